@@ -9,6 +9,7 @@
 #include <cstring>
 
 #include "common/goal_constants.h"
+#include "common/util/Assert.h"
 #include "common/util/Timer.h"
 
 #include "fmt/core.h"
@@ -17,6 +18,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <sys/mman.h>
 #include <sys/prctl.h>
 #include <sys/ptrace.h>
 #include <sys/stat.h>
@@ -301,6 +303,103 @@ bool cont_now(const ThreadID& tid) {
   return true;
 }
 
+
+namespace {
+constexpr u64 SOFT_DIRTY_BIT = 1ull << 55;
+
+/*!
+ * Read the /proc/pid/pagemap entries for some pages, starting at a host address.
+ */
+bool read_pagemap(pid_t pid, uintptr_t host_addr, u32 page_count, std::vector<u64>* entries) {
+  int fd = open(fmt::format("/proc/{}/pagemap", pid).c_str(), O_RDONLY);
+  if (fd < 0) {
+    printf("[Debugger] Failed to open pagemap: %s.\n", strerror(errno));
+    return false;
+  }
+  entries->resize(page_count);
+  off_t offset = (host_addr / DIRTY_PAGE_SIZE) * sizeof(u64);
+  ssize_t expected = page_count * sizeof(u64);
+  bool ok = pread(fd, entries->data(), expected, offset) == expected;
+  close(fd);
+  if (!ok) {
+    printf("[Debugger] Failed to read pagemap: %s.\n", strerror(errno));
+  }
+  return ok;
+}
+}  // namespace
+
+/*!
+ * Soft-dirty bits need CONFIG_MEM_SOFT_DIRTY. Without it, pages are just never reported as dirty,
+ * so check that it works by writing to a page of our own.
+ */
+bool dirty_page_tracking_supported() {
+  static int supported = -1;
+  if (supported >= 0) {
+    return supported;
+  }
+  supported = 0;
+  auto* page = (volatile u8*)mmap(nullptr, DIRTY_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (page == MAP_FAILED) {
+    return false;
+  }
+  page[0] = 1;
+  std::vector<u64> entries;
+  if (clear_dirty_pages(ThreadID(getpid()))) {
+    page[0] = 2;
+    if (read_pagemap(getpid(), (uintptr_t)page, 1, &entries)) {
+      supported = (entries[0] & SOFT_DIRTY_BIT) != 0;
+    }
+  }
+  munmap(const_cast<u8*>(page), DIRTY_PAGE_SIZE);
+  if (!supported) {
+    printf("[Debugger] Soft-dirty page tracking is not available, diffs will read all memory.\n");
+  }
+  return supported;
+}
+
+/*!
+ * Clear the soft-dirty bits for all pages of the target. Note that this is for the whole process.
+ */
+bool clear_dirty_pages(const ThreadID& tid) {
+  int fd = open(fmt::format("/proc/{}/clear_refs", tid.id).c_str(), O_WRONLY);
+  if (fd < 0) {
+    printf("[Debugger] Failed to open clear_refs: %s.\n", strerror(errno));
+    return false;
+  }
+  // 4 = clear soft-dirty bits
+  bool ok = write(fd, "4", 1) == 1;
+  if (!ok) {
+    printf("[Debugger] Failed to clear soft-dirty bits: %s.\n", strerror(errno));
+  }
+  close(fd);
+  return ok;
+}
+
+/*!
+ * Get the GOAL addresses of the pages in the given range that were written since the last
+ * clear_dirty_pages. This uses the soft-dirty bit in /proc/pid/pagemap.
+ */
+bool get_dirty_pages(u32 goal_addr,
+                     u32 size,
+                     const DebugContext& context,
+                     std::vector<u32>* dirty_page_addrs) {
+  ASSERT((goal_addr % DIRTY_PAGE_SIZE) == 0 && (context.base % DIRTY_PAGE_SIZE) == 0);
+  u32 page_count = (size + DIRTY_PAGE_SIZE - 1) / DIRTY_PAGE_SIZE;
+  std::vector<u64> entries;
+  if (!read_pagemap(context.tid.id, context.base + goal_addr, page_count, &entries)) {
+    return false;
+  }
+
+  dirty_page_addrs->clear();
+  for (u32 i = 0; i < page_count; i++) {
+    if (entries[i] & SOFT_DIRTY_BIT) {
+      dirty_page_addrs->push_back(goal_addr + i * DIRTY_PAGE_SIZE);
+    }
+  }
+  return true;
+}
+
 #elif _WIN32
 
 ThreadID::ThreadID(DWORD _pid, DWORD _tid) : pid(_pid), tid(_tid) {}
@@ -682,6 +781,21 @@ bool set_regs_now(const ThreadID& tid, const Regs& out) {
   // todo, set fprs.
   return true;
 }
+
+// GetWriteWatch only works on memory of the calling process, so the debugger can't use it.
+bool dirty_page_tracking_supported() {
+  return false;
+}
+
+bool clear_dirty_pages(const ThreadID& tid) {
+  (void)tid;
+  return false;
+}
+
+bool get_dirty_pages(u32, u32, const DebugContext&, std::vector<u32>*) {
+  return false;
+}
+
 #elif __APPLE__
 ThreadID::ThreadID(const std::string& str) {}
 
@@ -737,6 +851,19 @@ bool write_goal_memory(const u8* src_buffer,
 bool check_stopped(const ThreadID& tid, SignalInfo* out) {
   return false;
 }
+
+bool dirty_page_tracking_supported() {
+  return false;
+}
+
+bool clear_dirty_pages(const ThreadID& tid) {
+  (void)tid;
+  return false;
+}
+
+bool get_dirty_pages(u32, u32, const DebugContext&, std::vector<u32>*) {
+  return false;
+}
 #endif
 
 const char* gpr_names[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
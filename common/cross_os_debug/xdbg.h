@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "common/common_types.h"
 
@@ -131,4 +132,13 @@ bool write_goal_value(T& value,
 
 bool check_stopped(const ThreadID& tid, SignalInfo* out);
 
+// Page level write tracking for the target's memory, used for memory snapshots.
+constexpr u32 DIRTY_PAGE_SIZE = 4096;
+bool dirty_page_tracking_supported();
+bool clear_dirty_pages(const ThreadID& tid);
+bool get_dirty_pages(u32 goal_addr,
+                     u32 size,
+                     const DebugContext& context,
+                     std::vector<u32>* dirty_page_addrs);
+
 }  // namespace xdbg
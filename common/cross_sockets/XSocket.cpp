@@ -18,9 +18,11 @@
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 
 #include "fmt/core.h"
 #include "common/log/log.h"
+#include "common/cross_sockets/XSocket.h"
 // clang-format on
 
 int open_socket(int af, int type, int protocol) {
@@ -163,6 +165,41 @@ int write_to_socket(int socket, const char* buf, int len) {
   return bytes_wrote;
 }
 
+/*!
+ * Write several buffers with a single send, without copying them together first.
+ * Like write_to_socket, this may write less than the total size and returns the bytes written.
+ */
+int write_to_socket_gather(int socket, const XSocketBuffer* bufs, int count) {
+  int bytes_wrote = 0;
+#ifdef OS_POSIX
+  std::vector<iovec> iov(count);
+  for (int i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<char*>(bufs[i].data);
+    iov[i].iov_len = bufs[i].len;
+  }
+  msghdr msg = {};
+  msg.msg_iov = iov.data();
+  msg.msg_iovlen = count;
+  bytes_wrote = sendmsg(socket, &msg, MSG_NOSIGNAL);
+#elif _WIN32
+  std::vector<WSABUF> wsa_bufs(count);
+  for (int i = 0; i < count; i++) {
+    wsa_bufs[i].buf = const_cast<char*>(bufs[i].data);
+    wsa_bufs[i].len = bufs[i].len;
+  }
+  DWORD sent = 0;
+  if (WSASend(socket, wsa_bufs.data(), count, &sent, 0, nullptr, nullptr) == 0) {
+    bytes_wrote = sent;
+  } else {
+    bytes_wrote = -1;
+  }
+#endif
+  if (bytes_wrote < 0) {
+    lg::error("[XSocket:{}] Error writing to socket", socket);
+  }
+  return bytes_wrote;
+}
+
 int read_from_socket(int socket, char* buf, int len) {
 #ifdef OS_POSIX
   return read(socket, buf, len);
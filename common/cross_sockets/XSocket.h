@@ -42,6 +42,12 @@ void close_socket(int sock);
 int set_socket_option(int socket, int level, int optname, const void* optval, int optlen);
 int set_socket_timeout(int socket, long microSeconds);
 int write_to_socket(int socket, const char* buf, int len);
+
+struct XSocketBuffer {
+  const char* data;
+  int len;
+};
+int write_to_socket_gather(int socket, const XSocketBuffer* bufs, int count);
 int read_from_socket(int socket, char* buf, int len);
 bool socket_timed_out();
 std::string address_to_string(const sockaddr_in& addr);
@@ -85,7 +85,7 @@ bool XSocketServer::init_server(bool failure_may_occur) {
     return false;
   }
 
-  if (listen(listening_socket, 0) < 0) {
+  if (listen(listening_socket, listen_backlog) < 0) {
     if (failure_may_occur) {
       lg::debug("[XSocketServer:{}] failed to listen", tcp_port);
     } else {
@@ -31,6 +31,8 @@ class XSocketServer {
   int tcp_port;
   struct sockaddr_in addr = {};
   int listening_socket = -1;
+  // connections that can wait to be accepted
+  int listen_backlog = 0;
   std::vector<char> buffer;
 
   bool server_initialized = false;
@@ -0,0 +1,195 @@
+#include "Fr3File.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "common/util/MappedFile.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/compress.h"
+
+#include "fmt/core.h"
+
+namespace tfrag3 {
+namespace {
+// the first 8 bytes of an original format file are the decompressed size, so a file starting with
+// the magic and version would have to be ~10 GB to be ambiguous.
+constexpr u32 kBlockFormatMagic = 0x42335246;  // "FR3B"
+constexpr u32 kBlockFormatVersion = 2;
+constexpr size_t kBlockSize = 1024 * 1024;
+constexpr size_t kBlockAlignment = 4096;
+
+struct BlockFileHeader {
+  u32 magic;
+  u32 format_version;
+  u64 decompressed_size;
+  u64 block_count;
+};
+
+struct BlockInfo {
+  u64 offset;       // from the start of the file, aligned to kBlockAlignment
+  u64 stored_size;  // size in the file
+  u64 size;         // decompressed size, the same as stored_size if the block isn't compressed
+
+  bool compressed() const { return stored_size != size; }
+};
+
+size_t align_up(size_t offset) {
+  return (offset + kBlockAlignment - 1) & ~(kBlockAlignment - 1);
+}
+
+bool is_block_format(const MappedFile& file) {
+  if (file.size() < sizeof(BlockFileHeader)) {
+    return false;
+  }
+  BlockFileHeader header;
+  memcpy(&header, file.data(), sizeof(BlockFileHeader));
+  return header.magic == kBlockFormatMagic && header.format_version == kBlockFormatVersion;
+}
+
+/*!
+ * Reads the blocks of a mapped file in order. Uncompressed blocks are copied straight out of the
+ * mapping, and compressed blocks are decompressed directly into the destination when a load covers
+ * the whole block.
+ */
+class BlockReader {
+ public:
+  BlockReader(const MappedFile& file, const std::vector<BlockInfo>& blocks)
+      : m_file(file), m_blocks(blocks) {}
+
+  void read(void* dst, size_t size) {
+    u8* out = (u8*)dst;
+    while (size > 0) {
+      if (m_pos == m_current_size) {
+        ASSERT(m_next_block < m_blocks.size());
+        const auto& block = m_blocks[m_next_block++];
+        const u8* stored = m_file.data() + block.offset;
+        m_pos = 0;
+        if (!block.compressed()) {
+          m_current = stored;
+          m_current_size = block.size;
+        } else if (size >= block.size) {
+          compression::decompress_zstd_no_header(stored, block.stored_size, out, block.size);
+          out += block.size;
+          size -= block.size;
+          m_current_size = 0;
+          continue;
+        } else {
+          m_buffer.resize(block.size);
+          compression::decompress_zstd_no_header(stored, block.stored_size, m_buffer.data(),
+                                                 block.size);
+          m_current = m_buffer.data();
+          m_current_size = block.size;
+        }
+      }
+      size_t count = std::min(size, m_current_size - m_pos);
+      memcpy(out, m_current + m_pos, count);
+      m_pos += count;
+      out += count;
+      size -= count;
+    }
+  }
+
+ private:
+  const MappedFile& m_file;
+  const std::vector<BlockInfo>& m_blocks;
+  std::vector<u8> m_buffer;
+  size_t m_next_block = 0;
+  const u8* m_current = nullptr;
+  size_t m_current_size = 0;
+  size_t m_pos = 0;
+};
+
+void read_block_format(const fs::path& path, const MappedFile& file, Level& level) {
+  BlockFileHeader header;
+  memcpy(&header, file.data(), sizeof(BlockFileHeader));
+  const size_t table_end = sizeof(BlockFileHeader) + header.block_count * sizeof(BlockInfo);
+  if (table_end > file.size()) {
+    throw std::runtime_error(fmt::format("fr3 file {} has an invalid block table", path.string()));
+  }
+
+  std::vector<BlockInfo> blocks(header.block_count);
+  memcpy(blocks.data(), file.data() + sizeof(BlockFileHeader), blocks.size() * sizeof(BlockInfo));
+  size_t total_size = 0;
+  for (auto& block : blocks) {
+    if (block.offset + block.stored_size > file.size()) {
+      throw std::runtime_error(fmt::format("fr3 file {} is truncated", path.string()));
+    }
+    total_size += block.size;
+  }
+  if (total_size != header.decompressed_size) {
+    throw std::runtime_error(fmt::format("fr3 file {} has an invalid block table", path.string()));
+  }
+
+  if (blocks.size() == 1 && !blocks[0].compressed()) {
+    // the whole level is in one piece in the mapping, no need to copy the file at all.
+    Serializer ser(file.data() + blocks[0].offset, blocks[0].size, false);
+    level.serialize(ser);
+    return;
+  }
+
+  BlockReader reader(file, blocks);
+  Serializer ser([&](void* dst, size_t size) { reader.read(dst, size); }, header.decompressed_size);
+  level.serialize(ser);
+}
+}  // namespace
+
+std::vector<u8> make_fr3_file(const u8* data, size_t size, Fr3Format format) {
+  if (format == Fr3Format::ZSTD) {
+    return compression::compress_zstd(data, size);
+  }
+
+  size_t block_size = kBlockSize;
+  if (format == Fr3Format::UNCOMPRESSED) {
+    // a single block, so it can be loaded in place.
+    block_size = std::max(size, size_t(1));
+  }
+  const size_t block_count = (size + block_size - 1) / block_size;
+  std::vector<BlockInfo> blocks(block_count);
+  std::vector<std::vector<u8>> block_data(block_count);
+  // the blocks are independent, so they're compressed in parallel.
+  ThreadPool::global().parallel_for(block_count, [&](int i) {
+    const size_t offset = i * block_size;
+    const size_t len = std::min(block_size, size - offset);
+    auto& stored = block_data[i];
+    if (format == Fr3Format::BLOCKS) {
+      stored = compression::compress_zstd_no_header(data + offset, len);
+    }
+    if (format == Fr3Format::UNCOMPRESSED || stored.size() >= len) {
+      // doesn't compress, keep it as is.
+      stored.assign(data + offset, data + offset + len);
+    }
+    blocks[i] = {0, stored.size(), len};
+  });
+
+  size_t file_size = sizeof(BlockFileHeader) + blocks.size() * sizeof(BlockInfo);
+  for (auto& block : blocks) {
+    block.offset = align_up(file_size);
+    file_size = block.offset + block.stored_size;
+  }
+
+  std::vector<u8> result(file_size);
+  BlockFileHeader header = {kBlockFormatMagic, kBlockFormatVersion, size, blocks.size()};
+  memcpy(result.data(), &header, sizeof(BlockFileHeader));
+  memcpy(result.data() + sizeof(BlockFileHeader), blocks.data(), blocks.size() * sizeof(BlockInfo));
+  for (size_t i = 0; i < blocks.size(); i++) {
+    memcpy(result.data() + blocks[i].offset, block_data[i].data(), blocks[i].stored_size);
+  }
+  return result;
+}
+
+void read_fr3_file(const fs::path& path, Level& level) {
+  MappedFile file(path);
+  if (is_block_format(file)) {
+    read_block_format(path, file, level);
+    return;
+  }
+
+  // original format, decompress it as a stream.
+  compression::ZstdFileReader reader(path);
+  Serializer ser([&](void* dst, size_t size) { reader.read(dst, size); },
+                 reader.decompressed_size());
+  level.serialize(ser);
+}
+
+}  // namespace tfrag3
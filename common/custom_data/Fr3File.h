@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/custom_data/Tfrag3Data.h"
+#include "common/util/FileUtil.h"
+
+namespace tfrag3 {
+
+/*!
+ * On-disk layouts for .fr3 files. All of them hold the same Level::serialize data.
+ *
+ * ZSTD is the original format: one zstd frame after an 8-byte decompressed size header.
+ *
+ * The block formats have a header and a table of blocks, so the loader can memory map the file and
+ * read it without a heap copy. Blocks start at page-aligned offsets and are each either stored as
+ * is, or compressed with zstd on their own. UNCOMPRESSED stores the data as a single block, so the
+ * level can be deserialized directly out of the mapping with no decompression at all.
+ */
+enum class Fr3Format { ZSTD, BLOCKS, UNCOMPRESSED };
+
+/*!
+ * Build the contents of an .fr3 file from serialized level data.
+ */
+std::vector<u8> make_fr3_file(const u8* data, size_t size, Fr3Format format = Fr3Format::BLOCKS);
+
+/*!
+ * Read an .fr3 file in any of the formats into a level.
+ */
+void read_fr3_file(const fs::path& path, Level& level);
+
+}  // namespace tfrag3
@@ -347,8 +347,27 @@ void ShrubTree::unpack() {
   ASSERT(i == unpacked.vertices.size());
 }
 
-void TfragTree::unpack() {
-  unpacked.vertices.resize(packed_vertices.vertices.size());
+void TfragTree::unpack(bool for_gpu) {
+  if (for_gpu) {
+    unpacked.gpu_vertices.resize(packed_vertices.vertices.size());
+    for (size_t i = 0; i < unpacked.gpu_vertices.size(); i++) {
+      auto& o = unpacked.gpu_vertices[i];
+      auto& in = packed_vertices.vertices[i];
+      auto& cluster = packed_vertices.cluster_origins.at(in.cluster_idx);
+      o.cluster[0] = cluster.x();
+      o.cluster[1] = cluster.y();
+      o.cluster[2] = cluster.z();
+      o.off[0] = in.xoff;
+      o.off[1] = in.yoff;
+      o.off[2] = in.zoff;
+      o.s = in.s;
+      o.t = in.t;
+      o.color_index = in.color_index;
+      o.pad = 0;
+    }
+  }
+
+  unpacked.vertices.resize(for_gpu ? 0 : packed_vertices.vertices.size());
   for (size_t i = 0; i < unpacked.vertices.size(); i++) {
     auto& o = unpacked.vertices[i];
     auto& in = packed_vertices.vertices[i];
@@ -477,6 +496,8 @@ void Texture::serialize(Serializer& ser) {
   ser.from_ptr(&h);
   ser.from_ptr(&combo_id);
   ser.from_pod_vector(&data);
+  ser.from_pod_vector(&compressed_data);
+  ser.from_ptr(&compressed_format);
   ser.from_str(&debug_name);
   ser.from_str(&debug_tpage_name);
   ser.from_ptr(&load_to_pool);
@@ -755,7 +776,7 @@ void TfragTree::memory_usage(MemoryUsageTracker* tracker) const {
 }
 
 void Texture::memory_usage(MemoryUsageTracker* tracker) const {
-  tracker->add(MemoryUsageCategory::TEXTURE, data.size() * sizeof(u32));
+  tracker->add(MemoryUsageCategory::TEXTURE, data.size() * sizeof(u32) + compressed_data.size());
 }
 
 void IndexTexture::memory_usage(MemoryUsageTracker* tracker) const {
@@ -857,16 +878,38 @@ void print_memory_usage(const tfrag3::Level& lev, int uncompressed_data_size) {
   }
 }
 
+namespace {
+// combine hashes so the fields aren't interchangeable, unlike xor: (1, 2) and (2, 1) are different
+// vertices, and (1, 1) shouldn't hash the same as (0, 0).
+template <typename T>
+void hash_combine(std::size_t& seed, const T& val) {
+  seed ^= std::hash<T>()(val) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}  // namespace
+
 std::size_t PreloadedVertex::hash::operator()(const PreloadedVertex& v) const {
-  return std::hash<float>()(v.x) ^ std::hash<float>()(v.y) ^ std::hash<float>()(v.z) ^
-         std::hash<float>()(v.s) ^ std::hash<float>()(v.t) ^ std::hash<u16>()(v.color_index);
+  std::size_t result = 0;
+  hash_combine(result, v.x);
+  hash_combine(result, v.y);
+  hash_combine(result, v.z);
+  hash_combine(result, v.s);
+  hash_combine(result, v.t);
+  hash_combine(result, v.color_index);
+  return result;
 }
 
 std::size_t PackedTieVertices::Vertex::hash::operator()(const Vertex& v) const {
-  return std::hash<float>()(v.x) ^ std::hash<float>()(v.y) ^ std::hash<float>()(v.z) ^
-         std::hash<float>()(v.r) ^ std::hash<float>()(v.g) ^ std::hash<float>()(v.b) ^
-         std::hash<float>()(v.a) ^ std::hash<float>()(v.s) ^ std::hash<float>()(v.t) ^
-         std::hash<float>()(v.nx) ^ std::hash<float>()(v.ny) ^ std::hash<float>()(v.nz);
+  std::size_t result = 0;
+  for (auto field : {v.x, v.y, v.z, v.s, v.t}) {
+    hash_combine(result, field);
+  }
+  for (auto field : {v.r, v.g, v.b, v.a}) {
+    hash_combine(result, field);
+  }
+  for (auto field : {v.nx, v.ny, v.nz}) {
+    hash_combine(result, field);
+  }
+  return result;
 }
 
 }  // namespace tfrag3
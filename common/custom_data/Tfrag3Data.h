@@ -6,6 +6,7 @@
 #include "common/common_types.h"
 #include "common/dma/gs.h"
 #include "common/math/Vector.h"
+#include "common/texture/texture_compression.h"
 #include "common/util/Assert.h"
 #include "common/util/Serializer.h"
 
@@ -18,7 +19,7 @@ namespace tfrag3 {
 // - if changing any large things (vertices, vis, bvh, colors, textures) update get_memory_usage
 // - if adding a new category to the memory usage, update extract_level to print it.
 
-constexpr int TFRAG3_VERSION = 43;
+constexpr int TFRAG3_VERSION = 44;
 
 enum MemoryUsageCategory {
   TEXTURE,
@@ -155,6 +156,17 @@ struct PackedTfragVertices {
   std::vector<math::Vector<u16, 3>> cluster_origins;
 };
 
+// The tfrag vertex the renderer uploads. The position stays quantized in its cluster, with the
+// cluster's origin copied into each vertex, and tfrag3.vert does the same math as unpack().
+struct TfragGpuVertex {
+  u16 cluster[3];
+  u16 off[3];
+  s16 s, t;
+  u16 color_index;
+  u16 pad;
+};
+static_assert(sizeof(TfragGpuVertex) == 20, "TfragGpuVertex size");
+
 struct ShrubGpuVertex {
   float x, y, z;
   float s, t;
@@ -308,10 +320,14 @@ struct PackedTimeOfDay {
 struct Texture {
   u16 w, h;
   u32 combo_id = 0;
-  std::vector<u32> data;
+  std::vector<u32> data;  // RGBA8888, empty if compressed
+  // if compressed, the full mip chain (largest first) in compressed_format.
+  std::vector<u8> compressed_data;
+  BcFormat compressed_format = BcFormat::BC1;
   std::string debug_name;
   std::string debug_tpage_name;
   bool load_to_pool = false;
+  bool is_compressed() const { return !compressed_data.empty(); }
   void serialize(Serializer& ser);
   void memory_usage(MemoryUsageTracker* tracker) const;
 };
@@ -344,10 +360,11 @@ struct TfragTree {
   bool use_strips = true;
 
   struct {
-    std::vector<PreloadedVertex> vertices;  // mesh vertices
+    std::vector<PreloadedVertex> vertices;     // mesh vertices
+    std::vector<TfragGpuVertex> gpu_vertices;  // mesh vertices, if unpacked for the renderer
     std::vector<u32> indices;
   } unpacked;
-  void unpack();
+  void unpack(bool for_gpu = false);
   void serialize(Serializer& ser);
   void memory_usage(MemoryUsageTracker* tracker) const;
 };
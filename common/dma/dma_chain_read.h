@@ -123,6 +123,7 @@ class DmaFollower {
   VifCode current_tag_vifcode0() const { return VifCode(current_tag_vif0()); }
   VifCode current_tag_vifcode1() const { return VifCode(current_tag_vif1()); }
   u32 current_tag_offset() const { return m_tag_offset; }
+  const void* base() const { return m_base; }
   bool ended() const { return m_ended; }
 
  private:
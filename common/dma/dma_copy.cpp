@@ -1,6 +1,8 @@
 
 #include "dma_copy.h"
 
+#include <cstring>
+
 #include "common/dma/dma_chain_read.h"
 #include "common/goal_constants.h"
 #include "common/log/log.h"
@@ -8,6 +10,12 @@
 
 #include "fmt/core.h"
 
+#ifdef __aarch64__
+#include <arm_acle.h>
+#else
+#include <immintrin.h>
+#endif
+
 /*!
  * Convert a DMA chain to an array of bytes that can be directly fed to VIF.
  */
@@ -65,9 +73,34 @@ void diff_dma_chains(DmaFollower ref, DmaFollower dma) {
   }
 }
 
+namespace {
+/*!
+ * Hash of a chunk, for checking if it changed. Four independent crc32c's, so it isn't limited by
+ * the latency of the crc instruction, and runs at about the speed of reading the memory.
+ */
+u64 hash_chunk(const u8* data, u32 size) {
+  u32 h[4] = {0, 0, 0, 0};
+  for (u32 i = 0; i < size; i += 32) {
+    u64 words[4];
+    memcpy(words, data + i, 32);
+    for (int j = 0; j < 4; j++) {
+#ifdef __aarch64__
+      h[j] = __crc32cd(h[j], words[j]);
+#else
+      h[j] = _mm_crc32_u64(h[j], words[j]);
+#endif
+    }
+  }
+  return (u64(h[0]) | (u64(h[1]) << 32)) ^ ((u64(h[2]) << 16) | (u64(h[3]) << 48));
+}
+}  // namespace
+
 void FixedChunkDmaCopier::serialize_last_result(Serializer& serializer) {
   serializer.from_ptr(&m_result.start_offset);
   serializer.from_pod_vector(&m_result.data);
+  if (serializer.is_loading()) {
+    m_result.chunk_sources.clear();
+  }
 }
 
 FixedChunkDmaCopier::FixedChunkDmaCopier(u32 main_memory_size)
@@ -92,7 +125,6 @@ const DmaData& FixedChunkDmaCopier::run(const void* memory, u32 offset, bool ver
   m_input_data = memory;
   std::fill(m_chunk_mask.begin(), m_chunk_mask.end(), false);
   m_fixups.clear();
-  m_result.data.clear();
   m_result.stats = DmaStats();
   m_result.start_offset = 0;
 
@@ -147,25 +179,57 @@ const DmaData& FixedChunkDmaCopier::run(const void* memory, u32 offset, bool ver
     }
   }
 
+  // every chunk is either copied or reused, so the old data doesn't need to be cleared.
   m_result.data.resize(current_out_chunk * chunk_size);
   m_result.stats.num_chunks = current_out_chunk;
-  m_result.stats.num_copied_bytes = m_result.data.size();
   m_result.stats.num_fixups = m_fixups.size();
 
   // copy
+  u32 previous_chunk_count = m_incremental ? m_result.chunk_sources.size() : 0;
+  m_result.chunk_sources.resize(m_incremental ? current_out_chunk : 0);
+  m_result.chunk_hashes.resize(m_incremental ? current_out_chunk : 0);
+  m_chunk_reused.assign(current_out_chunk, false);
+  u32 copied_chunks = 0;
   for (u32 chunk_idx = 0; chunk_idx < m_chunk_mask.size(); chunk_idx++) {
     u32 dest_idx = m_chunk_mask[chunk_idx];
-    if (dest_idx != UINT32_MAX) {
-      memcpy(m_result.data.data() + (dest_idx * chunk_size),
-             (const u8*)memory + (chunk_idx * chunk_size), chunk_size);
+    if (dest_idx == UINT32_MAX) {
+      continue;
+    }
+    const u8* src = (const u8*)memory + (chunk_idx * chunk_size);
+    if (m_incremental) {
+      u64 hash = hash_chunk(src, chunk_size);
+      if (dest_idx < previous_chunk_count && m_result.chunk_sources[dest_idx] == chunk_idx &&
+          m_result.chunk_hashes[dest_idx] == hash) {
+        m_chunk_reused[dest_idx] = true;
+        continue;
+      }
+      m_result.chunk_sources[dest_idx] = chunk_idx;
+      m_result.chunk_hashes[dest_idx] = hash;
     }
+    memcpy(m_result.data.data() + (dest_idx * chunk_size), src, chunk_size);
+    copied_chunks++;
   }
+  m_result.stats.num_copied_bytes = copied_chunks * chunk_size;
+
+  // a reused chunk still has the last run's fixups. Put the original addresses back, in case this
+  // chain doesn't fix up the same tags.
+  for (u32 fixup : m_result.fixup_offsets) {
+    u32 dest_idx = fixup / chunk_size;
+    if (dest_idx < current_out_chunk && m_chunk_reused[dest_idx]) {
+      u32 src_offset = m_result.chunk_sources[dest_idx] * chunk_size + fixup % chunk_size;
+      memcpy(m_result.data.data() + fixup, (const u8*)memory + src_offset, 4);
+    }
+  }
+  m_result.fixup_offsets.clear();
 
   // fix up!
   for (const auto& fu : m_fixups) {
     u32 tag_addr = m_chunk_mask.at(fu.source_chunk) * chunk_size + fu.offset_in_source_chunk + 4;
     u32 dest_addr = m_chunk_mask.at(fu.dest_chunk) * chunk_size + fu.offset_in_dest_chunk;
     memcpy(m_result.data.data() + tag_addr, &dest_addr, 4);
+    if (m_incremental) {
+      m_result.fixup_offsets.push_back(tag_addr);
+    }
   }
 
   // setup final offset
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
@@ -10,12 +11,22 @@ struct DmaData {
   u32 start_offset = 0;
   std::vector<u8> data;
   DmaStats stats;
+
+  // Set by an incremental FixedChunkDmaCopier: where each chunk of data was copied from, and a hash
+  // of the source at the time, so the copy can be skipped if the source hasn't changed.
+  std::vector<u32> chunk_sources;
+  std::vector<u64> chunk_hashes;
+  std::vector<u32> fixup_offsets;  // offsets of the addresses in data that were fixed up
 };
 
 /*!
  * The fixed chunk copier considers the game's main memory as an array of fixed sized chunks.
  * Only the chunks that have dma data are included in the copy.
  * The result is cached internally.
+ *
+ * In incremental mode, each chunk is hashed first, and isn't copied if the result already has the
+ * same chunk from the last run that used it. Hashing only reads the chunk, so this is a win when
+ * most chunks don't change, and a loss when they all do.
  */
 class FixedChunkDmaCopier {
  public:
@@ -23,12 +34,15 @@ class FixedChunkDmaCopier {
   FixedChunkDmaCopier(u32 main_memory_size);
 
   void set_input_data(const void* memory, u32 offset, bool run);
+  void set_incremental(bool incremental) { m_incremental = incremental; }
 
   const DmaData& run(const void* memory, u32 offset, bool verify = false);
 
   void serialize_last_result(Serializer& serializer);
 
   const DmaData& get_last_result() const { return m_result; }
+  // exchange the last result with other, to keep it without copying it. Reuses other's buffer.
+  void swap_last_result(DmaData* other) { std::swap(m_result, *other); }
 
   const void* get_last_input_data() const { return m_input_data; }
   u32 get_last_input_offset() const { return m_input_offset; }
@@ -45,7 +59,9 @@ class FixedChunkDmaCopier {
   u32 m_main_memory_size = 0;
   u32 m_chunk_count = 0;
   std::vector<u32> m_chunk_mask;
+  std::vector<u8> m_chunk_reused;  // for each output chunk, if the copy was skipped
   DmaData m_result;
+  bool m_incremental = false;
 
   u32 m_input_offset = 0;
   const void* m_input_data = nullptr;
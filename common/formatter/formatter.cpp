@@ -33,21 +33,6 @@ int hang_indentation_width(const FormatterTreeNode& curr_node) {
   return 1 + hang_indentation_width(first_elt);
 }
 
-int get_total_form_inlined_width(const FormatterTreeNode& curr_node) {
-  if (curr_node.token) {
-    return curr_node.token->length();
-  }
-  int width = 1;
-  for (int i = 0; i < curr_node.refs.size(); i++) {
-    width += get_total_form_inlined_width(curr_node.refs.at(i));
-    if (i != curr_node.refs.size() - 1) {
-      width += 1;  // add the space between elements
-    }
-  }
-  return width + 1;
-}
-
-// TODO - compute length of each node and store it AOT
 void apply_formatting_config(
     FormatterTreeNode& curr_node,
     std::optional<std::shared_ptr<formatter_rules::config::FormFormattingConfig>>
@@ -188,7 +173,7 @@ void apply_formatting_config(
       }
       for (const auto& field : curr_node.refs) {
         if ((int)field.refs.size() > col) {
-          const auto width = get_total_form_inlined_width(field.refs.at(col));
+          const auto width = field.refs.at(col).inlined_width;
           if (width > column_max_widths.at(col)) {
             column_max_widths[col] = width;
           }
@@ -203,38 +188,23 @@ void apply_formatting_config(
   }
 }
 
-bool form_contains_comment(const FormatterTreeNode& curr_node) {
-  if (curr_node.metadata.is_comment) {
-    return true;
-  }
-  for (const auto& ref : curr_node.refs) {
-    const auto contains_comment = form_contains_comment(ref);
-    if (contains_comment) {
-      return true;
-    }
-  }
-  return false;
-}
-
-bool form_contains_node_that_prevents_inlining(const FormatterTreeNode& curr_node) {
-  if (curr_node.formatting_config.should_prevent_inlining(curr_node.formatting_config,
-                                                          curr_node.refs.size())) {
-    return true;
-  }
-  for (const auto& ref : curr_node.refs) {
-    const auto prevents_inlining = form_contains_node_that_prevents_inlining(ref);
-    if (prevents_inlining) {
-      return true;
-    }
+// Once the configs are final, find which forms contain a node that prevents inlining, children
+// first. Checking this while printing would walk every subtree again at each level.
+void compute_inlining_info(FormatterTreeNode& curr_node) {
+  bool prevents_inlining = curr_node.formatting_config.should_prevent_inlining(
+      curr_node.formatting_config, curr_node.refs.size());
+  for (auto& ref : curr_node.refs) {
+    compute_inlining_info(ref);
+    prevents_inlining = prevents_inlining || ref.contains_node_that_prevents_inlining;
   }
-  return false;
+  curr_node.contains_node_that_prevents_inlining = prevents_inlining;
 }
 
 bool can_node_be_inlined(const FormatterTreeNode& curr_node, int cursor_pos) {
   using namespace formatter_rules;
   if (curr_node.formatting_config.force_inline) {
     // Ensure there are no comments, this still trumps this
-    if (form_contains_comment(curr_node)) {
+    if (curr_node.contains_comment) {
       return false;
     }
     return true;
@@ -245,11 +215,11 @@ bool can_node_be_inlined(const FormatterTreeNode& curr_node, int cursor_pos) {
   }
   // If the config explicitly prevents inlining, or it contains a sub-node that prevents inlining
   if (curr_node.formatting_config.prevent_inlining ||
-      form_contains_node_that_prevents_inlining(curr_node)) {
+      curr_node.contains_node_that_prevents_inlining) {
     return false;
   }
   // nor can we inline something that contains a comment in the middle
-  if (form_contains_comment(curr_node)) {
+  if (curr_node.contains_comment) {
     return false;
   }
   // constant pairs are not inlined!
@@ -260,9 +230,8 @@ bool can_node_be_inlined(const FormatterTreeNode& curr_node, int cursor_pos) {
   if (curr_node.formatting_config.inline_until_index({})) {
     return false;
   }
-  // let's see if we can inline the form all on one line to do that, we recursively explore
-  // the form to find the total width
-  int line_width = cursor_pos + get_total_form_inlined_width(curr_node);
+  // let's see if we can inline the form all on one line
+  int line_width = cursor_pos + curr_node.inlined_width;
   return line_width <= indent::line_width_target;  // TODO - comments
 }
 
@@ -317,12 +286,13 @@ std::vector<std::string> apply_formatting(const FormatterTreeNode& curr_node,
     } else {
       // If it's not a token, we have to recursively build up the form
       // TODO - add the cursor_pos here
-      const auto& lines = apply_formatting(ref, {}, cursor_pos);
-      for (int i = 0; i < (int)lines.size(); i++) {
-        const auto& line = lines.at(i);
-        form_lines.push_back(fmt::format(
-            "{}{}", str_util::repeat(ref.formatting_config.parent_mutable_extra_indent, " "),
-            line));
+      auto lines = apply_formatting(ref, {}, cursor_pos);
+      const auto extra_indent = ref.formatting_config.parent_mutable_extra_indent;
+      for (auto& line : lines) {
+        if (extra_indent > 0) {
+          line.insert(0, extra_indent, ' ');
+        }
+        form_lines.push_back(std::move(line));
       }
     }
     // If we are hanging forms, combine the first two forms onto the same line
@@ -381,13 +351,13 @@ std::vector<std::string> apply_formatting(const FormatterTreeNode& curr_node,
   // TODO there is a hack here so that multi-line forms that are consolidated still line up properly
   // i have to make consolidate a more first-class feature of the config
   // TODO - hacky, but prevents a bad situation, clean up
-  if (curr_node.formatting_config.inline_until_index(form_lines) &&
-      !str_util::contains(form_lines.at(0), ";")) {
+  const auto inline_until_index = curr_node.formatting_config.inline_until_index(form_lines);
+  if (inline_until_index && !str_util::contains(form_lines.at(0), ";")) {
     std::vector<std::string> new_form_lines = {};
     const auto original_form_head_width = str_util::split(form_lines.at(0), '\n').at(0).length();
     bool consolidating_lines = true;
     for (int i = 0; i < (int)form_lines.size(); i++) {
-      if (i < curr_node.formatting_config.inline_until_index(form_lines)) {
+      if (i < inline_until_index) {
         if (new_form_lines.empty()) {
           new_form_lines.push_back(form_lines.at(i));
         } else {
@@ -403,7 +373,7 @@ std::vector<std::string> apply_formatting(const FormatterTreeNode& curr_node,
         }
       }
     }
-    form_lines = new_form_lines;
+    form_lines = std::move(new_form_lines);
   }
 
   // Add any column padding
@@ -432,11 +402,15 @@ std::vector<std::string> apply_formatting(const FormatterTreeNode& curr_node,
     // NOTE - not sure about this, if we are inlining a form, it always makes sense to eliminate
     // trailing whitespace the only issue i can foresee is related to strings that span multiple
     // lines.
-    std::vector<std::string> new_form_lines = {};
-    for (const auto& form_line : form_lines) {
-      new_form_lines.push_back(str_util::ltrim(form_line));
+    std::string inlined_line;
+    inlined_line.reserve(curr_node.inlined_width + 1);
+    for (int i = 0; i < (int)form_lines.size(); i++) {
+      if (i > 0) {
+        inlined_line += ' ';
+      }
+      inlined_line += str_util::ltrim(form_lines.at(i));
     }
-    form_lines = {fmt::format("{}", fmt::join(new_form_lines, " "))};
+    form_lines = {std::move(inlined_line)};
   } else {
     bool currently_in_block_comment = false;
     for (int i = 0; i < (int)form_lines.size(); i++) {
@@ -461,7 +435,19 @@ std::vector<std::string> apply_formatting(const FormatterTreeNode& curr_node,
 
 std::string join_formatted_lines(const std::vector<std::string>& lines,
                                  const std::string& line_ending) {
-  return fmt::format("{}", fmt::join(lines, line_ending));
+  size_t total_size = 0;
+  for (const auto& line : lines) {
+    total_size += line.size() + line_ending.size();
+  }
+  std::string result;
+  result.reserve(total_size);
+  for (size_t i = 0; i < lines.size(); i++) {
+    if (i > 0) {
+      result += line_ending;
+    }
+    result += lines[i];
+  }
+  return result;
 }
 
 std::optional<std::string> formatter::format_code(const std::string& source) {
@@ -493,6 +479,7 @@ std::optional<std::string> formatter::format_code(const std::string& source) {
     // 2. Recursively iterate through this simplified FormatterTree and figure out what rules
     // need to be applied to produce an optimal result
     apply_formatting_config(formatting_tree.root);
+    compute_inlining_info(formatting_tree.root);
     // 3. Use this updated FormatterTree to print out the final source-code, while doing so
     // we may deviate from the optimal result to produce something even more optimal by inlining
     // forms that can fit within the line width.
@@ -72,10 +72,34 @@ bool nodes_on_same_line(const std::string& source, const TSNode& n1, const TSNod
   return !str_util::contains(code_between, "\n");
 }
 
+// Fill in the width and comment info of every node, children first.
+void compute_subtree_info(FormatterTreeNode& node) {
+  if (node.token) {
+    node.inlined_width = node.token->length();
+    node.contains_comment = node.metadata.is_comment;
+    return;
+  }
+  // the parens, and a space between each element
+  int width = 2;
+  bool contains_comment = node.metadata.is_comment;
+  for (size_t i = 0; i < node.refs.size(); i++) {
+    auto& ref = node.refs[i];
+    compute_subtree_info(ref);
+    width += ref.inlined_width;
+    if (i != node.refs.size() - 1) {
+      width += 1;
+    }
+    contains_comment = contains_comment || ref.contains_comment;
+  }
+  node.inlined_width = width;
+  node.contains_comment = contains_comment;
+}
+
 FormatterTree::FormatterTree(const std::string& source, const TSNode& root_node) {
   root = FormatterTreeNode();
   root.metadata.is_top_level = true;
   construct_formatter_tree_recursive(source, root_node, root);
+  compute_subtree_info(root);
 }
 
 const std::unordered_map<std::string, std::vector<std::string>> node_type_ignorable_contents = {
@@ -90,7 +114,7 @@ void FormatterTree::construct_formatter_tree_recursive(const std::string& source
   if (ts_node_child_count(curr_node) == 0) {
     auto new_node = FormatterTreeNode(source, curr_node);
     new_node.node_prefix = node_prefix;
-    tree_node.refs.push_back(new_node);
+    tree_node.refs.push_back(std::move(new_node));
     return;
   }
   const std::string curr_node_type = ts_node_type(curr_node);
@@ -137,17 +161,21 @@ void FormatterTree::construct_formatter_tree_recursive(const std::string& source
     construct_formatter_tree_recursive(source, ts_node_child(curr_node, 1), tree_node, node_prefix);
     return;
   }
-  std::vector<std::string> skippable_nodes = {};
-  if (node_type_ignorable_contents.find(curr_node_type) != node_type_ignorable_contents.end()) {
-    skippable_nodes = node_type_ignorable_contents.at(curr_node_type);
-  }
+  static const std::vector<std::string> no_skippable_nodes = {};
+  const auto skippable_it = node_type_ignorable_contents.find(curr_node_type);
+  const auto& skippable_nodes = skippable_it != node_type_ignorable_contents.end()
+                                    ? skippable_it->second
+                                    : no_skippable_nodes;
   for (size_t i = 0; i < ts_node_child_count(curr_node); i++) {
     const auto child_node = ts_node_child(curr_node, i);
-    [[maybe_unused]] auto debug_child = ts_node_string(child_node);
-    const auto contents = get_source_code(source, child_node);
+    // compare in place, copying out the source of every child would copy the whole file once per
+    // level of nesting
+    const uint32_t child_start = ts_node_start_byte(child_node);
+    const uint32_t child_length = ts_node_end_byte(child_node) - child_start;
     bool skip_node = false;
     for (const auto& skippable_content : skippable_nodes) {
-      if (skippable_content == contents) {
+      if (skippable_content.length() == child_length &&
+          source.compare(child_start, child_length, skippable_content) == 0) {
         skip_node = true;
         break;
       }
@@ -172,6 +200,6 @@ void FormatterTree::construct_formatter_tree_recursive(const std::string& source
     if (node_prefix && !list_node.node_prefix) {
       list_node.node_prefix = node_prefix;
     }
-    tree_node.refs.push_back(list_node);
+    tree_node.refs.push_back(std::move(list_node));
   }
 }
@@ -44,6 +44,13 @@ class FormatterTreeNode {
 
   formatter_rules::config::FormFormattingConfig formatting_config;
 
+  // Facts about the whole subtree, computed once so formatting doesn't keep walking it.
+  // The width of the subtree if it was all printed on one line
+  int inlined_width = 0;
+  bool contains_comment = false;
+  // Set after the formatting configs are applied, since it depends on them
+  bool contains_node_that_prevents_inlining = false;
+
   FormatterTreeNode() = default;
   FormatterTreeNode(const std::string& source, const TSNode& node);
   FormatterTreeNode(const Metadata& _metadata) : metadata(_metadata) {};
@@ -143,7 +143,7 @@ static FormFormattingConfig new_deftype_rule(
   cfg.has_constant_pairs = true;
   cfg.config_set = true;
   cfg.hang_forms = false;
-  cfg.inline_until_index = [start_index](std::vector<std::string> curr_lines) {
+  cfg.inline_until_index = [start_index](const std::vector<std::string>& curr_lines) {
     if (curr_lines.size() >= 4 && curr_lines.at(3) == "()") {
       return 4;
     }
@@ -176,7 +176,7 @@ static FormFormattingConfig new_defproc_rule(
   cfg.has_constant_pairs = true;
   cfg.config_set = true;
   cfg.hang_forms = false;
-  cfg.inline_until_index = [start_index](std::vector<std::string> curr_lines) {
+  cfg.inline_until_index = [start_index](const std::vector<std::string>& curr_lines) {
     // if (curr_lines.size() >= 4 && curr_lines.at(3) == "()") {
     //   return 4;
     // }
@@ -210,14 +210,15 @@ static FormFormattingConfig new_binding_rule(int form_head_width) {
   binding_list_config->config_set = true;
   binding_list_config->hang_forms = false;
   binding_list_config->indentation_width = 1;
-  binding_list_config->indentation_width_for_index = [form_head_width](FormFormattingConfig /*cfg*/,
-                                                                       int index) {
-    if (index == 0) {
-      return 0;
-    }
-    return form_head_width;
-  };
-  binding_list_config->should_prevent_inlining = [](FormFormattingConfig /*config*/, int num_refs) {
+  binding_list_config->indentation_width_for_index =
+      [form_head_width](const FormFormattingConfig& /*cfg*/, int index) {
+        if (index == 0) {
+          return 0;
+        }
+        return form_head_width;
+      };
+  binding_list_config->should_prevent_inlining = [](const FormFormattingConfig& /*config*/,
+                                                    int num_refs) {
     // Only prevent inlining a binding list, if there are more than 1 bindings
     if (num_refs > 1) {
       return true;
@@ -239,16 +240,15 @@ static FormFormattingConfig new_inline_binding_rule(int form_head_width) {
   binding_list_config->config_set = true;
   binding_list_config->hang_forms = false;
   binding_list_config->indentation_width = 1;
-  binding_list_config->indentation_width_for_index = [form_head_width](FormFormattingConfig /*cfg*/,
-                                                                       int index) {
-    if (index == 0) {
-      return 0;
-    }
-    return form_head_width;
-  };
-  binding_list_config->should_prevent_inlining = [](FormFormattingConfig /*config*/, int num_refs) {
-    return false;
-  };
+  binding_list_config->indentation_width_for_index =
+      [form_head_width](const FormFormattingConfig& /*cfg*/, int index) {
+        if (index == 0) {
+          return 0;
+        }
+        return form_head_width;
+      };
+  binding_list_config->should_prevent_inlining = [](const FormFormattingConfig& /*config*/,
+                                                    int num_refs) { return false; };
   cfg.index_configs.emplace(1, binding_list_config);
   return cfg;
 }
@@ -18,17 +18,19 @@ struct FormFormattingConfig {
   int indentation_width =
       2;  // 2 for a flow // TODO - also remove this, prefer storing the first node's width in the
           // metadata on the first pass, that's basically all this does
-  std::function<int(FormFormattingConfig, int)> indentation_width_for_index =
-      [](FormFormattingConfig config, int /*index*/) { return config.indentation_width; };
+  std::function<int(const FormFormattingConfig&, int)> indentation_width_for_index =
+      [](const FormFormattingConfig& config, int /*index*/) { return config.indentation_width; };
   bool combine_first_two_lines =
       false;  // NOTE - basically hang, but will probably stick around after hang is gone, may be
               // redundant (inline_until_index!)
   std::function<std::optional<int>(const std::vector<std::string>& /*curr_lines*/)>
-      inline_until_index = [](std::vector<std::string> /*curr_lines*/) { return std::nullopt; };
+      inline_until_index = [](const std::vector<std::string>& /*curr_lines*/) {
+        return std::nullopt;
+      };
   bool has_constant_pairs = false;
   bool prevent_inlining = false;  // TODO - duplicate of below
-  std::function<bool(FormFormattingConfig, int num_refs)> should_prevent_inlining =
-      [](FormFormattingConfig config, int /*num_refs*/) { return config.prevent_inlining; };
+  std::function<bool(const FormFormattingConfig&, int num_refs)> should_prevent_inlining =
+      [](const FormFormattingConfig& config, int /*num_refs*/) { return config.prevent_inlining; };
   int parent_mutable_extra_indent = 0;
   std::optional<std::shared_ptr<FormFormattingConfig>> default_index_config;
   std::unordered_map<int, std::shared_ptr<FormFormattingConfig>> index_configs = {};
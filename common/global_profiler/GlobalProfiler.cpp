@@ -1,8 +1,8 @@
 // clang-format off
 #include "GlobalProfiler.h"
 
+#include <algorithm>
 #include <chrono>
-#include <cstring>
 #include <thread>
 
 #include "common/util/Assert.h"
@@ -34,36 +34,131 @@ u64 get_current_ts() {
   return std::chrono::steady_clock::now().time_since_epoch().count();
 }
 
+namespace {
+constexpr u32 kEmptyNameId = 0;
+
+// the streamed trace has one packet sequence for the frame tracks, then one for each thread.
+constexpr u32 kFrameSequence = 1;
+constexpr u32 kFirstThreadSequence = 2;
+constexpr u64 kFrameTrackUuid = 1;
+constexpr u64 kFrameTimeTrackUuid = 2;
+constexpr u64 kDrawCallsTrackUuid = 3;
+constexpr u64 kTrianglesTrackUuid = 4;
+constexpr u64 kFirstThreadTrackUuid = 100;
+constexpr auto kStreamFlushInterval = std::chrono::milliseconds(50);
+
+struct ThreadProfState {
+  GlobalProfiler* owner = nullptr;
+  void* buffer = nullptr;
+  // names are usually string literals, so remember the ID for each pointer. The string is checked
+  // in the table too, in case the memory was reused for a different name.
+  std::unordered_map<const char*, std::pair<u32, const std::string*>> name_cache;
+
+  ~ThreadProfState() {
+    if (owner) {
+      owner->release_thread_buffer(buffer);
+    }
+  }
+};
+thread_local ThreadProfState t_prof_state;
+}  // namespace
+
 GlobalProfiler::GlobalProfiler() {
   m_t0 = get_current_ts();
-  m_nodes.resize(m_max_events);
+  ASSERT(intern_name("") == kEmptyNameId);
+}
+
+GlobalProfiler::~GlobalProfiler() {
+  stop_streaming();
 }
 
 void GlobalProfiler::update_event_buffer_size(size_t new_size) {
-  m_max_events = new_size;
-  m_nodes.resize(m_max_events);
+  m_max_events = std::max(new_size, size_t(1));
+  m_generation++;
 }
 
 void GlobalProfiler::set_waiting_for_event(const std::string& event_name) {
   if (!event_name.empty()) {
-    m_waiting_for_event = event_name;
+    m_waiting_for_event = intern_name(event_name.c_str());
   }
 }
 
-void GlobalProfiler::event(const char* name, ProfNode::Kind kind) {
-  if (m_waiting_for_event && m_waiting_for_event.value() == name) {
-    m_ignore_events = true;
+u32 GlobalProfiler::intern_name(const char* name) {
+  auto& cache = t_prof_state.name_cache;
+  if (t_prof_state.owner == this) {
+    auto it = cache.find(name);
+    if (it != cache.end() && *it->second.second == name) {
+      return it->second.first;
+    }
   }
-  if (!m_enabled || m_ignore_events) {
-    return;
+
+  std::lock_guard<std::mutex> lk(m_names_mutex);
+  auto [it, inserted] = m_name_ids.try_emplace(name, m_names.size());
+  if (inserted) {
+    m_names.push_back(name);
+  }
+  if (t_prof_state.owner == this) {
+    cache[name] = {it->second, &m_names[it->second]};
   }
-  size_t my_idx = (m_next_idx++ % m_nodes.size());
-  auto& node = m_nodes[my_idx];
+  return it->second;
+}
+
+GlobalProfiler::ThreadBuffer& GlobalProfiler::get_thread_buffer() {
+  if (t_prof_state.owner != this) {
+    ThreadBuffer* buffer;
+    {
+      std::lock_guard<std::mutex> lk(m_buffers_mutex);
+      if (!m_free_buffers.empty()) {
+        // the events of the thread that had it are dropped now.
+        buffer = m_free_buffers.back();
+        m_free_buffers.pop_back();
+      } else {
+        buffer = m_buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+        buffer->index = m_buffers.size() - 1;
+      }
+      buffer->tid = get_current_tid();
+      // start out of date, so the first event sizes the buffer.
+      buffer->generation = m_generation - 1;
+    }
+    t_prof_state.owner = this;
+    t_prof_state.buffer = buffer;
+    t_prof_state.name_cache.clear();
+  }
+  return *(ThreadBuffer*)t_prof_state.buffer;
+}
+
+void GlobalProfiler::release_thread_buffer(void* buffer) {
+  std::lock_guard<std::mutex> lk(m_buffers_mutex);
+  m_free_buffers.push_back((ThreadBuffer*)buffer);
+}
+
+void GlobalProfiler::record(u32 name_id, ProfNode::Kind kind) {
+  auto& buffer = get_thread_buffer();
+  const u32 generation = m_generation;
+  if (buffer.generation != generation) {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    buffer.nodes.assign(m_max_events, ProfNode{});
+    buffer.next_idx = 0;
+    buffer.generation = generation;
+  }
+  const size_t idx = buffer.next_idx.load(std::memory_order_relaxed);
+  auto& node = buffer.nodes[idx % buffer.nodes.size()];
   node.ts = get_current_ts() - m_t0;
-  node.tid = get_current_tid();
+  node.name_id = name_id;
   node.kind = kind;
-  strncpy(node.name, name, sizeof(node.name));
-  node.name[sizeof(node.name) - 1] = '\0';
+  buffer.next_idx.store(idx + 1, std::memory_order_release);
+}
+
+void GlobalProfiler::event(const char* name, ProfNode::Kind kind) {
+  if (!m_enabled || m_ignore_events) {
+    return;
+  }
+  const u32 name_id = intern_name(name);
+  if (m_waiting_for_event && m_waiting_for_event.value() == name_id) {
+    m_ignore_events = true;
+    return;
+  }
+  record(name_id, kind);
 }
 
 void GlobalProfiler::instant_event(const char* name) {
@@ -75,7 +170,14 @@ void GlobalProfiler::root_event() {
 }
 
 size_t GlobalProfiler::get_next_idx() {
-  return (m_next_idx % m_nodes.size());
+  std::lock_guard<std::mutex> lk(m_buffers_mutex);
+  size_t result = 0;
+  for (auto& buffer : m_buffers) {
+    if (buffer->generation == m_generation) {
+      result = std::max(result, std::min(buffer->next_idx.load(), buffer->nodes.size()));
+    }
+  }
+  return result;
 }
 
 void GlobalProfiler::begin_event(const char* name) {
@@ -86,79 +188,300 @@ void GlobalProfiler::end_event() {
   if (!m_enabled || m_ignore_events) {
     return;
   }
-  size_t my_idx = (m_next_idx++ % m_nodes.size());
-  auto& node = m_nodes[my_idx];
-  node.ts = get_current_ts() - m_t0;
-  node.tid = get_current_tid();
-  node.kind = ProfNode::END;
-  node.name[0] = '\0';
+  record(kEmptyNameId, ProfNode::END);
 }
 
 void GlobalProfiler::clear() {
-  m_next_idx = 0;
+  m_generation++;
 }
 
 void GlobalProfiler::set_enable(bool en) {
   m_enabled = en;
 }
 
+void GlobalProfiler::start_streaming(const fs::path& path) {
+  stop_streaming();
+  if (!m_stream_writer.open(path)) {
+    lg::error("Failed to open {} for the profiler trace", path.string());
+    return;
+  }
+  lg::info("Streaming profiler events to {}", path.string());
+
+  m_stream_writer.track(kFrameSequence, kFrameTrackUuid, "Frames", false);
+  m_stream_writer.track(kFrameSequence, kFrameTimeTrackUuid, "Frame Time (ms)", true);
+  m_stream_writer.track(kFrameSequence, kDrawCallsTrackUuid, "Draw Calls", true);
+  m_stream_writer.track(kFrameSequence, kTrianglesTrackUuid, "Triangles", true);
+  {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    for (auto& buffer : m_buffers) {
+      buffer->streamed_generation = buffer->generation;
+      buffer->streamed_idx = 0;
+      buffer->stream_track_written = false;
+      buffer->stream_names_sent.clear();
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_frames_mutex);
+    m_pending_frames.clear();
+  }
+  m_stream_dropped_events = 0;
+  m_streaming = true;
+  set_enable(true);
+  m_stream_thread = std::thread(&GlobalProfiler::stream_loop, this);
+}
+
+void GlobalProfiler::stop_streaming() {
+  if (!m_stream_thread.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_stream_mutex);
+    m_streaming = false;
+  }
+  m_stream_cv.notify_all();
+  m_stream_thread.join();
+  stream_flush();
+  m_stream_writer.close();
+  if (m_stream_dropped_events) {
+    lg::warn("Profiler stream dropped {} events, try a larger event buffer",
+             m_stream_dropped_events);
+  }
+}
+
+void GlobalProfiler::frame_marker(float duration_s, u32 draw_calls, u32 triangles) {
+  if (!m_streaming) {
+    return;
+  }
+  const u64 end_ts = get_current_ts() - m_t0;
+  const u64 duration_ns = std::min((u64)(duration_s * 1e9), end_ts);
+  std::lock_guard<std::mutex> lk(m_frames_mutex);
+  m_pending_frames.push_back({end_ts - duration_ns, end_ts, draw_calls, triangles});
+}
+
+void GlobalProfiler::stream_loop() {
+  std::unique_lock<std::mutex> lk(m_stream_mutex);
+  while (m_streaming) {
+    m_stream_cv.wait_for(lk, kStreamFlushInterval, [&]() { return !m_streaming; });
+    stream_flush();
+  }
+}
+
+void GlobalProfiler::stream_flush() {
+  using EventType = PerfettoWriter::EventType;
+  std::vector<ProfNode> nodes;
+  {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    for (auto& buffer : m_buffers) {
+      if (buffer->streamed_generation != buffer->generation) {
+        // cleared or resized, start over.
+        buffer->streamed_generation = buffer->generation;
+        buffer->streamed_idx = 0;
+      }
+      const u32 sequence = kFirstThreadSequence + buffer->index;
+      const u64 track_uuid = kFirstThreadTrackUuid + buffer->index;
+      if (!buffer->stream_track_written) {
+        m_stream_writer.thread_track(sequence, track_uuid, buffer->index,
+                                     fmt::format("thread {}", buffer->index));
+        buffer->stream_track_written = true;
+      }
+
+      const size_t size = buffer->nodes.size();
+      const size_t end = buffer->next_idx.load(std::memory_order_acquire);
+      if (size == 0 || end == buffer->streamed_idx) {
+        continue;
+      }
+      const size_t begin = std::max(buffer->streamed_idx, end > size ? end - size : 0);
+      nodes.clear();
+      for (size_t i = begin; i < end; i++) {
+        nodes.push_back(buffer->nodes[i % size]);
+      }
+      // the owning thread may have lapped us while copying, those events are garbage.
+      const size_t new_end = buffer->next_idx.load(std::memory_order_acquire);
+      const size_t valid_begin = std::max(begin, new_end > size ? new_end - size : 0);
+      m_stream_dropped_events += valid_begin - buffer->streamed_idx;
+      buffer->streamed_idx = end;
+
+      std::lock_guard<std::mutex> names_lk(m_names_mutex);
+      if (buffer->stream_names_sent.size() < m_names.size()) {
+        buffer->stream_names_sent.resize(m_names.size());
+      }
+      for (size_t i = valid_begin; i < end; i++) {
+        const auto& node = nodes[i - begin];
+        EventType type;
+        switch (node.kind) {
+          case ProfNode::BEGIN:
+            type = EventType::SLICE_BEGIN;
+            break;
+          case ProfNode::END:
+            type = EventType::SLICE_END;
+            break;
+          case ProfNode::INSTANT:
+            type = EventType::INSTANT;
+            break;
+          default:
+            continue;
+        }
+        const std::string* new_name = nullptr;
+        if (type != EventType::SLICE_END && node.name_id < m_names.size() &&
+            !buffer->stream_names_sent[node.name_id]) {
+          new_name = &m_names[node.name_id];
+          buffer->stream_names_sent[node.name_id] = true;
+        }
+        // iids start at 1
+        m_stream_writer.interned_event(sequence, node.ts, type, track_uuid, node.name_id + 1,
+                                       new_name);
+      }
+    }
+  }
+
+  std::vector<FrameMarker> frames;
+  {
+    std::lock_guard<std::mutex> lk(m_frames_mutex);
+    std::swap(frames, m_pending_frames);
+  }
+  for (const auto& frame : frames) {
+    m_stream_writer.event(kFrameSequence, frame.start_ts, EventType::SLICE_BEGIN, kFrameTrackUuid,
+                          "frame");
+    m_stream_writer.event(kFrameSequence, frame.end_ts, EventType::SLICE_END, kFrameTrackUuid, "");
+    m_stream_writer.event(kFrameSequence, frame.end_ts, EventType::COUNTER, kFrameTimeTrackUuid,
+                          "", (frame.end_ts - frame.start_ts) / 1e6);
+    m_stream_writer.event(kFrameSequence, frame.end_ts, EventType::COUNTER, kDrawCallsTrackUuid,
+                          "", frame.draw_calls);
+    m_stream_writer.event(kFrameSequence, frame.end_ts, EventType::COUNTER, kTrianglesTrackUuid,
+                          "", frame.triangles);
+  }
+  m_stream_writer.flush();
+}
+
 void GlobalProfiler::dump_to_json() {
   if (m_enabled) {
     set_enable(false);
   }
 
-  nlohmann::json json;
-  auto& trace_events = json["traceEvents"];
-  json["displayTimeUnit"] = "ms";
-
-  u64 lowest_ts = UINT64_MAX;
-  struct ThreadInfo {
-    size_t lowest_at_target = UINT64_MAX;
-    size_t highest_at_target = 0;
-    size_t debug = 0;
-    u32 short_id = 0;
+  struct MergedEvent {
+    u64 ts;
+    u32 name_id;
+    u32 short_id;
+    ProfNode::Kind kind;
   };
-  std::unordered_map<u32, ThreadInfo> info_per_thread;
+  std::vector<MergedEvent> events;
+  u64 lowest_ts = UINT64_MAX;
+  const u32 root_id = intern_name("ROOT");
 
-  // first, find all the threads
-  std::string kRootName = "ROOT";
-  for (size_t offset = m_nodes.size(); offset-- > 0;) {
-    size_t idx = (m_next_idx + offset) % m_nodes.size();
-    const auto& event = m_nodes[idx];
+  {
+    std::lock_guard<std::mutex> lk(m_buffers_mutex);
+    u32 short_id = 0;
+    for (auto& buffer : m_buffers) {
+      if (buffer->generation != m_generation) {
+        continue;
+      }
+      const size_t end = buffer->next_idx.load(std::memory_order_acquire);
+      const size_t size = buffer->nodes.size();
+      const size_t begin = end > size ? end - size : 0;
+      auto node_at = [&](size_t i) -> const ProfNode& { return buffer->nodes[i % size]; };
 
-    if (event.kind != ProfNode::UNUSED) {
-      lowest_ts = std::min(event.ts, lowest_ts);
-    }
-    if (event.kind == ProfNode::INSTANT && kRootName == event.name) {
-      auto& info = info_per_thread[event.tid];
-      info.lowest_at_target = std::min(info.lowest_at_target, offset);
-      info.highest_at_target = std::max(info.highest_at_target, offset);
+      // only keep the events between the first and last ROOT on each thread, so every thread's
+      // trace covers whole frames.
+      size_t first_root = end;
+      size_t last_root = begin;
+      for (size_t i = begin; i < end; i++) {
+        const auto& node = node_at(i);
+        lowest_ts = std::min(node.ts, lowest_ts);
+        if (node.kind == ProfNode::INSTANT && node.name_id == root_id) {
+          first_root = std::min(first_root, i);
+          last_root = i;
+        }
+      }
+      if (first_root == end) {
+        continue;
+      }
+      for (size_t i = first_root; i <= last_root; i++) {
+        const auto& node = node_at(i);
+        events.push_back({node.ts, node.name_id, short_id, node.kind});
+      }
+      lg::debug("thread: {}: {} events", buffer->tid, last_root - first_root + 1);
+      short_id++;
     }
   }
+  std::stable_sort(events.begin(), events.end(),
+                   [](const MergedEvent& a, const MergedEvent& b) { return a.ts < b.ts; });
 
-  u32 i = 0;
-  for (auto& info : info_per_thread) {
-    info.second.short_id = i++;
-  }
+  std::lock_guard<std::mutex> lk(m_names_mutex);
+
+  // add up the time in each event name, per thread, using a stack of the open events.
+  {
+    struct OpenEvent {
+      u32 name_id;
+      u64 start_ts;
+      u64 child_ns;
+    };
+    std::vector<EventTotal> totals(m_names.size());
+    std::unordered_map<u32, std::vector<OpenEvent>> stacks;
+    std::unordered_map<u32, int> frames;
+    for (const auto& event : events) {
+      auto& stack = stacks[event.short_id];
+      switch (event.kind) {
+        case ProfNode::BEGIN:
+          stack.push_back({event.name_id, event.ts, 0});
+          break;
+        case ProfNode::END:
+          if (!stack.empty()) {
+            const auto open = stack.back();
+            stack.pop_back();
+            const u64 duration = event.ts - open.start_ts;
+            auto& total = totals.at(open.name_id);
+            total.count++;
+            total.total_ms += duration / 1e6;
+            total.self_ms += (duration - std::min(duration, open.child_ns)) / 1e6;
+            if (!stack.empty()) {
+              stack.back().child_ns += duration;
+            }
+          }
+          break;
+        case ProfNode::INSTANT:
+          if (event.name_id == root_id) {
+            // everything should be closed at ROOT, don't let unbalanced events pile up.
+            stack.clear();
+            frames[event.short_id]++;
+          }
+          break;
+        default:
+          break;
+      }
+    }
 
-  for (size_t event_idx = 0; event_idx < m_nodes.size(); event_idx++) {
-    auto& event = m_nodes[(event_idx + m_next_idx) % m_nodes.size()];
-    if (event.kind == ProfNode::UNUSED) {
-      continue;
+    EventTotals result;
+    for (const auto& [tid, count] : frames) {
+      result.frames = std::max(result.frames, count);
     }
-    auto& info = info_per_thread.at(event.tid);
-    if (event_idx < info.lowest_at_target || event_idx > info.highest_at_target) {
-      continue;
+    for (u32 i = 0; i < totals.size(); i++) {
+      if (totals[i].count) {
+        totals[i].name = m_names.at(i);
+        result.events.push_back(std::move(totals[i]));
+      }
     }
+    std::sort(result.events.begin(), result.events.end(),
+              [](const EventTotal& a, const EventTotal& b) { return a.total_ms > b.total_ms; });
+    for (size_t i = 0; i < std::min(result.events.size(), size_t(10)); i++) {
+      const auto& e = result.events[i];
+      lg::info("[Profiler] {:>9.3f} ms total {:>9.3f} ms self {:>7} x {}", e.total_ms, e.self_ms,
+               e.count, e.name);
+    }
+    std::lock_guard<std::mutex> totals_lock(m_totals_mutex);
+    m_last_event_totals = std::move(result);
+  }
+
+  nlohmann::json json;
+  auto& trace_events = json["traceEvents"];
+  json["displayTimeUnit"] = "ms";
 
+  for (const auto& event : events) {
     auto& json_event = trace_events.emplace_back();
     // name
     if (event.kind != ProfNode::END) {
-      json_event["name"] = event.name;
+      json_event["name"] = m_names.at(event.name_id);
     }
 
-    // cat
-    // json_event["cat"] = "a";  // ??
     // ph BEi
     switch (event.kind) {
       case ProfNode::END:
@@ -176,21 +499,9 @@ void GlobalProfiler::dump_to_json() {
     // pid
     json_event["pid"] = 1;
     // tid
-    json_event["tid"] = info.short_id;
+    json_event["tid"] = event.short_id;
     // ts
     json_event["ts"] = (event.ts - lowest_ts) / 1000.f;
-    if (event.ts < info.debug) {
-      lg::debug("out of order: {} {} {} ms", event.ts / 1000.f, info.debug / 1000.f,
-                (info.debug - event.ts) / 1000000.f);
-      lg::debug("  idx: {}, range {} {}", event_idx, info.lowest_at_target, info.highest_at_target);
-      lg::debug("  now: {}", m_next_idx.load());
-    }
-    info.debug = event.ts;
-  }
-
-  for (auto& t : info_per_thread) {
-    lg::debug("thread: {}: {} -> {}", t.first, t.second.lowest_at_target,
-              t.second.highest_at_target);
   }
 
   if (m_enable_compression) {
@@ -209,6 +520,11 @@ void GlobalProfiler::dump_to_json() {
   }
 }
 
+GlobalProfiler::EventTotals GlobalProfiler::last_event_totals() {
+  std::lock_guard<std::mutex> lk(m_totals_mutex);
+  return m_last_event_totals;
+}
+
 GlobalProfiler gprof;
 GlobalProfiler& prof() {
   return gprof;
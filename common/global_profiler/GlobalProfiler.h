@@ -1,22 +1,42 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/global_profiler/PerfettoWriter.h"
+#include "common/util/FileUtil.h"
 
 struct ProfNode {
   u64 ts;
-  u64 tid;
-  char name[128];
+  u32 name_id;  // index into the profiler's name table
   enum Kind : u8 { BEGIN, END, INSTANT, UNUSED } kind = UNUSED;
 };
 
+/*!
+ * Records begin/end/instant events from any thread, to be dumped as a Chrome trace.
+ *
+ * Each thread records into its own ring buffer, so recording an event never touches memory shared
+ * with other threads. Names are interned once and events only store their ID. The buffers are
+ * merged when dumping. When a thread exits, its buffer is kept (with its events) until a new
+ * thread takes it over, so threads that come and go don't add buffers.
+ *
+ * Events can also be streamed to a Perfetto trace file as they are recorded, which has no limit on
+ * the length of the capture.
+ */
 class GlobalProfiler {
  public:
   GlobalProfiler();
+  ~GlobalProfiler();
+  // the size of the ring buffer for each thread
   size_t get_max_events() { return m_max_events; }
   void update_event_buffer_size(size_t new_size);
   void set_waiting_for_event(const std::string& event_name);
@@ -29,21 +49,108 @@ class GlobalProfiler {
   void dump_to_json();
   void root_event();
   bool is_enabled() { return m_enabled; }
+  // the number of events in the fullest thread buffer
   size_t get_next_idx();
 
+  /*!
+   * Start writing all events to a Perfetto trace at path, until stop_streaming. Also enables
+   * recording. The thread buffers are drained often, so they only need to hold a fraction of a
+   * second of events.
+   */
+  void start_streaming(const fs::path& path);
+  void stop_streaming();
+  bool is_streaming() const { return m_streaming; }
+
+  /*!
+   * Mark the end of a rendered frame, for the frame tracks of the streamed trace.
+   */
+  void frame_marker(float duration_s, u32 draw_calls, u32 triangles);
+
+  struct EventTotal {
+    std::string name;
+    u32 count = 0;
+    double total_ms = 0;  // including the events inside it
+    double self_ms = 0;   // not including the events inside it
+  };
+
+  struct EventTotals {
+    int frames = 0;  // the number of ROOT events on the thread that had the most
+    std::vector<EventTotal> events;  // most total time first
+  };
+
+  /*!
+   * The time spent in each named event, added up over the events in the last dump_to_json. The GOAL
+   * kernel names an event after each process it runs, so this shows which processes take the most
+   * time.
+   */
+  EventTotals last_event_totals();
+
+  // called by the thread_local state of a thread that recorded events, when the thread exits.
+  void release_thread_buffer(void* buffer);
+
   bool m_enable_compression = false;
 
  private:
+  struct ThreadBuffer {
+    u64 tid = 0;
+    // bumped by clear and resize. The owning thread resets its buffer when it sees a new one.
+    u32 generation = 0;
+    std::vector<ProfNode> nodes;
+    // only written by the owning thread
+    std::atomic_size_t next_idx = 0;
+
+    // only used by the streaming thread
+    u32 index = 0;
+    u32 streamed_generation = 0;
+    size_t streamed_idx = 0;
+    bool stream_track_written = false;
+    std::vector<bool> stream_names_sent;
+  };
+
+  struct FrameMarker {
+    u64 start_ts;
+    u64 end_ts;
+    u32 draw_calls;
+    u32 triangles;
+  };
+
+  ThreadBuffer& get_thread_buffer();
+  u32 intern_name(const char* name);
+  void record(u32 name_id, ProfNode::Kind kind);
+  void stream_loop();
+  void stream_flush();
+
   std::atomic_bool m_enabled = false;
-  size_t m_max_events = 65536;
+  std::atomic_size_t m_max_events = 65536;
   u64 m_t0 = 0;
-  std::atomic_size_t m_next_idx = 0;
-  std::vector<ProfNode> m_nodes;
+  std::atomic<u32> m_generation = 0;
+
+  std::mutex m_buffers_mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+  // buffers of threads that have exited, for new threads to reuse.
+  std::vector<ThreadBuffer*> m_free_buffers;
+
+  std::mutex m_names_mutex;
+  std::unordered_map<std::string, u32> m_name_ids;
+  std::deque<std::string> m_names;
+
   // this is very niche, but sometimes you want to capture up to a given event (ie. long startup)
   // instead of having to make the user quit and record as fast as possible, we can instead just
   // stop capturing events once we have received what we are looking for
-  std::optional<std::string> m_waiting_for_event = {};
-  bool m_ignore_events = false;
+  std::optional<u32> m_waiting_for_event = {};
+  std::atomic_bool m_ignore_events = false;
+
+  std::atomic_bool m_streaming = false;
+  std::thread m_stream_thread;
+  std::mutex m_stream_mutex;
+  std::condition_variable m_stream_cv;
+  PerfettoWriter m_stream_writer;
+  size_t m_stream_dropped_events = 0;
+  std::mutex m_frames_mutex;
+  std::vector<FrameMarker> m_pending_frames;
+
+  std::mutex m_totals_mutex;
+  EventTotals m_last_event_totals;
 };
 
 struct ScopedEvent {
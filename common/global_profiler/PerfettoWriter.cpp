@@ -0,0 +1,195 @@
+#include "PerfettoWriter.h"
+
+#include <cstring>
+
+namespace {
+// field numbers from perfetto/protos/perfetto/trace/
+namespace field {
+constexpr u32 kTracePacket = 1;  // Trace
+
+constexpr u32 kTimestamp = 8;  // TracePacket
+constexpr u32 kSequenceId = 10;
+constexpr u32 kTrackEvent = 11;
+constexpr u32 kInternedData = 12;
+constexpr u32 kSequenceFlags = 13;
+constexpr u32 kTrackDescriptor = 60;
+
+constexpr u32 kEventType = 9;  // TrackEvent
+constexpr u32 kEventNameIid = 10;
+constexpr u32 kEventTrackUuid = 11;
+constexpr u32 kEventName = 23;
+constexpr u32 kEventDoubleCounterValue = 44;
+
+constexpr u32 kTrackUuid = 1;  // TrackDescriptor
+constexpr u32 kTrackName = 2;
+constexpr u32 kTrackThread = 4;
+constexpr u32 kTrackCounter = 8;
+
+constexpr u32 kThreadPid = 1;  // ThreadDescriptor
+constexpr u32 kThreadTid = 2;
+constexpr u32 kThreadName = 5;
+
+constexpr u32 kInternedEventNames = 2;  // InternedData
+constexpr u32 kEventNameEntryIid = 1;   // EventName
+constexpr u32 kEventNameEntryName = 2;
+}  // namespace field
+
+constexpr u32 kSeqIncrementalStateCleared = 1;
+constexpr u32 kSeqNeedsIncrementalState = 2;
+
+constexpr u32 kWireVarint = 0;
+constexpr u32 kWire64Bit = 1;
+constexpr u32 kWireLengthDelimited = 2;
+
+/*!
+ * Builds one protobuf message.
+ */
+class ProtoMessage {
+ public:
+  void varint(u32 field, u64 value) {
+    put_varint((field << 3) | kWireVarint);
+    put_varint(value);
+  }
+
+  void double_value(u32 field, double value) {
+    put_varint((field << 3) | kWire64Bit);
+    u8 bytes[8];
+    memcpy(bytes, &value, 8);
+    m_data.insert(m_data.end(), bytes, bytes + 8);
+  }
+
+  void bytes(u32 field, const void* data, size_t size) {
+    put_varint((field << 3) | kWireLengthDelimited);
+    put_varint(size);
+    m_data.insert(m_data.end(), (const u8*)data, (const u8*)data + size);
+  }
+
+  void string(u32 field, const std::string& str) { bytes(field, str.data(), str.size()); }
+  void message(u32 field, const ProtoMessage& msg) { bytes(field, msg.m_data.data(), msg.size()); }
+  size_t size() const { return m_data.size(); }
+  const std::vector<u8>& data() const { return m_data; }
+
+ private:
+  void put_varint(u64 value) {
+    while (value >= 0x80) {
+      m_data.push_back((value & 0x7f) | 0x80);
+      value >>= 7;
+    }
+    m_data.push_back(value);
+  }
+
+  std::vector<u8> m_data;
+};
+
+ProtoMessage packet_for(u32 sequence, u32 flags) {
+  ProtoMessage packet;
+  packet.varint(field::kSequenceId, sequence);
+  packet.varint(field::kSequenceFlags, flags);
+  return packet;
+}
+
+void append_packet(std::vector<u8>& buffer, const ProtoMessage& packet) {
+  // a Trace is just its packets one after another, so each one can be written on its own.
+  ProtoMessage trace;
+  trace.message(field::kTracePacket, packet);
+  buffer.insert(buffer.end(), trace.data().begin(), trace.data().end());
+}
+}  // namespace
+
+PerfettoWriter::~PerfettoWriter() {
+  close();
+}
+
+bool PerfettoWriter::open(const fs::path& path) {
+  close();
+  file_util::create_dir_if_needed_for_file(path);
+  m_file = file_util::open_file(path, "wb");
+  return m_file != nullptr;
+}
+
+void PerfettoWriter::close() {
+  if (m_file) {
+    flush();
+    fclose(m_file);
+    m_file = nullptr;
+  }
+}
+
+void PerfettoWriter::thread_track(u32 sequence, u64 uuid, u32 tid, const std::string& name) {
+  ProtoMessage thread;
+  thread.varint(field::kThreadPid, 1);
+  thread.varint(field::kThreadTid, tid);
+  thread.string(field::kThreadName, name);
+  ProtoMessage track;
+  track.varint(field::kTrackUuid, uuid);
+  track.message(field::kTrackThread, thread);
+  auto packet = packet_for(sequence, kSeqIncrementalStateCleared);
+  packet.message(field::kTrackDescriptor, track);
+  append_packet(m_buffer, packet);
+}
+
+void PerfettoWriter::track(u32 sequence, u64 uuid, const std::string& name, bool counter) {
+  ProtoMessage track;
+  track.varint(field::kTrackUuid, uuid);
+  track.string(field::kTrackName, name);
+  if (counter) {
+    track.message(field::kTrackCounter, ProtoMessage());
+  }
+  auto packet = packet_for(sequence, kSeqIncrementalStateCleared);
+  packet.message(field::kTrackDescriptor, track);
+  append_packet(m_buffer, packet);
+}
+
+void PerfettoWriter::interned_event(u32 sequence,
+                                    u64 ts,
+                                    EventType type,
+                                    u64 track_uuid,
+                                    u64 name_iid,
+                                    const std::string* new_name) {
+  ProtoMessage event;
+  event.varint(field::kEventType, (u32)type);
+  event.varint(field::kEventTrackUuid, track_uuid);
+  if (type != EventType::SLICE_END) {
+    event.varint(field::kEventNameIid, name_iid);
+  }
+  auto packet = packet_for(sequence, kSeqNeedsIncrementalState);
+  packet.varint(field::kTimestamp, ts);
+  packet.message(field::kTrackEvent, event);
+  if (new_name) {
+    ProtoMessage name;
+    name.varint(field::kEventNameEntryIid, name_iid);
+    name.string(field::kEventNameEntryName, *new_name);
+    ProtoMessage interned;
+    interned.message(field::kInternedEventNames, name);
+    packet.message(field::kInternedData, interned);
+  }
+  append_packet(m_buffer, packet);
+}
+
+void PerfettoWriter::event(u32 sequence,
+                           u64 ts,
+                           EventType type,
+                           u64 track_uuid,
+                           const std::string& name,
+                           double value) {
+  ProtoMessage event;
+  event.varint(field::kEventType, (u32)type);
+  event.varint(field::kEventTrackUuid, track_uuid);
+  if (type == EventType::COUNTER) {
+    event.double_value(field::kEventDoubleCounterValue, value);
+  } else if (type != EventType::SLICE_END) {
+    event.string(field::kEventName, name);
+  }
+  auto packet = packet_for(sequence, kSeqNeedsIncrementalState);
+  packet.varint(field::kTimestamp, ts);
+  packet.message(field::kTrackEvent, event);
+  append_packet(m_buffer, packet);
+}
+
+void PerfettoWriter::flush() {
+  if (m_file && !m_buffer.empty()) {
+    fwrite(m_buffer.data(), 1, m_buffer.size(), m_file);
+    fflush(m_file);
+  }
+  m_buffer.clear();
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
+/*!
+ * Writes a Perfetto trace (a protobuf Trace message, one TracePacket at a time) to a file, so it
+ * can be written as the game runs and opened in ui.perfetto.dev at any point.
+ * Only the handful of fields the profiler needs are encoded, by hand, to avoid depending on the
+ * Perfetto SDK.
+ */
+class PerfettoWriter {
+ public:
+  enum class EventType : u8 { SLICE_BEGIN = 1, SLICE_END = 2, INSTANT = 3, COUNTER = 4 };
+
+  PerfettoWriter() = default;
+  ~PerfettoWriter();
+  PerfettoWriter(const PerfettoWriter&) = delete;
+  PerfettoWriter& operator=(const PerfettoWriter&) = delete;
+
+  bool open(const fs::path& path);
+  void close();
+  bool is_open() const { return m_file != nullptr; }
+
+  /*!
+   * Declare a track for a thread. Events for it use their own packet sequence, which must be
+   * started with this.
+   */
+  void thread_track(u32 sequence, u64 uuid, u32 tid, const std::string& name);
+
+  /*!
+   * Declare a global track, optionally one for counter values.
+   */
+  void track(u32 sequence, u64 uuid, const std::string& name, bool counter);
+
+  /*!
+   * Add an event with a name that was interned on this sequence. If new_name is set, it's interned
+   * as name_iid in the same packet.
+   */
+  void interned_event(u32 sequence,
+                      u64 ts,
+                      EventType type,
+                      u64 track_uuid,
+                      u64 name_iid,
+                      const std::string* new_name);
+
+  /*!
+   * Add an event with its name inline. A counter event uses value instead of a name.
+   */
+  void event(u32 sequence,
+             u64 ts,
+             EventType type,
+             u64 track_uuid,
+             const std::string& name,
+             double value = 0);
+
+  /*!
+   * Write everything added so far to the file.
+   */
+  void flush();
+
+ private:
+  std::vector<u8> m_buffer;
+  FILE* m_file = nullptr;
+};
@@ -0,0 +1,175 @@
+#include "Telemetry.h"
+
+// clang-format off
+#include "common/cross_sockets/XSocket.h"
+#ifdef _WIN32
+#include <WS2tcpip.h>
+#endif
+// clang-format on
+
+#include <algorithm>
+
+#include "common/log/log.h"
+#include "common/util/FileUtil.h"
+#include "common/util/string_util.h"
+
+#include "fmt/core.h"
+
+namespace {
+// a long frame is only blamed on an event that took at least this much of it.
+constexpr double kMinCauseFraction = 0.25;
+}  // namespace
+
+Telemetry::~Telemetry() {
+  close();
+}
+
+bool Telemetry::open(const std::string& output, double interval_s) {
+  close();
+  if (str_util::starts_with(output, "udp:")) {
+    auto parts = str_util::split(output.substr(4), ':');
+    if (parts.size() != 2) {
+      lg::error("Telemetry output {} should be udp:host:port", output);
+      return false;
+    }
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(std::stoi(parts[1]));
+    const auto host = parts[0] == "localhost" ? std::string("127.0.0.1") : parts[0];
+    if (inet_pton(AF_INET, host.c_str(), &addr.sin_addr) <= 0) {
+      lg::error("Telemetry host {} is not an IPv4 address", parts[0]);
+      return false;
+    }
+    m_socket = open_socket(AF_INET, SOCK_DGRAM, 0);
+    if (m_socket < 0 || connect_socket(m_socket, (sockaddr*)&addr, sizeof(addr)) < 0) {
+      lg::error("Failed to open telemetry socket to {}", output);
+      close();
+      return false;
+    }
+  } else {
+    m_file = file_util::open_file(output, "a");
+    if (!m_file) {
+      lg::error("Failed to open telemetry file {}", output);
+      return false;
+    }
+  }
+  m_interval_s = interval_s;
+  m_last_report = m_clock.getSeconds();
+  m_enabled = true;
+  lg::info("Writing telemetry to {} every {}s", output, interval_s);
+  return true;
+}
+
+void Telemetry::close() {
+  m_enabled = false;
+  if (m_file) {
+    fclose(m_file);
+    m_file = nullptr;
+  }
+  if (m_socket >= 0) {
+    close_socket(m_socket);
+    m_socket = -1;
+  }
+}
+
+void Telemetry::frame(double frame_s, double long_frame_s) {
+  if (!m_enabled) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_frame_ms.push_back(frame_s * 1000);
+    if (frame_s > long_frame_s) {
+      m_long_frames++;
+      std::string cause = "unknown";
+      double cause_time = frame_s * kMinCauseFraction;
+      for (const auto& [name, time] : m_frame_event_time) {
+        if (time >= cause_time) {
+          cause = name;
+          cause_time = time;
+        }
+      }
+      m_long_frame_causes[cause]++;
+    }
+    m_frame_event_time.clear();
+  }
+
+  if (m_clock.getSeconds() - m_last_report >= m_interval_s) {
+    flush();
+  }
+}
+
+void Telemetry::add_event_time(const char* name, double seconds) {
+  if (!m_enabled) {
+    return;
+  }
+  std::lock_guard<std::mutex> lk(m_mutex);
+  m_frame_event_time[name] += seconds;
+}
+
+void Telemetry::count_event(const char* name) {
+  if (!m_enabled) {
+    return;
+  }
+  std::lock_guard<std::mutex> lk(m_mutex);
+  m_event_counts[name]++;
+}
+
+void Telemetry::set_info_callback(std::function<void(nlohmann::json&)> callback) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  m_info_callback = std::move(callback);
+}
+
+void Telemetry::flush() {
+  nlohmann::json report;
+  std::function<void(nlohmann::json&)> info_callback;
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    double now = m_clock.getSeconds();
+    report["time"] = now;
+    report["duration"] = now - m_last_report;
+    m_last_report = now;
+
+    report["frames"] = m_frame_ms.size();
+    if (!m_frame_ms.empty()) {
+      std::sort(m_frame_ms.begin(), m_frame_ms.end());
+      auto percentile = [&](double p) {
+        return m_frame_ms[std::min(m_frame_ms.size() - 1, size_t(p * m_frame_ms.size()))];
+      };
+      report["frame_ms"] = {{"p50", percentile(0.5)},
+                            {"p90", percentile(0.9)},
+                            {"p99", percentile(0.99)},
+                            {"max", m_frame_ms.back()}};
+    }
+    report["long_frames"] = m_long_frames;
+    report["long_frame_causes"] = m_long_frame_causes;
+    report["events"] = m_event_counts;
+
+    m_frame_ms.clear();
+    m_long_frames = 0;
+    m_long_frame_causes.clear();
+    m_event_counts.clear();
+    info_callback = m_info_callback;
+  }
+  if (info_callback) {
+    info_callback(report);
+  }
+  write(report.dump());
+}
+
+void Telemetry::write(const std::string& line) {
+  if (m_file) {
+    fmt::print(m_file, "{}\n", line);
+    fflush(m_file);
+  }
+  if (m_socket >= 0) {
+    // one report per datagram. Not write_to_socket, which logs an error for each report that
+    // nobody is listening for.
+    send(m_socket, line.data(), line.size(), 0);
+  }
+}
+
+Telemetry& telemetry() {
+  static Telemetry t;
+  return t;
+}
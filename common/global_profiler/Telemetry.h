@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/Timer.h"
+
+#include "third-party/json.hpp"
+
+/*!
+ * Frame time and stutter statistics, written periodically as JSON lines for monitoring a game that
+ * nobody is watching. Each report covers the frames since the last one:
+ *   - the frame time percentiles and the number of long frames
+ *   - for the long frames, what they spent the most time in. These use the same names as the
+ *     GlobalProfiler events at those places.
+ *   - counts of events, like timeouts
+ *   - whatever the info callback adds, like loaded levels and heap usage
+ *
+ * It does nothing until open() is called.
+ */
+class Telemetry {
+ public:
+  ~Telemetry();
+
+  /*!
+   * Start writing reports every interval_s seconds. The output is a file, or a UDP address given
+   * as udp:host:port.
+   */
+  bool open(const std::string& output, double interval_s);
+  void close();
+  bool is_enabled() const { return m_enabled; }
+
+  /*!
+   * Called once per frame by the render loop. Frames longer than long_frame_s count as long.
+   */
+  void frame(double frame_s, double long_frame_s);
+  // time spent in the GlobalProfiler event name during this frame
+  void add_event_time(const char* name, double seconds);
+  // a GlobalProfiler event that happened, for things like timeouts
+  void count_event(const char* name);
+
+  // adds fields to each report, called on the render thread.
+  void set_info_callback(std::function<void(nlohmann::json&)> callback);
+
+  // write a report now, for the frames so far
+  void flush();
+
+ private:
+  void write(const std::string& line);
+
+  std::atomic_bool m_enabled = false;
+  double m_interval_s = 1.;
+  Timer m_clock;
+  double m_last_report = 0;
+  FILE* m_file = nullptr;
+  int m_socket = -1;
+
+  std::mutex m_mutex;
+  std::vector<float> m_frame_ms;
+  u32 m_long_frames = 0;
+  std::unordered_map<std::string, double> m_frame_event_time;  // this frame only
+  std::unordered_map<std::string, u32> m_long_frame_causes;
+  std::unordered_map<std::string, u32> m_event_counts;
+  std::function<void(nlohmann::json&)> m_info_callback;
+};
+
+Telemetry& telemetry();
+
+/*!
+ * Adds the time until it is destroyed to an event of the current frame. Use the same name as the
+ * scoped_prof at the same place.
+ */
+struct ScopedTelemetryTime {
+  explicit ScopedTelemetryTime(const char* _name) : name(_name) {}
+  ScopedTelemetryTime(const ScopedTelemetryTime&) = delete;
+  ScopedTelemetryTime& operator=(const ScopedTelemetryTime&) = delete;
+  ~ScopedTelemetryTime() {
+    if (telemetry().is_enabled()) {
+      telemetry().add_event_time(name, timer.getSeconds());
+    }
+  }
+  const char* name;
+  Timer timer;
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+/*!
+ * @file HeapAllocator.h
+ * Allocation for GOOS heap objects.
+ *
+ * The reader and macro expansion create and free huge numbers of small objects, mostly pairs.
+ * Instead of going to malloc for each one, objects come from per-thread free lists of fixed size
+ * blocks, carved out of large chunks. std::allocate_shared puts the reference count and the object
+ * in a single block.
+ *
+ * Chunks are never returned to the system. An object may be freed by a different thread than the
+ * one that allocated it, in which case the block goes on the freeing thread's list. A thread that
+ * frees more than it allocates (a consumer of objects built elsewhere) gives a chunk's worth of
+ * blocks back to a shared list whenever its list gets too long, and when a thread exits, all of
+ * its free blocks go there. Threads take from the shared list before they allocate a new chunk.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "common/common_types.h"
+
+namespace goos {
+namespace detail {
+
+template <size_t Size, size_t Align>
+class BlockPool {
+ public:
+  static void* allocate() {
+    if (t_exited) {
+      return allocate_shared_list();
+    }
+    auto& local = t_local;
+    if (!local.head) {
+      local.refill();
+    }
+    FreeBlock* block = local.head;
+    local.head = block->next;
+    local.count--;
+    return block;
+  }
+
+  static void deallocate(void* ptr) {
+    auto* block = static_cast<FreeBlock*>(ptr);
+    if (t_exited) {
+      // objects destroyed after this thread's list is gone, like globals at exit.
+      auto& shared = shared_list();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      block->next = shared.head;
+      shared.head = block;
+      return;
+    }
+    auto& local = t_local;
+    block->next = local.head;
+    local.head = block;
+    local.count++;
+    if (local.count > kSpillThreshold) {
+      local.spill();
+    }
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  static constexpr size_t kAlign = std::max(Align, alignof(FreeBlock));
+  static constexpr size_t kBlockSize =
+      ((std::max(Size, sizeof(FreeBlock)) + kAlign - 1) / kAlign) * kAlign;
+  static constexpr size_t kBlocksPerChunk = 1024;
+  // a local list longer than this gives kBlocksPerChunk blocks back to the shared list.
+  static constexpr size_t kSpillThreshold = 4 * kBlocksPerChunk;
+
+  struct SharedList {
+    std::mutex mutex;
+    FreeBlock* head = nullptr;
+  };
+
+  // never destroyed, threads may still free blocks during static destruction.
+  static SharedList& shared_list() {
+    static SharedList* list = new SharedList;
+    return *list;
+  }
+
+  static FreeBlock* new_chunk() {
+    auto* chunk =
+        static_cast<u8*>(::operator new(kBlockSize * kBlocksPerChunk, std::align_val_t(kAlign)));
+    FreeBlock* head = nullptr;
+    for (size_t i = kBlocksPerChunk; i-- > 0;) {
+      auto* block = reinterpret_cast<FreeBlock*>(chunk + i * kBlockSize);
+      block->next = head;
+      head = block;
+    }
+    return head;
+  }
+
+  static void* allocate_shared_list() {
+    auto& shared = shared_list();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (!shared.head) {
+      shared.head = new_chunk();
+    }
+    FreeBlock* block = shared.head;
+    shared.head = block->next;
+    return block;
+  }
+
+  struct LocalList {
+    FreeBlock* head = nullptr;
+    size_t count = 0;
+
+    void refill() {
+      {
+        // take at most a chunk's worth, so one thread doesn't hold on to everything.
+        auto& shared = shared_list();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        if (shared.head) {
+          FreeBlock* tail = shared.head;
+          count = 1;
+          while (tail->next && count < kBlocksPerChunk) {
+            tail = tail->next;
+            count++;
+          }
+          head = shared.head;
+          shared.head = tail->next;
+          tail->next = nullptr;
+          return;
+        }
+      }
+      head = new_chunk();
+      count = kBlocksPerChunk;
+    }
+
+    void spill() {
+      FreeBlock* spilled = head;
+      FreeBlock* tail = head;
+      for (size_t i = 1; i < kBlocksPerChunk; i++) {
+        tail = tail->next;
+      }
+      head = tail->next;
+      count -= kBlocksPerChunk;
+      auto& shared = shared_list();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      tail->next = shared.head;
+      shared.head = spilled;
+    }
+
+    ~LocalList() {
+      t_exited = true;
+      if (!head) {
+        return;
+      }
+      FreeBlock* tail = head;
+      while (tail->next) {
+        tail = tail->next;
+      }
+      auto& shared = shared_list();
+      std::lock_guard<std::mutex> lock(shared.mutex);
+      tail->next = shared.head;
+      shared.head = head;
+      head = nullptr;
+      count = 0;
+    }
+  };
+
+  static inline thread_local LocalList t_local;
+  // trivially destructible, so it can still be read after t_local is destroyed.
+  static inline thread_local bool t_exited = false;
+};
+}  // namespace detail
+
+/*!
+ * Standard allocator that takes single objects from a BlockPool. Arrays go to operator new.
+ */
+template <typename T>
+class HeapAllocator {
+ public:
+  using value_type = T;
+
+  HeapAllocator() = default;
+  template <typename U>
+  HeapAllocator(const HeapAllocator<U>&) {}
+
+  T* allocate(size_t n) {
+    if (n == 1) {
+      return static_cast<T*>(detail::BlockPool<sizeof(T), alignof(T)>::allocate());
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+  }
+
+  void deallocate(T* ptr, size_t n) {
+    if (n == 1) {
+      detail::BlockPool<sizeof(T), alignof(T)>::deallocate(ptr);
+    } else {
+      ::operator delete(ptr, std::align_val_t(alignof(T)));
+    }
+  }
+
+  template <typename U>
+  bool operator==(const HeapAllocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const HeapAllocator<U>&) const {
+    return false;
+  }
+};
+
+/*!
+ * Like std::make_shared, but allocated from the GOOS object pool.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> make_heap_object(Args&&... args) {
+  return std::allocate_shared<T>(HeapAllocator<T>(), std::forward<Args>(args)...);
+}
+}  // namespace goos
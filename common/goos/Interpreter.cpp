@@ -371,17 +371,17 @@ Arguments Interpreter::get_args_no_named(const Object& form,
   }
 
   // loop over forms in list
-  Object current = rest;
-  while (!current.is_empty_list()) {
-    auto arg = current.as_pair()->car;
+  const Object* current = &rest;
+  while (!current->is_empty_list()) {
+    const auto* pair = current->as_pair();
 
     // not a keyword. Add to unnamed or rest, depending on what we expect
     if (spec.varargs || args.unnamed.size() < spec.unnamed.size()) {
-      args.unnamed.push_back(arg);
+      args.unnamed.push_back(pair->car);
     } else {
-      args.rest.push_back(arg);
+      args.rest.push_back(pair->car);
     }
-    current = current.as_pair()->cdr;
+    current = &pair->cdr;
   }
 
   // Check argument size, if spec defines it
@@ -448,6 +448,7 @@ ArgumentSpec Interpreter::parse_arg_spec(const Object& form, Object& rest) {
       }
 
       spec.rest = rest_name.as_symbol().name_ptr;
+      spec.rest_sym = rest_name.as_symbol();
 
       if (!current.as_pair()->cdr.is_empty_list()) {
         throw_eval_error(form, "rest must be the last argument");
@@ -494,6 +495,7 @@ ArgumentSpec Interpreter::parse_arg_spec(const Object& form, Object& rest) {
       }
     } else {
       spec.unnamed.push_back(arg.as_symbol().name_ptr);
+      spec.unnamed_syms.push_back(arg.as_symbol());
     }
 
     current = current.as_pair()->cdr;
@@ -581,7 +583,8 @@ bool try_symbol_lookup(const Object& sym,
                        const std::shared_ptr<EnvironmentObject>& env,
                        Object* dest) {
   // booleans are hard-coded here
-  if (sym.as_symbol() == "#t" || sym.as_symbol() == "#f") {
+  const auto& name = sym.as_symbol();
+  if (name.name_ptr[0] == '#' && (name == "#t" || name == "#f")) {
     *dest = sym;
     return true;
   }
@@ -589,7 +592,7 @@ bool try_symbol_lookup(const Object& sym,
   // loop up envs until we find it.
   EnvironmentObject* search_env = env.get();
   for (;;) {
-    auto* obj = search_env->vars.lookup(sym.as_symbol());
+    auto* obj = search_env->vars.lookup(name);
     if (obj) {
       *dest = *obj;
       return true;
@@ -603,6 +606,13 @@ bool try_symbol_lookup(const Object& sym,
     }
   }
 }
+/*!
+ * Spec for built-in forms. Shared, so they don't build a new one on every call.
+ */
+const ArgumentSpec& varargs_spec() {
+  static const ArgumentSpec spec = make_varargs();
+  return spec;
+}
 }  // namespace
 
 /*!
@@ -649,7 +659,7 @@ Object Interpreter::eval_let_common(const goos::Object& form,
     throw_eval_error(form, "let cannot have empty bindings");
   }
 
-  std::shared_ptr<EnvironmentObject> new_env = std::make_shared<EnvironmentObject>();
+  std::shared_ptr<EnvironmentObject> new_env = make_heap_object<EnvironmentObject>();
   new_env->parent_env = env;
 
   while (!bindings_iter->is_empty_list()) {
@@ -697,7 +707,7 @@ Object Interpreter::eval_pair(const Object& obj, const std::shared_ptr<Environme
     // try builtins next
     const auto& kv_b = builtin_forms.find((void*)head_sym.name_ptr);
     if (kv_b != builtin_forms.end()) {
-      Arguments args = get_args(obj, rest, make_varargs());
+      Arguments args = get_args(obj, rest, varargs_spec());
       // all "built-in" forms expect arguments to be evaluated (that's why they aren't special)
       eval_args(&args, env);
       return ((*this).*(kv_b->second))(obj, args, env);
@@ -706,7 +716,7 @@ Object Interpreter::eval_pair(const Object& obj, const std::shared_ptr<Environme
     // try custom forms next
     for (const auto& cf : m_custom_forms) {
       if (cf.first == head_sym.name_ptr) {
-        Arguments args = get_args(obj, rest, make_varargs());
+        Arguments args = get_args(obj, rest, varargs_spec());
         return (cf.second)(obj, args, env);
       }
     }
@@ -760,9 +770,11 @@ void Interpreter::set_args_in_env(const Object& form,
                                std::to_string(arg_spec.unnamed.size()) + ")");
   }
 
-  // unnamed args
+  // unnamed args. Specs from parse_arg_spec have the names already interned.
+  const bool has_syms = arg_spec.unnamed_syms.size() == arg_spec.unnamed.size();
   for (size_t i = 0; i < arg_spec.unnamed.size(); i++) {
-    env->vars.set(intern_ptr(arg_spec.unnamed.at(i).c_str()), args.unnamed.at(i));
+    env->vars.set(has_syms ? arg_spec.unnamed_syms[i] : intern_ptr(arg_spec.unnamed[i]),
+                  args.unnamed[i]);
   }
 
   // named args
@@ -773,7 +785,8 @@ void Interpreter::set_args_in_env(const Object& form,
   // rest args
   if (!arg_spec.rest.empty()) {
     // will correctly handle the '() case
-    env->vars.set(intern_ptr(arg_spec.rest), build_list(args.rest));
+    env->vars.set(arg_spec.rest_sym.name_ptr ? arg_spec.rest_sym : intern_ptr(arg_spec.rest),
+                  build_list(args.rest));
   } else {
     if (!args.rest.empty()) {
       throw_eval_error(form, "got too many arguments");
@@ -787,7 +800,7 @@ void Interpreter::set_args_in_env(const Object& form,
 Object Interpreter::eval_define(const Object& form,
                                 const Object& rest,
                                 const std::shared_ptr<EnvironmentObject>& env) {
-  auto args = get_args(form, rest, make_varargs());
+  auto args = get_args(form, rest, varargs_spec());
   vararg_check(form, args, {ObjectType::SYMBOL, {}}, {{"env", {false, {}}}});
 
   auto define_env = env;
@@ -809,7 +822,7 @@ Object Interpreter::eval_define(const Object& form,
 Object Interpreter::eval_set(const Object& form,
                              const Object& rest,
                              const std::shared_ptr<EnvironmentObject>& env) {
-  auto args = get_args(form, rest, make_varargs());
+  auto args = get_args(form, rest, varargs_spec());
   vararg_check(form, args, {ObjectType::SYMBOL, {}}, {});
   auto to_define = args.unnamed.at(0);
   Object to_set = eval_with_rewind(args.unnamed.at(1), env);
@@ -896,7 +909,7 @@ Object Interpreter::eval_quote(const Object& form,
                                const Object& rest,
                                const std::shared_ptr<EnvironmentObject>& env) {
   (void)env;
-  auto args = get_args_no_named(form, rest, make_varargs());
+  auto args = get_args_no_named(form, rest, varargs_spec());
   if (args.unnamed.size() != 1) {
     throw_eval_error(form, "invalid number of arguments to quote");
   }
@@ -908,7 +921,7 @@ Object build_list_with_spliced_tail(std::vector<Object>&& objects, const Object&
     return tail;
   }
 
-  std::shared_ptr<PairObject> head = std::make_shared<PairObject>(objects.back(), tail);
+  std::shared_ptr<PairObject> head = make_heap_object<PairObject>(objects.back(), tail);
 
   s64 idx = ((s64)objects.size()) - 2;
   while (idx >= 0) {
@@ -916,7 +929,7 @@ Object build_list_with_spliced_tail(std::vector<Object>&& objects, const Object&
     next.type = ObjectType::PAIR;
     next.heap_obj = std::move(head);
 
-    head = std::make_shared<PairObject>();
+    head = make_heap_object<PairObject>();
     head->car = std::move(objects[idx]);
     head->cdr = std::move(next);
 
@@ -1024,12 +1037,12 @@ Object Interpreter::eval_cond(const Object& form,
     throw_eval_error(form, "cond must have at least one clause, which must be a form");
   Object result;
 
-  Object lst = rest;
+  const Object* lst = &rest;
   for (;;) {
-    if (lst.type == ObjectType::PAIR) {
-      Object current_case = lst.as_pair()->car;
+    if (lst->type == ObjectType::PAIR) {
+      const Object& current_case = lst->as_pair()->car;
       if (current_case.type != ObjectType::PAIR)
-        throw_eval_error(lst, "bogus cond case");
+        throw_eval_error(*lst, "bogus cond case");
 
       // check condition:
       Object condition_result = eval_with_rewind(current_case.as_pair()->car, env);
@@ -1041,9 +1054,9 @@ Object Interpreter::eval_cond(const Object& form,
         return eval_list_return_last(current_case, current_case.as_pair()->cdr, env);
       } else {
         // no match, continue.
-        lst = lst.as_pair()->cdr;
+        lst = &lst->as_pair()->cdr;
       }
-    } else if (lst.type == ObjectType::EMPTY_LIST) {
+    } else if (lst->type == ObjectType::EMPTY_LIST) {
       return m_false_object;
     } else {
       throw_eval_error(form, "malformed cond");
@@ -1061,15 +1074,15 @@ Object Interpreter::eval_or(const Object& form,
     throw_eval_error(form, "or must have at least one argument!");
   }
 
-  Object lst = rest;
+  const Object* lst = &rest;
   for (;;) {
-    if (lst.type == ObjectType::PAIR) {
-      Object current = eval_with_rewind(lst.as_pair()->car, env);
+    if (lst->type == ObjectType::PAIR) {
+      Object current = eval_with_rewind(lst->as_pair()->car, env);
       if (truthy(current)) {
         return current;
       }
-      lst = lst.as_pair()->cdr;
-    } else if (lst.type == ObjectType::EMPTY_LIST) {
+      lst = &lst->as_pair()->cdr;
+    } else if (lst->type == ObjectType::EMPTY_LIST) {
       return m_false_object;
     } else {
       throw_eval_error(form, "invalid or form");
@@ -1087,16 +1100,16 @@ Object Interpreter::eval_and(const Object& form,
     throw_eval_error(form, "and must have at least one argument!");
   }
 
-  Object lst = rest;
+  const Object* lst = &rest;
   Object current;
   for (;;) {
-    if (lst.type == ObjectType::PAIR) {
-      current = eval_with_rewind(lst.as_pair()->car, env);
+    if (lst->type == ObjectType::PAIR) {
+      current = eval_with_rewind(lst->as_pair()->car, env);
       if (!truthy(current)) {
         return m_false_object;
       }
-      lst = lst.as_pair()->cdr;
-    } else if (lst.type == ObjectType::EMPTY_LIST) {
+      lst = &lst->as_pair()->cdr;
+    } else if (lst->type == ObjectType::EMPTY_LIST) {
       return current;
     } else {
       throw_eval_error(form, "invalid and form");
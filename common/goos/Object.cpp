@@ -41,6 +41,7 @@
 #include "Object.h"
 
 #include <cinttypes>
+#include <cstdlib>
 #include <cstring>
 
 #include "common/util/FileUtil.h"
@@ -166,9 +167,10 @@ std::string object_type_to_string(ObjectType type) {
  */
 template <>
 std::string fixed_to_string(FloatType x) {
-  auto result = float_to_string(x);
-  ASSERT((float)x == (float)std::stod(result));
-  return result;
+  char buffer[64];
+  int length = float_to_cstr(x, buffer);
+  ASSERT((float)x == (float)std::strtod(buffer, nullptr));
+  return std::string(buffer, length);
 }
 
 /*!
@@ -230,7 +232,7 @@ Object build_list(const std::vector<Object>& objects) {
   // this is by far the most expensive part of parsing, so this is done a bit carefully.
   // we maintain a std::shared_ptr<PairObject> that represents the list, built from back to front.
   std::shared_ptr<PairObject> head =
-      std::make_shared<PairObject>(objects.back(), Object::make_empty_list());
+      make_heap_object<PairObject>(objects.back(), Object::make_empty_list());
 
   s64 idx = ((s64)objects.size()) - 2;
   while (idx >= 0) {
@@ -238,7 +240,7 @@ Object build_list(const std::vector<Object>& objects) {
     next.type = ObjectType::PAIR;
     next.heap_obj = std::move(head);
 
-    head = std::make_shared<PairObject>();
+    head = make_heap_object<PairObject>();
     head->car = objects[idx];
     head->cdr = std::move(next);
 
@@ -259,7 +261,7 @@ Object build_list(std::vector<Object>&& objects) {
   // this is by far the most expensive part of parsing, so this is done a bit carefully.
   // we maintain a std::shared_ptr<PairObject> that represents the list, built from back to front.
   std::shared_ptr<PairObject> head =
-      std::make_shared<PairObject>(objects.back(), Object::make_empty_list());
+      make_heap_object<PairObject>(objects.back(), Object::make_empty_list());
 
   s64 idx = ((s64)objects.size()) - 2;
   while (idx >= 0) {
@@ -267,7 +269,7 @@ Object build_list(std::vector<Object>&& objects) {
     next.type = ObjectType::PAIR;
     next.heap_obj = std::move(head);
 
-    head = std::make_shared<PairObject>();
+    head = make_heap_object<PairObject>();
     head->car = std::move(objects[idx]);
     head->cdr = std::move(next);
 
@@ -7,7 +7,7 @@
  * An "Object" is an efficient wrapper around any of these types.
  * Some types are "heap allocated", and have reference semantics, and others are
  * "fixed" and have value semantics.  Heap allocated objects implement reference counting with
- * std::shared_ptr.
+ * std::shared_ptr, and are allocated from a pool (see HeapAllocator.h) with make_heap_object.
  *
  * To create a new Object for a heap allocated type, use the make_new static method of the type of
  * object you want to make. This will return a correctly setup Object. For fixed objects, use
@@ -54,6 +54,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/goos/HeapAllocator.h"
 #include "common/util/Assert.h"
 #include "common/util/crc32.h"
 
@@ -405,7 +406,7 @@ class StringObject : public HeapObject {
   static Object make_new(const std::string& text) {
     Object obj;
     obj.type = ObjectType::STRING;
-    obj.heap_obj = std::make_shared<StringObject>(text);
+    obj.heap_obj = make_heap_object<StringObject>(text);
     return obj;
   }
 
@@ -419,47 +420,41 @@ class PairObject : public HeapObject {
  public:
   Object car, cdr;
 
+  // where this form came from in the source, owned by the TextDb with the matching id.
+  u32 text_db_id = 0;
+  u32 text_ref = 0;
+
   PairObject(const Object& car_, const Object& cdr_) : car(car_), cdr(cdr_) {}
   PairObject() = default;
 
   static Object make_new(const Object& a, const Object& b) {
     Object obj;
     obj.type = ObjectType::PAIR;
-    obj.heap_obj = std::make_shared<PairObject>(a, b);
+    obj.heap_obj = make_heap_object<PairObject>(a, b);
     return obj;
   }
 
   std::string print() const override {
-    std::pair<Object, Object> to_print_pair = std::make_pair(car, cdr);
-
     std::string result = "(";
 
     // print first thing:
     result += car.print();
 
-    // print second thing
-    Object to_print = cdr;
-    if (to_print.type == ObjectType::EMPTY_LIST) {
-      result += ")";
-      return result;
-    } else {
-      result += " ";
-    }
-
+    // walk the rest without copying Objects, which would touch every reference count.
+    const Object* to_print = &cdr;
     for (;;) {
-      if (to_print.type == ObjectType::PAIR) {
-        Object to_print_car = std::dynamic_pointer_cast<PairObject>(to_print.heap_obj)->car;
-        result += to_print_car.print();
-        to_print = std::dynamic_pointer_cast<PairObject>(to_print.heap_obj)->cdr;
-        if (to_print.type == ObjectType::EMPTY_LIST) {
-          result += ")";
-          return result;
-        } else {
-          result += " ";
-        }
+      if (to_print->type == ObjectType::EMPTY_LIST) {
+        result += ")";
+        return result;
+      }
+      result += " ";
+      if (to_print->type == ObjectType::PAIR) {
+        auto* pair = static_cast<const PairObject*>(to_print->heap_obj.get());
+        result += pair->car.print();
+        to_print = &pair->cdr;
       } else {
         result += ". ";
-        result += to_print.print();
+        result += to_print->print();
         result += ")";
         return result;
       }
@@ -534,13 +529,27 @@ class InternedPtrMap {
     // should be impossible to reach.
     ASSERT_NOT_REACHED();
   }
+  /*!
+   * Call f(name, value) on each entry, in no particular order.
+   */
+  template <typename F>
+  void for_each(F&& f) const {
+    for (const auto& e : m_entries) {
+      if (e.key) {
+        f(e.key, e.value);
+      }
+    }
+  }
+
   void clear() {
+    // most environments are for a lambda or macro call and only hold a few arguments, so start
+    // small. Lookups in small maps are a linear search over every slot.
     m_entries.clear();
-    m_power_of_two_size = 3;  // 2 ^ 3 = 8
-    m_entries.resize(8);
+    m_power_of_two_size = 2;  // 2 ^ 2 = 4
+    m_entries.resize(4);
     m_used_entries = 0;
     m_next_resize = (m_entries.size() * kMaxUsed);
-    m_mask = 0b111;
+    m_mask = 0b11;
   }
 
  private:
@@ -602,7 +611,7 @@ class EnvironmentObject : public HeapObject {
   static Object make_new() {
     Object obj;
     obj.type = ObjectType::ENVIRONMENT;
-    obj.heap_obj = std::make_shared<EnvironmentObject>();
+    obj.heap_obj = make_heap_object<EnvironmentObject>();
     return obj;
   }
 
@@ -610,7 +619,7 @@ class EnvironmentObject : public HeapObject {
                          std::shared_ptr<EnvironmentObject> parent_env = nullptr) {
     Object obj;
     obj.type = ObjectType::ENVIRONMENT;
-    auto env = std::make_shared<EnvironmentObject>();
+    auto env = make_heap_object<EnvironmentObject>();
     env->name = std::move(name);
     env->parent_env = std::move(parent_env);
     obj.heap_obj = std::move(env);
@@ -643,6 +652,10 @@ struct ArgumentSpec {
   std::vector<std::string> unnamed;
   std::unordered_map<std::string, NamedArg> named;
   std::string rest;
+  // the interned names, filled in by Interpreter::parse_arg_spec so binding arguments doesn't have
+  // to look up each name in the symbol table.
+  std::vector<InternedSymbolPtr> unnamed_syms;
+  InternedSymbolPtr rest_sym = {nullptr};
   std::string print() const;
 };
 
@@ -675,7 +688,7 @@ class LambdaObject : public HeapObject {
   static Object make_new() {
     Object obj;
     obj.type = ObjectType::LAMBDA;
-    obj.heap_obj = std::make_shared<LambdaObject>();
+    obj.heap_obj = make_heap_object<LambdaObject>();
     return obj;
   }
 
@@ -702,7 +715,7 @@ class MacroObject : public HeapObject {
   static Object make_new() {
     Object obj;
     obj.type = ObjectType::MACRO;
-    obj.heap_obj = std::make_shared<MacroObject>();
+    obj.heap_obj = make_heap_object<MacroObject>();
     return obj;
   }
 
@@ -724,7 +737,7 @@ class ArrayObject : public HeapObject {
   static Object make_new(std::vector<Object> objects) {
     Object obj;
     obj.type = ObjectType::ARRAY;
-    obj.heap_obj = std::make_shared<ArrayObject>(std::move(objects));
+    obj.heap_obj = make_heap_object<ArrayObject>(std::move(objects));
     return obj;
   }
 
@@ -758,7 +771,7 @@ class StringHashTableObject : public HeapObject {
   static Object make_new() {
     Object obj;
     obj.type = ObjectType::STRING_HASH_TABLE;
-    obj.heap_obj = std::make_shared<StringHashTableObject>();
+    obj.heap_obj = make_heap_object<StringHashTableObject>();
     return obj;
   }
 
@@ -805,7 +818,7 @@ inline std::shared_ptr<EnvironmentObject> Object::as_env_ptr() const {
   if (type != ObjectType::ENVIRONMENT) {
     throw std::runtime_error("as_env called on a " + object_type_to_string(type) + " " + print());
   }
-  return std::dynamic_pointer_cast<EnvironmentObject>(heap_obj);
+  return std::static_pointer_cast<EnvironmentObject>(heap_obj);
 }
 
 inline StringObject* Object::as_string() const {
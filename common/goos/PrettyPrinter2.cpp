@@ -1,5 +1,10 @@
 #include "PrettyPrinter2.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+
 #include "common/common_types.h"
 #include "common/util/Assert.h"
 
@@ -15,158 +20,165 @@ namespace v2 {
 // element in a list.
 
 // The main node type.
-// unlike v1, this nests lists.
-// these have pointers to parents, so generally not safe to copy.
+// unlike v1, this nests lists. The nodes live in a flat arena (Printer::m_nodes), and the children
+// of a list are consecutive in the arena, so nodes refer to each other by index.
 struct Node {
-  Node() = default;
-
-  Node(const std::string& str) : kind(Kind::ATOM), atom_str(str) {}
-
-  Node(std::vector<Node>&& list, bool is_list)
-      : kind(is_list ? Kind::LIST : Kind::IMPROPER_LIST), child_nodes(std::move(list)) {}
   enum class Kind : u8 { ATOM, LIST, IMPROPER_LIST, INVALID } kind = Kind::INVALID;
 
-  std::vector<Node> child_nodes;
-  std::string atom_str;
+  bool break_list = false;
+  // text_len must be recomputed. Set when this node or something below it is broken.
+  bool dirty = true;
+  // the closing paren goes on its own line. Only computed right before printing.
+  bool end_paren_newline = false;
+  u8 top_line_count = 0;
+  u8 sub_elt_indent = 0;
 
-  // number of quotes this is wrapped in.
-  enum class QuoteKind { QUOTE, UNQUOTE, QUASIQUOTE, UNQUOTE_SPLICING };
-  std::vector<QuoteKind> quotes;
+  // the quotes this is wrapped in, then the atom text (for atoms), in Printer::m_text.
+  u32 text_start = 0;
+  u32 quote_count = 0;
+  u32 atom_size = 0;
 
-  Node* parent = nullptr;
+  u32 first_child = 0;
+  u32 child_count = 0;
+  s32 parent = -1;
   u32 my_depth = 0;
 
-  int get_quote_length() const;
-
-  void link(Node* this_parent, std::vector<Node*>* bfs_order, u32 depth) {
-    parent = this_parent;
-    my_depth = depth;
-    bfs_order->push_back(this);
-    switch (kind) {
-      case Kind::ATOM:
-        break;
-      case Kind::LIST:
-      case Kind::IMPROPER_LIST:
-        ASSERT(!child_nodes.empty());
-        for (auto& child : child_nodes) {
-          child.link(this, bfs_order, depth + 1);
-        }
-        break;
-      default:
-        ASSERT(false);
-    }
-  }
+  // how wide is this text? not including the indentation of this subtree.
+  u32 text_len = 0;
 
-  bool needs_end_paren_newline() const {
-    if (break_list) {
-      return true;
-    }
+  u32 last_child() const { return first_child + child_count - 1; }
+};
 
-    if (!child_nodes.empty()) {
-      return child_nodes.back().needs_end_paren_newline();
-    }
+bool is_symbol(const goos::Object& obj, const char* name) {
+  return obj.is_symbol() && obj.as_symbol() == name;
+}
 
-    return false;
+// How far after the listing indent the next element on the top line of a broken list starts.
+// s0 is where the previous element started, and len is the length of the output so far, both
+// relative to the start of the printed object.
+// This used to scan back from the end of the output looking for a newline, but compared the
+// position (instead of the character) to '\n'. That's kept, to not change the output.
+int compute_extra_offset(size_t len, size_t s0, int ei) {
+  if (s0 < '\n' && len > '\n') {
+    return len - '\n';
   }
+  return ei + len - s0;
+}
 
-  std::string debug_to_string() const {
-    switch (kind) {
-      case Kind::ATOM:
-        return fmt::format("[atom {}]", atom_str);
-      case Kind::LIST:
-        return "[list]";
-      case Kind::IMPROPER_LIST:
-        return "[improper list]";
-      default:
-        ASSERT(false);
+/*!
+ * Pretty printer state. The arena and text buffers are kept between prints, so printing doesn't
+ * allocate once they have grown to fit the biggest object.
+ */
+class Printer {
+ public:
+  void print(const goos::Object& obj, int line_length, std::string& out);
+
+ private:
+  void add_node(u32 idx, const goos::Object& obj, s32 parent, u32 depth);
+  std::string_view quotes(const Node& node) const {
+    return std::string_view(m_text).substr(node.text_start, node.quote_count);
+  }
+  std::string_view atom_str(const Node& node) const {
+    return std::string_view(m_text).substr(node.text_start + node.quote_count, node.atom_size);
+  }
+  Node& child(const Node& node, size_t idx) {
+    if (idx >= node.child_count) {
+      throw std::out_of_range(fmt::format("pretty printer: list has no element {}", idx));
     }
+    return m_nodes[node.first_child + idx];
   }
-
-  // how wide is this text? not including the indentation of this subtree.
-  u32 text_len = 0;
-
-  bool break_list = false;
-  u8 top_line_count = 0;
-  u8 sub_elt_indent = 0;
+  size_t out_pos() const { return m_out->size() - m_out_start; }
+
+  void recompute_lengths();
+  void break_list(u32 idx);
+  void insert_required_breaks();
+  int run_algorithm(int line_length);
+  void compute_end_paren_newlines();
+  void append_node(u32 idx, int init_indent_level, int next_indent_level);
+
+  std::vector<Node> m_nodes;
+  // all nodes, parents before children (depth-first order)
+  std::vector<u32> m_order;
+  std::string m_text;
+
+  std::string* m_out = nullptr;
+  size_t m_out_start = 0;
 };
 
-inline const std::string quote_symbol(Node::QuoteKind kind) {
-  switch (kind) {
-    case Node::QuoteKind::QUOTE:
-      return "'";
-    case Node::QuoteKind::QUASIQUOTE:
-      return "`";
-    case Node::QuoteKind::UNQUOTE:
-      return ",";
-    case Node::QuoteKind::UNQUOTE_SPLICING:
-      return ",@";
-    default:
-      ASSERT_MSG(false, fmt::format("invalid quote kind {}", fmt::underlying(kind)));
-      return "[invalid]";
-  }
-}
-
-int Node::get_quote_length() const {
-  int out = 0;
-  for (auto& q : quotes) {
-    out += quote_symbol(q).length();
+void Printer::add_node(u32 idx, const goos::Object& obj, s32 parent, u32 depth) {
+  m_order.push_back(idx);
+  m_nodes[idx].parent = parent;
+  m_nodes[idx].my_depth = depth;
+  m_nodes[idx].text_start = m_text.size();
+
+  // strip off (quote x) and (unquote x).
+  const goos::Object* to_print = &obj;
+  while (to_print->is_pair()) {
+    auto& first = to_print->as_pair()->car;
+    auto& second = to_print->as_pair()->cdr;
+    char quote;
+    if (is_symbol(first, "quote")) {
+      quote = '\'';
+    } else if (is_symbol(first, "unquote")) {
+      quote = ',';
+    } else {
+      break;
+    }
+    if (!second.is_pair() || !second.as_pair()->cdr.is_empty_list()) {
+      break;
+    }
+    m_text.push_back(quote);
+    to_print = &second.as_pair()->car;
   }
-  return out;
-}
+  // the innermost quote is printed first.
+  std::reverse(m_text.begin() + m_nodes[idx].text_start, m_text.end());
+  m_nodes[idx].quote_count = m_text.size() - m_nodes[idx].text_start;
 
-Node to_node(const goos::Object& obj) {
-  switch (obj.type) {
+  switch (to_print->type) {
     case goos::ObjectType::EMPTY_LIST:
       // just treat this as a printing "atom"
-      return Node("()");
+      m_text.append("()");
+      break;
+    case goos::ObjectType::SYMBOL:
+      m_text.append(to_print->as_symbol().name_ptr);
+      break;
     case goos::ObjectType::INTEGER:
     case goos::ObjectType::FLOAT:
     case goos::ObjectType::CHAR:
-    case goos::ObjectType::SYMBOL:
     case goos::ObjectType::STRING:
       // these are all atoms that the pretty printer should just treat as a blob.
-      return Node(obj.print());
+      m_text.append(to_print->print());
+      break;
 
     case goos::ObjectType::PAIR: {
-      // we've got four cases: quoted thing, unquoted thing, proper list, improper list.
-
-      // there's probably a better way to do this but i am lazy
-      auto& first = obj.as_pair()->car;
-      if (first.is_symbol("quote")) {
-        auto& second = obj.as_pair()->cdr;
-        if (second.is_pair() && second.as_pair()->cdr.is_empty_list()) {
-          Node result = to_node(second.as_pair()->car);
-          result.quotes.push_back(Node::QuoteKind::QUOTE);
-          return result;
-        }
-      } else if (first.is_symbol("unquote")) {
-        auto& second = obj.as_pair()->cdr;
-        if (second.is_pair() && second.as_pair()->cdr.is_empty_list()) {
-          Node result = to_node(second.as_pair()->car);
-          result.quotes.push_back(Node::QuoteKind::UNQUOTE);
-          return result;
-        }
+      // either a proper or improper list. The children go at the end of the arena, together.
+      u32 count = 0;
+      const goos::Object* it = to_print;
+      while (it->is_pair()) {
+        count++;
+        it = &it->as_pair()->cdr;
+      }
+      bool is_list = it->is_empty_list();
+      if (!is_list) {
+        count++;
       }
 
-      // not quoted, so either list or pair
-      std::vector<Node> children;
-      auto* to_print = &obj;
-      for (;;) {
-        if (to_print->is_pair()) {
-          // first print the car:
-          children.push_back(to_node(to_print->as_pair()->car));
-          // then load up the cdr as the next thing to print
-          to_print = &to_print->as_pair()->cdr;
-          if (to_print->is_empty_list()) {
-            // we're done, add a close paren and finish
-            return Node(std::move(children), true);
-          }
-        } else {
-          children.push_back(to_node(*to_print));
-          return Node(std::move(children), false);
-        }
+      u32 first_child = m_nodes.size();
+      m_nodes.resize(first_child + count);
+      Node& node = m_nodes[idx];
+      node.kind = is_list ? Node::Kind::LIST : Node::Kind::IMPROPER_LIST;
+      node.first_child = first_child;
+      node.child_count = count;
+
+      u32 child_idx = first_child;
+      for (it = to_print; it->is_pair(); it = &it->as_pair()->cdr) {
+        add_node(child_idx++, it->as_pair()->car, idx, depth + 1);
+      }
+      if (!is_list) {
+        add_node(child_idx, *it, idx, depth + 1);
       }
-    } break;
+      return;
+    }
 
       // these are unsupported by the pretty printer.
     case goos::ObjectType::ARRAY:  // todo, we should probably handle arrays.
@@ -177,26 +189,33 @@ Node to_node(const goos::Object& obj) {
     default:
       ASSERT(false);
   }
+
+  Node& node = m_nodes[idx];
+  node.kind = Node::Kind::ATOM;
+  node.atom_size = m_text.size() - node.text_start - node.quote_count;
 }
 
-void recompute_lengths(const std::vector<Node*>& bfs_order) {
-  // iterate from leaves up
-  for (auto it = bfs_order.rbegin(); it != bfs_order.rend(); it++) {
-    Node* node = *it;
-    switch (node->kind) {
+void Printer::recompute_lengths() {
+  // iterate from leaves up, skipping subtrees that haven't changed.
+  for (auto it = m_order.rbegin(); it != m_order.rend(); it++) {
+    Node& node = m_nodes[*it];
+    if (!node.dirty) {
+      continue;
+    }
+    node.dirty = false;
+    switch (node.kind) {
       case Node::Kind::ATOM:
-        node->text_len = node->atom_str.length() + node->get_quote_length();
+        node.text_len = node.atom_size + node.quote_count;
         break;
       case Node::Kind::IMPROPER_LIST:
       case Node::Kind::LIST: {
-        if (node->break_list) {
+        if (node.break_list) {
           // special case compute first line length
-          int first_line_len = 1 + node->get_quote_length();  // open paren + quotes
-          int nodes_on_first_line =
-              std::min(int(node->child_nodes.size()), int(node->top_line_count));
+          int first_line_len = 1 + node.quote_count;  // open paren + quotes
+          int nodes_on_first_line = std::min(int(node.child_count), int(node.top_line_count));
           if (nodes_on_first_line > 0) {
             for (int node_idx = 0; node_idx < nodes_on_first_line; node_idx++) {
-              first_line_len += node->child_nodes.at(node_idx).text_len;
+              first_line_len += m_nodes[node.first_child + node_idx].text_len;
               first_line_len++;  // trailing space
             }
             first_line_len--;  // last one doesn't have a trailing space
@@ -205,17 +224,16 @@ void recompute_lengths(const std::vector<Node*>& bfs_order) {
           int max_line_len = first_line_len;
 
           // now the length of all the things below
-          for (u32 node_idx = nodes_on_first_line; node_idx < node->child_nodes.size();
-               node_idx++) {
-            int line_len = node->sub_elt_indent + node->child_nodes.at(node_idx).text_len;
+          for (u32 node_idx = nodes_on_first_line; node_idx < node.child_count; node_idx++) {
+            int line_len = node.sub_elt_indent + m_nodes[node.first_child + node_idx].text_len;
             max_line_len = std::max(max_line_len, line_len);
           }
 
-          node->text_len = max_line_len;
+          node.text_len = max_line_len;
         } else {
-          node->text_len = 1 + node->get_quote_length();  // open paren + quotes
-          for (auto& child : node->child_nodes) {
-            node->text_len += (child.text_len + 1);  // space or close paren.
+          node.text_len = 1 + node.quote_count;  // open paren + quotes
+          for (u32 i = 0; i < node.child_count; i++) {
+            node.text_len += (m_nodes[node.first_child + i].text_len + 1);  // space or close paren.
           }
         }
       } break;
@@ -230,13 +248,15 @@ void recompute_lengths(const std::vector<Node*>& bfs_order) {
  * These rules will be used if the printer decides it should break up the list.
  * If you want to force a form to always be broken up, see insert_required_breaks
  */
-void break_list(Node* node) {
+void Printer::break_list(u32 idx) {
+  Node* node = &m_nodes[idx];
   ASSERT(!node->break_list);
   node->break_list = true;
+  node->dirty = true;
   node->sub_elt_indent = 2;
   node->top_line_count = 1;
 
-  const std::unordered_set<std::string> sameline_splitters = {
+  static const std::unordered_set<std::string_view> sameline_splitters = {
       "if",
       "<",
       ">",
@@ -266,12 +286,13 @@ void break_list(Node* node) {
       "dma-buffer-add-gs-set-flusha",
   };
 
-  if (node->child_nodes.at(0).kind == Node::Kind::LIST) {
+  auto& head = child(*node, 0);
+  if (head.kind == Node::Kind::LIST) {
     // ((foo
     //    bar
     node->sub_elt_indent = 1;
-  } else if (node->child_nodes.at(0).kind == Node::Kind::ATOM) {
-    auto& name = node->child_nodes[0].atom_str;
+  } else if (head.kind == Node::Kind::ATOM) {
+    auto name = atom_str(head);
     if (name == "defun" || name == "defun-debug" || name == "defbehavior" || name == "defstate") {
       // things with three things in the top line: (defun <name> <args>
       node->top_line_count = 3;
@@ -290,7 +311,7 @@ void break_list(Node* node) {
       // things with 4 things in the top line: (defmethod <method> <type> <args>
       // or just 3 things in the top line: (defmethod <method> <args>
       node->top_line_count = 3;
-      if (node->child_nodes.size() >= 4 && node->child_nodes[2].kind == Node::Kind::ATOM) {
+      if (node->child_count >= 4 && child(*node, 2).kind == Node::Kind::ATOM) {
         node->top_line_count = 4;
       }
     } else if (name == "until" || name == "while" || name == "dotimes" || name == "countdown" ||
@@ -301,10 +322,10 @@ void break_list(Node* node) {
                name == "with-dma-buffer-add-bucket") {
       // special case for things like let.
       node->top_line_count = 2;  // (let <defs>
-      if (node->child_nodes.size() > 1 && node->child_nodes[1].child_nodes.size() > 1 &&
-          !node->child_nodes[1].break_list) {
+      if (node->child_count > 1 && child(*node, 1).child_count > 1 &&
+          !child(*node, 1).break_list) {
         // and break the defs.
-        break_list(&node->child_nodes[1]);
+        break_list(node->first_child + 1);
       }
     } else if (sameline_splitters.count(name) > 0) {
       // if has a special indent rule:
@@ -312,49 +333,52 @@ void break_list(Node* node) {
       node->sub_elt_indent += name.size();
     } else if (name == "cond") {
       // cond should always be broken up
-      for (size_t i = 1; i < node->child_nodes.size(); i++) {
-        auto& cond_body = node->child_nodes[i];
+      for (size_t i = 1; i < node->child_count; i++) {
+        auto& cond_body = child(*node, i);
         if (cond_body.kind == Node::Kind::LIST && !cond_body.break_list) {
-          break_list(&cond_body);
+          break_list(node->first_child + i);
         }
       }
     } else if (name == "case") {
       // case gets a second thing on top, plus break up everything.
       node->top_line_count = 2;
-      for (size_t i = 2; i < node->child_nodes.size(); i++) {
-        auto& cond_body = node->child_nodes[i];
+      for (size_t i = 2; i < node->child_count; i++) {
+        auto& cond_body = child(*node, i);
         if (cond_body.kind == Node::Kind::LIST && !cond_body.break_list) {
-          break_list(&cond_body);
+          break_list(node->first_child + i);
         }
       }
     }
   }
 
-  Node* child = node;
-  for (Node* p = node->parent; p; p = p->parent) {
-    if (!p->break_list && &p->child_nodes.back() != child) {
+  u32 child_idx = idx;
+  for (s32 p = node->parent; p >= 0; p = m_nodes[p].parent) {
+    Node& parent = m_nodes[p];
+    parent.dirty = true;
+    if (!parent.break_list && parent.last_child() != child_idx) {
       break_list(p);
     }
-    child = p;
+    child_idx = p;
   }
 }
 
-void insert_required_breaks(const std::vector<Node*>& bfs_order) {
-  const std::unordered_set<std::string> always_break = {
+void Printer::insert_required_breaks() {
+  static const std::unordered_set<std::string_view> always_break = {
       "when",     "defun-debug", "countdown", "case", "defun", "defmethod",   "let",     "until",
       "while",    "if",          "dotimes",   "cond", "else",  "defbehavior", "with-pp", "rlet",
       "defstate", "behavior",    "defpart",   "loop", "let*",  "suspend-for"};
-  for (auto node : bfs_order) {
-    if (!node->break_list && node->kind == Node::Kind::LIST &&
-        node->child_nodes.at(0).kind == Node::Kind::ATOM) {
-      if (always_break.count(node->child_nodes[0].atom_str) > 0) {
-        break_list(node);
+  for (auto idx : m_order) {
+    auto& node = m_nodes[idx];
+    if (!node.break_list && node.kind == Node::Kind::LIST &&
+        child(node, 0).kind == Node::Kind::ATOM) {
+      if (always_break.count(atom_str(child(node, 0))) > 0) {
+        break_list(idx);
       }
     }
   }
 }
 
-int run_algorithm(const std::vector<Node*>& bfs_order, int line_length) {
+int Printer::run_algorithm(int line_length) {
   // our approach is to go in reverse order and find the first list node that is:
   // - too long
   // - not already split.
@@ -363,97 +387,84 @@ int run_algorithm(const std::vector<Node*>& bfs_order, int line_length) {
 
   int num_broken = 0;
   std::optional<s32> min_depth;
-  for (auto it = bfs_order.rbegin(); it != bfs_order.rend(); it++) {
-    Node* node = *it;
-    if (min_depth && node->my_depth < min_depth) {
+  for (auto it = m_order.rbegin(); it != m_order.rend(); it++) {
+    Node& node = m_nodes[*it];
+    if (min_depth && node.my_depth < min_depth) {
       break;
     }
 
-    if (node->kind != Node::Kind::ATOM && (int)node->text_len > line_length &&
-        node->break_list == false) {
-      break_list(node);
+    if (node.kind != Node::Kind::ATOM && (int)node.text_len > line_length &&
+        node.break_list == false) {
+      break_list(*it);
       num_broken++;
       if (!min_depth) {
-        min_depth = node->my_depth;
+        min_depth = node.my_depth;
       }
     }
   }
-  recompute_lengths(bfs_order);
+  recompute_lengths();
   return num_broken;
 }
 
-int compute_extra_offset(const std::string& str, int s0, int ei) {
-  ASSERT(!str.empty());
-  for (size_t i = str.length(); i-- > 0;) {
-    if ((int)i == s0) {
-      return ei + str.length() - s0;
-    } else if (i == '\n') {
-      return str.length() - i;
-    }
+void Printer::compute_end_paren_newlines() {
+  for (auto it = m_order.rbegin(); it != m_order.rend(); it++) {
+    Node& node = m_nodes[*it];
+    node.end_paren_newline =
+        node.break_list || (node.child_count && m_nodes[node.last_child()].end_paren_newline);
   }
-  return ei + str.length() - s0;
 }
 
-void append_node_to_string(const Node* node,
-                           std::string& str,
-                           int init_indent_level,
-                           int next_indent_level) {
-  for (int i = 0; i < init_indent_level; i++) {
-    str.push_back(' ');
-  }
-  for (auto q : node->quotes) {
-    str.append(quote_symbol(q));
-  }
-  switch (node->kind) {
+void Printer::append_node(u32 idx, int init_indent_level, int next_indent_level) {
+  std::string& str = *m_out;
+  const Node& node = m_nodes[idx];
+  str.append(init_indent_level, ' ');
+  str.append(quotes(node));
+  switch (node.kind) {
     case Node::Kind::ATOM:
-      str.append(node->atom_str);
+      str.append(atom_str(node));
       break;
     case Node::Kind::IMPROPER_LIST:
     case Node::Kind::LIST:
-      if (node->break_list) {
+      if (node.break_list) {
         str.push_back('(');
         size_t node_idx = 0;
 
-        int listing_indent = next_indent_level + node->get_quote_length() + node->sub_elt_indent;
+        int listing_indent = next_indent_level + node.quote_count + node.sub_elt_indent;
         int extra_indent = 0;
         int old_indent = listing_indent;
-        if (node->top_line_count) {
-          listing_indent -= node->sub_elt_indent;
-          listing_indent += node->child_nodes.front().kind == Node::Kind::LIST ? 1 : 2;
+        if (node.top_line_count) {
+          listing_indent -= node.sub_elt_indent;
+          listing_indent += child(node, 0).kind == Node::Kind::LIST ? 1 : 2;
         }
-        for (; node_idx < node->top_line_count; node_idx++) {
-          size_t s0 = str.length();
-          if (node->kind == Node::Kind::IMPROPER_LIST &&
-              &node->child_nodes.at(node_idx) == &node->child_nodes.back()) {
+        for (; node_idx < node.top_line_count; node_idx++) {
+          size_t s0 = out_pos();
+          child(node, node_idx);  // bounds check
+          if (node.kind == Node::Kind::IMPROPER_LIST && node_idx == node.child_count - 1) {
             str.append(". ");
           }
           // so, if these need to break, they should have a bigger indent.
-          append_node_to_string(&node->child_nodes.at(node_idx), str, 0,
-                                listing_indent + extra_indent);
-          extra_indent = compute_extra_offset(str, s0, extra_indent);
+          append_node(node.first_child + node_idx, 0, listing_indent + extra_indent);
+          extra_indent = compute_extra_offset(out_pos(), s0, extra_indent);
           str.push_back(' ');
         }
-        if (node->top_line_count) {
+        if (node.top_line_count) {
           listing_indent = old_indent;
         }
-        if (node->top_line_count > 0) {
+        if (node.top_line_count > 0) {
           str.pop_back();
         }
         str.push_back('\n');
         bool after_key = false;
-        for (; node_idx < node->child_nodes.size(); node_idx++) {
-          if (node->kind == Node::Kind::IMPROPER_LIST &&
-              &node->child_nodes.at(node_idx) == &node->child_nodes.back()) {
-            for (int i = 0; i < listing_indent; i++) {
-              str.push_back(' ');
-            }
+        for (; node_idx < node.child_count; node_idx++) {
+          if (node.kind == Node::Kind::IMPROPER_LIST && node_idx == node.child_count - 1) {
+            str.append(listing_indent, ' ');
             str.append(".\n");
           }
-          append_node_to_string(&node->child_nodes.at(node_idx), str,
-                                after_key ? 0 : listing_indent, listing_indent);
-          if (node->child_nodes.at(node_idx).kind == Node::Kind::ATOM &&
-              node->child_nodes.at(node_idx).atom_str.at(0) == ':' &&
-              node->child_nodes.at(node_idx).atom_str.find(' ') == std::string::npos) {
+          append_node(node.first_child + node_idx, after_key ? 0 : listing_indent, listing_indent);
+          const Node& elt = child(node, node_idx);
+          auto elt_str = atom_str(elt);
+          if (elt.kind == Node::Kind::ATOM && elt_str.at(0) == ':' &&
+              elt_str.find(' ') == std::string_view::npos) {
             str.push_back(' ');
             after_key = true;
           } else {
@@ -461,39 +472,36 @@ void append_node_to_string(const Node* node,
             after_key = false;
           }
         }
-        for (int i = 0; i < listing_indent; i++) {
-          str.push_back(' ');
-        }
+        str.append(listing_indent, ' ');
         str.push_back(')');
       } else {
         str.push_back('(');
-        ASSERT(!node->child_nodes.empty());
-        int listing_indent = next_indent_level + node->get_quote_length();
+        ASSERT(node.child_count);
+        int listing_indent = next_indent_level + node.quote_count;
         int extra_indent = 1;
         int c0 = 0;
-        for (auto& child : node->child_nodes) {
-          if (node->kind == Node::Kind::IMPROPER_LIST && &child == &node->child_nodes.back()) {
+        for (u32 i = 0; i < node.child_count; i++) {
+          if (node.kind == Node::Kind::IMPROPER_LIST && i == node.child_count - 1) {
             str.append(". ");
           }
-          size_t s0 = str.length();
-          append_node_to_string(&child, str, 0, listing_indent + extra_indent);
+          size_t s0 = out_pos();
+          append_node(node.first_child + i, 0, listing_indent + extra_indent);
           str.push_back(' ');
-          extra_indent += (str.length() - s0);
-          if (&child == &node->child_nodes.at(0) && !child.break_list) {
+          extra_indent += (out_pos() - s0);
+          const Node& elt = m_nodes[node.first_child + i];
+          if (i == 0 && !elt.break_list) {
             //
-            if (child.kind == Node::Kind::LIST) {
+            if (elt.kind == Node::Kind::LIST) {
               c0 = 0;
             } else {
-              c0 = str.length() - s0;
+              c0 = out_pos() - s0;
             }
           }
         }
         str.pop_back();
-        if (node->needs_end_paren_newline()) {
+        if (node.end_paren_newline) {
           str.push_back('\n');
-          for (int i = 0; i < listing_indent + c0 + 1; i++) {
-            str.push_back(' ');
-          }
+          str.append(listing_indent + c0 + 1, ' ');
         }
         str.push_back(')');
       }
@@ -503,39 +511,45 @@ void append_node_to_string(const Node* node,
   }
 }
 
-std::string node_to_string(const Node* node) {
-  std::string result;
-  append_node_to_string(node, result, 0, 0);
-  return result;
-}
+void Printer::print(const goos::Object& obj, int line_length, std::string& out) {
+  m_nodes.clear();
+  m_order.clear();
+  m_text.clear();
 
-}  // namespace v2
+  // construct the tree, ordered by depth
+  m_nodes.emplace_back();
+  add_node(0, obj, -1, 0);
 
-std::string to_string(const goos::Object& obj, int line_length) {
-  using namespace v2;
-
-  // construct the tree
-  Node root = to_node(obj);
-
-  // create tree links and order by depth
-  std::vector<Node*> bfs_order;
-  root.link(nullptr, &bfs_order, 0);
-
-  insert_required_breaks(bfs_order);
+  insert_required_breaks();
 
   // compute subtree lengths
-  recompute_lengths(bfs_order);
-
-  int max_depth = 0;
-  for (auto node : bfs_order) {
-    max_depth = std::max((int)node->my_depth, max_depth);
-  }
+  recompute_lengths();
 
   int num_broken = 1;
   while (num_broken) {
-    num_broken = run_algorithm(bfs_order, line_length);
+    num_broken = run_algorithm(line_length);
   }
 
-  return node_to_string(&root);
+  compute_end_paren_newlines();
+  // the text, plus a space or paren for each node. Doesn't include indentation.
+  out.reserve(out.size() + m_text.size() + 2 * m_nodes.size());
+  m_out = &out;
+  m_out_start = out.size();
+  append_node(0, 0, 0);
+  m_out = nullptr;
+}
+
+}  // namespace v2
+
+void append_to_string(const goos::Object& obj, std::string& out, int line_length) {
+  // reused between calls, so the arena is only allocated when it needs to grow.
+  thread_local v2::Printer printer;
+  printer.print(obj, line_length, out);
+}
+
+std::string to_string(const goos::Object& obj, int line_length) {
+  std::string result;
+  append_to_string(obj, result, line_length);
+  return result;
 }
 }  // namespace pretty_print
@@ -10,5 +10,7 @@
 namespace pretty_print {
 // main pretty print function
 std::string to_string(const goos::Object& obj, int line_length = 110);
+// same as to_string, but appends to an existing string.
+void append_to_string(const goos::Object& obj, std::string& out, int line_length = 110);
 
 }  // namespace pretty_print
@@ -11,6 +11,9 @@
 
 #include "Reader.h"
 
+#include <cerrno>
+#include <cstdlib>
+
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
 #include "common/util/FontUtils.h"
@@ -474,11 +477,11 @@ struct ListBuilder {
   void push_back(Object&& o) {
     size++;
     if (!tail) {
-      tail = std::make_shared<PairObject>(o, Object{});
+      tail = make_heap_object<PairObject>(o, Object{});
       head.type = ObjectType::PAIR;
       head.heap_obj = tail;
     } else {
-      auto next = std::make_shared<PairObject>(o, Object{});
+      auto next = make_heap_object<PairObject>(o, Object{});
       tail->cdr.type = ObjectType::PAIR;
       tail->cdr.heap_obj = next;
       prev_tail = std::move(tail);
@@ -736,16 +739,16 @@ bool Reader::try_token_as_float(const Token& tok, Object& obj) {
       }
     }
 
-    try {
-      std::size_t end = 0;
-      double v = std::stod(tok.text, &end);
-      if (end != tok.text.size())
-        return false;
-      obj = Object::make_float(v);
-      return true;
-    } catch (std::exception& e) {
+    // the same checks as std::stod, without the exceptions: the whole token must be used, and
+    // values that are out of range aren't floats.
+    char* end = nullptr;
+    errno = 0;
+    double v = std::strtod(tok.text.c_str(), &end);
+    if (end != tok.text.c_str() + tok.text.size() || errno == ERANGE) {
       return false;
     }
+    obj = Object::make_float(v);
+    return true;
   }
   return false;
 }
@@ -13,6 +13,8 @@
 
 #include "TextDB.h"
 
+#include <atomic>
+
 #include "common/util/FileUtil.h"
 
 #include "fmt/core.h"
@@ -91,6 +93,17 @@ FileText::FileText(const std::string& file_path, const std::string& description_
   build_offsets();
 }
 
+namespace {
+// ids are never reused, so pairs linked by a db that was cleared or destroyed don't match
+// a new one.
+u32 next_text_db_id() {
+  static std::atomic<u32> next_id = 1;
+  return next_id++;
+}
+}  // namespace
+
+TextDb::TextDb() : m_id(next_text_db_id()) {}
+
 /*!
  * Inform the TextDB about a source of text.
  */
@@ -98,37 +111,61 @@ void TextDb::insert(const std::shared_ptr<SourceText>& frag) {
   m_fragments.push_back(frag);
 }
 
+u32 TextDb::fragment_index(const std::shared_ptr<SourceText>& frag) {
+  // forms are linked in the order they're read, so this is almost always the last one.
+  if (m_last_frag_idx < m_fragments.size() && m_fragments[m_last_frag_idx] == frag) {
+    return m_last_frag_idx;
+  }
+  for (size_t i = m_fragments.size(); i-- > 0;) {
+    if (m_fragments[i] == frag) {
+      m_last_frag_idx = i;
+      return i;
+    }
+  }
+  m_fragments.push_back(frag);
+  m_last_frag_idx = m_fragments.size() - 1;
+  return m_last_frag_idx;
+}
+
+const TextDb::TextRef* TextDb::find(const PairObject* pair) const {
+  if (pair->text_db_id != m_id) {
+    return nullptr;
+  }
+  return &m_refs[pair->text_ref];
+}
+
+const TextDb::TextRef* TextDb::find(const Object& o) const {
+  if (!o.is_pair()) {
+    return nullptr;
+  }
+  return find(o.as_pair());
+}
+
 /*!
  * Link the GOOS object o to the offset into the given text fragment.
  * The object _must_ be a pair or empty list.
  */
-void TextDb::link(const Object& o, std::shared_ptr<SourceText> frag, int offset) {
+void TextDb::link(const Object& o, const std::shared_ptr<SourceText>& frag, int offset) {
   if (o.is_empty_list())
     return;
   ASSERT(o.is_pair());
-  TextRef ref;
-  ref.offset = offset;
-  ref.frag = std::move(frag);
-  m_map[o.heap_obj] = ref;
+  auto* pair = o.as_pair();
+  pair->text_db_id = m_id;
+  pair->text_ref = m_refs.size();
+  m_refs.push_back({fragment_index(frag), offset});
 }
 
 /*!
  * Given an object, get a string representing where it's from. Or "?" if we can't find it.
  */
 std::string TextDb::get_info_for(const Object& o, bool* terminate_compiler_error) const {
-  if (o.is_pair()) {
-    auto kv = m_map.find(o.heap_obj);
-    if (kv != m_map.end()) {
-      if (terminate_compiler_error) {
-        *terminate_compiler_error = kv->second.frag->terminate_compiler_error();
-      }
-      return get_info_for(kv->second.frag, kv->second.offset);
-    } else {
-      if (terminate_compiler_error) {
-        *terminate_compiler_error = false;
-      }
-      return "?\n";
+  auto* ref = find(o);
+  if (ref) {
+    const auto& frag = m_fragments[ref->frag_idx];
+    if (terminate_compiler_error) {
+      *terminate_compiler_error = frag->terminate_compiler_error();
     }
+    return get_info_for(frag, ref->offset);
   } else {
     if (terminate_compiler_error) {
       *terminate_compiler_error = false;
@@ -138,13 +175,9 @@ std::string TextDb::get_info_for(const Object& o, bool* terminate_compiler_error
 }
 
 std::optional<TextDb::ShortInfo> TextDb::get_short_info_for(const Object& o) const {
-  if (o.is_pair()) {
-    auto kv = m_map.find(o.heap_obj);
-    if (kv != m_map.end()) {
-      return get_short_info_for(kv->second.frag, kv->second.offset);
-    } else {
-      return {};
-    }
+  auto* ref = find(o);
+  if (ref) {
+    return get_short_info_for(m_fragments[ref->frag_idx], ref->offset);
   } else {
     return {};
   }
@@ -177,9 +210,10 @@ std::optional<TextDb::ShortInfo> TextDb::get_short_info_for(const std::shared_pt
 
 std::optional<TextDb::ShortInfo> TextDb::try_get_short_info(
     const std::shared_ptr<goos::HeapObject>& heap_obj) const {
-  auto it = m_map.find(heap_obj);
-  if (it != m_map.end()) {
-    auto& frag = it->second.frag;
+  auto* pair = dynamic_cast<const PairObject*>(heap_obj.get());
+  auto* ref = pair ? find(pair) : nullptr;
+  if (ref) {
+    auto& frag = m_fragments[ref->frag_idx];
     // shorten the string
     std::string name = frag->get_description();
     size_t start = 0;
@@ -195,7 +229,7 @@ std::optional<TextDb::ShortInfo> TextDb::try_get_short_info(
     ShortInfo result;
     result.filename = name;
 
-    int line_idx = frag->get_line_idx(it->second.offset);
+    int line_idx = frag->get_line_idx(ref->offset);
     result.line_idx_to_display = line_idx + 1;
 
     int offset_of_line = frag->get_offset_of_line(line_idx);
@@ -203,7 +237,7 @@ std::optional<TextDb::ShortInfo> TextDb::try_get_short_info(
 
     int line_length = offset_of_next_line - offset_of_line;
 
-    int start_offset_in_line = it->second.offset - offset_of_line - 1;
+    int start_offset_in_line = ref->offset - offset_of_line - 1;
     result.pos_in_line = std::max(start_offset_in_line, 0);
     result.line_text = std::string(frag->get_text() + offset_of_line + 1, line_length - 1);
     return result;
@@ -220,7 +254,7 @@ std::optional<TextDb::ShortInfo> TextDb::try_get_short_info(const Object& o) con
 }
 
 bool TextDb::has_info(const Object& o) const {
-  return o.is_pair() && (m_map.find(o.heap_obj) != m_map.end());
+  return find(o) != nullptr;
 }
 
 /*!
@@ -231,20 +265,22 @@ bool TextDb::has_info(const Object& o) const {
  */
 void TextDb::inherit_info(const Object& parent, const Object& child) {
   if (parent.is_pair() && child.is_pair()) {
-    auto parent_kv = m_map.find(parent.heap_obj);
-    if (parent_kv != m_map.end()) {
-      std::vector<const Object*> children = {&child};
+    auto* parent_pair = parent.as_pair();
+    if (find(parent_pair)) {
+      std::vector<PairObject*> children = {child.as_pair()};
       // mark all forms as children. This will help with error messages in macros, and makes
       // (add-macro-to-autocomplete) work properly.
       while (!children.empty()) {
         auto top = children.back();
         children.pop_back();
-        if (m_map.insert({top->heap_obj, parent_kv->second}).second) {
-          if (top->as_pair()->car.is_pair()) {
-            children.push_back(&top->as_pair()->car);
+        if (!find(top)) {
+          top->text_db_id = m_id;
+          top->text_ref = parent_pair->text_ref;
+          if (top->car.is_pair()) {
+            children.push_back(top->car.as_pair());
           }
-          if (top->as_pair()->cdr.is_pair()) {
-            children.push_back(&top->as_pair()->cdr);
+          if (top->cdr.is_pair()) {
+            children.push_back(top->cdr.as_pair());
           }
         }
       }
@@ -253,7 +289,10 @@ void TextDb::inherit_info(const Object& parent, const Object& child) {
 }
 
 void TextDb::clear_info() {
-  m_map.clear();
+  // forms linked so far keep the old id, so they no longer match.
+  m_id = next_text_db_id();
+  m_refs.clear();
   m_fragments.clear();
+  m_last_frag_idx = 0;
 }
 }  // namespace goos
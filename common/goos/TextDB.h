@@ -90,11 +90,11 @@ class FileText : public SourceText {
   std::string m_desc_name;
 };
 
-struct TextRef {
-  int offset;
-  std::shared_ptr<SourceText> frag;
-};
-
+/*!
+ * Source locations of forms. Instead of a side table keyed on the object, each PairObject stores
+ * the id of the TextDb that linked it and an index into that db's list of locations, so looking up
+ * a form is just an array access, and the db doesn't keep forms alive.
+ */
 class TextDb {
  public:
   struct ShortInfo {
@@ -104,8 +104,9 @@ class TextDb {
     std::string line_text;
   };
 
+  TextDb();
   void insert(const std::shared_ptr<SourceText>& frag);
-  void link(const Object& o, std::shared_ptr<SourceText> frag, int offset);
+  void link(const Object& o, const std::shared_ptr<SourceText>& frag, int offset);
   std::string get_info_for(const Object& o, bool* terminate_compiler_error = nullptr) const;
   std::optional<ShortInfo> get_short_info_for(const Object& o) const;
   std::string get_info_for(const std::shared_ptr<SourceText>& frag, int offset) const;
@@ -119,7 +120,18 @@ class TextDb {
   void clear_info();
 
  private:
+  struct TextRef {
+    u32 frag_idx;
+    int offset;
+  };
+
+  const TextRef* find(const PairObject* pair) const;
+  const TextRef* find(const Object& o) const;
+  u32 fragment_index(const std::shared_ptr<SourceText>& frag);
+
   std::vector<std::shared_ptr<SourceText>> m_fragments;
-  std::unordered_map<std::shared_ptr<goos::HeapObject>, TextRef> m_map;
+  std::vector<TextRef> m_refs;
+  u32 m_id = 0;
+  u32 m_last_frag_idx = 0;
 };
 }  // namespace goos
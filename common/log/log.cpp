@@ -1,9 +1,18 @@
 #include "log.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <memory>
 #include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include "fmt/color.h"
 #ifdef _WIN32  // see lg::initialize
@@ -11,11 +20,193 @@
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
 #endif
+#include "common/common_types.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
 #include "common/util/string_util.h"
 
 namespace lg {
+class AsyncWriter;
+
+namespace {
+
+/*!
+ * Formatted log messages from one thread, for the async writer. There is one producer, the thread,
+ * and one consumer, the writer, so it's lock free: the producer only moves m_head and the consumer
+ * only moves m_tail. Messages are packed back to back and may wrap around.
+ */
+class MessageQueue {
+ public:
+  static constexpr u64 kSize = 256 * 1024;  // must be a power of 2
+
+  struct Header {
+    u64 seq;  // the order messages were logged in, across all threads
+    u32 file_len;
+    u32 stdout_len;
+    bool flush;
+  };
+
+  struct Message {
+    u64 seq;
+    bool flush;
+    std::string file_text;
+    std::string stdout_text;
+  };
+
+  static u64 size_of(std::string_view file_text, std::string_view stdout_text) {
+    return sizeof(Header) + file_text.size() + stdout_text.size();
+  }
+
+  // returns false if there isn't space, without adding anything.
+  bool push(const Header& header, std::string_view file_text, std::string_view stdout_text) {
+    const u64 head = m_head.load(std::memory_order_relaxed);
+    const u64 tail = m_tail.load(std::memory_order_acquire);
+    if (kSize - (head - tail) < size_of(file_text, stdout_text)) {
+      return false;
+    }
+    u64 pos = head;
+    copy_in(&pos, &header, sizeof(Header));
+    copy_in(&pos, file_text.data(), file_text.size());
+    copy_in(&pos, stdout_text.data(), stdout_text.size());
+    m_head.store(pos, std::memory_order_release);
+    return true;
+  }
+
+  // move every message to out.
+  void pop_all(std::vector<Message>* out) {
+    const u64 head = m_head.load(std::memory_order_acquire);
+    u64 pos = m_tail.load(std::memory_order_relaxed);
+    while (pos < head) {
+      Header header;
+      copy_out(&pos, &header, sizeof(Header));
+      auto& msg = out->emplace_back();
+      msg.seq = header.seq;
+      msg.flush = header.flush;
+      msg.file_text.resize(header.file_len);
+      copy_out(&pos, msg.file_text.data(), header.file_len);
+      msg.stdout_text.resize(header.stdout_len);
+      copy_out(&pos, msg.stdout_text.data(), header.stdout_len);
+    }
+    m_tail.store(pos, std::memory_order_release);
+  }
+
+  bool empty() const {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+  // set when the thread exits, the writer removes the queue once it's empty.
+  std::atomic_bool abandoned = false;
+
+  // while the thread is adding a message, a lower bound on its seq. See AsyncWriter::write_pass.
+  static constexpr u64 kNotAdding = UINT64_MAX;
+  std::atomic<u64> adding_seq = kNotAdding;
+
+ private:
+  void copy_in(u64* pos, const void* src, size_t size) {
+    const u64 offset = *pos & (kSize - 1);
+    const u64 first = std::min<u64>(size, kSize - offset);
+    memcpy(m_data.get() + offset, src, first);
+    memcpy(m_data.get(), (const u8*)src + first, size - first);
+    *pos += size;
+  }
+
+  void copy_out(u64* pos, void* dst, size_t size) const {
+    const u64 offset = *pos & (kSize - 1);
+    const u64 first = std::min<u64>(size, kSize - offset);
+    memcpy(dst, m_data.get() + offset, first);
+    memcpy((u8*)dst + first, m_data.get(), size - first);
+    *pos += size;
+  }
+
+  std::unique_ptr<u8[]> m_data = std::make_unique<u8[]>(kSize);
+  std::atomic<u64> m_head = 0;
+  std::atomic<u64> m_tail = 0;
+};
+
+/*!
+ * The calling thread's queue. The writer can still be draining it after the thread exits, so it's
+ * shared.
+ */
+struct ThreadQueue {
+  std::shared_ptr<MessageQueue> queue;
+  const AsyncWriter* writer = nullptr;  // the writer the queue was added to
+  ~ThreadQueue();
+};
+thread_local ThreadQueue t_queue;
+// set once t_queue is destroyed, messages logged after that are written directly.
+thread_local bool t_queue_destroyed = false;
+
+ThreadQueue::~ThreadQueue() {
+  if (queue) {
+    queue->abandoned = true;
+  }
+  t_queue_destroyed = true;
+}
+}  // namespace
+
+/*!
+ * Writes the queued messages from a background thread. Each pass takes the messages from every
+ * queue, sorts them back into the order they were logged in, and writes them with one fwrite per
+ * output. The outputs are only flushed at the end of a pass.
+ *
+ * Writers are never freed, because a thread may still be pushing to one after it's stopped.
+ */
+class AsyncWriter {
+ public:
+  explicit AsyncWriter(queue_full policy) : m_policy(policy) {
+    m_thread = std::thread(&AsyncWriter::run, this);
+  }
+
+  /*!
+   * Queue a message. If the queue is full, this waits for space or drops it, depending on the
+   * policy. Returns false if it has to be written directly instead, because the writer is stopped.
+   */
+  bool push(level log_level, std::string_view file_text, std::string_view stdout_text, bool flush);
+
+  // wait until everything that was queued before this call is written and flushed.
+  void flush();
+
+  void stop();
+
+ private:
+  void run();
+  void wake() {
+    if (!m_wake.exchange(true)) {
+      m_wake_cv.notify_one();
+    }
+  }
+  MessageQueue& thread_queue();
+  bool write_pass();
+
+  queue_full m_policy;
+  std::thread m_thread;
+  std::atomic_bool m_stop = false;
+
+  std::atomic<u64> m_next_seq = 0;
+  std::atomic<u64> m_dropped = 0;
+
+  // only locked by a thread when it logs for the first time, and by the writer.
+  std::mutex m_queues_mutex;
+  std::vector<std::shared_ptr<MessageQueue>> m_queues;
+
+  // producers wake the writer without locking. A wakeup that races the writer going to sleep is
+  // only late by the timeout.
+  std::atomic_bool m_wake = false;
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake_cv;
+
+  // guards everything below, and is held while writing. Every message with a seq below
+  // m_flushed_seq has been written and flushed.
+  std::mutex m_flush_mutex;
+  std::condition_variable m_flush_cv;
+  int m_flush_waiters = 0;
+  u64 m_flushed_seq = 0;
+  bool m_stopped = false;
+
+  std::vector<MessageQueue::Message> m_batch;
+  std::string m_file_buffer, m_stdout_buffer;
+};
+
 struct Logger {
   Logger() = default;
 
@@ -27,8 +218,15 @@ struct Logger {
   std::mutex mutex;
   bool disable_colors = false;
 
+  // null unless start_async was called.
+  std::atomic<AsyncWriter*> async = nullptr;
+
   ~Logger() {
-    // will run when program exits.
+    // will run when program exits. Other threads may still be logging, so the writer is stopped,
+    // but not freed.
+    if (auto* writer = async.exchange(nullptr)) {
+      writer->stop();
+    }
     if (fp) {
       fclose(fp);
     }
@@ -37,12 +235,204 @@ struct Logger {
 
 Logger gLogger;
 
+MessageQueue& AsyncWriter::thread_queue() {
+  if (t_queue.writer != this) {
+    // first message from this thread, or the last writer was stopped and a new one started.
+    if (t_queue.queue) {
+      t_queue.queue->abandoned = true;
+    }
+    t_queue.queue = std::make_shared<MessageQueue>();
+    t_queue.writer = this;
+    std::lock_guard<std::mutex> lk(m_queues_mutex);
+    m_queues.push_back(t_queue.queue);
+  }
+  return *t_queue.queue;
+}
+
+bool AsyncWriter::push(level log_level,
+                       std::string_view file_text,
+                       std::string_view stdout_text,
+                       bool flush) {
+  if (t_queue_destroyed || MessageQueue::size_of(file_text, stdout_text) > MessageQueue::kSize) {
+    return false;
+  }
+  auto& queue = thread_queue();
+  // the writer holds back everything logged after this until it's queued. This has to be set
+  // before checking m_stop too, so the writer doesn't exit while we're adding it.
+  queue.adding_seq = m_next_seq.load();
+  if (m_stop) {
+    queue.adding_seq = MessageQueue::kNotAdding;
+    return false;
+  }
+  MessageQueue::Header header;
+  header.seq = m_next_seq.fetch_add(1);
+  header.file_len = file_text.size();
+  header.stdout_len = stdout_text.size();
+  header.flush = flush;
+  while (!queue.push(header, file_text, stdout_text)) {
+    if (m_policy == queue_full::drop && log_level < level::warn) {
+      m_dropped++;
+      break;
+    }
+    wake();
+    std::this_thread::yield();
+  }
+  queue.adding_seq = MessageQueue::kNotAdding;
+  wake();
+  return true;
+}
+
+void AsyncWriter::flush() {
+  std::unique_lock<std::mutex> lk(m_flush_mutex);
+  // everything logged before this call has a lower seq.
+  const u64 target = m_next_seq.load();
+  m_flush_waiters++;
+  wake();
+  m_flush_cv.wait(lk, [&] { return m_flushed_seq >= target || m_stopped; });
+  m_flush_waiters--;
+}
+
+void AsyncWriter::stop() {
+  if (!m_thread.joinable()) {
+    return;
+  }
+  m_stop = true;
+  wake();
+  m_thread.join();
+  std::lock_guard<std::mutex> lk(m_flush_mutex);
+  m_stopped = true;
+  m_flush_cv.notify_all();
+}
+
+void AsyncWriter::run() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lk(m_wake_mutex);
+      m_wake_cv.wait_for(lk, std::chrono::milliseconds(20), [&] { return m_wake.load(); });
+    }
+    m_wake = false;
+    const bool stopping = m_stop;
+    const bool busy = write_pass();
+    // once stopped, nothing new is queued, so keep going until everything is written.
+    if (stopping && !busy) {
+      break;
+    }
+  }
+}
+
+/*!
+ * Write everything in the queues that can be written yet. Returns false if there was nothing to
+ * write and no thread was adding a message.
+ */
+bool AsyncWriter::write_pass() {
+  // A message can't be written until everything logged before it is queued, or it would be out of
+  // order. Threads set adding_seq before taking a seq, so once the writer has seen m_next_seq and
+  // every adding_seq, anything that isn't queued yet has a seq of at least the lowest of them.
+  u64 limit = m_next_seq.load();
+  bool adding = false;
+  {
+    std::lock_guard<std::mutex> lk(m_queues_mutex);
+    for (auto& queue : m_queues) {
+      const u64 seq = queue->adding_seq;
+      if (seq != MessageQueue::kNotAdding) {
+        adding = true;
+        limit = std::min(limit, seq);
+      }
+    }
+    for (auto it = m_queues.begin(); it != m_queues.end();) {
+      // check before draining, the thread can't add more once it's abandoned.
+      const bool abandoned = (*it)->abandoned;
+      (*it)->pop_all(&m_batch);
+      if (abandoned) {
+        it = m_queues.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  std::sort(m_batch.begin(), m_batch.end(),
+            [](const auto& a, const auto& b) { return a.seq < b.seq; });
+  // the rest waits for a later pass.
+  const auto ready_end = std::lower_bound(m_batch.begin(), m_batch.end(), limit,
+                                          [](const auto& msg, u64 seq) { return msg.seq < seq; });
+
+  bool flush = false;
+  m_file_buffer.clear();
+  m_stdout_buffer.clear();
+  const u64 dropped = m_dropped.exchange(0);
+  if (dropped) {
+    const auto note = fmt::format("[{} log messages were dropped, the log queue was full]\n",
+                                  dropped);
+    m_file_buffer += note;
+    m_stdout_buffer += note;
+  }
+  for (auto it = m_batch.begin(); it != ready_end; ++it) {
+    m_file_buffer += it->file_text;
+    m_stdout_buffer += it->stdout_text;
+    flush |= it->flush;
+  }
+  const bool wrote = ready_end != m_batch.begin() || dropped;
+  m_batch.erase(m_batch.begin(), ready_end);
+
+  {
+    std::lock_guard<std::mutex> flush_lock(m_flush_mutex);
+    flush |= m_flush_waiters > 0;
+    if (wrote || flush) {
+      std::lock_guard<std::mutex> lock(gLogger.mutex);
+      if (gLogger.fp && !m_file_buffer.empty()) {
+        fwrite(m_file_buffer.data(), m_file_buffer.size(), 1, gLogger.fp);
+      }
+      if (!m_stdout_buffer.empty()) {
+        fwrite(m_stdout_buffer.data(), m_stdout_buffer.size(), 1, stdout);
+      }
+      if (flush) {
+        if (gLogger.fp) {
+          fflush(gLogger.fp);
+        }
+        fflush(stdout);
+        fflush(stderr);
+        m_flushed_seq = std::max(m_flushed_seq, limit);
+      }
+    }
+  }
+  m_flush_cv.notify_all();
+  return wrote || adding || !m_batch.empty();
+}
+
 namespace internal {
 const char* log_level_names[] = {"trace", "debug", "info", "warn", "error", "die", "die"};
 const fmt::color log_colors[] = {
     fmt::color::gray, fmt::color::turquoise, fmt::color::light_green, fmt::color::yellow,
     fmt::color::red,  fmt::color::hot_pink,  fmt::color::hot_pink};
 
+/*!
+ * Write a formatted message to the file and stdout, from the async writer if there is one. Either
+ * text may be empty.
+ */
+void write_message(level log_level,
+                   const std::string& file_text,
+                   const std::string& stdout_text,
+                   bool flush) {
+  auto* async = gLogger.async.load();
+  if (async && async->push(log_level, file_text, stdout_text, flush)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(gLogger.mutex);
+  if (gLogger.fp && !file_text.empty()) {
+    fwrite(file_text.data(), file_text.size(), 1, gLogger.fp);
+    if (flush) {
+      fflush(gLogger.fp);
+    }
+  }
+  if (!stdout_text.empty()) {
+    fwrite(stdout_text.data(), stdout_text.size(), 1, stdout);
+    if (flush) {
+      fflush(stdout);
+      fflush(stderr);
+    }
+  }
+}
+
 void log_message(level log_level, LogTime& now, const char* message) {
 #ifdef __linux__
   char date_time_buffer[128];
@@ -56,83 +446,60 @@ void log_message(level log_level, LogTime& now, const char* message) {
   std::string time_string = fmt::format("[{}]", date_time_buffer);
 #endif
 
-  {
-    std::lock_guard<std::mutex> lock(gLogger.mutex);
-    if (gLogger.fp && log_level >= gLogger.file_log_level) {
-      // log to file
-      std::string file_string =
+  std::string file_string;
+  if (gLogger.fp && log_level >= gLogger.file_log_level) {
+    file_string =
+        fmt::format("{} [{}] {}\n", time_string, log_level_names[int(log_level)], message);
+  }
+
+  std::string stdout_string;
+  if (log_level >= gLogger.stdout_log_level ||
+      (log_level == level::die && gLogger.stdout_log_level == level::off_unless_die)) {
+    if (gLogger.disable_colors) {
+      stdout_string =
           fmt::format("{} [{}] {}\n", time_string, log_level_names[int(log_level)], message);
-      fwrite(file_string.c_str(), file_string.length(), 1, gLogger.fp);
-      if (log_level >= gLogger.flush_level) {
-        fflush(gLogger.fp);
-      }
+    } else {
+      stdout_string = fmt::format("{} [{}] {}\n", time_string,
+                                  fmt::format(fg(log_colors[int(log_level)]), "{}",
+                                              log_level_names[int(log_level)]),
+                                  message);
     }
+  }
 
-    if (log_level >= gLogger.stdout_log_level ||
-        (log_level == level::die && gLogger.stdout_log_level == level::off_unless_die)) {
-      fmt::print("{} [", time_string);
-      if (gLogger.disable_colors) {
-        fmt::print("{}", log_level_names[int(log_level)]);
-      } else {
-        fmt::print(fg(log_colors[int(log_level)]), "{}", log_level_names[int(log_level)]);
-      }
-      fmt::print("] {}\n", message);
-      if (log_level >= gLogger.flush_level) {
-        fflush(stdout);
-        fflush(stderr);
-      }
-    }
+  if (log_level == level::die) {
+    // get everything before this out before we abort.
+    flush();
+  }
+
+  if (!file_string.empty() || !stdout_string.empty()) {
+    write_message(log_level, file_string, stdout_string, log_level >= gLogger.flush_level);
   }
 
   if (log_level == level::die) {
-    fflush(stdout);
-    fflush(stderr);
-    if (gLogger.fp) {
-      fflush(gLogger.fp);
-    }
+    flush();
     abort();
   }
 }
 
 void log_print(const char* message) {
-  {
-    // We always immediately flush prints because since it has no associated level
-    // it could be anything from a fatal error to a useless debug log.
-    std::lock_guard<std::mutex> lock(gLogger.mutex);
-    if (gLogger.fp) {
-      // Log to File
-      std::string msg(message);
-      fwrite(msg.c_str(), msg.length(), 1, gLogger.fp);
-      fflush(gLogger.fp);
-    }
-
-    if (gLogger.stdout_log_level < lg::level::off_unless_die) {
-      fmt::print("{}", message);
-      fflush(stdout);
-      fflush(stderr);
-    }
-  }
+  // We always flush prints because since it has no associated level it could be anything from a
+  // fatal error to a useless debug log. With the async writer, that's at the end of its pass.
+  std::string msg(message);
+  write_message(level::info, msg,
+                gLogger.stdout_log_level < lg::level::off_unless_die ? msg : std::string(), true);
 }
 
 void log_vprintf(const char* format, va_list arg_list) {
-  {
-    // We always immediately flush prints because since it has no associated level
-    // it could be anything from a fatal error to a useless debug log.
-    std::lock_guard<std::mutex> lock(gLogger.mutex);
-    va_list arg_list_2;
-    va_copy(arg_list_2, arg_list);
-    if (gLogger.fp) {
-      // Log to File
-      vfprintf(gLogger.fp, format, arg_list);
-      fflush(gLogger.fp);
-    }
-
-    if (gLogger.stdout_log_level < lg::level::off_unless_die) {
-      vprintf(format, arg_list_2);
-      fflush(stdout);
-      fflush(stderr);
-    }
+  va_list arg_list_2;
+  va_copy(arg_list_2, arg_list);
+  const int size = vsnprintf(nullptr, 0, format, arg_list);
+  std::string msg;
+  if (size > 0) {
+    msg.resize(size);
+    vsnprintf(msg.data(), size + 1, format, arg_list_2);
   }
+  va_end(arg_list_2);
+  log_print(msg.c_str());
 }
 }  // namespace internal
 
@@ -252,7 +619,42 @@ void initialize() {
   gLogger.initialized = true;
 }
 
+void start_async(queue_full policy) {
+  ASSERT(!gLogger.async);
+  // never freed, see AsyncWriter.
+  gLogger.async = new AsyncWriter(policy);
+
+  // write what's queued if we die from an uncaught exception.
+  static std::once_flag handler_once;
+  std::call_once(handler_once, [] {
+    static std::terminate_handler previous_handler = nullptr;
+    previous_handler = std::set_terminate([] {
+      flush();
+      if (previous_handler) {
+        previous_handler();
+      }
+      abort();
+    });
+  });
+}
+
+void flush() {
+  if (auto* async = gLogger.async.load()) {
+    async->flush();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(gLogger.mutex);
+  if (gLogger.fp) {
+    fflush(gLogger.fp);
+  }
+  fflush(stdout);
+  fflush(stderr);
+}
+
 void finish() {
+  if (auto* async = gLogger.async.exchange(nullptr)) {
+    async->stop();
+  }
   {
     std::lock_guard<std::mutex> lock(gLogger.mutex);
     if (gLogger.fp) {
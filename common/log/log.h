@@ -53,6 +53,22 @@ void disable_ansi_colors();
 void initialize();
 void finish();
 
+// what a thread does when its async log queue is full, because the writer can't keep up.
+enum class queue_full {
+  drop,  // drop trace, debug and info messages and prints, and log how many were dropped.
+         // Warnings and errors wait.
+  block  // wait for space
+};
+
+/*!
+ * Write the log from a background thread. Each thread formats its messages and adds them to its
+ * own lock-free queue, and the writer writes them in batches, so logging threads don't wait on the
+ * file or the console. die and uncaught exceptions flush the queues first. finish() stops it.
+ */
+void start_async(queue_full policy = queue_full::block);
+// wait until everything logged so far is written and flushed.
+void flush();
+
 template <typename... Args>
 void log(level log_level, const std::string& format, Args&&... args) {
   LogTime now;
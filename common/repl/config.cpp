@@ -14,6 +14,8 @@ void to_json(json& j, const Config& obj) {
       {"keybinds", obj.keybinds},
       {"perGameHistory", obj.per_game_history},
       {"permissiveRedefinitions", obj.permissive_redefinitions},
+      {"makeJobs", obj.make_jobs},
+      {"buildCacheDir", obj.build_cache_dir},
   };
 }
 
@@ -64,6 +66,12 @@ void from_json(const json& j, Config& obj) {
   if (j.contains("permissiveRedefinitions")) {
     j.at("permissiveRedefinitions").get_to(obj.permissive_redefinitions);
   }
+  if (j.contains("makeJobs")) {
+    j.at("makeJobs").get_to(obj.make_jobs);
+  }
+  if (j.contains("buildCacheDir")) {
+    j.at("buildCacheDir").get_to(obj.build_cache_dir);
+  }
   // if there is game specific configuration, override any values we just set
   if (j.contains(version_to_game_name(obj.game_version))) {
     from_json(j.at(version_to_game_name(obj.game_version)), obj);
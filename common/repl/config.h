@@ -50,6 +50,10 @@ struct Config {
   bool per_game_history = true;
   bool permissive_redefinitions = false;
   std::string iso_path;
+  // number of make steps to run at once, 0 will use all available cores.
+  int make_jobs = 0;
+  // if set, outputs of make steps are cached here by the hash of their inputs.
+  std::string build_cache_dir;
 
   int get_nrepl_port() {
     if (temp_nrepl_port != -1) {
@@ -34,3 +34,58 @@ void ReplClient::eval(std::string form) {
     disconnect();
   }
 }
+
+bool ReplClient::read_all(char* dst, size_t size) {
+  size_t got = 0;
+  while (got < size) {
+    auto bytes_read = read_from_socket(client_socket, dst + got, size - got);
+    if (bytes_read <= 0) {
+      disconnect();
+      return false;
+    }
+    got += bytes_read;
+  }
+  return true;
+}
+
+std::optional<std::string> ReplClient::request(ReplServerMessageType type,
+                                               const std::string& body) {
+  if (!is_connected()) {
+    return {};
+  }
+  // the server says hello when we connect, skip past that first.
+  if (!m_got_greeting) {
+    std::string greeting = ReplServer::greeting();
+    if (!read_all(greeting.data(), greeting.size())) {
+      return {};
+    }
+    m_got_greeting = true;
+  }
+
+  ReplServerHeader header = {(u32)body.size(), (u32)type};
+  std::vector<char> buffer((char*)&header, (char*)&header + sizeof(header));
+  buffer.insert(buffer.end(), body.begin(), body.end());
+  size_t sent = 0;
+  while (sent < buffer.size()) {
+    int result = write_to_socket(client_socket, buffer.data() + sent, buffer.size() - sent);
+    if (result <= 0) {
+      disconnect();
+      return {};
+    }
+    sent += result;
+  }
+
+  if (!read_all((char*)&header, sizeof(header))) {
+    return {};
+  }
+  if (header.type != (u32)type) {
+    // not an answer, the server may have rejected us.
+    disconnect();
+    return {};
+  }
+  std::string response(header.length, '\0');
+  if (!read_all(response.data(), response.size())) {
+    return {};
+  }
+  return response;
+}
@@ -13,4 +13,14 @@ class ReplClient : public XSocketClient {
 
   // TODO - just void for now :(
   void eval(std::string form);
+
+  /*!
+   * Send a request that the server answers (EVAL_WITH_RESULT or FORMAT) and wait for the answer.
+   * Returns nothing if the connection failed.
+   */
+  std::optional<std::string> request(ReplServerMessageType type, const std::string& body);
+
+ private:
+  bool read_all(char* dst, size_t size);
+  bool m_got_greeting = false;
 };
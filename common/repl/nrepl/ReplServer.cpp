@@ -16,7 +16,11 @@
 #include "common/log/log.h"
 // clang-format on
 
-// TODO - The server also needs to eventually return the result of the evaluation
+ReplServer::ReplServer(std::function<bool()> shutdown_callback, int _tcp_port)
+    : XSocketServer(std::move(shutdown_callback), _tcp_port) {
+  // many tools may connect at once
+  listen_backlog = max_clients;
+}
 
 ReplServer::~ReplServer() {
   // Close all our client sockets!
@@ -41,9 +45,13 @@ void ReplServer::error_response(int socket, const std::string& error) {
   }
 }
 
+std::string ReplServer::greeting() {
+  return fmt::format("Connected to OpenGOAL v{}.{} nREPL!", versions::GOAL_VERSION_MAJOR,
+                     versions::GOAL_VERSION_MINOR);
+}
+
 void ReplServer::ping_response(int socket) {
-  std::string ping = fmt::format("Connected to OpenGOAL v{}.{} nREPL!",
-                                 versions::GOAL_VERSION_MAJOR, versions::GOAL_VERSION_MINOR);
+  std::string ping = greeting();
   auto resp = write_to_socket(socket, ping.c_str(), ping.size());
   if (resp == -1) {
     lg::warn("[nREPL:{}] Client Disconnected: {}", tcp_port, address_to_string(addr),
@@ -53,7 +61,29 @@ void ReplServer::ping_response(int socket) {
   }
 }
 
-std::optional<std::string> ReplServer::get_msg() {
+void ReplServer::respond(const ReplRequest& request, const std::string& body) {
+  if (client_sockets.count(request.socket) == 0) {
+    return;
+  }
+  ReplServerHeader header = {(u32)body.size(), (u32)request.type};
+  std::vector<char> msg((char*)&header, (char*)&header + sizeof(header));
+  msg.insert(msg.end(), body.begin(), body.end());
+  // the result may be bigger than one send
+  size_t sent = 0;
+  while (sent < msg.size()) {
+    auto resp = write_to_socket(request.socket, msg.data() + sent, msg.size() - sent);
+    if (resp <= 0) {
+      lg::warn("[nREPL:{}] Client Disconnected before its result was sent: {}", tcp_port,
+               request.socket);
+      close_socket(request.socket);
+      client_sockets.erase(request.socket);
+      return;
+    }
+    sent += resp;
+  }
+}
+
+std::optional<ReplRequest> ReplServer::get_request() {
   // Clear the sockets we are listening on
   FD_ZERO(&read_sockets);
 
@@ -173,9 +203,12 @@ std::optional<std::string> ReplServer::get_msg() {
             ping_response(sock);
             return std::nullopt;
           case ReplServerMessageType::EVAL:
+          case ReplServerMessageType::EVAL_WITH_RESULT:
+          case ReplServerMessageType::FORMAT: {
             std::string msg(buffer.data(), header->length);
             lg::debug("[nREPL:{}] Received Message: {}", tcp_port, msg);
-            return std::make_optional(msg);
+            return ReplRequest{sock, (ReplServerMessageType)header->type, msg};
+          }
         }
       }
     }
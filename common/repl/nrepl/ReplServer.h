@@ -5,21 +5,41 @@
 
 #include "common/cross_sockets/XSocketServer.h"
 
-enum ReplServerMessageType { PING = 0, EVAL = 10, SHUTDOWN = 20 };
+// EVAL_WITH_RESULT and FORMAT are answered with a message of the same type, holding a JSON object.
+// It's {"ok": bool, "error": string} for EVAL_WITH_RESULT and {"ok": bool, "result": string} for
+// FORMAT.
+enum ReplServerMessageType {
+  PING = 0,
+  EVAL = 10,
+  EVAL_WITH_RESULT = 11,
+  SHUTDOWN = 20,
+  FORMAT = 30
+};
 
 struct ReplServerHeader {
   u32 length;
   u32 type;
 };
 
+struct ReplRequest {
+  int socket;
+  ReplServerMessageType type;
+  std::string body;
+};
+
 class ReplServer : public XSocketServer {
  public:
-  using XSocketServer::XSocketServer;
+  ReplServer(std::function<bool()> shutdown_callback, int _tcp_port);
   virtual ~ReplServer();
 
   void post_init() override;
 
-  std::optional<std::string> get_msg();
+  // sent to every client when it connects, without a header.
+  static std::string greeting();
+
+  std::optional<ReplRequest> get_request();
+  // answer a request that wants a result. Does nothing if the client has disconnected.
+  void respond(const ReplRequest& request, const std::string& body);
 
  private:
   int max_clients = 50;
@@ -168,6 +168,9 @@ void Wrapper::print_help_message() {
   fmt::print(" - Compile an OpenGOAL source file\n");
   fmt::print(fmt::emphasis::bold | fg(fmt::color::lime_green), "(ml \"filename\")\n");
   fmt::print(" - Compile and Load (or reload) an OpenGOAL source file\n");
+  fmt::print(fmt::emphasis::bold | fg(fmt::color::lime_green),
+             "(hot-patch \"filename\" name [:type type-name])\n");
+  fmt::print(" - Reload one function or method from a file, without reloading the whole file\n");
   fmt::print(fmt::emphasis::bold | fg(fmt::color::lime_green), "(build-kernel)\n");
   fmt::print(" - Build the GOAL kernel\n");
   fmt::print(fmt::emphasis::bold | fg(fmt::color::lime_green), "(make \"file-name\")\n");
@@ -11,7 +11,7 @@ void open_subtitle_project(const std::string& project_kind,
                            const std::string& file_path,
                            std::vector<GameSubtitleDefinitionFile>& subtitle_files) {
   goos::Reader reader;
-  auto& proj = reader.read_from_file({file_path}).as_pair()->cdr.as_pair()->car;
+  auto proj = reader.read_from_file({file_path}).as_pair()->cdr.as_pair()->car;
   if (!proj.is_pair() || !proj.as_pair()->car.is_symbol() ||
       proj.as_pair()->car.as_symbol() != project_kind) {
     throw std::runtime_error(fmt::format("invalid project '{}'", project_kind));
@@ -201,6 +201,19 @@ GameSubtitlePackage read_json_files_v2(const GameSubtitleDefinitionFile& file_in
 }
 
 void GameSubtitleDB::init_banks_from_file(const GameSubtitleDefinitionFile& file_info) {
+  init_banks_from_package(file_info, read_package(file_info));
+}
+
+GameSubtitlePackage GameSubtitleDB::read_package(
+    const GameSubtitleDefinitionFile& file_info) const {
+  if (m_subtitle_version == SubtitleFormat::V1) {
+    return read_json_files_v1(file_info);
+  }
+  return read_json_files_v2(file_info);
+}
+
+void GameSubtitleDB::init_banks_from_package(const GameSubtitleDefinitionFile& file_info,
+                                             const GameSubtitlePackage& package) {
   // Init Settings
   std::shared_ptr<GameSubtitleBank> bank;
   if (!bank_exists(file_info.language_id)) {
@@ -212,20 +225,11 @@ void GameSubtitleDB::init_banks_from_file(const GameSubtitleDefinitionFile& file
   bank->m_text_version = get_text_version_from_name(file_info.text_version);
   bank->m_file_path = file_info.lines_path;
   bank->m_file_base_path = file_info.lines_base_path;
-  try {
-    if (m_subtitle_version == SubtitleFormat::V1) {
-      const auto package = read_json_files_v1(file_info);
-      bank->m_speakers = package.combined_lines.speakers;
-      bank->add_scenes_from_files(package);
-    } else {
-      const auto package = read_json_files_v2(file_info);
-      bank->m_speakers = package.combined_lines.speakers;
-      bank->m_speakers.emplace("none", "none");
-      bank->add_scenes_from_files(package);
-    }
-  } catch (std::exception& e) {
-    throw;
+  bank->m_speakers = package.combined_lines.speakers;
+  if (m_subtitle_version == SubtitleFormat::V2) {
+    bank->m_speakers.emplace("none", "none");
   }
+  bank->add_scenes_from_files(package);
 }
 
 GameSubtitleSceneInfo GameSubtitleBank::new_scene_from_meta(
@@ -340,25 +344,26 @@ std::vector<std::string> GameSubtitleBank::speaker_names_ordered_by_enum_value()
 }
 
 u16 GameSubtitleBank::speaker_enum_value_from_name(const std::string& speaker_id) {
-  std::unordered_map<std::string, u16> enum_map;
+  const std::unordered_map<std::string, u16>* enum_map = nullptr;
   switch (m_text_version) {
     case GameTextVersion::JAK2:
-      enum_map = jak2_speaker_name_to_enum_val;
+      enum_map = &jak2_speaker_name_to_enum_val;
       break;
     case GameTextVersion::JAK3:
-      enum_map = jak3_speaker_name_to_enum_val;
+      enum_map = &jak3_speaker_name_to_enum_val;
       break;
     default:
       throw std::runtime_error(fmt::format("GameSubtitleBank: invalid game text version {}",
                                            get_text_version_name(m_text_version)));
   }
-  if (enum_map.find(speaker_id) == enum_map.end()) {
+  auto it = enum_map->find(speaker_id);
+  if (it == enum_map->end()) {
     throw std::runtime_error(
         fmt::format("'{}' speaker could not be found in the enum value mapping, update it or fix "
                     "the invalid speaker!",
                     speaker_id));
   }
-  return u16(enum_map.at(speaker_id));
+  return u16(it->second);
 }
 
 SubtitleMetadataFile dump_bank_meta_v2(const GameVersion game_version,
@@ -164,6 +164,11 @@ class GameSubtitleDB {
   }
 
   void init_banks_from_file(const GameSubtitleDefinitionFile& file_info);
+  // init_banks_from_file in two steps. Reading doesn't touch the database, so files can be read in
+  // parallel, then added in order.
+  GameSubtitlePackage read_package(const GameSubtitleDefinitionFile& file_info) const;
+  void init_banks_from_package(const GameSubtitleDefinitionFile& file_info,
+                               const GameSubtitlePackage& package);
   bool write_subtitle_db_to_files(const GameVersion game_version);
 };
 
@@ -208,6 +208,15 @@ void parse_text_goal(const goos::Object& data,
 void parse_text_json(const nlohmann::json& json,
                      GameTextDB& db,
                      const GameTextDefinitionFile& file_info) {
+  add_text_lines(convert_text_json(json, file_info), db, file_info);
+}
+
+/*!
+ * Convert the lines of a game text file (JSON format) to the game's encoding, without adding them
+ * to a database. The lines are in the order they should be set.
+ */
+std::vector<std::pair<int, std::string>> convert_text_json(const nlohmann::json& json,
+                                                           const GameTextDefinitionFile& file_info) {
   // Verify we have all data that we need
   if (!file_info.group_name.has_value()) {
     throw std::runtime_error(
@@ -221,24 +230,15 @@ void parse_text_json(const nlohmann::json& json,
     throw std::runtime_error(
         fmt::format("Can't parse {}, did not provide text_version", file_info.file_path));
   }
-  // Init Settings
-  std::shared_ptr<GameTextBank> bank;
-  if (!db.bank_exists(file_info.group_name.value(), file_info.language_id)) {
-    // database has no lang in this group yet
-    bank = db.add_bank(file_info.group_name.value(),
-                       std::make_shared<GameTextBank>(file_info.language_id));
-  } else {
-    bank = db.bank_by_id(file_info.group_name.value(), file_info.language_id);
-  }
   const GameTextFontBank* font = get_font_bank(file_info.text_version);
+  std::vector<std::pair<int, std::string>> lines;
   // Parse the file
   for (const auto& [text_id, text_value] : json.items()) {
     auto line_id = std::stoi(text_id, nullptr, 16);
     if (text_value.is_string()) {
       // single line replacement
-      auto line = font->convert_utf8_to_game(text_value);
       // TODO - lint duplicate line definitions across text files
-      bank->set_line(line_id, line);
+      lines.emplace_back(line_id, font->convert_utf8_to_game(text_value));
     } else if (text_value.is_array()) {
       // multi-line replacement starting from line_id
       //  (e.g. for Jak 1 credits, start from x0b00)
@@ -247,8 +247,8 @@ void parse_text_json(const nlohmann::json& json,
           throw std::runtime_error(fmt::format(
               "Non string provided for line {} / text id #x{} of _credits", idx, line_id));
         }
-        auto line = font->convert_utf8_to_game(raw_line);
-        bank->set_line(line_id++, line);  // increment line_id
+        // increment line_id
+        lines.emplace_back(line_id++, font->convert_utf8_to_game(raw_line));
       }
     } else {
       // Unexpected value type
@@ -256,6 +256,26 @@ void parse_text_json(const nlohmann::json& json,
           fmt::format("Must provide string or array for text id #x{}", text_id));
     }
   }
+  return lines;
+}
+
+/*!
+ * Add lines from convert_text_json to the database.
+ */
+void add_text_lines(const std::vector<std::pair<int, std::string>>& lines,
+                    GameTextDB& db,
+                    const GameTextDefinitionFile& file_info) {
+  std::shared_ptr<GameTextBank> bank;
+  if (!db.bank_exists(file_info.group_name.value(), file_info.language_id)) {
+    // database has no lang in this group yet
+    bank = db.add_bank(file_info.group_name.value(),
+                       std::make_shared<GameTextBank>(file_info.language_id));
+  } else {
+    bank = db.bank_by_id(file_info.group_name.value(), file_info.language_id);
+  }
+  for (auto& [line_id, line] : lines) {
+    bank->set_line(line_id, line);
+  }
 }
 
 GameTextVersion parse_text_only_version(const std::string& filename) {
@@ -292,7 +312,7 @@ void open_text_project(const std::string& kind,
                        const std::string& filename,
                        std::vector<GameTextDefinitionFile>& text_files) {
   goos::Reader reader;
-  auto& proj = reader.read_from_file({filename}).as_pair()->cdr.as_pair()->car;
+  auto proj = reader.read_from_file({filename}).as_pair()->cdr.as_pair()->car;
   if (!proj.is_pair() || !proj.as_pair()->car.is_symbol() ||
       proj.as_pair()->car.as_symbol() != kind) {
     throw std::runtime_error(fmt::format("invalid {} project", kind));
@@ -7,6 +7,7 @@
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/goos/Object.h"
 #include "common/log/log.h"
@@ -85,6 +86,13 @@ void parse_text_goal(const goos::Object& data,
 void parse_text_json(const nlohmann::json& json,
                      GameTextDB& db,
                      const GameTextDefinitionFile& file_info);
+// parse_text_json in two steps. The first doesn't touch the database, so files can be converted in
+// parallel, then added in order.
+std::vector<std::pair<int, std::string>> convert_text_json(const nlohmann::json& json,
+                                                           const GameTextDefinitionFile& file_info);
+void add_text_lines(const std::vector<std::pair<int, std::string>>& lines,
+                    GameTextDB& db,
+                    const GameTextDefinitionFile& file_info);
 GameTextVersion parse_text_only_version(const std::string& filename);
 GameTextVersion parse_text_only_version(const goos::Object& data);
 
@@ -1,8 +1,22 @@
 #include "sqlite.h"
 
+#include <cctype>
+
 #include "common/log/log.h"
 
+namespace {
+// cached statements, before the cache is cleared. Queries that don't repeat (like ones with the
+// values written into them) would otherwise fill it up forever.
+constexpr size_t kMaxCachedStatements = 128;
+}  // namespace
+
+sqlite::SQLiteDatabase::~SQLiteDatabase() {
+  // statements have to be finalized before the database can be closed.
+  clear_statements();
+}
+
 bool sqlite::SQLiteDatabase::open_db(const std::string& path) {
+  std::lock_guard<std::recursive_mutex> lk(m_mutex);
   if (is_open()) {
     return true;
   }
@@ -21,13 +35,64 @@ bool sqlite::SQLiteDatabase::open_db(const std::string& path) {
   return true;
 }
 
-// TODO - allow passing in a `std::function<int(void*, int, char**, char**)>` to format the results
-// for now we do something that works in general (converts to vectors)
+void sqlite::SQLiteDatabase::clear_statements() {
+  std::lock_guard<std::recursive_mutex> lk(m_mutex);
+  for (auto& [sql, stmt] : m_statements) {
+    sqlite3_finalize(stmt);
+  }
+  m_statements.clear();
+}
 
-sqlite::GenericResponse sqlite::SQLiteDatabase::run_query(const std::string& sql) {
-  GenericResponse resp;
-  if (!is_open()) {
-    return resp;
+sqlite3_stmt* sqlite::SQLiteDatabase::cached_statement(const std::string& sql) {
+  auto it = m_statements.find(sql);
+  if (it != m_statements.end()) {
+    return it->second;
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  const char* tail = nullptr;
+  if (sqlite3_prepare_v3(m_db.value().get(), sql.data(), sql.size(), SQLITE_PREPARE_PERSISTENT,
+                         &stmt, &tail) != SQLITE_OK ||
+      !stmt) {
+    // errors are reported by sqlite3_exec.
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+  // more than one statement (like a schema file), leave it to sqlite3_exec.
+  for (; tail && *tail; tail++) {
+    if (!isspace((unsigned char)*tail)) {
+      sqlite3_finalize(stmt);
+      return nullptr;
+    }
+  }
+
+  if (m_statements.size() >= kMaxCachedStatements) {
+    clear_statements();
+  }
+  m_statements[sql] = stmt;
+  return stmt;
+}
+
+bool sqlite::SQLiteDatabase::exec(const std::string& sql, GenericResponse* resp) {
+  if (auto* stmt = cached_statement(sql)) {
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+      if (resp) {
+        std::vector<std::string> row = {};
+        const int argc = sqlite3_column_count(stmt);
+        for (int i = 0; i < argc; i++) {
+          const auto* text = (const char*)sqlite3_column_text(stmt, i);
+          row.push_back(text ? text : "NULL");
+        }
+        resp->rows.push_back(row);
+      }
+    }
+    sqlite3_reset(stmt);
+    if (rc != SQLITE_DONE) {
+      fprintf(stderr, "SQL error: %s\n", sqlite3_errmsg(m_db.value().get()));
+      return false;
+    }
+    return true;
   }
 
   char* errMsg = 0;
@@ -36,20 +101,100 @@ sqlite::GenericResponse sqlite::SQLiteDatabase::run_query(const std::string& sql
       m_db.value().get(), sql.data(),
       [](void* data, int argc, char** argv, char** /*azColName*/) {
         GenericResponse* resp = static_cast<GenericResponse*>(data);
-        std::vector<std::string> row = {};
-        for (int i = 0; i < argc; i++) {
-          row.push_back(argv[i] ? argv[i] : "NULL");
+        if (resp) {
+          std::vector<std::string> row = {};
+          for (int i = 0; i < argc; i++) {
+            row.push_back(argv[i] ? argv[i] : "NULL");
+          }
+          resp->rows.push_back(row);
         }
-        resp->rows.push_back(row);
         return 0;
       },
-      &resp, &errMsg);
+      resp, &errMsg);
 
   if (rc != SQLITE_OK) {
     fprintf(stderr, "SQL error: %s\n", errMsg);
     sqlite3_free(errMsg);
-    // TODO - store error on response
+    return false;
+  }
+  return true;
+}
+
+// TODO - allow passing in a `std::function<int(void*, int, char**, char**)>` to format the results
+// for now we do something that works in general (converts to vectors)
+
+sqlite::GenericResponse sqlite::SQLiteDatabase::run_query(const std::string& sql) {
+  std::lock_guard<std::recursive_mutex> lk(m_mutex);
+  GenericResponse resp;
+  if (!is_open()) {
     return resp;
   }
+  // TODO - store error on response
+  exec(sql, &resp);
   return resp;
 }
+
+bool sqlite::SQLiteDatabase::run_transaction(const std::string& sql) {
+  std::lock_guard<std::recursive_mutex> lk(m_mutex);
+  if (!is_open() || !exec("BEGIN TRANSACTION;", nullptr)) {
+    return false;
+  }
+  if (!exec(sql, nullptr)) {
+    exec("ROLLBACK;", nullptr);
+    return false;
+  }
+  return exec("COMMIT;", nullptr);
+}
+
+sqlite::AsyncQueryRunner::~AsyncQueryRunner() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+u32 sqlite::AsyncQueryRunner::submit(std::string sql) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  // started on the first query, most runs never make one.
+  if (!m_thread.joinable()) {
+    m_thread = std::thread([this]() { worker(); });
+  }
+  u32 id = m_next_id++;
+  if (m_next_id == 0) {
+    m_next_id = 1;
+  }
+  m_queue.emplace_back(id, std::move(sql));
+  m_cv.notify_one();
+  return id;
+}
+
+std::optional<sqlite::GenericResponse> sqlite::AsyncQueryRunner::take_result(u32 id) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  auto it = m_results.find(id);
+  if (it == m_results.end()) {
+    return std::nullopt;
+  }
+  auto result = std::move(it->second);
+  m_results.erase(it);
+  return result;
+}
+
+void sqlite::AsyncQueryRunner::worker() {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  while (true) {
+    m_cv.wait(lk, [&]() { return m_stop || !m_queue.empty(); });
+    if (m_stop) {
+      return;
+    }
+    auto [id, sql] = std::move(m_queue.front());
+    m_queue.pop_front();
+    lk.unlock();
+    auto result = m_db.run_query(sql);
+    lk.lock();
+    m_results[id] = std::move(result);
+  }
+}
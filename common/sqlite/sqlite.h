@@ -1,10 +1,17 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "common/common_types.h"
+
 #include "third-party/sqlite3/sqlite3.h"
 
 // Just a simple wrapper around the raw C types from sqlite3
@@ -22,15 +29,62 @@ struct GenericResponse {
   std::vector<std::vector<std::string>> rows;
 };
 
+/*!
+ * Single statement queries are prepared once and kept, so running the same SQL again skips
+ * parsing it. Safe to use from multiple threads, queries run one at a time.
+ */
 class SQLiteDatabase {
  public:
   SQLiteDatabase() = default;
+  ~SQLiteDatabase();
+  SQLiteDatabase(const SQLiteDatabase&) = delete;
+  SQLiteDatabase& operator=(const SQLiteDatabase&) = delete;
+
   bool is_open() const { return m_db.has_value(); }
   bool open_db(const std::string& path);
   GenericResponse run_query(const std::string& sql);
+  // Run the SQL (which can be many statements) as one transaction, which is much faster than
+  // waiting for the disk after each insert. Rolled back if anything fails.
+  bool run_transaction(const std::string& sql);
 
  private:
+  bool exec(const std::string& sql, GenericResponse* resp);
+  // nullptr if the sql isn't a single statement that can be cached.
+  sqlite3_stmt* cached_statement(const std::string& sql);
+  void clear_statements();
+
   std::optional<std::shared_ptr<sqlite3>> m_db;
+  std::recursive_mutex m_mutex;
+  std::unordered_map<std::string, sqlite3_stmt*> m_statements;
+};
+
+/*!
+ * Runs queries on a worker thread, in the order they were submitted, so the caller doesn't wait
+ * for the disk. The results are picked up later with take_result.
+ */
+class AsyncQueryRunner {
+ public:
+  explicit AsyncQueryRunner(SQLiteDatabase& db) : m_db(db) {}
+  ~AsyncQueryRunner();
+  AsyncQueryRunner(const AsyncQueryRunner&) = delete;
+  AsyncQueryRunner& operator=(const AsyncQueryRunner&) = delete;
+
+  // returns the id to get the result with, never 0.
+  u32 submit(std::string sql);
+  // the result, once the query has finished. Each result can only be taken once.
+  std::optional<GenericResponse> take_result(u32 id);
+
+ private:
+  void worker();
+
+  SQLiteDatabase& m_db;
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stop = false;
+  u32 m_next_id = 1;
+  std::deque<std::pair<u32, std::string>> m_queue;
+  std::unordered_map<u32, GenericResponse> m_results;
 };
 
 }  // namespace sqlite
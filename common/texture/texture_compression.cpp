@@ -0,0 +1,334 @@
+#include "texture_compression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "common/util/Assert.h"
+
+namespace {
+u32 channel(u32 px, int c) {
+  return (px >> (8 * c)) & 0xff;
+}
+
+u16 to_565(const float* rgb) {
+  auto q = [](float v, int max) {
+    return (u32)std::clamp((int)std::lround(v * max / 255.f), 0, max);
+  };
+  return (q(rgb[0], 31) << 11) | (q(rgb[1], 63) << 5) | q(rgb[2], 31);
+}
+
+void from_565(u16 c, u32* rgb) {
+  u32 r = (c >> 11) & 31;
+  u32 g = (c >> 5) & 63;
+  u32 b = c & 31;
+  rgb[0] = (r << 3) | (r >> 2);
+  rgb[1] = (g << 2) | (g >> 4);
+  rgb[2] = (b << 3) | (b >> 2);
+}
+
+/*!
+ * The four colors of a 4-color block.
+ */
+void color_palette(u16 c0, u16 c1, bool four_color, u32 palette[4][4]) {
+  from_565(c0, palette[0]);
+  from_565(c1, palette[1]);
+  for (int c = 0; c < 3; c++) {
+    if (four_color) {
+      palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+      palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    } else {
+      palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+      palette[3][c] = 0;
+    }
+  }
+  palette[0][3] = palette[1][3] = palette[2][3] = 255;
+  palette[3][3] = four_color ? 255 : 0;
+}
+
+/*!
+ * Color part of a block. Endpoints are the extremes along the principal axis of the colors, pulled
+ * in slightly, and the block is always in 4-color mode.
+ */
+void compress_color_block(const u32* block, u8* out) {
+  float rgb[16][3];
+  float mean[3] = {0, 0, 0};
+  for (int i = 0; i < 16; i++) {
+    for (int c = 0; c < 3; c++) {
+      rgb[i][c] = channel(block[i], c);
+      mean[c] += rgb[i][c] / 16.f;
+    }
+  }
+
+  float cov[6] = {0, 0, 0, 0, 0, 0};  // xx, xy, xz, yy, yz, zz
+  for (auto& px : rgb) {
+    float d[3] = {px[0] - mean[0], px[1] - mean[1], px[2] - mean[2]};
+    cov[0] += d[0] * d[0];
+    cov[1] += d[0] * d[1];
+    cov[2] += d[0] * d[2];
+    cov[3] += d[1] * d[1];
+    cov[4] += d[1] * d[2];
+    cov[5] += d[2] * d[2];
+  }
+
+  float axis[3] = {1, 1, 1};
+  for (int iter = 0; iter < 8; iter++) {
+    float next[3] = {cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2],
+                     cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2],
+                     cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2]};
+    float len = std::max({std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+    if (len < 1e-6f) {
+      break;
+    }
+    for (int c = 0; c < 3; c++) {
+      axis[c] = next[c] / len;
+    }
+  }
+
+  int min_idx = 0, max_idx = 0;
+  float min_proj = 1e30f, max_proj = -1e30f;
+  for (int i = 0; i < 16; i++) {
+    float proj = rgb[i][0] * axis[0] + rgb[i][1] * axis[1] + rgb[i][2] * axis[2];
+    if (proj < min_proj) {
+      min_proj = proj;
+      min_idx = i;
+    }
+    if (proj > max_proj) {
+      max_proj = proj;
+      max_idx = i;
+    }
+  }
+
+  float hi[3], lo[3];
+  for (int c = 0; c < 3; c++) {
+    float inset = (rgb[max_idx][c] - rgb[min_idx][c]) / 16.f;
+    hi[c] = rgb[max_idx][c] - inset;
+    lo[c] = rgb[min_idx][c] + inset;
+  }
+
+  u16 c0 = to_565(hi);
+  u16 c1 = to_565(lo);
+  if (c0 < c1) {
+    std::swap(c0, c1);
+  }
+
+  u32 indices = 0;
+  if (c0 != c1) {
+    u32 palette[4][4];
+    color_palette(c0, c1, true, palette);
+    for (int i = 0; i < 16; i++) {
+      int best = 0;
+      float best_dist = 1e30f;
+      for (int p = 0; p < 4; p++) {
+        float dist = 0;
+        for (int c = 0; c < 3; c++) {
+          float d = rgb[i][c] - palette[p][c];
+          dist += d * d;
+        }
+        if (dist < best_dist) {
+          best_dist = dist;
+          best = p;
+        }
+      }
+      indices |= best << (2 * i);
+    }
+  }
+
+  memcpy(out, &c0, 2);
+  memcpy(out + 2, &c1, 2);
+  memcpy(out + 4, &indices, 4);
+}
+
+void alpha_palette(u8 a0, u8 a1, u32 palette[8]) {
+  palette[0] = a0;
+  palette[1] = a1;
+  if (a0 > a1) {
+    for (int i = 1; i < 7; i++) {
+      palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+    }
+  } else {
+    for (int i = 1; i < 5; i++) {
+      palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+    }
+    palette[6] = 0;
+    palette[7] = 255;
+  }
+}
+
+void compress_alpha_block(const u32* block, u8* out) {
+  u8 a0 = 0, a1 = 255;
+  for (int i = 0; i < 16; i++) {
+    u8 a = channel(block[i], 3);
+    a0 = std::max(a0, a);
+    a1 = std::min(a1, a);
+  }
+
+  u64 indices = 0;
+  if (a0 != a1) {
+    u32 palette[8];
+    alpha_palette(a0, a1, palette);
+    for (int i = 0; i < 16; i++) {
+      int a = channel(block[i], 3);
+      int best = 0;
+      for (int p = 1; p < 8; p++) {
+        if (std::abs(a - (int)palette[p]) < std::abs(a - (int)palette[best])) {
+          best = p;
+        }
+      }
+      indices |= (u64)best << (3 * i);
+    }
+  }
+
+  out[0] = a0;
+  out[1] = a1;
+  for (int i = 0; i < 6; i++) {
+    out[2 + i] = indices >> (8 * i);
+  }
+}
+
+u32 block_size(BcFormat format) {
+  return format == BcFormat::BC1 ? 8 : 16;
+}
+
+void compress_level(const u32* rgba, u32 w, u32 h, BcFormat format, u8* out) {
+  u32 block[16];
+  for (u32 by = 0; by < h; by += 4) {
+    for (u32 bx = 0; bx < w; bx += 4) {
+      // blocks that hang off the edge repeat the last row/column.
+      for (u32 y = 0; y < 4; y++) {
+        for (u32 x = 0; x < 4; x++) {
+          block[x + y * 4] = rgba[std::min(bx + x, w - 1) + std::min(by + y, h - 1) * w];
+        }
+      }
+      bc_compress_block(block, format, out);
+      out += block_size(format);
+    }
+  }
+}
+
+std::vector<u32> downsample(const u32* rgba, u32 w, u32 h) {
+  const u32 w2 = std::max(1u, w / 2);
+  const u32 h2 = std::max(1u, h / 2);
+  std::vector<u32> result(w2 * h2);
+  for (u32 y = 0; y < h2; y++) {
+    for (u32 x = 0; x < w2; x++) {
+      const u32 x0 = std::min(2 * x, w - 1), x1 = std::min(2 * x + 1, w - 1);
+      const u32 y0 = std::min(2 * y, h - 1), y1 = std::min(2 * y + 1, h - 1);
+      u32 px = 0;
+      for (int c = 0; c < 4; c++) {
+        u32 sum = channel(rgba[x0 + y0 * w], c) + channel(rgba[x1 + y0 * w], c) +
+                  channel(rgba[x0 + y1 * w], c) + channel(rgba[x1 + y1 * w], c);
+        px |= ((sum + 2) / 4) << (8 * c);
+      }
+      result[x + y * w2] = px;
+    }
+  }
+  return result;
+}
+}  // namespace
+
+u32 bc_num_mip_levels(u32 w, u32 h) {
+  u32 levels = 1;
+  while (w > 1 || h > 1) {
+    w = std::max(1u, w / 2);
+    h = std::max(1u, h / 2);
+    levels++;
+  }
+  return levels;
+}
+
+u32 bc_level_size(u32 w, u32 h, BcFormat format) {
+  return ((w + 3) / 4) * ((h + 3) / 4) * block_size(format);
+}
+
+u32 bc_mip_chain_size(u32 w, u32 h, BcFormat format) {
+  u32 size = 0;
+  const u32 levels = bc_num_mip_levels(w, h);
+  for (u32 i = 0; i < levels; i++) {
+    size += bc_level_size(w, h, format);
+    w = std::max(1u, w / 2);
+    h = std::max(1u, h / 2);
+  }
+  return size;
+}
+
+BcFormat bc_pick_format(const u32* rgba, u32 num_texels) {
+  for (u32 i = 0; i < num_texels; i++) {
+    if ((rgba[i] >> 24) != 0xff) {
+      return BcFormat::BC3;
+    }
+  }
+  return BcFormat::BC1;
+}
+
+void bc_compress_block(const u32* block, BcFormat format, u8* out) {
+  switch (format) {
+    case BcFormat::BC1:
+      compress_color_block(block, out);
+      break;
+    case BcFormat::BC3:
+      compress_alpha_block(block, out);
+      compress_color_block(block, out + 8);
+      break;
+    default:
+      ASSERT_NOT_REACHED();
+  }
+}
+
+std::vector<u8> bc_compress_mip_chain(const u32* rgba, u32 w, u32 h, BcFormat format) {
+  std::vector<u8> result(bc_mip_chain_size(w, h, format));
+  u8* out = result.data();
+  std::vector<u32> level;
+  const u32* level_data = rgba;
+  const u32 levels = bc_num_mip_levels(w, h);
+  for (u32 i = 0; i < levels; i++) {
+    compress_level(level_data, w, h, format, out);
+    out += bc_level_size(w, h, format);
+    if (w > 1 || h > 1) {
+      level = downsample(level_data, w, h);
+      level_data = level.data();
+      w = std::max(1u, w / 2);
+      h = std::max(1u, h / 2);
+    }
+  }
+  ASSERT(out == result.data() + result.size());
+  return result;
+}
+
+void bc_decompress_level(const u8* data, u32 w, u32 h, BcFormat format, u32* rgba_out) {
+  for (u32 by = 0; by < h; by += 4) {
+    for (u32 bx = 0; bx < w; bx += 4) {
+      const u8* color_block = format == BcFormat::BC3 ? data + 8 : data;
+      u16 c0, c1;
+      u32 indices;
+      memcpy(&c0, color_block, 2);
+      memcpy(&c1, color_block + 2, 2);
+      memcpy(&indices, color_block + 4, 4);
+      u32 palette[4][4];
+      color_palette(c0, c1, format == BcFormat::BC3 || c0 > c1, palette);
+
+      u32 alphas[8];
+      u64 alpha_indices = 0;
+      if (format == BcFormat::BC3) {
+        alpha_palette(data[0], data[1], alphas);
+        for (int i = 0; i < 6; i++) {
+          alpha_indices |= (u64)data[2 + i] << (8 * i);
+        }
+      }
+
+      for (u32 y = 0; y < 4; y++) {
+        for (u32 x = 0; x < 4; x++) {
+          if (bx + x >= w || by + y >= h) {
+            continue;
+          }
+          const u32 i = x + y * 4;
+          const u32* color = palette[(indices >> (2 * i)) & 3];
+          u32 a = format == BcFormat::BC3 ? alphas[(alpha_indices >> (3 * i)) & 7] : color[3];
+          rgba_out[bx + x + (by + y) * w] =
+              color[0] | (color[1] << 8) | (color[2] << 16) | (a << 24);
+        }
+      }
+      data += block_size(format);
+    }
+  }
+}
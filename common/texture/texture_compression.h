@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+
+/*!
+ * @file texture_compression.h
+ * BC1 and BC3 (also called DXT1 and DXT5) block compression for RGBA8888 textures.
+ * Blocks are 4x4 texels; BC1 is 8 bytes per block with no alpha, BC3 is 16 bytes with alpha.
+ */
+
+enum class BcFormat : u8 { BC1 = 1, BC3 = 2 };
+
+/*!
+ * Number of levels in a full mip chain, down to 1x1.
+ */
+u32 bc_num_mip_levels(u32 w, u32 h);
+
+/*!
+ * Size in bytes of one compressed level.
+ */
+u32 bc_level_size(u32 w, u32 h, BcFormat format);
+
+/*!
+ * Size in bytes of a full compressed mip chain.
+ */
+u32 bc_mip_chain_size(u32 w, u32 h, BcFormat format);
+
+/*!
+ * Pick a format for the texture: BC1 if every texel is fully opaque, BC3 otherwise.
+ */
+BcFormat bc_pick_format(const u32* rgba, u32 num_texels);
+
+/*!
+ * Compress one 4x4 block, given in row-major order. Writes 8 (BC1) or 16 (BC3) bytes.
+ */
+void bc_compress_block(const u32* block, BcFormat format, u8* out);
+
+/*!
+ * Build the mip chain with a box filter and compress every level. The result is every level,
+ * largest first, in the layout glCompressedTexImage2D expects.
+ */
+std::vector<u8> bc_compress_mip_chain(const u32* rgba, u32 w, u32 h, BcFormat format);
+
+/*!
+ * Decompress one level back to RGBA8888, for drivers that can't sample these formats.
+ */
+void bc_decompress_level(const u8* data, u32 w, u32 h, BcFormat format, u32* rgba_out);
@@ -9,6 +9,7 @@
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/Serializer.h"
 
 #include "fmt/core.h"
 
@@ -1184,3 +1185,115 @@ std::string EnumType::diff_impl(const Type& other_) const {
 
   return result;
 }
+
+/////////////////
+// Serialization
+/////////////////
+
+void DefinitionMetadata::serialize(Serializer& ser) {
+  ser.from_optional(&definition_info, [&](goos::TextDb::ShortInfo* info) {
+    ser.from_str(&info->filename);
+    ser.from_ptr(&info->line_idx_to_display);
+    ser.from_ptr(&info->pos_in_line);
+    ser.from_str(&info->line_text);
+  });
+  ser.from_optional(&docstring, [&](std::string* str) { ser.from_str(str); });
+}
+
+void MethodInfo::serialize(Serializer& ser) {
+  ser.from_ptr(&id);
+  ser.from_str(&name);
+  type.serialize(ser);
+  ser.from_str(&defined_in_type);
+  ser.from_str(&type_name);
+  ser.from_ptr(&no_virtual);
+  ser.from_ptr(&overrides_parent);
+  ser.from_ptr(&only_overrides_docstring);
+  ser.from_optional(&docstring, [&](std::string* str) { ser.from_str(str); });
+  ser.from_optional(&overlay_name, [&](std::string* str) { ser.from_str(str); });
+}
+
+void Type::serialize(Serializer& ser) {
+  auto serialize_state_meta = [&](auto* map) {
+    ser.from_string_map(map, [&](auto* states) {
+      ser.from_string_map(states, [&](DefinitionMetadata* meta) { meta->serialize(ser); });
+    });
+  };
+
+  m_metadata.serialize(ser);
+  serialize_state_meta(&m_virtual_state_definition_meta);
+  serialize_state_meta(&m_state_definition_meta);
+  ser.from_vector(&m_methods, [&](MethodInfo* info) { info->serialize(ser); });
+  ser.from_string_map(&m_states, [&](TypeSpec* ts) { ts->serialize(ser); });
+  m_new_method_info.serialize(ser);
+  ser.from_ptr(&m_new_method_info_defined);
+  ser.from_ptr(&m_generate_inspect);
+  ser.from_str(&m_parent);
+  ser.from_str(&m_name);
+  ser.from_ptr(&m_allow_in_runtime);
+  ser.from_str(&m_runtime_name);
+  ser.from_ptr(&m_is_boxed);
+  ser.from_ptr(&m_heap_base);
+}
+
+void ValueType::serialize(Serializer& ser) {
+  Type::serialize(ser);
+  ser.from_ptr(&m_size);
+  ser.from_ptr(&m_offset);
+  ser.from_ptr(&m_sign_extend);
+  ser.from_ptr(&m_reg_kind);
+}
+
+void Field::serialize(Serializer& ser) {
+  ser.from_str(&m_name);
+  m_type.serialize(ser);
+  ser.from_ptr(&m_override_type);
+  ser.from_ptr(&m_offset);
+  ser.from_ptr(&m_inline);
+  ser.from_ptr(&m_dynamic);
+  ser.from_ptr(&m_array);
+  ser.from_ptr(&m_array_size);
+  ser.from_ptr(&m_alignment);
+  ser.from_ptr(&m_skip_in_static_decomp);
+  ser.from_ptr(&m_placed_by_user);
+  ser.from_str(&m_comment);
+  ser.from_ptr(&m_field_score);
+  ser.from_optional(&m_decomp_as_ts, [&](TypeSpec* ts) { ts->serialize(ser); });
+}
+
+void StructureType::serialize(Serializer& ser) {
+  Type::serialize(ser);
+  ser.from_vector(&m_fields, [&](Field* field) { field->serialize(ser); });
+  ser.from_pod_vector(&m_overriden_fields);
+  ser.from_ptr(&m_dynamic);
+  ser.from_ptr(&m_size_in_mem);
+  ser.from_ptr(&m_pack);
+  ser.from_ptr(&m_allow_misalign);
+  ser.from_ptr(&m_offset);
+  ser.from_ptr(&m_always_stack_singleton);
+  ser.from_ptr(&m_idx_of_first_unique_field);
+}
+
+void BasicType::serialize(Serializer& ser) {
+  StructureType::serialize(ser);
+  ser.from_ptr(&m_final);
+}
+
+void BitField::serialize(Serializer& ser) {
+  m_type.serialize(ser);
+  ser.from_str(&m_name);
+  ser.from_ptr(&m_offset);
+  ser.from_ptr(&m_size);
+  ser.from_ptr(&m_skip_in_static_decomp);
+}
+
+void BitFieldType::serialize(Serializer& ser) {
+  ValueType::serialize(ser);
+  ser.from_vector(&m_fields, [&](BitField* field) { field->serialize(ser); });
+}
+
+void EnumType::serialize(Serializer& ser) {
+  ValueType::serialize(ser);
+  ser.from_ptr(&m_is_bitfield);
+  ser.from_string_map(&m_entries, [&](s64* value) { ser.from_ptr(value); });
+}
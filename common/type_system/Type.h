@@ -15,12 +15,15 @@
 #include "common/goos/TextDB.h"
 #include "common/util/Assert.h"
 
+class Serializer;
 class TypeSystem;
 
 // Various metadata that can be associated with a symbol or form
 struct DefinitionMetadata {
   std::optional<goos::TextDb::ShortInfo> definition_info;
   std::optional<std::string> docstring;
+
+  void serialize(Serializer& ser);
 };
 
 struct MethodInfo {
@@ -42,6 +45,7 @@ struct MethodInfo {
   bool operator!=(const MethodInfo& other) const { return !((*this) == other); }
   std::string print_one_line() const;
   std::string diff(const MethodInfo& other) const;
+  void serialize(Serializer& ser);
 };
 
 /*!
@@ -121,6 +125,15 @@ class Type {
 
   bool gen_inspect() const { return m_generate_inspect; }
 
+  /*!
+   * This type and all of its parents, starting from the root. Set up by the TypeSystem, so
+   * typechecks and common ancestors don't need to look up each parent by name.
+   */
+  const std::vector<const Type*>& ancestors() const { return m_ancestors; }
+
+  // save or load everything but the kind of type, which the TypeSystem handles.
+  virtual void serialize(Serializer& ser);
+
   DefinitionMetadata m_metadata;
   std::unordered_map<std::string, std::unordered_map<std::string, DefinitionMetadata>>
       m_virtual_state_definition_meta = {};
@@ -144,6 +157,10 @@ class Type {
   std::string m_runtime_name;
   bool m_is_boxed = false;  // does this have runtime type information?
   int m_heap_base = 0;
+
+ private:
+  friend class TypeSystem;
+  std::vector<const Type*> m_ancestors;
 };
 
 /*!
@@ -194,6 +211,7 @@ class ValueType : public Type {
   std::string diff_impl(const Type& other) const override;
   ~ValueType() = default;
   void inherit(const ValueType* parent);
+  void serialize(Serializer& ser) override;
 
  protected:
   friend class TypeSystem;
@@ -249,6 +267,7 @@ class Field {
   bool operator==(const Field& other) const;
   bool operator!=(const Field& other) const { return !((*this) == other); }
   std::string diff(const Field& other) const;
+  void serialize(Serializer& ser);
 
   int alignment() const {
     ASSERT(m_alignment != -1);
@@ -322,6 +341,7 @@ class StructureType : public ReferenceType {
   void set_gen_inspect(bool gen_inspect) { m_generate_inspect = gen_inspect; }
   int size() const { return m_size_in_mem; }
   void override_field_type(const std::string& field_name, const TypeSpec& new_type);
+  void serialize(Serializer& ser) override;
 
  protected:
   friend class TypeSystem;
@@ -358,6 +378,7 @@ class BasicType : public StructureType {
   ~BasicType() = default;
   bool operator==(const Type& other) const override;
   std::string diff_impl(const Type& other) const override;
+  void serialize(Serializer& ser) override;
 
  protected:
   bool m_final = false;
@@ -376,6 +397,7 @@ class BitField {
   bool operator!=(const BitField& other) const { return !((*this) == other); }
   std::string diff(const BitField& other) const;
   std::string print() const;
+  void serialize(Serializer& ser);
 
  private:
   TypeSpec m_type;
@@ -394,6 +416,7 @@ class BitFieldType : public ValueType {
   const std::vector<BitField>& fields() const { return m_fields; }
   std::string diff_impl(const Type& other) const override;
   void set_gen_inspect(bool gen_inspect) { m_generate_inspect = gen_inspect; }
+  void serialize(Serializer& ser) override;
 
  private:
   friend class TypeSystem;
@@ -411,6 +434,7 @@ class EnumType : public ValueType {
   const std::unordered_map<std::string, s64>& entries() const { return m_entries; }
   bool is_bitfield() const { return m_is_bitfield; }
   std::string diff_impl(const Type& other) const override;
+  void serialize(Serializer& ser) override;
 
  private:
   friend class TypeSystem;
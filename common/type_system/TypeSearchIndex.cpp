@@ -0,0 +1,238 @@
+#include "TypeSearchIndex.h"
+
+#include <algorithm>
+#include <map>
+
+#include "common/util/Assert.h"
+
+#include "fmt/core.h"
+
+namespace {
+constexpr u32 kIndexVersion = 1;
+
+void intersect(std::optional<std::vector<int>>* result, std::vector<int> ids) {
+  std::sort(ids.begin(), ids.end());
+  if (!*result) {
+    *result = std::move(ids);
+    return;
+  }
+  std::vector<int> both;
+  std::set_intersection((*result)->begin(), (*result)->end(), ids.begin(), ids.end(),
+                        std::back_inserter(both));
+  *result = std::move(both);
+}
+}  // namespace
+
+TypeSearchIndex::TypeSearchIndex(const TypeSystem& ts) {
+  // walk the type tree in preorder to number the types
+  auto names = ts.get_all_type_names();
+  std::sort(names.begin(), names.end());
+  std::unordered_map<std::string, std::vector<const std::string*>> children;
+  std::vector<const std::string*> roots;
+  for (const auto& name : names) {
+    auto* type = ts.lookup_type_allow_partial_def(name);
+    if (type->has_parent() && ts.fully_defined_type_exists(type->get_parent())) {
+      children[type->get_parent()].push_back(&name);
+    } else {
+      roots.push_back(&name);
+    }
+  }
+
+  std::vector<std::pair<const std::string*, bool>> stack;
+  for (auto it = roots.rbegin(); it != roots.rend(); it++) {
+    stack.emplace_back(*it, false);
+  }
+  std::vector<int> open;
+  m_subtree_end.resize(names.size());
+  while (!stack.empty()) {
+    auto [name, done] = stack.back();
+    stack.pop_back();
+    if (done) {
+      m_subtree_end.at(open.back()) = m_names.size();
+      open.pop_back();
+      continue;
+    }
+    open.push_back(m_names.size());
+    m_names.push_back(*name);
+    stack.emplace_back(name, true);
+    auto kids = children.find(*name);
+    if (kids != children.end()) {
+      for (auto it = kids->second.rbegin(); it != kids->second.rend(); it++) {
+        stack.emplace_back(*it, false);
+      }
+    }
+  }
+  ASSERT(m_names.size() == names.size());
+
+  std::vector<std::pair<std::string, s32>> field_keys;
+  std::vector<std::vector<s32>> field_ids;
+  std::map<std::pair<std::string, s32>, size_t> field_key_idx;
+  m_has_parent.resize(m_names.size());
+  m_is_structure.resize(m_names.size());
+  for (size_t id = 0; id < m_names.size(); id++) {
+    auto* type = ts.lookup_type_allow_partial_def(m_names[id]);
+    m_has_parent[id] = type->has_parent();
+    if (!dynamic_cast<NullType*>(type)) {
+      m_by_size.push_back({type->get_size_in_memory(), (s32)id});
+    }
+    auto method_count = ts.try_get_type_method_count(m_names[id]);
+    if (method_count) {
+      m_by_max_method_id.push_back({*method_count - 1, (s32)id});
+    }
+    auto* structure = dynamic_cast<StructureType*>(type);
+    if (structure) {
+      m_is_structure[id] = true;
+      for (const auto& field : structure->fields()) {
+        auto key = std::make_pair(field.type().base_type(), field.offset());
+        auto [it, inserted] = field_key_idx.try_emplace(key, field_keys.size());
+        if (inserted) {
+          field_keys.push_back(key);
+          field_ids.emplace_back();
+        }
+        auto& ids = field_ids[it->second];
+        if (ids.empty() || ids.back() != (s32)id) {
+          ids.push_back(id);
+        }
+      }
+    }
+  }
+  std::sort(m_by_size.begin(), m_by_size.end());
+  std::sort(m_by_max_method_id.begin(), m_by_max_method_id.end());
+
+  // field_key_idx is ordered by (type name, offset), which is the order of m_fields.
+  for (const auto& [key, idx] : field_key_idx) {
+    if (m_field_type_names.empty() || m_field_type_names.back() != key.first) {
+      m_field_type_names.push_back(key.first);
+    }
+    auto& entry = m_fields.emplace_back();
+    entry.type_name = m_field_type_names.size() - 1;
+    entry.offset = key.second;
+    entry.begin = m_field_postings.size();
+    m_field_postings.insert(m_field_postings.end(), field_ids[idx].begin(), field_ids[idx].end());
+    entry.end = m_field_postings.size();
+  }
+
+  build_lookup();
+}
+
+void TypeSearchIndex::build_lookup() {
+  m_id_by_name.clear();
+  for (size_t i = 0; i < m_names.size(); i++) {
+    m_id_by_name[m_names[i]] = i;
+  }
+}
+
+std::vector<int> TypeSearchIndex::ids_in_range(const std::vector<Key>& keys,
+                                               int min,
+                                               std::optional<int> max) const {
+  auto begin = std::lower_bound(keys.begin(), keys.end(), Key{min, INT32_MIN});
+  auto end = max ? std::upper_bound(keys.begin(), keys.end(), Key{*max, INT32_MAX}) : keys.end();
+  std::vector<int> result;
+  for (auto it = begin; it < end; it++) {
+    result.push_back(it->id);
+  }
+  return result;
+}
+
+std::vector<std::string> TypeSearchIndex::search(const Query& query) const {
+  std::optional<std::vector<int>> ids;
+
+  if (!query.parent.empty()) {
+    // same aliases as TypeSystem::typecheck_base_types
+    std::string parent = query.parent;
+    if (parent == "meters" || parent == "degrees") {
+      parent = "float";
+    } else if (parent == "seconds") {
+      parent = "time-frame";
+    }
+    std::vector<int> descendants;
+    auto it = m_id_by_name.find(parent);
+    if (it != m_id_by_name.end()) {
+      for (int id = it->second; id < m_subtree_end.at(it->second); id++) {
+        if (m_has_parent[id]) {
+          descendants.push_back(id);
+        }
+      }
+    }
+    intersect(&ids, std::move(descendants));
+  }
+
+  if (query.min_method_id != -1) {
+    intersect(&ids, ids_in_range(m_by_max_method_id, query.min_method_id, {}));
+  }
+
+  if (query.min_size) {
+    intersect(&ids,
+              ids_in_range(m_by_size, *query.min_size, query.max_size.value_or(*query.min_size)));
+  }
+
+  if (query.fields && query.fields->empty()) {
+    // no fields required, but it still has to be a structure.
+    std::vector<int> structures;
+    for (size_t id = 0; id < m_names.size(); id++) {
+      if (m_is_structure[id]) {
+        structures.push_back(id);
+      }
+    }
+    intersect(&ids, std::move(structures));
+  }
+
+  if (query.fields) {
+    for (const auto& field : *query.fields) {
+      std::vector<int> with_field;
+      auto name = std::lower_bound(m_field_type_names.begin(), m_field_type_names.end(),
+                                   field.field_type_name);
+      if (name != m_field_type_names.end() && *name == field.field_type_name) {
+        FieldEntry key{(s32)(name - m_field_type_names.begin()), field.field_offset, 0, 0};
+        auto entry = std::lower_bound(m_fields.begin(), m_fields.end(), key,
+                                      [](const FieldEntry& a, const FieldEntry& b) {
+                                        return a.type_name != b.type_name
+                                                   ? a.type_name < b.type_name
+                                                   : a.offset < b.offset;
+                                      });
+        if (entry != m_fields.end() && entry->type_name == key.type_name &&
+            entry->offset == key.offset) {
+          with_field.assign(m_field_postings.begin() + entry->begin,
+                            m_field_postings.begin() + entry->end);
+        }
+      }
+      intersect(&ids, std::move(with_field));
+    }
+  }
+
+  std::vector<std::string> result;
+  if (ids) {
+    for (int id : *ids) {
+      result.push_back(m_names.at(id));
+    }
+    std::sort(result.begin(), result.end());
+  }
+  return result;
+}
+
+std::vector<std::string> TypeSearchIndex::all_type_names() const {
+  auto result = m_names;
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+void TypeSearchIndex::serialize(Serializer& ser) {
+  u32 version = kIndexVersion;
+  ser.from_ptr(&version);
+  if (version != kIndexVersion) {
+    throw std::runtime_error(
+        fmt::format("type search index version {}, expected {}", version, kIndexVersion));
+  }
+  ser.from_string_vector(&m_names);
+  ser.from_pod_vector(&m_subtree_end);
+  ser.from_pod_vector(&m_has_parent);
+  ser.from_pod_vector(&m_is_structure);
+  ser.from_pod_vector(&m_by_size);
+  ser.from_pod_vector(&m_by_max_method_id);
+  ser.from_string_vector(&m_field_type_names);
+  ser.from_pod_vector(&m_fields);
+  ser.from_pod_vector(&m_field_postings);
+  if (ser.is_loading()) {
+    build_lookup();
+  }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+/*!
+ * @file TypeSearchIndex.h
+ * An index over a TypeSystem for the searches done by tools/type_searcher: types by parent, size,
+ * method count and fields at given offsets. It can be saved and loaded, so a search doesn't need
+ * to parse all-types.
+ */
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/type_system/TypeSystem.h"
+#include "common/util/Serializer.h"
+
+class TypeSearchIndex {
+ public:
+  /*!
+   * A search for types matching all of the set filters. These mean the same thing as the
+   * TypeSystem::search_types_by_... functions.
+   */
+  struct Query {
+    std::string parent;      // the type or its descendants, if not empty
+    int min_method_id = -1;  // types that have this method id, if not -1
+    std::optional<int> min_size;
+    std::optional<int> max_size;  // if not set, the size must be exactly min_size
+    std::optional<std::vector<TypeSystem::TypeSearchFieldInput>> fields;
+
+    bool empty() const {
+      return parent.empty() && min_method_id == -1 && !min_size && !fields;
+    }
+  };
+
+  TypeSearchIndex() = default;
+  explicit TypeSearchIndex(const TypeSystem& ts);
+
+  /*!
+   * The names of the types matching the query, sorted.
+   */
+  std::vector<std::string> search(const Query& query) const;
+  std::vector<std::string> all_type_names() const;
+  int type_count() const { return m_names.size(); }
+
+  void serialize(Serializer& ser);
+
+ private:
+  struct Key {
+    s32 key;
+    s32 id;
+    bool operator<(const Key& other) const {
+      return key != other.key ? key < other.key : id < other.id;
+    }
+  };
+
+  struct FieldEntry {
+    s32 type_name;  // in m_field_type_names
+    s32 offset;
+    u32 begin, end;  // in m_field_postings
+  };
+
+  void build_lookup();
+  std::vector<int> ids_in_range(const std::vector<Key>& keys,
+                                int min,
+                                std::optional<int> max) const;
+
+  // types are numbered in preorder of the type tree, so the descendants of a type are a range.
+  std::vector<std::string> m_names;
+  std::vector<s32> m_subtree_end;  // one past the last descendant of each type
+  std::vector<u8> m_has_parent;
+  std::vector<u8> m_is_structure;
+  std::vector<Key> m_by_size;           // not including null types
+  std::vector<Key> m_by_max_method_id;  // the highest method id of the type
+
+  // structure types by (field type, offset) of their fields
+  std::vector<std::string> m_field_type_names;  // sorted
+  std::vector<FieldEntry> m_fields;             // sorted by type_name, then offset
+  std::vector<s32> m_field_postings;
+
+  // not saved, rebuilt after loading
+  std::unordered_map<std::string, int> m_id_by_name;
+};
@@ -7,6 +7,8 @@
 
 #include <stdexcept>
 
+#include "common/util/Serializer.h"
+
 #include "fmt/core.h"
 
 bool TypeTag::operator==(const TypeTag& other) const {
@@ -145,3 +147,20 @@ void TypeSpec::delete_tag(const std::string& tag_name) {
     }
   }
 }
+
+void TypeSpec::serialize(Serializer& ser) {
+  ser.from_str(&m_type);
+  size_t num_args = arg_count();
+  ser.from_ptr(&num_args);
+  if (ser.is_loading()) {
+    delete m_arguments;
+    m_arguments = num_args ? new std::vector<TypeSpec>(num_args) : nullptr;
+  }
+  for (size_t i = 0; i < num_args; i++) {
+    m_arguments->at(i).serialize(ser);
+  }
+  ser.from_vector(&m_tags, [&](TypeTag* tag) {
+    ser.from_str(&tag->name);
+    ser.from_str(&tag->value);
+  });
+}
@@ -12,6 +12,8 @@
 #include "common/util/Assert.h"
 #include "common/util/SmallVector.h"
 
+class Serializer;
+
 /*!
  * A :name value modifier to apply to a type.
  */
@@ -151,6 +153,7 @@ class TypeSpec {
   }
 
   const std::vector<TypeTag>& tags() const { return m_tags; }
+  void serialize(Serializer& ser);
 
  private:
   friend class TypeSystem;
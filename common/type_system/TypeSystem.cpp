@@ -12,6 +12,7 @@
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/Serializer.h"
 #include "common/util/math_util.h"
 
 #include "fmt/color.h"
@@ -32,6 +33,8 @@ template <typename... Args>
 }
 }  // namespace
 
+thread_local std::unordered_set<std::string>* TypeSystem::s_type_use_recorder = nullptr;
+
 TypeSystem::TypeSystem() {
   // the "none" and "_type_" types are included by default.
   add_type("none", std::make_unique<NullType>("none"));
@@ -74,6 +77,8 @@ Type* TypeSystem::add_type(const std::string& name, std::unique_ptr<Type> type)
 
         // update the type
         m_types[name] = std::move(type);
+        // children still point to the old type.
+        rebuild_all_ancestors();
       } else {
         throw_typesystem_error(
             "Inconsistent type definition. Type {} was originally\n{}\nand is redefined "
@@ -98,7 +103,13 @@ Type* TypeSystem::add_type(const std::string& name, std::unique_ptr<Type> type)
       }
     }
 
+    auto* new_type = type.get();
     m_types[name] = std::move(type);
+    if (m_missing_parents.count(name)) {
+      rebuild_all_ancestors();
+    } else {
+      set_ancestors(new_type);
+    }
     auto fwd_it = m_forward_declared_types.find(name);
     if (fwd_it != m_forward_declared_types.end()) {
       // need to check parent is correct.
@@ -258,7 +269,7 @@ int TypeSystem::get_type_method_count(const std::string& name) const {
 }
 
 std::optional<int> TypeSystem::try_get_type_method_count(const std::string& name) const {
-  auto type_it = m_types.find(name);
+  auto type_it = find_type(name);
   if (type_it != m_types.end()) {
     return get_next_method_id(type_it->second.get());
   }
@@ -350,7 +361,7 @@ DerefInfo TypeSystem::get_deref_info(const TypeSpec& ts) const {
  * If you really need a TypeSpec which refers to a non-existent type, just construct your own.
  */
 TypeSpec TypeSystem::make_typespec(const std::string& name) const {
-  if (m_types.find(name) != m_types.end() ||
+  if (find_type(name) != m_types.end() ||
       m_forward_declared_types.find(name) != m_forward_declared_types.end()) {
     return TypeSpec(name);
   } else {
@@ -359,7 +370,7 @@ TypeSpec TypeSystem::make_typespec(const std::string& name) const {
 }
 
 bool TypeSystem::fully_defined_type_exists(const std::string& name) const {
-  return m_types.find(name) != m_types.end();
+  return find_type(name) != m_types.end();
 }
 
 bool TypeSystem::fully_defined_type_exists(const TypeSpec& type) const {
@@ -367,6 +378,9 @@ bool TypeSystem::fully_defined_type_exists(const TypeSpec& type) const {
 }
 
 bool TypeSystem::partially_defined_type_exists(const std::string& name) const {
+  if (s_type_use_recorder) {
+    s_type_use_recorder->insert(name);
+  }
   return m_forward_declared_types.find(name) != m_forward_declared_types.end();
 }
 
@@ -424,7 +438,7 @@ TypeSpec TypeSystem::make_inline_array_typespec(const TypeSpec& type) const {
  * lookup_type to find the most up-to-date type information.
  */
 Type* TypeSystem::lookup_type(const std::string& name) const {
-  auto kv = m_types.find(name);
+  auto kv = find_type(name);
   if (kv != m_types.end()) {
     return kv->second.get();
   }
@@ -455,7 +469,7 @@ Type* TypeSystem::lookup_type(const TypeSpec& ts) const {
  * Same as lookup_type, but returns null instead of throwing.
  */
 Type* TypeSystem::lookup_type_no_throw(const std::string& name) const {
-  auto kv = m_types.find(name);
+  auto kv = find_type(name);
   if (kv != m_types.end()) {
     return kv->second.get();
   }
@@ -484,7 +498,7 @@ Type* TypeSystem::lookup_type_allow_partial_def(const TypeSpec& ts) const {
  */
 Type* TypeSystem::lookup_type_allow_partial_def(const std::string& name) const {
   // look up fully defined types first:
-  auto kv = m_types.find(name);
+  auto kv = find_type(name);
   if (kv != m_types.end()) {
     return kv->second.get();
   }
@@ -504,7 +518,7 @@ Type* TypeSystem::lookup_type_allow_partial_def(const std::string& name) const {
     }
     current_name = fwd_dec->second;
 
-    auto type_lookup = m_types.find(current_name);
+    auto type_lookup = find_type(current_name);
     if (type_lookup != m_types.end()) {
       result = type_lookup->second.get();
     }
@@ -520,7 +534,7 @@ Type* TypeSystem::lookup_type_allow_partial_def(const std::string& name) const {
  * This should be safe to use to load a value from a field.
  */
 int TypeSystem::get_load_size_allow_partial_def(const TypeSpec& ts) const {
-  auto fully_defined_it = m_types.find(ts.base_type());
+  auto fully_defined_it = find_type(ts.base_type());
   if (fully_defined_it != m_types.end()) {
     return fully_defined_it->second->get_load_size();
   }
@@ -803,7 +817,7 @@ MethodInfo TypeSystem::lookup_method(const std::string& type_name,
 bool TypeSystem::try_lookup_method(const std::string& type_name,
                                    const std::string& method_name,
                                    MethodInfo* info) const {
-  auto kv = m_types.find(type_name);
+  auto kv = find_type(type_name);
   if (kv == m_types.end()) {
     // try to look up a forward declared type.
     auto fwd_dec_type = lookup_type_allow_partial_def(type_name);
@@ -823,7 +837,7 @@ bool TypeSystem::try_lookup_method(const std::string& type_name,
 bool TypeSystem::try_lookup_method(const std::string& type_name,
                                    int method_id,
                                    MethodInfo* info) const {
-  auto kv = m_types.find(type_name);
+  auto kv = find_type(type_name);
   if (kv == m_types.end()) {
     return false;
   }
@@ -1285,6 +1299,134 @@ std::string TypeSystem::print_all_type_information() const {
   return result;
 }
 
+namespace {
+enum class TypeKind : u8 { NONE, VALUE, BITFIELD, ENUM, STRUCTURE, BASIC };
+
+TypeKind get_type_kind(const Type* type) {
+  if (dynamic_cast<const EnumType*>(type)) {
+    return TypeKind::ENUM;
+  } else if (dynamic_cast<const BitFieldType*>(type)) {
+    return TypeKind::BITFIELD;
+  } else if (dynamic_cast<const ValueType*>(type)) {
+    return TypeKind::VALUE;
+  } else if (dynamic_cast<const BasicType*>(type)) {
+    return TypeKind::BASIC;
+  } else if (dynamic_cast<const StructureType*>(type)) {
+    return TypeKind::STRUCTURE;
+  } else if (dynamic_cast<const NullType*>(type)) {
+    return TypeKind::NONE;
+  }
+  ASSERT_NOT_REACHED_MSG(fmt::format("can't serialize type {}", type->get_name()));
+}
+
+/*!
+ * Make a type of the given kind, with nothing set. Type::serialize fills in the rest.
+ */
+std::unique_ptr<Type> make_empty_type(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::NONE:
+      return std::make_unique<NullType>("");
+    case TypeKind::VALUE:
+      return std::make_unique<ValueType>("", "", false, 0, false, RegClass::INVALID);
+    case TypeKind::BITFIELD:
+      return std::make_unique<BitFieldType>("", "", 0, false);
+    case TypeKind::ENUM: {
+      ValueType parent("", "", false, 0, false, RegClass::INVALID);
+      return std::make_unique<EnumType>(&parent, "", false, std::unordered_map<std::string, s64>());
+    }
+    case TypeKind::STRUCTURE:
+      return std::make_unique<StructureType>("", "", false, false, false, 0);
+    case TypeKind::BASIC:
+      return std::make_unique<BasicType>("", "", false, 0);
+    default:
+      ASSERT_NOT_REACHED();
+  }
+}
+}  // namespace
+
+void TypeSystem::serialize(Serializer& ser) {
+  if (ser.is_loading()) {
+    // keep the old types around, in case somebody still has a pointer to one.
+    for (auto& [name, type] : m_types) {
+      m_old_types.push_back(std::move(type));
+    }
+  }
+
+  ser.from_string_map(&m_types, [&](std::unique_ptr<Type>* type) {
+    TypeKind kind = ser.is_saving() ? get_type_kind(type->get()) : TypeKind::NONE;
+    ser.from_ptr(&kind);
+    if (ser.is_loading()) {
+      *type = make_empty_type(kind);
+    }
+    (*type)->serialize(ser);
+  });
+  ser.from_string_map(&m_forward_declared_types,
+                      [&](std::string* parent) { ser.from_str(parent); });
+  ser.from_string_map(&m_forward_declared_method_counts, [&](int* count) { ser.from_ptr(count); });
+
+  if (ser.is_loading()) {
+    rebuild_all_ancestors();
+  }
+}
+
+/*!
+ * Set up the ancestors of a type from its parent, which should already be set up.
+ */
+void TypeSystem::set_ancestors(Type* type) {
+  type->m_ancestors.clear();
+  if (type->has_parent()) {
+    auto parent = m_types.find(type->get_parent());
+    if (parent != m_types.end()) {
+      type->m_ancestors = parent->second->m_ancestors;
+    } else {
+      m_missing_parents.insert(type->get_parent());
+    }
+  }
+  type->m_ancestors.push_back(type);
+}
+
+/*!
+ * Set up the ancestors of every type, for when existing types have new parents.
+ */
+void TypeSystem::rebuild_all_ancestors() {
+  m_missing_parents.clear();
+  for (auto& [name, type] : m_types) {
+    type->m_ancestors.clear();
+  }
+
+  for (auto& [name, type] : m_types) {
+    // walk up to the first type that's already set up, then set up the types below it in order.
+    std::vector<Type*> pending;
+    Type* current = type.get();
+    while (current->m_ancestors.empty()) {
+      pending.push_back(current);
+      if (!current->has_parent()) {
+        break;
+      }
+      auto parent = m_types.find(current->get_parent());
+      if (parent == m_types.end()) {
+        break;
+      }
+      current = parent->second.get();
+    }
+    for (auto it = pending.rbegin(); it != pending.rend(); it++) {
+      set_ancestors(*it);
+    }
+  }
+}
+
+/*!
+ * Report the ancestors of a type to the type use recorder. Typechecks using the ancestors depend
+ * on each of them, even though they don't look them up by name.
+ */
+void TypeSystem::record_ancestors(const Type* type) const {
+  if (s_type_use_recorder) {
+    for (auto* ancestor : type->ancestors()) {
+      s_type_use_recorder->insert(ancestor->get_name());
+    }
+  }
+}
+
 /*!
  * Get the next free method ID of a type.
  */
@@ -1412,7 +1554,7 @@ int TypeSystem::get_size_in_type(const Field& field) const {
   }
 }
 
-std::vector<std::string> TypeSystem::get_all_type_names() {
+std::vector<std::string> TypeSystem::get_all_type_names() const {
   std::vector<std::string> results = {};
   for (const auto& [type_name, type_info] : m_types) {
     results.push_back(type_name);
@@ -1711,61 +1853,59 @@ bool TypeSystem::typecheck_and_throw(const TypeSpec& expected,
 bool TypeSystem::typecheck_base_types(const std::string& input_expected,
                                       const std::string& input_actual,
                                       bool allow_alias) const {
-  std::string expected = input_expected;
-  std::string actual = input_actual;
+  static const std::string float_name = "float";
+  static const std::string time_frame_name = "time-frame";
+  static const std::string int_name = "int";
+  const std::string* expected = &input_expected;
+  const std::string* actual = &input_actual;
 
   // the unit types aren't picky.
-  if (expected == "meters") {
-    expected = "float";
-  }
-
-  if (expected == "seconds") {
-    expected = "time-frame";
+  if (*expected == "meters" || *expected == "degrees") {
+    expected = &float_name;
   }
 
-  if (actual == "seconds") {
-    actual = "time-frame";
+  if (*expected == "seconds") {
+    expected = &time_frame_name;
   }
 
-  if (expected == "degrees") {
-    expected = "float";
+  if (*actual == "seconds") {
+    actual = &time_frame_name;
   }
 
   // the decompiler prefers no aliasing so it can detect casts properly
   if (allow_alias) {
-    if (expected == "time-frame") {
-      expected = "int";
+    if (*expected == "time-frame") {
+      expected = &int_name;
     }
 
-    if (actual == "time-frame") {
-      actual = "int";
+    if (*actual == "time-frame") {
+      actual = &int_name;
     }
   }
 
-  // just to make sure it exists.
-  lookup_type_allow_partial_def(expected);
+  // make sure both exist.
+  auto expected_type = lookup_type_allow_partial_def(*expected);
+  auto actual_type = lookup_type_allow_partial_def(*actual);
 
-  if (expected == actual || expected == lookup_type_allow_partial_def(actual)->get_name()) {
-    lookup_type_allow_partial_def(actual);  // make sure it exists
+  if (*expected == *actual) {
     return true;
   }
 
-  std::string actual_name = actual;
-  auto actual_type = lookup_type_allow_partial_def(actual_name);
-  while (actual_type->has_parent()) {
-    actual_name = actual_type->get_parent();
-    actual_type = lookup_type_allow_partial_def(actual_name);
-
-    if (expected == actual_name) {
-      return true;
-    }
+  if (expected_type->get_name() != *expected) {
+    // expected is only forward declared, so it can't be a parent of a defined type.
+    return false;
   }
 
-  return false;
+  // expected is a parent if it's at the same depth in actual's ancestors.
+  record_ancestors(actual_type);
+  const auto& actual_ancestors = actual_type->ancestors();
+  const size_t expected_depth = expected_type->ancestors().size();
+  return expected_depth <= actual_ancestors.size() &&
+         actual_ancestors[expected_depth - 1] == expected_type;
 }
 
 EnumType* TypeSystem::try_enum_lookup(const std::string& type_name) const {
-  auto it = m_types.find(type_name);
+  auto it = find_type(type_name);
   if (it != m_types.end()) {
     return dynamic_cast<EnumType*>(it->second.get());
   }
@@ -1802,6 +1942,22 @@ std::string TypeSystem::lca_base(const std::string& a, const std::string& b) con
     return a;
   }
 
+  auto a_it = find_type(a);
+  auto b_it = find_type(b);
+  if (a_it != m_types.end() && b_it != m_types.end()) {
+    record_ancestors(a_it->second.get());
+    record_ancestors(b_it->second.get());
+    const auto& a_anc = a_it->second->ancestors();
+    const auto& b_anc = b_it->second->ancestors();
+    size_t depth = 0;
+    while (depth < a_anc.size() && depth < b_anc.size() && a_anc[depth] == b_anc[depth]) {
+      depth++;
+    }
+    ASSERT(depth > 0);
+    return a_anc[depth - 1]->get_name();
+  }
+
+  // forward declared types don't have ancestors set up, so look up the path by name.
   auto a_up = get_path_up_tree(a);
   auto b_up = get_path_up_tree(b);
 
@@ -2436,7 +2592,7 @@ bool TypeSystem::should_use_virtual_methods(const Type* type, int method_id) con
 }
 
 bool TypeSystem::should_use_virtual_methods(const TypeSpec& type, int method_id) const {
-  auto it = m_types.find(type.base_type());
+  auto it = find_type(type.base_type());
   if (it != m_types.end()) {
     // it's a fully defined type
     return should_use_virtual_methods(it->second.get(), method_id);
@@ -13,6 +13,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Type.h"
@@ -228,6 +229,11 @@ class TypeSystem {
   void add_builtin_types(GameVersion version);
 
   std::string print_all_type_information() const;
+
+  /*!
+   * Save or load all types and forward declarations. Loading replaces the current types.
+   */
+  void serialize(Serializer& ser);
   bool typecheck_and_throw(const TypeSpec& expected,
                            const TypeSpec& actual,
                            const std::string& error_source_name = "",
@@ -274,7 +280,7 @@ class TypeSystem {
     m_types_allowed_to_be_redefined.push_back(type_name);
   }
 
-  std::vector<std::string> get_all_type_names();
+  std::vector<std::string> get_all_type_names() const;
   std::vector<std::string> search_types_by_parent_type(
       const std::string& parent_type,
       const std::optional<std::vector<std::string>>& existing_matches = {});
@@ -298,7 +304,26 @@ class TypeSystem {
       const std::vector<TypeSearchFieldInput>& search_fields,
       const std::optional<std::vector<std::string>>& existing_matches = {});
 
+  /*!
+   * While a recorder is set, the name of every type looked up on this thread is added to it.
+   * The decompiler uses this to find which type definitions its output depends on.
+   * Returns the recorder that was set before.
+   */
+  static std::unordered_set<std::string>* set_type_use_recorder(
+      std::unordered_set<std::string>* recorder) {
+    return std::exchange(s_type_use_recorder, recorder);
+  }
+
  private:
+  std::unordered_map<std::string, std::unique_ptr<Type>>::const_iterator find_type(
+      const std::string& name) const {
+    if (s_type_use_recorder) {
+      s_type_use_recorder->insert(name);
+    }
+    return m_types.find(name);
+  }
+  static thread_local std::unordered_set<std::string>* s_type_use_recorder;
+
   std::string lca_base(const std::string& a, const std::string& b) const;
   bool typecheck_base_types(const std::string& expected,
                             const std::string& actual,
@@ -316,12 +341,17 @@ class TypeSystem {
                                     bool sign_extend = false,
                                     RegClass reg = RegClass::GPR_64);
   void builtin_structure_inherit(StructureType* st);
+  void set_ancestors(Type* type);
+  void rebuild_all_ancestors();
+  void record_ancestors(const Type* type) const;
 
   std::unordered_map<std::string, std::unique_ptr<Type>> m_types;
   std::unordered_map<std::string, std::string> m_forward_declared_types;
   std::unordered_map<std::string, int> m_forward_declared_method_counts;
 
   std::vector<std::unique_ptr<Type>> m_old_types;
+  // parents that weren't defined when a child was added. Defining one rebuilds all ancestors.
+  std::unordered_set<std::string> m_missing_parents;
 
   std::vector<std::string> m_types_allowed_to_be_redefined;
   bool m_allow_redefinition = false;
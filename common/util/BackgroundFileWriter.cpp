@@ -0,0 +1,88 @@
+#include "BackgroundFileWriter.h"
+
+#include "common/log/log.h"
+#include "common/util/Timer.h"
+
+BackgroundFileWriter::~BackgroundFileWriter() {
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    m_stop = true;
+  }
+  m_work_cv.notify_one();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+void BackgroundFileWriter::write(const fs::path& path, std::vector<u8> data) {
+  auto shared = std::make_shared<const std::vector<u8>>(std::move(data));
+  std::lock_guard<std::mutex> lk(m_mutex);
+  // started on the first write, so tools that never write don't get a thread.
+  if (!m_thread.joinable()) {
+    m_thread = std::thread([this]() { worker(); });
+  }
+  for (auto& queued : m_queue) {
+    if (queued.path == path) {
+      // not started yet, just write the new data instead.
+      queued.data = std::move(shared);
+      return;
+    }
+  }
+  m_queue.push_back({path, std::move(shared)});
+  m_work_cv.notify_one();
+}
+
+void BackgroundFileWriter::write_text(const fs::path& path, const std::string& text) {
+  std::vector<u8> data(text.begin(), text.end());
+  data.push_back('\n');
+  write(path, std::move(data));
+}
+
+std::shared_ptr<const std::vector<u8>> BackgroundFileWriter::pending(const fs::path& path) {
+  std::lock_guard<std::mutex> lk(m_mutex);
+  for (auto& queued : m_queue) {
+    if (queued.path == path) {
+      return queued.data;
+    }
+  }
+  if (m_in_progress && m_in_progress->path == path) {
+    return m_in_progress->data;
+  }
+  return nullptr;
+}
+
+void BackgroundFileWriter::flush() {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  m_done_cv.wait(lk, [&]() { return m_queue.empty() && !m_in_progress; });
+}
+
+void BackgroundFileWriter::worker() {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  while (true) {
+    // finish the writes before stopping.
+    m_work_cv.wait(lk, [&]() { return m_stop || !m_queue.empty(); });
+    if (m_queue.empty()) {
+      return;
+    }
+    m_in_progress = std::move(m_queue.front());
+    m_queue.erase(m_queue.begin());
+    const auto& write = *m_in_progress;
+    lk.unlock();
+    Timer timer;
+    if (file_util::write_binary_file_atomic(write.path, write.data->data(), write.data->size())) {
+      lg::debug("Wrote {} in background in {:.2f} ms", write.path.string(), timer.getMs());
+    } else {
+      lg::error("Failed to write {}", write.path.string());
+    }
+    lk.lock();
+    m_in_progress.reset();
+    if (m_queue.empty()) {
+      m_done_cv.notify_all();
+    }
+  }
+}
+
+BackgroundFileWriter& background_file_writer() {
+  static BackgroundFileWriter writer;
+  return writer;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
+/*!
+ * Writes files on a worker thread, so the caller doesn't wait for slow storage. Each file is
+ * replaced atomically (see file_util::write_binary_file_atomic), so a crash leaves either the old
+ * or the new file. If a file is written again before the last write started, only the newest data
+ * is written.
+ */
+class BackgroundFileWriter {
+ public:
+  BackgroundFileWriter() = default;
+  // finishes all the writes.
+  ~BackgroundFileWriter();
+  BackgroundFileWriter(const BackgroundFileWriter&) = delete;
+  BackgroundFileWriter& operator=(const BackgroundFileWriter&) = delete;
+
+  void write(const fs::path& path, std::vector<u8> data);
+  // like file_util::write_text_file, with a newline after the text.
+  void write_text(const fs::path& path, const std::string& text);
+
+  // The data that will be in the file, if it's still being written. Lets readers see the newest
+  // data without waiting.
+  std::shared_ptr<const std::vector<u8>> pending(const fs::path& path);
+
+  // wait until everything written so far is in the files.
+  void flush();
+
+ private:
+  struct Write {
+    fs::path path;
+    std::shared_ptr<const std::vector<u8>> data;
+  };
+  void worker();
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_done_cv;
+  std::thread m_thread;
+  bool m_stop = false;
+  std::vector<Write> m_queue;  // in the order they were first written
+  std::optional<Write> m_in_progress;
+};
+
+// the writer for saves and settings.
+BackgroundFileWriter& background_file_writer();
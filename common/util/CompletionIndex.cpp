@@ -0,0 +1,290 @@
+#include "CompletionIndex.h"
+
+#include <algorithm>
+
+#include "common/util/Assert.h"
+
+namespace {
+char to_lower(char c) {
+  return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+u64 char_bit(char c) {
+  c = to_lower(c);
+  if (c >= 'a' && c <= 'z') {
+    return 1ull << (c - 'a');
+  }
+  if (c >= '0' && c <= '9') {
+    return 1ull << (26 + c - '0');
+  }
+  // everything else shares the remaining bits, which only makes the filter less strict.
+  return 1ull << (36 + (u8)c % 28);
+}
+
+u64 char_mask(std::string_view str) {
+  u64 mask = 0;
+  for (char c : str) {
+    mask |= char_bit(c);
+  }
+  return mask;
+}
+
+bool is_word_start(std::string_view name, size_t idx) {
+  if (idx == 0) {
+    return true;
+  }
+  switch (name[idx - 1]) {
+    case '-':
+    case '_':
+    case '*':
+    case '/':
+    case ':':
+    case '!':
+    case '?':
+    case '>':
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Scores for each matched character of a fuzzy search.
+constexpr int kMatchScore = 16;
+constexpr int kNameStartBonus = 24;
+constexpr int kWordStartBonus = 12;
+constexpr int kConsecutiveBonus = 16;
+constexpr int kMaxGapPenalty = 8;
+constexpr int kExactBonus = 32;
+
+/*!
+ * Score a lowercase name against a lowercase query, or -1 if the query isn't a subsequence of the
+ * name. Each character is matched to its first occurrence after the previous one.
+ */
+int fuzzy_score(std::string_view name, std::string_view query) {
+  int score = 0;
+  int prev = -2;
+  size_t pos = 0;
+  for (char q : query) {
+    while (pos < name.size() && name[pos] != q) {
+      pos++;
+    }
+    if (pos == name.size()) {
+      return -1;
+    }
+    int idx = pos;
+    score += kMatchScore;
+    if (idx == 0) {
+      score += kNameStartBonus;
+    } else if (is_word_start(name, idx)) {
+      score += kWordStartBonus;
+    }
+    if (idx == prev + 1) {
+      score += kConsecutiveBonus;
+    } else if (prev >= 0) {
+      score -= std::min(idx - prev - 1, kMaxGapPenalty);
+    }
+    prev = idx;
+    pos++;
+  }
+  if (name.size() == query.size()) {
+    score += kExactBonus;
+  }
+  return score;
+}
+
+/*!
+ * The best score a name can get for the query, if the name doesn't start with the query.
+ * If first_char_at_start, the name starts with the first character of the query.
+ */
+int fuzzy_score_bound(std::string_view query, bool first_char_at_start) {
+  int score = kMatchScore + (first_char_at_start ? kNameStartBonus : kWordStartBonus);
+  // the best a character can do without following the previous one
+  constexpr int not_consecutive = kMatchScore + kWordStartBonus - 1;
+  int smallest_loss = INT32_MAX;
+  for (size_t i = 1; i < query.size(); i++) {
+    // a character can only be both at a word start and right after the previous one if the
+    // previous one is the end of a word.
+    int best = kMatchScore + kConsecutiveBonus + (is_word_start(query, i) ? kWordStartBonus : 0);
+    score += best;
+    smallest_loss = std::min(smallest_loss, best - not_consecutive);
+  }
+  if (first_char_at_start) {
+    // when the first character is at the start, one of the others can't be consecutive, or it
+    // would start with the query.
+    score -= query.size() > 1 ? smallest_loss : 0;
+  }
+  return score;
+}
+
+struct Match {
+  int score;
+  int length;
+  int idx;
+  // best first
+  bool operator<(const Match& other) const {
+    if (score != other.score) {
+      return score > other.score;
+    }
+    if (length != other.length) {
+      return length < other.length;
+    }
+    return idx < other.idx;
+  }
+};
+}  // namespace
+
+CompletionIndex::CompletionIndex(std::vector<std::string> names) {
+  std::sort(names.begin(), names.end());
+  names.erase(std::unique(names.begin(), names.end()), names.end());
+  size_t total_size = 0;
+  for (const auto& name : names) {
+    total_size += name.size();
+  }
+  ASSERT(total_size < UINT32_MAX);
+  m_chars.reserve(total_size);
+  m_offsets.reserve(names.size() + 1);
+  for (const auto& name : names) {
+    m_offsets.push_back(m_chars.size());
+    m_chars += name;
+  }
+  m_offsets.push_back(m_chars.size());
+
+  // the fuzzy search data is in lowercase order, so the searches can go through it in order.
+  std::vector<std::string> lower(names.size());
+  for (size_t i = 0; i < names.size(); i++) {
+    for (char c : names[i]) {
+      lower[i].push_back(to_lower(c));
+    }
+  }
+  m_lower_order.resize(names.size());
+  for (size_t i = 0; i < names.size(); i++) {
+    m_lower_order[i] = i;
+  }
+  std::stable_sort(m_lower_order.begin(), m_lower_order.end(),
+                   [&](s32 a, s32 b) { return lower[a] < lower[b]; });
+  m_lower_chars.reserve(total_size);
+  m_lower_offsets.reserve(names.size() + 1);
+  m_masks.reserve(names.size());
+  for (s32 idx : m_lower_order) {
+    m_lower_offsets.push_back(m_lower_chars.size());
+    m_lower_chars += lower[idx];
+    m_masks.push_back(char_mask(lower[idx]));
+  }
+  m_lower_offsets.push_back(m_lower_chars.size());
+}
+
+int CompletionIndex::lower_bound(std::string_view key) const {
+  int lo = 0;
+  int hi = size();
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (name(mid) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+int CompletionIndex::lower_bound_lowercase(std::string_view key) const {
+  int lo = 0;
+  int hi = size();
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (lower_name(mid) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+std::vector<std::string> CompletionIndex::with_prefix(const std::string& prefix,
+                                                      int max_count) const {
+  std::vector<std::string> result;
+  for (int i = lower_bound(prefix); i < size(); i++) {
+    if (max_count >= 0 && (int)result.size() >= max_count) {
+      break;
+    }
+    auto n = name(i);
+    if (n.substr(0, prefix.size()) != prefix) {
+      break;
+    }
+    result.emplace_back(n);
+  }
+  return result;
+}
+
+std::vector<std::string> CompletionIndex::fuzzy(const std::string& query, int max_count) const {
+  std::vector<std::string> result;
+  if (max_count <= 0 || query.empty()) {
+    return result;
+  }
+  std::string lower_query;
+  for (char c : query) {
+    lower_query.push_back(to_lower(c));
+  }
+  const u64 query_mask = char_mask(lower_query);
+
+  // heap of the best max_count so far, with the worst of them on top.
+  std::vector<Match> best;
+  // pos is in the lowercase order
+  auto consider = [&](int pos) {
+    if ((m_masks[pos] & query_mask) != query_mask) {
+      return;
+    }
+    auto lower = lower_name(pos);
+    int score = fuzzy_score(lower, lower_query);
+    if (score < 0) {
+      return;
+    }
+    Match match{score, (int)lower.size(), pos};
+    if ((int)best.size() < max_count) {
+      best.push_back(match);
+      std::push_heap(best.begin(), best.end());
+    } else if (match < best.front()) {
+      std::pop_heap(best.begin(), best.end());
+      best.back() = match;
+      std::push_heap(best.begin(), best.end());
+    }
+  };
+  // once we have max_count matches better than anything left could be, we can stop.
+  auto can_skip = [&](int bound) {
+    return (int)best.size() == max_count && best.front().score > bound;
+  };
+
+  // Names starting with the query score best, then names starting with its first character. Both
+  // are ranges of the names in lowercase order, so look at those first.
+  int first_begin = lower_bound_lowercase(lower_query.substr(0, 1));
+  int first_end = lower_bound_lowercase(std::string(1, lower_query[0] + 1));
+  int prefix_begin = lower_bound_lowercase(lower_query);
+  int prefix_end = prefix_begin;
+  while (prefix_end < first_end &&
+         lower_name(prefix_end).substr(0, lower_query.size()) == lower_query) {
+    prefix_end++;
+  }
+  // consider the names in [begin, end) that aren't in [skip_begin, skip_end)
+  auto consider_range = [&](int begin, int end, int skip_begin, int skip_end) {
+    for (int pos = begin; pos < skip_begin; pos++) {
+      consider(pos);
+    }
+    for (int pos = skip_end; pos < end; pos++) {
+      consider(pos);
+    }
+  };
+  consider_range(prefix_begin, prefix_end, prefix_end, prefix_end);
+  if (!can_skip(fuzzy_score_bound(lower_query, true))) {
+    consider_range(first_begin, first_end, prefix_begin, prefix_end);
+  }
+  if (!can_skip(fuzzy_score_bound(lower_query, false))) {
+    consider_range(0, size(), first_begin, first_end);
+  }
+
+  std::sort_heap(best.begin(), best.end());
+  for (const auto& match : best) {
+    result.emplace_back(name(m_lower_order[match.idx]));
+  }
+  return result;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/common_types.h"
+
+/*!
+ * A read-only index of names for auto-completion. The names are sorted and packed into one string,
+ * so a prefix lookup is a binary search. A fuzzy lookup first scores the names that start with the
+ * query, and stops there if nothing else could rank higher. Otherwise it scans one 64-bit character
+ * mask per name, and only scores the names that contain every character of the query.
+ *
+ * It can't be modified, build a new one when the names change.
+ */
+class CompletionIndex {
+ public:
+  CompletionIndex() = default;
+  // duplicate names are only stored once.
+  explicit CompletionIndex(std::vector<std::string> names);
+
+  int size() const { return (int)m_lower_order.size(); }
+
+  // Names starting with the prefix, sorted. If max_count is not -1, only the first max_count.
+  std::vector<std::string> with_prefix(const std::string& prefix, int max_count = -1) const;
+
+  /*!
+   * The best max_count names that contain the characters of the query in order (like "cmrot" for
+   * "camera-rotate"), best first. Matches at the start of the name or of a word, and runs of
+   * consecutive characters score higher. Case is ignored.
+   */
+  std::vector<std::string> fuzzy(const std::string& query, int max_count) const;
+
+ private:
+  std::string_view name(int idx) const {
+    return std::string_view(m_chars).substr(m_offsets[idx], m_offsets[idx + 1] - m_offsets[idx]);
+  }
+  // pos is in m_lower_order
+  std::string_view lower_name(int pos) const {
+    return std::string_view(m_lower_chars)
+        .substr(m_lower_offsets[pos], m_lower_offsets[pos + 1] - m_lower_offsets[pos]);
+  }
+  int lower_bound(std::string_view key) const;
+  int lower_bound_lowercase(std::string_view key) const;
+
+  std::string m_chars;         // all names, sorted, back to back
+  std::vector<u32> m_offsets;  // start of each name in m_chars, plus the end of the last
+
+  // for fuzzy searches, the names in lowercase and sorted that way
+  std::vector<s32> m_lower_order;  // index of each name in m_offsets
+  std::string m_lower_chars;
+  std::vector<u32> m_lower_offsets;
+  std::vector<u64> m_masks;  // the characters used in each name
+};
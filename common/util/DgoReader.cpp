@@ -13,8 +13,26 @@
 
 #include "third-party/json.hpp"
 
-DgoReader::DgoReader(std::string file_name, const std::vector<u8>& data)
-    : m_file_name(std::move(file_name)) {
+DgoReader::DgoReader(std::string file_name, std::vector<u8> data)
+    : m_owned_data(std::move(data)), m_file_name(std::move(file_name)) {
+  read_entries(m_owned_data);
+}
+
+DgoReader::DgoReader(const fs::path& path)
+    : m_mapped_file(std::make_unique<MappedFile>(path)),
+      m_file_name(file_util::base_name(path.string())) {
+  std::span<const u8> data(m_mapped_file->data(), m_mapped_file->size());
+  if (data.size() >= 4 && memcmp(data.data(), "oZlB", 4) == 0) {
+    // the entries have to point at the decompressed data, so this one can't be a view.
+    m_owned_data = file_util::decompress_dgo(std::vector<u8>(data.begin(), data.end()));
+    m_mapped_file.reset();
+    m_was_compressed = true;
+    data = m_owned_data;
+  }
+  read_entries(data);
+}
+
+void DgoReader::read_entries(std::span<const u8> data) {
   BinaryReader reader(data);
   auto header = reader.read<DgoHeader>();
   m_internal_name = header.name;
@@ -47,11 +65,10 @@ DgoReader::DgoReader(std::string file_name, const std::vector<u8>& data)
     }
 
     all_unique_names.insert(entry.unique_name);
-    entry.data.resize(obj_header.size);
 
     ASSERT((reader.get_seek() % 16) == 0);
-    memcpy(entry.data.data(), reader.here(), obj_header.size);
-    m_entries.push_back(entry);
+    entry.data = data.subspan(reader.get_seek(), obj_header.size);
+    m_entries.push_back(std::move(entry));
 
     reader.ffwd(align16(obj_header.size));
   }
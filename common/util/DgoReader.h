@@ -1,23 +1,46 @@
 #pragma once
 
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/util/FileUtil.h"
+#include "common/util/MappedFile.h"
 
 struct DgoDataEntry {
-  std::vector<u8> data;
+  // points into the data owned by the DgoReader, valid for as long as the reader is.
+  std::span<const u8> data;
   std::string internal_name;
   std::string unique_name;
 };
 
+/*!
+ * Splits a DGO into its object files. The entries are views of the DGO data, not copies.
+ */
 class DgoReader {
  public:
-  DgoReader(std::string file_name, const std::vector<u8>& data);
-  const std::vector<DgoDataEntry> entries() const { return m_entries; }
+  DgoReader(std::string file_name, std::vector<u8> data);
+  /*!
+   * Memory map a DGO file. Compressed DGOs are decompressed into memory instead.
+   */
+  explicit DgoReader(const fs::path& path);
+  DgoReader(const DgoReader&) = delete;
+  DgoReader& operator=(const DgoReader&) = delete;
+  DgoReader(DgoReader&&) = default;
+  DgoReader& operator=(DgoReader&&) = default;
+
+  const std::vector<DgoDataEntry>& entries() const { return m_entries; }
   std::string description_as_json() const;
+  bool was_compressed() const { return m_was_compressed; }
 
  private:
+  void read_entries(std::span<const u8> data);
+
+  std::unique_ptr<MappedFile> m_mapped_file;
+  std::vector<u8> m_owned_data;
   std::vector<DgoDataEntry> m_entries;
   std::string m_internal_name, m_file_name;
-};
\ No newline at end of file
+  bool m_was_compressed = false;
+};
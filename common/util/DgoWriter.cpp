@@ -5,41 +5,97 @@
 
 #include "DgoWriter.h"
 
-#include "BinaryWriter.h"
-#include "FileUtil.h"
+#include <cstring>
+#include <stdexcept>
+
+#include "BitUtils.h"
+#include "MappedFile.h"
 
 #include "common/log/log.h"
 
-void build_dgo(const DgoDescription& description, const std::string& output_prefix) {
-  BinaryWriter writer;
-  // dgo header
-  writer.add<uint32_t>(description.entries.size());
-  writer.add_cstr_len(description.dgo_name.c_str(), 60);
+#include "fmt/core.h"
 
+void build_dgo(const DgoDescription& description, const std::string& output_prefix) {
+  // skip missing files first, the object count in the header has to match what we write.
+  std::vector<std::pair<const DgoDescription::DgoEntry*, fs::path>> objects;
   for (auto& obj : description.entries) {
-    // Ensure the directory exists
     const auto file_path =
         file_util::get_jak_project_dir() / "out" / output_prefix / "obj" / obj.file_name;
     if (!file_util::file_exists(file_path.string())) {
       lg::warn("tried to build a DGO with a file that doesn't exist: {}", file_path.string());
       continue;
     }
-    auto obj_data = file_util::read_binary_file(file_path);
-    // size
-    writer.add<uint32_t>(obj_data.size());
-    // name
-    writer.add_str_len(obj.name_in_dgo, 60);
-    // data
-    writer.add_data(obj_data.data(), obj_data.size());
-    // pad
-    while (writer.get_size() & 0xf) {
-      writer.add<uint8_t>(0);
-    }
+    objects.emplace_back(&obj, file_path);
   }
 
   // Ensure the output directory exists
   const auto dgo_path =
       file_util::get_jak_project_dir() / "out" / output_prefix / "iso" / description.dgo_name;
   file_util::create_dir_if_needed_for_file(dgo_path);
-  writer.write_to_file(dgo_path);
+  DgoFileWriter writer(dgo_path, description.dgo_name, objects.size());
+  for (auto& [obj, file_path] : objects) {
+    writer.add_object_file(obj->name_in_dgo, file_path, false);
+  }
+  writer.finish();
+}
+
+DgoFileWriter::DgoFileWriter(const fs::path& path, const std::string& dgo_name, u32 object_count)
+    : m_path(path), m_object_count(object_count) {
+  m_fp = file_util::open_file(path, "wb");
+  if (!m_fp) {
+    throw std::runtime_error("failed to open " + path.string());
+  }
+  char name[60] = {};
+  ASSERT(dgo_name.length() < sizeof(name));
+  memcpy(name, dgo_name.data(), dgo_name.length());
+  write(&object_count, sizeof(u32));
+  write(name, sizeof(name));
+}
+
+DgoFileWriter::~DgoFileWriter() {
+  if (m_fp) {
+    fclose(m_fp);
+  }
+}
+
+void DgoFileWriter::add_object(const std::string& name_in_dgo,
+                               const u8* data,
+                               size_t size,
+                               bool align_size) {
+  ASSERT(m_objects_written < m_object_count);
+  u32 header_size = align_size ? align16(size) : size;
+  char name[60] = {};
+  ASSERT(name_in_dgo.length() < sizeof(name));
+  memcpy(name, name_in_dgo.data(), name_in_dgo.length());
+  write(&header_size, sizeof(u32));
+  write(name, sizeof(name));
+  write(data, size);
+  const u8 padding[16] = {};
+  write(padding, align16(m_offset) - m_offset);
+  m_objects_written++;
+}
+
+void DgoFileWriter::add_object_file(const std::string& name_in_dgo,
+                                    const fs::path& obj_path,
+                                    bool align_size) {
+  MappedFile obj(obj_path);
+  add_object(name_in_dgo, obj.data(), obj.size(), align_size);
+}
+
+void DgoFileWriter::finish() {
+  ASSERT_MSG(m_objects_written == m_object_count,
+             fmt::format("DGO {} has {} objects, but {} were written", m_path.string(),
+                         m_object_count, m_objects_written));
+  if (fclose(m_fp) != 0) {
+    m_fp = nullptr;
+    throw std::runtime_error("failed to write " + m_path.string());
+  }
+  m_fp = nullptr;
+}
+
+void DgoFileWriter::write(const void* data, size_t size) {
+  if (size && fwrite(data, size, 1, m_fp) != 1) {
+    throw std::runtime_error("failed to write " + m_path.string());
+  }
+  m_offset += size;
 }
@@ -5,9 +5,13 @@
  * Create a DGO from existing files.
  */
 
+#include <cstdio>
 #include <string>
 #include <vector>
 
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
 struct DgoDescription {
   std::string dgo_name;
   struct DgoEntry {
@@ -18,3 +22,40 @@ struct DgoDescription {
 };
 
 void build_dgo(const DgoDescription& description, const std::string& output_prefix);
+
+/*!
+ * Writes a DGO straight to disk, one object at a time, so the whole DGO is never in memory.
+ * The object count goes in the header, so it must be known up front.
+ */
+class DgoFileWriter {
+ public:
+  DgoFileWriter(const fs::path& path, const std::string& dgo_name, u32 object_count);
+  ~DgoFileWriter();
+  DgoFileWriter(const DgoFileWriter&) = delete;
+  DgoFileWriter& operator=(const DgoFileWriter&) = delete;
+
+  /*!
+   * Add the next object. If align_size is set, the size in the object header is rounded up to 16
+   * bytes, like the DGOs on the disc.
+   */
+  void add_object(const std::string& name_in_dgo, const u8* data, size_t size, bool align_size);
+
+  /*!
+   * Map the file at obj_path and add it as the next object.
+   */
+  void add_object_file(const std::string& name_in_dgo, const fs::path& obj_path, bool align_size);
+
+  /*!
+   * Check that every object was added and close the file.
+   */
+  void finish();
+
+ private:
+  void write(const void* data, size_t size);
+
+  fs::path m_path;
+  FILE* m_fp = nullptr;
+  u32 m_object_count = 0;
+  u32 m_objects_written = 0;
+  size_t m_offset = 0;
+};
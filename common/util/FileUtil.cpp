@@ -31,6 +31,7 @@
 #define NOMINMAX
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
+#include <io.h>
 #else
 #include <cstring>
 #include <unistd.h>
@@ -329,6 +330,36 @@ void write_binary_file(const std::string& name, const void* data, size_t size) {
   write_binary_file(fs::path(name), data, size);
 }
 
+bool write_binary_file_atomic(const fs::path& name, const void* data, size_t size) {
+  auto temp_name = name;
+  temp_name += ".tmp";
+  std::error_code ec;
+  if (!name.parent_path().empty()) {
+    fs::create_directories(name.parent_path(), ec);
+  }
+  FILE* fp = file_util::open_file(temp_name, "wb");
+  if (!fp) {
+    return false;
+  }
+  bool ok = size == 0 || fwrite(data, size, 1, fp) == 1;
+  // make sure the data is on the disk before the rename can be.
+  ok = ok && fflush(fp) == 0;
+#ifdef _WIN32
+  ok = ok && _commit(_fileno(fp)) == 0;
+#else
+  ok = ok && fsync(fileno(fp)) == 0;
+#endif
+  ok = fclose(fp) == 0 && ok;
+  if (ok) {
+    fs::rename(temp_name, name, ec);
+    ok = !ec;
+  }
+  if (!ok) {
+    fs::remove(temp_name, ec);
+  }
+  return ok;
+}
+
 void write_rgba_png(const fs::path& name, void* data, int w, int h) {
   auto flags = 0;
 
@@ -339,6 +370,14 @@ void write_rgba_png(const fs::path& name, void* data, int w, int h) {
   }
 }
 
+std::vector<u8> encode_rgba_png(const void* data, int w, int h) {
+  std::vector<u8> result;
+  if (!fpng::fpng_encode_image_to_memory(data, w, h, 4, result)) {
+    throw std::runtime_error("couldn't encode png");
+  }
+  return result;
+}
+
 void write_text_file(const std::string& file_name, const std::string& text) {
   write_text_file(fs::path(file_name), text);
 }
@@ -396,6 +435,8 @@ std::vector<uint8_t> read_binary_file(const fs::path& path) {
 }
 
 std::string read_text_file(const fs::path& path) {
+#ifdef _WIN32
+  // text mode converts the line endings.
   fs::ifstream file(path);
   if (!file.good()) {
     throw std::runtime_error("couldn't open " + path.string());
@@ -403,6 +444,32 @@ std::string read_text_file(const fs::path& path) {
   std::stringstream ss;
   ss << file.rdbuf();
   return ss.str();
+#else
+  // text and binary mode are the same here, so read it straight into the string, without the
+  // copies through a stringstream.
+  auto fp = file_util::open_file(path, "rb");
+  if (!fp) {
+    throw std::runtime_error("couldn't open " + path.string());
+  }
+  // the size is only a guess (it's 0 for some special files), keep reading until the end.
+  std::error_code ec;
+  const auto file_size = fs::file_size(path, ec);
+  // one extra byte, to see the end of the file in the first read.
+  size_t capacity = ec ? 4096 : file_size + 1;
+  std::string result;
+  size_t size = 0;
+  while (true) {
+    result.resize(capacity);
+    size += fread(result.data() + size, 1, capacity - size, fp);
+    if (size < capacity) {
+      break;
+    }
+    capacity *= 2;
+  }
+  result.resize(size);
+  fclose(fp);
+  return result;
+#endif
 }
 
 std::string read_text_file(const std::string& path) {
@@ -49,7 +49,10 @@ void override_user_config_dir(fs::path user_config_dir_override,
 std::string get_file_path(const std::vector<std::string>& path);
 void write_binary_file(const std::string& name, const void* data, size_t size);
 void write_binary_file(const fs::path& name, const void* data, size_t size);
+// Write to a temporary file, then rename it over the file, so the file is never partially written.
+bool write_binary_file_atomic(const fs::path& name, const void* data, size_t size);
 void write_rgba_png(const fs::path& name, void* data, int w, int h);
+std::vector<u8> encode_rgba_png(const void* data, int w, int h);
 void write_text_file(const std::string& file_name, const std::string& text);
 void write_text_file(const fs::path& file_name, const std::string& text);
 std::vector<uint8_t> read_binary_file(const std::string& filename);
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/util/Assert.h"
+
+namespace cu {
+/*!
+ * A replacement for std::unordered_map that keeps its entries in a single array, with open
+ * addressing and linear probing. A lookup is usually one cache miss, and inserting doesn't
+ * allocate a node for each entry. It's meant for maps that are built and searched often, like the
+ * compiler's environments.
+ *
+ * The hash is mixed before it's used, so hashes with poor low bits (like pointers) are fine.
+ *
+ * Differences from std::unordered_map:
+ *  - inserting can move all the entries, which invalidates pointers, references and iterators.
+ *  - erasing moves entries too (backward shift deletion), which invalidates iterators.
+ *  - the entries are std::pair<Key, Value>. Don't modify the key.
+ *  - "at" asserts instead of throwing if the key is missing.
+ *  - no custom allocators, no buckets interface.
+ */
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class FlatHashMap {
+ public:
+  using value_type = std::pair<Key, Value>;
+
+  template <bool is_const>
+  class Iterator {
+   public:
+    using map_type = std::conditional_t<is_const, const FlatHashMap, FlatHashMap>;
+    using entry_type = std::conditional_t<is_const, const value_type, value_type>;
+
+    Iterator(map_type* map, std::size_t idx) : m_map(map), m_idx(idx) { skip_unused(); }
+    // iterator to const_iterator
+    template <bool other_const, typename = std::enable_if_t<is_const && !other_const>>
+    Iterator(const Iterator<other_const>& other) : m_map(other.m_map), m_idx(other.m_idx) {}
+
+    entry_type& operator*() const { return m_map->m_slots[m_idx]; }
+    entry_type* operator->() const { return &m_map->m_slots[m_idx]; }
+    Iterator& operator++() {
+      m_idx++;
+      skip_unused();
+      return *this;
+    }
+    bool operator==(const Iterator& other) const { return m_idx == other.m_idx; }
+    bool operator!=(const Iterator& other) const { return m_idx != other.m_idx; }
+
+   private:
+    friend class FlatHashMap;
+    template <bool>
+    friend class Iterator;
+    void skip_unused() {
+      while (m_idx < m_map->m_capacity && !m_map->m_used[m_idx]) {
+        m_idx++;
+      }
+    }
+    map_type* m_map;
+    std::size_t m_idx;
+  };
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  FlatHashMap() = default;
+  FlatHashMap(const FlatHashMap& other) { *this = other; }
+  FlatHashMap(FlatHashMap&& other) noexcept { swap(other); }
+  FlatHashMap& operator=(const FlatHashMap& other) {
+    if (this != &other) {
+      clear();
+      reserve(other.m_size);
+      for (const auto& entry : other) {
+        try_emplace(entry.first, entry.second);
+      }
+    }
+    return *this;
+  }
+  FlatHashMap& operator=(FlatHashMap&& other) noexcept {
+    if (this != &other) {
+      FlatHashMap tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+  ~FlatHashMap() { free_storage(); }
+
+  void swap(FlatHashMap& other) noexcept {
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_used, other.m_used);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_shift, other.m_shift);
+    std::swap(m_size, other.m_size);
+  }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, m_capacity); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, m_capacity); }
+
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+  iterator find(const Key& key) { return iterator(this, find_index(key)); }
+  const_iterator find(const Key& key) const { return const_iterator(this, find_index(key)); }
+  bool contains(const Key& key) const { return find_index(key) != m_capacity; }
+  std::size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  Value& at(const Key& key) {
+    auto idx = find_index(key);
+    ASSERT(idx != m_capacity);
+    return m_slots[idx].second;
+  }
+  const Value& at(const Key& key) const {
+    auto idx = find_index(key);
+    ASSERT(idx != m_capacity);
+    return m_slots[idx].second;
+  }
+
+  /*!
+   * Add key with a Value constructed from args, if key isn't already in the map.
+   */
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    if ((m_size + 1) * 4 > m_capacity * 3) {
+      rehash(m_capacity ? m_capacity * 2 : kMinCapacity);
+    }
+    std::size_t idx = ideal_index(key);
+    while (m_used[idx]) {
+      if (Equal()(m_slots[idx].first, key)) {
+        return {iterator(this, idx), false};
+      }
+      idx = (idx + 1) & (m_capacity - 1);
+    }
+    new (m_slots + idx) value_type(std::piecewise_construct,
+                                   std::forward_as_tuple(std::forward<K>(key)),
+                                   std::forward_as_tuple(std::forward<Args>(args)...));
+    m_used[idx] = 1;
+    m_size++;
+    return {iterator(this, idx), true};
+  }
+
+  std::pair<iterator, bool> insert(value_type entry) {
+    return try_emplace(std::move(entry.first), std::move(entry.second));
+  }
+
+  Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+  Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+  /*!
+   * Remove key, if it's in the map. Returns the number of entries removed.
+   */
+  std::size_t erase(const Key& key) {
+    std::size_t hole = find_index(key);
+    if (hole == m_capacity) {
+      return 0;
+    }
+    m_slots[hole].~value_type();
+    m_size--;
+    // move back the following entries that would have been in the hole, so lookups don't need
+    // tombstones.
+    std::size_t idx = hole;
+    while (true) {
+      idx = (idx + 1) & (m_capacity - 1);
+      if (!m_used[idx]) {
+        break;
+      }
+      // distance from its ideal slot, compared to the distance of the hole from that slot.
+      const std::size_t ideal = ideal_index(m_slots[idx].first);
+      if (((idx - ideal) & (m_capacity - 1)) >= ((hole - ideal) & (m_capacity - 1))) {
+        new (m_slots + hole) value_type(std::move(m_slots[idx]));
+        m_slots[idx].~value_type();
+        hole = idx;
+      }
+    }
+    m_used[hole] = 0;
+    return 1;
+  }
+
+  void clear() {
+    for (std::size_t i = 0; i < m_capacity; i++) {
+      if (m_used[i]) {
+        m_slots[i].~value_type();
+        m_used[i] = 0;
+      }
+    }
+    m_size = 0;
+  }
+
+  /*!
+   * Make room for count entries, so adding them won't rehash.
+   */
+  void reserve(std::size_t count) {
+    std::size_t capacity = m_capacity ? m_capacity : kMinCapacity;
+    while (count * 4 > capacity * 3) {
+      capacity *= 2;
+    }
+    if (capacity != m_capacity) {
+      rehash(capacity);
+    }
+  }
+
+ private:
+  static constexpr std::size_t kMinCapacity = 8;
+
+  template <typename K>
+  std::size_t ideal_index(const K& key) const {
+    // fibonacci hashing: the top bits of the product depend on all bits of the hash.
+    return (std::size_t(Hash()(key)) * UINT64_C(0x9E3779B97F4A7C15)) >> m_shift;
+  }
+
+  std::size_t find_index(const Key& key) const {
+    if (m_size == 0) {
+      return m_capacity;
+    }
+    std::size_t idx = ideal_index(key);
+    while (m_used[idx]) {
+      if (Equal()(m_slots[idx].first, key)) {
+        return idx;
+      }
+      idx = (idx + 1) & (m_capacity - 1);
+    }
+    return m_capacity;
+  }
+
+  void rehash(std::size_t capacity) {
+    value_type* old_slots = m_slots;
+    std::unique_ptr<uint8_t[]> old_used = std::move(m_used);
+    const std::size_t old_capacity = m_capacity;
+
+    m_slots = std::allocator<value_type>().allocate(capacity);
+    m_used = std::make_unique<uint8_t[]>(capacity);
+    m_capacity = capacity;
+    m_shift = 64;
+    while ((std::size_t(1) << (64 - m_shift)) < capacity) {
+      m_shift--;
+    }
+
+    for (std::size_t i = 0; i < old_capacity; i++) {
+      if (old_used[i]) {
+        std::size_t idx = ideal_index(old_slots[i].first);
+        while (m_used[idx]) {
+          idx = (idx + 1) & (m_capacity - 1);
+        }
+        new (m_slots + idx) value_type(std::move(old_slots[i]));
+        m_used[idx] = 1;
+        old_slots[i].~value_type();
+      }
+    }
+    if (old_slots) {
+      std::allocator<value_type>().deallocate(old_slots, old_capacity);
+    }
+  }
+
+  void free_storage() {
+    clear();
+    if (m_slots) {
+      std::allocator<value_type>().deallocate(m_slots, m_capacity);
+    }
+    m_slots = nullptr;
+    m_used.reset();
+    m_capacity = 0;
+  }
+
+  value_type* m_slots = nullptr;
+  std::unique_ptr<uint8_t[]> m_used;
+  std::size_t m_capacity = 0;  // 0, or a power of two
+  int m_shift = 64;
+  std::size_t m_size = 0;
+};
+}  // namespace cu
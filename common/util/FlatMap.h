@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "common/util/Assert.h"
+
+namespace cu {
+/*!
+ * A replacement for std::map that keeps its entries sorted in a single vector. Lookups are a binary
+ * search, and iterating is in key order like std::map, but without following pointers. Adding a new
+ * key moves the entries after it, so it's meant for maps with at most a few thousand entries that
+ * are looked up more than they are added to, like the link tables of an object file.
+ *
+ * Differences from std::map:
+ *  - adding or erasing invalidates pointers, references and iterators.
+ *  - the entries are std::pair<Key, Value>. Don't modify the key.
+ *  - "at" asserts instead of throwing if the key is missing.
+ */
+template <typename Key, typename Value, typename Less = std::less<Key>>
+class FlatMap {
+ public:
+  using value_type = std::pair<Key, Value>;
+  using iterator = typename std::vector<value_type>::iterator;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  iterator begin() { return m_entries.begin(); }
+  iterator end() { return m_entries.end(); }
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  std::size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+  void reserve(std::size_t count) { m_entries.reserve(count); }
+  void clear() { m_entries.clear(); }
+
+  iterator find(const Key& key) { return m_entries.begin() + find_index(key); }
+  const_iterator find(const Key& key) const { return m_entries.begin() + find_index(key); }
+  bool contains(const Key& key) const { return find_index(key) != m_entries.size(); }
+  std::size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  Value& at(const Key& key) {
+    auto idx = find_index(key);
+    ASSERT(idx != m_entries.size());
+    return m_entries[idx].second;
+  }
+  const Value& at(const Key& key) const {
+    auto idx = find_index(key);
+    ASSERT(idx != m_entries.size());
+    return m_entries[idx].second;
+  }
+
+  /*!
+   * Add key with a Value constructed from args, if key isn't already in the map.
+   */
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    std::size_t idx = lower_bound(key);
+    if (idx != m_entries.size() && !Less()(key, m_entries[idx].first)) {
+      return {m_entries.begin() + idx, false};
+    }
+    auto it = m_entries.emplace(m_entries.begin() + idx, std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+    return {it, true};
+  }
+
+  std::pair<iterator, bool> insert(value_type entry) {
+    return try_emplace(std::move(entry.first), std::move(entry.second));
+  }
+
+  Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+  Value& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+  /*!
+   * Remove key, if it's in the map. Returns the number of entries removed.
+   */
+  std::size_t erase(const Key& key) {
+    auto idx = find_index(key);
+    if (idx == m_entries.size()) {
+      return 0;
+    }
+    m_entries.erase(m_entries.begin() + idx);
+    return 1;
+  }
+
+ private:
+  // index of the first entry that isn't less than key
+  std::size_t lower_bound(const Key& key) const {
+    std::size_t lo = 0;
+    std::size_t hi = m_entries.size();
+    while (lo < hi) {
+      std::size_t mid = lo + (hi - lo) / 2;
+      if (Less()(m_entries[mid].first, key)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  std::size_t find_index(const Key& key) const {
+    std::size_t idx = lower_bound(key);
+    if (idx != m_entries.size() && !Less()(key, m_entries[idx].first)) {
+      return idx;
+    }
+    return m_entries.size();
+  }
+
+  std::vector<value_type> m_entries;
+};
+}  // namespace cu
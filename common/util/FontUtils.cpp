@@ -54,92 +54,131 @@ GameTextFontBank::GameTextFontBank(GameTextVersion version,
       [](const ReplaceInfo& a, const ReplaceInfo& b) { return a.from.size() > b.from.size(); });
 }
 
-/*!
- * Finds a remap info that best matches the byte sequence (is the longest match).
- */
-const EncodeInfo* GameTextFontBank::find_encode_to_utf8(const char* in) const {
-  const EncodeInfo* best_info = nullptr;
-  for (auto& info : *m_encode_info) {
-    if (info.bytes.size() == 0)
-      continue;
-
-    bool found = true;
-    for (int i = 0; found && i < (int)info.bytes.size(); ++i) {
-      if (uint8_t(in[i]) != info.bytes.at(i)) {
-        found = false;
+void RemapTrie::add(std::string_view key, int score, int value) {
+  ASSERT(!key.empty());
+  const int entry = m_entries.size();
+  m_entries.push_back({score, value});
+  int node = 0;
+  for (size_t i = 0; i < key.size(); i++) {
+    const int new_node = m_nodes.size();
+    if (i == 0) {
+      int& first = m_first[u8(key[0])];
+      if (first < 0) {
+        first = new_node;
       }
+      node = first;
+    } else {
+      node = m_edges.try_emplace((u32(node) << 8) | u8(key[i]), new_node).first->second;
+    }
+    if (node == new_node) {
+      m_nodes.emplace_back();
     }
+    m_nodes[node].below = better(m_nodes[node].below, entry);
+  }
+  m_nodes[node].here = better(m_nodes[node].here, entry);
+}
 
-    if (found && (!best_info || info.chars.length() > best_info->chars.length())) {
-      best_info = &info;
+int RemapTrie::better(int a, int b) const {
+  if (a < 0 || b < 0) {
+    return std::max(a, b);
+  }
+  if (m_entries[a].score != m_entries[b].score) {
+    return m_entries[a].score > m_entries[b].score ? a : b;
+  }
+  return std::min(a, b);
+}
+
+int RemapTrie::find(const char* in, size_t size, bool past_end) const {
+  if (size == 0 || m_first[u8(in[0])] < 0) {
+    return -1;
+  }
+  int node = m_first[u8(in[0])];
+  int best = m_nodes[node].here;
+  size_t i = 1;
+  for (; i < size; i++) {
+    auto it = m_edges.find((u32(node) << 8) | u8(in[i]));
+    if (it == m_edges.end()) {
+      break;
     }
+    node = it->second;
+    best = better(best, m_nodes[node].here);
+  }
+  if (past_end && i == size) {
+    best = better(best, m_nodes[node].below);
   }
-  return best_info;
+  return best < 0 ? -1 : m_entries[best].value;
+}
+
+const GameTextFontBank::LookupTables& GameTextFontBank::lookup() const {
+  std::call_once(m_lookup_once, [&]() {
+    m_lookup = std::make_unique<LookupTables>();
+    for (int i = 0; i < (int)m_encode_info->size(); i++) {
+      auto& info = m_encode_info->at(i);
+      if (!info.chars.empty()) {
+        m_lookup->encode_by_chars.add(info.chars, info.chars.length(), i);
+      }
+      if (!info.bytes.empty()) {
+        std::string_view bytes((const char*)info.bytes.data(), info.bytes.size());
+        m_lookup->encode_by_bytes.add(bytes, info.chars.length(), i);
+      }
+    }
+    for (int i = 0; i < (int)m_replace_info->size(); i++) {
+      auto& info = m_replace_info->at(i);
+      if (!info.from.empty()) {
+        m_lookup->replace_by_from.add(info.from, info.from.length(), i);
+      }
+      if (!info.to.empty()) {
+        m_lookup->replace_by_to.add(info.to, info.to.length(), i);
+      }
+    }
+    for (int c = 0; c < 256; c++) {
+      m_lookup->valid_chars[c] = valid_char_range(char(c));
+    }
+  });
+  return *m_lookup;
+}
+
+/*!
+ * Finds a remap info that best matches the byte sequence (is the longest match).
+ */
+const EncodeInfo* GameTextFontBank::find_encode_to_utf8(const char* in) const {
+  // like the game, this doesn't stop at the end of the string if a remap continues past it.
+  int idx = lookup().encode_by_bytes.find(in, SIZE_MAX);
+  return idx < 0 ? nullptr : &m_encode_info->at(idx);
 }
 
 /*!
  * Finds a remap info that best matches the character sequence (is the longest match).
+ * At the end of the string, an info whose characters run past the end also matches.
  */
 const EncodeInfo* GameTextFontBank::find_encode_to_game(const std::string& in, int off) const {
-  const EncodeInfo* best_info = nullptr;
-  for (auto& info : *m_encode_info) {
-    if (info.chars.length() == 0)
-      continue;
-
-    bool found = true;
-    for (int i = 0; found && i < (int)info.chars.length() && i + off < (int)in.size(); ++i) {
-      if (in.at(i + off) != info.chars.at(i)) {
-        found = false;
-      }
-    }
-
-    if (found && (!best_info || info.chars.length() > best_info->chars.length())) {
-      best_info = &info;
-    }
-  }
-  return best_info;
+  int idx = lookup().encode_by_chars.find(in.data() + off, in.size() - off, true);
+  return idx < 0 ? nullptr : &m_encode_info->at(idx);
 }
 
 /*!
  * Finds a remap info that best matches the character sequence (is the longest match).
  */
 const ReplaceInfo* GameTextFontBank::find_replace_to_utf8(const std::string& in, int off) const {
-  const ReplaceInfo* best_info = nullptr;
-  for (auto& info : *m_replace_info) {
-    if (info.from.empty() || in.size() - off < info.from.size())
-      continue;
-
-    bool found = memcmp(in.data() + off, info.from.data(), info.from.size()) == 0;
-    if (found && (!best_info || info.from.length() > best_info->from.length())) {
-      best_info = &info;
-    }
-  }
-  return best_info;
+  int idx = lookup().replace_by_from.find(in.data() + off, in.size() - off);
+  return idx < 0 ? nullptr : &m_replace_info->at(idx);
 }
 
 /*!
  * Finds a remap info that best matches the character sequence (is the longest match).
  */
 const ReplaceInfo* GameTextFontBank::find_replace_to_game(const std::string& in, int off) const {
-  const ReplaceInfo* best_info = nullptr;
-  for (auto& info : *m_replace_info) {
-    if (info.to.empty() || in.size() - off < info.to.size())
-      continue;
-
-    bool found = memcmp(in.data() + off, info.to.data(), info.to.size()) == 0;
-    if (found && (!best_info || info.to.length() > best_info->to.length())) {
-      best_info = &info;
-    }
-  }
-  return best_info;
+  int idx = lookup().replace_by_to.find(in.data() + off, in.size() - off);
+  return idx < 0 ? nullptr : &m_replace_info->at(idx);
 }
 
 /*!
  * Try to replace specific substrings with better variants.
  * These are for hiding confusing text transforms.
  */
-std::string GameTextFontBank::replace_to_utf8(std::string& str) const {
+void GameTextFontBank::replace_to_utf8(std::string& str) const {
   std::string newstr;
+  newstr.reserve(str.size());
 
   for (int i = 0; i < (int)str.length();) {
     auto remap = find_replace_to_utf8(str, i);
@@ -147,19 +186,17 @@ std::string GameTextFontBank::replace_to_utf8(std::string& str) const {
       newstr.push_back(str.at(i));
       i += 1;
     } else {
-      for (auto b : remap->to) {
-        newstr.push_back(b);
-      }
+      newstr.append(remap->to);
       i += remap->from.length();
     }
   }
 
-  str = newstr;
-  return str;
+  str.swap(newstr);
 }
 
-std::string GameTextFontBank::replace_to_game(std::string& str) const {
+void GameTextFontBank::replace_to_game(std::string& str) const {
   std::string newstr;
+  newstr.reserve(str.size());
 
   for (int i = 0; i < (int)str.length();) {
     auto remap = find_replace_to_game(str, i);
@@ -167,19 +204,17 @@ std::string GameTextFontBank::replace_to_game(std::string& str) const {
       newstr.push_back(str.at(i));
       i += 1;
     } else {
-      for (auto b : remap->from) {
-        newstr.push_back(b);
-      }
+      newstr.append(remap->from);
       i += remap->to.length();
     }
   }
 
-  str = newstr;
-  return str;
+  str.swap(newstr);
 }
 
-std::string GameTextFontBank::encode_utf8_to_game(std::string& str) const {
+void GameTextFontBank::encode_utf8_to_game(std::string& str) const {
   std::string newstr;
+  newstr.reserve(str.size());
 
   for (int i = 0; i < (int)str.length();) {
     auto remap = find_encode_to_game(str, i);
@@ -187,24 +222,18 @@ std::string GameTextFontBank::encode_utf8_to_game(std::string& str) const {
       newstr.push_back(str.at(i));
       i += 1;
     } else {
-      for (auto b : remap->bytes) {
-        newstr.push_back(b);
-      }
+      newstr.append(remap->bytes.begin(), remap->bytes.end());
       i += remap->chars.length();
     }
   }
 
-  str = newstr;
-  return str;
+  str.swap(newstr);
 }
 
 /*!
  * Turn a normal readable string into a string readable in the in-game font encoding and converts
  * \cXX escape sequences
  */
-// NOTE - the convert_utf8_to_game function is really really slow (about 80-90% of the
-// time loading the text files)
-// TODO - improve that as a follow up sometime in the future
 std::string GameTextFontBank::convert_utf8_to_game(std::string str, bool escape) const {
   std::string newstr;
 
@@ -276,6 +305,7 @@ bool GameTextFontBank::valid_char_range(const char in) const {
  * Unprintable characters become escape sequences, including tab and newline.
  */
 std::string GameTextFontBank::convert_game_to_utf8(const char* in) const {
+  const auto& valid_chars = lookup().valid_chars;
   std::string temp;
   std::string result;
   while (*in) {
@@ -283,7 +313,7 @@ std::string GameTextFontBank::convert_game_to_utf8(const char* in) const {
     if (remap != nullptr) {
       temp.append(remap->chars);
       in += remap->bytes.size() - 1;
-    } else if (valid_char_range(*in) || *in == '\n' || *in == '\t' || *in == '\\' || *in == '\"') {
+    } else if (valid_chars[u8(*in)] || *in == '\n' || *in == '\t' || *in == '\\' || *in == '\"') {
       temp.push_back(*in);
     } else {
       temp += fmt::format("\\c{:02x}", uint8_t(*in));
@@ -309,7 +339,8 @@ std::string GameTextFontBank::convert_game_to_utf8(const char* in) const {
       result.push_back(c);
     }
   }
-  return replace_to_utf8(result);
+  replace_to_utf8(result);
+  return result;
 }
 
 static std::vector<EncodeInfo> s_encode_info_null = {};
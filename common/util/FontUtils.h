@@ -9,13 +9,18 @@
  * Always verify the encoding if string detection suddenly goes awry.
  */
 
+#include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/util/FlatHashMap.h"
 #include "common/versions/versions.h"
 
 // version of the game text file's text encoding. Not real, but we need to differentiate them
@@ -49,6 +54,43 @@ struct ReplaceInfo {
   std::string to;
 };
 
+/*!
+ * A trie of remap strings, so finding the ones that match at a position walks the input once
+ * instead of comparing it against every remap.
+ */
+class RemapTrie {
+ public:
+  RemapTrie() { m_first.fill(-1); }
+  /*!
+   * Add a remap string, which maps to value. When several match, the one with the highest score
+   * wins, then the first one added.
+   */
+  void add(std::string_view key, int score, int value);
+  /*!
+   * Find the best entry whose key is a prefix of in[0, size), and return its value. If past_end is
+   * set, keys that run past the end of the input (that is, that start with all of it) match too.
+   * Returns -1 for no match.
+   */
+  int find(const char* in, size_t size, bool past_end = false) const;
+
+ private:
+  struct Node {
+    int here = -1;   // best entry that ends at this node
+    int below = -1;  // best entry that ends at this node or after it
+  };
+  struct Entry {
+    int score;
+    int value;
+  };
+  int better(int a, int b) const;
+
+  std::vector<Node> m_nodes = {Node()};
+  std::vector<Entry> m_entries;
+  // most characters don't start any remap, so the first step is a table lookup.
+  std::array<int, 256> m_first;
+  cu::FlatHashMap<u32, int> m_edges;  // (node << 8 | next byte) -> node, after the first step
+};
+
 /*!
  * All the information to convert UTF-8 text into game text.
  */
@@ -58,14 +100,27 @@ class GameTextFontBank {
   std::vector<ReplaceInfo>* m_replace_info;
   std::unordered_set<char>* m_passthrus;
 
+  // tries over the info vectors, for each direction. Built on first use, because the jak 2 and
+  // jak 3 banks share (and both sort) the same vectors during static init.
+  struct LookupTables {
+    RemapTrie encode_by_chars;
+    RemapTrie encode_by_bytes;
+    RemapTrie replace_by_from;
+    RemapTrie replace_by_to;
+    std::array<bool, 256> valid_chars;  // valid_char_range for each character
+  };
+  mutable std::once_flag m_lookup_once;
+  mutable std::unique_ptr<LookupTables> m_lookup;
+  const LookupTables& lookup() const;
+
   const EncodeInfo* find_encode_to_utf8(const char* in) const;
   const EncodeInfo* find_encode_to_game(const std::string& in, int off = 0) const;
   const ReplaceInfo* find_replace_to_utf8(const std::string& in, int off = 0) const;
   const ReplaceInfo* find_replace_to_game(const std::string& in, int off = 0) const;
 
-  std::string replace_to_utf8(std::string& str) const;
-  std::string replace_to_game(std::string& str) const;
-  std::string encode_utf8_to_game(std::string& str) const;
+  void replace_to_utf8(std::string& str) const;
+  void replace_to_game(std::string& str) const;
+  void encode_utf8_to_game(std::string& str) const;
 
  public:
   GameTextFontBank(GameTextVersion version,
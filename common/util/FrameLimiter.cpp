@@ -1,9 +1,24 @@
 #include "FrameLimiter.h"
 
+#include <algorithm>
 #include <thread>
 
 #include "common/common_types.h"
 
+#ifdef _WIN32
+#define NOMINMAX
+#include <Windows.h>
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+namespace {
+// spin for at least this long, on top of the expected oversleep
+constexpr double kMinSpinSeconds = 0.0002;
+constexpr double kMaxOversleepSeconds = 0.004;
+}  // namespace
+
 double FrameLimiter::round_to_nearest_60fps(double current) {
   double one_frame = 1.f / 60.f;
   int frames_missed = (current / one_frame);  // rounds down
@@ -19,42 +34,47 @@ FrameLimiter::FrameLimiter() {}
 
 FrameLimiter::~FrameLimiter() {}
 
-void FrameLimiter::run(double target_fps,
-                       bool experimental_accurate_lag,
-                       bool do_sleeps,
-                       double engine_time) {
-  double target_seconds;
-  if (experimental_accurate_lag) {
-    target_seconds = round_to_nearest_60fps(engine_time);
-  } else {
-    target_seconds = 1.f / target_fps;
-  }
-  double remaining_time = target_seconds - m_timer.getSeconds();
-
-  if (do_sleeps && remaining_time > 0.001) {
-    std::this_thread::sleep_for(std::chrono::microseconds(int((remaining_time - 0.001) * 1e6)));
-  }
-
-  while (remaining_time > 0) {
-    remaining_time = target_seconds - m_timer.getSeconds();
-  }
-
-  m_timer.start();
+void FrameLimiter::sleep(double seconds) {
+#ifdef __linux__
+  timespec ts;
+  ts.tv_sec = (time_t)seconds;
+  ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+  clock_nanosleep(CLOCK_MONOTONIC, 0, &ts, nullptr);
+#else
+  std::this_thread::sleep_for(std::chrono::nanoseconds(s64(seconds * 1e9)));
+#endif
 }
 
 #else
 
-#define NOMINMAX
-#include <Windows.h>
-
 FrameLimiter::FrameLimiter() {
   timeBeginPeriod(1);
+  // high resolution timers are only on Windows 10 1803 and newer, fall back to Sleep without them.
+  m_waitable_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION,
+                                            TIMER_ALL_ACCESS);
 }
 
 FrameLimiter::~FrameLimiter() {
-  timeEndPeriod(0);
+  if (m_waitable_timer) {
+    CloseHandle(m_waitable_timer);
+  }
+  timeEndPeriod(1);
 }
 
+void FrameLimiter::sleep(double seconds) {
+  if (m_waitable_timer) {
+    LARGE_INTEGER due;
+    due.QuadPart = -(LONGLONG)(seconds * 1e7);  // relative, in 100 ns units
+    if (SetWaitableTimerEx(m_waitable_timer, &due, 0, nullptr, nullptr, nullptr, 0)) {
+      WaitForSingleObject(m_waitable_timer, INFINITE);
+      return;
+    }
+  }
+  Sleep((DWORD)(seconds * 1000));
+}
+
+#endif
+
 void FrameLimiter::run(double target_fps,
                        bool experimental_accurate_lag,
                        bool do_sleeps,
@@ -65,17 +85,23 @@ void FrameLimiter::run(double target_fps,
   } else {
     target_seconds = 1.f / target_fps;
   }
-  double remaining_time = target_seconds - m_timer.getSeconds();
-
-  if (do_sleeps && remaining_time > 0.001) {
-    Sleep((remaining_time * 1000) - 1);
+  double deadline = m_frame_start + target_seconds;
+  double now = m_clock.getSeconds();
+
+  double sleep_time = deadline - now - m_oversleep - kMinSpinSeconds;
+  if (do_sleeps && sleep_time > 0) {
+    sleep(sleep_time);
+    double woke = m_clock.getSeconds();
+    // increase quickly when the OS is late, and decrease slowly when it's on time.
+    double late = std::max(0., woke - now - sleep_time);
+    m_oversleep = late > m_oversleep ? late : m_oversleep * 0.95 + late * 0.05;
+    m_oversleep = std::min(m_oversleep, kMaxOversleepSeconds);
   }
 
-  while (remaining_time > 0) {
-    remaining_time = target_seconds - m_timer.getSeconds();
-  }
+  do {
+    now = m_clock.getSeconds();
+  } while (now < deadline);
 
-  m_timer.start();
+  // if this frame took longer than two frames, don't try to catch up.
+  m_frame_start = (now - deadline > target_seconds) ? now : deadline;
 }
-
-#endif
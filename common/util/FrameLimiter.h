@@ -2,6 +2,11 @@
 
 #include "common/util/Timer.h"
 
+/*!
+ * Waits for the end of each frame. A frame is timed from the deadline of the previous one, not from
+ * when run() returned, so the time spent between calls doesn't push the frames back. Most of the
+ * wait is a sleep, then it spins for as long as the OS has recently been late to wake us up.
+ */
 class FrameLimiter {
  public:
   FrameLimiter();
@@ -11,6 +16,12 @@ class FrameLimiter {
 
  private:
   double round_to_nearest_60fps(double current);
+  void sleep(double seconds);
 
-  Timer m_timer;
-};
\ No newline at end of file
+  Timer m_clock;  // never restarted
+  double m_frame_start = 0;
+  double m_oversleep = 0.001;  // how late the OS wakes us up from a sleep, estimated
+#ifdef _WIN32
+  void* m_waitable_timer = nullptr;
+#endif
+};
@@ -0,0 +1,121 @@
+#include "MappedFile.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "common/common_types.h"
+#ifdef OS_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#elif _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
+#include "common/log/log.h"
+
+#include "fmt/core.h"
+
+void MappedFile::read_fallback(const fs::path& path) {
+  lg::warn("Couldn't map {}, reading it instead", path.string());
+  m_fallback = file_util::read_binary_file(path);
+  m_size = m_fallback.size();
+  m_data = m_fallback.empty() ? nullptr : m_fallback.data();
+}
+
+#ifdef OS_POSIX
+MappedFile::MappedFile(const fs::path& path, Access access) {
+  int fd = open(path.string().c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error(
+        fmt::format("File {} cannot be opened: {}", path.string(), strerror(errno)));
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    throw std::runtime_error(
+        fmt::format("File {} cannot be opened: {}", path.string(), strerror(errno)));
+  }
+  m_size = st.st_size;
+  if (m_size > 0) {
+    void* mem = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mem == MAP_FAILED) {
+      close(fd);
+      read_fallback(path);
+      return;
+    }
+    m_data = (const u8*)mem;
+    switch (access) {
+      case Access::SEQUENTIAL:
+        // read ahead aggressively, and start now.
+        madvise(mem, m_size, MADV_SEQUENTIAL);
+        madvise(mem, m_size, MADV_WILLNEED);
+        break;
+      case Access::RANDOM:
+        madvise(mem, m_size, MADV_RANDOM);
+        break;
+      default:
+        break;
+    }
+  }
+  // the mapping stays valid after the file is closed.
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (is_mapped()) {
+    munmap(const_cast<u8*>(m_data), m_size);
+  }
+}
+#elif _WIN32
+MappedFile::MappedFile(const fs::path& path, Access access) {
+  DWORD flags = FILE_ATTRIBUTE_NORMAL;
+  if (access == Access::SEQUENTIAL) {
+    flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+  } else if (access == Access::RANDOM) {
+    flags |= FILE_FLAG_RANDOM_ACCESS;
+  }
+  HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, flags, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error(fmt::format("File {} cannot be opened", path.string()));
+  }
+  m_file = file;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    throw std::runtime_error(fmt::format("File {} cannot be opened", path.string()));
+  }
+  m_size = size.QuadPart;
+  if (m_size > 0) {
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    m_data = mapping ? (const u8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!m_data) {
+      if (mapping) {
+        CloseHandle(mapping);
+      }
+      CloseHandle(file);
+      m_file = nullptr;
+      read_fallback(path);
+      return;
+    }
+    m_mapping = mapping;
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (is_mapped()) {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mapping) {
+    CloseHandle(m_mapping);
+  }
+  if (m_file) {
+    CloseHandle(m_file);
+  }
+}
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
+/*!
+ * A read-only memory mapping of an entire file.
+ * The OS pages the file in as it's accessed, so reading it doesn't need a heap copy.
+ * If the file can't be mapped, it's read into memory instead, so users don't need a fallback.
+ */
+class MappedFile {
+ public:
+  // how the file will be read, so the OS can read ahead (or not).
+  enum class Access { NORMAL, SEQUENTIAL, RANDOM };
+
+  explicit MappedFile(const fs::path& path, Access access = Access::NORMAL);
+  ~MappedFile();
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const u8* data() const { return m_data; }
+  size_t size() const { return m_size; }
+  std::span<const u8> span() const { return {m_data, m_size}; }
+  // false if the file was read into memory because it couldn't be mapped.
+  bool is_mapped() const { return m_data && m_fallback.empty(); }
+
+ private:
+  void read_fallback(const fs::path& path);
+
+  const u8* m_data = nullptr;
+  size_t m_size = 0;
+  std::vector<u8> m_fallback;
+#ifdef _WIN32
+  void* m_file = nullptr;
+  void* m_mapping = nullptr;
+#endif
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/Assert.h"
+
+/*!
+ * A MonotonicArena hands out memory by bumping a pointer through large blocks, and frees it all at
+ * once when it's destroyed. This is much faster than new/delete for lots of small objects that
+ * all die together, and puts objects created one after another next to each other in memory.
+ *
+ * The arena does not run destructors. Objects made with create must be destroyed by the caller
+ * before the arena is destroyed (or reset).
+ */
+class MonotonicArena {
+ public:
+  explicit MonotonicArena(size_t first_block_size = 16 * 1024)
+      : m_next_block_size(first_block_size) {}
+  MonotonicArena(const MonotonicArena&) = delete;
+  MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+  void* allocate(size_t size, size_t align) {
+    ASSERT(align && (align & (align - 1)) == 0);
+    uintptr_t aligned = (m_ptr + align - 1) & ~(uintptr_t)(align - 1);
+    if (aligned + size > m_end) {
+      new_block(size + align);
+      aligned = (m_ptr + align - 1) & ~(uintptr_t)(align - 1);
+    }
+    m_ptr = aligned + size;
+    return (void*)aligned;
+  }
+
+  template <typename T, class... Args>
+  T* create(Args&&... args) {
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  // free all blocks. Everything allocated from the arena is gone.
+  void reset() {
+    m_blocks.clear();
+    m_ptr = m_end = 0;
+    m_bytes_reserved = 0;
+  }
+
+  size_t bytes_reserved() const { return m_bytes_reserved; }
+
+ private:
+  static constexpr size_t kMaxBlockSize = 1024 * 1024;
+
+  void new_block(size_t min_size) {
+    size_t size = std::max(m_next_block_size, min_size);
+    // grow, so small arenas stay small and big ones don't make too many blocks.
+    m_next_block_size = std::min(m_next_block_size * 2, kMaxBlockSize);
+    // not make_unique, which would zero the block.
+    m_blocks.emplace_back(new u8[size]);
+    m_ptr = (uintptr_t)m_blocks.back().get();
+    m_end = m_ptr + size;
+    m_bytes_reserved += size;
+  }
+
+  std::vector<std::unique_ptr<u8[]>> m_blocks;
+  uintptr_t m_ptr = 0;
+  uintptr_t m_end = 0;
+  size_t m_next_block_size;
+  size_t m_bytes_reserved = 0;
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstring>
+#include <functional>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -44,14 +46,27 @@ class Serializer {
 
   /*!
    * Construct a serializer that reads from the given data.
-   * The data is copied to an internal buffer managed by the serializer, there is no need to keep
-   * the input data around.
+   * By default, the data is copied to an internal buffer managed by the serializer, there is no
+   * need to keep the input data around. If copy_data is false, the serializer reads the data in
+   * place, and it must stay alive for as long as the serializer is used.
    */
-  Serializer(const u8* data, size_t size) : m_size(size), m_writing(false) {
-    m_data = (u8*)malloc(size);
-    memcpy(m_data, data, size);
+  Serializer(const u8* data, size_t size, bool copy_data = true) : m_size(size), m_writing(false) {
+    if (copy_data) {
+      m_data = (u8*)malloc(size);
+      memcpy(m_data, data, size);
+    } else {
+      m_data = const_cast<u8*>(data);
+      m_owns_data = false;
+    }
   }
 
+  /*!
+   * Construct a serializer that loads size bytes from a stream. Each load calls source to fill the
+   * destination directly, so the whole input never needs to be in memory.
+   */
+  Serializer(std::function<void(void*, size_t)> source, size_t size)
+      : m_size(size), m_writing(false), m_owns_data(false), m_source(std::move(source)) {}
+
   // don't allow copying, assigning, or move constructing.
   Serializer(const Serializer& other) = delete;
   Serializer& operator=(const Serializer& other) = delete;
@@ -67,6 +82,8 @@ class Serializer {
     m_size = other.m_size;
     m_offset = other.m_offset;
     m_writing = other.m_writing;
+    m_owns_data = other.m_owns_data;
+    m_source = std::move(other.m_source);
 
     other.m_data = nullptr;
     other.m_size = 0;
@@ -74,7 +91,11 @@ class Serializer {
     return *this;
   }
 
-  ~Serializer() { free(m_data); }
+  ~Serializer() {
+    if (m_owns_data) {
+      free(m_data);
+    }
+  }
 
   /*!
    * Save or load the thing pointed to by ptr.
@@ -167,6 +188,60 @@ class Serializer {
     }
   }
 
+  /*!
+   * Save or load a vector of anything. f is called on each element to save or load it.
+   */
+  template <typename T, typename F>
+  void from_vector(std::vector<T>* vec, F&& f) {
+    if (is_saving()) {
+      save<size_t>(vec->size());
+    } else {
+      vec->clear();
+      vec->resize(load<size_t>());
+    }
+    for (auto& elt : *vec) {
+      f(&elt);
+    }
+  }
+
+  /*!
+   * Save or load a map with string keys. f is called on each value to save or load it.
+   */
+  template <typename Map, typename F>
+  void from_string_map(Map* map, F&& f) {
+    if (is_saving()) {
+      save<size_t>(map->size());
+      for (auto& [key, value] : *map) {
+        save_str(&key);
+        f(&value);
+      }
+    } else {
+      map->clear();
+      size_t count = load<size_t>();
+      for (size_t i = 0; i < count; i++) {
+        f(&(*map)[load_string()]);
+      }
+    }
+  }
+
+  /*!
+   * Save or load an optional. f is called on the value, if there is one.
+   */
+  template <typename T, typename F>
+  void from_optional(std::optional<T>* opt, F&& f) {
+    bool has_value = opt->has_value();
+    from_ptr(&has_value);
+    if (is_loading()) {
+      opt->reset();
+      if (has_value) {
+        opt->emplace();
+      }
+    }
+    if (has_value) {
+      f(&opt->value());
+    }
+  }
+
   /*!
    * Are we saving?
    */
@@ -182,6 +257,7 @@ class Serializer {
    */
   void reset_load() {
     ASSERT(is_loading());
+    ASSERT(!m_source);
     m_offset = 0;
   }
 
@@ -221,7 +297,11 @@ class Serializer {
     } else {
       // if we would overflow, it's an error.
       ASSERT(m_offset + size <= m_size);
-      memcpy(data, m_data + m_offset, size);
+      if (m_source) {
+        m_source(data, size);
+      } else {
+        memcpy(data, m_data + m_offset, size);
+      }
     }
     m_offset += size;
   }
@@ -230,4 +310,6 @@ class Serializer {
   size_t m_size = 0;
   size_t m_offset = 0;
   bool m_writing = false;
+  bool m_owns_data = true;
+  std::function<void(void*, size_t)> m_source;
 };
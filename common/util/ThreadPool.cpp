@@ -0,0 +1,233 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "common/util/Assert.h"
+
+namespace {
+// the pool and index of the worker running on this thread, if any.
+thread_local ThreadPool* t_worker_pool = nullptr;
+thread_local int t_worker_idx = -1;
+
+std::atomic<int> g_global_thread_limit = 0;
+std::atomic<bool> g_global_pool_created = false;
+}  // namespace
+
+ThreadPool::ThreadPool(int num_threads) {
+  num_threads = std::max(1, num_threads);
+  for (int i = 0; i < num_threads; i++) {
+    m_queues.push_back(std::make_unique<WorkerQueue>());
+  }
+  for (int i = 0; i < num_threads; i++) {
+    m_threads.emplace_back(&ThreadPool::worker_loop, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lk(m_wake_mutex);
+    m_shutdown = true;
+  }
+  m_wake_cv.notify_all();
+  for (auto& t : m_threads) {
+    t.join();
+  }
+}
+
+ThreadPool& ThreadPool::global() {
+  static ThreadPool pool([]() {
+    g_global_pool_created = true;
+    int limit = g_global_thread_limit;
+    if (limit <= 0) {
+      if (const char* env = std::getenv("OPENGOAL_MAX_THREADS")) {
+        limit = std::atoi(env);
+      }
+    }
+    return limit > 0 ? limit : std::max(1, (int)std::thread::hardware_concurrency());
+  }());
+  return pool;
+}
+
+void ThreadPool::set_global_thread_limit(int num_threads) {
+  ASSERT_MSG(!g_global_pool_created, "The global thread pool has already been created");
+  g_global_thread_limit = num_threads;
+}
+
+void ThreadPool::push(std::function<void()> task) {
+  // workers push to their own queue, so tasks they spawn stay hot in their cache.
+  size_t idx = t_worker_pool == this ? t_worker_idx : m_next_queue++ % m_queues.size();
+  {
+    std::lock_guard<std::mutex> lk(m_queues[idx]->mutex);
+    m_queues[idx]->tasks.push_back(std::move(task));
+  }
+  {
+    // must hold the lock so a worker can't miss the wakeup between checking and sleeping.
+    std::lock_guard<std::mutex> lk(m_wake_mutex);
+    m_pending++;
+  }
+  m_wake_cv.notify_one();
+}
+
+bool ThreadPool::pop_task(std::function<void()>* out) {
+  const size_t num_queues = m_queues.size();
+  const bool is_worker = t_worker_pool == this;
+  const size_t home = is_worker ? t_worker_idx : m_next_queue % num_queues;
+
+  // newest task from our own queue first, then steal the oldest task from the others.
+  if (is_worker) {
+    auto& queue = *m_queues[home];
+    std::lock_guard<std::mutex> lk(queue.mutex);
+    if (!queue.tasks.empty()) {
+      *out = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      m_pending--;
+      return true;
+    }
+  }
+
+  for (size_t i = 0; i < num_queues; i++) {
+    auto& queue = *m_queues[(home + i) % num_queues];
+    std::lock_guard<std::mutex> lk(queue.mutex);
+    if (!queue.tasks.empty()) {
+      *out = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      m_pending--;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ThreadPool::run_one() {
+  std::function<void()> task;
+  if (!pop_task(&task)) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::notify_waiters() {
+  {
+    // the waiter checks done() with the lock held, so it can't miss this.
+    std::lock_guard<std::mutex> lk(m_wake_mutex);
+  }
+  m_wake_cv.notify_all();
+}
+
+void ThreadPool::worker_loop(int idx) {
+  t_worker_pool = this;
+  t_worker_idx = idx;
+  while (true) {
+    if (run_one()) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lk(m_wake_mutex);
+    m_wake_cv.wait(lk, [&]() { return m_shutdown || m_pending > 0; });
+    if (m_shutdown && m_pending == 0) {
+      return;
+    }
+  }
+}
+
+void ThreadPool::parallel_for(int count, const std::function<void(int)>& func, int max_workers) {
+  if (count <= 0) {
+    return;
+  }
+  // the calling thread is one of the runners, so this stays within the pool's thread count.
+  int num_runners = std::min(count, num_threads());
+  if (max_workers > 0) {
+    num_runners = std::min(num_runners, max_workers);
+  }
+
+  std::atomic<int> next_idx = 0;
+  std::atomic<int> runners_done = 0;
+  std::atomic<bool> failed = false;
+  std::exception_ptr first_exception;
+  std::mutex exception_mutex;
+  auto runner = [&]() {
+    for (int i = next_idx++; i < count && !failed; i = next_idx++) {
+      try {
+        func(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lk(exception_mutex);
+        if (!first_exception) {
+          first_exception = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+    if (++runners_done == num_runners) {
+      notify_waiters();
+    }
+  };
+
+  for (int i = 1; i < num_runners; i++) {
+    push(runner);
+  }
+  runner();
+  wait_until([&]() { return runners_done == num_runners; });
+
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+TaskGraph::TaskId TaskGraph::add(std::function<void()> func, const std::vector<TaskId>& deps) {
+  TaskId id = m_tasks.size();
+  auto& task = m_tasks.emplace_back();
+  task.func = std::move(func);
+  task.num_deps = deps.size();
+  for (auto dep : deps) {
+    ASSERT(dep >= 0 && dep < id);
+    m_tasks[dep].dependents.push_back(id);
+  }
+  return id;
+}
+
+void TaskGraph::start(TaskId id) {
+  m_pool.submit([this, id]() {
+    auto& task = m_tasks[id];
+    if (!m_failed) {
+      try {
+        task.func();
+      } catch (...) {
+        std::lock_guard<std::mutex> lk(m_exception_mutex);
+        if (!m_exception) {
+          m_exception = std::current_exception();
+        }
+        m_failed = true;
+      }
+    }
+    for (auto dependent : task.dependents) {
+      if (--m_tasks[dependent].remaining_deps == 0) {
+        start(dependent);
+      }
+    }
+    // run() can return as soon as the last task is counted, so don't touch this after that.
+    auto& pool = m_pool;
+    const int num_tasks = m_tasks.size();
+    if (++m_done == num_tasks) {
+      pool.notify_waiters();
+    }
+  });
+}
+
+void TaskGraph::run() {
+  m_done = 0;
+  m_failed = false;
+  m_exception = nullptr;
+  for (auto& task : m_tasks) {
+    task.remaining_deps = task.num_deps;
+  }
+  for (TaskId id = 0; id < (TaskId)m_tasks.size(); id++) {
+    if (m_tasks[id].num_deps == 0) {
+      start(id);
+    }
+  }
+  m_pool.wait_until([&]() { return m_done == (int)m_tasks.size(); });
+  if (m_exception) {
+    std::rethrow_exception(m_exception);
+  }
+}
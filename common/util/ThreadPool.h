@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*!
+ * A persistent pool of worker threads with work stealing.
+ *
+ * Each worker has its own queue. Tasks submitted from a worker go on that worker's queue, and an
+ * idle worker steals from the others, so nested parallelism doesn't funnel through a single lock.
+ * Waiting on the pool (wait, parallel_for, TaskGraph::run) runs queued tasks instead of blocking,
+ * so it's fine to wait from inside a task.
+ *
+ * Most code should use ThreadPool::global(), which is shared by everything in the process. Its
+ * size is the global cap on concurrency, so tools that run at the same time don't oversubscribe.
+ */
+class ThreadPool {
+ public:
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /*!
+   * The shared pool. It's created on first use, with the number of threads from
+   * set_global_thread_limit, the OPENGOAL_MAX_THREADS environment variable, or one per core.
+   */
+  static ThreadPool& global();
+
+  /*!
+   * Set the number of threads for the global pool. Must be called before the first use of global.
+   */
+  static void set_global_thread_limit(int num_threads);
+
+  int num_threads() const { return (int)m_threads.size(); }
+
+  /*!
+   * Run func on the pool. The future holds its result, or the exception it threw.
+   */
+  template <typename F>
+  auto submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+    auto result = task->get_future();
+    push([task]() { (*task)(); });
+    return result;
+  }
+
+  /*!
+   * Wait for a future from submit, running other tasks in the meantime.
+   */
+  template <typename T>
+  T wait(std::future<T>& future) {
+    while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      if (!run_one()) {
+        future.wait_for(std::chrono::microseconds(100));
+      }
+    }
+    return future.get();
+  }
+
+  /*!
+   * Run func(i) for i in [0, count), on up to max_workers threads at once (0 for no limit).
+   * Indices are handed out one at a time, so uneven work is balanced. If func throws, the
+   * remaining indices are skipped and the first exception is rethrown here.
+   */
+  void parallel_for(int count, const std::function<void(int)>& func, int max_workers = 0);
+
+  /*!
+   * Run one queued task on this thread. Returns false if there was nothing to run.
+   */
+  bool run_one();
+
+  /*!
+   * Run queued tasks until done() returns true, sleeping while there is nothing to run. Whatever
+   * makes done() true must call notify_waiters afterward.
+   */
+  template <typename Done>
+  void wait_until(Done&& done) {
+    while (!done()) {
+      if (run_one()) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lk(m_wake_mutex);
+      m_wake_cv.wait(lk, [&]() { return done() || m_pending > 0; });
+    }
+  }
+
+  void notify_waiters();
+
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void push(std::function<void()> task);
+  bool pop_task(std::function<void()>* out);
+  void worker_loop(int idx);
+
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_threads;
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake_cv;
+  std::atomic<int> m_pending = 0;
+  std::atomic<unsigned> m_next_queue = 0;
+  bool m_shutdown = false;
+};
+
+/*!
+ * A set of tasks with dependencies between them, run on a ThreadPool.
+ * A task starts once all the tasks it depends on are done.
+ */
+class TaskGraph {
+ public:
+  using TaskId = int;
+  explicit TaskGraph(ThreadPool& pool = ThreadPool::global()) : m_pool(pool) {}
+
+  /*!
+   * Add a task that runs after all of deps. Dependencies must be added first.
+   */
+  TaskId add(std::function<void()> func, const std::vector<TaskId>& deps = {});
+
+  /*!
+   * Run all tasks and wait for them to finish. If a task throws, the tasks that haven't started
+   * are skipped and the first exception is rethrown here.
+   */
+  void run();
+
+ private:
+  struct Task {
+    std::function<void()> func;
+    std::vector<TaskId> dependents;
+    int num_deps = 0;
+    std::atomic<int> remaining_deps = 0;
+  };
+
+  void start(TaskId id);
+
+  ThreadPool& m_pool;
+  std::deque<Task> m_tasks;
+  std::atomic<int> m_done = 0;
+  std::atomic<bool> m_failed = false;
+  std::mutex m_exception_mutex;
+  std::exception_ptr m_exception;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+
+/*!
+ * Hands the latest value from one writer thread to one reader thread, without locks and without
+ * either side waiting for the other. The writer can write as often as it likes, and the reader
+ * always gets the most recent complete value. Values in between are skipped.
+ *
+ * There are three copies of the value: the writer fills one, the reader reads another, and the
+ * third is the latest complete one. Publishing and reading swap a copy with the third one.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  /*!
+   * Publish a new value. Only one thread may write.
+   */
+  void write(const T& value) {
+    m_slots[m_write_idx] = value;
+    const int old = m_latest.exchange(m_write_idx | kFreshBit, std::memory_order_acq_rel);
+    m_write_idx = old & kIndexMask;
+  }
+
+  /*!
+   * Get the latest value, which may be the same one as the last read. Returns false (and leaves out
+   * alone) if nothing has been written yet. Only one thread may read.
+   */
+  bool read(T* out) {
+    if (m_latest.load(std::memory_order_relaxed) & kFreshBit) {
+      const int old = m_latest.exchange(m_read_idx, std::memory_order_acq_rel);
+      m_read_idx = old & kIndexMask;
+    } else if (!m_has_value) {
+      return false;
+    }
+    m_has_value = true;
+    *out = m_slots[m_read_idx];
+    return true;
+  }
+
+ private:
+  static constexpr int kFreshBit = 4;
+  static constexpr int kIndexMask = 3;
+
+  T m_slots[3] = {};
+  int m_write_idx = 0;            // writer only
+  int m_read_idx = 1;             // reader only
+  bool m_has_value = false;       // reader only
+  std::atomic<int> m_latest = 2;  // the third slot, and whether it's newer than the read one
+};
@@ -1,29 +1,59 @@
 #include "compress.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <stdexcept>
 
 #include "common/util/Assert.h"
+#include "common/util/ThreadPool.h"
 
 #include "fmt/core.h"
 #include "third-party/zstd/lib/zstd.h"
 
 namespace compression {
+namespace {
+// the layout of the seek table from zstd's contrib/seekable_format, without checksums.
+constexpr u32 kSeekTableMagic = ZSTD_MAGIC_SKIPPABLE_START | 0xE;
+constexpr u32 kSeekableMagic = 0x8F92EAB1;
+constexpr size_t kSkippableHeaderSize = 8;  // magic, size
+constexpr size_t kSeekEntrySize = 8;   // compressed size, decompressed size
+constexpr size_t kSeekFooterSize = 9;  // frame count, descriptor, magic
+
+void check_zstd(size_t ret) {
+  if (ZSTD_isError(ret)) {
+    ASSERT_MSG(false, fmt::format("ZSTD error: {}", ZSTD_getErrorName(ret)));
+  }
+}
+
+ZstdCompressor& thread_compressor() {
+  thread_local ZstdCompressor compressor;
+  return compressor;
+}
+
+ZstdDecompressor& thread_decompressor() {
+  thread_local ZstdDecompressor decompressor;
+  return decompressor;
+}
+
+void append_u32(std::vector<u8>* out, u32 value) {
+  const size_t offset = out->size();
+  out->resize(offset + sizeof(u32));
+  memcpy(out->data() + offset, &value, sizeof(u32));
+}
+
+u32 read_u32(const u8* data) {
+  u32 result;
+  memcpy(&result, data, sizeof(u32));
+  return result;
+}
+}  // namespace
 
 /*!
  * Compress data with zstd.  There is an 8-byte header containing the decompressed data's size.
  */
 std::vector<u8> compress_zstd(const void* data, size_t size) {
-  auto max_compressed = ZSTD_compressBound(size);
-  std::vector<u8> result(sizeof(size_t) + max_compressed);
-  memcpy(result.data(), &size, sizeof(size_t));
-  auto compressed_size =
-      ZSTD_compress(result.data() + sizeof(size_t), max_compressed, data, size, 1);
-  if (ZSTD_isError(compressed_size)) {
-    ASSERT_MSG(false, fmt::format("ZSTD error: {}", ZSTD_getErrorName(compressed_size)));
-  }
-  result.resize(sizeof(size_t) + compressed_size);
-  return result;
+  return thread_compressor().compress(data, size);
 }
 
 /*!
@@ -31,32 +61,258 @@ std::vector<u8> compress_zstd(const void* data, size_t size) {
  * decompressed data's size.
  */
 std::vector<u8> decompress_zstd(const void* data, size_t size) {
+  return thread_decompressor().decompress(data, size);
+}
+
+std::vector<u8> compress_zstd_no_header(const void* data, size_t size) {
+  std::vector<u8> result;
+  thread_compressor().compress_no_header(data, size, &result);
+  return result;
+}
+
+/*!
+ * Decompress data from compress_zstd_no_header. dst_size must be the exact decompressed size.
+ */
+void decompress_zstd_no_header(const void* data, size_t size, void* dst, size_t dst_size) {
+  thread_decompressor().decompress_no_header(data, size, dst, dst_size);
+}
+
+std::vector<u8> compress_zstd_seekable(const void* data, size_t size, size_t frame_size) {
+  // the seek table has 32-bit sizes.
+  ASSERT(frame_size > 0 && ZSTD_compressBound(frame_size) <= UINT32_MAX);
+  const size_t frame_count = (size + frame_size - 1) / frame_size;
+  std::vector<std::vector<u8>> frames(frame_count);
+  ThreadPool::global().parallel_for(frame_count, [&](int i) {
+    const size_t offset = i * frame_size;
+    thread_compressor().compress_no_header((const u8*)data + offset,
+                                           std::min(frame_size, size - offset), &frames[i]);
+  });
+
+  size_t total = 0;
+  for (const auto& frame : frames) {
+    total += frame.size();
+  }
+  const size_t table_size = frame_count * kSeekEntrySize + kSeekFooterSize;
+  std::vector<u8> result;
+  result.reserve(total + kSkippableHeaderSize + table_size);
+  for (const auto& frame : frames) {
+    result.insert(result.end(), frame.begin(), frame.end());
+  }
+
+  append_u32(&result, kSeekTableMagic);
+  append_u32(&result, table_size);
+  for (size_t i = 0; i < frame_count; i++) {
+    append_u32(&result, frames[i].size());
+    append_u32(&result, std::min(frame_size, size - i * frame_size));
+  }
+  append_u32(&result, frame_count);
+  result.push_back(0);  // descriptor: no checksums
+  append_u32(&result, kSeekableMagic);
+  return result;
+}
+
+std::vector<u8> compress_zstd_parallel(const void* data, size_t size) {
+  auto frames = compress_zstd_seekable(data, size);
+  std::vector<u8> result(sizeof(size_t) + frames.size());
+  memcpy(result.data(), &size, sizeof(size_t));
+  memcpy(result.data() + sizeof(size_t), frames.data(), frames.size());
+  return result;
+}
+
+ZstdCompressor::ZstdCompressor(int level) {
+  m_ctx = ZSTD_createCCtx();
+  check_zstd(ZSTD_CCtx_setParameter(m_ctx, ZSTD_c_compressionLevel, level));
+}
+
+ZstdCompressor::~ZstdCompressor() {
+  ZSTD_freeCCtx(m_ctx);
+}
+
+void ZstdCompressor::set_dictionary(const std::vector<u8>& dictionary) {
+  // an empty dictionary clears it.
+  check_zstd(ZSTD_CCtx_loadDictionary(m_ctx, dictionary.data(), dictionary.size()));
+}
+
+std::vector<u8> ZstdCompressor::compress(const void* data, size_t size) {
+  std::vector<u8> result(sizeof(size_t));
+  memcpy(result.data(), &size, sizeof(size_t));
+  compress_no_header(data, size, &result);
+  return result;
+}
+
+void ZstdCompressor::compress_no_header(const void* data, size_t size, std::vector<u8>* out) {
+  const size_t start = out->size();
+  const size_t max_compressed = ZSTD_compressBound(size);
+  out->resize(start + max_compressed);
+  const size_t compressed_size =
+      ZSTD_compress2(m_ctx, out->data() + start, max_compressed, data, size);
+  check_zstd(compressed_size);
+  out->resize(start + compressed_size);
+}
+
+ZstdDecompressor::ZstdDecompressor() {
+  m_ctx = ZSTD_createDCtx();
+}
+
+ZstdDecompressor::~ZstdDecompressor() {
+  ZSTD_freeDCtx(m_ctx);
+}
+
+void ZstdDecompressor::set_dictionary(const std::vector<u8>& dictionary) {
+  check_zstd(ZSTD_DCtx_loadDictionary(m_ctx, dictionary.data(), dictionary.size()));
+}
+
+std::vector<u8> ZstdDecompressor::decompress(const void* data, size_t size) {
   ASSERT(size >= sizeof(size_t));
   size_t decompressed_size;
   memcpy(&decompressed_size, data, sizeof(size_t));
-  size_t compressed_size = size - sizeof(size_t);
-
   std::vector<u8> result(decompressed_size);
-  auto decomp_size = ZSTD_decompress(result.data(), decompressed_size,
-                                     (const u8*)data + sizeof(size_t), compressed_size);
-  if (ZSTD_isError(decomp_size)) {
-    ASSERT_MSG(false, fmt::format("ZSTD error: {}", ZSTD_getErrorName(compressed_size)));
+  decompress_no_header((const u8*)data + sizeof(size_t), size - sizeof(size_t), result.data(),
+                       decompressed_size);
+  return result;
+}
+
+void ZstdDecompressor::decompress_no_header(const void* data,
+                                            size_t size,
+                                            void* dst,
+                                            size_t dst_size) {
+  auto decomp_size = ZSTD_decompressDCtx(m_ctx, dst, dst_size, data, size);
+  check_zstd(decomp_size);
+  ASSERT(decomp_size == dst_size);
+}
+
+ZstdSeekableReader::ZstdSeekableReader(const void* data, size_t size) : m_data((const u8*)data) {
+  if (size < kSkippableHeaderSize + kSeekFooterSize ||
+      read_u32(m_data + size - sizeof(u32)) != kSeekableMagic) {
+    throw std::runtime_error("Data is not a seekable zstd stream");
+  }
+  const u8* footer = m_data + size - kSeekFooterSize;
+  const size_t frame_count = read_u32(footer);
+  if (footer[4] != 0) {
+    throw std::runtime_error("Seekable zstd streams with checksums aren't supported");
+  }
+  const size_t table_size = frame_count * kSeekEntrySize + kSeekFooterSize;
+  if (size < kSkippableHeaderSize + table_size) {
+    throw std::runtime_error("Seekable zstd stream has an invalid seek table");
+  }
+  const size_t table_start = size - table_size - kSkippableHeaderSize;
+  if (read_u32(m_data + table_start) != kSeekTableMagic ||
+      read_u32(m_data + table_start + sizeof(u32)) != table_size) {
+    throw std::runtime_error("Seekable zstd stream has an invalid seek table");
   }
 
-  ASSERT(decomp_size == decompressed_size);
-  return result;
+  size_t offset = 0;
+  const u8* entry = m_data + table_start + kSkippableHeaderSize;
+  for (size_t i = 0; i < frame_count; i++, entry += kSeekEntrySize) {
+    auto& frame = m_frames.emplace_back();
+    frame.offset = offset;
+    frame.compressed_size = read_u32(entry);
+    frame.decompressed_offset = m_decompressed_size;
+    frame.decompressed_size = read_u32(entry + sizeof(u32));
+    offset += frame.compressed_size;
+    m_decompressed_size += frame.decompressed_size;
+  }
+  if (offset != table_start) {
+    throw std::runtime_error("Seekable zstd stream has an invalid seek table");
+  }
 }
 
-std::vector<u8> compress_zstd_no_header(const void* data, size_t size) {
-  size_t max_compressed = ZSTD_compressBound(size);
-  std::vector<u8> result(max_compressed);
+const ZstdSeekableReader::Frame& ZstdSeekableReader::frame_at(size_t decompressed_offset) const {
+  auto it = std::upper_bound(
+      m_frames.begin(), m_frames.end(), decompressed_offset,
+      [](size_t offset, const Frame& frame) { return offset < frame.decompressed_offset; });
+  ASSERT(it != m_frames.begin());
+  return *(it - 1);
+}
 
-  size_t compressed_size = ZSTD_compress(result.data(), max_compressed, data, size, 1);
-  if (ZSTD_isError(compressed_size)) {
-    ASSERT_MSG(false, fmt::format("ZSTD error: {}", ZSTD_getErrorName(compressed_size)));
+void ZstdSeekableReader::read(size_t offset, void* dst, size_t size) {
+  ASSERT(offset + size <= m_decompressed_size);
+  if (size == 0) {
+    return;
   }
+  const int first = &frame_at(offset) - m_frames.data();
+  const int last = &frame_at(offset + size - 1) - m_frames.data();
 
-  result.resize(compressed_size);
-  return result;
+  // frames that are read completely go straight to dst, in parallel.
+  auto frame_dst = [&](const Frame& frame) {
+    return (u8*)dst + frame.decompressed_offset - offset;
+  };
+  auto is_whole = [&](const Frame& frame) {
+    return frame.decompressed_offset >= offset &&
+           frame.decompressed_offset + frame.decompressed_size <= offset + size;
+  };
+  if (last - first > 1 || is_whole(m_frames[first]) || is_whole(m_frames[last])) {
+    ThreadPool::global().parallel_for(last - first + 1, [&](int i) {
+      const auto& frame = m_frames[first + i];
+      if (is_whole(frame)) {
+        decompress_zstd_no_header(m_data + frame.offset, frame.compressed_size, frame_dst(frame),
+                                  frame.decompressed_size);
+      }
+    });
+  }
+
+  // the frames at the ends may only be partly read, those go through the cache.
+  auto read_part = [&](int idx) {
+    const auto& frame = m_frames[idx];
+    if (is_whole(frame)) {
+      return;
+    }
+    if (m_cached_frame != idx) {
+      m_cache.resize(frame.decompressed_size);
+      decompress_zstd_no_header(m_data + frame.offset, frame.compressed_size, m_cache.data(),
+                                frame.decompressed_size);
+      m_cached_frame = idx;
+    }
+    const size_t start = std::max(offset, frame.decompressed_offset);
+    const size_t end =
+        std::min(offset + size, frame.decompressed_offset + frame.decompressed_size);
+    memcpy((u8*)dst + start - offset, m_cache.data() + start - frame.decompressed_offset,
+           end - start);
+  };
+  read_part(first);
+  if (last != first) {
+    read_part(last);
+  }
+}
+
+ZstdFileReader::ZstdFileReader(const fs::path& path) {
+  m_fp = file_util::open_file(path, "rb");
+  if (!m_fp) {
+    throw std::runtime_error(
+        fmt::format("File {} cannot be opened: {}", path.string(), strerror(errno)));
+  }
+  if (fread(&m_decompressed_size, sizeof(size_t), 1, m_fp) != 1) {
+    fclose(m_fp);
+    throw std::runtime_error(fmt::format("File {} is missing the zstd header", path.string()));
+  }
+  m_ctx = ZSTD_createDCtx();
+  m_in_buffer.resize(ZSTD_DStreamInSize());
+}
+
+ZstdFileReader::~ZstdFileReader() {
+  ZSTD_freeDCtx(m_ctx);
+  fclose(m_fp);
+}
+
+void ZstdFileReader::read(void* dst, size_t size) {
+  ASSERT(m_bytes_read + size <= m_decompressed_size);
+  ZSTD_outBuffer out = {dst, size, 0};
+  while (out.pos < out.size) {
+    if (m_in_pos == m_in_size) {
+      m_in_size = fread(m_in_buffer.data(), 1, m_in_buffer.size(), m_fp);
+      m_in_pos = 0;
+    }
+    ZSTD_inBuffer in = {m_in_buffer.data(), m_in_size, m_in_pos};
+    const size_t out_pos_before = out.pos;
+    auto ret = ZSTD_decompressStream(m_ctx, &out, &in);
+    if (ZSTD_isError(ret)) {
+      ASSERT_MSG(false, fmt::format("ZSTD error: {}", ZSTD_getErrorName(ret)));
+    }
+    m_in_pos = in.pos;
+    // zstd may still have buffered output after the end of the file, but no progress means the
+    // file is truncated.
+    ASSERT_MSG(m_in_size > 0 || out.pos > out_pos_before, "ZSTD error: unexpected end of file");
+  }
+  m_bytes_read += size;
 }
 }  // namespace compression
@@ -1,12 +1,149 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdio>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
 namespace compression {
-// compress and decompress data with zstd
+// compress and decompress data with zstd. These reuse a context per thread.
 std::vector<u8> compress_zstd(const void* data, size_t size);
 std::vector<u8> decompress_zstd(const void* data, size_t size);
 std::vector<u8> compress_zstd_no_header(const void* data, size_t size);
+void decompress_zstd_no_header(const void* data, size_t size, void* dst, size_t dst_size);
+
+constexpr size_t kSeekableFrameSize = 1024 * 1024;
+
+/*!
+ * Compress data as independent frames of frame_size bytes, in parallel on the global ThreadPool.
+ * The frames are followed by a seek table in a skippable frame, in the layout of zstd's seekable
+ * format, so the result is still a normal zstd stream, and ZstdSeekableReader can decompress any
+ * range of it without the frames before that.
+ */
+std::vector<u8> compress_zstd_seekable(const void* data,
+                                       size_t size,
+                                       size_t frame_size = kSeekableFrameSize);
+
+/*!
+ * Like compress_zstd, but compressed in parallel with compress_zstd_seekable. decompress_zstd and
+ * ZstdFileReader read it the same way. The frames compress a little worse than one big frame.
+ */
+std::vector<u8> compress_zstd_parallel(const void* data, size_t size);
+
+/*!
+ * A zstd compression context, which can be reused for many buffers without allocating its memory
+ * again. It can use a dictionary, which helps a lot with small buffers that look alike. The
+ * dictionary is either one trained by `zstd --train`, or any bytes typical of the data.
+ * Not thread safe.
+ */
+class ZstdCompressor {
+ public:
+  explicit ZstdCompressor(int level = 1);
+  ~ZstdCompressor();
+  ZstdCompressor(const ZstdCompressor&) = delete;
+  ZstdCompressor& operator=(const ZstdCompressor&) = delete;
+
+  // used for all compression after this, until it's set again. Empty for no dictionary.
+  void set_dictionary(const std::vector<u8>& dictionary);
+
+  // with the size header, like compress_zstd.
+  std::vector<u8> compress(const void* data, size_t size);
+  // appends one frame to out.
+  void compress_no_header(const void* data, size_t size, std::vector<u8>* out);
+
+ private:
+  ZSTD_CCtx_s* m_ctx = nullptr;
+};
+
+/*!
+ * A zstd decompression context, which can be reused. It must have the same dictionary that the
+ * data was compressed with. Not thread safe.
+ */
+class ZstdDecompressor {
+ public:
+  ZstdDecompressor();
+  ~ZstdDecompressor();
+  ZstdDecompressor(const ZstdDecompressor&) = delete;
+  ZstdDecompressor& operator=(const ZstdDecompressor&) = delete;
+
+  void set_dictionary(const std::vector<u8>& dictionary);
+
+  // data from ZstdCompressor::compress, or compress_zstd.
+  std::vector<u8> decompress(const void* data, size_t size);
+  // dst_size must be the exact decompressed size.
+  void decompress_no_header(const void* data, size_t size, void* dst, size_t dst_size);
+
+ private:
+  ZSTD_DCtx_s* m_ctx = nullptr;
+};
+
+/*!
+ * Random access to data from compress_zstd_seekable. Only the frames that a read covers are
+ * decompressed. The data must stay valid while the reader is used. Not thread safe.
+ */
+class ZstdSeekableReader {
+ public:
+  ZstdSeekableReader(const void* data, size_t size);
+
+  size_t decompressed_size() const { return m_decompressed_size; }
+  size_t frame_count() const { return m_frames.size(); }
+
+  /*!
+   * Decompress size bytes starting at offset into dst. Reads covering several frames decompress
+   * them in parallel.
+   */
+  void read(size_t offset, void* dst, size_t size);
+
+ private:
+  struct Frame {
+    size_t offset;  // in the compressed data
+    size_t compressed_size;
+    size_t decompressed_offset;
+    size_t decompressed_size;
+  };
+  const Frame& frame_at(size_t decompressed_offset) const;
+
+  const u8* m_data = nullptr;
+  std::vector<Frame> m_frames;
+  size_t m_decompressed_size = 0;
+
+  // the last frame that was partly read, since small reads usually come in order.
+  int m_cached_frame = -1;
+  std::vector<u8> m_cache;
+};
+
+/*!
+ * Streaming decompression of a file created with compress_zstd.
+ * The file is read and decompressed a chunk at a time, directly into the buffers passed to read, so
+ * neither the whole compressed file nor a second copy of the decompressed data is ever in memory.
+ */
+class ZstdFileReader {
+ public:
+  explicit ZstdFileReader(const fs::path& path);
+  ~ZstdFileReader();
+  ZstdFileReader(const ZstdFileReader&) = delete;
+  ZstdFileReader& operator=(const ZstdFileReader&) = delete;
+
+  /*!
+   * Decompress the next size bytes into dst. It's an error to read past the end.
+   */
+  void read(void* dst, size_t size);
+
+  size_t decompressed_size() const { return m_decompressed_size; }
+  size_t bytes_read() const { return m_bytes_read; }
+
+ private:
+  FILE* m_fp = nullptr;
+  ZSTD_DCtx_s* m_ctx = nullptr;
+  std::vector<u8> m_in_buffer;
+  size_t m_in_pos = 0;
+  size_t m_in_size = 0;
+  size_t m_decompressed_size = 0;
+  size_t m_bytes_read = 0;
+};
 }  // namespace compression
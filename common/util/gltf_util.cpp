@@ -1,5 +1,7 @@
 #include "gltf_util.h"
 
+#include <cmath>
+
 #include "image_resize.h"
 
 #include "common/log/log.h"
@@ -594,28 +596,172 @@ std::vector<NodeWithTransform> flatten_nodes_from_all_scenes(const tinygltf::Mod
   return out;
 }
 
-void dedup_vertices(const std::vector<tfrag3::PreloadedVertex>& vertices_in,
-                    std::vector<tfrag3::PreloadedVertex>& vertices_out,
-                    std::vector<u32>& old_to_new_out) {
-  ASSERT(vertices_out.empty());
-  ASSERT(old_to_new_out.empty());
-  old_to_new_out.resize(vertices_in.size(), -1);
-
-  std::unordered_map<tfrag3::PreloadedVertex, u32, tfrag3::PreloadedVertex::hash> vtx_to_new;
-
-  for (size_t in_idx = 0; in_idx < vertices_in.size(); in_idx++) {
-    auto& vtx = vertices_in[in_idx];
-    const auto& lookup = vtx_to_new.find(vtx);
-    if (lookup == vtx_to_new.end()) {
-      // first time seeing this one
-      size_t new_idx = vertices_out.size();
-      vertices_out.push_back(vtx);
-      old_to_new_out[in_idx] = new_idx;
-      vtx_to_new[vtx] = new_idx;
+namespace {
+constexpr int kVertexCacheSize = 32;
+
+/*!
+ * How good it is to draw a triangle using this vertex next.
+ */
+float vertex_cache_score(int cache_position, int remaining_tris) {
+  if (remaining_tris == 0) {
+    return -1.f;
+  }
+
+  float score = 0;
+  if (cache_position >= 0) {
+    if (cache_position < 3) {
+      // used by the last triangle. These get a fixed score so the next triangle doesn't simply
+      // continue a strip, which tends to leave long thin holes.
+      score = 0.75f;
     } else {
-      old_to_new_out[in_idx] = lookup->second;
+      const float scale = 1.f / (kVertexCacheSize - 3);
+      score = std::pow(1.f - (cache_position - 3) * scale, 1.5f);
+    }
+  }
+
+  // boost vertices with few triangles left, so we don't leave lone triangles behind to come back
+  // to later.
+  score += 2.f / std::sqrt((float)remaining_tris);
+  return score;
+}
+}  // namespace
+
+void optimize_vertex_cache(std::vector<u32>& indices, u32 vertex_count) {
+  ASSERT(indices.size() % 3 == 0);
+  const u32 tri_count = indices.size() / 3;
+  if (tri_count < 2) {
+    return;
+  }
+
+  // per vertex, the triangles that use it. The first remaining_tris of these haven't been added.
+  std::vector<u32> vtx_tri_start(vertex_count + 1, 0);
+  for (auto idx : indices) {
+    ASSERT(idx < vertex_count);
+    vtx_tri_start[idx + 1]++;
+  }
+  for (u32 i = 0; i < vertex_count; i++) {
+    vtx_tri_start[i + 1] += vtx_tri_start[i];
+  }
+  std::vector<u32> vtx_tris(indices.size());
+  std::vector<int> remaining_tris(vertex_count, 0);
+  for (u32 tri = 0; tri < tri_count; tri++) {
+    for (int i = 0; i < 3; i++) {
+      const u32 vtx = indices[tri * 3 + i];
+      vtx_tris[vtx_tri_start[vtx] + remaining_tris[vtx]++] = tri;
+    }
+  }
+
+  std::vector<int> cache_position(vertex_count, -1);
+  std::vector<float> vtx_score(vertex_count);
+  for (u32 i = 0; i < vertex_count; i++) {
+    vtx_score[i] = vertex_cache_score(-1, remaining_tris[i]);
+  }
+  std::vector<float> tri_score(tri_count);
+  for (u32 tri = 0; tri < tri_count; tri++) {
+    tri_score[tri] = vtx_score[indices[tri * 3]] + vtx_score[indices[tri * 3 + 1]] +
+                     vtx_score[indices[tri * 3 + 2]];
+  }
+
+  std::vector<bool> tri_added(tri_count, false);
+  std::vector<u32> result;
+  result.reserve(indices.size());
+
+  // the simulated LRU cache, most recent first. It can go 3 over the size while adding a triangle.
+  std::vector<u32> cache, new_cache;
+  cache.reserve(kVertexCacheSize + 3);
+  new_cache.reserve(kVertexCacheSize + 3);
+
+  // when no triangle in the cache is left to add, restart from the first one not yet added.
+  u32 next_unadded = 0;
+  s64 best_tri = -1;
+
+  for (u32 added = 0; added < tri_count; added++) {
+    if (best_tri < 0) {
+      while (tri_added[next_unadded]) {
+        next_unadded++;
+      }
+      best_tri = next_unadded;
+    }
+
+    const u32 tri = best_tri;
+    tri_added[tri] = true;
+    new_cache.clear();
+    for (int i = 0; i < 3; i++) {
+      const u32 vtx = indices[tri * 3 + i];
+      result.push_back(vtx);
+
+      // remove the triangle from the vertex's list of remaining triangles.
+      u32* tris = &vtx_tris[vtx_tri_start[vtx]];
+      const int count = remaining_tris[vtx];
+      for (int j = 0; j < count; j++) {
+        if (tris[j] == tri) {
+          std::swap(tris[j], tris[count - 1]);
+          break;
+        }
+      }
+      remaining_tris[vtx]--;
+      new_cache.push_back(vtx);
+    }
+
+    for (auto vtx : cache) {
+      if (vtx != new_cache[0] && vtx != new_cache[1] && vtx != new_cache[2]) {
+        new_cache.push_back(vtx);
+      }
+    }
+    std::swap(cache, new_cache);
+
+    // update the scores of everything in the cache, and anything that just fell out of it.
+    for (size_t i = kVertexCacheSize; i < cache.size(); i++) {
+      cache_position[cache[i]] = -1;
+    }
+    for (size_t i = 0; i < cache.size(); i++) {
+      const u32 vtx = cache[i];
+      if (i < (size_t)kVertexCacheSize) {
+        cache_position[vtx] = i;
+      }
+      const float new_score = vertex_cache_score(cache_position[vtx], remaining_tris[vtx]);
+      const float diff = new_score - vtx_score[vtx];
+      vtx_score[vtx] = new_score;
+      for (int j = 0; j < remaining_tris[vtx]; j++) {
+        tri_score[vtx_tris[vtx_tri_start[vtx] + j]] += diff;
+      }
+    }
+    if (cache.size() > (size_t)kVertexCacheSize) {
+      cache.resize(kVertexCacheSize);
+    }
+
+    // the next triangle is the best one using a vertex in the cache.
+    best_tri = -1;
+    float best_score = -1;
+    for (auto vtx : cache) {
+      for (int j = 0; j < remaining_tris[vtx]; j++) {
+        const u32 candidate = vtx_tris[vtx_tri_start[vtx] + j];
+        if (tri_score[candidate] > best_score) {
+          best_score = tri_score[candidate];
+          best_tri = candidate;
+        }
+      }
+    }
+  }
+
+  indices = std::move(result);
+}
+
+float average_cache_miss_ratio(const std::vector<u32>& indices, u32 vertex_count, int cache_size) {
+  if (indices.empty()) {
+    return 0;
+  }
+  // the time each vertex went in the cache, a vertex is in the cache if it went in during the last
+  // cache_size misses.
+  std::vector<s64> insert_time(vertex_count, -(s64)cache_size - 1);
+  s64 misses = 0;
+  for (auto idx : indices) {
+    if (misses - insert_time.at(idx) > cache_size) {
+      insert_time[idx] = misses;
+      misses++;
     }
   }
+  return (float)misses / (indices.size() / 3);
 }
 
 void setup_alpha_from_material(const tinygltf::Material& material, DrawMode* mode) {
@@ -740,7 +886,7 @@ std::vector<float> extract_floats(const tinygltf::Model& model, int accessor_idx
 }
 
 std::size_t TieFullVertex::hash::operator()(const TieFullVertex& x) const {
-  return tfrag3::PackedTieVertices::Vertex::hash()(x.vertex) ^ std::hash<u16>()(x.color_index);
+  return tfrag3::PackedTieVertices::Vertex::hash()(x.vertex) * 31 + x.color_index;
 }
 
 tfrag3::PackedTimeOfDay pack_time_of_day(const std::vector<math::Vector<u8, 4>>& color_palette) {
@@ -90,6 +90,10 @@ struct TieFullVertex {
   }
 };
 
+/*!
+ * Remove duplicate vertices. Vertices keep the order they are first seen in, and old_to_new_out
+ * maps each input vertex to its index in vertices_out.
+ */
 template <typename T>
 void dedup_vertices(const std::vector<T>& vertices_in,
                     std::vector<T>& vertices_out,
@@ -98,23 +102,53 @@ void dedup_vertices(const std::vector<T>& vertices_in,
   ASSERT(old_to_new_out.empty());
   old_to_new_out.resize(vertices_in.size(), -1);
 
-  std::unordered_map<T, u32, typename T::hash> vtx_to_new;
+  // open addressing table of indices into vertices_out, kept at most half full. This is much
+  // faster than an unordered_map, which allocates a node for every unique vertex.
+  constexpr u32 kEmpty = UINT32_MAX;
+  int table_bits = 4;
+  while ((1ull << table_bits) < 2 * vertices_in.size()) {
+    table_bits++;
+  }
+  const size_t mask = (1ull << table_bits) - 1;
+  std::vector<u32> table(mask + 1, kEmpty);
+  typename T::hash hasher;
 
   for (size_t in_idx = 0; in_idx < vertices_in.size(); in_idx++) {
     auto& vtx = vertices_in[in_idx];
-    const auto& lookup = vtx_to_new.find(vtx);
-    if (lookup == vtx_to_new.end()) {
-      // first time seeing this one
-      size_t new_idx = vertices_out.size();
-      vertices_out.push_back(vtx);
-      old_to_new_out[in_idx] = new_idx;
-      vtx_to_new[vtx] = new_idx;
-    } else {
-      old_to_new_out[in_idx] = lookup->second;
+    // fibonacci hashing, so all bits of the hash pick the slot.
+    size_t slot = ((u64)hasher(vtx) * 0x9E3779B97F4A7C15ull) >> (64 - table_bits);
+    while (true) {
+      u32 entry = table[slot];
+      if (entry == kEmpty) {
+        // first time seeing this one
+        entry = vertices_out.size();
+        vertices_out.push_back(vtx);
+        table[slot] = entry;
+        old_to_new_out[in_idx] = entry;
+        break;
+      }
+      if (vertices_out[entry] == vtx) {
+        old_to_new_out[in_idx] = entry;
+        break;
+      }
+      slot = (slot + 1) & mask;
     }
   }
 }
 
+/*!
+ * Reorder the triangles of an indexed triangle list so vertices get used again while they are
+ * still in the GPU's post-transform cache, using Tom Forsyth's "linear-speed vertex cache
+ * optimisation". Triangles keep their vertex order, so winding doesn't change.
+ */
+void optimize_vertex_cache(std::vector<u32>& indices, u32 vertex_count);
+
+/*!
+ * The average number of vertices transformed per triangle, for a FIFO post-transform cache.
+ * 3 is the worst possible, and a regular grid mesh gets close to 0.5 at best.
+ */
+float average_cache_miss_ratio(const std::vector<u32>& indices, u32 vertex_count, int cache_size);
+
 std::vector<NodeWithTransform> flatten_nodes_from_all_scenes(const tinygltf::Model& model);
 
 void setup_alpha_from_material(const tinygltf::Material& material, DrawMode* mode);
@@ -0,0 +1,514 @@
+#include "hash.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__AVX2__)
+#define HASH_USE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define HASH_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define HASH_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace hash_util {
+
+namespace {
+
+constexpr u64 PRIME32_1 = 0x9E3779B1U;
+constexpr u64 PRIME32_2 = 0x85EBCA77U;
+constexpr u64 PRIME32_3 = 0xC2B2AE3DU;
+constexpr u64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr u64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr u64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr size_t kStripeSize = 64;
+// each stripe of a block uses the secret starting 8 bytes later than the previous one.
+constexpr size_t kStripesPerBlock = (kHashSecretSize - kStripeSize) / 8;
+constexpr size_t kScrambleSecretOffset = kHashSecretSize - kStripeSize;
+// not a multiple of 8, so the last stripe's key is different from every other stripe's.
+constexpr size_t kLastStripeSecretOffset = kHashSecretSize - kStripeSize - 7;
+constexpr size_t kMergeSecretOffsetLo = 11;
+constexpr size_t kMergeSecretOffsetHi = kHashSecretSize - kStripeSize - 11;
+// inputs up to this size don't use the accumulators
+constexpr size_t kShortInputMax = 128;
+
+// the secret is just "random" bytes, from splitmix64.
+constexpr std::array<u8, kHashSecretSize> make_secret() {
+  std::array<u8, kHashSecretSize> result{};
+  u64 state = 0x6a09e667f3bcc908ULL;
+  for (size_t i = 0; i < kHashSecretSize; i += 8) {
+    state += 0x9E3779B97F4A7C15ULL;
+    u64 z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    for (size_t j = 0; j < 8; j++) {
+      result[i + j] = (u8)(z >> (8 * j));
+    }
+  }
+  return result;
+}
+
+constexpr std::array<u8, kHashSecretSize> kSecret = make_secret();
+
+u64 read64(const u8* p) {
+  u64 result;
+  memcpy(&result, p, 8);
+  return result;
+}
+
+u32 read32(const u8* p) {
+  u32 result;
+  memcpy(&result, p, 4);
+  return result;
+}
+
+void write64(u8* p, u64 x) {
+  memcpy(p, &x, 8);
+}
+
+u64 rotl64(u64 x, int amount) {
+  return (x << amount) | (x >> (64 - amount));
+}
+
+// multiply to 128 bits, and xor the halves together.
+u64 mul128_fold64(u64 a, u64 b) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = (unsigned __int128)a * b;
+  return (u64)product ^ (u64)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  u64 hi;
+  u64 lo = _umul128(a, b, &hi);
+  return lo ^ hi;
+#else
+  u64 lo_lo = (a & 0xffffffff) * (b & 0xffffffff);
+  u64 hi_lo = (a >> 32) * (b & 0xffffffff);
+  u64 lo_hi = (a & 0xffffffff) * (b >> 32);
+  u64 hi_hi = (a >> 32) * (b >> 32);
+  u64 cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  u64 hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+  u64 lo = (cross << 32) | (lo_lo & 0xffffffff);
+  return lo ^ hi;
+#endif
+}
+
+u64 avalanche(u64 h) {
+  h ^= h >> 37;
+  h *= 0x165667919E3779F9ULL;
+  h ^= h >> 32;
+  return h;
+}
+
+// stronger mixing for the tiny inputs, which don't get a multiply of their own.
+u64 fmix64(u64 h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+/*!
+ * The secret used for a seed: each 16 bytes get the seed added to the first half and subtracted
+ * from the second.
+ */
+void derive_secret(u8* out, u64 seed) {
+  for (size_t i = 0; i < kHashSecretSize; i += 16) {
+    write64(out + i, read64(kSecret.data() + i) + seed);
+    write64(out + i + 8, read64(kSecret.data() + i + 8) - seed);
+  }
+}
+
+u64 mix16(const u8* data, const u8* secret, u64 seed) {
+  return mul128_fold64(read64(data) ^ (read64(secret) + seed),
+                       read64(data + 8) ^ (read64(secret + 8) - seed));
+}
+
+u64 hash_short(const u8* data, size_t size, u64 seed) {
+  const u8* secret = kSecret.data();
+  if (size == 0) {
+    return fmix64(seed ^ read64(secret + 56) ^ read64(secret + 64));
+  }
+  if (size <= 3) {
+    u32 combined = ((u32)data[0] << 16) | ((u32)data[size >> 1] << 24) | (u32)data[size - 1] |
+                   ((u32)size << 8);
+    u64 bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+    return fmix64((u64)combined ^ bitflip);
+  }
+  if (size <= 8) {
+    u64 input = read32(data + size - 4) + ((u64)read32(data) << 32);
+    u64 bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+    return fmix64((input ^ bitflip) + size);
+  }
+  if (size <= 16) {
+    u64 lo = read64(data) ^ ((read64(secret + 24) ^ read64(secret + 32)) + seed);
+    u64 hi = read64(data + size - 8) ^ ((read64(secret + 40) ^ read64(secret + 48)) - seed);
+    return avalanche(size + rotl64(lo, 32) + hi + mul128_fold64(lo, hi));
+  }
+
+  // 17 to 128 bytes: pairs of 16 bytes from the start and end, overlapping in the middle.
+  u64 acc = size * PRIME64_1;
+  if (size > 32) {
+    if (size > 64) {
+      if (size > 96) {
+        acc += mix16(data + 48, secret + 96, seed);
+        acc += mix16(data + size - 64, secret + 112, seed);
+      }
+      acc += mix16(data + 32, secret + 64, seed);
+      acc += mix16(data + size - 48, secret + 80, seed);
+    }
+    acc += mix16(data + 16, secret + 32, seed);
+    acc += mix16(data + size - 32, secret + 48, seed);
+  }
+  acc += mix16(data, secret, seed);
+  acc += mix16(data + size - 16, secret + 16, seed);
+  return avalanche(acc);
+}
+
+Hash128 hash128_short(const u8* data, size_t size, u64 seed) {
+  return {hash_short(data, size, seed), hash_short(data, size, seed ^ PRIME64_3)};
+}
+
+////////////////////
+// Accumulators
+////////////////////
+
+void init_acc(u64* acc) {
+  acc[0] = PRIME32_3;
+  acc[1] = PRIME64_1;
+  acc[2] = PRIME64_2;
+  acc[3] = PRIME64_3;
+  acc[4] = PRIME64_4;
+  acc[5] = PRIME32_2;
+  acc[6] = PRIME64_5;
+  acc[7] = PRIME32_1;
+}
+
+/*
+ * Each lane adds the data of the neighboring lane, plus the product of the low and high halves
+ * of its data xor key. The SIMD versions below do exactly this, several lanes at a time.
+ */
+void accumulate_stripe_scalar(u64* acc, const u8* data, const u8* key) {
+  for (int i = 0; i < 8; i++) {
+    u64 data_val = read64(data + 8 * i);
+    u64 data_key = data_val ^ read64(key + 8 * i);
+    acc[i ^ 1] += data_val;
+    acc[i] += (data_key & 0xffffffff) * (data_key >> 32);
+  }
+}
+
+void scramble_scalar(u64* acc, const u8* key) {
+  for (int i = 0; i < 8; i++) {
+    u64 x = acc[i];
+    x ^= x >> 47;
+    x ^= read64(key + 8 * i);
+    acc[i] = x * PRIME32_1;
+  }
+}
+
+#if defined(HASH_USE_AVX2)
+void accumulate_stripe_simd(u64* acc, const u8* data, const u8* key) {
+  for (int i = 0; i < 2; i++) {
+    __m256i* acc_vec = (__m256i*)acc + i;
+    __m256i a = _mm256_loadu_si256(acc_vec);
+    __m256i data_vec = _mm256_loadu_si256((const __m256i*)data + i);
+    __m256i key_vec = _mm256_loadu_si256((const __m256i*)key + i);
+    __m256i data_key = _mm256_xor_si256(data_vec, key_vec);
+    __m256i data_key_hi = _mm256_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+    __m256i product = _mm256_mul_epu32(data_key, data_key_hi);
+    __m256i data_swap = _mm256_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+    a = _mm256_add_epi64(a, data_swap);
+    _mm256_storeu_si256(acc_vec, _mm256_add_epi64(a, product));
+  }
+}
+
+void scramble_simd(u64* acc, const u8* key) {
+  const __m256i prime = _mm256_set1_epi32((int)PRIME32_1);
+  for (int i = 0; i < 2; i++) {
+    __m256i* acc_vec = (__m256i*)acc + i;
+    __m256i a = _mm256_loadu_si256(acc_vec);
+    a = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+    a = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)key + i));
+    // 64-bit multiply by a 32-bit constant, as two 32x32->64 multiplies.
+    __m256i a_hi = _mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1));
+    __m256i product_lo = _mm256_mul_epu32(a, prime);
+    __m256i product_hi = _mm256_mul_epu32(a_hi, prime);
+    _mm256_storeu_si256(acc_vec, _mm256_add_epi64(product_lo, _mm256_slli_epi64(product_hi, 32)));
+  }
+}
+#elif defined(HASH_USE_SSE2)
+void accumulate_stripe_simd(u64* acc, const u8* data, const u8* key) {
+  for (int i = 0; i < 4; i++) {
+    __m128i* acc_vec = (__m128i*)acc + i;
+    __m128i a = _mm_loadu_si128(acc_vec);
+    __m128i data_vec = _mm_loadu_si128((const __m128i*)data + i);
+    __m128i key_vec = _mm_loadu_si128((const __m128i*)key + i);
+    __m128i data_key = _mm_xor_si128(data_vec, key_vec);
+    __m128i data_key_hi = _mm_shuffle_epi32(data_key, _MM_SHUFFLE(0, 3, 0, 1));
+    __m128i product = _mm_mul_epu32(data_key, data_key_hi);
+    __m128i data_swap = _mm_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+    a = _mm_add_epi64(a, data_swap);
+    _mm_storeu_si128(acc_vec, _mm_add_epi64(a, product));
+  }
+}
+
+void scramble_simd(u64* acc, const u8* key) {
+  const __m128i prime = _mm_set1_epi32((int)PRIME32_1);
+  for (int i = 0; i < 4; i++) {
+    __m128i* acc_vec = (__m128i*)acc + i;
+    __m128i a = _mm_loadu_si128(acc_vec);
+    a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+    a = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)key + i));
+    // 64-bit multiply by a 32-bit constant, as two 32x32->64 multiplies.
+    __m128i a_hi = _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1));
+    __m128i product_lo = _mm_mul_epu32(a, prime);
+    __m128i product_hi = _mm_mul_epu32(a_hi, prime);
+    _mm_storeu_si128(acc_vec, _mm_add_epi64(product_lo, _mm_slli_epi64(product_hi, 32)));
+  }
+}
+#elif defined(HASH_USE_NEON)
+void accumulate_stripe_simd(u64* acc, const u8* data, const u8* key) {
+  for (int i = 0; i < 4; i++) {
+    uint64x2_t a = vld1q_u64(acc + 2 * i);
+    uint64x2_t data_vec = vreinterpretq_u64_u8(vld1q_u8(data + 16 * i));
+    uint64x2_t key_vec = vreinterpretq_u64_u8(vld1q_u8(key + 16 * i));
+    uint64x2_t data_key = veorq_u64(data_vec, key_vec);
+    uint32x2_t data_key_lo = vmovn_u64(data_key);
+    uint32x2_t data_key_hi = vshrn_n_u64(data_key, 32);
+    a = vaddq_u64(a, vextq_u64(data_vec, data_vec, 1));
+    vst1q_u64(acc + 2 * i, vmlal_u32(a, data_key_lo, data_key_hi));
+  }
+}
+
+void scramble_simd(u64* acc, const u8* key) {
+  const uint32x2_t prime = vdup_n_u32((u32)PRIME32_1);
+  for (int i = 0; i < 4; i++) {
+    uint64x2_t a = vld1q_u64(acc + 2 * i);
+    a = veorq_u64(a, vshrq_n_u64(a, 47));
+    a = veorq_u64(a, vreinterpretq_u64_u8(vld1q_u8(key + 16 * i)));
+    // 64-bit multiply by a 32-bit constant, as two 32x32->64 multiplies.
+    uint32x2_t a_lo = vmovn_u64(a);
+    uint32x2_t a_hi = vshrn_n_u64(a, 32);
+    uint64x2_t product_hi = vshlq_n_u64(vmull_u32(a_hi, prime), 32);
+    vst1q_u64(acc + 2 * i, vmlal_u32(product_hi, a_lo, prime));
+  }
+}
+#else
+void accumulate_stripe_simd(u64* acc, const u8* data, const u8* key) {
+  accumulate_stripe_scalar(acc, data, key);
+}
+
+void scramble_simd(u64* acc, const u8* key) {
+  scramble_scalar(acc, key);
+}
+#endif
+
+template <bool simd>
+void accumulate_stripe(u64* acc, const u8* data, const u8* key) {
+  if constexpr (simd) {
+    accumulate_stripe_simd(acc, data, key);
+  } else {
+    accumulate_stripe_scalar(acc, data, key);
+  }
+}
+
+template <bool simd>
+void scramble(u64* acc, const u8* key) {
+  if constexpr (simd) {
+    scramble_simd(acc, key);
+  } else {
+    scramble_scalar(acc, key);
+  }
+}
+
+/*!
+ * Accumulate stripe_count stripes, scrambling at the end of each block. stripes_in_block is how
+ * far into the current block the first one is, and is updated.
+ */
+template <bool simd>
+void accumulate(u64* acc,
+                const u8* data,
+                size_t stripe_count,
+                const u8* secret,
+                size_t* stripes_in_block) {
+  for (size_t i = 0; i < stripe_count; i++) {
+    accumulate_stripe<simd>(acc, data + i * kStripeSize, secret + 8 * *stripes_in_block);
+    if (++*stripes_in_block == kStripesPerBlock) {
+      scramble<simd>(acc, secret + kScrambleSecretOffset);
+      *stripes_in_block = 0;
+    }
+  }
+}
+
+u64 merge_acc(const u64* acc, const u8* key, u64 start) {
+  u64 result = start;
+  for (int i = 0; i < 4; i++) {
+    result += mul128_fold64(acc[2 * i] ^ read64(key + 16 * i),
+                            acc[2 * i + 1] ^ read64(key + 16 * i + 8));
+  }
+  return avalanche(result);
+}
+
+u64 merge_acc64(const u64* acc, const u8* secret, size_t size) {
+  return merge_acc(acc, secret + kMergeSecretOffsetLo, size * PRIME64_1);
+}
+
+Hash128 merge_acc128(const u64* acc, const u8* secret, size_t size) {
+  return {merge_acc(acc, secret + kMergeSecretOffsetLo, size * PRIME64_1),
+          merge_acc(acc, secret + kMergeSecretOffsetHi, ~(size * PRIME64_2))};
+}
+
+/*!
+ * The accumulators after all of a long input: the stripes before the last byte as usual, then the
+ * last 64 bytes (which can overlap the previous stripe) with their own key.
+ */
+template <bool simd>
+void hash_long_acc(u64* acc, const u8* data, size_t size, const u8* secret) {
+  init_acc(acc);
+  size_t stripes_in_block = 0;
+  accumulate<simd>(acc, data, (size - 1) / kStripeSize, secret, &stripes_in_block);
+  accumulate_stripe<simd>(acc, data + size - kStripeSize, secret + kLastStripeSecretOffset);
+}
+
+const u8* secret_for_seed(u64 seed, u8* storage) {
+  if (seed == 0) {
+    return kSecret.data();
+  }
+  derive_secret(storage, seed);
+  return storage;
+}
+
+template <bool simd>
+u64 hash64_impl(const void* data, size_t size, u64 seed) {
+  const u8* bytes = (const u8*)data;
+  if (size <= kShortInputMax) {
+    return hash_short(bytes, size, seed);
+  }
+  u8 secret_storage[kHashSecretSize];
+  const u8* secret = secret_for_seed(seed, secret_storage);
+  alignas(32) u64 acc[8];
+  hash_long_acc<simd>(acc, bytes, size, secret);
+  return merge_acc64(acc, secret, size);
+}
+
+}  // namespace
+
+u64 hash64(const void* data, size_t size, u64 seed) {
+  return hash64_impl<true>(data, size, seed);
+}
+
+u64 hash64_scalar(const void* data, size_t size, u64 seed) {
+  return hash64_impl<false>(data, size, seed);
+}
+
+Hash128 hash128(const void* data, size_t size, u64 seed) {
+  const u8* bytes = (const u8*)data;
+  if (size <= kShortInputMax) {
+    return hash128_short(bytes, size, seed);
+  }
+  u8 secret_storage[kHashSecretSize];
+  const u8* secret = secret_for_seed(seed, secret_storage);
+  alignas(32) u64 acc[8];
+  hash_long_acc<true>(acc, bytes, size, secret);
+  return merge_acc128(acc, secret, size);
+}
+
+////////////////////
+// Hasher
+////////////////////
+
+/*
+ * The buffer holds the input that hasn't been accumulated yet. It's only accumulated once more
+ * input arrives, so at the end there's at least one byte left for the last stripe. If that's less
+ * than a stripe, the rest of the last stripe comes from the end of the buffer, which always holds
+ * the end of what was accumulated before.
+ */
+
+Hasher::Hasher(u64 seed) : m_seed(seed) {
+  init_acc(m_acc);
+  if (seed == 0) {
+    memcpy(m_secret, kSecret.data(), kHashSecretSize);
+  } else {
+    derive_secret(m_secret, seed);
+  }
+}
+
+void Hasher::consume(const u8* data, size_t stripe_count) {
+  accumulate<true>(m_acc, data, stripe_count, m_secret, &m_stripes_in_block);
+}
+
+void Hasher::update(const void* data, size_t size) {
+  const u8* input = (const u8*)data;
+  m_total_size += size;
+
+  // fits in the buffer, with nothing after it yet.
+  if (size <= kBufferSize - m_buffered) {
+    memcpy(m_buffer + m_buffered, input, size);
+    m_buffered += size;
+    return;
+  }
+
+  // the buffer gets full, and there's more input after it.
+  if (m_buffered) {
+    size_t fill = kBufferSize - m_buffered;
+    memcpy(m_buffer + m_buffered, input, fill);
+    input += fill;
+    size -= fill;
+    consume(m_buffer, kBufferSize / kStripeSize);
+    m_buffered = 0;
+  }
+
+  // accumulate directly from the input, leaving at least one byte.
+  if (size > kBufferSize) {
+    size_t chunks = (size - 1) / kBufferSize;
+    consume(input, chunks * (kBufferSize / kStripeSize));
+    input += chunks * kBufferSize;
+    size -= chunks * kBufferSize;
+    memcpy(m_buffer + kBufferSize - kStripeSize, input - kStripeSize, kStripeSize);
+  }
+
+  memcpy(m_buffer, input, size);
+  m_buffered = size;
+}
+
+void Hasher::final_acc(u64* acc) const {
+  memcpy(acc, m_acc, sizeof(m_acc));
+  size_t stripes_in_block = m_stripes_in_block;
+  accumulate<true>(acc, m_buffer, (m_buffered - 1) / kStripeSize, m_secret, &stripes_in_block);
+  u8 last_stripe[kStripeSize];
+  if (m_buffered >= kStripeSize) {
+    memcpy(last_stripe, m_buffer + m_buffered - kStripeSize, kStripeSize);
+  } else {
+    size_t from_before = kStripeSize - m_buffered;
+    memcpy(last_stripe, m_buffer + kBufferSize - from_before, from_before);
+    memcpy(last_stripe + from_before, m_buffer, m_buffered);
+  }
+  accumulate_stripe<true>(acc, last_stripe, m_secret + kLastStripeSecretOffset);
+}
+
+u64 Hasher::digest64() const {
+  if (m_total_size <= kShortInputMax) {
+    return hash_short(m_buffer, m_total_size, m_seed);
+  }
+  alignas(32) u64 acc[8];
+  final_acc(acc);
+  return merge_acc64(acc, m_secret, m_total_size);
+}
+
+Hash128 Hasher::digest128() const {
+  if (m_total_size <= kShortInputMax) {
+    return hash128_short(m_buffer, m_total_size, m_seed);
+  }
+  alignas(32) u64 acc[8];
+  final_acc(acc);
+  return merge_acc128(acc, m_secret, m_total_size);
+}
+
+}  // namespace hash_util
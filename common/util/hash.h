@@ -0,0 +1,74 @@
+#pragma once
+
+/*!
+ * @file hash.h
+ * A fast non-cryptographic 64 and 128-bit hash, for cache keys and content deduplication.
+ *
+ * It's built like XXH3: eight 64-bit accumulators take a 64-byte stripe at a time with 32x32->64
+ * multiplies, and get scrambled after every 1 KB. That part runs as two (SSE), four (AVX2) or two
+ * (NEON) lanes at a time, and gives the same result as the scalar version, so hashes are the same
+ * on every platform. Short inputs use a few 64x64->128 multiplies instead.
+ *
+ * It's not compatible with XXH3 (or anything else) and may change, so don't store these hashes
+ * anywhere that outlives a cache.
+ */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace hash_util {
+
+struct Hash128 {
+  u64 lo = 0;
+  u64 hi = 0;
+  bool operator==(const Hash128& other) const { return lo == other.lo && hi == other.hi; }
+  bool operator!=(const Hash128& other) const { return !(*this == other); }
+};
+
+u64 hash64(const void* data, size_t size, u64 seed = 0);
+Hash128 hash128(const void* data, size_t size, u64 seed = 0);
+
+inline u64 hash64(std::string_view str, u64 seed = 0) {
+  return hash64(str.data(), str.size(), seed);
+}
+
+// the same as hash64, without SIMD. For testing.
+u64 hash64_scalar(const void* data, size_t size, u64 seed = 0);
+
+constexpr size_t kHashSecretSize = 192;
+
+/*!
+ * Hash data that arrives in pieces. The result is the same as hashing all the pieces back to back
+ * with hash64/hash128.
+ */
+class Hasher {
+ public:
+  explicit Hasher(u64 seed = 0);
+  void update(const void* data, size_t size);
+  void update(std::string_view str) { update(str.data(), str.size()); }
+  template <typename T>
+  void update_pod(const T& x) {
+    update(&x, sizeof(T));
+  }
+  u64 digest64() const;
+  Hash128 digest128() const;
+
+ private:
+  static constexpr size_t kBufferSize = 256;
+
+  void consume(const u8* data, size_t stripe_count);
+  void final_acc(u64* acc) const;
+
+  u64 m_seed;
+  u64 m_acc[8];
+  u8 m_secret[kHashSecretSize];
+  u8 m_buffer[kBufferSize];
+  size_t m_buffered = 0;
+  size_t m_stripes_in_block = 0;
+  u64 m_total_size = 0;
+};
+
+}  // namespace hash_util
@@ -1,7 +1,8 @@
 #include "json_util.h"
 
+#include <algorithm>
+
 #include "common/log/log.h"
-#include "common/util/Assert.h"
 
 /*!
  * Strip out // and / * comments
@@ -10,66 +11,45 @@
  */
 std::string strip_cpp_style_comments(const std::string& input) {
   std::string output;
+  output.reserve(input.size());
 
-  enum State { NORMAL, BLOCK_COMMENT, LINE_COMMENT, STRING } state = NORMAL;
-
-  for (size_t i = 0; i < input.size(); i++) {
-    char c = input[i];
-    char next = i < (input.size() - 1) ? input[i + 1] : '\0';
-    char prev = i > 0 ? input[i - 1] : '\0';
-
-    switch (state) {
-      case NORMAL:
-        if (c == '/' && next == '*') {
-          // Normal -> block
-          state = BLOCK_COMMENT;
-          i++;  // skip over *
-        } else if (c == '/' && next == '/') {
-          // Normal -> line
-          state = LINE_COMMENT;
-          i++;
-        } else if (c == '"') {
-          // Normal -> string
-          state = STRING;
-          output.push_back(c);
-        } else {
-          // Normal -> normal
-          output.push_back(c);
-        }
-        break;
-      case BLOCK_COMMENT:
-        if (c == '*' && next == '/') {
-          // Block -> normal
-          state = NORMAL;
-          i++;
-        }
-        // otherwise stay in block comment
-        break;
-      case LINE_COMMENT:
-        if (c == '\n') {
-          state = NORMAL;
-          output.push_back(c);
-        }
-        break;
-      case STRING:
-        if (c == '"' && prev != '\\') {
-          state = NORMAL;
+  // everything that isn't a comment is copied a run at a time, starting here.
+  size_t run_start = 0;
+  size_t i = 0;
+  while (i < input.size()) {
+    i = input.find_first_of("/\"", i);
+    if (i == std::string::npos) {
+      break;
+    }
+    const char next = i + 1 < input.size() ? input[i + 1] : '\0';
+    if (input[i] == '"') {
+      // skip to the end of the string
+      size_t end = i;
+      do {
+        end = input.find('"', end + 1);
+        if (end == std::string::npos) {
+          throw std::runtime_error("strip_cpp_style_comments ended in a string.");
         }
-        output.push_back(c);
-        break;
-      default:
-        ASSERT(false);
+      } while (input[end - 1] == '\\');
+      i = end + 1;
+    } else if (next == '*') {
+      output.append(input, run_start, i - run_start);
+      size_t end = input.find("*/", i + 2);
+      if (end == std::string::npos) {
+        throw std::runtime_error("strip_cpp_style_comments ended in a block comment");
+      }
+      i = end + 2;
+      run_start = i;
+    } else if (next == '/') {
+      // the newline at the end is kept
+      output.append(input, run_start, i - run_start);
+      i = std::min(input.find('\n', i + 2), input.size());
+      run_start = i;
+    } else {
+      i++;
     }
   }
-
-  if (state == BLOCK_COMMENT) {
-    throw std::runtime_error("strip_cpp_style_comments ended in a block comment");
-  }
-
-  if (state == STRING) {
-    throw std::runtime_error("strip_cpp_style_comments ended in a string.");
-  }
-
+  output.append(input, run_start, std::string::npos);
   return output;
 }
 
@@ -39,6 +39,9 @@ size_t get_peak_rss() {
 #ifdef _WIN32
 // windows has a __cpuid
 #include <intrin.h>
+u64 xgetbv0() {
+  return _xgetbv(0);
+}
 #elif __x86_64__
 // using int to be compatible with msvc's intrinsic
 void __cpuidex(int result[4], int eax, int ecx) {
@@ -46,6 +49,11 @@ void __cpuidex(int result[4], int eax, int ecx) {
       : "=a"(result[0]), "=b"(result[1]), "=c"(result[2]), "=d"(result[3])
       : "0"(eax), "2"(ecx));
 }
+u64 xgetbv0() {
+  u32 eax, edx;
+  asm("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((u64)edx << 32) | eax;
+}
 #else
 // for now, just return 0's.
 void __cpuidex(int result[4], int eax, int ecx) {
@@ -54,6 +62,9 @@ void __cpuidex(int result[4], int eax, int ecx) {
     result[i] = 0;
   }
 }
+u64 xgetbv0() {
+  return 0;
+}
 #endif
 
 CpuInfo gCpuInfo;
@@ -97,6 +108,17 @@ void setup_cpu_info() {
     int result[4];
     __cpuidex(result, 1, 0);
     gCpuInfo.has_avx = result[2] & (1 << 28);
+    gCpuInfo.has_fma = result[2] & (1 << 12);
+
+    // the CPU supporting AVX isn't enough, the OS also has to save the upper halves of the
+    // registers. Code that picks an AVX2 path at runtime relies on this.
+    const bool has_osxsave = result[2] & (1 << 27);
+    const bool os_saves_ymm = has_osxsave && (xgetbv0() & 0x6) == 0x6;
+    if (!os_saves_ymm) {
+      gCpuInfo.has_avx = false;
+      gCpuInfo.has_avx2 = false;
+      gCpuInfo.has_fma = false;
+    }
   }
 
   printf("-------- CPU Information --------\n");
@@ -104,6 +126,7 @@ void setup_cpu_info() {
   printf(" Model: %s\n", gCpuInfo.model.c_str());
   printf(" AVX  : %s\n", gCpuInfo.has_avx ? "true" : "false");
   printf(" AVX2 : %s\n", gCpuInfo.has_avx2 ? "true" : "false");
+  printf(" FMA  : %s\n", gCpuInfo.has_fma ? "true" : "false");
   fflush(stdout);
 
   gCpuInfo.initialized = true;
@@ -15,10 +15,9 @@
  * that round-trips through a properly implemented string -> float conversion.
  */
 std::string float_to_string(float value, bool append_trailing_decimal) {
-  constexpr int buff_size = 128;
-  char buff[buff_size];
-  float_to_cstr(value, buff, append_trailing_decimal);
-  return {buff};
+  char buff[64];
+  int length = float_to_cstr(value, buff, append_trailing_decimal);
+  return std::string(buff, length);
 }
 
 /*!
@@ -94,119 +93,110 @@ std::string seconds_to_string(s64 value, bool append_trailing_decimal) {
   return fixed_point_to_string(value, TICKS_PER_SECOND, append_trailing_decimal);
 }
 
+namespace {
+// "00" to "99", for writing two digits at a time.
+constexpr char kDigitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+int count_digits(u32 value) {
+  int count = 1;
+  while (value >= 10) {
+    value /= 10;
+    count++;
+  }
+  return count;
+}
+
+// write the digits of value to the num_digits chars at buffer.
+void write_digits(u32 value, char* buffer, int num_digits) {
+  char* out = buffer + num_digits;
+  while (value >= 100) {
+    u32 pair = (value % 100) * 2;
+    value /= 100;
+    *--out = kDigitPairs[pair + 1];
+    *--out = kDigitPairs[pair];
+  }
+  if (value >= 10) {
+    *--out = kDigitPairs[value * 2 + 1];
+    *--out = kDigitPairs[value * 2];
+  } else {
+    *--out = '0' + value;
+  }
+}
+
+char* write_zeros(char* out, int count) {
+  for (int i = 0; i < count; i++) {
+    *out++ = '0';
+  }
+  return out;
+}
+}  // namespace
+
+/*!
+ * Write the float_to_string string to buffer, which must have room for 64 chars.
+ * Returns the length of the string, not including the null terminator.
+ */
 int float_to_cstr(float value, char* buffer, bool append_trailing_decimal) {
   ASSERT(std::isfinite(value));
-  // dragonbox gives us:
-  //  - an integer, representing the decimal value
-  //  - sign
-  //  - exponent
-
-  int i = 0;
+  char* out = buffer;
 
   // the exponent/significand representation of dragonbox is ambiguous with how it represents 0,
   // so just handle that as a special case
   if (value == 0) {
-    buffer[i++] = '0';
+    *out++ = '0';
     if (append_trailing_decimal) {
-      buffer[i++] = '.';
-      buffer[i++] = '0';
+      *out++ = '.';
+      *out++ = '0';
     }
-    buffer[i++] = '\0';
+    *out = '\0';
+    return out - buffer;
   }
 
+  // dragonbox gives us:
+  //  - an integer, representing the decimal value (at most 9 digits for a float)
+  //  - sign
+  //  - exponent
   auto decimal = jkj::dragonbox::to_decimal(value);
+  const u32 significand = decimal.significand;
+  const int num_digits = count_digits(significand);
 
-  // in all cases, we need to convert the decimal to characters.
-  char digit_buff[64];
-  int num_digits = 0;
-  u64 significand = decimal.significand;
-  while (significand) {
-    digit_buff[num_digits++] = '0' + (significand % 10);
-    significand /= 10;
+  if (decimal.is_negative) {
+    *out++ = '-';
   }
 
   if (decimal.exponent >= 0) {
     // needs 0 or more trailing zeros before decimal (no nonzeros after decimal).
-
-    // print in four parts:
-    // negative sign | digits | 000's | .0
-
-    // part 1
-    if (decimal.is_negative) {
-      buffer[i++] = '-';
-    }
-
-    // part 2
-    for (int digit = 0; digit < num_digits; digit++) {
-      buffer[i++] = digit_buff[num_digits - (digit + 1)];
-    }
-
-    // part 3
-    for (int j = 0; j < decimal.exponent; j++) {
-      buffer[i++] = '0';
-    }
-
-    // part 4
+    // digits | 000's | .0
+    write_digits(significand, out, num_digits);
+    out = write_zeros(out + num_digits, decimal.exponent);
     if (append_trailing_decimal) {
-      buffer[i++] = '.';
-      buffer[i++] = '0';
+      *out++ = '.';
+      *out++ = '0';
     }
-    buffer[i++] = '\0';
+  } else if (num_digits <= -decimal.exponent) {
+    // all after the decimal
+    // 0. | 000's | digits
+    *out++ = '0';
+    *out++ = '.';
+    out = write_zeros(out, -decimal.exponent - num_digits);
+    write_digits(significand, out, num_digits);
+    out += num_digits;
   } else {
-    // some nonzero digits after decimal.
-
-    if (num_digits <= -decimal.exponent) {
-      // all after the decimal
-      // negative sign | 0. | 000's | digits
-
-      // part 1
-      if (decimal.is_negative) {
-        buffer[i++] = '-';
-      }
-
-      // part 2
-      buffer[i++] = '0';
-      buffer[i++] = '.';
-
-      // part 3
-      int zeros = -decimal.exponent - num_digits;
-      for (int j = 0; j < zeros; j++) {
-        buffer[i++] = '0';
-      }
-
-      // part 4
-      for (int digit = 0; digit < num_digits; digit++) {
-        buffer[i++] = digit_buff[num_digits - (digit + 1)];
-      }
-      buffer[i++] = '\0';
-
-    } else {
-      // some before, some after.
-      // negative sign | digits | . | digits
-
-      // part 1
-      if (decimal.is_negative) {
-        buffer[i++] = '-';
-      }
-
-      // part 2
-      int digits_before_decimal = num_digits + decimal.exponent;
-      int digit = 0;
-      for (; digit < digits_before_decimal; digit++) {
-        buffer[i++] = digit_buff[num_digits - (digit + 1)];
-      }
-
-      // part 3
-      buffer[i++] = '.';
-
-      // part 4
-      for (; digit < num_digits; digit++) {
-        buffer[i++] = digit_buff[num_digits - (digit + 1)];
-      }
-      buffer[i++] = '\0';
+    // some before, some after.
+    // digits | . | digits
+    // write them all, then shift the ones after the decimal over to make room for the point.
+    const int digits_before_decimal = num_digits + decimal.exponent;
+    write_digits(significand, out, num_digits);
+    for (int digit = num_digits; digit > digits_before_decimal; digit--) {
+      out[digit] = out[digit - 1];
     }
+    out[digits_before_decimal] = '.';
+    out += num_digits + 1;
   }
-  return i;
+  *out = '\0';
+  return out - buffer;
 }
 
 bool proper_float(float value) {
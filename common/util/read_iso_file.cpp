@@ -1,9 +1,16 @@
 #include "read_iso_file.h"
 
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <future>
+
 #include "common/common_types.h"
 #include "common/log/log.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/Timer.h"
 
 #include "third-party/zstd/lib/common/xxhash.h"
 
@@ -33,6 +40,8 @@ void IsoFile::Entry::print(std::string* result, const std::string& prefix) const
 
 namespace {
 constexpr int SECTOR_SIZE = 0x800;
+// file data that has been read, but not written yet. Reading stops until the writes catch up.
+constexpr size_t MAX_BYTES_IN_FLIGHT = 256 * 1024 * 1024;
 
 int fseek_64(FILE* fp, u64 offset, int origin) {
 #ifdef _WIN32
@@ -54,25 +63,42 @@ T read_file(FILE* fp, u32 sector, u32 offset_in_sector) {
   return result;
 }
 
+void read_bytes(FILE* fp, u64 offset, void* dst, size_t size) {
+  if (fseek_64(fp, offset, SEEK_SET)) {
+    ASSERT_MSG(false, "Failed to fseek iso");
+  }
+  if (size && fread(dst, size, 1, fp) != 1) {
+    ASSERT_MSG(false, "Failed to fread iso");
+  }
+}
+
 void add_from_dir(FILE* fp, u32 sector, u32 size, IsoFile::Entry* parent) {
+  // read the whole directory at once, the records are small. The padding past the last record
+  // makes the reads of a truncated record safe.
+  std::vector<u8> dir(size + 0x200, 0);
+  read_bytes(fp, u64(sector) * SECTOR_SIZE, dir.data(), size);
+  auto get_u32 = [&](u32 offset) {
+    u32 result;
+    memcpy(&result, dir.data() + offset, sizeof(u32));
+    return result;
+  };
+
   u32 offset = 0;
   while (offset < size) {
-    if (!read_file<u8>(fp, sector, offset)) {
+    if (!dir[offset]) {
       offset = (offset & ~(SECTOR_SIZE - 1)) + SECTOR_SIZE;
       continue;
     }
-    u8 record_size = read_file<u8>(fp, sector, offset);
-    u8 kind = read_file<u8>(fp, sector, offset + 0x21);
+    u8 record_size = dir[offset];
+    u8 kind = dir[offset + 0x21];
     if ((kind != 0) && (kind != 1)) {
       auto& entry = parent->children.emplace_back();
-      u32 extent = read_file<u32>(fp, sector, offset + 2);
-      u32 dir_or_file_size = read_file<u32>(fp, sector, offset + 10);
-      u32 name_len = read_file<u8>(fp, sector, offset + 32);
-      u8 c0 = read_file<u8>(fp, sector, offset + name_len + 0x1f);
-      u8 c1 = read_file<u8>(fp, sector, offset + name_len + 0x20);
-      for (u32 i = 0; i < name_len; i++) {
-        entry.name.push_back(read_file<char>(fp, sector, offset + 0x21 + i));
-      }
+      u32 extent = get_u32(offset + 2);
+      u32 dir_or_file_size = get_u32(offset + 10);
+      u32 name_len = dir[offset + 32];
+      u8 c0 = dir[offset + name_len + 0x1f];
+      u8 c1 = dir[offset + name_len + 0x20];
+      entry.name.assign((const char*)dir.data() + offset + 0x21, name_len);
       entry.is_dir = (c0 != ';' || c1 != '1');
       if (entry.is_dir) {
         add_from_dir(fp, extent, dir_or_file_size, &entry);
@@ -87,34 +113,25 @@ void add_from_dir(FILE* fp, u32 sector, u32 size, IsoFile::Entry* parent) {
   }
 }
 
-void unpack_entry(FILE* fp,
-                  IsoFile& iso,
-                  const IsoFile::Entry& entry,
-                  const fs::path& dest,
-                  bool print_progress) {
+struct FileToUnpack {
+  const IsoFile::Entry* entry;
+  fs::path path;
+};
+
+/*!
+ * Create the directories under entry, and list its files.
+ */
+void collect_files(const IsoFile::Entry& entry,
+                   const fs::path& dest,
+                   std::vector<FileToUnpack>* files) {
   fs::path path_to_entry = dest / entry.name;
   if (entry.is_dir) {
     fs::create_directory(path_to_entry);
     for (const auto& child : entry.children) {
-      unpack_entry(fp, iso, child, path_to_entry, print_progress);
+      collect_files(child, path_to_entry, files);
     }
   } else {
-    if (print_progress) {
-      lg::info("Extracting {}...", entry.name);
-    }
-    std::vector<u8> buffer(entry.size);
-    if (fseek_64(fp, entry.offset_in_file, SEEK_SET)) {
-      ASSERT_MSG(false, "Failed to fseek iso when unpacking");
-    }
-    if (fread(buffer.data(), buffer.size(), 1, fp) != 1) {
-      ASSERT_MSG(false, "Failed to fread iso when unpacking");
-    }
-    file_util::write_binary_file(path_to_entry.string(), buffer.data(), buffer.size());
-    iso.files_extracted++;
-    if (iso.shouldHash) {
-      auto hash = XXH64(buffer.data(), buffer.size(), 0);
-      iso.hashes.push_back(hash);
-    }
+    files->push_back({&entry, path_to_entry});
   }
 }
 }  // namespace
@@ -128,8 +145,63 @@ IsoFile find_files_in_iso(FILE* fp) {
   return result;
 }
 
+/*!
+ * Extract every file. The files are read in the order they are on the disc, so the reads are one
+ * pass through the image, and the files are written and hashed on the thread pool while the next
+ * ones are read.
+ */
 void unpack_iso_files(FILE* fp, IsoFile& layout, const fs::path& dest, bool print_progress) {
-  unpack_entry(fp, layout, layout.root, dest, print_progress);
+  Timer timer;
+  std::vector<FileToUnpack> files;
+  collect_files(layout.root, dest, &files);
+  std::stable_sort(files.begin(), files.end(), [](const auto& a, const auto& b) {
+    return a.entry->offset_in_file < b.entry->offset_in_file;
+  });
+
+  struct PendingWrite {
+    std::future<u64> hash;
+    size_t size;
+  };
+  std::deque<PendingWrite> pending;
+  size_t bytes_in_flight = 0;
+  size_t total_bytes = 0;
+  auto finish_oldest = [&]() {
+    auto& write = pending.front();
+    u64 hash = ThreadPool::global().wait(write.hash);
+    if (layout.shouldHash) {
+      layout.hashes.push_back(hash);
+    }
+    layout.files_extracted++;
+    bytes_in_flight -= write.size;
+    pending.pop_front();
+  };
+
+  for (const auto& file : files) {
+    if (print_progress) {
+      lg::info("Extracting {}...", file.entry->name);
+    }
+    std::vector<u8> buffer(file.entry->size);
+    read_bytes(fp, file.entry->offset_in_file, buffer.data(), buffer.size());
+    total_bytes += buffer.size();
+    bytes_in_flight += buffer.size();
+    const bool hash = layout.shouldHash;
+    pending.push_back({ThreadPool::global().submit(
+                           [path = file.path, buffer = std::move(buffer), hash]() -> u64 {
+                             file_util::write_binary_file(path, buffer.data(), buffer.size());
+                             return hash ? XXH64(buffer.data(), buffer.size(), 0) : 0;
+                           }),
+                       file.entry->size});
+    while (bytes_in_flight > MAX_BYTES_IN_FLIGHT) {
+      finish_oldest();
+    }
+  }
+  while (!pending.empty()) {
+    finish_oldest();
+  }
+
+  const double seconds = timer.getSeconds();
+  lg::info("Extracted {} files, {:.1f} MB in {:.2f}s ({:.1f} MB/s)", layout.files_extracted,
+           total_bytes / (1024. * 1024.), seconds, total_bytes / (1024. * 1024.) / seconds);
 }
 
 IsoFile unpack_iso_files(FILE* fp,
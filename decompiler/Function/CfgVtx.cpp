@@ -429,6 +429,16 @@ std::string ControlFlowGraph::to_dot() {
   return result;
 }
 
+/*!
+ * Drop the nodes that have been claimed by a parent from m_top_level. Not done while the list is
+ * being iterated over.
+ */
+void ControlFlowGraph::compact_top_level() {
+  if (!m_top_level_iterations) {
+    std::erase_if(m_top_level, [](CfgVtx* x) { return x->parent != nullptr; });
+  }
+}
+
 /*!
  * Is this CFG fully resolved?  Did we succeed in decoding the control flow?
  */
@@ -441,7 +451,7 @@ bool ControlFlowGraph::is_fully_resolved() {
  */
 int ControlFlowGraph::get_top_level_vertices_count() {
   int count = 0;
-  for (auto* x : m_node_pool) {
+  for (auto* x : m_top_level) {
     if (!x->parent && x != entry() && x != exit()) {
       count++;
     }
@@ -454,7 +464,7 @@ int ControlFlowGraph::get_top_level_vertices_count() {
  */
 CfgVtx* ControlFlowGraph::get_single_top_level() {
   ASSERT(get_top_level_vertices_count() == 1);
-  for (auto* x : m_node_pool) {
+  for (auto* x : m_top_level) {
     if (!x->parent && x != entry() && x != exit()) {
       return x;
     }
@@ -472,7 +482,7 @@ goos::Object ControlFlowGraph::to_form() {
     return get_single_top_level()->to_form();
   } else {
     std::vector<goos::Object> forms = {pretty_print::to_symbol("ungrouped")};
-    for (auto* x : m_node_pool) {
+    for (auto* x : m_top_level) {
       if (!x->parent && x != entry() && x != exit()) {
         forms.push_back(x->to_form());
       }
@@ -343,13 +343,19 @@ class ControlFlowGraph {
    */
   template <typename Func>
   void for_each_top_level_vtx(Func f) {
-    for (auto* x : m_node_pool) {
+    compact_top_level();
+    // vertices allocated by f aren't visited until the next call.
+    size_t end = m_top_level.size();
+    m_top_level_iterations++;
+    for (size_t i = 0; i < end; i++) {
+      auto* x = m_top_level[i];
       if (!x->parent && x != entry() && x != exit()) {
         if (!f(x)) {
-          return;
+          break;
         }
       }
     }
+    m_top_level_iterations--;
   }
 
   EntryVtx* entry() { return m_entry; }
@@ -362,6 +368,7 @@ class ControlFlowGraph {
   T* alloc(Args&&... args) {
     T* new_obj = new T(std::forward<Args>(args)...);
     m_node_pool.push_back(new_obj);
+    m_top_level.push_back(new_obj);
     new_obj->uid = m_uid++;
     return new_obj;
   }
@@ -379,8 +386,14 @@ class ControlFlowGraph {
   bool is_goto_end_and_unreachable(CfgVtx* b0, CfgVtx* b1);
   bool is_goto_not_end_and_unreachable(CfgVtx* b0, CfgVtx* b1);
   bool is_infinite_continue(CfgVtx* b0);
+  void compact_top_level();
   std::vector<BlockVtx*> m_blocks;   // all block nodes, in order.
   std::vector<CfgVtx*> m_node_pool;  // all nodes allocated
+  // the nodes that may still be top level, in allocation order. Nodes only ever gain a parent, so
+  // this is m_node_pool minus some nodes that have one. Finding patterns scans this over and over,
+  // and it stays small while m_node_pool keeps growing.
+  std::vector<CfgVtx*> m_top_level;
+  int m_top_level_iterations = 0;
   EntryVtx* m_entry;                 // the entry vertex
   ExitVtx* m_exit;                   // the exit vertex
   int m_uid = 0;
@@ -21,12 +21,13 @@ namespace decompiler {
 ///////////////////
 
 FormPool::~FormPool() {
+  // the arenas free the memory.
   for (auto& x : m_forms) {
-    delete x;
+    x->~Form();
   }
 
   for (auto& x : m_elements) {
-    delete x;
+    x->~FormElement();
   }
 }
 
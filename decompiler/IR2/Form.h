@@ -9,6 +9,7 @@
 #include "common/math/Vector.h"
 #include "common/type_system/TypeSystem.h"
 #include "common/type_system/state.h"
+#include "common/util/MonotonicArena.h"
 
 #include "decompiler/Disasm/DecompilerLabel.h"
 #include "decompiler/Disasm/Register.h"
@@ -2054,52 +2055,57 @@ class CfgVtx;
  * It will clean up everything when it is destroyed.
  * As a result, you don't need to worry about deleting / referencing counting when manipulating
  * a Form graph.
+ *
+ * There's one pool per function, and forms and elements are created in the pool's arenas, so
+ * allocating is a pointer bump and freeing happens all at once. Forms are kept in their own arena,
+ * so they are packed together.
  */
 class FormPool {
  public:
+  FormPool() = default;
+  FormPool(const FormPool&) = delete;
+  FormPool& operator=(const FormPool&) = delete;
+
   template <typename T, class... Args>
   T* alloc_element(Args&&... args) {
-    auto elt = new T(std::forward<Args>(args)...);
-    m_elements.emplace_back(elt);
+    auto elt = m_element_arena.create<T>(std::forward<Args>(args)...);
+    m_elements.push_back(elt);
     return elt;
   }
 
   template <typename T, class... Args>
   Form* alloc_single_element_form(FormElement* parent, Args&&... args) {
-    auto elt = new T(std::forward<Args>(args)...);
-    m_elements.emplace_back(elt);
+    auto elt = alloc_element<T>(std::forward<Args>(args)...);
     auto form = alloc_single_form(parent, elt);
     return form;
   }
 
   template <typename T, class... Args>
   Form* form(Args&&... args) {
-    auto elt = new T(std::forward<Args>(args)...);
-    m_elements.emplace_back(elt);
+    auto elt = alloc_element<T>(std::forward<Args>(args)...);
     auto form = alloc_single_form(nullptr, elt);
     return form;
   }
 
   Form* alloc_single_form(FormElement* parent, FormElement* elt) {
-    auto form = new Form(parent, elt);
+    auto form = m_form_arena.create<Form>(parent, elt);
     m_forms.push_back(form);
     return form;
   }
 
   Form* alloc_sequence_form(FormElement* parent, const std::vector<FormElement*> sequence) {
-    auto form = new Form(parent, sequence);
+    auto form = m_form_arena.create<Form>(parent, sequence);
     m_forms.push_back(form);
     return form;
   }
 
   Form* acquire(std::unique_ptr<Form> form_ptr) {
-    Form* form = form_ptr.release();
-    m_forms.push_back(form);
-    return form;
+    // not from the arena, so it's owned separately.
+    return m_acquired_forms.emplace_back(std::move(form_ptr)).get();
   }
 
   Form* alloc_empty_form() {
-    Form* form = new Form;
+    Form* form = m_form_arena.create<Form>();
     m_forms.push_back(form);
     return form;
   }
@@ -2120,8 +2126,12 @@ class FormPool {
   ~FormPool();
 
  private:
+  MonotonicArena m_form_arena;
+  MonotonicArena m_element_arena;
+  // everything in the arenas, to run the destructors
   std::vector<Form*> m_forms;
   std::vector<FormElement*> m_elements;
+  std::vector<std::unique_ptr<Form>> m_acquired_forms;
   std::unordered_map<const CfgVtx*, Form*> m_vtx_to_form_cache;
 };
 
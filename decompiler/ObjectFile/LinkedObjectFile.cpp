@@ -55,6 +55,12 @@ int LinkedObjectFile::get_label_id_for(int seg, int offset) {
     label.name = "L" + std::to_string(id);
     label_per_seg_by_offset.at(seg)[offset] = id;
     labels.push_back(label);
+    if (m_labels_sorted) {
+      auto& sorted = m_sorted_labels_by_seg.at(seg);
+      auto it = std::upper_bound(sorted.begin(), sorted.end(), offset,
+                                 [&](int off, int lab) { return off < labels.at(lab).offset; });
+      sorted.insert(it, id);
+    }
     return id;
   } else {
     // return an existing label
@@ -78,6 +84,29 @@ int LinkedObjectFile::get_label_at(int seg, int offset) const {
   return kv->second;
 }
 
+/*!
+ * Get the ID of the first label in the given segment that points after offset.
+ * Returns -1 if there is no label after it.
+ */
+int LinkedObjectFile::get_label_after(int seg, int offset) const {
+  if (!m_labels_sorted) {
+    int result = -1;
+    for (int i = 0; i < (int)labels.size(); i++) {
+      const auto& label = labels[i];
+      if (label.target_segment == seg && label.offset > offset &&
+          (result == -1 || label.offset < labels[result].offset)) {
+        result = i;
+      }
+    }
+    return result;
+  }
+
+  const auto& sorted = m_sorted_labels_by_seg.at(seg);
+  auto it = std::upper_bound(sorted.begin(), sorted.end(), offset,
+                             [&](int off, int lab) { return off < labels.at(lab).offset; });
+  return it == sorted.end() ? -1 : *it;
+}
+
 /*!
  * Does this label point to code? Can point to the middle of a function, or the start of a function.
  */
@@ -239,10 +268,13 @@ uint32_t LinkedObjectFile::set_ordered_label_names() {
     return la.target_segment < lb.target_segment;
   });
 
+  m_sorted_labels_by_seg.assign(segments, {});
   for (size_t i = 0; i < indices.size(); i++) {
     auto& label = labels.at(indices[i]);
     label.name = "L" + std::to_string(i + 1);
+    m_sorted_labels_by_seg.at(label.target_segment).push_back(indices[i]);
   }
+  m_labels_sorted = true;
 
   return labels.size();
 }
@@ -457,6 +489,7 @@ void LinkedObjectFile::find_functions(GameVersion version) {
 void LinkedObjectFile::disassemble_functions() {
   for (int seg = 0; seg < segments; seg++) {
     for (auto& function : functions_by_seg.at(seg)) {
+      function.instructions.reserve(function.end_word - function.start_word);
       for (auto word = function.start_word; word < function.end_word; word++) {
         // decode!
         function.instructions.push_back(
@@ -796,7 +829,7 @@ std::string LinkedObjectFile::get_goal_string(int seg, int word_idx, bool with_q
 /*!
  * Return true if the object file contains any functions at all.
  */
-bool LinkedObjectFile::has_any_functions() {
+bool LinkedObjectFile::has_any_functions() const {
   for (auto& fv : functions_by_seg) {
     if (!fv.empty())
       return true;
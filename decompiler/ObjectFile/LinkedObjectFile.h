@@ -30,6 +30,7 @@ class LinkedObjectFile {
   void push_back_word_to_segment(uint32_t word, int segment);
   int get_label_id_for(int seg, int offset);
   int get_label_at(int seg, int offset) const;
+  int get_label_after(int seg, int offset) const;
   bool label_points_to_code(int label_id) const;
   bool pointer_link_word(int source_segment, int source_offset, int dest_segment, int dest_offset);
   void pointer_link_split_word(int source_segment,
@@ -60,7 +61,7 @@ class LinkedObjectFile {
   void process_fp_relative_links();
   std::string print_scripts();
   std::string print_disassembly(bool write_hex);
-  bool has_any_functions();
+  bool has_any_functions() const;
   void append_word_to_string(std::string& dest, const LinkedWord& word) const;
   std::string print_function_disassembly(Function& func,
                                          int seg,
@@ -148,5 +149,8 @@ class LinkedObjectFile {
   bool is_empty_list(int seg, int byte_idx) const;
 
   std::vector<std::unordered_map<int, int>> label_per_seg_by_offset;
+  // label IDs in each segment, sorted by offset. Built by set_ordered_label_names, after linking.
+  std::vector<std::vector<int>> m_sorted_labels_by_seg;
+  bool m_labels_sorted = false;
 };
 }  // namespace decompiler
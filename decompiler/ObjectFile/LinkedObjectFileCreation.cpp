@@ -7,6 +7,7 @@
 #include "LinkedObjectFileCreation.h"
 
 #include <cstring>
+#include <stdexcept>
 
 #include "common/link_types.h"
 #include "common/log/log.h"
@@ -61,6 +62,26 @@ struct LinkHeaderV5 {
   char name[59];                   // 21 (really??)
 };
 
+/*!
+ * The object file data, with the bounds checked at() that the linkers use to read it.
+ */
+class ObjectBytes {
+ public:
+  ObjectBytes(std::span<const u8> data) : m_data(data) {}
+  const u8& at(size_t idx) const {
+    if (idx >= m_data.size()) {
+      throw std::out_of_range(
+          fmt::format("object data index {} out of range ({} bytes)", idx, m_data.size()));
+    }
+    return m_data[idx];
+  }
+  const u8* data() const { return m_data.data(); }
+  size_t size() const { return m_data.size(); }
+
+ private:
+  std::span<const u8> m_data;
+};
+
 // The types of symbol links
 enum class SymbolLinkKind {
   EMPTY_LIST,  // link to the empty list
@@ -72,7 +93,7 @@ enum class SymbolLinkKind {
  * Handle symbol links for a single symbol in a V2/V4 object file.
  */
 static uint32_t c_symlink2(LinkedObjectFile& f,
-                           const std::vector<uint8_t>& data,
+                           ObjectBytes data,
                            uint32_t code_ptr_offset,
                            uint32_t link_ptr_offset,
                            SymbolLinkKind kind,
@@ -156,7 +177,7 @@ static uint32_t c_symlink2(LinkedObjectFile& f,
  * Handle symbol links for a single symbol in a V3 object file.
  */
 static uint32_t c_symlink3(LinkedObjectFile& f,
-                           const std::vector<uint8_t>& data,
+                           ObjectBytes data,
                            uint32_t code_ptr,
                            uint32_t link_ptr,
                            SymbolLinkKind kind,
@@ -226,7 +247,7 @@ static uint32_t c_symlink3(LinkedObjectFile& f,
  * frame and level data is ~10 MB.
  */
 static void link_v2_or_v4(LinkedObjectFile& f,
-                          const std::vector<uint8_t>& data,
+                          ObjectBytes data,
                           const std::string& name,
                           DecompilerTypeSystem& dts,
                           GameVersion version) {
@@ -416,7 +437,7 @@ static void assert_string_empty_after(const char* str, int size) {
 }
 
 static void link_v5(LinkedObjectFile& f,
-                    const std::vector<uint8_t>& data,
+                    ObjectBytes data,
                     const std::string& name,
                     DecompilerTypeSystem& dts) {
   auto header = (const LinkHeaderV5*)(&data.at(0));
@@ -635,7 +656,7 @@ static void link_v5(LinkedObjectFile& f,
 }
 
 static void link_v3(LinkedObjectFile& f,
-                    const std::vector<uint8_t>& data,
+                    ObjectBytes data,
                     const std::string& name,
                     DecompilerTypeSystem& dts,
                     GameVersion game_version) {
@@ -825,11 +846,12 @@ static void link_v3(LinkedObjectFile& f,
 /*!
  * Main function to generate LinkedObjectFiles from raw object data.
  */
-LinkedObjectFile to_linked_object_file(const std::vector<uint8_t>& data,
+LinkedObjectFile to_linked_object_file(std::span<const u8> object_data,
                                        const std::string& name,
                                        DecompilerTypeSystem& dts,
                                        GameVersion game_version) {
   LinkedObjectFile result(game_version);
+  ObjectBytes data(object_data);
   const auto* header = (const LinkHeaderCommon*)&data.at(0);
 
   // use appropriate linker
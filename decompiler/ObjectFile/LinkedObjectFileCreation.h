@@ -6,11 +6,13 @@
  * This implements a decoder for the GOAL linking format.
  */
 
+#include <span>
+
 #include "LinkedObjectFile.h"
 
 namespace decompiler {
 class DecompilerTypeSystem;
-LinkedObjectFile to_linked_object_file(const std::vector<uint8_t>& data,
+LinkedObjectFile to_linked_object_file(std::span<const u8> data,
                                        const std::string& name,
                                        DecompilerTypeSystem& dts,
                                        GameVersion game_version);
@@ -150,7 +150,9 @@ ObjectFileDB::ObjectFileDB(const std::vector<fs::path>& _dgos,
 
   lg::info("-Loading {} plain object files...", object_files.size());
   for (auto& obj : object_files) {
-    auto data = file_util::read_binary_file(obj);
+    const auto& mapped = m_mapped_inputs.emplace_back(std::make_unique<MappedFile>(obj));
+    std::span<const u8> data(mapped->data(), mapped->size());
+    std::vector<u8> patched_data;
     auto name = obj_filename_to_name(obj.string());
     if (auto it = config.object_patches.find(name); it != config.object_patches.end()) {
       // print the file CRC
@@ -199,13 +201,15 @@ ObjectFileDB::ObjectFileDB(const std::vector<fs::path>& _dgos,
           lg::error("error patching {} with {} (out {}): {}", name, it->second.target_file,
                     it->second.patch_file, xd3_strerror(xd3_res));
         } else {
-          data.resize(out_sz);
-          memcpy(data.data(), out_buf, data.size());
+          patched_data.resize(out_sz);
+          memcpy(patched_data.data(), out_buf, patched_data.size());
+          data = patched_data;
         }
         free(out_buf);
       }
     }
-    add_obj_from_dgo(name, name, data.data(), data.size(), "NO-XGO", config);
+    add_obj_from_dgo(name, name, data.data(), data.size(), "NO-XGO", config,
+                     !patched_data.empty());
   }
 
   if (config.read_spools) {
@@ -220,7 +224,8 @@ ObjectFileDB::ObjectFileDB(const std::vector<fs::path>& _dgos,
         // append the chunk ID to the full name
         std::string name = obj_name + fmt::format("+{}", i);
         auto& data = reader.get_chunk(i);
-        add_obj_from_dgo(name, name, data.data(), data.size(), "ALLSPOOL", config, obj_name);
+        add_obj_from_dgo(name, name, data.data(), data.size(), "ALLSPOOL", config, true,
+                         obj_name);
       }
     }
   }
@@ -234,7 +239,7 @@ ObjectFileDB::ObjectFileDB(const std::vector<fs::path>& _dgos,
       for (int i = 0; i < reader.chunk_count(); i++) {
         auto name = reader.get_chunk_texture_name(i);
         add_obj_from_dgo(name, name, reader.get_chunk(i).data(), reader.get_chunk(i).size(),
-                         "TEXSPOOL", config, name);
+                         "TEXSPOOL", config, true, name);
       }
     }
   }
@@ -246,7 +251,7 @@ ObjectFileDB::ObjectFileDB(const std::vector<fs::path>& _dgos,
       for (int i = 0; i < reader.chunk_count(); i++) {
         auto name = reader.get_chunk_art_name(i);
         add_obj_from_dgo(name, name, reader.get_chunk(i).data(), reader.get_chunk(i).size(),
-                         "ARTSPOOL", config, name);
+                         "ARTSPOOL", config, true, name);
       }
     }
   }
@@ -292,11 +297,16 @@ void ObjectFileDB::load_map_file(const std::string& map_data) {
  * Load the objects stored in the given DGO into the ObjectFileDB
  */
 void ObjectFileDB::get_objs_from_dgo(const fs::path& filename, const Config& config) {
-  auto dgo_data = file_util::read_binary_file(filename);
+  auto mapped = std::make_unique<MappedFile>(filename);
+  std::span<const u8> dgo_data(mapped->data(), mapped->size());
   stats.total_dgo_bytes += dgo_data.size();
 
-  if (file_util::dgo_header_is_compressed(dgo_data)) {
-    dgo_data = file_util::decompress_dgo(dgo_data);
+  if (dgo_data.size() >= 4 && memcmp(dgo_data.data(), "oZlB", 4) == 0) {
+    // the objects have to point at the decompressed data, so keep that instead of the mapping.
+    dgo_data = m_decompressed_inputs.emplace_back(
+        file_util::decompress_dgo(std::vector<u8>(dgo_data.begin(), dgo_data.end())));
+  } else {
+    m_mapped_inputs.push_back(std::move(mapped));
   }
 
   BinaryReader reader(dgo_data);
@@ -336,7 +346,7 @@ void ObjectFileDB::get_objs_from_dgo(const fs::path& filename, const Config& con
     auto name = get_object_file_name(obj_header.name, reader.here(), obj_header.object_count);
 
     add_obj_from_dgo(name, obj_header.name, reader.here(), obj_header.object_count, dgo_base_name,
-                     config);
+                     config, false);
     reader.ffwd(align16(obj_header.object_count));
   }
 
@@ -394,7 +404,8 @@ bool are_objects_the_same(const std::string& obj_name,
 }
 
 /*!
- * Add an object file to the ObjectFileDB
+ * Add an object file to the ObjectFileDB.
+ * Unless copy_data is set, obj_data must stay valid for as long as the ObjectFileDB does.
  */
 void ObjectFileDB::add_obj_from_dgo(const std::string& obj_name,
                                     const std::string& name_in_dgo,
@@ -402,6 +413,7 @@ void ObjectFileDB::add_obj_from_dgo(const std::string& obj_name,
                                     uint32_t obj_size,
                                     const std::string& dgo_name,
                                     const Config& config,
+                                    bool copy_data,
                                     const std::string& cut_name) {
   if (config.banned_objects.find(obj_name) != config.banned_objects.end()) {
     return;
@@ -439,8 +451,12 @@ void ObjectFileDB::add_obj_from_dgo(const std::string& obj_name,
 
   // nope, have to add a new one.
   ObjectFileData data(config.game_version);
-  data.data.resize(obj_size);
-  memcpy(data.data.data(), obj_data, obj_size);
+  if (copy_data) {
+    data.owned_data.assign(obj_data, obj_data + obj_size);
+    data.data = data.owned_data;
+  } else {
+    data.data = std::span<const u8>(obj_data, obj_size);
+  }
   data.record.hash = hash;
   data.record.name = obj_name;
   data.dgo_names.push_back(dgo_name);
@@ -920,11 +936,26 @@ struct JointGeo {
   u32 length{};
 };
 
-void get_joint_info(ObjectFileDB& db, ObjectFileData& obj, JointGeo jg) {
+/*!
+ * The art group elements and joints found in one object. They're added to the type system after,
+ * in object order, so objects can be read in parallel.
+ */
+struct ArtInfo {
+  struct Entry {
+    std::string group;
+    std::string name;
+    int index;
+  };
+  std::vector<Entry> elts;
+  std::vector<Entry> joints;
+  std::string error;
+};
+
+void get_joint_info(GameVersion version, const ObjectFileData& obj, JointGeo jg, ArtInfo* out) {
   const auto& words = obj.linked_data.words_by_seg.at(MAIN_SEGMENT);
   for (size_t i = 0; i < jg.length; ++i) {
     u32 label = 0x0;
-    if (db.version() == GameVersion::Jak3) {
+    if (version == GameVersion::Jak3) {
       label = words.at((jg.offset / 4) + 11 + i).label_id();
     } else {
       label = words.at((jg.offset / 4) + 7 + i).label_id();
@@ -933,11 +964,11 @@ void get_joint_info(ObjectFileDB& db, ObjectFileData& obj, JointGeo jg) {
     const auto& name =
         obj.linked_data.get_goal_string_by_label(words.at(joint.offset / 4).label_id());
     // lg::print("{} joint idx {}/{}: {}\n", jg.name, i + 1, jg.length, name);
-    db.dts.add_joint_node(jg.name, name, i + 1);
+    out->joints.push_back({jg.name, name, int(i + 1)});
   }
 }
 
-void get_art_info(ObjectFileDB& db, ObjectFileData& obj) {
+void get_art_info(GameVersion version, const ObjectFileData& obj, ArtInfo* out) {
   // jak 1/2
   if (obj.obj_version == 4) {
     const auto& words = obj.linked_data.words_by_seg.at(MAIN_SEGMENT);
@@ -977,7 +1008,7 @@ void get_art_info(ObjectFileDB& db, ObjectFileData& obj) {
           jg.offset = label.offset;
           jg.name = unique_name;
           jg.length = words.at(label.offset / 4 + 2).data;
-          get_joint_info(db, obj, jg);
+          get_joint_info(version, obj, jg, out);
         } else if (elt_type == "merc-ctrl" || elt_type == "shadow-geo") {
           // (maybe mesh-geo as well but that doesnt exist)
           // the skin!
@@ -994,7 +1025,7 @@ void get_art_info(ObjectFileDB& db, ObjectFileData& obj) {
               fmt::format("unknown art elt type {} in {}", elt_type, obj.to_unique_name()));
         }
         // lg::print("  {}: {} ({}) -> {} @ {}\n", i, elt_name, elt_type, unique_name, elt_index);
-        db.dts.add_art_group_elt(ag_name, unique_name, elt_index);
+        out->elts.push_back({ag_name, unique_name, elt_index});
       }
     }
   }
@@ -1039,7 +1070,7 @@ void get_art_info(ObjectFileDB& db, ObjectFileData& obj) {
           jg.offset = label.offset;
           jg.name = unique_name;
           jg.length = words.at(label.offset / 4 + 2).data;
-          get_joint_info(db, obj, jg);
+          get_joint_info(version, obj, jg, out);
         } else if (elt_type == "merc-ctrl" || elt_type == "shadow-geo") {
           // (maybe mesh-geo as well but that doesnt exist)
           // the skin!
@@ -1056,7 +1087,7 @@ void get_art_info(ObjectFileDB& db, ObjectFileData& obj) {
               fmt::format("unknown art elt type {} in {}", elt_type, obj.to_unique_name()));
         }
         // lg::print("  {}: {} ({}) -> {} @ {}\n", i, elt_name, elt_type, unique_name, elt_index);
-        db.dts.add_art_group_elt(ag_name, unique_name, elt_index);
+        out->elts.push_back({ag_name, unique_name, elt_index});
       }
     }
   }
@@ -1070,14 +1101,29 @@ void ObjectFileDB::extract_art_info() {
   lg::info("Processing art groups...");
   Timer timer;
 
-  for_each_obj([&](ObjectFileData& obj) {
+  std::vector<ObjectFileData*> objs;
+  for_each_obj([&](ObjectFileData& obj) { objs.push_back(&obj); });
+  std::vector<ArtInfo> infos(objs.size());
+  ThreadPool::global().parallel_for(objs.size(), [&](int i) {
     try {
-      get_art_info(*this, obj);
+      get_art_info(m_version, *objs[i], &infos[i]);
     } catch (std::runtime_error& e) {
-      lg::warn("Error when extracting art group info: {}", e.what());
+      infos[i].error = e.what();
     }
   });
 
+  for (auto& info : infos) {
+    for (auto& joint : info.joints) {
+      dts.add_joint_node(joint.group, joint.name, joint.index);
+    }
+    for (auto& elt : info.elts) {
+      dts.add_art_group_elt(elt.group, elt.name, elt.index);
+    }
+    if (!info.error.empty()) {
+      lg::warn("Error when extracting art group info: {}", info.error);
+    }
+  }
+
   lg::info("Processed art groups: in {:.2f} ms", timer.getMs());
 }
 
@@ -7,6 +7,9 @@
  * (there may be different object files with the same name sometimes)
  */
 
+#include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,12 +17,17 @@
 #include "LinkedObjectFile.h"
 
 #include "common/common_types.h"
+#include "common/global_profiler/GlobalProfiler.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/MappedFile.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/Timer.h"
 
 #include "decompiler/analysis/symbol_def_map.h"
 #include "decompiler/data/TextureDB.h"
 #include "decompiler/util/DecompilerTypeSystem.h"
+#include "decompiler/util/PassStats.h"
 
 #include "fmt/core.h"
 
@@ -38,7 +46,13 @@ struct ObjectFileRecord {
  */
 struct ObjectFileData {
   ObjectFileData(GameVersion version) : linked_data(version) {}
-  std::vector<uint8_t> data;     // raw bytes
+  // data may point at owned_data, so this can be moved but not copied.
+  ObjectFileData(const ObjectFileData&) = delete;
+  ObjectFileData& operator=(const ObjectFileData&) = delete;
+  ObjectFileData(ObjectFileData&&) = default;
+  ObjectFileData& operator=(ObjectFileData&&) = default;
+  std::span<const u8> data;      // raw bytes, in a file owned by the ObjectFileDB or owned_data
+  std::vector<u8> owned_data;    // only used if the bytes couldn't be viewed from the input file
   LinkedObjectFile linked_data;  // data including linking annotations
   ObjectFileRecord record;       // name
   std::vector<std::string> dgo_names;
@@ -258,7 +272,8 @@ class ObjectFileDB {
   };
   void ir2_analyze_all_types(const fs::path& output_file,
                              const std::optional<std::string>& previous_game_types,
-                             const std::unordered_set<std::string>& bad_types);
+                             const std::unordered_set<std::string>& bad_types,
+                             int num_threads = 1);
   std::string ir2_to_file(ObjectFileData& data, const Config& config);
   std::string ir2_function_to_string(ObjectFileData& data, Function& function, int seg);
   std::string ir2_final_out(ObjectFileData& data,
@@ -289,6 +304,7 @@ class ObjectFileDB {
                         uint32_t obj_size,
                         const std::string& dgo_name,
                         const Config& config,
+                        bool copy_data,
                         const std::string& cut_name = "");
 
   /*!
@@ -304,6 +320,25 @@ class ObjectFileDB {
     }
   }
 
+  /*!
+   * Apply f to all ObjectFileData's, on up to num_threads threads of the global pool. The order that
+   * objects are processed in is not defined, so f must only modify the object it is given (or lock).
+   * If f throws, the remaining objects are skipped and the first exception is rethrown.
+   */
+  template <typename Func>
+  void for_each_obj_parallel(Func f, int num_threads) {
+    ASSERT(obj_files_by_name.size() == obj_file_order.size());
+    std::vector<ObjectFileData*> objs;
+    for (const auto& name : obj_file_order) {
+      for (auto& obj : obj_files_by_name.at(name)) {
+        objs.push_back(&obj);
+      }
+    }
+
+    // objects vary a lot in size, so parallel_for hands them out one at a time.
+    ThreadPool::global().parallel_for(objs.size(), [&](int i) { f(*objs[i]); }, num_threads);
+  }
+
   /*!
    * Apply f to all ObjectFileData's in a specific DGO. Does it in the right order.
    */
@@ -386,6 +421,26 @@ class ObjectFileDB {
     }
   }
 
+  /*!
+   * Run an IR2 pass on each function in a segment. If pass stats are enabled, the pass is also a
+   * profiler event and the time spent on each function is added to pass_stats.
+   */
+  template <typename Func>
+  void for_each_function_in_pass(const char* pass, int seg, ObjectFileData& data, Func f) {
+    if (!pass_stats) {
+      for_each_function_in_seg_in_obj(seg, data, f);
+      return;
+    }
+    auto event = scoped_prof(pass);
+    std::vector<std::pair<std::string, double>> function_ms;
+    for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+      Timer timer;
+      f(func);
+      function_ms.emplace_back(func.name(), timer.getMs());
+    });
+    pass_stats->add_pass(pass, data.to_unique_name(), function_ms);
+  }
+
   // Danger: after adding all object files, we assume that the vector never reallocates.
   std::unordered_map<std::string, std::vector<ObjectFileData>> obj_files_by_name;
   std::unordered_map<std::string, std::vector<ObjectFileRecord>> obj_files_by_dgo;
@@ -394,6 +449,13 @@ class ObjectFileDB {
   std::unordered_map<std::string, std::unordered_map<std::string, std::string>> dgo_obj_name_map;
 
   SymbolMapBuilder map_builder;
+  // symbol map info from each object, added to map_builder in object order after ir2 analysis.
+  std::unordered_map<const ObjectFileData*, SymbolMapBuilder::ObjectSymbolList>
+      pending_symbol_maps;
+  // protects stats and pending_symbol_maps during parallel ir2 analysis.
+  std::mutex ir2_shared_mutex;
+  // only set while analyze_functions_ir2 runs with ir2_pass_stats enabled.
+  std::unique_ptr<PassStats> pass_stats;
 
   struct {
     LetRewriteStats let;
@@ -407,6 +469,9 @@ class ObjectFileDB {
 
  private:
   GameVersion m_version;
+  // the mapped DGOs and object files, which the ObjectFileData's view instead of copying.
+  std::vector<std::unique_ptr<MappedFile>> m_mapped_inputs;
+  std::vector<std::vector<u8>> m_decompressed_inputs;
 };
 
 std::string print_art_elt_for_dump(const std::string& group_name, const std::string& name, int idx);
@@ -5,12 +5,17 @@
 
 #include "ObjectFileDB.h"
 
+#include <memory>
+#include <optional>
+
 #include "common/formatter/formatter.h"
 #include "common/goos/PrettyPrinter.h"
 #include "common/link_types.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/Timer.h"
+#include "common/util/os.h"
 #include "common/util/string_util.h"
 
 #include "decompiler/IR2/Form.h"
@@ -32,6 +37,7 @@
 #include "decompiler/analysis/type_analysis.h"
 #include "decompiler/analysis/variable_naming.h"
 #include "decompiler/types2/types2.h"
+#include "decompiler/util/DecompilerCache.h"
 
 namespace decompiler {
 
@@ -42,6 +48,13 @@ void ObjectFileDB::process_object_file_data(
     const std::unordered_set<std::string>& skip_functions,
     const std::unordered_map<std::string, std::unordered_set<std::string>>& skip_states) {
   Timer file_timer;
+  const size_t start_peak_rss = pass_stats ? get_peak_rss() : 0;
+  std::optional<ScopedEvent> file_event;
+  if (pass_stats) {
+    prof().root_event();
+    prof().begin_event(data.to_unique_name().c_str());
+    file_event.emplace(&prof());
+  }
   ir2_do_segment_analysis_phase1(TOP_LEVEL_SEGMENT, config, data);
   ir2_do_segment_analysis_phase1(DEBUG_SEGMENT, config, data);
   ir2_do_segment_analysis_phase1(MAIN_SEGMENT, config, data);
@@ -93,6 +106,7 @@ void ObjectFileDB::process_object_file_data(
   }
 
   if (!output_dir.string().empty()) {
+    auto write_event = scoped_prof("ir2_write_results");
     ir2_write_results(output_dir, config, imports, data);
   } else {
     data.output_with_skips = ir2_final_out(data, imports, skip_functions);
@@ -116,6 +130,13 @@ void ObjectFileDB::process_object_file_data(
     });
   }
 
+  if (pass_stats) {
+    file_event.reset();
+    prof().root_event();
+    pass_stats->add_object(data.to_unique_name(), file_timer.getMs(),
+                           get_peak_rss() - start_peak_rss);
+  }
+
   lg::info("Done in {:.2f}ms", file_timer.getMs());
 }
 
@@ -135,20 +156,99 @@ void ObjectFileDB::analyze_functions_ir2(
   for (auto& f : obj_files_by_name) {
     total_file_count += f.second.size();
   }
-  int file_idx = 1;
-  for_each_obj([&](ObjectFileData& data) {
-    if (prefile_callback) {
-      prefile_callback.value()(data.to_unique_name());
+
+  // the cache only holds the files written to output_dir, so it can't be used for anything that
+  // needs the IR2 results afterward.
+  std::unique_ptr<DecompilerCache> cache;
+  if (!config.decompiler_cache_dir.empty() && !output_dir.string().empty() &&
+      !config.generate_all_types && !config.generate_symbol_definition_map &&
+      skip_functions.empty() && skip_states.empty()) {
+    cache = std::make_unique<DecompilerCache>(
+        file_util::get_file_path({config.decompiler_cache_dir}), config, dts);
+  }
+
+  if (config.ir2_pass_stats) {
+    pass_stats = std::make_unique<PassStats>();
+    // about a hundred events per object file.
+    prof().update_event_buffer_size(1 << 20);
+    prof().set_enable(true);
+  }
+
+  auto process = [&](ObjectFileData& data) {
+    if (!cache) {
+      process_object_file_data(data, output_dir, config, skip_functions, skip_states);
+      return;
+    }
+    const auto key = cache->get_key(data, config);
+    if (cache->restore(key, data, output_dir)) {
+      lg::info("Restored {} from decompiler cache", data.to_unique_name());
+      return;
     }
-    lg::info("[{:3d}/{}]------ {}", file_idx++, total_file_count, data.to_unique_name());
-    process_object_file_data(data, output_dir, config, skip_functions, skip_states);
-    if (postfile_callback) {
-      postfile_callback.value()();
+    std::unordered_set<std::string> used_types;
+    {
+      ScopedTypeUseRecorder recorder(&used_types);
+      process_object_file_data(data, output_dir, config, skip_functions, skip_states);
+    }
+    cache->store(key, data, output_dir, used_types);
+  };
+
+  if (config.ir2_threads > 1) {
+    // the callbacks are run on the thread that processes the file, so they must be thread safe.
+    lg::info("Running IR2 analysis on {} threads", config.ir2_threads);
+    std::atomic<int> file_idx = 1;
+    for_each_obj_parallel(
+        [&](ObjectFileData& data) {
+          if (prefile_callback) {
+            prefile_callback.value()(data.to_unique_name());
+          }
+          lg::info("[{:3d}/{}]------ {}", file_idx++, total_file_count, data.to_unique_name());
+          process(data);
+          if (postfile_callback) {
+            postfile_callback.value()();
+          }
+        },
+        config.ir2_threads);
+  } else {
+    int file_idx = 1;
+    for_each_obj([&](ObjectFileData& data) {
+      if (prefile_callback) {
+        prefile_callback.value()(data.to_unique_name());
+      }
+      lg::info("[{:3d}/{}]------ {}", file_idx++, total_file_count, data.to_unique_name());
+      process(data);
+      if (postfile_callback) {
+        postfile_callback.value()();
+      }
+    });
+  }
+
+  // add symbols in the original object order, so the symbol map doesn't depend on threading.
+  for_each_obj([&](ObjectFileData& data) {
+    auto it = pending_symbol_maps.find(&data);
+    if (it != pending_symbol_maps.end()) {
+      map_builder.add_object_symbols(it->second);
     }
   });
+  pending_symbol_maps.clear();
+
+  if (cache) {
+    lg::info("Decompiler cache: {} of {} object files restored, {} stored", cache->hit_count(),
+             total_file_count, cache->store_count());
+  }
 
   lg::info("{}", stats.let.print());
 
+  if (pass_stats) {
+    lg::info("Writing IR2 pass trace to profile_data/");
+    prof().dump_to_json();
+    const auto report = pass_stats->report();
+    if (!output_dir.string().empty()) {
+      file_util::write_text_file(output_dir / "ir2_pass_stats.txt", report);
+    }
+    lg::info("IR2 pass stats:\n{}", report);
+    pass_stats.reset();
+  }
+
   if (config.generate_symbol_definition_map) {
     lg::info("Generating symbol definition map...");
     map_builder.build_map();
@@ -320,7 +420,8 @@ void ObjectFileDB::ir2_top_level_pass(const Config& config) {
 
 void ObjectFileDB::ir2_analyze_all_types(const fs::path& output_file,
                                          const std::optional<std::string>& previous_game_types,
-                                         const std::unordered_set<std::string>& bad_types) {
+                                         const std::unordered_set<std::string>& bad_types,
+                                         int num_threads) {
   auto is_code_file = [](ObjectFileData& data) {
     return (data.obj_version == 3 ||
             (data.obj_version == 5 && data.linked_data.has_any_functions()));
@@ -390,7 +491,33 @@ void ObjectFileDB::ir2_analyze_all_types(const fs::path& output_file,
     }
   }
 
+  // Reading the fields from an inspect method only looks at that method, so they're all read at
+  // once, on many threads. The deftypes are made from them in order below.
+  auto use_inspect = [&](Function& f, int seg) {
+    return seg != TOP_LEVEL_SEGMENT && f.is_inspect_method &&
+           bad_types.find(f.guessed_name.type_name) == bad_types.end();
+  };
+  std::vector<std::pair<Function*, LinkedObjectFile*>> inspects;
+  for_each_obj([&](ObjectFileData& data) {
+    if (is_code_file(data)) {
+      for_each_function_def_order_in_obj(data, [&](Function& f, int seg) {
+        if (use_inspect(f, seg)) {
+          inspects.emplace_back(&f, &data.linked_data);
+        }
+      });
+    }
+  });
+  std::vector<TypeInspectorResult> inspect_results(inspects.size());
+  ThreadPool::global().parallel_for(
+      inspects.size(),
+      [&](int i) {
+        auto& [f, file] = inspects[i];
+        inspect_results[i] = read_inspect_method(*f, f->guessed_name.type_name, dts, *file);
+      },
+      num_threads);
+
   // Then another to actually setup the definitions
+  size_t next_inspect = 0;
   for_each_obj([&](ObjectFileData& data) {
     if (is_code_file(data)) {
       auto& object_result = per_object.at(data.to_unique_name());
@@ -399,10 +526,10 @@ void ObjectFileDB::ir2_analyze_all_types(const fs::path& output_file,
       // typedefs
       for_each_function_def_order_in_obj(data, [&](Function& f, int seg) {
         if (seg != TOP_LEVEL_SEGMENT) {
-          if (f.is_inspect_method && bad_types.find(f.guessed_name.type_name) == bad_types.end()) {
-            auto deftype_from_inspect =
-                inspect_inspect_method(f, f.guessed_name.type_name, dts, data.linked_data,
-                                       previous_game_ts, ti_cache, object_result);
+          if (use_inspect(f, seg)) {
+            ASSERT(inspects.at(next_inspect).first == &f);
+            auto deftype_from_inspect = inspect_inspect_method(
+                inspect_results[next_inspect++], previous_game_ts, ti_cache, object_result);
             bool already_seen = object_result.type_info.count(f.guessed_name.type_name) > 0;
             if (!already_seen) {
               object_result.type_names_in_order.push_back(f.guessed_name.type_name);
@@ -456,7 +583,7 @@ void ObjectFileDB::ir2_analyze_all_types(const fs::path& output_file,
  * - Build control flow graph
  */
 void ObjectFileDB::ir2_basic_block_pass(int seg, const Config& config, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     func.ir2.env.file = &data.linked_data;
     func.ir2.env.dts = &dts;
     func.ir2.env.func = &func;
@@ -507,7 +634,7 @@ void ObjectFileDB::ir2_basic_block_pass(int seg, const Config& config, ObjectFil
 }
 
 void ObjectFileDB::ir2_stack_spill_slot_pass(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (!func.cfg_ok) {
       return;
     }
@@ -525,7 +652,7 @@ void ObjectFileDB::ir2_stack_spill_slot_pass(int seg, ObjectFileData& data) {
  * think are IR of the original GOAL compiler.
  */
 void ObjectFileDB::ir2_atomic_op_pass(int seg, const Config& config, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (!func.cfg_ok) {
       return;
     }
@@ -559,7 +686,11 @@ void ObjectFileDB::ir2_atomic_op_pass(int seg, const Config& config, ObjectFileD
 }
 
 void ObjectFileDB::ir2_symbol_definition_map(ObjectFileData& data) {
-  map_builder.add_object(data);
+  auto symbols = SymbolMapBuilder::collect_object_symbols(data);
+  if (symbols) {
+    std::lock_guard<std::mutex> lock(ir2_shared_mutex);
+    pending_symbol_maps[&data] = std::move(*symbols);
+  }
 }
 
 template <typename Key, typename Value>
@@ -594,7 +725,7 @@ const std::string* find_file_override_for_art_group(const Config& config,
  */
 void ObjectFileDB::ir2_type_analysis_pass(int seg, const Config& config, ObjectFileData& data) {
   auto obj_name = data.to_unique_name();
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (!func.suspected_asm) {
       TypeSpec ts;
       if (lookup_function_type(func.guessed_name, data.to_unique_name(), config, &ts) &&
@@ -693,7 +824,7 @@ void ObjectFileDB::ir2_type_analysis_pass(int seg, const Config& config, ObjectF
 }
 
 void ObjectFileDB::ir2_register_usage_pass(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (!func.suspected_asm && func.ir2.atomic_ops_succeeded) {
       func.ir2.env.set_reg_use(analyze_ir2_register_usage(func));
 
@@ -743,7 +874,7 @@ void ObjectFileDB::ir2_register_usage_pass(int seg, ObjectFileData& data) {
 }
 
 void ObjectFileDB::ir2_variable_pass(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     (void)data;
     if (!func.suspected_asm && func.ir2.atomic_ops_succeeded && func.ir2.env.has_type_analysis()) {
       try {
@@ -764,7 +895,7 @@ void ObjectFileDB::ir2_cfg_build_pass(int seg, ObjectFileData& data) {
   int total = 0;
   int attempted = 0;
   int successful = 0;
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     (void)data;
     total++;
     if (!func.suspected_asm && func.ir2.atomic_ops_succeeded && func.cfg->is_fully_resolved()) {
@@ -784,7 +915,7 @@ void ObjectFileDB::ir2_cfg_build_pass(int seg, ObjectFileData& data) {
 }
 
 void ObjectFileDB::ir2_build_expressions(int seg, const Config& config, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     (void)data;
     if (func.ir2.top_form && func.ir2.env.has_type_analysis() && func.ir2.env.has_local_vars() &&
         func.ir2.env.types_succeeded) {
@@ -807,10 +938,13 @@ void ObjectFileDB::ir2_build_expressions(int seg, const Config& config, ObjectFi
 }
 
 void ObjectFileDB::ir2_insert_lets(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (func.ir2.expressions_succeeded) {
       try {
-        insert_lets(func, func.ir2.env, *func.ir2.form_pool, func.ir2.top_form, stats.let);
+        LetRewriteStats let_stats;
+        insert_lets(func, func.ir2.env, *func.ir2.form_pool, func.ir2.top_form, let_stats);
+        std::lock_guard<std::mutex> lock(ir2_shared_mutex);
+        stats.let += let_stats;
       } catch (const std::exception& e) {
         const auto err = fmt::format(
             "Error while inserting lets: {}. Make sure that the return type is not "
@@ -824,7 +958,7 @@ void ObjectFileDB::ir2_insert_lets(int seg, ObjectFileData& data) {
 }
 
 void ObjectFileDB::ir2_add_store_errors(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     if (func.ir2.expressions_succeeded && !func.warnings.has_errors()) {
       // print warning about failed store, but only if decompilation passes without any major
       // errors
@@ -840,7 +974,7 @@ void ObjectFileDB::ir2_add_store_errors(int seg, ObjectFileData& data) {
 }
 
 void ObjectFileDB::ir2_rewrite_inline_asm_instructions(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     (void)data;
     if (func.ir2.top_form && func.ir2.env.has_type_analysis()) {
       if (rewrite_inline_asm_instructions(func.ir2.top_form, *func.ir2.form_pool, func, dts)) {
@@ -851,7 +985,7 @@ void ObjectFileDB::ir2_rewrite_inline_asm_instructions(int seg, ObjectFileData&
 }
 
 void ObjectFileDB::ir2_insert_anonymous_functions(int seg, ObjectFileData& data) {
-  for_each_function_in_seg_in_obj(seg, data, [&](Function& func) {
+  for_each_function_in_pass(__func__, seg, data, [&](Function& func) {
     (void)data;
     if (func.ir2.top_form && func.ir2.env.has_type_analysis()) {
       try {
@@ -929,7 +1063,7 @@ std::string ObjectFileDB::ir2_to_file(ObjectFileData& data, const Config& config
           result += final_defun_out(func, func.ir2.env, dts);
         } else {
           result += ";; no variable information\n";
-          result += pretty_print::to_string(func.ir2.top_form->to_form(func.ir2.env));
+          pretty_print::append_to_string(func.ir2.top_form->to_form(func.ir2.env), result);
         }
         result += "\n\n;;-*-OpenGOAL-End-*-\n\n";
       } else if (func.ir2.atomic_ops_succeeded) {
@@ -1342,13 +1342,10 @@ int detect(int idx, Function& function, LinkedObjectFile& file, TypeInspectorRes
   return idx;
 }
 
-std::string inspect_inspect_method(Function& inspect_method,
-                                   const std::string& type_name,
-                                   DecompilerTypeSystem& dts,
-                                   LinkedObjectFile& file,
-                                   DecompilerTypeSystem& previous_game_ts,
-                                   TypeInspectorCache& ti_cache,
-                                   ObjectFileDB::PerObjectAllTypeInfo& object_file_meta) {
+TypeInspectorResult read_inspect_method(Function& inspect_method,
+                                        const std::string& type_name,
+                                        DecompilerTypeSystem& dts,
+                                        LinkedObjectFile& file) {
   lg::print(" iim: {}\n", inspect_method.name());
   TypeInspectorResult result;
   ASSERT(type_name == inspect_method.guessed_name.type_name);
@@ -1361,13 +1358,6 @@ std::string inspect_inspect_method(Function& inspect_method,
   result.type_size = flags.size;
   result.type_method_count = flags.methods;
 
-  // ignore duplicate inspects
-  if (ti_cache.previous_results.find(type_name) != ti_cache.previous_results.end() &&
-      !(std::find(g_duplicate_inspects_jak3.begin(), g_duplicate_inspects_jak3.end(), type_name) !=
-        g_duplicate_inspects_jak3.end())) {
-    return fmt::format(";; {} is already defined!\n", type_name);
-  }
-
   // Only set heap-base if it's different from the automatic one
   // A child (or child of a child) of process ALWAYS has heap-base set.
   if (flags.heap_base > 0) {
@@ -1399,17 +1389,10 @@ std::string inspect_inspect_method(Function& inspect_method,
     idx = get_start_idx_process(inspect_method, result.parent_type_name, inspect_method.ir2.env,
                                 &result);
   }
-  StructureType* old_game_type = nullptr;
-  if (previous_game_ts.ts.fully_defined_type_exists(type_name)) {
-    old_game_type = dynamic_cast<StructureType*>(previous_game_ts.ts.lookup_type(type_name));
-  }
   if (idx <= 0) {
     // can't get any field...
     result.warnings += "Failed to read fields.";
-    idx = -2;
-    ti_cache.previous_results[type_name] = result;
-    return result.print_as_deftype(old_game_type, ti_cache.previous_results, previous_game_ts,
-                                   object_file_meta);
+    return result;
   }
   while (idx < int(inspect_method.ir2.atomic_ops->ops.size()) - 2 && idx != -1) {
     // skip over non-format calls in inspects
@@ -1424,9 +1407,29 @@ std::string inspect_inspect_method(Function& inspect_method,
   if (idx == -1) {
     result.warnings += "Failed to read some fields.";
   }
+  return result;
+}
+
+std::string inspect_inspect_method(const TypeInspectorResult& result,
+                                   DecompilerTypeSystem& previous_game_ts,
+                                   TypeInspectorCache& ti_cache,
+                                   ObjectFileDB::PerObjectAllTypeInfo& object_file_meta) {
+  const auto& type_name = result.type_name;
+  // ignore duplicate inspects
+  if (ti_cache.previous_results.find(type_name) != ti_cache.previous_results.end() &&
+      !(std::find(g_duplicate_inspects_jak3.begin(), g_duplicate_inspects_jak3.end(), type_name) !=
+        g_duplicate_inspects_jak3.end())) {
+    return fmt::format(";; {} is already defined!\n", type_name);
+  }
+
+  StructureType* old_game_type = nullptr;
+  if (previous_game_ts.ts.fully_defined_type_exists(type_name)) {
+    old_game_type = dynamic_cast<StructureType*>(previous_game_ts.ts.lookup_type(type_name));
+  }
   ti_cache.previous_results[type_name] = result;
-  return result.print_as_deftype(old_game_type, ti_cache.previous_results, previous_game_ts,
-                                 object_file_meta);
+  auto to_print = result;
+  return to_print.print_as_deftype(old_game_type, ti_cache.previous_results, previous_game_ts,
+                                   object_file_meta);
 }
 
 std::string old_method_string(const MethodInfo& info, const bool omit_comment = false) {
@@ -36,10 +36,20 @@ struct TypeInspectorCache {
   std::unordered_map<std::string, TypeInspectorResult> previous_results;
 };
 
-std::string inspect_inspect_method(Function& inspect_method,
-                                   const std::string& type_name,
-                                   DecompilerTypeSystem& dts,
-                                   LinkedObjectFile& file,
+/*!
+ * Read the flags and fields of a type from its inspect method. This only reads the function, its
+ * object file and the type system, so many inspect methods can be read at once.
+ */
+TypeInspectorResult read_inspect_method(Function& inspect_method,
+                                        const std::string& type_name,
+                                        DecompilerTypeSystem& dts,
+                                        LinkedObjectFile& file);
+
+/*!
+ * Make the deftype for a type from read_inspect_method. Types must be done in the order of their
+ * inspect methods in the objects: duplicates are skipped, and a deftype uses its parent's result.
+ */
+std::string inspect_inspect_method(const TypeInspectorResult& result,
                                    DecompilerTypeSystem& previous_game_ts,
                                    TypeInspectorCache& ti_cache,
                                    ObjectFileDB::PerObjectAllTypeInfo& object_file_meta);
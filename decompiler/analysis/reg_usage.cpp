@@ -9,67 +9,34 @@ RegUsageInfo::RegUsageInfo(int n_blocks, int n_ops) {
 }
 
 namespace {
-bool in_set(RegSet& set, const Register& obj) {
-  return set.find(obj) != set.end();
-}
-
 void phase1(const FunctionAtomicOps& ops, int block_id, RegUsageInfo* out) {
   int end_op = ops.block_id_to_end_atomic_op.at(block_id);
   int start_op = ops.block_id_to_first_atomic_op.at(block_id);
+  auto& block = out->block.at(block_id);
 
   for (int i = end_op; i-- > start_op;) {
     const auto& instr = ops.ops.at(i);
-    auto read = instr->read_regs();
-    auto write = instr->write_regs();
 
     auto& lv = out->op.at(i).live;
     auto& dd = out->op.at(i).dead;
-    auto& block = out->block.at(block_id);
 
     // make all read live out
     lv.clear();
-    for (auto& x : read) {
-      lv.insert(x);
-    }
+    lv.insert(instr->read_regs().begin(), instr->read_regs().end());
 
     // kill things which are overwritten
     dd.clear();
-    for (auto& x : write) {
-      if (!in_set(lv, x)) {
-        dd.insert(x);
-      }
-    }
-
-    // b.use = i.liveout
-    RegSet use_old = block.use;
-    block.use.clear();
-    for (auto& x : lv) {
-      block.use.insert(x);
-    }
-    // | (bu.use & !i.dead)
-    for (auto& x : use_old) {
-      if (!in_set(dd, x)) {
-        block.use.insert(x);
-      }
-    }
+    dd.insert(instr->write_regs().begin(), instr->write_regs().end());
+    dd -= lv;
 
-    // b.defs = i.dead
-    RegSet defs_old = block.defs;
-    block.defs.clear();
-    for (auto& x : dd) {
-      block.defs.insert(x);
-    }
-    // | b.defs & !i.lv
-    for (auto& x : defs_old) {
-      if (!in_set(lv, x)) {
-        block.defs.insert(x);
-      }
-    }
+    // b.use = i.liveout | (bu.use & !i.dead)
+    block.use = lv | (block.use - dd);
+    // b.defs = i.dead | (b.defs & !i.lv)
+    block.defs = dd | (block.defs - lv);
   }
 }
 
 bool phase2(const std::vector<BasicBlock>& blocks, int block_id, RegUsageInfo* info) {
-  bool changed = false;
   auto& block_info = info->block.at(block_id);
   const auto& block_obj = blocks.at(block_id);
   auto out = block_info.defs;  // copy
@@ -78,25 +45,55 @@ bool phase2(const std::vector<BasicBlock>& blocks, int block_id, RegUsageInfo* i
     if (s == -1) {
       continue;
     }
-    for (auto in : info->block.at(s).input) {
-      out.insert(in);
-    }
+    out |= info->block.at(s).input;
   }
 
-  RegSet in = block_info.use;
-  for (auto x : out) {
-    if (!in_set(block_info.defs, x)) {
-      in.insert(x);
-    }
-  }
+  RegSet in = block_info.use | (out - block_info.defs);
 
   if (in != block_info.input || out != block_info.output) {
-    changed = true;
     block_info.input = in;
     block_info.output = out;
+    return true;
   }
 
-  return changed;
+  return false;
+}
+
+/*!
+ * Blocks in postorder of the CFG from block 0, followed by any unreachable blocks. Liveness flows
+ * backward, so visiting successors first means most blocks only need to be visited once.
+ */
+std::vector<int> postorder(const std::vector<BasicBlock>& blocks) {
+  std::vector<int> order;
+  std::vector<bool> visited(blocks.size(), false);
+  // block, and the next successor to visit
+  std::vector<std::pair<int, int>> stack;
+
+  auto visit_from = [&](int root) {
+    visited.at(root) = true;
+    stack.push_back({root, 0});
+    while (!stack.empty()) {
+      auto& [block, next_succ] = stack.back();
+      if (next_succ < 2) {
+        int succ = next_succ == 0 ? blocks.at(block).succ_branch : blocks.at(block).succ_ft;
+        next_succ++;
+        if (succ != -1 && !visited.at(succ)) {
+          visited.at(succ) = true;
+          stack.push_back({succ, 0});
+        }
+      } else {
+        order.push_back(block);
+        stack.pop_back();
+      }
+    }
+  };
+
+  for (int i = 0; i < int(blocks.size()); i++) {
+    if (!visited.at(i)) {
+      visit_from(i);
+    }
+  }
+  return order;
 }
 
 void phase3(const FunctionAtomicOps& ops,
@@ -109,9 +106,7 @@ void phase3(const FunctionAtomicOps& ops,
     if (s == -1) {
       continue;
     }
-    for (auto i : info->block.at(s).input) {
-      live_local.insert(i);
-    }
+    live_local |= info->block.at(s).input;
   }
 
   int end_op = ops.block_id_to_end_atomic_op.at(block_id);
@@ -121,12 +116,7 @@ void phase3(const FunctionAtomicOps& ops,
     auto& lv = info->op.at(i).live;
     auto& dd = info->op.at(i).dead;
 
-    RegSet new_live = lv;
-    for (auto x : live_local) {
-      if (!in_set(dd, x)) {
-        new_live.insert(x);
-      }
-    }
+    RegSet new_live = lv | (live_local - dd);
     lv = live_local;
     live_local = new_live;
   }
@@ -142,15 +132,33 @@ RegUsageInfo analyze_ir2_register_usage(const Function& function) {
     phase1(*ops, i, &result);
   }
 
-  bool changed = false;
-  do {
-    changed = false;
-    for (int i = 0; i < int(blocks.size()); i++) {
-      if (phase2(blocks, i, &result)) {
-        changed = true;
+  // solve for block input/output with a worklist, starting with every block in postorder.
+  // when a block's input changes, its predecessors need another look.
+  std::vector<std::vector<int>> preds(blocks.size());
+  for (int i = 0; i < int(blocks.size()); i++) {
+    for (auto s : {blocks.at(i).succ_branch, blocks.at(i).succ_ft}) {
+      if (s != -1) {
+        preds.at(s).push_back(i);
+      }
+    }
+  }
+
+  auto order = postorder(blocks);
+  std::vector<int> worklist(order.rbegin(), order.rend());  // popped from the back
+  std::vector<bool> in_worklist(blocks.size(), true);
+  while (!worklist.empty()) {
+    int block = worklist.back();
+    worklist.pop_back();
+    in_worklist.at(block) = false;
+    if (phase2(blocks, block, &result)) {
+      for (auto pred : preds.at(block)) {
+        if (!in_worklist.at(pred)) {
+          in_worklist.at(pred) = true;
+          worklist.push_back(pred);
+        }
       }
     }
-  } while (changed);
+  }
 
   for (int i = 0; i < int(blocks.size()); i++) {
     phase3(*ops, blocks, i, &result);
@@ -170,16 +178,14 @@ RegUsageInfo analyze_ir2_register_usage(const Function& function) {
       for (auto succ : {blocks.at(block_id).succ_branch, blocks.at(block_id).succ_ft}) {
         if (succ != -1) {
           auto succ_id = ops->block_id_to_first_atomic_op.at(succ);  // todo?
-          result.op.at(succ_id).live_in.insert(last_live_out.begin(), last_live_out.end());
+          result.op.at(succ_id).live_in |= last_live_out;
         }
       }
     }
   }
 
   // special case for the very first op
-  auto& first_op_live_out = result.op.at(0).live;
-  RegSet first_op_live_in;
-  first_op_live_in.insert(first_op_live_out.begin(), first_op_live_out.end());
+  RegSet first_op_live_in = result.op.at(0).live;
   for (auto reg : ops->ops.at(0)->write_regs()) {
     first_op_live_in.erase(reg);
   }
@@ -1,15 +1,173 @@
 #pragma once
 
-#include <unordered_set>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
 #include <vector>
 
+#include "common/common_types.h"
+#include "common/util/Assert.h"
+
 #include "decompiler/Disasm/Register.h"
 
 namespace decompiler {
 
 class Function;
 
-using RegSet = std::unordered_set<Register, Register::hash>;
+/*!
+ * A set of registers, stored as a bitset indexed by register ID. It has the parts of the
+ * std::unordered_set interface that the decompiler uses, and iterates in order of register ID.
+ */
+class RegSet {
+ public:
+  class const_iterator {
+   public:
+    using value_type = Register;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Register*;
+    using reference = const Register&;
+    using iterator_category = std::forward_iterator_tag;
+
+    const_iterator() = default;
+    const_iterator(const RegSet* set, int idx) : m_set(set), m_idx(idx) { load(); }
+
+    // the register is stored in the iterator, so references don't outlive it.
+    const Register& operator*() const { return m_reg; }
+    const Register* operator->() const { return &m_reg; }
+    const_iterator& operator++() {
+      m_idx++;
+      load();
+      return *this;
+    }
+    const_iterator operator++(int) {
+      auto old = *this;
+      ++*this;
+      return old;
+    }
+    bool operator==(const const_iterator& other) const { return m_idx == other.m_idx; }
+    bool operator!=(const const_iterator& other) const { return m_idx != other.m_idx; }
+
+   private:
+    void load() {
+      m_idx = m_set->next_set_bit(m_idx);
+      if (m_idx < kBits) {
+        m_reg = Register(m_idx);
+      }
+    }
+
+    const RegSet* m_set = nullptr;
+    int m_idx = kBits;
+    Register m_reg;
+  };
+  using iterator = const_iterator;
+
+  RegSet() = default;
+  RegSet(std::initializer_list<Register> regs) { insert(regs.begin(), regs.end()); }
+
+  std::pair<iterator, bool> insert(const Register& reg) {
+    int idx = index(reg);
+    bool inserted = !test(idx);
+    m_words[idx / 64] |= bit(idx);
+    return {iterator(this, idx), inserted};
+  }
+
+  template <typename It>
+  void insert(It first, It last) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  size_t erase(const Register& reg) {
+    int idx = index(reg);
+    bool present = test(idx);
+    m_words[idx / 64] &= ~bit(idx);
+    return present;
+  }
+
+  iterator find(const Register& reg) const {
+    int idx = index(reg);
+    return test(idx) ? iterator(this, idx) : end();
+  }
+  size_t count(const Register& reg) const { return test(index(reg)); }
+  bool contains(const Register& reg) const { return test(index(reg)); }
+
+  iterator begin() const { return iterator(this, 0); }
+  iterator end() const { return iterator(this, kBits); }
+
+  size_t size() const {
+    size_t result = 0;
+    for (auto word : m_words) {
+      result += std::popcount(word);
+    }
+    return result;
+  }
+  bool empty() const {
+    for (auto word : m_words) {
+      if (word) {
+        return false;
+      }
+    }
+    return true;
+  }
+  void clear() { m_words = {}; }
+
+  RegSet& operator|=(const RegSet& other) {
+    for (int i = 0; i < kWords; i++) {
+      m_words[i] |= other.m_words[i];
+    }
+    return *this;
+  }
+  RegSet& operator&=(const RegSet& other) {
+    for (int i = 0; i < kWords; i++) {
+      m_words[i] &= other.m_words[i];
+    }
+    return *this;
+  }
+  // remove all registers in other
+  RegSet& operator-=(const RegSet& other) {
+    for (int i = 0; i < kWords; i++) {
+      m_words[i] &= ~other.m_words[i];
+    }
+    return *this;
+  }
+  friend RegSet operator|(RegSet a, const RegSet& b) { return a |= b; }
+  friend RegSet operator&(RegSet a, const RegSet& b) { return a &= b; }
+  friend RegSet operator-(RegSet a, const RegSet& b) { return a -= b; }
+
+  bool operator==(const RegSet& other) const { return m_words == other.m_words; }
+  bool operator!=(const RegSet& other) const { return m_words != other.m_words; }
+
+ private:
+  static constexpr int kBits = Reg::MAX_REG_ID;
+  static constexpr int kWords = (kBits + 63) / 64;
+
+  static int index(const Register& reg) {
+    int idx = reg.reg_id();
+    ASSERT(idx < kBits);
+    return idx;
+  }
+  static u64 bit(int idx) { return u64(1) << (idx % 64); }
+  bool test(int idx) const { return m_words[idx / 64] & bit(idx); }
+
+  // the first set bit at or after idx, or kBits
+  int next_set_bit(int idx) const {
+    while (idx < kBits) {
+      u64 word = m_words[idx / 64] >> (idx % 64);
+      if (word) {
+        idx += std::countr_zero(word);
+        return idx < kBits ? idx : kBits;
+      }
+      idx = (idx / 64 + 1) * 64;
+    }
+    return kBits;
+  }
+
+  std::array<u64, kWords> m_words{};
+};
 
 struct RegUsageInfo {
   struct PerBlock {
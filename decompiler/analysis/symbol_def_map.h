@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -11,11 +12,6 @@ class Function;
 
 class SymbolMapBuilder {
  public:
-  void add_object(const ObjectFileData& data);
-  void build_map();
-  std::string convert_to_json() const;
-
- private:
   struct SymbolInfo {
     std::string name;
     bool is_type = false;
@@ -26,6 +22,16 @@ class SymbolMapBuilder {
     std::vector<SymbolInfo> symbols;
   };
 
+  void add_object(const ObjectFileData& data);
+  // collect the symbols used by an object. Doesn't modify the builder, so this is thread safe.
+  static std::optional<ObjectSymbolList> collect_object_symbols(const ObjectFileData& data);
+  // add symbols from collect_object_symbols. Should be called in the same order as add_object.
+  void add_object_symbols(const ObjectSymbolList& symbols);
+  void build_map();
+  std::string convert_to_json() const;
+
+ private:
+
   // symbols that we've seen load/store
   std::unordered_set<std::string> m_seen_symbols;
   // symbol that we've seen used in a deftype
@@ -40,8 +46,12 @@ class SymbolMapBuilder {
   // - other symbols do not appear.
   std::vector<ObjectSymbolList> m_result;
 
-  void add_load_store_from_function(const Function& f, ObjectSymbolList* output);
-  void add_deftypes_from_top_level_function(const Function& f, ObjectSymbolList* output);
+  static void add_load_store_from_function(const Function& f,
+                                           ObjectSymbolList* output,
+                                           std::unordered_set<std::string>* seen);
+  static void add_deftypes_from_top_level_function(const Function& f,
+                                                   ObjectSymbolList* output,
+                                                   std::unordered_set<std::string>* seen);
 };
 
 }  // namespace decompiler
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "variable_naming.h"
 
+#include <array>
+#include <optional>
 #include <set>
+#include <stdexcept>
 
 #include "reg_usage.h"
 
@@ -301,6 +304,25 @@ int arg_count(const Function& f) {
     return 0;
   }
 }
+
+/*!
+ * The current SSA variable of each register, indexed by register ID.
+ */
+class CurrentRegs {
+ public:
+  bool contains(Register reg) const { return m_vars.at(reg.reg_id()).has_value(); }
+  const VarSSA& at(Register reg) const {
+    const auto& var = m_vars.at(reg.reg_id());
+    if (!var) {
+      throw std::out_of_range(fmt::format("No SSA variable for {}", reg.to_string()));
+    }
+    return *var;
+  }
+  void set(Register reg, const VarSSA& var) { m_vars.at(reg.reg_id()) = var; }
+
+ private:
+  std::array<std::optional<VarSSA>, Reg::MAX_REG_ID> m_vars;
+};
 }  // namespace
 
 /*!
@@ -332,7 +354,7 @@ SSA make_rc_ssa(const Function& function, const RegUsageInfo& rui, const Functio
     }
 
     // local map: current register names at the current op.
-    std::unordered_map<Register, VarSSA, Register::hash> current_regs;
+    CurrentRegs current_regs;
 
     // if we're block zero, write function arguments:
 
@@ -352,23 +374,16 @@ SSA make_rc_ssa(const Function& function, const RegUsageInfo& rui, const Functio
     }
 
     for (auto reg : init_regs) {
-      // to avoid operator[]
-      auto it = current_regs.find(reg);
-      if (it != current_regs.end()) {
-        ASSERT(false);
-        it->second = ssa.get_phi_dest(block_id, reg);
-      } else {
-        current_regs.insert(std::make_pair(reg, ssa.get_phi_dest(block_id, reg)));
-      }
+      ASSERT(!current_regs.contains(reg));
+      current_regs.set(reg, ssa.get_phi_dest(block_id, reg));
     }
 
     if (block_id == 0) {
       SSA::Ins ins(-1);
       for (int i = 0; i < arg_count(function); i++) {
         auto dest_reg = Register::get_arg_reg(i);
-        auto it = current_regs.find(dest_reg);
-        if (it == current_regs.end()) {
-          current_regs.insert(std::make_pair(dest_reg, ssa.get_phi_dest(block_id, dest_reg)));
+        if (!current_regs.contains(dest_reg)) {
+          current_regs.set(dest_reg, ssa.get_phi_dest(block_id, dest_reg));
         }
         ins.src.push_back(current_regs.at(dest_reg));
       }
@@ -439,13 +454,7 @@ SSA make_rc_ssa(const Function& function, const RegUsageInfo& rui, const Functio
         if (w.get_kind() == Reg::FPR || w.get_kind() == Reg::GPR) {
           auto var = ssa.map.allocate(w);
           ssa_i.dst = var;
-          // avoid operator[] again
-          auto it = current_regs.find(w);
-          if (it != current_regs.end()) {
-            it->second = var;
-          } else {
-            current_regs.insert(std::make_pair(w, var));
-          }
+          current_regs.set(w, var);
         }
       }
 
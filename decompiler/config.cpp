@@ -1,7 +1,11 @@
 #include "config.h"
 
+#include <thread>
+
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/hash.h"
 #include "common/util/json_util.h"
 
 #include "decompiler/util/config_parsers.h"
@@ -35,6 +39,58 @@ nlohmann::json read_json_file_from_config(const nlohmann::json& json, const std:
   return parse_commented_json(file_txt, file_name);
 }
 
+/*!
+ * The json files named by the config, read and parsed in parallel. Parsing them is most of the
+ * time it takes to load the config.
+ */
+class ConfigJsonFiles {
+ public:
+  ConfigJsonFiles(const nlohmann::json& json, const std::vector<std::string>& file_keys)
+      : m_json(json) {
+    std::vector<std::string> keys;
+    for (const auto& key : file_keys) {
+      if (json.contains(key)) {
+        keys.push_back(key);
+      }
+    }
+    std::vector<nlohmann::json> files(keys.size());
+    ThreadPool::global().parallel_for(
+        (int)keys.size(), [&](int i) { files[i] = read_json_file_from_config(json, keys[i]); });
+    for (size_t i = 0; i < keys.size(); i++) {
+      m_files[keys[i]] = std::move(files[i]);
+    }
+  }
+
+  /*!
+   * Get the parsed file for file_key. Each file can only be taken once.
+   */
+  nlohmann::json take(const std::string& file_key) {
+    auto it = m_files.find(file_key);
+    if (it == m_files.end()) {
+      // not one of the files loaded up front, or missing from the config (this throws).
+      return read_json_file_from_config(m_json, file_key);
+    }
+    auto result = std::move(it->second);
+    m_files.erase(it);
+    return result;
+  }
+
+ private:
+  const nlohmann::json& m_json;
+  std::unordered_map<std::string, nlohmann::json> m_files;
+};
+
+/*!
+ * Mix the config entry for a function or object file into its hash, for the decompiler cache.
+ */
+void add_config_entry_hash(Config& config,
+                           const std::string& kind,
+                           const std::string& name,
+                           const nlohmann::json& entry) {
+  auto& hash = config.config_entry_hashes[name];
+  hash = hash_util::hash64(fmt::format("{:016x} {} {}", hash, kind, entry.dump()));
+}
+
 Config make_config_via_json(nlohmann::json& json) {
   Config config;
   int version_int = json.at("game_version").get<int>();
@@ -46,8 +102,33 @@ Config make_config_via_json(nlohmann::json& json) {
     config.expected_elf_name = json.at("expected_elf_name").get<std::string>();
   }
   config.all_types_file = json.at("all_types_file").get<std::string>();
+  if (json.contains("ignore_var_name_casts")) {
+    config.ignore_var_name_casts = json.at("ignore_var_name_casts").get<bool>();
+  }
 
-  auto inputs_json = read_json_file_from_config(json, "inputs_file");
+  std::vector<std::string> file_keys = {"inputs_file",
+                                        "art_group_dump_file",
+                                        "joint_node_dump_file",
+                                        "tex_dump_file",
+                                        "type_casts_file",
+                                        "type_casts_merge_file",
+                                        "anonymous_function_types_file",
+                                        "anonymous_function_types_merge_file",
+                                        "label_types_file",
+                                        "label_types_merge_file",
+                                        "stack_structures_file",
+                                        "stack_structures_merge_file",
+                                        "hacks_file",
+                                        "hacks_merge_file",
+                                        "art_info_file",
+                                        "import_deps_file",
+                                        "process_stack_size_file"};
+  if (!config.ignore_var_name_casts) {
+    file_keys.push_back("var_names_file");
+  }
+  ConfigJsonFiles files(json, file_keys);
+
+  auto inputs_json = files.take("inputs_file");
   config.dgo_names = json.contains("dgo_names")
                          ? json.at("dgo_names").get<std::vector<std::string>>()
                          : inputs_json.at("dgo_names").get<std::vector<std::string>>();
@@ -68,26 +149,20 @@ Config make_config_via_json(nlohmann::json& json) {
       inputs_json.at("streamed_audio_file_names").get<std::vector<std::string>>();
 
   if (json.contains("art_group_dump_file")) {
-    auto json_data = file_util::read_text_file(
-        file_util::get_file_path({json.at("art_group_dump_file").get<std::string>()}));
-    std::unordered_map<std::string, std::unordered_map<int, std::string>> serialized =
-        parse_commented_json(json_data, "art_group_dump_file");
-    config.art_group_info_dump = serialized;
+    config.art_group_info_dump =
+        files.take("art_group_dump_file")
+            .get<std::unordered_map<std::string, std::unordered_map<int, std::string>>>();
   }
 
   if (json.contains("joint_node_dump_file")) {
-    auto json_data = file_util::read_text_file(
-        file_util::get_file_path({json.at("joint_node_dump_file").get<std::string>()}));
-    std::unordered_map<std::string, std::unordered_map<int, std::string>> serialized =
-        parse_commented_json(json_data, "joint_node_dump_file");
-    config.jg_info_dump = serialized;
+    config.jg_info_dump =
+        files.take("joint_node_dump_file")
+            .get<std::unordered_map<std::string, std::unordered_map<int, std::string>>>();
   }
 
   if (json.contains("tex_dump_file")) {
-    auto json_data = file_util::read_text_file(
-        file_util::get_file_path({json.at("tex_dump_file").get<std::string>()}));
-    std::unordered_map<u32, TexInfo> serialized = parse_commented_json(json_data, "tex_dump_file");
-    config.texture_info_dump = serialized;
+    config.texture_info_dump =
+        files.take("tex_dump_file").get<std::unordered_map<u32, TexInfo>>();
   }
 
   if (json.contains("obj_file_name_map_file")) {
@@ -124,12 +199,28 @@ Config make_config_via_json(nlohmann::json& json) {
   config.is_pal = json.at("is_pal").get<bool>();
   config.rip_levels = json.at("rip_levels").get<bool>();
   config.extract_collision = json.at("extract_collision").get<bool>();
+  if (json.contains("compress_background_textures")) {
+    config.compress_background_textures = json.at("compress_background_textures").get<bool>();
+  }
+  if (json.contains("compressed_texture_cache_dir")) {
+    config.compressed_texture_cache_dir =
+        json.at("compressed_texture_cache_dir").get<std::string>();
+  }
   config.generate_all_types = json.at("generate_all_types").get<bool>();
   if (json.contains("read_spools")) {
     config.read_spools = json.at("read_spools").get<bool>();
   }
-  if (json.contains("ignore_var_name_casts")) {
-    config.ignore_var_name_casts = json.at("ignore_var_name_casts").get<bool>();
+  if (json.contains("ir2_threads")) {
+    config.ir2_threads = json.at("ir2_threads").get<int>();
+    if (config.ir2_threads <= 0) {
+      config.ir2_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+  }
+  if (json.contains("ir2_pass_stats")) {
+    config.ir2_pass_stats = json.at("ir2_pass_stats").get<bool>();
+  }
+  if (json.contains("decompiler_cache_dir")) {
+    config.decompiler_cache_dir = json.at("decompiler_cache_dir").get<std::string>();
   }
   if (json.contains("old_all_types_file")) {
     config.old_all_types_file = json.at("old_all_types_file").get<std::string>();
@@ -143,13 +234,14 @@ Config make_config_via_json(nlohmann::json& json) {
     config.banned_objects.insert(x);
   }
 
-  auto type_casts_json = read_json_file_from_config(json, "type_casts_file");
+  auto type_casts_json = files.take("type_casts_file");
   if (json.contains("type_casts_merge_file")) {
-    type_casts_json.update(read_json_file_from_config(json, "type_casts_merge_file"));
+    type_casts_json.update(files.take("type_casts_merge_file"));
   }
   for (auto& kv : type_casts_json.items()) {
     auto& function_name = kv.key();
     auto& casts = kv.value();
+    add_config_entry_hash(config, "casts", function_name, casts);
     for (auto& cast : casts) {
       if (cast.at(0).is_string()) {
         auto cast_name = cast.at(0).get<std::string>();
@@ -177,13 +269,14 @@ Config make_config_via_json(nlohmann::json& json) {
     }
   }
 
-  auto anon_func_json = read_json_file_from_config(json, "anonymous_function_types_file");
+  auto anon_func_json = files.take("anonymous_function_types_file");
   if (json.contains("anonymous_function_types_merge_file")) {
-    anon_func_json.update(read_json_file_from_config(json, "anonymous_function_types_merge_file"));
+    anon_func_json.update(files.take("anonymous_function_types_merge_file"));
   }
   for (auto& kv : anon_func_json.items()) {
     auto& obj_file_name = kv.key();
     auto& anon_types = kv.value();
+    add_config_entry_hash(config, "anon", obj_file_name, anon_types);
     for (auto& anon_type : anon_types) {
       auto id = anon_type.at(0).get<int>();
       const auto& type_name = anon_type.at(1).get<std::string>();
@@ -191,9 +284,10 @@ Config make_config_via_json(nlohmann::json& json) {
     }
   }
   if (!config.ignore_var_name_casts) {
-    auto var_names_json = read_json_file_from_config(json, "var_names_file");
+    auto var_names_json = files.take("var_names_file");
     for (auto& kv : var_names_json.items()) {
       auto& function_name = kv.key();
+      add_config_entry_hash(config, "vars", function_name, kv.value());
       auto arg = kv.value().find("args");
       if (arg != kv.value().end()) {
         for (auto& x : arg.value()) {
@@ -219,13 +313,14 @@ Config make_config_via_json(nlohmann::json& json) {
     }
   }
 
-  auto label_types_json = read_json_file_from_config(json, "label_types_file");
+  auto label_types_json = files.take("label_types_file");
   if (json.contains("label_types_merge_file")) {
-    label_types_json.update(read_json_file_from_config(json, "label_types_merge_file"));
+    label_types_json.update(files.take("label_types_merge_file"));
   }
   for (auto& kv : label_types_json.items()) {
     auto& obj_name = kv.key();
     auto& types = kv.value();
+    add_config_entry_hash(config, "labels", obj_name, types);
     for (auto& x : types) {
       const auto& name = x.at(0).get<std::string>();
       const auto& type_name = x.at(1).get<std::string>();
@@ -243,22 +338,23 @@ Config make_config_via_json(nlohmann::json& json) {
     }
   }
 
-  auto stack_structures_json = read_json_file_from_config(json, "stack_structures_file");
+  auto stack_structures_json = files.take("stack_structures_file");
   if (json.contains("stack_structures_merge_file")) {
-    stack_structures_json.update(read_json_file_from_config(json, "stack_structures_merge_file"));
+    stack_structures_json.update(files.take("stack_structures_merge_file"));
   }
   for (auto& kv : stack_structures_json.items()) {
     auto& func_name = kv.key();
     auto& stack_structures = kv.value();
+    add_config_entry_hash(config, "stack", func_name, stack_structures);
     config.stack_structure_hints_by_function[func_name] =
         parse_stack_structure_hints(stack_structures);
   }
 
-  auto hacks_json = read_json_file_from_config(json, "hacks_file");
+  auto hacks_json = files.take("hacks_file");
   if (json.contains("hacks_merge_file")) {
     // NOTE - here we merge one level deeper because it's worth doing here
     // - chances are you just need to override a few individual hacks
-    const auto hack_overrides = read_json_file_from_config(json, "hacks_merge_file");
+    const auto hack_overrides = files.take("hacks_merge_file");
     for (const auto& entry : hack_overrides.items()) {
       if (hacks_json.contains(entry.key())) {
         // If the parent json file has this, update it
@@ -333,7 +429,7 @@ Config make_config_via_json(nlohmann::json& json) {
     config.common_tpages = inputs_json.at("common_tpages").get<std::unordered_set<int>>();
   }
 
-  auto art_info_json = read_json_file_from_config(json, "art_info_file");
+  auto art_info_json = files.take("art_info_file");
   config.art_group_type_remap =
       art_info_json.at("type_remap").get<std::unordered_map<std::string, std::string>>();
   if (art_info_json.contains("file_override")) {
@@ -344,7 +440,7 @@ Config make_config_via_json(nlohmann::json& json) {
   config.joint_node_hacks =
       art_info_json.at("joint_node_hacks").get<std::unordered_map<std::string, std::string>>();
 
-  auto import_deps = read_json_file_from_config(json, "import_deps_file");
+  auto import_deps = files.take("import_deps_file");
   config.import_deps_by_file =
       import_deps.get<std::unordered_map<std::string, std::vector<std::string>>>();
 
@@ -363,10 +459,21 @@ Config make_config_via_json(nlohmann::json& json) {
     config.object_patches.insert({obj, new_pch});
   }
 
-  auto process_stack_size_json = read_json_file_from_config(json, "process_stack_size_file");
+  auto process_stack_size_json = files.take("process_stack_size_file");
   config.process_stack_size_overrides =
       process_stack_size_json.get<std::unordered_map<std::string, int>>();
 
+  // everything else is hashed together, so changing it invalidates every cached object file.
+  // the settings that don't change the output are left out.
+  auto main_json = json;
+  main_json.erase("ir2_threads");
+  main_json.erase("ir2_pass_stats");
+  main_json.erase("decompiler_cache_dir");
+  main_json.erase("compressed_texture_cache_dir");
+  config.global_config_hash =
+      hash_util::hash64(main_json.dump() + hacks_json.dump() + art_info_json.dump() +
+                        import_deps.dump() + process_stack_size_json.dump());
+
   return config;
 }
 }  // namespace
@@ -124,6 +124,8 @@ struct Config {
   bool dump_tex_info = false;
   bool rip_levels = false;
   bool extract_collision = false;
+  bool compress_background_textures = false;
+  std::string compressed_texture_cache_dir;
   bool find_functions = false;
   bool read_spools = false;
   bool ignore_var_name_casts = false;
@@ -139,6 +141,18 @@ struct Config {
   bool generate_all_types = false;
   std::optional<std::string> old_all_types_file;
 
+  // number of threads used to run the IR2 passes on object files. 1 runs them serially.
+  int ir2_threads = 1;
+  // time each IR2 pass per function and object file, and write a report and a profiler trace.
+  bool ir2_pass_stats = false;
+
+  // folder for the per-object decompiler cache, empty if the cache is disabled.
+  std::string decompiler_cache_dir;
+  // hash of all config that may affect the output of any object file.
+  u64 global_config_hash = 0;
+  // hash of the config entries for each function or object file name (casts, var names, etc.)
+  std::unordered_map<std::string, u64> config_entry_hashes;
+
   bool is_pal = false;
 
   bool write_patches = false;
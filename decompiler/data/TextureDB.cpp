@@ -2,6 +2,7 @@
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/hash.h"
 
 #include "fmt/core.h"
 #define STBI_WINDOWS_UTF8
@@ -15,6 +16,10 @@ TextureDB::TextureDB() {
               "placeholder-white", "placeholder", {}, 1, 0);
 }
 
+u64 TextureDB::hash_texture_data(const std::vector<u32>& data) {
+  return hash_util::hash64(data.data(), data.size() * sizeof(u32));
+}
+
 void TextureDB::add_texture(u32 tpage,
                             u32 texid,
                             const std::vector<u32>& data,
@@ -45,6 +50,7 @@ void TextureDB::add_texture(u32 tpage,
   } else {
     auto& new_tex = textures[combo_id];
     new_tex.rgba_bytes = data;
+    new_tex.content_hash = hash_texture_data(data);
     new_tex.name = tex_name;
     new_tex.w = w;
     new_tex.h = h;
@@ -124,19 +130,28 @@ void TextureDB::merge_textures(const fs::path& base_path) {
           tex.second.rgba_bytes.at(i / 4) = merge_pixel;
         }
       }
+      tex.second.content_hash = hash_texture_data(tex.second.rgba_bytes);
       stbi_image_free(merge_data);
     }
   }
 }
 
+/*!
+ * Replace textures with PNGs from path. A texture is replaced by <tpage>/<name>.png, then
+ * _all/<name>.png, then _by_hash/<content hash as 16 hex digits>.png, which replaces every
+ * texture with those exact pixels, whatever it's called.
+ */
 void TextureDB::replace_textures(const fs::path& path) {
   fs::path base_path(path);
   for (auto& tex : textures) {
     fs::path full_path = base_path / tpage_names.at(tex.second.page) / (tex.second.name + ".png");
     if (!fs::exists(full_path)) {
       full_path = base_path / "_all" / (tex.second.name + ".png");
-      if (!fs::exists(full_path))
-        continue;
+      if (!fs::exists(full_path)) {
+        full_path = base_path / "_by_hash" / fmt::format("{:016x}.png", tex.second.content_hash);
+        if (!fs::exists(full_path))
+          continue;
+      }
     }
     lg::info("Replacing {}", tpage_names.at(tex.second.page) + "/" + (tex.second.name));
     int w, h;
@@ -149,6 +164,7 @@ void TextureDB::replace_textures(const fs::path& path) {
     memcpy(tex.second.rgba_bytes.data(), data, w * h * 4);
     tex.second.w = w;
     tex.second.h = h;
+    tex.second.content_hash = hash_texture_data(tex.second.rgba_bytes);
     stbi_image_free(data);
   }
 }
@@ -20,8 +20,12 @@ struct TextureDB {
     u32 dest = -1;
     std::vector<u32> rgba_bytes;
     u32 num_mips = -1;
+    // hash64 of rgba_bytes, updated whenever the data changes.
+    u64 content_hash = 0;
   };
 
+  static u64 hash_texture_data(const std::vector<u32>& data);
+
   std::map<u32, TextureData> textures;
   std::unordered_map<u32, std::string> tpage_names;
   std::unordered_map<std::string, std::set<u32>> texture_ids_per_level;
@@ -177,7 +177,7 @@ int run_decompilation_process(decompiler::Config config,
   if (config.generate_all_types) {
     ASSERT_MSG(config.decompile_code, "Must decompile code to generate all-types");
     db.ir2_analyze_all_types(out_folder / "new-all-types.gc", config.old_all_types_file,
-                             config.hacks.types_with_bad_inspect_methods);
+                             config.hacks.types_with_bad_inspect_methods, config.ir2_threads);
   }
 
   lg::info("[Mem] After decomp: {} MB", get_peak_rss() / (1024 * 1024));
@@ -1,5 +1,7 @@
 #include "extractor_util.h"
 
+#include <algorithm>
+#include <future>
 #include <optional>
 #include <regex>
 #include <unordered_map>
@@ -7,6 +9,8 @@
 #include "common/log/log.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/hash.h"
 #include "common/util/json_util.h"
 #include "common/util/read_iso_file.h"
 
@@ -280,3 +284,97 @@ std::tuple<uint64_t, int> calculate_extraction_hash(const fs::path& extracted_is
   }
   return {XXH64(&combined_hash, sizeof(uint64_t), 0), filec};
 }
+
+uint64_t hash_file_contents(const fs::path& path) {
+  constexpr size_t kChunkSize = 16 * 1024 * 1024;
+  auto fp = file_util::open_file(path, "rb");
+  ASSERT_MSG(fp, fmt::format("failed to open {} to hash it", path.string()));
+  std::vector<u8> chunks[2] = {std::vector<u8>(kChunkSize), std::vector<u8>(kChunkSize)};
+  auto read_chunk = [&](int idx) {
+    return ThreadPool::global().submit(
+        [&, idx]() { return fread(chunks[idx].data(), 1, kChunkSize, fp); });
+  };
+
+  hash_util::Hasher hasher;
+  int idx = 0;
+  auto next = read_chunk(idx);
+  while (true) {
+    const size_t bytes = ThreadPool::global().wait(next);
+    if (bytes == 0) {
+      break;
+    }
+    next = read_chunk(idx ^ 1);
+    hasher.update(chunks[idx].data(), bytes);
+    idx ^= 1;
+  }
+  fclose(fp);
+  return hasher.digest64();
+}
+
+uint64_t hash_dir_listing(const fs::path& dir) {
+  if (!fs::exists(dir)) {
+    return 0;
+  }
+  std::vector<std::tuple<std::string, uintmax_t, int64_t>> files;
+  for (const auto& entry : fs::recursive_directory_iterator(dir)) {
+    if (entry.is_regular_file()) {
+      files.emplace_back(fs::relative(entry.path(), dir).generic_string(), entry.file_size(),
+                         (int64_t)entry.last_write_time().time_since_epoch().count());
+    }
+  }
+  // the order of a directory iterator isn't specified.
+  std::sort(files.begin(), files.end());
+  hash_util::Hasher hasher;
+  for (const auto& [name, size, time] : files) {
+    hasher.update(name);
+    hasher.update_pod(size);
+    hasher.update_pod(time);
+  }
+  return hasher.digest64();
+}
+
+ExtractorManifest::ExtractorManifest(const fs::path& path) : m_path(path) {
+  if (!fs::exists(m_path)) {
+    return;
+  }
+  try {
+    m_stages = parse_commented_json(file_util::read_text_file(m_path), m_path.string());
+    if (m_stages.is_object()) {
+      return;
+    }
+  } catch (std::exception& e) {
+    lg::warn("Ignoring the extractor manifest {}, it couldn't be read: {}", m_path.string(),
+             e.what());
+  }
+  m_stages = nlohmann::json::object();
+}
+
+bool ExtractorManifest::is_current(const std::string& stage, const std::string& key) const {
+  auto it = m_stages.find(stage);
+  return it != m_stages.end() && it->value("key", "") == key;
+}
+
+nlohmann::json ExtractorManifest::info(const std::string& stage) const {
+  auto it = m_stages.find(stage);
+  if (it == m_stages.end()) {
+    return {};
+  }
+  return it->value("info", nlohmann::json());
+}
+
+void ExtractorManifest::start(const std::string& stage) {
+  m_stages.erase(stage);
+}
+
+void ExtractorManifest::finish(const std::string& stage,
+                               const std::string& key,
+                               const nlohmann::json& info) {
+  m_stages[stage] = {{"key", key}, {"info", info}};
+}
+
+void ExtractorManifest::save() const {
+  const auto text = m_stages.dump(2);
+  if (!file_util::write_binary_file_atomic(m_path, text.data(), text.size())) {
+    lg::warn("Failed to write the extractor manifest {}", m_path.string());
+  }
+}
@@ -74,3 +74,41 @@ std::tuple<bool, ExtractorErrorCode> is_iso_file(fs::path path_to_supposed_iso);
 std::tuple<uint64_t, int> calculate_extraction_hash(const IsoFile& iso_file);
 
 std::tuple<uint64_t, int> calculate_extraction_hash(const fs::path& extracted_iso_path);
+
+/*!
+ * Hash the contents of a file. It's read in large chunks, and the next chunk is read on the thread
+ * pool while the current one is hashed.
+ */
+uint64_t hash_file_contents(const fs::path& path);
+
+/*!
+ * Hash the paths, sizes and modification times of all the files in a folder and its subfolders.
+ * This notices a change to the folder without reading the files. Returns 0 if it doesn't exist.
+ */
+uint64_t hash_dir_listing(const fs::path& dir);
+
+/*!
+ * Remembers what each stage of the extraction was last run on, so a re-run can skip the stages
+ * that have nothing new to do. A stage's key should cover the hashes of everything it reads and
+ * the version of the code that runs it. The stage can also record some info for the next run, like
+ * where its output went.
+ *
+ * A stage is forgotten when it starts and remembered when it finishes, so a stage that fails or is
+ * interrupted is always run again.
+ */
+class ExtractorManifest {
+ public:
+  explicit ExtractorManifest(const fs::path& path);
+
+  bool is_current(const std::string& stage, const std::string& key) const;
+  // The info recorded when the stage finished, or null.
+  nlohmann::json info(const std::string& stage) const;
+
+  void start(const std::string& stage);
+  void finish(const std::string& stage, const std::string& key, const nlohmann::json& info = {});
+  void save() const;
+
+ private:
+  fs::path m_path;
+  nlohmann::json m_stages = nlohmann::json::object();
+};
@@ -1,6 +1,9 @@
+#include <map>
+
 #include "common/log/log.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/hash.h"
 #include "common/util/read_iso_file.h"
 #include "common/util/term_util.h"
 #include "common/util/unicode_util.h"
@@ -16,6 +19,15 @@
 const std::unordered_map<std::string, std::string> data_subfolders = {{"jak1", "jak1"},
                                                                       {"jak2", "jak2"}};
 
+// bump these if a change to the extractor changes the output of that stage, so it's redone.
+constexpr int kExtractStageVersion = 1;
+constexpr int kDecompileStageVersion = 1;
+
+std::string to_stage_key(const hash_util::Hasher& hasher) {
+  const auto hash = hasher.digest128();
+  return fmt::format("{:016x}{:016x}", hash.hi, hash.lo);
+}
+
 IsoFile extract_files(fs::path input_file_path, fs::path extracted_iso_path) {
   lg::info(
       "Note: Provided game data path '{}' points to a file, not a directory. Assuming it's an ISO "
@@ -101,9 +113,34 @@ std::tuple<std::optional<ISOMetadata>, ExtractorErrorCode> validate(
   };
 }
 
+/*!
+ * The decompiler's output depends on the decompiler itself, its config, the game files and the
+ * replacement assets.
+ */
+std::string decompile_stage_key(const decompiler::Config& config, const fs::path& in_folder) {
+  hash_util::Hasher hasher;
+  hasher.update(fmt::format("{} {:016x} {:016x}\n", kDecompileStageVersion,
+                            hash_file_contents(file_util::get_current_executable_path()),
+                            config.global_config_hash));
+  const std::map<std::string, u64> config_entries(config.config_entry_hashes.begin(),
+                                                  config.config_entry_hashes.end());
+  for (const auto& [name, hash] : config_entries) {
+    hasher.update(fmt::format("{} {:016x}\n", name, hash));
+  }
+  const auto project_dir = file_util::get_jak_project_dir();
+  const auto game_name = game_version_names[config.game_version];
+  hasher.update_pod(hash_file_contents(project_dir / config.all_types_file));
+  hasher.update_pod(hash_dir_listing(in_folder));
+  hasher.update_pod(hash_dir_listing(project_dir / "custom_assets" / game_name));
+  hasher.update_pod(
+      hash_dir_listing(project_dir / "game" / "assets" / game_name / "texture_merges"));
+  return to_stage_key(hasher);
+}
+
 ExtractorErrorCode decompile(const fs::path& in_folder,
                              const std::string& data_subfolder,
-                             const std::string& config_override) {
+                             const std::string& config_override,
+                             ExtractorManifest& manifest) {
   // Determine which config to use from the database
   const auto version_info = get_version_info_or_default(in_folder);
 
@@ -113,11 +150,25 @@ ExtractorErrorCode decompile(const fs::path& in_folder,
       version_info.decomp_config_version, config_override);
 
   auto out_folder = file_util::get_jak_project_dir() / "decompiler_out" / data_subfolder;
+  auto level_folder = file_util::get_jak_project_dir() / "out" /
+                      game_version_names[config.game_version] / "fr3";
+
+  const auto stage = fmt::format("decompile-{}", data_subfolder);
+  const auto key = decompile_stage_key(config, in_folder);
+  if (manifest.is_current(stage, key) && fs::exists(out_folder) &&
+      (!config.levels_extract || fs::exists(level_folder))) {
+    lg::info("Skipping decompilation, nothing it uses has changed since the last run");
+    return ExtractorErrorCode::SUCCESS;
+  }
+  manifest.start(stage);
+  manifest.save();
 
   const auto result = run_decompilation_process(config, in_folder, out_folder, true);
   if (result != 0) {
     return ExtractorErrorCode::DECOMPILATION_GENERIC_ERROR;
   }
+  manifest.finish(stage, key);
+  manifest.save();
   return ExtractorErrorCode::SUCCESS;
 }
 
@@ -263,7 +314,37 @@ int main(int argc, char** argv) {
   }
   std::string data_subfolder = data_subfolders.at(game_name);
 
-  if (flag_extract) {
+  const auto extraction_root =
+      extraction_path.empty() ? file_util::get_jak_project_dir() / "iso_data" : extraction_path;
+  ExtractorManifest manifest(extraction_root / "extractor-manifest.json");
+
+  // An ISO that was already extracted and verified doesn't need to be extracted again, as long as
+  // the extracted files haven't been touched since.
+  bool skip_extract = false;
+  std::string extract_key;
+  if (flag_extract && fs::is_regular_file(input_file_path)) {
+    const auto [iso_ok, iso_code] = is_iso_file(input_file_path);
+    if (!iso_ok) {
+      return static_cast<int>(iso_code);
+    }
+    lg::info("Hashing {}...", input_file_path.string());
+    extract_key =
+        fmt::format("{} {:016x}", kExtractStageVersion, hash_file_contents(input_file_path));
+    const auto info = manifest.info("extract");
+    if (manifest.is_current("extract", extract_key)) {
+      const fs::path previous_path = info.at("iso_data_path").get<std::string>();
+      if (hash_dir_listing(previous_path) == info.at("listing").get<u64>() &&
+          fs::exists(previous_path / "buildinfo.json")) {
+        lg::info("Skipping extraction, this ISO is already extracted to {}",
+                 previous_path.string());
+        skip_extract = true;
+        iso_data_path = previous_path;
+        data_subfolder = info.at("data_subfolder").get<std::string>();
+      }
+    }
+  }
+
+  if (flag_extract && !skip_extract) {
     // we extract to a temporary location because we don't know what we're extracting yet!
     fs::path temp_iso_extract_location = file_util::get_jak_project_dir() / "iso_data" / "_temp";
     if (!extraction_path.empty()) {
@@ -277,11 +358,9 @@ int main(int argc, char** argv) {
     fs::create_directories(temp_iso_extract_location);
 
     if (fs::is_regular_file(input_file_path)) {
-      // If it's a file, then it better be an iso file
-      const auto [iso_ok, iso_code] = is_iso_file(input_file_path);
-      if (!iso_ok) {
-        return static_cast<int>(iso_code);
-      }
+      // If it's a file, then it better be an iso file (checked above)
+      manifest.start("extract");
+      manifest.save();
 
       // Extract to the temporary location
       const auto iso_file = extract_files(input_file_path, temp_iso_extract_location);
@@ -340,9 +419,6 @@ int main(int argc, char** argv) {
     }
 
     // write out a json file with some metadata for the game
-    if (fs::exists(iso_data_path / "buildinfo.json")) {
-      fs::remove(iso_data_path / "buildinfo.json");
-    }
     const auto [serial, elf_hash] = findElfFile(iso_data_path);
     BuildInfo build_info;
     if (serial.has_value()) {
@@ -352,8 +428,21 @@ int main(int argc, char** argv) {
       build_info.elf_hash = elf_hash.value();
     }
     const nlohmann::json json_data{build_info};
-    file_util::write_text_file((iso_data_path / "buildinfo.json").string(), json_data.dump(2));
-  } else {
+    const auto buildinfo_path = iso_data_path / "buildinfo.json";
+    // only if it changed, the decompiler is redone when anything in the folder is modified.
+    if (!fs::exists(buildinfo_path) ||
+        file_util::read_text_file(buildinfo_path) != json_data.dump(2)) {
+      file_util::write_text_file(buildinfo_path, json_data.dump(2));
+    }
+
+    if (!extract_key.empty() && iso_data_path != temp_iso_extract_location) {
+      manifest.finish("extract", extract_key,
+                      {{"iso_data_path", iso_data_path.string()},
+                       {"data_subfolder", data_subfolder},
+                       {"listing", hash_dir_listing(iso_data_path)}});
+      manifest.save();
+    }
+  } else if (!flag_extract) {
     // If we did not extract, we have no clue what game the user is trying to decompile / compile
     // this is why the user has to specify this!
     if (flag_folder) {
@@ -365,7 +454,8 @@ int main(int argc, char** argv) {
 
   if (flag_decompile) {
     try {
-      const auto status_code = decompile(iso_data_path, data_subfolder, decomp_config_override);
+      const auto status_code =
+          decompile(iso_data_path, data_subfolder, decomp_config_override, manifest);
       if (status_code != ExtractorErrorCode::SUCCESS) {
         return static_cast<int>(status_code);
       }
@@ -0,0 +1,122 @@
+#include "GlbWriter.h"
+
+#include <cctype>
+#include <sstream>
+
+#include "common/util/Assert.h"
+
+#include "fmt/core.h"
+
+GlbWriter::GlbWriter(const fs::path& glb_file)
+    : m_glb_file(glb_file), m_bin_file(glb_file.string() + ".bin.tmp") {
+  file_util::create_dir_if_needed_for_file(m_glb_file);
+  m_bin = file_util::open_file(m_bin_file, "wb");
+  ASSERT_MSG(m_bin, fmt::format("Failed to open {}", m_bin_file.string()));
+}
+
+GlbWriter::~GlbWriter() {
+  if (m_bin) {
+    fclose(m_bin);
+    fs::remove(m_bin_file);
+  }
+}
+
+/*!
+ * Add data to the end of the GLB buffer, and return its offset.
+ */
+size_t GlbWriter::append(const void* data, size_t size) {
+  // keep everything 4-byte aligned, which is enough for all accessor component types.
+  static const u8 zeros[4] = {0, 0, 0, 0};
+  size_t padding = (4 - (m_bin_size % 4)) % 4;
+  fwrite(zeros, 1, padding, m_bin);
+  m_bin_size += padding;
+
+  size_t offset = m_bin_size;
+  if (size) {
+    size_t written = fwrite(data, size, 1, m_bin);
+    ASSERT_MSG(written == 1, fmt::format("Failed to write to {}", m_bin_file.string()));
+  }
+  m_bin_size += size;
+  return offset;
+}
+
+void GlbWriter::flush() {
+  std::vector<size_t> buffer_offsets;
+  for (auto& buffer : model.buffers) {
+    buffer_offsets.push_back(append(buffer.data.data(), buffer.data.size()));
+  }
+  model.buffers.clear();
+  for (size_t i = m_flushed_buffer_views; i < model.bufferViews.size(); i++) {
+    auto& view = model.bufferViews[i];
+    view.byteOffset += buffer_offsets.at(view.buffer);
+    view.buffer = 0;
+  }
+
+  for (size_t i = m_flushed_images; i < model.images.size(); i++) {
+    auto& image = model.images[i];
+    ASSERT(image.component == 4 && image.bits == 8);
+    auto png = file_util::encode_rgba_png(image.image.data(), image.width, image.height);
+    image.bufferView = (int)model.bufferViews.size();
+    auto& view = model.bufferViews.emplace_back();
+    view.buffer = 0;
+    view.byteOffset = append(png.data(), png.size());
+    view.byteLength = png.size();
+    image.mimeType = "image/png";
+    image.image = {};
+  }
+
+  m_flushed_buffer_views = model.bufferViews.size();
+  m_flushed_images = model.images.size();
+}
+
+void GlbWriter::finish() {
+  flush();
+  fclose(m_bin);
+  m_bin = nullptr;
+
+  // the JSON for everything but the buffer, which tinygltf doesn't know about.
+  std::ostringstream json_stream;
+  tinygltf::TinyGLTF gltf;
+  gltf.WriteGltfSceneToStream(&model, json_stream, false, false);
+  std::string json = json_stream.str();
+  while (!json.empty() && std::isspace((unsigned char)json.back())) {
+    json.pop_back();
+  }
+  ASSERT(!json.empty() && json.back() == '}');
+  json.pop_back();
+  json += fmt::format(",\"buffers\":[{{\"byteLength\":{}}}]}}", m_bin_size);
+  // chunks must be 4-byte aligned. JSON is padded with spaces, and binary with zeros.
+  while (json.size() % 4) {
+    json.push_back(' ');
+  }
+  size_t bin_chunk_size = (m_bin_size + 3) & ~size_t(3);
+  size_t total_size = 12 + 8 + json.size() + (m_bin_size ? 8 + bin_chunk_size : 0);
+  ASSERT_MSG(total_size <= UINT32_MAX, "GLB files can't be bigger than 4 GB");
+
+  FILE* out = file_util::open_file(m_glb_file, "wb");
+  ASSERT_MSG(out, fmt::format("Failed to open {}", m_glb_file.string()));
+  auto write_u32 = [&](u32 x) { fwrite(&x, sizeof(u32), 1, out); };
+  write_u32(0x46546C67);  // glTF
+  write_u32(2);
+  write_u32(total_size);
+  write_u32(json.size());
+  write_u32(0x4E4F534A);  // JSON
+  fwrite(json.data(), 1, json.size(), out);
+
+  if (m_bin_size) {
+    write_u32(bin_chunk_size);
+    write_u32(0x004E4942);  // BIN
+    FILE* in = file_util::open_file(m_bin_file, "rb");
+    ASSERT(in);
+    std::vector<u8> chunk(1024 * 1024);
+    size_t n;
+    while ((n = fread(chunk.data(), 1, chunk.size(), in)) > 0) {
+      fwrite(chunk.data(), 1, n, out);
+    }
+    fclose(in);
+    static const u8 zeros[4] = {0, 0, 0, 0};
+    fwrite(zeros, 1, bin_chunk_size - m_bin_size, out);
+  }
+  fclose(out);
+  fs::remove(m_bin_file);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdio>
+
+#include "common/util/FileUtil.h"
+
+#include "third-party/tiny_gltf/tiny_gltf.h"
+
+/*!
+ * Writes a binary glTF (.glb) file without keeping all of its data in memory.
+ *
+ * Build up the model like any tinygltf::Model, with buffers for the buffer views and RGBA data for
+ * images. flush moves the data of the buffers and images added since the last flush to a
+ * temporary file, as part of the single GLB buffer, and keeps only the rest of the model
+ * (accessors, buffer views, meshes...) in memory. Flushing after each part of a big model keeps
+ * memory use to about the size of the biggest part. finish writes the GLB file.
+ *
+ * tinygltf's own writer only puts the first buffer in the binary chunk of the GLB. Other buffers
+ * and all images are stored as base64 strings in the JSON, which takes several copies of the data
+ * in memory at once.
+ */
+class GlbWriter {
+ public:
+  explicit GlbWriter(const fs::path& glb_file);
+  ~GlbWriter();
+  GlbWriter(const GlbWriter&) = delete;
+  GlbWriter& operator=(const GlbWriter&) = delete;
+
+  void flush();
+  void finish();
+
+  tinygltf::Model model;
+
+ private:
+  size_t append(const void* data, size_t size);
+
+  fs::path m_glb_file;
+  fs::path m_bin_file;
+  FILE* m_bin = nullptr;
+  size_t m_bin_size = 0;
+  size_t m_flushed_buffer_views = 0;
+  size_t m_flushed_images = 0;
+};
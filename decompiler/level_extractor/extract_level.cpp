@@ -1,14 +1,20 @@
 #include "extract_level.h"
 
+#include <map>
+#include <mutex>
 #include <set>
 #include <thread>
+#include <unordered_map>
 
+#include "common/custom_data/Fr3File.h"
 #include "common/log/log.h"
+#include "common/texture/texture_compression.h"
 #include "common/util/FileUtil.h"
-#include "common/util/SimpleThreadGroup.h"
-#include "common/util/compress.h"
+#include "common/util/hash.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/string_util.h"
 
+#include "decompiler/extractor/extractor_util.h"
 #include "decompiler/level_extractor/BspHeader.h"
 #include "decompiler/level_extractor/extract_actors.h"
 #include "decompiler/level_extractor/extract_collide_frags.h"
@@ -23,6 +29,9 @@
 
 namespace decompiler {
 
+// bump this if a change to level extraction changes the fr3 files, so old ones aren't reused.
+constexpr int kLevelExtractVersion = 1;
+
 /*!
  * Look through files in a DGO and find the bsp-header file (the level)
  */
@@ -87,18 +96,140 @@ void add_all_textures_from_level(tfrag3::Level& lev,
   }
 }
 
+/*!
+ * Compressed mip chains by the hash of their texture data and format, shared by all levels being
+ * extracted. Most background textures are used by several levels, so each is only compressed once.
+ */
+class CompressedTextureCache {
+ public:
+  bool find(u64 key, std::vector<u8>* out) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_data.find(key);
+    if (it == m_data.end()) {
+      return false;
+    }
+    *out = it->second;
+    return true;
+  }
+
+  void insert(u64 key, const std::vector<u8>& data) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_data.try_emplace(key, data);
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::unordered_map<u64, std::vector<u8>> m_data;
+};
+
+/*!
+ * Replace the RGBA data of the textures drawn by tfrag, tie and shrub with compressed mip chains.
+ * Other textures keep their RGBA data, since some renderers read texture data on the CPU.
+ */
+void compress_background_textures(tfrag3::Level& lev,
+                                  const Config& config,
+                                  CompressedTextureCache& shared_cache) {
+  // bump this if the encoder output changes, to ignore old cache entries.
+  constexpr u64 kEncoderVersion = 1;
+
+  std::vector<bool> is_background(lev.textures.size(), false);
+  auto mark = [&](s64 tex_id) {
+    if (tex_id >= 0 && tex_id < (s64)lev.textures.size()) {
+      is_background[tex_id] = true;
+    }
+  };
+  for (const auto& geo : lev.tfrag_trees) {
+    for (const auto& tree : geo) {
+      for (const auto& draw : tree.draws) {
+        mark(draw.tree_tex_id);
+      }
+    }
+  }
+  for (const auto& geo : lev.tie_trees) {
+    for (const auto& tree : geo) {
+      for (const auto& draw : tree.static_draws) {
+        mark(draw.tree_tex_id);
+      }
+      for (const auto& draw : tree.instanced_wind_draws) {
+        mark(draw.tree_tex_id);
+      }
+    }
+  }
+  for (const auto& tree : lev.shrub_trees) {
+    for (const auto& draw : tree.static_draws) {
+      mark(draw.tree_tex_id);
+    }
+  }
+
+  std::vector<u32> to_compress;
+  for (u32 i = 0; i < lev.textures.size(); i++) {
+    if (is_background[i] && !lev.textures[i].is_compressed()) {
+      to_compress.push_back(i);
+    }
+  }
+
+  const bool use_cache = !config.compressed_texture_cache_dir.empty();
+  const fs::path cache_dir = file_util::get_file_path({config.compressed_texture_cache_dir});
+  if (use_cache) {
+    file_util::create_dir_if_needed(cache_dir);
+  }
+
+  ThreadPool::global().parallel_for(to_compress.size(), [&](int i) {
+    auto& tex = lev.textures[to_compress[i]];
+    const auto format = bc_pick_format(tex.data.data(), tex.data.size());
+    const u32 expected_size = bc_mip_chain_size(tex.w, tex.h, format);
+
+    u64 header[3] = {kEncoderVersion, (u64)format, ((u64)tex.w << 16) | tex.h};
+    hash_util::Hasher hasher;
+    hasher.update(header, sizeof(header));
+    hasher.update(tex.data.data(), tex.data.size() * 4);
+    const u64 hash = hasher.digest64();
+    shared_cache.find(hash, &tex.compressed_data);
+
+    fs::path cache_file;
+    if (use_cache && !tex.is_compressed()) {
+      cache_file = cache_dir / fmt::format("{:016x}.bc", hash);
+      if (fs::exists(cache_file)) {
+        auto cached = file_util::read_binary_file(cache_file);
+        if (cached.size() == expected_size) {
+          tex.compressed_data = std::move(cached);
+        }
+      }
+    }
+
+    if (!tex.is_compressed()) {
+      tex.compressed_data = bc_compress_mip_chain(tex.data.data(), tex.w, tex.h, format);
+      if (use_cache) {
+        // other levels may be writing the same texture, so write it somewhere else first.
+        auto temp_file = cache_file;
+        temp_file += fmt::format(".{}", std::hash<std::thread::id>()(std::this_thread::get_id()));
+        file_util::write_binary_file(temp_file, tex.compressed_data.data(),
+                                     tex.compressed_data.size());
+        std::error_code ec;
+        fs::rename(temp_file, cache_file, ec);
+      }
+    }
+    shared_cache.insert(hash, tex.compressed_data);
+    tex.compressed_format = format;
+    tex.data.clear();
+    tex.data.shrink_to_fit();
+  });
+}
+
 void confirm_textures_identical(const TextureDB& tex_db) {
-  std::unordered_map<std::string, std::vector<u32>> tex_dupl;
+  // compare by content hash, so the texture data isn't copied or compared again.
+  std::unordered_map<std::string, const TextureDB::TextureData*> tex_dupl;
   for (auto& tex : tex_db.textures) {
     auto name = tex_db.tpage_names.at(tex.second.page) + tex.second.name;
     auto it = tex_dupl.find(name);
     if (it == tex_dupl.end()) {
-      tex_dupl.insert({name, tex.second.rgba_bytes});
+      tex_dupl.insert({name, &tex.second});
     } else {
-      bool ok = it->second == tex.second.rgba_bytes;
+      bool ok = it->second->content_hash == tex.second.content_hash &&
+                it->second->rgba_bytes.size() == tex.second.rgba_bytes.size();
       if (!ok) {
         ASSERT_MSG(false, fmt::format("BAD duplicate: {} {} vs {}", name,
-                                      tex.second.rgba_bytes.size(), it->second.size()));
+                                      tex.second.rgba_bytes.size(), it->second->rgba_bytes.size()));
       }
     }
   }
@@ -265,19 +396,19 @@ level_tools::BspHeader extract_bsp_from_level(const ObjectFileDB& db,
  * Even though GAME.CGO isn't technically a level, the decompiler/loader treat it like one,
  * but the bsp stuff is just empty. It will contain only textures/art groups.
  */
-void extract_common(const ObjectFileDB& db,
+bool extract_common(const ObjectFileDB& db,
                     const TextureDB& tex_db,
                     const std::string& dgo_name,
                     const fs::path& output_folder,
                     const Config& config) {
   if (db.obj_files_by_dgo.count(dgo_name) == 0) {
     lg::warn("Skipping common extract for {} because the DGO was not part of the input", dgo_name);
-    return;
+    return false;
   }
 
   if (tex_db.textures.size() == 0) {
     lg::warn("Skipping common extract because there were no textures in the input");
-    return;
+    return false;
   }
 
   confirm_textures_identical(tex_db);
@@ -328,7 +459,7 @@ void extract_common(const ObjectFileDB& db,
   Serializer ser;
   tfrag_level.serialize(ser);
   auto compressed =
-      compression::compress_zstd(ser.get_save_result().first, ser.get_save_result().second);
+      tfrag3::make_fr3_file(ser.get_save_result().first, ser.get_save_result().second);
 
   lg::info("stats for {}", dgo_name);
   print_memory_usage(tfrag_level, ser.get_save_result().second);
@@ -343,17 +474,22 @@ void extract_common(const ObjectFileDB& db,
                      game_version_names[config.game_version] / "common";
     save_level_foreground_as_gltf(tfrag_level, art_group_data, file_path);
   }
+  return true;
 }
 
-void extract_from_level(const ObjectFileDB& db,
-                        const TextureDB& tex_db,
-                        const std::string& dgo_name,
-                        const Config& config,
-                        const fs::path& output_folder,
-                        const fs::path& entities_folder) {
+/*!
+ * Extract a level. Returns the files that were written, or nothing if the DGO isn't in the input.
+ */
+std::vector<fs::path> extract_from_level(const ObjectFileDB& db,
+                                         const TextureDB& tex_db,
+                                         const std::string& dgo_name,
+                                         const Config& config,
+                                         const fs::path& output_folder,
+                                         const fs::path& entities_folder,
+                                         CompressedTextureCache& compressed_textures) {
   if (db.obj_files_by_dgo.count(dgo_name) == 0) {
     lg::warn("Skipping extract for {} because the DGO was not part of the input", dgo_name);
-    return;
+    return {};
   }
   tfrag3::Level level_data;
   std::map<std::string, level_tools::ArtData> art_group_data;
@@ -364,17 +500,6 @@ void extract_from_level(const ObjectFileDB& db,
   extract_art_groups_from_level(db, tex_db, bsp_header.texture_remap_table, dgo_name, level_data,
                                 art_group_data);
 
-  Serializer ser;
-  level_data.serialize(ser);
-  auto compressed =
-      compression::compress_zstd(ser.get_save_result().first, ser.get_save_result().second);
-  lg::info("stats for {}", level_data.level_name);
-  print_memory_usage(level_data, ser.get_save_result().second);
-  lg::info("compressed: {} -> {} ({:.2f}%)", ser.get_save_result().second, compressed.size(),
-           100.f * compressed.size() / ser.get_save_result().second);
-  file_util::write_binary_file(output_folder / fmt::format("{}.fr3", level_data.level_name),
-                               compressed.data(), compressed.size());
-
   if (config.rip_levels) {
     auto back_file_path = file_util::get_jak_project_dir() / "glb_out" /
                           game_version_names[config.game_version] / level_data.level_name /
@@ -385,8 +510,103 @@ void extract_from_level(const ObjectFileDB& db,
                           game_version_names[config.game_version] / level_data.level_name;
     save_level_foreground_as_gltf(level_data, art_group_data, fore_file_path);
   }
-  file_util::write_text_file(entities_folder / fmt::format("{}-actors.json", level_data.level_name),
-                             extract_actors_to_json(bsp_header.actors));
+
+  // after the glb export, which needs the uncompressed textures.
+  if (config.compress_background_textures) {
+    compress_background_textures(level_data, config, compressed_textures);
+  }
+
+  Serializer ser;
+  level_data.serialize(ser);
+  auto compressed =
+      tfrag3::make_fr3_file(ser.get_save_result().first, ser.get_save_result().second);
+  lg::info("stats for {}", level_data.level_name);
+  print_memory_usage(level_data, ser.get_save_result().second);
+  lg::info("compressed: {} -> {} ({:.2f}%)", ser.get_save_result().second, compressed.size(),
+           100.f * compressed.size() / ser.get_save_result().second);
+  const auto fr3_path = output_folder / fmt::format("{}.fr3", level_data.level_name);
+  const auto actors_path =
+      entities_folder / fmt::format("{}-actors.json", level_data.level_name);
+  file_util::write_binary_file(fr3_path, compressed.data(), compressed.size());
+  file_util::write_text_file(actors_path, extract_actors_to_json(bsp_header.actors));
+  return {fr3_path, actors_path};
+}
+
+/*!
+ * Hash everything that a level's output depends on, other than the objects in its DGO: the
+ * extractor version, the config, the types, the textures and the replacement models.
+ */
+u64 hash_shared_level_inputs(const TextureDB& tex_db, const Config& config) {
+  hash_util::Hasher hasher;
+  hasher.update(fmt::format("{} {} {:016x}\n", kLevelExtractVersion, tfrag3::TFRAG3_VERSION,
+                            config.global_config_hash));
+  const auto project_dir = file_util::get_jak_project_dir();
+  hasher.update(file_util::read_text_file(project_dir / config.all_types_file));
+  hasher.update_pod(hash_dir_listing(project_dir / "custom_assets" /
+                                     game_version_names[config.game_version] /
+                                     "merc_replacements"));
+
+  // textures can be looked up from other levels, so a level depends on all of them.
+  for (const auto& [id, tex] : tex_db.textures) {
+    hasher.update(fmt::format("tex {} {} {} {} {} {} {} {:016x}\n", id, tex.name, tex.page, tex.w,
+                              tex.h, tex.dest, tex.num_mips, tex.content_hash));
+  }
+  const std::map<u32, std::string> tpage_names(tex_db.tpage_names.begin(),
+                                               tex_db.tpage_names.end());
+  for (const auto& [page, name] : tpage_names) {
+    hasher.update(fmt::format("tpage {} {}\n", page, name));
+  }
+  const std::map<std::string, std::set<u32>> ids_per_level(tex_db.texture_ids_per_level.begin(),
+                                                           tex_db.texture_ids_per_level.end());
+  for (const auto& [level, ids] : ids_per_level) {
+    hasher.update(fmt::format("level {} {}\n", level, fmt::join(ids, " ")));
+  }
+  for (const auto& [id, tex] : tex_db.index_textures_by_combo_id) {
+    hasher.update(fmt::format("index {} {} {} {} {} {}\n", id, tex.w, tex.h, tex.name,
+                              tex.tpage_name, fmt::join(tex.level_names, " ")));
+    hasher.update(tex.index_data.data(), tex.index_data.size());
+    hasher.update(tex.color_table.data(), sizeof(tex.color_table));
+  }
+  const std::map<std::string, u32> anim_slots(tex_db.animated_tex_output_to_anim_slot.begin(),
+                                              tex_db.animated_tex_output_to_anim_slot.end());
+  for (const auto& [name, slot] : anim_slots) {
+    hasher.update(fmt::format("anim {} {}\n", name, slot));
+  }
+  return hasher.digest64();
+}
+
+std::string level_key(const ObjectFileDB& db,
+                      u64 shared_inputs_hash,
+                      const std::vector<std::string>& dgo_names) {
+  hash_util::Hasher hasher;
+  hasher.update_pod(shared_inputs_hash);
+  for (const auto& dgo_name : dgo_names) {
+    hasher.update(dgo_name);
+    auto it = db.obj_files_by_dgo.find(dgo_name);
+    if (it == db.obj_files_by_dgo.end()) {
+      continue;
+    }
+    for (const auto& rec : it->second) {
+      const auto& data = db.lookup_record(rec).data;
+      hasher.update(rec.name);
+      hasher.update_pod(data.size());
+      hasher.update(data.data(), data.size());
+    }
+  }
+  const auto hash = hasher.digest128();
+  return fmt::format("{:016x}{:016x}", hash.hi, hash.lo);
+}
+
+bool outputs_exist(const nlohmann::json& info) {
+  if (!info.contains("outputs")) {
+    return false;
+  }
+  for (const auto& output : info.at("outputs")) {
+    if (!fs::exists(fs::path(output.get<std::string>()))) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void extract_all_levels(const ObjectFileDB& db,
@@ -395,17 +615,65 @@ void extract_all_levels(const ObjectFileDB& db,
                         const std::string& common_name,
                         const Config& config,
                         const fs::path& output_path) {
-  extract_common(db, tex_db, common_name, output_path, config);
+  // levels that were already extracted from the same inputs are skipped. The glb export isn't
+  // tracked, so everything is redone if it's on.
+  ExtractorManifest manifest(output_path / "levels-manifest.json");
+  const u64 shared_inputs_hash = hash_shared_level_inputs(tex_db, config);
+  auto is_current = [&](const std::string& dgo_name, const std::string& key) {
+    return !config.rip_levels && manifest.is_current(dgo_name, key) &&
+           outputs_exist(manifest.info(dgo_name));
+  };
+
+  const auto common_key = level_key(db, shared_inputs_hash, {common_name, "ARTSPOOL"});
+  if (is_current(common_name, common_key)) {
+    lg::info("Skipping common extract for {}, it hasn't changed", common_name);
+  } else {
+    manifest.start(common_name);
+    manifest.save();
+    if (extract_common(db, tex_db, common_name, output_path, config)) {
+      const auto fr3_path =
+          output_path / fmt::format("{}.fr3", common_name.substr(0, common_name.length() - 4));
+      manifest.finish(common_name, common_key, {{"outputs", {fr3_path.string()}}});
+    }
+  }
+
   auto entities_dir = file_util::get_jak_project_dir() / "decompiler_out" /
                       game_version_names[config.game_version] / "entities";
   file_util::create_dir_if_needed(entities_dir);
-  SimpleThreadGroup threads;
-  threads.run(
-      [&](int idx) {
-        extract_from_level(db, tex_db, dgo_names[idx], config, output_path, entities_dir);
-      },
-      dgo_names.size());
-  threads.join();
+
+  std::vector<std::string> dirty_levels;
+  std::vector<std::string> dirty_keys;
+  for (const auto& dgo_name : dgo_names) {
+    auto key = level_key(db, shared_inputs_hash, {dgo_name});
+    if (is_current(dgo_name, key)) {
+      lg::info("Skipping extract for {}, it hasn't changed", dgo_name);
+      continue;
+    }
+    manifest.start(dgo_name);
+    dirty_levels.push_back(dgo_name);
+    dirty_keys.push_back(std::move(key));
+  }
+  manifest.save();
+  lg::info("Extracting {} of {} levels", dirty_levels.size(), dgo_names.size());
+
+  CompressedTextureCache compressed_textures;
+  std::vector<std::vector<fs::path>> outputs(dirty_levels.size());
+  ThreadPool::global().parallel_for(dirty_levels.size(), [&](int idx) {
+    outputs[idx] = extract_from_level(db, tex_db, dirty_levels[idx], config, output_path,
+                                      entities_dir, compressed_textures);
+  });
+
+  for (size_t i = 0; i < dirty_levels.size(); i++) {
+    if (outputs[i].empty()) {
+      continue;
+    }
+    nlohmann::json paths = nlohmann::json::array();
+    for (const auto& path : outputs[i]) {
+      paths.push_back(path.string());
+    }
+    manifest.finish(dirty_levels[i], dirty_keys[i], {{"outputs", paths}});
+  }
+  manifest.save();
 }
 
 }  // namespace decompiler
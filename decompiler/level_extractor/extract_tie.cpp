@@ -4,6 +4,7 @@
 
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/string_util.h"
 
 #include "decompiler/ObjectFile/LinkedObjectFile.h"
@@ -1461,7 +1462,8 @@ struct NrmDebug {
 };
 
 void emulate_tie_instance_program(std::vector<TieProtoInfo>& protos, GameVersion version) {
-  for (auto& proto : protos) {
+  ThreadPool::global().parallel_for(protos.size(), [&](int proto_idx) {
+    auto& proto = protos[proto_idx];
     //    bool first_instance = true;
     //    for (auto& instance : proto.instances) {
     for (u32 frag_idx = 0; frag_idx < proto.frags.size(); frag_idx++) {
@@ -1866,7 +1868,7 @@ void emulate_tie_instance_program(std::vector<TieProtoInfo>& protos, GameVersion
     }
 
     //    }
-  }
+  });
 }
 
 // the final step of the VU program emulation is the "xgkick" instruction.
@@ -1874,7 +1876,8 @@ void emulate_tie_instance_program(std::vector<TieProtoInfo>& protos, GameVersion
 // strgifs and adgifs. We look at the memory map for each frag and figure out which strips
 // go with which adgifs, then copy vertices
 void emulate_kicks(std::vector<TieProtoInfo>& protos) {
-  for (auto& proto : protos) {
+  ThreadPool::global().parallel_for(protos.size(), [&](int proto_idx) {
+    auto& proto = protos[proto_idx];
     for (auto& frag : proto.frags) {
       // we iterate over both adgifs/stgifs. sometimes you can have multiple strgifs that use the
       // same adgif. But we never expect to see multiple adgifs in a row.
@@ -1941,7 +1944,7 @@ void emulate_kicks(std::vector<TieProtoInfo>& protos) {
 
       ASSERT(adgif_it == adgif_end);
     }
-  }
+  });
 }
 
 // from here on, we are mostly converting the "info" formats to the C++ renderer format (tfrag3)
@@ -2469,7 +2472,8 @@ void handle_draw_for_strip(tfrag3::TieTree& tree,
                            u32 proto_idx,
                            u32 frag_idx,
                            u32 strip_idx,
-                           u32 matrix_idx) {
+                           u32 matrix_idx,
+                           bool has_normals) {
   // okay, we now have a texture and draw mode, let's see if we can add to an existing...
   auto existing_draws_in_tex = static_draws_by_tex.find(idx_in_lev_data);
   tfrag3::StripDraw* draw_to_add_to = nullptr;
@@ -2509,14 +2513,7 @@ void handle_draw_for_strip(tfrag3::TieTree& tree,
   grp.matrix_idx = matrix_idx;
   grp.start_vert = packed_vert_indices.at(frag_idx).at(strip_idx).first;
   grp.end_vert = packed_vert_indices.at(frag_idx).at(strip_idx).second;
-  grp.has_normals = false;
-  for (auto i = grp.start_vert; i < grp.end_vert; i++) {
-    auto& v = tree.packed_vertices.vertices.at(i);
-    if (v.nx || v.ny || v.nz) {
-      grp.has_normals = true;
-      break;
-    }
-  }
+  grp.has_normals = has_normals;
 
   tree.packed_vertices.matrix_groups.push_back(grp);
   tfrag3::StripDraw::VertexRun run;
@@ -2538,6 +2535,16 @@ void handle_draw_for_strip(tfrag3::TieTree& tree,
   draw_to_add_to->vis_groups.push_back(vgroup);
 }
 
+/*!
+ * The parts of a strip's draw that are the same for every instance of the prototype.
+ */
+struct TieStripDrawInfo {
+  s32 tex_idx = 0;
+  DrawMode mode;
+  s32 envmap_tex_idx = 0;
+  bool has_normals = false;
+};
+
 /*!
  * Convert TieProtoInfo's to C++ renderer format
  */
@@ -2612,6 +2619,36 @@ void add_vertices_and_static_draw(tfrag3::TieTree& tree,
       }
     }
 
+    // look up textures and draw modes once per prototype instead of once per instance. Textures
+    // are added to the level in the same order the first instance would have added them, and not
+    // at all if there are no instances.
+    std::vector<std::vector<TieStripDrawInfo>> strip_draw_infos;
+    if (!proto.instances.empty()) {
+      for (size_t frag_idx = 0; frag_idx < proto.frags.size(); frag_idx++) {
+        auto& frag = proto.frags[frag_idx];
+        auto& frag_infos = strip_draw_infos.emplace_back();
+        for (size_t strip_idx = 0; strip_idx < frag.strips.size(); strip_idx++) {
+          auto& strip = frag.strips[strip_idx];
+          auto& strip_info = frag_infos.emplace_back();
+          strip_info.tex_idx = get_or_add_texture(strip.adgif.combo_tex, lev, tdb);
+          strip_info.mode = process_draw_mode(strip.adgif, frag.prog_info.misc_x == 0,
+                                              frag.has_magic_tex0_bit, version, info.category);
+          if (!using_wind && info.uses_envmap) {
+            strip_info.envmap_tex_idx =
+                get_or_add_texture(proto.envmap_adgif.value().combo_tex, lev, tdb);
+          }
+          auto [start, end] = packed_vert_indices.at(frag_idx).at(strip_idx);
+          for (int i = start; i < end; i++) {
+            auto& v = tree.packed_vertices.vertices[i];
+            if (v.nx || v.ny || v.nz) {
+              strip_info.has_normals = true;
+              break;
+            }
+          }
+        }
+      }
+    }
+
     // loop over instances of the prototypes
     for (auto& inst : proto.instances) {
       // if we're using wind, we use the instanced renderer, which requires some extra info
@@ -2637,11 +2674,9 @@ void add_vertices_and_static_draw(tfrag3::TieTree& tree,
         // loop over triangle strips within the fragment
         for (size_t strip_idx = 0; strip_idx < frag.strips.size(); strip_idx++) {
           auto& strip = frag.strips[strip_idx];
-
-          s32 idx_in_lev_data = get_or_add_texture(strip.adgif.combo_tex, lev, tdb);
-          // determine the draw mode
-          DrawMode mode = process_draw_mode(strip.adgif, frag.prog_info.misc_x == 0,
-                                            frag.has_magic_tex0_bit, version, info.category);
+          const auto& strip_info = strip_draw_infos[frag_idx][strip_idx];
+          s32 idx_in_lev_data = strip_info.tex_idx;
+          const DrawMode& mode = strip_info.mode;
 
           if (using_wind) {
             handle_wind_draw_for_strip(tree, wind_draws_by_tex, packed_vert_indices,
@@ -2654,20 +2689,19 @@ void add_vertices_and_static_draw(tfrag3::TieTree& tree,
               handle_draw_for_strip(tree, static_draws_by_tex,
                                     draws_by_category.at((int)info.category), packed_vert_indices,
                                     mode, idx_in_lev_data, strip, inst, ifrag, proto_idx, frag_idx,
-                                    strip_idx, matrix_idx);
-              s32 envmap_tex_idx =
-                  get_or_add_texture(proto.envmap_adgif.value().combo_tex, lev, tdb);
+                                    strip_idx, matrix_idx, strip_info.has_normals);
 
               // second pass envmap draw mode, in envmap bucket, envmap-specific draw list
               handle_draw_for_strip(tree, static_draws_by_tex,
                                     draws_by_category.at((int)info.envmap_second_draw_category),
-                                    packed_vert_indices, envmap_drawmode, envmap_tex_idx, strip,
-                                    inst, ifrag, proto_idx, frag_idx, strip_idx, matrix_idx);
+                                    packed_vert_indices, envmap_drawmode,
+                                    strip_info.envmap_tex_idx, strip, inst, ifrag, proto_idx,
+                                    frag_idx, strip_idx, matrix_idx, strip_info.has_normals);
             } else {
               handle_draw_for_strip(tree, static_draws_by_tex,
                                     draws_by_category.at((int)info.category), packed_vert_indices,
                                     mode, idx_in_lev_data, strip, inst, ifrag, proto_idx, frag_idx,
-                                    strip_idx, matrix_idx);
+                                    strip_idx, matrix_idx, strip_info.has_normals);
             }
           }
         }
@@ -2752,48 +2786,60 @@ void extract_tie(const level_tools::DrawableTreeInstanceTie* tree,
                  tfrag3::Level& out,
                  bool dump_level,
                  GameVersion version) {
-  for (int geo = 0; geo < GEOM_MAX; ++geo) {
+  // sanity check the vis tree (not a perfect check, but this is used in game and should be right)
+  ASSERT(tree->length == (int)tree->arrays.size());
+  ASSERT(tree->length > 0);
+  auto last_array = tree->arrays.back().get();
+  auto as_instance_array = dynamic_cast<level_tools::DrawableInlineArrayInstanceTie*>(last_array);
+  ASSERT(as_instance_array);
+  ASSERT(as_instance_array->length == (int)as_instance_array->instances.size());
+  ASSERT(as_instance_array->length > 0);
+  u16 idx = as_instance_array->instances.front().id;
+  for (auto& elt : as_instance_array->instances) {
+    ASSERT(elt.id == idx);
+    idx++;
+  }
+  bool ok = verify_node_indices(tree);
+  ASSERT(ok);
+
+  // the geometry levels only share the level's texture list, which is only touched when adding
+  // draws. So everything before that runs on all levels at once, and the draws are added in order.
+  struct GeoResult {
+    bool skip = false;
+    tfrag3::TieTree tree;
+    std::unordered_map<int, int> instance_parents;
+    std::vector<TieProtoInfo> info;
+    BigPalette palette;
+  };
+  std::array<GeoResult, GEOM_MAX> geos;
+
+  ThreadPool::global().parallel_for(GEOM_MAX, [&](int geo) {
+    auto& result = geos[geo];
     // as far as I can tell, this one has bad colors
     if (debug_name == "PRECD.DGO-2-tie" && geo == 3) {
-      continue;
+      result.skip = true;
+      return;
     }
-    tfrag3::TieTree this_tree;
-
-    // sanity check the vis tree (not a perfect check, but this is used in game and should be right)
-    ASSERT(tree->length == (int)tree->arrays.size());
-    ASSERT(tree->length > 0);
-    auto last_array = tree->arrays.back().get();
-    auto as_instance_array = dynamic_cast<level_tools::DrawableInlineArrayInstanceTie*>(last_array);
-    ASSERT(as_instance_array);
-    ASSERT(as_instance_array->length == (int)as_instance_array->instances.size());
-    ASSERT(as_instance_array->length > 0);
-    u16 idx = as_instance_array->instances.front().id;
-    for (auto& elt : as_instance_array->instances) {
-      ASSERT(elt.id == idx);
-      idx++;
-    }
-    bool ok = verify_node_indices(tree);
-    ASSERT(ok);
 
     // extract the vis tree. Note that this extracts the tree only down to the last draw node, a
     // parent of between 1 and 8 instances.
-    extract_vis_data(tree, as_instance_array->instances.front().id, this_tree);
+    extract_vis_data(tree, as_instance_array->instances.front().id, result.tree);
 
     // we use the index of the instance in the instance list as its index. But this is different
     // from its visibility index. This map goes from instance index to the parent node in the vis
     // tree. later, we can use this to remap from instance idx to the visiblity node index.
-    std::unordered_map<int, int> instance_parents;
-    for (size_t node_idx = 0; node_idx < this_tree.bvh.vis_nodes.size(); node_idx++) {
-      const auto& node = this_tree.bvh.vis_nodes[node_idx];
+    for (size_t node_idx = 0; node_idx < result.tree.bvh.vis_nodes.size(); node_idx++) {
+      const auto& node = result.tree.bvh.vis_nodes[node_idx];
       if (node.flags == 0) {
         for (int i = 0; i < node.num_kids; i++) {
-          instance_parents[node.child_id + i] = node_idx;
+          result.instance_parents[node.child_id + i] = node_idx;
         }
       }
     }
 
     // convert level format data to a nicer format
-    auto info =
+    auto& info = result.info;
+    info =
         collect_instance_info(as_instance_array, &tree->prototypes.prototype_array_tie.data, geo);
     update_proto_info(&info, tex_map, tree->prototypes.prototype_array_tie.data, geo, version);
     if (version < GameVersion::Jak2) {
@@ -2819,16 +2865,24 @@ void extract_tie(const level_tools::DrawableTreeInstanceTie* tree,
     }
 
     // create time of day data.
-    auto full_palette = make_big_palette(info);
+    result.palette = make_big_palette(info);
+  });
+
+  for (int geo = 0; geo < GEOM_MAX; ++geo) {
+    auto& result = geos[geo];
+    if (result.skip) {
+      continue;
+    }
+    auto& this_tree = result.tree;
 
     // create draws
-    add_vertices_and_static_draw(this_tree, out, tex_db, info, version);
+    add_vertices_and_static_draw(this_tree, out, tex_db, result.info, version);
 
     // remap vis indices and merge
     for (auto& draw : this_tree.static_draws) {
       for (auto& str : draw.vis_groups) {
-        auto it = instance_parents.find(str.vis_idx_in_pc_bvh);
-        if (it == instance_parents.end()) {
+        auto it = result.instance_parents.find(str.vis_idx_in_pc_bvh);
+        if (it == result.instance_parents.end()) {
           str.vis_idx_in_pc_bvh = UINT16_MAX;
         } else {
           str.vis_idx_in_pc_bvh = it->second;
@@ -2839,8 +2893,8 @@ void extract_tie(const level_tools::DrawableTreeInstanceTie* tree,
 
     for (auto& draw : this_tree.instanced_wind_draws) {
       for (auto& str : draw.instance_groups) {
-        auto it = instance_parents.find(str.vis_idx);
-        if (it == instance_parents.end()) {
+        auto it = result.instance_parents.find(str.vis_idx);
+        if (it == result.instance_parents.end()) {
           str.vis_idx = UINT32_MAX;
         } else {
           str.vis_idx = it->second;
@@ -2852,8 +2906,10 @@ void extract_tie(const level_tools::DrawableTreeInstanceTie* tree,
 
     merge_groups(this_tree.packed_vertices.matrix_groups);
 
-    this_tree.colors = pack_big_palette(full_palette);
+    this_tree.colors = pack_big_palette(result.palette);
     out.tie_trees[geo].push_back(std::move(this_tree));
+    // free the emulation results before the next level of geometry.
+    result.info = {};
   }
 }
 }  // namespace decompiler
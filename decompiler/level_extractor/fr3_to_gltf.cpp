@@ -6,6 +6,7 @@
 #include "common/math/Vector.h"
 #include "common/math/geometry.h"
 
+#include "decompiler/level_extractor/GlbWriter.h"
 #include "decompiler/level_extractor/tfrag_tie_fixup.h"
 
 #include "third-party/tiny_gltf/tiny_gltf.h"
@@ -981,8 +982,10 @@ void add_merc(const tfrag3::Level& level,
  * Export the background geometry (tie, tfrag, shrub) to a GLTF binary format (.glb) file.
  */
 void save_level_background_as_gltf(const tfrag3::Level& level, const fs::path& glb_file) {
-  // the top level container for everything is the model.
-  tinygltf::Model model;
+  // the top level container for everything is the model. The data of each tree is written out
+  // after adding it, so only one tree is unpacked in memory at a time.
+  GlbWriter glb(glb_file);
+  auto& model = glb.model;
 
   // a "scene" is a traditional scene graph, made up of Nodes.
   // sadly, attempting to nest stuff makes the blender importer unhappy, so we just dump
@@ -1000,23 +1003,21 @@ void save_level_background_as_gltf(const tfrag3::Level& level, const fs::path& g
   // add all hi-lod tfrag trees
   for (const auto& tfrag : level.tfrag_trees.at(0)) {
     add_tfrag(level, tfrag, model, tex_image_map);
+    glb.flush();
   }
 
   for (const auto& tie : level.tie_trees.at(0)) {
     add_tie(level, tie, model, tex_image_map);
+    glb.flush();
   }
 
   for (const auto& shrub : level.shrub_trees) {
     add_shrub(level, shrub, model, tex_image_map);
+    glb.flush();
   }
 
   model.asset.generator = "opengoal";
-  tinygltf::TinyGLTF gltf;
-  gltf.WriteGltfSceneToFile(&model, glb_file.string(),
-                            true,   // embedImages
-                            true,   // embedBuffers
-                            true,   // pretty print
-                            true);  // write binary
+  glb.finish();
 }
 
 void save_level_foreground_as_gltf(const tfrag3::Level& level,
@@ -1026,7 +1027,9 @@ void save_level_foreground_as_gltf(const tfrag3::Level& level,
     const auto& mmodel = level.merc_data.models[model_idx];
 
     // the top level container for everything is the model.
-    tinygltf::Model model;
+    auto glb_file = glb_path / fmt::format("{}.glb", mmodel.name);
+    GlbWriter glb(glb_file);
+    auto& model = glb.model;
 
     // a "scene" is a traditional scene graph, made up of Nodes.
     // sadly, attempting to nest stuff makes the blender importer unhappy, so we just dump
@@ -1044,15 +1047,6 @@ void save_level_foreground_as_gltf(const tfrag3::Level& level,
     add_merc(level, art_data, mmodel, model, tex_image_map);
 
     model.asset.generator = "opengoal";
-
-    auto glb_file = glb_path / fmt::format("{}.glb", mmodel.name);
-    file_util::create_dir_if_needed_for_file(glb_file);
-
-    tinygltf::TinyGLTF gltf;
-    gltf.WriteGltfSceneToFile(&model, glb_file.string(),
-                              true,   // embedImages
-                              true,   // embedBuffers
-                              true,   // pretty print
-                              true);  // write binary
+    glb.finish();
   }
 }
\ No newline at end of file
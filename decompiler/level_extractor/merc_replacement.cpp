@@ -1,10 +1,27 @@
 #include "merc_replacement.h"
 
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+#include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/compress.h"
+#include "common/util/hash.h"
+
 using namespace gltf_util;
 
 namespace decompiler {
+namespace {
 
-void extract(tfrag3::MercModel& mdl,
+/*!
+ * Convert the meshes of a glTF model to a merc model. When replacing a model, old_model is the
+ * model being replaced, which effects with eye or mod draws can be copied from.
+ */
+void extract(const std::string& name,
+             const tfrag3::MercModel* old_model,
              MercExtractData& out,
              const tinygltf::Model& model,
              const std::vector<NodeWithTransform>& all_nodes,
@@ -35,10 +52,12 @@ void extract(tfrag3::MercModel& mdl,
       mesh_count++;
       has_custom_weights = node.extras.Has("enable_custom_weights") &&
                            node.extras.Get("enable_custom_weights").Get<int>();
-      copy_eye_draws =
-          node.extras.Has("copy_eye_draws") && node.extras.Get("copy_eye_draws").Get<int>();
-      copy_mod_draws =
-          node.extras.Has("copy_mod_draws") && node.extras.Get("copy_mod_draws").Get<int>();
+      if (old_model) {
+        copy_eye_draws =
+            node.extras.Has("copy_eye_draws") && node.extras.Get("copy_eye_draws").Get<int>();
+        copy_mod_draws =
+            node.extras.Has("copy_mod_draws") && node.extras.Get("copy_mod_draws").Get<int>();
+      }
       for (const auto& prim : mesh.primitives) {
         prim_count++;
         // extract index buffer
@@ -86,7 +105,7 @@ void extract(tfrag3::MercModel& mdl,
   tfrag3::MercEffect e;
   tfrag3::MercEffect envmap_eff;
   envmap_eff.has_envmap = false;
-  out.new_model.name = mdl.name;
+  out.new_model.name = name;
   // if we have a skeleton, use that joint count, otherwise use a high default value since the model
   // we replace can have more
   out.new_model.max_bones = joints != 3 ? joints : 100;
@@ -113,7 +132,7 @@ void extract(tfrag3::MercModel& mdl,
 
   // copy any effects from the old model that used mod or eye draws
   if (copy_eye_draws || copy_mod_draws) {
-    for (auto& old_eff : mdl.effects) {
+    for (auto& old_eff : old_model->effects) {
       tfrag3::MercEffect eff;
       bool has_eye_draw = false;
       if (copy_eye_draws) {
@@ -130,7 +149,7 @@ void extract(tfrag3::MercModel& mdl,
         eff.mod.fix_draw.clear();
       }
       if ((copy_eye_draws || copy_mod_draws) && (eff.has_mod_draw || has_eye_draw)) {
-        lg::info("adding old effect for {} (mod draw {}, eye draw {})", mdl.name,
+        lg::info("adding old effect for {} (mod draw {}, eye draw {})", name,
                  old_eff.has_mod_draw, has_eye_draw);
         out.new_model.effects.push_back(eff);
       }
@@ -147,138 +166,84 @@ void extract(tfrag3::MercModel& mdl,
            out.new_vertices.size());
 }
 
-void extract(const std::string& name,
-             MercExtractData& out,
-             const tinygltf::Model& model,
-             const std::vector<NodeWithTransform>& all_nodes,
-             u32 index_offset,
-             u32 vertex_offset,
-             u32 tex_offset,
-             bool& has_custom_weights) {
-  ASSERT(out.new_vertices.empty());
+/*!
+ * Finds the closest vertex to a point, with a kd-tree. This returns the same vertex as checking the
+ * distance to every vertex in order and keeping the first closest one, just faster.
+ */
+class ClosestVertexFinder {
+ public:
+  explicit ClosestVertexFinder(const std::vector<tfrag3::MercVertex>& verts) : m_verts(verts) {
+    ASSERT(!verts.empty());
+    m_order.resize(verts.size());
+    m_split.resize(verts.size());
+    for (u32 i = 0; i < m_order.size(); i++) {
+      m_order[i] = i;
+    }
+    build(0, m_order.size(), 0);
+  }
 
-  std::map<int, tfrag3::MercDraw> draw_by_material;
-  int mesh_count = 0;
-  int prim_count = 0;
-  int joints = 3;
-  auto skin_idx = find_single_skin(model, all_nodes);
-  if (skin_idx) {
-    joints += get_joint_count(model, *skin_idx);
+  const tfrag3::MercVertex& find(float x, float y, float z) const {
+    const float pt[3] = {x, y, z};
+    float best_dist = 1e10;
+    u32 best_idx = 0;
+    search(pt, 0, m_order.size(), 0, best_dist, best_idx);
+    return m_verts[best_idx];
   }
 
-  for (const auto& n : all_nodes) {
-    const auto& node = model.nodes[n.node_idx];
-    if (node.extras.Has("set_invisible") && node.extras.Get("set_invisible").Get<int>()) {
-      continue;
+ private:
+  static constexpr u32 kLeafSize = 8;
+
+  void build(u32 lo, u32 hi, int axis) {
+    if (hi - lo <= kLeafSize) {
+      return;
     }
-    if (node.mesh >= 0) {
-      const auto& mesh = model.meshes[node.mesh];
-      mesh_count++;
-      has_custom_weights = node.extras.Has("enable_custom_weights") &&
-                           node.extras.Get("enable_custom_weights").Get<int>();
-      for (const auto& prim : mesh.primitives) {
-        prim_count++;
-        // extract index buffer
-        std::vector<u32> prim_indices = gltf_util::gltf_index_buffer(
-            model, prim.indices, out.new_vertices.size() + vertex_offset);
-        ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
-        // extract vertices
-        auto verts =
-            gltf_util::gltf_vertices(model, prim.attributes, n.w_T_node, true, true, mesh.name);
-        out.new_vertices.insert(out.new_vertices.end(), verts.vtx.begin(), verts.vtx.end());
-        out.new_colors.insert(out.new_colors.end(), verts.vtx_colors.begin(),
-                              verts.vtx_colors.end());
-        out.normals.insert(out.normals.end(), verts.normals.begin(), verts.normals.end());
-        ASSERT(out.new_colors.size() == out.new_vertices.size());
+    u32 mid = (lo + hi) / 2;
+    std::nth_element(m_order.begin() + lo, m_order.begin() + mid, m_order.begin() + hi,
+                     [&](u32 a, u32 b) { return m_verts[a].pos[axis] < m_verts[b].pos[axis]; });
+    // building the upper half moves m_order[mid], so remember where this node was split.
+    m_split[mid] = m_verts[m_order[mid]].pos[axis];
+    build(lo, mid, (axis + 1) % 3);
+    build(mid, hi, (axis + 1) % 3);
+  }
 
-        if (prim.attributes.count("JOINTS_0") && prim.attributes.count("WEIGHTS_0")) {
-          auto joints_and_weights = gltf_util::extract_and_flatten_joints_and_weights(model, prim);
-          ASSERT(joints_and_weights.size() == verts.vtx.size());
-          out.joints_and_weights.insert(out.joints_and_weights.end(), joints_and_weights.begin(),
-                                        joints_and_weights.end());
-        } else {
-          // add fake data for vertices without this data
-          gltf_util::JointsAndWeights dummy;
-          dummy.joints[0] = 3;
-          dummy.weights[0] = 1.f;
-          for (size_t i = 0; i < out.new_vertices.size(); i++) {
-            out.joints_and_weights.push_back(dummy);
-          }
+  void search(const float* pt, u32 lo, u32 hi, int axis, float& best_dist, u32& best_idx) const {
+    if (hi - lo <= kLeafSize) {
+      for (u32 i = lo; i < hi; i++) {
+        u32 idx = m_order[i];
+        const auto& v = m_verts[idx];
+        float dx = v.pos[0] - pt[0];
+        float dy = v.pos[1] - pt[1];
+        float dz = v.pos[2] - pt[2];
+        float dist = (dx * dx) + (dy * dy) + (dz * dz);
+        if (dist < best_dist || (dist == best_dist && idx < best_idx)) {
+          best_dist = dist;
+          best_idx = idx;
         }
-
-        // TODO: just putting it all in one material
-        auto& draw = draw_by_material[prim.material];
-        draw.mode = gltf_util::make_default_draw_mode();  // todo rm
-        draw.tree_tex_id = 0;                             // todo rm
-        draw.num_triangles += prim_indices.size() / 3;
-        draw.no_strip = true;
-        draw.index_count = prim_indices.size();
-        draw.first_index = index_offset + out.new_indices.size();
-
-        out.new_indices.insert(out.new_indices.end(), prim_indices.begin(), prim_indices.end());
       }
+      return;
     }
-  }
-
-  tfrag3::MercEffect e;
-  tfrag3::MercEffect envmap_eff;
-  envmap_eff.has_envmap = false;
-  out.new_model.name = name;
-  // if we have a skeleton, use that joint count, otherwise use a high default value since the model
-  // we replace can have more
-  out.new_model.max_bones = joints != 3 ? joints : 100;
-  out.new_model.max_draws = 0;
-
-  for (const auto& [mat_idx, d_] : draw_by_material) {
-    const auto& mat = model.materials[mat_idx];
-    if (mat_idx < 0 || !gltf_util::material_has_envmap(model.materials[mat_idx]) ||
-        !gltf_util::envmap_is_valid(model.materials[mat_idx])) {
-      gltf_util::process_normal_merc_draw(model, out, tex_offset, e, mat_idx, d_);
+    u32 mid = (lo + hi) / 2;
+    // everything in [lo, mid) is <= split, everything in [mid, hi) is >= split.
+    float d = pt[axis] - m_split[mid];
+    int next_axis = (axis + 1) % 3;
+    if (d < 0) {
+      search(pt, lo, mid, next_axis, best_dist, best_idx);
+      if (d * d <= best_dist) {
+        search(pt, mid, hi, next_axis, best_dist, best_idx);
+      }
     } else {
-      envmap_eff.has_envmap = true;
-      gltf_util::process_envmap_merc_draw(model, out, tex_offset, envmap_eff, mat_idx, d_);
-    }
-  }
-
-  // in case a model only has envmap draws, we don't push the normal merc effect
-  if (!e.all_draws.empty()) {
-    out.new_model.effects.push_back(e);
-  }
-  if (envmap_eff.has_envmap) {
-    out.new_model.effects.push_back(envmap_eff);
-  }
-
-  for (auto& effect : out.new_model.effects) {
-    out.new_model.max_draws += effect.all_draws.size();
-  }
-
-  lg::info("total of {} unique materials ({} normal, {} envmap)", out.new_model.max_draws,
-           e.all_draws.size(), envmap_eff.all_draws.size());
-  lg::info("Merged {} meshes and {} prims into {} vertices", mesh_count, prim_count,
-           out.new_vertices.size());
-}
-
-const tfrag3::MercVertex& find_closest(const std::vector<tfrag3::MercVertex>& old,
-                                       float x,
-                                       float y,
-                                       float z) {
-  float best_dist = 1e10;
-  size_t best_idx = 0;
-
-  for (size_t i = 0; i < old.size(); i++) {
-    auto& v = old[i];
-    float dx = v.pos[0] - x;
-    float dy = v.pos[1] - y;
-    float dz = v.pos[2] - z;
-    float dist = (dx * dx) + (dy * dy) + (dz * dz);
-    if (dist < best_dist) {
-      best_dist = dist;
-      best_idx = i;
+      search(pt, mid, hi, next_axis, best_dist, best_idx);
+      if (d * d <= best_dist) {
+        search(pt, lo, mid, next_axis, best_dist, best_idx);
+      }
     }
   }
 
-  return old[best_idx];
-}
+  const std::vector<tfrag3::MercVertex>& m_verts;
+  std::vector<u32> m_order;
+  // the split position of the node with this midpoint. Every node has a different midpoint.
+  std::vector<float> m_split;
+};
 
 void merc_convert_replacement(MercSwapData& out,
                               const MercExtractData& in,
@@ -288,12 +253,16 @@ void merc_convert_replacement(MercSwapData& out,
   out.new_indices = in.new_indices;
   out.new_textures = in.tex_pool.textures_by_idx;
 
+  std::optional<ClosestVertexFinder> closest;
+  if (!use_custom_weights) {
+    closest.emplace(old_verts);
+  }
+
   // convert vertices
-  for (size_t i = 0; i < in.new_vertices.size(); i++) {
+  out.new_vertices.resize(in.new_vertices.size());
+  ThreadPool::global().parallel_for(in.new_vertices.size(), [&](int i) {
     const auto& y = in.new_vertices[i];
-
-    const auto& copy_from = find_closest(old_verts, y.x, y.y, y.z);
-    auto& x = out.new_vertices.emplace_back();
+    auto& x = out.new_vertices[i];
     x.pos[0] = y.x;
     x.pos[1] = y.y;
     x.pos[2] = y.z;
@@ -308,6 +277,7 @@ void merc_convert_replacement(MercSwapData& out,
       x.mats[1] = in.joints_and_weights.at(i).joints[1];
       x.mats[2] = in.joints_and_weights.at(i).joints[2];
     } else {
+      const auto& copy_from = closest->find(y.x, y.y, y.z);
       x.weights[0] = copy_from.weights[0];
       x.weights[1] = copy_from.weights[1];
       x.weights[2] = copy_from.weights[2];
@@ -321,7 +291,7 @@ void merc_convert_replacement(MercSwapData& out,
     x.rgba[1] = in.new_colors[i][1];
     x.rgba[2] = in.new_colors[i][2];
     x.rgba[3] = in.new_colors[i][3];
-  }
+  });
 }
 
 void merc_convert_custom(MercSwapData& out, const MercExtractData& in) {
@@ -354,36 +324,158 @@ void merc_convert_custom(MercSwapData& out, const MercExtractData& in) {
   }
 }
 
-MercSwapData load_replacement_merc_model(tfrag3::MercModel& mdl,
-                                         u32 current_idx_count,
-                                         u32 current_vtx_count,
-                                         u32 current_tex_count,
-                                         const std::string& path,
-                                         const std::vector<tfrag3::MercVertex>& old_verts,
-                                         bool custom_mdl) {
-  MercSwapData result;
+/*!
+ * A parsed glTF file. Replaced models are often in several levels, which are extracted at the same
+ * time, so the levels share the parsed file instead of each reading it again. Parsed files are kept
+ * until the extractor exits.
+ */
+struct ParsedGltf {
+  tinygltf::Model model;
+  std::vector<NodeWithTransform> all_nodes;
+};
+
+std::shared_ptr<const ParsedGltf> parse_gltf_shared(const std::string& path,
+                                                    const std::vector<u8>& data,
+                                                    u64 data_hash) {
+  static std::mutex mutex;
+  static std::unordered_map<u64, std::shared_ptr<const ParsedGltf>> parsed_files;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = parsed_files.find(data_hash);
+    if (it != parsed_files.end()) {
+      return it->second;
+    }
+  }
+
   lg::info("Reading gltf mesh: {}", path);
+  auto result = std::make_shared<ParsedGltf>();
   tinygltf::TinyGLTF loader;
-  tinygltf::Model model;
   std::string err, warn;
-  bool res = loader.LoadBinaryFromFile(&model, &err, &warn, path);
+  bool res = loader.LoadBinaryFromMemory(&result->model, &err, &warn, data.data(), data.size());
   ASSERT_MSG(warn.empty(), warn.c_str());
   ASSERT_MSG(err.empty(), err.c_str());
   ASSERT_MSG(res, "Failed to load GLTF file!");
-  auto all_nodes = flatten_nodes_from_all_scenes(model);
+  result->all_nodes = flatten_nodes_from_all_scenes(result->model);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  return parsed_files.try_emplace(data_hash, std::move(result)).first->second;
+}
+
+void serialize_swap_data(Serializer& ser, MercSwapData& data) {
+  ser.from_pod_vector(&data.new_indices);
+  ser.from_pod_vector(&data.new_vertices);
+  ser.from_vector(&data.new_textures, [&](tfrag3::Texture* tex) { tex->serialize(ser); });
+  data.new_model.serialize(ser);
+}
+
+/*!
+ * Hash of everything loading a model depends on, so the result from an earlier extraction can be
+ * used again if the glb file, the model it replaces, and its place in the level are the same.
+ */
+u64 merc_cache_key(u64 data_hash,
+                   const std::string& name,
+                   tfrag3::MercModel* old_model,
+                   u32 current_idx_count,
+                   u32 current_vtx_count,
+                   u32 current_tex_count,
+                   const std::vector<tfrag3::MercVertex>& old_verts,
+                   bool custom_mdl) {
+  // bump this if the conversion changes, to ignore old cache entries.
+  constexpr u64 kConverterVersion = 1;
+
+  u64 old_model_hash = 0;
+  if (old_model) {
+    Serializer ser;
+    old_model->serialize(ser);
+    old_model_hash = hash_util::hash64(ser.get_save_result().first, ser.get_save_result().second);
+  }
+  // only the parts of the old vertices that are used, the padding isn't always initialized.
+  std::vector<u8> old_vert_data;
+  old_vert_data.reserve(old_verts.size() * 27);
+  for (auto& v : old_verts) {
+    const u8* pos = (const u8*)v.pos;
+    const u8* weights = (const u8*)v.weights;
+    old_vert_data.insert(old_vert_data.end(), pos, pos + sizeof(v.pos));
+    old_vert_data.insert(old_vert_data.end(), weights, weights + sizeof(v.weights));
+    old_vert_data.insert(old_vert_data.end(), v.mats, v.mats + 3);
+  }
 
+  u64 header[9] = {kConverterVersion,
+                   data_hash,
+                   hash_util::hash64(name),
+                   old_model_hash,
+                   hash_util::hash64(old_vert_data.data(), old_vert_data.size()),
+                   current_idx_count,
+                   current_vtx_count,
+                   current_tex_count,
+                   custom_mdl};
+  return hash_util::hash64(header, sizeof(header));
+}
+
+/*!
+ * Load a replacement model (old_model is the model it replaces) or custom model (old_model is
+ * null), reusing the result of an earlier extraction if nothing changed.
+ */
+MercSwapData load_merc_model(const std::string& name,
+                             tfrag3::MercModel* old_model,
+                             u32 current_idx_count,
+                             u32 current_vtx_count,
+                             u32 current_tex_count,
+                             const std::string& path,
+                             const std::vector<tfrag3::MercVertex>& old_verts,
+                             bool custom_mdl) {
+  MercSwapData result;
+  auto data = file_util::read_binary_file(path);
+  const u64 data_hash = hash_util::hash64(data.data(), data.size());
+  const u64 key = merc_cache_key(data_hash, name, old_model, current_idx_count, current_vtx_count,
+                                 current_tex_count, old_verts, custom_mdl);
+  const auto cache_file = file_util::get_jak_project_dir() / "decompiler_out" /
+                          "merc_replacement_cache" / fmt::format("{:016x}.bin", key);
+  if (fs::exists(cache_file)) {
+    auto compressed = file_util::read_binary_file(cache_file);
+    auto bytes = compression::decompress_zstd(compressed.data(), compressed.size());
+    Serializer ser(bytes.data(), bytes.size(), false);
+    serialize_swap_data(ser, result);
+    lg::info("Using cached conversion of {}", path);
+    return result;
+  }
+
+  auto gltf = parse_gltf_shared(path, data, data_hash);
   MercExtractData extract_data;
   auto has_custom_weights = false;
-  extract(mdl, extract_data, model, all_nodes, current_idx_count, current_vtx_count,
-          current_tex_count, has_custom_weights);
+  extract(name, old_model, extract_data, gltf->model, gltf->all_nodes, current_idx_count,
+          current_vtx_count, current_tex_count, has_custom_weights);
   if (custom_mdl) {
     merc_convert_custom(result, extract_data);
   } else {
     merc_convert_replacement(result, extract_data, old_verts, has_custom_weights);
   }
 
+  Serializer ser;
+  serialize_swap_data(ser, result);
+  auto compressed =
+      compression::compress_zstd(ser.get_save_result().first, ser.get_save_result().second);
+  file_util::create_dir_if_needed_for_file(cache_file);
+  // other levels may be writing the same model, so write it somewhere else first.
+  auto temp_file = cache_file;
+  temp_file += fmt::format(".{}", std::hash<std::thread::id>()(std::this_thread::get_id()));
+  file_util::write_binary_file(temp_file, compressed.data(), compressed.size());
+  std::error_code ec;
+  fs::rename(temp_file, cache_file, ec);
   return result;
 }
+}  // namespace
+
+MercSwapData load_replacement_merc_model(tfrag3::MercModel& mdl,
+                                         u32 current_idx_count,
+                                         u32 current_vtx_count,
+                                         u32 current_tex_count,
+                                         const std::string& path,
+                                         const std::vector<tfrag3::MercVertex>& old_verts,
+                                         bool custom_mdl) {
+  return load_merc_model(mdl.name, &mdl, current_idx_count, current_vtx_count, current_tex_count,
+                         path, old_verts, custom_mdl);
+}
 
 MercSwapData load_custom_merc_model(const std::string& name,
                                     u32 current_idx_count,
@@ -392,27 +484,7 @@ MercSwapData load_custom_merc_model(const std::string& name,
                                     const std::string& path,
                                     const std::vector<tfrag3::MercVertex>& old_verts,
                                     bool custom_mdl) {
-  MercSwapData result;
-  lg::info("Reading gltf mesh: {}", path);
-  tinygltf::TinyGLTF loader;
-  tinygltf::Model model;
-  std::string err, warn;
-  bool res = loader.LoadBinaryFromFile(&model, &err, &warn, path);
-  ASSERT_MSG(warn.empty(), warn.c_str());
-  ASSERT_MSG(err.empty(), err.c_str());
-  ASSERT_MSG(res, "Failed to load GLTF file!");
-  auto all_nodes = flatten_nodes_from_all_scenes(model);
-
-  MercExtractData extract_data;
-  auto has_custom_weights = false;
-  extract(name, extract_data, model, all_nodes, current_idx_count, current_vtx_count,
-          current_tex_count, has_custom_weights);
-  if (custom_mdl) {
-    merc_convert_custom(result, extract_data);
-  } else {
-    merc_convert_replacement(result, extract_data, old_verts, has_custom_weights);
-  }
-
-  return result;
+  return load_merc_model(name, nullptr, current_idx_count, current_vtx_count, current_tex_count,
+                         path, old_verts, custom_mdl);
 }
-}  // namespace decompiler
\ No newline at end of file
+}  // namespace decompiler
@@ -0,0 +1,241 @@
+#include "DecompilerCache.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+#include "common/log/log.h"
+#include "common/type_system/TypeSystem.h"
+#include "common/util/hash.h"
+
+#include "decompiler/ObjectFile/ObjectFileDB.h"
+#include "decompiler/config.h"
+#include "decompiler/util/DecompilerTypeSystem.h"
+
+#include "fmt/core.h"
+#include "third-party/json.hpp"
+
+namespace decompiler {
+namespace {
+// bump this if the layout of cache entries changes.
+constexpr int kDecompilerCacheFormatVersion = 2;
+
+std::string hash_string(const std::string& str) {
+  auto hash = hash_util::hash128(str.data(), str.size());
+  return fmt::format("{:016x}{:016x}", hash.hi, hash.lo);
+}
+
+void append_metadata(std::string& result, const DefinitionMetadata& meta) {
+  result += meta.docstring.value_or("");
+  result += '\n';
+}
+
+void append_handler_metadata(
+    std::string& result,
+    const std::unordered_map<std::string, DefinitionMetadata>& handlers) {
+  std::map<std::string, DefinitionMetadata> sorted(handlers.begin(), handlers.end());
+  for (auto& [handler, meta] : sorted) {
+    result += handler + ' ';
+    append_metadata(result, meta);
+  }
+}
+
+std::vector<std::string> output_names(const ObjectFileData& data) {
+  if (!data.linked_data.has_any_functions()) {
+    return {};
+  }
+  return {data.to_unique_name() + "_ir2.asm", data.to_unique_name() + "_disasm.gc"};
+}
+}  // namespace
+
+DecompilerCache::DecompilerCache(const fs::path& cache_dir,
+                                 const Config& config,
+                                 const DecompilerTypeSystem& dts)
+    : m_dir(cache_dir), m_dts(dts) {
+  file_util::create_dir_if_needed(m_dir);
+  // the decompiler itself is part of the key, so a rebuilt decompiler never uses old results.
+  auto exe_data = file_util::read_binary_file(file_util::get_current_executable_path());
+  nlohmann::json art_data = {{"art", dts.art_group_info},
+                             {"jg", dts.jg_info},
+                             {"tex", dts.textures},
+                             {"formats", dts.bad_format_strings}};
+  m_global_key = fmt::format("{} {:016x} {:016x} {}\n", kDecompilerCacheFormatVersion,
+                             hash_util::hash64(exe_data.data(), exe_data.size()),
+                             config.global_config_hash, hash_string(art_data.dump()));
+}
+
+std::string DecompilerCache::get_key(const ObjectFileData& data, const Config& config) const {
+  const auto obj_name = data.to_unique_name();
+  std::string key_data = m_global_key;
+  auto add_config_entry = [&](const std::string& name) {
+    auto it = config.config_entry_hashes.find(name);
+    if (it != config.config_entry_hashes.end()) {
+      key_data += fmt::format("cfg {} {:016x}\n", name, it->second);
+    }
+  };
+
+  key_data += fmt::format("obj {} {:016x}\n", obj_name,
+                          hash_util::hash64(data.data.data(), data.data.size()));
+  add_config_entry(obj_name);
+  for (auto& seg_functions : data.linked_data.functions_by_seg) {
+    for (auto& func : seg_functions) {
+      const auto func_name = func.name();
+      key_data += fmt::format("fn {} {}\n", func_name, func.type.print());
+      add_config_entry(func_name);
+    }
+  }
+  return hash_string(key_data);
+}
+
+fs::path DecompilerCache::entry_path(const ObjectFileData& data) const {
+  return m_dir / (data.to_unique_name() + ".json");
+}
+
+std::string DecompilerCache::hash_type(const std::string& name) const {
+  const auto& ts = m_dts.ts;
+  std::string result;
+  if (ts.fully_defined_type_exists(name)) {
+    auto* type = ts.lookup_type(name);
+    result = type->print();
+    if (auto* as_enum = dynamic_cast<const EnumType*>(type)) {
+      // the entries aren't part of print()
+      std::map<std::string, s64> entries(as_enum->entries().begin(), as_enum->entries().end());
+      result += fmt::format("bitfield {}\n", as_enum->is_bitfield());
+      for (auto& [entry_name, value] : entries) {
+        result += fmt::format("{} {}\n", entry_name, value);
+      }
+    }
+    for (auto& [state_name, state_type] : type->get_states_declared_for_type()) {
+      result += fmt::format("state {} {}\n", state_name, state_type.print());
+    }
+    append_metadata(result, type->m_metadata);
+    for (auto& method : type->get_methods_defined_for_type()) {
+      result += method.docstring.value_or("");
+      result += '\n';
+    }
+    auto virtual_states = m_dts.virtual_state_metadata.find(name);
+    if (virtual_states != m_dts.virtual_state_metadata.end()) {
+      std::set<std::string> state_names;
+      for (auto& [state_name, handlers] : virtual_states->second) {
+        state_names.insert(state_name);
+      }
+      for (auto& state_name : state_names) {
+        result += state_name + '\n';
+        append_handler_metadata(result, virtual_states->second.at(state_name));
+      }
+    }
+  } else if (ts.partially_defined_type_exists(name)) {
+    result = "partial";
+  } else {
+    result = "none";
+  }
+  return hash_string(result);
+}
+
+std::string DecompilerCache::hash_symbol(const std::string& name) const {
+  std::string result;
+  auto type = m_dts.symbol_types.find(name);
+  if (type != m_dts.symbol_types.end()) {
+    result += type->second.print();
+  }
+  result += '\n';
+  auto meta = m_dts.symbol_metadata_map.find(name);
+  if (meta != m_dts.symbol_metadata_map.end()) {
+    append_metadata(result, meta->second);
+  }
+  auto state = m_dts.state_metadata.find(name);
+  if (state != m_dts.state_metadata.end()) {
+    append_handler_metadata(result, state->second);
+  }
+  return hash_string(result);
+}
+
+bool DecompilerCache::restore(const std::string& key,
+                              const ObjectFileData& data,
+                              const fs::path& output_dir) {
+  const auto path = entry_path(data);
+  if (!fs::exists(path)) {
+    return false;
+  }
+
+  nlohmann::json entry;
+  try {
+    entry = nlohmann::json::parse(file_util::read_text_file(path));
+  } catch (const std::exception& e) {
+    lg::warn("Ignoring invalid decompiler cache entry {}: {}", path.string(), e.what());
+    return false;
+  }
+
+  if (entry.value("key", "") != key) {
+    return false;
+  }
+  for (auto& [name, hash] : entry.at("types").items()) {
+    if (hash_type(name) != hash.get<std::string>()) {
+      return false;
+    }
+  }
+  for (auto& [name, hash] : entry.at("symbols").items()) {
+    if (hash_symbol(name) != hash.get<std::string>()) {
+      return false;
+    }
+  }
+
+  for (auto& [name, text] : entry.at("outputs").items()) {
+    file_util::write_text_file(output_dir / name, text.get<std::string>());
+  }
+  m_hits++;
+  return true;
+}
+
+void DecompilerCache::store(const std::string& key,
+                            const ObjectFileData& data,
+                            const fs::path& output_dir,
+                            const std::unordered_set<std::string>& used_types) {
+  nlohmann::json entry;
+  entry["key"] = key;
+
+  auto types = nlohmann::json::object();
+  for (auto& name : used_types) {
+    types[name] = hash_type(name);
+  }
+  entry["types"] = types;
+
+  // symbols are only looked up by the names the object links to.
+  auto symbols = nlohmann::json::object();
+  for (auto& seg_words : data.linked_data.words_by_seg) {
+    for (auto& word : seg_words) {
+      if (word.holds_string()) {
+        const auto name = word.symbol_name();
+        if (!symbols.contains(name)) {
+          symbols[name] = hash_symbol(name);
+        }
+      }
+    }
+  }
+  entry["symbols"] = symbols;
+
+  auto outputs = nlohmann::json::object();
+  for (auto& name : output_names(data)) {
+    const auto output_path = output_dir / name;
+    if (fs::exists(output_path)) {
+      outputs[name] = file_util::read_text_file(output_path);
+    }
+  }
+  entry["outputs"] = outputs;
+
+  // write then rename, so a crash never leaves a truncated entry behind.
+  const auto path = entry_path(data);
+  auto tmp_path = path;
+  tmp_path += ".tmp";
+  file_util::write_text_file(tmp_path, entry.dump());
+  fs::rename(tmp_path, path);
+  m_stores++;
+}
+
+ScopedTypeUseRecorder::ScopedTypeUseRecorder(std::unordered_set<std::string>* recorder)
+    : m_previous(TypeSystem::set_type_use_recorder(recorder)) {}
+
+ScopedTypeUseRecorder::~ScopedTypeUseRecorder() {
+  TypeSystem::set_type_use_recorder(m_previous);
+}
+}  // namespace decompiler
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <unordered_set>
+
+#include "common/util/FileUtil.h"
+
+namespace decompiler {
+struct Config;
+struct ObjectFileData;
+class DecompilerTypeSystem;
+
+/*!
+ * A persistent cache of the IR2 output for each object file.
+ *
+ * An entry is keyed by the bytes of the object file, the names and types of its functions, the
+ * config entries for the object and its functions, all the other config, and the decompiler
+ * executable itself. Each entry also remembers a hash of every type and symbol that was used while
+ * decompiling the object, so editing a type in all-types only redoes the objects that use it.
+ *
+ * Entries are per object file, not per function: the output files, labels and anonymous function
+ * types are all per object, so this is the smallest unit that can be written out on its own.
+ */
+class DecompilerCache {
+ public:
+  DecompilerCache(const fs::path& cache_dir, const Config& config, const DecompilerTypeSystem& dts);
+
+  /*!
+   * Get the cache key for an object file. The functions must already be named and typed.
+   */
+  std::string get_key(const ObjectFileData& data, const Config& config) const;
+
+  /*!
+   * Write the cached outputs of an object file to output_dir.
+   * Returns false if there is no entry for this key, or if a type or symbol it used has changed.
+   */
+  bool restore(const std::string& key, const ObjectFileData& data, const fs::path& output_dir);
+
+  /*!
+   * Add the outputs of an object file that was just decompiled into output_dir to the cache.
+   */
+  void store(const std::string& key,
+             const ObjectFileData& data,
+             const fs::path& output_dir,
+             const std::unordered_set<std::string>& used_types);
+
+  int hit_count() const { return m_hits; }
+  int store_count() const { return m_stores; }
+
+ private:
+  fs::path entry_path(const ObjectFileData& data) const;
+  std::string hash_type(const std::string& name) const;
+  std::string hash_symbol(const std::string& name) const;
+
+  fs::path m_dir;
+  const DecompilerTypeSystem& m_dts;
+  std::string m_global_key;
+  std::atomic<int> m_hits = 0;
+  std::atomic<int> m_stores = 0;
+};
+
+/*!
+ * Records the names of all types looked up on this thread while it's alive, then puts back the
+ * recorder that was set before.
+ */
+class ScopedTypeUseRecorder {
+ public:
+  explicit ScopedTypeUseRecorder(std::unordered_set<std::string>* recorder);
+  ~ScopedTypeUseRecorder();
+  ScopedTypeUseRecorder(const ScopedTypeUseRecorder&) = delete;
+  ScopedTypeUseRecorder& operator=(const ScopedTypeUseRecorder&) = delete;
+
+ private:
+  std::unordered_set<std::string>* m_previous = nullptr;
+};
+}  // namespace decompiler
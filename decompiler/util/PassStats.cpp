@@ -0,0 +1,108 @@
+#include "PassStats.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "fmt/core.h"
+
+namespace decompiler {
+
+void PassStats::add_pass(const char* pass,
+                         const std::string& obj_name,
+                         const std::vector<std::pair<std::string, double>>& function_ms) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = std::find_if(m_passes.begin(), m_passes.end(), [&](const auto& p) {
+    return std::string_view(p.first) == pass;
+  });
+  if (it == m_passes.end()) {
+    it = m_passes.insert(m_passes.end(), {pass, {}});
+  }
+  auto& total = it->second;
+
+  for (auto& [func_name, ms] : function_ms) {
+    auto key = fmt::format("{} ({})", func_name, obj_name);
+    total.ms += ms;
+    total.functions++;
+    if (ms > total.max_ms) {
+      total.max_ms = ms;
+      total.max_function = key;
+    }
+
+    auto& func = m_functions[key];
+    func.ms += ms;
+    if (ms > func.slowest_pass_ms) {
+      func.slowest_pass_ms = ms;
+      func.slowest_pass = pass;
+    }
+  }
+}
+
+void PassStats::add_object(const std::string& obj_name, double ms, size_t peak_rss_growth) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_objects.push_back({obj_name, ms, peak_rss_growth});
+}
+
+std::string PassStats::report(int max_rows) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::string result;
+
+  double pass_total_ms = 0;
+  for (auto& [name, pass] : m_passes) {
+    pass_total_ms += pass.ms;
+  }
+
+  auto passes = m_passes;
+  std::sort(passes.begin(), passes.end(),
+            [](const auto& a, const auto& b) { return a.second.ms > b.second.ms; });
+  result += "Passes, by total time:\n";
+  result += fmt::format("  {:<36} {:>10} {:>6} {:>9} {:>8} {:>8}  {}\n", "pass", "total ms", "%",
+                        "functions", "avg ms", "max ms", "slowest function");
+  for (auto& [name, pass] : passes) {
+    result += fmt::format("  {:<36} {:>10.1f} {:>6.1f} {:>9} {:>8.3f} {:>8.2f}  {}\n", name,
+                          pass.ms, pass_total_ms > 0 ? 100. * pass.ms / pass_total_ms : 0.,
+                          pass.functions, pass.functions ? pass.ms / pass.functions : 0.,
+                          pass.max_ms, pass.max_function);
+  }
+
+  std::vector<const std::pair<const std::string, FunctionTotal>*> functions;
+  functions.reserve(m_functions.size());
+  for (auto& f : m_functions) {
+    functions.push_back(&f);
+  }
+  const size_t function_rows = std::min(functions.size(), (size_t)max_rows);
+  std::partial_sort(functions.begin(), functions.begin() + function_rows, functions.end(),
+                    [](auto* a, auto* b) { return a->second.ms > b->second.ms; });
+  result += fmt::format("\nSlowest {} of {} functions:\n", function_rows, functions.size());
+  result += fmt::format("  {:>10} {:>10}  {:<36} {}\n", "total ms", "pass ms", "slowest pass",
+                        "function");
+  for (size_t i = 0; i < function_rows; i++) {
+    auto& [name, func] = *functions[i];
+    result += fmt::format("  {:>10.2f} {:>10.2f}  {:<36} {}\n", func.ms, func.slowest_pass_ms,
+                          func.slowest_pass ? func.slowest_pass : "", name);
+  }
+
+  auto objects = m_objects;
+  const size_t object_rows = std::min(objects.size(), (size_t)max_rows);
+  std::partial_sort(objects.begin(), objects.begin() + object_rows, objects.end(),
+                    [](const auto& a, const auto& b) { return a.ms > b.ms; });
+  result += fmt::format("\nSlowest {} of {} object files:\n", object_rows, objects.size());
+  result += fmt::format("  {:>10} {:>14}  {}\n", "ms", "peak rss +MB", "object");
+  for (size_t i = 0; i < object_rows; i++) {
+    auto& obj = objects[i];
+    result += fmt::format("  {:>10.1f} {:>14.1f}  {}\n", obj.ms,
+                          obj.peak_rss_growth / (1024. * 1024.), obj.name);
+  }
+
+  std::sort(objects.begin(), objects.end(), [](const auto& a, const auto& b) {
+    return a.peak_rss_growth > b.peak_rss_growth;
+  });
+  result += "\nObject files that grew the peak RSS the most:\n";
+  for (size_t i = 0; i < object_rows && objects[i].peak_rss_growth > 0; i++) {
+    auto& obj = objects[i];
+    result +=
+        fmt::format("  {:>10.1f} MB  {}\n", obj.peak_rss_growth / (1024. * 1024.), obj.name);
+  }
+  return result;
+}
+
+}  // namespace decompiler
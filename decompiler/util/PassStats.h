@@ -0,0 +1,57 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace decompiler {
+
+/*!
+ * Time spent in each IR2 pass, per pass, function and object file, collected when ir2_pass_stats
+ * is set in the config. Can be added to from the IR2 threads.
+ *
+ * Memory is only tracked per object file, as how much it grew the peak RSS of the decompiler.
+ * While objects run on several threads, that growth is shared between the objects running at the
+ * same time.
+ */
+class PassStats {
+ public:
+  // add the time of each function in one run of a pass.
+  void add_pass(const char* pass,
+                const std::string& obj_name,
+                const std::vector<std::pair<std::string, double>>& function_ms);
+  void add_object(const std::string& obj_name, double ms, size_t peak_rss_growth);
+  std::string report(int max_rows = 40) const;
+
+ private:
+  struct PassTotal {
+    double ms = 0;
+    int functions = 0;
+    double max_ms = 0;
+    std::string max_function;
+  };
+
+  struct FunctionTotal {
+    double ms = 0;
+    const char* slowest_pass = nullptr;
+    double slowest_pass_ms = 0;
+  };
+
+  struct ObjectTotal {
+    std::string name;
+    double ms = 0;
+    size_t peak_rss_growth = 0;
+  };
+
+  mutable std::mutex m_mutex;
+  // in the order the passes first ran
+  std::vector<std::pair<const char*, PassTotal>> m_passes;
+  std::unordered_map<std::string, FunctionTotal> m_functions;
+  std::vector<ObjectTotal> m_objects;
+};
+
+}  // namespace decompiler
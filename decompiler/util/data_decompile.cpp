@@ -358,7 +358,13 @@ std::string print_def(const goos::Object& obj) {
  */
 int index_of_closest_following_label_in_segment(int start_byte,
                                                 int seg,
-                                                const std::vector<DecompilerLabel>& labels) {
+                                                const std::vector<DecompilerLabel>& labels,
+                                                const LinkedObjectFile* file) {
+  // the object file has the labels sorted, so use that if they're its labels.
+  if (file && &file->labels == &labels) {
+    return file->get_label_after(seg, start_byte);
+  }
+
   int result_idx = -1;
   int closest_byte = -1;
   for (int i = 0; i < (int)labels.size(); i++) {
@@ -382,8 +388,10 @@ int guess_array_size_array(int start_offset,
                            int segment,
                            int stride,
                            const std::vector<std::vector<LinkedWord>>& all_words,
-                           const std::vector<DecompilerLabel>& labels) {
-  int end_label_idx = index_of_closest_following_label_in_segment(start_offset, segment, labels);
+                           const std::vector<DecompilerLabel>& labels,
+                           const LinkedObjectFile* file) {
+  int end_label_idx =
+      index_of_closest_following_label_in_segment(start_offset, segment, labels, file);
 
   int end_offset = all_words.at(segment).size() * 4;
   if (end_label_idx < 0) {
@@ -443,7 +451,7 @@ goos::Object decomp_ref_to_integer_array_guess_size(
     int field_location,
     const TypeSystem& ts,
     const std::vector<std::vector<LinkedWord>>& all_words,
-    const LinkedObjectFile* /*file*/,
+    const LinkedObjectFile* file,
     const TypeSpec& array_elt_type,
     int stride) {
   // lg::print("Decomp decomp_ref_to_inline_array_guess_size {}\n", array_elt_type.print());
@@ -473,7 +481,8 @@ goos::Object decomp_ref_to_integer_array_guess_size(
   // the data shouldn't have any labels in the middle of it, so we can find the end of the array
   // by searching for the label after the start label.
   const auto& start_label = labels.at(pointer_to_data.label_id());
-  int size_elts = guess_array_size_array(start_label.offset, my_seg, stride, all_words, labels);
+  int size_elts =
+      guess_array_size_array(start_label.offset, my_seg, stride, all_words, labels, file);
 
   return decompile_value_array(array_elt_type, elt_type_info, size_elts, stride, start_label.offset,
                                all_words.at(start_label.target_segment), ts);
@@ -483,8 +492,10 @@ int guess_array_size_inline_array(int start_offset,
                                   int segment,
                                   int stride,
                                   const std::vector<std::vector<LinkedWord>>& all_words,
-                                  const std::vector<DecompilerLabel>& labels) {
-  int end_label_idx = index_of_closest_following_label_in_segment(start_offset, segment, labels);
+                                  const std::vector<DecompilerLabel>& labels,
+                                  const LinkedObjectFile* file) {
+  int end_label_idx =
+      index_of_closest_following_label_in_segment(start_offset, segment, labels, file);
 
   int end_offset = all_words.at(segment).size() * 4;
   if (end_label_idx < 0) {
@@ -586,7 +597,7 @@ goos::Object decomp_ref_to_inline_array_guess_size(
   int start_offset = start_label.offset;
 
   int size_elts = guess_array_size_inline_array(start_offset, start_label.target_segment, stride,
-                                                all_words, labels);
+                                                all_words, labels, file);
 
   // now disassemble:
   std::vector<goos::Object> array_def = {pretty_print::to_symbol(
@@ -1435,8 +1446,8 @@ goos::Object decompile_structure(const TypeSpec& type,
         // inherit segment of our data.
         int array_data_seg = label.target_segment;
         // try to find the next thing in the file.
-        int num_elts =
-            guess_array_size_array(array_start_byte, array_data_seg, elt_size, words, labels);
+        int num_elts = guess_array_size_array(array_start_byte, array_data_seg, elt_size, words,
+                                              labels, file);
 
         std::vector<goos::Object> array_def = {pretty_print::to_symbol(
             fmt::format("new 'static 'array {} {}", field.type().print(), num_elts))};
@@ -1489,7 +1500,7 @@ goos::Object decompile_structure(const TypeSpec& type,
         // the data shouldn't have any labels in the middle of it, so we can find the end of the
         // array by searching for the label after the start label.
         int size_elts = guess_array_size_inline_array(array_start_byte, array_data_seg, elt_size,
-                                                      words, labels);
+                                                      words, labels, file);
         if (size_elts) {
           // now disassemble:
           std::vector<goos::Object> array_def = {pretty_print::to_symbol(
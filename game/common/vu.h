@@ -44,6 +44,41 @@ static inline REALLY_INLINE void copy_vector(void* dest, const void* src) {
   _mm_store_ps((float*)dest, val);
 }
 
+/*!
+ * All ones in the lanes selected by a VU field mask. The mask is nearly always a constant, so this
+ * folds away once inlined.
+ */
+static inline REALLY_INLINE __m128 vu_lane_mask(Mask mask) {
+  const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+  return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)mask), bits), bits));
+}
+
+/*!
+ * Write the lanes of val selected by mask to dest (aligned), leaving the others alone. This is the
+ * vector version of the "if (mask & (1 << i)) dest[i] = ..." loop.
+ */
+static inline REALLY_INLINE void vu_masked_store(float* dest, Mask mask, __m128 val) {
+  if (mask == Mask::xyzw) {
+    _mm_store_ps(dest, val);
+  } else {
+    _mm_store_ps(dest, _mm_blendv_ps(_mm_load_ps(dest), val, vu_lane_mask(mask)));
+  }
+}
+
+/*!
+ * Is any lane selected by mask negative? (-0 is not)
+ */
+static inline REALLY_INLINE bool vu_any_negative(Mask mask, __m128 val) {
+  return _mm_movemask_ps(_mm_cmplt_ps(val, _mm_setzero_ps())) & (int)mask;
+}
+
+/*!
+ * Swap a 4-bit lane mask between x-in-bit-0 and x-in-bit-3 order.
+ */
+inline u32 vu_reverse_lanes(u32 bits) {
+  return ((bits & 1) << 3) | ((bits & 2) << 1) | ((bits & 4) >> 1) | ((bits & 8) >> 3);
+}
+
 inline float vu_max(float a, float b) {
   return std::max(b, a);
   //  s32 ai, bi;
@@ -69,6 +104,18 @@ inline float vu_min(float a, float b) {
   }
 }
 
+/*!
+ * vu_min on all four lanes: the same integer compare, flipped when both inputs are negative.
+ */
+static inline REALLY_INLINE __m128 vu_min_ps(__m128 a, __m128 b) {
+  __m128i ai = _mm_castps_si128(a);
+  __m128i bi = _mm_castps_si128(b);
+  __m128i a_greater = _mm_cmpgt_epi32(ai, bi);
+  __m128i both_negative = _mm_srai_epi32(_mm_and_si128(ai, bi), 31);
+  __m128i pick_b = _mm_xor_si128(a_greater, both_negative);
+  return _mm_blendv_ps(a, b, _mm_castsi128_ps(pick_b));
+}
+
 struct alignas(16) Vf {
   REALLY_INLINE __m128 load() const { return _mm_load_ps(data); }
 
@@ -171,53 +218,26 @@ struct alignas(16) Vf {
   float operator[](int i) const { return data[i]; }
 
   void mr32(Mask mask, const Vf& other) {
-    float temp[4];
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        temp[i] = other[(i + 1) % 4];
-      }
-    }
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = temp[i];
-      }
-    }
+    auto v = other.load();
+    vu_masked_store(data, mask, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 3, 2, 1)));
   }
 
   REALLY_INLINE void mr32_z(const Vf& other) { data[2] = other.data[3]; }
 
   void mfir(Mask mask, s16 in) {
-    s32 sext = in;
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        memcpy(data + i, &sext, 4);
-      }
-    }
+    vu_masked_store(data, mask, _mm_castsi128_ps(_mm_set1_epi32(in)));
   }
 
   void maxi(Mask mask, const Vf& other, float I) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_max(other[i], I);
-      }
-    }
+    vu_masked_store(data, mask, _mm_max_ps(other.load(), _mm_set1_ps(I)));
   }
 
   void max(Mask mask, const Vf& other, float I) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_max(other[i], I);
-      }
-    }
+    vu_masked_store(data, mask, _mm_max_ps(other.load(), _mm_set1_ps(I)));
   }
 
   void max(Mask mask, const Vf& other, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_max(other[i], b[i]);
-      }
-    }
+    vu_masked_store(data, mask, _mm_max_ps(other.load(), b.load()));
   }
 
   REALLY_INLINE void max_xyzw(const Vf& a, const Vf& b) {
@@ -237,57 +257,25 @@ struct alignas(16) Vf {
   }
 
   void minii(Mask mask, const Vf& other, float I) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_min(other[i], I);
-      }
-    }
+    vu_masked_store(data, mask, vu_min_ps(other.load(), _mm_set1_ps(I)));
   }
 
   void mini(Mask mask, const Vf& other, float I) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_min(other[i], I);
-      }
-    }
+    vu_masked_store(data, mask, vu_min_ps(other.load(), _mm_set1_ps(I)));
   }
 
   void mini(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = vu_min(a[i], b[i]);
-      }
-    }
+    vu_masked_store(data, mask, vu_min_ps(a.load(), b.load()));
   }
 
-  void fill(float f) {
-    for (auto& x : data) {
-      x = f;
-    }
-  }
+  void fill(float f) { _mm_store_ps(data, _mm_set1_ps(f)); }
 
-  void move(Mask mask, const Vf& other) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = other[i];
-      }
-    }
-  }
+  void move(Mask mask, const Vf& other) { vu_masked_store(data, mask, other.load()); }
 
-  void mfp(Mask mask, float other) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = other;
-      }
-    }
-  }
+  void mfp(Mask mask, float other) { vu_masked_store(data, mask, _mm_set1_ps(other)); }
 
   void add(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] + b[i];
-      }
-    }
+    vu_masked_store(data, mask, _mm_add_ps(a.load(), b.load()));
   }
 
   REALLY_INLINE void add_xyzw(const Vf& a, const Vf& b) {
@@ -295,53 +283,27 @@ struct alignas(16) Vf {
   }
 
   void add(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] + b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_add_ps(a.load(), _mm_set1_ps(b)));
   }
 
   u32 add_and_set_sf_s(Mask mask, const Vf& a, float b) {
-    u32 flag = 0;
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] + b;
-        if (data[i] < 0) {
-          flag = 0x2;
-        }
-      }
-    }
-    return flag;
+    auto result = _mm_add_ps(a.load(), _mm_set1_ps(b));
+    vu_masked_store(data, mask, result);
+    return vu_any_negative(mask, result) ? 0x2 : 0;
   }
 
   u32 sub_and_set_sf_s(Mask mask, const Vf& a, float b) {
-    u32 flag = 0;
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] - b;
-        if (data[i] < 0) {
-          flag = 0x2;
-        }
-      }
-    }
-    return flag;
+    auto result = _mm_sub_ps(a.load(), _mm_set1_ps(b));
+    vu_masked_store(data, mask, result);
+    return vu_any_negative(mask, result) ? 0x2 : 0;
   }
 
   void sub(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] - b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_sub_ps(a.load(), _mm_set1_ps(b)));
   }
 
   void sub(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] - b[i];
-      }
-    }
+    vu_masked_store(data, mask, _mm_sub_ps(a.load(), b.load()));
   }
 
   REALLY_INLINE void mul_xyzw(const Vf& a, const Vf& b) {
@@ -353,70 +315,41 @@ struct alignas(16) Vf {
   }
 
   void mul(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] * b[i];
-      }
-    }
+    vu_masked_store(data, mask, _mm_mul_ps(a.load(), b.load()));
   }
 
   void saturate_infs() {
-    for (auto& val : data) {
-      if (std::isinf(val)) {
-        if (val > 0) {
-          val = FLT_MAX;
-        } else {
-          val = -FLT_MAX;
-        }
-      }
-    }
+    // replace +/-inf with +/-FLT_MAX, keeping the sign.
+    const auto sign_bit = _mm_set1_ps(-0.f);
+    auto v = load();
+    auto is_inf = _mm_cmpeq_ps(_mm_andnot_ps(sign_bit, v), _mm_set1_ps(INFINITY));
+    auto saturated = _mm_or_ps(_mm_and_ps(sign_bit, v), _mm_set1_ps(FLT_MAX));
+    _mm_store_ps(data, _mm_blendv_ps(v, saturated, is_inf));
   }
 
   void mul(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] * b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_mul_ps(a.load(), _mm_set1_ps(b)));
   }
 
   void itof0(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        s32 val;
-        memcpy(&val, &a.data[i], 4);
-        data[i] = val;
-      }
-    }
+    vu_masked_store(data, mask, _mm_cvtepi32_ps(_mm_castps_si128(a.load())));
   }
 
   void itof12(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        s32 val;
-        memcpy(&val, &a.data[i], 4);
-        data[i] = ((float)val) * (1.f / 4096.f);
-      }
-    }
+    vu_masked_store(data, mask,
+                    _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(a.load())),
+                               _mm_set1_ps(1.f / 4096.f)));
   }
 
   void itof15(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        s32 val;
-        memcpy(&val, &a.data[i], 4);
-        data[i] = ((float)val) * (1.f / 32768.f);
-      }
-    }
+    vu_masked_store(data, mask,
+                    _mm_mul_ps(_mm_cvtepi32_ps(_mm_castps_si128(a.load())),
+                               _mm_set1_ps(1.f / 32768.f)));
   }
 
   void ftoi4(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        s32 val = a.data[i] * 16.f;
-        memcpy(&data[i], &val, 4);
-      }
-    }
+    vu_masked_store(data, mask,
+                    _mm_castsi128_ps(_mm_cvttps_epi32(_mm_mul_ps(a.load(), _mm_set1_ps(16.f)))));
   }
 
   void ftoi4_check(Mask /*mask*/, const Vf& a) {
@@ -431,15 +364,8 @@ struct alignas(16) Vf {
   }
 
   void ftoi12(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        //        if (std::isnan(a.data[i])) {
-        //          ASSERT(false);
-        //        }
-        s32 val = a.data[i] * 4096.f;
-        memcpy(&data[i], &val, 4);
-      }
-    }
+    vu_masked_store(data, mask,
+                    _mm_castsi128_ps(_mm_cvttps_epi32(_mm_mul_ps(a.load(), _mm_set1_ps(4096.f)))));
   }
 
   void ftoi12_check(Mask mask, const Vf& a) {
@@ -455,44 +381,29 @@ struct alignas(16) Vf {
   }
 
   void ftoi0(Mask mask, const Vf& a) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        s32 val = a.data[i];
-        memcpy(&data[i], &val, 4);
-      }
-    }
+    vu_masked_store(data, mask, _mm_castsi128_ps(_mm_cvttps_epi32(a.load())));
   }
 };
 
 struct alignas(16) Accumulator {
   float data[4];
 
+  REALLY_INLINE __m128 load() const { return _mm_load_ps(data); }
+
   std::string print() const {
     return fmt::format("{} {} {} {}", data[0], data[1], data[2], data[3]);
   }
 
   void adda(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] + b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_add_ps(a.load(), _mm_set1_ps(b)));
   }
 
   void madda(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] += a[i] * b[i];
-      }
-    }
+    vu_masked_store(data, mask, _mm_add_ps(load(), _mm_mul_ps(a.load(), b.load())));
   }
 
   void madda(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] += a[i] * b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_add_ps(load(), _mm_mul_ps(a.load(), _mm_set1_ps(b))));
   }
 
   REALLY_INLINE void madda_xyzw(const Vf& _a, float _b) {
@@ -510,11 +421,7 @@ struct alignas(16) Accumulator {
   }
 
   void madd(Mask mask, Vf& dest, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        dest[i] = data[i] + a[i] * b[i];
-      }
-    }
+    vu_masked_store(dest.data, mask, _mm_add_ps(load(), _mm_mul_ps(a.load(), b.load())));
   }
 
   REALLY_INLINE void madd_xyzw(Vf& dest, const Vf& _a, float _b) {
@@ -534,59 +441,33 @@ struct alignas(16) Accumulator {
   }
 
   void madd(Mask mask, Vf& dest, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        dest[i] = data[i] + a[i] * b;
-      }
-    }
+    vu_masked_store(dest.data, mask, _mm_add_ps(load(), _mm_mul_ps(a.load(), _mm_set1_ps(b))));
   }
 
   void msub(Mask mask, Vf& dest, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        dest[i] = data[i] - a[i] * b;
-      }
-    }
+    vu_masked_store(dest.data, mask, _mm_sub_ps(load(), _mm_mul_ps(a.load(), _mm_set1_ps(b))));
   }
 
   void msuba(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] -= a[i] * b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_sub_ps(load(), _mm_mul_ps(a.load(), _mm_set1_ps(b))));
   }
 
   u16 madd_flag(Mask mask, Vf& dest, const Vf& a, float b) {
-    u16 result = 0;
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        dest[i] = data[i] + a[i] * b;
-        if (dest[i] < 0) {
-          result |= (1 << (3 - i)) << 4;
-        }
-        if (dest[i] == 0) {
-          result |= (1 << (3 - i));
-        }
-      }
-    }
-    return result;
+    auto result = _mm_add_ps(load(), _mm_mul_ps(a.load(), _mm_set1_ps(b)));
+    vu_masked_store(dest.data, mask, result);
+    // the MAC flags have x in the high bit, so lane order is reversed from the mask.
+    const auto zero = _mm_setzero_ps();
+    const u32 neg = _mm_movemask_ps(_mm_cmplt_ps(result, zero)) & (u32)mask;
+    const u32 is_zero = _mm_movemask_ps(_mm_cmpeq_ps(result, zero)) & (u32)mask;
+    return (vu_reverse_lanes(neg) << 4) | vu_reverse_lanes(is_zero);
   }
 
   void mula(Mask mask, const Vf& a, const Vf& b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] * b[i];
-      }
-    }
+    vu_masked_store(data, mask, _mm_mul_ps(a.load(), b.load()));
   }
 
   void mula(Mask mask, const Vf& a, float b) {
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        data[i] = a[i] * b;
-      }
-    }
+    vu_masked_store(data, mask, _mm_mul_ps(a.load(), _mm_set1_ps(b)));
   }
 
   REALLY_INLINE void mula_xyzw(const Vf& _a, float _b) {
@@ -0,0 +1,316 @@
+#include "frame_replay.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "common/dma/dma_copy.h"
+#include "common/goal_constants.h"
+#include "common/log/log.h"
+#include "common/util/Assert.h"
+#include "common/util/Timer.h"
+#include "common/util/compress.h"
+#include "common/util/json_util.h"
+#include "common/util/string_util.h"
+
+#include "game/graphics/opengl_renderer/OpenGLRenderer.h"
+#include "game/graphics/opengl_renderer/loader/Loader.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
+#include "game/graphics/texture/TexturePool.h"
+#include "game/runtime.h"
+#include "game/system/hid/sdl_util.h"
+
+#include "fmt/format.h"
+#include "third-party/SDL/include/SDL3/SDL.h"
+#include "third-party/glad/include/glad/glad.h"
+
+namespace frame_replay {
+
+namespace {
+constexpr u32 kCaptureMagic = 0x5047524f;  // "ORGP"
+constexpr u32 kCaptureVersion = 1;
+
+struct BucketTiming {
+  std::string name;
+  double cpu_seconds = 0;
+  double gpu_seconds = 0;
+  int gpu_samples = 0;
+  u64 draw_calls = 0;
+  u64 triangles = 0;
+};
+
+double percentile(const std::vector<double>& sorted, double p) {
+  return sorted.at(std::min(sorted.size() - 1, size_t(p * sorted.size())));
+}
+}  // namespace
+
+void CapturedFrame::serialize(Serializer& ser) {
+  ser.from_ptr(&dma_start_offset);
+  ser.from_pod_vector(&dma);
+  ser.from_pod_vector(&vram);
+  ser.from_ptr(&pmode_alp);
+}
+
+void Capture::serialize(Serializer& ser) {
+  u32 magic = kCaptureMagic;
+  u32 capture_version = kCaptureVersion;
+  ser.from_ptr(&magic);
+  ser.from_ptr(&capture_version);
+  if (magic != kCaptureMagic || capture_version != kCaptureVersion) {
+    throw std::runtime_error(fmt::format("not a frame capture, or an old version ({})",
+                                         capture_version));
+  }
+  ser.from_ptr(&version);
+  ser.from_string_vector(&levels);
+  ser.from_ptr(&game_res_w);
+  ser.from_ptr(&game_res_h);
+  ser.from_ptr(&msaa_samples);
+  ser.from_vector(&frames, [&](CapturedFrame* frame) { frame->serialize(ser); });
+}
+
+void save_capture(Capture& capture, const fs::path& path) {
+  Serializer ser;
+  capture.serialize(ser);
+  auto result = ser.get_save_result();
+  auto compressed = compression::compress_zstd_parallel(result.first, result.second);
+  file_util::create_dir_if_needed_for_file(path);
+  file_util::write_binary_file(path, compressed.data(), compressed.size());
+}
+
+Capture load_capture(const fs::path& path) {
+  auto compressed = file_util::read_binary_file(path);
+  auto data = compression::decompress_zstd(compressed.data(), compressed.size());
+  Serializer ser(data.data(), data.size(), false);
+  Capture capture;
+  capture.serialize(ser);
+  return capture;
+}
+
+void Recorder::start(int frame_count, GameVersion version, const RenderOptions& options) {
+  m_capture = {};
+  m_capture.version = version;
+  m_capture.game_res_w = options.game_res_w;
+  m_capture.game_res_h = options.game_res_h;
+  m_capture.msaa_samples = options.msaa_samples;
+  m_frames_left = frame_count;
+  lg::info("Recording {} frames for replay", frame_count);
+}
+
+void Recorder::add_frame(const DmaData& chain,
+                         TexturePool& texture_pool,
+                         Loader& loader,
+                         float pmode_alp) {
+  ASSERT(active());
+  auto& frame = m_capture.frames.emplace_back();
+  frame.dma_start_offset = chain.start_offset;
+  frame.dma = chain.data;
+  frame.vram = texture_pool.get_vram_state();
+  frame.pmode_alp = pmode_alp;
+  for (auto& level : loader.get_want_levels()) {
+    if (std::find(m_capture.levels.begin(), m_capture.levels.end(), level) ==
+        m_capture.levels.end()) {
+      m_capture.levels.push_back(level);
+    }
+  }
+
+  m_frames_left--;
+  if (!active()) {
+    auto path = file_util::get_user_misc_dir(m_capture.version) / "replay-captures" /
+                fmt::format("{}.bin", str_util::current_local_timestamp_no_colons());
+    Timer timer;
+    save_capture(m_capture, path);
+    lg::info("Saved {} frames to {} in {:.2f}s", m_capture.frames.size(), path.string(),
+             timer.getSeconds());
+    m_capture = {};
+  }
+}
+
+int run_replay(const fs::path& capture_path, const ReplaySettings& settings) {
+  Capture capture;
+  try {
+    capture = load_capture(capture_path);
+  } catch (const std::exception& e) {
+    lg::error("Failed to load frame capture {}: {}", capture_path.string(), e.what());
+    return 1;
+  }
+  if (capture.frames.empty()) {
+    lg::error("Frame capture {} has no frames", capture_path.string());
+    return 1;
+  }
+  lg::info("Replaying {} frames of {} at {}x{}, levels: {}", capture.frames.size(),
+           version_to_game_name(capture.version), capture.game_res_w, capture.game_res_h,
+           fmt::join(capture.levels, ", "));
+
+  if (!SDL_Init(SDL_INIT_VIDEO)) {
+    sdl_util::log_error("Could not initialize SDL");
+    return 1;
+  }
+  SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+  SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+  SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+#ifndef __APPLE__
+  SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+#else
+  SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);
+#endif
+  SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+  SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
+  SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+  SDL_Window* window = SDL_CreateWindow("OpenGOAL - Replay", capture.game_res_w,
+                                        capture.game_res_h, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+  if (!window) {
+    sdl_util::log_error("Could not create window");
+    SDL_Quit();
+    return 1;
+  }
+  SDL_GLContext gl_context = SDL_GL_CreateContext(window);
+  if (!gl_context || !SDL_GL_MakeCurrent(window, gl_context)) {
+    sdl_util::log_error("Could not create OpenGL context");
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return 1;
+  }
+  gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress);
+  if (!gladLoadGL()) {
+    lg::error("GL init fail");
+    SDL_GL_DestroyContext(gl_context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return 1;
+  }
+  load_buffer_storage((GLADloadproc)SDL_GL_GetProcAddress);
+  load_parallel_shader_compile((GLADloadproc)SDL_GL_GetProcAddress);
+  std::string gpu_name = (const char*)glGetString(GL_RENDERER);
+  lg::info("GPU: {}", gpu_name);
+
+  // the game isn't running, so give the renderer blank memory for the few things that read from it
+  // directly instead of the chain (texture uploads). The texture pool is set from the capture.
+  std::vector<u8> blank_ee_memory(EE_MAIN_MEM_SIZE);
+  g_ee_main_mem = blank_ee_memory.data();
+
+  std::vector<double> frame_times_ms;
+  std::vector<BucketTiming> buckets;
+  {
+    auto texture_pool = std::make_shared<TexturePool>(capture.version);
+    auto loader = std::make_shared<Loader>(
+        file_util::get_jak_project_dir() / "out" / game_version_names[capture.version] / "fr3",
+        fr3_level_count[capture.version]);
+    OpenGLRenderer renderer(texture_pool, loader, capture.version);
+
+    loader->set_want_levels(capture.levels);
+    loader->update_blocking(*texture_pool);
+
+    RenderOptions options;
+    options.game_res_w = capture.game_res_w;
+    options.game_res_h = capture.game_res_h;
+    options.window_framebuffer_width = capture.game_res_w;
+    options.window_framebuffer_height = capture.game_res_h;
+    options.draw_region_width = capture.game_res_w;
+    options.draw_region_height = capture.game_res_h;
+    options.msaa_samples = capture.msaa_samples;
+    options.gpu_sync = settings.gpu_sync;
+    options.prepare_buckets_in_parallel = true;
+    options.measure_gpu_time = true;
+
+    std::unordered_map<std::string, size_t> bucket_idx;
+    auto render_frame = [&](const CapturedFrame& frame, bool record) {
+      Timer timer;
+      texture_pool->set_vram_state(frame.vram);
+      options.pmode_alp_register = frame.pmode_alp;
+      renderer.render(DmaFollower(frame.dma.data(), frame.dma_start_offset), options);
+      glFinish();
+      if (!record) {
+        return;
+      }
+      frame_times_ms.push_back(timer.getMs());
+      for (auto& top : renderer.profiler().root()->children()) {
+        if (top.name() != "buckets") {
+          continue;
+        }
+        for (auto& node : top.children()) {
+          auto [it, inserted] = bucket_idx.try_emplace(node.name(), buckets.size());
+          if (inserted) {
+            buckets.emplace_back().name = node.name();
+          }
+          auto& bucket = buckets[it->second];
+          bucket.cpu_seconds += node.stats().duration;
+          if (node.stats().gpu_duration >= 0) {
+            bucket.gpu_seconds += node.stats().gpu_duration;
+            bucket.gpu_samples++;
+          }
+          bucket.draw_calls += node.stats().draw_calls;
+          bucket.triangles += node.stats().triangles;
+        }
+      }
+    };
+
+    // the first run compiles shaders and uploads merc models, so isn't timed.
+    for (auto& frame : capture.frames) {
+      render_frame(frame, false);
+    }
+    for (int loop = 0; loop < settings.loops; loop++) {
+      for (auto& frame : capture.frames) {
+        render_frame(frame, true);
+      }
+    }
+  }
+
+  g_ee_main_mem = nullptr;
+  SDL_GL_DestroyContext(gl_context);
+  SDL_DestroyWindow(window);
+  SDL_Quit();
+
+  if (frame_times_ms.empty()) {
+    lg::error("No frames were timed, --bench-replay-loops must be at least 1");
+    return 1;
+  }
+
+  const double frame_count = frame_times_ms.size();
+  double total_ms = 0;
+  for (auto t : frame_times_ms) {
+    total_ms += t;
+  }
+  std::sort(frame_times_ms.begin(), frame_times_ms.end());
+  std::stable_sort(buckets.begin(), buckets.end(), [](const auto& a, const auto& b) {
+    return a.cpu_seconds + a.gpu_seconds > b.cpu_seconds + b.gpu_seconds;
+  });
+
+  lg::info("{:<40} {:>10} {:>10} {:>10} {:>12}", "bucket", "cpu ms", "gpu ms", "draws", "tris");
+  for (const auto& bucket : buckets) {
+    if (bucket.draw_calls == 0 && bucket.cpu_seconds < 1e-5 * frame_count) {
+      continue;
+    }
+    double gpu_ms = bucket.gpu_samples ? 1000. * bucket.gpu_seconds / bucket.gpu_samples : -1.;
+    lg::info("{:<40} {:10.3f} {:10.3f} {:10.1f} {:12.1f}", bucket.name,
+             1000. * bucket.cpu_seconds / frame_count, gpu_ms, bucket.draw_calls / frame_count,
+             bucket.triangles / frame_count);
+  }
+  lg::info("{} frames, mean {:.3f} ms, p50 {:.3f} ms, p90 {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms",
+           frame_times_ms.size(), total_ms / frame_count, percentile(frame_times_ms, 0.5),
+           percentile(frame_times_ms, 0.9), percentile(frame_times_ms, 0.99),
+           frame_times_ms.back());
+
+  if (!settings.json_path.empty()) {
+    json result;
+    result["capture"] = capture_path.string();
+    result["gpu"] = gpu_name;
+    result["frames"] = frame_times_ms.size();
+    result["frame_time_ms"] = {{"mean", total_ms / frame_count},
+                               {"p50", percentile(frame_times_ms, 0.5)},
+                               {"p90", percentile(frame_times_ms, 0.9)},
+                               {"p99", percentile(frame_times_ms, 0.99)},
+                               {"max", frame_times_ms.back()}};
+    result["buckets"] = json::array();
+    for (const auto& bucket : buckets) {
+      result["buckets"].push_back(
+          {{"name", bucket.name},
+           {"cpu_ms", 1000. * bucket.cpu_seconds / frame_count},
+           {"gpu_ms", bucket.gpu_samples ? 1000. * bucket.gpu_seconds / bucket.gpu_samples : -1.},
+           {"draw_calls", bucket.draw_calls / frame_count},
+           {"triangles", bucket.triangles / frame_count}});
+    }
+    file_util::write_text_file(settings.json_path, result.dump(2));
+  }
+  return 0;
+}
+
+}  // namespace frame_replay
@@ -0,0 +1,86 @@
+#pragma once
+
+/*!
+ * @file frame_replay.h
+ * Record the DMA chains of a few seconds of gameplay, and play them back through the renderer
+ * without the game (gk --bench-replay). The same capture can be replayed on different machines or
+ * builds to compare renderer performance with exactly the same input.
+ */
+
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+#include "common/util/Serializer.h"
+#include "common/versions/versions.h"
+
+struct RenderOptions;
+struct DmaData;
+class TexturePool;
+class Loader;
+
+namespace frame_replay {
+
+struct CapturedFrame {
+  // the chain, as copied by the FixedChunkDmaCopier
+  u32 dma_start_offset = 0;
+  std::vector<u8> dma;
+  // TexturePool::get_vram_state() before the frame was rendered
+  std::vector<u32> vram;
+  float pmode_alp = 1.f;
+
+  void serialize(Serializer& ser);
+};
+
+struct Capture {
+  GameVersion version = GameVersion::Jak1;
+  // every level the game wanted during the capture
+  std::vector<std::string> levels;
+  // the internal resolution when it was captured, which is also used for the replay.
+  int game_res_w = 640;
+  int game_res_h = 480;
+  int msaa_samples = 2;
+  std::vector<CapturedFrame> frames;
+
+  void serialize(Serializer& ser);
+};
+
+void save_capture(Capture& capture, const fs::path& path);
+Capture load_capture(const fs::path& path);
+
+/*!
+ * Records frames while the game is running. Started from the debug menu.
+ */
+class Recorder {
+ public:
+  void start(int frame_count, GameVersion version, const RenderOptions& options);
+  bool active() const { return m_frames_left > 0; }
+
+  /*!
+   * Add the frame that's about to be rendered, with its copied DMA chain. Must be called before the
+   * renderer runs. After the last frame, the capture is saved.
+   */
+  void add_frame(const DmaData& chain,
+                 TexturePool& texture_pool,
+                 Loader& loader,
+                 float pmode_alp);
+
+ private:
+  Capture m_capture;
+  int m_frames_left = 0;
+};
+
+struct ReplaySettings {
+  int loops = 10;  // number of times to play the capture, after one warmup run.
+  // glFinish after each bucket, so bucket CPU times include waiting for the GPU.
+  bool gpu_sync = false;
+  fs::path json_path;  // if set, write the results here.
+};
+
+/*!
+ * Replay a capture and print the per-bucket and frame timings. Returns the exit code for gk.
+ */
+int run_replay(const fs::path& capture_path, const ReplaySettings& settings);
+
+}  // namespace frame_replay
@@ -21,6 +21,8 @@
 #include "game/kernel/common/kmachine.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/runtime.h"
+#include "game/sound/sndshim.h"
+#include "pipelines/headless.h"
 #include "pipelines/opengl.h"
 
 namespace Gfx {
@@ -36,6 +38,8 @@ const GfxRendererModule* GetRenderer(GfxPipeline pipeline) {
       return NULL;
     case GfxPipeline::OpenGL:
       return &gRendererOpenGL;
+    case GfxPipeline::Headless:
+      return &gRendererHeadless;
     default:
       lg::error("Requested unknown renderer {}", fmt::underlying(pipeline));
       return NULL;
@@ -56,9 +60,11 @@ u32 Init(GameVersion version) {
 
   g_debug_settings = game_settings::DebugSettings();
   g_debug_settings.load_settings();
+  snd_SetLatencyFrames(g_debug_settings.audio_latency_frames);
   {
     auto p = scoped_prof("startup::gfx::get_renderer");
-    g_global_settings.renderer = GetRenderer(GfxPipeline::OpenGL);
+    g_global_settings.renderer =
+        GetRenderer(g_global_settings.headless ? GfxPipeline::Headless : GfxPipeline::OpenGL);
   }
 
   {
@@ -69,6 +75,10 @@ u32 Init(GameVersion version) {
     }
   }
 
+  if (g_global_settings.headless) {
+    return 0;  // no window to make
+  }
+
   if (g_main_thread_id != std::this_thread::get_id()) {
     lg::error("Ran Gfx::Init outside main thread. Init display elsewhere?");
   } else {
@@ -100,7 +110,9 @@ void Loop(std::function<bool()> f) {
 
 u32 Exit() {
   lg::info("GFX Exit");
-  Display::KillMainDisplay();
+  if (Display::GetMainDisplay()) {
+    Display::KillMainDisplay();
+  }
   GetCurrentRenderer()->exit();
   g_debug_settings.save_settings();
   return 0;
@@ -131,6 +143,12 @@ u32 sync_path() {
   return 0;
 }
 
+void flush() {
+  if (GetCurrentRenderer()) {
+    GetCurrentRenderer()->flush();
+  }
+}
+
 bool CollisionRendererGetMask(GfxGlobalSettings::CollisionRendererMode mode, s64 mask_id) {
   int arr_idx = mask_id / 32;
   int arr_ofs = mask_id % 32;
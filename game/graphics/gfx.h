@@ -23,7 +23,7 @@ struct GfxGlobalSettings;
 class GfxDisplay;
 
 // enum for rendering pipeline
-enum class GfxPipeline { Invalid = 0, OpenGL };
+enum class GfxPipeline { Invalid = 0, OpenGL, Headless };
 
 // module for the different rendering pipelines
 struct GfxRendererModule {
@@ -38,6 +38,7 @@ struct GfxRendererModule {
   std::function<void()> exit;
   std::function<u32()> vsync;
   std::function<u32()> sync_path;
+  std::function<void()> flush;
   std::function<void(const void*, u32)> send_chain;
   std::function<void(const u8*, int, u32)> texture_upload_now;
   std::function<void(u32, u32, u32)> texture_relocate;
@@ -67,6 +68,10 @@ struct GfxGlobalSettings {
   // multi-sampled anti-aliasing sample count. 1 = disabled.
   int msaa_samples = 2;
 
+  // lower the game resolution, down to this fraction, when the GPU can't keep up with target_fps.
+  bool dynamic_resolution = false;
+  float dynamic_resolution_min_scale = 0.5f;
+
   // current renderer
   const GfxRendererModule* renderer;
 
@@ -76,7 +81,12 @@ struct GfxGlobalSettings {
 
   // vsync enable
   bool vsync = true;
-  bool old_vsync = false;
+  // with vsync, show a late frame right away instead of waiting for the next refresh. It tears for
+  // that frame, but doesn't drop to half the frame rate. Ignored if the driver doesn't support it.
+  bool adaptive_vsync = false;
+  // how many frames the GPU may be behind before the next one is started, 0 to let the driver
+  // decide. Fewer queued frames means the input for a frame is read closer to when it's shown.
+  int max_queued_frames = 0;
   // target frame rate
   float target_fps = 60;
   // use custom frame limiter
@@ -85,6 +95,31 @@ struct GfxGlobalSettings {
   // frame timing things
   bool experimental_accurate_lag = false;
   bool sleep_in_frame_limiter = true;
+  // copy each DMA chain when it's sent, so the game can start the next frame before the renderer
+  // is done with this one.
+  bool pipelined_dma = false;
+  // when copying, skip the chunks that haven't changed since the copy was last used.
+  bool incremental_dma_copy = false;
+  // upload loading levels from another thread with a second GL context. Only read at startup.
+  bool gl_upload_thread = false;
+  // sample controllers on their own thread every millisecond, instead of once per rendered frame.
+  // Only read at startup.
+  bool input_poll_thread = false;
+  // GPU memory for loaded levels, in MB. Levels that aren't in use are unloaded to stay under it.
+  // 0 for no limit.
+  int level_gpu_budget_mb = 0;
+  // load big compressed textures at a lower resolution and stream in the rest. Only read at
+  // startup.
+  bool texture_streaming = false;
+  // also pack tfrag textures into texture arrays, so tfrag draws switch textures with a uniform
+  // instead of a bind. The arrays are a second copy of those textures in GPU memory. Only read at
+  // startup.
+  bool tfrag_texture_arrays = false;
+  // no window or GPU: nothing is drawn, and frames run as fast as possible with a fixed timestep.
+  // Only read at startup.
+  bool headless = false;
+  // in headless mode, exit after this many frames. 0 to run until the game exits.
+  int headless_frames = 0;
 
   // fancy effect things
   bool hack_no_tex = false;
@@ -118,6 +153,8 @@ u32 vsync();
 void register_vsync_callback(std::function<void()> f);
 void clear_vsync_callback();
 u32 sync_path();
+// wait until the renderer is done with everything the game sent it.
+void flush();
 
 // matching enum in kernel-defs.gc !!
 enum class RendererTreeType { NONE = 0, TFRAG3 = 1, TIE3 = 2, INVALID };
@@ -1,1664 +1,835 @@
 #include "jak2_texture_remap.h"
 
-#include <unordered_map>
-#include <utility>
-#include <vector>
+#include <algorithm>
+#include <iterator>
 
 namespace {
-const std::unordered_map<int, std::vector<std::pair<int, int>>> data = {
-    {12, {{46, 1}, {134, 1}, {38, 1}, {201, 1}, {52, 1}, {12, 1}, {187, 1}}},
-    {31, {{2, 1}}},
-    {623, {{6, 1}, {7, 2}}},
-    {778,
-     {{47, 1}, {61, 1}, {28, 1}, {59, 1}, {65, 1}, {62, 1}, {66, 2}, {45, 1}, {26, 1}, {31, 1}}},
-    {779, {{99, 1},  {26, 1},  {40, 2},  {52, 3},  {6, 1},   {7, 2},   {8, 3},  {2, 1},  {3, 2},
-           {47, 3},  {36, 1},  {30, 1},  {32, 1},  {38, 2},  {41, 3},  {34, 1}, {24, 1}, {31, 2},
-           {39, 3},  {20, 1},  {21, 2},  {37, 3},  {49, 1},  {50, 2},  {51, 3}, {78, 1}, {79, 2},
-           {80, 3},  {73, 1},  {75, 2},  {76, 3},  {66, 1},  {83, 2},  {84, 3}, {11, 1}, {12, 2},
-           {113, 1}, {109, 1}, {110, 2}, {112, 3}, {105, 1}, {107, 2}, {159, 1}}},
-    {787, {{149, 1}, {150, 2}, {168, 1}, {161, 1}, {160, 2}, {162, 3}, {163, 4}, {164, 4}, {169, 1},
-           {44, 1},  {54, 1},  {12, 1},  {93, 1},  {65, 1},  {184, 1}, {28, 1},  {182, 2}, {77, 1},
-           {92, 1},  {21, 1},  {49, 1},  {185, 2}, {30, 1},  {52, 2},  {16, 1},  {24, 2},  {72, 3},
-           {187, 4}, {75, 1},  {27, 1},  {85, 2},  {50, 1},  {69, 1},  {10, 1},  {47, 1},  {51, 2},
-           {153, 1}, {76, 1},  {13, 1},  {186, 1}, {40, 1},  {82, 2},  {183, 1}}},
-    {788, {{2, 1}}},
-    {789, {{10, 1}, {11, 2}, {70, 1}, {54, 1}, {52, 1}, {63, 1}, {59, 1}}},
-    {851, {{62, 1}, {22, 1}, {57, 2}, {43, 1}, {44, 2}, {45, 3}, {53, 1}, {63, 2}, {9, 1},
-           {18, 2}, {28, 1}, {39, 1}, {26, 1}, {49, 1}, {60, 1}, {42, 1}, {21, 1}, {41, 1},
-           {47, 2}, {35, 1}, {46, 1}, {51, 2}, {61, 1}, {7, 1},  {5, 1},  {56, 2}}},
-    {853,
-     {{5, 1},
-      {6, 2},
-      {57, 1},
-      {55, 1},
-      {58, 2},
-      {59, 1},
-      {61, 1},
-      {63, 2},
-      {64, 3},
-      {51, 1},
-      {49, 1},
-      {47, 1}}},
-    {856, {{14, 1}, {77, 1}, {66, 1}, {68, 2}, {80, 1}, {82, 1}, {51, 1}, {75, 1},
-           {85, 1}, {83, 1}, {76, 1}, {81, 1}, {44, 1}, {67, 1}, {28, 1}, {21, 1},
-           {22, 2}, {27, 3}, {25, 1}, {26, 2}, {37, 3}, {53, 1}, {72, 1}}},
-    {858, {{118, 1}, {120, 2}, {121, 3}, {52, 1}, {50, 1}, {48, 1}, {96, 1}}},
-    {881, {{89, 1}, {17, 1}, {34, 2}, {51, 1}, {53, 1}, {43, 1}, {46, 1}, {19, 1}, {44, 2},
-           {45, 3}, {40, 1}, {91, 1}, {92, 2}, {84, 1}, {52, 1}, {28, 1}, {2, 1},  {13, 2},
-           {12, 1}, {23, 2}, {61, 1}, {65, 1}, {73, 1}, {82, 1}, {74, 1}, {76, 1}, {72, 1}}},
-    {918,
-     {{98, 1},
-      {99, 2},
-      {96, 1},
-      {97, 2},
-      {61, 1},
-      {53, 1},
-      {56, 2},
-      {58, 3},
-      {94, 1},
-      {95, 2},
-      {92, 2},
-      {93, 4},
-      {32, 1},
-      {37, 2},
-      {129, 1},
-      {130, 2}}},
-    {929, {{131, 1}, {132, 2}, {119, 2}, {118, 2}, {121, 3}, {128, 1}, {122, 1}, {95, 1},
-           {81, 1},  {19, 1},  {70, 2},  {78, 3},  {79, 4},  {103, 1}, {104, 2}, {75, 1},
-           {76, 2},  {57, 1},  {66, 2},  {67, 3},  {73, 1},  {92, 2},  {38, 1},  {39, 2},
-           {17, 1},  {34, 2},  {36, 3},  {33, 1},  {35, 2},  {37, 3},  {29, 1},  {30, 2},
-           {32, 3},  {43, 1},  {44, 2},  {45, 3},  {46, 4},  {15, 1},  {27, 2},  {28, 3},
-           {16, 1},  {23, 2},  {88, 3},  {74, 1},  {77, 2},  {91, 3},  {24, 1},  {25, 2},
-           {26, 3},  {102, 4}, {53, 1},  {54, 2},  {101, 1}, {98, 1},  {99, 2},  {100, 3}}},
-    {930,
-     {{134, 1},
-      {27, 1},
-      {28, 2},
-      {29, 3},
-      {23, 1},
-      {24, 2},
-      {31, 3},
-      {58, 1},
-      {59, 2},
-      {60, 3},
-      {52, 1},
-      {55, 2},
-      {56, 3},
-      {42, 1},
-      {63, 2},
-      {64, 3},
-      {33, 1},
-      {34, 2}}},
-    {932, {{83, 1}, {84, 2}, {6, 1},  {8, 2},  {18, 1}, {20, 2}, {47, 1}, {50, 1},
-           {11, 1}, {54, 1}, {53, 1}, {34, 1}, {41, 2}, {48, 3}, {32, 1}, {36, 2},
-           {23, 1}, {24, 2}, {9, 1},  {10, 2}, {22, 1}, {43, 2}, {44, 3}}},
-    {933,
-     {{2, 1},
-      {123, 1},
-      {9, 1},
-      {10, 2},
-      {11, 3},
-      {5, 1},
-      {6, 2},
-      {13, 3},
-      {39, 1},
-      {40, 2},
-      {41, 3},
-      {33, 1},
-      {36, 2},
-      {37, 3},
-      {23, 1},
-      {44, 2},
-      {45, 3},
-      {15, 1},
-      {16, 2}}},
-    {955,
-     {{70, 1},
-      {15, 1},
-      {48, 1},
-      {3, 1},
-      {10, 2},
-      {12, 3},
-      {30, 1},
-      {32, 2},
-      {37, 1},
-      {35, 1},
-      {26, 1},
-      {76, 1},
-      {84, 2}}},
-    {957, {{3, 1}, {5, 2}, {6, 3}}},
-    {973, {{13, 1}, {16, 2}, {27, 1}, {8, 1}, {9, 2}, {18, 1}, {14, 1}, {17, 1}}},
-    {974,
-     {{30, 1},
-      {56, 1},
-      {60, 2},
-      {61, 3},
-      {39, 1},
-      {63, 1},
-      {27, 1},
-      {44, 2},
-      {15, 1},
-      {45, 2},
-      {32, 1},
-      {1, 1},
-      {4, 2},
-      {6, 3},
-      {40, 1},
-      {21, 1},
-      {37, 2},
-      {38, 3},
-      {12, 1}}},
-    {977, {{30, 1}, {72, 1}, {73, 2}, {74, 3}, {35, 1}, {50, 1}, {76, 1},
-           {16, 1}, {43, 2}, {14, 1}, {44, 2}, {31, 1}, {2, 1},  {19, 2},
-           {33, 3}, {36, 1}, {66, 1}, {24, 1}, {37, 2}, {39, 3}, {22, 1}}},
-    {978, {{8, 1}, {18, 2}, {26, 1}, {12, 1}, {21, 2}, {22, 1}, {17, 1}, {19, 1}}},
-    {979, {{15, 1}, {16, 3},  {17, 4},  {11, 3},  {12, 4},  {13, 5}, {1, 1},  {2, 2},
-           {3, 3},  {40, 4},  {41, 5},  {42, 6},  {36, 6},  {37, 7}, {38, 8}, {32, 8},
-           {33, 9}, {34, 10}, {28, 10}, {29, 11}, {30, 12}, {5, 1},  {6, 2},  {7, 3},
-           {26, 3}, {22, 3},  {23, 4},  {24, 5},  {19, 5},  {20, 6}, {9, 1}}},
-    {998,
-     {{64, 1},
-      {66, 1},
-      {61, 1},
-      {58, 1},
-      {55, 1},
-      {53, 1},
-      {51, 1},
-      {46, 1},
-      {42, 1},
-      {44, 2},
-      {37, 1}}},
-    {1021, {{13, 1}, {7, 1}, {9, 2}, {70, 1}, {71, 2}, {72, 3}, {66, 1}}},
-    {1022, {{6, 1}}},
-    {1031,
-     {{4, 1},
-      {56, 1},
-      {16, 1},
-      {64, 1},
-      {44, 1},
-      {34, 1},
-      {49, 1},
-      {40, 1},
-      {67, 1},
-      {53, 1},
-      {27, 1},
-      {28, 2},
-      {37, 1},
-      {54, 1}}},
-    {1059, {{99, 1}, {86, 1}, {100, 2}, {85, 1},  {42, 1}, {52, 2}, {46, 1}, {23, 1}, {47, 2},
-            {78, 1}, {63, 1}, {80, 1},  {89, 2},  {62, 1}, {93, 2}, {64, 1}, {50, 1}, {92, 2},
-            {61, 1}, {58, 1}, {67, 1},  {40, 1},  {5, 1},  {8, 2},  {41, 1}, {22, 1}, {84, 1},
-            {96, 1}, {97, 1}, {103, 1}, {104, 1}, {81, 1}, {105, 1}}},
-    {1060, {{6, 1},   {4, 1},   {7, 2},   {8, 1},   {29, 1},  {27, 1},  {24, 1},  {14, 1},
-            {15, 2},  {46, 1},  {147, 1}, {149, 2}, {44, 1},  {41, 1},  {143, 1}, {86, 1},
-            {84, 1},  {85, 2},  {139, 1}, {140, 2}, {198, 1}, {100, 1}, {101, 2}, {102, 3},
-            {96, 1},  {97, 2},  {104, 3}, {131, 1}, {132, 2}, {133, 3}, {125, 1}, {128, 2},
-            {129, 3}, {115, 1}, {136, 2}, {137, 3}, {106, 1}, {107, 2}}},
-    {1117, {{11, 1}, {23, 2}, {21, 1}, {25, 2}}},
-    {1131, {{8, 1},  {9, 2},  {10, 3}, {76, 1}, {4, 1},  {5, 2},  {12, 3}, {14, 1}, {15, 2},
-            {39, 1}, {40, 2}, {41, 3}, {33, 1}, {36, 2}, {37, 3}, {23, 1}, {44, 2}, {45, 3},
-            {75, 1}, {66, 1}, {70, 2}, {72, 3}, {63, 1}, {64, 2}, {71, 3}, {58, 1}, {56, 1},
-            {61, 1}, {62, 2}, {67, 3}, {52, 1}, {68, 2}, {107, 3}}},
-    {1133, {{52, 1}, {32, 1}, {14, 1}, {57, 1}, {31, 1}, {30, 1}, {9, 1}}},
-    {1135, {{58, 1}, {60, 2}, {61, 3}, {62, 1}}},
-    {1137,
-     {{133, 1},
-      {118, 1},
-      {119, 2},
-      {9, 1},
-      {111, 2},
-      {129, 1},
-      {125, 1},
-      {123, 1},
-      {127, 2},
-      {116, 1},
-      {117, 2},
-      {77, 1},
-      {1, 1},
-      {4, 2},
-      {7, 1}}},
-    {1183, {{9, 1},  {10, 2}, {11, 3}, {79, 1}, {5, 1},  {6, 2},  {13, 3}, {15, 1}, {16, 2},
-            {69, 1}, {50, 1}, {57, 1}, {58, 2}, {62, 3}, {66, 1}, {67, 2}, {75, 1}, {76, 2},
-            {71, 1}, {56, 1}, {59, 2}, {60, 1}, {63, 3}, {64, 4}, {40, 1}, {41, 2}, {42, 3},
-            {34, 1}, {37, 2}, {38, 3}, {24, 1}, {45, 2}, {46, 3}}},
-    {1204,
-     {{13, 1}, {69, 2}, {70, 3}, {66, 1}, {38, 1}, {97, 2}, {27, 1}, {91, 2}, {92, 3}, {31, 1},
-      {67, 2}, {36, 1}, {83, 1}, {30, 1}, {34, 1}, {62, 1}, {68, 2}, {50, 1}, {96, 1}, {47, 1}}},
-    {1205, {{30, 1}, {31, 2}}},
-    {1253, {{15, 4}}},
-    {1254,
-     {{85, 1},  {86, 2},  {55, 2},  {104, 3}, {110, 4}, {137, 5}, {91, 1},  {121, 3}, {124, 1},
-      {133, 1}, {134, 3}, {113, 1}, {81, 1},  {80, 2},  {82, 3},  {83, 4},  {97, 4},  {98, 1},
-      {120, 2}, {94, 1},  {96, 2},  {77, 1},  {135, 1}, {52, 2},  {54, 4},  {103, 6}, {51, 7},
-      {53, 10}, {138, 9}, {111, 6}, {112, 7}, {114, 8}, {108, 6}, {109, 7}, {142, 2}, {150, 2},
-      {90, 2},  {72, 11}, {74, 12}, {126, 1}, {32, 1},  {29, 1},  {22, 1},  {36, 1},  {10, 1},
-      {13, 2},  {14, 3},  {6, 1},   {11, 2},  {17, 1},  {31, 1},  {38, 2},  {39, 3},  {119, 1}}},
-    {1255, {{2, 1}, {3, 2}, {5, 1}, {8, 1}}},
-    {1256, {{16, 1}, {18, 2}, {19, 3}}},
-    {1264, {{26, 1},  {70, 1},  {120, 1}, {80, 1},  {119, 2}, {121, 3}, {122, 4},
-            {71, 4},  {72, 1},  {86, 2},  {102, 1}, {113, 1}, {114, 3}, {115, 5},
-            {107, 5}, {108, 6}, {109, 7}, {112, 7}, {28, 1},  {82, 1},  {87, 2}}},
-    {1266, {{218, 1}, {219, 2}, {220, 3}, {153, 1}, {154, 2}, {158, 1}}},
-    {1268,
-     {{15, 1},
-      {54, 1},
-      {56, 2},
-      {58, 1},
-      {59, 2},
-      {21, 1},
-      {38, 2},
-      {9, 1},
-      {19, 2},
-      {52, 3},
-      {8, 1}}},
-    {1269, {{13, 1}, {20, 2}, {14, 1}, {25, 1}, {21, 1}, {23, 1}, {24, 1}}},
-    {1303, {{1, 1}, {3, 2}, {4, 3}}},
-    {1308, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {1325, {{5, 1}}},
-    {1369,
-     {{51, 1},
-      {56, 1},
-      {41, 1},
-      {15, 1},
-      {37, 1},
-      {35, 1},
-      {31, 1},
-      {17, 1},
-      {22, 2},
-      {49, 1},
-      {24, 1},
-      {25, 2},
-      {45, 1},
-      {53, 1},
-      {1, 1}}},
-    {1370, {{61, 1}, {62, 1}, {31, 1}, {41, 2}, {23, 1}, {8, 1},  {35, 2}, {71, 1}, {14, 1},
-            {73, 1}, {17, 1}, {21, 2}, {11, 1}, {20, 2}, {46, 1}, {30, 1}, {40, 1}, {26, 1},
-            {34, 1}, {36, 2}, {22, 1}, {65, 1}, {66, 1}, {74, 1}, {67, 1}}},
-    {1372, {{23, 1}, {33, 1}, {32, 1}, {29, 1}, {37, 1}, {3, 1}, {10, 1}}},
-    {1373, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {1387,
-     {{1, 2},   {2, 3},   {3, 4},   {29, 1},  {16, 1},  {17, 2},  {80, 2},  {79, 1},  {35, 1},
-      {36, 2},  {76, 1},  {70, 1},  {68, 1},  {69, 2},  {64, 1},  {73, 2},  {98, 1},  {95, 1},
-      {96, 2},  {97, 3},  {91, 1},  {92, 2},  {99, 3},  {125, 1}, {126, 2}, {127, 3}, {119, 1},
-      {122, 2}, {123, 3}, {109, 1}, {130, 2}, {131, 3}, {101, 1}, {102, 2}}},
-    {1409,
-     {{53, 1},  {54, 2},  {89, 1},  {92, 2},  {99, 3},  {105, 1}, {107, 3}, {109, 4}, {96, 3},
-      {97, 4},  {100, 5}, {102, 1}, {104, 2}, {106, 3}, {91, 1},  {93, 2},  {98, 1},  {103, 3},
-      {108, 4}, {86, 3},  {94, 4},  {110, 5}, {185, 1}, {125, 1}, {129, 2}, {38, 1},  {39, 2},
-      {40, 3},  {34, 1},  {35, 2},  {42, 3},  {76, 1},  {77, 2},  {78, 3},  {70, 1},  {73, 2},
-      {74, 3},  {60, 1},  {81, 2},  {82, 3},  {44, 1},  {45, 2},  {133, 1}, {128, 1}, {130, 2},
-      {134, 3}, {120, 1}, {122, 1}, {123, 2}, {119, 1}, {115, 1}, {118, 2}, {121, 1}, {131, 2},
-      {132, 3}, {26, 1},  {28, 2},  {30, 3},  {16, 1},  {19, 2},  {22, 3},  {14, 1},  {20, 2},
-      {24, 3},  {12, 1},  {17, 2},  {18, 3},  {9, 1},   {10, 2},  {13, 3},  {5, 1},   {21, 2},
-      {27, 3},  {11, 1},  {23, 2},  {29, 3},  {189, 1}, {190, 2}, {191, 3}}},
-    {1414, {{44, 1}}},
-    {1416, {{5, 1}, {6, 2}}},
-    {1430,
-     {{104, 1},
-      {114, 3},
-      {115, 3},
-      {90, 3},
-      {97, 4},
-      {100, 1},
-      {54, 1},
-      {55, 2},
-      {73, 3},
-      {92, 1},
-      {98, 2},
-      {94, 1},
-      {95, 2},
-      {125, 1},
-      {133, 1},
-      {135, 2},
-      {136, 1},
-      {134, 1}}},
-    {1451,
-     {{26, 1},  {28, 2},  {30, 3},  {16, 1},  {19, 2},  {22, 3},  {14, 1},  {20, 2},  {24, 3},
-      {12, 1},  {17, 2},  {18, 3},  {9, 1},   {10, 2},  {13, 3},  {5, 1},   {21, 2},  {27, 3},
-      {11, 1},  {23, 2},  {29, 3},  {183, 1}, {172, 1}, {176, 2}, {38, 1},  {39, 2},  {40, 3},
-      {34, 1},  {35, 2},  {42, 3},  {214, 1}, {215, 2}, {68, 1},  {69, 2},  {70, 3},  {62, 1},
-      {65, 2},  {66, 3},  {52, 1},  {73, 2},  {74, 3},  {44, 1},  {45, 2},  {180, 1}, {175, 1},
-      {177, 2}, {181, 3}, {167, 1}, {169, 1}, {170, 2}, {166, 1}, {162, 1}, {165, 2}, {168, 1},
-      {178, 2}, {179, 3}, {190, 1}, {206, 1}, {199, 1}, {205, 1}, {194, 1}, {191, 1}, {233, 1},
-      {234, 2}, {235, 3}, {185, 1}, {85, 2},  {81, 2},  {102, 1}, {104, 2}, {107, 3}, {113, 5}}},
-    {1496, {{19, 1}, {18, 1}}},
-    {1557, {{34, 1}, {44, 2}, {17, 1}, {45, 1}, {15, 1}, {29, 2}, {46, 3}, {57, 1}, {91, 1},
-            {22, 1}, {28, 1}, {42, 2}, {61, 3}, {30, 1}, {53, 1}, {20, 1}, {47, 1}, {65, 1},
-            {62, 1}, {59, 1}, {26, 1}, {23, 1}, {40, 1}, {82, 1}, {90, 1}}},
-    {1560,
-     {{49, 1},
-      {50, 2},
-      {56, 1},
-      {58, 2},
-      {61, 3},
-      {53, 1},
-      {54, 2},
-      {57, 1},
-      {59, 2},
-      {60, 3},
-      {12, 1},
-      {14, 2},
-      {15, 3},
-      {10, 1}}},
-    {1561, {{48, 1}, {7, 1},  {28, 1}, {34, 1}, {31, 1}, {54, 1}, {44, 1}, {36, 1},
-            {10, 1}, {41, 1}, {27, 1}, {3, 1},  {45, 1}, {12, 1}, {32, 1}, {61, 1},
-            {50, 1}, {47, 1}, {38, 1}, {64, 1}, {62, 1}, {35, 1}}},
-    {1562, {{3, 1}}},
-    {1565, {{48, 1}, {11, 1}, {31, 1}, {37, 1}, {34, 1}, {50, 1}, {54, 1},
-            {14, 1}, {41, 1}, {30, 1}, {7, 1},  {45, 1}, {16, 1}, {35, 1},
-            {65, 1}, {49, 1}, {47, 1}, {38, 1}, {68, 1}, {66, 1}, {53, 1}}},
-    {1570,
-     {{52, 1},
-      {34, 1},
-      {36, 2},
-      {43, 1},
-      {21, 1},
-      {37, 1},
-      {26, 1},
-      {47, 2},
-      {12, 1},
-      {14, 2},
-      {54, 1},
-      {8, 1},
-      {51, 2},
-      {56, 1},
-      {28, 1},
-      {53, 2}}},
-    {1573, {{14, 1}, {11, 1}, {12, 2}, {13, 3}, {7, 1},  {8, 2},  {15, 3},
-            {42, 1}, {43, 2}, {44, 3}, {36, 1}, {39, 2}, {40, 3}, {26, 1},
-            {47, 2}, {48, 3}, {17, 1}, {18, 2}, {57, 1}, {60, 2}, {59, 1}}},
-    {1574,
-     {{26, 1},  {28, 2},  {30, 3},  {16, 1},  {19, 2},  {22, 3},  {14, 1},  {20, 2},  {24, 3},
-      {12, 1},  {17, 2},  {18, 3},  {9, 1},   {10, 2},  {13, 3},  {5, 1},   {21, 2},  {27, 3},
-      {11, 1},  {23, 2},  {29, 3},  {154, 1}, {156, 2}, {146, 1}, {138, 1}, {140, 2}, {145, 3},
-      {155, 1}, {150, 1}, {153, 2}, {152, 1}, {147, 1}, {148, 2}, {141, 1}, {149, 2}, {151, 3},
-      {131, 1}, {128, 1}, {129, 2}, {159, 1}, {160, 2}, {161, 3}}},
-    {1577, {{1, 1}, {3, 2}, {4, 3}}},
-    {1578,
-     {{49, 1},
-      {93, 1},
-      {46, 1},
-      {74, 2},
-      {62, 1},
-      {70, 1},
-      {83, 1},
-      {64, 1},
-      {87, 1},
-      {72, 1},
-      {61, 1},
-      {69, 1},
-      {80, 1},
-      {65, 1},
-      {85, 1},
-      {76, 1},
-      {58, 1},
-      {88, 1}}},
-    {1580,
-     {{33, 1},
-      {34, 2},
-      {32, 1},
-      {31, 1},
-      {46, 1},
-      {21, 1},
-      {28, 1},
-      {39, 2},
-      {5, 1},
-      {7, 2},
-      {53, 1},
-      {11, 1},
-      {30, 2},
-      {43, 1}}},
-    {1583,
-     {{14, 1},
-      {18, 2},
-      {22, 1},
-      {17, 1},
-      {19, 2},
-      {23, 3},
-      {9, 1},
-      {11, 1},
-      {12, 2},
-      {8, 1},
-      {4, 1},
-      {7, 2},
-      {10, 1},
-      {20, 2},
-      {21, 3},
-      {38, 1},
-      {39, 2},
-      {40, 3}}},
-    {1584,
-     {{35, 1},
-      {36, 2},
-      {37, 1},
-      {29, 1},
-      {19, 1},
-      {28, 1},
-      {42, 2},
-      {9, 1},
-      {12, 2},
-      {22, 1},
-      {46, 2},
-      {31, 1}}},
-    {1587, {{6, 1}}},
-    {1588, {{10, 1}, {13, 2}, {12, 1}}},
-    {1589, {{37, 1}, {39, 2}, {43, 1}, {31, 1}, {44, 2}, {50, 3}, {7, 1},  {40, 1},
-            {30, 1}, {53, 2}, {10, 1}, {12, 2}, {47, 1}, {13, 1}, {48, 2}, {27, 1},
-            {29, 2}, {67, 3}, {63, 1}, {64, 1}, {65, 1}, {66, 2}, {33, 1}}},
-    {1592,
-     {{33, 1}, {46, 2}, {40, 1}, {42, 2}, {45, 1}, {38, 1}, {41, 2}, {36, 1}, {18, 1}, {52, 1},
-      {20, 1}, {22, 2}, {9, 1},  {37, 2}, {57, 1}, {55, 1}, {32, 1}, {61, 2}, {43, 1}, {47, 2}}},
-    {1594,
-     {{18, 1},
-      {30, 1},
-      {13, 1},
-      {20, 2},
-      {31, 1},
-      {21, 1},
-      {27, 1},
-      {7, 1},
-      {8, 2},
-      {9, 3},
-      {29, 1},
-      {28, 1}}},
-    {1595, {{69, 1},  {70, 2}, {72, 3},  {71, 1},  {85, 1},  {82, 1},  {83, 2},  {84, 3},
-            {78, 1},  {79, 2}, {86, 3},  {111, 1}, {112, 2}, {113, 3}, {105, 1}, {108, 2},
-            {109, 3}, {96, 1}, {116, 2}, {117, 3}, {88, 1},  {89, 2}}},
-    {1596,
-     {{26, 1},
-      {5, 1},
-      {20, 1},
-      {30, 1},
-      {25, 1},
-      {32, 1},
-      {28, 1},
-      {45, 1},
-      {6, 1},
-      {13, 2},
-      {14, 3},
-      {10, 1},
-      {17, 2},
-      {27, 1}}},
-    {1597, {{3, 1}, {5, 2}}},
-    {1598,
-     {{16, 1},
-      {24, 1},
-      {8, 1},
-      {28, 1},
-      {25, 1},
-      {17, 1},
-      {31, 2},
-      {15, 1},
-      {29, 2},
-      {26, 1},
-      {30, 1}}},
-    {1599, {{12, 1}, {17, 1}, {19, 2}, {4, 1}, {2, 1}, {5, 2}}},
-    {1601, {{3, 1}}},
-    {1605,
-     {{76, 1},
-      {60, 1},
-      {61, 2},
-      {12, 1},
-      {53, 2},
-      {72, 1},
-      {70, 1},
-      {66, 1},
-      {68, 2},
-      {59, 1},
-      {63, 2},
-      {42, 1},
-      {3, 1},
-      {6, 2},
-      {9, 1}}},
-    {1606, {{11, 1}, {12, 2}, {18, 1}, {3, 1}, {15, 1}}},
-    {1607,
-     {{37, 1},  {38, 2},  {46, 1},  {44, 1},  {47, 2},  {48, 1},  {54, 1},  {57, 2},  {64, 3},
-      {70, 1},  {72, 3},  {74, 4},  {61, 3},  {62, 4},  {65, 5},  {67, 1},  {69, 2},  {71, 3},
-      {56, 1},  {58, 2},  {63, 1},  {68, 3},  {73, 4},  {51, 3},  {59, 4},  {75, 5},  {100, 1},
-      {84, 1},  {189, 1}, {93, 1},  {99, 1},  {88, 1},  {85, 1},  {78, 1},  {114, 1}, {112, 1},
-      {115, 2}, {116, 3}, {124, 1}, {125, 2}, {126, 3}, {127, 1}, {120, 1}, {121, 2}, {128, 3},
-      {130, 1}, {131, 2}, {154, 1}, {155, 2}, {156, 3}, {148, 1}, {151, 2}, {152, 3}, {138, 1},
-      {159, 2}, {160, 3}, {169, 1}, {179, 2}, {187, 1}, {188, 2}, {184, 1}, {185, 1}, {167, 1}}},
-    {1615, {{3, 1}}},
-    {1616, {{8, 1}}},
-    {1621,
-     {{17, 1},
-      {21, 2},
-      {25, 1},
-      {20, 1},
-      {22, 2},
-      {26, 3},
-      {12, 1},
-      {14, 1},
-      {15, 2},
-      {11, 1},
-      {7, 1},
-      {10, 2},
-      {13, 1},
-      {23, 2},
-      {24, 3},
-      {52, 1},
-      {53, 2},
-      {54, 3},
-      {32, 1}}},
-    {1626, {{13, 1}, {10, 1}, {14, 1}, {4, 1}, {5, 2}, {7, 3}}},
-    {1627,
-     {{133, 1}, {135, 2}, {136, 3}, {12, 1},  {9, 1},   {10, 2},  {11, 3},  {5, 1},   {6, 2},
-      {13, 3},  {40, 1},  {41, 2},  {42, 3},  {34, 1},  {37, 2},  {38, 3},  {24, 1},  {45, 2},
-      {46, 3},  {15, 1},  {16, 2},  {131, 1}, {127, 1}, {128, 2}, {130, 3}, {123, 1}, {125, 2}}},
-    {1628,
-     {{15, 1},
-      {5, 1},
-      {24, 1},
-      {20, 1},
-      {26, 1},
-      {13, 1},
-      {14, 2},
-      {6, 1},
-      {7, 2},
-      {19, 3},
-      {28, 1}}},
-    {1629, {{56, 1}, {52, 2}, {106, 1}, {89, 1}, {99, 1}, {98, 1}, {80, 1}, {60, 2}}},
-    {1641, {{2, 1}}},
-    {1719,
-     {{22, 1},
-      {24, 1},
-      {9, 1},
-      {14, 2},
-      {15, 3},
-      {5, 1},
-      {16, 2},
-      {26, 3},
-      {13, 1},
-      {19, 1},
-      {20, 2},
-      {21, 3}}},
-    {1720, {{1, 1}, {5, 2}, {7, 1}, {4, 1}}},
-    {1721, {{7, 1},  {8, 2},  {18, 1}, {19, 2}, {20, 3}, {21, 1}, {14, 1},
-            {15, 2}, {22, 3}, {24, 1}, {25, 2}, {49, 1}, {50, 2}, {51, 3},
-            {43, 1}, {46, 2}, {47, 3}, {33, 1}, {54, 2}, {55, 3}, {78, 1}}},
-    {1733, {{41, 1}}},
-    {1735, {{70, 1}, {27, 1}, {28, 2}, {29, 3}, {23, 1}, {24, 2}, {31, 3}, {61, 1},
-            {62, 2}, {63, 3}, {55, 1}, {58, 2}, {59, 3}, {46, 1}, {66, 2}, {67, 3},
-            {40, 1}, {41, 2}, {33, 1}, {34, 2}, {7, 1},  {1, 1}}},
-    {1753, {{24, 1}, {26, 2}, {28, 3}, {14, 1}, {17, 2}, {20, 3}, {12, 1}, {18, 2}, {22, 3},
-            {10, 1}, {15, 2}, {16, 3}, {7, 1},  {8, 2},  {11, 3}, {3, 1},  {19, 2}, {25, 3},
-            {9, 1},  {21, 2}, {27, 3}, {59, 1}, {64, 2}, {65, 3}, {56, 1}, {57, 2}, {60, 3},
-            {58, 1}, {66, 2}, {46, 1}, {47, 2}, {53, 3}, {41, 1}, {63, 2}, {37, 1}, {49, 2},
-            {61, 3}, {48, 1}, {51, 2}, {52, 3}, {42, 1}, {44, 2}, {73, 1}}},
-    {1756, {{56, 1}, {61, 2}, {62, 3}, {53, 1}, {54, 2}, {57, 3}, {55, 1},
-            {63, 2}, {43, 1}, {44, 2}, {50, 3}, {38, 1}, {60, 2}, {34, 1},
-            {46, 2}, {58, 3}, {45, 1}, {48, 2}, {49, 3}, {39, 1}, {41, 2}}},
-    {1764, {{66, 1}, {63, 1}, {64, 2}, {65, 3}, {59, 1}, {60, 2}, {67, 3}, {93, 1}, {94, 2},
-            {95, 3}, {87, 1}, {90, 2}, {91, 3}, {78, 1}, {98, 2}, {99, 3}, {69, 1}, {70, 2},
-            {53, 1}, {47, 1}, {51, 2}, {54, 3}, {44, 1}, {45, 2}, {52, 3}, {39, 1}, {37, 1},
-            {42, 1}, {43, 2}, {48, 3}, {33, 1}, {49, 2}, {55, 3}}},
-    {1772, {{110, 1}, {106, 1}, {107, 2}, {109, 3}, {102, 1}, {104, 2}, {143, 1}, {140, 1},
-            {141, 2}, {142, 3}, {136, 1}, {137, 2}, {144, 3}, {169, 1}, {170, 2}, {171, 3},
-            {163, 1}, {166, 2}, {167, 3}, {154, 1}, {174, 2}, {175, 3}, {146, 1}, {147, 2}}},
-    {1773,
-     {{72, 1},
-      {66, 1},
-      {70, 2},
-      {73, 3},
-      {63, 1},
-      {64, 2},
-      {71, 3},
-      {58, 1},
-      {56, 1},
-      {61, 1},
-      {62, 2},
-      {67, 3},
-      {52, 1},
-      {68, 2},
-      {74, 3}}},
-    {1774,
-     {{27, 1},
-      {21, 1},
-      {25, 2},
-      {28, 3},
-      {18, 1},
-      {19, 2},
-      {26, 3},
-      {13, 1},
-      {11, 1},
-      {16, 1},
-      {17, 2},
-      {22, 3},
-      {7, 1},
-      {23, 2},
-      {54, 3}}},
-    {1862, {{2, 1}}},
-    {1872, {{10, 1}, {11, 2}, {12, 3}, {13, 1}, {6, 1}, {7, 2}, {14, 3}, {16, 1}, {17, 2}}},
-    {1877,
-     {{88, 1},
-      {87, 1},
-      {13, 1},
-      {11, 1},
-      {14, 2},
-      {7, 1},
-      {68, 1},
-      {75, 1},
-      {49, 1},
-      {48, 1},
-      {41, 1},
-      {51, 1}}},
-    {1879,
-     {{9, 1},
-      {10, 2},
-      {11, 3},
-      {12, 1},
-      {5, 1},
-      {6, 2},
-      {13, 3},
-      {15, 1},
-      {16, 2},
-      {39, 1},
-      {40, 2},
-      {41, 3},
-      {33, 1},
-      {36, 2},
-      {37, 3},
-      {24, 1},
-      {44, 2},
-      {45, 3}}},
-    {1950, {{17, 1}, {18, 2}, {19, 3}, {20, 1}, {13, 1}, {14, 2}, {21, 3}, {23, 1}, {24, 2}}},
-    {2209, {{11, 1}, {3, 1}, {5, 3}, {23, 2}, {19, 2}}},
-    {2212, {{80, 1}, {12, 1}, {9, 1},  {10, 2}, {11, 3}, {60, 1}, {74, 2}, {77, 3}, {65, 1},
-            {67, 2}, {5, 1},  {6, 2},  {13, 3}, {39, 1}, {40, 2}, {41, 3}, {33, 1}, {36, 2},
-            {37, 3}, {24, 1}, {44, 2}, {45, 3}, {15, 1}, {16, 2}, {68, 1}, {70, 2}, {78, 3},
-            {63, 1}, {69, 2}, {75, 3}, {79, 1}, {72, 1}, {73, 2}, {71, 1}}},
-    {2280, {{29, 1}, {27, 1}, {21, 1}}},
-    {2282,
-     {{27, 1},
-      {53, 1},
-      {29, 1},
-      {30, 2},
-      {6, 1},
-      {34, 1},
-      {13, 1},
-      {46, 1},
-      {49, 2},
-      {47, 1},
-      {36, 1},
-      {48, 2},
-      {57, 1}}},
-    {2283, {{8, 1}}},
-    {2284, {{71, 1}, {19, 1}, {23, 2}, {27, 1}, {22, 1}, {24, 2}, {28, 3}, {14, 1}, {16, 1},
-            {17, 2}, {13, 1}, {9, 1},  {12, 2}, {15, 1}, {25, 2}, {26, 3}, {74, 1}, {75, 2},
-            {76, 3}, {50, 1}, {67, 1}, {68, 2}, {69, 3}, {54, 1}, {58, 2}, {56, 1}, {57, 2}}},
-    {2290,
-     {{34, 1},
-      {36, 1},
-      {27, 1},
-      {31, 1},
-      {32, 2},
-      {28, 1},
-      {14, 1},
-      {52, 1},
-      {6, 1},
-      {29, 1},
-      {44, 1},
-      {47, 2},
-      {45, 1},
-      {38, 1},
-      {46, 2},
-      {59, 1}}},
-    {2292,
-     {{51, 1},
-      {52, 2},
-      {10, 1},
-      {22, 2},
-      {16, 1},
-      {20, 2},
-      {12, 2},
-      {17, 3},
-      {18, 1},
-      {19, 2},
-      {9, 1},
-      {13, 2}}},
-    {2298, {{56, 1}, {58, 1}, {3, 1},  {12, 1}, {34, 1}, {49, 2}, {5, 1},  {14, 1}, {19, 2},
-            {64, 3}, {39, 1}, {40, 2}, {54, 1}, {51, 1}, {61, 1}, {86, 2}, {30, 1}, {50, 2},
-            {52, 1}, {72, 1}, {75, 1}, {68, 1}, {69, 1}, {20, 1}, {42, 1}, {60, 1}, {78, 1}}},
-    {2300, {{58, 1}, {13, 1}, {67, 2}, {72, 3}, {37, 1}, {82, 2}, {33, 1}, {70, 2}, {73, 3},
-            {63, 1}, {24, 1}, {62, 2}, {34, 1}, {64, 2}, {18, 1}, {27, 1}, {84, 1}, {55, 1},
-            {66, 2}, {68, 3}, {54, 1}, {65, 1}, {69, 1}, {71, 1}, {80, 1}, {83, 2}}},
-    {2324, {{41, 1}, {29, 1}, {40, 1}, {45, 1}, {34, 1}, {35, 2}, {30, 1}, {32, 1}}},
-    {2354,
-     {{47, 3},  {48, 4},  {27, 4},  {74, 6},  {77, 7},  {86, 9},  {52, 1},  {106, 3}, {110, 1},
-      {111, 3}, {116, 2}, {102, 1}, {122, 1}, {59, 1},  {101, 2}, {103, 3}, {104, 4}, {123, 1},
-      {65, 1},  {98, 2},  {125, 1}, {24, 2},  {26, 4},  {67, 6},  {23, 8},  {25, 11}, {55, 10},
-      {56, 11}, {76, 12}, {82, 14}, {83, 15}, {85, 16}, {78, 14}, {80, 15}, {84, 16}, {63, 16},
-      {79, 26}, {51, 13}, {71, 14}, {72, 15}, {46, 15}, {53, 16}, {62, 17}, {90, 1},  {118, 1},
-      {2, 1},   {7, 2},   {9, 3},   {8, 1},   {92, 1},  {97, 1},  {3, 1},   {96, 1},  {16, 1},
-      {18, 1},  {12, 1},  {60, 2},  {61, 1},  {89, 1}}},
-    {2356, {{2, 4}}},
-    {2357, {{1, 1}, {3, 2}, {4, 3}, {31, 1}}},
-    {2360, {{64, 1}, {66, 2}, {67, 1}}},
-    {2363, {{1, 1}, {3, 2}, {4, 3}}},
-    {2371, {{27, 1}, {32, 1}, {33, 2}}},
-    {2372, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {2373, {{2, 1}, {3, 2}, {5, 3}, {10, 1}, {7, 1}, {11, 2}}},
-    {2374,
-     {{20, 1},
-      {26, 1},
-      {11, 1},
-      {22, 1},
-      {5, 1},
-      {21, 1},
-      {1, 1},
-      {7, 2},
-      {25, 3},
-      {16, 1},
-      {24, 2},
-      {9, 1}}},
-    {2375, {{1, 1}, {3, 2}, {7, 3}, {17, 1}, {16, 1}}},
-    {2406,
-     {{29, 1},
-      {41, 1},
-      {42, 1},
-      {24, 1},
-      {32, 1},
-      {4, 1},
-      {11, 1},
-      {43, 2},
-      {13, 1},
-      {9, 1},
-      {15, 2}}},
-    {2407,
-     {{35, 1},
-      {32, 1},
-      {33, 2},
-      {34, 3},
-      {28, 1},
-      {29, 2},
-      {36, 3},
-      {62, 1},
-      {63, 2},
-      {64, 3},
-      {56, 1},
-      {59, 2},
-      {60, 3},
-      {47, 1},
-      {67, 2},
-      {68, 3},
-      {38, 1},
-      {39, 2}}},
-    {2423,
-     {{21, 1},
-      {22, 2},
-      {5, 1},
-      {13, 1},
-      {9, 1},
-      {10, 2},
-      {27, 1},
-      {26, 1},
-      {32, 1},
-      {8, 1},
-      {11, 2}}},
-    {2426,
-     {{82, 1},
-      {79, 1},
-      {80, 2},
-      {81, 3},
-      {75, 1},
-      {76, 2},
-      {83, 3},
-      {108, 1},
-      {109, 2},
-      {110, 3},
-      {102, 1},
-      {105, 2},
-      {106, 3},
-      {93, 1},
-      {113, 2},
-      {114, 3},
-      {85, 1},
-      {86, 2}}},
-    {2438, {{9, 1}, {3, 1}, {4, 1}, {5, 2}, {6, 3}, {29, 1}, {30, 1}, {33, 1}}},
-    {2445, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {2525, {{21, 1}, {24, 2}, {26, 3}, {30, 1}, {28, 1}, {29, 1}, {13, 1}, {23, 1},
-            {10, 1}, {22, 1}, {19, 1}, {25, 2}, {27, 3}, {3, 1},  {68, 1}, {69, 2},
-            {70, 3}, {71, 1}, {64, 1}, {65, 2}, {72, 3}, {74, 1}, {75, 2}, {57, 1}}},
-    {2526,
-     {{82, 1}, {71, 1}, {72, 2}, {60, 1}, {94, 1}, {83, 1}, {84, 2}, {90, 3}, {80, 1}, {93, 1},
-      {96, 1}, {86, 1}, {89, 1}, {95, 2}, {66, 1}, {64, 1}, {70, 2}, {8, 1},  {68, 2}, {36, 1}}},
-    {2527, {{1, 1}, {3, 2}, {4, 3}, {6, 1}, {26, 1}, {24, 1}, {29, 1}, {8, 1}}},
-    {2535,
-     {{33, 1},
-      {34, 2},
-      {19, 1},
-      {16, 1},
-      {17, 2},
-      {20, 3},
-      {18, 1},
-      {8, 1},
-      {11, 2},
-      {120, 1},
-      {118, 1},
-      {96, 1},
-      {129, 1},
-      {131, 1},
-      {145, 1},
-      {126, 1},
-      {142, 2},
-      {147, 1}}},
-    {2537,
-     {{10, 1},
-      {65, 1},
-      {84, 1},
-      {93, 2},
-      {87, 1},
-      {90, 1},
-      {99, 1},
-      {92, 1},
-      {31, 1},
-      {27, 1},
-      {8, 1},
-      {51, 1},
-      {64, 2},
-      {58, 1},
-      {62, 1}}},
-    {2539, {{3, 1},  {4, 2},  {8, 1},  {10, 2}, {11, 3}, {24, 1}, {21, 1}, {22, 2},
-            {23, 3}, {17, 1}, {18, 2}, {25, 3}, {51, 1}, {52, 2}, {53, 3}, {45, 1},
-            {48, 2}, {49, 3}, {36, 1}, {56, 2}, {57, 3}, {27, 1}, {28, 2}}},
-    {2553, {{13, 1}}},
-    {2558,
-     {{22, 1},
-      {25, 2},
-      {27, 3},
-      {31, 1},
-      {29, 1},
-      {30, 1},
-      {14, 1},
-      {24, 1},
-      {11, 1},
-      {23, 1},
-      {20, 1},
-      {26, 2},
-      {28, 3},
-      {4, 1}}},
-    {2568,
-     {{174, 1}, {178, 2}, {63, 1},  {64, 2},  {65, 3},  {66, 1},  {24, 1},  {26, 2},  {59, 1},
-      {60, 2},  {67, 3},  {147, 1}, {187, 1}, {190, 2}, {191, 3}, {186, 1}, {189, 2}, {192, 3},
-      {148, 1}, {144, 1}, {156, 1}, {151, 1}, {19, 1},  {22, 2},  {23, 3},  {11, 1},  {21, 2},
-      {14, 1},  {20, 2},  {15, 1},  {16, 2},  {8, 1},   {13, 2},  {17, 3},  {69, 1},  {70, 2},
-      {182, 1}, {177, 1}, {179, 2}, {183, 3}, {169, 1}, {171, 1}, {172, 2}, {168, 1}, {164, 1},
-      {167, 2}, {170, 1}, {180, 2}, {181, 3}, {205, 1}, {206, 2}, {207, 3}}},
-    {2572,
-     {{28, 3},  {29, 5},  {8, 6},   {50, 7},  {56, 8},  {62, 9},  {87, 1},  {34, 1},  {76, 3},
-      {90, 1},  {96, 1},  {97, 2},  {41, 1},  {72, 1},  {71, 2},  {73, 3},  {74, 4},  {91, 1},
-      {47, 1},  {68, 2},  {93, 1},  {5, 2},   {7, 4},   {48, 6},  {4, 8},   {6, 11},  {37, 13},
-      {38, 14}, {55, 15}, {63, 14}, {64, 15}, {65, 16}, {57, 16}, {59, 26}, {61, 27}, {45, 25},
-      {58, 26}, {33, 16}, {51, 17}, {52, 18}, {27, 18}, {35, 19}, {44, 20}, {83, 1}}},
-    {2573, {{2, 4}}},
-    {2574,
-     {{61, 1}, {58, 1}, {59, 2}, {62, 3}, {71, 1}, {72, 1}, {73, 2}, {70, 1}, {50, 1}, {53, 2},
-      {12, 1}, {74, 1}, {75, 2}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},  {13, 3}, {80, 1},
-      {81, 2}, {39, 1}, {40, 2}, {41, 3}, {33, 1}, {36, 2}, {37, 3}, {24, 1}, {44, 2}, {45, 3},
-      {15, 1}, {16, 2}, {60, 1}, {69, 2}, {76, 3}, {83, 1}, {84, 2}, {85, 3}}},
-    {2597, {{53, 1}, {69, 1}, {68, 1}, {73, 1}, {62, 1}, {54, 1}, {48, 1}, {9, 1},  {10, 2},
-            {11, 3}, {12, 1}, {5, 1},  {6, 2},  {13, 3}, {15, 1}, {16, 2}, {39, 1}, {40, 2},
-            {41, 3}, {33, 1}, {36, 2}, {37, 3}, {24, 1}, {44, 2}, {45, 3}}},
-    {2618, {{6, 1}, {5, 1}, {2, 1}}},
-    {2657, {{76, 1}, {22, 1}, {25, 2}, {27, 3}, {31, 1}, {29, 1}, {30, 1}, {14, 1}, {24, 1},
-            {11, 1}, {23, 1}, {20, 1}, {26, 2}, {28, 3}, {4, 1},  {69, 1}, {70, 2}, {83, 1},
-            {86, 2}, {89, 3}, {85, 1}, {87, 2}, {88, 3}, {67, 1}, {68, 2}, {65, 1}, {66, 2},
-            {78, 1}, {81, 2}, {74, 1}, {80, 2}, {72, 1}, {79, 2}, {36, 1}}},
-    {2658, {{48, 1}, {49, 2}, {50, 3}, {42, 1}, {45, 2}, {46, 3}, {33, 1}, {53, 2}, {54, 3}}},
-    {2662, {{4, 1}}},
-    {2679,
-     {{86, 1},  {87, 2},  {88, 3},  {89, 1},  {82, 1},  {83, 2},  {90, 3},  {115, 1}, {116, 2},
-      {117, 3}, {109, 1}, {112, 2}, {113, 3}, {100, 1}, {120, 2}, {121, 3}, {92, 1},  {93, 2},
-      {20, 1},  {23, 2},  {25, 3},  {29, 1},  {27, 1},  {28, 1},  {12, 1},  {22, 1},  {77, 1},
-      {21, 1},  {18, 1},  {24, 2},  {26, 3},  {3, 1},   {73, 3},  {71, 4}}},
-    {2691, {{24, 1}, {26, 2}, {28, 3}, {14, 1}, {17, 2}, {20, 3}, {12, 1},
-            {18, 2}, {22, 3}, {10, 1}, {15, 2}, {16, 3}, {7, 1},  {8, 2},
-            {11, 3}, {3, 1},  {19, 2}, {25, 3}, {9, 1},  {21, 2}, {27, 3}}},
-    {2699, {{30, 1}, {35, 2}, {36, 3}, {27, 1}, {28, 2}, {31, 3}, {29, 1}, {37, 2},
-            {17, 1}, {18, 2}, {24, 3}, {12, 1}, {34, 2}, {8, 1},  {20, 2}, {32, 3},
-            {19, 1}, {22, 2}, {23, 3}, {13, 1}, {15, 2}, {66, 1}, {68, 2}}},
-    {2701,
-     {{45, 1}, {49, 2}, {53, 1}, {48, 1}, {50, 2}, {54, 3}, {40, 1},  {42, 1},  {43, 2}, {39, 1},
-      {35, 1}, {38, 2}, {41, 1}, {51, 2}, {52, 3}, {25, 1}, {27, 2},  {29, 3},  {15, 1}, {18, 2},
-      {21, 3}, {13, 1}, {19, 2}, {23, 3}, {11, 1}, {16, 2}, {17, 3},  {8, 1},   {9, 2},  {12, 3},
-      {4, 1},  {20, 2}, {26, 3}, {10, 1}, {22, 2}, {28, 3}, {112, 1}, {113, 2}, {114, 3}}},
-    {2703,
-     {{14, 1}, {18, 2}, {22, 1}, {17, 1}, {19, 2}, {23, 3}, {9, 1},  {11, 1}, {12, 2}, {8, 1},
-      {4, 1},  {7, 2},  {10, 1}, {20, 2}, {21, 3}, {80, 1}, {82, 2}, {84, 3}, {70, 1}, {73, 2},
-      {76, 3}, {68, 1}, {74, 2}, {78, 3}, {66, 1}, {71, 2}, {72, 3}, {63, 1}, {64, 2}, {67, 3},
-      {59, 1}, {75, 2}, {81, 3}, {65, 1}, {77, 2}, {83, 3}, {47, 1}, {50, 2}, {52, 3}, {56, 1},
-      {54, 1}, {55, 1}, {39, 1}, {49, 1}, {36, 1}, {48, 1}, {45, 1}, {51, 2}, {53, 3}, {29, 1}}},
-    {2705,
-     {{27, 1},
-      {7, 1},
-      {21, 2},
-      {24, 3},
-      {12, 1},
-      {14, 2},
-      {15, 1},
-      {17, 2},
-      {25, 3},
-      {10, 1},
-      {16, 2},
-      {22, 3},
-      {26, 1},
-      {19, 1},
-      {20, 2},
-      {18, 1}}},
-    {2707, {{44, 1}, {48, 2}, {52, 1}, {47, 1}, {49, 2}, {53, 3}, {39, 1}, {41, 1}, {42, 2},
-            {38, 1}, {34, 1}, {37, 2}, {40, 1}, {50, 2}, {51, 3}, {24, 1}, {26, 2}, {28, 3},
-            {14, 1}, {17, 2}, {20, 3}, {12, 1}, {18, 2}, {22, 3}, {10, 1}, {15, 2}, {16, 3},
-            {7, 1},  {8, 2},  {11, 3}, {3, 1},  {19, 2}, {25, 3}, {9, 1},  {21, 2}, {27, 3}}},
-    {2731,
-     {{28, 1}, {29, 3}, {30, 4}, {47, 1}, {60, 1}, {61, 2}, {21, 1}, {57, 1}, {39, 1}, {50, 1}}},
-    {2733,
-     {{14, 1},
-      {11, 1},
-      {12, 2},
-      {13, 3},
-      {7, 1},
-      {8, 2},
-      {15, 3},
-      {41, 1},
-      {42, 2},
-      {43, 3},
-      {35, 1},
-      {38, 2},
-      {39, 3},
-      {26, 1},
-      {46, 2},
-      {47, 3},
-      {17, 1},
-      {18, 2}}},
-    {2751,
-     {{17, 1},
-      {20, 2},
-      {25, 3},
-      {10, 1},
-      {21, 2},
-      {27, 3},
-      {14, 1},
-      {18, 2},
-      {26, 3},
-      {16, 1},
-      {22, 2},
-      {23, 3}}},
-    {2752, {{13, 2}, {7, 2},  {11, 1}, {19, 2}, {23, 1}, {30, 1}, {36, 2}, {44, 1},
-            {46, 2}, {47, 1}, {37, 1}, {42, 2}, {33, 1}, {45, 1}, {53, 1}, {14, 1},
-            {17, 2}, {25, 3}, {12, 1}, {21, 2}, {15, 1}, {16, 2}}},
-    {2755, {{42, 3},   {43, 5},   {8, 6},    {91, 7},  {96, 8},   {111, 9},  {51, 1},   {44, 1},
-            {48, 3},   {57, 1},   {64, 1},   {65, 2},  {103, 1},  {38, 1},   {37, 2},   {39, 3},
-            {40, 4},   {93, 4},   {58, 1},   {70, 2},  {34, 1},   {41, 2},   {101, 3},  {66, 1},
-            {5, 2},    {7, 4},    {89, 6},   {4, 8},   {6, 11},   {30, 11},  {31, 12},  {90, 13},
-            {106, 12}, {107, 13}, {110, 14}, {94, 12}, {104, 13}, {108, 14}, {102, 12}, {109, 13},
-            {47, 2},   {97, 12},  {98, 13},  {25, 13}, {28, 14},  {87, 15},  {53, 1},   {113, 1}}},
-    {2756, {{2, 4}}},
-    {2863,
-     {{16, 1}, {59, 1}, {60, 2}, {13, 1}, {14, 2}, {15, 3}, {9, 1},  {10, 2}, {17, 3}, {43, 1},
-      {44, 2}, {45, 3}, {57, 1}, {58, 2}, {55, 1}, {56, 2}, {53, 1}, {54, 2}, {51, 1}, {52, 2},
-      {37, 1}, {40, 2}, {41, 3}, {28, 1}, {48, 2}, {49, 3}, {19, 1}, {20, 2}}},
-    {2865, {{86, 1},  {96, 2},  {109, 1}, {116, 2}, {107, 1}, {125, 2}, {95, 1},
-            {124, 1}, {110, 1}, {117, 2}, {80, 1},  {82, 2},  {102, 1}, {108, 2},
-            {126, 1}, {93, 1},  {90, 1},  {123, 1}, {8, 1},   {40, 1}}},
-    {2866, {{9, 1}}},
-    {2867,
-     {{71, 1}, {84, 1}, {75, 1}, {85, 2}, {12, 1}, {14, 2}, {15, 3}, {87, 1}, {35, 1}, {39, 2},
-      {43, 1}, {38, 1}, {40, 2}, {44, 3}, {30, 1}, {32, 1}, {33, 2}, {29, 1}, {25, 1}, {28, 2},
-      {31, 1}, {41, 2}, {42, 3}, {61, 1}, {56, 1}, {89, 1}, {90, 2}, {91, 3}}},
-    {2869, {{1, 1}, {19, 1}, {15, 1}, {16, 2}}},
-    {2889,
-     {{38, 1},
-      {41, 2},
-      {42, 3},
-      {37, 1},
-      {40, 2},
-      {43, 3},
-      {50, 1},
-      {51, 2},
-      {47, 1},
-      {32, 1},
-      {33, 2}}},
-    {2929, {{16, 1},  {20, 1},  {87, 2},  {88, 3},  {8, 1},   {23, 1},  {90, 2},  {14, 1},
-            {17, 2},  {11, 3},  {86, 4},  {89, 4},  {18, 5},  {52, 6},  {53, 7},  {85, 4},
-            {3, 1},   {112, 1}, {116, 2}, {50, 1},  {51, 2},  {43, 1},  {44, 2},  {46, 3},
-            {47, 1},  {48, 2},  {49, 3},  {120, 1}, {115, 1}, {117, 2}, {121, 3}, {107, 1},
-            {109, 1}, {110, 2}, {106, 1}, {102, 1}, {105, 2}, {108, 1}, {118, 2}, {119, 3},
-            {72, 1},  {62, 1},  {93, 1},  {33, 1},  {29, 1},  {30, 2},  {37, 1},  {38, 2},
-            {39, 3},  {76, 1},  {75, 1},  {79, 1},  {80, 2},  {94, 1},  {66, 1},  {63, 1},
-            {70, 1},  {124, 1}, {125, 2}, {126, 3}, {83, 1},  {27, 1},  {55, 1},  {92, 1}}},
-    {2932,
-     {{5, 1},
-      {7, 2},
-      {17, 3},
-      {8, 1},
-      {9, 2},
-      {10, 3},
-      {12, 1},
-      {13, 2},
-      {15, 3},
-      {2, 1},
-      {3, 1},
-      {14, 2}}},
-    {2949, {{70, 1}, {75, 2}, {76, 3}, {67, 1}, {68, 2}, {71, 3}, {69, 1},
-            {77, 2}, {57, 1}, {58, 2}, {64, 3}, {52, 1}, {74, 2}, {48, 1},
-            {60, 2}, {72, 3}, {59, 1}, {62, 2}, {63, 3}, {53, 1}, {55, 2}}},
-    {2953, {{2, 1}}},
-    {2956, {{192, 1}, {193, 2}, {52, 1},  {32, 1},  {46, 2},  {49, 3},  {37, 1},  {39, 2},
-            {40, 1},  {42, 2},  {50, 3},  {35, 1},  {41, 2},  {47, 3},  {51, 1},  {44, 1},
-            {45, 2},  {43, 1},  {240, 1}, {246, 2}, {256, 3}, {255, 2}, {183, 1}, {177, 1},
-            {178, 1}, {179, 2}, {180, 3}, {238, 1}, {251, 2}, {254, 3}, {241, 1}, {242, 2},
-            {243, 3}, {245, 1}, {247, 2}, {250, 3}, {235, 1}, {248, 2}, {249, 3}}},
-    {2957, {{46, 1}, {57, 1}, {52, 1}, {72, 1}, {61, 1}, {53, 1}}},
-    {2964, {{21, 1}, {24, 2}, {26, 3}, {30, 1}, {28, 1}, {29, 1},  {13, 1},  {23, 1},  {10, 1},
-            {22, 1}, {19, 1}, {25, 2}, {27, 3}, {3, 1},  {75, 1},  {79, 2},  {83, 1},  {78, 1},
-            {80, 2}, {84, 3}, {70, 1}, {72, 1}, {73, 2}, {69, 1},  {65, 1},  {68, 2},  {71, 1},
-            {81, 2}, {82, 3}, {55, 1}, {57, 2}, {59, 3}, {45, 1},  {48, 2},  {51, 3},  {43, 1},
-            {49, 2}, {53, 3}, {41, 1}, {46, 2}, {47, 3}, {38, 1},  {39, 2},  {42, 3},  {34, 1},
-            {50, 2}, {56, 3}, {40, 1}, {52, 2}, {58, 3}, {203, 1}, {205, 1}, {206, 2}, {207, 3}}},
-    {2972,
-     {{5, 1},  {6, 2},  {30, 1}, {34, 2}, {38, 1}, {33, 1}, {35, 2}, {39, 3}, {25, 1}, {27, 1},
-      {28, 2}, {24, 1}, {20, 1}, {23, 2}, {26, 1}, {36, 2}, {37, 3}, {49, 1}, {50, 2}, {51, 3},
-      {13, 1}, {60, 1}, {69, 1}, {70, 2}, {71, 3}, {55, 1}, {47, 1}, {15, 1}, {11, 1}}},
-    {2986, {{6, 1},   {7, 2},   {12, 1},  {13, 2},  {16, 3}, {21, 1},  {22, 2},  {24, 3},  {19, 1},
-            {20, 2},  {23, 3},  {10, 1},  {11, 2},  {14, 3}, {127, 1}, {122, 1}, {121, 1}, {120, 1},
-            {42, 2},  {109, 1}, {110, 2}, {39, 1},  {40, 2}, {41, 3},  {35, 1},  {36, 2},  {43, 3},
-            {139, 2}, {132, 2}, {68, 1},  {69, 2},  {70, 3}, {107, 1}, {108, 2}, {105, 1}, {106, 2},
-            {103, 1}, {104, 2}, {101, 1}, {102, 2}, {62, 1}, {65, 2},  {66, 3},  {53, 1},  {73, 2},
-            {74, 3},  {45, 1},  {46, 2},  {80, 1},  {86, 1}, {144, 1}, {147, 2}, {149, 3}, {112, 1},
-            {113, 2}, {148, 3}, {115, 1}, {145, 2}, {146, 3}}},
-    {2988,
-     {{64, 1},
-      {44, 1},
-      {59, 1},
-      {18, 1},
-      {60, 1},
-      {2, 1},
-      {5, 2},
-      {41, 1},
-      {57, 1},
-      {46, 1},
-      {49, 1},
-      {16, 1}}},
-    {2990, {{4, 1}, {5, 2}, {9, 1}, {10, 2}, {29, 1}, {26, 1}}},
-    {2992,
-     {{76, 1},
-      {59, 1},
-      {43, 1},
-      {77, 1},
-      {16, 1},
-      {79, 1},
-      {74, 1},
-      {65, 1},
-      {56, 1},
-      {18, 1},
-      {60, 1},
-      {4, 1}}},
-    {2996, {{99, 1},  {106, 2}, {135, 3}, {107, 1}, {118, 2}, {108, 1}, {97, 1},  {105, 1},
-            {109, 2}, {110, 3}, {137, 1}, {100, 1}, {129, 2}, {126, 1}, {136, 2}, {138, 1},
-            {102, 1}, {103, 2}, {125, 1}, {33, 1},  {131, 2}, {132, 3}}},
-    {2997, {{1, 1},   {3, 2},   {4, 3},   {35, 1},  {40, 2},  {41, 3}, {32, 1}, {33, 2}, {36, 3},
-            {34, 1},  {42, 2},  {22, 1},  {23, 2},  {29, 3},  {17, 1}, {39, 2}, {13, 1}, {25, 2},
-            {37, 3},  {24, 1},  {27, 2},  {28, 3},  {18, 1},  {20, 2}, {97, 1}, {85, 1}, {98, 2},
-            {102, 3}, {56, 2},  {100, 2}, {103, 3}, {104, 5}, {88, 2}, {89, 3}, {99, 4}, {93, 1},
-            {96, 1},  {101, 2}, {87, 1},  {90, 2},  {92, 3},  {118, 1}}},
-    {3023,
-     {{6, 3},
-      {12, 3},
-      {10, 3},
-      {18, 4},
-      {22, 1},
-      {13, 1},
-      {16, 2},
-      {24, 3},
-      {11, 1},
-      {20, 2},
-      {14, 1},
-      {15, 2},
-      {35, 1},
-      {43, 1},
-      {45, 2},
-      {46, 1},
-      {44, 1}}},
-    {3029,
-     {{5, 1},
-      {9, 1},
-      {17, 1},
-      {7, 1},
-      {3, 1},
-      {34, 1},
-      {36, 1},
-      {46, 1},
-      {45, 1},
-      {28, 1},
-      {30, 1},
-      {32, 1}}},
-    {3030,
-     {{128, 1},
-      {151, 1},
-      {107, 1},
-      {152, 2},
-      {144, 1},
-      {122, 1},
-      {155, 1},
-      {113, 1},
-      {108, 1},
-      {154, 2},
-      {153, 1},
-      {137, 1},
-      {140, 1},
-      {123, 1},
-      {143, 1},
-      {101, 1}}},
-    {3031,
-     {{80, 1},  {83, 2},  {85, 3},  {89, 1},  {87, 1},  {88, 1},  {72, 1},  {82, 1},  {69, 1},
-      {81, 1},  {78, 1},  {84, 2},  {86, 3},  {62, 1},  {1, 1},   {3, 2},   {4, 3},   {17, 1},
-      {133, 1}, {137, 2}, {14, 1},  {15, 2},  {16, 3},  {10, 1},  {11, 2},  {18, 3},  {44, 1},
-      {45, 2},  {46, 3},  {38, 1},  {41, 2},  {42, 3},  {29, 1},  {49, 2},  {50, 3},  {20, 1},
-      {21, 2},  {141, 1}, {136, 1}, {138, 2}, {142, 3}, {128, 1}, {130, 1}, {131, 2}, {127, 1},
-      {123, 1}, {126, 2}, {129, 1}, {139, 2}, {140, 3}, {113, 1}, {115, 2}, {117, 3}, {103, 1},
-      {106, 2}, {109, 3}, {101, 1}, {107, 2}, {111, 3}, {99, 1},  {104, 2}, {105, 3}, {96, 1},
-      {97, 2},  {100, 3}, {92, 1},  {108, 2}, {114, 3}, {98, 1},  {110, 2}, {116, 3}, {223, 1},
-      {224, 2}, {225, 3}}},
-    {3033, {{3, 1},  {1, 1},  {4, 2},  {5, 3},  {24, 1}, {30, 2}, {29, 1}, {36, 1}, {37, 2},
-            {40, 3}, {45, 1}, {46, 2}, {48, 3}, {43, 1}, {44, 2}, {47, 3}, {34, 1}, {35, 2},
-            {38, 3}, {21, 1}, {22, 2}, {20, 1}, {27, 2}, {26, 1}, {28, 2}, {23, 1}}},
-    {3034,
-     {{99, 1},
-      {69, 1},
-      {6, 1},
-      {86, 2},
-      {7, 1},
-      {17, 2},
-      {103, 3},
-      {33, 1},
-      {70, 1},
-      {72, 2},
-      {100, 1},
-      {31, 1},
-      {85, 1},
-      {79, 1}}},
-    {3037, {{16, 1}, {13, 1}, {14, 2}, {15, 3}, {9, 1},  {10, 2},  {17, 3}, {43, 1}, {44, 2},
-            {45, 3}, {37, 1}, {40, 2}, {41, 3}, {28, 1}, {48, 2},  {49, 3}, {19, 1}, {20, 2},
-            {70, 1}, {73, 2}, {75, 1}, {76, 2}, {67, 1}, {68, 2},  {71, 3}, {96, 1}, {92, 1},
-            {93, 2}, {94, 1}, {95, 2}, {98, 1}, {99, 2}, {100, 3}, {64, 1}, {65, 2}}},
-    {3039,
-     {{60, 1},  {62, 2},  {79, 1},  {80, 2},  {72, 1},  {73, 2},  {75, 3},  {76, 1},  {77, 2},
-      {78, 3},  {65, 1},  {12, 1},  {63, 2},  {66, 3},  {55, 1},  {57, 1},  {58, 2},  {54, 1},
-      {50, 1},  {53, 2},  {47, 1},  {56, 2},  {64, 3},  {9, 1},   {4, 1},   {90, 1},  {91, 2},
-      {92, 3},  {119, 1}, {105, 1}, {36, 1},  {40, 1},  {34, 1},  {35, 2},  {44, 1},  {45, 2},
-      {46, 3},  {123, 1}, {122, 1}, {126, 1}, {127, 2}, {125, 1}, {109, 1}, {106, 1}, {117, 1},
-      {130, 1}, {96, 1},  {87, 1},  {88, 2},  {85, 1},  {38, 1},  {32, 1},  {98, 1},  {28, 1}}},
-    {3045,
-     {{28, 1},
-      {34, 1},
-      {40, 1},
-      {20, 1},
-      {35, 2},
-      {45, 3},
-      {39, 1},
-      {26, 1},
-      {33, 1},
-      {42, 2},
-      {44, 3},
-      {48, 1},
-      {46, 1},
-      {47, 1},
-      {29, 1},
-      {49, 1},
-      {50, 2}}},
-    {3048, {{14, 1}, {1, 1},  {3, 2},  {4, 3},  {55, 1},  {52, 1}, {53, 2}, {54, 3}, {48, 1},
-            {49, 2}, {56, 3}, {82, 1}, {83, 2}, {84, 3},  {76, 1}, {79, 2}, {80, 3}, {67, 1},
-            {87, 2}, {88, 3}, {58, 1}, {59, 2}, {102, 1}, {11, 1}, {12, 2}}},
-    {3051, {{44, 1}, {35, 1}, {41, 1}, {32, 1}, {47, 1}, {46, 1}, {42, 1}}},
-    {3053,
-     {{30, 1},
-      {31, 2},
-      {3, 1},
-      {1, 1},
-      {4, 2},
-      {5, 3},
-      {40, 1},
-      {50, 2},
-      {58, 1},
-      {59, 2},
-      {55, 1},
-      {56, 1},
-      {39, 1},
-      {73, 1},
-      {74, 2},
-      {75, 3}}},
-    {3073, {{7, 1}, {6, 1}, {2, 1}}},
-    {3091, {{10, 1}, {11, 2}, {12, 3}, {13, 1}, {6, 1}, {7, 2}, {14, 3}, {16, 1}, {17, 2}}},
-    {3112, {{2, 1}}},
-    {3159, {{86, 1}, {89, 2}, {92, 3}, {87, 1}, {94, 3}, {79, 2}, {90, 3}, {83, 2},
-            {88, 3}, {98, 4}, {69, 6}, {71, 7}, {80, 8}, {95, 5}, {96, 6}, {97, 7},
-            {81, 5}, {84, 2}, {82, 1}, {85, 2}, {93, 3}, {77, 1}}},
-    {3162,
-     {{86, 1}, {89, 2}, {92, 3}, {87, 1}, {94, 3}, {79, 2}, {90, 3}, {63, 1}, {64, 2}, {83, 2},
-      {88, 3}, {98, 4}, {69, 5}, {71, 6}, {80, 8}, {60, 1}, {61, 2}, {62, 1}, {65, 2}, {66, 3},
-      {95, 1}, {96, 2}, {97, 3}, {81, 1}, {84, 1}, {82, 1}, {85, 2}, {93, 3}, {77, 1}}},
-    {3169,
-     {{14, 1},
-      {53, 1},
-      {35, 1},
-      {36, 1},
-      {6, 1},
-      {7, 1},
-      {15, 2},
-      {29, 1},
-      {13, 1},
-      {45, 1},
-      {33, 1},
-      {22, 1},
-      {28, 1},
-      {31, 1},
-      {46, 1},
-      {43, 1},
-      {52, 1}}},
-    {3170, {{3, 1}}},
-    {3171, {{34, 1}, {4, 1},  {6, 2},  {7, 3},  {22, 1}, {26, 2}, {30, 1}, {25, 1},
-            {27, 2}, {31, 3}, {17, 1}, {19, 1}, {20, 2}, {16, 1}, {12, 1}, {15, 2},
-            {18, 1}, {28, 2}, {29, 3}, {62, 1}, {63, 2}, {64, 3}}},
-    {3172,
-     {{37, 1},
-      {38, 2},
-      {32, 1},
-      {4, 1},
-      {42, 2},
-      {43, 3},
-      {19, 1},
-      {24, 1},
-      {25, 2},
-      {40, 1},
-      {23, 1},
-      {39, 1}}},
-    {3182, {{6, 3},  {12, 3}, {10, 3}, {18, 4}, {22, 1}, {13, 1}, {16, 2}, {24, 3},
-            {11, 1}, {20, 2}, {14, 1}, {15, 2}, {30, 1}, {49, 1}, {37, 1}, {38, 2},
-            {42, 3}, {46, 1}, {47, 2}, {36, 1}, {39, 2}, {40, 1}, {43, 3}, {44, 4},
-            {58, 1}, {54, 1}, {55, 2}, {56, 1}, {57, 2}, {61, 1}, {62, 2}, {63, 3}}},
-    {3185, {{49, 1}, {60, 1}, {55, 1}, {56, 1}}},
-    {3186, {{102, 1}, {82, 1},  {96, 2},  {99, 3},  {87, 1},  {89, 2},  {110, 1}, {113, 2}, {9, 1},
-            {26, 1},  {28, 2},  {29, 1},  {27, 1},  {115, 1}, {107, 1}, {108, 2}, {111, 3}, {90, 1},
-            {92, 2},  {100, 3}, {85, 1},  {91, 2},  {97, 3},  {101, 1}, {94, 1},  {95, 2},  {93, 1},
-            {127, 1}, {119, 1}, {120, 2}, {121, 1}, {126, 2}, {123, 1}, {124, 2}, {130, 3}}},
-    {3188,
-     {{22, 1},
-      {23, 2},
-      {24, 3},
-      {16, 1},
-      {19, 2},
-      {20, 3},
-      {7, 1},
-      {27, 2},
-      {28, 3},
-      {37, 1},
-      {38, 2},
-      {39, 3},
-      {40, 1},
-      {33, 1},
-      {34, 2},
-      {41, 3},
-      {43, 1},
-      {44, 2}}},
-    {3190,
-     {{4, 1},
-      {36, 1},
-      {32, 1},
-      {22, 1},
-      {28, 2},
-      {18, 1},
-      {19, 2},
-      {21, 1},
-      {34, 2},
-      {30, 1},
-      {31, 2},
-      {27, 1},
-      {2, 1}}},
-    {3192,
-     {{14, 1},
-      {11, 1},
-      {12, 2},
-      {15, 3},
-      {21, 1},
-      {22, 1},
-      {23, 2},
-      {20, 1},
-      {3, 1},
-      {6, 2},
-      {24, 1},
-      {25, 2},
-      {13, 1},
-      {19, 2},
-      {26, 3},
-      {32, 1},
-      {33, 2},
-      {34, 3}}},
-    {3194,
-     {{54, 1},
-      {47, 1},
-      {51, 2},
-      {55, 3},
-      {44, 1},
-      {45, 2},
-      {52, 3},
-      {39, 1},
-      {37, 1},
-      {42, 1},
-      {43, 2},
-      {48, 3},
-      {33, 1},
-      {49, 2},
-      {53, 3},
-      {58, 1}}},
-    {3199,
-     {{64, 1}, {67, 2}, {31, 1}, {32, 2}, {27, 1}, {69, 1}, {61, 1}, {62, 2}, {65, 3}, {94, 1},
-      {90, 1}, {91, 2}, {93, 3}, {86, 1}, {88, 2}, {83, 1}, {84, 2}, {92, 3}, {97, 1}, {99, 2}}},
-    {3214, {{8, 1}, {9, 2}, {13, 1}, {6, 1}}},
-    {3219,
-     {{12, 1},
-      {16, 1},
-      {17, 2},
-      {19, 3},
-      {8, 2},
-      {15, 3},
-      {5, 1},
-      {6, 2},
-      {10, 1},
-      {13, 2},
-      {23, 3}}},
-    {3221,
-     {{26, 2},  {72, 3},  {79, 4},  {99, 5},  {49, 1},  {55, 1},  {62, 1},  {63, 2},  {91, 1},
-      {16, 1},  {15, 2},  {17, 3},  {18, 4},  {105, 4}, {56, 1},  {106, 2}, {19, 1},  {27, 2},
-      {92, 3},  {64, 1},  {10, 2},  {25, 5},  {75, 7},  {23, 10}, {24, 13}, {9, 11},  {11, 12},
-      {80, 13}, {96, 13}, {97, 14}, {98, 15}, {83, 14}, {86, 13}, {88, 14}, {90, 15}, {93, 13},
-      {94, 14}, {44, 2},  {31, 11}, {32, 12}, {73, 13}, {51, 1},  {84, 1},  {74, 1},  {101, 1}}},
-    {3222, {{2, 4}}},
-    {3224, {{37, 1}, {46, 2}, {48, 1}, {49, 2}, {16, 1}, {40, 1}, {43, 2}, {44, 3}, {45, 1},
-            {29, 1}, {34, 1}, {35, 2}, {33, 1}, {39, 2}, {38, 1}, {41, 2}, {42, 3}, {22, 1},
-            {23, 4}, {36, 5}, {15, 3}, {17, 4}, {7, 1},  {12, 2}, {14, 3}, {10, 1}, {11, 2}}},
-    {3237,
-     {{44, 1}, {53, 1}, {54, 2}, {50, 1}, {51, 2}, {55, 3}, {45, 1}, {46, 2}, {56, 1}, {57, 2},
-      {58, 3}, {37, 1}, {59, 2}, {35, 1}, {48, 2}, {40, 1}, {41, 2}, {27, 1}, {29, 2}, {30, 3},
-      {26, 1}, {28, 2}, {15, 1}, {16, 2}, {19, 3}, {17, 1}, {18, 2}, {22, 3}, {23, 1}, {8, 1},
-      {11, 2}, {12, 3}, {13, 1}, {20, 2}, {21, 3}, {3, 1},  {6, 2},  {7, 3}}},
-    {3239, {{33, 1}, {34, 2}, {21, 1}, {31, 2}, {25, 1}, {28, 2}, {29, 3}, {30, 1}, {37, 1},
-            {43, 1}, {45, 2}, {40, 1}, {41, 2}, {44, 3}, {12, 1}, {18, 1}, {19, 2}, {24, 1},
-            {47, 2}, {23, 1}, {26, 2}, {27, 3}, {4, 1},  {5, 3},  {20, 4}}},
-    {3240, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3241, {{53, 1}, {57, 1}, {43, 1}, {14, 1}, {52, 1}, {37, 1}, {34, 1}, {48, 2}, {51, 3},
-            {36, 1}, {41, 2}, {23, 1}, {24, 2}, {20, 1}, {21, 2}, {25, 3}, {15, 1}, {16, 2},
-            {26, 1}, {27, 2}, {28, 3}, {7, 1},  {29, 2}, {5, 1},  {18, 2}, {10, 1}, {11, 2}}},
-    {3242,
-     {{15, 1},
-      {24, 1},
-      {25, 2},
-      {21, 1},
-      {22, 2},
-      {26, 3},
-      {16, 1},
-      {17, 2},
-      {27, 1},
-      {28, 2},
-      {29, 3},
-      {8, 1},
-      {30, 2},
-      {6, 1},
-      {19, 2},
-      {11, 1},
-      {12, 2}}},
-    {3243, {{4, 1}, {8, 2}, {6, 1}, {9, 2}, {12, 3}}},
-    {3244, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3245,
-     {{36, 1},
-      {37, 2},
-      {15, 1},
-      {19, 1},
-      {22, 2},
-      {38, 1},
-      {39, 2},
-      {40, 3},
-      {21, 1},
-      {25, 2},
-      {14, 1},
-      {16, 2},
-      {6, 1},
-      {11, 2},
-      {13, 3},
-      {9, 1},
-      {10, 2}}},
-    {3246,
-     {{46, 1}, {59, 1}, {60, 2}, {50, 1}, {36, 1}, {3, 1},  {6, 2},  {5, 1},  {9, 2},  {15, 3},
-      {45, 1}, {30, 1}, {27, 1}, {41, 2}, {44, 3}, {29, 1}, {34, 2}, {61, 1}, {62, 2}, {63, 3}}},
-    {3248, {{7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2},
-            {26, 3}, {21, 1}, {31, 2}, {37, 3}, {45, 1}, {49, 2}, {47, 1}, {50, 2},
-            {53, 3}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3}, {30, 1},
-            {18, 1}, {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3249, {{33, 1}, {34, 2}, {5, 1}, {9, 2}, {7, 1}, {10, 2}, {13, 3}, {35, 1}, {36, 2}, {37, 3}}},
-    {3250,
-     {{19, 1},
-      {28, 2},
-      {30, 1},
-      {31, 2},
-      {22, 1},
-      {25, 2},
-      {26, 3},
-      {27, 1},
-      {11, 1},
-      {16, 1},
-      {17, 2},
-      {15, 1},
-      {21, 2},
-      {20, 1},
-      {23, 2},
-      {24, 3},
-      {4, 1},
-      {5, 3},
-      {18, 4}}},
-    {3251, {{21, 1}, {22, 2}, {4, 1}, {7, 2}, {23, 1}, {24, 2}, {25, 3}, {6, 1}, {10, 2}}},
-    {3252, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3253, {{34, 1}, {43, 2}, {45, 1}, {46, 2}, {15, 1}, {37, 1}, {40, 2}, {41, 3}, {42, 1},
-            {26, 1}, {31, 1}, {32, 2}, {30, 1}, {36, 2}, {35, 1}, {38, 2}, {39, 3}, {19, 1},
-            {20, 4}, {33, 5}, {14, 3}, {16, 4}, {6, 1},  {11, 2}, {13, 3}, {9, 1},  {10, 2}}},
-    {3254, {{23, 1}, {27, 1}, {13, 1}, {22, 1}, {7, 1}, {4, 1}, {18, 2}, {21, 3}, {6, 1}, {11, 2}}},
-    {3255, {{21, 1}, {22, 2}, {4, 1}, {7, 2}, {23, 1}, {24, 2}, {25, 3}, {6, 1}, {10, 2}}},
-    {3256, {{23, 1}, {27, 1}, {13, 1}, {22, 1}, {7, 1}, {4, 1}, {18, 2}, {21, 3}, {6, 1}, {11, 2}}},
-    {3257, {{7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2}, {26, 3},
-            {21, 1}, {31, 2}, {37, 3}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3},
-            {30, 1}, {18, 1}, {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3260, {{33, 1}, {34, 2}, {3, 1}, {6, 2}, {5, 1}, {9, 2}, {15, 3}, {35, 1}, {36, 2}, {37, 3}}},
-    {3261,
-     {{36, 1},
-      {37, 2},
-      {15, 1},
-      {19, 1},
-      {22, 2},
-      {38, 1},
-      {39, 2},
-      {40, 3},
-      {21, 1},
-      {25, 2},
-      {14, 1},
-      {16, 2},
-      {6, 1},
-      {11, 2},
-      {13, 3},
-      {9, 1},
-      {10, 2}}},
-    {3262, {{21, 1}, {22, 2}, {4, 1}, {7, 2}, {23, 1}, {24, 2}, {25, 3}, {6, 1}, {10, 2}}},
-    {3263,
-     {{46, 1},
-      {50, 1},
-      {36, 1},
-      {4, 1},
-      {8, 2},
-      {6, 1},
-      {9, 2},
-      {12, 3},
-      {45, 1},
-      {30, 1},
-      {27, 1},
-      {41, 2},
-      {44, 3},
-      {29, 1},
-      {34, 2}}},
-    {3264, {{7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2}, {26, 3},
-            {21, 1}, {31, 2}, {37, 3}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3},
-            {30, 1}, {18, 1}, {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3265, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3266, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3267, {{7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2}, {26, 3},
-            {21, 1}, {31, 2}, {37, 3}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3},
-            {30, 1}, {18, 1}, {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3268, {{4, 1}, {8, 2}, {6, 1}, {9, 2}, {12, 3}}},
-    {3269,
-     {{64, 1}, {7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2}, {26, 3},
-      {21, 1}, {31, 2}, {37, 3}, {68, 1}, {54, 1}, {63, 1}, {48, 1}, {45, 1}, {59, 2}, {62, 3},
-      {47, 1}, {52, 2}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3}, {30, 1}, {18, 1},
-      {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3270, {{7, 1},  {33, 2}, {5, 1},  {12, 2}, {10, 1}, {42, 2}, {23, 1}, {25, 2}, {26, 3},
-            {21, 1}, {31, 2}, {37, 3}, {38, 1}, {39, 2}, {40, 3}, {34, 1}, {35, 2}, {36, 3},
-            {30, 1}, {18, 1}, {19, 2}, {20, 3}, {16, 1}, {24, 2}, {13, 1}, {29, 2}, {14, 1}}},
-    {3271, {{76, 1}, {80, 1}, {66, 1}, {34, 1}, {38, 2}, {36, 1}, {39, 2}, {42, 3}, {75, 1},
-            {60, 1}, {57, 1}, {71, 2}, {74, 3}, {59, 1}, {64, 2}, {25, 1}, {27, 2}, {28, 3},
-            {24, 1}, {26, 2}, {13, 1}, {14, 2}, {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1},
-            {6, 1},  {9, 2},  {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3272,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {3275, {{45, 1}, {46, 2}, {65, 1}, {66, 2}, {34, 1}, {43, 2}, {15, 1}, {37, 1}, {40, 2},
-            {41, 3}, {42, 1}, {48, 1}, {51, 2}, {67, 1}, {68, 2}, {69, 3}, {50, 1}, {54, 2},
-            {26, 1}, {31, 1}, {32, 2}, {30, 1}, {36, 2}, {35, 1}, {38, 2}, {39, 3}, {19, 1},
-            {20, 4}, {33, 5}, {14, 3}, {16, 4}, {6, 1},  {11, 2}, {13, 3}, {9, 1},  {10, 2}}},
-    {3276,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {3278, {{34, 1}, {43, 2}, {45, 1}, {46, 2}, {15, 1}, {37, 1}, {40, 2}, {41, 3}, {42, 1},
-            {26, 1}, {31, 1}, {32, 2}, {30, 1}, {36, 2}, {35, 1}, {38, 2}, {39, 3}, {19, 1},
-            {20, 4}, {33, 5}, {14, 3}, {16, 4}, {6, 1},  {11, 2}, {13, 3}, {9, 1},  {10, 2}}},
-    {3280, {{33, 1}, {34, 2}, {5, 1}, {9, 2}, {7, 1}, {10, 2}, {13, 3}, {35, 1}, {36, 2}, {37, 3}}},
-    {3315, {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2},
-            {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},  {9, 2},
-            {10, 3}, {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {3323, {{15, 1}, {17, 2}, {20, 3}, {12, 1}, {13, 2}, {16, 1}, {18, 2}, {19, 3}}},
-    {3336, {{3, 1}, {4, 2}, {5, 1}}},
-    {3341, {{3, 1}, {34, 1}, {35, 1}, {40, 1}, {12, 1}, {22, 2}, {20, 1}, {15, 1}, {5, 1}}},
-    {3343,
-     {{66, 1}, {67, 2}, {22, 1}, {9, 1},  {19, 1}, {20, 2}, {21, 3}, {15, 1}, {16, 2}, {23, 3},
-      {49, 1}, {50, 2}, {51, 3}, {43, 1}, {46, 2}, {47, 3}, {34, 1}, {54, 2}, {55, 3}, {25, 1},
-      {26, 2}, {6, 1},  {4, 1},  {87, 1}, {89, 2}, {88, 1}, {92, 2}, {82, 1}, {83, 2}, {95, 3},
-      {84, 1}, {93, 2}, {94, 3}, {69, 1}, {75, 1}, {76, 2}, {77, 3}, {64, 1}}},
-    {3378, {{15, 1}, {14, 1}, {16, 2}, {6, 1}, {11, 2}, {13, 3}, {9, 1}, {10, 2}}},
-    {3435,
-     {{25, 1},
-      {18, 1},
-      {19, 2},
-      {14, 1},
-      {15, 2},
-      {7, 1},
-      {4, 1},
-      {12, 2},
-      {26, 3},
-      {20, 1},
-      {21, 2},
-      {9, 1},
-      {17, 2},
-      {27, 3}}},
-    {3442,
-     {{44, 1},
-      {37, 1},
-      {60, 1},
-      {24, 1},
-      {31, 1},
-      {39, 1},
-      {30, 1},
-      {38, 1},
-      {49, 1},
-      {55, 1},
-      {68, 2},
-      {56, 1},
-      {36, 1},
-      {53, 1},
-      {67, 2},
-      {64, 1},
-      {2, 1}}},
-    {3445, {{15, 1}, {14, 1}}},
-    {3447, {{27, 1}, {43, 1}, {78, 1}, {8, 1},  {42, 1}, {76, 1}, {41, 1}, {52, 1},
-            {48, 1}, {55, 1}, {71, 1}, {84, 1}, {82, 1}, {63, 1}, {65, 1}, {68, 1},
-            {74, 2}, {32, 1}, {60, 1}, {77, 2}, {66, 1}, {4, 1}}},
-    {3450, {{15, 1}, {14, 1}}},
-    {3451,
-     {{38, 1},
-      {24, 1},
-      {18, 1},
-      {49, 1},
-      {64, 1},
-      {39, 1},
-      {29, 1},
-      {34, 1},
-      {56, 1},
-      {51, 1},
-      {48, 1},
-      {60, 1},
-      {58, 1},
-      {9, 1},
-      {46, 1},
-      {61, 1},
-      {14, 1}}},
-    {3454, {{15, 1}, {14, 1}}},
+struct RemapEntry {
+  int tpage;
+  int texture_idx;
+  int dest_offset;
 };
 
+constexpr bool entry_less(const RemapEntry& a, const RemapEntry& b) {
+  return a.tpage != b.tpage ? a.tpage < b.tpage : a.texture_idx < b.texture_idx;
+}
+
+// sorted by tpage, then by texture, so a lookup is a binary search.
+// clang-format off
+constexpr RemapEntry data[] = {
+    {12, 12, 1}, {12, 38, 1}, {12, 46, 1}, {12, 52, 1}, {12, 134, 1}, {12, 187, 1}, {12, 201, 1},
+    {31, 2, 1}, {623, 6, 1}, {623, 7, 2}, {778, 26, 1}, {778, 28, 1}, {778, 31, 1}, {778, 45, 1},
+    {778, 47, 1}, {778, 59, 1}, {778, 61, 1}, {778, 62, 1}, {778, 65, 1}, {778, 66, 2}, {779, 2, 1},
+    {779, 3, 2}, {779, 6, 1}, {779, 7, 2}, {779, 8, 3}, {779, 11, 1}, {779, 12, 2}, {779, 20, 1},
+    {779, 21, 2}, {779, 24, 1}, {779, 26, 1}, {779, 30, 1}, {779, 31, 2}, {779, 32, 1},
+    {779, 34, 1}, {779, 36, 1}, {779, 37, 3}, {779, 38, 2}, {779, 39, 3}, {779, 40, 2},
+    {779, 41, 3}, {779, 47, 3}, {779, 49, 1}, {779, 50, 2}, {779, 51, 3}, {779, 52, 3},
+    {779, 66, 1}, {779, 73, 1}, {779, 75, 2}, {779, 76, 3}, {779, 78, 1}, {779, 79, 2},
+    {779, 80, 3}, {779, 83, 2}, {779, 84, 3}, {779, 99, 1}, {779, 105, 1}, {779, 107, 2},
+    {779, 109, 1}, {779, 110, 2}, {779, 112, 3}, {779, 113, 1}, {779, 159, 1}, {787, 10, 1},
+    {787, 12, 1}, {787, 13, 1}, {787, 16, 1}, {787, 21, 1}, {787, 24, 2}, {787, 27, 1},
+    {787, 28, 1}, {787, 30, 1}, {787, 40, 1}, {787, 44, 1}, {787, 47, 1}, {787, 49, 1},
+    {787, 50, 1}, {787, 51, 2}, {787, 52, 2}, {787, 54, 1}, {787, 65, 1}, {787, 69, 1},
+    {787, 72, 3}, {787, 75, 1}, {787, 76, 1}, {787, 77, 1}, {787, 82, 2}, {787, 85, 2},
+    {787, 92, 1}, {787, 93, 1}, {787, 149, 1}, {787, 150, 2}, {787, 153, 1}, {787, 160, 2},
+    {787, 161, 1}, {787, 162, 3}, {787, 163, 4}, {787, 164, 4}, {787, 168, 1}, {787, 169, 1},
+    {787, 182, 2}, {787, 183, 1}, {787, 184, 1}, {787, 185, 2}, {787, 186, 1}, {787, 187, 4},
+    {788, 2, 1}, {789, 10, 1}, {789, 11, 2}, {789, 52, 1}, {789, 54, 1}, {789, 59, 1}, {789, 63, 1},
+    {789, 70, 1}, {851, 5, 1}, {851, 7, 1}, {851, 9, 1}, {851, 18, 2}, {851, 21, 1}, {851, 22, 1},
+    {851, 26, 1}, {851, 28, 1}, {851, 35, 1}, {851, 39, 1}, {851, 41, 1}, {851, 42, 1},
+    {851, 43, 1}, {851, 44, 2}, {851, 45, 3}, {851, 46, 1}, {851, 47, 2}, {851, 49, 1},
+    {851, 51, 2}, {851, 53, 1}, {851, 56, 2}, {851, 57, 2}, {851, 60, 1}, {851, 61, 1},
+    {851, 62, 1}, {851, 63, 2}, {853, 5, 1}, {853, 6, 2}, {853, 47, 1}, {853, 49, 1}, {853, 51, 1},
+    {853, 55, 1}, {853, 57, 1}, {853, 58, 2}, {853, 59, 1}, {853, 61, 1}, {853, 63, 2},
+    {853, 64, 3}, {856, 14, 1}, {856, 21, 1}, {856, 22, 2}, {856, 25, 1}, {856, 26, 2},
+    {856, 27, 3}, {856, 28, 1}, {856, 37, 3}, {856, 44, 1}, {856, 51, 1}, {856, 53, 1},
+    {856, 66, 1}, {856, 67, 1}, {856, 68, 2}, {856, 72, 1}, {856, 75, 1}, {856, 76, 1},
+    {856, 77, 1}, {856, 80, 1}, {856, 81, 1}, {856, 82, 1}, {856, 83, 1}, {856, 85, 1},
+    {858, 48, 1}, {858, 50, 1}, {858, 52, 1}, {858, 96, 1}, {858, 118, 1}, {858, 120, 2},
+    {858, 121, 3}, {881, 2, 1}, {881, 12, 1}, {881, 13, 2}, {881, 17, 1}, {881, 19, 1},
+    {881, 23, 2}, {881, 28, 1}, {881, 34, 2}, {881, 40, 1}, {881, 43, 1}, {881, 44, 2},
+    {881, 45, 3}, {881, 46, 1}, {881, 51, 1}, {881, 52, 1}, {881, 53, 1}, {881, 61, 1},
+    {881, 65, 1}, {881, 72, 1}, {881, 73, 1}, {881, 74, 1}, {881, 76, 1}, {881, 82, 1},
+    {881, 84, 1}, {881, 89, 1}, {881, 91, 1}, {881, 92, 2}, {918, 32, 1}, {918, 37, 2},
+    {918, 53, 1}, {918, 56, 2}, {918, 58, 3}, {918, 61, 1}, {918, 92, 2}, {918, 93, 4},
+    {918, 94, 1}, {918, 95, 2}, {918, 96, 1}, {918, 97, 2}, {918, 98, 1}, {918, 99, 2},
+    {918, 129, 1}, {918, 130, 2}, {929, 15, 1}, {929, 16, 1}, {929, 17, 1}, {929, 19, 1},
+    {929, 23, 2}, {929, 24, 1}, {929, 25, 2}, {929, 26, 3}, {929, 27, 2}, {929, 28, 3},
+    {929, 29, 1}, {929, 30, 2}, {929, 32, 3}, {929, 33, 1}, {929, 34, 2}, {929, 35, 2},
+    {929, 36, 3}, {929, 37, 3}, {929, 38, 1}, {929, 39, 2}, {929, 43, 1}, {929, 44, 2},
+    {929, 45, 3}, {929, 46, 4}, {929, 53, 1}, {929, 54, 2}, {929, 57, 1}, {929, 66, 2},
+    {929, 67, 3}, {929, 70, 2}, {929, 73, 1}, {929, 74, 1}, {929, 75, 1}, {929, 76, 2},
+    {929, 77, 2}, {929, 78, 3}, {929, 79, 4}, {929, 81, 1}, {929, 88, 3}, {929, 91, 3},
+    {929, 92, 2}, {929, 95, 1}, {929, 98, 1}, {929, 99, 2}, {929, 100, 3}, {929, 101, 1},
+    {929, 102, 4}, {929, 103, 1}, {929, 104, 2}, {929, 118, 2}, {929, 119, 2}, {929, 121, 3},
+    {929, 122, 1}, {929, 128, 1}, {929, 131, 1}, {929, 132, 2}, {930, 23, 1}, {930, 24, 2},
+    {930, 27, 1}, {930, 28, 2}, {930, 29, 3}, {930, 31, 3}, {930, 33, 1}, {930, 34, 2},
+    {930, 42, 1}, {930, 52, 1}, {930, 55, 2}, {930, 56, 3}, {930, 58, 1}, {930, 59, 2},
+    {930, 60, 3}, {930, 63, 2}, {930, 64, 3}, {930, 134, 1}, {932, 6, 1}, {932, 8, 2}, {932, 9, 1},
+    {932, 10, 2}, {932, 11, 1}, {932, 18, 1}, {932, 20, 2}, {932, 22, 1}, {932, 23, 1},
+    {932, 24, 2}, {932, 32, 1}, {932, 34, 1}, {932, 36, 2}, {932, 41, 2}, {932, 43, 2},
+    {932, 44, 3}, {932, 47, 1}, {932, 48, 3}, {932, 50, 1}, {932, 53, 1}, {932, 54, 1},
+    {932, 83, 1}, {932, 84, 2}, {933, 2, 1}, {933, 5, 1}, {933, 6, 2}, {933, 9, 1}, {933, 10, 2},
+    {933, 11, 3}, {933, 13, 3}, {933, 15, 1}, {933, 16, 2}, {933, 23, 1}, {933, 33, 1},
+    {933, 36, 2}, {933, 37, 3}, {933, 39, 1}, {933, 40, 2}, {933, 41, 3}, {933, 44, 2},
+    {933, 45, 3}, {933, 123, 1}, {955, 3, 1}, {955, 10, 2}, {955, 12, 3}, {955, 15, 1},
+    {955, 26, 1}, {955, 30, 1}, {955, 32, 2}, {955, 35, 1}, {955, 37, 1}, {955, 48, 1},
+    {955, 70, 1}, {955, 76, 1}, {955, 84, 2}, {957, 3, 1}, {957, 5, 2}, {957, 6, 3}, {973, 8, 1},
+    {973, 9, 2}, {973, 13, 1}, {973, 14, 1}, {973, 16, 2}, {973, 17, 1}, {973, 18, 1}, {973, 27, 1},
+    {974, 1, 1}, {974, 4, 2}, {974, 6, 3}, {974, 12, 1}, {974, 15, 1}, {974, 21, 1}, {974, 27, 1},
+    {974, 30, 1}, {974, 32, 1}, {974, 37, 2}, {974, 38, 3}, {974, 39, 1}, {974, 40, 1},
+    {974, 44, 2}, {974, 45, 2}, {974, 56, 1}, {974, 60, 2}, {974, 61, 3}, {974, 63, 1}, {977, 2, 1},
+    {977, 14, 1}, {977, 16, 1}, {977, 19, 2}, {977, 22, 1}, {977, 24, 1}, {977, 30, 1},
+    {977, 31, 1}, {977, 33, 3}, {977, 35, 1}, {977, 36, 1}, {977, 37, 2}, {977, 39, 3},
+    {977, 43, 2}, {977, 44, 2}, {977, 50, 1}, {977, 66, 1}, {977, 72, 1}, {977, 73, 2},
+    {977, 74, 3}, {977, 76, 1}, {978, 8, 1}, {978, 12, 1}, {978, 17, 1}, {978, 18, 2}, {978, 19, 1},
+    {978, 21, 2}, {978, 22, 1}, {978, 26, 1}, {979, 1, 1}, {979, 2, 2}, {979, 3, 3}, {979, 5, 1},
+    {979, 6, 2}, {979, 7, 3}, {979, 9, 1}, {979, 11, 3}, {979, 12, 4}, {979, 13, 5}, {979, 15, 1},
+    {979, 16, 3}, {979, 17, 4}, {979, 19, 5}, {979, 20, 6}, {979, 22, 3}, {979, 23, 4},
+    {979, 24, 5}, {979, 26, 3}, {979, 28, 10}, {979, 29, 11}, {979, 30, 12}, {979, 32, 8},
+    {979, 33, 9}, {979, 34, 10}, {979, 36, 6}, {979, 37, 7}, {979, 38, 8}, {979, 40, 4},
+    {979, 41, 5}, {979, 42, 6}, {998, 37, 1}, {998, 42, 1}, {998, 44, 2}, {998, 46, 1},
+    {998, 51, 1}, {998, 53, 1}, {998, 55, 1}, {998, 58, 1}, {998, 61, 1}, {998, 64, 1},
+    {998, 66, 1}, {1021, 7, 1}, {1021, 9, 2}, {1021, 13, 1}, {1021, 66, 1}, {1021, 70, 1},
+    {1021, 71, 2}, {1021, 72, 3}, {1022, 6, 1}, {1031, 4, 1}, {1031, 16, 1}, {1031, 27, 1},
+    {1031, 28, 2}, {1031, 34, 1}, {1031, 37, 1}, {1031, 40, 1}, {1031, 44, 1}, {1031, 49, 1},
+    {1031, 53, 1}, {1031, 54, 1}, {1031, 56, 1}, {1031, 64, 1}, {1031, 67, 1}, {1059, 5, 1},
+    {1059, 8, 2}, {1059, 22, 1}, {1059, 23, 1}, {1059, 40, 1}, {1059, 41, 1}, {1059, 42, 1},
+    {1059, 46, 1}, {1059, 47, 2}, {1059, 50, 1}, {1059, 52, 2}, {1059, 58, 1}, {1059, 61, 1},
+    {1059, 62, 1}, {1059, 63, 1}, {1059, 64, 1}, {1059, 67, 1}, {1059, 78, 1}, {1059, 80, 1},
+    {1059, 81, 1}, {1059, 84, 1}, {1059, 85, 1}, {1059, 86, 1}, {1059, 89, 2}, {1059, 92, 2},
+    {1059, 93, 2}, {1059, 96, 1}, {1059, 97, 1}, {1059, 99, 1}, {1059, 100, 2}, {1059, 103, 1},
+    {1059, 104, 1}, {1059, 105, 1}, {1060, 4, 1}, {1060, 6, 1}, {1060, 7, 2}, {1060, 8, 1},
+    {1060, 14, 1}, {1060, 15, 2}, {1060, 24, 1}, {1060, 27, 1}, {1060, 29, 1}, {1060, 41, 1},
+    {1060, 44, 1}, {1060, 46, 1}, {1060, 84, 1}, {1060, 85, 2}, {1060, 86, 1}, {1060, 96, 1},
+    {1060, 97, 2}, {1060, 100, 1}, {1060, 101, 2}, {1060, 102, 3}, {1060, 104, 3}, {1060, 106, 1},
+    {1060, 107, 2}, {1060, 115, 1}, {1060, 125, 1}, {1060, 128, 2}, {1060, 129, 3}, {1060, 131, 1},
+    {1060, 132, 2}, {1060, 133, 3}, {1060, 136, 2}, {1060, 137, 3}, {1060, 139, 1}, {1060, 140, 2},
+    {1060, 143, 1}, {1060, 147, 1}, {1060, 149, 2}, {1060, 198, 1}, {1117, 11, 1}, {1117, 21, 1},
+    {1117, 23, 2}, {1117, 25, 2}, {1131, 4, 1}, {1131, 5, 2}, {1131, 8, 1}, {1131, 9, 2},
+    {1131, 10, 3}, {1131, 12, 3}, {1131, 14, 1}, {1131, 15, 2}, {1131, 23, 1}, {1131, 33, 1},
+    {1131, 36, 2}, {1131, 37, 3}, {1131, 39, 1}, {1131, 40, 2}, {1131, 41, 3}, {1131, 44, 2},
+    {1131, 45, 3}, {1131, 52, 1}, {1131, 56, 1}, {1131, 58, 1}, {1131, 61, 1}, {1131, 62, 2},
+    {1131, 63, 1}, {1131, 64, 2}, {1131, 66, 1}, {1131, 67, 3}, {1131, 68, 2}, {1131, 70, 2},
+    {1131, 71, 3}, {1131, 72, 3}, {1131, 75, 1}, {1131, 76, 1}, {1131, 107, 3}, {1133, 9, 1},
+    {1133, 14, 1}, {1133, 30, 1}, {1133, 31, 1}, {1133, 32, 1}, {1133, 52, 1}, {1133, 57, 1},
+    {1135, 58, 1}, {1135, 60, 2}, {1135, 61, 3}, {1135, 62, 1}, {1137, 1, 1}, {1137, 4, 2},
+    {1137, 7, 1}, {1137, 9, 1}, {1137, 77, 1}, {1137, 111, 2}, {1137, 116, 1}, {1137, 117, 2},
+    {1137, 118, 1}, {1137, 119, 2}, {1137, 123, 1}, {1137, 125, 1}, {1137, 127, 2}, {1137, 129, 1},
+    {1137, 133, 1}, {1183, 5, 1}, {1183, 6, 2}, {1183, 9, 1}, {1183, 10, 2}, {1183, 11, 3},
+    {1183, 13, 3}, {1183, 15, 1}, {1183, 16, 2}, {1183, 24, 1}, {1183, 34, 1}, {1183, 37, 2},
+    {1183, 38, 3}, {1183, 40, 1}, {1183, 41, 2}, {1183, 42, 3}, {1183, 45, 2}, {1183, 46, 3},
+    {1183, 50, 1}, {1183, 56, 1}, {1183, 57, 1}, {1183, 58, 2}, {1183, 59, 2}, {1183, 60, 1},
+    {1183, 62, 3}, {1183, 63, 3}, {1183, 64, 4}, {1183, 66, 1}, {1183, 67, 2}, {1183, 69, 1},
+    {1183, 71, 1}, {1183, 75, 1}, {1183, 76, 2}, {1183, 79, 1}, {1204, 13, 1}, {1204, 27, 1},
+    {1204, 30, 1}, {1204, 31, 1}, {1204, 34, 1}, {1204, 36, 1}, {1204, 38, 1}, {1204, 47, 1},
+    {1204, 50, 1}, {1204, 62, 1}, {1204, 66, 1}, {1204, 67, 2}, {1204, 68, 2}, {1204, 69, 2},
+    {1204, 70, 3}, {1204, 83, 1}, {1204, 91, 2}, {1204, 92, 3}, {1204, 96, 1}, {1204, 97, 2},
+    {1205, 30, 1}, {1205, 31, 2}, {1253, 15, 4}, {1254, 6, 1}, {1254, 10, 1}, {1254, 11, 2},
+    {1254, 13, 2}, {1254, 14, 3}, {1254, 17, 1}, {1254, 22, 1}, {1254, 29, 1}, {1254, 31, 1},
+    {1254, 32, 1}, {1254, 36, 1}, {1254, 38, 2}, {1254, 39, 3}, {1254, 51, 7}, {1254, 52, 2},
+    {1254, 53, 10}, {1254, 54, 4}, {1254, 55, 2}, {1254, 72, 11}, {1254, 74, 12}, {1254, 77, 1},
+    {1254, 80, 2}, {1254, 81, 1}, {1254, 82, 3}, {1254, 83, 4}, {1254, 85, 1}, {1254, 86, 2},
+    {1254, 90, 2}, {1254, 91, 1}, {1254, 94, 1}, {1254, 96, 2}, {1254, 97, 4}, {1254, 98, 1},
+    {1254, 103, 6}, {1254, 104, 3}, {1254, 108, 6}, {1254, 109, 7}, {1254, 110, 4}, {1254, 111, 6},
+    {1254, 112, 7}, {1254, 113, 1}, {1254, 114, 8}, {1254, 119, 1}, {1254, 120, 2}, {1254, 121, 3},
+    {1254, 124, 1}, {1254, 126, 1}, {1254, 133, 1}, {1254, 134, 3}, {1254, 135, 1}, {1254, 137, 5},
+    {1254, 138, 9}, {1254, 142, 2}, {1254, 150, 2}, {1255, 2, 1}, {1255, 3, 2}, {1255, 5, 1},
+    {1255, 8, 1}, {1256, 16, 1}, {1256, 18, 2}, {1256, 19, 3}, {1264, 26, 1}, {1264, 28, 1},
+    {1264, 70, 1}, {1264, 71, 4}, {1264, 72, 1}, {1264, 80, 1}, {1264, 82, 1}, {1264, 86, 2},
+    {1264, 87, 2}, {1264, 102, 1}, {1264, 107, 5}, {1264, 108, 6}, {1264, 109, 7}, {1264, 112, 7},
+    {1264, 113, 1}, {1264, 114, 3}, {1264, 115, 5}, {1264, 119, 2}, {1264, 120, 1}, {1264, 121, 3},
+    {1264, 122, 4}, {1266, 153, 1}, {1266, 154, 2}, {1266, 158, 1}, {1266, 218, 1}, {1266, 219, 2},
+    {1266, 220, 3}, {1268, 8, 1}, {1268, 9, 1}, {1268, 15, 1}, {1268, 19, 2}, {1268, 21, 1},
+    {1268, 38, 2}, {1268, 52, 3}, {1268, 54, 1}, {1268, 56, 2}, {1268, 58, 1}, {1268, 59, 2},
+    {1269, 13, 1}, {1269, 14, 1}, {1269, 20, 2}, {1269, 21, 1}, {1269, 23, 1}, {1269, 24, 1},
+    {1269, 25, 1}, {1303, 1, 1}, {1303, 3, 2}, {1303, 4, 3}, {1308, 1, 1}, {1308, 3, 2},
+    {1308, 4, 3}, {1308, 5, 1}, {1325, 5, 1}, {1369, 1, 1}, {1369, 15, 1}, {1369, 17, 1},
+    {1369, 22, 2}, {1369, 24, 1}, {1369, 25, 2}, {1369, 31, 1}, {1369, 35, 1}, {1369, 37, 1},
+    {1369, 41, 1}, {1369, 45, 1}, {1369, 49, 1}, {1369, 51, 1}, {1369, 53, 1}, {1369, 56, 1},
+    {1370, 8, 1}, {1370, 11, 1}, {1370, 14, 1}, {1370, 17, 1}, {1370, 20, 2}, {1370, 21, 2},
+    {1370, 22, 1}, {1370, 23, 1}, {1370, 26, 1}, {1370, 30, 1}, {1370, 31, 1}, {1370, 34, 1},
+    {1370, 35, 2}, {1370, 36, 2}, {1370, 40, 1}, {1370, 41, 2}, {1370, 46, 1}, {1370, 61, 1},
+    {1370, 62, 1}, {1370, 65, 1}, {1370, 66, 1}, {1370, 67, 1}, {1370, 71, 1}, {1370, 73, 1},
+    {1370, 74, 1}, {1372, 3, 1}, {1372, 10, 1}, {1372, 23, 1}, {1372, 29, 1}, {1372, 32, 1},
+    {1372, 33, 1}, {1372, 37, 1}, {1373, 1, 1}, {1373, 3, 2}, {1373, 4, 3}, {1373, 5, 1},
+    {1387, 1, 2}, {1387, 2, 3}, {1387, 3, 4}, {1387, 16, 1}, {1387, 17, 2}, {1387, 29, 1},
+    {1387, 35, 1}, {1387, 36, 2}, {1387, 64, 1}, {1387, 68, 1}, {1387, 69, 2}, {1387, 70, 1},
+    {1387, 73, 2}, {1387, 76, 1}, {1387, 79, 1}, {1387, 80, 2}, {1387, 91, 1}, {1387, 92, 2},
+    {1387, 95, 1}, {1387, 96, 2}, {1387, 97, 3}, {1387, 98, 1}, {1387, 99, 3}, {1387, 101, 1},
+    {1387, 102, 2}, {1387, 109, 1}, {1387, 119, 1}, {1387, 122, 2}, {1387, 123, 3}, {1387, 125, 1},
+    {1387, 126, 2}, {1387, 127, 3}, {1387, 130, 2}, {1387, 131, 3}, {1409, 5, 1}, {1409, 9, 1},
+    {1409, 10, 2}, {1409, 11, 1}, {1409, 12, 1}, {1409, 13, 3}, {1409, 14, 1}, {1409, 16, 1},
+    {1409, 17, 2}, {1409, 18, 3}, {1409, 19, 2}, {1409, 20, 2}, {1409, 21, 2}, {1409, 22, 3},
+    {1409, 23, 2}, {1409, 24, 3}, {1409, 26, 1}, {1409, 27, 3}, {1409, 28, 2}, {1409, 29, 3},
+    {1409, 30, 3}, {1409, 34, 1}, {1409, 35, 2}, {1409, 38, 1}, {1409, 39, 2}, {1409, 40, 3},
+    {1409, 42, 3}, {1409, 44, 1}, {1409, 45, 2}, {1409, 53, 1}, {1409, 54, 2}, {1409, 60, 1},
+    {1409, 70, 1}, {1409, 73, 2}, {1409, 74, 3}, {1409, 76, 1}, {1409, 77, 2}, {1409, 78, 3},
+    {1409, 81, 2}, {1409, 82, 3}, {1409, 86, 3}, {1409, 89, 1}, {1409, 91, 1}, {1409, 92, 2},
+    {1409, 93, 2}, {1409, 94, 4}, {1409, 96, 3}, {1409, 97, 4}, {1409, 98, 1}, {1409, 99, 3},
+    {1409, 100, 5}, {1409, 102, 1}, {1409, 103, 3}, {1409, 104, 2}, {1409, 105, 1}, {1409, 106, 3},
+    {1409, 107, 3}, {1409, 108, 4}, {1409, 109, 4}, {1409, 110, 5}, {1409, 115, 1}, {1409, 118, 2},
+    {1409, 119, 1}, {1409, 120, 1}, {1409, 121, 1}, {1409, 122, 1}, {1409, 123, 2}, {1409, 125, 1},
+    {1409, 128, 1}, {1409, 129, 2}, {1409, 130, 2}, {1409, 131, 2}, {1409, 132, 3}, {1409, 133, 1},
+    {1409, 134, 3}, {1409, 185, 1}, {1409, 189, 1}, {1409, 190, 2}, {1409, 191, 3}, {1414, 44, 1},
+    {1416, 5, 1}, {1416, 6, 2}, {1430, 54, 1}, {1430, 55, 2}, {1430, 73, 3}, {1430, 90, 3},
+    {1430, 92, 1}, {1430, 94, 1}, {1430, 95, 2}, {1430, 97, 4}, {1430, 98, 2}, {1430, 100, 1},
+    {1430, 104, 1}, {1430, 114, 3}, {1430, 115, 3}, {1430, 125, 1}, {1430, 133, 1}, {1430, 134, 1},
+    {1430, 135, 2}, {1430, 136, 1}, {1451, 5, 1}, {1451, 9, 1}, {1451, 10, 2}, {1451, 11, 1},
+    {1451, 12, 1}, {1451, 13, 3}, {1451, 14, 1}, {1451, 16, 1}, {1451, 17, 2}, {1451, 18, 3},
+    {1451, 19, 2}, {1451, 20, 2}, {1451, 21, 2}, {1451, 22, 3}, {1451, 23, 2}, {1451, 24, 3},
+    {1451, 26, 1}, {1451, 27, 3}, {1451, 28, 2}, {1451, 29, 3}, {1451, 30, 3}, {1451, 34, 1},
+    {1451, 35, 2}, {1451, 38, 1}, {1451, 39, 2}, {1451, 40, 3}, {1451, 42, 3}, {1451, 44, 1},
+    {1451, 45, 2}, {1451, 52, 1}, {1451, 62, 1}, {1451, 65, 2}, {1451, 66, 3}, {1451, 68, 1},
+    {1451, 69, 2}, {1451, 70, 3}, {1451, 73, 2}, {1451, 74, 3}, {1451, 81, 2}, {1451, 85, 2},
+    {1451, 102, 1}, {1451, 104, 2}, {1451, 107, 3}, {1451, 113, 5}, {1451, 162, 1}, {1451, 165, 2},
+    {1451, 166, 1}, {1451, 167, 1}, {1451, 168, 1}, {1451, 169, 1}, {1451, 170, 2}, {1451, 172, 1},
+    {1451, 175, 1}, {1451, 176, 2}, {1451, 177, 2}, {1451, 178, 2}, {1451, 179, 3}, {1451, 180, 1},
+    {1451, 181, 3}, {1451, 183, 1}, {1451, 185, 1}, {1451, 190, 1}, {1451, 191, 1}, {1451, 194, 1},
+    {1451, 199, 1}, {1451, 205, 1}, {1451, 206, 1}, {1451, 214, 1}, {1451, 215, 2}, {1451, 233, 1},
+    {1451, 234, 2}, {1451, 235, 3}, {1496, 18, 1}, {1496, 19, 1}, {1557, 15, 1}, {1557, 17, 1},
+    {1557, 20, 1}, {1557, 22, 1}, {1557, 23, 1}, {1557, 26, 1}, {1557, 28, 1}, {1557, 29, 2},
+    {1557, 30, 1}, {1557, 34, 1}, {1557, 40, 1}, {1557, 42, 2}, {1557, 44, 2}, {1557, 45, 1},
+    {1557, 46, 3}, {1557, 47, 1}, {1557, 53, 1}, {1557, 57, 1}, {1557, 59, 1}, {1557, 61, 3},
+    {1557, 62, 1}, {1557, 65, 1}, {1557, 82, 1}, {1557, 90, 1}, {1557, 91, 1}, {1560, 10, 1},
+    {1560, 12, 1}, {1560, 14, 2}, {1560, 15, 3}, {1560, 49, 1}, {1560, 50, 2}, {1560, 53, 1},
+    {1560, 54, 2}, {1560, 56, 1}, {1560, 57, 1}, {1560, 58, 2}, {1560, 59, 2}, {1560, 60, 3},
+    {1560, 61, 3}, {1561, 3, 1}, {1561, 7, 1}, {1561, 10, 1}, {1561, 12, 1}, {1561, 27, 1},
+    {1561, 28, 1}, {1561, 31, 1}, {1561, 32, 1}, {1561, 34, 1}, {1561, 35, 1}, {1561, 36, 1},
+    {1561, 38, 1}, {1561, 41, 1}, {1561, 44, 1}, {1561, 45, 1}, {1561, 47, 1}, {1561, 48, 1},
+    {1561, 50, 1}, {1561, 54, 1}, {1561, 61, 1}, {1561, 62, 1}, {1561, 64, 1}, {1562, 3, 1},
+    {1565, 7, 1}, {1565, 11, 1}, {1565, 14, 1}, {1565, 16, 1}, {1565, 30, 1}, {1565, 31, 1},
+    {1565, 34, 1}, {1565, 35, 1}, {1565, 37, 1}, {1565, 38, 1}, {1565, 41, 1}, {1565, 45, 1},
+    {1565, 47, 1}, {1565, 48, 1}, {1565, 49, 1}, {1565, 50, 1}, {1565, 53, 1}, {1565, 54, 1},
+    {1565, 65, 1}, {1565, 66, 1}, {1565, 68, 1}, {1570, 8, 1}, {1570, 12, 1}, {1570, 14, 2},
+    {1570, 21, 1}, {1570, 26, 1}, {1570, 28, 1}, {1570, 34, 1}, {1570, 36, 2}, {1570, 37, 1},
+    {1570, 43, 1}, {1570, 47, 2}, {1570, 51, 2}, {1570, 52, 1}, {1570, 53, 2}, {1570, 54, 1},
+    {1570, 56, 1}, {1573, 7, 1}, {1573, 8, 2}, {1573, 11, 1}, {1573, 12, 2}, {1573, 13, 3},
+    {1573, 14, 1}, {1573, 15, 3}, {1573, 17, 1}, {1573, 18, 2}, {1573, 26, 1}, {1573, 36, 1},
+    {1573, 39, 2}, {1573, 40, 3}, {1573, 42, 1}, {1573, 43, 2}, {1573, 44, 3}, {1573, 47, 2},
+    {1573, 48, 3}, {1573, 57, 1}, {1573, 59, 1}, {1573, 60, 2}, {1574, 5, 1}, {1574, 9, 1},
+    {1574, 10, 2}, {1574, 11, 1}, {1574, 12, 1}, {1574, 13, 3}, {1574, 14, 1}, {1574, 16, 1},
+    {1574, 17, 2}, {1574, 18, 3}, {1574, 19, 2}, {1574, 20, 2}, {1574, 21, 2}, {1574, 22, 3},
+    {1574, 23, 2}, {1574, 24, 3}, {1574, 26, 1}, {1574, 27, 3}, {1574, 28, 2}, {1574, 29, 3},
+    {1574, 30, 3}, {1574, 128, 1}, {1574, 129, 2}, {1574, 131, 1}, {1574, 138, 1}, {1574, 140, 2},
+    {1574, 141, 1}, {1574, 145, 3}, {1574, 146, 1}, {1574, 147, 1}, {1574, 148, 2}, {1574, 149, 2},
+    {1574, 150, 1}, {1574, 151, 3}, {1574, 152, 1}, {1574, 153, 2}, {1574, 154, 1}, {1574, 155, 1},
+    {1574, 156, 2}, {1574, 159, 1}, {1574, 160, 2}, {1574, 161, 3}, {1577, 1, 1}, {1577, 3, 2},
+    {1577, 4, 3}, {1578, 46, 1}, {1578, 49, 1}, {1578, 58, 1}, {1578, 61, 1}, {1578, 62, 1},
+    {1578, 64, 1}, {1578, 65, 1}, {1578, 69, 1}, {1578, 70, 1}, {1578, 72, 1}, {1578, 74, 2},
+    {1578, 76, 1}, {1578, 80, 1}, {1578, 83, 1}, {1578, 85, 1}, {1578, 87, 1}, {1578, 88, 1},
+    {1578, 93, 1}, {1580, 5, 1}, {1580, 7, 2}, {1580, 11, 1}, {1580, 21, 1}, {1580, 28, 1},
+    {1580, 30, 2}, {1580, 31, 1}, {1580, 32, 1}, {1580, 33, 1}, {1580, 34, 2}, {1580, 39, 2},
+    {1580, 43, 1}, {1580, 46, 1}, {1580, 53, 1}, {1583, 4, 1}, {1583, 7, 2}, {1583, 8, 1},
+    {1583, 9, 1}, {1583, 10, 1}, {1583, 11, 1}, {1583, 12, 2}, {1583, 14, 1}, {1583, 17, 1},
+    {1583, 18, 2}, {1583, 19, 2}, {1583, 20, 2}, {1583, 21, 3}, {1583, 22, 1}, {1583, 23, 3},
+    {1583, 38, 1}, {1583, 39, 2}, {1583, 40, 3}, {1584, 9, 1}, {1584, 12, 2}, {1584, 19, 1},
+    {1584, 22, 1}, {1584, 28, 1}, {1584, 29, 1}, {1584, 31, 1}, {1584, 35, 1}, {1584, 36, 2},
+    {1584, 37, 1}, {1584, 42, 2}, {1584, 46, 2}, {1587, 6, 1}, {1588, 10, 1}, {1588, 12, 1},
+    {1588, 13, 2}, {1589, 7, 1}, {1589, 10, 1}, {1589, 12, 2}, {1589, 13, 1}, {1589, 27, 1},
+    {1589, 29, 2}, {1589, 30, 1}, {1589, 31, 1}, {1589, 33, 1}, {1589, 37, 1}, {1589, 39, 2},
+    {1589, 40, 1}, {1589, 43, 1}, {1589, 44, 2}, {1589, 47, 1}, {1589, 48, 2}, {1589, 50, 3},
+    {1589, 53, 2}, {1589, 63, 1}, {1589, 64, 1}, {1589, 65, 1}, {1589, 66, 2}, {1589, 67, 3},
+    {1592, 9, 1}, {1592, 18, 1}, {1592, 20, 1}, {1592, 22, 2}, {1592, 32, 1}, {1592, 33, 1},
+    {1592, 36, 1}, {1592, 37, 2}, {1592, 38, 1}, {1592, 40, 1}, {1592, 41, 2}, {1592, 42, 2},
+    {1592, 43, 1}, {1592, 45, 1}, {1592, 46, 2}, {1592, 47, 2}, {1592, 52, 1}, {1592, 55, 1},
+    {1592, 57, 1}, {1592, 61, 2}, {1594, 7, 1}, {1594, 8, 2}, {1594, 9, 3}, {1594, 13, 1},
+    {1594, 18, 1}, {1594, 20, 2}, {1594, 21, 1}, {1594, 27, 1}, {1594, 28, 1}, {1594, 29, 1},
+    {1594, 30, 1}, {1594, 31, 1}, {1595, 69, 1}, {1595, 70, 2}, {1595, 71, 1}, {1595, 72, 3},
+    {1595, 78, 1}, {1595, 79, 2}, {1595, 82, 1}, {1595, 83, 2}, {1595, 84, 3}, {1595, 85, 1},
+    {1595, 86, 3}, {1595, 88, 1}, {1595, 89, 2}, {1595, 96, 1}, {1595, 105, 1}, {1595, 108, 2},
+    {1595, 109, 3}, {1595, 111, 1}, {1595, 112, 2}, {1595, 113, 3}, {1595, 116, 2}, {1595, 117, 3},
+    {1596, 5, 1}, {1596, 6, 1}, {1596, 10, 1}, {1596, 13, 2}, {1596, 14, 3}, {1596, 17, 2},
+    {1596, 20, 1}, {1596, 25, 1}, {1596, 26, 1}, {1596, 27, 1}, {1596, 28, 1}, {1596, 30, 1},
+    {1596, 32, 1}, {1596, 45, 1}, {1597, 3, 1}, {1597, 5, 2}, {1598, 8, 1}, {1598, 15, 1},
+    {1598, 16, 1}, {1598, 17, 1}, {1598, 24, 1}, {1598, 25, 1}, {1598, 26, 1}, {1598, 28, 1},
+    {1598, 29, 2}, {1598, 30, 1}, {1598, 31, 2}, {1599, 2, 1}, {1599, 4, 1}, {1599, 5, 2},
+    {1599, 12, 1}, {1599, 17, 1}, {1599, 19, 2}, {1601, 3, 1}, {1605, 3, 1}, {1605, 6, 2},
+    {1605, 9, 1}, {1605, 12, 1}, {1605, 42, 1}, {1605, 53, 2}, {1605, 59, 1}, {1605, 60, 1},
+    {1605, 61, 2}, {1605, 63, 2}, {1605, 66, 1}, {1605, 68, 2}, {1605, 70, 1}, {1605, 72, 1},
+    {1605, 76, 1}, {1606, 3, 1}, {1606, 11, 1}, {1606, 12, 2}, {1606, 15, 1}, {1606, 18, 1},
+    {1607, 37, 1}, {1607, 38, 2}, {1607, 44, 1}, {1607, 46, 1}, {1607, 47, 2}, {1607, 48, 1},
+    {1607, 51, 3}, {1607, 54, 1}, {1607, 56, 1}, {1607, 57, 2}, {1607, 58, 2}, {1607, 59, 4},
+    {1607, 61, 3}, {1607, 62, 4}, {1607, 63, 1}, {1607, 64, 3}, {1607, 65, 5}, {1607, 67, 1},
+    {1607, 68, 3}, {1607, 69, 2}, {1607, 70, 1}, {1607, 71, 3}, {1607, 72, 3}, {1607, 73, 4},
+    {1607, 74, 4}, {1607, 75, 5}, {1607, 78, 1}, {1607, 84, 1}, {1607, 85, 1}, {1607, 88, 1},
+    {1607, 93, 1}, {1607, 99, 1}, {1607, 100, 1}, {1607, 112, 1}, {1607, 114, 1}, {1607, 115, 2},
+    {1607, 116, 3}, {1607, 120, 1}, {1607, 121, 2}, {1607, 124, 1}, {1607, 125, 2}, {1607, 126, 3},
+    {1607, 127, 1}, {1607, 128, 3}, {1607, 130, 1}, {1607, 131, 2}, {1607, 138, 1}, {1607, 148, 1},
+    {1607, 151, 2}, {1607, 152, 3}, {1607, 154, 1}, {1607, 155, 2}, {1607, 156, 3}, {1607, 159, 2},
+    {1607, 160, 3}, {1607, 167, 1}, {1607, 169, 1}, {1607, 179, 2}, {1607, 184, 1}, {1607, 185, 1},
+    {1607, 187, 1}, {1607, 188, 2}, {1607, 189, 1}, {1615, 3, 1}, {1616, 8, 1}, {1621, 7, 1},
+    {1621, 10, 2}, {1621, 11, 1}, {1621, 12, 1}, {1621, 13, 1}, {1621, 14, 1}, {1621, 15, 2},
+    {1621, 17, 1}, {1621, 20, 1}, {1621, 21, 2}, {1621, 22, 2}, {1621, 23, 2}, {1621, 24, 3},
+    {1621, 25, 1}, {1621, 26, 3}, {1621, 32, 1}, {1621, 52, 1}, {1621, 53, 2}, {1621, 54, 3},
+    {1626, 4, 1}, {1626, 5, 2}, {1626, 7, 3}, {1626, 10, 1}, {1626, 13, 1}, {1626, 14, 1},
+    {1627, 5, 1}, {1627, 6, 2}, {1627, 9, 1}, {1627, 10, 2}, {1627, 11, 3}, {1627, 12, 1},
+    {1627, 13, 3}, {1627, 15, 1}, {1627, 16, 2}, {1627, 24, 1}, {1627, 34, 1}, {1627, 37, 2},
+    {1627, 38, 3}, {1627, 40, 1}, {1627, 41, 2}, {1627, 42, 3}, {1627, 45, 2}, {1627, 46, 3},
+    {1627, 123, 1}, {1627, 125, 2}, {1627, 127, 1}, {1627, 128, 2}, {1627, 130, 3}, {1627, 131, 1},
+    {1627, 133, 1}, {1627, 135, 2}, {1627, 136, 3}, {1628, 5, 1}, {1628, 6, 1}, {1628, 7, 2},
+    {1628, 13, 1}, {1628, 14, 2}, {1628, 15, 1}, {1628, 19, 3}, {1628, 20, 1}, {1628, 24, 1},
+    {1628, 26, 1}, {1628, 28, 1}, {1629, 52, 2}, {1629, 56, 1}, {1629, 60, 2}, {1629, 80, 1},
+    {1629, 89, 1}, {1629, 98, 1}, {1629, 99, 1}, {1629, 106, 1}, {1641, 2, 1}, {1719, 5, 1},
+    {1719, 9, 1}, {1719, 13, 1}, {1719, 14, 2}, {1719, 15, 3}, {1719, 16, 2}, {1719, 19, 1},
+    {1719, 20, 2}, {1719, 21, 3}, {1719, 22, 1}, {1719, 24, 1}, {1719, 26, 3}, {1720, 1, 1},
+    {1720, 4, 1}, {1720, 5, 2}, {1720, 7, 1}, {1721, 7, 1}, {1721, 8, 2}, {1721, 14, 1},
+    {1721, 15, 2}, {1721, 18, 1}, {1721, 19, 2}, {1721, 20, 3}, {1721, 21, 1}, {1721, 22, 3},
+    {1721, 24, 1}, {1721, 25, 2}, {1721, 33, 1}, {1721, 43, 1}, {1721, 46, 2}, {1721, 47, 3},
+    {1721, 49, 1}, {1721, 50, 2}, {1721, 51, 3}, {1721, 54, 2}, {1721, 55, 3}, {1721, 78, 1},
+    {1733, 41, 1}, {1735, 1, 1}, {1735, 7, 1}, {1735, 23, 1}, {1735, 24, 2}, {1735, 27, 1},
+    {1735, 28, 2}, {1735, 29, 3}, {1735, 31, 3}, {1735, 33, 1}, {1735, 34, 2}, {1735, 40, 1},
+    {1735, 41, 2}, {1735, 46, 1}, {1735, 55, 1}, {1735, 58, 2}, {1735, 59, 3}, {1735, 61, 1},
+    {1735, 62, 2}, {1735, 63, 3}, {1735, 66, 2}, {1735, 67, 3}, {1735, 70, 1}, {1753, 3, 1},
+    {1753, 7, 1}, {1753, 8, 2}, {1753, 9, 1}, {1753, 10, 1}, {1753, 11, 3}, {1753, 12, 1},
+    {1753, 14, 1}, {1753, 15, 2}, {1753, 16, 3}, {1753, 17, 2}, {1753, 18, 2}, {1753, 19, 2},
+    {1753, 20, 3}, {1753, 21, 2}, {1753, 22, 3}, {1753, 24, 1}, {1753, 25, 3}, {1753, 26, 2},
+    {1753, 27, 3}, {1753, 28, 3}, {1753, 37, 1}, {1753, 41, 1}, {1753, 42, 1}, {1753, 44, 2},
+    {1753, 46, 1}, {1753, 47, 2}, {1753, 48, 1}, {1753, 49, 2}, {1753, 51, 2}, {1753, 52, 3},
+    {1753, 53, 3}, {1753, 56, 1}, {1753, 57, 2}, {1753, 58, 1}, {1753, 59, 1}, {1753, 60, 3},
+    {1753, 61, 3}, {1753, 63, 2}, {1753, 64, 2}, {1753, 65, 3}, {1753, 66, 2}, {1753, 73, 1},
+    {1756, 34, 1}, {1756, 38, 1}, {1756, 39, 1}, {1756, 41, 2}, {1756, 43, 1}, {1756, 44, 2},
+    {1756, 45, 1}, {1756, 46, 2}, {1756, 48, 2}, {1756, 49, 3}, {1756, 50, 3}, {1756, 53, 1},
+    {1756, 54, 2}, {1756, 55, 1}, {1756, 56, 1}, {1756, 57, 3}, {1756, 58, 3}, {1756, 60, 2},
+    {1756, 61, 2}, {1756, 62, 3}, {1756, 63, 2}, {1764, 33, 1}, {1764, 37, 1}, {1764, 39, 1},
+    {1764, 42, 1}, {1764, 43, 2}, {1764, 44, 1}, {1764, 45, 2}, {1764, 47, 1}, {1764, 48, 3},
+    {1764, 49, 2}, {1764, 51, 2}, {1764, 52, 3}, {1764, 53, 1}, {1764, 54, 3}, {1764, 55, 3},
+    {1764, 59, 1}, {1764, 60, 2}, {1764, 63, 1}, {1764, 64, 2}, {1764, 65, 3}, {1764, 66, 1},
+    {1764, 67, 3}, {1764, 69, 1}, {1764, 70, 2}, {1764, 78, 1}, {1764, 87, 1}, {1764, 90, 2},
+    {1764, 91, 3}, {1764, 93, 1}, {1764, 94, 2}, {1764, 95, 3}, {1764, 98, 2}, {1764, 99, 3},
+    {1772, 102, 1}, {1772, 104, 2}, {1772, 106, 1}, {1772, 107, 2}, {1772, 109, 3}, {1772, 110, 1},
+    {1772, 136, 1}, {1772, 137, 2}, {1772, 140, 1}, {1772, 141, 2}, {1772, 142, 3}, {1772, 143, 1},
+    {1772, 144, 3}, {1772, 146, 1}, {1772, 147, 2}, {1772, 154, 1}, {1772, 163, 1}, {1772, 166, 2},
+    {1772, 167, 3}, {1772, 169, 1}, {1772, 170, 2}, {1772, 171, 3}, {1772, 174, 2}, {1772, 175, 3},
+    {1773, 52, 1}, {1773, 56, 1}, {1773, 58, 1}, {1773, 61, 1}, {1773, 62, 2}, {1773, 63, 1},
+    {1773, 64, 2}, {1773, 66, 1}, {1773, 67, 3}, {1773, 68, 2}, {1773, 70, 2}, {1773, 71, 3},
+    {1773, 72, 1}, {1773, 73, 3}, {1773, 74, 3}, {1774, 7, 1}, {1774, 11, 1}, {1774, 13, 1},
+    {1774, 16, 1}, {1774, 17, 2}, {1774, 18, 1}, {1774, 19, 2}, {1774, 21, 1}, {1774, 22, 3},
+    {1774, 23, 2}, {1774, 25, 2}, {1774, 26, 3}, {1774, 27, 1}, {1774, 28, 3}, {1774, 54, 3},
+    {1862, 2, 1}, {1872, 6, 1}, {1872, 7, 2}, {1872, 10, 1}, {1872, 11, 2}, {1872, 12, 3},
+    {1872, 13, 1}, {1872, 14, 3}, {1872, 16, 1}, {1872, 17, 2}, {1877, 7, 1}, {1877, 11, 1},
+    {1877, 13, 1}, {1877, 14, 2}, {1877, 41, 1}, {1877, 48, 1}, {1877, 49, 1}, {1877, 51, 1},
+    {1877, 68, 1}, {1877, 75, 1}, {1877, 87, 1}, {1877, 88, 1}, {1879, 5, 1}, {1879, 6, 2},
+    {1879, 9, 1}, {1879, 10, 2}, {1879, 11, 3}, {1879, 12, 1}, {1879, 13, 3}, {1879, 15, 1},
+    {1879, 16, 2}, {1879, 24, 1}, {1879, 33, 1}, {1879, 36, 2}, {1879, 37, 3}, {1879, 39, 1},
+    {1879, 40, 2}, {1879, 41, 3}, {1879, 44, 2}, {1879, 45, 3}, {1950, 13, 1}, {1950, 14, 2},
+    {1950, 17, 1}, {1950, 18, 2}, {1950, 19, 3}, {1950, 20, 1}, {1950, 21, 3}, {1950, 23, 1},
+    {1950, 24, 2}, {2209, 3, 1}, {2209, 5, 3}, {2209, 11, 1}, {2209, 19, 2}, {2209, 23, 2},
+    {2212, 5, 1}, {2212, 6, 2}, {2212, 9, 1}, {2212, 10, 2}, {2212, 11, 3}, {2212, 12, 1},
+    {2212, 13, 3}, {2212, 15, 1}, {2212, 16, 2}, {2212, 24, 1}, {2212, 33, 1}, {2212, 36, 2},
+    {2212, 37, 3}, {2212, 39, 1}, {2212, 40, 2}, {2212, 41, 3}, {2212, 44, 2}, {2212, 45, 3},
+    {2212, 60, 1}, {2212, 63, 1}, {2212, 65, 1}, {2212, 67, 2}, {2212, 68, 1}, {2212, 69, 2},
+    {2212, 70, 2}, {2212, 71, 1}, {2212, 72, 1}, {2212, 73, 2}, {2212, 74, 2}, {2212, 75, 3},
+    {2212, 77, 3}, {2212, 78, 3}, {2212, 79, 1}, {2212, 80, 1}, {2280, 21, 1}, {2280, 27, 1},
+    {2280, 29, 1}, {2282, 6, 1}, {2282, 13, 1}, {2282, 27, 1}, {2282, 29, 1}, {2282, 30, 2},
+    {2282, 34, 1}, {2282, 36, 1}, {2282, 46, 1}, {2282, 47, 1}, {2282, 48, 2}, {2282, 49, 2},
+    {2282, 53, 1}, {2282, 57, 1}, {2283, 8, 1}, {2284, 9, 1}, {2284, 12, 2}, {2284, 13, 1},
+    {2284, 14, 1}, {2284, 15, 1}, {2284, 16, 1}, {2284, 17, 2}, {2284, 19, 1}, {2284, 22, 1},
+    {2284, 23, 2}, {2284, 24, 2}, {2284, 25, 2}, {2284, 26, 3}, {2284, 27, 1}, {2284, 28, 3},
+    {2284, 50, 1}, {2284, 54, 1}, {2284, 56, 1}, {2284, 57, 2}, {2284, 58, 2}, {2284, 67, 1},
+    {2284, 68, 2}, {2284, 69, 3}, {2284, 71, 1}, {2284, 74, 1}, {2284, 75, 2}, {2284, 76, 3},
+    {2290, 6, 1}, {2290, 14, 1}, {2290, 27, 1}, {2290, 28, 1}, {2290, 29, 1}, {2290, 31, 1},
+    {2290, 32, 2}, {2290, 34, 1}, {2290, 36, 1}, {2290, 38, 1}, {2290, 44, 1}, {2290, 45, 1},
+    {2290, 46, 2}, {2290, 47, 2}, {2290, 52, 1}, {2290, 59, 1}, {2292, 9, 1}, {2292, 10, 1},
+    {2292, 12, 2}, {2292, 13, 2}, {2292, 16, 1}, {2292, 17, 3}, {2292, 18, 1}, {2292, 19, 2},
+    {2292, 20, 2}, {2292, 22, 2}, {2292, 51, 1}, {2292, 52, 2}, {2298, 3, 1}, {2298, 5, 1},
+    {2298, 12, 1}, {2298, 14, 1}, {2298, 19, 2}, {2298, 20, 1}, {2298, 30, 1}, {2298, 34, 1},
+    {2298, 39, 1}, {2298, 40, 2}, {2298, 42, 1}, {2298, 49, 2}, {2298, 50, 2}, {2298, 51, 1},
+    {2298, 52, 1}, {2298, 54, 1}, {2298, 56, 1}, {2298, 58, 1}, {2298, 60, 1}, {2298, 61, 1},
+    {2298, 64, 3}, {2298, 68, 1}, {2298, 69, 1}, {2298, 72, 1}, {2298, 75, 1}, {2298, 78, 1},
+    {2298, 86, 2}, {2300, 13, 1}, {2300, 18, 1}, {2300, 24, 1}, {2300, 27, 1}, {2300, 33, 1},
+    {2300, 34, 1}, {2300, 37, 1}, {2300, 54, 1}, {2300, 55, 1}, {2300, 58, 1}, {2300, 62, 2},
+    {2300, 63, 1}, {2300, 64, 2}, {2300, 65, 1}, {2300, 66, 2}, {2300, 67, 2}, {2300, 68, 3},
+    {2300, 69, 1}, {2300, 70, 2}, {2300, 71, 1}, {2300, 72, 3}, {2300, 73, 3}, {2300, 80, 1},
+    {2300, 82, 2}, {2300, 83, 2}, {2300, 84, 1}, {2324, 29, 1}, {2324, 30, 1}, {2324, 32, 1},
+    {2324, 34, 1}, {2324, 35, 2}, {2324, 40, 1}, {2324, 41, 1}, {2324, 45, 1}, {2354, 2, 1},
+    {2354, 3, 1}, {2354, 7, 2}, {2354, 8, 1}, {2354, 9, 3}, {2354, 12, 1}, {2354, 16, 1},
+    {2354, 18, 1}, {2354, 23, 8}, {2354, 24, 2}, {2354, 25, 11}, {2354, 26, 4}, {2354, 27, 4},
+    {2354, 46, 15}, {2354, 47, 3}, {2354, 48, 4}, {2354, 51, 13}, {2354, 52, 1}, {2354, 53, 16},
+    {2354, 55, 10}, {2354, 56, 11}, {2354, 59, 1}, {2354, 60, 2}, {2354, 61, 1}, {2354, 62, 17},
+    {2354, 63, 16}, {2354, 65, 1}, {2354, 67, 6}, {2354, 71, 14}, {2354, 72, 15}, {2354, 74, 6},
+    {2354, 76, 12}, {2354, 77, 7}, {2354, 78, 14}, {2354, 79, 26}, {2354, 80, 15}, {2354, 82, 14},
+    {2354, 83, 15}, {2354, 84, 16}, {2354, 85, 16}, {2354, 86, 9}, {2354, 89, 1}, {2354, 90, 1},
+    {2354, 92, 1}, {2354, 96, 1}, {2354, 97, 1}, {2354, 98, 2}, {2354, 101, 2}, {2354, 102, 1},
+    {2354, 103, 3}, {2354, 104, 4}, {2354, 106, 3}, {2354, 110, 1}, {2354, 111, 3}, {2354, 116, 2},
+    {2354, 118, 1}, {2354, 122, 1}, {2354, 123, 1}, {2354, 125, 1}, {2356, 2, 4}, {2357, 1, 1},
+    {2357, 3, 2}, {2357, 4, 3}, {2357, 31, 1}, {2360, 64, 1}, {2360, 66, 2}, {2360, 67, 1},
+    {2363, 1, 1}, {2363, 3, 2}, {2363, 4, 3}, {2371, 27, 1}, {2371, 32, 1}, {2371, 33, 2},
+    {2372, 1, 1}, {2372, 3, 2}, {2372, 4, 3}, {2372, 5, 1}, {2373, 2, 1}, {2373, 3, 2},
+    {2373, 5, 3}, {2373, 7, 1}, {2373, 10, 1}, {2373, 11, 2}, {2374, 1, 1}, {2374, 5, 1},
+    {2374, 7, 2}, {2374, 9, 1}, {2374, 11, 1}, {2374, 16, 1}, {2374, 20, 1}, {2374, 21, 1},
+    {2374, 22, 1}, {2374, 24, 2}, {2374, 25, 3}, {2374, 26, 1}, {2375, 1, 1}, {2375, 3, 2},
+    {2375, 7, 3}, {2375, 16, 1}, {2375, 17, 1}, {2406, 4, 1}, {2406, 9, 1}, {2406, 11, 1},
+    {2406, 13, 1}, {2406, 15, 2}, {2406, 24, 1}, {2406, 29, 1}, {2406, 32, 1}, {2406, 41, 1},
+    {2406, 42, 1}, {2406, 43, 2}, {2407, 28, 1}, {2407, 29, 2}, {2407, 32, 1}, {2407, 33, 2},
+    {2407, 34, 3}, {2407, 35, 1}, {2407, 36, 3}, {2407, 38, 1}, {2407, 39, 2}, {2407, 47, 1},
+    {2407, 56, 1}, {2407, 59, 2}, {2407, 60, 3}, {2407, 62, 1}, {2407, 63, 2}, {2407, 64, 3},
+    {2407, 67, 2}, {2407, 68, 3}, {2423, 5, 1}, {2423, 8, 1}, {2423, 9, 1}, {2423, 10, 2},
+    {2423, 11, 2}, {2423, 13, 1}, {2423, 21, 1}, {2423, 22, 2}, {2423, 26, 1}, {2423, 27, 1},
+    {2423, 32, 1}, {2426, 75, 1}, {2426, 76, 2}, {2426, 79, 1}, {2426, 80, 2}, {2426, 81, 3},
+    {2426, 82, 1}, {2426, 83, 3}, {2426, 85, 1}, {2426, 86, 2}, {2426, 93, 1}, {2426, 102, 1},
+    {2426, 105, 2}, {2426, 106, 3}, {2426, 108, 1}, {2426, 109, 2}, {2426, 110, 3}, {2426, 113, 2},
+    {2426, 114, 3}, {2438, 3, 1}, {2438, 4, 1}, {2438, 5, 2}, {2438, 6, 3}, {2438, 9, 1},
+    {2438, 29, 1}, {2438, 30, 1}, {2438, 33, 1}, {2445, 1, 1}, {2445, 3, 2}, {2445, 4, 3},
+    {2445, 5, 1}, {2525, 3, 1}, {2525, 10, 1}, {2525, 13, 1}, {2525, 19, 1}, {2525, 21, 1},
+    {2525, 22, 1}, {2525, 23, 1}, {2525, 24, 2}, {2525, 25, 2}, {2525, 26, 3}, {2525, 27, 3},
+    {2525, 28, 1}, {2525, 29, 1}, {2525, 30, 1}, {2525, 57, 1}, {2525, 64, 1}, {2525, 65, 2},
+    {2525, 68, 1}, {2525, 69, 2}, {2525, 70, 3}, {2525, 71, 1}, {2525, 72, 3}, {2525, 74, 1},
+    {2525, 75, 2}, {2526, 8, 1}, {2526, 36, 1}, {2526, 60, 1}, {2526, 64, 1}, {2526, 66, 1},
+    {2526, 68, 2}, {2526, 70, 2}, {2526, 71, 1}, {2526, 72, 2}, {2526, 80, 1}, {2526, 82, 1},
+    {2526, 83, 1}, {2526, 84, 2}, {2526, 86, 1}, {2526, 89, 1}, {2526, 90, 3}, {2526, 93, 1},
+    {2526, 94, 1}, {2526, 95, 2}, {2526, 96, 1}, {2527, 1, 1}, {2527, 3, 2}, {2527, 4, 3},
+    {2527, 6, 1}, {2527, 8, 1}, {2527, 24, 1}, {2527, 26, 1}, {2527, 29, 1}, {2535, 8, 1},
+    {2535, 11, 2}, {2535, 16, 1}, {2535, 17, 2}, {2535, 18, 1}, {2535, 19, 1}, {2535, 20, 3},
+    {2535, 33, 1}, {2535, 34, 2}, {2535, 96, 1}, {2535, 118, 1}, {2535, 120, 1}, {2535, 126, 1},
+    {2535, 129, 1}, {2535, 131, 1}, {2535, 142, 2}, {2535, 145, 1}, {2535, 147, 1}, {2537, 8, 1},
+    {2537, 10, 1}, {2537, 27, 1}, {2537, 31, 1}, {2537, 51, 1}, {2537, 58, 1}, {2537, 62, 1},
+    {2537, 64, 2}, {2537, 65, 1}, {2537, 84, 1}, {2537, 87, 1}, {2537, 90, 1}, {2537, 92, 1},
+    {2537, 93, 2}, {2537, 99, 1}, {2539, 3, 1}, {2539, 4, 2}, {2539, 8, 1}, {2539, 10, 2},
+    {2539, 11, 3}, {2539, 17, 1}, {2539, 18, 2}, {2539, 21, 1}, {2539, 22, 2}, {2539, 23, 3},
+    {2539, 24, 1}, {2539, 25, 3}, {2539, 27, 1}, {2539, 28, 2}, {2539, 36, 1}, {2539, 45, 1},
+    {2539, 48, 2}, {2539, 49, 3}, {2539, 51, 1}, {2539, 52, 2}, {2539, 53, 3}, {2539, 56, 2},
+    {2539, 57, 3}, {2553, 13, 1}, {2558, 4, 1}, {2558, 11, 1}, {2558, 14, 1}, {2558, 20, 1},
+    {2558, 22, 1}, {2558, 23, 1}, {2558, 24, 1}, {2558, 25, 2}, {2558, 26, 2}, {2558, 27, 3},
+    {2558, 28, 3}, {2558, 29, 1}, {2558, 30, 1}, {2558, 31, 1}, {2568, 8, 1}, {2568, 11, 1},
+    {2568, 13, 2}, {2568, 14, 1}, {2568, 15, 1}, {2568, 16, 2}, {2568, 17, 3}, {2568, 19, 1},
+    {2568, 20, 2}, {2568, 21, 2}, {2568, 22, 2}, {2568, 23, 3}, {2568, 24, 1}, {2568, 26, 2},
+    {2568, 59, 1}, {2568, 60, 2}, {2568, 63, 1}, {2568, 64, 2}, {2568, 65, 3}, {2568, 66, 1},
+    {2568, 67, 3}, {2568, 69, 1}, {2568, 70, 2}, {2568, 144, 1}, {2568, 147, 1}, {2568, 148, 1},
+    {2568, 151, 1}, {2568, 156, 1}, {2568, 164, 1}, {2568, 167, 2}, {2568, 168, 1}, {2568, 169, 1},
+    {2568, 170, 1}, {2568, 171, 1}, {2568, 172, 2}, {2568, 174, 1}, {2568, 177, 1}, {2568, 178, 2},
+    {2568, 179, 2}, {2568, 180, 2}, {2568, 181, 3}, {2568, 182, 1}, {2568, 183, 3}, {2568, 186, 1},
+    {2568, 187, 1}, {2568, 189, 2}, {2568, 190, 2}, {2568, 191, 3}, {2568, 192, 3}, {2568, 205, 1},
+    {2568, 206, 2}, {2568, 207, 3}, {2572, 4, 8}, {2572, 5, 2}, {2572, 6, 11}, {2572, 7, 4},
+    {2572, 8, 6}, {2572, 27, 18}, {2572, 28, 3}, {2572, 29, 5}, {2572, 33, 16}, {2572, 34, 1},
+    {2572, 35, 19}, {2572, 37, 13}, {2572, 38, 14}, {2572, 41, 1}, {2572, 44, 20}, {2572, 45, 25},
+    {2572, 47, 1}, {2572, 48, 6}, {2572, 50, 7}, {2572, 51, 17}, {2572, 52, 18}, {2572, 55, 15},
+    {2572, 56, 8}, {2572, 57, 16}, {2572, 58, 26}, {2572, 59, 26}, {2572, 61, 27}, {2572, 62, 9},
+    {2572, 63, 14}, {2572, 64, 15}, {2572, 65, 16}, {2572, 68, 2}, {2572, 71, 2}, {2572, 72, 1},
+    {2572, 73, 3}, {2572, 74, 4}, {2572, 76, 3}, {2572, 83, 1}, {2572, 87, 1}, {2572, 90, 1},
+    {2572, 91, 1}, {2572, 93, 1}, {2572, 96, 1}, {2572, 97, 2}, {2573, 2, 4}, {2574, 5, 1},
+    {2574, 6, 2}, {2574, 9, 1}, {2574, 10, 2}, {2574, 11, 3}, {2574, 12, 1}, {2574, 13, 3},
+    {2574, 15, 1}, {2574, 16, 2}, {2574, 24, 1}, {2574, 33, 1}, {2574, 36, 2}, {2574, 37, 3},
+    {2574, 39, 1}, {2574, 40, 2}, {2574, 41, 3}, {2574, 44, 2}, {2574, 45, 3}, {2574, 50, 1},
+    {2574, 53, 2}, {2574, 58, 1}, {2574, 59, 2}, {2574, 60, 1}, {2574, 61, 1}, {2574, 62, 3},
+    {2574, 69, 2}, {2574, 70, 1}, {2574, 71, 1}, {2574, 72, 1}, {2574, 73, 2}, {2574, 74, 1},
+    {2574, 75, 2}, {2574, 76, 3}, {2574, 80, 1}, {2574, 81, 2}, {2574, 83, 1}, {2574, 84, 2},
+    {2574, 85, 3}, {2597, 5, 1}, {2597, 6, 2}, {2597, 9, 1}, {2597, 10, 2}, {2597, 11, 3},
+    {2597, 12, 1}, {2597, 13, 3}, {2597, 15, 1}, {2597, 16, 2}, {2597, 24, 1}, {2597, 33, 1},
+    {2597, 36, 2}, {2597, 37, 3}, {2597, 39, 1}, {2597, 40, 2}, {2597, 41, 3}, {2597, 44, 2},
+    {2597, 45, 3}, {2597, 48, 1}, {2597, 53, 1}, {2597, 54, 1}, {2597, 62, 1}, {2597, 68, 1},
+    {2597, 69, 1}, {2597, 73, 1}, {2618, 2, 1}, {2618, 5, 1}, {2618, 6, 1}, {2657, 4, 1},
+    {2657, 11, 1}, {2657, 14, 1}, {2657, 20, 1}, {2657, 22, 1}, {2657, 23, 1}, {2657, 24, 1},
+    {2657, 25, 2}, {2657, 26, 2}, {2657, 27, 3}, {2657, 28, 3}, {2657, 29, 1}, {2657, 30, 1},
+    {2657, 31, 1}, {2657, 36, 1}, {2657, 65, 1}, {2657, 66, 2}, {2657, 67, 1}, {2657, 68, 2},
+    {2657, 69, 1}, {2657, 70, 2}, {2657, 72, 1}, {2657, 74, 1}, {2657, 76, 1}, {2657, 78, 1},
+    {2657, 79, 2}, {2657, 80, 2}, {2657, 81, 2}, {2657, 83, 1}, {2657, 85, 1}, {2657, 86, 2},
+    {2657, 87, 2}, {2657, 88, 3}, {2657, 89, 3}, {2658, 33, 1}, {2658, 42, 1}, {2658, 45, 2},
+    {2658, 46, 3}, {2658, 48, 1}, {2658, 49, 2}, {2658, 50, 3}, {2658, 53, 2}, {2658, 54, 3},
+    {2662, 4, 1}, {2679, 3, 1}, {2679, 12, 1}, {2679, 18, 1}, {2679, 20, 1}, {2679, 21, 1},
+    {2679, 22, 1}, {2679, 23, 2}, {2679, 24, 2}, {2679, 25, 3}, {2679, 26, 3}, {2679, 27, 1},
+    {2679, 28, 1}, {2679, 29, 1}, {2679, 71, 4}, {2679, 73, 3}, {2679, 77, 1}, {2679, 82, 1},
+    {2679, 83, 2}, {2679, 86, 1}, {2679, 87, 2}, {2679, 88, 3}, {2679, 89, 1}, {2679, 90, 3},
+    {2679, 92, 1}, {2679, 93, 2}, {2679, 100, 1}, {2679, 109, 1}, {2679, 112, 2}, {2679, 113, 3},
+    {2679, 115, 1}, {2679, 116, 2}, {2679, 117, 3}, {2679, 120, 2}, {2679, 121, 3}, {2691, 3, 1},
+    {2691, 7, 1}, {2691, 8, 2}, {2691, 9, 1}, {2691, 10, 1}, {2691, 11, 3}, {2691, 12, 1},
+    {2691, 14, 1}, {2691, 15, 2}, {2691, 16, 3}, {2691, 17, 2}, {2691, 18, 2}, {2691, 19, 2},
+    {2691, 20, 3}, {2691, 21, 2}, {2691, 22, 3}, {2691, 24, 1}, {2691, 25, 3}, {2691, 26, 2},
+    {2691, 27, 3}, {2691, 28, 3}, {2699, 8, 1}, {2699, 12, 1}, {2699, 13, 1}, {2699, 15, 2},
+    {2699, 17, 1}, {2699, 18, 2}, {2699, 19, 1}, {2699, 20, 2}, {2699, 22, 2}, {2699, 23, 3},
+    {2699, 24, 3}, {2699, 27, 1}, {2699, 28, 2}, {2699, 29, 1}, {2699, 30, 1}, {2699, 31, 3},
+    {2699, 32, 3}, {2699, 34, 2}, {2699, 35, 2}, {2699, 36, 3}, {2699, 37, 2}, {2699, 66, 1},
+    {2699, 68, 2}, {2701, 4, 1}, {2701, 8, 1}, {2701, 9, 2}, {2701, 10, 1}, {2701, 11, 1},
+    {2701, 12, 3}, {2701, 13, 1}, {2701, 15, 1}, {2701, 16, 2}, {2701, 17, 3}, {2701, 18, 2},
+    {2701, 19, 2}, {2701, 20, 2}, {2701, 21, 3}, {2701, 22, 2}, {2701, 23, 3}, {2701, 25, 1},
+    {2701, 26, 3}, {2701, 27, 2}, {2701, 28, 3}, {2701, 29, 3}, {2701, 35, 1}, {2701, 38, 2},
+    {2701, 39, 1}, {2701, 40, 1}, {2701, 41, 1}, {2701, 42, 1}, {2701, 43, 2}, {2701, 45, 1},
+    {2701, 48, 1}, {2701, 49, 2}, {2701, 50, 2}, {2701, 51, 2}, {2701, 52, 3}, {2701, 53, 1},
+    {2701, 54, 3}, {2701, 112, 1}, {2701, 113, 2}, {2701, 114, 3}, {2703, 4, 1}, {2703, 7, 2},
+    {2703, 8, 1}, {2703, 9, 1}, {2703, 10, 1}, {2703, 11, 1}, {2703, 12, 2}, {2703, 14, 1},
+    {2703, 17, 1}, {2703, 18, 2}, {2703, 19, 2}, {2703, 20, 2}, {2703, 21, 3}, {2703, 22, 1},
+    {2703, 23, 3}, {2703, 29, 1}, {2703, 36, 1}, {2703, 39, 1}, {2703, 45, 1}, {2703, 47, 1},
+    {2703, 48, 1}, {2703, 49, 1}, {2703, 50, 2}, {2703, 51, 2}, {2703, 52, 3}, {2703, 53, 3},
+    {2703, 54, 1}, {2703, 55, 1}, {2703, 56, 1}, {2703, 59, 1}, {2703, 63, 1}, {2703, 64, 2},
+    {2703, 65, 1}, {2703, 66, 1}, {2703, 67, 3}, {2703, 68, 1}, {2703, 70, 1}, {2703, 71, 2},
+    {2703, 72, 3}, {2703, 73, 2}, {2703, 74, 2}, {2703, 75, 2}, {2703, 76, 3}, {2703, 77, 2},
+    {2703, 78, 3}, {2703, 80, 1}, {2703, 81, 3}, {2703, 82, 2}, {2703, 83, 3}, {2703, 84, 3},
+    {2705, 7, 1}, {2705, 10, 1}, {2705, 12, 1}, {2705, 14, 2}, {2705, 15, 1}, {2705, 16, 2},
+    {2705, 17, 2}, {2705, 18, 1}, {2705, 19, 1}, {2705, 20, 2}, {2705, 21, 2}, {2705, 22, 3},
+    {2705, 24, 3}, {2705, 25, 3}, {2705, 26, 1}, {2705, 27, 1}, {2707, 3, 1}, {2707, 7, 1},
+    {2707, 8, 2}, {2707, 9, 1}, {2707, 10, 1}, {2707, 11, 3}, {2707, 12, 1}, {2707, 14, 1},
+    {2707, 15, 2}, {2707, 16, 3}, {2707, 17, 2}, {2707, 18, 2}, {2707, 19, 2}, {2707, 20, 3},
+    {2707, 21, 2}, {2707, 22, 3}, {2707, 24, 1}, {2707, 25, 3}, {2707, 26, 2}, {2707, 27, 3},
+    {2707, 28, 3}, {2707, 34, 1}, {2707, 37, 2}, {2707, 38, 1}, {2707, 39, 1}, {2707, 40, 1},
+    {2707, 41, 1}, {2707, 42, 2}, {2707, 44, 1}, {2707, 47, 1}, {2707, 48, 2}, {2707, 49, 2},
+    {2707, 50, 2}, {2707, 51, 3}, {2707, 52, 1}, {2707, 53, 3}, {2731, 21, 1}, {2731, 28, 1},
+    {2731, 29, 3}, {2731, 30, 4}, {2731, 39, 1}, {2731, 47, 1}, {2731, 50, 1}, {2731, 57, 1},
+    {2731, 60, 1}, {2731, 61, 2}, {2733, 7, 1}, {2733, 8, 2}, {2733, 11, 1}, {2733, 12, 2},
+    {2733, 13, 3}, {2733, 14, 1}, {2733, 15, 3}, {2733, 17, 1}, {2733, 18, 2}, {2733, 26, 1},
+    {2733, 35, 1}, {2733, 38, 2}, {2733, 39, 3}, {2733, 41, 1}, {2733, 42, 2}, {2733, 43, 3},
+    {2733, 46, 2}, {2733, 47, 3}, {2751, 10, 1}, {2751, 14, 1}, {2751, 16, 1}, {2751, 17, 1},
+    {2751, 18, 2}, {2751, 20, 2}, {2751, 21, 2}, {2751, 22, 2}, {2751, 23, 3}, {2751, 25, 3},
+    {2751, 26, 3}, {2751, 27, 3}, {2752, 7, 2}, {2752, 11, 1}, {2752, 12, 1}, {2752, 13, 2},
+    {2752, 14, 1}, {2752, 15, 1}, {2752, 16, 2}, {2752, 17, 2}, {2752, 19, 2}, {2752, 21, 2},
+    {2752, 23, 1}, {2752, 25, 3}, {2752, 30, 1}, {2752, 33, 1}, {2752, 36, 2}, {2752, 37, 1},
+    {2752, 42, 2}, {2752, 44, 1}, {2752, 45, 1}, {2752, 46, 2}, {2752, 47, 1}, {2752, 53, 1},
+    {2755, 4, 8}, {2755, 5, 2}, {2755, 6, 11}, {2755, 7, 4}, {2755, 8, 6}, {2755, 25, 13},
+    {2755, 28, 14}, {2755, 30, 11}, {2755, 31, 12}, {2755, 34, 1}, {2755, 37, 2}, {2755, 38, 1},
+    {2755, 39, 3}, {2755, 40, 4}, {2755, 41, 2}, {2755, 42, 3}, {2755, 43, 5}, {2755, 44, 1},
+    {2755, 47, 2}, {2755, 48, 3}, {2755, 51, 1}, {2755, 53, 1}, {2755, 57, 1}, {2755, 58, 1},
+    {2755, 64, 1}, {2755, 65, 2}, {2755, 66, 1}, {2755, 70, 2}, {2755, 87, 15}, {2755, 89, 6},
+    {2755, 90, 13}, {2755, 91, 7}, {2755, 93, 4}, {2755, 94, 12}, {2755, 96, 8}, {2755, 97, 12},
+    {2755, 98, 13}, {2755, 101, 3}, {2755, 102, 12}, {2755, 103, 1}, {2755, 104, 13},
+    {2755, 106, 12}, {2755, 107, 13}, {2755, 108, 14}, {2755, 109, 13}, {2755, 110, 14},
+    {2755, 111, 9}, {2755, 113, 1}, {2756, 2, 4}, {2863, 9, 1}, {2863, 10, 2}, {2863, 13, 1},
+    {2863, 14, 2}, {2863, 15, 3}, {2863, 16, 1}, {2863, 17, 3}, {2863, 19, 1}, {2863, 20, 2},
+    {2863, 28, 1}, {2863, 37, 1}, {2863, 40, 2}, {2863, 41, 3}, {2863, 43, 1}, {2863, 44, 2},
+    {2863, 45, 3}, {2863, 48, 2}, {2863, 49, 3}, {2863, 51, 1}, {2863, 52, 2}, {2863, 53, 1},
+    {2863, 54, 2}, {2863, 55, 1}, {2863, 56, 2}, {2863, 57, 1}, {2863, 58, 2}, {2863, 59, 1},
+    {2863, 60, 2}, {2865, 8, 1}, {2865, 40, 1}, {2865, 80, 1}, {2865, 82, 2}, {2865, 86, 1},
+    {2865, 90, 1}, {2865, 93, 1}, {2865, 95, 1}, {2865, 96, 2}, {2865, 102, 1}, {2865, 107, 1},
+    {2865, 108, 2}, {2865, 109, 1}, {2865, 110, 1}, {2865, 116, 2}, {2865, 117, 2}, {2865, 123, 1},
+    {2865, 124, 1}, {2865, 125, 2}, {2865, 126, 1}, {2866, 9, 1}, {2867, 12, 1}, {2867, 14, 2},
+    {2867, 15, 3}, {2867, 25, 1}, {2867, 28, 2}, {2867, 29, 1}, {2867, 30, 1}, {2867, 31, 1},
+    {2867, 32, 1}, {2867, 33, 2}, {2867, 35, 1}, {2867, 38, 1}, {2867, 39, 2}, {2867, 40, 2},
+    {2867, 41, 2}, {2867, 42, 3}, {2867, 43, 1}, {2867, 44, 3}, {2867, 56, 1}, {2867, 61, 1},
+    {2867, 71, 1}, {2867, 75, 1}, {2867, 84, 1}, {2867, 85, 2}, {2867, 87, 1}, {2867, 89, 1},
+    {2867, 90, 2}, {2867, 91, 3}, {2869, 1, 1}, {2869, 15, 1}, {2869, 16, 2}, {2869, 19, 1},
+    {2889, 32, 1}, {2889, 33, 2}, {2889, 37, 1}, {2889, 38, 1}, {2889, 40, 2}, {2889, 41, 2},
+    {2889, 42, 3}, {2889, 43, 3}, {2889, 47, 1}, {2889, 50, 1}, {2889, 51, 2}, {2929, 3, 1},
+    {2929, 8, 1}, {2929, 11, 3}, {2929, 14, 1}, {2929, 16, 1}, {2929, 17, 2}, {2929, 18, 5},
+    {2929, 20, 1}, {2929, 23, 1}, {2929, 27, 1}, {2929, 29, 1}, {2929, 30, 2}, {2929, 33, 1},
+    {2929, 37, 1}, {2929, 38, 2}, {2929, 39, 3}, {2929, 43, 1}, {2929, 44, 2}, {2929, 46, 3},
+    {2929, 47, 1}, {2929, 48, 2}, {2929, 49, 3}, {2929, 50, 1}, {2929, 51, 2}, {2929, 52, 6},
+    {2929, 53, 7}, {2929, 55, 1}, {2929, 62, 1}, {2929, 63, 1}, {2929, 66, 1}, {2929, 70, 1},
+    {2929, 72, 1}, {2929, 75, 1}, {2929, 76, 1}, {2929, 79, 1}, {2929, 80, 2}, {2929, 83, 1},
+    {2929, 85, 4}, {2929, 86, 4}, {2929, 87, 2}, {2929, 88, 3}, {2929, 89, 4}, {2929, 90, 2},
+    {2929, 92, 1}, {2929, 93, 1}, {2929, 94, 1}, {2929, 102, 1}, {2929, 105, 2}, {2929, 106, 1},
+    {2929, 107, 1}, {2929, 108, 1}, {2929, 109, 1}, {2929, 110, 2}, {2929, 112, 1}, {2929, 115, 1},
+    {2929, 116, 2}, {2929, 117, 2}, {2929, 118, 2}, {2929, 119, 3}, {2929, 120, 1}, {2929, 121, 3},
+    {2929, 124, 1}, {2929, 125, 2}, {2929, 126, 3}, {2932, 2, 1}, {2932, 3, 1}, {2932, 5, 1},
+    {2932, 7, 2}, {2932, 8, 1}, {2932, 9, 2}, {2932, 10, 3}, {2932, 12, 1}, {2932, 13, 2},
+    {2932, 14, 2}, {2932, 15, 3}, {2932, 17, 3}, {2949, 48, 1}, {2949, 52, 1}, {2949, 53, 1},
+    {2949, 55, 2}, {2949, 57, 1}, {2949, 58, 2}, {2949, 59, 1}, {2949, 60, 2}, {2949, 62, 2},
+    {2949, 63, 3}, {2949, 64, 3}, {2949, 67, 1}, {2949, 68, 2}, {2949, 69, 1}, {2949, 70, 1},
+    {2949, 71, 3}, {2949, 72, 3}, {2949, 74, 2}, {2949, 75, 2}, {2949, 76, 3}, {2949, 77, 2},
+    {2953, 2, 1}, {2956, 32, 1}, {2956, 35, 1}, {2956, 37, 1}, {2956, 39, 2}, {2956, 40, 1},
+    {2956, 41, 2}, {2956, 42, 2}, {2956, 43, 1}, {2956, 44, 1}, {2956, 45, 2}, {2956, 46, 2},
+    {2956, 47, 3}, {2956, 49, 3}, {2956, 50, 3}, {2956, 51, 1}, {2956, 52, 1}, {2956, 177, 1},
+    {2956, 178, 1}, {2956, 179, 2}, {2956, 180, 3}, {2956, 183, 1}, {2956, 192, 1}, {2956, 193, 2},
+    {2956, 235, 1}, {2956, 238, 1}, {2956, 240, 1}, {2956, 241, 1}, {2956, 242, 2}, {2956, 243, 3},
+    {2956, 245, 1}, {2956, 246, 2}, {2956, 247, 2}, {2956, 248, 2}, {2956, 249, 3}, {2956, 250, 3},
+    {2956, 251, 2}, {2956, 254, 3}, {2956, 255, 2}, {2956, 256, 3}, {2957, 46, 1}, {2957, 52, 1},
+    {2957, 53, 1}, {2957, 57, 1}, {2957, 61, 1}, {2957, 72, 1}, {2964, 3, 1}, {2964, 10, 1},
+    {2964, 13, 1}, {2964, 19, 1}, {2964, 21, 1}, {2964, 22, 1}, {2964, 23, 1}, {2964, 24, 2},
+    {2964, 25, 2}, {2964, 26, 3}, {2964, 27, 3}, {2964, 28, 1}, {2964, 29, 1}, {2964, 30, 1},
+    {2964, 34, 1}, {2964, 38, 1}, {2964, 39, 2}, {2964, 40, 1}, {2964, 41, 1}, {2964, 42, 3},
+    {2964, 43, 1}, {2964, 45, 1}, {2964, 46, 2}, {2964, 47, 3}, {2964, 48, 2}, {2964, 49, 2},
+    {2964, 50, 2}, {2964, 51, 3}, {2964, 52, 2}, {2964, 53, 3}, {2964, 55, 1}, {2964, 56, 3},
+    {2964, 57, 2}, {2964, 58, 3}, {2964, 59, 3}, {2964, 65, 1}, {2964, 68, 2}, {2964, 69, 1},
+    {2964, 70, 1}, {2964, 71, 1}, {2964, 72, 1}, {2964, 73, 2}, {2964, 75, 1}, {2964, 78, 1},
+    {2964, 79, 2}, {2964, 80, 2}, {2964, 81, 2}, {2964, 82, 3}, {2964, 83, 1}, {2964, 84, 3},
+    {2964, 203, 1}, {2964, 205, 1}, {2964, 206, 2}, {2964, 207, 3}, {2972, 5, 1}, {2972, 6, 2},
+    {2972, 11, 1}, {2972, 13, 1}, {2972, 15, 1}, {2972, 20, 1}, {2972, 23, 2}, {2972, 24, 1},
+    {2972, 25, 1}, {2972, 26, 1}, {2972, 27, 1}, {2972, 28, 2}, {2972, 30, 1}, {2972, 33, 1},
+    {2972, 34, 2}, {2972, 35, 2}, {2972, 36, 2}, {2972, 37, 3}, {2972, 38, 1}, {2972, 39, 3},
+    {2972, 47, 1}, {2972, 49, 1}, {2972, 50, 2}, {2972, 51, 3}, {2972, 55, 1}, {2972, 60, 1},
+    {2972, 69, 1}, {2972, 70, 2}, {2972, 71, 3}, {2986, 6, 1}, {2986, 7, 2}, {2986, 10, 1},
+    {2986, 11, 2}, {2986, 12, 1}, {2986, 13, 2}, {2986, 14, 3}, {2986, 16, 3}, {2986, 19, 1},
+    {2986, 20, 2}, {2986, 21, 1}, {2986, 22, 2}, {2986, 23, 3}, {2986, 24, 3}, {2986, 35, 1},
+    {2986, 36, 2}, {2986, 39, 1}, {2986, 40, 2}, {2986, 41, 3}, {2986, 42, 2}, {2986, 43, 3},
+    {2986, 45, 1}, {2986, 46, 2}, {2986, 53, 1}, {2986, 62, 1}, {2986, 65, 2}, {2986, 66, 3},
+    {2986, 68, 1}, {2986, 69, 2}, {2986, 70, 3}, {2986, 73, 2}, {2986, 74, 3}, {2986, 80, 1},
+    {2986, 86, 1}, {2986, 101, 1}, {2986, 102, 2}, {2986, 103, 1}, {2986, 104, 2}, {2986, 105, 1},
+    {2986, 106, 2}, {2986, 107, 1}, {2986, 108, 2}, {2986, 109, 1}, {2986, 110, 2}, {2986, 112, 1},
+    {2986, 113, 2}, {2986, 115, 1}, {2986, 120, 1}, {2986, 121, 1}, {2986, 122, 1}, {2986, 127, 1},
+    {2986, 132, 2}, {2986, 139, 2}, {2986, 144, 1}, {2986, 145, 2}, {2986, 146, 3}, {2986, 147, 2},
+    {2986, 148, 3}, {2986, 149, 3}, {2988, 2, 1}, {2988, 5, 2}, {2988, 16, 1}, {2988, 18, 1},
+    {2988, 41, 1}, {2988, 44, 1}, {2988, 46, 1}, {2988, 49, 1}, {2988, 57, 1}, {2988, 59, 1},
+    {2988, 60, 1}, {2988, 64, 1}, {2990, 4, 1}, {2990, 5, 2}, {2990, 9, 1}, {2990, 10, 2},
+    {2990, 26, 1}, {2990, 29, 1}, {2992, 4, 1}, {2992, 16, 1}, {2992, 18, 1}, {2992, 43, 1},
+    {2992, 56, 1}, {2992, 59, 1}, {2992, 60, 1}, {2992, 65, 1}, {2992, 74, 1}, {2992, 76, 1},
+    {2992, 77, 1}, {2992, 79, 1}, {2996, 33, 1}, {2996, 97, 1}, {2996, 99, 1}, {2996, 100, 1},
+    {2996, 102, 1}, {2996, 103, 2}, {2996, 105, 1}, {2996, 106, 2}, {2996, 107, 1}, {2996, 108, 1},
+    {2996, 109, 2}, {2996, 110, 3}, {2996, 118, 2}, {2996, 125, 1}, {2996, 126, 1}, {2996, 129, 2},
+    {2996, 131, 2}, {2996, 132, 3}, {2996, 135, 3}, {2996, 136, 2}, {2996, 137, 1}, {2996, 138, 1},
+    {2997, 1, 1}, {2997, 3, 2}, {2997, 4, 3}, {2997, 13, 1}, {2997, 17, 1}, {2997, 18, 1},
+    {2997, 20, 2}, {2997, 22, 1}, {2997, 23, 2}, {2997, 24, 1}, {2997, 25, 2}, {2997, 27, 2},
+    {2997, 28, 3}, {2997, 29, 3}, {2997, 32, 1}, {2997, 33, 2}, {2997, 34, 1}, {2997, 35, 1},
+    {2997, 36, 3}, {2997, 37, 3}, {2997, 39, 2}, {2997, 40, 2}, {2997, 41, 3}, {2997, 42, 2},
+    {2997, 56, 2}, {2997, 85, 1}, {2997, 87, 1}, {2997, 88, 2}, {2997, 89, 3}, {2997, 90, 2},
+    {2997, 92, 3}, {2997, 93, 1}, {2997, 96, 1}, {2997, 97, 1}, {2997, 98, 2}, {2997, 99, 4},
+    {2997, 100, 2}, {2997, 101, 2}, {2997, 102, 3}, {2997, 103, 3}, {2997, 104, 5}, {2997, 118, 1},
+    {3023, 6, 3}, {3023, 10, 3}, {3023, 11, 1}, {3023, 12, 3}, {3023, 13, 1}, {3023, 14, 1},
+    {3023, 15, 2}, {3023, 16, 2}, {3023, 18, 4}, {3023, 20, 2}, {3023, 22, 1}, {3023, 24, 3},
+    {3023, 35, 1}, {3023, 43, 1}, {3023, 44, 1}, {3023, 45, 2}, {3023, 46, 1}, {3029, 3, 1},
+    {3029, 5, 1}, {3029, 7, 1}, {3029, 9, 1}, {3029, 17, 1}, {3029, 28, 1}, {3029, 30, 1},
+    {3029, 32, 1}, {3029, 34, 1}, {3029, 36, 1}, {3029, 45, 1}, {3029, 46, 1}, {3030, 101, 1},
+    {3030, 107, 1}, {3030, 108, 1}, {3030, 113, 1}, {3030, 122, 1}, {3030, 123, 1}, {3030, 128, 1},
+    {3030, 137, 1}, {3030, 140, 1}, {3030, 143, 1}, {3030, 144, 1}, {3030, 151, 1}, {3030, 152, 2},
+    {3030, 153, 1}, {3030, 154, 2}, {3030, 155, 1}, {3031, 1, 1}, {3031, 3, 2}, {3031, 4, 3},
+    {3031, 10, 1}, {3031, 11, 2}, {3031, 14, 1}, {3031, 15, 2}, {3031, 16, 3}, {3031, 17, 1},
+    {3031, 18, 3}, {3031, 20, 1}, {3031, 21, 2}, {3031, 29, 1}, {3031, 38, 1}, {3031, 41, 2},
+    {3031, 42, 3}, {3031, 44, 1}, {3031, 45, 2}, {3031, 46, 3}, {3031, 49, 2}, {3031, 50, 3},
+    {3031, 62, 1}, {3031, 69, 1}, {3031, 72, 1}, {3031, 78, 1}, {3031, 80, 1}, {3031, 81, 1},
+    {3031, 82, 1}, {3031, 83, 2}, {3031, 84, 2}, {3031, 85, 3}, {3031, 86, 3}, {3031, 87, 1},
+    {3031, 88, 1}, {3031, 89, 1}, {3031, 92, 1}, {3031, 96, 1}, {3031, 97, 2}, {3031, 98, 1},
+    {3031, 99, 1}, {3031, 100, 3}, {3031, 101, 1}, {3031, 103, 1}, {3031, 104, 2}, {3031, 105, 3},
+    {3031, 106, 2}, {3031, 107, 2}, {3031, 108, 2}, {3031, 109, 3}, {3031, 110, 2}, {3031, 111, 3},
+    {3031, 113, 1}, {3031, 114, 3}, {3031, 115, 2}, {3031, 116, 3}, {3031, 117, 3}, {3031, 123, 1},
+    {3031, 126, 2}, {3031, 127, 1}, {3031, 128, 1}, {3031, 129, 1}, {3031, 130, 1}, {3031, 131, 2},
+    {3031, 133, 1}, {3031, 136, 1}, {3031, 137, 2}, {3031, 138, 2}, {3031, 139, 2}, {3031, 140, 3},
+    {3031, 141, 1}, {3031, 142, 3}, {3031, 223, 1}, {3031, 224, 2}, {3031, 225, 3}, {3033, 1, 1},
+    {3033, 3, 1}, {3033, 4, 2}, {3033, 5, 3}, {3033, 20, 1}, {3033, 21, 1}, {3033, 22, 2},
+    {3033, 23, 1}, {3033, 24, 1}, {3033, 26, 1}, {3033, 27, 2}, {3033, 28, 2}, {3033, 29, 1},
+    {3033, 30, 2}, {3033, 34, 1}, {3033, 35, 2}, {3033, 36, 1}, {3033, 37, 2}, {3033, 38, 3},
+    {3033, 40, 3}, {3033, 43, 1}, {3033, 44, 2}, {3033, 45, 1}, {3033, 46, 2}, {3033, 47, 3},
+    {3033, 48, 3}, {3034, 6, 1}, {3034, 7, 1}, {3034, 17, 2}, {3034, 31, 1}, {3034, 33, 1},
+    {3034, 69, 1}, {3034, 70, 1}, {3034, 72, 2}, {3034, 79, 1}, {3034, 85, 1}, {3034, 86, 2},
+    {3034, 99, 1}, {3034, 100, 1}, {3034, 103, 3}, {3037, 9, 1}, {3037, 10, 2}, {3037, 13, 1},
+    {3037, 14, 2}, {3037, 15, 3}, {3037, 16, 1}, {3037, 17, 3}, {3037, 19, 1}, {3037, 20, 2},
+    {3037, 28, 1}, {3037, 37, 1}, {3037, 40, 2}, {3037, 41, 3}, {3037, 43, 1}, {3037, 44, 2},
+    {3037, 45, 3}, {3037, 48, 2}, {3037, 49, 3}, {3037, 64, 1}, {3037, 65, 2}, {3037, 67, 1},
+    {3037, 68, 2}, {3037, 70, 1}, {3037, 71, 3}, {3037, 73, 2}, {3037, 75, 1}, {3037, 76, 2},
+    {3037, 92, 1}, {3037, 93, 2}, {3037, 94, 1}, {3037, 95, 2}, {3037, 96, 1}, {3037, 98, 1},
+    {3037, 99, 2}, {3037, 100, 3}, {3039, 4, 1}, {3039, 9, 1}, {3039, 12, 1}, {3039, 28, 1},
+    {3039, 32, 1}, {3039, 34, 1}, {3039, 35, 2}, {3039, 36, 1}, {3039, 38, 1}, {3039, 40, 1},
+    {3039, 44, 1}, {3039, 45, 2}, {3039, 46, 3}, {3039, 47, 1}, {3039, 50, 1}, {3039, 53, 2},
+    {3039, 54, 1}, {3039, 55, 1}, {3039, 56, 2}, {3039, 57, 1}, {3039, 58, 2}, {3039, 60, 1},
+    {3039, 62, 2}, {3039, 63, 2}, {3039, 64, 3}, {3039, 65, 1}, {3039, 66, 3}, {3039, 72, 1},
+    {3039, 73, 2}, {3039, 75, 3}, {3039, 76, 1}, {3039, 77, 2}, {3039, 78, 3}, {3039, 79, 1},
+    {3039, 80, 2}, {3039, 85, 1}, {3039, 87, 1}, {3039, 88, 2}, {3039, 90, 1}, {3039, 91, 2},
+    {3039, 92, 3}, {3039, 96, 1}, {3039, 98, 1}, {3039, 105, 1}, {3039, 106, 1}, {3039, 109, 1},
+    {3039, 117, 1}, {3039, 119, 1}, {3039, 122, 1}, {3039, 123, 1}, {3039, 125, 1}, {3039, 126, 1},
+    {3039, 127, 2}, {3039, 130, 1}, {3045, 20, 1}, {3045, 26, 1}, {3045, 28, 1}, {3045, 29, 1},
+    {3045, 33, 1}, {3045, 34, 1}, {3045, 35, 2}, {3045, 39, 1}, {3045, 40, 1}, {3045, 42, 2},
+    {3045, 44, 3}, {3045, 45, 3}, {3045, 46, 1}, {3045, 47, 1}, {3045, 48, 1}, {3045, 49, 1},
+    {3045, 50, 2}, {3048, 1, 1}, {3048, 3, 2}, {3048, 4, 3}, {3048, 11, 1}, {3048, 12, 2},
+    {3048, 14, 1}, {3048, 48, 1}, {3048, 49, 2}, {3048, 52, 1}, {3048, 53, 2}, {3048, 54, 3},
+    {3048, 55, 1}, {3048, 56, 3}, {3048, 58, 1}, {3048, 59, 2}, {3048, 67, 1}, {3048, 76, 1},
+    {3048, 79, 2}, {3048, 80, 3}, {3048, 82, 1}, {3048, 83, 2}, {3048, 84, 3}, {3048, 87, 2},
+    {3048, 88, 3}, {3048, 102, 1}, {3051, 32, 1}, {3051, 35, 1}, {3051, 41, 1}, {3051, 42, 1},
+    {3051, 44, 1}, {3051, 46, 1}, {3051, 47, 1}, {3053, 1, 1}, {3053, 3, 1}, {3053, 4, 2},
+    {3053, 5, 3}, {3053, 30, 1}, {3053, 31, 2}, {3053, 39, 1}, {3053, 40, 1}, {3053, 50, 2},
+    {3053, 55, 1}, {3053, 56, 1}, {3053, 58, 1}, {3053, 59, 2}, {3053, 73, 1}, {3053, 74, 2},
+    {3053, 75, 3}, {3073, 2, 1}, {3073, 6, 1}, {3073, 7, 1}, {3091, 6, 1}, {3091, 7, 2},
+    {3091, 10, 1}, {3091, 11, 2}, {3091, 12, 3}, {3091, 13, 1}, {3091, 14, 3}, {3091, 16, 1},
+    {3091, 17, 2}, {3112, 2, 1}, {3159, 69, 6}, {3159, 71, 7}, {3159, 77, 1}, {3159, 79, 2},
+    {3159, 80, 8}, {3159, 81, 5}, {3159, 82, 1}, {3159, 83, 2}, {3159, 84, 2}, {3159, 85, 2},
+    {3159, 86, 1}, {3159, 87, 1}, {3159, 88, 3}, {3159, 89, 2}, {3159, 90, 3}, {3159, 92, 3},
+    {3159, 93, 3}, {3159, 94, 3}, {3159, 95, 5}, {3159, 96, 6}, {3159, 97, 7}, {3159, 98, 4},
+    {3162, 60, 1}, {3162, 61, 2}, {3162, 62, 1}, {3162, 63, 1}, {3162, 64, 2}, {3162, 65, 2},
+    {3162, 66, 3}, {3162, 69, 5}, {3162, 71, 6}, {3162, 77, 1}, {3162, 79, 2}, {3162, 80, 8},
+    {3162, 81, 1}, {3162, 82, 1}, {3162, 83, 2}, {3162, 84, 1}, {3162, 85, 2}, {3162, 86, 1},
+    {3162, 87, 1}, {3162, 88, 3}, {3162, 89, 2}, {3162, 90, 3}, {3162, 92, 3}, {3162, 93, 3},
+    {3162, 94, 3}, {3162, 95, 1}, {3162, 96, 2}, {3162, 97, 3}, {3162, 98, 4}, {3169, 6, 1},
+    {3169, 7, 1}, {3169, 13, 1}, {3169, 14, 1}, {3169, 15, 2}, {3169, 22, 1}, {3169, 28, 1},
+    {3169, 29, 1}, {3169, 31, 1}, {3169, 33, 1}, {3169, 35, 1}, {3169, 36, 1}, {3169, 43, 1},
+    {3169, 45, 1}, {3169, 46, 1}, {3169, 52, 1}, {3169, 53, 1}, {3170, 3, 1}, {3171, 4, 1},
+    {3171, 6, 2}, {3171, 7, 3}, {3171, 12, 1}, {3171, 15, 2}, {3171, 16, 1}, {3171, 17, 1},
+    {3171, 18, 1}, {3171, 19, 1}, {3171, 20, 2}, {3171, 22, 1}, {3171, 25, 1}, {3171, 26, 2},
+    {3171, 27, 2}, {3171, 28, 2}, {3171, 29, 3}, {3171, 30, 1}, {3171, 31, 3}, {3171, 34, 1},
+    {3171, 62, 1}, {3171, 63, 2}, {3171, 64, 3}, {3172, 4, 1}, {3172, 19, 1}, {3172, 23, 1},
+    {3172, 24, 1}, {3172, 25, 2}, {3172, 32, 1}, {3172, 37, 1}, {3172, 38, 2}, {3172, 39, 1},
+    {3172, 40, 1}, {3172, 42, 2}, {3172, 43, 3}, {3182, 6, 3}, {3182, 10, 3}, {3182, 11, 1},
+    {3182, 12, 3}, {3182, 13, 1}, {3182, 14, 1}, {3182, 15, 2}, {3182, 16, 2}, {3182, 18, 4},
+    {3182, 20, 2}, {3182, 22, 1}, {3182, 24, 3}, {3182, 30, 1}, {3182, 36, 1}, {3182, 37, 1},
+    {3182, 38, 2}, {3182, 39, 2}, {3182, 40, 1}, {3182, 42, 3}, {3182, 43, 3}, {3182, 44, 4},
+    {3182, 46, 1}, {3182, 47, 2}, {3182, 49, 1}, {3182, 54, 1}, {3182, 55, 2}, {3182, 56, 1},
+    {3182, 57, 2}, {3182, 58, 1}, {3182, 61, 1}, {3182, 62, 2}, {3182, 63, 3}, {3185, 49, 1},
+    {3185, 55, 1}, {3185, 56, 1}, {3185, 60, 1}, {3186, 9, 1}, {3186, 26, 1}, {3186, 27, 1},
+    {3186, 28, 2}, {3186, 29, 1}, {3186, 82, 1}, {3186, 85, 1}, {3186, 87, 1}, {3186, 89, 2},
+    {3186, 90, 1}, {3186, 91, 2}, {3186, 92, 2}, {3186, 93, 1}, {3186, 94, 1}, {3186, 95, 2},
+    {3186, 96, 2}, {3186, 97, 3}, {3186, 99, 3}, {3186, 100, 3}, {3186, 101, 1}, {3186, 102, 1},
+    {3186, 107, 1}, {3186, 108, 2}, {3186, 110, 1}, {3186, 111, 3}, {3186, 113, 2}, {3186, 115, 1},
+    {3186, 119, 1}, {3186, 120, 2}, {3186, 121, 1}, {3186, 123, 1}, {3186, 124, 2}, {3186, 126, 2},
+    {3186, 127, 1}, {3186, 130, 3}, {3188, 7, 1}, {3188, 16, 1}, {3188, 19, 2}, {3188, 20, 3},
+    {3188, 22, 1}, {3188, 23, 2}, {3188, 24, 3}, {3188, 27, 2}, {3188, 28, 3}, {3188, 33, 1},
+    {3188, 34, 2}, {3188, 37, 1}, {3188, 38, 2}, {3188, 39, 3}, {3188, 40, 1}, {3188, 41, 3},
+    {3188, 43, 1}, {3188, 44, 2}, {3190, 2, 1}, {3190, 4, 1}, {3190, 18, 1}, {3190, 19, 2},
+    {3190, 21, 1}, {3190, 22, 1}, {3190, 27, 1}, {3190, 28, 2}, {3190, 30, 1}, {3190, 31, 2},
+    {3190, 32, 1}, {3190, 34, 2}, {3190, 36, 1}, {3192, 3, 1}, {3192, 6, 2}, {3192, 11, 1},
+    {3192, 12, 2}, {3192, 13, 1}, {3192, 14, 1}, {3192, 15, 3}, {3192, 19, 2}, {3192, 20, 1},
+    {3192, 21, 1}, {3192, 22, 1}, {3192, 23, 2}, {3192, 24, 1}, {3192, 25, 2}, {3192, 26, 3},
+    {3192, 32, 1}, {3192, 33, 2}, {3192, 34, 3}, {3194, 33, 1}, {3194, 37, 1}, {3194, 39, 1},
+    {3194, 42, 1}, {3194, 43, 2}, {3194, 44, 1}, {3194, 45, 2}, {3194, 47, 1}, {3194, 48, 3},
+    {3194, 49, 2}, {3194, 51, 2}, {3194, 52, 3}, {3194, 53, 3}, {3194, 54, 1}, {3194, 55, 3},
+    {3194, 58, 1}, {3199, 27, 1}, {3199, 31, 1}, {3199, 32, 2}, {3199, 61, 1}, {3199, 62, 2},
+    {3199, 64, 1}, {3199, 65, 3}, {3199, 67, 2}, {3199, 69, 1}, {3199, 83, 1}, {3199, 84, 2},
+    {3199, 86, 1}, {3199, 88, 2}, {3199, 90, 1}, {3199, 91, 2}, {3199, 92, 3}, {3199, 93, 3},
+    {3199, 94, 1}, {3199, 97, 1}, {3199, 99, 2}, {3214, 6, 1}, {3214, 8, 1}, {3214, 9, 2},
+    {3214, 13, 1}, {3219, 5, 1}, {3219, 6, 2}, {3219, 8, 2}, {3219, 10, 1}, {3219, 12, 1},
+    {3219, 13, 2}, {3219, 15, 3}, {3219, 16, 1}, {3219, 17, 2}, {3219, 19, 3}, {3219, 23, 3},
+    {3221, 9, 11}, {3221, 10, 2}, {3221, 11, 12}, {3221, 15, 2}, {3221, 16, 1}, {3221, 17, 3},
+    {3221, 18, 4}, {3221, 19, 1}, {3221, 23, 10}, {3221, 24, 13}, {3221, 25, 5}, {3221, 26, 2},
+    {3221, 27, 2}, {3221, 31, 11}, {3221, 32, 12}, {3221, 44, 2}, {3221, 49, 1}, {3221, 51, 1},
+    {3221, 55, 1}, {3221, 56, 1}, {3221, 62, 1}, {3221, 63, 2}, {3221, 64, 1}, {3221, 72, 3},
+    {3221, 73, 13}, {3221, 74, 1}, {3221, 75, 7}, {3221, 79, 4}, {3221, 80, 13}, {3221, 83, 14},
+    {3221, 84, 1}, {3221, 86, 13}, {3221, 88, 14}, {3221, 90, 15}, {3221, 91, 1}, {3221, 92, 3},
+    {3221, 93, 13}, {3221, 94, 14}, {3221, 96, 13}, {3221, 97, 14}, {3221, 98, 15}, {3221, 99, 5},
+    {3221, 101, 1}, {3221, 105, 4}, {3221, 106, 2}, {3222, 2, 4}, {3224, 7, 1}, {3224, 10, 1},
+    {3224, 11, 2}, {3224, 12, 2}, {3224, 14, 3}, {3224, 15, 3}, {3224, 16, 1}, {3224, 17, 4},
+    {3224, 22, 1}, {3224, 23, 4}, {3224, 29, 1}, {3224, 33, 1}, {3224, 34, 1}, {3224, 35, 2},
+    {3224, 36, 5}, {3224, 37, 1}, {3224, 38, 1}, {3224, 39, 2}, {3224, 40, 1}, {3224, 41, 2},
+    {3224, 42, 3}, {3224, 43, 2}, {3224, 44, 3}, {3224, 45, 1}, {3224, 46, 2}, {3224, 48, 1},
+    {3224, 49, 2}, {3237, 3, 1}, {3237, 6, 2}, {3237, 7, 3}, {3237, 8, 1}, {3237, 11, 2},
+    {3237, 12, 3}, {3237, 13, 1}, {3237, 15, 1}, {3237, 16, 2}, {3237, 17, 1}, {3237, 18, 2},
+    {3237, 19, 3}, {3237, 20, 2}, {3237, 21, 3}, {3237, 22, 3}, {3237, 23, 1}, {3237, 26, 1},
+    {3237, 27, 1}, {3237, 28, 2}, {3237, 29, 2}, {3237, 30, 3}, {3237, 35, 1}, {3237, 37, 1},
+    {3237, 40, 1}, {3237, 41, 2}, {3237, 44, 1}, {3237, 45, 1}, {3237, 46, 2}, {3237, 48, 2},
+    {3237, 50, 1}, {3237, 51, 2}, {3237, 53, 1}, {3237, 54, 2}, {3237, 55, 3}, {3237, 56, 1},
+    {3237, 57, 2}, {3237, 58, 3}, {3237, 59, 2}, {3239, 4, 1}, {3239, 5, 3}, {3239, 12, 1},
+    {3239, 18, 1}, {3239, 19, 2}, {3239, 20, 4}, {3239, 21, 1}, {3239, 23, 1}, {3239, 24, 1},
+    {3239, 25, 1}, {3239, 26, 2}, {3239, 27, 3}, {3239, 28, 2}, {3239, 29, 3}, {3239, 30, 1},
+    {3239, 31, 2}, {3239, 33, 1}, {3239, 34, 2}, {3239, 37, 1}, {3239, 40, 1}, {3239, 41, 2},
+    {3239, 43, 1}, {3239, 44, 3}, {3239, 45, 2}, {3239, 47, 2}, {3240, 1, 1}, {3240, 4, 2},
+    {3240, 5, 3}, {3240, 6, 1}, {3240, 9, 2}, {3240, 10, 3}, {3240, 11, 1}, {3240, 13, 1},
+    {3240, 14, 2}, {3240, 15, 1}, {3240, 16, 2}, {3240, 17, 3}, {3240, 18, 2}, {3240, 19, 3},
+    {3240, 20, 3}, {3240, 21, 1}, {3240, 24, 1}, {3240, 25, 1}, {3240, 26, 2}, {3240, 27, 2},
+    {3240, 28, 3}, {3241, 5, 1}, {3241, 7, 1}, {3241, 10, 1}, {3241, 11, 2}, {3241, 14, 1},
+    {3241, 15, 1}, {3241, 16, 2}, {3241, 18, 2}, {3241, 20, 1}, {3241, 21, 2}, {3241, 23, 1},
+    {3241, 24, 2}, {3241, 25, 3}, {3241, 26, 1}, {3241, 27, 2}, {3241, 28, 3}, {3241, 29, 2},
+    {3241, 34, 1}, {3241, 36, 1}, {3241, 37, 1}, {3241, 41, 2}, {3241, 43, 1}, {3241, 48, 2},
+    {3241, 51, 3}, {3241, 52, 1}, {3241, 53, 1}, {3241, 57, 1}, {3242, 6, 1}, {3242, 8, 1},
+    {3242, 11, 1}, {3242, 12, 2}, {3242, 15, 1}, {3242, 16, 1}, {3242, 17, 2}, {3242, 19, 2},
+    {3242, 21, 1}, {3242, 22, 2}, {3242, 24, 1}, {3242, 25, 2}, {3242, 26, 3}, {3242, 27, 1},
+    {3242, 28, 2}, {3242, 29, 3}, {3242, 30, 2}, {3243, 4, 1}, {3243, 6, 1}, {3243, 8, 2},
+    {3243, 9, 2}, {3243, 12, 3}, {3244, 1, 1}, {3244, 4, 2}, {3244, 5, 3}, {3244, 6, 1},
+    {3244, 9, 2}, {3244, 10, 3}, {3244, 11, 1}, {3244, 13, 1}, {3244, 14, 2}, {3244, 15, 1},
+    {3244, 16, 2}, {3244, 17, 3}, {3244, 18, 2}, {3244, 19, 3}, {3244, 20, 3}, {3244, 21, 1},
+    {3244, 24, 1}, {3244, 25, 1}, {3244, 26, 2}, {3244, 27, 2}, {3244, 28, 3}, {3245, 6, 1},
+    {3245, 9, 1}, {3245, 10, 2}, {3245, 11, 2}, {3245, 13, 3}, {3245, 14, 1}, {3245, 15, 1},
+    {3245, 16, 2}, {3245, 19, 1}, {3245, 21, 1}, {3245, 22, 2}, {3245, 25, 2}, {3245, 36, 1},
+    {3245, 37, 2}, {3245, 38, 1}, {3245, 39, 2}, {3245, 40, 3}, {3246, 3, 1}, {3246, 5, 1},
+    {3246, 6, 2}, {3246, 9, 2}, {3246, 15, 3}, {3246, 27, 1}, {3246, 29, 1}, {3246, 30, 1},
+    {3246, 34, 2}, {3246, 36, 1}, {3246, 41, 2}, {3246, 44, 3}, {3246, 45, 1}, {3246, 46, 1},
+    {3246, 50, 1}, {3246, 59, 1}, {3246, 60, 2}, {3246, 61, 1}, {3246, 62, 2}, {3246, 63, 3},
+    {3248, 5, 1}, {3248, 7, 1}, {3248, 10, 1}, {3248, 12, 2}, {3248, 13, 1}, {3248, 14, 1},
+    {3248, 16, 1}, {3248, 18, 1}, {3248, 19, 2}, {3248, 20, 3}, {3248, 21, 1}, {3248, 23, 1},
+    {3248, 24, 2}, {3248, 25, 2}, {3248, 26, 3}, {3248, 29, 2}, {3248, 30, 1}, {3248, 31, 2},
+    {3248, 33, 2}, {3248, 34, 1}, {3248, 35, 2}, {3248, 36, 3}, {3248, 37, 3}, {3248, 38, 1},
+    {3248, 39, 2}, {3248, 40, 3}, {3248, 42, 2}, {3248, 45, 1}, {3248, 47, 1}, {3248, 49, 2},
+    {3248, 50, 2}, {3248, 53, 3}, {3249, 5, 1}, {3249, 7, 1}, {3249, 9, 2}, {3249, 10, 2},
+    {3249, 13, 3}, {3249, 33, 1}, {3249, 34, 2}, {3249, 35, 1}, {3249, 36, 2}, {3249, 37, 3},
+    {3250, 4, 1}, {3250, 5, 3}, {3250, 11, 1}, {3250, 15, 1}, {3250, 16, 1}, {3250, 17, 2},
+    {3250, 18, 4}, {3250, 19, 1}, {3250, 20, 1}, {3250, 21, 2}, {3250, 22, 1}, {3250, 23, 2},
+    {3250, 24, 3}, {3250, 25, 2}, {3250, 26, 3}, {3250, 27, 1}, {3250, 28, 2}, {3250, 30, 1},
+    {3250, 31, 2}, {3251, 4, 1}, {3251, 6, 1}, {3251, 7, 2}, {3251, 10, 2}, {3251, 21, 1},
+    {3251, 22, 2}, {3251, 23, 1}, {3251, 24, 2}, {3251, 25, 3}, {3252, 1, 1}, {3252, 4, 2},
+    {3252, 5, 3}, {3252, 6, 1}, {3252, 9, 2}, {3252, 10, 3}, {3252, 11, 1}, {3252, 13, 1},
+    {3252, 14, 2}, {3252, 15, 1}, {3252, 16, 2}, {3252, 17, 3}, {3252, 18, 2}, {3252, 19, 3},
+    {3252, 20, 3}, {3252, 21, 1}, {3252, 24, 1}, {3252, 25, 1}, {3252, 26, 2}, {3252, 27, 2},
+    {3252, 28, 3}, {3253, 6, 1}, {3253, 9, 1}, {3253, 10, 2}, {3253, 11, 2}, {3253, 13, 3},
+    {3253, 14, 3}, {3253, 15, 1}, {3253, 16, 4}, {3253, 19, 1}, {3253, 20, 4}, {3253, 26, 1},
+    {3253, 30, 1}, {3253, 31, 1}, {3253, 32, 2}, {3253, 33, 5}, {3253, 34, 1}, {3253, 35, 1},
+    {3253, 36, 2}, {3253, 37, 1}, {3253, 38, 2}, {3253, 39, 3}, {3253, 40, 2}, {3253, 41, 3},
+    {3253, 42, 1}, {3253, 43, 2}, {3253, 45, 1}, {3253, 46, 2}, {3254, 4, 1}, {3254, 6, 1},
+    {3254, 7, 1}, {3254, 11, 2}, {3254, 13, 1}, {3254, 18, 2}, {3254, 21, 3}, {3254, 22, 1},
+    {3254, 23, 1}, {3254, 27, 1}, {3255, 4, 1}, {3255, 6, 1}, {3255, 7, 2}, {3255, 10, 2},
+    {3255, 21, 1}, {3255, 22, 2}, {3255, 23, 1}, {3255, 24, 2}, {3255, 25, 3}, {3256, 4, 1},
+    {3256, 6, 1}, {3256, 7, 1}, {3256, 11, 2}, {3256, 13, 1}, {3256, 18, 2}, {3256, 21, 3},
+    {3256, 22, 1}, {3256, 23, 1}, {3256, 27, 1}, {3257, 5, 1}, {3257, 7, 1}, {3257, 10, 1},
+    {3257, 12, 2}, {3257, 13, 1}, {3257, 14, 1}, {3257, 16, 1}, {3257, 18, 1}, {3257, 19, 2},
+    {3257, 20, 3}, {3257, 21, 1}, {3257, 23, 1}, {3257, 24, 2}, {3257, 25, 2}, {3257, 26, 3},
+    {3257, 29, 2}, {3257, 30, 1}, {3257, 31, 2}, {3257, 33, 2}, {3257, 34, 1}, {3257, 35, 2},
+    {3257, 36, 3}, {3257, 37, 3}, {3257, 38, 1}, {3257, 39, 2}, {3257, 40, 3}, {3257, 42, 2},
+    {3260, 3, 1}, {3260, 5, 1}, {3260, 6, 2}, {3260, 9, 2}, {3260, 15, 3}, {3260, 33, 1},
+    {3260, 34, 2}, {3260, 35, 1}, {3260, 36, 2}, {3260, 37, 3}, {3261, 6, 1}, {3261, 9, 1},
+    {3261, 10, 2}, {3261, 11, 2}, {3261, 13, 3}, {3261, 14, 1}, {3261, 15, 1}, {3261, 16, 2},
+    {3261, 19, 1}, {3261, 21, 1}, {3261, 22, 2}, {3261, 25, 2}, {3261, 36, 1}, {3261, 37, 2},
+    {3261, 38, 1}, {3261, 39, 2}, {3261, 40, 3}, {3262, 4, 1}, {3262, 6, 1}, {3262, 7, 2},
+    {3262, 10, 2}, {3262, 21, 1}, {3262, 22, 2}, {3262, 23, 1}, {3262, 24, 2}, {3262, 25, 3},
+    {3263, 4, 1}, {3263, 6, 1}, {3263, 8, 2}, {3263, 9, 2}, {3263, 12, 3}, {3263, 27, 1},
+    {3263, 29, 1}, {3263, 30, 1}, {3263, 34, 2}, {3263, 36, 1}, {3263, 41, 2}, {3263, 44, 3},
+    {3263, 45, 1}, {3263, 46, 1}, {3263, 50, 1}, {3264, 5, 1}, {3264, 7, 1}, {3264, 10, 1},
+    {3264, 12, 2}, {3264, 13, 1}, {3264, 14, 1}, {3264, 16, 1}, {3264, 18, 1}, {3264, 19, 2},
+    {3264, 20, 3}, {3264, 21, 1}, {3264, 23, 1}, {3264, 24, 2}, {3264, 25, 2}, {3264, 26, 3},
+    {3264, 29, 2}, {3264, 30, 1}, {3264, 31, 2}, {3264, 33, 2}, {3264, 34, 1}, {3264, 35, 2},
+    {3264, 36, 3}, {3264, 37, 3}, {3264, 38, 1}, {3264, 39, 2}, {3264, 40, 3}, {3264, 42, 2},
+    {3265, 1, 1}, {3265, 4, 2}, {3265, 5, 3}, {3265, 6, 1}, {3265, 9, 2}, {3265, 10, 3},
+    {3265, 11, 1}, {3265, 13, 1}, {3265, 14, 2}, {3265, 15, 1}, {3265, 16, 2}, {3265, 17, 3},
+    {3265, 18, 2}, {3265, 19, 3}, {3265, 20, 3}, {3265, 21, 1}, {3265, 24, 1}, {3265, 25, 1},
+    {3265, 26, 2}, {3265, 27, 2}, {3265, 28, 3}, {3266, 1, 1}, {3266, 4, 2}, {3266, 5, 3},
+    {3266, 6, 1}, {3266, 9, 2}, {3266, 10, 3}, {3266, 11, 1}, {3266, 13, 1}, {3266, 14, 2},
+    {3266, 15, 1}, {3266, 16, 2}, {3266, 17, 3}, {3266, 18, 2}, {3266, 19, 3}, {3266, 20, 3},
+    {3266, 21, 1}, {3266, 24, 1}, {3266, 25, 1}, {3266, 26, 2}, {3266, 27, 2}, {3266, 28, 3},
+    {3267, 5, 1}, {3267, 7, 1}, {3267, 10, 1}, {3267, 12, 2}, {3267, 13, 1}, {3267, 14, 1},
+    {3267, 16, 1}, {3267, 18, 1}, {3267, 19, 2}, {3267, 20, 3}, {3267, 21, 1}, {3267, 23, 1},
+    {3267, 24, 2}, {3267, 25, 2}, {3267, 26, 3}, {3267, 29, 2}, {3267, 30, 1}, {3267, 31, 2},
+    {3267, 33, 2}, {3267, 34, 1}, {3267, 35, 2}, {3267, 36, 3}, {3267, 37, 3}, {3267, 38, 1},
+    {3267, 39, 2}, {3267, 40, 3}, {3267, 42, 2}, {3268, 4, 1}, {3268, 6, 1}, {3268, 8, 2},
+    {3268, 9, 2}, {3268, 12, 3}, {3269, 5, 1}, {3269, 7, 1}, {3269, 10, 1}, {3269, 12, 2},
+    {3269, 13, 1}, {3269, 14, 1}, {3269, 16, 1}, {3269, 18, 1}, {3269, 19, 2}, {3269, 20, 3},
+    {3269, 21, 1}, {3269, 23, 1}, {3269, 24, 2}, {3269, 25, 2}, {3269, 26, 3}, {3269, 29, 2},
+    {3269, 30, 1}, {3269, 31, 2}, {3269, 33, 2}, {3269, 34, 1}, {3269, 35, 2}, {3269, 36, 3},
+    {3269, 37, 3}, {3269, 38, 1}, {3269, 39, 2}, {3269, 40, 3}, {3269, 42, 2}, {3269, 45, 1},
+    {3269, 47, 1}, {3269, 48, 1}, {3269, 52, 2}, {3269, 54, 1}, {3269, 59, 2}, {3269, 62, 3},
+    {3269, 63, 1}, {3269, 64, 1}, {3269, 68, 1}, {3270, 5, 1}, {3270, 7, 1}, {3270, 10, 1},
+    {3270, 12, 2}, {3270, 13, 1}, {3270, 14, 1}, {3270, 16, 1}, {3270, 18, 1}, {3270, 19, 2},
+    {3270, 20, 3}, {3270, 21, 1}, {3270, 23, 1}, {3270, 24, 2}, {3270, 25, 2}, {3270, 26, 3},
+    {3270, 29, 2}, {3270, 30, 1}, {3270, 31, 2}, {3270, 33, 2}, {3270, 34, 1}, {3270, 35, 2},
+    {3270, 36, 3}, {3270, 37, 3}, {3270, 38, 1}, {3270, 39, 2}, {3270, 40, 3}, {3270, 42, 2},
+    {3271, 1, 1}, {3271, 4, 2}, {3271, 5, 3}, {3271, 6, 1}, {3271, 9, 2}, {3271, 10, 3},
+    {3271, 11, 1}, {3271, 13, 1}, {3271, 14, 2}, {3271, 15, 1}, {3271, 16, 2}, {3271, 17, 3},
+    {3271, 18, 2}, {3271, 19, 3}, {3271, 20, 3}, {3271, 21, 1}, {3271, 24, 1}, {3271, 25, 1},
+    {3271, 26, 2}, {3271, 27, 2}, {3271, 28, 3}, {3271, 34, 1}, {3271, 36, 1}, {3271, 38, 2},
+    {3271, 39, 2}, {3271, 42, 3}, {3271, 57, 1}, {3271, 59, 1}, {3271, 60, 1}, {3271, 64, 2},
+    {3271, 66, 1}, {3271, 71, 2}, {3271, 74, 3}, {3271, 75, 1}, {3271, 76, 1}, {3271, 80, 1},
+    {3272, 5, 1}, {3272, 7, 1}, {3272, 10, 1}, {3272, 11, 2}, {3272, 14, 1}, {3272, 15, 1},
+    {3272, 16, 2}, {3272, 18, 2}, {3272, 20, 1}, {3272, 21, 2}, {3272, 23, 1}, {3272, 24, 2},
+    {3272, 25, 3}, {3272, 26, 1}, {3272, 27, 2}, {3272, 28, 3}, {3272, 29, 2}, {3275, 6, 1},
+    {3275, 9, 1}, {3275, 10, 2}, {3275, 11, 2}, {3275, 13, 3}, {3275, 14, 3}, {3275, 15, 1},
+    {3275, 16, 4}, {3275, 19, 1}, {3275, 20, 4}, {3275, 26, 1}, {3275, 30, 1}, {3275, 31, 1},
+    {3275, 32, 2}, {3275, 33, 5}, {3275, 34, 1}, {3275, 35, 1}, {3275, 36, 2}, {3275, 37, 1},
+    {3275, 38, 2}, {3275, 39, 3}, {3275, 40, 2}, {3275, 41, 3}, {3275, 42, 1}, {3275, 43, 2},
+    {3275, 45, 1}, {3275, 46, 2}, {3275, 48, 1}, {3275, 50, 1}, {3275, 51, 2}, {3275, 54, 2},
+    {3275, 65, 1}, {3275, 66, 2}, {3275, 67, 1}, {3275, 68, 2}, {3275, 69, 3}, {3276, 5, 1},
+    {3276, 7, 1}, {3276, 10, 1}, {3276, 11, 2}, {3276, 14, 1}, {3276, 15, 1}, {3276, 16, 2},
+    {3276, 18, 2}, {3276, 20, 1}, {3276, 21, 2}, {3276, 23, 1}, {3276, 24, 2}, {3276, 25, 3},
+    {3276, 26, 1}, {3276, 27, 2}, {3276, 28, 3}, {3276, 29, 2}, {3278, 6, 1}, {3278, 9, 1},
+    {3278, 10, 2}, {3278, 11, 2}, {3278, 13, 3}, {3278, 14, 3}, {3278, 15, 1}, {3278, 16, 4},
+    {3278, 19, 1}, {3278, 20, 4}, {3278, 26, 1}, {3278, 30, 1}, {3278, 31, 1}, {3278, 32, 2},
+    {3278, 33, 5}, {3278, 34, 1}, {3278, 35, 1}, {3278, 36, 2}, {3278, 37, 1}, {3278, 38, 2},
+    {3278, 39, 3}, {3278, 40, 2}, {3278, 41, 3}, {3278, 42, 1}, {3278, 43, 2}, {3278, 45, 1},
+    {3278, 46, 2}, {3280, 5, 1}, {3280, 7, 1}, {3280, 9, 2}, {3280, 10, 2}, {3280, 13, 3},
+    {3280, 33, 1}, {3280, 34, 2}, {3280, 35, 1}, {3280, 36, 2}, {3280, 37, 3}, {3315, 1, 1},
+    {3315, 4, 2}, {3315, 5, 3}, {3315, 6, 1}, {3315, 9, 2}, {3315, 10, 3}, {3315, 11, 1},
+    {3315, 13, 1}, {3315, 14, 2}, {3315, 15, 1}, {3315, 16, 2}, {3315, 17, 3}, {3315, 18, 2},
+    {3315, 19, 3}, {3315, 20, 3}, {3315, 21, 1}, {3315, 24, 1}, {3315, 25, 1}, {3315, 26, 2},
+    {3315, 27, 2}, {3315, 28, 3}, {3323, 12, 1}, {3323, 13, 2}, {3323, 15, 1}, {3323, 16, 1},
+    {3323, 17, 2}, {3323, 18, 2}, {3323, 19, 3}, {3323, 20, 3}, {3336, 3, 1}, {3336, 4, 2},
+    {3336, 5, 1}, {3341, 3, 1}, {3341, 5, 1}, {3341, 12, 1}, {3341, 15, 1}, {3341, 20, 1},
+    {3341, 22, 2}, {3341, 34, 1}, {3341, 35, 1}, {3341, 40, 1}, {3343, 4, 1}, {3343, 6, 1},
+    {3343, 9, 1}, {3343, 15, 1}, {3343, 16, 2}, {3343, 19, 1}, {3343, 20, 2}, {3343, 21, 3},
+    {3343, 22, 1}, {3343, 23, 3}, {3343, 25, 1}, {3343, 26, 2}, {3343, 34, 1}, {3343, 43, 1},
+    {3343, 46, 2}, {3343, 47, 3}, {3343, 49, 1}, {3343, 50, 2}, {3343, 51, 3}, {3343, 54, 2},
+    {3343, 55, 3}, {3343, 64, 1}, {3343, 66, 1}, {3343, 67, 2}, {3343, 69, 1}, {3343, 75, 1},
+    {3343, 76, 2}, {3343, 77, 3}, {3343, 82, 1}, {3343, 83, 2}, {3343, 84, 1}, {3343, 87, 1},
+    {3343, 88, 1}, {3343, 89, 2}, {3343, 92, 2}, {3343, 93, 2}, {3343, 94, 3}, {3343, 95, 3},
+    {3378, 6, 1}, {3378, 9, 1}, {3378, 10, 2}, {3378, 11, 2}, {3378, 13, 3}, {3378, 14, 1},
+    {3378, 15, 1}, {3378, 16, 2}, {3435, 4, 1}, {3435, 7, 1}, {3435, 9, 1}, {3435, 12, 2},
+    {3435, 14, 1}, {3435, 15, 2}, {3435, 17, 2}, {3435, 18, 1}, {3435, 19, 2}, {3435, 20, 1},
+    {3435, 21, 2}, {3435, 25, 1}, {3435, 26, 3}, {3435, 27, 3}, {3442, 2, 1}, {3442, 24, 1},
+    {3442, 30, 1}, {3442, 31, 1}, {3442, 36, 1}, {3442, 37, 1}, {3442, 38, 1}, {3442, 39, 1},
+    {3442, 44, 1}, {3442, 49, 1}, {3442, 53, 1}, {3442, 55, 1}, {3442, 56, 1}, {3442, 60, 1},
+    {3442, 64, 1}, {3442, 67, 2}, {3442, 68, 2}, {3445, 14, 1}, {3445, 15, 1}, {3447, 4, 1},
+    {3447, 8, 1}, {3447, 27, 1}, {3447, 32, 1}, {3447, 41, 1}, {3447, 42, 1}, {3447, 43, 1},
+    {3447, 48, 1}, {3447, 52, 1}, {3447, 55, 1}, {3447, 60, 1}, {3447, 63, 1}, {3447, 65, 1},
+    {3447, 66, 1}, {3447, 68, 1}, {3447, 71, 1}, {3447, 74, 2}, {3447, 76, 1}, {3447, 77, 2},
+    {3447, 78, 1}, {3447, 82, 1}, {3447, 84, 1}, {3450, 14, 1}, {3450, 15, 1}, {3451, 9, 1},
+    {3451, 14, 1}, {3451, 18, 1}, {3451, 24, 1}, {3451, 29, 1}, {3451, 34, 1}, {3451, 38, 1},
+    {3451, 39, 1}, {3451, 46, 1}, {3451, 48, 1}, {3451, 49, 1}, {3451, 51, 1}, {3451, 56, 1},
+    {3451, 58, 1}, {3451, 60, 1}, {3451, 61, 1}, {3451, 64, 1}, {3454, 14, 1}, {3454, 15, 1},
 };
+// clang-format on
+static_assert(std::is_sorted(std::begin(data), std::end(data), entry_less));
+}  // namespace
 
 int lookup_jak2_texture_dest_offset(int tpage, int texture_idx) {
-  auto it = data.find(tpage);
-  if (it == data.end()) {
-    return 0;
-  }
-  for (auto& p : it->second) {
-    if (p.first == texture_idx) {
-      return p.second;
-    }
+  const RemapEntry key = {tpage, texture_idx, 0};
+  auto it = std::lower_bound(std::begin(data), std::end(data), key, entry_less);
+  if (it != std::end(data) && it->tpage == tpage && it->texture_idx == texture_idx) {
+    return it->dest_offset;
   }
   return 0;
-}
\ No newline at end of file
+}
@@ -1,2062 +1,1060 @@
 #include "jak3_texture_remap.h"
 
-#include <unordered_map>
-#include <utility>
-#include <vector>
+#include <algorithm>
+#include <iterator>
 
 namespace {
-const std::unordered_map<int, std::vector<std::pair<int, int>>> data = {
-    {2, {{1, 1}}},
-    {4, {{66, 1},   {18, 2},   {177, 2},  {21, 1},  {88, 1},  {89, 2},   {172, 5},  {173, 6},
-         {174, 7},  {168, 7},  {169, 8},  {170, 9}, {164, 9}, {165, 10}, {166, 11}, {140, 11},
-         {161, 12}, {162, 13}, {131, 13}, {181, 1}, {182, 2}, {85, 1},   {185, 2},  {22, 1},
-         {59, 1},   {63, 2},   {64, 3},   {25, 1},  {24, 1},  {61, 2},   {100, 1},  {134, 2},
-         {130, 1},  {150, 1},  {148, 1},  {183, 2}, {184, 3}, {113, 1},  {154, 2}}},
-    {5, {{4, 1}, {24, 1}, {30, 1}, {13, 1}, {14, 2}, {17, 1}, {2, 1}, {19, 2}}},
-    {7, {{55, 1},  {25, 1},  {31, 2},  {129, 1}, {130, 2}, {127, 1}, {128, 2}, {90, 1},  {115, 2},
-         {106, 1}, {123, 1}, {124, 2}, {98, 1},  {103, 2}, {105, 3}, {107, 4}, {110, 5}, {112, 6},
-         {117, 7}, {92, 1},  {111, 2}, {119, 3}, {104, 1}, {108, 2}, {116, 3}, {109, 1}, {125, 1},
-         {126, 2}, {97, 1},  {113, 2}, {118, 3}, {121, 1}, {122, 2}}},
-    {10, {{4, 1}, {5, 2}, {9, 3}}},
-    {11,
-     {{22, 1},
-      {23, 2},
-      {5, 1},
-      {16, 2},
-      {7, 1},
-      {19, 2},
-      {10, 1},
-      {11, 2},
-      {12, 3},
-      {14, 1},
-      {15, 2},
-      {17, 3},
-      {4, 1}}},
-    {13, {{21, 1}, {23, 2}, {24, 3}, {46, 1}, {47, 2}, {39, 1}, {40, 2}}},
-    {17,
-     {{56, 1},
-      {42, 1},
-      {44, 2},
-      {46, 3},
-      {51, 2},
-      {52, 3},
-      {48, 1},
-      {49, 2},
-      {40, 1},
-      {53, 2},
-      {59, 3}}},
-    {125, {{17, 1}, {18, 2}, {19, 3}, {23, 1}}},
-    {127,
-     {{36, 1},
-      {51, 1},
-      {53, 2},
-      {44, 1},
-      {72, 1},
-      {73, 3},
-      {74, 4},
-      {79, 3},
-      {139, 1},
-      {140, 2},
-      {132, 1},
-      {133, 2},
-      {92, 1}}},
-    {133, {{77, 1}, {74, 1}, {75, 2}, {55, 1}, {56, 2}, {57, 3}, {51, 1}}},
-    {135, {{9, 1}, {11, 2}, {19, 1}, {13, 1}, {14, 2}, {20, 1}, {10, 1}, {4, 1}}},
-    {136,
-     {{9, 1},
-      {46, 1},
-      {47, 2},
-      {54, 3},
-      {4, 1},
-      {6, 2},
-      {32, 1},
-      {45, 1},
-      {15, 1},
-      {16, 1},
-      {26, 2},
-      {49, 1},
-      {35, 1},
-      {23, 1},
-      {25, 2},
-      {27, 3}}},
-    {162, {{6, 1}}},
-    {166, {{105, 1}, {103, 1}}},
-    {170, {{9, 1}}},
-    {174, {{103, 1}}},
-    {179, {{3, 1}}},
-    {180, {{52, 1}, {31, 1}, {7, 1},  {34, 1}, {36, 1}, {59, 1}, {48, 1}, {40, 1},
-           {10, 1}, {45, 1}, {30, 1}, {3, 1},  {49, 1}, {12, 1}, {37, 1}, {58, 1},
-           {54, 1}, {51, 1}, {41, 1}, {25, 1}, {21, 1}, {39, 1}}},
-    {187, {{5, 1}}},
-    {188, {{56, 1}, {47, 1}, {37, 1}, {15, 1}, {38, 1}, {78, 1}, {49, 1}, {34, 1},
-           {40, 1}, {54, 1}, {29, 1}, {36, 1}, {50, 1}, {43, 1}, {39, 1}, {58, 1},
-           {23, 1}, {55, 1}, {31, 1}, {27, 1}, {30, 1}, {24, 1}}},
-    {224,
-     {{1, 1},
-      {3, 2},
-      {4, 3},
-      {24, 1},
-      {43, 1},
-      {36, 1},
-      {38, 2},
-      {39, 1},
-      {40, 2},
-      {42, 3},
-      {25, 1},
-      {37, 2},
-      {16, 1},
-      {18, 1},
-      {20, 1},
-      {53, 1}}},
-    {226,
-     {{30, 1},
-      {77, 1},
-      {78, 2},
-      {18, 1},
-      {43, 1},
-      {53, 1},
-      {62, 2},
-      {63, 3},
-      {1, 1},
-      {3, 2},
-      {9, 1},
-      {7, 1},
-      {45, 1},
-      {41, 1}}},
-    {244, {{1, 1}, {3, 2}, {4, 3}, {8, 1}}},
-    {272, {{5, 1}, {7, 2}, {8, 3}}},
-    {273, {{28, 1}, {29, 2}}},
-    {274, {{27, 1}, {42, 2}, {44, 1}, {12, 1}, {20, 2}, {46, 3}, {60, 1}, {65, 1}, {15, 1},
-           {97, 2}, {29, 1}, {40, 2}, {55, 3}, {21, 1}, {52, 1}, {13, 1}, {50, 1}, {39, 1},
-           {48, 1}, {53, 1}, {30, 1}, {16, 1}, {37, 1}, {58, 1}, {62, 1}}},
-    {318,
-     {{29, 1},
-      {48, 1},
-      {41, 1},
-      {43, 2},
-      {44, 1},
-      {45, 2},
-      {47, 3},
-      {30, 1},
-      {42, 2},
-      {19, 1},
-      {23, 1},
-      {25, 1}}},
-    {319, {{89, 1}, {93, 2}, {96, 1}, {97, 2}, {85, 1}, {84, 1}}},
-    {325,
-     {{60, 1}, {117, 1}, {47, 1}, {14, 1}, {21, 2}, {57, 3}, {22, 1}, {37, 2}, {45, 3}, {20, 1},
-      {40, 2}, {78, 3},  {82, 1}, {87, 2}, {46, 1}, {51, 2}, {55, 3}, {42, 1}, {56, 1}, {58, 2},
-      {35, 1}, {52, 1},  {53, 2}, {23, 1}, {31, 2}, {32, 3}, {48, 1}, {49, 2}, {17, 1}, {18, 2},
-      {43, 3}, {113, 1}, {38, 1}, {61, 2}, {12, 1}, {30, 2}, {84, 1}, {85, 2}, {86, 3}}},
-    {405,
-     {{130, 1},
-      {120, 1},
-      {126, 2},
-      {107, 1},
-      {68, 1},
-      {121, 1},
-      {124, 1},
-      {73, 1},
-      {114, 1},
-      {85, 1},
-      {90, 2},
-      {93, 3},
-      {94, 4},
-      {66, 1},
-      {82, 1},
-      {104, 1},
-      {71, 1}}},
-    {428, {{21, 1}, {28, 1}, {14, 1}, {26, 2}, {32, 1}, {35, 1}}},
-    {446, {{3, 1}, {4, 2}, {5, 3}, {6, 5}, {7, 6}}},
-    {536,
-     {{113, 1}, {171, 1}, {174, 2}, {188, 3}, {92, 1},  {89, 1},  {90, 2},  {91, 3},  {85, 1},
-      {86, 2},  {93, 3},  {156, 1}, {132, 1}, {125, 1}, {127, 2}, {128, 1}, {129, 2}, {131, 3},
-      {114, 1}, {126, 2}, {186, 1}, {187, 2}, {195, 3}, {183, 1}, {184, 2}, {185, 3}, {177, 1},
-      {178, 2}, {191, 3}, {181, 1}, {189, 2}, {190, 3}, {167, 1}, {173, 2}, {168, 1}, {182, 2},
-      {175, 1}, {180, 2}, {193, 1}, {194, 2}, {95, 1},  {96, 2},  {151, 1}, {145, 1}, {103, 1},
-      {107, 1}, {51, 1},  {62, 1},  {61, 1},  {66, 1},  {55, 1},  {109, 1}, {52, 1},  {46, 1}}},
-    {540,
-     {{41, 1},  {219, 1}, {210, 1}, {38, 1},  {39, 2},  {40, 3},  {34, 1},  {35, 2},  {42, 3},
-      {86, 1},  {87, 2},  {82, 1},  {209, 1}, {211, 2}, {213, 3}, {212, 1}, {216, 2}, {217, 3},
-      {205, 1}, {206, 2}, {208, 3}, {173, 1}, {174, 2}, {170, 1}, {171, 2}, {175, 3}, {215, 1},
-      {203, 1}, {201, 1}, {202, 1}, {214, 2}, {68, 1},  {69, 2},  {70, 3},  {62, 1},  {65, 2},
-      {66, 3},  {73, 1},  {74, 2},  {152, 3}, {44, 1},  {45, 2},  {25, 1},  {27, 2},  {29, 3},
-      {15, 1},  {18, 2},  {21, 3},  {13, 1},  {19, 2},  {23, 3},  {11, 1},  {16, 2},  {17, 3},
-      {8, 1},   {9, 2},   {12, 3},  {4, 1},   {20, 2},  {26, 3},  {10, 1},  {22, 2},  {28, 3}}},
-    {544, {{81, 1},  {82, 2},  {96, 1},  {106, 2}, {119, 3}, {95, 1},  {100, 2}, {110, 3}, {99, 1},
-           {109, 2}, {113, 3}, {117, 1}, {118, 2}, {120, 1}, {121, 2}, {34, 1},  {38, 2},  {36, 1},
-           {39, 2},  {42, 3},  {107, 1}, {108, 2}, {112, 3}, {105, 1}, {115, 2}, {94, 1},  {102, 2},
-           {93, 1},  {111, 2}, {75, 1},  {76, 2},  {71, 1},  {80, 2},  {65, 1},  {73, 2},  {74, 3},
-           {69, 1},  {59, 1},  {84, 1},  {85, 2},  {86, 3},  {58, 1},  {60, 2},  {63, 3},  {67, 1},
-           {70, 2},  {79, 3},  {25, 1},  {27, 2},  {28, 3},  {24, 1},  {26, 2},  {13, 1},  {14, 2},
-           {17, 3},  {15, 1},  {16, 2},  {20, 3},  {21, 1},  {6, 1},   {9, 2},   {11, 1},  {18, 2},
-           {19, 3},  {1, 1},   {4, 2},   {5, 3}}},
-    {591, {{287, 1}, {288, 2}, {289, 3}, {290, 4}, {283, 1}, {284, 2}, {285, 3}, {279, 1}, {280, 2},
-           {281, 3}, {275, 1}, {276, 2}, {277, 3}, {271, 1}, {272, 2}, {273, 3}, {266, 1}, {267, 2},
-           {268, 3}, {269, 4}, {262, 1}, {263, 2}, {264, 3}, {258, 1}, {259, 2}, {260, 3}, {254, 1},
-           {255, 2}, {256, 3}, {250, 1}, {251, 2}, {252, 3}, {245, 1}, {246, 2}, {247, 3}, {248, 4},
-           {241, 1}, {242, 2}, {243, 3}, {237, 1}, {238, 2}, {239, 3}, {233, 1}, {234, 2}, {235, 3},
-           {229, 1}, {230, 2}, {231, 3}, {224, 1}, {225, 2}, {226, 3}, {227, 4}, {220, 1}, {221, 2},
-           {222, 3}, {216, 1}, {217, 2}, {218, 3}, {212, 1}, {213, 2}, {214, 3}, {208, 1}, {209, 2},
-           {210, 3}, {204, 1}, {205, 2}, {206, 3}, {199, 1}, {200, 2}, {201, 3}, {202, 4}, {195, 1},
-           {196, 2}, {197, 3}, {191, 1}, {192, 2}, {193, 3}, {187, 1}, {188, 2}, {189, 3}, {141, 1},
-           {142, 2}, {143, 3}, {137, 1}, {138, 2}, {139, 3}, {133, 1}, {134, 2}, {135, 3}, {17, 1},
-           {130, 2}, {131, 3}, {182, 1}, {183, 2}, {184, 3}, {185, 4}, {177, 1}, {178, 2}, {179, 3},
-           {180, 4}, {170, 1}, {171, 2}, {172, 3}, {174, 4}, {175, 5}, {176, 6}, {166, 1}, {167, 2},
-           {168, 3}, {161, 1}, {162, 2}, {163, 3}, {164, 4}, {157, 1}, {158, 2}, {159, 3}, {153, 1},
-           {154, 2}, {155, 3}, {149, 1}, {150, 2}, {151, 3}, {145, 1}, {146, 2}, {147, 3}}},
-    {593, {{29, 1}, {14, 1}, {24, 2}, {15, 1}, {23, 2}, {21, 1}}},
-    {605, {{30, 1}, {19, 1}, {28, 2}, {17, 1}, {26, 2}, {25, 1}}},
-    {632, {{82, 1}, {84, 2}, {28, 1}, {44, 1}, {68, 1}, {73, 1}, {76, 2},
-           {79, 3}, {35, 1}, {42, 1}, {22, 1}, {29, 1}, {24, 1}, {37, 1},
-           {55, 2}, {17, 1}, {18, 2}, {20, 3}, {63, 1}, {65, 1}, {43, 1}}},
-    {633, {{5, 1}, {6, 2}, {19, 1}}},
-    {646, {{4, 1}, {5, 2}, {6, 3}, {7, 5}, {8, 6}}},
-    {647, {{28, 1}, {17, 1}, {30, 1}, {38, 1}, {9, 1}, {37, 2}, {21, 1}, {22, 2}, {27, 3}}},
-    {736, {{17, 1}, {24, 1}, {21, 1}, {22, 2}, {30, 3}}},
-    {740, {{13, 1}, {14, 1}, {29, 1}, {18, 1}, {28, 1}, {24, 1}}},
-    {741,
-     {{3, 1},  {1, 1},  {4, 2},   {5, 3},   {18, 1},  {64, 1}, {15, 1}, {16, 2}, {17, 3}, {11, 1},
-      {12, 2}, {19, 3}, {118, 1}, {83, 1},  {76, 1},  {78, 2}, {79, 1}, {80, 2}, {82, 3}, {65, 1},
-      {77, 2}, {21, 1}, {22, 2},  {113, 1}, {107, 1}, {56, 1}, {58, 1}, {60, 1}}},
-    {742,
-     {{67, 1},
-      {54, 1},
-      {27, 1},
-      {77, 1},
-      {79, 1},
-      {34, 1},
-      {22, 1},
-      {25, 2},
-      {41, 1},
-      {40, 1},
-      {60, 2},
-      {39, 1},
-      {47, 1},
-      {46, 1},
-      {83, 2},
-      {36, 1},
-      {82, 1},
-      {42, 1}}},
-    {744, {{27, 1}, {34, 1}, {68, 1}, {31, 1}, {8, 1},  {28, 2}, {33, 1},
-           {38, 2}, {71, 1}, {64, 1}, {36, 1}, {51, 2}, {10, 1}, {20, 2},
-           {37, 1}, {26, 1}, {67, 2}, {24, 1}, {69, 1}, {23, 1}, {63, 2}}},
-    {746, {{13, 1}, {60, 1}, {35, 1}, {43, 1}, {28, 1}, {31, 2}, {33, 1},
-           {46, 2}, {42, 1}, {7, 1},  {12, 2}, {49, 1}, {11, 1}, {75, 2},
-           {27, 1}, {78, 1}, {76, 1}, {68, 1}, {70, 1}, {19, 1}, {80, 2}}},
-    {747, {{13, 1}}},
-    {748,
-     {{66, 1},
-      {81, 1},
-      {35, 1},
-      {24, 1},
-      {77, 1},
-      {30, 1},
-      {33, 2},
-      {49, 1},
-      {41, 1},
-      {60, 1},
-      {8, 1},
-      {40, 2},
-      {44, 1},
-      {48, 1},
-      {80, 2},
-      {32, 1},
-      {62, 1},
-      {15, 1},
-      {67, 2}}},
-    {752, {{99, 1}, {80, 1}, {91, 1}}},
-    {753, {{53, 1}, {43, 1}, {1, 1}, {3, 2}, {4, 3}, {5, 1}, {34, 1}, {14, 1}}},
-    {754, {{76, 1}, {67, 1}, {1, 1}, {3, 2}, {4, 3}, {42, 1}}},
-    {756, {{2, 1}, {4, 2}, {5, 3}, {44, 1}, {32, 1}, {38, 1}}},
-    {757,
-     {{66, 1}, {54, 1}, {29, 1}, {40, 1}, {33, 1}, {48, 1}, {44, 1}, {20, 1}, {83, 1}, {81, 1}}},
-    {759, {{1, 1}, {3, 2}, {4, 3}, {6, 1}}},
-    {773, {{34, 1}, {29, 1}, {30, 2}, {35, 1}, {40, 1}}},
-    {774, {{1, 1}, {3, 2}, {4, 3}}},
-    {798, {{42, 1}, {35, 1}, {37, 2}, {34, 1}, {36, 2}, {32, 1}, {39, 2},
-           {52, 1}, {15, 1}, {16, 2}, {21, 3}, {51, 1}, {53, 2}, {38, 1},
-           {54, 2}, {48, 1}, {49, 2}, {50, 3}, {55, 1}, {47, 1}, {45, 1}}},
-    {820,
-     {{14, 1}, {18, 2}, {33, 1}, {34, 2}, {22, 1}, {17, 1}, {19, 2}, {23, 3}, {9, 1},  {11, 1},
-      {12, 2}, {8, 1},  {4, 1},  {7, 2},  {10, 1}, {20, 2}, {21, 3}, {26, 1}, {27, 2}, {28, 3}}},
-    {841,
-     {{27, 1},
-      {48, 1},
-      {73, 1},
-      {46, 1},
-      {19, 1},
-      {29, 1},
-      {1, 1},
-      {87, 1},
-      {38, 1},
-      {30, 1},
-      {34, 1},
-      {35, 2},
-      {36, 3},
-      {51, 1},
-      {52, 2},
-      {63, 1}}},
-    {843, {{2, 1}, {3, 2}}},
-    {844, {{5, 1}}},
-    {869, {{100, 1}, {102, 2}, {103, 3}}},
-    {871, {{9, 1}, {10, 2}, {11, 3}, {12, 1}, {5, 1}, {6, 2}, {13, 3}, {15, 1}, {16, 2}}},
-    {872,
-     {{31, 1}, {33, 2}, {25, 1}, {26, 2}, {19, 1}, {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {32, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {873, {{22, 1}, {19, 1}}},
-    {874, {{73, 1}, {78, 1}, {72, 1}, {47, 1}, {48, 2}, {49, 3}, {45, 1}, {50, 2}, {51, 3}, {40, 1},
-           {41, 2}, {42, 3}, {59, 1}, {63, 2}, {86, 1}, {99, 2}, {92, 1}, {93, 2}, {98, 3}, {95, 1},
-           {96, 2}, {97, 3}, {89, 1}, {94, 2}, {69, 1}, {74, 2}, {71, 1}, {75, 2}, {76, 3}, {61, 1},
-           {65, 2}, {60, 1}, {62, 2}, {64, 3}, {54, 1}, {55, 2}, {56, 3}}},
-    {895, {{89, 4},  {90, 5},  {91, 6},  {85, 6},  {86, 7}, {87, 8}, {81, 8}, {82, 9},
-           {83, 11}, {77, 11}, {78, 12}, {79, 13}, {94, 5}, {95, 6}, {96, 7}, {98, 1},
-           {99, 2},  {100, 3}, {75, 3},  {71, 3},  {72, 4}, {73, 5}, {9, 1},  {11, 2}}},
-    {924, {{9, 1},  {10, 2}, {13, 3}, {37, 4}, {41, 1}, {44, 2}, {34, 1},
-           {14, 1}, {15, 1}, {38, 2}, {24, 1}, {26, 2}, {25, 1}, {27, 2},
-           {28, 3}, {30, 4}, {40, 1}, {42, 2}, {2, 1},  {45, 2}, {46, 3}}},
-    {925, {{87, 1},  {89, 2},  {94, 3},  {88, 1},  {95, 2},  {96, 3},  {91, 1},  {93, 2},  {83, 1},
-           {86, 2},  {92, 3},  {35, 1},  {108, 1}, {32, 1},  {33, 2},  {34, 3},  {28, 1},  {29, 2},
-           {36, 3},  {140, 1}, {141, 2}, {136, 1}, {127, 1}, {120, 1}, {122, 2}, {123, 1}, {124, 2},
-           {126, 3}, {109, 1}, {121, 2}, {38, 1},  {39, 2},  {100, 1}, {102, 1}, {104, 1}}},
-    {926, {{21, 1}, {32, 2}, {27, 1}, {28, 2}, {29, 3}, {40, 4}, {48, 5}, {30, 1}, {42, 2}, {39, 1},
-           {50, 1}, {45, 1}, {56, 2}, {35, 1}, {37, 1}, {41, 2}, {46, 3}, {6, 1},  {47, 2}, {17, 1},
-           {18, 2}, {22, 3}, {4, 1},  {14, 2}, {15, 3}, {20, 4}, {44, 5}, {19, 1}, {26, 2}}},
-    {928,
-     {{18, 1},
-      {14, 1},
-      {20, 2},
-      {21, 3},
-      {22, 4},
-      {27, 5},
-      {23, 1},
-      {44, 2},
-      {46, 1},
-      {17, 1},
-      {34, 2},
-      {13, 1},
-      {19, 2}}},
-    {929,
-     {{68, 1},
-      {70, 2},
-      {75, 3},
-      {69, 1},
-      {76, 2},
-      {77, 3},
-      {72, 1},
-      {74, 2},
-      {64, 1},
-      {67, 2},
-      {73, 3},
-      {46, 1},
-      {47, 2},
-      {48, 1},
-      {54, 1},
-      {23, 1},
-      {49, 2},
-      {45, 1}}},
-    {930, {{37, 1}, {6, 1},  {8, 2},  {14, 3}, {18, 4}, {46, 5}, {19, 1}, {22, 2}, {45, 1},
-           {31, 1}, {48, 2}, {53, 3}, {32, 1}, {39, 1}, {49, 1}, {83, 2}, {11, 1}, {17, 2},
-           {27, 3}, {12, 1}, {13, 2}, {26, 3}, {36, 1}, {38, 2}, {77, 3}, {16, 1}, {59, 2},
-           {61, 3}, {80, 4}, {23, 1}, {29, 2}, {30, 3}, {68, 1}, {65, 1}, {66, 2}, {69, 1}}},
-    {931,
-     {{23, 1},
-      {10, 1},
-      {12, 2},
-      {16, 3},
-      {21, 4},
-      {24, 5},
-      {11, 1},
-      {29, 1},
-      {15, 1},
-      {17, 2},
-      {19, 1},
-      {20, 2},
-      {22, 3}}},
-    {932, {{74, 1}, {67, 1}, {62, 1}, {14, 1}, {30, 1}, {85, 1}, {86, 2}, {81, 1}}},
-    {947,
-     {{41, 1},
-      {42, 2},
-      {43, 3},
-      {37, 1},
-      {38, 2},
-      {39, 3},
-      {33, 1},
-      {34, 2},
-      {35, 3},
-      {29, 1},
-      {30, 2},
-      {31, 3}}},
-    {948, {{15, 1}, {16, 2}, {17, 3}, {3, 1}}},
-    {949, {{7, 1}, {8, 2}, {5, 1}}},
-    {950, {{7, 1}, {22, 1}, {21, 1}, {26, 1}, {11, 1}, {8, 1}, {2, 1}}},
-    {956, {{25, 1}, {26, 2}, {18, 1}, {19, 2}, {21, 3}, {22, 1}, {23, 2}, {24, 3}, {30, 1},
-           {36, 1}, {37, 2}, {38, 3}, {8, 1},  {42, 1}, {43, 2}, {14, 1}, {31, 2}, {11, 3},
-           {29, 4}, {40, 4}, {32, 5}, {33, 6}, {34, 7}, {27, 4}, {3, 1}}},
-    {957,
-     {{14, 1},
-      {18, 2},
-      {22, 1},
-      {17, 1},
-      {19, 2},
-      {23, 3},
-      {9, 1},
-      {11, 1},
-      {12, 2},
-      {8, 1},
-      {4, 1},
-      {7, 2},
-      {10, 1},
-      {20, 2},
-      {21, 3},
-      {26, 1},
-      {27, 2},
-      {28, 3}}},
-    {958, {{5, 1}}},
-    {976, {{1, 1}, {2, 2}, {3, 3}, {4, 4}}},
-    {989, {{4, 1}, {11, 2}, {15, 1}, {16, 1}, {7, 1}}},
-    {1023,
-     {{33, 1}, {34, 3}, {35, 4}, {29, 3}, {30, 4}, {31, 5}, {19, 1}, {20, 2}, {21, 3}, {14, 4},
-      {15, 5}, {16, 6}, {10, 6}, {11, 7}, {12, 8}, {6, 8},  {7, 9},  {8, 10}, {2, 10}, {3, 11},
-      {4, 12}, {23, 1}, {24, 2}, {25, 3}, {44, 3}, {40, 3}, {41, 4}, {42, 5}, {37, 5}, {38, 6}}},
-    {1026, {{43, 1}, {10, 1}, {35, 1}, {33, 1}, {23, 1}, {24, 2}, {21, 1}, {14, 1}, {12, 1}}},
-    {1035,
-     {{34, 1}, {35, 3}, {36, 4}, {30, 3}, {31, 4}, {32, 5}, {20, 1}, {21, 2},  {22, 3}, {16, 5},
-      {17, 6}, {18, 7}, {12, 7}, {13, 8}, {14, 9}, {8, 9},  {9, 10}, {10, 11}, {4, 11}, {5, 12},
-      {6, 13}, {24, 1}, {25, 2}, {26, 3}, {44, 3}, {40, 3}, {41, 4}, {42, 5},  {38, 5}}},
-    {1037, {{3, 1}, {4, 2}, {5, 3}, {6, 4}}},
-    {1085, {{47, 1}, {48, 2}, {50, 3}, {30, 1}, {55, 2}, {33, 1}, {43, 1}, {49, 2}, {51, 3}}},
-    {1086, {{7, 1}, {8, 2}, {3, 1}}},
-    {1087,
-     {{31, 1}, {33, 2}, {25, 1}, {26, 2}, {19, 1}, {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {32, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {1088,
-     {{60, 1}, {62, 2}, {14, 1}, {23, 1}, {24, 2}, {20, 1}, {21, 2}, {25, 3}, {15, 1}, {16, 2},
-      {26, 1}, {27, 2}, {28, 3}, {7, 1},  {29, 2}, {5, 1},  {18, 2}, {10, 1}, {11, 2}, {54, 1},
-      {55, 2}, {48, 1}, {59, 2}, {42, 1}, {52, 2}, {53, 3}, {46, 1}, {36, 1}, {49, 1}, {51, 2},
-      {61, 3}, {35, 1}, {37, 2}, {40, 3}, {44, 1}, {47, 2}, {58, 3}}},
-    {1090, {{73, 1}, {80, 2}, {76, 1}}},
-    {1092, {{7, 1}, {8, 2}, {3, 1}}},
-    {1093, {{45, 1}, {46, 2}, {54, 3}, {48, 1}, {31, 1}, {33, 2}, {50, 1}, {51, 2}, {53, 3},
-            {55, 1}, {56, 2}, {43, 1}, {47, 1}, {37, 1}, {38, 2}, {40, 3}, {25, 1}, {26, 2},
-            {19, 1}, {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1}, {7, 1},  {20, 1}, {22, 2},
-            {32, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {1121,
-     {{53, 1},
-      {44, 1},
-      {67, 1},
-      {41, 1},
-      {56, 1},
-      {45, 1},
-      {64, 1},
-      {18, 1},
-      {8, 1},
-      {27, 1},
-      {20, 1},
-      {39, 1}}},
-    {1123,
-     {{13, 1}, {42, 1}, {67, 2}, {75, 1}, {71, 1}, {48, 1}, {50, 1}, {15, 1}, {60, 2}, {59, 1},
-      {58, 1}, {68, 1}, {35, 1}, {73, 1}, {66, 1}, {2, 1},  {70, 2}, {6, 1},  {24, 2}, {72, 3}}},
-    {1124, {{11, 1}}},
-    {1125, {{39, 1}, {53, 1}, {48, 1}, {71, 1}, {74, 2}, {26, 1}, {59, 1}, {28, 1}, {49, 2},
-            {77, 3}, {78, 4}, {44, 1}, {79, 1}, {58, 1}, {75, 1}, {25, 1}, {57, 2}, {66, 1},
-            {61, 1}, {69, 1}, {33, 1}, {76, 2}, {70, 1}, {1, 1},  {11, 1}, {21, 2}, {72, 3}}},
-    {1127, {{36, 1}, {42, 1}, {74, 1}, {31, 1}, {41, 1}, {18, 1}, {53, 2}, {25, 1}, {40, 2},
-            {23, 1}, {61, 2}, {58, 1}, {19, 1}, {26, 2}, {67, 1}, {70, 1}, {48, 1}, {12, 1},
-            {73, 1}, {71, 1}, {59, 1}, {34, 1}, {28, 1}, {39, 2}, {75, 3}}},
-    {1130, {{3, 1}, {5, 2}, {6, 3}, {61, 1}, {1, 1}}},
-    {1132, {{55, 1}, {46, 1}, {51, 1}}},
-    {1133, {{16, 1}, {14, 1}, {17, 2}, {18, 3}, {77, 1}, {2, 1}, {36, 1}}},
-    {1135,
-     {{53, 1},
-      {45, 1},
-      {47, 1},
-      {41, 1},
-      {27, 1},
-      {59, 1},
-      {65, 2},
-      {64, 1},
-      {74, 1},
-      {34, 1},
-      {54, 1},
-      {50, 1},
-      {52, 1},
-      {70, 2}}},
-    {1137, {{1, 1}, {3, 2}, {4, 3}, {5, 1}, {24, 1}, {16, 1}, {10, 1}}},
-    {1138, {{21, 1}, {78, 1}, {59, 1}, {69, 1}, {50, 1}, {30, 1}, {46, 2}, {7, 1},  {23, 2},
-            {76, 3}, {75, 1}, {33, 1}, {74, 1}, {5, 1},  {20, 2}, {60, 1}, {19, 1}, {77, 2},
-            {44, 1}, {72, 2}, {70, 1}, {71, 1}, {51, 1}, {39, 1}, {4, 1},  {58, 2}, {79, 3}}},
-    {1141, {{1, 1}, {3, 2}, {4, 3}}},
-    {1143, {{53, 1}, {45, 1}, {47, 1}, {41, 1}, {37, 1}, {42, 2}, {27, 1}, {63, 2},
-            {79, 3}, {78, 1}, {59, 1}, {65, 2}, {77, 1}, {64, 1}, {73, 1}, {75, 1},
-            {80, 2}, {34, 1}, {81, 2}, {54, 1}, {50, 1}, {70, 1}}},
-    {1145, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {1153,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {1156, {{9, 1},   {10, 2},  {11, 3},  {12, 1},  {5, 1},  {6, 2},   {13, 3}, {15, 1},  {16, 2},
-            {50, 1},  {70, 1},  {58, 1},  {59, 2},  {63, 3}, {67, 1},  {68, 2}, {57, 1},  {60, 2},
-            {61, 1},  {64, 3},  {65, 4},  {93, 1},  {77, 1}, {78, 2},  {73, 1}, {112, 1}, {105, 1},
-            {107, 2}, {108, 1}, {109, 2}, {111, 3}, {94, 1}, {106, 2}, {85, 1}, {87, 1},  {89, 1}}},
-    {1158,
-     {{5, 1},
-      {62, 1},
-      {59, 1},
-      {52, 1},
-      {48, 1},
-      {46, 1},
-      {43, 1},
-      {34, 1},
-      {32, 1},
-      {23, 1},
-      {18, 1},
-      {19, 2},
-      {13, 1},
-      {1, 1}}},
-    {1163, {{4, 1}, {8, 2}, {6, 1}, {9, 2}, {12, 3}}},
-    {1165,
-     {{50, 2}, {4, 1},  {8, 2},  {6, 1},  {9, 2},  {12, 3}, {43, 1}, {47, 2}, {51, 3}, {40, 1},
-      {41, 2}, {48, 3}, {35, 1}, {33, 1}, {38, 1}, {39, 2}, {44, 3}, {29, 1}, {45, 2}, {49, 3}}},
-    {1167, {{12, 1}, {85, 1},  {9, 1},  {10, 2}, {11, 3},  {5, 1},   {6, 2},
-            {13, 3}, {104, 1}, {97, 1}, {99, 2}, {100, 1}, {101, 2}, {103, 3},
-            {86, 1}, {98, 2},  {15, 1}, {16, 2}, {77, 1},  {79, 1},  {81, 1}}},
-    {1211, {{131, 1}, {140, 2}, {154, 3}, {152, 1}, {158, 2}, {157, 1}, {159, 2}, {161, 3},
-            {126, 1}, {127, 2}, {128, 3}, {124, 1}, {147, 2}, {150, 3}, {141, 1}, {142, 2},
-            {156, 3}, {144, 1}, {145, 2}, {153, 3}, {133, 1}, {134, 2}, {162, 3}, {121, 1},
-            {122, 2}, {143, 3}, {136, 1}, {148, 2}, {155, 3}, {135, 1}, {138, 2}, {151, 3},
-            {132, 1}, {149, 2}, {160, 3}, {12, 1},  {84, 1},  {9, 1},   {10, 2},  {11, 3},
-            {5, 1},   {6, 2},   {13, 3},  {103, 1}, {96, 1},  {98, 2},  {99, 1},  {100, 2},
-            {102, 3}, {85, 1},  {97, 2},  {15, 1},  {16, 2},  {74, 1},  {78, 1},  {80, 1}}},
-    {1213, {{16, 1}, {18, 1}, {20, 1}, {23, 1}, {25, 2}}},
-    {1222,
-     {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2}, {17, 3}, {15, 1}, {16, 2},
-      {20, 3}, {21, 1}, {6, 1},  {9, 2},  {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {1244, {{18, 1}, {4, 1}}},
-    {1245, {{9, 1},   {10, 2}, {11, 3},  {12, 1},  {94, 1},  {5, 1},   {6, 2},   {13, 3},  {53, 1},
-            {54, 2},  {49, 1}, {113, 1}, {106, 1}, {108, 2}, {109, 1}, {110, 2}, {112, 3}, {95, 1},
-            {107, 2}, {39, 1}, {40, 2},  {41, 3},  {33, 1},  {36, 2},  {37, 3},  {24, 1},  {44, 2},
-            {45, 3},  {58, 1}, {59, 2},  {15, 1},  {16, 2},  {86, 1},  {88, 1},  {90, 1}}},
-    {1246, {{73, 1}, {74, 2}, {82, 3}, {76, 1}, {31, 1}, {33, 2}, {46, 1}, {55, 1}, {56, 2},
-            {52, 1}, {53, 2}, {57, 3}, {47, 1}, {48, 2}, {58, 1}, {59, 2}, {60, 3}, {39, 1},
-            {61, 2}, {37, 1}, {50, 2}, {42, 1}, {43, 2}, {78, 1}, {79, 2}, {81, 3}, {83, 1},
-            {84, 2}, {71, 1}, {75, 1}, {65, 1}, {66, 2}, {68, 3}, {25, 1}, {26, 2}, {19, 1},
-            {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1}, {7, 1},  {20, 1}, {22, 2}, {32, 3},
-            {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {1247, {{69, 1},  {78, 1}, {68, 1},  {70, 2},  {72, 3},  {71, 1},  {75, 2},  {76, 3},  {64, 1},
-            {65, 2},  {67, 3}, {51, 1},  {52, 2},  {48, 1},  {49, 2},  {53, 3},  {74, 1},  {62, 1},
-            {60, 1},  {61, 1}, {73, 2},  {12, 1},  {92, 1},  {9, 1},   {10, 2},  {11, 3},  {5, 1},
-            {6, 2},   {13, 3}, {111, 1}, {104, 1}, {106, 2}, {107, 1}, {108, 2}, {110, 3}, {93, 1},
-            {105, 2}, {15, 1}, {16, 2},  {82, 1},  {86, 1},  {88, 1}}},
-    {1251,
-     {{44, 2},
-      {49, 1},
-      {43, 1},
-      {7, 1},
-      {11, 2},
-      {40, 1},
-      {45, 2},
-      {42, 1},
-      {46, 2},
-      {47, 3},
-      {9, 1},
-      {13, 2},
-      {8, 1},
-      {10, 2},
-      {12, 3},
-      {2, 1},
-      {3, 2},
-      {4, 3}}},
-    {1300, {{21, 1}, {16, 1}, {14, 1}}},
-    {1320, {{12, 1}, {13, 1}, {5, 1}, {9, 2}, {17, 3}}},
-    {1322, {{12, 1}, {62, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {81, 1}, {74, 1}, {76, 2}, {77, 1}, {78, 2}, {80, 3},
-            {63, 1}, {75, 2}, {15, 1}, {16, 2}, {52, 1}, {56, 1}, {58, 1}}},
-    {1323,
-     {{31, 1}, {33, 2}, {25, 1}, {26, 2}, {19, 1}, {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {32, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {1343, {{8, 1}, {18, 2}, {26, 1}, {27, 2}, {23, 1}, {24, 1}, {7, 1}}},
-    {1347, {{44, 1}, {49, 1}, {37, 1}, {41, 2}}},
-    {1367,
-     {{52, 1},
-      {7, 1},
-      {8, 2},
-      {3, 1},
-      {71, 1},
-      {64, 1},
-      {66, 2},
-      {67, 1},
-      {68, 2},
-      {70, 3},
-      {53, 1},
-      {65, 2},
-      {42, 1},
-      {46, 1},
-      {48, 1}}},
-    {1371, {{19, 1}, {23, 1}, {20, 1}, {21, 2}, {22, 3}, {14, 1}}},
-    {1372, {{9, 1}, {13, 1}, {10, 1}, {11, 2}, {12, 3}}},
-    {1373,
-     {{12, 1},
-      {7, 1},
-      {9, 2},
-      {42, 1},
-      {44, 2},
-      {41, 1},
-      {45, 2},
-      {20, 1},
-      {5, 1},
-      {10, 2},
-      {13, 1},
-      {38, 1},
-      {32, 1},
-      {33, 2},
-      {37, 3}}},
-    {1377, {{45, 1}, {23, 1}, {58, 1}, {46, 1}, {54, 1}, {47, 1}, {48, 2}}},
-    {1378, {{14, 1}, {15, 2}, {7, 1}, {8, 2}}},
-    {1380, {{10, 1}, {19, 1}, {14, 1}}},
-    {1382, {{16, 1}, {19, 1}, {26, 1}, {24, 1}}},
-    {1384,
-     {{41, 1},
-      {44, 2},
-      {45, 1},
-      {42, 1},
-      {25, 1},
-      {29, 2},
-      {28, 1},
-      {47, 2},
-      {2, 1},
-      {49, 1},
-      {14, 1},
-      {48, 2},
-      {38, 1},
-      {50, 1},
-      {33, 1},
-      {40, 2}}},
-    {1385, {{28, 1}, {5, 1}, {7, 1}, {6, 1}, {8, 2}, {10, 3}, {11, 1}}},
-    {1391, {{12, 1}, {88, 1},  {9, 1},   {10, 2},  {11, 3},  {5, 1},   {6, 2},
-            {13, 3}, {107, 1}, {100, 1}, {102, 2}, {103, 1}, {104, 2}, {106, 3},
-            {89, 1}, {101, 2}, {15, 1},  {16, 2},  {80, 1},  {82, 1},  {84, 1}}},
-    {1393, {{54, 1}, {61, 1}, {68, 1}, {41, 1}, {45, 1}, {44, 1}, {27, 1}, {28, 1}, {25, 1}}},
-    {1394, {{24, 1}, {33, 1}, {23, 1}, {25, 2}, {27, 3}, {26, 1}, {30, 2},
-            {31, 3}, {19, 1}, {20, 2}, {22, 3}, {6, 1},  {7, 2},  {3, 1},
-            {4, 2},  {8, 3},  {29, 1}, {17, 1}, {15, 1}, {16, 1}, {28, 2}}},
-    {1401, {{1, 1}, {3, 2}, {4, 3}}},
-    {1407, {{26, 1}, {18, 1}, {25, 1}, {27, 2}, {29, 3}, {28, 1}, {32, 2},
-            {33, 3}, {20, 1}, {21, 2}, {23, 3}, {6, 1},  {7, 2},  {3, 1},
-            {4, 2},  {8, 3},  {31, 1}, {16, 1}, {11, 1}, {12, 1}, {30, 2}}},
-    {1408, {{17, 1}, {12, 1}, {10, 1}}},
-    {1438, {{30, 3},  {31, 6},   {14, 6},   {74, 8},  {89, 9},  {102, 11}, {29, 5},  {32, 6},
-            {39, 4},  {40, 5},   {57, 1},   {60, 1},  {95, 1},  {85, 1},   {96, 1},  {36, 1},
-            {6, 2},   {13, 4},   {81, 6},   {11, 9},  {12, 12}, {5, 11},   {7, 12},  {73, 13},
-            {99, 12}, {100, 13}, {101, 14}, {91, 11}, {94, 12}, {97, 13},  {92, 11}, {98, 13},
-            {34, 2},  {69, 6},   {70, 7},   {22, 7},  {23, 8},  {77, 1},   {109, 1}, {114, 1}}},
-    {1439, {{2, 4}}},
-    {1440, {{1, 1},  {40, 1}, {43, 1}, {54, 1}, {83, 1}, {78, 1}, {79, 1}, {74, 1}, {80, 1},
-            {63, 2}, {59, 1}, {81, 1}, {51, 1}, {53, 1}, {38, 1}, {34, 1}, {47, 1}, {30, 1},
-            {28, 1}, {16, 1}, {87, 1}, {86, 1}, {95, 1}, {20, 1}, {17, 1}, {10, 1}}},
-    {1449,
-     {{14, 1},
-      {33, 1},
-      {26, 1},
-      {28, 2},
-      {29, 1},
-      {30, 2},
-      {32, 3},
-      {15, 1},
-      {27, 2},
-      {6, 1},
-      {8, 1},
-      {10, 1}}},
-    {1450,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {1463,
-     {{27, 1},
-      {20, 1},
-      {24, 2},
-      {28, 3},
-      {17, 1},
-      {18, 2},
-      {25, 3},
-      {12, 1},
-      {10, 1},
-      {15, 1},
-      {16, 2},
-      {21, 3},
-      {6, 1},
-      {22, 2},
-      {26, 3}}},
-    {1464,
-     {{27, 1},
-      {20, 1},
-      {24, 2},
-      {28, 3},
-      {17, 1},
-      {18, 2},
-      {25, 3},
-      {12, 1},
-      {10, 1},
-      {15, 1},
-      {16, 2},
-      {21, 3},
-      {6, 1},
-      {22, 2},
-      {26, 3}}},
-    {1466,
-     {{14, 1},
-      {33, 1},
-      {26, 1},
-      {28, 2},
-      {29, 1},
-      {30, 2},
-      {32, 3},
-      {15, 1},
-      {27, 2},
-      {6, 1},
-      {8, 1},
-      {10, 1}}},
-    {1468,
-     {{12, 1},
-      {13, 2},
-      {21, 3},
-      {15, 1},
-      {17, 1},
-      {18, 2},
-      {20, 3},
-      {22, 1},
-      {23, 2},
-      {10, 1},
-      {14, 1},
-      {4, 1},
-      {5, 2},
-      {7, 3}}},
-    {1479, {{40, 1}, {45, 2}, {48, 3}, {27, 1}, {37, 1}, {51, 2}, {57, 3}, {20, 1}, {24, 2},
-            {28, 3}, {17, 1}, {18, 2}, {25, 3}, {12, 1}, {10, 1}, {15, 1}, {16, 2}, {21, 3},
-            {6, 1},  {22, 2}, {26, 3}, {44, 1}, {50, 2}, {53, 3}, {39, 1}, {46, 2}, {35, 1},
-            {36, 2}, {54, 3}, {47, 1}, {49, 2}, {55, 3}, {42, 1}, {52, 2}}},
-    {1484, {{2, 1}, {3, 2}}},
-    {1503, {{3, 1}, {4, 2}, {5, 3}, {6, 4}}},
-    {1517, {{113, 1}, {97, 1},  {105, 2}, {102, 1}, {103, 2}, {107, 1}, {115, 2}, {100, 1},
-            {104, 2}, {106, 3}, {12, 1},  {31, 1},  {9, 1},   {10, 2},  {11, 3},  {5, 1},
-            {6, 2},   {13, 3},  {50, 1},  {43, 1},  {45, 2},  {46, 1},  {47, 2},  {49, 3},
-            {32, 1},  {44, 2},  {15, 1},  {16, 2},  {23, 1},  {25, 1},  {27, 1}}},
-    {1518, {{18, 1}, {16, 1}, {66, 1}, {70, 1}}},
-    {1523, {{14, 1}, {15, 2}}},
-    {1527, {{22, 1}, {23, 2}, {24, 3}, {16, 1}, {19, 2}, {20, 3}, {7, 1}, {27, 2}, {28, 3}}},
-    {1536, {{22, 1}, {23, 2}, {24, 3}, {16, 1}, {19, 2}, {20, 3}, {7, 1}, {27, 2}, {28, 3}}},
-    {1537,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {1539,
-     {{52, 1},
-      {36, 1},
-      {37, 2},
-      {32, 1},
-      {71, 1},
-      {64, 1},
-      {66, 2},
-      {67, 1},
-      {68, 2},
-      {70, 3},
-      {53, 1},
-      {65, 2},
-      {42, 1},
-      {46, 1},
-      {48, 1}}},
-    {1540,
-     {{31, 1}, {33, 2}, {25, 1}, {26, 2}, {19, 1}, {30, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {32, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {29, 3}}},
-    {1541,
-     {{44, 1}, {53, 1}, {52, 1}, {55, 2}, {57, 3}, {56, 1}, {60, 2}, {61, 3}, {46, 1}, {47, 2},
-      {49, 3}, {42, 1}, {50, 2}, {39, 1}, {40, 2}, {54, 3}, {59, 1}, {37, 1}, {32, 1}, {33, 1},
-      {58, 2}, {22, 1}, {23, 2}, {24, 3}, {16, 1}, {19, 2}, {20, 3}, {7, 1},  {27, 2}, {28, 3}}},
-    {1542, {{48, 1}, {57, 1}, {14, 1}, {56, 1}, {59, 2}, {61, 3}, {60, 1}, {64, 2}, {65, 3},
-            {50, 1}, {51, 2}, {53, 3}, {46, 1}, {54, 2}, {43, 1}, {44, 2}, {58, 3}, {63, 1},
-            {41, 1}, {36, 1}, {37, 1}, {62, 2}, {33, 1}, {26, 1}, {28, 2}, {29, 1}, {30, 2},
-            {32, 3}, {15, 1}, {27, 2}, {6, 1},  {8, 1},  {10, 1}}},
-    {1550,
-     {{21, 1},
-      {26, 1},
-      {20, 1},
-      {7, 1},
-      {11, 2},
-      {17, 1},
-      {22, 2},
-      {19, 1},
-      {23, 2},
-      {24, 3},
-      {9, 1},
-      {13, 2},
-      {8, 1},
-      {10, 2},
-      {12, 3},
-      {2, 1},
-      {3, 2},
-      {4, 3}}},
-    {1557,
-     {{23, 1},
-      {27, 1},
-      {13, 1},
-      {22, 1},
-      {7, 1},
-      {4, 1},
-      {18, 2},
-      {21, 3},
-      {6, 1},
-      {11, 2},
-      {40, 1},
-      {46, 2}}},
-    {1577, {{31, 1}, {52, 1}, {28, 1}, {29, 2}, {30, 3}, {24, 1},  {25, 2},  {32, 3}, {78, 1},
-            {79, 2}, {74, 1}, {71, 1}, {64, 1}, {66, 2}, {67, 1},  {68, 2},  {70, 3}, {53, 1},
-            {65, 2}, {34, 1}, {35, 2}, {42, 1}, {46, 1}, {106, 1}, {105, 1}, {99, 1}, {48, 1}}},
-    {1591,
-     {{24, 1},
-      {35, 1},
-      {21, 1},
-      {22, 2},
-      {27, 1},
-      {39, 1},
-      {41, 2},
-      {37, 1},
-      {49, 2},
-      {34, 1},
-      {9, 1}}},
-    {1592, {{21, 1}, {22, 2}}},
-    {1598, {{12, 1}, {80, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {99, 1}, {92, 1}, {94, 2}, {95, 1}, {96, 2}, {98, 3},
-            {81, 1}, {93, 2}, {15, 1}, {16, 2}, {70, 1}, {74, 1}, {76, 1}}},
-    {1599,
-     {{68, 1},
-      {73, 1},
-      {67, 1},
-      {54, 1},
-      {58, 2},
-      {64, 1},
-      {69, 2},
-      {66, 1},
-      {70, 2},
-      {71, 3},
-      {56, 1},
-      {60, 2},
-      {55, 1},
-      {57, 2},
-      {59, 3},
-      {49, 1},
-      {50, 2},
-      {51, 3}}},
-    {1600, {{12, 1}, {31, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {50, 1}, {43, 1}, {45, 2}, {46, 1}, {47, 2}, {49, 3},
-            {32, 1}, {44, 2}, {15, 1}, {16, 2}, {23, 1}, {25, 1}, {27, 1}}},
-    {1601,
-     {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2}, {17, 3}, {15, 1}, {16, 2},
-      {20, 3}, {21, 1}, {6, 1},  {9, 2},  {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {1603,
-     {{119, 1},
-      {114, 1},
-      {112, 1},
-      {126, 1},
-      {137, 1},
-      {136, 1},
-      {141, 1},
-      {130, 1},
-      {127, 1},
-      {121, 1}}},
-    {1605,
-     {{25, 1}, {27, 2}, {28, 3}, {24, 1}, {26, 2}, {13, 1}, {14, 2}, {17, 3}, {15, 1}, {16, 2},
-      {20, 3}, {21, 1}, {6, 1},  {9, 2},  {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {1620,
-     {{56, 1},
-      {57, 2},
-      {53, 1},
-      {54, 2},
-      {50, 1},
-      {51, 2},
-      {20, 1},
-      {77, 2},
-      {29, 1},
-      {43, 2},
-      {25, 1},
-      {40, 2},
-      {63, 1},
-      {23, 1},
-      {42, 2},
-      {79, 3},
-      {26, 1},
-      {41, 2},
-      {39, 1}}},
-    {1621, {{82, 1},  {150, 2}, {152, 3}, {151, 1}, {74, 1},  {75, 2},  {79, 3},  {90, 4},  {91, 5},
-            {31, 1},  {40, 2},  {89, 3},  {158, 1}, {156, 1}, {159, 2}, {160, 3}, {18, 1},  {53, 1},
-            {15, 1},  {16, 2},  {17, 3},  {11, 1},  {12, 2},  {19, 3},  {72, 1},  {65, 1},  {67, 2},
-            {68, 1},  {69, 2},  {71, 3},  {54, 1},  {66, 2},  {21, 1},  {22, 2},  {45, 1},  {47, 1},
-            {33, 1},  {34, 2},  {36, 3},  {35, 1},  {37, 2},  {38, 3},  {26, 1},  {28, 2},  {32, 3},
-            {49, 1},  {166, 1}, {170, 2}, {173, 1}, {174, 2}, {169, 1}, {171, 1}, {172, 2}, {2, 1},
-            {165, 2}, {168, 3}, {125, 1}, {121, 1}, {123, 2}}},
-    {1623, {{12, 1}, {24, 2}, {37, 3}, {11, 1}, {17, 2}, {28, 3}, {16, 1}, {27, 2},
-            {31, 3}, {35, 1}, {36, 2}, {18, 1}, {20, 2}, {25, 1}, {26, 2}, {30, 3},
-            {23, 1}, {33, 2}, {10, 1}, {19, 2}, {9, 1},  {29, 2}}},
-    {1624, {{58, 1}, {78, 1}, {55, 1}, {56, 2}, {57, 3}, {51, 1}, {52, 2}, {59, 3}, {9, 1},
-            {10, 2}, {11, 3}, {7, 1},  {12, 2}, {13, 3}, {2, 1},  {3, 2},  {4, 3},  {97, 1},
-            {90, 1}, {92, 2}, {93, 1}, {94, 2}, {96, 3}, {79, 1}, {91, 2}, {61, 1}, {62, 2},
-            {68, 1}, {72, 1}, {74, 1}, {39, 1}, {30, 1}, {38, 1}, {41, 2}, {43, 3}, {42, 1},
-            {46, 2}, {47, 3}, {32, 1}, {33, 2}, {35, 3}, {28, 1}, {36, 2}, {25, 1}, {26, 2},
-            {40, 3}, {45, 1}, {23, 1}, {18, 1}, {19, 1}, {44, 2}}},
-    {1632, {{38, 1}, {34, 1}, {6, 1}, {43, 1}, {11, 1}, {25, 2}}},
-    {1633, {{18, 1}}},
-    {1635, {{11, 1}, {12, 2}, {13, 3}, {9, 1}, {14, 2}, {15, 3}, {4, 1}, {5, 2}, {6, 3}, {20, 1}}},
-    {1653, {{4, 1}, {5, 2}}},
-    {1663, {{9, 1},  {10, 2}, {11, 3}, {7, 1},  {12, 2}, {13, 3}, {2, 1},  {3, 2},  {4, 3},
-            {30, 1}, {39, 2}, {53, 3}, {51, 1}, {57, 2}, {56, 1}, {58, 2}, {60, 3}, {25, 1},
-            {26, 2}, {27, 3}, {23, 1}, {46, 2}, {49, 3}, {40, 1}, {41, 2}, {55, 3}, {43, 1},
-            {44, 2}, {52, 3}, {32, 1}, {33, 2}, {61, 3}, {20, 1}, {21, 2}, {42, 3}, {35, 1},
-            {47, 2}, {54, 3}, {34, 1}, {37, 2}, {50, 3}, {31, 1}, {48, 2}, {59, 3}}},
-    {1707, {{1, 1}}},
-    {1712, {{17, 1}, {12, 1}, {10, 1}}},
-    {1714, {{12, 1}, {35, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {54, 1}, {47, 1}, {49, 2}, {50, 1}, {51, 2}, {53, 3},
-            {36, 1}, {48, 2}, {15, 1}, {16, 2}, {25, 1}, {29, 1}, {31, 1}}},
-    {1715, {{39, 1}, {34, 1}, {32, 1}}},
-    {1717, {{12, 1}, {58, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {77, 1}, {70, 1}, {72, 2}, {73, 1}, {74, 2}, {76, 3},
-            {59, 1}, {71, 2}, {15, 1}, {16, 2}, {50, 1}, {52, 1}, {54, 1}}},
-    {1756,
-     {{47, 1}, {68, 1}, {44, 1}, {45, 2}, {46, 3}, {40, 1}, {41, 2}, {48, 3}, {87, 1}, {80, 1},
-      {82, 2}, {83, 1}, {84, 2}, {86, 3}, {69, 1}, {81, 2}, {50, 1}, {51, 2}, {58, 1}, {62, 1},
-      {14, 1}, {15, 2}, {34, 3}, {24, 1}, {30, 2}, {31, 3}, {20, 1}, {21, 2}, {25, 3}, {23, 1},
-      {16, 1}, {17, 2}, {19, 3}, {27, 1}, {28, 2}, {29, 3}, {64, 1}}},
-    {1758, {{13, 1}}},
-    {1766, {{12, 1}, {31, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {50, 1}, {43, 1}, {45, 2}, {46, 1}, {47, 2}, {49, 3},
-            {32, 1}, {44, 2}, {15, 1}, {16, 2}, {23, 1}, {25, 1}, {27, 1}}},
-    {1767,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {1784, {{1, 1}, {3, 2}, {4, 3}, {6, 1}}},
-    {1795,
-     {{92, 1},  {147, 2}, {71, 2},  {34, 1},  {44, 1},  {43, 1},  {68, 1},  {69, 2},  {70, 3},
-      {64, 1},  {65, 2},  {72, 3},  {152, 1}, {146, 1}, {42, 1},  {45, 2},  {47, 3},  {46, 1},
-      {50, 2},  {51, 3},  {36, 1},  {37, 2},  {39, 3},  {32, 1},  {40, 2},  {49, 1},  {29, 1},
-      {24, 1},  {25, 1},  {48, 2},  {111, 1}, {104, 1}, {106, 2}, {107, 1}, {108, 2}, {110, 3},
-      {93, 1},  {105, 2}, {74, 1},  {75, 2},  {133, 1}, {137, 2}, {82, 1},  {86, 1},  {143, 1},
-      {148, 2}, {145, 1}, {149, 2}, {150, 3}, {135, 1}, {139, 2}, {134, 1}, {136, 2}, {138, 3},
-      {128, 1}, {129, 2}, {130, 3}, {17, 1},  {12, 1},  {10, 1},  {88, 1}}},
-    {1808,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {1810, {{50, 1}, {59, 1}, {16, 1}, {58, 1}, {61, 2}, {63, 3}, {62, 1}, {66, 2}, {67, 3},
-            {52, 1}, {53, 2}, {55, 3}, {48, 1}, {56, 2}, {45, 1}, {46, 2}, {60, 3}, {65, 1},
-            {43, 1}, {38, 1}, {39, 1}, {64, 2}, {35, 1}, {28, 1}, {30, 2}, {31, 1}, {32, 2},
-            {34, 3}, {17, 1}, {29, 2}, {6, 1},  {10, 1}, {12, 1}}},
-    {1811,
-     {{32, 1}, {34, 2}, {25, 1}, {26, 2}, {19, 1}, {31, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {33, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {30, 3}}},
-    {1812,
-     {{13, 1},
-      {14, 2},
-      {15, 3},
-      {18, 1},
-      {21, 1},
-      {22, 2},
-      {25, 3},
-      {19, 1},
-      {23, 2},
-      {11, 1},
-      {17, 1},
-      {5, 1},
-      {6, 2},
-      {8, 3}}},
-    {1826, {{30, 1}, {17, 1}}},
-    {1835, {{20, 1}, {23, 2}, {21, 1}, {26, 1}, {19, 1}, {22, 2}}},
-    {1838, {{2, 1}}},
-    {1839, {{3, 1}, {1, 1}, {4, 2}, {5, 3}}},
-    {1848, {{37, 1}, {31, 1}, {6, 1},  {17, 2}, {84, 3}, {89, 4}, {26, 1}, {30, 2}, {25, 1},
-            {28, 2}, {53, 1}, {54, 2}, {59, 3}, {29, 1}, {66, 1}, {91, 2}, {68, 1}, {77, 2},
-            {83, 3}, {20, 1}, {69, 2}, {81, 3}, {78, 1}, {79, 2}, {82, 3}, {61, 1}, {62, 2},
-            {63, 3}, {67, 4}, {80, 1}, {88, 2}, {90, 3}, {12, 1}, {75, 2}, {76, 3}, {21, 1},
-            {27, 2}, {64, 3}, {93, 1}, {94, 2}, {9, 1},  {13, 2}, {14, 3}}},
-    {1849, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3},
-            {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {1864,
-     {{13, 1},
-      {16, 2},
-      {70, 1},
-      {68, 1},
-      {71, 1},
-      {9, 1},
-      {14, 2},
-      {32, 1},
-      {67, 1},
-      {22, 1},
-      {36, 1},
-      {52, 1},
-      {69, 1}}},
-    {1866, {{121, 1}, {142, 1}, {118, 1}, {119, 2}, {120, 3}, {114, 1}, {115, 2}, {122, 3},
-            {161, 1}, {154, 1}, {156, 2}, {157, 1}, {158, 2}, {160, 3}, {143, 1}, {155, 2},
-            {124, 1}, {125, 2}, {132, 1}, {136, 1}, {90, 1},  {138, 1}}},
-    {1925,
-     {{61, 1},
-      {39, 1},
-      {34, 1},
-      {35, 1},
-      {42, 1},
-      {28, 1},
-      {49, 2},
-      {46, 1},
-      {54, 1},
-      {56, 2},
-      {53, 1},
-      {65, 1},
-      {51, 1},
-      {69, 2},
-      {52, 1},
-      {19, 1},
-      {67, 1}}},
-    {1927, {{1, 1}, {3, 2}, {4, 3}, {5, 1}}},
-    {1938, {{24, 1}, {26, 2}, {7, 1}}},
-    {1950, {{27, 6},   {28, 7},   {9, 4},    {90, 5},   {114, 6},  {123, 7},  {26, 1},   {29, 3},
-            {103, 1},  {66, 1},   {108, 1},  {34, 1},   {35, 3},   {65, 2},   {67, 3},   {68, 4},
-            {105, 4},  {76, 1},   {113, 1},  {75, 1},   {6, 2},    {14, 4},   {99, 6},   {11, 9},
-            {13, 12},  {5, 12},   {7, 13},   {91, 14},  {119, 13}, {120, 14}, {125, 15}, {116, 12},
-            {121, 14}, {122, 15}, {117, 13}, {118, 14}, {31, 5},   {58, 6},   {59, 7},   {20, 7}}},
-    {1951, {{2, 4}}},
-    {1956, {{11, 1}}},
-    {1967,
-     {{7, 3},  {13, 3}, {29, 3}, {48, 1}, {11, 1}, {19, 2}, {23, 1}, {36, 1}, {37, 2}, {41, 3},
-      {45, 1}, {46, 2}, {55, 1}, {56, 2}, {51, 1}, {35, 1}, {38, 2}, {39, 1}, {42, 3}, {43, 4},
-      {14, 1}, {17, 2}, {24, 3}, {12, 1}, {21, 2}, {15, 1}, {16, 2}, {62, 1}}},
-    {1968,
-     {{35, 1}, {47, 2}, {60, 3}, {34, 1}, {40, 2}, {51, 3}, {39, 1}, {50, 2}, {54, 3}, {58, 1},
-      {59, 2}, {41, 1}, {43, 2}, {5, 1},  {9, 2},  {7, 1},  {10, 2}, {13, 3}, {48, 1}, {49, 2},
-      {53, 3}, {46, 1}, {56, 2}, {33, 1}, {42, 2}, {32, 1}, {52, 2}, {86, 1}, {88, 2}, {89, 3},
-      {85, 1}, {87, 2}, {74, 1}, {75, 2}, {78, 3}, {76, 1}, {77, 2}, {81, 3}, {82, 1}, {67, 1},
-      {70, 2}, {72, 1}, {79, 2}, {80, 3}, {62, 1}, {65, 2}, {66, 3}}},
-    {1971,
-     {{24, 1},
-      {13, 1},
-      {16, 1},
-      {27, 1},
-      {40, 2},
-      {46, 1},
-      {47, 1},
-      {3, 1},
-      {9, 2},
-      {10, 3},
-      {7, 1},
-      {15, 2}}},
-    {1973, {{32, 1}, {3, 1}, {1, 1}, {4, 2}, {5, 3}}},
-    {1974, {{18, 1}, {19, 2}}},
-    {1987, {{9, 1}, {10, 2}, {11, 3}, {12, 1}, {5, 1}, {6, 2}, {13, 3}, {15, 1}, {16, 2}}},
-    {2001, {{8, 1}}},
-    {2048, {{13, 1}, {18, 2}, {21, 3}, {56, 1}, {10, 1}, {24, 2}, {30, 3}, {49, 1}, {53, 2},
-            {57, 3}, {46, 1}, {47, 2}, {54, 3}, {41, 1}, {39, 1}, {44, 1}, {45, 2}, {50, 3},
-            {35, 1}, {51, 2}, {55, 3}, {17, 1}, {23, 2}, {26, 3}, {12, 1}, {19, 2}, {8, 1},
-            {9, 2},  {27, 3}, {20, 1}, {22, 2}, {28, 3}, {15, 1}, {25, 2}}},
-    {2055,
-     {{149, 1},
-      {131, 1},
-      {106, 1},
-      {80, 1},
-      {84, 1},
-      {92, 2},
-      {86, 1},
-      {87, 2},
-      {72, 1},
-      {73, 2},
-      {114, 1},
-      {63, 1},
-      {100, 2},
-      {109, 1},
-      {143, 1},
-      {110, 1},
-      {93, 1},
-      {104, 1}}},
-    {2056, {{14, 1}, {15, 2}}},
-    {2058,
-     {{170, 1},
-      {112, 1},
-      {104, 1},
-      {110, 2},
-      {111, 1},
-      {114, 2},
-      {97, 1},
-      {98, 2},
-      {133, 1},
-      {96, 1},
-      {157, 2},
-      {155, 1},
-      {125, 1},
-      {143, 1},
-      {127, 1},
-      {119, 1}}},
-    {2059, {{15, 1}, {16, 2}}},
-    {2065,
-     {{102, 1},
-      {92, 1},
-      {98, 2},
-      {96, 1},
-      {99, 2},
-      {84, 1},
-      {85, 2},
-      {87, 1},
-      {83, 1},
-      {100, 2},
-      {107, 1},
-      {110, 1},
-      {115, 1},
-      {104, 1},
-      {112, 1},
-      {109, 1}}},
-    {2066, {{14, 1}, {15, 2}}},
-    {2067,
-     {{57, 1},
-      {58, 2},
-      {59, 3},
-      {60, 1},
-      {53, 1},
-      {54, 2},
-      {61, 3},
-      {46, 1},
-      {47, 2},
-      {42, 1},
-      {63, 1},
-      {64, 2}}},
-    {2071,
-     {{12, 1},
-      {13, 2},
-      {14, 3},
-      {17, 1},
-      {20, 1},
-      {21, 2},
-      {26, 3},
-      {18, 1},
-      {24, 2},
-      {10, 1},
-      {16, 1},
-      {4, 1},
-      {5, 2},
-      {7, 3}}},
-    {2091, {{13, 1}}},
-    {2094, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3},
-            {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2095,
-     {{27, 1},
-      {20, 1},
-      {24, 2},
-      {28, 3},
-      {17, 1},
-      {18, 2},
-      {25, 3},
-      {12, 1},
-      {10, 1},
-      {15, 1},
-      {16, 2},
-      {21, 3},
-      {6, 1},
-      {22, 2},
-      {26, 3}}},
-    {2130, {{9, 1}, {10, 2}, {11, 3}, {12, 1}, {5, 1}, {6, 2}, {13, 3}, {15, 1}, {16, 2}}},
-    {2131,
-     {{6, 3},
-      {12, 3},
-      {10, 3},
-      {18, 4},
-      {22, 1},
-      {13, 1},
-      {16, 2},
-      {23, 3},
-      {11, 1},
-      {20, 2},
-      {14, 1},
-      {15, 2}}},
-    {2133, {{4, 1}, {8, 2}, {6, 1}, {9, 2}, {12, 3}}},
-    {2140, {{23, 1}, {17, 1}, {29, 1}, {19, 1}, {28, 1}, {1, 1}}},
-    {2142, {{3, 1},  {1, 1},  {4, 2},  {5, 3},  {18, 1}, {39, 1}, {15, 1}, {16, 2}, {17, 3},
-            {11, 1}, {12, 2}, {19, 3}, {58, 1}, {51, 1}, {53, 2}, {54, 1}, {55, 2}, {57, 3},
-            {40, 1}, {52, 2}, {21, 1}, {22, 2}, {29, 1}, {33, 1}, {35, 1}}},
-    {2167, {{17, 1}, {24, 1}, {23, 1}, {10, 1}, {15, 2}}},
-    {2189, {{14, 1}, {25, 1}, {13, 1}, {18, 1}, {12, 1}, {16, 2}}},
-    {2191,
-     {{19, 1}, {25, 2}, {5, 1}, {15, 1}, {14, 1}, {20, 2}, {18, 1}, {23, 2}, {13, 1}, {16, 2}}},
-    {2199,
-     {{13, 1}, {26, 2}, {15, 1}, {14, 1}, {19, 2}, {18, 1}, {22, 2}, {10, 1}, {16, 2}, {25, 3}}},
-    {2210,
-     {{21, 1}, {28, 1}, {29, 1}, {31, 2}, {50, 1}, {53, 1}, {48, 1}, {51, 2}, {5, 1},  {6, 2},
-      {1, 1},  {2, 2},  {3, 3},  {33, 1}, {34, 2}, {26, 1}, {20, 1}, {23, 2}, {30, 3}, {36, 1}}},
-    {2220, {{11, 1}, {4, 1}, {5, 2}, {6, 1}, {7, 2}, {8, 3}, {3, 1}}},
-    {2233, {{24, 1}, {98, 1},  {48, 1}, {38, 1},  {27, 1},  {43, 2}, {100, 1},
-            {44, 1}, {103, 1}, {3, 1},  {50, 1},  {17, 1},  {22, 2}, {102, 1},
-            {66, 1}, {106, 1}, {96, 1}, {104, 1}, {105, 1}, {54, 1}}},
-    {2235, {{2, 1}, {5, 2}, {21, 1}, {30, 1}, {29, 1}, {22, 1}}},
-    {2237, {{24, 1}, {45, 1}, {21, 1}, {22, 2}, {23, 3}, {17, 1}, {18, 2},
-            {25, 3}, {63, 1}, {57, 1}, {59, 2}, {53, 1}, {60, 2}, {62, 3},
-            {46, 1}, {58, 2}, {27, 1}, {28, 2}, {35, 1}, {39, 1}, {41, 1}}},
-    {2249, {{22, 1}, {7, 1}, {2, 1}, {14, 1}}},
-    {2270, {{46, 1}, {16, 1}, {43, 1}, {44, 2}, {45, 3}, {39, 1}, {40, 2},
-            {47, 3}, {35, 1}, {28, 1}, {30, 2}, {31, 1}, {32, 2}, {34, 3},
-            {17, 1}, {29, 2}, {49, 1}, {50, 2}, {6, 1},  {10, 1}, {12, 1}}},
-    {2274, {{2, 1}, {3, 2}}},
-    {2292, {{25, 1}, {16, 1}, {24, 1}, {27, 2}, {29, 3}, {28, 1}, {32, 2},
-            {33, 3}, {18, 1}, {19, 2}, {21, 3}, {14, 1}, {22, 2}, {11, 1},
-            {12, 2}, {26, 3}, {31, 1}, {9, 1},  {4, 1},  {5, 1},  {30, 2}}},
-    {2293,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {2302, {{9, 1}, {10, 2}, {11, 3}, {12, 1}, {5, 1}, {6, 2}, {13, 3}, {15, 1}, {16, 2}}},
-    {2306, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},  {13, 3},
-            {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3}, {34, 1}, {46, 2},
-            {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}, {62, 1}, {63, 2}, {58, 1}}},
-    {2311,
-     {{27, 1},
-      {20, 1},
-      {24, 2},
-      {28, 3},
-      {17, 1},
-      {18, 2},
-      {25, 3},
-      {12, 1},
-      {10, 1},
-      {15, 1},
-      {16, 2},
-      {21, 3},
-      {6, 1},
-      {22, 2},
-      {26, 3}}},
-    {2323, {{12, 1}, {13, 2}, {14, 3}, {17, 1}, {57, 1}, {59, 2}, {20, 1}, {21, 2}, {26, 3},
-            {18, 1}, {24, 2}, {10, 1}, {16, 1}, {4, 1},  {5, 2},  {7, 3},  {50, 1}, {51, 2},
-            {44, 1}, {56, 2}, {38, 1}, {48, 2}, {49, 3}, {42, 1}, {32, 1}, {45, 1}, {47, 2},
-            {58, 3}, {31, 1}, {33, 2}, {36, 3}, {40, 1}, {43, 2}, {55, 3}}},
-    {2327,
-     {{14, 1},
-      {9, 1},
-      {10, 2},
-      {15, 3},
-      {20, 1},
-      {17, 1},
-      {5, 1},
-      {7, 2},
-      {11, 3},
-      {12, 4},
-      {13, 1}}},
-    {2328, {{1, 1}}},
-    {2333, {{8, 1}, {10, 2}}},
-    {2336,
-     {{24, 1}, {27, 2}, {38, 3}, {23, 1}, {16, 1}, {14, 1}, {15, 2}, {26, 3}, {33, 1}, {35, 2},
-      {31, 1}, {32, 2}, {34, 3}, {17, 1}, {25, 2}, {36, 3}, {22, 1}, {9, 1},  {11, 2}, {28, 3}}},
-    {2340, {{1, 1}, {24, 1}, {3, 1}, {6, 2}, {29, 1}, {26, 1}, {22, 1}, {27, 1}}},
-    {2342,
-     {{14, 1}, {12, 1}, {15, 2}, {29, 1}, {31, 1}, {13, 1}, {4, 1}, {32, 1}, {33, 2}, {25, 1}}},
-    {2343, {{11, 1}}},
-    {2345, {{7, 1}, {6, 1}, {9, 2}, {25, 1}, {11, 1}, {4, 1}, {40, 1}, {26, 1}}},
-    {2346, {{8, 1}}},
-    {2347,
-     {{1, 1}, {4, 2}, {10, 1}, {23, 1}, {22, 1}, {20, 1}, {21, 2}, {17, 1}, {11, 1}, {13, 1}}},
-    {2348, {{10, 1}, {11, 2}, {6, 1}}},
-    {2349,
-     {{32, 1}, {34, 2}, {25, 1}, {26, 2}, {19, 1}, {31, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {33, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {30, 3}}},
-    {2362, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3},
-            {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2367, {{12, 1}, {33, 1}, {71, 1}, {72, 2}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3}, {69, 1}, {70, 2},
-            {67, 1}, {68, 2}, {65, 1}, {66, 2}, {63, 1}, {64, 2}, {61, 1}, {62, 2}, {34, 1},
-            {46, 2}, {59, 1}, {60, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2428, {{10, 1}}},
-    {2431,
-     {{6, 1},
-      {21, 1},
-      {15, 1},
-      {26, 2},
-      {28, 1},
-      {33, 2},
-      {29, 1},
-      {14, 1},
-      {17, 2},
-      {23, 3},
-      {25, 1},
-      {5, 1},
-      {8, 2},
-      {22, 3},
-      {20, 1},
-      {24, 2}}},
-    {2432, {{12, 2}, {63, 3}, {57, 2}, {61, 1}, {69, 2}, {33, 1}, {9, 1},  {10, 2}, {11, 3},
-            {5, 1},  {6, 2},  {13, 3}, {73, 1}, {64, 1}, {67, 2}, {74, 3}, {62, 1}, {71, 2},
-            {65, 1}, {66, 2}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3}, {34, 1},
-            {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2483,
-     {{18, 1},
-      {23, 2},
-      {17, 1},
-      {24, 1},
-      {6, 1},
-      {10, 1},
-      {19, 2},
-      {5, 1},
-      {7, 2},
-      {22, 3},
-      {25, 1}}},
-    {2484,
-     {{20, 1},
-      {22, 2},
-      {28, 1},
-      {14, 1},
-      {18, 1},
-      {24, 2},
-      {17, 1},
-      {27, 2},
-      {11, 1},
-      {15, 2},
-      {29, 3}}},
-    {2485,
-     {{15, 1},
-      {23, 2},
-      {25, 1},
-      {4, 1},
-      {17, 1},
-      {26, 2},
-      {7, 1},
-      {22, 2},
-      {5, 1},
-      {10, 2},
-      {20, 3}}},
-    {2486,
-     {{24, 1},
-      {30, 2},
-      {27, 1},
-      {12, 1},
-      {16, 1},
-      {21, 2},
-      {15, 1},
-      {25, 2},
-      {9, 1},
-      {13, 2},
-      {26, 3}}},
-    {2487,
-     {{18, 1},
-      {27, 2},
-      {24, 1},
-      {12, 1},
-      {19, 1},
-      {20, 2},
-      {15, 1},
-      {23, 2},
-      {9, 1},
-      {13, 2},
-      {26, 1}}},
-    {2501, {{34, 1}, {33, 1}, {31, 1}}},
-    {2508,
-     {{60, 1},
-      {47, 1},
-      {40, 1},
-      {11, 1},
-      {12, 2},
-      {42, 1},
-      {17, 1},
-      {29, 2},
-      {10, 1},
-      {20, 2},
-      {39, 1},
-      {19, 1},
-      {26, 2},
-      {25, 1},
-      {44, 1}}},
-    {2509, {{5, 1}, {6, 2}}},
-    {2512,
-     {{9, 1},  {10, 2}, {11, 3}, {12, 1}, {34, 1}, {131, 1}, {132, 2}, {133, 3}, {5, 1},  {6, 2},
-      {13, 3}, {71, 1}, {72, 2}, {84, 3}, {85, 1}, {93, 2},  {108, 1}, {82, 1},  {83, 2}, {76, 1},
-      {77, 2}, {78, 1}, {79, 2}, {81, 3}, {92, 1}, {89, 1},  {91, 2},  {94, 3},  {87, 1}, {88, 2},
-      {56, 1}, {57, 2}, {58, 3}, {53, 1}, {46, 1}, {48, 2},  {49, 1},  {50, 2},  {52, 3}, {35, 1},
-      {47, 2}, {15, 1}, {16, 2}, {24, 1}, {28, 1}, {30, 1}}},
-    {2513, {{12, 1}, {24, 2}, {37, 3}, {11, 1}, {17, 2}, {28, 3}, {16, 1}, {27, 2},
-            {31, 3}, {35, 1}, {36, 2}, {18, 1}, {20, 2}, {50, 1}, {25, 1}, {26, 2},
-            {30, 3}, {23, 1}, {33, 2}, {10, 1}, {19, 2}, {9, 1},  {29, 2}, {51, 1},
-            {54, 2}, {55, 1}, {44, 1}, {45, 2}, {53, 3}, {46, 1}, {49, 2}, {52, 3}}},
-    {2530, {{26, 5},   {27, 6},   {9, 4},    {87, 5},   {109, 6},  {120, 7},  {25, 1},   {28, 3},
-            {101, 1},  {63, 1},   {102, 1},  {33, 1},   {34, 3},   {62, 2},   {64, 3},   {65, 4},
-            {104, 4},  {73, 1},   {107, 1},  {72, 1},   {6, 2},    {14, 4},   {99, 6},   {11, 9},
-            {13, 12},  {5, 12},   {7, 13},   {88, 14},  {119, 13}, {124, 14}, {125, 15}, {111, 12},
-            {112, 14}, {114, 15}, {121, 13}, {122, 14}, {30, 5},   {55, 6},   {56, 7},   {20, 7}}},
-    {2531, {{2, 4}}},
-    {2553, {{16, 1}, {17, 2}, {18, 3}, {19, 1}, {12, 1}, {13, 2}, {20, 3}, {22, 1}, {23, 2}}},
-    {2596, {{72, 1}, {81, 1}, {38, 1}, {118, 1}, {119, 2}, {114, 1}, {80, 1}, {83, 2}, {85, 3},
-            {84, 1}, {88, 2}, {89, 3}, {74, 1},  {75, 2},  {77, 3},  {70, 1}, {78, 2}, {67, 1},
-            {68, 2}, {82, 3}, {87, 1}, {65, 1},  {60, 1},  {61, 1},  {86, 2}, {57, 1}, {50, 1},
-            {52, 2}, {53, 1}, {54, 2}, {56, 3},  {39, 1},  {51, 2},  {28, 1}, {32, 1}, {34, 1}}},
-    {2597,
-     {{101, 1}, {65, 1}, {66, 2},  {67, 3}, {70, 2}, {105, 1}, {91, 1}, {34, 1}, {38, 2}, {36, 1},
-      {39, 2},  {42, 3}, {100, 1}, {85, 1}, {82, 1}, {96, 2},  {99, 3}, {84, 1}, {89, 2}, {73, 1},
-      {74, 2},  {79, 3}, {71, 1},  {77, 2}, {63, 1}, {69, 1},  {57, 1}, {58, 2}, {60, 3}, {25, 1},
-      {27, 2},  {28, 3}, {24, 1},  {26, 2}, {13, 1}, {14, 2},  {17, 3}, {15, 1}, {16, 2}, {20, 3},
-      {21, 1},  {6, 1},  {9, 2},   {11, 1}, {18, 2}, {19, 3},  {1, 1},  {4, 2},  {5, 3}}},
-    {2599,
-     {{23, 1},
-      {30, 2},
-      {8, 1},
-      {20, 1},
-      {19, 1},
-      {24, 2},
-      {22, 1},
-      {27, 2},
-      {4, 1},
-      {17, 2},
-      {29, 3},
-      {13, 1}}},
-    {2601, {{12, 1}, {37, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {56, 1}, {49, 1}, {51, 2}, {52, 1}, {53, 2}, {55, 3},
-            {38, 1}, {50, 2}, {15, 1}, {16, 2}, {27, 1}, {31, 1}, {33, 1}}},
-    {2605, {{29, 6},  {86, 3},   {113, 4},  {24, 1},  {30, 2},   {63, 1},   {104, 1},  {33, 1},
-            {34, 3},  {62, 2},   {64, 3},   {65, 4},  {98, 4},   {73, 1},   {110, 1},  {72, 1},
-            {5, 2},   {4, 1},    {6, 3},    {87, 8},  {115, 9},  {116, 11}, {121, 12}, {56, 10},
-            {106, 9}, {120, 10}, {122, 11}, {118, 9}, {119, 11}, {20, 4}}},
-    {2606, {{2, 4}}},
-    {2615, {{5, 1}}},
-    {2616, {{29, 1}, {31, 2}, {32, 3}, {45, 1}, {48, 1}, {56, 1}, {21, 1},
-            {22, 2}, {26, 3}, {16, 1}, {46, 1}, {53, 2}, {54, 3}, {11, 1},
-            {14, 2}, {15, 3}, {25, 4}, {42, 1}, {41, 1}, {47, 2}, {24, 1}}},
-    {2617,
-     {{55, 1},
-      {57, 2},
-      {58, 3},
-      {49, 1},
-      {47, 1},
-      {50, 2},
-      {37, 1},
-      {38, 2},
-      {39, 3},
-      {42, 1},
-      {53, 2},
-      {59, 3},
-      {8, 1},
-      {12, 2},
-      {19, 3},
-      {51, 4},
-      {43, 1},
-      {44, 2},
-      {40, 1}}},
-    {2619, {{55, 1}, {57, 2}, {58, 3}, {37, 1}, {53, 1}, {64, 1}, {44, 1},
-            {45, 2}, {46, 3}, {29, 1}, {51, 1}, {59, 2}, {63, 1}, {25, 1},
-            {26, 2}, {48, 3}, {68, 4}, {50, 1}, {65, 1}, {1, 1},  {3, 2}}},
-    {2620,
-     {{44, 1},
-      {46, 2},
-      {47, 3},
-      {34, 1},
-      {38, 1},
-      {15, 1},
-      {23, 2},
-      {24, 3},
-      {4, 1},
-      {28, 1},
-      {33, 2},
-      {41, 1},
-      {10, 1},
-      {11, 2},
-      {16, 3},
-      {39, 4},
-      {26, 1},
-      {27, 2},
-      {36, 1}}},
-    {2621,
-     {{22, 1}, {43, 1}, {19, 1}, {20, 2},  {21, 3}, {15, 1}, {16, 2}, {23, 3}, {62, 1}, {55, 1},
-      {57, 2}, {58, 1}, {59, 2}, {61, 3},  {44, 1}, {56, 2}, {25, 1}, {26, 2}, {33, 1}, {108, 1},
-      {37, 1}, {71, 1}, {39, 1}, {113, 1}, {76, 1}, {80, 1}, {81, 2}, {82, 3}}},
-    {2624, {{69, 1}}},
-    {2627, {{4, 1}, {5, 2}, {6, 3}}},
-    {2628, {{29, 1}, {38, 1}, {24, 1}, {42, 1}}},
-    {2632, {{50, 1}, {62, 1}, {22, 1}, {24, 1}, {38, 1}, {49, 1}, {34, 1},
-            {20, 1}, {17, 1}, {19, 2}, {32, 1}, {13, 1}, {5, 1},  {23, 1},
-            {54, 1}, {67, 1}, {31, 1}, {27, 1}, {59, 2}, {61, 1}, {56, 1}}},
-    {2633,
-     {{39, 1},
-      {16, 1},
-      {35, 1},
-      {53, 1},
-      {49, 1},
-      {23, 1},
-      {12, 1},
-      {4, 1},
-      {37, 2},
-      {24, 1},
-      {15, 1},
-      {33, 1},
-      {17, 1},
-      {48, 1},
-      {61, 1},
-      {31, 1},
-      {28, 1},
-      {52, 2},
-      {56, 1}}},
-    {2637,
-     {{33, 1},
-      {14, 1},
-      {50, 1},
-      {26, 1},
-      {18, 1},
-      {6, 1},
-      {25, 2},
-      {23, 1},
-      {13, 1},
-      {17, 1},
-      {28, 1},
-      {62, 1},
-      {51, 1},
-      {36, 1}}},
-    {2638, {{32, 1}, {37, 1}}},
-    {2639,
-     {{12, 1},  {72, 1},  {99, 1},  {102, 2}, {109, 3}, {9, 1},   {10, 2},  {11, 3},  {5, 1},
-      {6, 2},   {13, 3},  {91, 1},  {84, 1},  {86, 2},  {87, 1},  {88, 2},  {90, 3},  {73, 1},
-      {85, 2},  {107, 1}, {108, 2}, {128, 3}, {35, 1},  {36, 2},  {100, 3}, {32, 1},  {98, 2},
-      {112, 3}, {105, 1}, {110, 2}, {111, 3}, {96, 1},  {101, 2}, {97, 1},  {106, 2}, {103, 1},
-      {104, 2}, {126, 1}, {127, 2}, {15, 1},  {16, 2},  {62, 1},  {66, 1},  {56, 1},  {57, 2},
-      {58, 3},  {50, 1},  {51, 2},  {52, 3},  {55, 1},  {45, 1},  {47, 2},  {48, 3},  {39, 1},
-      {40, 2},  {41, 3},  {68, 1}}},
-    {2640,
-     {{54, 1},
-      {23, 1},
-      {26, 1},
-      {57, 1},
-      {55, 1},
-      {39, 1},
-      {11, 1},
-      {12, 1},
-      {35, 2},
-      {16, 1},
-      {31, 1},
-      {6, 1},
-      {37, 1},
-      {24, 1},
-      {64, 1},
-      {33, 1},
-      {36, 1},
-      {56, 2}}},
-    {2644, {{27, 1}, {18, 1}}},
-    {2647, {{22, 1}, {14, 1}}},
-    {2650, {{21, 1}, {15, 1}}},
-    {2653, {{75, 1}, {78, 2}, {85, 3}, {36, 1}, {55, 1}, {48, 1}, {50, 2}, {51, 1}, {52, 2},
-            {54, 3}, {37, 1}, {49, 2}, {83, 1}, {84, 2}, {91, 3}, {13, 1}, {14, 2}, {76, 3},
-            {10, 1}, {74, 2}, {88, 3}, {81, 1}, {86, 2}, {87, 3}, {72, 1}, {77, 2}, {73, 1},
-            {82, 2}, {79, 1}, {80, 2}, {89, 1}, {90, 2}, {26, 1}, {30, 1}, {20, 1}, {64, 1},
-            {63, 1}, {68, 1}, {57, 1}, {32, 1}, {21, 1}, {3, 1}}},
-    {2654,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {2657,
-     {{70, 1}, {71, 1}, {74, 2}, {75, 1}, {64, 1}, {65, 2}, {73, 3}, {66, 1}, {69, 2}, {72, 3}}},
-    {2658, {{18, 1}, {19, 1}, {30, 1}, {31, 2}, {32, 1}, {6, 1}, {10, 1}, {12, 1}, {14, 1}}},
-    {2660, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3},
-            {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2661,
-     {{14, 1},
-      {23, 1},
-      {24, 2},
-      {20, 1},
-      {21, 2},
-      {25, 3},
-      {15, 1},
-      {16, 2},
-      {26, 1},
-      {27, 2},
-      {28, 3},
-      {7, 1},
-      {29, 2},
-      {5, 1},
-      {18, 2},
-      {10, 1},
-      {11, 2}}},
-    {2677,
-     {{32, 1}, {34, 2}, {25, 1}, {26, 2}, {19, 1}, {31, 2}, {13, 1}, {23, 2}, {24, 3}, {17, 1},
-      {7, 1},  {20, 1}, {22, 2}, {33, 3}, {6, 1},  {8, 2},  {11, 3}, {15, 1}, {18, 2}, {30, 3}}},
-    {2682,
-     {{6, 1},  {7, 2},  {8, 3},  {61, 1}, {3, 1},  {4, 2},  {9, 3},  {17, 1}, {64, 2}, {67, 3},
-      {66, 1}, {76, 2}, {27, 1}, {28, 2}, {21, 1}, {22, 2}, {23, 1}, {24, 2}, {26, 3}, {75, 1},
-      {74, 1}, {77, 2}, {78, 3}, {70, 1}, {71, 2}, {14, 1}, {65, 2}, {69, 3}, {60, 1}, {62, 2}}},
-    {2698, {{27, 1}, {23, 1}, {25, 2}, {13, 1}, {18, 1}}},
-    {2708,
-     {{16, 1}, {25, 2}, {20, 1}, {10, 1}, {15, 1}, {21, 2}, {13, 1}, {17, 2}, {7, 1}, {11, 2}}},
-    {2712, {{4, 1}}},
-    {2746,
-     {{41, 1},
-      {50, 1},
-      {51, 2},
-      {47, 1},
-      {48, 2},
-      {52, 3},
-      {42, 1},
-      {43, 2},
-      {53, 1},
-      {54, 2},
-      {55, 3},
-      {34, 1},
-      {56, 2},
-      {32, 1},
-      {45, 2},
-      {37, 1},
-      {38, 2}}},
-    {2762, {{69, 1}, {72, 2}, {87, 3}, {12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},
-            {6, 2},  {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3}, {34, 1},
-            {46, 2}, {80, 1}, {85, 2}, {86, 3}, {82, 1}, {83, 2}, {84, 3}, {75, 1}, {76, 2},
-            {91, 3}, {79, 1}, {89, 2}, {90, 3}, {65, 1}, {71, 2}, {66, 1}, {81, 2}, {73, 1},
-            {78, 2}, {59, 1}, {77, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2763,
-     {{44, 1}, {53, 1}, {54, 2}, {50, 1}, {51, 2}, {55, 3}, {45, 1}, {46, 2}, {56, 1}, {57, 2},
-      {58, 3}, {37, 1}, {59, 2}, {35, 1}, {48, 2}, {40, 1}, {41, 2}, {25, 1}, {27, 2}, {28, 3},
-      {24, 1}, {26, 2}, {13, 1}, {14, 2}, {17, 3}, {15, 1}, {16, 2}, {20, 3}, {21, 1}, {6, 1},
-      {9, 2},  {11, 1}, {18, 2}, {19, 3}, {1, 1},  {4, 2},  {5, 3}}},
-    {2768, {{39, 1}, {17, 1}, {12, 1}, {10, 1}, {38, 1}}},
-    {2814,
-     {{5, 1},
-      {7, 1},
-      {58, 1},
-      {69, 1},
-      {59, 1},
-      {61, 1},
-      {24, 1},
-      {42, 2},
-      {56, 1},
-      {68, 2},
-      {60, 1},
-      {47, 1},
-      {48, 2},
-      {27, 1},
-      {34, 1}}},
-    {2844, {{10, 1}}},
-    {2846,
-     {{17, 1},
-      {20, 2},
-      {18, 1},
-      {23, 1},
-      {16, 1},
-      {19, 2},
-      {6, 1},
-      {29, 1},
-      {28, 1},
-      {33, 1},
-      {10, 1},
-      {7, 1},
-      {1, 1}}},
-    {2855, {{17, 1}, {14, 1}}},
-    {2856,
-     {{47, 1},
-      {43, 1},
-      {45, 2},
-      {37, 1},
-      {48, 1},
-      {49, 2},
-      {31, 1},
-      {32, 2},
-      {36, 1},
-      {25, 1},
-      {27, 2},
-      {28, 3},
-      {13, 1},
-      {14, 2}}},
-    {2867, {{2, 1}}},
-    {2869, {{12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3},
-            {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2881,
-     {{13, 1},
-      {9, 1},
-      {5, 1},
-      {58, 1},
-      {29, 1},
-      {38, 1},
-      {59, 1},
-      {60, 1},
-      {2, 1},
-      {14, 2},
-      {34, 1},
-      {61, 1},
-      {43, 1}}},
-    {2884,
-     {{12, 1}, {15, 2}, {29, 3},  {81, 1},  {27, 1}, {28, 2}, {143, 3}, {24, 1}, {25, 2}, {26, 3},
-      {18, 1}, {19, 2}, {32, 3},  {22, 1},  {30, 2}, {31, 3}, {8, 1},   {14, 2}, {9, 1},  {23, 2},
-      {16, 1}, {21, 2}, {141, 1}, {142, 2}, {69, 1}, {54, 1}, {124, 1}, {129, 1}}},
-    {2889, {{13, 1}, {18, 2}, {26, 1}, {23, 1}, {27, 1}, {17, 1}, {19, 1}, {15, 1}}},
-    {2892, {{44, 1}, {49, 1}, {43, 1}, {30, 1}, {34, 2}, {40, 1}, {45, 2},
-            {42, 1}, {46, 2}, {47, 3}, {32, 1}, {36, 2}, {31, 1}, {33, 2},
-            {35, 3}, {25, 1}, {26, 2}, {27, 3}, {17, 1}, {12, 1}, {10, 1}}},
-    {2901, {{13, 1}, {18, 1}}},
-    {2905, {{13, 1}, {18, 2}, {26, 1}, {23, 1}, {27, 1}, {17, 1}, {19, 1}, {15, 1}}},
-    {2909, {{48, 1}, {49, 2}, {50, 3}, {16, 1}, {27, 2}, {31, 3}, {11, 1}, {17, 2}, {28, 3},
-            {12, 1}, {24, 2}, {37, 3}, {53, 1}, {35, 1}, {36, 2}, {18, 1}, {20, 2}, {25, 1},
-            {26, 2}, {30, 3}, {23, 1}, {33, 2}, {10, 1}, {19, 2}, {9, 1},  {29, 2}, {56, 1},
-            {57, 2}, {62, 3}, {54, 1}, {60, 2}, {46, 1}, {52, 1}, {40, 1}, {41, 2}, {43, 3}}},
-    {2912, {{14, 1}}},
-    {2944, {{40, 1}}},
-    {2953, {{71, 1}, {74, 2}, {89, 3}, {12, 1}, {33, 1}, {9, 1},  {10, 2}, {11, 3}, {5, 1},
-            {6, 2},  {13, 3}, {52, 1}, {45, 1}, {47, 2}, {48, 1}, {49, 2}, {51, 3}, {34, 1},
-            {46, 2}, {82, 1}, {87, 2}, {88, 3}, {84, 1}, {85, 2}, {86, 3}, {77, 1}, {78, 2},
-            {93, 3}, {81, 1}, {91, 2}, {92, 3}, {67, 1}, {73, 2}, {68, 1}, {83, 2}, {75, 1},
-            {80, 2}, {61, 1}, {79, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {29, 1}}},
-    {2960,
-     {{12, 1},
-      {13, 2},
-      {14, 3},
-      {17, 1},
-      {20, 1},
-      {21, 2},
-      {26, 3},
-      {18, 1},
-      {24, 2},
-      {10, 1},
-      {16, 1},
-      {4, 1},
-      {5, 2},
-      {7, 3}}},
-    {2961, {{59, 1}, {41, 1}, {36, 1}, {34, 1}, {58, 1}}},
-    {2967, {{46, 1}, {16, 1}, {43, 1}, {44, 2}, {45, 3}, {39, 1}, {40, 2}, {47, 3},
-            {35, 1}, {28, 1}, {30, 2}, {31, 1}, {32, 2}, {34, 3}, {17, 1}, {29, 2},
-            {49, 1}, {50, 2}, {6, 1},  {10, 1}, {12, 1}, {62, 1}}},
-    {2968,
-     {{13, 1},
-      {18, 2},
-      {21, 3},
-      {10, 1},
-      {24, 2},
-      {30, 3},
-      {17, 1},
-      {23, 2},
-      {26, 3},
-      {12, 1},
-      {19, 2},
-      {8, 1},
-      {9, 2},
-      {27, 3},
-      {20, 1},
-      {22, 2},
-      {28, 3},
-      {15, 1},
-      {25, 2}}},
-    {2977, {{55, 1}, {56, 1}, {48, 1}, {52, 2}, {60, 3}}},
-    {2978, {{28, 1}, {19, 1}, {12, 1}}},
-    {2983, {{33, 1}, {12, 1}, {71, 1}, {74, 2}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {72, 1}, {77, 1}, {70, 1}, {73, 2}, {52, 1}, {45, 1}, {47, 2}, {48, 1},
-            {49, 2}, {51, 3}, {34, 1}, {46, 2}, {15, 1}, {16, 2}, {23, 1}, {27, 1}, {60, 1},
-            {89, 1}, {88, 1}, {93, 1}, {64, 1}, {29, 1}, {61, 1}, {55, 1}}},
-    {2984, {{14, 1}, {19, 2}, {22, 3}, {83, 1}, {11, 1}, {25, 2}, {31, 3}, {43, 1}, {76, 1},
-            {80, 2}, {84, 3}, {73, 1}, {74, 2}, {81, 3}, {68, 1}, {66, 1}, {71, 1}, {72, 2},
-            {77, 3}, {62, 1}, {78, 2}, {82, 3}, {52, 1}, {53, 2}, {49, 1}, {50, 2}, {54, 3},
-            {44, 1}, {45, 2}, {55, 1}, {56, 2}, {57, 3}, {36, 1}, {58, 2}, {34, 1}, {47, 2},
-            {39, 1}, {40, 2}, {18, 1}, {24, 2}, {27, 3}, {13, 1}, {20, 2}, {9, 1},  {10, 2},
-            {28, 3}, {21, 1}, {23, 2}, {29, 3}, {16, 1}, {26, 2}}},
-    {3017, {{20, 1}, {10, 1}, {4, 1}}},
-    {3028, {{2, 1}}},
-    {3030, {{1, 1}, {39, 1}, {38, 1}}},
-    {3032,
-     {{22, 2},
-      {32, 3},
-      {59, 1},
-      {62, 2},
-      {65, 3},
-      {55, 1},
-      {60, 2},
-      {56, 1},
-      {57, 2},
-      {63, 3},
-      {51, 1},
-      {47, 1},
-      {64, 2},
-      {40, 1},
-      {41, 2},
-      {37, 1},
-      {38, 1},
-      {21, 1},
-      {9, 1}}},
-    {3036, {{2, 1}}},
-    {3053, {{7, 1}}},
-    {3069, {{9, 1},  {15, 2}, {19, 3}, {13, 1}, {42, 1}, {22, 1}, {23, 2}, {24, 3},
-            {5, 1},  {6, 2},  {7, 3},  {3, 1},  {31, 2}, {35, 3}, {12, 1}, {18, 2},
-            {20, 3}, {16, 1}, {17, 2}, {46, 3}, {28, 1}, {26, 1}, {37, 1}, {38, 2}}},
-    {3091, {{4, 1}, {8, 2}, {5, 1}}},
-    {3099,
-     {{12, 1}, {13, 1}, {5, 1}, {9, 2}, {17, 3}, {33, 1}, {34, 2}, {35, 3}, {39, 1}, {31, 1}}},
-    {3139, {{15, 1}, {16, 1}, {3, 1}, {1, 1}}},
-    {3158, {{6, 1}}},
-    {3172, {{1, 1}}},
-    {3175,
-     {{15, 1},
-      {16, 2},
-      {17, 1},
-      {18, 2},
-      {8, 1},
-      {9, 2},
-      {10, 3},
-      {14, 1},
-      {3, 1},
-      {5, 2},
-      {6, 3},
-      {1, 1}}},
-    {3176,
-     {{15, 1},
-      {16, 2},
-      {17, 1},
-      {18, 2},
-      {8, 1},
-      {9, 2},
-      {10, 3},
-      {14, 1},
-      {3, 1},
-      {5, 2},
-      {6, 3},
-      {1, 1}}},
-    {3179, {{14, 1}, {17, 2}, {32, 3}, {25, 1}, {30, 2}, {31, 3}, {27, 1}, {28, 2},
-            {29, 3}, {20, 1}, {21, 2}, {36, 3}, {24, 1}, {34, 2}, {35, 3}, {10, 1},
-            {16, 2}, {11, 1}, {26, 2}, {18, 1}, {23, 2}, {4, 1},  {22, 2}}},
-    {3188,
-     {{15, 1},
-      {16, 2},
-      {17, 1},
-      {18, 2},
-      {8, 1},
-      {9, 2},
-      {10, 3},
-      {14, 1},
-      {3, 1},
-      {5, 2},
-      {6, 3},
-      {1, 1}}},
-    {3235, {{2, 1}}},
-    {3263,
-     {{15, 1}, {65, 1}, {68, 2}, {54, 1}, {59, 2}, {67, 1}, {56, 1}, {57, 2}, {58, 3}, {20, 1}}},
-    {3271,
-     {{5, 1},
-      {24, 1},
-      {12, 1},
-      {13, 2},
-      {17, 3},
-      {21, 1},
-      {22, 2},
-      {11, 1},
-      {14, 2},
-      {15, 1},
-      {18, 3},
-      {19, 4}}},
-    {3273,
-     {{5, 1},
-      {24, 1},
-      {12, 1},
-      {13, 2},
-      {17, 3},
-      {21, 1},
-      {22, 2},
-      {11, 1},
-      {14, 2},
-      {15, 1},
-      {18, 3},
-      {19, 4}}},
-    {3279, {{12, 1}}},
-    {3287, {{13, 1}, {30, 2}, {21, 1}}},
-    {3296,
-     {{43, 1},  {98, 1},  {106, 2}, {137, 1}, {128, 1}, {94, 2},  {170, 2}, {100, 2}, {151, 1},
-      {110, 1}, {158, 1}, {159, 2}, {163, 3}, {167, 1}, {168, 2}, {69, 1},  {70, 2},  {65, 1},
-      {157, 1}, {160, 2}, {161, 1}, {164, 3}, {165, 4}, {136, 3}, {139, 4}, {141, 5}, {140, 1},
-      {144, 2}, {145, 3}, {130, 1}, {131, 2}, {133, 3}, {126, 1}, {134, 2}, {123, 1}, {124, 2},
-      {138, 3}, {143, 1}, {121, 1}, {116, 1}, {117, 1}, {142, 2}, {101, 1}, {104, 2}, {111, 3},
-      {99, 1},  {108, 2}, {102, 1}, {103, 2}, {62, 1},  {55, 1},  {57, 2},  {58, 1},  {59, 2},
-      {61, 3},  {44, 1},  {56, 2},  {33, 1},  {37, 1},  {39, 1}}},
-    {3297, {{80, 1},  {118, 1}, {119, 2}, {120, 3}, {123, 1}, {57, 1},  {84, 1},  {70, 1},
-            {87, 1},  {91, 2},  {89, 1},  {92, 2},  {95, 3},  {79, 1},  {50, 1},  {54, 2},
-            {58, 3},  {47, 1},  {48, 2},  {55, 3},  {42, 1},  {40, 1},  {45, 1},  {46, 2},
-            {51, 3},  {36, 1},  {52, 2},  {56, 3},  {64, 1},  {61, 1},  {75, 2},  {78, 3},
-            {63, 1},  {68, 2},  {126, 1}, {127, 2}, {132, 3}, {124, 1}, {130, 2}, {116, 1},
-            {122, 1}, {110, 1}, {111, 2}, {113, 3}, {25, 1},  {27, 2},  {28, 3},  {24, 1},
-            {26, 2},  {13, 1},  {14, 2},  {17, 3},  {15, 1},  {16, 2},  {20, 3},  {21, 1},
-            {6, 1},   {9, 2},   {11, 1},  {18, 2},  {19, 3},  {1, 1},   {4, 2},   {5, 3}}},
-    {3306, {{51, 1}, {13, 2}, {7, 2},  {11, 1}, {19, 2}, {23, 1}, {44, 1}, {48, 2}, {52, 3},
-            {41, 1}, {42, 2}, {49, 3}, {36, 1}, {34, 1}, {39, 1}, {40, 2}, {45, 3}, {30, 1},
-            {46, 2}, {50, 3}, {14, 1}, {17, 2}, {24, 3}, {12, 1}, {21, 2}, {15, 1}, {16, 2}}},
-    {3311,
-     {{93, 1}, {106, 1}, {86, 1}, {96, 2}, {100, 3}, {25, 1}, {28, 2}, {43, 3}, {50, 1}, {51, 2},
-      {52, 3}, {7, 1},   {8, 2},  {9, 3},  {4, 1},   {5, 2},  {10, 3}, {54, 1}, {56, 2}, {60, 3},
-      {59, 1}, {73, 2},  {92, 1}, {99, 2}, {101, 3}, {95, 1}, {97, 2}, {98, 3}, {82, 1}, {83, 2},
-      {76, 1}, {77, 2},  {78, 1}, {79, 2}, {81, 3},  {72, 1}, {71, 1}, {74, 2}, {84, 3}, {65, 1},
-      {67, 2}, {61, 1},  {63, 2}, {64, 3}, {36, 1},  {41, 2}, {42, 3}, {38, 1}, {39, 2}, {40, 3},
-      {31, 1}, {32, 2},  {47, 3}, {35, 1}, {45, 2},  {46, 3}, {21, 1}, {27, 2}, {22, 1}, {37, 2},
-      {29, 1}, {34, 2},  {15, 1}, {33, 2}, {105, 1}, {108, 2}}},
-    {3312,
-     {{13, 1},  {27, 2},  {33, 3},  {64, 1},  {66, 2},  {16, 1},  {21, 2},  {24, 3},  {126, 1},
-      {135, 2}, {139, 3}, {117, 1}, {127, 2}, {136, 3}, {122, 1}, {133, 2}, {145, 3}, {143, 1},
-      {144, 2}, {123, 1}, {129, 2}, {76, 1},  {97, 1},  {131, 1}, {134, 2}, {138, 3}, {132, 1},
-      {141, 2}, {121, 1}, {128, 2}, {120, 1}, {137, 2}, {106, 1}, {107, 2}, {103, 1}, {104, 2},
-      {108, 3}, {98, 1},  {99, 2},  {109, 1}, {110, 2}, {111, 3}, {90, 1},  {112, 2}, {88, 1},
-      {101, 2}, {93, 1},  {94, 2},  {77, 1},  {80, 2},  {81, 1},  {70, 1},  {71, 2},  {79, 3},
-      {72, 1},  {75, 2},  {78, 3},  {57, 1},  {58, 2},  {51, 1},  {63, 2},  {45, 1},  {55, 2},
-      {56, 3},  {49, 1},  {39, 1},  {52, 1},  {54, 2},  {65, 3},  {38, 1},  {40, 2},  {43, 3},
-      {47, 1},  {50, 2},  {62, 3},  {20, 1},  {26, 2},  {29, 3},  {15, 1},  {22, 2},  {11, 1},
-      {12, 2},  {30, 3},  {23, 1},  {25, 2},  {31, 3},  {18, 1},  {28, 2}}},
-    {3360,
-     {{153, 1}, {161, 2}, {230, 1}, {110, 2}, {155, 4}, {149, 3}, {233, 1}, {234, 2}, {107, 1},
-      {108, 2}, {109, 3}, {241, 1}, {242, 2}, {264, 1}, {103, 1}, {104, 2}, {111, 3}, {165, 1},
-      {227, 1}, {170, 1}, {171, 2}, {189, 1}, {187, 1}, {235, 1}, {236, 2}, {220, 1}, {218, 1},
-      {207, 1}, {208, 2}, {156, 1}, {159, 2}, {166, 3}, {154, 1}, {163, 2}, {157, 1}, {158, 2},
-      {137, 1}, {138, 2}, {139, 3}, {131, 1}, {134, 2}, {135, 3}, {122, 1}, {142, 2}, {143, 3},
-      {113, 1}, {114, 2}, {253, 1}, {263, 2}}},
-    {3361, {{45, 1}, {49, 2}, {47, 1}, {50, 2}, {53, 3}}},
-    {3365, {{196, 1}, {298, 2}, {319, 1}, {251, 1}, {225, 1}, {226, 2}, {290, 1}, {296, 2},
-            {338, 1}, {341, 2}, {277, 1}, {202, 1}, {203, 2}, {192, 1}, {204, 2}, {269, 3},
-            {327, 1}, {329, 2}, {322, 2}, {318, 1}, {187, 6}, {300, 7}, {145, 2}, {138, 1},
-            {141, 3}, {104, 3}, {78, 1},  {40, 2},  {355, 1}, {360, 1}}},
-    {3386, {{51, 1}}},
-    {3390, {{9, 1}, {29, 1}, {30, 3}, {35, 1}, {37, 2}, {2, 1}, {6, 2}, {4, 1}, {36, 1}}},
-    {3401, {{26, 6},   {27, 7},   {9, 4},    {87, 5},   {109, 6},  {120, 7},  {25, 1},   {28, 3},
-            {101, 1},  {63, 1},   {102, 1},  {33, 1},   {34, 3},   {62, 2},   {64, 3},   {65, 4},
-            {104, 4},  {73, 1},   {107, 1},  {72, 1},   {6, 2},    {14, 4},   {99, 6},   {11, 9},
-            {13, 12},  {5, 12},   {7, 13},   {88, 14},  {119, 13}, {124, 14}, {125, 15}, {111, 12},
-            {112, 14}, {114, 15}, {121, 13}, {122, 14}, {30, 5},   {55, 6},   {56, 7},   {20, 7}}},
-    {3402, {{2, 4}}},
-    {3403,
-     {{32, 1},
-      {42, 2},
-      {30, 1},
-      {31, 1},
-      {33, 1},
-      {13, 1},
-      {29, 1},
-      {3, 1},
-      {9, 1},
-      {35, 1},
-      {36, 2},
-      {23, 1},
-      {34, 2}}},
-    {3404, {{1, 1}, {4, 2}}},
-    {3405, {{12, 1}, {36, 1}, {56, 1}, {57, 2}, {9, 1},  {10, 2}, {11, 3}, {5, 1},  {6, 2},
-            {13, 3}, {80, 1}, {79, 1}, {81, 2}, {71, 1}, {76, 2}, {78, 3}, {74, 1}, {75, 2},
-            {67, 1}, {60, 1}, {62, 2}, {63, 1}, {64, 2}, {66, 3}, {52, 1}, {53, 2}, {49, 1},
-            {50, 2}, {46, 1}, {47, 2}, {43, 1}, {44, 2}, {40, 1}, {41, 2}, {37, 1}, {61, 2},
-            {32, 1}, {33, 2}, {15, 1}, {16, 2}, {24, 1}, {28, 1}, {30, 1}}},
-    {3406, {{33, 1}, {35, 2}, {45, 1}, {57, 2}, {70, 3}, {44, 1}, {50, 2}, {61, 3}, {49, 1},
-            {60, 2}, {64, 3}, {68, 1}, {69, 2}, {51, 1}, {53, 2}, {58, 1}, {59, 2}, {63, 3},
-            {56, 1}, {66, 2}, {43, 1}, {52, 2}, {42, 1}, {62, 2}, {26, 1}, {27, 2}, {20, 1},
-            {32, 2}, {14, 1}, {24, 2}, {25, 3}, {18, 1}, {8, 1},  {21, 1}, {23, 2}, {34, 3},
-            {7, 1},  {9, 2},  {12, 3}, {16, 1}, {19, 2}, {31, 3}}},
-    {3415,
-     {{111, 1}, {116, 2}, {128, 3}, {32, 1},  {71, 1},  {39, 1},  {40, 2},  {87, 1},  {124, 1},
-      {118, 1}, {120, 1}, {126, 2}, {129, 3}, {122, 1}, {109, 1}, {119, 2}, {127, 3}, {105, 1},
-      {106, 2}, {125, 3}, {114, 1}, {115, 2}, {121, 3}, {61, 1},  {50, 1},  {58, 1},  {86, 1},
-      {88, 2},  {78, 1},  {83, 2},  {85, 3},  {81, 1},  {82, 2},  {35, 1},  {23, 1},  {102, 1},
-      {98, 1},  {99, 2},  {101, 3}, {94, 1},  {96, 2}}},
-    {3416, {{44, 1}, {46, 2}, {48, 1}, {28, 1}}},
-    {3417, {{3, 1}, {4, 2}, {5, 3}, {6, 4}}},
-
+struct RemapEntry {
+  int tpage;
+  int texture_idx;
+  int dest_offset;
 };
+
+constexpr bool entry_less(const RemapEntry& a, const RemapEntry& b) {
+  return a.tpage != b.tpage ? a.tpage < b.tpage : a.texture_idx < b.texture_idx;
 }
 
+// sorted by tpage, then by texture, so a lookup is a binary search.
+// clang-format off
+constexpr RemapEntry data[] = {
+    {2, 1, 1}, {4, 18, 2}, {4, 21, 1}, {4, 22, 1}, {4, 24, 1}, {4, 25, 1}, {4, 59, 1}, {4, 61, 2},
+    {4, 63, 2}, {4, 64, 3}, {4, 66, 1}, {4, 85, 1}, {4, 88, 1}, {4, 89, 2}, {4, 100, 1},
+    {4, 113, 1}, {4, 130, 1}, {4, 131, 13}, {4, 134, 2}, {4, 140, 11}, {4, 148, 1}, {4, 150, 1},
+    {4, 154, 2}, {4, 161, 12}, {4, 162, 13}, {4, 164, 9}, {4, 165, 10}, {4, 166, 11}, {4, 168, 7},
+    {4, 169, 8}, {4, 170, 9}, {4, 172, 5}, {4, 173, 6}, {4, 174, 7}, {4, 177, 2}, {4, 181, 1},
+    {4, 182, 2}, {4, 183, 2}, {4, 184, 3}, {4, 185, 2}, {5, 2, 1}, {5, 4, 1}, {5, 13, 1},
+    {5, 14, 2}, {5, 17, 1}, {5, 19, 2}, {5, 24, 1}, {5, 30, 1}, {7, 25, 1}, {7, 31, 2}, {7, 55, 1},
+    {7, 90, 1}, {7, 92, 1}, {7, 97, 1}, {7, 98, 1}, {7, 103, 2}, {7, 104, 1}, {7, 105, 3},
+    {7, 106, 1}, {7, 107, 4}, {7, 108, 2}, {7, 109, 1}, {7, 110, 5}, {7, 111, 2}, {7, 112, 6},
+    {7, 113, 2}, {7, 115, 2}, {7, 116, 3}, {7, 117, 7}, {7, 118, 3}, {7, 119, 3}, {7, 121, 1},
+    {7, 122, 2}, {7, 123, 1}, {7, 124, 2}, {7, 125, 1}, {7, 126, 2}, {7, 127, 1}, {7, 128, 2},
+    {7, 129, 1}, {7, 130, 2}, {10, 4, 1}, {10, 5, 2}, {10, 9, 3}, {11, 4, 1}, {11, 5, 1},
+    {11, 7, 1}, {11, 10, 1}, {11, 11, 2}, {11, 12, 3}, {11, 14, 1}, {11, 15, 2}, {11, 16, 2},
+    {11, 17, 3}, {11, 19, 2}, {11, 22, 1}, {11, 23, 2}, {13, 21, 1}, {13, 23, 2}, {13, 24, 3},
+    {13, 39, 1}, {13, 40, 2}, {13, 46, 1}, {13, 47, 2}, {17, 40, 1}, {17, 42, 1}, {17, 44, 2},
+    {17, 46, 3}, {17, 48, 1}, {17, 49, 2}, {17, 51, 2}, {17, 52, 3}, {17, 53, 2}, {17, 56, 1},
+    {17, 59, 3}, {125, 17, 1}, {125, 18, 2}, {125, 19, 3}, {125, 23, 1}, {127, 36, 1}, {127, 44, 1},
+    {127, 51, 1}, {127, 53, 2}, {127, 72, 1}, {127, 73, 3}, {127, 74, 4}, {127, 79, 3},
+    {127, 92, 1}, {127, 132, 1}, {127, 133, 2}, {127, 139, 1}, {127, 140, 2}, {133, 51, 1},
+    {133, 55, 1}, {133, 56, 2}, {133, 57, 3}, {133, 74, 1}, {133, 75, 2}, {133, 77, 1}, {135, 4, 1},
+    {135, 9, 1}, {135, 10, 1}, {135, 11, 2}, {135, 13, 1}, {135, 14, 2}, {135, 19, 1}, {135, 20, 1},
+    {136, 4, 1}, {136, 6, 2}, {136, 9, 1}, {136, 15, 1}, {136, 16, 1}, {136, 23, 1}, {136, 25, 2},
+    {136, 26, 2}, {136, 27, 3}, {136, 32, 1}, {136, 35, 1}, {136, 45, 1}, {136, 46, 1},
+    {136, 47, 2}, {136, 49, 1}, {136, 54, 3}, {162, 6, 1}, {166, 103, 1}, {166, 105, 1},
+    {170, 9, 1}, {174, 103, 1}, {179, 3, 1}, {180, 3, 1}, {180, 7, 1}, {180, 10, 1}, {180, 12, 1},
+    {180, 21, 1}, {180, 25, 1}, {180, 30, 1}, {180, 31, 1}, {180, 34, 1}, {180, 36, 1},
+    {180, 37, 1}, {180, 39, 1}, {180, 40, 1}, {180, 41, 1}, {180, 45, 1}, {180, 48, 1},
+    {180, 49, 1}, {180, 51, 1}, {180, 52, 1}, {180, 54, 1}, {180, 58, 1}, {180, 59, 1}, {187, 5, 1},
+    {188, 15, 1}, {188, 23, 1}, {188, 24, 1}, {188, 27, 1}, {188, 29, 1}, {188, 30, 1},
+    {188, 31, 1}, {188, 34, 1}, {188, 36, 1}, {188, 37, 1}, {188, 38, 1}, {188, 39, 1},
+    {188, 40, 1}, {188, 43, 1}, {188, 47, 1}, {188, 49, 1}, {188, 50, 1}, {188, 54, 1},
+    {188, 55, 1}, {188, 56, 1}, {188, 58, 1}, {188, 78, 1}, {224, 1, 1}, {224, 3, 2}, {224, 4, 3},
+    {224, 16, 1}, {224, 18, 1}, {224, 20, 1}, {224, 24, 1}, {224, 25, 1}, {224, 36, 1},
+    {224, 37, 2}, {224, 38, 2}, {224, 39, 1}, {224, 40, 2}, {224, 42, 3}, {224, 43, 1},
+    {224, 53, 1}, {226, 1, 1}, {226, 3, 2}, {226, 7, 1}, {226, 9, 1}, {226, 18, 1}, {226, 30, 1},
+    {226, 41, 1}, {226, 43, 1}, {226, 45, 1}, {226, 53, 1}, {226, 62, 2}, {226, 63, 3},
+    {226, 77, 1}, {226, 78, 2}, {244, 1, 1}, {244, 3, 2}, {244, 4, 3}, {244, 8, 1}, {272, 5, 1},
+    {272, 7, 2}, {272, 8, 3}, {273, 28, 1}, {273, 29, 2}, {274, 12, 1}, {274, 13, 1}, {274, 15, 1},
+    {274, 16, 1}, {274, 20, 2}, {274, 21, 1}, {274, 27, 1}, {274, 29, 1}, {274, 30, 1},
+    {274, 37, 1}, {274, 39, 1}, {274, 40, 2}, {274, 42, 2}, {274, 44, 1}, {274, 46, 3},
+    {274, 48, 1}, {274, 50, 1}, {274, 52, 1}, {274, 53, 1}, {274, 55, 3}, {274, 58, 1},
+    {274, 60, 1}, {274, 62, 1}, {274, 65, 1}, {274, 97, 2}, {318, 19, 1}, {318, 23, 1},
+    {318, 25, 1}, {318, 29, 1}, {318, 30, 1}, {318, 41, 1}, {318, 42, 2}, {318, 43, 2},
+    {318, 44, 1}, {318, 45, 2}, {318, 47, 3}, {318, 48, 1}, {319, 84, 1}, {319, 85, 1},
+    {319, 89, 1}, {319, 93, 2}, {319, 96, 1}, {319, 97, 2}, {325, 12, 1}, {325, 14, 1},
+    {325, 17, 1}, {325, 18, 2}, {325, 20, 1}, {325, 21, 2}, {325, 22, 1}, {325, 23, 1},
+    {325, 30, 2}, {325, 31, 2}, {325, 32, 3}, {325, 35, 1}, {325, 37, 2}, {325, 38, 1},
+    {325, 40, 2}, {325, 42, 1}, {325, 43, 3}, {325, 45, 3}, {325, 46, 1}, {325, 47, 1},
+    {325, 48, 1}, {325, 49, 2}, {325, 51, 2}, {325, 52, 1}, {325, 53, 2}, {325, 55, 3},
+    {325, 56, 1}, {325, 57, 3}, {325, 58, 2}, {325, 60, 1}, {325, 61, 2}, {325, 78, 3},
+    {325, 82, 1}, {325, 84, 1}, {325, 85, 2}, {325, 86, 3}, {325, 87, 2}, {325, 113, 1},
+    {325, 117, 1}, {405, 66, 1}, {405, 68, 1}, {405, 71, 1}, {405, 73, 1}, {405, 82, 1},
+    {405, 85, 1}, {405, 90, 2}, {405, 93, 3}, {405, 94, 4}, {405, 104, 1}, {405, 107, 1},
+    {405, 114, 1}, {405, 120, 1}, {405, 121, 1}, {405, 124, 1}, {405, 126, 2}, {405, 130, 1},
+    {428, 14, 1}, {428, 21, 1}, {428, 26, 2}, {428, 28, 1}, {428, 32, 1}, {428, 35, 1}, {446, 3, 1},
+    {446, 4, 2}, {446, 5, 3}, {446, 6, 5}, {446, 7, 6}, {536, 46, 1}, {536, 51, 1}, {536, 52, 1},
+    {536, 55, 1}, {536, 61, 1}, {536, 62, 1}, {536, 66, 1}, {536, 85, 1}, {536, 86, 2},
+    {536, 89, 1}, {536, 90, 2}, {536, 91, 3}, {536, 92, 1}, {536, 93, 3}, {536, 95, 1},
+    {536, 96, 2}, {536, 103, 1}, {536, 107, 1}, {536, 109, 1}, {536, 113, 1}, {536, 114, 1},
+    {536, 125, 1}, {536, 126, 2}, {536, 127, 2}, {536, 128, 1}, {536, 129, 2}, {536, 131, 3},
+    {536, 132, 1}, {536, 145, 1}, {536, 151, 1}, {536, 156, 1}, {536, 167, 1}, {536, 168, 1},
+    {536, 171, 1}, {536, 173, 2}, {536, 174, 2}, {536, 175, 1}, {536, 177, 1}, {536, 178, 2},
+    {536, 180, 2}, {536, 181, 1}, {536, 182, 2}, {536, 183, 1}, {536, 184, 2}, {536, 185, 3},
+    {536, 186, 1}, {536, 187, 2}, {536, 188, 3}, {536, 189, 2}, {536, 190, 3}, {536, 191, 3},
+    {536, 193, 1}, {536, 194, 2}, {536, 195, 3}, {540, 4, 1}, {540, 8, 1}, {540, 9, 2},
+    {540, 10, 1}, {540, 11, 1}, {540, 12, 3}, {540, 13, 1}, {540, 15, 1}, {540, 16, 2},
+    {540, 17, 3}, {540, 18, 2}, {540, 19, 2}, {540, 20, 2}, {540, 21, 3}, {540, 22, 2},
+    {540, 23, 3}, {540, 25, 1}, {540, 26, 3}, {540, 27, 2}, {540, 28, 3}, {540, 29, 3},
+    {540, 34, 1}, {540, 35, 2}, {540, 38, 1}, {540, 39, 2}, {540, 40, 3}, {540, 41, 1},
+    {540, 42, 3}, {540, 44, 1}, {540, 45, 2}, {540, 62, 1}, {540, 65, 2}, {540, 66, 3},
+    {540, 68, 1}, {540, 69, 2}, {540, 70, 3}, {540, 73, 1}, {540, 74, 2}, {540, 82, 1},
+    {540, 86, 1}, {540, 87, 2}, {540, 152, 3}, {540, 170, 1}, {540, 171, 2}, {540, 173, 1},
+    {540, 174, 2}, {540, 175, 3}, {540, 201, 1}, {540, 202, 1}, {540, 203, 1}, {540, 205, 1},
+    {540, 206, 2}, {540, 208, 3}, {540, 209, 1}, {540, 210, 1}, {540, 211, 2}, {540, 212, 1},
+    {540, 213, 3}, {540, 214, 2}, {540, 215, 1}, {540, 216, 2}, {540, 217, 3}, {540, 219, 1},
+    {544, 1, 1}, {544, 4, 2}, {544, 5, 3}, {544, 6, 1}, {544, 9, 2}, {544, 11, 1}, {544, 13, 1},
+    {544, 14, 2}, {544, 15, 1}, {544, 16, 2}, {544, 17, 3}, {544, 18, 2}, {544, 19, 3},
+    {544, 20, 3}, {544, 21, 1}, {544, 24, 1}, {544, 25, 1}, {544, 26, 2}, {544, 27, 2},
+    {544, 28, 3}, {544, 34, 1}, {544, 36, 1}, {544, 38, 2}, {544, 39, 2}, {544, 42, 3},
+    {544, 58, 1}, {544, 59, 1}, {544, 60, 2}, {544, 63, 3}, {544, 65, 1}, {544, 67, 1},
+    {544, 69, 1}, {544, 70, 2}, {544, 71, 1}, {544, 73, 2}, {544, 74, 3}, {544, 75, 1},
+    {544, 76, 2}, {544, 79, 3}, {544, 80, 2}, {544, 81, 1}, {544, 82, 2}, {544, 84, 1},
+    {544, 85, 2}, {544, 86, 3}, {544, 93, 1}, {544, 94, 1}, {544, 95, 1}, {544, 96, 1},
+    {544, 99, 1}, {544, 100, 2}, {544, 102, 2}, {544, 105, 1}, {544, 106, 2}, {544, 107, 1},
+    {544, 108, 2}, {544, 109, 2}, {544, 110, 3}, {544, 111, 2}, {544, 112, 3}, {544, 113, 3},
+    {544, 115, 2}, {544, 117, 1}, {544, 118, 2}, {544, 119, 3}, {544, 120, 1}, {544, 121, 2},
+    {591, 17, 1}, {591, 130, 2}, {591, 131, 3}, {591, 133, 1}, {591, 134, 2}, {591, 135, 3},
+    {591, 137, 1}, {591, 138, 2}, {591, 139, 3}, {591, 141, 1}, {591, 142, 2}, {591, 143, 3},
+    {591, 145, 1}, {591, 146, 2}, {591, 147, 3}, {591, 149, 1}, {591, 150, 2}, {591, 151, 3},
+    {591, 153, 1}, {591, 154, 2}, {591, 155, 3}, {591, 157, 1}, {591, 158, 2}, {591, 159, 3},
+    {591, 161, 1}, {591, 162, 2}, {591, 163, 3}, {591, 164, 4}, {591, 166, 1}, {591, 167, 2},
+    {591, 168, 3}, {591, 170, 1}, {591, 171, 2}, {591, 172, 3}, {591, 174, 4}, {591, 175, 5},
+    {591, 176, 6}, {591, 177, 1}, {591, 178, 2}, {591, 179, 3}, {591, 180, 4}, {591, 182, 1},
+    {591, 183, 2}, {591, 184, 3}, {591, 185, 4}, {591, 187, 1}, {591, 188, 2}, {591, 189, 3},
+    {591, 191, 1}, {591, 192, 2}, {591, 193, 3}, {591, 195, 1}, {591, 196, 2}, {591, 197, 3},
+    {591, 199, 1}, {591, 200, 2}, {591, 201, 3}, {591, 202, 4}, {591, 204, 1}, {591, 205, 2},
+    {591, 206, 3}, {591, 208, 1}, {591, 209, 2}, {591, 210, 3}, {591, 212, 1}, {591, 213, 2},
+    {591, 214, 3}, {591, 216, 1}, {591, 217, 2}, {591, 218, 3}, {591, 220, 1}, {591, 221, 2},
+    {591, 222, 3}, {591, 224, 1}, {591, 225, 2}, {591, 226, 3}, {591, 227, 4}, {591, 229, 1},
+    {591, 230, 2}, {591, 231, 3}, {591, 233, 1}, {591, 234, 2}, {591, 235, 3}, {591, 237, 1},
+    {591, 238, 2}, {591, 239, 3}, {591, 241, 1}, {591, 242, 2}, {591, 243, 3}, {591, 245, 1},
+    {591, 246, 2}, {591, 247, 3}, {591, 248, 4}, {591, 250, 1}, {591, 251, 2}, {591, 252, 3},
+    {591, 254, 1}, {591, 255, 2}, {591, 256, 3}, {591, 258, 1}, {591, 259, 2}, {591, 260, 3},
+    {591, 262, 1}, {591, 263, 2}, {591, 264, 3}, {591, 266, 1}, {591, 267, 2}, {591, 268, 3},
+    {591, 269, 4}, {591, 271, 1}, {591, 272, 2}, {591, 273, 3}, {591, 275, 1}, {591, 276, 2},
+    {591, 277, 3}, {591, 279, 1}, {591, 280, 2}, {591, 281, 3}, {591, 283, 1}, {591, 284, 2},
+    {591, 285, 3}, {591, 287, 1}, {591, 288, 2}, {591, 289, 3}, {591, 290, 4}, {593, 14, 1},
+    {593, 15, 1}, {593, 21, 1}, {593, 23, 2}, {593, 24, 2}, {593, 29, 1}, {605, 17, 1},
+    {605, 19, 1}, {605, 25, 1}, {605, 26, 2}, {605, 28, 2}, {605, 30, 1}, {632, 17, 1},
+    {632, 18, 2}, {632, 20, 3}, {632, 22, 1}, {632, 24, 1}, {632, 28, 1}, {632, 29, 1},
+    {632, 35, 1}, {632, 37, 1}, {632, 42, 1}, {632, 43, 1}, {632, 44, 1}, {632, 55, 2},
+    {632, 63, 1}, {632, 65, 1}, {632, 68, 1}, {632, 73, 1}, {632, 76, 2}, {632, 79, 3},
+    {632, 82, 1}, {632, 84, 2}, {633, 5, 1}, {633, 6, 2}, {633, 19, 1}, {646, 4, 1}, {646, 5, 2},
+    {646, 6, 3}, {646, 7, 5}, {646, 8, 6}, {647, 9, 1}, {647, 17, 1}, {647, 21, 1}, {647, 22, 2},
+    {647, 27, 3}, {647, 28, 1}, {647, 30, 1}, {647, 37, 2}, {647, 38, 1}, {736, 17, 1},
+    {736, 21, 1}, {736, 22, 2}, {736, 24, 1}, {736, 30, 3}, {740, 13, 1}, {740, 14, 1},
+    {740, 18, 1}, {740, 24, 1}, {740, 28, 1}, {740, 29, 1}, {741, 1, 1}, {741, 3, 1}, {741, 4, 2},
+    {741, 5, 3}, {741, 11, 1}, {741, 12, 2}, {741, 15, 1}, {741, 16, 2}, {741, 17, 3}, {741, 18, 1},
+    {741, 19, 3}, {741, 21, 1}, {741, 22, 2}, {741, 56, 1}, {741, 58, 1}, {741, 60, 1},
+    {741, 64, 1}, {741, 65, 1}, {741, 76, 1}, {741, 77, 2}, {741, 78, 2}, {741, 79, 1},
+    {741, 80, 2}, {741, 82, 3}, {741, 83, 1}, {741, 107, 1}, {741, 113, 1}, {741, 118, 1},
+    {742, 22, 1}, {742, 25, 2}, {742, 27, 1}, {742, 34, 1}, {742, 36, 1}, {742, 39, 1},
+    {742, 40, 1}, {742, 41, 1}, {742, 42, 1}, {742, 46, 1}, {742, 47, 1}, {742, 54, 1},
+    {742, 60, 2}, {742, 67, 1}, {742, 77, 1}, {742, 79, 1}, {742, 82, 1}, {742, 83, 2}, {744, 8, 1},
+    {744, 10, 1}, {744, 20, 2}, {744, 23, 1}, {744, 24, 1}, {744, 26, 1}, {744, 27, 1},
+    {744, 28, 2}, {744, 31, 1}, {744, 33, 1}, {744, 34, 1}, {744, 36, 1}, {744, 37, 1},
+    {744, 38, 2}, {744, 51, 2}, {744, 63, 2}, {744, 64, 1}, {744, 67, 2}, {744, 68, 1},
+    {744, 69, 1}, {744, 71, 1}, {746, 7, 1}, {746, 11, 1}, {746, 12, 2}, {746, 13, 1}, {746, 19, 1},
+    {746, 27, 1}, {746, 28, 1}, {746, 31, 2}, {746, 33, 1}, {746, 35, 1}, {746, 42, 1},
+    {746, 43, 1}, {746, 46, 2}, {746, 49, 1}, {746, 60, 1}, {746, 68, 1}, {746, 70, 1},
+    {746, 75, 2}, {746, 76, 1}, {746, 78, 1}, {746, 80, 2}, {747, 13, 1}, {748, 8, 1}, {748, 15, 1},
+    {748, 24, 1}, {748, 30, 1}, {748, 32, 1}, {748, 33, 2}, {748, 35, 1}, {748, 40, 2},
+    {748, 41, 1}, {748, 44, 1}, {748, 48, 1}, {748, 49, 1}, {748, 60, 1}, {748, 62, 1},
+    {748, 66, 1}, {748, 67, 2}, {748, 77, 1}, {748, 80, 2}, {748, 81, 1}, {752, 80, 1},
+    {752, 91, 1}, {752, 99, 1}, {753, 1, 1}, {753, 3, 2}, {753, 4, 3}, {753, 5, 1}, {753, 14, 1},
+    {753, 34, 1}, {753, 43, 1}, {753, 53, 1}, {754, 1, 1}, {754, 3, 2}, {754, 4, 3}, {754, 42, 1},
+    {754, 67, 1}, {754, 76, 1}, {756, 2, 1}, {756, 4, 2}, {756, 5, 3}, {756, 32, 1}, {756, 38, 1},
+    {756, 44, 1}, {757, 20, 1}, {757, 29, 1}, {757, 33, 1}, {757, 40, 1}, {757, 44, 1},
+    {757, 48, 1}, {757, 54, 1}, {757, 66, 1}, {757, 81, 1}, {757, 83, 1}, {759, 1, 1}, {759, 3, 2},
+    {759, 4, 3}, {759, 6, 1}, {773, 29, 1}, {773, 30, 2}, {773, 34, 1}, {773, 35, 1}, {773, 40, 1},
+    {774, 1, 1}, {774, 3, 2}, {774, 4, 3}, {798, 15, 1}, {798, 16, 2}, {798, 21, 3}, {798, 32, 1},
+    {798, 34, 1}, {798, 35, 1}, {798, 36, 2}, {798, 37, 2}, {798, 38, 1}, {798, 39, 2},
+    {798, 42, 1}, {798, 45, 1}, {798, 47, 1}, {798, 48, 1}, {798, 49, 2}, {798, 50, 3},
+    {798, 51, 1}, {798, 52, 1}, {798, 53, 2}, {798, 54, 2}, {798, 55, 1}, {820, 4, 1}, {820, 7, 2},
+    {820, 8, 1}, {820, 9, 1}, {820, 10, 1}, {820, 11, 1}, {820, 12, 2}, {820, 14, 1}, {820, 17, 1},
+    {820, 18, 2}, {820, 19, 2}, {820, 20, 2}, {820, 21, 3}, {820, 22, 1}, {820, 23, 3},
+    {820, 26, 1}, {820, 27, 2}, {820, 28, 3}, {820, 33, 1}, {820, 34, 2}, {841, 1, 1}, {841, 19, 1},
+    {841, 27, 1}, {841, 29, 1}, {841, 30, 1}, {841, 34, 1}, {841, 35, 2}, {841, 36, 3},
+    {841, 38, 1}, {841, 46, 1}, {841, 48, 1}, {841, 51, 1}, {841, 52, 2}, {841, 63, 1},
+    {841, 73, 1}, {841, 87, 1}, {843, 2, 1}, {843, 3, 2}, {844, 5, 1}, {869, 100, 1}, {869, 102, 2},
+    {869, 103, 3}, {871, 5, 1}, {871, 6, 2}, {871, 9, 1}, {871, 10, 2}, {871, 11, 3}, {871, 12, 1},
+    {871, 13, 3}, {871, 15, 1}, {871, 16, 2}, {872, 6, 1}, {872, 7, 1}, {872, 8, 2}, {872, 11, 3},
+    {872, 13, 1}, {872, 15, 1}, {872, 17, 1}, {872, 18, 2}, {872, 19, 1}, {872, 20, 1},
+    {872, 22, 2}, {872, 23, 2}, {872, 24, 3}, {872, 25, 1}, {872, 26, 2}, {872, 29, 3},
+    {872, 30, 2}, {872, 31, 1}, {872, 32, 3}, {872, 33, 2}, {873, 19, 1}, {873, 22, 1},
+    {874, 40, 1}, {874, 41, 2}, {874, 42, 3}, {874, 45, 1}, {874, 47, 1}, {874, 48, 2},
+    {874, 49, 3}, {874, 50, 2}, {874, 51, 3}, {874, 54, 1}, {874, 55, 2}, {874, 56, 3},
+    {874, 59, 1}, {874, 60, 1}, {874, 61, 1}, {874, 62, 2}, {874, 63, 2}, {874, 64, 3},
+    {874, 65, 2}, {874, 69, 1}, {874, 71, 1}, {874, 72, 1}, {874, 73, 1}, {874, 74, 2},
+    {874, 75, 2}, {874, 76, 3}, {874, 78, 1}, {874, 86, 1}, {874, 89, 1}, {874, 92, 1},
+    {874, 93, 2}, {874, 94, 2}, {874, 95, 1}, {874, 96, 2}, {874, 97, 3}, {874, 98, 3},
+    {874, 99, 2}, {895, 9, 1}, {895, 11, 2}, {895, 71, 3}, {895, 72, 4}, {895, 73, 5}, {895, 75, 3},
+    {895, 77, 11}, {895, 78, 12}, {895, 79, 13}, {895, 81, 8}, {895, 82, 9}, {895, 83, 11},
+    {895, 85, 6}, {895, 86, 7}, {895, 87, 8}, {895, 89, 4}, {895, 90, 5}, {895, 91, 6},
+    {895, 94, 5}, {895, 95, 6}, {895, 96, 7}, {895, 98, 1}, {895, 99, 2}, {895, 100, 3},
+    {924, 2, 1}, {924, 9, 1}, {924, 10, 2}, {924, 13, 3}, {924, 14, 1}, {924, 15, 1}, {924, 24, 1},
+    {924, 25, 1}, {924, 26, 2}, {924, 27, 2}, {924, 28, 3}, {924, 30, 4}, {924, 34, 1},
+    {924, 37, 4}, {924, 38, 2}, {924, 40, 1}, {924, 41, 1}, {924, 42, 2}, {924, 44, 2},
+    {924, 45, 2}, {924, 46, 3}, {925, 28, 1}, {925, 29, 2}, {925, 32, 1}, {925, 33, 2},
+    {925, 34, 3}, {925, 35, 1}, {925, 36, 3}, {925, 38, 1}, {925, 39, 2}, {925, 83, 1},
+    {925, 86, 2}, {925, 87, 1}, {925, 88, 1}, {925, 89, 2}, {925, 91, 1}, {925, 92, 3},
+    {925, 93, 2}, {925, 94, 3}, {925, 95, 2}, {925, 96, 3}, {925, 100, 1}, {925, 102, 1},
+    {925, 104, 1}, {925, 108, 1}, {925, 109, 1}, {925, 120, 1}, {925, 121, 2}, {925, 122, 2},
+    {925, 123, 1}, {925, 124, 2}, {925, 126, 3}, {925, 127, 1}, {925, 136, 1}, {925, 140, 1},
+    {925, 141, 2}, {926, 4, 1}, {926, 6, 1}, {926, 14, 2}, {926, 15, 3}, {926, 17, 1}, {926, 18, 2},
+    {926, 19, 1}, {926, 20, 4}, {926, 21, 1}, {926, 22, 3}, {926, 26, 2}, {926, 27, 1},
+    {926, 28, 2}, {926, 29, 3}, {926, 30, 1}, {926, 32, 2}, {926, 35, 1}, {926, 37, 1},
+    {926, 39, 1}, {926, 40, 4}, {926, 41, 2}, {926, 42, 2}, {926, 44, 5}, {926, 45, 1},
+    {926, 46, 3}, {926, 47, 2}, {926, 48, 5}, {926, 50, 1}, {926, 56, 2}, {928, 13, 1},
+    {928, 14, 1}, {928, 17, 1}, {928, 18, 1}, {928, 19, 2}, {928, 20, 2}, {928, 21, 3},
+    {928, 22, 4}, {928, 23, 1}, {928, 27, 5}, {928, 34, 2}, {928, 44, 2}, {928, 46, 1},
+    {929, 23, 1}, {929, 45, 1}, {929, 46, 1}, {929, 47, 2}, {929, 48, 1}, {929, 49, 2},
+    {929, 54, 1}, {929, 64, 1}, {929, 67, 2}, {929, 68, 1}, {929, 69, 1}, {929, 70, 2},
+    {929, 72, 1}, {929, 73, 3}, {929, 74, 2}, {929, 75, 3}, {929, 76, 2}, {929, 77, 3}, {930, 6, 1},
+    {930, 8, 2}, {930, 11, 1}, {930, 12, 1}, {930, 13, 2}, {930, 14, 3}, {930, 16, 1}, {930, 17, 2},
+    {930, 18, 4}, {930, 19, 1}, {930, 22, 2}, {930, 23, 1}, {930, 26, 3}, {930, 27, 3},
+    {930, 29, 2}, {930, 30, 3}, {930, 31, 1}, {930, 32, 1}, {930, 36, 1}, {930, 37, 1},
+    {930, 38, 2}, {930, 39, 1}, {930, 45, 1}, {930, 46, 5}, {930, 48, 2}, {930, 49, 1},
+    {930, 53, 3}, {930, 59, 2}, {930, 61, 3}, {930, 65, 1}, {930, 66, 2}, {930, 68, 1},
+    {930, 69, 1}, {930, 77, 3}, {930, 80, 4}, {930, 83, 2}, {931, 10, 1}, {931, 11, 1},
+    {931, 12, 2}, {931, 15, 1}, {931, 16, 3}, {931, 17, 2}, {931, 19, 1}, {931, 20, 2},
+    {931, 21, 4}, {931, 22, 3}, {931, 23, 1}, {931, 24, 5}, {931, 29, 1}, {932, 14, 1},
+    {932, 30, 1}, {932, 62, 1}, {932, 67, 1}, {932, 74, 1}, {932, 81, 1}, {932, 85, 1},
+    {932, 86, 2}, {947, 29, 1}, {947, 30, 2}, {947, 31, 3}, {947, 33, 1}, {947, 34, 2},
+    {947, 35, 3}, {947, 37, 1}, {947, 38, 2}, {947, 39, 3}, {947, 41, 1}, {947, 42, 2},
+    {947, 43, 3}, {948, 3, 1}, {948, 15, 1}, {948, 16, 2}, {948, 17, 3}, {949, 5, 1}, {949, 7, 1},
+    {949, 8, 2}, {950, 2, 1}, {950, 7, 1}, {950, 8, 1}, {950, 11, 1}, {950, 21, 1}, {950, 22, 1},
+    {950, 26, 1}, {956, 3, 1}, {956, 8, 1}, {956, 11, 3}, {956, 14, 1}, {956, 18, 1}, {956, 19, 2},
+    {956, 21, 3}, {956, 22, 1}, {956, 23, 2}, {956, 24, 3}, {956, 25, 1}, {956, 26, 2},
+    {956, 27, 4}, {956, 29, 4}, {956, 30, 1}, {956, 31, 2}, {956, 32, 5}, {956, 33, 6},
+    {956, 34, 7}, {956, 36, 1}, {956, 37, 2}, {956, 38, 3}, {956, 40, 4}, {956, 42, 1},
+    {956, 43, 2}, {957, 4, 1}, {957, 7, 2}, {957, 8, 1}, {957, 9, 1}, {957, 10, 1}, {957, 11, 1},
+    {957, 12, 2}, {957, 14, 1}, {957, 17, 1}, {957, 18, 2}, {957, 19, 2}, {957, 20, 2},
+    {957, 21, 3}, {957, 22, 1}, {957, 23, 3}, {957, 26, 1}, {957, 27, 2}, {957, 28, 3}, {958, 5, 1},
+    {976, 1, 1}, {976, 2, 2}, {976, 3, 3}, {976, 4, 4}, {989, 4, 1}, {989, 7, 1}, {989, 11, 2},
+    {989, 15, 1}, {989, 16, 1}, {1023, 2, 10}, {1023, 3, 11}, {1023, 4, 12}, {1023, 6, 8},
+    {1023, 7, 9}, {1023, 8, 10}, {1023, 10, 6}, {1023, 11, 7}, {1023, 12, 8}, {1023, 14, 4},
+    {1023, 15, 5}, {1023, 16, 6}, {1023, 19, 1}, {1023, 20, 2}, {1023, 21, 3}, {1023, 23, 1},
+    {1023, 24, 2}, {1023, 25, 3}, {1023, 29, 3}, {1023, 30, 4}, {1023, 31, 5}, {1023, 33, 1},
+    {1023, 34, 3}, {1023, 35, 4}, {1023, 37, 5}, {1023, 38, 6}, {1023, 40, 3}, {1023, 41, 4},
+    {1023, 42, 5}, {1023, 44, 3}, {1026, 10, 1}, {1026, 12, 1}, {1026, 14, 1}, {1026, 21, 1},
+    {1026, 23, 1}, {1026, 24, 2}, {1026, 33, 1}, {1026, 35, 1}, {1026, 43, 1}, {1035, 4, 11},
+    {1035, 5, 12}, {1035, 6, 13}, {1035, 8, 9}, {1035, 9, 10}, {1035, 10, 11}, {1035, 12, 7},
+    {1035, 13, 8}, {1035, 14, 9}, {1035, 16, 5}, {1035, 17, 6}, {1035, 18, 7}, {1035, 20, 1},
+    {1035, 21, 2}, {1035, 22, 3}, {1035, 24, 1}, {1035, 25, 2}, {1035, 26, 3}, {1035, 30, 3},
+    {1035, 31, 4}, {1035, 32, 5}, {1035, 34, 1}, {1035, 35, 3}, {1035, 36, 4}, {1035, 38, 5},
+    {1035, 40, 3}, {1035, 41, 4}, {1035, 42, 5}, {1035, 44, 3}, {1037, 3, 1}, {1037, 4, 2},
+    {1037, 5, 3}, {1037, 6, 4}, {1085, 30, 1}, {1085, 33, 1}, {1085, 43, 1}, {1085, 47, 1},
+    {1085, 48, 2}, {1085, 49, 2}, {1085, 50, 3}, {1085, 51, 3}, {1085, 55, 2}, {1086, 3, 1},
+    {1086, 7, 1}, {1086, 8, 2}, {1087, 6, 1}, {1087, 7, 1}, {1087, 8, 2}, {1087, 11, 3},
+    {1087, 13, 1}, {1087, 15, 1}, {1087, 17, 1}, {1087, 18, 2}, {1087, 19, 1}, {1087, 20, 1},
+    {1087, 22, 2}, {1087, 23, 2}, {1087, 24, 3}, {1087, 25, 1}, {1087, 26, 2}, {1087, 29, 3},
+    {1087, 30, 2}, {1087, 31, 1}, {1087, 32, 3}, {1087, 33, 2}, {1088, 5, 1}, {1088, 7, 1},
+    {1088, 10, 1}, {1088, 11, 2}, {1088, 14, 1}, {1088, 15, 1}, {1088, 16, 2}, {1088, 18, 2},
+    {1088, 20, 1}, {1088, 21, 2}, {1088, 23, 1}, {1088, 24, 2}, {1088, 25, 3}, {1088, 26, 1},
+    {1088, 27, 2}, {1088, 28, 3}, {1088, 29, 2}, {1088, 35, 1}, {1088, 36, 1}, {1088, 37, 2},
+    {1088, 40, 3}, {1088, 42, 1}, {1088, 44, 1}, {1088, 46, 1}, {1088, 47, 2}, {1088, 48, 1},
+    {1088, 49, 1}, {1088, 51, 2}, {1088, 52, 2}, {1088, 53, 3}, {1088, 54, 1}, {1088, 55, 2},
+    {1088, 58, 3}, {1088, 59, 2}, {1088, 60, 1}, {1088, 61, 3}, {1088, 62, 2}, {1090, 73, 1},
+    {1090, 76, 1}, {1090, 80, 2}, {1092, 3, 1}, {1092, 7, 1}, {1092, 8, 2}, {1093, 6, 1},
+    {1093, 7, 1}, {1093, 8, 2}, {1093, 11, 3}, {1093, 13, 1}, {1093, 15, 1}, {1093, 17, 1},
+    {1093, 18, 2}, {1093, 19, 1}, {1093, 20, 1}, {1093, 22, 2}, {1093, 23, 2}, {1093, 24, 3},
+    {1093, 25, 1}, {1093, 26, 2}, {1093, 29, 3}, {1093, 30, 2}, {1093, 31, 1}, {1093, 32, 3},
+    {1093, 33, 2}, {1093, 37, 1}, {1093, 38, 2}, {1093, 40, 3}, {1093, 43, 1}, {1093, 45, 1},
+    {1093, 46, 2}, {1093, 47, 1}, {1093, 48, 1}, {1093, 50, 1}, {1093, 51, 2}, {1093, 53, 3},
+    {1093, 54, 3}, {1093, 55, 1}, {1093, 56, 2}, {1121, 8, 1}, {1121, 18, 1}, {1121, 20, 1},
+    {1121, 27, 1}, {1121, 39, 1}, {1121, 41, 1}, {1121, 44, 1}, {1121, 45, 1}, {1121, 53, 1},
+    {1121, 56, 1}, {1121, 64, 1}, {1121, 67, 1}, {1123, 2, 1}, {1123, 6, 1}, {1123, 13, 1},
+    {1123, 15, 1}, {1123, 24, 2}, {1123, 35, 1}, {1123, 42, 1}, {1123, 48, 1}, {1123, 50, 1},
+    {1123, 58, 1}, {1123, 59, 1}, {1123, 60, 2}, {1123, 66, 1}, {1123, 67, 2}, {1123, 68, 1},
+    {1123, 70, 2}, {1123, 71, 1}, {1123, 72, 3}, {1123, 73, 1}, {1123, 75, 1}, {1124, 11, 1},
+    {1125, 1, 1}, {1125, 11, 1}, {1125, 21, 2}, {1125, 25, 1}, {1125, 26, 1}, {1125, 28, 1},
+    {1125, 33, 1}, {1125, 39, 1}, {1125, 44, 1}, {1125, 48, 1}, {1125, 49, 2}, {1125, 53, 1},
+    {1125, 57, 2}, {1125, 58, 1}, {1125, 59, 1}, {1125, 61, 1}, {1125, 66, 1}, {1125, 69, 1},
+    {1125, 70, 1}, {1125, 71, 1}, {1125, 72, 3}, {1125, 74, 2}, {1125, 75, 1}, {1125, 76, 2},
+    {1125, 77, 3}, {1125, 78, 4}, {1125, 79, 1}, {1127, 12, 1}, {1127, 18, 1}, {1127, 19, 1},
+    {1127, 23, 1}, {1127, 25, 1}, {1127, 26, 2}, {1127, 28, 1}, {1127, 31, 1}, {1127, 34, 1},
+    {1127, 36, 1}, {1127, 39, 2}, {1127, 40, 2}, {1127, 41, 1}, {1127, 42, 1}, {1127, 48, 1},
+    {1127, 53, 2}, {1127, 58, 1}, {1127, 59, 1}, {1127, 61, 2}, {1127, 67, 1}, {1127, 70, 1},
+    {1127, 71, 1}, {1127, 73, 1}, {1127, 74, 1}, {1127, 75, 3}, {1130, 1, 1}, {1130, 3, 1},
+    {1130, 5, 2}, {1130, 6, 3}, {1130, 61, 1}, {1132, 46, 1}, {1132, 51, 1}, {1132, 55, 1},
+    {1133, 2, 1}, {1133, 14, 1}, {1133, 16, 1}, {1133, 17, 2}, {1133, 18, 3}, {1133, 36, 1},
+    {1133, 77, 1}, {1135, 27, 1}, {1135, 34, 1}, {1135, 41, 1}, {1135, 45, 1}, {1135, 47, 1},
+    {1135, 50, 1}, {1135, 52, 1}, {1135, 53, 1}, {1135, 54, 1}, {1135, 59, 1}, {1135, 64, 1},
+    {1135, 65, 2}, {1135, 70, 2}, {1135, 74, 1}, {1137, 1, 1}, {1137, 3, 2}, {1137, 4, 3},
+    {1137, 5, 1}, {1137, 10, 1}, {1137, 16, 1}, {1137, 24, 1}, {1138, 4, 1}, {1138, 5, 1},
+    {1138, 7, 1}, {1138, 19, 1}, {1138, 20, 2}, {1138, 21, 1}, {1138, 23, 2}, {1138, 30, 1},
+    {1138, 33, 1}, {1138, 39, 1}, {1138, 44, 1}, {1138, 46, 2}, {1138, 50, 1}, {1138, 51, 1},
+    {1138, 58, 2}, {1138, 59, 1}, {1138, 60, 1}, {1138, 69, 1}, {1138, 70, 1}, {1138, 71, 1},
+    {1138, 72, 2}, {1138, 74, 1}, {1138, 75, 1}, {1138, 76, 3}, {1138, 77, 2}, {1138, 78, 1},
+    {1138, 79, 3}, {1141, 1, 1}, {1141, 3, 2}, {1141, 4, 3}, {1143, 27, 1}, {1143, 34, 1},
+    {1143, 37, 1}, {1143, 41, 1}, {1143, 42, 2}, {1143, 45, 1}, {1143, 47, 1}, {1143, 50, 1},
+    {1143, 53, 1}, {1143, 54, 1}, {1143, 59, 1}, {1143, 63, 2}, {1143, 64, 1}, {1143, 65, 2},
+    {1143, 70, 1}, {1143, 73, 1}, {1143, 75, 1}, {1143, 77, 1}, {1143, 78, 1}, {1143, 79, 3},
+    {1143, 80, 2}, {1143, 81, 2}, {1145, 1, 1}, {1145, 3, 2}, {1145, 4, 3}, {1145, 5, 1},
+    {1153, 5, 1}, {1153, 7, 1}, {1153, 10, 1}, {1153, 11, 2}, {1153, 14, 1}, {1153, 15, 1},
+    {1153, 16, 2}, {1153, 18, 2}, {1153, 20, 1}, {1153, 21, 2}, {1153, 23, 1}, {1153, 24, 2},
+    {1153, 25, 3}, {1153, 26, 1}, {1153, 27, 2}, {1153, 28, 3}, {1153, 29, 2}, {1156, 5, 1},
+    {1156, 6, 2}, {1156, 9, 1}, {1156, 10, 2}, {1156, 11, 3}, {1156, 12, 1}, {1156, 13, 3},
+    {1156, 15, 1}, {1156, 16, 2}, {1156, 50, 1}, {1156, 57, 1}, {1156, 58, 1}, {1156, 59, 2},
+    {1156, 60, 2}, {1156, 61, 1}, {1156, 63, 3}, {1156, 64, 3}, {1156, 65, 4}, {1156, 67, 1},
+    {1156, 68, 2}, {1156, 70, 1}, {1156, 73, 1}, {1156, 77, 1}, {1156, 78, 2}, {1156, 85, 1},
+    {1156, 87, 1}, {1156, 89, 1}, {1156, 93, 1}, {1156, 94, 1}, {1156, 105, 1}, {1156, 106, 2},
+    {1156, 107, 2}, {1156, 108, 1}, {1156, 109, 2}, {1156, 111, 3}, {1156, 112, 1}, {1158, 1, 1},
+    {1158, 5, 1}, {1158, 13, 1}, {1158, 18, 1}, {1158, 19, 2}, {1158, 23, 1}, {1158, 32, 1},
+    {1158, 34, 1}, {1158, 43, 1}, {1158, 46, 1}, {1158, 48, 1}, {1158, 52, 1}, {1158, 59, 1},
+    {1158, 62, 1}, {1163, 4, 1}, {1163, 6, 1}, {1163, 8, 2}, {1163, 9, 2}, {1163, 12, 3},
+    {1165, 4, 1}, {1165, 6, 1}, {1165, 8, 2}, {1165, 9, 2}, {1165, 12, 3}, {1165, 29, 1},
+    {1165, 33, 1}, {1165, 35, 1}, {1165, 38, 1}, {1165, 39, 2}, {1165, 40, 1}, {1165, 41, 2},
+    {1165, 43, 1}, {1165, 44, 3}, {1165, 45, 2}, {1165, 47, 2}, {1165, 48, 3}, {1165, 49, 3},
+    {1165, 50, 2}, {1165, 51, 3}, {1167, 5, 1}, {1167, 6, 2}, {1167, 9, 1}, {1167, 10, 2},
+    {1167, 11, 3}, {1167, 12, 1}, {1167, 13, 3}, {1167, 15, 1}, {1167, 16, 2}, {1167, 77, 1},
+    {1167, 79, 1}, {1167, 81, 1}, {1167, 85, 1}, {1167, 86, 1}, {1167, 97, 1}, {1167, 98, 2},
+    {1167, 99, 2}, {1167, 100, 1}, {1167, 101, 2}, {1167, 103, 3}, {1167, 104, 1}, {1211, 5, 1},
+    {1211, 6, 2}, {1211, 9, 1}, {1211, 10, 2}, {1211, 11, 3}, {1211, 12, 1}, {1211, 13, 3},
+    {1211, 15, 1}, {1211, 16, 2}, {1211, 74, 1}, {1211, 78, 1}, {1211, 80, 1}, {1211, 84, 1},
+    {1211, 85, 1}, {1211, 96, 1}, {1211, 97, 2}, {1211, 98, 2}, {1211, 99, 1}, {1211, 100, 2},
+    {1211, 102, 3}, {1211, 103, 1}, {1211, 121, 1}, {1211, 122, 2}, {1211, 124, 1}, {1211, 126, 1},
+    {1211, 127, 2}, {1211, 128, 3}, {1211, 131, 1}, {1211, 132, 1}, {1211, 133, 1}, {1211, 134, 2},
+    {1211, 135, 1}, {1211, 136, 1}, {1211, 138, 2}, {1211, 140, 2}, {1211, 141, 1}, {1211, 142, 2},
+    {1211, 143, 3}, {1211, 144, 1}, {1211, 145, 2}, {1211, 147, 2}, {1211, 148, 2}, {1211, 149, 2},
+    {1211, 150, 3}, {1211, 151, 3}, {1211, 152, 1}, {1211, 153, 3}, {1211, 154, 3}, {1211, 155, 3},
+    {1211, 156, 3}, {1211, 157, 1}, {1211, 158, 2}, {1211, 159, 2}, {1211, 160, 3}, {1211, 161, 3},
+    {1211, 162, 3}, {1213, 16, 1}, {1213, 18, 1}, {1213, 20, 1}, {1213, 23, 1}, {1213, 25, 2},
+    {1222, 1, 1}, {1222, 4, 2}, {1222, 5, 3}, {1222, 6, 1}, {1222, 9, 2}, {1222, 11, 1},
+    {1222, 13, 1}, {1222, 14, 2}, {1222, 15, 1}, {1222, 16, 2}, {1222, 17, 3}, {1222, 18, 2},
+    {1222, 19, 3}, {1222, 20, 3}, {1222, 21, 1}, {1222, 24, 1}, {1222, 25, 1}, {1222, 26, 2},
+    {1222, 27, 2}, {1222, 28, 3}, {1244, 4, 1}, {1244, 18, 1}, {1245, 5, 1}, {1245, 6, 2},
+    {1245, 9, 1}, {1245, 10, 2}, {1245, 11, 3}, {1245, 12, 1}, {1245, 13, 3}, {1245, 15, 1},
+    {1245, 16, 2}, {1245, 24, 1}, {1245, 33, 1}, {1245, 36, 2}, {1245, 37, 3}, {1245, 39, 1},
+    {1245, 40, 2}, {1245, 41, 3}, {1245, 44, 2}, {1245, 45, 3}, {1245, 49, 1}, {1245, 53, 1},
+    {1245, 54, 2}, {1245, 58, 1}, {1245, 59, 2}, {1245, 86, 1}, {1245, 88, 1}, {1245, 90, 1},
+    {1245, 94, 1}, {1245, 95, 1}, {1245, 106, 1}, {1245, 107, 2}, {1245, 108, 2}, {1245, 109, 1},
+    {1245, 110, 2}, {1245, 112, 3}, {1245, 113, 1}, {1246, 6, 1}, {1246, 7, 1}, {1246, 8, 2},
+    {1246, 11, 3}, {1246, 13, 1}, {1246, 15, 1}, {1246, 17, 1}, {1246, 18, 2}, {1246, 19, 1},
+    {1246, 20, 1}, {1246, 22, 2}, {1246, 23, 2}, {1246, 24, 3}, {1246, 25, 1}, {1246, 26, 2},
+    {1246, 29, 3}, {1246, 30, 2}, {1246, 31, 1}, {1246, 32, 3}, {1246, 33, 2}, {1246, 37, 1},
+    {1246, 39, 1}, {1246, 42, 1}, {1246, 43, 2}, {1246, 46, 1}, {1246, 47, 1}, {1246, 48, 2},
+    {1246, 50, 2}, {1246, 52, 1}, {1246, 53, 2}, {1246, 55, 1}, {1246, 56, 2}, {1246, 57, 3},
+    {1246, 58, 1}, {1246, 59, 2}, {1246, 60, 3}, {1246, 61, 2}, {1246, 65, 1}, {1246, 66, 2},
+    {1246, 68, 3}, {1246, 71, 1}, {1246, 73, 1}, {1246, 74, 2}, {1246, 75, 1}, {1246, 76, 1},
+    {1246, 78, 1}, {1246, 79, 2}, {1246, 81, 3}, {1246, 82, 3}, {1246, 83, 1}, {1246, 84, 2},
+    {1247, 5, 1}, {1247, 6, 2}, {1247, 9, 1}, {1247, 10, 2}, {1247, 11, 3}, {1247, 12, 1},
+    {1247, 13, 3}, {1247, 15, 1}, {1247, 16, 2}, {1247, 48, 1}, {1247, 49, 2}, {1247, 51, 1},
+    {1247, 52, 2}, {1247, 53, 3}, {1247, 60, 1}, {1247, 61, 1}, {1247, 62, 1}, {1247, 64, 1},
+    {1247, 65, 2}, {1247, 67, 3}, {1247, 68, 1}, {1247, 69, 1}, {1247, 70, 2}, {1247, 71, 1},
+    {1247, 72, 3}, {1247, 73, 2}, {1247, 74, 1}, {1247, 75, 2}, {1247, 76, 3}, {1247, 78, 1},
+    {1247, 82, 1}, {1247, 86, 1}, {1247, 88, 1}, {1247, 92, 1}, {1247, 93, 1}, {1247, 104, 1},
+    {1247, 105, 2}, {1247, 106, 2}, {1247, 107, 1}, {1247, 108, 2}, {1247, 110, 3}, {1247, 111, 1},
+    {1251, 2, 1}, {1251, 3, 2}, {1251, 4, 3}, {1251, 7, 1}, {1251, 8, 1}, {1251, 9, 1},
+    {1251, 10, 2}, {1251, 11, 2}, {1251, 12, 3}, {1251, 13, 2}, {1251, 40, 1}, {1251, 42, 1},
+    {1251, 43, 1}, {1251, 44, 2}, {1251, 45, 2}, {1251, 46, 2}, {1251, 47, 3}, {1251, 49, 1},
+    {1300, 14, 1}, {1300, 16, 1}, {1300, 21, 1}, {1320, 5, 1}, {1320, 9, 2}, {1320, 12, 1},
+    {1320, 13, 1}, {1320, 17, 3}, {1322, 5, 1}, {1322, 6, 2}, {1322, 9, 1}, {1322, 10, 2},
+    {1322, 11, 3}, {1322, 12, 1}, {1322, 13, 3}, {1322, 15, 1}, {1322, 16, 2}, {1322, 52, 1},
+    {1322, 56, 1}, {1322, 58, 1}, {1322, 62, 1}, {1322, 63, 1}, {1322, 74, 1}, {1322, 75, 2},
+    {1322, 76, 2}, {1322, 77, 1}, {1322, 78, 2}, {1322, 80, 3}, {1322, 81, 1}, {1323, 6, 1},
+    {1323, 7, 1}, {1323, 8, 2}, {1323, 11, 3}, {1323, 13, 1}, {1323, 15, 1}, {1323, 17, 1},
+    {1323, 18, 2}, {1323, 19, 1}, {1323, 20, 1}, {1323, 22, 2}, {1323, 23, 2}, {1323, 24, 3},
+    {1323, 25, 1}, {1323, 26, 2}, {1323, 29, 3}, {1323, 30, 2}, {1323, 31, 1}, {1323, 32, 3},
+    {1323, 33, 2}, {1343, 7, 1}, {1343, 8, 1}, {1343, 18, 2}, {1343, 23, 1}, {1343, 24, 1},
+    {1343, 26, 1}, {1343, 27, 2}, {1347, 37, 1}, {1347, 41, 2}, {1347, 44, 1}, {1347, 49, 1},
+    {1367, 3, 1}, {1367, 7, 1}, {1367, 8, 2}, {1367, 42, 1}, {1367, 46, 1}, {1367, 48, 1},
+    {1367, 52, 1}, {1367, 53, 1}, {1367, 64, 1}, {1367, 65, 2}, {1367, 66, 2}, {1367, 67, 1},
+    {1367, 68, 2}, {1367, 70, 3}, {1367, 71, 1}, {1371, 14, 1}, {1371, 19, 1}, {1371, 20, 1},
+    {1371, 21, 2}, {1371, 22, 3}, {1371, 23, 1}, {1372, 9, 1}, {1372, 10, 1}, {1372, 11, 2},
+    {1372, 12, 3}, {1372, 13, 1}, {1373, 5, 1}, {1373, 7, 1}, {1373, 9, 2}, {1373, 10, 2},
+    {1373, 12, 1}, {1373, 13, 1}, {1373, 20, 1}, {1373, 32, 1}, {1373, 33, 2}, {1373, 37, 3},
+    {1373, 38, 1}, {1373, 41, 1}, {1373, 42, 1}, {1373, 44, 2}, {1373, 45, 2}, {1377, 23, 1},
+    {1377, 45, 1}, {1377, 46, 1}, {1377, 47, 1}, {1377, 48, 2}, {1377, 54, 1}, {1377, 58, 1},
+    {1378, 7, 1}, {1378, 8, 2}, {1378, 14, 1}, {1378, 15, 2}, {1380, 10, 1}, {1380, 14, 1},
+    {1380, 19, 1}, {1382, 16, 1}, {1382, 19, 1}, {1382, 24, 1}, {1382, 26, 1}, {1384, 2, 1},
+    {1384, 14, 1}, {1384, 25, 1}, {1384, 28, 1}, {1384, 29, 2}, {1384, 33, 1}, {1384, 38, 1},
+    {1384, 40, 2}, {1384, 41, 1}, {1384, 42, 1}, {1384, 44, 2}, {1384, 45, 1}, {1384, 47, 2},
+    {1384, 48, 2}, {1384, 49, 1}, {1384, 50, 1}, {1385, 5, 1}, {1385, 6, 1}, {1385, 7, 1},
+    {1385, 8, 2}, {1385, 10, 3}, {1385, 11, 1}, {1385, 28, 1}, {1391, 5, 1}, {1391, 6, 2},
+    {1391, 9, 1}, {1391, 10, 2}, {1391, 11, 3}, {1391, 12, 1}, {1391, 13, 3}, {1391, 15, 1},
+    {1391, 16, 2}, {1391, 80, 1}, {1391, 82, 1}, {1391, 84, 1}, {1391, 88, 1}, {1391, 89, 1},
+    {1391, 100, 1}, {1391, 101, 2}, {1391, 102, 2}, {1391, 103, 1}, {1391, 104, 2}, {1391, 106, 3},
+    {1391, 107, 1}, {1393, 25, 1}, {1393, 27, 1}, {1393, 28, 1}, {1393, 41, 1}, {1393, 44, 1},
+    {1393, 45, 1}, {1393, 54, 1}, {1393, 61, 1}, {1393, 68, 1}, {1394, 3, 1}, {1394, 4, 2},
+    {1394, 6, 1}, {1394, 7, 2}, {1394, 8, 3}, {1394, 15, 1}, {1394, 16, 1}, {1394, 17, 1},
+    {1394, 19, 1}, {1394, 20, 2}, {1394, 22, 3}, {1394, 23, 1}, {1394, 24, 1}, {1394, 25, 2},
+    {1394, 26, 1}, {1394, 27, 3}, {1394, 28, 2}, {1394, 29, 1}, {1394, 30, 2}, {1394, 31, 3},
+    {1394, 33, 1}, {1401, 1, 1}, {1401, 3, 2}, {1401, 4, 3}, {1407, 3, 1}, {1407, 4, 2},
+    {1407, 6, 1}, {1407, 7, 2}, {1407, 8, 3}, {1407, 11, 1}, {1407, 12, 1}, {1407, 16, 1},
+    {1407, 18, 1}, {1407, 20, 1}, {1407, 21, 2}, {1407, 23, 3}, {1407, 25, 1}, {1407, 26, 1},
+    {1407, 27, 2}, {1407, 28, 1}, {1407, 29, 3}, {1407, 30, 2}, {1407, 31, 1}, {1407, 32, 2},
+    {1407, 33, 3}, {1408, 10, 1}, {1408, 12, 1}, {1408, 17, 1}, {1438, 5, 11}, {1438, 6, 2},
+    {1438, 7, 12}, {1438, 11, 9}, {1438, 12, 12}, {1438, 13, 4}, {1438, 14, 6}, {1438, 22, 7},
+    {1438, 23, 8}, {1438, 29, 5}, {1438, 30, 3}, {1438, 31, 6}, {1438, 32, 6}, {1438, 34, 2},
+    {1438, 36, 1}, {1438, 39, 4}, {1438, 40, 5}, {1438, 57, 1}, {1438, 60, 1}, {1438, 69, 6},
+    {1438, 70, 7}, {1438, 73, 13}, {1438, 74, 8}, {1438, 77, 1}, {1438, 81, 6}, {1438, 85, 1},
+    {1438, 89, 9}, {1438, 91, 11}, {1438, 92, 11}, {1438, 94, 12}, {1438, 95, 1}, {1438, 96, 1},
+    {1438, 97, 13}, {1438, 98, 13}, {1438, 99, 12}, {1438, 100, 13}, {1438, 101, 14},
+    {1438, 102, 11}, {1438, 109, 1}, {1438, 114, 1}, {1439, 2, 4}, {1440, 1, 1}, {1440, 10, 1},
+    {1440, 16, 1}, {1440, 17, 1}, {1440, 20, 1}, {1440, 28, 1}, {1440, 30, 1}, {1440, 34, 1},
+    {1440, 38, 1}, {1440, 40, 1}, {1440, 43, 1}, {1440, 47, 1}, {1440, 51, 1}, {1440, 53, 1},
+    {1440, 54, 1}, {1440, 59, 1}, {1440, 63, 2}, {1440, 74, 1}, {1440, 78, 1}, {1440, 79, 1},
+    {1440, 80, 1}, {1440, 81, 1}, {1440, 83, 1}, {1440, 86, 1}, {1440, 87, 1}, {1440, 95, 1},
+    {1449, 6, 1}, {1449, 8, 1}, {1449, 10, 1}, {1449, 14, 1}, {1449, 15, 1}, {1449, 26, 1},
+    {1449, 27, 2}, {1449, 28, 2}, {1449, 29, 1}, {1449, 30, 2}, {1449, 32, 3}, {1449, 33, 1},
+    {1450, 5, 1}, {1450, 7, 1}, {1450, 10, 1}, {1450, 11, 2}, {1450, 14, 1}, {1450, 15, 1},
+    {1450, 16, 2}, {1450, 18, 2}, {1450, 20, 1}, {1450, 21, 2}, {1450, 23, 1}, {1450, 24, 2},
+    {1450, 25, 3}, {1450, 26, 1}, {1450, 27, 2}, {1450, 28, 3}, {1450, 29, 2}, {1463, 6, 1},
+    {1463, 10, 1}, {1463, 12, 1}, {1463, 15, 1}, {1463, 16, 2}, {1463, 17, 1}, {1463, 18, 2},
+    {1463, 20, 1}, {1463, 21, 3}, {1463, 22, 2}, {1463, 24, 2}, {1463, 25, 3}, {1463, 26, 3},
+    {1463, 27, 1}, {1463, 28, 3}, {1464, 6, 1}, {1464, 10, 1}, {1464, 12, 1}, {1464, 15, 1},
+    {1464, 16, 2}, {1464, 17, 1}, {1464, 18, 2}, {1464, 20, 1}, {1464, 21, 3}, {1464, 22, 2},
+    {1464, 24, 2}, {1464, 25, 3}, {1464, 26, 3}, {1464, 27, 1}, {1464, 28, 3}, {1466, 6, 1},
+    {1466, 8, 1}, {1466, 10, 1}, {1466, 14, 1}, {1466, 15, 1}, {1466, 26, 1}, {1466, 27, 2},
+    {1466, 28, 2}, {1466, 29, 1}, {1466, 30, 2}, {1466, 32, 3}, {1466, 33, 1}, {1468, 4, 1},
+    {1468, 5, 2}, {1468, 7, 3}, {1468, 10, 1}, {1468, 12, 1}, {1468, 13, 2}, {1468, 14, 1},
+    {1468, 15, 1}, {1468, 17, 1}, {1468, 18, 2}, {1468, 20, 3}, {1468, 21, 3}, {1468, 22, 1},
+    {1468, 23, 2}, {1479, 6, 1}, {1479, 10, 1}, {1479, 12, 1}, {1479, 15, 1}, {1479, 16, 2},
+    {1479, 17, 1}, {1479, 18, 2}, {1479, 20, 1}, {1479, 21, 3}, {1479, 22, 2}, {1479, 24, 2},
+    {1479, 25, 3}, {1479, 26, 3}, {1479, 27, 1}, {1479, 28, 3}, {1479, 35, 1}, {1479, 36, 2},
+    {1479, 37, 1}, {1479, 39, 1}, {1479, 40, 1}, {1479, 42, 1}, {1479, 44, 1}, {1479, 45, 2},
+    {1479, 46, 2}, {1479, 47, 1}, {1479, 48, 3}, {1479, 49, 2}, {1479, 50, 2}, {1479, 51, 2},
+    {1479, 52, 2}, {1479, 53, 3}, {1479, 54, 3}, {1479, 55, 3}, {1479, 57, 3}, {1484, 2, 1},
+    {1484, 3, 2}, {1503, 3, 1}, {1503, 4, 2}, {1503, 5, 3}, {1503, 6, 4}, {1517, 5, 1},
+    {1517, 6, 2}, {1517, 9, 1}, {1517, 10, 2}, {1517, 11, 3}, {1517, 12, 1}, {1517, 13, 3},
+    {1517, 15, 1}, {1517, 16, 2}, {1517, 23, 1}, {1517, 25, 1}, {1517, 27, 1}, {1517, 31, 1},
+    {1517, 32, 1}, {1517, 43, 1}, {1517, 44, 2}, {1517, 45, 2}, {1517, 46, 1}, {1517, 47, 2},
+    {1517, 49, 3}, {1517, 50, 1}, {1517, 97, 1}, {1517, 100, 1}, {1517, 102, 1}, {1517, 103, 2},
+    {1517, 104, 2}, {1517, 105, 2}, {1517, 106, 3}, {1517, 107, 1}, {1517, 113, 1}, {1517, 115, 2},
+    {1518, 16, 1}, {1518, 18, 1}, {1518, 66, 1}, {1518, 70, 1}, {1523, 14, 1}, {1523, 15, 2},
+    {1527, 7, 1}, {1527, 16, 1}, {1527, 19, 2}, {1527, 20, 3}, {1527, 22, 1}, {1527, 23, 2},
+    {1527, 24, 3}, {1527, 27, 2}, {1527, 28, 3}, {1536, 7, 1}, {1536, 16, 1}, {1536, 19, 2},
+    {1536, 20, 3}, {1536, 22, 1}, {1536, 23, 2}, {1536, 24, 3}, {1536, 27, 2}, {1536, 28, 3},
+    {1537, 5, 1}, {1537, 7, 1}, {1537, 10, 1}, {1537, 11, 2}, {1537, 14, 1}, {1537, 15, 1},
+    {1537, 16, 2}, {1537, 18, 2}, {1537, 20, 1}, {1537, 21, 2}, {1537, 23, 1}, {1537, 24, 2},
+    {1537, 25, 3}, {1537, 26, 1}, {1537, 27, 2}, {1537, 28, 3}, {1537, 29, 2}, {1539, 32, 1},
+    {1539, 36, 1}, {1539, 37, 2}, {1539, 42, 1}, {1539, 46, 1}, {1539, 48, 1}, {1539, 52, 1},
+    {1539, 53, 1}, {1539, 64, 1}, {1539, 65, 2}, {1539, 66, 2}, {1539, 67, 1}, {1539, 68, 2},
+    {1539, 70, 3}, {1539, 71, 1}, {1540, 6, 1}, {1540, 7, 1}, {1540, 8, 2}, {1540, 11, 3},
+    {1540, 13, 1}, {1540, 15, 1}, {1540, 17, 1}, {1540, 18, 2}, {1540, 19, 1}, {1540, 20, 1},
+    {1540, 22, 2}, {1540, 23, 2}, {1540, 24, 3}, {1540, 25, 1}, {1540, 26, 2}, {1540, 29, 3},
+    {1540, 30, 2}, {1540, 31, 1}, {1540, 32, 3}, {1540, 33, 2}, {1541, 7, 1}, {1541, 16, 1},
+    {1541, 19, 2}, {1541, 20, 3}, {1541, 22, 1}, {1541, 23, 2}, {1541, 24, 3}, {1541, 27, 2},
+    {1541, 28, 3}, {1541, 32, 1}, {1541, 33, 1}, {1541, 37, 1}, {1541, 39, 1}, {1541, 40, 2},
+    {1541, 42, 1}, {1541, 44, 1}, {1541, 46, 1}, {1541, 47, 2}, {1541, 49, 3}, {1541, 50, 2},
+    {1541, 52, 1}, {1541, 53, 1}, {1541, 54, 3}, {1541, 55, 2}, {1541, 56, 1}, {1541, 57, 3},
+    {1541, 58, 2}, {1541, 59, 1}, {1541, 60, 2}, {1541, 61, 3}, {1542, 6, 1}, {1542, 8, 1},
+    {1542, 10, 1}, {1542, 14, 1}, {1542, 15, 1}, {1542, 26, 1}, {1542, 27, 2}, {1542, 28, 2},
+    {1542, 29, 1}, {1542, 30, 2}, {1542, 32, 3}, {1542, 33, 1}, {1542, 36, 1}, {1542, 37, 1},
+    {1542, 41, 1}, {1542, 43, 1}, {1542, 44, 2}, {1542, 46, 1}, {1542, 48, 1}, {1542, 50, 1},
+    {1542, 51, 2}, {1542, 53, 3}, {1542, 54, 2}, {1542, 56, 1}, {1542, 57, 1}, {1542, 58, 3},
+    {1542, 59, 2}, {1542, 60, 1}, {1542, 61, 3}, {1542, 62, 2}, {1542, 63, 1}, {1542, 64, 2},
+    {1542, 65, 3}, {1550, 2, 1}, {1550, 3, 2}, {1550, 4, 3}, {1550, 7, 1}, {1550, 8, 1},
+    {1550, 9, 1}, {1550, 10, 2}, {1550, 11, 2}, {1550, 12, 3}, {1550, 13, 2}, {1550, 17, 1},
+    {1550, 19, 1}, {1550, 20, 1}, {1550, 21, 1}, {1550, 22, 2}, {1550, 23, 2}, {1550, 24, 3},
+    {1550, 26, 1}, {1557, 4, 1}, {1557, 6, 1}, {1557, 7, 1}, {1557, 11, 2}, {1557, 13, 1},
+    {1557, 18, 2}, {1557, 21, 3}, {1557, 22, 1}, {1557, 23, 1}, {1557, 27, 1}, {1557, 40, 1},
+    {1557, 46, 2}, {1577, 24, 1}, {1577, 25, 2}, {1577, 28, 1}, {1577, 29, 2}, {1577, 30, 3},
+    {1577, 31, 1}, {1577, 32, 3}, {1577, 34, 1}, {1577, 35, 2}, {1577, 42, 1}, {1577, 46, 1},
+    {1577, 48, 1}, {1577, 52, 1}, {1577, 53, 1}, {1577, 64, 1}, {1577, 65, 2}, {1577, 66, 2},
+    {1577, 67, 1}, {1577, 68, 2}, {1577, 70, 3}, {1577, 71, 1}, {1577, 74, 1}, {1577, 78, 1},
+    {1577, 79, 2}, {1577, 99, 1}, {1577, 105, 1}, {1577, 106, 1}, {1591, 9, 1}, {1591, 21, 1},
+    {1591, 22, 2}, {1591, 24, 1}, {1591, 27, 1}, {1591, 34, 1}, {1591, 35, 1}, {1591, 37, 1},
+    {1591, 39, 1}, {1591, 41, 2}, {1591, 49, 2}, {1592, 21, 1}, {1592, 22, 2}, {1598, 5, 1},
+    {1598, 6, 2}, {1598, 9, 1}, {1598, 10, 2}, {1598, 11, 3}, {1598, 12, 1}, {1598, 13, 3},
+    {1598, 15, 1}, {1598, 16, 2}, {1598, 70, 1}, {1598, 74, 1}, {1598, 76, 1}, {1598, 80, 1},
+    {1598, 81, 1}, {1598, 92, 1}, {1598, 93, 2}, {1598, 94, 2}, {1598, 95, 1}, {1598, 96, 2},
+    {1598, 98, 3}, {1598, 99, 1}, {1599, 49, 1}, {1599, 50, 2}, {1599, 51, 3}, {1599, 54, 1},
+    {1599, 55, 1}, {1599, 56, 1}, {1599, 57, 2}, {1599, 58, 2}, {1599, 59, 3}, {1599, 60, 2},
+    {1599, 64, 1}, {1599, 66, 1}, {1599, 67, 1}, {1599, 68, 1}, {1599, 69, 2}, {1599, 70, 2},
+    {1599, 71, 3}, {1599, 73, 1}, {1600, 5, 1}, {1600, 6, 2}, {1600, 9, 1}, {1600, 10, 2},
+    {1600, 11, 3}, {1600, 12, 1}, {1600, 13, 3}, {1600, 15, 1}, {1600, 16, 2}, {1600, 23, 1},
+    {1600, 25, 1}, {1600, 27, 1}, {1600, 31, 1}, {1600, 32, 1}, {1600, 43, 1}, {1600, 44, 2},
+    {1600, 45, 2}, {1600, 46, 1}, {1600, 47, 2}, {1600, 49, 3}, {1600, 50, 1}, {1601, 1, 1},
+    {1601, 4, 2}, {1601, 5, 3}, {1601, 6, 1}, {1601, 9, 2}, {1601, 11, 1}, {1601, 13, 1},
+    {1601, 14, 2}, {1601, 15, 1}, {1601, 16, 2}, {1601, 17, 3}, {1601, 18, 2}, {1601, 19, 3},
+    {1601, 20, 3}, {1601, 21, 1}, {1601, 24, 1}, {1601, 25, 1}, {1601, 26, 2}, {1601, 27, 2},
+    {1601, 28, 3}, {1603, 112, 1}, {1603, 114, 1}, {1603, 119, 1}, {1603, 121, 1}, {1603, 126, 1},
+    {1603, 127, 1}, {1603, 130, 1}, {1603, 136, 1}, {1603, 137, 1}, {1603, 141, 1}, {1605, 1, 1},
+    {1605, 4, 2}, {1605, 5, 3}, {1605, 6, 1}, {1605, 9, 2}, {1605, 11, 1}, {1605, 13, 1},
+    {1605, 14, 2}, {1605, 15, 1}, {1605, 16, 2}, {1605, 17, 3}, {1605, 18, 2}, {1605, 19, 3},
+    {1605, 20, 3}, {1605, 21, 1}, {1605, 24, 1}, {1605, 25, 1}, {1605, 26, 2}, {1605, 27, 2},
+    {1605, 28, 3}, {1620, 20, 1}, {1620, 23, 1}, {1620, 25, 1}, {1620, 26, 1}, {1620, 29, 1},
+    {1620, 39, 1}, {1620, 40, 2}, {1620, 41, 2}, {1620, 42, 2}, {1620, 43, 2}, {1620, 50, 1},
+    {1620, 51, 2}, {1620, 53, 1}, {1620, 54, 2}, {1620, 56, 1}, {1620, 57, 2}, {1620, 63, 1},
+    {1620, 77, 2}, {1620, 79, 3}, {1621, 2, 1}, {1621, 11, 1}, {1621, 12, 2}, {1621, 15, 1},
+    {1621, 16, 2}, {1621, 17, 3}, {1621, 18, 1}, {1621, 19, 3}, {1621, 21, 1}, {1621, 22, 2},
+    {1621, 26, 1}, {1621, 28, 2}, {1621, 31, 1}, {1621, 32, 3}, {1621, 33, 1}, {1621, 34, 2},
+    {1621, 35, 1}, {1621, 36, 3}, {1621, 37, 2}, {1621, 38, 3}, {1621, 40, 2}, {1621, 45, 1},
+    {1621, 47, 1}, {1621, 49, 1}, {1621, 53, 1}, {1621, 54, 1}, {1621, 65, 1}, {1621, 66, 2},
+    {1621, 67, 2}, {1621, 68, 1}, {1621, 69, 2}, {1621, 71, 3}, {1621, 72, 1}, {1621, 74, 1},
+    {1621, 75, 2}, {1621, 79, 3}, {1621, 82, 1}, {1621, 89, 3}, {1621, 90, 4}, {1621, 91, 5},
+    {1621, 121, 1}, {1621, 123, 2}, {1621, 125, 1}, {1621, 150, 2}, {1621, 151, 1}, {1621, 152, 3},
+    {1621, 156, 1}, {1621, 158, 1}, {1621, 159, 2}, {1621, 160, 3}, {1621, 165, 2}, {1621, 166, 1},
+    {1621, 168, 3}, {1621, 169, 1}, {1621, 170, 2}, {1621, 171, 1}, {1621, 172, 2}, {1621, 173, 1},
+    {1621, 174, 2}, {1623, 9, 1}, {1623, 10, 1}, {1623, 11, 1}, {1623, 12, 1}, {1623, 16, 1},
+    {1623, 17, 2}, {1623, 18, 1}, {1623, 19, 2}, {1623, 20, 2}, {1623, 23, 1}, {1623, 24, 2},
+    {1623, 25, 1}, {1623, 26, 2}, {1623, 27, 2}, {1623, 28, 3}, {1623, 29, 2}, {1623, 30, 3},
+    {1623, 31, 3}, {1623, 33, 2}, {1623, 35, 1}, {1623, 36, 2}, {1623, 37, 3}, {1624, 2, 1},
+    {1624, 3, 2}, {1624, 4, 3}, {1624, 7, 1}, {1624, 9, 1}, {1624, 10, 2}, {1624, 11, 3},
+    {1624, 12, 2}, {1624, 13, 3}, {1624, 18, 1}, {1624, 19, 1}, {1624, 23, 1}, {1624, 25, 1},
+    {1624, 26, 2}, {1624, 28, 1}, {1624, 30, 1}, {1624, 32, 1}, {1624, 33, 2}, {1624, 35, 3},
+    {1624, 36, 2}, {1624, 38, 1}, {1624, 39, 1}, {1624, 40, 3}, {1624, 41, 2}, {1624, 42, 1},
+    {1624, 43, 3}, {1624, 44, 2}, {1624, 45, 1}, {1624, 46, 2}, {1624, 47, 3}, {1624, 51, 1},
+    {1624, 52, 2}, {1624, 55, 1}, {1624, 56, 2}, {1624, 57, 3}, {1624, 58, 1}, {1624, 59, 3},
+    {1624, 61, 1}, {1624, 62, 2}, {1624, 68, 1}, {1624, 72, 1}, {1624, 74, 1}, {1624, 78, 1},
+    {1624, 79, 1}, {1624, 90, 1}, {1624, 91, 2}, {1624, 92, 2}, {1624, 93, 1}, {1624, 94, 2},
+    {1624, 96, 3}, {1624, 97, 1}, {1632, 6, 1}, {1632, 11, 1}, {1632, 25, 2}, {1632, 34, 1},
+    {1632, 38, 1}, {1632, 43, 1}, {1633, 18, 1}, {1635, 4, 1}, {1635, 5, 2}, {1635, 6, 3},
+    {1635, 9, 1}, {1635, 11, 1}, {1635, 12, 2}, {1635, 13, 3}, {1635, 14, 2}, {1635, 15, 3},
+    {1635, 20, 1}, {1653, 4, 1}, {1653, 5, 2}, {1663, 2, 1}, {1663, 3, 2}, {1663, 4, 3},
+    {1663, 7, 1}, {1663, 9, 1}, {1663, 10, 2}, {1663, 11, 3}, {1663, 12, 2}, {1663, 13, 3},
+    {1663, 20, 1}, {1663, 21, 2}, {1663, 23, 1}, {1663, 25, 1}, {1663, 26, 2}, {1663, 27, 3},
+    {1663, 30, 1}, {1663, 31, 1}, {1663, 32, 1}, {1663, 33, 2}, {1663, 34, 1}, {1663, 35, 1},
+    {1663, 37, 2}, {1663, 39, 2}, {1663, 40, 1}, {1663, 41, 2}, {1663, 42, 3}, {1663, 43, 1},
+    {1663, 44, 2}, {1663, 46, 2}, {1663, 47, 2}, {1663, 48, 2}, {1663, 49, 3}, {1663, 50, 3},
+    {1663, 51, 1}, {1663, 52, 3}, {1663, 53, 3}, {1663, 54, 3}, {1663, 55, 3}, {1663, 56, 1},
+    {1663, 57, 2}, {1663, 58, 2}, {1663, 59, 3}, {1663, 60, 3}, {1663, 61, 3}, {1707, 1, 1},
+    {1712, 10, 1}, {1712, 12, 1}, {1712, 17, 1}, {1714, 5, 1}, {1714, 6, 2}, {1714, 9, 1},
+    {1714, 10, 2}, {1714, 11, 3}, {1714, 12, 1}, {1714, 13, 3}, {1714, 15, 1}, {1714, 16, 2},
+    {1714, 25, 1}, {1714, 29, 1}, {1714, 31, 1}, {1714, 35, 1}, {1714, 36, 1}, {1714, 47, 1},
+    {1714, 48, 2}, {1714, 49, 2}, {1714, 50, 1}, {1714, 51, 2}, {1714, 53, 3}, {1714, 54, 1},
+    {1715, 32, 1}, {1715, 34, 1}, {1715, 39, 1}, {1717, 5, 1}, {1717, 6, 2}, {1717, 9, 1},
+    {1717, 10, 2}, {1717, 11, 3}, {1717, 12, 1}, {1717, 13, 3}, {1717, 15, 1}, {1717, 16, 2},
+    {1717, 50, 1}, {1717, 52, 1}, {1717, 54, 1}, {1717, 58, 1}, {1717, 59, 1}, {1717, 70, 1},
+    {1717, 71, 2}, {1717, 72, 2}, {1717, 73, 1}, {1717, 74, 2}, {1717, 76, 3}, {1717, 77, 1},
+    {1756, 14, 1}, {1756, 15, 2}, {1756, 16, 1}, {1756, 17, 2}, {1756, 19, 3}, {1756, 20, 1},
+    {1756, 21, 2}, {1756, 23, 1}, {1756, 24, 1}, {1756, 25, 3}, {1756, 27, 1}, {1756, 28, 2},
+    {1756, 29, 3}, {1756, 30, 2}, {1756, 31, 3}, {1756, 34, 3}, {1756, 40, 1}, {1756, 41, 2},
+    {1756, 44, 1}, {1756, 45, 2}, {1756, 46, 3}, {1756, 47, 1}, {1756, 48, 3}, {1756, 50, 1},
+    {1756, 51, 2}, {1756, 58, 1}, {1756, 62, 1}, {1756, 64, 1}, {1756, 68, 1}, {1756, 69, 1},
+    {1756, 80, 1}, {1756, 81, 2}, {1756, 82, 2}, {1756, 83, 1}, {1756, 84, 2}, {1756, 86, 3},
+    {1756, 87, 1}, {1758, 13, 1}, {1766, 5, 1}, {1766, 6, 2}, {1766, 9, 1}, {1766, 10, 2},
+    {1766, 11, 3}, {1766, 12, 1}, {1766, 13, 3}, {1766, 15, 1}, {1766, 16, 2}, {1766, 23, 1},
+    {1766, 25, 1}, {1766, 27, 1}, {1766, 31, 1}, {1766, 32, 1}, {1766, 43, 1}, {1766, 44, 2},
+    {1766, 45, 2}, {1766, 46, 1}, {1766, 47, 2}, {1766, 49, 3}, {1766, 50, 1}, {1767, 5, 1},
+    {1767, 7, 1}, {1767, 10, 1}, {1767, 11, 2}, {1767, 14, 1}, {1767, 15, 1}, {1767, 16, 2},
+    {1767, 18, 2}, {1767, 20, 1}, {1767, 21, 2}, {1767, 23, 1}, {1767, 24, 2}, {1767, 25, 3},
+    {1767, 26, 1}, {1767, 27, 2}, {1767, 28, 3}, {1767, 29, 2}, {1784, 1, 1}, {1784, 3, 2},
+    {1784, 4, 3}, {1784, 6, 1}, {1795, 10, 1}, {1795, 12, 1}, {1795, 17, 1}, {1795, 24, 1},
+    {1795, 25, 1}, {1795, 29, 1}, {1795, 32, 1}, {1795, 34, 1}, {1795, 36, 1}, {1795, 37, 2},
+    {1795, 39, 3}, {1795, 40, 2}, {1795, 42, 1}, {1795, 43, 1}, {1795, 44, 1}, {1795, 45, 2},
+    {1795, 46, 1}, {1795, 47, 3}, {1795, 48, 2}, {1795, 49, 1}, {1795, 50, 2}, {1795, 51, 3},
+    {1795, 64, 1}, {1795, 65, 2}, {1795, 68, 1}, {1795, 69, 2}, {1795, 70, 3}, {1795, 71, 2},
+    {1795, 72, 3}, {1795, 74, 1}, {1795, 75, 2}, {1795, 82, 1}, {1795, 86, 1}, {1795, 88, 1},
+    {1795, 92, 1}, {1795, 93, 1}, {1795, 104, 1}, {1795, 105, 2}, {1795, 106, 2}, {1795, 107, 1},
+    {1795, 108, 2}, {1795, 110, 3}, {1795, 111, 1}, {1795, 128, 1}, {1795, 129, 2}, {1795, 130, 3},
+    {1795, 133, 1}, {1795, 134, 1}, {1795, 135, 1}, {1795, 136, 2}, {1795, 137, 2}, {1795, 138, 3},
+    {1795, 139, 2}, {1795, 143, 1}, {1795, 145, 1}, {1795, 146, 1}, {1795, 147, 2}, {1795, 148, 2},
+    {1795, 149, 2}, {1795, 150, 3}, {1795, 152, 1}, {1808, 5, 1}, {1808, 7, 1}, {1808, 10, 1},
+    {1808, 11, 2}, {1808, 14, 1}, {1808, 15, 1}, {1808, 16, 2}, {1808, 18, 2}, {1808, 20, 1},
+    {1808, 21, 2}, {1808, 23, 1}, {1808, 24, 2}, {1808, 25, 3}, {1808, 26, 1}, {1808, 27, 2},
+    {1808, 28, 3}, {1808, 29, 2}, {1810, 6, 1}, {1810, 10, 1}, {1810, 12, 1}, {1810, 16, 1},
+    {1810, 17, 1}, {1810, 28, 1}, {1810, 29, 2}, {1810, 30, 2}, {1810, 31, 1}, {1810, 32, 2},
+    {1810, 34, 3}, {1810, 35, 1}, {1810, 38, 1}, {1810, 39, 1}, {1810, 43, 1}, {1810, 45, 1},
+    {1810, 46, 2}, {1810, 48, 1}, {1810, 50, 1}, {1810, 52, 1}, {1810, 53, 2}, {1810, 55, 3},
+    {1810, 56, 2}, {1810, 58, 1}, {1810, 59, 1}, {1810, 60, 3}, {1810, 61, 2}, {1810, 62, 1},
+    {1810, 63, 3}, {1810, 64, 2}, {1810, 65, 1}, {1810, 66, 2}, {1810, 67, 3}, {1811, 6, 1},
+    {1811, 7, 1}, {1811, 8, 2}, {1811, 11, 3}, {1811, 13, 1}, {1811, 15, 1}, {1811, 17, 1},
+    {1811, 18, 2}, {1811, 19, 1}, {1811, 20, 1}, {1811, 22, 2}, {1811, 23, 2}, {1811, 24, 3},
+    {1811, 25, 1}, {1811, 26, 2}, {1811, 30, 3}, {1811, 31, 2}, {1811, 32, 1}, {1811, 33, 3},
+    {1811, 34, 2}, {1812, 5, 1}, {1812, 6, 2}, {1812, 8, 3}, {1812, 11, 1}, {1812, 13, 1},
+    {1812, 14, 2}, {1812, 15, 3}, {1812, 17, 1}, {1812, 18, 1}, {1812, 19, 1}, {1812, 21, 1},
+    {1812, 22, 2}, {1812, 23, 2}, {1812, 25, 3}, {1826, 17, 1}, {1826, 30, 1}, {1835, 19, 1},
+    {1835, 20, 1}, {1835, 21, 1}, {1835, 22, 2}, {1835, 23, 2}, {1835, 26, 1}, {1838, 2, 1},
+    {1839, 1, 1}, {1839, 3, 1}, {1839, 4, 2}, {1839, 5, 3}, {1848, 6, 1}, {1848, 9, 1},
+    {1848, 12, 1}, {1848, 13, 2}, {1848, 14, 3}, {1848, 17, 2}, {1848, 20, 1}, {1848, 21, 1},
+    {1848, 25, 1}, {1848, 26, 1}, {1848, 27, 2}, {1848, 28, 2}, {1848, 29, 1}, {1848, 30, 2},
+    {1848, 31, 1}, {1848, 37, 1}, {1848, 53, 1}, {1848, 54, 2}, {1848, 59, 3}, {1848, 61, 1},
+    {1848, 62, 2}, {1848, 63, 3}, {1848, 64, 3}, {1848, 66, 1}, {1848, 67, 4}, {1848, 68, 1},
+    {1848, 69, 2}, {1848, 75, 2}, {1848, 76, 3}, {1848, 77, 2}, {1848, 78, 1}, {1848, 79, 2},
+    {1848, 80, 1}, {1848, 81, 3}, {1848, 82, 3}, {1848, 83, 3}, {1848, 84, 3}, {1848, 88, 2},
+    {1848, 89, 4}, {1848, 90, 3}, {1848, 91, 2}, {1848, 93, 1}, {1848, 94, 2}, {1849, 5, 1},
+    {1849, 6, 2}, {1849, 9, 1}, {1849, 10, 2}, {1849, 11, 3}, {1849, 12, 1}, {1849, 13, 3},
+    {1849, 15, 1}, {1849, 16, 2}, {1849, 23, 1}, {1849, 27, 1}, {1849, 29, 1}, {1849, 33, 1},
+    {1849, 34, 1}, {1849, 45, 1}, {1849, 46, 2}, {1849, 47, 2}, {1849, 48, 1}, {1849, 49, 2},
+    {1849, 51, 3}, {1849, 52, 1}, {1864, 9, 1}, {1864, 13, 1}, {1864, 14, 2}, {1864, 16, 2},
+    {1864, 22, 1}, {1864, 32, 1}, {1864, 36, 1}, {1864, 52, 1}, {1864, 67, 1}, {1864, 68, 1},
+    {1864, 69, 1}, {1864, 70, 1}, {1864, 71, 1}, {1866, 90, 1}, {1866, 114, 1}, {1866, 115, 2},
+    {1866, 118, 1}, {1866, 119, 2}, {1866, 120, 3}, {1866, 121, 1}, {1866, 122, 3}, {1866, 124, 1},
+    {1866, 125, 2}, {1866, 132, 1}, {1866, 136, 1}, {1866, 138, 1}, {1866, 142, 1}, {1866, 143, 1},
+    {1866, 154, 1}, {1866, 155, 2}, {1866, 156, 2}, {1866, 157, 1}, {1866, 158, 2}, {1866, 160, 3},
+    {1866, 161, 1}, {1925, 19, 1}, {1925, 28, 1}, {1925, 34, 1}, {1925, 35, 1}, {1925, 39, 1},
+    {1925, 42, 1}, {1925, 46, 1}, {1925, 49, 2}, {1925, 51, 1}, {1925, 52, 1}, {1925, 53, 1},
+    {1925, 54, 1}, {1925, 56, 2}, {1925, 61, 1}, {1925, 65, 1}, {1925, 67, 1}, {1925, 69, 2},
+    {1927, 1, 1}, {1927, 3, 2}, {1927, 4, 3}, {1927, 5, 1}, {1938, 7, 1}, {1938, 24, 1},
+    {1938, 26, 2}, {1950, 5, 12}, {1950, 6, 2}, {1950, 7, 13}, {1950, 9, 4}, {1950, 11, 9},
+    {1950, 13, 12}, {1950, 14, 4}, {1950, 20, 7}, {1950, 26, 1}, {1950, 27, 6}, {1950, 28, 7},
+    {1950, 29, 3}, {1950, 31, 5}, {1950, 34, 1}, {1950, 35, 3}, {1950, 58, 6}, {1950, 59, 7},
+    {1950, 65, 2}, {1950, 66, 1}, {1950, 67, 3}, {1950, 68, 4}, {1950, 75, 1}, {1950, 76, 1},
+    {1950, 90, 5}, {1950, 91, 14}, {1950, 99, 6}, {1950, 103, 1}, {1950, 105, 4}, {1950, 108, 1},
+    {1950, 113, 1}, {1950, 114, 6}, {1950, 116, 12}, {1950, 117, 13}, {1950, 118, 14},
+    {1950, 119, 13}, {1950, 120, 14}, {1950, 121, 14}, {1950, 122, 15}, {1950, 123, 7},
+    {1950, 125, 15}, {1951, 2, 4}, {1956, 11, 1}, {1967, 7, 3}, {1967, 11, 1}, {1967, 12, 1},
+    {1967, 13, 3}, {1967, 14, 1}, {1967, 15, 1}, {1967, 16, 2}, {1967, 17, 2}, {1967, 19, 2},
+    {1967, 21, 2}, {1967, 23, 1}, {1967, 24, 3}, {1967, 29, 3}, {1967, 35, 1}, {1967, 36, 1},
+    {1967, 37, 2}, {1967, 38, 2}, {1967, 39, 1}, {1967, 41, 3}, {1967, 42, 3}, {1967, 43, 4},
+    {1967, 45, 1}, {1967, 46, 2}, {1967, 48, 1}, {1967, 51, 1}, {1967, 55, 1}, {1967, 56, 2},
+    {1967, 62, 1}, {1968, 5, 1}, {1968, 7, 1}, {1968, 9, 2}, {1968, 10, 2}, {1968, 13, 3},
+    {1968, 32, 1}, {1968, 33, 1}, {1968, 34, 1}, {1968, 35, 1}, {1968, 39, 1}, {1968, 40, 2},
+    {1968, 41, 1}, {1968, 42, 2}, {1968, 43, 2}, {1968, 46, 1}, {1968, 47, 2}, {1968, 48, 1},
+    {1968, 49, 2}, {1968, 50, 2}, {1968, 51, 3}, {1968, 52, 2}, {1968, 53, 3}, {1968, 54, 3},
+    {1968, 56, 2}, {1968, 58, 1}, {1968, 59, 2}, {1968, 60, 3}, {1968, 62, 1}, {1968, 65, 2},
+    {1968, 66, 3}, {1968, 67, 1}, {1968, 70, 2}, {1968, 72, 1}, {1968, 74, 1}, {1968, 75, 2},
+    {1968, 76, 1}, {1968, 77, 2}, {1968, 78, 3}, {1968, 79, 2}, {1968, 80, 3}, {1968, 81, 3},
+    {1968, 82, 1}, {1968, 85, 1}, {1968, 86, 1}, {1968, 87, 2}, {1968, 88, 2}, {1968, 89, 3},
+    {1971, 3, 1}, {1971, 7, 1}, {1971, 9, 2}, {1971, 10, 3}, {1971, 13, 1}, {1971, 15, 2},
+    {1971, 16, 1}, {1971, 24, 1}, {1971, 27, 1}, {1971, 40, 2}, {1971, 46, 1}, {1971, 47, 1},
+    {1973, 1, 1}, {1973, 3, 1}, {1973, 4, 2}, {1973, 5, 3}, {1973, 32, 1}, {1974, 18, 1},
+    {1974, 19, 2}, {1987, 5, 1}, {1987, 6, 2}, {1987, 9, 1}, {1987, 10, 2}, {1987, 11, 3},
+    {1987, 12, 1}, {1987, 13, 3}, {1987, 15, 1}, {1987, 16, 2}, {2001, 8, 1}, {2048, 8, 1},
+    {2048, 9, 2}, {2048, 10, 1}, {2048, 12, 1}, {2048, 13, 1}, {2048, 15, 1}, {2048, 17, 1},
+    {2048, 18, 2}, {2048, 19, 2}, {2048, 20, 1}, {2048, 21, 3}, {2048, 22, 2}, {2048, 23, 2},
+    {2048, 24, 2}, {2048, 25, 2}, {2048, 26, 3}, {2048, 27, 3}, {2048, 28, 3}, {2048, 30, 3},
+    {2048, 35, 1}, {2048, 39, 1}, {2048, 41, 1}, {2048, 44, 1}, {2048, 45, 2}, {2048, 46, 1},
+    {2048, 47, 2}, {2048, 49, 1}, {2048, 50, 3}, {2048, 51, 2}, {2048, 53, 2}, {2048, 54, 3},
+    {2048, 55, 3}, {2048, 56, 1}, {2048, 57, 3}, {2055, 63, 1}, {2055, 72, 1}, {2055, 73, 2},
+    {2055, 80, 1}, {2055, 84, 1}, {2055, 86, 1}, {2055, 87, 2}, {2055, 92, 2}, {2055, 93, 1},
+    {2055, 100, 2}, {2055, 104, 1}, {2055, 106, 1}, {2055, 109, 1}, {2055, 110, 1}, {2055, 114, 1},
+    {2055, 131, 1}, {2055, 143, 1}, {2055, 149, 1}, {2056, 14, 1}, {2056, 15, 2}, {2058, 96, 1},
+    {2058, 97, 1}, {2058, 98, 2}, {2058, 104, 1}, {2058, 110, 2}, {2058, 111, 1}, {2058, 112, 1},
+    {2058, 114, 2}, {2058, 119, 1}, {2058, 125, 1}, {2058, 127, 1}, {2058, 133, 1}, {2058, 143, 1},
+    {2058, 155, 1}, {2058, 157, 2}, {2058, 170, 1}, {2059, 15, 1}, {2059, 16, 2}, {2065, 83, 1},
+    {2065, 84, 1}, {2065, 85, 2}, {2065, 87, 1}, {2065, 92, 1}, {2065, 96, 1}, {2065, 98, 2},
+    {2065, 99, 2}, {2065, 100, 2}, {2065, 102, 1}, {2065, 104, 1}, {2065, 107, 1}, {2065, 109, 1},
+    {2065, 110, 1}, {2065, 112, 1}, {2065, 115, 1}, {2066, 14, 1}, {2066, 15, 2}, {2067, 42, 1},
+    {2067, 46, 1}, {2067, 47, 2}, {2067, 53, 1}, {2067, 54, 2}, {2067, 57, 1}, {2067, 58, 2},
+    {2067, 59, 3}, {2067, 60, 1}, {2067, 61, 3}, {2067, 63, 1}, {2067, 64, 2}, {2071, 4, 1},
+    {2071, 5, 2}, {2071, 7, 3}, {2071, 10, 1}, {2071, 12, 1}, {2071, 13, 2}, {2071, 14, 3},
+    {2071, 16, 1}, {2071, 17, 1}, {2071, 18, 1}, {2071, 20, 1}, {2071, 21, 2}, {2071, 24, 2},
+    {2071, 26, 3}, {2091, 13, 1}, {2094, 5, 1}, {2094, 6, 2}, {2094, 9, 1}, {2094, 10, 2},
+    {2094, 11, 3}, {2094, 12, 1}, {2094, 13, 3}, {2094, 15, 1}, {2094, 16, 2}, {2094, 23, 1},
+    {2094, 27, 1}, {2094, 29, 1}, {2094, 33, 1}, {2094, 34, 1}, {2094, 45, 1}, {2094, 46, 2},
+    {2094, 47, 2}, {2094, 48, 1}, {2094, 49, 2}, {2094, 51, 3}, {2094, 52, 1}, {2095, 6, 1},
+    {2095, 10, 1}, {2095, 12, 1}, {2095, 15, 1}, {2095, 16, 2}, {2095, 17, 1}, {2095, 18, 2},
+    {2095, 20, 1}, {2095, 21, 3}, {2095, 22, 2}, {2095, 24, 2}, {2095, 25, 3}, {2095, 26, 3},
+    {2095, 27, 1}, {2095, 28, 3}, {2130, 5, 1}, {2130, 6, 2}, {2130, 9, 1}, {2130, 10, 2},
+    {2130, 11, 3}, {2130, 12, 1}, {2130, 13, 3}, {2130, 15, 1}, {2130, 16, 2}, {2131, 6, 3},
+    {2131, 10, 3}, {2131, 11, 1}, {2131, 12, 3}, {2131, 13, 1}, {2131, 14, 1}, {2131, 15, 2},
+    {2131, 16, 2}, {2131, 18, 4}, {2131, 20, 2}, {2131, 22, 1}, {2131, 23, 3}, {2133, 4, 1},
+    {2133, 6, 1}, {2133, 8, 2}, {2133, 9, 2}, {2133, 12, 3}, {2140, 1, 1}, {2140, 17, 1},
+    {2140, 19, 1}, {2140, 23, 1}, {2140, 28, 1}, {2140, 29, 1}, {2142, 1, 1}, {2142, 3, 1},
+    {2142, 4, 2}, {2142, 5, 3}, {2142, 11, 1}, {2142, 12, 2}, {2142, 15, 1}, {2142, 16, 2},
+    {2142, 17, 3}, {2142, 18, 1}, {2142, 19, 3}, {2142, 21, 1}, {2142, 22, 2}, {2142, 29, 1},
+    {2142, 33, 1}, {2142, 35, 1}, {2142, 39, 1}, {2142, 40, 1}, {2142, 51, 1}, {2142, 52, 2},
+    {2142, 53, 2}, {2142, 54, 1}, {2142, 55, 2}, {2142, 57, 3}, {2142, 58, 1}, {2167, 10, 1},
+    {2167, 15, 2}, {2167, 17, 1}, {2167, 23, 1}, {2167, 24, 1}, {2189, 12, 1}, {2189, 13, 1},
+    {2189, 14, 1}, {2189, 16, 2}, {2189, 18, 1}, {2189, 25, 1}, {2191, 5, 1}, {2191, 13, 1},
+    {2191, 14, 1}, {2191, 15, 1}, {2191, 16, 2}, {2191, 18, 1}, {2191, 19, 1}, {2191, 20, 2},
+    {2191, 23, 2}, {2191, 25, 2}, {2199, 10, 1}, {2199, 13, 1}, {2199, 14, 1}, {2199, 15, 1},
+    {2199, 16, 2}, {2199, 18, 1}, {2199, 19, 2}, {2199, 22, 2}, {2199, 25, 3}, {2199, 26, 2},
+    {2210, 1, 1}, {2210, 2, 2}, {2210, 3, 3}, {2210, 5, 1}, {2210, 6, 2}, {2210, 20, 1},
+    {2210, 21, 1}, {2210, 23, 2}, {2210, 26, 1}, {2210, 28, 1}, {2210, 29, 1}, {2210, 30, 3},
+    {2210, 31, 2}, {2210, 33, 1}, {2210, 34, 2}, {2210, 36, 1}, {2210, 48, 1}, {2210, 50, 1},
+    {2210, 51, 2}, {2210, 53, 1}, {2220, 3, 1}, {2220, 4, 1}, {2220, 5, 2}, {2220, 6, 1},
+    {2220, 7, 2}, {2220, 8, 3}, {2220, 11, 1}, {2233, 3, 1}, {2233, 17, 1}, {2233, 22, 2},
+    {2233, 24, 1}, {2233, 27, 1}, {2233, 38, 1}, {2233, 43, 2}, {2233, 44, 1}, {2233, 48, 1},
+    {2233, 50, 1}, {2233, 54, 1}, {2233, 66, 1}, {2233, 96, 1}, {2233, 98, 1}, {2233, 100, 1},
+    {2233, 102, 1}, {2233, 103, 1}, {2233, 104, 1}, {2233, 105, 1}, {2233, 106, 1}, {2235, 2, 1},
+    {2235, 5, 2}, {2235, 21, 1}, {2235, 22, 1}, {2235, 29, 1}, {2235, 30, 1}, {2237, 17, 1},
+    {2237, 18, 2}, {2237, 21, 1}, {2237, 22, 2}, {2237, 23, 3}, {2237, 24, 1}, {2237, 25, 3},
+    {2237, 27, 1}, {2237, 28, 2}, {2237, 35, 1}, {2237, 39, 1}, {2237, 41, 1}, {2237, 45, 1},
+    {2237, 46, 1}, {2237, 53, 1}, {2237, 57, 1}, {2237, 58, 2}, {2237, 59, 2}, {2237, 60, 2},
+    {2237, 62, 3}, {2237, 63, 1}, {2249, 2, 1}, {2249, 7, 1}, {2249, 14, 1}, {2249, 22, 1},
+    {2270, 6, 1}, {2270, 10, 1}, {2270, 12, 1}, {2270, 16, 1}, {2270, 17, 1}, {2270, 28, 1},
+    {2270, 29, 2}, {2270, 30, 2}, {2270, 31, 1}, {2270, 32, 2}, {2270, 34, 3}, {2270, 35, 1},
+    {2270, 39, 1}, {2270, 40, 2}, {2270, 43, 1}, {2270, 44, 2}, {2270, 45, 3}, {2270, 46, 1},
+    {2270, 47, 3}, {2270, 49, 1}, {2270, 50, 2}, {2274, 2, 1}, {2274, 3, 2}, {2292, 4, 1},
+    {2292, 5, 1}, {2292, 9, 1}, {2292, 11, 1}, {2292, 12, 2}, {2292, 14, 1}, {2292, 16, 1},
+    {2292, 18, 1}, {2292, 19, 2}, {2292, 21, 3}, {2292, 22, 2}, {2292, 24, 1}, {2292, 25, 1},
+    {2292, 26, 3}, {2292, 27, 2}, {2292, 28, 1}, {2292, 29, 3}, {2292, 30, 2}, {2292, 31, 1},
+    {2292, 32, 2}, {2292, 33, 3}, {2293, 5, 1}, {2293, 7, 1}, {2293, 10, 1}, {2293, 11, 2},
+    {2293, 14, 1}, {2293, 15, 1}, {2293, 16, 2}, {2293, 18, 2}, {2293, 20, 1}, {2293, 21, 2},
+    {2293, 23, 1}, {2293, 24, 2}, {2293, 25, 3}, {2293, 26, 1}, {2293, 27, 2}, {2293, 28, 3},
+    {2293, 29, 2}, {2302, 5, 1}, {2302, 6, 2}, {2302, 9, 1}, {2302, 10, 2}, {2302, 11, 3},
+    {2302, 12, 1}, {2302, 13, 3}, {2302, 15, 1}, {2302, 16, 2}, {2306, 5, 1}, {2306, 6, 2},
+    {2306, 9, 1}, {2306, 10, 2}, {2306, 11, 3}, {2306, 12, 1}, {2306, 13, 3}, {2306, 15, 1},
+    {2306, 16, 2}, {2306, 23, 1}, {2306, 27, 1}, {2306, 29, 1}, {2306, 33, 1}, {2306, 34, 1},
+    {2306, 45, 1}, {2306, 46, 2}, {2306, 47, 2}, {2306, 48, 1}, {2306, 49, 2}, {2306, 51, 3},
+    {2306, 52, 1}, {2306, 58, 1}, {2306, 62, 1}, {2306, 63, 2}, {2311, 6, 1}, {2311, 10, 1},
+    {2311, 12, 1}, {2311, 15, 1}, {2311, 16, 2}, {2311, 17, 1}, {2311, 18, 2}, {2311, 20, 1},
+    {2311, 21, 3}, {2311, 22, 2}, {2311, 24, 2}, {2311, 25, 3}, {2311, 26, 3}, {2311, 27, 1},
+    {2311, 28, 3}, {2323, 4, 1}, {2323, 5, 2}, {2323, 7, 3}, {2323, 10, 1}, {2323, 12, 1},
+    {2323, 13, 2}, {2323, 14, 3}, {2323, 16, 1}, {2323, 17, 1}, {2323, 18, 1}, {2323, 20, 1},
+    {2323, 21, 2}, {2323, 24, 2}, {2323, 26, 3}, {2323, 31, 1}, {2323, 32, 1}, {2323, 33, 2},
+    {2323, 36, 3}, {2323, 38, 1}, {2323, 40, 1}, {2323, 42, 1}, {2323, 43, 2}, {2323, 44, 1},
+    {2323, 45, 1}, {2323, 47, 2}, {2323, 48, 2}, {2323, 49, 3}, {2323, 50, 1}, {2323, 51, 2},
+    {2323, 55, 3}, {2323, 56, 2}, {2323, 57, 1}, {2323, 58, 3}, {2323, 59, 2}, {2327, 5, 1},
+    {2327, 7, 2}, {2327, 9, 1}, {2327, 10, 2}, {2327, 11, 3}, {2327, 12, 4}, {2327, 13, 1},
+    {2327, 14, 1}, {2327, 15, 3}, {2327, 17, 1}, {2327, 20, 1}, {2328, 1, 1}, {2333, 8, 1},
+    {2333, 10, 2}, {2336, 9, 1}, {2336, 11, 2}, {2336, 14, 1}, {2336, 15, 2}, {2336, 16, 1},
+    {2336, 17, 1}, {2336, 22, 1}, {2336, 23, 1}, {2336, 24, 1}, {2336, 25, 2}, {2336, 26, 3},
+    {2336, 27, 2}, {2336, 28, 3}, {2336, 31, 1}, {2336, 32, 2}, {2336, 33, 1}, {2336, 34, 3},
+    {2336, 35, 2}, {2336, 36, 3}, {2336, 38, 3}, {2340, 1, 1}, {2340, 3, 1}, {2340, 6, 2},
+    {2340, 22, 1}, {2340, 24, 1}, {2340, 26, 1}, {2340, 27, 1}, {2340, 29, 1}, {2342, 4, 1},
+    {2342, 12, 1}, {2342, 13, 1}, {2342, 14, 1}, {2342, 15, 2}, {2342, 25, 1}, {2342, 29, 1},
+    {2342, 31, 1}, {2342, 32, 1}, {2342, 33, 2}, {2343, 11, 1}, {2345, 4, 1}, {2345, 6, 1},
+    {2345, 7, 1}, {2345, 9, 2}, {2345, 11, 1}, {2345, 25, 1}, {2345, 26, 1}, {2345, 40, 1},
+    {2346, 8, 1}, {2347, 1, 1}, {2347, 4, 2}, {2347, 10, 1}, {2347, 11, 1}, {2347, 13, 1},
+    {2347, 17, 1}, {2347, 20, 1}, {2347, 21, 2}, {2347, 22, 1}, {2347, 23, 1}, {2348, 6, 1},
+    {2348, 10, 1}, {2348, 11, 2}, {2349, 6, 1}, {2349, 7, 1}, {2349, 8, 2}, {2349, 11, 3},
+    {2349, 13, 1}, {2349, 15, 1}, {2349, 17, 1}, {2349, 18, 2}, {2349, 19, 1}, {2349, 20, 1},
+    {2349, 22, 2}, {2349, 23, 2}, {2349, 24, 3}, {2349, 25, 1}, {2349, 26, 2}, {2349, 30, 3},
+    {2349, 31, 2}, {2349, 32, 1}, {2349, 33, 3}, {2349, 34, 2}, {2362, 5, 1}, {2362, 6, 2},
+    {2362, 9, 1}, {2362, 10, 2}, {2362, 11, 3}, {2362, 12, 1}, {2362, 13, 3}, {2362, 15, 1},
+    {2362, 16, 2}, {2362, 23, 1}, {2362, 27, 1}, {2362, 29, 1}, {2362, 33, 1}, {2362, 34, 1},
+    {2362, 45, 1}, {2362, 46, 2}, {2362, 47, 2}, {2362, 48, 1}, {2362, 49, 2}, {2362, 51, 3},
+    {2362, 52, 1}, {2367, 5, 1}, {2367, 6, 2}, {2367, 9, 1}, {2367, 10, 2}, {2367, 11, 3},
+    {2367, 12, 1}, {2367, 13, 3}, {2367, 15, 1}, {2367, 16, 2}, {2367, 23, 1}, {2367, 27, 1},
+    {2367, 29, 1}, {2367, 33, 1}, {2367, 34, 1}, {2367, 45, 1}, {2367, 46, 2}, {2367, 47, 2},
+    {2367, 48, 1}, {2367, 49, 2}, {2367, 51, 3}, {2367, 52, 1}, {2367, 59, 1}, {2367, 60, 2},
+    {2367, 61, 1}, {2367, 62, 2}, {2367, 63, 1}, {2367, 64, 2}, {2367, 65, 1}, {2367, 66, 2},
+    {2367, 67, 1}, {2367, 68, 2}, {2367, 69, 1}, {2367, 70, 2}, {2367, 71, 1}, {2367, 72, 2},
+    {2428, 10, 1}, {2431, 5, 1}, {2431, 6, 1}, {2431, 8, 2}, {2431, 14, 1}, {2431, 15, 1},
+    {2431, 17, 2}, {2431, 20, 1}, {2431, 21, 1}, {2431, 22, 3}, {2431, 23, 3}, {2431, 24, 2},
+    {2431, 25, 1}, {2431, 26, 2}, {2431, 28, 1}, {2431, 29, 1}, {2431, 33, 2}, {2432, 5, 1},
+    {2432, 6, 2}, {2432, 9, 1}, {2432, 10, 2}, {2432, 11, 3}, {2432, 12, 2}, {2432, 13, 3},
+    {2432, 15, 1}, {2432, 16, 2}, {2432, 23, 1}, {2432, 27, 1}, {2432, 29, 1}, {2432, 33, 1},
+    {2432, 34, 1}, {2432, 45, 1}, {2432, 46, 2}, {2432, 47, 2}, {2432, 48, 1}, {2432, 49, 2},
+    {2432, 51, 3}, {2432, 52, 1}, {2432, 57, 2}, {2432, 61, 1}, {2432, 62, 1}, {2432, 63, 3},
+    {2432, 64, 1}, {2432, 65, 1}, {2432, 66, 2}, {2432, 67, 2}, {2432, 69, 2}, {2432, 71, 2},
+    {2432, 73, 1}, {2432, 74, 3}, {2483, 5, 1}, {2483, 6, 1}, {2483, 7, 2}, {2483, 10, 1},
+    {2483, 17, 1}, {2483, 18, 1}, {2483, 19, 2}, {2483, 22, 3}, {2483, 23, 2}, {2483, 24, 1},
+    {2483, 25, 1}, {2484, 11, 1}, {2484, 14, 1}, {2484, 15, 2}, {2484, 17, 1}, {2484, 18, 1},
+    {2484, 20, 1}, {2484, 22, 2}, {2484, 24, 2}, {2484, 27, 2}, {2484, 28, 1}, {2484, 29, 3},
+    {2485, 4, 1}, {2485, 5, 1}, {2485, 7, 1}, {2485, 10, 2}, {2485, 15, 1}, {2485, 17, 1},
+    {2485, 20, 3}, {2485, 22, 2}, {2485, 23, 2}, {2485, 25, 1}, {2485, 26, 2}, {2486, 9, 1},
+    {2486, 12, 1}, {2486, 13, 2}, {2486, 15, 1}, {2486, 16, 1}, {2486, 21, 2}, {2486, 24, 1},
+    {2486, 25, 2}, {2486, 26, 3}, {2486, 27, 1}, {2486, 30, 2}, {2487, 9, 1}, {2487, 12, 1},
+    {2487, 13, 2}, {2487, 15, 1}, {2487, 18, 1}, {2487, 19, 1}, {2487, 20, 2}, {2487, 23, 2},
+    {2487, 24, 1}, {2487, 26, 1}, {2487, 27, 2}, {2501, 31, 1}, {2501, 33, 1}, {2501, 34, 1},
+    {2508, 10, 1}, {2508, 11, 1}, {2508, 12, 2}, {2508, 17, 1}, {2508, 19, 1}, {2508, 20, 2},
+    {2508, 25, 1}, {2508, 26, 2}, {2508, 29, 2}, {2508, 39, 1}, {2508, 40, 1}, {2508, 42, 1},
+    {2508, 44, 1}, {2508, 47, 1}, {2508, 60, 1}, {2509, 5, 1}, {2509, 6, 2}, {2512, 5, 1},
+    {2512, 6, 2}, {2512, 9, 1}, {2512, 10, 2}, {2512, 11, 3}, {2512, 12, 1}, {2512, 13, 3},
+    {2512, 15, 1}, {2512, 16, 2}, {2512, 24, 1}, {2512, 28, 1}, {2512, 30, 1}, {2512, 34, 1},
+    {2512, 35, 1}, {2512, 46, 1}, {2512, 47, 2}, {2512, 48, 2}, {2512, 49, 1}, {2512, 50, 2},
+    {2512, 52, 3}, {2512, 53, 1}, {2512, 56, 1}, {2512, 57, 2}, {2512, 58, 3}, {2512, 71, 1},
+    {2512, 72, 2}, {2512, 76, 1}, {2512, 77, 2}, {2512, 78, 1}, {2512, 79, 2}, {2512, 81, 3},
+    {2512, 82, 1}, {2512, 83, 2}, {2512, 84, 3}, {2512, 85, 1}, {2512, 87, 1}, {2512, 88, 2},
+    {2512, 89, 1}, {2512, 91, 2}, {2512, 92, 1}, {2512, 93, 2}, {2512, 94, 3}, {2512, 108, 1},
+    {2512, 131, 1}, {2512, 132, 2}, {2512, 133, 3}, {2513, 9, 1}, {2513, 10, 1}, {2513, 11, 1},
+    {2513, 12, 1}, {2513, 16, 1}, {2513, 17, 2}, {2513, 18, 1}, {2513, 19, 2}, {2513, 20, 2},
+    {2513, 23, 1}, {2513, 24, 2}, {2513, 25, 1}, {2513, 26, 2}, {2513, 27, 2}, {2513, 28, 3},
+    {2513, 29, 2}, {2513, 30, 3}, {2513, 31, 3}, {2513, 33, 2}, {2513, 35, 1}, {2513, 36, 2},
+    {2513, 37, 3}, {2513, 44, 1}, {2513, 45, 2}, {2513, 46, 1}, {2513, 49, 2}, {2513, 50, 1},
+    {2513, 51, 1}, {2513, 52, 3}, {2513, 53, 3}, {2513, 54, 2}, {2513, 55, 1}, {2530, 5, 12},
+    {2530, 6, 2}, {2530, 7, 13}, {2530, 9, 4}, {2530, 11, 9}, {2530, 13, 12}, {2530, 14, 4},
+    {2530, 20, 7}, {2530, 25, 1}, {2530, 26, 5}, {2530, 27, 6}, {2530, 28, 3}, {2530, 30, 5},
+    {2530, 33, 1}, {2530, 34, 3}, {2530, 55, 6}, {2530, 56, 7}, {2530, 62, 2}, {2530, 63, 1},
+    {2530, 64, 3}, {2530, 65, 4}, {2530, 72, 1}, {2530, 73, 1}, {2530, 87, 5}, {2530, 88, 14},
+    {2530, 99, 6}, {2530, 101, 1}, {2530, 102, 1}, {2530, 104, 4}, {2530, 107, 1}, {2530, 109, 6},
+    {2530, 111, 12}, {2530, 112, 14}, {2530, 114, 15}, {2530, 119, 13}, {2530, 120, 7},
+    {2530, 121, 13}, {2530, 122, 14}, {2530, 124, 14}, {2530, 125, 15}, {2531, 2, 4}, {2553, 12, 1},
+    {2553, 13, 2}, {2553, 16, 1}, {2553, 17, 2}, {2553, 18, 3}, {2553, 19, 1}, {2553, 20, 3},
+    {2553, 22, 1}, {2553, 23, 2}, {2596, 28, 1}, {2596, 32, 1}, {2596, 34, 1}, {2596, 38, 1},
+    {2596, 39, 1}, {2596, 50, 1}, {2596, 51, 2}, {2596, 52, 2}, {2596, 53, 1}, {2596, 54, 2},
+    {2596, 56, 3}, {2596, 57, 1}, {2596, 60, 1}, {2596, 61, 1}, {2596, 65, 1}, {2596, 67, 1},
+    {2596, 68, 2}, {2596, 70, 1}, {2596, 72, 1}, {2596, 74, 1}, {2596, 75, 2}, {2596, 77, 3},
+    {2596, 78, 2}, {2596, 80, 1}, {2596, 81, 1}, {2596, 82, 3}, {2596, 83, 2}, {2596, 84, 1},
+    {2596, 85, 3}, {2596, 86, 2}, {2596, 87, 1}, {2596, 88, 2}, {2596, 89, 3}, {2596, 114, 1},
+    {2596, 118, 1}, {2596, 119, 2}, {2597, 1, 1}, {2597, 4, 2}, {2597, 5, 3}, {2597, 6, 1},
+    {2597, 9, 2}, {2597, 11, 1}, {2597, 13, 1}, {2597, 14, 2}, {2597, 15, 1}, {2597, 16, 2},
+    {2597, 17, 3}, {2597, 18, 2}, {2597, 19, 3}, {2597, 20, 3}, {2597, 21, 1}, {2597, 24, 1},
+    {2597, 25, 1}, {2597, 26, 2}, {2597, 27, 2}, {2597, 28, 3}, {2597, 34, 1}, {2597, 36, 1},
+    {2597, 38, 2}, {2597, 39, 2}, {2597, 42, 3}, {2597, 57, 1}, {2597, 58, 2}, {2597, 60, 3},
+    {2597, 63, 1}, {2597, 65, 1}, {2597, 66, 2}, {2597, 67, 3}, {2597, 69, 1}, {2597, 70, 2},
+    {2597, 71, 1}, {2597, 73, 1}, {2597, 74, 2}, {2597, 77, 2}, {2597, 79, 3}, {2597, 82, 1},
+    {2597, 84, 1}, {2597, 85, 1}, {2597, 89, 2}, {2597, 91, 1}, {2597, 96, 2}, {2597, 99, 3},
+    {2597, 100, 1}, {2597, 101, 1}, {2597, 105, 1}, {2599, 4, 1}, {2599, 8, 1}, {2599, 13, 1},
+    {2599, 17, 2}, {2599, 19, 1}, {2599, 20, 1}, {2599, 22, 1}, {2599, 23, 1}, {2599, 24, 2},
+    {2599, 27, 2}, {2599, 29, 3}, {2599, 30, 2}, {2601, 5, 1}, {2601, 6, 2}, {2601, 9, 1},
+    {2601, 10, 2}, {2601, 11, 3}, {2601, 12, 1}, {2601, 13, 3}, {2601, 15, 1}, {2601, 16, 2},
+    {2601, 27, 1}, {2601, 31, 1}, {2601, 33, 1}, {2601, 37, 1}, {2601, 38, 1}, {2601, 49, 1},
+    {2601, 50, 2}, {2601, 51, 2}, {2601, 52, 1}, {2601, 53, 2}, {2601, 55, 3}, {2601, 56, 1},
+    {2605, 4, 1}, {2605, 5, 2}, {2605, 6, 3}, {2605, 20, 4}, {2605, 24, 1}, {2605, 29, 6},
+    {2605, 30, 2}, {2605, 33, 1}, {2605, 34, 3}, {2605, 56, 10}, {2605, 62, 2}, {2605, 63, 1},
+    {2605, 64, 3}, {2605, 65, 4}, {2605, 72, 1}, {2605, 73, 1}, {2605, 86, 3}, {2605, 87, 8},
+    {2605, 98, 4}, {2605, 104, 1}, {2605, 106, 9}, {2605, 110, 1}, {2605, 113, 4}, {2605, 115, 9},
+    {2605, 116, 11}, {2605, 118, 9}, {2605, 119, 11}, {2605, 120, 10}, {2605, 121, 12},
+    {2605, 122, 11}, {2606, 2, 4}, {2615, 5, 1}, {2616, 11, 1}, {2616, 14, 2}, {2616, 15, 3},
+    {2616, 16, 1}, {2616, 21, 1}, {2616, 22, 2}, {2616, 24, 1}, {2616, 25, 4}, {2616, 26, 3},
+    {2616, 29, 1}, {2616, 31, 2}, {2616, 32, 3}, {2616, 41, 1}, {2616, 42, 1}, {2616, 45, 1},
+    {2616, 46, 1}, {2616, 47, 2}, {2616, 48, 1}, {2616, 53, 2}, {2616, 54, 3}, {2616, 56, 1},
+    {2617, 8, 1}, {2617, 12, 2}, {2617, 19, 3}, {2617, 37, 1}, {2617, 38, 2}, {2617, 39, 3},
+    {2617, 40, 1}, {2617, 42, 1}, {2617, 43, 1}, {2617, 44, 2}, {2617, 47, 1}, {2617, 49, 1},
+    {2617, 50, 2}, {2617, 51, 4}, {2617, 53, 2}, {2617, 55, 1}, {2617, 57, 2}, {2617, 58, 3},
+    {2617, 59, 3}, {2619, 1, 1}, {2619, 3, 2}, {2619, 25, 1}, {2619, 26, 2}, {2619, 29, 1},
+    {2619, 37, 1}, {2619, 44, 1}, {2619, 45, 2}, {2619, 46, 3}, {2619, 48, 3}, {2619, 50, 1},
+    {2619, 51, 1}, {2619, 53, 1}, {2619, 55, 1}, {2619, 57, 2}, {2619, 58, 3}, {2619, 59, 2},
+    {2619, 63, 1}, {2619, 64, 1}, {2619, 65, 1}, {2619, 68, 4}, {2620, 4, 1}, {2620, 10, 1},
+    {2620, 11, 2}, {2620, 15, 1}, {2620, 16, 3}, {2620, 23, 2}, {2620, 24, 3}, {2620, 26, 1},
+    {2620, 27, 2}, {2620, 28, 1}, {2620, 33, 2}, {2620, 34, 1}, {2620, 36, 1}, {2620, 38, 1},
+    {2620, 39, 4}, {2620, 41, 1}, {2620, 44, 1}, {2620, 46, 2}, {2620, 47, 3}, {2621, 15, 1},
+    {2621, 16, 2}, {2621, 19, 1}, {2621, 20, 2}, {2621, 21, 3}, {2621, 22, 1}, {2621, 23, 3},
+    {2621, 25, 1}, {2621, 26, 2}, {2621, 33, 1}, {2621, 37, 1}, {2621, 39, 1}, {2621, 43, 1},
+    {2621, 44, 1}, {2621, 55, 1}, {2621, 56, 2}, {2621, 57, 2}, {2621, 58, 1}, {2621, 59, 2},
+    {2621, 61, 3}, {2621, 62, 1}, {2621, 71, 1}, {2621, 76, 1}, {2621, 80, 1}, {2621, 81, 2},
+    {2621, 82, 3}, {2621, 108, 1}, {2621, 113, 1}, {2624, 69, 1}, {2627, 4, 1}, {2627, 5, 2},
+    {2627, 6, 3}, {2628, 24, 1}, {2628, 29, 1}, {2628, 38, 1}, {2628, 42, 1}, {2632, 5, 1},
+    {2632, 13, 1}, {2632, 17, 1}, {2632, 19, 2}, {2632, 20, 1}, {2632, 22, 1}, {2632, 23, 1},
+    {2632, 24, 1}, {2632, 27, 1}, {2632, 31, 1}, {2632, 32, 1}, {2632, 34, 1}, {2632, 38, 1},
+    {2632, 49, 1}, {2632, 50, 1}, {2632, 54, 1}, {2632, 56, 1}, {2632, 59, 2}, {2632, 61, 1},
+    {2632, 62, 1}, {2632, 67, 1}, {2633, 4, 1}, {2633, 12, 1}, {2633, 15, 1}, {2633, 16, 1},
+    {2633, 17, 1}, {2633, 23, 1}, {2633, 24, 1}, {2633, 28, 1}, {2633, 31, 1}, {2633, 33, 1},
+    {2633, 35, 1}, {2633, 37, 2}, {2633, 39, 1}, {2633, 48, 1}, {2633, 49, 1}, {2633, 52, 2},
+    {2633, 53, 1}, {2633, 56, 1}, {2633, 61, 1}, {2637, 6, 1}, {2637, 13, 1}, {2637, 14, 1},
+    {2637, 17, 1}, {2637, 18, 1}, {2637, 23, 1}, {2637, 25, 2}, {2637, 26, 1}, {2637, 28, 1},
+    {2637, 33, 1}, {2637, 36, 1}, {2637, 50, 1}, {2637, 51, 1}, {2637, 62, 1}, {2638, 32, 1},
+    {2638, 37, 1}, {2639, 5, 1}, {2639, 6, 2}, {2639, 9, 1}, {2639, 10, 2}, {2639, 11, 3},
+    {2639, 12, 1}, {2639, 13, 3}, {2639, 15, 1}, {2639, 16, 2}, {2639, 32, 1}, {2639, 35, 1},
+    {2639, 36, 2}, {2639, 39, 1}, {2639, 40, 2}, {2639, 41, 3}, {2639, 45, 1}, {2639, 47, 2},
+    {2639, 48, 3}, {2639, 50, 1}, {2639, 51, 2}, {2639, 52, 3}, {2639, 55, 1}, {2639, 56, 1},
+    {2639, 57, 2}, {2639, 58, 3}, {2639, 62, 1}, {2639, 66, 1}, {2639, 68, 1}, {2639, 72, 1},
+    {2639, 73, 1}, {2639, 84, 1}, {2639, 85, 2}, {2639, 86, 2}, {2639, 87, 1}, {2639, 88, 2},
+    {2639, 90, 3}, {2639, 91, 1}, {2639, 96, 1}, {2639, 97, 1}, {2639, 98, 2}, {2639, 99, 1},
+    {2639, 100, 3}, {2639, 101, 2}, {2639, 102, 2}, {2639, 103, 1}, {2639, 104, 2}, {2639, 105, 1},
+    {2639, 106, 2}, {2639, 107, 1}, {2639, 108, 2}, {2639, 109, 3}, {2639, 110, 2}, {2639, 111, 3},
+    {2639, 112, 3}, {2639, 126, 1}, {2639, 127, 2}, {2639, 128, 3}, {2640, 6, 1}, {2640, 11, 1},
+    {2640, 12, 1}, {2640, 16, 1}, {2640, 23, 1}, {2640, 24, 1}, {2640, 26, 1}, {2640, 31, 1},
+    {2640, 33, 1}, {2640, 35, 2}, {2640, 36, 1}, {2640, 37, 1}, {2640, 39, 1}, {2640, 54, 1},
+    {2640, 55, 1}, {2640, 56, 2}, {2640, 57, 1}, {2640, 64, 1}, {2644, 18, 1}, {2644, 27, 1},
+    {2647, 14, 1}, {2647, 22, 1}, {2650, 15, 1}, {2650, 21, 1}, {2653, 3, 1}, {2653, 10, 1},
+    {2653, 13, 1}, {2653, 14, 2}, {2653, 20, 1}, {2653, 21, 1}, {2653, 26, 1}, {2653, 30, 1},
+    {2653, 32, 1}, {2653, 36, 1}, {2653, 37, 1}, {2653, 48, 1}, {2653, 49, 2}, {2653, 50, 2},
+    {2653, 51, 1}, {2653, 52, 2}, {2653, 54, 3}, {2653, 55, 1}, {2653, 57, 1}, {2653, 63, 1},
+    {2653, 64, 1}, {2653, 68, 1}, {2653, 72, 1}, {2653, 73, 1}, {2653, 74, 2}, {2653, 75, 1},
+    {2653, 76, 3}, {2653, 77, 2}, {2653, 78, 2}, {2653, 79, 1}, {2653, 80, 2}, {2653, 81, 1},
+    {2653, 82, 2}, {2653, 83, 1}, {2653, 84, 2}, {2653, 85, 3}, {2653, 86, 2}, {2653, 87, 3},
+    {2653, 88, 3}, {2653, 89, 1}, {2653, 90, 2}, {2653, 91, 3}, {2654, 5, 1}, {2654, 7, 1},
+    {2654, 10, 1}, {2654, 11, 2}, {2654, 14, 1}, {2654, 15, 1}, {2654, 16, 2}, {2654, 18, 2},
+    {2654, 20, 1}, {2654, 21, 2}, {2654, 23, 1}, {2654, 24, 2}, {2654, 25, 3}, {2654, 26, 1},
+    {2654, 27, 2}, {2654, 28, 3}, {2654, 29, 2}, {2657, 64, 1}, {2657, 65, 2}, {2657, 66, 1},
+    {2657, 69, 2}, {2657, 70, 1}, {2657, 71, 1}, {2657, 72, 3}, {2657, 73, 3}, {2657, 74, 2},
+    {2657, 75, 1}, {2658, 6, 1}, {2658, 10, 1}, {2658, 12, 1}, {2658, 14, 1}, {2658, 18, 1},
+    {2658, 19, 1}, {2658, 30, 1}, {2658, 31, 2}, {2658, 32, 1}, {2660, 5, 1}, {2660, 6, 2},
+    {2660, 9, 1}, {2660, 10, 2}, {2660, 11, 3}, {2660, 12, 1}, {2660, 13, 3}, {2660, 15, 1},
+    {2660, 16, 2}, {2660, 23, 1}, {2660, 27, 1}, {2660, 29, 1}, {2660, 33, 1}, {2660, 34, 1},
+    {2660, 45, 1}, {2660, 46, 2}, {2660, 47, 2}, {2660, 48, 1}, {2660, 49, 2}, {2660, 51, 3},
+    {2660, 52, 1}, {2661, 5, 1}, {2661, 7, 1}, {2661, 10, 1}, {2661, 11, 2}, {2661, 14, 1},
+    {2661, 15, 1}, {2661, 16, 2}, {2661, 18, 2}, {2661, 20, 1}, {2661, 21, 2}, {2661, 23, 1},
+    {2661, 24, 2}, {2661, 25, 3}, {2661, 26, 1}, {2661, 27, 2}, {2661, 28, 3}, {2661, 29, 2},
+    {2677, 6, 1}, {2677, 7, 1}, {2677, 8, 2}, {2677, 11, 3}, {2677, 13, 1}, {2677, 15, 1},
+    {2677, 17, 1}, {2677, 18, 2}, {2677, 19, 1}, {2677, 20, 1}, {2677, 22, 2}, {2677, 23, 2},
+    {2677, 24, 3}, {2677, 25, 1}, {2677, 26, 2}, {2677, 30, 3}, {2677, 31, 2}, {2677, 32, 1},
+    {2677, 33, 3}, {2677, 34, 2}, {2682, 3, 1}, {2682, 4, 2}, {2682, 6, 1}, {2682, 7, 2},
+    {2682, 8, 3}, {2682, 9, 3}, {2682, 14, 1}, {2682, 17, 1}, {2682, 21, 1}, {2682, 22, 2},
+    {2682, 23, 1}, {2682, 24, 2}, {2682, 26, 3}, {2682, 27, 1}, {2682, 28, 2}, {2682, 60, 1},
+    {2682, 61, 1}, {2682, 62, 2}, {2682, 64, 2}, {2682, 65, 2}, {2682, 66, 1}, {2682, 67, 3},
+    {2682, 69, 3}, {2682, 70, 1}, {2682, 71, 2}, {2682, 74, 1}, {2682, 75, 1}, {2682, 76, 2},
+    {2682, 77, 2}, {2682, 78, 3}, {2698, 13, 1}, {2698, 18, 1}, {2698, 23, 1}, {2698, 25, 2},
+    {2698, 27, 1}, {2708, 7, 1}, {2708, 10, 1}, {2708, 11, 2}, {2708, 13, 1}, {2708, 15, 1},
+    {2708, 16, 1}, {2708, 17, 2}, {2708, 20, 1}, {2708, 21, 2}, {2708, 25, 2}, {2712, 4, 1},
+    {2746, 32, 1}, {2746, 34, 1}, {2746, 37, 1}, {2746, 38, 2}, {2746, 41, 1}, {2746, 42, 1},
+    {2746, 43, 2}, {2746, 45, 2}, {2746, 47, 1}, {2746, 48, 2}, {2746, 50, 1}, {2746, 51, 2},
+    {2746, 52, 3}, {2746, 53, 1}, {2746, 54, 2}, {2746, 55, 3}, {2746, 56, 2}, {2762, 5, 1},
+    {2762, 6, 2}, {2762, 9, 1}, {2762, 10, 2}, {2762, 11, 3}, {2762, 12, 1}, {2762, 13, 3},
+    {2762, 15, 1}, {2762, 16, 2}, {2762, 23, 1}, {2762, 27, 1}, {2762, 29, 1}, {2762, 33, 1},
+    {2762, 34, 1}, {2762, 45, 1}, {2762, 46, 2}, {2762, 47, 2}, {2762, 48, 1}, {2762, 49, 2},
+    {2762, 51, 3}, {2762, 52, 1}, {2762, 59, 1}, {2762, 65, 1}, {2762, 66, 1}, {2762, 69, 1},
+    {2762, 71, 2}, {2762, 72, 2}, {2762, 73, 1}, {2762, 75, 1}, {2762, 76, 2}, {2762, 77, 2},
+    {2762, 78, 2}, {2762, 79, 1}, {2762, 80, 1}, {2762, 81, 2}, {2762, 82, 1}, {2762, 83, 2},
+    {2762, 84, 3}, {2762, 85, 2}, {2762, 86, 3}, {2762, 87, 3}, {2762, 89, 2}, {2762, 90, 3},
+    {2762, 91, 3}, {2763, 1, 1}, {2763, 4, 2}, {2763, 5, 3}, {2763, 6, 1}, {2763, 9, 2},
+    {2763, 11, 1}, {2763, 13, 1}, {2763, 14, 2}, {2763, 15, 1}, {2763, 16, 2}, {2763, 17, 3},
+    {2763, 18, 2}, {2763, 19, 3}, {2763, 20, 3}, {2763, 21, 1}, {2763, 24, 1}, {2763, 25, 1},
+    {2763, 26, 2}, {2763, 27, 2}, {2763, 28, 3}, {2763, 35, 1}, {2763, 37, 1}, {2763, 40, 1},
+    {2763, 41, 2}, {2763, 44, 1}, {2763, 45, 1}, {2763, 46, 2}, {2763, 48, 2}, {2763, 50, 1},
+    {2763, 51, 2}, {2763, 53, 1}, {2763, 54, 2}, {2763, 55, 3}, {2763, 56, 1}, {2763, 57, 2},
+    {2763, 58, 3}, {2763, 59, 2}, {2768, 10, 1}, {2768, 12, 1}, {2768, 17, 1}, {2768, 38, 1},
+    {2768, 39, 1}, {2814, 5, 1}, {2814, 7, 1}, {2814, 24, 1}, {2814, 27, 1}, {2814, 34, 1},
+    {2814, 42, 2}, {2814, 47, 1}, {2814, 48, 2}, {2814, 56, 1}, {2814, 58, 1}, {2814, 59, 1},
+    {2814, 60, 1}, {2814, 61, 1}, {2814, 68, 2}, {2814, 69, 1}, {2844, 10, 1}, {2846, 1, 1},
+    {2846, 6, 1}, {2846, 7, 1}, {2846, 10, 1}, {2846, 16, 1}, {2846, 17, 1}, {2846, 18, 1},
+    {2846, 19, 2}, {2846, 20, 2}, {2846, 23, 1}, {2846, 28, 1}, {2846, 29, 1}, {2846, 33, 1},
+    {2855, 14, 1}, {2855, 17, 1}, {2856, 13, 1}, {2856, 14, 2}, {2856, 25, 1}, {2856, 27, 2},
+    {2856, 28, 3}, {2856, 31, 1}, {2856, 32, 2}, {2856, 36, 1}, {2856, 37, 1}, {2856, 43, 1},
+    {2856, 45, 2}, {2856, 47, 1}, {2856, 48, 1}, {2856, 49, 2}, {2867, 2, 1}, {2869, 5, 1},
+    {2869, 6, 2}, {2869, 9, 1}, {2869, 10, 2}, {2869, 11, 3}, {2869, 12, 1}, {2869, 13, 3},
+    {2869, 15, 1}, {2869, 16, 2}, {2869, 23, 1}, {2869, 27, 1}, {2869, 29, 1}, {2869, 33, 1},
+    {2869, 34, 1}, {2869, 45, 1}, {2869, 46, 2}, {2869, 47, 2}, {2869, 48, 1}, {2869, 49, 2},
+    {2869, 51, 3}, {2869, 52, 1}, {2881, 2, 1}, {2881, 5, 1}, {2881, 9, 1}, {2881, 13, 1},
+    {2881, 14, 2}, {2881, 29, 1}, {2881, 34, 1}, {2881, 38, 1}, {2881, 43, 1}, {2881, 58, 1},
+    {2881, 59, 1}, {2881, 60, 1}, {2881, 61, 1}, {2884, 8, 1}, {2884, 9, 1}, {2884, 12, 1},
+    {2884, 14, 2}, {2884, 15, 2}, {2884, 16, 1}, {2884, 18, 1}, {2884, 19, 2}, {2884, 21, 2},
+    {2884, 22, 1}, {2884, 23, 2}, {2884, 24, 1}, {2884, 25, 2}, {2884, 26, 3}, {2884, 27, 1},
+    {2884, 28, 2}, {2884, 29, 3}, {2884, 30, 2}, {2884, 31, 3}, {2884, 32, 3}, {2884, 54, 1},
+    {2884, 69, 1}, {2884, 81, 1}, {2884, 124, 1}, {2884, 129, 1}, {2884, 141, 1}, {2884, 142, 2},
+    {2884, 143, 3}, {2889, 13, 1}, {2889, 15, 1}, {2889, 17, 1}, {2889, 18, 2}, {2889, 19, 1},
+    {2889, 23, 1}, {2889, 26, 1}, {2889, 27, 1}, {2892, 10, 1}, {2892, 12, 1}, {2892, 17, 1},
+    {2892, 25, 1}, {2892, 26, 2}, {2892, 27, 3}, {2892, 30, 1}, {2892, 31, 1}, {2892, 32, 1},
+    {2892, 33, 2}, {2892, 34, 2}, {2892, 35, 3}, {2892, 36, 2}, {2892, 40, 1}, {2892, 42, 1},
+    {2892, 43, 1}, {2892, 44, 1}, {2892, 45, 2}, {2892, 46, 2}, {2892, 47, 3}, {2892, 49, 1},
+    {2901, 13, 1}, {2901, 18, 1}, {2905, 13, 1}, {2905, 15, 1}, {2905, 17, 1}, {2905, 18, 2},
+    {2905, 19, 1}, {2905, 23, 1}, {2905, 26, 1}, {2905, 27, 1}, {2909, 9, 1}, {2909, 10, 1},
+    {2909, 11, 1}, {2909, 12, 1}, {2909, 16, 1}, {2909, 17, 2}, {2909, 18, 1}, {2909, 19, 2},
+    {2909, 20, 2}, {2909, 23, 1}, {2909, 24, 2}, {2909, 25, 1}, {2909, 26, 2}, {2909, 27, 2},
+    {2909, 28, 3}, {2909, 29, 2}, {2909, 30, 3}, {2909, 31, 3}, {2909, 33, 2}, {2909, 35, 1},
+    {2909, 36, 2}, {2909, 37, 3}, {2909, 40, 1}, {2909, 41, 2}, {2909, 43, 3}, {2909, 46, 1},
+    {2909, 48, 1}, {2909, 49, 2}, {2909, 50, 3}, {2909, 52, 1}, {2909, 53, 1}, {2909, 54, 1},
+    {2909, 56, 1}, {2909, 57, 2}, {2909, 60, 2}, {2909, 62, 3}, {2912, 14, 1}, {2944, 40, 1},
+    {2953, 5, 1}, {2953, 6, 2}, {2953, 9, 1}, {2953, 10, 2}, {2953, 11, 3}, {2953, 12, 1},
+    {2953, 13, 3}, {2953, 15, 1}, {2953, 16, 2}, {2953, 23, 1}, {2953, 27, 1}, {2953, 29, 1},
+    {2953, 33, 1}, {2953, 34, 1}, {2953, 45, 1}, {2953, 46, 2}, {2953, 47, 2}, {2953, 48, 1},
+    {2953, 49, 2}, {2953, 51, 3}, {2953, 52, 1}, {2953, 61, 1}, {2953, 67, 1}, {2953, 68, 1},
+    {2953, 71, 1}, {2953, 73, 2}, {2953, 74, 2}, {2953, 75, 1}, {2953, 77, 1}, {2953, 78, 2},
+    {2953, 79, 2}, {2953, 80, 2}, {2953, 81, 1}, {2953, 82, 1}, {2953, 83, 2}, {2953, 84, 1},
+    {2953, 85, 2}, {2953, 86, 3}, {2953, 87, 2}, {2953, 88, 3}, {2953, 89, 3}, {2953, 91, 2},
+    {2953, 92, 3}, {2953, 93, 3}, {2960, 4, 1}, {2960, 5, 2}, {2960, 7, 3}, {2960, 10, 1},
+    {2960, 12, 1}, {2960, 13, 2}, {2960, 14, 3}, {2960, 16, 1}, {2960, 17, 1}, {2960, 18, 1},
+    {2960, 20, 1}, {2960, 21, 2}, {2960, 24, 2}, {2960, 26, 3}, {2961, 34, 1}, {2961, 36, 1},
+    {2961, 41, 1}, {2961, 58, 1}, {2961, 59, 1}, {2967, 6, 1}, {2967, 10, 1}, {2967, 12, 1},
+    {2967, 16, 1}, {2967, 17, 1}, {2967, 28, 1}, {2967, 29, 2}, {2967, 30, 2}, {2967, 31, 1},
+    {2967, 32, 2}, {2967, 34, 3}, {2967, 35, 1}, {2967, 39, 1}, {2967, 40, 2}, {2967, 43, 1},
+    {2967, 44, 2}, {2967, 45, 3}, {2967, 46, 1}, {2967, 47, 3}, {2967, 49, 1}, {2967, 50, 2},
+    {2967, 62, 1}, {2968, 8, 1}, {2968, 9, 2}, {2968, 10, 1}, {2968, 12, 1}, {2968, 13, 1},
+    {2968, 15, 1}, {2968, 17, 1}, {2968, 18, 2}, {2968, 19, 2}, {2968, 20, 1}, {2968, 21, 3},
+    {2968, 22, 2}, {2968, 23, 2}, {2968, 24, 2}, {2968, 25, 2}, {2968, 26, 3}, {2968, 27, 3},
+    {2968, 28, 3}, {2968, 30, 3}, {2977, 48, 1}, {2977, 52, 2}, {2977, 55, 1}, {2977, 56, 1},
+    {2977, 60, 3}, {2978, 12, 1}, {2978, 19, 1}, {2978, 28, 1}, {2983, 5, 1}, {2983, 6, 2},
+    {2983, 9, 1}, {2983, 10, 2}, {2983, 11, 3}, {2983, 12, 1}, {2983, 13, 3}, {2983, 15, 1},
+    {2983, 16, 2}, {2983, 23, 1}, {2983, 27, 1}, {2983, 29, 1}, {2983, 33, 1}, {2983, 34, 1},
+    {2983, 45, 1}, {2983, 46, 2}, {2983, 47, 2}, {2983, 48, 1}, {2983, 49, 2}, {2983, 51, 3},
+    {2983, 52, 1}, {2983, 55, 1}, {2983, 60, 1}, {2983, 61, 1}, {2983, 64, 1}, {2983, 70, 1},
+    {2983, 71, 1}, {2983, 72, 1}, {2983, 73, 2}, {2983, 74, 2}, {2983, 77, 1}, {2983, 88, 1},
+    {2983, 89, 1}, {2983, 93, 1}, {2984, 9, 1}, {2984, 10, 2}, {2984, 11, 1}, {2984, 13, 1},
+    {2984, 14, 1}, {2984, 16, 1}, {2984, 18, 1}, {2984, 19, 2}, {2984, 20, 2}, {2984, 21, 1},
+    {2984, 22, 3}, {2984, 23, 2}, {2984, 24, 2}, {2984, 25, 2}, {2984, 26, 2}, {2984, 27, 3},
+    {2984, 28, 3}, {2984, 29, 3}, {2984, 31, 3}, {2984, 34, 1}, {2984, 36, 1}, {2984, 39, 1},
+    {2984, 40, 2}, {2984, 43, 1}, {2984, 44, 1}, {2984, 45, 2}, {2984, 47, 2}, {2984, 49, 1},
+    {2984, 50, 2}, {2984, 52, 1}, {2984, 53, 2}, {2984, 54, 3}, {2984, 55, 1}, {2984, 56, 2},
+    {2984, 57, 3}, {2984, 58, 2}, {2984, 62, 1}, {2984, 66, 1}, {2984, 68, 1}, {2984, 71, 1},
+    {2984, 72, 2}, {2984, 73, 1}, {2984, 74, 2}, {2984, 76, 1}, {2984, 77, 3}, {2984, 78, 2},
+    {2984, 80, 2}, {2984, 81, 3}, {2984, 82, 3}, {2984, 83, 1}, {2984, 84, 3}, {3017, 4, 1},
+    {3017, 10, 1}, {3017, 20, 1}, {3028, 2, 1}, {3030, 1, 1}, {3030, 38, 1}, {3030, 39, 1},
+    {3032, 9, 1}, {3032, 21, 1}, {3032, 22, 2}, {3032, 32, 3}, {3032, 37, 1}, {3032, 38, 1},
+    {3032, 40, 1}, {3032, 41, 2}, {3032, 47, 1}, {3032, 51, 1}, {3032, 55, 1}, {3032, 56, 1},
+    {3032, 57, 2}, {3032, 59, 1}, {3032, 60, 2}, {3032, 62, 2}, {3032, 63, 3}, {3032, 64, 2},
+    {3032, 65, 3}, {3036, 2, 1}, {3053, 7, 1}, {3069, 3, 1}, {3069, 5, 1}, {3069, 6, 2},
+    {3069, 7, 3}, {3069, 9, 1}, {3069, 12, 1}, {3069, 13, 1}, {3069, 15, 2}, {3069, 16, 1},
+    {3069, 17, 2}, {3069, 18, 2}, {3069, 19, 3}, {3069, 20, 3}, {3069, 22, 1}, {3069, 23, 2},
+    {3069, 24, 3}, {3069, 26, 1}, {3069, 28, 1}, {3069, 31, 2}, {3069, 35, 3}, {3069, 37, 1},
+    {3069, 38, 2}, {3069, 42, 1}, {3069, 46, 3}, {3091, 4, 1}, {3091, 5, 1}, {3091, 8, 2},
+    {3099, 5, 1}, {3099, 9, 2}, {3099, 12, 1}, {3099, 13, 1}, {3099, 17, 3}, {3099, 31, 1},
+    {3099, 33, 1}, {3099, 34, 2}, {3099, 35, 3}, {3099, 39, 1}, {3139, 1, 1}, {3139, 3, 1},
+    {3139, 15, 1}, {3139, 16, 1}, {3158, 6, 1}, {3172, 1, 1}, {3175, 1, 1}, {3175, 3, 1},
+    {3175, 5, 2}, {3175, 6, 3}, {3175, 8, 1}, {3175, 9, 2}, {3175, 10, 3}, {3175, 14, 1},
+    {3175, 15, 1}, {3175, 16, 2}, {3175, 17, 1}, {3175, 18, 2}, {3176, 1, 1}, {3176, 3, 1},
+    {3176, 5, 2}, {3176, 6, 3}, {3176, 8, 1}, {3176, 9, 2}, {3176, 10, 3}, {3176, 14, 1},
+    {3176, 15, 1}, {3176, 16, 2}, {3176, 17, 1}, {3176, 18, 2}, {3179, 4, 1}, {3179, 10, 1},
+    {3179, 11, 1}, {3179, 14, 1}, {3179, 16, 2}, {3179, 17, 2}, {3179, 18, 1}, {3179, 20, 1},
+    {3179, 21, 2}, {3179, 22, 2}, {3179, 23, 2}, {3179, 24, 1}, {3179, 25, 1}, {3179, 26, 2},
+    {3179, 27, 1}, {3179, 28, 2}, {3179, 29, 3}, {3179, 30, 2}, {3179, 31, 3}, {3179, 32, 3},
+    {3179, 34, 2}, {3179, 35, 3}, {3179, 36, 3}, {3188, 1, 1}, {3188, 3, 1}, {3188, 5, 2},
+    {3188, 6, 3}, {3188, 8, 1}, {3188, 9, 2}, {3188, 10, 3}, {3188, 14, 1}, {3188, 15, 1},
+    {3188, 16, 2}, {3188, 17, 1}, {3188, 18, 2}, {3235, 2, 1}, {3263, 15, 1}, {3263, 20, 1},
+    {3263, 54, 1}, {3263, 56, 1}, {3263, 57, 2}, {3263, 58, 3}, {3263, 59, 2}, {3263, 65, 1},
+    {3263, 67, 1}, {3263, 68, 2}, {3271, 5, 1}, {3271, 11, 1}, {3271, 12, 1}, {3271, 13, 2},
+    {3271, 14, 2}, {3271, 15, 1}, {3271, 17, 3}, {3271, 18, 3}, {3271, 19, 4}, {3271, 21, 1},
+    {3271, 22, 2}, {3271, 24, 1}, {3273, 5, 1}, {3273, 11, 1}, {3273, 12, 1}, {3273, 13, 2},
+    {3273, 14, 2}, {3273, 15, 1}, {3273, 17, 3}, {3273, 18, 3}, {3273, 19, 4}, {3273, 21, 1},
+    {3273, 22, 2}, {3273, 24, 1}, {3279, 12, 1}, {3287, 13, 1}, {3287, 21, 1}, {3287, 30, 2},
+    {3296, 33, 1}, {3296, 37, 1}, {3296, 39, 1}, {3296, 43, 1}, {3296, 44, 1}, {3296, 55, 1},
+    {3296, 56, 2}, {3296, 57, 2}, {3296, 58, 1}, {3296, 59, 2}, {3296, 61, 3}, {3296, 62, 1},
+    {3296, 65, 1}, {3296, 69, 1}, {3296, 70, 2}, {3296, 94, 2}, {3296, 98, 1}, {3296, 99, 1},
+    {3296, 100, 2}, {3296, 101, 1}, {3296, 102, 1}, {3296, 103, 2}, {3296, 104, 2}, {3296, 106, 2},
+    {3296, 108, 2}, {3296, 110, 1}, {3296, 111, 3}, {3296, 116, 1}, {3296, 117, 1}, {3296, 121, 1},
+    {3296, 123, 1}, {3296, 124, 2}, {3296, 126, 1}, {3296, 128, 1}, {3296, 130, 1}, {3296, 131, 2},
+    {3296, 133, 3}, {3296, 134, 2}, {3296, 136, 3}, {3296, 137, 1}, {3296, 138, 3}, {3296, 139, 4},
+    {3296, 140, 1}, {3296, 141, 5}, {3296, 142, 2}, {3296, 143, 1}, {3296, 144, 2}, {3296, 145, 3},
+    {3296, 151, 1}, {3296, 157, 1}, {3296, 158, 1}, {3296, 159, 2}, {3296, 160, 2}, {3296, 161, 1},
+    {3296, 163, 3}, {3296, 164, 3}, {3296, 165, 4}, {3296, 167, 1}, {3296, 168, 2}, {3296, 170, 2},
+    {3297, 1, 1}, {3297, 4, 2}, {3297, 5, 3}, {3297, 6, 1}, {3297, 9, 2}, {3297, 11, 1},
+    {3297, 13, 1}, {3297, 14, 2}, {3297, 15, 1}, {3297, 16, 2}, {3297, 17, 3}, {3297, 18, 2},
+    {3297, 19, 3}, {3297, 20, 3}, {3297, 21, 1}, {3297, 24, 1}, {3297, 25, 1}, {3297, 26, 2},
+    {3297, 27, 2}, {3297, 28, 3}, {3297, 36, 1}, {3297, 40, 1}, {3297, 42, 1}, {3297, 45, 1},
+    {3297, 46, 2}, {3297, 47, 1}, {3297, 48, 2}, {3297, 50, 1}, {3297, 51, 3}, {3297, 52, 2},
+    {3297, 54, 2}, {3297, 55, 3}, {3297, 56, 3}, {3297, 57, 1}, {3297, 58, 3}, {3297, 61, 1},
+    {3297, 63, 1}, {3297, 64, 1}, {3297, 68, 2}, {3297, 70, 1}, {3297, 75, 2}, {3297, 78, 3},
+    {3297, 79, 1}, {3297, 80, 1}, {3297, 84, 1}, {3297, 87, 1}, {3297, 89, 1}, {3297, 91, 2},
+    {3297, 92, 2}, {3297, 95, 3}, {3297, 110, 1}, {3297, 111, 2}, {3297, 113, 3}, {3297, 116, 1},
+    {3297, 118, 1}, {3297, 119, 2}, {3297, 120, 3}, {3297, 122, 1}, {3297, 123, 1}, {3297, 124, 1},
+    {3297, 126, 1}, {3297, 127, 2}, {3297, 130, 2}, {3297, 132, 3}, {3306, 7, 2}, {3306, 11, 1},
+    {3306, 12, 1}, {3306, 13, 2}, {3306, 14, 1}, {3306, 15, 1}, {3306, 16, 2}, {3306, 17, 2},
+    {3306, 19, 2}, {3306, 21, 2}, {3306, 23, 1}, {3306, 24, 3}, {3306, 30, 1}, {3306, 34, 1},
+    {3306, 36, 1}, {3306, 39, 1}, {3306, 40, 2}, {3306, 41, 1}, {3306, 42, 2}, {3306, 44, 1},
+    {3306, 45, 3}, {3306, 46, 2}, {3306, 48, 2}, {3306, 49, 3}, {3306, 50, 3}, {3306, 51, 1},
+    {3306, 52, 3}, {3311, 4, 1}, {3311, 5, 2}, {3311, 7, 1}, {3311, 8, 2}, {3311, 9, 3},
+    {3311, 10, 3}, {3311, 15, 1}, {3311, 21, 1}, {3311, 22, 1}, {3311, 25, 1}, {3311, 27, 2},
+    {3311, 28, 2}, {3311, 29, 1}, {3311, 31, 1}, {3311, 32, 2}, {3311, 33, 2}, {3311, 34, 2},
+    {3311, 35, 1}, {3311, 36, 1}, {3311, 37, 2}, {3311, 38, 1}, {3311, 39, 2}, {3311, 40, 3},
+    {3311, 41, 2}, {3311, 42, 3}, {3311, 43, 3}, {3311, 45, 2}, {3311, 46, 3}, {3311, 47, 3},
+    {3311, 50, 1}, {3311, 51, 2}, {3311, 52, 3}, {3311, 54, 1}, {3311, 56, 2}, {3311, 59, 1},
+    {3311, 60, 3}, {3311, 61, 1}, {3311, 63, 2}, {3311, 64, 3}, {3311, 65, 1}, {3311, 67, 2},
+    {3311, 71, 1}, {3311, 72, 1}, {3311, 73, 2}, {3311, 74, 2}, {3311, 76, 1}, {3311, 77, 2},
+    {3311, 78, 1}, {3311, 79, 2}, {3311, 81, 3}, {3311, 82, 1}, {3311, 83, 2}, {3311, 84, 3},
+    {3311, 86, 1}, {3311, 92, 1}, {3311, 93, 1}, {3311, 95, 1}, {3311, 96, 2}, {3311, 97, 2},
+    {3311, 98, 3}, {3311, 99, 2}, {3311, 100, 3}, {3311, 101, 3}, {3311, 105, 1}, {3311, 106, 1},
+    {3311, 108, 2}, {3312, 11, 1}, {3312, 12, 2}, {3312, 13, 1}, {3312, 15, 1}, {3312, 16, 1},
+    {3312, 18, 1}, {3312, 20, 1}, {3312, 21, 2}, {3312, 22, 2}, {3312, 23, 1}, {3312, 24, 3},
+    {3312, 25, 2}, {3312, 26, 2}, {3312, 27, 2}, {3312, 28, 2}, {3312, 29, 3}, {3312, 30, 3},
+    {3312, 31, 3}, {3312, 33, 3}, {3312, 38, 1}, {3312, 39, 1}, {3312, 40, 2}, {3312, 43, 3},
+    {3312, 45, 1}, {3312, 47, 1}, {3312, 49, 1}, {3312, 50, 2}, {3312, 51, 1}, {3312, 52, 1},
+    {3312, 54, 2}, {3312, 55, 2}, {3312, 56, 3}, {3312, 57, 1}, {3312, 58, 2}, {3312, 62, 3},
+    {3312, 63, 2}, {3312, 64, 1}, {3312, 65, 3}, {3312, 66, 2}, {3312, 70, 1}, {3312, 71, 2},
+    {3312, 72, 1}, {3312, 75, 2}, {3312, 76, 1}, {3312, 77, 1}, {3312, 78, 3}, {3312, 79, 3},
+    {3312, 80, 2}, {3312, 81, 1}, {3312, 88, 1}, {3312, 90, 1}, {3312, 93, 1}, {3312, 94, 2},
+    {3312, 97, 1}, {3312, 98, 1}, {3312, 99, 2}, {3312, 101, 2}, {3312, 103, 1}, {3312, 104, 2},
+    {3312, 106, 1}, {3312, 107, 2}, {3312, 108, 3}, {3312, 109, 1}, {3312, 110, 2}, {3312, 111, 3},
+    {3312, 112, 2}, {3312, 117, 1}, {3312, 120, 1}, {3312, 121, 1}, {3312, 122, 1}, {3312, 123, 1},
+    {3312, 126, 1}, {3312, 127, 2}, {3312, 128, 2}, {3312, 129, 2}, {3312, 131, 1}, {3312, 132, 1},
+    {3312, 133, 2}, {3312, 134, 2}, {3312, 135, 2}, {3312, 136, 3}, {3312, 137, 2}, {3312, 138, 3},
+    {3312, 139, 3}, {3312, 141, 2}, {3312, 143, 1}, {3312, 144, 2}, {3312, 145, 3}, {3360, 103, 1},
+    {3360, 104, 2}, {3360, 107, 1}, {3360, 108, 2}, {3360, 109, 3}, {3360, 110, 2}, {3360, 111, 3},
+    {3360, 113, 1}, {3360, 114, 2}, {3360, 122, 1}, {3360, 131, 1}, {3360, 134, 2}, {3360, 135, 3},
+    {3360, 137, 1}, {3360, 138, 2}, {3360, 139, 3}, {3360, 142, 2}, {3360, 143, 3}, {3360, 149, 3},
+    {3360, 153, 1}, {3360, 154, 1}, {3360, 155, 4}, {3360, 156, 1}, {3360, 157, 1}, {3360, 158, 2},
+    {3360, 159, 2}, {3360, 161, 2}, {3360, 163, 2}, {3360, 165, 1}, {3360, 166, 3}, {3360, 170, 1},
+    {3360, 171, 2}, {3360, 187, 1}, {3360, 189, 1}, {3360, 207, 1}, {3360, 208, 2}, {3360, 218, 1},
+    {3360, 220, 1}, {3360, 227, 1}, {3360, 230, 1}, {3360, 233, 1}, {3360, 234, 2}, {3360, 235, 1},
+    {3360, 236, 2}, {3360, 241, 1}, {3360, 242, 2}, {3360, 253, 1}, {3360, 263, 2}, {3360, 264, 1},
+    {3361, 45, 1}, {3361, 47, 1}, {3361, 49, 2}, {3361, 50, 2}, {3361, 53, 3}, {3365, 40, 2},
+    {3365, 78, 1}, {3365, 104, 3}, {3365, 138, 1}, {3365, 141, 3}, {3365, 145, 2}, {3365, 187, 6},
+    {3365, 192, 1}, {3365, 196, 1}, {3365, 202, 1}, {3365, 203, 2}, {3365, 204, 2}, {3365, 225, 1},
+    {3365, 226, 2}, {3365, 251, 1}, {3365, 269, 3}, {3365, 277, 1}, {3365, 290, 1}, {3365, 296, 2},
+    {3365, 298, 2}, {3365, 300, 7}, {3365, 318, 1}, {3365, 319, 1}, {3365, 322, 2}, {3365, 327, 1},
+    {3365, 329, 2}, {3365, 338, 1}, {3365, 341, 2}, {3365, 355, 1}, {3365, 360, 1}, {3386, 51, 1},
+    {3390, 2, 1}, {3390, 4, 1}, {3390, 6, 2}, {3390, 9, 1}, {3390, 29, 1}, {3390, 30, 3},
+    {3390, 35, 1}, {3390, 36, 1}, {3390, 37, 2}, {3401, 5, 12}, {3401, 6, 2}, {3401, 7, 13},
+    {3401, 9, 4}, {3401, 11, 9}, {3401, 13, 12}, {3401, 14, 4}, {3401, 20, 7}, {3401, 25, 1},
+    {3401, 26, 6}, {3401, 27, 7}, {3401, 28, 3}, {3401, 30, 5}, {3401, 33, 1}, {3401, 34, 3},
+    {3401, 55, 6}, {3401, 56, 7}, {3401, 62, 2}, {3401, 63, 1}, {3401, 64, 3}, {3401, 65, 4},
+    {3401, 72, 1}, {3401, 73, 1}, {3401, 87, 5}, {3401, 88, 14}, {3401, 99, 6}, {3401, 101, 1},
+    {3401, 102, 1}, {3401, 104, 4}, {3401, 107, 1}, {3401, 109, 6}, {3401, 111, 12},
+    {3401, 112, 14}, {3401, 114, 15}, {3401, 119, 13}, {3401, 120, 7}, {3401, 121, 13},
+    {3401, 122, 14}, {3401, 124, 14}, {3401, 125, 15}, {3402, 2, 4}, {3403, 3, 1}, {3403, 9, 1},
+    {3403, 13, 1}, {3403, 23, 1}, {3403, 29, 1}, {3403, 30, 1}, {3403, 31, 1}, {3403, 32, 1},
+    {3403, 33, 1}, {3403, 34, 2}, {3403, 35, 1}, {3403, 36, 2}, {3403, 42, 2}, {3404, 1, 1},
+    {3404, 4, 2}, {3405, 5, 1}, {3405, 6, 2}, {3405, 9, 1}, {3405, 10, 2}, {3405, 11, 3},
+    {3405, 12, 1}, {3405, 13, 3}, {3405, 15, 1}, {3405, 16, 2}, {3405, 24, 1}, {3405, 28, 1},
+    {3405, 30, 1}, {3405, 32, 1}, {3405, 33, 2}, {3405, 36, 1}, {3405, 37, 1}, {3405, 40, 1},
+    {3405, 41, 2}, {3405, 43, 1}, {3405, 44, 2}, {3405, 46, 1}, {3405, 47, 2}, {3405, 49, 1},
+    {3405, 50, 2}, {3405, 52, 1}, {3405, 53, 2}, {3405, 56, 1}, {3405, 57, 2}, {3405, 60, 1},
+    {3405, 61, 2}, {3405, 62, 2}, {3405, 63, 1}, {3405, 64, 2}, {3405, 66, 3}, {3405, 67, 1},
+    {3405, 71, 1}, {3405, 74, 1}, {3405, 75, 2}, {3405, 76, 2}, {3405, 78, 3}, {3405, 79, 1},
+    {3405, 80, 1}, {3405, 81, 2}, {3406, 7, 1}, {3406, 8, 1}, {3406, 9, 2}, {3406, 12, 3},
+    {3406, 14, 1}, {3406, 16, 1}, {3406, 18, 1}, {3406, 19, 2}, {3406, 20, 1}, {3406, 21, 1},
+    {3406, 23, 2}, {3406, 24, 2}, {3406, 25, 3}, {3406, 26, 1}, {3406, 27, 2}, {3406, 31, 3},
+    {3406, 32, 2}, {3406, 33, 1}, {3406, 34, 3}, {3406, 35, 2}, {3406, 42, 1}, {3406, 43, 1},
+    {3406, 44, 1}, {3406, 45, 1}, {3406, 49, 1}, {3406, 50, 2}, {3406, 51, 1}, {3406, 52, 2},
+    {3406, 53, 2}, {3406, 56, 1}, {3406, 57, 2}, {3406, 58, 1}, {3406, 59, 2}, {3406, 60, 2},
+    {3406, 61, 3}, {3406, 62, 2}, {3406, 63, 3}, {3406, 64, 3}, {3406, 66, 2}, {3406, 68, 1},
+    {3406, 69, 2}, {3406, 70, 3}, {3415, 23, 1}, {3415, 32, 1}, {3415, 35, 1}, {3415, 39, 1},
+    {3415, 40, 2}, {3415, 50, 1}, {3415, 58, 1}, {3415, 61, 1}, {3415, 71, 1}, {3415, 78, 1},
+    {3415, 81, 1}, {3415, 82, 2}, {3415, 83, 2}, {3415, 85, 3}, {3415, 86, 1}, {3415, 87, 1},
+    {3415, 88, 2}, {3415, 94, 1}, {3415, 96, 2}, {3415, 98, 1}, {3415, 99, 2}, {3415, 101, 3},
+    {3415, 102, 1}, {3415, 105, 1}, {3415, 106, 2}, {3415, 109, 1}, {3415, 111, 1}, {3415, 114, 1},
+    {3415, 115, 2}, {3415, 116, 2}, {3415, 118, 1}, {3415, 119, 2}, {3415, 120, 1}, {3415, 121, 3},
+    {3415, 122, 1}, {3415, 124, 1}, {3415, 125, 3}, {3415, 126, 2}, {3415, 127, 3}, {3415, 128, 3},
+    {3415, 129, 3}, {3416, 28, 1}, {3416, 44, 1}, {3416, 46, 2}, {3416, 48, 1}, {3417, 3, 1},
+    {3417, 4, 2}, {3417, 5, 3}, {3417, 6, 4},
+};
+// clang-format on
+static_assert(std::is_sorted(std::begin(data), std::end(data), entry_less));
+}  // namespace
+
 int lookup_jak3_texture_dest_offset(int tpage, int texture_idx) {
-  auto it = data.find(tpage);
-  if (it == data.end()) {
-    return 0;
-  }
-  for (auto& p : it->second) {
-    if (p.first == texture_idx) {
-      return p.second;
-    }
+  const RemapEntry key = {tpage, texture_idx, 0};
+  auto it = std::lower_bound(std::begin(data), std::end(data), key, entry_less);
+  if (it != std::end(data) && it->tpage == tpage && it->texture_idx == texture_idx) {
+    return it->dest_offset;
   }
   return 0;
-}
\ No newline at end of file
+}
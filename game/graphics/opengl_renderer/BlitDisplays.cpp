@@ -99,6 +99,18 @@ void BlitDisplays::do_copy_back(SharedRenderState* render_state) {
   }
 }
 
+std::optional<GLuint> BlitDisplays::take_copy_back_texture(SharedRenderState* render_state) {
+  std::optional<GLuint> result;
+  if (m_copy_back_pending) {
+    if (render_state->render_fb_w == m_copier->width() &&
+        render_state->render_fb_h == m_copier->height()) {
+      result = m_copier->texture();
+    }
+    m_copy_back_pending = false;
+  }
+  return result;
+}
+
 void BlitDisplays::draw_debug_window() {
   glBindTexture(GL_TEXTURE_2D, m_copier->texture());
   int w, h;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
 #include "game/graphics/opengl_renderer/opengl_utils.h"
 #include "game/graphics/texture/TexturePool.h"
@@ -14,6 +16,11 @@ class BlitDisplays : public BucketRenderer {
   void init_textures(TexturePool& texture_pool, GameVersion) override;
   void draw_debug_window() override;
   void do_copy_back(SharedRenderState* render_state);
+  /*!
+   * If a copy back is pending, skip it and return the saved frame so it can be drawn to the window
+   * directly. The render buffer still has the skipped frame.
+   */
+  std::optional<GLuint> take_copy_back_texture(SharedRenderState* render_state);
 
  private:
   std::unique_ptr<FramebufferCopier> m_copier;
@@ -44,6 +44,9 @@ struct SharedRenderState {
   math::Vector<u8, 4> fog_color = math::Vector<u8, 4>{0, 0, 0, 0};
   float fog_intensity = 1.f;
   bool no_multidraw = false;
+  bool gpu_background_culling = false;
+  // warp and sprite distort only copy the part of the framebuffer they sample.
+  bool partial_screen_copies = true;
 
   void reset();
   bool has_pc_data = false;
@@ -107,6 +110,20 @@ class BucketRenderer {
   virtual void init_shaders(ShaderLibrary&) {}
   virtual void init_textures(TexturePool&, GameVersion) {}
 
+  /*!
+   * Renderers that can process their DMA without OpenGL or the SharedRenderState return true here.
+   * OpenGLRenderer will then call prepare() on a worker thread, ahead of render(), so the DMA
+   * processing for many buckets can run at once.
+   */
+  virtual bool can_prepare() const { return false; }
+
+  /*!
+   * Process the DMA for this bucket, up to next_bucket. This runs on a worker thread at the same
+   * time as other buckets, so it must only touch the DMA and this renderer's own data.
+   * render() is still called afterward, in bucket order, and must skip over the DMA.
+   */
+  virtual void prepare(DmaFollower&, u32 /*next_bucket*/, GameVersion) {}
+
  protected:
   std::string m_name;
   int m_my_id;
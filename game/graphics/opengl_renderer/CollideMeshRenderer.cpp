@@ -1,5 +1,8 @@
 #include "CollideMeshRenderer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 #include "game/graphics/gfx.h"
@@ -104,6 +107,46 @@ const static std::vector<float> mode_colors_jak2 = {
     1.0f,  1.0f, 0.1f,  // 3, halfpipe
 };
 
+namespace {
+// triangles per chunk. Small enough to cull well, big enough that a large level is only a few
+// thousand chunks.
+constexpr u32 kTrisPerChunk = 256;
+
+// put the low 10 bits of x in every third bit, for a Morton code.
+u32 spread_bits_10(u32 x) {
+  x &= 0x3ff;
+  x = (x | (x << 16)) & 0x030000ff;
+  x = (x | (x << 8)) & 0x0300f00f;
+  x = (x | (x << 4)) & 0x030c30c3;
+  x = (x | (x << 2)) & 0x09249249;
+  return x;
+}
+
+template <size_t N>
+bool mask_has_bit(const std::array<u32, N>& mask, u32 bit) {
+  return bit / 32 < N && (mask[bit / 32] & (1u << (bit & 0x1f)));
+}
+
+/*!
+ * Same as the pat filter in collision.vert.
+ */
+bool pat_passes_filter(u32 pat, GameVersion version) {
+  const auto& settings = Gfx::g_global_settings;
+  bool new_pat = version == GameVersion::Jak2 || version == GameVersion::Jak3;
+  u32 mode = new_pat ? (pat >> 7) & 0x7 : (pat >> 3) & 0x7;
+  u32 material = new_pat ? (pat >> 10) & 0x3f : (pat >> 6) & 0x3f;
+  u32 event = new_pat ? (pat >> 18) & 0x3f : (pat >> 14) & 0x3f;
+  u32 skip = new_pat ? pat & 0x1f03007f : pat & 0x3007;
+  return mask_has_bit(settings.collision_mode_mask, mode) &&
+         mask_has_bit(settings.collision_material_mask, material) &&
+         mask_has_bit(settings.collision_event_mask, event) &&
+         !(settings.collision_skip_hide_mask & skip) &&
+         ((skip == 0 && settings.collision_skip_nomask_allowed) ||
+          (skip != 0 && (settings.collision_skip_mask == 0 ||
+                         (skip & settings.collision_skip_mask))));
+}
+}  // namespace
+
 CollideMeshRenderer::CollideMeshRenderer(GameVersion version) {
   glGenVertexArrays(1, &m_vao);
   glGenBuffers(1, &m_ubo);
@@ -118,6 +161,199 @@ CollideMeshRenderer::CollideMeshRenderer(GameVersion version) {
 CollideMeshRenderer::~CollideMeshRenderer() {
   glDeleteVertexArrays(1, &m_vao);
   glDeleteBuffers(1, &m_ubo);
+  for (auto& it : m_level_caches) {
+    free_level_cache(&it.second);
+  }
+}
+
+void CollideMeshRenderer::free_level_cache(LevelCache* cache) {
+  if (cache->index_buffer) {
+    glDeleteBuffers(1, &cache->index_buffer);
+    glDeleteBuffers(1, &cache->filtered_index_buffer);
+  }
+  *cache = LevelCache();
+}
+
+/*!
+ * Get the chunks of a level. The first time a level is drawn, this sorts its triangles into chunks.
+ */
+CollideMeshRenderer::LevelCache& CollideMeshRenderer::get_level_cache(const LevelData* lev) {
+  auto& cache = m_level_caches[lev];
+  cache.in_use = true;
+  if (cache.load_id == lev->load_id) {
+    return cache;
+  }
+
+  free_level_cache(&cache);
+  cache.load_id = lev->load_id;
+  cache.in_use = true;
+
+  const auto& verts = lev->level->collision.vertices;
+  const u32 num_tris = verts.size() / 3;
+  float lo[3], hi[3];
+  for (int i = 0; i < 3; i++) {
+    lo[i] = std::numeric_limits<float>::max();
+    hi[i] = std::numeric_limits<float>::lowest();
+  }
+  for (const auto& v : verts) {
+    const float pos[3] = {v.x, v.y, v.z};
+    for (int i = 0; i < 3; i++) {
+      lo[i] = std::min(lo[i], pos[i]);
+      hi[i] = std::max(hi[i], pos[i]);
+    }
+  }
+
+  // sort the triangles by the Morton code of their center, so the triangles of a chunk are close
+  std::vector<std::pair<u32, u32>> order;  // morton code, triangle
+  order.reserve(num_tris);
+  for (u32 tri = 0; tri < num_tris; tri++) {
+    u32 code = 0;
+    for (int i = 0; i < 3; i++) {
+      float center = 0;
+      for (int j = 0; j < 3; j++) {
+        const auto& v = verts[tri * 3 + j];
+        center += (i == 0 ? v.x : i == 1 ? v.y : v.z) / 3.f;
+      }
+      float extent = std::max(hi[i] - lo[i], 1.f);
+      u32 q = std::clamp((center - lo[i]) * (1023.f / extent), 0.f, 1023.f);
+      code |= spread_bits_10(q) << i;
+    }
+    order.emplace_back(code, tri);
+  }
+  std::sort(order.begin(), order.end());
+
+  cache.indices.reserve(num_tris * 3);
+  for (u32 start = 0; start < num_tris; start += kTrisPerChunk) {
+    u32 end = std::min(num_tris, start + kTrisPerChunk);
+    auto& chunk = cache.chunks.emplace_back();
+    chunk.first_index = cache.indices.size();
+    float chunk_lo[3], chunk_hi[3];
+    for (int i = 0; i < 3; i++) {
+      chunk_lo[i] = std::numeric_limits<float>::max();
+      chunk_hi[i] = std::numeric_limits<float>::lowest();
+    }
+    for (u32 i = start; i < end; i++) {
+      for (int j = 0; j < 3; j++) {
+        u32 idx = order[i].second * 3 + j;
+        const float pos[3] = {verts[idx].x, verts[idx].y, verts[idx].z};
+        for (int k = 0; k < 3; k++) {
+          chunk_lo[k] = std::min(chunk_lo[k], pos[k]);
+          chunk_hi[k] = std::max(chunk_hi[k], pos[k]);
+        }
+        cache.indices.push_back(idx);
+      }
+    }
+    chunk.index_count = cache.indices.size() - chunk.first_index;
+
+    math::Vector3f center((chunk_lo[0] + chunk_hi[0]) * 0.5f, (chunk_lo[1] + chunk_hi[1]) * 0.5f,
+                          (chunk_lo[2] + chunk_hi[2]) * 0.5f);
+    float radius_squared = 0;
+    for (u32 i = chunk.first_index; i < chunk.first_index + chunk.index_count; i++) {
+      const auto& v = verts[cache.indices[i]];
+      radius_squared =
+          std::max(radius_squared, (math::Vector3f(v.x, v.y, v.z) - center).squared_length());
+    }
+    chunk.bsphere = math::Vector4f(center.x(), center.y(), center.z(), std::sqrt(radius_squared));
+  }
+
+  glGenBuffers(1, &cache.index_buffer);
+  glGenBuffers(1, &cache.filtered_index_buffer);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cache.index_buffer);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, cache.indices.size() * sizeof(u32), cache.indices.data(),
+               GL_STATIC_DRAW);
+  return cache;
+}
+
+/*!
+ * Rebuild the index buffer of the triangles that pass the pat filter, if the filter changed.
+ */
+void CollideMeshRenderer::update_filtered_indices(LevelCache* cache,
+                                                  const tfrag3::CollisionMesh& mesh,
+                                                  GameVersion version) {
+  const auto& settings = Gfx::g_global_settings;
+  std::vector<u32> filter_settings = {(u32)version};
+  filter_settings.insert(filter_settings.end(), settings.collision_mode_mask.begin(),
+                         settings.collision_mode_mask.end());
+  filter_settings.insert(filter_settings.end(), settings.collision_event_mask.begin(),
+                         settings.collision_event_mask.end());
+  filter_settings.insert(filter_settings.end(), settings.collision_material_mask.begin(),
+                         settings.collision_material_mask.end());
+  filter_settings.push_back(settings.collision_skip_mask);
+  filter_settings.push_back(settings.collision_skip_hide_mask);
+  filter_settings.push_back(settings.collision_skip_nomask_allowed);
+  if (filter_settings == cache->filter_settings) {
+    return;
+  }
+  cache->filter_settings = std::move(filter_settings);
+
+  std::vector<u32> filtered;
+  filtered.reserve(cache->indices.size());
+  for (auto& chunk : cache->chunks) {
+    chunk.first_filtered_index = filtered.size();
+    for (u32 i = chunk.first_index; i < chunk.first_index + chunk.index_count; i += 3) {
+      // the shader filters each vertex, so keep the triangle if any of them pass.
+      const u32* tri = &cache->indices[i];
+      if (pat_passes_filter(mesh.vertices[tri[0]].pat, version) ||
+          pat_passes_filter(mesh.vertices[tri[1]].pat, version) ||
+          pat_passes_filter(mesh.vertices[tri[2]].pat, version)) {
+        filtered.insert(filtered.end(), tri, tri + 3);
+      }
+    }
+    chunk.filtered_index_count = filtered.size() - chunk.first_filtered_index;
+  }
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cache->filtered_index_buffer);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, filtered.size() * sizeof(u32), filtered.data(),
+               GL_STATIC_DRAW);
+}
+
+/*!
+ * Draw the chunks in m_chunk_visible. Chunks that are next to each other in the index buffer are
+ * drawn as one range.
+ */
+void CollideMeshRenderer::draw_visible_chunks(const LevelCache& cache,
+                                              bool filtered,
+                                              bool no_multidraw,
+                                              ScopedProfilerNode& prof) {
+  m_draw_counts.clear();
+  m_draw_offsets.clear();
+  u32 num_tris = 0;
+  u32 range_end = UINT32_MAX;
+  for (size_t i = 0; i < cache.chunks.size(); i++) {
+    if (!m_chunk_visible[i]) {
+      continue;
+    }
+    const auto& chunk = cache.chunks[i];
+    u32 first = filtered ? chunk.first_filtered_index : chunk.first_index;
+    u32 count = filtered ? chunk.filtered_index_count : chunk.index_count;
+    if (!count) {
+      continue;
+    }
+    num_tris += count / 3;
+    if (first == range_end) {
+      m_draw_counts.back() += count;
+    } else {
+      m_draw_counts.push_back(count);
+      m_draw_offsets.push_back((void*)(first * sizeof(u32)));
+    }
+    range_end = first + count;
+  }
+  if (m_draw_counts.empty()) {
+    return;
+  }
+
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+               filtered ? cache.filtered_index_buffer : cache.index_buffer);
+  if (no_multidraw) {
+    for (size_t i = 0; i < m_draw_counts.size(); i++) {
+      glDrawElements(GL_TRIANGLES, m_draw_counts[i], GL_UNSIGNED_INT, m_draw_offsets[i]);
+      prof.add_draw_call();
+    }
+  } else {
+    glMultiDrawElements(GL_TRIANGLES, m_draw_counts.data(), GL_UNSIGNED_INT,
+                        m_draw_offsets.data(), m_draw_counts.size());
+    prof.add_draw_call();
+  }
+  prof.add_tri(num_tris);
 }
 
 void CollideMeshRenderer::init_pat_colors(GameVersion version) {
@@ -205,7 +441,18 @@ void CollideMeshRenderer::render(SharedRenderState* render_state, ScopedProfiler
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);  // ?
   glDepthMask(GL_TRUE);
 
+  for (auto& it : m_level_caches) {
+    it.second.in_use = false;
+  }
+
   for (auto lev : levels) {
+    auto& cache = get_level_cache(lev);
+    update_filtered_indices(&cache, lev->level->collision, render_state->version);
+    m_chunk_visible.resize(cache.chunks.size());
+    for (size_t i = 0; i < cache.chunks.size(); i++) {
+      m_chunk_visible[i] = sphere_in_view_ref(cache.chunks[i].bsphere, render_state->camera_planes);
+    }
+
     glBindBuffer(GL_ARRAY_BUFFER, lev->collide_vertices);
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
@@ -256,20 +503,27 @@ void CollideMeshRenderer::render(SharedRenderState* render_state, ScopedProfiler
     glUniform1ui(glGetUniformLocation(shader, "collision_skip_nomask_allowed"),
                  Gfx::g_global_settings.collision_skip_nomask_allowed);
     glUniform1i(glGetUniformLocation(shader, "mode"), Gfx::g_global_settings.collision_mode);
-    glDrawArrays(GL_TRIANGLES, 0, lev->level->collision.vertices.size());
+    draw_visible_chunks(cache, true, render_state->no_multidraw, prof);
 
     if (Gfx::g_global_settings.collision_wireframe) {
       glUniform1i(glGetUniformLocation(shader, "wireframe"), 1);
       glDisable(GL_BLEND);
       glDepthMask(GL_FALSE);
       glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-      glDrawArrays(GL_TRIANGLES, 0, lev->level->collision.vertices.size());
+      draw_visible_chunks(cache, false, render_state->no_multidraw, prof);
       glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
       glEnable(GL_BLEND);
       glDepthMask(GL_TRUE);
     }
+  }
 
-    prof.add_draw_call();
-    prof.add_tri(lev->level->collision.vertices.size() / 3);
+  // free the chunks of levels that were unloaded
+  for (auto it = m_level_caches.begin(); it != m_level_caches.end();) {
+    if (it->second.in_use) {
+      ++it;
+    } else {
+      free_level_cache(&it->second);
+      it = m_level_caches.erase(it);
+    }
   }
 }
@@ -1,4 +1,7 @@
 #pragma once
+#include <unordered_map>
+#include <vector>
+
 #include "common/versions/versions.h"
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
@@ -16,10 +19,52 @@ class CollideMeshRenderer {
   ~CollideMeshRenderer();
 
  private:
+  /*!
+   * A run of triangles that are close to each other. The triangles of a level are sorted along a
+   * Morton curve and split into chunks, so most chunks are small and can be culled on their own.
+   */
+  struct Chunk {
+    math::Vector4f bsphere;
+    // in the index buffer of all triangles
+    u32 first_index = 0;
+    u32 index_count = 0;
+    // in the index buffer of the triangles that pass the pat filter
+    u32 first_filtered_index = 0;
+    u32 filtered_index_count = 0;
+  };
+
+  /*!
+   * Built the first time a level's collision is drawn, and freed once the level is unloaded.
+   */
+  struct LevelCache {
+    u64 load_id = UINT64_MAX;
+    GLuint index_buffer = 0;
+    GLuint filtered_index_buffer = 0;
+    std::vector<u32> indices;  // all triangles, in chunk order
+    std::vector<Chunk> chunks;
+    // the pat filter settings that the filtered index buffer was built for
+    std::vector<u32> filter_settings;
+    bool in_use = false;
+  };
+
   void init_pat_colors(GameVersion version);
+  LevelCache& get_level_cache(const LevelData* lev);
+  void update_filtered_indices(LevelCache* cache,
+                               const tfrag3::CollisionMesh& mesh,
+                               GameVersion version);
+  void draw_visible_chunks(const LevelCache& cache,
+                           bool filtered,
+                           bool no_multidraw,
+                           ScopedProfilerNode& prof);
+  static void free_level_cache(LevelCache* cache);
 
   GLuint m_vao;
   GLuint m_ubo;
 
   PatColors m_colors;
+
+  std::unordered_map<const LevelData*, LevelCache> m_level_caches;
+  std::vector<u8> m_chunk_visible;
+  std::vector<GLsizei> m_draw_counts;
+  std::vector<void*> m_draw_offsets;
 };
@@ -15,14 +15,13 @@ constexpr PerGameVersion<int> game_height(448, 416, 416);
 
 DirectRenderer::DirectRenderer(const std::string& name, int my_id, int batch_size)
     : BucketRenderer(name, my_id), m_prim_buffer(batch_size) {
-  glGenBuffers(1, &m_ogl.vertex_buffer);
-  glGenVertexArrays(1, &m_ogl.vao);
-  glBindVertexArray(m_ogl.vao);
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
   m_ogl.vertex_buffer_max_verts = batch_size * 3 * 2;
   m_ogl.vertex_buffer_bytes = m_ogl.vertex_buffer_max_verts * sizeof(Vertex);
-  glBufferData(GL_ARRAY_BUFFER, m_ogl.vertex_buffer_bytes, nullptr,
-               GL_STREAM_DRAW);  // todo stream?
+  // a flush is at most half of this, so there's always room for the next one.
+  m_ogl.vertex_stream = std::make_unique<StreamingBuffer>(m_ogl.vertex_buffer_bytes);
+  glGenVertexArrays(1, &m_ogl.vao);
+  glBindVertexArray(m_ogl.vao);
+  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_stream->buffer());
   glEnableVertexAttribArray(0);
   glVertexAttribPointer(0,                             // location 0 in the shader
                         4,                             // 4 floats per vert (w unused)
@@ -81,7 +80,6 @@ DirectRenderer::DirectRenderer(const std::string& name, int my_id, int batch_siz
 }
 
 DirectRenderer::~DirectRenderer() {
-  glDeleteBuffers(1, &m_ogl.vertex_buffer);
   glDeleteVertexArrays(1, &m_ogl.vao);
 }
 
@@ -171,11 +169,14 @@ void DirectRenderer::draw_debug_window() {
   ImGui::Text("  clmp: %d", m_stats.flush_from_clamp);
   ImGui::Text("  prim: %d", m_stats.flush_from_prim);
   ImGui::Text("  texstate: %d", m_stats.flush_from_state_exhaust);
+  ImGui::Text("  texconflict: %d", m_stats.flush_from_tex_conflict);
   ImGui::Text(" Total: %d/%d",
               m_stats.flush_from_prim + m_stats.flush_from_clamp + m_stats.flush_from_alpha +
                   m_stats.flush_from_test + m_stats.flush_from_zbuf + m_stats.flush_from_tex_1 +
-                  m_stats.flush_from_tex_0 + m_stats.flush_from_state_exhaust,
+                  m_stats.flush_from_tex_0 + m_stats.flush_from_state_exhaust +
+                  m_stats.flush_from_tex_conflict,
               m_stats.draw_calls);
+  ImGui::Text("Texture state reuse: %d/%d", m_stats.tex_state_reuses, m_stats.tex_state_lookups);
 }
 
 float u32_to_float(u32 in) {
@@ -258,9 +259,10 @@ void DirectRenderer::flush_pending(SharedRenderState* render_state, ScopedProfil
   glBindVertexArray(m_ogl.vao);
   // render!
   // update buffers:
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
-  glBufferData(GL_ARRAY_BUFFER, m_prim_buffer.vert_count * sizeof(Vertex),
-               m_prim_buffer.vertices.data(), GL_STREAM_DRAW);
+  const int first_vert =
+      m_ogl.vertex_stream->upload(m_prim_buffer.vertices.data(),
+                                  m_prim_buffer.vert_count * sizeof(Vertex), sizeof(Vertex)) /
+      sizeof(Vertex);
 
   GLint current_shader;
   GLint viewport_size[4];
@@ -289,11 +291,11 @@ void DirectRenderer::flush_pending(SharedRenderState* render_state, ScopedProfil
       glDepthMask(GL_TRUE);
       glUniform1f(m_uniforms.alpha_min, m_double_draw_aref);
       glUniform1f(m_uniforms.alpha_max, 10);
-      glDrawArrays(GL_TRIANGLES, offset, n_batch);
+      glDrawArrays(GL_TRIANGLES, first_vert + offset, n_batch);
       glDepthMask(GL_FALSE);
       glUniform1f(m_uniforms.alpha_min, -10);
       glUniform1f(m_uniforms.alpha_max, m_double_draw_aref);
-      glDrawArrays(GL_TRIANGLES, offset, n_batch);
+      glDrawArrays(GL_TRIANGLES, first_vert + offset, n_batch);
       offset += n_batch;
       draw_count += 2;
       num_tris += n_batch / 3;
@@ -302,7 +304,7 @@ void DirectRenderer::flush_pending(SharedRenderState* render_state, ScopedProfil
     m_test_state_needs_gl_update = true;
     m_prim_gl_state_needs_gl_update = true;
   } else {
-    glDrawArrays(GL_TRIANGLES, 0, m_prim_buffer.vert_count);
+    glDrawArrays(GL_TRIANGLES, first_vert, m_prim_buffer.vert_count);
     num_tris += m_prim_buffer.vert_count / 3;
     draw_count++;
   }
@@ -311,7 +313,7 @@ void DirectRenderer::flush_pending(SharedRenderState* render_state, ScopedProfil
     render_state->shaders[ShaderId::DEBUG_RED].activate();
     glDisable(GL_BLEND);
     glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    glDrawArrays(GL_TRIANGLES, 0, m_prim_buffer.vert_count);
+    glDrawArrays(GL_TRIANGLES, first_vert, m_prim_buffer.vert_count);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     m_blend_state_needs_gl_update = true;
     m_prim_gl_state_needs_gl_update = true;
@@ -1181,7 +1183,30 @@ int DirectRenderer::get_texture_unit_for_current_reg(SharedRenderState* render_s
     return m_current_tex_state_idx;
   }
 
-  if (m_next_free_tex_state >= TEXTURE_STATE_COUNT) {
+  // a new TEX0 often points at the texture that's already buffered (only tcc/decal/clut differ),
+  // so reuse that state instead of flushing.
+  m_stats.tex_state_lookups++;
+  bool conflict = false;
+  for (int i = 0; i < m_next_free_tex_state; i++) {
+    const auto& other = m_buffered_tex_state[i];
+    if (other.same_texture_as(m_tex_state_from_reg)) {
+      m_stats.tex_state_reuses++;
+      m_current_tex_state_idx = i;
+      return i;
+    }
+    // wrap and filter are set on the texture object, so one texture can't be buffered twice with
+    // different sampling.
+    if (other.texture_base_ptr == m_tex_state_from_reg.texture_base_ptr &&
+        other.using_mt4hh == m_tex_state_from_reg.using_mt4hh) {
+      conflict = true;
+    }
+  }
+
+  if (conflict) {
+    m_stats.flush_from_tex_conflict++;
+    flush_pending(render_state, prof);
+    return get_texture_unit_for_current_reg(render_state, prof);
+  } else if (m_next_free_tex_state >= TEXTURE_STATE_COUNT) {
     m_stats.flush_from_state_exhaust++;
     flush_pending(render_state, prof);
     return get_texture_unit_for_current_reg(render_state, prof);
@@ -1215,8 +1240,9 @@ void DirectRenderer::handle_xyzf2_common(u32 x,
   m_prim_building.building_idx++;
 
   int tex_unit = get_texture_unit_for_current_reg(render_state, prof);
-  bool tcc = m_buffered_tex_state[tex_unit].tcc;
-  bool decal = m_buffered_tex_state[tex_unit].decal;
+  // the buffered state may be shared with other registers, so these come from the register.
+  bool tcc = m_tex_state_from_reg.tcc;
+  bool decal = m_tex_state_from_reg.decal;
   bool fge = m_prim_gl_state.fogging_enable;
   bool use_uv = m_prim_gl_state.use_uv;
 
@@ -1247,18 +1273,18 @@ void DirectRenderer::handle_xyzf2_common(u32 x,
         auto& corner3_rgba = corner2_rgba;
         auto& corner4_rgba = corner2_rgba;
 
-        m_prim_buffer.push(corner1_rgba, corner1_vert, corner1_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
-        m_prim_buffer.push(corner3_rgba, corner3_vert, corner3_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
-        m_prim_buffer.push(corner2_rgba, corner2_vert, corner2_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
-        m_prim_buffer.push(corner2_rgba, corner2_vert, corner2_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
-        m_prim_buffer.push(corner4_rgba, corner4_vert, corner4_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
-        m_prim_buffer.push(corner1_rgba, corner1_vert, corner1_stq, scissor, 0, tcc, decal, fge,
-                           use_uv);
+        m_prim_buffer.push(corner1_rgba, corner1_vert, corner1_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
+        m_prim_buffer.push(corner3_rgba, corner3_vert, corner3_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
+        m_prim_buffer.push(corner2_rgba, corner2_vert, corner2_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
+        m_prim_buffer.push(corner2_rgba, corner2_vert, corner2_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
+        m_prim_buffer.push(corner4_rgba, corner4_vert, corner4_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
+        m_prim_buffer.push(corner1_rgba, corner1_vert, corner1_stq, scissor, tex_unit, tcc, decal,
+                           fge, use_uv);
         m_prim_building.building_idx = 0;
       }
     } break;
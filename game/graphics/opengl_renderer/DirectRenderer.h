@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "common/dma/gs.h"
@@ -7,6 +8,7 @@
 #include "common/util/SmallVector.h"
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 #include "game/graphics/pipelines/opengl.h"
 
 /*!
@@ -164,7 +166,10 @@ class DirectRenderer : public BucketRenderer {
     u32 ta0 = 0;
   } m_prim_gl_state;
 
-  static constexpr int TEXTURE_STATE_COUNT = 1;
+  // texture states that can be buffered before a flush. Each one gets its own texture unit
+  // (GL_TEXTURE20 + idx), and the shader picks the unit per vertex, so alternating between a few
+  // textures (font pages, HUD icons) doesn't split the draw.
+  static constexpr int TEXTURE_STATE_COUNT = 8;
 
   struct TextureState {
     GsTex0 current_register;
@@ -188,6 +193,14 @@ class DirectRenderer : public BucketRenderer {
              m_clamp_state.current_register == other.m_clamp_state.current_register &&
              enable_tex_filt == other.enable_tex_filt;
     }
+
+    // would binding other give the same OpenGL texture and sampling? tcc and decal are per-vertex,
+    // so they don't matter here.
+    bool same_texture_as(const TextureState& other) const {
+      return texture_base_ptr == other.texture_base_ptr && using_mt4hh == other.using_mt4hh &&
+             m_clamp_state.current_register == other.m_clamp_state.current_register &&
+             enable_tex_filt == other.enable_tex_filt;
+    }
   };
 
   // vertices will reference these texture states
@@ -284,7 +297,7 @@ class DirectRenderer : public BucketRenderer {
   } m_blit_buf_state;
 
   struct {
-    GLuint vertex_buffer;
+    std::unique_ptr<StreamingBuffer> vertex_stream;
     GLuint vao;
     u32 vertex_buffer_bytes = 0;
     u32 vertex_buffer_max_verts = 0;
@@ -318,6 +331,10 @@ class DirectRenderer : public BucketRenderer {
     int flush_from_clamp = 0;
     int flush_from_prim = 0;
     int flush_from_state_exhaust = 0;
+    int flush_from_tex_conflict = 0;
+
+    int tex_state_lookups = 0;
+    int tex_state_reuses = 0;
   } m_stats;
 
   bool m_prim_gl_state_needs_gl_update = true;
@@ -0,0 +1,51 @@
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// weight of each new GPU time in the average
+constexpr float kSmoothing = 0.1f;
+// frames to wait after a change, so the average is only of frames at the new scale.
+constexpr int kFramesBetweenChanges = 30;
+// go down when over this fraction of the target, and up when under the other one.
+constexpr float kHighWater = 0.95f;
+constexpr float kLowWater = 0.75f;
+// when going down, aim for this fraction of the target, to leave some headroom.
+constexpr float kDownTarget = 0.85f;
+constexpr float kMinStep = 0.05f;
+}  // namespace
+
+float DynamicResolution::update(float gpu_ms, const Settings& settings) {
+  m_scale = std::clamp(m_scale, settings.min_scale, settings.max_scale);
+  m_frames_since_change++;
+  if (gpu_ms >= 0) {
+    m_smoothed_ms =
+        m_smoothed_ms < 0 ? gpu_ms : m_smoothed_ms + (gpu_ms - m_smoothed_ms) * kSmoothing;
+  }
+  if (m_smoothed_ms < 0 || m_frames_since_change < kFramesBetweenChanges) {
+    return m_scale;
+  }
+
+  float new_scale = m_scale;
+  if (m_smoothed_ms > settings.target_ms * kHighWater) {
+    // the time goes with the number of pixels, the square of the scale.
+    float fit = m_scale * std::sqrt(settings.target_ms * kDownTarget / m_smoothed_ms);
+    new_scale = std::max(settings.min_scale, std::min(fit, m_scale - kMinStep));
+  } else if (m_smoothed_ms < settings.target_ms * kLowWater) {
+    new_scale = std::min(settings.max_scale, m_scale + kMinStep);
+  }
+
+  if (new_scale != m_scale) {
+    m_scale = new_scale;
+    m_frames_since_change = 0;
+    m_smoothed_ms = -1.f;
+  }
+  return m_scale;
+}
+
+void DynamicResolution::reset() {
+  m_scale = 1.f;
+  m_smoothed_ms = -1.f;
+  m_frames_since_change = 0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+/*!
+ * Picks the scale of the internal render resolution from the measured GPU frame time, so the GPU
+ * can hold a target frame time in heavy scenes.
+ *
+ * The GPU times arrive a few frames late, and each change reallocates the render buffers, so the
+ * scale only changes after the GPU time has been over or under the target for a while. Going down,
+ * it jumps to the scale that should fit the target, assuming the GPU time follows the pixel count.
+ * Going up, it takes small steps.
+ */
+class DynamicResolution {
+ public:
+  struct Settings {
+    float target_ms = 1000.f / 60;
+    float min_scale = 0.5f;
+    float max_scale = 1.f;
+  };
+
+  /*!
+   * Call once per frame, with the GPU time of a frame that finished since the last call, or a
+   * negative number if none did. Returns the scale to render the next frame at.
+   */
+  float update(float gpu_ms, const Settings& settings);
+  float scale() const { return m_scale; }
+  void reset();
+
+ private:
+  float m_scale = 1.f;
+  float m_smoothed_ms = -1.f;
+  int m_frames_since_change = 0;
+};
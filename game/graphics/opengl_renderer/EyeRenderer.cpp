@@ -53,12 +53,20 @@ void EyeRenderer::init_textures(TexturePool& texture_pool, GameVersion version)
   glBindBuffer(GL_ARRAY_BUFFER, m_gl_vertex_buffer);
   glBufferData(GL_ARRAY_BUFFER, VTX_BUFFER_FLOATS * sizeof(float), nullptr, GL_STREAM_DRAW);
   glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0,                  // location 0 in the shader
-                        4,                  // 2 floats per vert
-                        GL_FLOAT,           // floats
-                        GL_TRUE,            // normalized, ignored,
-                        sizeof(float) * 4,  //
-                        (void*)0            // offset in array
+  glVertexAttribPointer(0,                           // location 0 in the shader
+                        4,                           // 4 floats per vert
+                        GL_FLOAT,                    // floats
+                        GL_TRUE,                     // normalized, ignored,
+                        sizeof(float) * VTX_FLOATS,  //
+                        (void*)0                     // offset in array
+  );
+  glEnableVertexAttribArray(1);
+  glVertexAttribPointer(1,                            // location 1 in the shader
+                        1,                            // 1 float per vert
+                        GL_FLOAT,                     // floats
+                        GL_FALSE,                     // normalized, ignored,
+                        sizeof(float) * VTX_FLOATS,   //
+                        (void*)(sizeof(float) * 4)    // offset in array
   );
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
@@ -402,64 +410,43 @@ void EyeRenderer::handle_eye_dma2(DmaFollower& dma,
   m_average_time_ms = m_average_time_ms * 0.95 + time_ms * 0.05;
 }
 
+/*!
+ * Add a square as two triangles, with the same split as a triangle strip of its 4 corners.
+ */
+int add_square_to_buffer(int idx, float* data, float x0, float y0, float x1, float y1, int layer) {
+  const float corners[4][4] = {{x0, y0, 0, 0}, {x1, y0, 1, 0}, {x0, y1, 0, 1}, {x1, y1, 1, 1}};
+  for (int corner : {0, 1, 2, 2, 1, 3}) {
+    for (int i = 0; i < 4; i++) {
+      data[idx++] = corners[corner][i];
+    }
+    data[idx++] = layer;
+  }
+  return idx;
+}
+
 int add_draw_to_buffer_32(int idx,
                           const EyeRenderer::EyeDraw& draw,
                           float* data,
                           int pair,
-                          int lr) {
+                          int lr,
+                          int layer) {
   int x_off = lr * SINGLE_EYE_SIZE * 16;
   int y_off = pair * SINGLE_EYE_SIZE * 16;
-
-  data[idx++] = draw.sprite.xyz0[0] - x_off;
-  data[idx++] = draw.sprite.xyz0[1] - y_off;
-  data[idx++] = 0;
-  data[idx++] = 0;
-
-  data[idx++] = draw.sprite.xyz1[0] - x_off;
-  data[idx++] = draw.sprite.xyz0[1] - y_off;
-  data[idx++] = 1;
-  data[idx++] = 0;
-
-  data[idx++] = draw.sprite.xyz0[0] - x_off;
-  data[idx++] = draw.sprite.xyz1[1] - y_off;
-  data[idx++] = 0;
-  data[idx++] = 1;
-
-  data[idx++] = draw.sprite.xyz1[0] - x_off;
-  data[idx++] = draw.sprite.xyz1[1] - y_off;
-  data[idx++] = 1;
-  data[idx++] = 1;
-  return idx;
+  return add_square_to_buffer(idx, data, draw.sprite.xyz0[0] - x_off, draw.sprite.xyz0[1] - y_off,
+                              draw.sprite.xyz1[0] - x_off, draw.sprite.xyz1[1] - y_off, layer);
 }
 
 int add_draw_to_buffer_64(int idx,
                           const EyeRenderer::EyeDraw& draw,
                           float* data,
                           int pair,
-                          int lr) {
+                          int lr,
+                          int layer) {
   int x_off = lr * SINGLE_EYE_SIZE * 32;
   int y_off = (pair / 4) * SINGLE_EYE_SIZE * 32;
-
-  data[idx++] = (draw.sprite.xyz0[0] - x_off) / 2;
-  data[idx++] = (draw.sprite.xyz0[1] - y_off) / 2;
-  data[idx++] = 0;
-  data[idx++] = 0;
-
-  data[idx++] = (draw.sprite.xyz1[0] - x_off) / 2;
-  data[idx++] = (draw.sprite.xyz0[1] - y_off) / 2;
-  data[idx++] = 1;
-  data[idx++] = 0;
-
-  data[idx++] = (draw.sprite.xyz0[0] - x_off) / 2;
-  data[idx++] = (draw.sprite.xyz1[1] - y_off) / 2;
-  data[idx++] = 0;
-  data[idx++] = 1;
-
-  data[idx++] = (draw.sprite.xyz1[0] - x_off) / 2;
-  data[idx++] = (draw.sprite.xyz1[1] - y_off) / 2;
-  data[idx++] = 1;
-  data[idx++] = 1;
-  return idx;
+  return add_square_to_buffer(
+      idx, data, (draw.sprite.xyz0[0] - x_off) / 2, (draw.sprite.xyz0[1] - y_off) / 2,
+      (draw.sprite.xyz1[0] - x_off) / 2, (draw.sprite.xyz1[1] - y_off) / 2, layer);
 }
 
 void EyeRenderer::run_gpu(const std::vector<SingleEyeDraws>& draws,
@@ -471,37 +458,38 @@ void EyeRenderer::run_gpu(const std::vector<SingleEyeDraws>& draws,
   glBindVertexArray(m_vao);
   glBindBuffer(GL_ARRAY_BUFFER, m_gl_vertex_buffer);
 
-  // the first thing we'll do is prepare the vertices
+  // the first thing we'll do is prepare the vertices. Each eye is one draw, with only the squares
+  // that have a texture.
   int buffer_idx = 0;
+  m_first_vertex_per_draw.clear();
   for (const auto& draw : draws) {
-    if (draw.using_64) {
-      buffer_idx =
-          add_draw_to_buffer_64(buffer_idx, draw.iris, m_gpu_vertex_buffer, draw.pair, draw.lr);
-      buffer_idx =
-          add_draw_to_buffer_64(buffer_idx, draw.pupil, m_gpu_vertex_buffer, draw.pair, draw.lr);
-      buffer_idx =
-          add_draw_to_buffer_64(buffer_idx, draw.lid, m_gpu_vertex_buffer, draw.pair, draw.lr);
-    } else {
-      buffer_idx =
-          add_draw_to_buffer_32(buffer_idx, draw.iris, m_gpu_vertex_buffer, draw.pair, draw.lr);
-      buffer_idx =
-          add_draw_to_buffer_32(buffer_idx, draw.pupil, m_gpu_vertex_buffer, draw.pair, draw.lr);
-      buffer_idx =
-          add_draw_to_buffer_32(buffer_idx, draw.lid, m_gpu_vertex_buffer, draw.pair, draw.lr);
+    m_first_vertex_per_draw.push_back(buffer_idx / VTX_FLOATS);
+    const auto add = draw.using_64 ? add_draw_to_buffer_64 : add_draw_to_buffer_32;
+    if (draw.iris_tex) {
+      buffer_idx = add(buffer_idx, draw.iris, m_gpu_vertex_buffer, draw.pair, draw.lr, 0);
+    }
+    if (draw.pupil_tex) {
+      buffer_idx = add(buffer_idx, draw.pupil, m_gpu_vertex_buffer, draw.pair, draw.lr, 1);
+    }
+    if (draw.lid_tex) {
+      buffer_idx = add(buffer_idx, draw.lid, m_gpu_vertex_buffer, draw.pair, draw.lr, 2);
     }
   }
+  m_first_vertex_per_draw.push_back(buffer_idx / VTX_FLOATS);
   ASSERT(buffer_idx <= VTX_BUFFER_FLOATS);
-  int check = buffer_idx;
 
-  // maybe buffer sub data.
-  glBufferData(GL_ARRAY_BUFFER, buffer_idx * sizeof(float), m_gpu_vertex_buffer, GL_STREAM_DRAW);
+  // the buffer was allocated at the max size.
+  glBufferSubData(GL_ARRAY_BUFFER, 0, buffer_idx * sizeof(float), m_gpu_vertex_buffer);
 
   FramebufferTexturePairContext ctxt(m_gpu_eye_textures[draws.front().tex_slot()].fb);
 
   // set up common opengl state
   glDisable(GL_DEPTH_TEST);
-  render_state->shaders[ShaderId::EYE].activate();
-  glUniform1i(glGetUniformLocation(render_state->shaders[ShaderId::EYE].id(), "tex_T0"), 0);
+  const auto& shader = render_state->shaders[ShaderId::EYE];
+  shader.activate();
+  glUniform1i(glGetUniformLocation(shader.id(), "tex_T0"), 0);
+  glUniform1i(glGetUniformLocation(shader.id(), "tex_T1"), 1);
+  glUniform1i(glGetUniformLocation(shader.id(), "tex_T2"), 2);
   glActiveTexture(GL_TEXTURE0);
 
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -509,7 +497,22 @@ void EyeRenderer::run_gpu(const std::vector<SingleEyeDraws>& draws,
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
   glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-  buffer_idx = 0;
+  // the shader's second output is the pupil's alpha for the pupil and 1 for the others, so this
+  // is alpha blending for the pupil only.
+  glEnable(GL_BLEND);
+  glBlendEquation(GL_FUNC_ADD);
+  glBlendFunc(GL_SRC1_ALPHA, GL_ONE_MINUS_SRC1_ALPHA);
+
+  // eyes of the same character usually share textures, so only bind those that changed.
+  u64 bound_tex[3] = {0, 0, 0};
+  auto bind = [&](int unit, u64 tex) {
+    if (bound_tex[unit] != tex) {
+      glActiveTexture(GL_TEXTURE0 + unit);
+      glBindTexture(GL_TEXTURE_2D, tex);
+      bound_tex[unit] = tex;
+    }
+  };
+
   for (size_t draw_idx = 0; draw_idx < draws.size(); draw_idx++) {
     const auto& draw = draws[draw_idx];
     auto& out_tex = m_gpu_eye_textures[draw.tex_slot()];
@@ -523,32 +526,21 @@ void EyeRenderer::run_gpu(const std::vector<SingleEyeDraws>& draws,
     }
     glClearBufferfv(GL_COLOR, 0, clear);
 
-    // iris
+    // then iris, pupil and lid, in that order.
     if (draw.iris_tex) {
-      // set alpha
-      // set Z
-      // set texture
-      glDisable(GL_BLEND);
-      glBindTexture(GL_TEXTURE_2D, draw.iris_gl_tex);
-      glDrawArrays(GL_TRIANGLE_STRIP, buffer_idx / 4, 4);
+      bind(0, draw.iris_gl_tex);
     }
-    buffer_idx += 4 * 4;
-
     if (draw.pupil_tex) {
-      glEnable(GL_BLEND);
-      glBlendEquation(GL_FUNC_ADD);
-      glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-      glBindTexture(GL_TEXTURE_2D, draw.pupil_gl_tex);
-      glDrawArrays(GL_TRIANGLE_STRIP, buffer_idx / 4, 4);
+      bind(1, draw.pupil_gl_tex);
     }
-    buffer_idx += 4 * 4;
-
     if (draw.lid_tex) {
-      glDisable(GL_BLEND);
-      glBindTexture(GL_TEXTURE_2D, draw.lid_gl_tex);
-      glDrawArrays(GL_TRIANGLE_STRIP, buffer_idx / 4, 4);
+      bind(2, draw.lid_gl_tex);
+    }
+    const int first = m_first_vertex_per_draw[draw_idx];
+    const int count = m_first_vertex_per_draw[draw_idx + 1] - first;
+    if (count) {
+      glDrawArrays(GL_TRIANGLES, first, count);
     }
-    buffer_idx += 4 * 4;
 
     // finally, give to "vram"
     render_state->texture_pool->move_existing_to_vram(out_tex.gpu_tex, out_tex.tbp);
@@ -558,8 +550,8 @@ void EyeRenderer::run_gpu(const std::vector<SingleEyeDraws>& draws,
     }
   }
 
-  ASSERT(check == buffer_idx);
-
+  glDisable(GL_BLEND);
+  glActiveTexture(GL_TEXTURE0);
   glBindVertexArray(0);
   glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
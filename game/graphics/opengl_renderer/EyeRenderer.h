@@ -61,9 +61,11 @@ class EyeRenderer : public BucketRenderer {
     GpuEyeTex() : fb(128, 128, GL_UNSIGNED_INT_8_8_8_8_REV) {}
   } m_gpu_eye_textures[NUM_EYE_PAIRS * 2];
 
-  // xyst per vertex, 4 vertices per square, 3 draws per eye, 11 pairs of eyes, 2 eyes per pair.
-  static constexpr int VTX_BUFFER_FLOATS = 4 * 4 * 3 * NUM_EYE_PAIRS * 2;
+  // xyst and layer per vertex, 6 vertices per square, 3 squares per eye, 2 eyes per pair.
+  static constexpr int VTX_FLOATS = 5;
+  static constexpr int VTX_BUFFER_FLOATS = VTX_FLOATS * 6 * 3 * NUM_EYE_PAIRS * 2;
   float m_gpu_vertex_buffer[VTX_BUFFER_FLOATS];
+  std::vector<int> m_first_vertex_per_draw;  // one extra at the end
   GLuint m_vao;
   GLuint m_gl_vertex_buffer;
 
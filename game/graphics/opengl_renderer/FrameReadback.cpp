@@ -0,0 +1,150 @@
+#include "FrameReadback.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "common/log/log.h"
+#include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+
+namespace {
+void encode_frame(FrameReadback::Request& request, std::vector<u32>& pixels) {
+  const int width = request.width;
+  const int height = request.height;
+  // set alpha. our renderers mess this up in a way that isn't relevant to the final framebuffer.
+  for (auto& px : pixels) {
+    px |= 0xff000000;
+  }
+
+  if (request.on_pixels) {
+    request.on_pixels(width, height, pixels);
+  }
+
+  // flip upside down in place
+  for (int h = 0; h < height / 2; h++) {
+    std::swap_ranges(pixels.begin() + h * width, pixels.begin() + (h + 1) * width,
+                     pixels.begin() + (height - h - 1) * width);
+  }
+
+  try {
+    file_util::write_rgba_png(request.output_path, pixels.data(), width, height);
+  } catch (const std::exception& e) {
+    lg::error("Failed to save frame: {}", e.what());
+  }
+}
+}  // namespace
+
+FrameReadback::~FrameReadback() {
+  for (auto& slot : m_slots) {
+    if (slot.fence) {
+      finish(slot, true);
+    }
+    if (slot.pbo) {
+      glDeleteBuffers(1, &slot.pbo);
+    }
+  }
+  for (auto& encode : m_encodes) {
+    ThreadPool::global().wait(encode);
+  }
+}
+
+void FrameReadback::start(Request request) {
+  auto& slot = m_slots[m_next_slot];
+  m_next_slot = (m_next_slot + 1) % kNumBuffers;
+  if (slot.fence) {
+    finish(slot, true);
+  }
+
+  const u32 size_bytes = request.width * request.height * sizeof(u32);
+  if (!slot.pbo) {
+    glGenBuffers(1, &slot.pbo);
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+  if (slot.size_bytes != size_bytes) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size_bytes, nullptr, GL_STREAM_READ);
+    slot.size_bytes = size_bytes;
+  }
+
+  GLint oldbuf, oldreadbuf;
+  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldbuf);
+  glGetIntegerv(GL_READ_BUFFER, &oldreadbuf);
+  glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, request.fbo);
+  glReadBuffer(request.read_buffer);
+  // with a pack buffer bound, this only queues a copy into the buffer.
+  glReadPixels(request.x, request.y, request.width, request.height, GL_RGBA, GL_UNSIGNED_BYTE,
+               nullptr);
+  glReadBuffer(oldreadbuf);
+  glBindFramebuffer(GL_READ_FRAMEBUFFER, oldbuf);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  slot.request = std::move(request);
+}
+
+void FrameReadback::update() {
+  // oldest first, so frames are handed to the encoder in order.
+  for (int i = 0; i < kNumBuffers; i++) {
+    auto& slot = m_slots[(m_next_slot + i) % kNumBuffers];
+    if (slot.fence) {
+      finish(slot, false);
+    }
+  }
+
+  m_encodes.erase(std::remove_if(m_encodes.begin(), m_encodes.end(),
+                                 [](const std::future<void>& f) {
+                                   return f.wait_for(std::chrono::seconds(0)) ==
+                                          std::future_status::ready;
+                                 }),
+                  m_encodes.end());
+}
+
+bool FrameReadback::can_start_without_waiting() const {
+  return !m_slots[m_next_slot].fence && (int)m_encodes.size() < kMaxEncodes;
+}
+
+int FrameReadback::frames_in_flight() const {
+  int count = m_encodes.size();
+  for (auto& slot : m_slots) {
+    if (slot.fence) {
+      count++;
+    }
+  }
+  return count;
+}
+
+/*!
+ * Copy a finished read out of its buffer and start encoding it. If wait is false and the GPU
+ * isn't done yet, does nothing.
+ */
+void FrameReadback::finish(Slot& slot, bool wait) {
+  auto result = glClientWaitSync(slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                 wait ? 1'000'000'000 : 0);
+  if (result == GL_TIMEOUT_EXPIRED && !wait) {
+    return;
+  }
+  if (result == GL_TIMEOUT_EXPIRED || result == GL_WAIT_FAILED) {
+    lg::error("Frame readback didn't finish, the capture may be incomplete");
+  }
+  glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+
+  auto pixels = std::make_shared<std::vector<u32>>(slot.size_bytes / sizeof(u32));
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+  const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, slot.size_bytes, GL_MAP_READ_BIT);
+  if (mapped) {
+    memcpy(pixels->data(), mapped, slot.size_bytes);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  } else {
+    lg::error("Failed to map frame readback buffer");
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  if (mapped) {
+    auto request = std::make_shared<Request>(std::move(slot.request));
+    m_encodes.push_back(
+        ThreadPool::global().submit([request, pixels]() { encode_frame(*request, *pixels); }));
+  }
+  slot.request = {};
+}
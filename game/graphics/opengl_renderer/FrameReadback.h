@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+#include "third-party/glad/include/glad/glad.h"
+
+/*!
+ * Reads frames back to the CPU without stalling the GPU, for screenshots and frame capture.
+ * glReadPixels writes into one of a small ring of pixel buffer objects, and the pixels are picked
+ * up a few frames later, once the read's fence has signaled. PNG encoding runs on the thread pool.
+ */
+class FrameReadback {
+ public:
+  struct Request {
+    std::string output_path;
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+    GLuint fbo = 0;
+    int read_buffer = GL_BACK;
+    // called from a worker with the pixels (alpha set, not flipped yet) before the png is written.
+    std::function<void(int width, int height, const std::vector<u32>& pixels)> on_pixels;
+  };
+
+  FrameReadback() = default;
+  ~FrameReadback();
+  FrameReadback(const FrameReadback&) = delete;
+  FrameReadback& operator=(const FrameReadback&) = delete;
+
+  /*!
+   * Start reading back a region of a framebuffer. If every buffer in the ring is still waiting on
+   * the GPU, this waits for the oldest.
+   */
+  void start(Request request);
+
+  /*!
+   * Pick up the reads that the GPU has finished and send them to be encoded. Call once per frame.
+   */
+  void update();
+
+  /*!
+   * Can start be called without waiting on the GPU or piling up encodes?
+   */
+  bool can_start_without_waiting() const;
+
+  int frames_in_flight() const;
+
+ private:
+  static constexpr int kNumBuffers = 3;
+  static constexpr int kMaxEncodes = 8;
+
+  struct Slot {
+    GLuint pbo = 0;
+    GLsync fence = nullptr;
+    u32 size_bytes = 0;
+    Request request;
+  };
+
+  void finish(Slot& slot, bool wait);
+
+  std::array<Slot, kNumBuffers> m_slots;
+  int m_next_slot = 0;
+  std::vector<std::future<void>> m_encodes;
+};
@@ -1,8 +1,12 @@
 #include "OpenGLRenderer.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "common/goal_constants.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 
 #include "game/graphics/opengl_renderer/BlitDisplays.h"
 #include "game/graphics/opengl_renderer/DepthCue.h"
@@ -113,6 +117,7 @@ OpenGLRenderer::OpenGLRenderer(std::shared_ptr<TexturePool> texture_pool,
 
   m_merc2 = std::make_shared<Merc2>(m_render_state.shaders, anim_slot_array());
   m_generic2 = std::make_shared<Generic2>(m_render_state.shaders);
+  m_screen_copier = std::make_shared<FramebufferCopier>();
 
   // initialize all renderers
   auto p = scoped_prof("init-bucket-renderers");
@@ -347,7 +352,8 @@ void OpenGLRenderer::init_bucket_renderers_jak3() {
     init_bucket_renderer<Generic2BucketRenderer>("generic-sprite-1", BucketCategory::GENERIC,
                                                  BucketId::GENERIC_SPRITE_1, m_generic2,
                                                  Generic2::Mode::PRIM);
-    init_bucket_renderer<Sprite3>("particles", BucketCategory::SPRITE, BucketId::PARTICLES);
+    init_bucket_renderer<Sprite3>("particles", BucketCategory::SPRITE, BucketId::PARTICLES,
+                                  m_screen_copier);
     init_bucket_renderer<Generic2BucketRenderer>("generic-sprite-2", BucketCategory::GENERIC,
                                                  BucketId::GENERIC_SPRITE_2, m_generic2,
                                                  Generic2::Mode::PRIM);
@@ -361,7 +367,7 @@ void OpenGLRenderer::init_bucket_renderers_jak3() {
     init_bucket_renderer<TextureUploadHandler>("tex-warp", BucketCategory::TEX, BucketId::TEX_WARP,
                                                m_texture_animator);
     init_bucket_renderer<Warp>("generic-warp", BucketCategory::GENERIC, BucketId::GENERIC_WARP,
-                               m_generic2);
+                               m_generic2, m_screen_copier);
 
     init_bucket_renderer<TextureUploadHandler>("debug-no-zbuf1", BucketCategory::OTHER,
                                                BucketId::DEBUG_NO_ZBUF1, m_texture_animator, true);
@@ -566,13 +572,15 @@ void OpenGLRenderer::init_bucket_renderers_jak2() {
   init_bucket_renderer<OceanNear>("ocean-near", BucketCategory::OCEAN, BucketId::OCEAN_NEAR);
   init_bucket_renderer<TextureUploadHandler>("tex-all-sprite", BucketCategory::TEX,
                                              BucketId::TEX_ALL_SPRITE, m_texture_animator);
-  init_bucket_renderer<Sprite3>("particles", BucketCategory::SPRITE, BucketId::PARTICLES);
+  init_bucket_renderer<Sprite3>("particles", BucketCategory::SPRITE, BucketId::PARTICLES,
+                                  m_screen_copier);
   init_bucket_renderer<Shadow2>("shadow2", BucketCategory::OTHER, BucketId::SHADOW2);
   init_bucket_renderer<Generic2BucketRenderer>("effects", BucketCategory::OTHER, BucketId::EFFECTS,
                                                m_generic2, Generic2::Mode::LIGHTNING);
   init_bucket_renderer<TextureUploadHandler>("tex-all-warp", BucketCategory::TEX,
                                              BucketId::TEX_ALL_WARP, m_texture_animator);
-  init_bucket_renderer<Warp>("warp", BucketCategory::GENERIC, BucketId::GMERC_WARP, m_generic2);
+  init_bucket_renderer<Warp>("warp", BucketCategory::GENERIC, BucketId::GMERC_WARP, m_generic2,
+                             m_screen_copier);
   init_bucket_renderer<TextureUploadHandler>("debug-no-zbuf1", BucketCategory::OTHER,
                                              BucketId::DEBUG_NO_ZBUF1, m_texture_animator, true);
   init_bucket_renderer<TextureUploadHandler>("tex-all-map", BucketCategory::TEX,
@@ -825,7 +833,8 @@ void OpenGLRenderer::init_bucket_renderers_jak1() {
   init_bucket_renderer<TextureUploadHandler>("common-tex", BucketCategory::TEX,
                                              BucketId::PRE_SPRITE_TEX, m_texture_animator);  // 65
 
-  init_bucket_renderer<Sprite3>("sprite", BucketCategory::SPRITE, BucketId::SPRITE);  // 66
+  init_bucket_renderer<Sprite3>("sprite", BucketCategory::SPRITE, BucketId::SPRITE,
+                                m_screen_copier);  // 66
 
   init_bucket_renderer<DirectRenderer>("debug", BucketCategory::OTHER, BucketId::DEBUG, 0x20000);
   init_bucket_renderer<DirectRenderer>("debug-no-zbuf", BucketCategory::OTHER,
@@ -953,7 +962,25 @@ void OpenGLRenderer::render(DmaFollower dma, const RenderOptions& settings) {
   {
     g_current_renderer = "frame-setup";
     auto prof = m_profiler.root()->make_scoped_child("frame-setup");
-    setup_frame(settings);
+    int game_res_w = settings.game_res_w;
+    int game_res_h = settings.game_res_h;
+    m_upscale_bicubic = false;
+    if (settings.dynamic_resolution && !settings.internal_res_screenshot) {
+      DynamicResolution::Settings dynamic_settings;
+      dynamic_settings.target_ms = settings.target_frame_ms;
+      dynamic_settings.min_scale = settings.dynamic_resolution_min_scale;
+      // negative if there's no new GPU time
+      float gpu_ms = m_gpu_timers.take_frame_duration() * 1000.f;
+      float scale = m_dynamic_resolution.update(gpu_ms, dynamic_settings);
+      if (scale < 1.f) {
+        game_res_w = std::max(2, (int)std::lround(game_res_w * scale) & ~1);
+        game_res_h = std::max(2, (int)std::lround(game_res_h * scale) & ~1);
+        m_upscale_bicubic = true;
+      }
+    } else {
+      m_dynamic_resolution.reset();
+    }
+    setup_frame(settings, game_res_w, game_res_h);
     if (settings.gpu_sync) {
       glFinish();
     }
@@ -967,13 +994,17 @@ void OpenGLRenderer::render(DmaFollower dma, const RenderOptions& settings) {
       m_render_state.loader->update_blocking(*m_render_state.texture_pool);
 
     } else {
-      m_render_state.loader->update(*m_render_state.texture_pool);
+      m_render_state.loader->update(*m_render_state.texture_pool, settings.frame_slack_ms);
     }
   }
 
   // render the buckets!
   {
     auto prof = m_profiler.root()->make_scoped_child("buckets");
+    // only worth the queries if someone is looking at the results.
+    m_measure_gpu_time =
+        settings.draw_profiler_window || settings.measure_gpu_time || settings.dynamic_resolution;
+    m_bucket_prepare.enabled = settings.prepare_buckets_in_parallel;
     dispatch_buckets(dma, prof, settings.gpu_sync);
     if (m_texture_animator) {
       // if animation requests weren't made, assume the level is unloaded and the textures should
@@ -982,8 +1013,13 @@ void OpenGLRenderer::render(DmaFollower dma, const RenderOptions& settings) {
     }
   }
 
+  // The internal resolution screenshot reads the render buffer, so it needs the final frame there.
+  // Otherwise, the pcrtc pass reads the saved frame of BlitDisplays and resolves MSAA itself.
+  const bool screenshot_render_buffer =
+      settings.save_screenshot && settings.internal_res_screenshot;
+
   // blit framebuffer so that it can be used as a texture by the game later
-  {
+  if (screenshot_render_buffer) {
     g_current_renderer = "blit-display";
     auto prof = m_profiler.root()->make_scoped_child("blit-display");
     blit_display();
@@ -993,14 +1029,17 @@ void OpenGLRenderer::render(DmaFollower dma, const RenderOptions& settings) {
   {
     g_current_renderer = "pcrtc";
     auto prof = m_profiler.root()->make_scoped_child("pcrtc");
-    do_pcrtc_effects(settings.pmode_alp_register, &m_render_state, prof);
+    do_pcrtc_effects(settings.pmode_alp_register, screenshot_render_buffer, &m_render_state, prof);
     if (settings.gpu_sync) {
       glFinish();
     }
   }
+  m_gpu_timers.end_frame();
 
   m_last_pmode_alp = settings.pmode_alp_register;
 
+  m_frame_readback.update();
+
   if (settings.save_screenshot) {
     g_current_renderer = "screenshot";
     auto prof = m_profiler.root()->make_scoped_child("screenshot");
@@ -1034,6 +1073,12 @@ void OpenGLRenderer::render(DmaFollower dma, const RenderOptions& settings) {
                       settings.quick_screenshot);
   }
 
+  if (m_frame_capture.enabled) {
+    g_current_renderer = "frame-capture";
+    auto prof = m_profiler.root()->make_scoped_child("frame-capture");
+    capture_frame(settings);
+  }
+
   if (settings.draw_render_debug_window) {
     g_current_renderer = "render-window";
     auto prof = m_profiler.root()->make_scoped_child("render-window");
@@ -1100,11 +1145,33 @@ void OpenGLRenderer::draw_renderer_selection_window() {
   ImGui::Begin("Renderer Debug");
 
   ImGui::Checkbox("Use old single-draw", &m_render_state.no_multidraw);
+  ImGui::Checkbox("GPU background culling", &m_render_state.gpu_background_culling);
+  ImGui::Checkbox("Partial screen copies", &m_render_state.partial_screen_copies);
   ImGui::SliderFloat("Fog Adjust", &m_render_state.fog_intensity, 0, 10);
   ImGui::Checkbox("Sky CPU", &m_render_state.use_sky_cpu);
   ImGui::Checkbox("Occlusion Cull", &m_render_state.use_occlusion_culling);
   ImGui::Checkbox("Blackout Loads", &m_enable_fast_blackout_loads);
 
+  if (ImGui::TreeNode("Frame Capture")) {
+    ImGui::InputText("Directory", &m_frame_capture.dir);
+    ImGui::InputInt("Every N frames", &m_frame_capture.interval);
+    m_frame_capture.interval = std::max(1, m_frame_capture.interval);
+    if (ImGui::Checkbox("Capture", &m_frame_capture.enabled) && m_frame_capture.enabled) {
+      if (m_frame_capture.dir.empty()) {
+        m_frame_capture.dir = (file_util::get_user_screenshots_dir(m_version) /
+                               fmt::format("capture-{}",
+                                           str_util::current_local_timestamp_no_colons()))
+                                  .string();
+      }
+      file_util::create_dir_if_needed(m_frame_capture.dir);
+      m_frame_capture.saved = 0;
+      m_frame_capture.dropped = 0;
+    }
+    ImGui::Text("saved: %d dropped: %d in flight: %d", m_frame_capture.saved,
+                m_frame_capture.dropped, m_frame_readback.frames_in_flight());
+    ImGui::TreePop();
+  }
+
   if (m_texture_animator && ImGui::TreeNode("Texture Animator")) {
     m_texture_animator->draw_debug_window();
     ImGui::TreePop();
@@ -1149,7 +1216,7 @@ void OpenGLRenderer::draw_renderer_selection_window() {
 /*!
  * Pre-render frame setup.
  */
-void OpenGLRenderer::setup_frame(const RenderOptions& settings) {
+void OpenGLRenderer::setup_frame(const RenderOptions& settings, int game_res_w, int game_res_h) {
   // SDL controls the window framebuffer, so we just update the size:
   auto& window_fb = m_fbo_state.resources.window;
 
@@ -1165,10 +1232,10 @@ void OpenGLRenderer::setup_frame(const RenderOptions& settings) {
 
   // see if the render FBO is still applicable
   if (settings.save_screenshot || window_resized || !m_fbo_state.render_fbo ||
-      !m_fbo_state.render_fbo->matches(settings.game_res_w, settings.game_res_h,
+      !m_fbo_state.render_fbo->matches(game_res_w, game_res_h,
                                        settings.msaa_samples)) {
     // doesn't match, set up a new one for these settings
-    lg::info("FBO Setup: requested {}x{}, msaa {}", settings.game_res_w, settings.game_res_h,
+    lg::info("FBO Setup: requested {}x{}, msaa {}", game_res_w, game_res_h,
              settings.msaa_samples);
 
     // clear old framebuffers
@@ -1180,25 +1247,25 @@ void OpenGLRenderer::setup_frame(const RenderOptions& settings) {
 
     // create a fbo to render to, with the desired settings
     m_fbo_state.resources.render_buffer =
-        make_fbo(settings.game_res_w, settings.game_res_h, settings.msaa_samples, true);
+        make_fbo(game_res_w, game_res_h, settings.msaa_samples, true);
     m_fbo_state.render_fbo = &m_fbo_state.resources.render_buffer;
 
     if (settings.msaa_samples != 1) {
-      lg::info("FBO Setup: using second temporary buffer: res: {}x{}", settings.game_res_w,
-               settings.game_res_h);
+      lg::info("FBO Setup: using second temporary buffer: res: {}x{}", game_res_w,
+               game_res_h);
 
       // we'll need a temporary fbo to do the msaa resolve step
       // non-multisampled, and doesn't need z/stencil
       m_fbo_state.resources.resolve_buffer =
-          make_fbo(settings.game_res_w, settings.game_res_h, 1, false);
+          make_fbo(game_res_w, game_res_h, 1, false);
     } else {
       lg::info("FBO Setup: not using second temporary buffer");
     }
   }
 
-  ASSERT_MSG(settings.game_res_w > 0 && settings.game_res_h > 0,
-             fmt::format("Bad viewport size from game_res: {}x{}\n", settings.game_res_w,
-                         settings.game_res_h));
+  ASSERT_MSG(game_res_w > 0 && game_res_h > 0,
+             fmt::format("Bad viewport size from game_res: {}x{}\n", game_res_w,
+                         game_res_h));
 
   ASSERT_MSG(!m_fbo_state.render_fbo->is_window, "window fbo");
 
@@ -1244,9 +1311,9 @@ void OpenGLRenderer::setup_frame(const RenderOptions& settings) {
 
   m_render_state.render_fb_x = 0;
   m_render_state.render_fb_y = 0;
-  m_render_state.render_fb_w = settings.game_res_w;
-  m_render_state.render_fb_h = settings.game_res_h;
-  glViewport(0, 0, settings.game_res_w, settings.game_res_h);
+  m_render_state.render_fb_w = game_res_w;
+  m_render_state.render_fb_h = game_res_h;
+  glViewport(0, 0, game_res_w, game_res_h);
 }
 
 void OpenGLRenderer::dispatch_buckets_jak1(DmaFollower dma,
@@ -1283,6 +1350,7 @@ void OpenGLRenderer::dispatch_buckets_jak1(DmaFollower dma,
   // now we should point to the first bucket!
   ASSERT(dma.current_tag_offset() == m_render_state.next_bucket);
   m_render_state.next_bucket += 16;
+  start_bucket_prepares(dma, m_render_state.buckets_base);
 
   // loop over the buckets!
   for (size_t bucket_id = 0; bucket_id < m_bucket_renderers.size(); bucket_id++) {
@@ -1290,7 +1358,14 @@ void OpenGLRenderer::dispatch_buckets_jak1(DmaFollower dma,
     auto bucket_prof = prof.make_scoped_child(renderer->name_and_id());
     g_current_renderer = renderer->name_and_id();
     // lg::info("Render: {} start", g_current_renderer);
+    wait_for_bucket_prepare(bucket_id);
+    m_gpu_timers.begin_bucket(bucket_id);
     renderer->render(dma, &m_render_state, bucket_prof);
+    m_gpu_timers.end_bucket(bucket_id);
+    start_next_bucket_prepare();
+    if (m_measure_gpu_time) {
+      bucket_prof.set_gpu_time(m_gpu_timers.last_duration(bucket_id));
+    }
     if (sync_after_buckets) {
       auto pp = scoped_prof("finish");
       glFinish();
@@ -1324,13 +1399,21 @@ void OpenGLRenderer::dispatch_buckets_jak2(DmaFollower dma,
   m_render_state.next_bucket = m_render_state.buckets_base + 16;
   m_render_state.bucket_for_vis_copy = (int)jak2::BucketId::BUCKET_2;
   m_render_state.num_vis_to_copy = jak2::LEVEL_MAX;
+  start_bucket_prepares(dma, m_render_state.buckets_base);
 
   for (size_t bucket_id = 0; bucket_id < m_bucket_renderers.size(); bucket_id++) {
     auto& renderer = m_bucket_renderers[bucket_id];
     auto bucket_prof = prof.make_scoped_child(renderer->name_and_id());
     g_current_renderer = renderer->name_and_id();
     // lg::info("Render: {} start", g_current_renderer);
+    wait_for_bucket_prepare(bucket_id);
+    m_gpu_timers.begin_bucket(bucket_id);
     renderer->render(dma, &m_render_state, bucket_prof);
+    m_gpu_timers.end_bucket(bucket_id);
+    start_next_bucket_prepare();
+    if (m_measure_gpu_time) {
+      bucket_prof.set_gpu_time(m_gpu_timers.last_duration(bucket_id));
+    }
     if (sync_after_buckets) {
       auto pp = scoped_prof("finish");
       glFinish();
@@ -1366,13 +1449,21 @@ void OpenGLRenderer::dispatch_buckets_jak3(DmaFollower dma,
   m_render_state.next_bucket = m_render_state.buckets_base + 16;
   m_render_state.bucket_for_vis_copy = (int)jak3::BucketId::BUCKET_2;
   m_render_state.num_vis_to_copy = jak3::LEVEL_MAX;
+  start_bucket_prepares(dma, m_render_state.buckets_base);
 
   for (size_t bucket_id = 0; bucket_id < m_bucket_renderers.size(); bucket_id++) {
     auto& renderer = m_bucket_renderers[bucket_id];
     auto bucket_prof = prof.make_scoped_child(renderer->name_and_id());
     g_current_renderer = renderer->name_and_id();
     // lg::info("Render: {} start", g_current_renderer);
+    wait_for_bucket_prepare(bucket_id);
+    m_gpu_timers.begin_bucket(bucket_id);
     renderer->render(dma, &m_render_state, bucket_prof);
+    m_gpu_timers.end_bucket(bucket_id);
+    start_next_bucket_prepare();
+    if (m_measure_gpu_time) {
+      bucket_prof.set_gpu_time(m_gpu_timers.last_duration(bucket_id));
+    }
     if (sync_after_buckets) {
       auto pp = scoped_prof("finish");
       glFinish();
@@ -1397,6 +1488,55 @@ void OpenGLRenderer::dispatch_buckets_jak3(DmaFollower dma,
   // TODO ending data.
 }
 
+/*!
+ * Start running prepare() for the buckets that support it, ahead of the render thread.
+ * Bucket i's DMA starts at buckets_base + 16 * i and ends at the next bucket.
+ */
+void OpenGLRenderer::start_bucket_prepares(const DmaFollower& dma, u32 buckets_base) {
+  m_bucket_prepare.buckets.clear();
+  m_bucket_prepare.next = 0;
+  m_bucket_prepare.pending.clear();
+  m_bucket_prepare.pending.resize(m_bucket_renderers.size());
+  if (!m_bucket_prepare.enabled) {
+    return;
+  }
+
+  m_bucket_prepare.dma_base = dma.base();
+  m_bucket_prepare.buckets_base = buckets_base;
+  for (size_t bucket_id = 0; bucket_id < m_bucket_renderers.size(); bucket_id++) {
+    if (m_bucket_renderers[bucket_id]->can_prepare()) {
+      m_bucket_prepare.buckets.push_back(bucket_id);
+    }
+  }
+  for (int i = 0; i < kMaxBucketPreparesInFlight; i++) {
+    start_next_bucket_prepare();
+  }
+}
+
+void OpenGLRenderer::start_next_bucket_prepare() {
+  if (m_bucket_prepare.next >= m_bucket_prepare.buckets.size()) {
+    return;
+  }
+  const int bucket_id = m_bucket_prepare.buckets[m_bucket_prepare.next++];
+  auto* renderer = m_bucket_renderers[bucket_id].get();
+  const void* dma_base = m_bucket_prepare.dma_base;
+  const u32 bucket_start = m_bucket_prepare.buckets_base + 16 * bucket_id;
+  const GameVersion version = m_version;
+  m_bucket_prepare.pending[bucket_id] = ThreadPool::global().submit([=]() {
+    auto p = scoped_prof("bucket-prepare");
+    DmaFollower bucket_dma(dma_base, bucket_start);
+    renderer->prepare(bucket_dma, bucket_start + 16, version);
+  });
+}
+
+void OpenGLRenderer::wait_for_bucket_prepare(int bucket_id) {
+  auto& pending = m_bucket_prepare.pending.at(bucket_id);
+  if (pending.valid()) {
+    auto p = scoped_prof("wait-for-prepare");
+    ThreadPool::global().wait(pending);
+  }
+}
+
 /*!
  * This function finds buckets and dispatches them to the appropriate part.
  */
@@ -1407,6 +1547,10 @@ void OpenGLRenderer::dispatch_buckets(DmaFollower dma,
 
   m_render_state.version = m_version;
   m_render_state.frame_idx++;
+  if (m_measure_gpu_time) {
+    // and one more for the pcrtc pass
+    m_gpu_timers.begin_frame(m_bucket_renderers.size() + 1);
+  }
   switch (m_version) {
     case GameVersion::Jak1:
       dispatch_buckets_jak1(dma, prof, sync_after_buckets);
@@ -1523,7 +1667,8 @@ void copy_texture_to_clipboard(int width, int height, const std::vector<u32>& te
 #endif
 
 /*!
- * Take a screenshot!
+ * Take a screenshot! The pixels are read back asynchronously, so the file is written a few frames
+ * later.
  */
 void OpenGLRenderer::finish_screenshot(const std::string& output_name,
                                        int width,
@@ -1533,47 +1678,79 @@ void OpenGLRenderer::finish_screenshot(const std::string& output_name,
                                        GLuint fbo,
                                        int read_buffer,
                                        bool quick_screenshot) {
-  std::vector<u32> buffer(width * height);
-  glPixelStorei(GL_PACK_ALIGNMENT, 1);
-  GLint oldbuf, oldreadbuf;
-  glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &oldbuf);
-  glGetIntegerv(GL_READ_BUFFER, &oldreadbuf);
-  glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
-  glReadBuffer(read_buffer);
-  glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, buffer.data());
-
-  // set alpha. our renderers mess this up in a way that isn't relevant to the final framebuffer.
-  for (auto& px : buffer) {
-    px |= 0xff000000;
-  }
+  FrameReadback::Request request;
+  request.output_path = output_name;
+  request.x = x;
+  request.y = y;
+  request.width = width;
+  request.height = height;
+  request.fbo = fbo;
+  request.read_buffer = read_buffer;
 
 #ifdef _WIN32
   if (quick_screenshot) {
     // copy to clipboard (windows only)
-    copy_texture_to_clipboard(width, height, buffer);
+    request.on_pixels = [](int w, int h, const std::vector<u32>& pixels) {
+      copy_texture_to_clipboard(w, h, pixels);
+    };
   }
 #else
   (void)quick_screenshot;
   lg::error("screenshot to clipboard NYI non-Windows");
 #endif
 
-  // flip upside down in place
-  for (int h = 0; h < height / 2; h++) {
-    for (int w = 0; w < width; w++) {
-      std::swap(buffer[h * width + w], buffer[(height - h - 1) * width + w]);
-    }
+  m_frame_readback.start(std::move(request));
+}
+
+/*!
+ * Save every Nth frame of the window, if frame capture is on. Frames are dropped instead of
+ * stalling if the readback or encoding falls behind.
+ */
+void OpenGLRenderer::capture_frame(const RenderOptions& settings) {
+  if (!m_frame_capture.enabled || m_render_state.frame_idx % m_frame_capture.interval) {
+    return;
+  }
+  if (!m_frame_readback.can_start_without_waiting()) {
+    m_frame_capture.dropped++;
+    return;
   }
 
-  file_util::write_rgba_png(output_name, buffer.data(), width, height);
-  glReadBuffer(oldreadbuf);
-  glBindFramebuffer(GL_READ_FRAMEBUFFER, oldbuf);
+  FrameReadback::Request request;
+  request.output_path =
+      (fs::path(m_frame_capture.dir) / fmt::format("{:06d}.png", m_frame_capture.saved)).string();
+  request.x = m_render_state.draw_offset_x;
+  request.y = m_render_state.draw_offset_y;
+  request.width = settings.draw_region_width;
+  request.height = settings.draw_region_height;
+  request.fbo = 0;  // window
+  request.read_buffer = GL_BACK;
+  m_frame_readback.start(std::move(request));
+  m_frame_capture.saved++;
 }
 
+/*!
+ * Draw the frame to the window, in one pass that resolves MSAA, scales to the draw region, and
+ * applies the PCRTC brightness. If resolve_render_buffer is set, the resolve buffer is filled too.
+ */
 void OpenGLRenderer::do_pcrtc_effects(float alp,
+                                      bool resolve_render_buffer,
                                       SharedRenderState* render_state,
                                       ScopedProfilerNode& prof) {
-  Fbo* window_blit_src = nullptr;
-  if (m_fbo_state.resources.resolve_buffer.valid) {
+  const int timer_idx = m_bucket_renderers.size();
+  m_gpu_timers.begin_bucket(timer_idx);
+
+  const Fbo* src = m_fbo_state.render_fbo;
+  ASSERT(src->tex_id);
+  GLuint src_tex = *src->tex_id;
+  int samples = src->multisampled ? src->multisample_count : 0;
+
+  // if BlitDisplays skipped copying the saved frame back, draw it from its texture instead.
+  auto saved_frame =
+      m_blit_displays ? m_blit_displays->take_copy_back_texture(render_state) : std::nullopt;
+  if (saved_frame) {
+    src_tex = *saved_frame;
+    samples = 0;
+  } else if (resolve_render_buffer && m_fbo_state.resources.resolve_buffer.valid) {
     glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo_state.render_fbo->fbo_id);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo_state.resources.resolve_buffer.fbo_id);
     glBlitFramebuffer(0,                                            // srcX0
@@ -1587,35 +1764,26 @@ void OpenGLRenderer::do_pcrtc_effects(float alp,
                       GL_COLOR_BUFFER_BIT,                          // mask
                       GL_LINEAR                                     // filter
     );
-    window_blit_src = &m_fbo_state.resources.resolve_buffer;
-  } else {
-    window_blit_src = &m_fbo_state.resources.render_buffer;
+    src = &m_fbo_state.resources.resolve_buffer;
+    src_tex = *src->tex_id;
+    samples = 0;
   }
 
-  glBindFramebuffer(GL_READ_FRAMEBUFFER, window_blit_src->fbo_id);
-  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
-  glBlitFramebuffer(0,                                                          // srcX0
-                    0,                                                          // srcY0
-                    window_blit_src->width,                                     // srcX1
-                    window_blit_src->height,                                    // srcY1
-                    render_state->draw_offset_x,                                // dstX0
-                    render_state->draw_offset_y,                                // dstY0
-                    render_state->draw_offset_x + render_state->draw_region_w,  // dstX1
-                    render_state->draw_offset_y + render_state->draw_region_h,  // dstY1
-                    GL_COLOR_BUFFER_BIT,                                        // mask
-                    GL_LINEAR                                                   // filter
-  );
   glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-  if (alp < 1) {
-    glDisable(GL_DEPTH_TEST);
-    glEnable(GL_BLEND);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
-    glBlendEquation(GL_FUNC_ADD);
-    glViewport(0, 0, m_fbo_state.resources.window.width, m_fbo_state.resources.window.height);
-
-    m_blackout_renderer.draw(Vector4f(0, 0, 0, 1.f - alp), render_state, prof);
-
-    glEnable(GL_DEPTH_TEST);
+  glViewport(render_state->draw_offset_x, render_state->draw_offset_y, render_state->draw_region_w,
+             render_state->draw_region_h);
+  glDisable(GL_DEPTH_TEST);
+  glDisable(GL_BLEND);
+  // the saved frame is the same size as the render buffer.
+  const bool scaled =
+      src->width != render_state->draw_region_w || src->height != render_state->draw_region_h;
+  m_blackout_renderer.draw_texture(src_tex, samples, scaled, scaled && m_upscale_bicubic,
+                                   std::clamp(alp, 0.f, 1.f), render_state, prof);
+  glViewport(0, 0, m_fbo_state.resources.window.width, m_fbo_state.resources.window.height);
+  glEnable(GL_DEPTH_TEST);
+
+  m_gpu_timers.end_bucket(timer_idx);
+  if (m_measure_gpu_time) {
+    prof.set_gpu_time(m_gpu_timers.last_duration(timer_idx));
   }
 }
@@ -1,13 +1,16 @@
 #pragma once
 
 #include <array>
+#include <future>
 #include <memory>
 
 #include "common/dma/dma_chain_read.h"
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
 #include "game/graphics/opengl_renderer/CollideMeshRenderer.h"
+#include "game/graphics/opengl_renderer/DynamicResolution.h"
 #include "game/graphics/opengl_renderer/Fbo.h"
+#include "game/graphics/opengl_renderer/FrameReadback.h"
 #include "game/graphics/opengl_renderer/Profiler.h"
 #include "game/graphics/opengl_renderer/Shader.h"
 #include "game/graphics/opengl_renderer/TextureAnimator.h"
@@ -30,6 +33,12 @@ struct RenderOptions {
   int game_res_w = 640;
   int game_res_h = 480;
 
+  // lower the internal resolution when the GPU can't hold the target frame time, down to
+  // dynamic_resolution_min_scale of game_res_w/h. The frame is upscaled to the window.
+  bool dynamic_resolution = false;
+  float dynamic_resolution_min_scale = 0.5f;
+  float target_frame_ms = 1000.f / 60;
+
   // size of the window's framebuffer (framebuffer 0)
   // The renderer needs to know this to do an optimization to render directly to the window's
   // framebuffer when possible.
@@ -51,6 +60,17 @@ struct RenderOptions {
   // when enabled, does a `glFinish()` after each major rendering pass. This blocks until the GPU
   // is done working, making it easier to profile GPU utilization.
   bool gpu_sync = false;
+
+  // the DMA chain is a copy that the game won't modify while we render, so buckets can process
+  // their DMA ahead of time on other threads.
+  bool prepare_buckets_in_parallel = false;
+
+  // measure the GPU time of each bucket, even if the profiler window isn't open.
+  bool measure_gpu_time = false;
+
+  // how long the render thread waited last frame (for DMA, the frame limiter and vsync), or -1.
+  // The loader uses part of it for uploads.
+  float frame_slack_ms = -1;
 };
 
 /*!
@@ -70,14 +90,23 @@ class OpenGLRenderer {
   // the graphics system.
   void render(DmaFollower dma, const RenderOptions& settings);
 
+  // timings of the last frame, by bucket.
+  Profiler& profiler() { return m_profiler; }
+
  private:
-  void setup_frame(const RenderOptions& settings);
+  void setup_frame(const RenderOptions& settings, int game_res_w, int game_res_h);
   void dispatch_buckets(DmaFollower dma, ScopedProfilerNode& prof, bool sync_after_buckets);
   void dispatch_buckets_jak1(DmaFollower dma, ScopedProfilerNode& prof, bool sync_after_buckets);
   void dispatch_buckets_jak2(DmaFollower dma, ScopedProfilerNode& prof, bool sync_after_buckets);
   void dispatch_buckets_jak3(DmaFollower dma, ScopedProfilerNode& prof, bool sync_after_buckets);
-
-  void do_pcrtc_effects(float alp, SharedRenderState* render_state, ScopedProfilerNode& prof);
+  void start_bucket_prepares(const DmaFollower& dma, u32 buckets_base);
+  void start_next_bucket_prepare();
+  void wait_for_bucket_prepare(int bucket_id);
+
+  void do_pcrtc_effects(float alp,
+                        bool resolve_render_buffer,
+                        SharedRenderState* render_state,
+                        ScopedProfilerNode& prof);
   void blit_display();
   void init_bucket_renderers_jak1();
   void init_bucket_renderers_jak2();
@@ -91,6 +120,7 @@ class OpenGLRenderer {
                          GLuint fbo,
                          int read_buffer,
                          bool quick_screenshot);
+  void capture_frame(const RenderOptions& settings);
   template <typename T, typename U, class... Args>
   T* init_bucket_renderer(const std::string& name, BucketCategory cat, U id, Args&&... args) {
     auto renderer = std::make_unique<T>(name, (int)id, std::forward<Args>(args)...);
@@ -112,12 +142,30 @@ class OpenGLRenderer {
 
   std::shared_ptr<Merc2> m_merc2;
   std::shared_ptr<Generic2> m_generic2;
+  // the copy of the framebuffer that warp and sprite distort sample.
+  std::shared_ptr<FramebufferCopier> m_screen_copier;
   std::shared_ptr<TextureAnimator> m_texture_animator;
   std::vector<std::unique_ptr<BucketRenderer>> m_bucket_renderers;
   std::vector<BucketCategory> m_bucket_categories;
   class BlitDisplays* m_blit_displays = nullptr;
 
   std::array<float, (int)BucketCategory::MAX_CATEGORIES> m_category_times;
+  GpuBucketTimers m_gpu_timers;
+  bool m_measure_gpu_time = false;
+  DynamicResolution m_dynamic_resolution;
+  bool m_upscale_bicubic = false;
+
+  // buckets that can prepare() run up to this many buckets ahead of the render thread. Each one in
+  // flight holds its own copy of the renderer's buffers, so this is mostly a memory limit.
+  static constexpr int kMaxBucketPreparesInFlight = 4;
+  struct {
+    bool enabled = false;
+    const void* dma_base = nullptr;
+    u32 buckets_base = 0;
+    std::vector<int> buckets;
+    size_t next = 0;
+    std::vector<std::future<void>> pending;  // by bucket id
+  } m_bucket_prepare;
   FullScreenDraw m_blackout_renderer;
   CollideMeshRenderer m_collide_renderer;
 
@@ -125,6 +173,15 @@ class OpenGLRenderer {
   bool m_enable_fast_blackout_loads = true;
   std::string m_renderer_filter = "";
 
+  FrameReadback m_frame_readback;
+  struct {
+    bool enabled = false;
+    int interval = 1;
+    std::string dir;
+    int saved = 0;
+    int dropped = 0;
+  } m_frame_capture;
+
   struct FboState {
     struct {
       Fbo window;          // provided by glfw
@@ -21,12 +21,19 @@ void ProfilerNode::finish() {
   } else {
     m_stats.duration = m_timer.getSeconds();
     float total_child_time = 0;
+    float total_child_gpu_time = -1;
     for (const auto& child : m_children) {
       if (!child.finished()) {
         lg::error("finish() not called on {}", child.name());
       }
       total_child_time += child.m_stats.duration;
       m_stats.add_draw_stats(child.m_stats);
+      if (child.m_stats.gpu_duration >= 0) {
+        total_child_gpu_time = std::max(total_child_gpu_time, 0.f) + child.m_stats.gpu_duration;
+      }
+    }
+    if (m_stats.gpu_duration < 0) {
+      m_stats.gpu_duration = total_child_gpu_time;
     }
 
     if (!m_children.empty()) {
@@ -75,6 +82,8 @@ void Profiler::clear() {
 
 void Profiler::finish() {
   m_root.finish();
+  prof().frame_marker(m_root.m_stats.duration, m_root.m_stats.draw_calls,
+                      m_root.m_stats.triangles);
 }
 
 void Profiler::draw() {
@@ -110,6 +119,9 @@ void Profiler::draw_node(ProfilerNode& node, bool expand, int depth, float start
   auto str =
       fmt::format("{:20s} {:.2f}ms {:6d} tri {:4d} draw", node.m_name, node.m_stats.duration * 1000,
                   node.m_stats.triangles, node.m_stats.draw_calls);
+  if (node.m_stats.gpu_duration >= 0) {
+    str += fmt::format(" {:.2f}ms gpu", node.m_stats.gpu_duration * 1000);
+  }
   if (node.m_children.empty()) {
     ImGui::Text("   %s", str.c_str());
     color_orange = ImGui::IsItemHovered();
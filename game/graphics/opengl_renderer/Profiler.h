@@ -13,7 +13,8 @@
 enum class ProfilerSort { NONE = 0, TIME = 1, DRAW_CALLS = 2, TRIANGLES = 3 };
 
 struct ProfilerStats {
-  float duration = 0;  // seconds
+  float duration = 0;       // seconds
+  float gpu_duration = -1;  // seconds, negative if it wasn't measured
   u32 draw_calls = 0;
   u32 triangles = 0;
 
@@ -38,8 +39,10 @@ class ProfilerNode {
 
   void add_draw_call(int count = 1) { m_stats.draw_calls += count; }
   void add_tri(int count = 1) { m_stats.triangles += count; }
+  void set_gpu_time(float seconds) { m_stats.gpu_duration = seconds; }
   float get_elapsed_time() const { return m_timer.getSeconds(); }
   const ProfilerStats& stats() const { return m_stats; }
+  const std::vector<ProfilerNode>& children() const { return m_children; }
 
  private:
   friend class Profiler;
@@ -66,6 +69,7 @@ class ScopedProfilerNode {
 
   void add_draw_call(int count = 1) { m_node->add_draw_call(count); }
   void add_tri(int count = 1) { m_node->add_tri(count); }
+  void set_gpu_time(float seconds) { m_node->set_gpu_time(seconds); }
   float get_elapsed_time() const { return m_node->get_elapsed_time(); }
 
  private:
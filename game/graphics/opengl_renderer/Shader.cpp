@@ -1,88 +1,269 @@
 #include "Shader.h"
 
+#include "common/global_profiler/GlobalProfiler.h"
+#include "common/global_profiler/Telemetry.h"
 #include "common/log/log.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/Timer.h"
+#include "common/util/hash.h"
 
 #include "game/graphics/pipelines/opengl.h"
 
-Shader::Shader(const std::string& shader_name, GameVersion version) : m_name(shader_name) {
-  const std::string height_scale = version == GameVersion::Jak1 ? "1.0" : "0.5";
-  const std::string scissor_height = version == GameVersion::Jak1 ? "448.0" : "416.0";
-  const std::string scissor_adjust = "512.0 / " + scissor_height;
+namespace {
+struct ProgramCacheHeader {
+  u32 magic;
+  u32 binary_format;
+  u64 key;
+  u64 binary_size;
+};
+constexpr u32 kProgramCacheMagic = 0x43505347;  // GSPC
 
-  // read the shader source
-  auto vert_src =
-      file_util::read_text_file(file_util::get_file_path({shader_folder, shader_name + ".vert"}));
-  auto frag_src =
-      file_util::read_text_file(file_util::get_file_path({shader_folder, shader_name + ".frag"}));
+const char* stage_name(GLint type) {
+  switch (type) {
+    case GL_VERTEX_SHADER:
+      return "vertex";
+    case GL_FRAGMENT_SHADER:
+      return "fragment";
+    case GL_COMPUTE_SHADER:
+      return "compute";
+    default:
+      return "unknown";
+  }
+}
+}  // namespace
 
-  vert_src = std::regex_replace(vert_src, std::regex("HEIGHT_SCALE"), height_scale);
-  vert_src = std::regex_replace(vert_src, std::regex("SCISSOR_HEIGHT"), scissor_height);
-  frag_src = std::regex_replace(frag_src, std::regex("SCISSOR_HEIGHT"), scissor_height);
-  vert_src = std::regex_replace(vert_src, std::regex("SCISSOR_ADJUST"), "(" + scissor_adjust + ")");
+/*!
+ * Linked programs from previous runs, stored with glGetProgramBinary so startup doesn't have to
+ * compile every shader again. There's one file per shader, and the key covers the driver and the
+ * final shader source, so a driver update or a shader change just misses the cache.
+ */
+class ShaderProgramCache {
+ public:
+  explicit ShaderProgramCache(GameVersion version) {
+    GLint num_formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+    m_enabled = num_formats > 0;
+    if (!m_enabled) {
+      lg::info("Driver has no program binary formats, shaders won't be cached");
+      return;
+    }
+    auto gl_string = [](GLenum name) {
+      const char* str = (const char*)glGetString(name);
+      return std::string(str ? str : "");
+    };
+    m_driver = gl_string(GL_VENDOR) + "\n" + gl_string(GL_RENDERER) + "\n" + gl_string(GL_VERSION);
+    m_dir = file_util::get_user_misc_dir(version) / "shader-cache";
+  }
 
-  m_vert_shader = glCreateShader(GL_VERTEX_SHADER);
-  const char* src = vert_src.c_str();
-  glShaderSource(m_vert_shader, 1, &src, nullptr);
-  glCompileShader(m_vert_shader);
+  bool enabled() const { return m_enabled; }
 
-  constexpr int len = 1024;
-  int compile_ok;
-  char err[len];
+  u64 key(const std::string& source) const { return hash_util::hash64(m_driver + "\n" + source); }
 
-  glGetShaderiv(m_vert_shader, GL_COMPILE_STATUS, &compile_ok);
-  if (!compile_ok) {
-    glGetShaderInfoLog(m_vert_shader, len, nullptr, err);
-    lg::error("Failed to compile vertex shader {}:\n{}", shader_name.c_str(), err);
-    m_is_okay = false;
-    return;
+  /*!
+   * Try to set up the program from the cached binary. Returns false if there's no entry, it's for
+   * different source, or the driver won't take it. The program can still be compiled and linked
+   * as usual afterward.
+   */
+  bool load(u64 program, const std::string& name, u64 key) const {
+    if (!m_enabled) {
+      return false;
+    }
+    auto path = entry_path(name);
+    std::vector<u8> data;
+    try {
+      if (!fs::exists(path)) {
+        return false;
+      }
+      data = file_util::read_binary_file(path);
+    } catch (std::exception& e) {
+      lg::warn("Failed to read cached program for {}: {}", name, e.what());
+      return false;
+    }
+
+    ProgramCacheHeader header;
+    if (data.size() < sizeof(header)) {
+      return false;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != kProgramCacheMagic || header.key != key ||
+        header.binary_size != data.size() - sizeof(header)) {
+      return false;
+    }
+
+    glProgramBinary(program, header.binary_format, data.data() + sizeof(header),
+                    header.binary_size);
+    GLint ok = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+      lg::info("Driver rejected the cached program for {}, compiling it", name);
+    }
+    return ok;
   }
 
-  m_frag_shader = glCreateShader(GL_FRAGMENT_SHADER);
-  src = frag_src.c_str();
-  glShaderSource(m_frag_shader, 1, &src, nullptr);
-  glCompileShader(m_frag_shader);
+  void save(u64 program, const std::string& name, u64 key) const {
+    if (!m_enabled) {
+      return;
+    }
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+      return;
+    }
+    ProgramCacheHeader header;
+    std::vector<u8> data(sizeof(header) + length);
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &written, &format, data.data() + sizeof(header));
+    if (written <= 0) {
+      return;
+    }
+    header.magic = kProgramCacheMagic;
+    header.binary_format = format;
+    header.key = key;
+    header.binary_size = written;
+    memcpy(data.data(), &header, sizeof(header));
+    try {
+      file_util::create_dir_if_needed(m_dir);
+      file_util::write_binary_file(entry_path(name), data.data(), sizeof(header) + written);
+    } catch (std::exception& e) {
+      lg::warn("Failed to cache program for {}: {}", name, e.what());
+    }
+  }
 
-  glGetShaderiv(m_frag_shader, GL_COMPILE_STATUS, &compile_ok);
-  if (!compile_ok) {
-    glGetShaderInfoLog(m_frag_shader, len, nullptr, err);
-    lg::error("Failed to compile fragment shader {}:\n{}", shader_name.c_str(), err);
-    m_is_okay = false;
-    return;
+ private:
+  fs::path entry_path(const std::string& name) const { return m_dir / (name + ".bin"); }
+
+  bool m_enabled = false;
+  std::string m_driver;
+  fs::path m_dir;
+};
+
+Shader::Shader(const std::string& shader_name,
+               GameVersion version,
+               Kind kind,
+               const ShaderProgramCache* cache)
+    : m_name(shader_name), m_kind(kind) {
+  std::vector<std::pair<GLenum, std::string>> sources;
+  if (kind == Kind::COMPUTE) {
+    sources.emplace_back(GL_COMPUTE_SHADER, file_util::read_text_file(file_util::get_file_path(
+                                                {shader_folder, shader_name + ".comp"})));
+  } else {
+    const std::string height_scale = version == GameVersion::Jak1 ? "1.0" : "0.5";
+    const std::string scissor_height = version == GameVersion::Jak1 ? "448.0" : "416.0";
+    const std::string scissor_adjust = "512.0 / " + scissor_height;
+
+    // read the shader source
+    auto vert_src =
+        file_util::read_text_file(file_util::get_file_path({shader_folder, shader_name + ".vert"}));
+    auto frag_src =
+        file_util::read_text_file(file_util::get_file_path({shader_folder, shader_name + ".frag"}));
+
+    vert_src = std::regex_replace(vert_src, std::regex("HEIGHT_SCALE"), height_scale);
+    vert_src = std::regex_replace(vert_src, std::regex("SCISSOR_HEIGHT"), scissor_height);
+    frag_src = std::regex_replace(frag_src, std::regex("SCISSOR_HEIGHT"), scissor_height);
+    vert_src =
+        std::regex_replace(vert_src, std::regex("SCISSOR_ADJUST"), "(" + scissor_adjust + ")");
+    sources.emplace_back(GL_VERTEX_SHADER, std::move(vert_src));
+    sources.emplace_back(GL_FRAGMENT_SHADER, std::move(frag_src));
   }
 
   m_program = glCreateProgram();
-  glAttachShader(m_program, m_vert_shader);
-  glAttachShader(m_program, m_frag_shader);
+  m_pending = true;
+  if (cache) {
+    std::string all_sources;
+    for (auto& [type, src] : sources) {
+      all_sources += stage_name(type);
+      all_sources += "\n";
+      all_sources += src;
+    }
+    m_cache_key = cache->key(all_sources);
+    if (cache->load(m_program, m_name, m_cache_key)) {
+      m_from_cache = true;
+      return;
+    }
+    glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+
+  // don't ask for the compile status here. Drivers that compile in the background only have to
+  // wait once the result is needed in finish(), so every shader can be compiling at once.
+  for (auto& [type, src] : sources) {
+    u64 shader = glCreateShader(type);
+    const char* src_ptr = src.c_str();
+    glShaderSource(shader, 1, &src_ptr, nullptr);
+    glCompileShader(shader);
+    glAttachShader(m_program, shader);
+    m_stages.push_back(shader);
+  }
   glLinkProgram(m_program);
+}
 
-  glGetProgramiv(m_program, GL_LINK_STATUS, &compile_ok);
-  if (!compile_ok) {
-    glGetProgramInfoLog(m_program, len, nullptr, err);
-    lg::error("Failed to link shader {}:\n{}", shader_name.c_str(), err);
-    m_is_okay = false;
+void Shader::finish(const ShaderProgramCache* cache) {
+  if (!m_pending) {
     return;
   }
+  m_pending = false;
+  // this is where we wait for the driver to compile
+  auto p = scoped_prof("shader-compile");
+  ScopedTelemetryTime t("shader-compile");
 
-  // uniform samplers must be named matching the texture unit
-  glUseProgram(m_program);
-  for (int i = 1; i < 30; ++i) {
-    std::string uniformName = "tex_T" + std::to_string(i);
-    GLint texLoc = glGetUniformLocation(m_program, uniformName.c_str());
-    if (texLoc != -1) {
-      glUniform1i(texLoc, i);
+  constexpr int len = 1024;
+  int compile_ok;
+  char err[len];
+
+  m_is_okay = true;
+  for (auto shader : m_stages) {
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_ok);
+    if (!compile_ok) {
+      GLint type = 0;
+      glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+      glGetShaderInfoLog(shader, len, nullptr, err);
+      lg::error("Failed to compile {} shader {}:\n{}", stage_name(type), m_name, err);
+      m_is_okay = false;
     }
   }
-  // assuming that the bones uniform block is always using binding point 1
-  GLint bonesLoc = glGetUniformBlockIndex(m_program, "ub_bones");
-  if (bonesLoc != -1) {
-    glUniformBlockBinding(m_program, bonesLoc, 1);
+
+  if (m_is_okay) {
+    glGetProgramiv(m_program, GL_LINK_STATUS, &compile_ok);
+    if (!compile_ok) {
+      glGetProgramInfoLog(m_program, len, nullptr, err);
+      lg::error("Failed to link {}shader {}:\n{}", m_kind == Kind::COMPUTE ? "compute " : "",
+                m_name, err);
+      m_is_okay = false;
+    }
   }
 
-  glDeleteShader(m_vert_shader);
-  glDeleteShader(m_frag_shader);
-  m_is_okay = true;
+  for (auto shader : m_stages) {
+    glDetachShader(m_program, shader);
+    glDeleteShader(shader);
+  }
+  m_stages.clear();
+
+  if (!m_is_okay) {
+    return;
+  }
+
+  if (cache && !m_from_cache) {
+    cache->save(m_program, m_name, m_cache_key);
+  }
+
+  if (m_kind == Kind::GRAPHICS) {
+    // uniform samplers must be named matching the texture unit. Uniform values and block
+    // bindings aren't saved in program binaries, so cached programs need this too.
+    glUseProgram(m_program);
+    for (int i = 1; i < 30; ++i) {
+      std::string uniformName = "tex_T" + std::to_string(i);
+      GLint texLoc = glGetUniformLocation(m_program, uniformName.c_str());
+      if (texLoc != -1) {
+        glUniform1i(texLoc, i);
+      }
+    }
+    // assuming that the bones uniform block is always using binding point 1
+    GLint bonesLoc = glGetUniformBlockIndex(m_program, "ub_bones");
+    if (bonesLoc != -1) {
+      glUniformBlockBinding(m_program, bonesLoc, 1);
+    }
+  }
 }
 
 void Shader::activate() const {
@@ -91,49 +272,84 @@ void Shader::activate() const {
 }
 
 ShaderLibrary::ShaderLibrary(GameVersion version) {
-  at(ShaderId::SOLID_COLOR) = {"solid_color", version};
-  at(ShaderId::DIRECT_BASIC) = {"direct_basic", version};
-  at(ShaderId::DIRECT_BASIC_TEXTURED) = {"direct_basic_textured", version};
-  at(ShaderId::DIRECT_BASIC_TEXTURED_MULTI_UNIT) = {"direct_basic_textured_multi_unit", version};
-  at(ShaderId::DEBUG_RED) = {"debug_red", version};
-  at(ShaderId::SPRITE) = {"sprite_3d", version};
-  at(ShaderId::SKY) = {"sky", version};
-  at(ShaderId::SKY_BLEND) = {"sky_blend", version};
-  at(ShaderId::TFRAG3) = {"tfrag3", version};
-  at(ShaderId::TFRAG3_NO_TEX) = {"tfrag3_no_tex", version};
-  at(ShaderId::SPRITE3) = {"sprite3_3d", version};
-  at(ShaderId::DIRECT2) = {"direct2", version};
-  at(ShaderId::EYE) = {"eye", version};
-  at(ShaderId::GENERIC) = {"generic", version};
-  at(ShaderId::OCEAN_TEXTURE) = {"ocean_texture", version};
-  at(ShaderId::OCEAN_TEXTURE_MIPMAP) = {"ocean_texture_mipmap", version};
-  at(ShaderId::OCEAN_COMMON) = {"ocean_common", version};
-  at(ShaderId::SHRUB) = {"shrub", version};
-  at(ShaderId::SHADOW) = {"shadow", version};
-  at(ShaderId::COLLISION) = {"collision", version};
-  at(ShaderId::MERC2) = {"merc2", version};
-  at(ShaderId::SPRITE_DISTORT) = {"sprite_distort", version};
-  at(ShaderId::SPRITE_DISTORT_INSTANCED) = {"sprite_distort_instanced", version};
-  at(ShaderId::POST_PROCESSING) = {"post_processing", version};
-  at(ShaderId::DEPTH_CUE) = {"depth_cue", version};
-  at(ShaderId::EMERC) = {"emerc", version};
-  at(ShaderId::GLOW_PROBE) = {"glow_probe", version};
-  at(ShaderId::GLOW_PROBE_READ) = {"glow_probe_read", version};
-  at(ShaderId::GLOW_PROBE_READ_DEBUG) = {"glow_probe_read_debug", version};
-  at(ShaderId::GLOW_PROBE_DOWNSAMPLE) = {"glow_probe_downsample", version};
-  at(ShaderId::GLOW_DRAW) = {"glow_draw", version};
-  at(ShaderId::ETIE_BASE) = {"etie_base", version};
-  at(ShaderId::ETIE) = {"etie", version};
-  at(ShaderId::SHADOW2) = {"shadow2", version};
-  at(ShaderId::TEX_ANIM) = {"tex_anim", version};
-  at(ShaderId::GLOW_DEPTH_COPY) = {"glow_depth_copy", version};
-  at(ShaderId::GLOW_PROBE_ON_GRID) = {"glow_probe_on_grid", version};
-  at(ShaderId::HFRAG) = {"hfrag", version};
-  at(ShaderId::HFRAG_MONTAGE) = {"hfrag_montage", version};
-  at(ShaderId::PLAIN_TEXTURE) = {"plain_texture", version};
-  at(ShaderId::TIE_WIND) = {"tie_wind", version};
+  Timer timer;
+  ShaderProgramCache cache(version);
+  auto load = [&](ShaderId id, const char* name, Shader::Kind kind = Shader::Kind::GRAPHICS) {
+    at(id) = Shader(name, version, kind, &cache);
+  };
 
+  load(ShaderId::SOLID_COLOR, "solid_color");
+  load(ShaderId::DIRECT_BASIC, "direct_basic");
+  load(ShaderId::DIRECT_BASIC_TEXTURED, "direct_basic_textured");
+  load(ShaderId::DIRECT_BASIC_TEXTURED_MULTI_UNIT, "direct_basic_textured_multi_unit");
+  load(ShaderId::DEBUG_RED, "debug_red");
+  load(ShaderId::SPRITE, "sprite_3d");
+  load(ShaderId::SKY, "sky");
+  load(ShaderId::SKY_BLEND, "sky_blend");
+  load(ShaderId::TFRAG3, "tfrag3");
+  load(ShaderId::TFRAG3_NO_TEX, "tfrag3_no_tex");
+  load(ShaderId::SPRITE3, "sprite3_3d");
+  load(ShaderId::DIRECT2, "direct2");
+  load(ShaderId::EYE, "eye");
+  load(ShaderId::GENERIC, "generic");
+  load(ShaderId::OCEAN_TEXTURE, "ocean_texture");
+  load(ShaderId::OCEAN_TEXTURE_MIPMAP, "ocean_texture_mipmap");
+  load(ShaderId::OCEAN_COMMON, "ocean_common");
+  load(ShaderId::SHRUB, "shrub");
+  load(ShaderId::SHADOW, "shadow");
+  load(ShaderId::COLLISION, "collision");
+  load(ShaderId::MERC2, "merc2");
+  load(ShaderId::SPRITE_DISTORT, "sprite_distort");
+  load(ShaderId::SPRITE_DISTORT_INSTANCED, "sprite_distort_instanced");
+  load(ShaderId::POST_PROCESSING, "post_processing");
+  load(ShaderId::DEPTH_CUE, "depth_cue");
+  load(ShaderId::EMERC, "emerc");
+  load(ShaderId::GLOW_PROBE, "glow_probe");
+  load(ShaderId::GLOW_PROBE_READ, "glow_probe_read");
+  load(ShaderId::GLOW_PROBE_READ_DEBUG, "glow_probe_read_debug");
+  load(ShaderId::GLOW_PROBE_DOWNSAMPLE, "glow_probe_downsample");
+  load(ShaderId::GLOW_DRAW, "glow_draw");
+  load(ShaderId::ETIE_BASE, "etie_base");
+  load(ShaderId::ETIE, "etie");
+  load(ShaderId::SHADOW2, "shadow2");
+  load(ShaderId::TEX_ANIM, "tex_anim");
+  load(ShaderId::GLOW_DEPTH_COPY, "glow_depth_copy");
+  load(ShaderId::GLOW_PROBE_ON_GRID, "glow_probe_on_grid");
+  load(ShaderId::HFRAG, "hfrag");
+  load(ShaderId::HFRAG_MONTAGE, "hfrag_montage");
+  load(ShaderId::PLAIN_TEXTURE, "plain_texture");
+  load(ShaderId::TIE_WIND, "tie_wind");
+  load(ShaderId::TEX_ANIM_LAYERS, "tex_anim_layers");
+  load(ShaderId::TIE_WIND_INSTANCED, "tie_wind_instanced");
+
+  // compute shaders need GL 4.3. Their users fall back to the CPU if they aren't available, so
+  // they're allowed to fail.
+  const bool has_compute = GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3);
+  if (has_compute) {
+    load(ShaderId::BACKGROUND_CULL, "background_cull", Shader::Kind::COMPUTE);
+    load(ShaderId::GLOW_PROBE_VISIBILITY, "glow_probe_visibility", Shader::Kind::COMPUTE);
+    load(ShaderId::TIME_OF_DAY_BLEND, "time_of_day_blend", Shader::Kind::COMPUTE);
+    load(ShaderId::TIE_WIND_MATRICES, "tie_wind_matrices", Shader::Kind::COMPUTE);
+  }
+
+  // everything has been started, so the driver can compile in parallel while these wait.
+  int num_cached = 0;
   for (auto& shader : m_shaders) {
-    ASSERT_MSG(shader.okay(), "error compiling shader");
+    shader.finish(&cache);
+    if (shader.from_cache()) {
+      num_cached++;
+    }
+  }
+  lg::info("Loaded shaders in {:.1f} ms, {}/{} from the program cache", timer.getMs(),
+           num_cached, (int)ShaderId::MAX_SHADERS);
+
+  for (int i = 0; i < (int)ShaderId::MAX_SHADERS; i++) {
+    if ((ShaderId)i == ShaderId::BACKGROUND_CULL ||
+        (ShaderId)i == ShaderId::GLOW_PROBE_VISIBILITY ||
+        (ShaderId)i == ShaderId::TIME_OF_DAY_BLEND ||
+        (ShaderId)i == ShaderId::TIE_WIND_MATRICES) {
+      continue;
+    }
+    ASSERT_MSG(m_shaders[i].okay(), "error compiling shader");
   }
 }
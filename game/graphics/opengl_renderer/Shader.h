@@ -1,24 +1,49 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/versions/versions.h"
 
+class ShaderProgramCache;
+
 class Shader {
  public:
   static constexpr char shader_folder[] = "game/graphics/opengl_renderer/shaders/";
-  Shader(const std::string& shader_name, GameVersion version);
+  enum class Kind {
+    GRAPHICS,  // name.vert and name.frag
+    COMPUTE,   // name.comp, needs GL 4.3
+  };
+  /*!
+   * Start building the program, either from a binary in the cache or by compiling the source.
+   * This doesn't wait for the driver to finish, so finish() must be called before the program can
+   * be used.
+   */
+  Shader(const std::string& shader_name,
+         GameVersion version,
+         Kind kind = Kind::GRAPHICS,
+         const ShaderProgramCache* cache = nullptr);
   Shader() = default;
+
+  /*!
+   * Wait for the compile and link started by the constructor and check the result. If the program
+   * was compiled, it's added to the cache.
+   */
+  void finish(const ShaderProgramCache* cache = nullptr);
   void activate() const;
   bool okay() const { return m_is_okay; }
+  bool from_cache() const { return m_from_cache; }
   u64 id() const { return m_program; }
 
  private:
   std::string m_name;
-  u64 m_frag_shader = 0;
-  u64 m_vert_shader = 0;
+  Kind m_kind = Kind::GRAPHICS;
+  std::vector<u64> m_stages;
   u64 m_program = 0;
+  u64 m_cache_key = 0;
+  bool m_pending = false;
+  bool m_from_cache = false;
   bool m_is_okay = false;
 };
 
@@ -65,6 +90,12 @@ enum class ShaderId {
   HFRAG_MONTAGE = 38,
   PLAIN_TEXTURE = 39,
   TIE_WIND = 40,
+  BACKGROUND_CULL = 41,  // compute, only loaded if supported
+  TEX_ANIM_LAYERS = 42,
+  GLOW_PROBE_VISIBILITY = 43,  // compute, only loaded if supported
+  TIME_OF_DAY_BLEND = 44,      // compute, only loaded if supported
+  TIE_WIND_MATRICES = 45,      // compute, only loaded if supported
+  TIE_WIND_INSTANCED = 46,
   MAX_SHADERS
 };
 
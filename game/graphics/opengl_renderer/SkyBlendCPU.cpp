@@ -1,13 +1,153 @@
 #include "SkyBlendCPU.h"
 
-#ifndef __aarch64__
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define SKY_BLEND_X86
 #include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SKY_BLEND_NEON
+#include <arm_neon.h>
 #endif
 
+#include "common/util/fnv.h"
 #include "common/util/os.h"
 
 #include "game/graphics/opengl_renderer/AdgifHandler.h"
 
+// The AVX2 versions are always compiled for AVX2, no matter what the rest of the build targets, and
+// are only picked if the CPU has it. MSVC allows AVX2 intrinsics without /arch:AVX2.
+#if defined(SKY_BLEND_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SKY_BLEND_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SKY_BLEND_TARGET_AVX2
+#endif
+
+namespace {
+
+// out = in * intensity / 128
+void blend_sky_initial_scalar(u8 intensity, u8* out, const u8* in, u32 size) {
+  for (u32 i = 0; i < size; i++) {
+    out[i] = std::min(255u, ((u32)in[i] * intensity) >> 7);
+  }
+}
+
+// out += in * intensity / 128, saturating
+void blend_sky_scalar(u8 intensity, u8* out, const u8* in, u32 size) {
+  for (u32 i = 0; i < size; i++) {
+    out[i] = std::min(255u, out[i] + std::min(255u, ((u32)in[i] * intensity) >> 7));
+  }
+}
+
+#ifdef SKY_BLEND_X86
+void blend_sky_initial_sse(u8 intensity, u8* out, const u8* in, u32 size) {
+  __m128i intensity_vec = _mm_set1_epi16(intensity);
+  for (u32 i = 0; i < size / 8; i++) {
+    __m128i tex_data8 = _mm_loadu_si64((const __m128i*)(in + (i * 8)));
+    __m128i tex_data16 = _mm_cvtepu8_epi16(tex_data8);
+    tex_data16 = _mm_mullo_epi16(tex_data16, intensity_vec);
+    tex_data16 = _mm_srli_epi16(tex_data16, 7);
+    auto result = _mm_packus_epi16(tex_data16, tex_data16);
+    _mm_storel_epi64((__m128i*)(out + (i * 8)), result);
+  }
+  const u32 done = size & ~7u;
+  blend_sky_initial_scalar(intensity, out + done, in + done, size - done);
+}
+
+void blend_sky_sse(u8 intensity, u8* out, const u8* in, u32 size) {
+  __m128i intensity_vec = _mm_set1_epi16(intensity);
+  __m128i max_intensity = _mm_set1_epi16(255);
+  for (u32 i = 0; i < size / 8; i++) {
+    __m128i tex_data8 = _mm_loadu_si64((const __m128i*)(in + (i * 8)));
+    __m128i out_val = _mm_loadu_si64((const __m128i*)(out + (i * 8)));
+    __m128i tex_data16 = _mm_cvtepu8_epi16(tex_data8);
+    tex_data16 = _mm_mullo_epi16(tex_data16, intensity_vec);
+    tex_data16 = _mm_srli_epi16(tex_data16, 7);
+    tex_data16 = _mm_min_epi16(max_intensity, tex_data16);
+    auto result = _mm_packus_epi16(tex_data16, tex_data16);
+    out_val = _mm_adds_epu8(out_val, result);
+    _mm_storel_epi64((__m128i*)(out + (i * 8)), out_val);
+  }
+  const u32 done = size & ~7u;
+  blend_sky_scalar(intensity, out + done, in + done, size - done);
+}
+
+SKY_BLEND_TARGET_AVX2 void blend_sky_initial_avx2(u8 intensity, u8* out, const u8* in, u32 size) {
+  __m256i intensity_vec = _mm256_set1_epi16(intensity);
+  for (u32 i = 0; i < size / 16; i++) {
+    __m128i tex_data8 = _mm_loadu_si128((const __m128i*)(in + (i * 16)));
+    __m256i tex_data16 = _mm256_cvtepu8_epi16(tex_data8);
+    tex_data16 = _mm256_mullo_epi16(tex_data16, intensity_vec);
+    tex_data16 = _mm256_srli_epi16(tex_data16, 7);
+    auto hi = _mm256_extracti128_si256(tex_data16, 1);
+    auto result = _mm_packus_epi16(_mm256_castsi256_si128(tex_data16), hi);
+    _mm_storeu_si128((__m128i*)(out + (i * 16)), result);
+  }
+  const u32 done = size & ~15u;
+  blend_sky_initial_scalar(intensity, out + done, in + done, size - done);
+}
+
+SKY_BLEND_TARGET_AVX2 void blend_sky_avx2(u8 intensity, u8* out, const u8* in, u32 size) {
+  __m256i intensity_vec = _mm256_set1_epi16(intensity);
+  __m256i max_intensity = _mm256_set1_epi16(255);
+  for (u32 i = 0; i < size / 16; i++) {
+    __m128i tex_data8 = _mm_loadu_si128((const __m128i*)(in + (i * 16)));
+    __m128i out_val = _mm_loadu_si128((const __m128i*)(out + (i * 16)));
+    __m256i tex_data16 = _mm256_cvtepu8_epi16(tex_data8);
+    tex_data16 = _mm256_mullo_epi16(tex_data16, intensity_vec);
+    tex_data16 = _mm256_srli_epi16(tex_data16, 7);
+    tex_data16 = _mm256_min_epi16(max_intensity, tex_data16);
+    auto hi = _mm256_extracti128_si256(tex_data16, 1);
+    auto result = _mm_packus_epi16(_mm256_castsi256_si128(tex_data16), hi);
+    out_val = _mm_adds_epu8(out_val, result);
+    _mm_storeu_si128((__m128i*)(out + (i * 16)), out_val);
+  }
+  const u32 done = size & ~15u;
+  blend_sky_scalar(intensity, out + done, in + done, size - done);
+}
+#endif
+
+#ifdef SKY_BLEND_NEON
+// NEON is always there on aarch64, so these don't need a runtime check.
+void blend_sky_initial_neon(u8 intensity, u8* out, const u8* in, u32 size) {
+  for (u32 i = 0; i < size / 16; i++) {
+    uint8x16_t tex_data8 = vld1q_u8(in + (i * 16));
+    uint16x8_t lo = vmulq_n_u16(vmovl_u8(vget_low_u8(tex_data8)), intensity);
+    uint16x8_t hi = vmulq_n_u16(vmovl_u8(vget_high_u8(tex_data8)), intensity);
+    uint8x16_t result =
+        vcombine_u8(vqmovn_u16(vshrq_n_u16(lo, 7)), vqmovn_u16(vshrq_n_u16(hi, 7)));
+    vst1q_u8(out + (i * 16), result);
+  }
+  const u32 done = size & ~15u;
+  blend_sky_initial_scalar(intensity, out + done, in + done, size - done);
+}
+
+void blend_sky_neon(u8 intensity, u8* out, const u8* in, u32 size) {
+  for (u32 i = 0; i < size / 16; i++) {
+    uint8x16_t tex_data8 = vld1q_u8(in + (i * 16));
+    uint8x16_t out_val = vld1q_u8(out + (i * 16));
+    uint16x8_t lo = vmulq_n_u16(vmovl_u8(vget_low_u8(tex_data8)), intensity);
+    uint16x8_t hi = vmulq_n_u16(vmovl_u8(vget_high_u8(tex_data8)), intensity);
+    uint8x16_t result =
+        vcombine_u8(vqmovn_u16(vshrq_n_u16(lo, 7)), vqmovn_u16(vshrq_n_u16(hi, 7)));
+    vst1q_u8(out + (i * 16), vqaddq_u8(out_val, result));
+  }
+  const u32 done = size & ~15u;
+  blend_sky_scalar(intensity, out + done, in + done, size - done);
+}
+#endif
+
+u64 hash_blend_op(u64 hash, const u8* src, u32 intensity) {
+  u64 key[2] = {(u64)(uintptr_t)src, intensity};
+  const u8* ptr = (const u8*)key;
+  for (size_t i = 0; i < sizeof(key); i++) {
+    hash = 1099511628211 * (((u64)ptr[i]) ^ hash);
+  }
+  return hash;
+}
+
+}  // namespace
+
 SkyBlendCPU::SkyBlendCPU() {
   for (int i = 0; i < 2; i++) {
     glGenTextures(1, &m_textures[i].gl);
@@ -16,88 +156,43 @@ SkyBlendCPU::SkyBlendCPU() {
                  GL_UNSIGNED_INT_8_8_8_8_REV, 0);
     m_texture_data[i].resize(4 * m_sizes[i] * m_sizes[i]);
   }
-}
 
-SkyBlendCPU::~SkyBlendCPU() {
-  for (auto& tex : m_textures) {
-    glDeleteTextures(1, &tex.gl);
-  }
-}
-
-void blend_sky_initial_fast(u8 intensity, u8* out, const u8* in, u32 size) {
-#ifndef __arm64__
+#if defined(SKY_BLEND_X86)
   if (get_cpu_info().has_avx2) {
-#ifdef __AVX2__
-    __m256i intensity_vec = _mm256_set1_epi16(intensity);
-    for (u32 i = 0; i < size / 16; i++) {
-      __m128i tex_data8 = _mm_loadu_si128((const __m128i*)(in + (i * 16)));
-      __m256i tex_data16 = _mm256_cvtepu8_epi16(tex_data8);
-      tex_data16 = _mm256_mullo_epi16(tex_data16, intensity_vec);
-      tex_data16 = _mm256_srli_epi16(tex_data16, 7);
-      auto hi = _mm256_extracti128_si256(tex_data16, 1);
-      auto result = _mm_packus_epi16(_mm256_castsi256_si128(tex_data16), hi);
-      _mm_storeu_si128((__m128i*)(out + (i * 16)), result);
-    }
-#else
-    ASSERT(false);
-#endif
+    m_blend_initial = blend_sky_initial_avx2;
+    m_blend = blend_sky_avx2;
+    m_impl_name = "AVX2";
   } else {
-    __m128i intensity_vec = _mm_set1_epi16(intensity);
-    for (u32 i = 0; i < size / 8; i++) {
-      __m128i tex_data8 = _mm_loadu_si64((const __m128i*)(in + (i * 8)));
-      __m128i tex_data16 = _mm_cvtepu8_epi16(tex_data8);
-      tex_data16 = _mm_mullo_epi16(tex_data16, intensity_vec);
-      tex_data16 = _mm_srli_epi16(tex_data16, 7);
-      auto result = _mm_packus_epi16(tex_data16, tex_data16);
-      _mm_storel_epi64((__m128i*)(out + (i * 8)), result);
-    }
+    m_blend_initial = blend_sky_initial_sse;
+    m_blend = blend_sky_sse;
+    m_impl_name = "SSE";
   }
+#elif defined(SKY_BLEND_NEON)
+  m_blend_initial = blend_sky_initial_neon;
+  m_blend = blend_sky_neon;
+  m_impl_name = "NEON";
+#else
+  m_blend_initial = blend_sky_initial_scalar;
+  m_blend = blend_sky_scalar;
+  m_impl_name = "scalar";
 #endif
 }
 
-void blend_sky_fast(u8 intensity, u8* out, const u8* in, u32 size) {
-#ifndef __arm64__
-  if (get_cpu_info().has_avx2) {
-#ifdef __AVX2__
-    __m256i intensity_vec = _mm256_set1_epi16(intensity);
-    __m256i max_intensity = _mm256_set1_epi16(255);
-    for (u32 i = 0; i < size / 16; i++) {
-      __m128i tex_data8 = _mm_loadu_si128((const __m128i*)(in + (i * 16)));
-      __m128i out_val = _mm_loadu_si128((const __m128i*)(out + (i * 16)));
-      __m256i tex_data16 = _mm256_cvtepu8_epi16(tex_data8);
-      tex_data16 = _mm256_mullo_epi16(tex_data16, intensity_vec);
-      tex_data16 = _mm256_srli_epi16(tex_data16, 7);
-      tex_data16 = _mm256_min_epi16(max_intensity, tex_data16);
-      auto hi = _mm256_extracti128_si256(tex_data16, 1);
-      auto result = _mm_packus_epi16(_mm256_castsi256_si128(tex_data16), hi);
-      out_val = _mm_adds_epu8(out_val, result);
-      _mm_storeu_si128((__m128i*)(out + (i * 16)), out_val);
-    }
-#else
-    ASSERT(false);
-#endif
-  } else {
-    __m128i intensity_vec = _mm_set1_epi16(intensity);
-    __m128i max_intensity = _mm_set1_epi16(255);
-    for (u32 i = 0; i < size / 8; i++) {
-      __m128i tex_data8 = _mm_loadu_si64((const __m128i*)(in + (i * 8)));
-      __m128i out_val = _mm_loadu_si64((const __m128i*)(out + (i * 8)));
-      __m128i tex_data16 = _mm_cvtepu8_epi16(tex_data8);
-      tex_data16 = _mm_mullo_epi16(tex_data16, intensity_vec);
-      tex_data16 = _mm_srli_epi16(tex_data16, 7);
-      tex_data16 = _mm_min_epi16(max_intensity, tex_data16);
-      auto result = _mm_packus_epi16(tex_data16, tex_data16);
-      out_val = _mm_adds_epu8(out_val, result);
-      _mm_storel_epi64((__m128i*)(out + (i * 8)), out_val);
-    }
+SkyBlendCPU::~SkyBlendCPU() {
+  for (auto& tex : m_textures) {
+    glDeleteTextures(1, &tex.gl);
   }
-#endif
 }
 
 SkyBlendStats SkyBlendCPU::do_sky_blends(DmaFollower& dma,
                                          SharedRenderState* render_state,
                                          ScopedProfilerNode& /*prof*/) {
   SkyBlendStats stats;
+  bool touched[2] = {false, false};
+  for (auto& buffer : m_buffers) {
+    buffer.pending_hash = buffer.data_hash;
+    buffer.pending_ops.clear();
+  }
 
   while (dma.current_tag().qwc == 6) {
     // assuming that the vif and gif-tag is correct
@@ -139,32 +234,18 @@ SkyBlendStats SkyBlendCPU::do_sky_blends(DmaFollower& dma,
     auto tex = render_state->texture_pool->lookup_gpu_texture(adgif.tex0().tbp0());
     ASSERT(tex);
 
-    // slow version
-    /*
-    if (is_first_draw) {
-      memset(m_texture_data[buffer_idx].data(), 0, m_texture_data[buffer_idx].size());
-    }
-
-    // intensities should be 0-128 (maybe higher is okay, but I don't see how this could be
-    // generated with the GOAL code.)
-    ASSERT(intensity <= 128);
-    ASSERT(m_texture_data[buffer_idx].size() == tex->data.size());
-    for (size_t i = 0; i < m_texture_data[buffer_idx].size(); i++) {
-      u32 val = tex->data[i] * intensity;
-      val >>= 7;
-      m_texture_data[buffer_idx][i] += val;
-    }
-     */
     if (tex->get_data_ptr()) {
+      auto& buffer = m_buffers[buffer_idx];
       if (m_texture_data[buffer_idx].size() == tex->data_size()) {
-        if (is_first_draw) {
-          blend_sky_initial_fast(intensity, m_texture_data[buffer_idx].data(), tex->get_data_ptr(),
-                                 m_texture_data[buffer_idx].size());
-        } else {
-          blend_sky_fast(intensity, m_texture_data[buffer_idx].data(), tex->get_data_ptr(),
-                         m_texture_data[buffer_idx].size());
-        }
+        BlendOp op;
+        op.src = tex->get_data_ptr();
+        op.intensity = intensity;
+        op.first_draw = is_first_draw;
+        buffer.pending_hash = hash_blend_op(is_first_draw ? fnv64(nullptr, 0) : buffer.pending_hash,
+                                            op.src, op.intensity);
+        buffer.pending_ops.push_back(op);
       }
+      touched[buffer_idx] = true;
 
       if (buffer_idx == 0) {
         if (is_first_draw) {
@@ -179,13 +260,47 @@ SkyBlendStats SkyBlendCPU::do_sky_blends(DmaFollower& dma,
           stats.cloud_blends++;
         }
       }
+    }
+  }
+
+  for (int buffer_idx = 0; buffer_idx < 2; buffer_idx++) {
+    if (!touched[buffer_idx]) {
+      continue;
+    }
+    auto& buffer = m_buffers[buffer_idx];
+    auto& data = m_texture_data[buffer_idx];
+
+    // the blend only depends on the source texture data and intensities, so if those are the same
+    // as a recent run, there's no need to redo the blend.
+    if (buffer.pending_hash != buffer.data_hash) {
+      auto cached = std::find_if(buffer.cache.begin(), buffer.cache.end(), [&](const auto& e) {
+        return !e.data.empty() && e.hash == buffer.pending_hash;
+      });
+      if (cached != buffer.cache.end()) {
+        memcpy(data.data(), cached->data.data(), data.size());
+        stats.skipped_blends += (int)buffer.pending_ops.size();
+      } else {
+        for (auto& op : buffer.pending_ops) {
+          (op.first_draw ? m_blend_initial : m_blend)(op.intensity, data.data(), op.src,
+                                                      data.size());
+        }
+        auto& entry = buffer.cache[buffer.next_cache_entry];
+        buffer.next_cache_entry = (buffer.next_cache_entry + 1) % Buffer::kCacheSize;
+        entry.hash = buffer.pending_hash;
+        entry.data = data;
+      }
+      buffer.data_hash = buffer.pending_hash;
+
       glBindTexture(GL_TEXTURE_2D, m_textures[buffer_idx].gl);
       glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_sizes[buffer_idx], m_sizes[buffer_idx], 0, GL_RGBA,
-                   GL_UNSIGNED_INT_8_8_8_8_REV, m_texture_data[buffer_idx].data());
-
-      render_state->texture_pool->move_existing_to_vram(m_textures[buffer_idx].tex,
-                                                        m_textures[buffer_idx].tbp);
+                   GL_UNSIGNED_INT_8_8_8_8_REV, data.data());
+    } else {
+      stats.skipped_blends += (int)buffer.pending_ops.size();
     }
+
+    // the GPU blender may have been using these slots.
+    render_state->texture_pool->move_existing_to_vram(m_textures[buffer_idx].tex,
+                                                      m_textures[buffer_idx].tbp);
   }
 
   return stats;
@@ -208,4 +323,4 @@ void SkyBlendCPU::init_textures(TexturePool& tex_pool, GameVersion version) {
     m_textures[i].tex = tex_pool.give_texture_and_load_to_vram(in, tbp);
     m_textures[i].tbp = tbp;
   }
-}
\ No newline at end of file
+}
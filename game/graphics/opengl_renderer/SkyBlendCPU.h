@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "common/dma/dma_chain_read.h"
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
@@ -15,6 +17,9 @@ class SkyBlendCPU {
                               SharedRenderState* render_state,
                               ScopedProfilerNode& prof);
   void init_textures(TexturePool& tex_pool, GameVersion version);
+  const char* blend_impl_name() const { return m_impl_name; }
+
+  using BlendFunc = void (*)(u8 intensity, u8* out, const u8* in, u32 size);
 
  private:
   static constexpr int m_sizes[2] = {32, 64};
@@ -25,4 +30,37 @@ class SkyBlendCPU {
     u32 tbp;
     GpuTexture* tex;
   } m_textures[2];
-};
\ No newline at end of file
+
+  /*!
+   * A draw or blend of one source texture. These are recorded during do_sky_blends and only run
+   * at the end, if the result isn't already in the buffer or the cache.
+   */
+  struct BlendOp {
+    const u8* src = nullptr;
+    u32 intensity = 0;
+    bool first_draw = false;
+  };
+
+  struct Buffer {
+    // hash of the ops that made the current contents of m_texture_data. The chain restarts at
+    // each first draw, so the same sequence of draws in a frame gives the same hash.
+    u64 data_hash = 0;
+    // hash of the contents once the ops recorded this call have run.
+    u64 pending_hash = 0;
+    std::vector<BlendOp> pending_ops;
+
+    // recent results. Each level blends the sky once per frame, so the contents alternate between
+    // a few values even when nothing is changing.
+    static constexpr int kCacheSize = 4;
+    struct CacheEntry {
+      u64 hash = 0;
+      std::vector<u8> data;
+    };
+    std::array<CacheEntry, kCacheSize> cache;
+    int next_cache_entry = 0;
+  } m_buffers[2];
+
+  BlendFunc m_blend_initial = nullptr;
+  BlendFunc m_blend = nullptr;
+  const char* m_impl_name = "";
+};
@@ -5,4 +5,5 @@ struct SkyBlendStats {
   int cloud_draws = 0;
   int sky_blends = 0;
   int cloud_blends = 0;
+  int skipped_blends = 0;  // cpu only: draws and blends that didn't need to run again
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "SkyRenderer.h"
 
+#include "common/util/Timer.h"
+
 #include "game/graphics/opengl_renderer/AdgifHandler.h"
 #include "game/graphics/pipelines/opengl.h"
 
@@ -49,13 +51,44 @@ void SkyBlendHandler::handle_sky_copies(DmaFollower& dma,
       dma.read_and_advance();
     }
     return;
-  } else {
-    if (render_state->use_sky_cpu) {
-      m_gpu_stats = m_shared_cpu_blender->do_sky_blends(dma, render_state, prof);
+  } else if (m_benchmark.frames_left > 0) {
+    // the blender that isn't in use goes first, on a copy of the DMA, so the one in use still
+    // makes the textures that get used.
+    const bool use_cpu = render_state->use_sky_cpu;
+    DmaFollower dma_copy = dma;
+    glFinish();
+    Timer other_timer;
+    run_blender(!use_cpu, dma_copy, render_state, prof);
+    glFinish();
+    const double other_ms = other_timer.getMs();
+    Timer timer;
+    m_gpu_stats = run_blender(use_cpu, dma, render_state, prof);
+    glFinish();
+    const double ms = timer.getMs();
 
-    } else {
-      m_gpu_stats = m_shared_gpu_blender->do_sky_blends(dma, render_state, prof);
+    m_benchmark.cpu_ms += use_cpu ? ms : other_ms;
+    m_benchmark.gpu_ms += use_cpu ? other_ms : ms;
+    m_benchmark.frames++;
+    if (--m_benchmark.frames_left == 0) {
+      const double cpu = m_benchmark.cpu_ms / m_benchmark.frames;
+      const double gpu = m_benchmark.gpu_ms / m_benchmark.frames;
+      lg::info("[{}] sky blend: CPU ({}) {:.3f} ms, GPU {:.3f} ms per frame. Using {}.", m_name,
+               m_shared_cpu_blender->blend_impl_name(), cpu, gpu, cpu <= gpu ? "CPU" : "GPU");
+      render_state->use_sky_cpu = cpu <= gpu;
     }
+  } else {
+    m_gpu_stats = run_blender(render_state->use_sky_cpu, dma, render_state, prof);
+  }
+}
+
+SkyBlendStats SkyBlendHandler::run_blender(bool cpu,
+                                           DmaFollower& dma,
+                                           SharedRenderState* render_state,
+                                           ScopedProfilerNode& prof) {
+  if (cpu) {
+    return m_shared_cpu_blender->do_sky_blends(dma, render_state, prof);
+  } else {
+    return m_shared_gpu_blender->do_sky_blends(dma, render_state, prof);
   }
 }
 
@@ -119,6 +152,18 @@ void SkyBlendHandler::draw_debug_window() {
   ImGui::Separator();
   ImGui::Text("Draw/Blend ( sky ): %d/%d", m_gpu_stats.sky_draws, m_gpu_stats.sky_blends);
   ImGui::Text("Draw/Blend (cloud): %d/%d", m_gpu_stats.cloud_draws, m_gpu_stats.cloud_blends);
+  ImGui::Text("CPU blend (%s) skipped: %d", m_shared_cpu_blender->blend_impl_name(),
+              m_gpu_stats.skipped_blends);
+  if (m_benchmark.frames_left > 0) {
+    ImGui::Text("Benchmarking... %d", m_benchmark.frames_left);
+  } else if (ImGui::Button("Benchmark CPU vs GPU")) {
+    m_benchmark = {};
+    m_benchmark.frames_left = kBenchmarkFrames;
+  }
+  if (m_benchmark.frames > 0) {
+    ImGui::Text("CPU %.3f ms, GPU %.3f ms (%d frames)", m_benchmark.cpu_ms / m_benchmark.frames,
+                m_benchmark.gpu_ms / m_benchmark.frames, m_benchmark.frames);
+  }
 
   if (ImGui::TreeNode("tfrag")) {
     m_tfrag_renderer.draw_debug_window();
@@ -27,9 +27,25 @@ class SkyBlendHandler : public BucketRenderer {
                          SharedRenderState* render_state,
                          ScopedProfilerNode& prof);
 
+  SkyBlendStats run_blender(bool cpu,
+                            DmaFollower& dma,
+                            SharedRenderState* render_state,
+                            ScopedProfilerNode& prof);
+
   std::shared_ptr<SkyBlendGPU> m_shared_gpu_blender;
   std::shared_ptr<SkyBlendCPU> m_shared_cpu_blender;
   SkyBlendStats m_gpu_stats;
+
+  // Times both blenders on the same data for a number of frames, then switches to the faster one.
+  // Each run is bracketed by glFinish, so this includes the GPU time and the upload of the CPU
+  // result, but it stalls, so it's only for this measurement.
+  static constexpr int kBenchmarkFrames = 120;
+  struct {
+    int frames_left = 0;
+    int frames = 0;
+    double cpu_ms = 0;
+    double gpu_ms = 0;
+  } m_benchmark;
   TFragment m_tfrag_renderer;
 };
 
@@ -5,6 +5,7 @@
 #include "common/texture/texture_slots.h"
 #include "common/util/FileUtil.h"
 #include "common/util/Timer.h"
+#include "common/util/fnv.h"
 
 #include "game/graphics/opengl_renderer/slime_lut.h"
 #include "game/graphics/texture/TexturePool.h"
@@ -370,7 +371,7 @@ ClutBlender::ClutBlender(const std::string& dest,
 /*!
  * Blend cluts and create an output texture.
  */
-GLuint ClutBlender::run(const float* weights) {
+bool ClutBlender::run(const float* weights) {
   bool needs_run = false;
 
   // check if weights changed or not.
@@ -382,7 +383,7 @@ GLuint ClutBlender::run(const float* weights) {
   }
 
   if (!needs_run) {
-    return m_texture;
+    return false;
   }
 
   // update weights
@@ -407,7 +408,7 @@ GLuint ClutBlender::run(const float* weights) {
   // send to GPU.
   opengl_upload_texture(m_texture, m_temp_rgba.data(), m_dest->w, m_dest->h);
 
-  return m_texture;
+  return true;
 }
 
 /*!
@@ -458,6 +459,33 @@ Psm32ToPsm8Scrambler::Psm32ToPsm8Scrambler(int w, int h, int write_tex_width, in
   }
 }
 
+Psm32ToPsm8Gather::Psm32ToPsm8Gather(int in_w, int in_h, int read_tex_width) {
+  // which input byte ended up at each VRAM byte.
+  std::vector<int> byte_at_vram;
+  for (int y = 0; y < in_h; y++) {
+    for (int x = 0; x < in_w; x++) {
+      u32 byte_addr = psmct32_addr(x, y, in_w);
+      if (byte_addr + 4 > byte_at_vram.size()) {
+        byte_at_vram.resize(byte_addr + 4, -1);
+      }
+      for (int c = 0; c < 4; c++) {
+        byte_at_vram[byte_addr + c] = (x + y * in_w) * 4 + c;
+      }
+    }
+  }
+
+  const int out_w = in_w * 2;
+  const int out_h = in_h * 2;
+  source_per_texel.resize(out_w * out_h);
+  for (int y = 0; y < out_h; y++) {
+    for (int x = 0; x < out_w; x++) {
+      u32 byte_addr = psmt8_addr(x, y, read_tex_width);
+      source_per_texel[x + y * out_w] =
+          byte_addr < byte_at_vram.size() ? byte_at_vram[byte_addr] : -1;
+    }
+  }
+}
+
 const std::vector<std::string>& animated_texture_slots(GameVersion version) {
   switch (version) {
     case GameVersion::Jak2:
@@ -535,6 +563,39 @@ TextureAnimator::TextureAnimator(ShaderLibrary& shaders,
   m_uniforms.maximum = glGetUniformLocation(shader.id(), "maximum");
   m_uniforms.slime_scroll = glGetUniformLocation(shader.id(), "slime_scroll");
 
+  // single pass shader for fixed animations
+  {
+    auto& layers_shader = shaders[ShaderId::TEX_ANIM_LAYERS];
+    m_single_pass.program = layers_shader.id();
+    layers_shader.activate();
+    m_single_pass.layer_count = glGetUniformLocation(layers_shader.id(), "layer_count");
+    m_single_pass.clear_color = glGetUniformLocation(layers_shader.id(), "clear_color");
+    m_single_pass.dest_size = glGetUniformLocation(layers_shader.id(), "dest_size");
+    GLint units[kMaxSinglePassLayers];
+    for (int i = 0; i < kMaxSinglePassLayers; i++) {
+      units[i] = i;
+    }
+    glUniform1iv(glGetUniformLocation(layers_shader.id(), "layer_tex"), kMaxSinglePassLayers,
+                 units);
+    glUniformBlockBinding(layers_shader.id(),
+                          glGetUniformBlockIndex(layers_shader.id(), "ub_tex_anim_layers"),
+                          kSinglePassUniformBinding);
+    glGenBuffers(1, &m_single_pass.ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, m_single_pass.ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(m_single_pass.layers), nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // the layers that share a texture don't always share wrap modes, so those come from samplers.
+    glGenSamplers(4, m_single_pass.samplers);
+    for (int i = 0; i < 4; i++) {
+      const GLuint sampler = m_single_pass.samplers[i];
+      glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+      glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, (i & 1) ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+      glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, (i & 2) ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+    }
+  }
+
   // create a single "dummy texture" with all 0 data.
   // this is faster and easier than switching shaders to one without texturing, and is used
   // only rarely
@@ -587,6 +648,7 @@ TextureAnimator::TextureAnimator(ShaderLibrary& shaders,
 
   m_public_output_slots.resize(animated_texture_slots(m_version).size(), m_dummy_texture);
   m_private_output_slots = m_public_output_slots;
+  m_private_output_slot_versions.resize(m_private_output_slots.size());
   m_output_debug_flags.resize(animated_texture_slots(m_version).size());
 
   // animation-specific stuff
@@ -683,6 +745,13 @@ void imgui_show_tex(GLuint tex) {
 
 void TextureAnimator::draw_debug_window() {
   ImGui::Checkbox("fast-scrambler", &m_debug.use_fast_scrambler);
+  ImGui::Checkbox("skip-unchanged", &m_debug.skip_unchanged);
+  ImGui::Checkbox("single-pass-layers", &m_debug.single_pass_layers);
+  ImGui::Text("Run/skipped last frame:");
+  ImGui::Text(" fixed %d/%d", m_anim_stats.fixed.run, m_anim_stats.fixed.skipped);
+  ImGui::Text(" clut  %d/%d", m_anim_stats.clut.run, m_anim_stats.clut.skipped);
+  ImGui::Text(" sky   %d/%d", m_anim_stats.sky.run, m_anim_stats.sky.skipped);
+  ImGui::Text(" slime %d/%d", m_anim_stats.slime.run, m_anim_stats.slime.skipped);
 
   ImGui::Text("Slime:");
   ImGui::Text("dests %d %d", m_debug_slime_input.dest, m_debug_slime_input.scroll_dest);
@@ -772,6 +841,8 @@ TextureAnimator::~TextureAnimator() {
   glDeleteVertexArrays(1, &m_vao);
   glDeleteBuffers(1, &m_vertex_buffer);
   glDeleteTextures(1, &m_dummy_texture);
+  glDeleteBuffers(1, &m_single_pass.ubo);
+  glDeleteSamplers(4, m_single_pass.samplers);
 }
 
 GLuint TextureAnimator::get_by_slot(int idx) {
@@ -1208,6 +1279,7 @@ void TextureAnimator::handle_texture_anim_data(DmaFollower& dma,
   m_in_use_temp_textures.clear();  // reset temp texture allocator.
   m_force_to_gpu.clear();
   m_skip_tbps.clear();
+  m_anim_stats = {};
 
   // loop over DMA, and do the appropriate texture operations.
   // this will fill out m_textures, which is keyed on TBP.
@@ -1599,7 +1671,14 @@ void TextureAnimator::run_clut_blender_group(DmaTransfer& tf,
   float weights[2] = {1.f - f, f};
   blenders.last_updated_frame = frame_idx;
   for (size_t i = 0; i < blenders.blenders.size(); i++) {
-    m_private_output_slots[blenders.outputs[i]] = blenders.blenders[i].run(weights);
+    const int slot = blenders.outputs[i];
+    if (blenders.blenders[i].run(weights)) {
+      m_private_output_slot_versions[slot]++;
+      m_anim_stats.clut.run++;
+    } else {
+      m_anim_stats.clut.skipped++;
+    }
+    m_private_output_slots[slot] = blenders.blenders[i].texture();
   }
 
   const u32* tbps = (const u32*)(tf.data + 16);
@@ -1638,7 +1717,18 @@ void TextureAnimator::handle_clouds_and_fog(const DmaTransfer& tf,
   ASSERT(tf.size_bytes >= sizeof(SkyInput));
   SkyInput input;
   memcpy(&input, tf.data, sizeof(SkyInput));
-  auto tex = run_clouds(input, hires);
+  // with the same input, the noise textures don't advance, so the output would be the same.
+  auto& last_input = hires ? m_last_sky_hires_input : m_last_sky_input;
+  GLint tex;
+  if (m_debug.skip_unchanged && last_input &&
+      !memcmp(&*last_input, &input, sizeof(SkyInput))) {
+    tex = (hires ? m_sky_hires_final_texture : m_sky_final_texture).texture();
+    m_anim_stats.sky.skipped++;
+  } else {
+    tex = run_clouds(input, hires);
+    last_input = input;
+    m_anim_stats.sky.run++;
+  }
   auto& gpu_tex = hires ? m_sky_hires_pool_gpu_tex : m_sky_pool_gpu_tex;
 
   if (gpu_tex) {
@@ -1661,7 +1751,16 @@ void TextureAnimator::handle_slime(const DmaTransfer& tf, TexturePool* texture_p
   SlimeInput input;
   memcpy(&input, tf.data, sizeof(SlimeInput));
 
-  run_slime(input);
+  if (m_debug.skip_unchanged && m_last_slime_input &&
+      !memcmp(&*m_last_slime_input, &input, sizeof(SlimeInput))) {
+    m_anim_stats.slime.skipped++;
+  } else {
+    run_slime(input);
+    m_last_slime_input = input;
+    m_private_output_slot_versions.at(m_slime_output_slot)++;
+    m_private_output_slot_versions.at(m_slime_scroll_output_slot)++;
+    m_anim_stats.slime.run++;
+  }
 
   {
     auto no_scroll_tex = m_slime_final_texture.texture();
@@ -1704,10 +1803,12 @@ void TextureAnimator::handle_slime(const DmaTransfer& tf, TexturePool* texture_p
 void TextureAnimator::clear_stale_textures(u64 frame_idx) {
   for (auto& group : m_clut_blender_groups) {
     if (frame_idx > group.last_updated_frame) {
-      for (auto& blender : group.blenders) {
+      for (size_t i = 0; i < group.blenders.size(); i++) {
+        auto& blender = group.blenders[i];
         if (!blender.at_default()) {
           float weights[2] = {1, 0};
           blender.run(weights);
+          m_private_output_slot_versions.at(group.outputs[i])++;
         }
       }
     }
@@ -2105,6 +2206,22 @@ GLuint TextureAnimator::make_or_get_gpu_texture_for_current_shader(TexturePool&
               rgba_data[m_psm32_to_psm8_64_64.destinations_per_byte[i]] =
                   clut_u32s[m_clut_table.addrs[vram_entry->data[i]]];
             }
+          } else if (m_debug.use_fast_scrambler) {
+            // other sizes get a gather table the first time they're seen.
+            const u64 key = vram_entry->tex_width | ((u64)vram_entry->tex_height << 16) |
+                            ((u64)m_current_shader.tex0.tbw() << 32);
+            auto it = m_psm32_to_psm8_gathers.find(key);
+            if (it == m_psm32_to_psm8_gathers.end()) {
+              it = m_psm32_to_psm8_gathers
+                       .try_emplace(key, vram_entry->tex_width, vram_entry->tex_height,
+                                    64 * m_current_shader.tex0.tbw())
+                       .first;
+            }
+            const auto& sources = it->second.source_per_texel;
+            for (int i = 0; i < w * h; i++) {
+              rgba_data[i] =
+                  sources[i] < 0 ? 0 : clut_u32s[m_clut_table.addrs[vram_entry->data[sources[i]]]];
+            }
           } else {
             Timer timer;
             m_converter.upload_width(vram_entry->data.data(), m_current_shader.tex0.tbp0(),
@@ -2450,6 +2567,36 @@ void convert_gs_uv_to_vec2(float* out, const math::Vector<float, 4>& in) {
   out[0] = in.x();
   out[1] = in.y();
 }
+
+/*!
+ * The blend mode number used by tex_anim_layers.frag for this layer, matching the blending set up
+ * by set_up_opengl_for_fixed. Returns -1 if the single pass shader can't do this layer.
+ */
+int single_pass_blend_mode(const FixedLayerDef& def) {
+  if (def.z_test) {
+    return -1;
+  }
+  if (!def.blend_enable) {
+    return 0;
+  }
+  using BM = GsAlpha::BlendMode;
+  const auto* m = def.blend_modes;
+  if (m[0] == BM::SOURCE && m[1] == BM::ZERO_OR_FIXED && m[2] == BM::SOURCE && m[3] == BM::DEST) {
+    return 1;
+  }
+  if (m[0] == BM::SOURCE && m[1] == BM::DEST && m[2] == BM::SOURCE && m[3] == BM::DEST) {
+    return 2;
+  }
+  if (m[0] == BM::SOURCE && m[1] == BM::ZERO_OR_FIXED && m[2] == BM::ZERO_OR_FIXED) {
+    if (m[3] == BM::ZERO_OR_FIXED && def.blend_fix == 128) {
+      return 0;
+    }
+    if (m[3] == BM::DEST) {
+      return 3;
+    }
+  }
+  return -1;
+}
 }  // namespace
 
 void TextureAnimator::set_uniforms_from_draw_data(const DrawData& dd, int dest_w, int dest_h) {
@@ -2625,8 +2772,153 @@ void TextureAnimator::set_draw_data_from_interpolated(DrawData* result,
   result->pos3.y() = poss[3].y();
 }
 
+/*!
+ * Hash of everything that affects the output of run_fixed_animation: the interpolated values of
+ * the layers that are active at this time, and the textures they read.
+ */
+u64 TextureAnimator::fixed_animation_input_hash(const FixedAnim& anim,
+                                                float time,
+                                                bool debug_flag) const {
+  u64 hash = fnv64(&debug_flag, sizeof(bool));
+  auto add = [&](const void* data, size_t len) {
+    const auto* ptr = (const u8*)data;
+    for (size_t i = 0; i < len; i++) {
+      hash = 1099511628211 * (((u64)ptr[i]) ^ hash);
+    }
+  };
+
+  LayerVals interpolated_values;
+  for (size_t layer_idx = 0; layer_idx < anim.def.layers.size(); layer_idx++) {
+    auto& layer_def = anim.def.layers[layer_idx];
+    auto& layer_dyn = anim.dynamic_data[layer_idx];
+    if (time < layer_def.start_time || time > layer_def.end_time || layer_def.disable) {
+      continue;
+    }
+    interpolate_layer_values(
+        (time - layer_def.start_time) / (layer_def.end_time - layer_def.start_time),
+        &interpolated_values, layer_dyn.start_vals, layer_dyn.end_vals);
+    add(&layer_idx, sizeof(size_t));
+    // the padding isn't set by interpolation, so leave it out
+    add(&interpolated_values, offsetof(LayerVals, pad));
+
+    const auto& src = anim.src_textures.at(layer_idx);
+    if (src.is_anim_slot) {
+      add(&m_private_output_slots.at(src.idx), sizeof(GLuint));
+      add(&m_private_output_slot_versions.at(src.idx), sizeof(u32));
+    } else {
+      add(&src.idx, sizeof(u64));
+    }
+  }
+  return hash;
+}
+
+/*!
+ * Draw all layers of a fixed animation with one draw, instead of one clear and two draws per layer.
+ * Returns false without drawing anything if the animation has a layer the shader can't handle.
+ */
+bool TextureAnimator::run_fixed_animation_single_pass(FixedAnim& anim, float time) {
+  const int w = anim.fbt->width();
+  const int h = anim.fbt->height();
+  int layer_count = 0;
+  LayerVals interpolated_values;
+  DrawData draw_data;
+  for (size_t layer_idx = 0; layer_idx < anim.def.layers.size(); layer_idx++) {
+    auto& layer_def = anim.def.layers[layer_idx];
+    auto& layer_dyn = anim.dynamic_data[layer_idx];
+    if (time < layer_def.start_time || time > layer_def.end_time || layer_def.disable) {
+      continue;
+    }
+    const int blend = single_pass_blend_mode(layer_def);
+    if (blend < 0 || layer_count == kMaxSinglePassLayers) {
+      return false;
+    }
+
+    interpolate_layer_values(
+        (time - layer_def.start_time) / (layer_def.end_time - layer_def.start_time),
+        &interpolated_values, layer_dyn.start_vals, layer_dyn.end_vals);
+    set_draw_data_from_interpolated(&draw_data, interpolated_values, w, h);
+
+    // the quad is a parallelogram: corner 0 is local (0, 0), 1 is (1, 0) and 2 is (0, 1).
+    float pos[3 * 3];
+    convert_gs_position_to_vec3(pos, draw_data.pos0, w, h);
+    convert_gs_position_to_vec3(pos + 3, draw_data.pos1, w, h);
+    convert_gs_position_to_vec3(pos + 6, draw_data.pos2, w, h);
+    const math::Vector2f p0(pos[0], pos[1]);
+    const math::Vector2f e1(pos[3] - pos[0], pos[4] - pos[1]);
+    const math::Vector2f e2(pos[6] - pos[0], pos[7] - pos[1]);
+    const float det = e1.x() * e2.y() - e1.y() * e2.x();
+    if (det == 0) {
+      continue;  // covers no pixels
+    }
+
+    auto& out = m_single_pass.layers[layer_count];
+    out.local_x = math::Vector4f(e2.y() / det, -e2.x() / det,
+                                 (e2.x() * p0.y() - e2.y() * p0.x()) / det, 0);
+    out.local_y = math::Vector4f(-e1.y() / det, e1.x() / det,
+                                 (e1.y() * p0.x() - e1.x() * p0.y()) / det, 0);
+    out.uv0_du = math::Vector4f(draw_data.st0.x(), draw_data.st0.y(),
+                                draw_data.st1.x() - draw_data.st0.x(),
+                                draw_data.st1.y() - draw_data.st0.y());
+    out.dv_fix = math::Vector4f(draw_data.st2.x() - draw_data.st0.x(),
+                                draw_data.st2.y() - draw_data.st0.y(),
+                                (float)layer_def.blend_fix / 128.f, 0);
+    out.rgba = draw_data.color.cast<float>();
+    out.mode = math::Vector4<s32>(blend, anim.def.set_alpha, 0, 0);
+
+    const auto& src = anim.src_textures.at(layer_idx);
+    m_single_pass.textures[layer_count] =
+        src.is_anim_slot ? m_private_output_slots.at(src.idx) : src.idx;
+    m_single_pass.sampler_idx[layer_count] = layer_def.clamp_u + 2 * layer_def.clamp_v;
+    layer_count++;
+  }
+
+  FramebufferTexturePairContext ctxt(anim.fbt.value());
+  glUseProgram(m_single_pass.program);
+  glBindBuffer(GL_UNIFORM_BUFFER, m_single_pass.ubo);
+  // orphan, the previous animation's draw may still be reading it.
+  glBufferData(GL_UNIFORM_BUFFER, sizeof(m_single_pass.layers), nullptr, GL_STREAM_DRAW);
+  glBufferSubData(GL_UNIFORM_BUFFER, 0, layer_count * sizeof(SinglePassLayer),
+                  m_single_pass.layers);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  glBindBufferBase(GL_UNIFORM_BUFFER, kSinglePassUniformBinding, m_single_pass.ubo);
+  for (int i = 0; i < layer_count; i++) {
+    glActiveTexture(GL_TEXTURE0 + i);
+    glBindTexture(GL_TEXTURE_2D, m_single_pass.textures[i]);
+    glBindSampler(i, m_single_pass.samplers[m_single_pass.sampler_idx[i]]);
+  }
+
+  glUniform1i(m_single_pass.layer_count, layer_count);
+  glUniform4f(m_single_pass.clear_color, anim.def.color[0] / 128.f, anim.def.color[1] / 128.f,
+              anim.def.color[2] / 128.f, anim.def.color[3] / 128.f);
+  glUniform2f(m_single_pass.dest_size, w, h);
+  glDisable(GL_BLEND);
+  glDisable(GL_DEPTH_TEST);
+  glColorMask(true, true, true, true);
+  glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+
+  for (int i = 0; i < layer_count; i++) {
+    glBindSampler(i, 0);
+    glActiveTexture(GL_TEXTURE0 + i);
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+  glActiveTexture(GL_TEXTURE0);
+  glUseProgram(m_shader_id);
+  return true;
+}
+
 void TextureAnimator::run_fixed_animation(FixedAnim& anim, float time) {
-  {
+  const u64 input_hash =
+      fixed_animation_input_hash(anim, time, m_output_debug_flags.at(anim.dest_slot).b);
+  if (m_debug.skip_unchanged && anim.last_input_hash == input_hash) {
+    m_private_output_slots.at(anim.dest_slot) = anim.fbt->texture();
+    m_anim_stats.fixed.skipped++;
+    return;
+  }
+  anim.last_input_hash = input_hash;
+  m_private_output_slot_versions.at(anim.dest_slot)++;
+  m_anim_stats.fixed.run++;
+
+  if (!m_debug.single_pass_layers || !run_fixed_animation_single_pass(anim, time)) {
     FramebufferTexturePairContext ctxt(anim.fbt.value());
     // Clear
     {
@@ -73,7 +73,7 @@ class ClutBlender {
               const std::optional<std::string>& level_name,
               const tfrag3::Level* level,
               OpenGLTexturePool* tpool);
-  GLuint run(const float* weights);
+  bool run(const float* weights);
   GLuint texture() const { return m_texture; }
   bool at_default() const { return m_current_weights[0] == 1.f && m_current_weights[1] == 0.f; }
 
@@ -95,6 +95,17 @@ struct Psm32ToPsm8Scrambler {
   std::vector<int> destinations_per_byte;
 };
 
+/*!
+ * The same conversion as TextureConverter's upload_width + download_rgba8888 for PSMT8, but as a
+ * table: texel i of the PSMT8 output reads byte source_per_texel[i] of the PSM32 input, or -1 if
+ * that part of VRAM wasn't written. Works for any size, so it's built for the sizes that don't have
+ * a Psm32ToPsm8Scrambler.
+ */
+struct Psm32ToPsm8Gather {
+  Psm32ToPsm8Gather(int in_w, int in_h, int read_tex_width);
+  std::vector<int> source_per_texel;
+};
+
 struct ClutReader {
   std::array<int, 256> addrs;
   ClutReader() {
@@ -225,6 +236,8 @@ struct FixedAnim {
   int dest_slot;
   std::vector<FixedAnimSource> src_textures;
   GpuTexture* pool_gpu_tex = nullptr;
+  // hash of everything that went into the last render of fbt, to skip re-rendering the same thing.
+  std::optional<u64> last_input_hash;
 };
 
 struct FixedAnimArray {
@@ -316,6 +329,8 @@ class TextureAnimator {
   int create_fixed_anim_array(const std::vector<FixedAnimDef>& defs);
   void run_fixed_animation_array(int idx, const DmaTransfer& transfer, TexturePool* texture_pool);
   void run_fixed_animation(FixedAnim& anim, float time);
+  u64 fixed_animation_input_hash(const FixedAnim& anim, float time, bool debug_flag) const;
+  bool run_fixed_animation_single_pass(FixedAnim& anim, float time);
 
   struct DrawData {
     u8 tmpl1[16];
@@ -377,8 +392,47 @@ class TextureAnimator {
 
   struct {
     bool use_fast_scrambler = true;
+    bool skip_unchanged = true;
+    bool single_pass_layers = false;
   } m_debug;
 
+  // Layers for tex_anim_layers, which draws all layers of a fixed animation at once. Must match
+  // the shader's std140 layout.
+  static constexpr int kMaxSinglePassLayers = 16;
+  // uniform buffer binding point. 0 and 1 are used by collision and merc bones.
+  static constexpr int kSinglePassUniformBinding = 2;
+  struct SinglePassLayer {
+    math::Vector4f local_x;
+    math::Vector4f local_y;
+    math::Vector4f uv0_du;
+    math::Vector4f dv_fix;
+    math::Vector4f rgba;
+    math::Vector4<s32> mode;
+  };
+  static_assert(sizeof(SinglePassLayer) == 6 * 16);
+
+  struct {
+    GLuint program;
+    GLuint layer_count;
+    GLuint clear_color;
+    GLuint dest_size;
+    GLuint ubo;
+    GLuint samplers[4];  // by clamp_u + 2 * clamp_v
+    SinglePassLayer layers[kMaxSinglePassLayers];
+    GLuint textures[kMaxSinglePassLayers];
+    int sampler_idx[kMaxSinglePassLayers];
+  } m_single_pass;
+
+  // per-frame counts of animations that were rendered, or skipped because their inputs matched
+  // the last render.
+  struct AnimStats {
+    int run = 0;
+    int skipped = 0;
+  };
+  struct {
+    AnimStats fixed, clut, sky, slime;
+  } m_anim_stats;
+
   GLuint m_shader_id;
   GLuint m_dummy_texture;
   GLuint m_slime_lut_texture;
@@ -388,6 +442,8 @@ class TextureAnimator {
   int m_current_dest_tbp = -1;
 
   std::vector<GLuint> m_private_output_slots;
+  // incremented when the texture in the private output slot is redrawn in place.
+  std::vector<u32> m_private_output_slot_versions;
   std::vector<GLuint> m_public_output_slots;
   std::vector<int> m_skip_tbps;
 
@@ -426,6 +482,7 @@ class TextureAnimator {
 
   Psm32ToPsm8Scrambler m_psm32_to_psm8_8_8, m_psm32_to_psm8_16_16, m_psm32_to_psm8_32_32,
       m_psm32_to_psm8_64_64;
+  std::unordered_map<u64, Psm32ToPsm8Gather> m_psm32_to_psm8_gathers;  // by input w, h, tbw
   ClutReader m_clut_table;
 
  public:
@@ -529,6 +586,7 @@ class TextureAnimator {
   FramebufferTexturePair m_sky_hires_blend_texture;
   FramebufferTexturePair m_sky_hires_final_texture;
   GpuTexture* m_sky_hires_pool_gpu_tex = nullptr;
+  std::optional<SkyInput> m_last_sky_input, m_last_sky_hires_input;
 
   SlimeInput m_debug_slime_input;
   NoiseTexturePair m_slime_noise_textures[kNumSlimeNoiseLayers];
@@ -538,6 +596,7 @@ class TextureAnimator {
   GpuTexture* m_slime_scroll_pool_gpu_tex = nullptr;
   int m_slime_output_slot = -1;
   int m_slime_scroll_output_slot = -1;
+  std::optional<SlimeInput> m_last_slime_input;
   ShaderLibrary* m_shaders = nullptr;
 };
 
@@ -1,5 +1,8 @@
 #include "VisDataHandler.h"
 
+#include <bit>
+#include <cstring>
+
 #include "background/background_common.h"
 
 #include "third-party/imgui/imgui.h"
@@ -22,14 +25,10 @@ void VisDataHandler::draw_debug_window() {
 
 int bitcount(const u8* data) {
   int result = 0;
-  for (int byte = 0; byte < 16 * 128; byte++) {
-    u8 val = data[byte];
-    for (int i = 0; i < 8; i++) {
-      if (val & 1) {
-        result++;
-      }
-      val >>= 1;
-    }
+  for (int word = 0; word < 16 * 128 / 8; word++) {
+    u64 val;
+    memcpy(&val, data + word * 8, 8);
+    result += std::popcount(val);
   }
   return result;
 }
@@ -1,27 +1,45 @@
 #include "Warp.h"
 
-Warp::Warp(const std::string& name, int id, std::shared_ptr<Generic2> generic)
-    : BucketRenderer(name, id), m_generic(generic) {}
+#include "third-party/imgui/imgui.h"
+
+Warp::Warp(const std::string& name,
+           int id,
+           std::shared_ptr<Generic2> generic,
+           std::shared_ptr<FramebufferCopier> fb_copier)
+    : BucketRenderer(name, id), m_generic(generic), m_fb_copier(fb_copier) {}
 
 void Warp::draw_debug_window() {
+  ImGui::Text("Copied %dx%d", m_fb_copier->last_copy_width(), m_fb_copier->last_copy_height());
   m_generic->draw_debug_window();
 }
 
 void Warp::render(DmaFollower& dma, SharedRenderState* render_state, ScopedProfilerNode& prof) {
-  m_fb_copier.copy_now(render_state->render_fb_w, render_state->render_fb_h,
-                       render_state->render_fb);
+  // find the vertices first, so only the part of the framebuffer they sample is copied.
+  {
+    auto p = prof.make_scoped_child("prepare");
+    m_generic->prepare_in_mode(dma, render_state->next_bucket, render_state->version,
+                               Generic2::Mode::WARP);
+  }
+  if (render_state->partial_screen_copies) {
+    m_fb_copier->copy_region_now(render_state->render_fb_w, render_state->render_fb_h,
+                                 render_state->render_fb,
+                                 m_generic->warp_tex_coord_bounds(render_state->version));
+  } else {
+    m_fb_copier->copy_now(render_state->render_fb_w, render_state->render_fb_h,
+                          render_state->render_fb);
+  }
   render_state->texture_pool->move_existing_to_vram(m_warp_src_tex, m_tbp);
-  m_generic->render_in_mode(dma, render_state, prof, Generic2::Mode::WARP);
+  m_generic->draw_prepared(render_state, prof);
 }
 
 void Warp::init_textures(TexturePool& tex_pool, GameVersion version) {
   TextureInput in;
   // point to fb copier's texture.
-  in.gpu_texture = m_fb_copier.texture();
+  in.gpu_texture = m_fb_copier->texture();
   in.w = 32;
   in.h = 32;
   in.debug_page_name = "PC-WARP";
   in.debug_name = "PC-WARP";
   in.id = tex_pool.allocate_pc_port_texture(version);
   m_warp_src_tex = tex_pool.give_texture_and_load_to_vram(in, m_tbp);
-}
\ No newline at end of file
+}
@@ -7,14 +7,17 @@
 
 class Warp : public BucketRenderer {
  public:
-  Warp(const std::string& name, int id, std::shared_ptr<Generic2> generic);
+  Warp(const std::string& name,
+       int id,
+       std::shared_ptr<Generic2> generic,
+       std::shared_ptr<FramebufferCopier> fb_copier);
   void render(DmaFollower& dma, SharedRenderState* render_state, ScopedProfilerNode& prof) override;
   void draw_debug_window() override;
   void init_textures(TexturePool& tex_pool, GameVersion version) override;
 
  private:
   std::shared_ptr<Generic2> m_generic;
-  FramebufferCopier m_fb_copier;
+  std::shared_ptr<FramebufferCopier> m_fb_copier;  // shared with sprite distort
   GpuTexture* m_warp_src_tex = nullptr;
   u32 m_tbp = 1216;  // hack, jak 2
 };
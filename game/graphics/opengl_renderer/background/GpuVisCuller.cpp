@@ -0,0 +1,199 @@
+#include "GpuVisCuller.h"
+
+#include <algorithm>
+
+#include "common/util/Assert.h"
+
+GpuVisCuller::GpuVisCuller(const std::vector<tfrag3::StripDraw>& draws,
+                           const tfrag3::BVH& bvh,
+                           u32 num_protos,
+                           const Shader& shader) {
+  // groups, in the same order as the CPU multidraw code walks them.
+  std::vector<Group> groups;
+  m_first_group_per_draw.reserve(draws.size() + 1);
+  for (const auto& draw : draws) {
+    m_first_group_per_draw.push_back(groups.size());
+    u32 iidx = draw.unpacked.idx_of_first_idx_in_full_buffer;
+    for (const auto& grp : draw.vis_groups) {
+      auto& out = groups.emplace_back();
+      out.first_index = iidx;
+      out.num_inds = grp.num_inds;
+      out.vis_and_proto_idx = grp.vis_idx_in_pc_bvh | ((u32)grp.tie_proto_idx << 16);
+      out.base_instance = 0;
+      iidx += grp.num_inds;
+    }
+  }
+  m_first_group_per_draw.push_back(groups.size());
+  init(groups, nodes_from_bvh(bvh), num_protos, shader);
+}
+
+GpuVisCuller::GpuVisCuller(const std::vector<tfrag3::InstancedStripDraw>& draws,
+                           const tfrag3::BVH& bvh,
+                           const Shader& shader) {
+  // the wind index buffer has the draws back to back, like wind_vertex_index_offsets in Tie3.
+  std::vector<Group> groups;
+  m_first_group_per_draw.reserve(draws.size() + 1);
+  u32 iidx = 0;
+  for (const auto& draw : draws) {
+    m_first_group_per_draw.push_back(groups.size());
+    u32 grp_iidx = iidx;
+    for (const auto& grp : draw.instance_groups) {
+      auto& out = groups.emplace_back();
+      out.first_index = grp_iidx;
+      out.num_inds = grp.num;
+      out.vis_and_proto_idx = grp.vis_idx;
+      out.base_instance = grp.instance_idx;
+      grp_iidx += grp.num;
+    }
+    iidx += draw.vertex_index_stream.size();
+  }
+  m_first_group_per_draw.push_back(groups.size());
+  init(groups, nodes_from_bvh(bvh), 0, shader);
+}
+
+GpuVisCuller::GpuVisCuller(const tfrag3::Hfragment& hfrag, const Shader& shader) {
+  std::vector<Node> nodes(hfrag.corners.size());
+  for (size_t i = 0; i < hfrag.corners.size(); i++) {
+    ASSERT(hfrag.corners[i].vis_id < 0xffff);
+    nodes[i].bsphere = hfrag.corners[i].bsphere;
+    nodes[i].my_id = hfrag.corners[i].vis_id;
+  }
+
+  std::vector<Group> groups;
+  m_first_group_per_draw.reserve(hfrag.buckets.size() + 1);
+  for (const auto& bucket : hfrag.buckets) {
+    m_first_group_per_draw.push_back(groups.size());
+    for (u32 corner_idx : bucket.corners) {
+      ASSERT(corner_idx < 0xffff);
+      const auto& corner = hfrag.corners.at(corner_idx);
+      auto& out = groups.emplace_back();
+      out.first_index = corner.index_start;
+      out.num_inds = corner.index_length;
+      out.vis_and_proto_idx = corner_idx;
+      out.base_instance = 0;
+    }
+  }
+  m_first_group_per_draw.push_back(groups.size());
+  init(groups, std::move(nodes), 0, shader);
+}
+
+std::vector<GpuVisCuller::Node> GpuVisCuller::nodes_from_bvh(const tfrag3::BVH& bvh) {
+  std::vector<Node> nodes(bvh.vis_nodes.size());
+  for (size_t i = 0; i < bvh.vis_nodes.size(); i++) {
+    nodes[i].bsphere = bvh.vis_nodes[i].bsphere;
+    nodes[i].my_id = bvh.vis_nodes[i].my_id;
+  }
+  return nodes;
+}
+
+void GpuVisCuller::init(const std::vector<Group>& groups,
+                        std::vector<Node> nodes,
+                        u32 num_protos,
+                        const Shader& shader) {
+  m_num_groups = groups.size();
+
+  u32 max_id = 0;
+  for (const auto& node : nodes) {
+    if (node.my_id != 0xffff) {
+      max_id = std::max(max_id, node.my_id);
+    }
+  }
+  // never make an empty buffer, so the bindings are always valid.
+  if (nodes.empty()) {
+    nodes.emplace_back();
+  }
+  m_occlusion_string_len = max_id / 8 + 1;
+  m_occlusion_bytes = (m_occlusion_string_len + 3) & ~3;
+  m_proto_bytes = (std::max(num_protos, 1u) + 3) & ~3;
+
+  GLint alignment = 1;
+  glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+  m_ssbo_alignment = std::max(alignment, 4);
+
+  glGenBuffers(1, &m_groups_buffer);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_groups_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, std::max(1u, m_num_groups) * sizeof(Group),
+               groups.data(), GL_STATIC_DRAW);
+
+  glGenBuffers(1, &m_nodes_buffer);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_nodes_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, nodes.size() * sizeof(Node), nodes.data(),
+               GL_STATIC_DRAW);
+
+  glGenBuffers(1, &m_commands_buffer);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_commands_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, std::max(1u, m_num_groups) * kCommandSize, nullptr,
+               GL_DYNAMIC_COPY);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  // enough for a few frames of occlusion and proto strings.
+  m_frame_data = std::make_unique<StreamingBuffer>(
+      8 * (m_occlusion_bytes + m_proto_bytes + 2 * m_ssbo_alignment));
+
+  auto id = shader.id();
+  m_uniforms.planes = glGetUniformLocation(id, "planes");
+  m_uniforms.num_groups = glGetUniformLocation(id, "num_groups");
+  m_uniforms.use_occlusion = glGetUniformLocation(id, "use_occlusion");
+  m_uniforms.use_proto_vis = glGetUniformLocation(id, "use_proto_vis");
+}
+
+GpuVisCuller::~GpuVisCuller() {
+  glDeleteBuffers(1, &m_groups_buffer);
+  glDeleteBuffers(1, &m_nodes_buffer);
+  glDeleteBuffers(1, &m_commands_buffer);
+}
+
+bool GpuVisCuller::supported(SharedRenderState* render_state) {
+  return render_state->shaders[ShaderId::BACKGROUND_CULL].okay();
+}
+
+void GpuVisCuller::dispatch(const Shader& shader,
+                            const math::Vector4f* planes,
+                            const u8* occlusion_string,
+                            const std::vector<u8>* proto_vis_flags) {
+  if (!m_num_groups) {
+    return;
+  }
+  shader.activate();
+  glUniform4fv(m_uniforms.planes, 4, planes[0].data());
+  glUniform1ui(m_uniforms.num_groups, m_num_groups);
+  glUniform1i(m_uniforms.use_occlusion, occlusion_string != nullptr);
+  glUniform1i(m_uniforms.use_proto_vis, proto_vis_flags != nullptr);
+
+  u32 occlusion_offset = m_frame_data->allocate(m_occlusion_bytes, m_ssbo_alignment);
+  if (occlusion_string) {
+    m_frame_data->write(occlusion_offset, occlusion_string, m_occlusion_string_len);
+  }
+  u32 proto_offset = m_frame_data->allocate(m_proto_bytes, m_ssbo_alignment);
+  if (proto_vis_flags) {
+    m_frame_data->write(proto_offset, proto_vis_flags->data(),
+                        std::min((size_t)m_proto_bytes, proto_vis_flags->size()));
+  }
+
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_groups_buffer);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_nodes_buffer);
+  glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 2, m_frame_data->buffer(), occlusion_offset,
+                    m_occlusion_bytes);
+  glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 3, m_frame_data->buffer(), proto_offset,
+                    m_proto_bytes);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, m_commands_buffer);
+
+  glDispatchCompute((m_num_groups + kWorkgroupSize - 1) / kWorkgroupSize, 1, 1);
+  glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+
+  for (int i = 0; i < 5; i++) {
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, i, 0);
+  }
+}
+
+void GpuVisCuller::draw(u64 draw_mode, size_t draw_idx) const {
+  const u32 first = m_first_group_per_draw[draw_idx];
+  const u32 count = m_first_group_per_draw[draw_idx + 1] - first;
+  if (!count) {
+    return;
+  }
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_commands_buffer);
+  glMultiDrawElementsIndirect(draw_mode, GL_UNSIGNED_INT, (void*)(u64)(first * kCommandSize),
+                              count, 0);
+  glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/custom_data/Tfrag3Data.h"
+#include "common/math/Vector.h"
+
+#include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
+
+/*!
+ * Culls the vis groups of a tfrag or tie tree on the GPU, with the BACKGROUND_CULL compute shader.
+ * The groups and BVH are uploaded once when the tree is loaded, then each frame only the camera
+ * planes and the occlusion/proto strings are sent. The shader writes an indirect draw command for
+ * every vis group, so the per-draw multidraw arrays are never built on the CPU.
+ */
+class GpuVisCuller {
+ public:
+  GpuVisCuller(const std::vector<tfrag3::StripDraw>& draws,
+               const tfrag3::BVH& bvh,
+               u32 num_protos,
+               const Shader& shader);
+
+  /*!
+   * Cull the instance groups of tie wind draws instead. The commands index into the tree's wind
+   * index buffer, and their base instance is the group's instance.
+   */
+  GpuVisCuller(const std::vector<tfrag3::InstancedStripDraw>& draws,
+               const tfrag3::BVH& bvh,
+               const Shader& shader);
+
+  /*!
+   * Cull the corners of a hfrag. Each bucket is a draw, and each corner in it is a group with its
+   * own bounding sphere and occlusion bit, so there's no BVH.
+   */
+  GpuVisCuller(const tfrag3::Hfragment& hfrag, const Shader& shader);
+  ~GpuVisCuller();
+  GpuVisCuller(const GpuVisCuller&) = delete;
+  GpuVisCuller& operator=(const GpuVisCuller&) = delete;
+
+  /*!
+   * Can the GPU culling path be used at all?
+   */
+  static bool supported(SharedRenderState* render_state);
+
+  /*!
+   * Cull all groups. The occlusion string and proto visibility flags are optional.
+   */
+  void dispatch(const Shader& shader,
+                const math::Vector4f* planes,
+                const u8* occlusion_string,
+                const std::vector<u8>* proto_vis_flags);
+
+  /*!
+   * Draw one StripDraw with the commands from the last dispatch. The tree's vertex array and full
+   * index buffer must be bound.
+   */
+  void draw(u64 draw_mode, size_t draw_idx) const;
+
+  bool draw_is_empty(size_t draw_idx) const {
+    return m_first_group_per_draw[draw_idx + 1] == m_first_group_per_draw[draw_idx];
+  }
+
+ private:
+  struct Group {
+    u32 first_index;
+    u32 num_inds;
+    u32 vis_and_proto_idx;  // vis_idx | (proto_idx << 16)
+    u32 base_instance;
+  };
+  struct Node {
+    math::Vector4f bsphere;
+    u32 my_id;
+    u32 pad[3];
+  };
+  static_assert(sizeof(Group) == 16);
+  static_assert(sizeof(Node) == 32);
+  static constexpr int kCommandSize = 5 * sizeof(u32);
+  static constexpr int kWorkgroupSize = 64;
+
+  static std::vector<Node> nodes_from_bvh(const tfrag3::BVH& bvh);
+  void init(const std::vector<Group>& groups,
+            std::vector<Node> nodes,
+            u32 num_protos,
+            const Shader& shader);
+
+  std::vector<u32> m_first_group_per_draw;  // one extra at the end
+  u32 m_num_groups = 0;
+  u32 m_occlusion_string_len = 0;
+  u32 m_occlusion_bytes = 0;  // rounded up to whole words
+  u32 m_proto_bytes = 0;
+  u32 m_ssbo_alignment = 1;
+
+  GLuint m_groups_buffer = 0;
+  GLuint m_nodes_buffer = 0;
+  GLuint m_commands_buffer = 0;
+  std::unique_ptr<StreamingBuffer> m_frame_data;
+
+  struct {
+    GLint planes, num_groups, use_occlusion, use_proto_vis;
+  } m_uniforms;
+};
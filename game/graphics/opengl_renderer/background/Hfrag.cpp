@@ -32,10 +32,15 @@ void Hfrag::draw_debug_window() {
     } else {
       ImGui::Text("Level %s", level.name.c_str());
       ImGui::Text(" total corners:   %d", level.stats.total_corners);
-      ImGui::Text(" in view corners: %d", level.stats.corners_in_view);
-      ImGui::Text(" in view and not occluded corners: %d",
-                  level.stats.corners_in_view_and_not_occluded);
-      ImGui::Text(" buckets used: %d", level.stats.buckets_used);
+      if (level.stats.gpu_culled) {
+        ImGui::Text(" corners culled on the GPU");
+      } else {
+        ImGui::Text(" in view corners: %d", level.stats.corners_in_view);
+        ImGui::Text(" in view and not occluded corners: %d",
+                    level.stats.corners_in_view_and_not_occluded);
+        ImGui::Text(" buckets used: %d", level.stats.buckets_used);
+      }
+      ImGui::Text(" montages drawn: %d", level.stats.montages_drawn);
     }
   }
 }
@@ -138,6 +143,9 @@ Hfrag::HfragLevel* Hfrag::get_hfrag_level(const std::string& name,
   for (auto& lev : m_levels) {
     if (lev.in_use && lev.name == name && lev.load_id == lev_data->load_id) {
       // we can reuse it!
+      if (lev.wang_texture_idx < lev_data->texture_base_levels.size()) {
+        lev.wang_base_level = lev_data->texture_base_levels[lev.wang_texture_idx];
+      }
       return &lev;
     }
   }
@@ -147,7 +155,7 @@ Hfrag::HfragLevel* Hfrag::get_hfrag_level(const std::string& name,
     if (lev.in_use && lev.name == name) {
       // unload the previous copy and reload
       unload_hfrag_level(&lev);
-      load_hfrag_level(name, &lev, lev_data);
+      load_hfrag_level(name, &lev, lev_data, render_state);
       return &lev;
     }
   }
@@ -155,7 +163,7 @@ Hfrag::HfragLevel* Hfrag::get_hfrag_level(const std::string& name,
   // prefer to load in an unused slot
   for (auto& lev : m_levels) {
     if (!lev.in_use) {
-      load_hfrag_level(name, &lev, lev_data);
+      load_hfrag_level(name, &lev, lev_data, render_state);
       return &lev;
     }
   }
@@ -176,13 +184,15 @@ Hfrag::HfragLevel* Hfrag::get_hfrag_level(const std::string& name,
 
   ASSERT(oldest_lev);
   unload_hfrag_level(oldest_lev);
-  load_hfrag_level(name, oldest_lev, lev_data);
+  load_hfrag_level(name, oldest_lev, lev_data, render_state);
   return oldest_lev;
 }
 
 void Hfrag::unload_hfrag_level(Hfrag::HfragLevel* lev) {
   ASSERT(lev->in_use);
   // delete OpenGL resources we created.
+  lev->tod_blender.reset();
+  lev->gpu_culler.reset();
   glBindTexture(GL_TEXTURE_1D, lev->time_of_day_texture);
   glDeleteTextures(1, &lev->time_of_day_texture);
   glDeleteVertexArrays(1, &lev->vao);
@@ -198,7 +208,8 @@ void Hfrag::unload_hfrag_level(Hfrag::HfragLevel* lev) {
 
 void Hfrag::load_hfrag_level(const std::string& load_name,
                              Hfrag::HfragLevel* lev,
-                             const LevelData* data) {
+                             const LevelData* data,
+                             SharedRenderState* render_state) {
   ASSERT(!lev->in_use);
 
   lev->in_use = true;
@@ -208,10 +219,14 @@ void Hfrag::load_hfrag_level(const std::string& load_name,
   lev->index_buffer = data->hfrag_indices;
   lev->num_colors = data->level->hfrag.time_of_day_colors.color_count;
   lev->hfrag = &data->level->hfrag;
-  lev->wang_texture = data->textures.at(data->level->hfrag.wang_tree_tex_id[0]);
-
-  if (m_color_result.size() < lev->num_colors) {
-    m_color_result.resize(lev->num_colors);
+  lev->wang_texture_idx = data->level->hfrag.wang_tree_tex_id[0];
+  lev->wang_texture = data->textures.at(lev->wang_texture_idx);
+  lev->wang_base_level = 0;
+  if (lev->wang_texture_idx < data->texture_base_levels.size()) {
+    lev->wang_base_level = data->texture_base_levels[lev->wang_texture_idx];
+  }
+  for (auto& base_level : lev->montage_base_level) {
+    base_level = -1;
   }
 
   ASSERT(lev->hfrag->buckets.size() == kNumBuckets);
@@ -257,12 +272,19 @@ void Hfrag::load_hfrag_level(const std::string& load_name,
   glActiveTexture(GL_TEXTURE10);
   glGenTextures(1, &lev->time_of_day_texture);
   glBindTexture(GL_TEXTURE_1D, lev->time_of_day_texture);
-  glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
+  glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
                GL_UNSIGNED_INT_8_8_8_8, nullptr);
   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
   glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  lev->tod_blender = std::make_unique<TimeOfDayBlender>(lev->hfrag->time_of_day_colors,
+                                                        lev->time_of_day_texture, render_state);
   glBindVertexArray(0);
 
+  if (GpuVisCuller::supported(render_state)) {
+    lev->gpu_culler = std::make_unique<GpuVisCuller>(
+        *lev->hfrag, render_state->shaders[ShaderId::BACKGROUND_CULL]);
+  }
+
   // montage
 
   struct MontageVertex {
@@ -350,8 +372,23 @@ void Hfrag::render_hfrag_level(Hfrag::HfragLevel* lev,
   }
   lev->stats = {};
 
+  const bool gpu_culled = lev->gpu_culler && render_state->gpu_background_culling &&
+                          !render_state->no_multidraw;
+  if (gpu_culled) {
+    // the CPU doesn't know which corners are visible, so make sure every montage is ready. They're
+    // cached, so this only draws them once.
+    lev->gpu_culler->dispatch(render_state->shaders[ShaderId::BACKGROUND_CULL],
+                              pc_data.camera.planes, occlusion_data, nullptr);
+    lev->stats.gpu_culled = true;
+    lev->stats.total_corners = lev->hfrag->corners.size();
+    for (int bucket_idx = 1; bucket_idx < kNumBuckets; bucket_idx++) {
+      m_bucket_used[bucket_idx] = true;
+    }
+  }
+
   // bucket 0 is not drawn, although there is data there.
-  for (u32 bucket_idx = 1; bucket_idx < lev->hfrag->buckets.size(); bucket_idx++) {
+  for (u32 bucket_idx = 1; !gpu_culled && bucket_idx < lev->hfrag->buckets.size();
+       bucket_idx++) {
     const auto& bucket = lev->hfrag->buckets[bucket_idx];
     for (u32 corner_idx : bucket.corners) {
       const auto& corner = lev->hfrag->corners[corner_idx];
@@ -388,11 +425,7 @@ void Hfrag::render_hfrag_level(Hfrag::HfragLevel* lev,
   render_hfrag_montage_textures(lev, render_state, prof);
 
   // generate time of day texture
-  interp_time_of_day(pc_data.camera.itimes, lev->hfrag->time_of_day_colors, m_color_result.data());
-  glActiveTexture(GL_TEXTURE10);
-  glBindTexture(GL_TEXTURE_1D, lev->time_of_day_texture);
-  glTexSubImage1D(GL_TEXTURE_1D, 0, 0, lev->num_colors, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV,
-                  m_color_result.data());
+  lev->tod_blender->update(pc_data.camera.itimes, render_state);
 
   // initialize data
   glBindVertexArray(lev->vao);
@@ -417,6 +450,14 @@ void Hfrag::render_hfrag_level(Hfrag::HfragLevel* lev,
     glBindTexture(GL_TEXTURE_2D, lev->montage_texture[bucket_idx].fb.texture());
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);  // HACK rm
 
+    if (gpu_culled) {
+      if (!lev->gpu_culler->draw_is_empty(bucket_idx)) {
+        lev->gpu_culler->draw(GL_TRIANGLE_STRIP, bucket_idx);
+        prof.add_draw_call(1);
+      }
+      continue;
+    }
+
     const auto& bucket = lev->hfrag->buckets[bucket_idx];
     for (u32 corner_idx : bucket.corners) {
       const auto& corner = lev->hfrag->corners[corner_idx];
@@ -433,6 +474,14 @@ void Hfrag::render_hfrag_level(Hfrag::HfragLevel* lev,
 void Hfrag::render_hfrag_montage_textures(Hfrag::HfragLevel* lev,
                                           SharedRenderState* render_state,
                                           ScopedProfilerNode& prof) {
+  bool any_stale = false;
+  for (int bi = 0; bi < kNumBuckets; bi++) {
+    any_stale |= m_bucket_used[bi] && lev->montage_base_level[bi] != lev->wang_base_level;
+  }
+  if (!any_stale) {
+    return;
+  }
+
   glBindVertexArray(lev->montage_vao);
   glBindBuffer(GL_ARRAY_BUFFER, lev->montage_vertices);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_montage_indices);
@@ -446,9 +495,11 @@ void Hfrag::render_hfrag_montage_textures(Hfrag::HfragLevel* lev,
   glUniform1i(glGetUniformLocation(sh.id(), "tex_T0"), 0);
 
   for (int bi = 0; bi < kNumBuckets; bi++) {
-    if (!m_bucket_used[bi]) {
-      continue;  // no need to generate textures
+    if (!m_bucket_used[bi] || lev->montage_base_level[bi] == lev->wang_base_level) {
+      continue;  // not needed, or already drawn from the current wang texture
     }
+    lev->montage_base_level[bi] = lev->wang_base_level;
+    lev->stats.montages_drawn++;
 
     FramebufferTexturePairContext ctxt(lev->montage_texture[bi].fb);  // render to texture
     glActiveTexture(GL_TEXTURE0);
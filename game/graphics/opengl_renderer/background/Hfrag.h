@@ -1,6 +1,8 @@
 #pragma once
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/background/GpuVisCuller.h"
+#include "game/graphics/opengl_renderer/background/TimeOfDayBlender.h"
 #include "game/graphics/opengl_renderer/background/background_common.h"
 #include "game/graphics/opengl_renderer/opengl_utils.h"
 
@@ -29,14 +31,20 @@ class Hfrag : public BucketRenderer {
     GLuint vertex_buffer;
     GLuint index_buffer;
     GLuint time_of_day_texture;
+    std::unique_ptr<TimeOfDayBlender> tod_blender;
     GLuint vao;
     tfrag3::Hfragment* hfrag = nullptr;
     u64 num_colors = 0;
     u64 last_used_frame = 0;
+    std::unique_ptr<GpuVisCuller> gpu_culler;
 
     GLuint wang_texture;
+    u32 wang_texture_idx = 0;
+    int wang_base_level = 0;  // goes down as the loader streams in the larger mips
 
+    // the montages only depend on the wang texture, so they're kept until it changes.
     MontageTexture montage_texture[kNumBuckets];
+    int montage_base_level[kNumBuckets];  // wang_base_level when drawn, -1 if not drawn yet
     GLuint montage_vertices;
     GLuint montage_vao;
 
@@ -45,6 +53,8 @@ class Hfrag : public BucketRenderer {
       int corners_in_view = 0;
       int corners_in_view_and_not_occluded = 0;
       int buckets_used = 0;
+      int montages_drawn = 0;
+      bool gpu_culled = false;
     } stats;
   };
 
@@ -54,7 +64,10 @@ class Hfrag : public BucketRenderer {
    */
   HfragLevel* get_hfrag_level(const std::string& name, SharedRenderState* render_state);
   void unload_hfrag_level(HfragLevel* lev);
-  void load_hfrag_level(const std::string& load_name, HfragLevel* lev, const LevelData* data);
+  void load_hfrag_level(const std::string& load_name,
+                        HfragLevel* lev,
+                        const LevelData* data,
+                        SharedRenderState* render_state);
   void render_hfrag_level(HfragLevel* lev,
                           SharedRenderState* render_state,
                           ScopedProfilerNode& prof,
@@ -68,7 +81,6 @@ class Hfrag : public BucketRenderer {
   static constexpr int kMaxLevels = 2;
   std::array<HfragLevel, kMaxLevels> m_levels;
   static constexpr int TIME_OF_DAY_COLOR_COUNT = 8192;
-  std::vector<math::Vector<u8, 4>> m_color_result;
 
   bool m_bucket_used[kNumBuckets];
   bool m_corner_vis[kNumCorners];
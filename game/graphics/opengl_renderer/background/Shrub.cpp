@@ -2,9 +2,7 @@
 
 #include "common/log/log.h"
 
-Shrub::Shrub(const std::string& name, int my_id) : BucketRenderer(name, my_id) {
-  m_color_result.resize(TIME_OF_DAY_COLOR_COUNT);
-}
+Shrub::Shrub(const std::string& name, int my_id) : BucketRenderer(name, my_id) {}
 
 Shrub::~Shrub() {
   discard_tree_cache();
@@ -67,7 +65,7 @@ void Shrub::render(DmaFollower& dma, SharedRenderState* render_state, ScopedProf
   render_all_trees(settings, render_state, prof);
 }
 
-void Shrub::update_load(const LevelData* loader_data) {
+void Shrub::update_load(const LevelData* loader_data, SharedRenderState* render_state) {
   const tfrag3::Level* lev_data = loader_data->level.get();
   // We changed level!
   discard_tree_cache();
@@ -75,20 +73,12 @@ void Shrub::update_load(const LevelData* loader_data) {
 
   size_t max_draws = 0;
   u32 time_of_day_count = 0;
-  size_t max_num_grps = 0;
   size_t max_inds = 0;
 
   for (u32 l_tree = 0; l_tree < lev_data->shrub_trees.size(); l_tree++) {
-    size_t num_grps = 0;
-
     const auto& tree = lev_data->shrub_trees[l_tree];
     max_draws = std::max(tree.static_draws.size(), max_draws);
-    for (auto& draw : tree.static_draws) {
-      (void)draw;
-      // num_grps += draw.vis_groups.size(); TODO
-      max_num_grps += 1;
-    }
-    max_num_grps = std::max(max_num_grps, num_grps);
+    build_draw_groups(&m_trees[l_tree], tree.static_draws);
 
     time_of_day_count = std::max(tree.time_of_day_colors.color_count, time_of_day_count);
     max_inds = std::max(tree.indices.size(), max_inds);
@@ -153,22 +143,52 @@ void Shrub::update_load(const LevelData* loader_data) {
     glActiveTexture(GL_TEXTURE10);
     glGenTextures(1, &m_trees[l_tree].time_of_day_texture);
     glBindTexture(GL_TEXTURE_1D, m_trees[l_tree].time_of_day_texture);
-    glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
+    glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
                  GL_UNSIGNED_INT_8_8_8_8, nullptr);
     glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    m_trees[l_tree].tod_blender = std::make_unique<TimeOfDayBlender>(
+        tree.time_of_day_colors, m_trees[l_tree].time_of_day_texture, render_state);
 
     glBindVertexArray(0);
   }
 
-  m_cache.multidraw_offset_per_stripdraw.resize(max_draws);
-  m_cache.multidraw_count_buffer.resize(max_num_grps);
-  m_cache.multidraw_index_offset_buffer.resize(max_num_grps);
+  m_cache.multidraw_count_buffer.resize(max_draws);
+  m_cache.multidraw_index_offset_buffer.resize(max_draws);
   m_cache.draw_idx_temp.resize(max_draws);
   m_cache.index_temp.resize(max_inds);
   ASSERT(time_of_day_count <= TIME_OF_DAY_COLOR_COUNT);
 }
 
+/*!
+ * Group the draws of a tree by texture and mode, so each group is one multidraw. The extractor
+ * splits the draws of jak 2 and 3 by proto, so protos can be hidden, which leaves many small draws
+ * with the same settings.
+ * The draws are already in no particular order: the extractor puts all instances with the same
+ * settings in one draw. So drawing a whole group at its first draw is fine.
+ */
+void Shrub::build_draw_groups(Tree* tree, const std::vector<tfrag3::ShrubDraw>& draws) {
+  std::unordered_map<u64, u32> group_of_key;
+  std::vector<std::vector<u32>> groups;
+  for (u32 i = 0; i < draws.size(); i++) {
+    u64 key = ((u64)draws[i].tree_tex_id << 32) | draws[i].mode.as_int();
+    auto [it, added] = group_of_key.try_emplace(key, groups.size());
+    if (added) {
+      groups.emplace_back();
+    }
+    groups[it->second].push_back(i);
+  }
+
+  tree->draw_groups.clear();
+  tree->group_draws.clear();
+  for (auto& group : groups) {
+    auto& out = tree->draw_groups.emplace_back();
+    out.first = tree->group_draws.size();
+    out.count = group.size();
+    tree->group_draws.insert(tree->group_draws.end(), group.begin(), group.end());
+  }
+}
+
 bool Shrub::setup_for_level(const std::string& level, SharedRenderState* render_state) {
   // make sure we have the level data.
   Timer tfrag3_setup_timer;
@@ -195,7 +215,7 @@ bool Shrub::setup_for_level(const std::string& level, SharedRenderState* render_
   m_load_id = lev_data->load_id;
 
   if (m_level_name != level) {
-    update_load(lev_data);
+    update_load(lev_data, render_state);
     m_has_level = true;
     m_level_name = level;
   } else {
@@ -211,6 +231,7 @@ bool Shrub::setup_for_level(const std::string& level, SharedRenderState* render_
 
 void Shrub::discard_tree_cache() {
   for (auto& tree : m_trees) {
+    tree.tod_blender.reset();
     glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
     glDeleteTextures(1, &tree.time_of_day_texture);
     glDeleteBuffers(1, &tree.index_buffer);
@@ -280,19 +301,11 @@ void Shrub::render_tree(int idx,
     return;
   }
 
-  if (m_color_result.size() < tree.colors->color_count) {
-    m_color_result.resize(tree.colors->color_count);
-  }
-
   Timer interp_timer;
-  interp_time_of_day(settings.camera.itimes, *tree.colors, m_color_result.data());
+  tree.tod_blender->update(settings.camera.itimes, render_state);
   tree.perf.tod_time.add(interp_timer.getSeconds());
 
   Timer setup_timer;
-  glActiveTexture(GL_TEXTURE10);
-  glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
-  glTexSubImage1D(GL_TEXTURE_1D, 0, 0, tree.colors->color_count, GL_RGBA,
-                  GL_UNSIGNED_INT_8_8_8_8_REV, m_color_result.data());
 
   first_tfrag_draw_setup(settings.camera, render_state, ShaderId::SHRUB);
 
@@ -318,34 +331,54 @@ void Shrub::render_tree(int idx,
         m_cache.draw_idx_temp.data(), m_cache.index_temp.data(), *tree.draws, tree.index_data);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size * sizeof(u32), m_cache.index_temp.data(),
                  GL_STREAM_DRAW);
-  } else {
-    make_all_visible_multidraws(m_cache.multidraw_offset_per_stripdraw.data(),
-                                m_cache.multidraw_count_buffer.data(),
-                                m_cache.multidraw_index_offset_buffer.data(), *tree.draws);
   }
 
   tree.perf.index_time.add(index_timer.getSeconds());
 
   Timer draw_timer;
 
-  for (size_t draw_idx = 0; draw_idx < tree.draws->size(); draw_idx++) {
-    const auto& draw = tree.draws->operator[](draw_idx);
-    if (!tree.proto_vis_mask.at(draw.proto_idx)) {
-      continue;
-    }
-    const auto& multidraw_indices = m_cache.multidraw_offset_per_stripdraw[draw_idx];
-    const auto& singledraw_indices = m_cache.draw_idx_temp[draw_idx];
-
-    if (render_state->no_multidraw) {
-      if (singledraw_indices.second == 0) {
+  GLsizei* counts = m_cache.multidraw_count_buffer.data();
+  void** offsets = m_cache.multidraw_index_offset_buffer.data();
+  for (const auto& group : tree.draw_groups) {
+    // the visible draws of the group
+    int num_draws = 0;
+    u32 num_tris = 0;
+    for (u32 i = group.first; i < group.first + group.count; i++) {
+      const u32 draw_idx = tree.group_draws[i];
+      const auto& draw = tree.draws->operator[](draw_idx);
+      if (!tree.proto_vis_mask.at(draw.proto_idx)) {
         continue;
       }
-    } else {
-      if (multidraw_indices.second == 0) {
+      if (render_state->no_multidraw) {
+        const auto& singledraw_indices = m_cache.draw_idx_temp[draw_idx];
+        counts[num_draws] = singledraw_indices.second;
+        offsets[num_draws] = (void*)(singledraw_indices.first * sizeof(u32));
+      } else {
+        counts[num_draws] = draw.num_indices;
+        offsets[num_draws] = (void*)((u64)draw.first_index_index * sizeof(u32));
+      }
+      if (counts[num_draws] == 0) {
         continue;
       }
+      num_draws++;
+      num_tris += draw.num_triangles;
+    }
+    if (num_draws == 0) {
+      continue;
     }
 
+    auto draw_visible = [&]() {
+      if (render_state->no_multidraw) {
+        for (int i = 0; i < num_draws; i++) {
+          glDrawElements(GL_TRIANGLE_STRIP, counts[i], GL_UNSIGNED_INT, offsets[i]);
+        }
+      } else {
+        glMultiDrawElements(GL_TRIANGLE_STRIP, counts, GL_UNSIGNED_INT, offsets, num_draws);
+      }
+    };
+
+    // all draws of the group have the same settings.
+    const auto& draw = tree.draws->operator[](tree.group_draws[group.first]);
     if ((int)draw.tree_tex_id != last_texture) {
       glBindTexture(GL_TEXTURE_2D, m_textures->at(draw.tree_tex_id));
       last_texture = draw.tree_tex_id;
@@ -356,19 +389,11 @@ void Shrub::render_tree(int idx,
     auto double_draw = setup_tfrag_shader(render_state, draw.mode, ShaderId::SHRUB);
 
     prof.add_draw_call();
-    prof.add_tri(draw.num_triangles);
+    prof.add_tri(num_tris);
 
     tree.perf.draws++;
 
-    if (render_state->no_multidraw) {
-      glDrawElements(GL_TRIANGLE_STRIP, singledraw_indices.second, GL_UNSIGNED_INT,
-                     (void*)(singledraw_indices.first * sizeof(u32)));
-    } else {
-      glMultiDrawElements(GL_TRIANGLE_STRIP,
-                          &m_cache.multidraw_count_buffer[multidraw_indices.first], GL_UNSIGNED_INT,
-                          &m_cache.multidraw_index_offset_buffer[multidraw_indices.first],
-                          multidraw_indices.second);
-    }
+    draw_visible();
 
     switch (double_draw.kind) {
       case DoubleDrawKind::NONE:
@@ -381,15 +406,7 @@ void Shrub::render_tree(int idx,
         glUniform1f(glGetUniformLocation(render_state->shaders[ShaderId::SHRUB].id(), "alpha_max"),
                     double_draw.aref_second);
         glDepthMask(GL_FALSE);
-        if (render_state->no_multidraw) {
-          glDrawElements(GL_TRIANGLE_STRIP, singledraw_indices.second, GL_UNSIGNED_INT,
-                         (void*)(singledraw_indices.first * sizeof(u32)));
-        } else {
-          glMultiDrawElements(
-              GL_TRIANGLE_STRIP, &m_cache.multidraw_count_buffer[multidraw_indices.first],
-              GL_UNSIGNED_INT, &m_cache.multidraw_index_offset_buffer[multidraw_indices.first],
-              multidraw_indices.second);
-        }
+        draw_visible();
         break;
       default:
         ASSERT(false);
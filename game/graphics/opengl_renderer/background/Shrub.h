@@ -6,6 +6,7 @@
 
 #include "game/graphics/gfx.h"
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/background/TimeOfDayBlender.h"
 #include "game/graphics/opengl_renderer/background/background_common.h"
 #include "game/graphics/pipelines/opengl.h"
 
@@ -27,7 +28,7 @@ class Shrub : public BucketRenderer {
   void draw_debug_window() override;
 
  private:
-  void update_load(const LevelData* loader_data);
+  void update_load(const LevelData* loader_data, SharedRenderState* render_state);
   void discard_tree_cache();
 
   struct Tree {
@@ -40,10 +41,19 @@ class Shrub : public BucketRenderer {
     const std::vector<tfrag3::ShrubDraw>* draws = nullptr;
     const std::vector<tfrag3::TieWindInstance>* instance_info = nullptr;
     const tfrag3::PackedTimeOfDay* colors = nullptr;
+    std::unique_ptr<TimeOfDayBlender> tod_blender;
     const u32* index_data = nullptr;
     std::vector<bool> proto_vis_mask;
     std::unordered_map<std::string, std::vector<u32>> proto_name_to_idx;
 
+    // draws with the same texture and mode, which are drawn together. In order of first use.
+    struct DrawGroup {
+      u32 first = 0;  // in group_draws
+      u32 count = 0;
+    };
+    std::vector<DrawGroup> draw_groups;
+    std::vector<u32> group_draws;  // indices of draws, grouped
+
     struct {
       u32 draws = 0;
       u32 wind_draws = 0;
@@ -55,6 +65,7 @@ class Shrub : public BucketRenderer {
       Filtered<float> tree_time;
     } perf;
   };
+  static void build_draw_groups(Tree* tree, const std::vector<tfrag3::ShrubDraw>& draws);
 
   struct {
     GLuint decal;
@@ -65,7 +76,6 @@ class Shrub : public BucketRenderer {
   const std::vector<GLuint>* m_textures;
   u64 m_load_id = -1;
 
-  std::vector<math::Vector<u8, 4>> m_color_result;
 
   static constexpr int TIME_OF_DAY_COLOR_COUNT = 8192;
   bool m_has_level = false;
@@ -73,7 +83,6 @@ class Shrub : public BucketRenderer {
   struct Cache {
     std::vector<std::pair<int, int>> draw_idx_temp;
     std::vector<u32> index_temp;
-    std::vector<std::pair<int, int>> multidraw_offset_per_stripdraw;
     std::vector<GLsizei> multidraw_count_buffer;
     std::vector<void*> multidraw_index_offset_buffer;
   } m_cache;
@@ -57,10 +57,6 @@ TFragment::TFragment(const std::string& name,
                         (void*)offsetof(DebugVertex, rgba)  // offset (0)
   );
   glBindVertexArray(0);
-  // regardless of how many we use some fixed max
-  // we won't actually interp or upload to gpu the unused ones, but we need a fixed maximum so
-  // indexing works properly.
-  m_color_result.resize(TIME_OF_DAY_COLOR_COUNT);
 }
 
 TFragment::~TFragment() {
@@ -170,6 +166,7 @@ void TFragment::render(DmaFollower& dma,
 }
 
 void TFragment::draw_debug_window() {
+  ImGui::Checkbox("Texture arrays", &m_use_texture_arrays);
   for (int i = 0; i < (int)m_cached_trees.at(lod()).size(); i++) {
     auto& tree = m_cached_trees.at(lod()).at(i);
     if (tree.kind == tfrag3::TFragmentTreeKind::INVALID) {
@@ -186,7 +183,8 @@ void TFragment::draw_debug_window() {
     ImGui::PopID();
     if (tree.rendered_this_frame) {
       ImGui::Checkbox("freeze itimes", &tree.freeze_itimes);
-      ImGui::Text("  tris: %d draws: %d", tree.tris_this_frame, tree.draws_this_frame);
+      ImGui::Text("  tris: %d draws: %d tex binds: %d", tree.tris_this_frame,
+                  tree.draws_this_frame, tree.tex_binds_this_frame);
       for (int j = 0; j < 4; j++) {
         ImGui::Text(" itimes[%d] 0x%x 0x%x 0x%x 0x%x", j, tree.itimes_debug[j][0],
                     tree.itimes_debug[j][1], tree.itimes_debug[j][2], tree.itimes_debug[j][3]);
@@ -197,6 +195,9 @@ void TFragment::draw_debug_window() {
 
 void TFragment::init_shaders(ShaderLibrary& shaders) {
   m_uniforms.decal = glGetUniformLocation(shaders[ShaderId::TFRAG3].id(), "decal");
+  m_uniforms.tex_layer = glGetUniformLocation(shaders[ShaderId::TFRAG3].id(), "tex_layer");
+  m_uniforms.packed_vertices =
+      glGetUniformLocation(shaders[ShaderId::TFRAG3].id(), "packed_vertices");
 }
 
 void TFragment::handle_initialization(DmaFollower& dma) {
@@ -260,7 +261,8 @@ std::string TFragData::print() const {
 }
 
 void TFragment::update_load(const std::vector<tfrag3::TFragmentTreeKind>& tree_kinds,
-                            const LevelData* loader_data) {
+                            const LevelData* loader_data,
+                            SharedRenderState* render_state) {
   const auto* lev_data = loader_data->level.get();
   discard_tree_cache();
   for (int geom = 0; geom < GEOM_MAX; ++geom) {
@@ -297,6 +299,11 @@ void TFragment::update_load(const std::vector<tfrag3::TFragmentTreeKind>& tree_k
         tree_cache.draws = &tree.draws;  // todo - should we just copy this?
         tree_cache.colors = &tree.colors;
         tree_cache.vis = &tree.bvh;
+        build_cull_bvh(tree.bvh, &tree_cache.cull);
+        if (GpuVisCuller::supported(render_state)) {
+          tree_cache.gpu_culler = std::make_unique<GpuVisCuller>(
+              tree.draws, tree.bvh, 0, render_state->shaders[ShaderId::BACKGROUND_CULL]);
+        }
         tree_cache.index_data = tree.unpacked.indices.data();
         tree_cache.draw_mode = tree.use_strips ? GL_TRIANGLE_STRIP : GL_TRIANGLES;
         vis_temp_len = std::max(vis_temp_len, tree.bvh.vis_nodes.size());
@@ -307,28 +314,38 @@ void TFragment::update_load(const std::vector<tfrag3::TFragmentTreeKind>& tree_k
         glEnableVertexAttribArray(0);
         glEnableVertexAttribArray(1);
         glEnableVertexAttribArray(2);
+        glEnableVertexAttribArray(3);
+
+        // the vertices are still quantized, see TfragGpuVertex. tfrag3.vert converts to floats.
+        glVertexAttribPointer(0,                               // location 0 in the shader
+                              3,                               // 3 values per vert
+                              GL_UNSIGNED_SHORT,               // u16 offset in the cluster
+                              GL_FALSE,                        // normalized
+                              sizeof(tfrag3::TfragGpuVertex),  // stride
+                              (void*)offsetof(tfrag3::TfragGpuVertex, off)  // offset
+        );
 
-        glVertexAttribPointer(0,                                // location 0 in the shader
-                              3,                                // 3 values per vert
-                              GL_FLOAT,                         // floats
-                              GL_FALSE,                         // normalized
-                              sizeof(tfrag3::PreloadedVertex),  // stride
-                              (void*)offsetof(tfrag3::PreloadedVertex, x)  // offset (0)
+        glVertexAttribPointer(1,                               // location 1 in the shader
+                              2,                               // 2 values per vert
+                              GL_SHORT,                        // s16, 1024 = 1.0
+                              GL_FALSE,                        // normalized
+                              sizeof(tfrag3::TfragGpuVertex),  // stride
+                              (void*)offsetof(tfrag3::TfragGpuVertex, s)  // offset
         );
 
-        glVertexAttribPointer(1,                                // location 1 in the shader
-                              3,                                // 3 values per vert
-                              GL_FLOAT,                         // floats
-                              GL_FALSE,                         // normalized
-                              sizeof(tfrag3::PreloadedVertex),  // stride
-                              (void*)offsetof(tfrag3::PreloadedVertex, s)  // offset (0)
+        glVertexAttribIPointer(2,                               // location 2 in the shader
+                               1,                               // 1 values per vert
+                               GL_UNSIGNED_SHORT,               // u16
+                               sizeof(tfrag3::TfragGpuVertex),  // stride
+                               (void*)offsetof(tfrag3::TfragGpuVertex, color_index)  // offset
         );
 
-        glVertexAttribIPointer(2,                                // location 2 in the shader
-                               2,                                // 1 values per vert
-                               GL_UNSIGNED_SHORT,                // u16
-                               sizeof(tfrag3::PreloadedVertex),  // stride
-                               (void*)offsetof(tfrag3::PreloadedVertex, color_index)  // offset (0)
+        glVertexAttribPointer(3,                               // location 3 in the shader
+                              3,                               // 3 values per vert
+                              GL_UNSIGNED_SHORT,               // u16 cluster cell
+                              GL_FALSE,                        // normalized
+                              sizeof(tfrag3::TfragGpuVertex),  // stride
+                              (void*)offsetof(tfrag3::TfragGpuVertex, cluster)  // offset
         );
         glGenBuffers(1, &tree_cache.single_draw_index_buffer);
         glGenBuffers(1, &tree_cache.index_buffer);
@@ -338,10 +355,12 @@ void TFragment::update_load(const std::vector<tfrag3::TFragmentTreeKind>& tree_k
 
         glGenTextures(1, &tree_cache.time_of_day_texture);
         glBindTexture(GL_TEXTURE_1D, tree_cache.time_of_day_texture);
-        glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
+        glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
                      GL_UNSIGNED_INT_8_8_8_8, nullptr);
         glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        tree_cache.tod_blender = std::make_unique<TimeOfDayBlender>(
+            tree.colors, tree_cache.time_of_day_texture, render_state);
         glBindVertexArray(0);
       }
     }
@@ -367,6 +386,8 @@ bool TFragment::setup_for_level(const std::vector<tfrag3::TFragmentTreeKind>& tr
     // not loaded
     m_has_level = false;
     m_textures = nullptr;
+    m_texture_arrays = nullptr;
+    m_texture_array_slots = nullptr;
     m_level_name = "";
     discard_tree_cache();
     return false;
@@ -375,6 +396,8 @@ bool TFragment::setup_for_level(const std::vector<tfrag3::TFragmentTreeKind>& tr
   if (m_has_level && lev_data->load_id != m_load_id) {
     m_has_level = false;
     m_textures = nullptr;
+    m_texture_arrays = nullptr;
+    m_texture_array_slots = nullptr;
     m_level_name = "";
     discard_tree_cache();
     return setup_for_level(tree_kinds, level, render_state);
@@ -383,9 +406,11 @@ bool TFragment::setup_for_level(const std::vector<tfrag3::TFragmentTreeKind>& tr
   m_load_id = lev_data->load_id;
 
   if (m_level_name != level) {
-    update_load(tree_kinds, lev_data);
+    update_load(tree_kinds, lev_data, render_state);
     m_has_level = true;
     m_textures = &lev_data->textures;
+    m_texture_arrays = &lev_data->texture_arrays;
+    m_texture_array_slots = &lev_data->texture_array_slots;
     m_level_name = level;
   } else {
     m_has_level = true;
@@ -418,16 +443,19 @@ void TFragment::render_tree(int geom,
 
   ASSERT(tree.kind != tfrag3::TFragmentTreeKind::INVALID);
 
-  if (m_color_result.size() < tree.colors->color_count) {
-    m_color_result.resize(tree.colors->color_count);
+  tree.tod_blender->update(settings.camera.itimes, render_state);
+
+  // the debug view draws from the CPU vis results, so it keeps the CPU path.
+  const bool gpu_culled = tree.gpu_culler && render_state->gpu_background_culling &&
+                          !render_state->no_multidraw && !tree.cull_debug;
+  if (gpu_culled) {
+    // before the tfrag shader is set up, the dispatch binds the culling shader.
+    tree.gpu_culler->dispatch(render_state->shaders[ShaderId::BACKGROUND_CULL],
+                              settings.camera.planes, settings.occlusion_culling, nullptr);
   }
-  interp_time_of_day(settings.camera.itimes, *tree.colors, m_color_result.data());
-  glActiveTexture(GL_TEXTURE10);
-  glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
-  glTexSubImage1D(GL_TEXTURE_1D, 0, 0, tree.colors->color_count, GL_RGBA,
-                  GL_UNSIGNED_INT_8_8_8_8_REV, m_color_result.data());
 
   first_tfrag_draw_setup(settings.camera, render_state, ShaderId::TFRAG3);
+  glUniform1i(m_uniforms.packed_vertices, 1);
 
   glBindVertexArray(tree.vao);
   glBindBuffer(GL_ARRAY_BUFFER, tree.vertex_buffer);
@@ -437,24 +465,30 @@ void TFragment::render_tree(int geom,
   glEnable(GL_PRIMITIVE_RESTART);
   glPrimitiveRestartIndex(UINT32_MAX);
 
-  cull_check_all_slow(settings.camera.planes, tree.vis->vis_nodes, settings.occlusion_culling,
-                      m_cache.vis_temp.data());
+  // the triangle count stays on the GPU in the GPU culled path, so it doesn't add to the profiler.
+  u32 total_tris = 0;
+  if (!gpu_culled) {
+    cull_check_all(settings.camera.planes, tree.cull, settings.occlusion_culling,
+                   m_cache.vis_temp.data());
 
-  u32 total_tris;
-  if (render_state->no_multidraw) {
-    u32 idx_buffer_size = make_index_list_from_vis_string(
-        m_cache.draw_idx_temp.data(), m_cache.index_temp.data(), *tree.draws, m_cache.vis_temp,
-        tree.index_data, &total_tris);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size * sizeof(u32), m_cache.index_temp.data(),
-                 GL_STREAM_DRAW);
-  } else {
-    total_tris = make_multidraws_from_vis_string(
-        m_cache.multidraw_offset_per_stripdraw.data(), m_cache.multidraw_count_buffer.data(),
-        m_cache.multidraw_index_offset_buffer.data(), *tree.draws, m_cache.vis_temp);
+    if (render_state->no_multidraw) {
+      u32 idx_buffer_size = make_index_list_from_vis_string(
+          m_cache.draw_idx_temp.data(), m_cache.index_temp.data(), *tree.draws, m_cache.vis_temp,
+          tree.index_data, &total_tris);
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size * sizeof(u32),
+                   m_cache.index_temp.data(), GL_STREAM_DRAW);
+    } else {
+      total_tris = make_multidraws_from_vis_string(
+          m_cache.multidraw_offset_per_stripdraw.data(), m_cache.multidraw_count_buffer.data(),
+          m_cache.multidraw_index_offset_buffer.data(), *tree.draws, m_cache.vis_temp);
+    }
   }
 
   prof.add_tri(total_tris);
 
+  // tex_layer is always put back to 0 after the tree, since Tie3 shares this shader.
+  s32 bound_array = -1;
+  int current_layer = 0;
   for (size_t draw_idx = 0; draw_idx < tree.draws->size(); draw_idx++) {
     const auto& draw = tree.draws->operator[](draw_idx);
     const auto& multidraw_indices = m_cache.multidraw_offset_per_stripdraw[draw_idx];
@@ -464,6 +498,10 @@ void TFragment::render_tree(int geom,
       if (singledraw_indices.second == 0) {
         continue;
       }
+    } else if (gpu_culled) {
+      if (tree.gpu_culler->draw_is_empty(draw_idx)) {
+        continue;
+      }
     } else {
       if (multidraw_indices.second == 0) {
         continue;
@@ -472,12 +510,41 @@ void TFragment::render_tree(int geom,
 
     ASSERT(m_textures);
     s32 tex_idx = draw.tree_tex_id;
-    if (tex_idx >= 0) {
-      glBindTexture(GL_TEXTURE_2D, m_textures->at(draw.tree_tex_id));
+    const LevelData::TextureArraySlot* array_slot = nullptr;
+    if (m_use_texture_arrays && tex_idx >= 0 && tex_idx < (int)m_texture_array_slots->size() &&
+        m_texture_array_slots->at(tex_idx).array >= 0) {
+      array_slot = &m_texture_array_slots->at(tex_idx);
+    }
+
+    DoubleDraw double_draw;
+    if (array_slot) {
+      // textures of the same size share an array, so only the layer changes.
+      if (array_slot->array != bound_array) {
+        glActiveTexture(GL_TEXTURE0 + kTextureArrayUnit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, m_texture_arrays->at(array_slot->array));
+        bound_array = array_slot->array;
+        tree.tex_binds_this_frame++;
+      }
+      if (array_slot->layer + 1 != current_layer) {
+        current_layer = array_slot->layer + 1;
+        glUniform1i(m_uniforms.tex_layer, current_layer);
+      }
+      double_draw = setup_tfrag_shader(render_state, draw.mode, ShaderId::TFRAG3,
+                                       GL_TEXTURE0 + kTextureArrayUnit, GL_TEXTURE_2D_ARRAY);
     } else {
-      glBindTexture(GL_TEXTURE_2D, m_anim_slot_array->at(-(tex_idx + 1)));
+      glActiveTexture(GL_TEXTURE0);
+      if (tex_idx >= 0) {
+        glBindTexture(GL_TEXTURE_2D, m_textures->at(draw.tree_tex_id));
+      } else {
+        glBindTexture(GL_TEXTURE_2D, m_anim_slot_array->at(-(tex_idx + 1)));
+      }
+      tree.tex_binds_this_frame++;
+      if (current_layer != 0) {
+        current_layer = 0;
+        glUniform1i(m_uniforms.tex_layer, 0);
+      }
+      double_draw = setup_tfrag_shader(render_state, draw.mode, ShaderId::TFRAG3);
     }
-    auto double_draw = setup_tfrag_shader(render_state, draw.mode, ShaderId::TFRAG3);
     glUniform1i(m_uniforms.decal, draw.mode.get_decal() ? 1 : 0);
     tree.tris_this_frame += draw.num_triangles;
     tree.draws_this_frame++;
@@ -486,6 +553,8 @@ void TFragment::render_tree(int geom,
     if (render_state->no_multidraw) {
       glDrawElements(tree.draw_mode, singledraw_indices.second, GL_UNSIGNED_INT,
                      (void*)(singledraw_indices.first * sizeof(u32)));
+    } else if (gpu_culled) {
+      tree.gpu_culler->draw(tree.draw_mode, draw_idx);
     } else {
       glMultiDrawElements(tree.draw_mode, &m_cache.multidraw_count_buffer[multidraw_indices.first],
                           GL_UNSIGNED_INT,
@@ -506,6 +575,8 @@ void TFragment::render_tree(int geom,
         if (render_state->no_multidraw) {
           glDrawElements(tree.draw_mode, singledraw_indices.second, GL_UNSIGNED_INT,
                          (void*)(singledraw_indices.first * sizeof(u32)));
+        } else if (gpu_culled) {
+          tree.gpu_culler->draw(tree.draw_mode, draw_idx);
         } else {
           glMultiDrawElements(
               tree.draw_mode, &m_cache.multidraw_count_buffer[multidraw_indices.first],
@@ -517,6 +588,10 @@ void TFragment::render_tree(int geom,
         ASSERT(false);
     }
   }
+  if (current_layer != 0) {
+    glUniform1i(m_uniforms.tex_layer, 0);
+  }
+  glActiveTexture(GL_TEXTURE0);
   glBindVertexArray(0);
 }
 
@@ -563,9 +638,12 @@ void TFragment::render_matching_trees(int geom,
 
 void TFragment::discard_tree_cache() {
   m_textures = nullptr;
+  m_texture_arrays = nullptr;
+  m_texture_array_slots = nullptr;
   for (int geom = 0; geom < GEOM_MAX; ++geom) {
     for (auto& tree : m_cached_trees[geom]) {
       if (tree.kind != tfrag3::TFragmentTreeKind::INVALID) {
+        tree.tod_blender.reset();
         glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
         glDeleteTextures(1, &tree.time_of_day_texture);
         glDeleteBuffers(1, &tree.single_draw_index_buffer);
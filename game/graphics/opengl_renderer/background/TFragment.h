@@ -72,7 +72,8 @@ class TFragment : public BucketRenderer {
                               ScopedProfilerNode& prof);
 
   void update_load(const std::vector<tfrag3::TFragmentTreeKind>& tree_kinds,
-                   const LevelData* loader_data);
+                   const LevelData* loader_data,
+                   SharedRenderState* render_state);
 
   int lod() const { return Gfx::g_global_settings.lod_tfrag; }
   struct DebugVertex {
@@ -124,17 +125,22 @@ class TFragment : public BucketRenderer {
     const std::vector<tfrag3::StripDraw>* draws = nullptr;
     const tfrag3::PackedTimeOfDay* colors = nullptr;
     const tfrag3::BVH* vis = nullptr;
+    CullBvh cull;
     const u32* index_data = nullptr;
     u64 draw_mode = 0;
+    std::unique_ptr<GpuVisCuller> gpu_culler;
+    std::unique_ptr<TimeOfDayBlender> tod_blender;
 
     void reset_stats() {
       rendered_this_frame = false;
       tris_this_frame = 0;
       draws_this_frame = 0;
+      tex_binds_this_frame = 0;
     }
     bool rendered_this_frame = false;
     int tris_this_frame = 0;
     int draws_this_frame = 0;
+    int tex_binds_this_frame = 0;
     bool allowed = true;
     bool forced = false;
     bool cull_debug = false;
@@ -145,8 +151,13 @@ class TFragment : public BucketRenderer {
 
   struct {
     GLuint decal;
+    GLuint tex_layer;
+    GLuint packed_vertices;
   } m_uniforms;
 
+  static constexpr int kTextureArrayUnit = 12;  // tex_T12 in tfrag3.frag
+  bool m_use_texture_arrays = true;
+
   struct Cache {
     std::vector<u8> vis_temp;
     std::vector<std::pair<int, int>> draw_idx_temp;
@@ -159,9 +170,10 @@ class TFragment : public BucketRenderer {
   std::string m_level_name;
 
   const std::vector<GLuint>* m_textures = nullptr;
+  const std::vector<GLuint>* m_texture_arrays = nullptr;
+  const std::vector<LevelData::TextureArraySlot>* m_texture_array_slots = nullptr;
   std::array<std::vector<TreeCache>, GEOM_MAX> m_cached_trees;
 
-  std::vector<math::Vector<u8, 4>> m_color_result;
 
   GLuint m_debug_vao = -1;
   GLuint m_debug_verts = -1;
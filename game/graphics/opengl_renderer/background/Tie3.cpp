@@ -15,10 +15,6 @@ Tie3::Tie3(const std::string& name,
       m_level_id(level_id),
       m_default_category(category),
       m_anim_slot_array(anim_slot_array) {
-  // regardless of how many we use some fixed max
-  // we won't actually interp or upload to gpu the unused ones, but we need a fixed maximum so
-  // indexing works properly.
-  m_color_result.resize(TIME_OF_DAY_COLOR_COUNT);
 
   m_wind_data.paused = 0;
   math::Vector4f ones(1, 1, 1, 1);
@@ -57,7 +53,7 @@ void Tie3::init_shaders(ShaderLibrary& shaders) {
  * This often causes stutters, so as much as possible, we move stuff to the loader,
  * and this function just updates things to reference loader data.
  */
-void Tie3::load_from_fr3_data(const LevelData* loader_data) {
+void Tie3::load_from_fr3_data(const LevelData* loader_data, SharedRenderState* render_state) {
   auto ul = scoped_prof("update-load");
   const tfrag3::Level* lev_data = loader_data->level.get();
   m_wind_vectors.clear();
@@ -107,6 +103,7 @@ void Tie3::load_from_fr3_data(const LevelData* loader_data) {
       lod_tree[l_tree].colors = &tree.colors;
       // visibility BVH from FR3
       lod_tree[l_tree].vis = &tree.bvh;
+      build_cull_bvh(tree.bvh, &lod_tree[l_tree].cull);
       // indices from FR3 (needed on CPU for culling)
       lod_tree[l_tree].index_data = tree.unpacked.indices.data();
       // wind metadata
@@ -177,6 +174,10 @@ void Tie3::load_from_fr3_data(const LevelData* loader_data) {
           lod_tree[l_tree].wind_vertex_index_offsets.push_back(off);
           off += draw.vertex_index_stream.size();
         }
+        if (TieWindGpu::supported(render_state)) {
+          lod_tree[l_tree].gpu_wind = std::make_unique<TieWindGpu>(
+              tree.instanced_wind_draws, tree.wind_instance_info, tree.bvh, render_state);
+        }
       }
 
       // set up per-proto visibility. Jak 2 needs to enable/disable individual protos.
@@ -189,10 +190,12 @@ void Tie3::load_from_fr3_data(const LevelData* loader_data) {
       glActiveTexture(GL_TEXTURE10);
       glGenTextures(1, &lod_tree[l_tree].time_of_day_texture);
       glBindTexture(GL_TEXTURE_1D, lod_tree[l_tree].time_of_day_texture);
-      glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
+      glTexImage1D(GL_TEXTURE_1D, 0, GL_RGBA8, TIME_OF_DAY_COLOR_COUNT, 0, GL_RGBA,
                    GL_UNSIGNED_INT_8_8_8_8, nullptr);
       glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
       glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      lod_tree[l_tree].tod_blender = std::make_unique<TimeOfDayBlender>(
+          tree.colors, lod_tree[l_tree].time_of_day_texture, render_state);
 
       glBindVertexArray(0);
 
@@ -203,12 +206,25 @@ void Tie3::load_from_fr3_data(const LevelData* loader_data) {
       lod_tree[l_tree].multidraw_offset_per_stripdraw.resize(tree.static_draws.size());
       lod_tree[l_tree].multidraw_count_buffer.resize(num_grps);
       lod_tree[l_tree].multidraw_index_offset_buffer.resize(num_grps);
+
+      if (GpuVisCuller::supported(render_state)) {
+        lod_tree[l_tree].gpu_culler = std::make_unique<GpuVisCuller>(
+            tree.static_draws, tree.bvh, tree.proto_names.size(),
+            render_state->shaders[ShaderId::BACKGROUND_CULL]);
+      }
     }
   }
 
   // set up temporary caches. These are just temporary, so they don't need per-tree versions.
 
   m_wind_vectors.resize(4 * max_wind_idx + 4);  // 4x u32's per wind.
+  if (TieWindGpu::supported(render_state)) {
+    glGenBuffers(1, &m_wind_vector_buffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_wind_vector_buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, m_wind_vectors.size() * sizeof(float),
+                 m_wind_vectors.data(), GL_DYNAMIC_COPY);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+  }
 
   // ASSERT(time_of_day_count <= TIME_OF_DAY_COLOR_COUNT);
 }
@@ -245,7 +261,7 @@ bool Tie3::try_loading_level(const std::string& level, SharedRenderState* render
   // see if this is the first time we've gotten the level
   if (m_level_name != level) {
     // it is! do the one time load.
-    load_from_fr3_data(lev_data);
+    load_from_fr3_data(lev_data, render_state);
     m_has_level = true;
     m_level_name = level;
   } else {
@@ -262,6 +278,7 @@ bool Tie3::try_loading_level(const std::string& level, SharedRenderState* render
 void Tie3::discard_tree_cache() {
   for (int geo = 0; geo < 4; ++geo) {
     for (auto& tree : m_trees[geo]) {
+      tree.tod_blender.reset();
       glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
       glDeleteTextures(1, &tree.time_of_day_texture);
       // glDeleteBuffers(1, &tree.index_buffer);
@@ -271,6 +288,10 @@ void Tie3::discard_tree_cache() {
 
     m_trees[geo].clear();
   }
+  if (m_wind_vector_buffer) {
+    glDeleteBuffers(1, &m_wind_vector_buffer);
+    m_wind_vector_buffer = 0;
+  }
 }
 
 bool Tie3::set_up_common_data_from_dma(DmaFollower& dma, SharedRenderState* render_state) {
@@ -376,7 +397,7 @@ void Tie3::render(DmaFollower& dma, SharedRenderState* render_state, ScopedProfi
   }
 
   if (set_up_common_data_from_dma(dma, render_state)) {
-    setup_all_trees(lod(), m_common_data.settings, m_common_data.proto_vis_data,
+    setup_all_trees(lod(), m_common_data.settings, render_state, m_common_data.proto_vis_data,
                     m_common_data.proto_vis_data_size, !render_state->no_multidraw, prof);
 
     draw_matching_draws_for_all_trees(lod(), m_common_data.settings, render_state, prof,
@@ -405,18 +426,21 @@ void Tie3::draw_matching_draws_for_all_trees(int geom,
 
 void Tie3::setup_all_trees(int geom,
                            const TfragRenderSettings& settings,
+                           SharedRenderState* render_state,
                            const u8* proto_vis_data,
                            size_t proto_vis_data_size,
                            bool use_multidraw,
                            ScopedProfilerNode& prof) {
   for (u32 i = 0; i < m_trees[geom].size(); i++) {
-    setup_tree(i, geom, settings, proto_vis_data, proto_vis_data_size, use_multidraw, prof);
+    setup_tree(i, geom, settings, render_state, proto_vis_data, proto_vis_data_size, use_multidraw,
+               prof);
   }
 }
 
 void Tie3::setup_tree(int idx,
                       int geom,
                       const TfragRenderSettings& settings,
+                      SharedRenderState* render_state,
                       const u8* proto_vis_data,
                       size_t proto_vis_data_size,
                       bool use_multidraw,
@@ -429,30 +453,32 @@ void Tie3::setup_tree(int idx,
   }
 
   // update time of day
-  if (m_color_result.size() < tree.colors->color_count) {
-    m_color_result.resize(tree.colors->color_count);
-  }
-
-  interp_time_of_day(settings.camera.itimes, *tree.colors, m_color_result.data());
-
-  glActiveTexture(GL_TEXTURE10);
-  glBindTexture(GL_TEXTURE_1D, tree.time_of_day_texture);
-  glTexSubImage1D(GL_TEXTURE_1D, 0, 0, tree.colors->color_count, GL_RGBA,
-                  GL_UNSIGNED_INT_8_8_8_8_REV, m_color_result.data());
+  tree.tod_blender->update(settings.camera.itimes, render_state);
 
   // update proto vis mask
   if (proto_vis_data) {
     tree.proto_visibility.update(proto_vis_data, proto_vis_data_size);
   }
 
-  if (!m_debug_all_visible) {
+  tree.gpu_culled = tree.gpu_culler && render_state->gpu_background_culling && use_multidraw &&
+                    !m_debug_all_visible;
+
+  // wind instances are still culled on the CPU, unless the GPU does them too.
+  const bool cpu_wind = !tree.wind_draws->empty() && !tree.gpu_wind;
+  if (!m_debug_all_visible && (!tree.gpu_culled || cpu_wind)) {
     // need culling data
-    cull_check_all_slow(settings.camera.planes, tree.vis->vis_nodes, settings.occlusion_culling,
-                        tree.vis_temp.data());
+    cull_check_all(settings.camera.planes, tree.cull, settings.occlusion_culling,
+                   tree.vis_temp.data());
   }
 
   u32 num_tris = 0;
-  if (use_multidraw) {
+  if (tree.gpu_culled) {
+    // the triangle count stays on the GPU, so this path doesn't add to the profiler.
+    tree.gpu_culler->dispatch(
+        render_state->shaders[ShaderId::BACKGROUND_CULL], settings.camera.planes,
+        settings.occlusion_culling,
+        tree.has_proto_visibility ? &tree.proto_visibility.vis_flags : nullptr);
+  } else if (use_multidraw) {
     if (m_debug_all_visible) {
       num_tris = make_all_visible_multidraws(
           tree.multidraw_offset_per_stripdraw.data(), tree.multidraw_count_buffer.data(),
@@ -574,6 +600,10 @@ void Tie3::draw_matching_draws_for_tree(int idx,
       if (singledraw_indices.second == 0) {
         continue;
       }
+    } else if (tree.gpu_culled) {
+      if (tree.gpu_culler->draw_is_empty(draw_idx)) {
+        continue;
+      }
     } else {
       if (multidraw_indices.second == 0) {
         continue;
@@ -600,6 +630,8 @@ void Tie3::draw_matching_draws_for_tree(int idx,
     if (render_state->no_multidraw) {
       glDrawElements(tree.draw_mode, singledraw_indices.second, GL_UNSIGNED_INT,
                      (void*)(singledraw_indices.first * sizeof(u32)));
+    } else if (tree.gpu_culled) {
+      tree.gpu_culler->draw(tree.draw_mode, draw_idx);
     } else {
       glMultiDrawElements(
           tree.draw_mode, &tree.multidraw_count_buffer[multidraw_indices.first], GL_UNSIGNED_INT,
@@ -620,6 +652,8 @@ void Tie3::draw_matching_draws_for_tree(int idx,
         if (render_state->no_multidraw) {
           glDrawElements(tree.draw_mode, singledraw_indices.second, GL_UNSIGNED_INT,
                          (void*)(singledraw_indices.first * sizeof(u32)));
+        } else if (tree.gpu_culled) {
+          tree.gpu_culler->draw(tree.draw_mode, draw_idx);
         } else {
           glMultiDrawElements(tree.draw_mode, &tree.multidraw_count_buffer[multidraw_indices.first],
                               GL_UNSIGNED_INT,
@@ -670,6 +704,10 @@ void Tie3::envmap_second_pass_draw(const Tree& tree,
       if (singledraw_indices.second == 0) {
         continue;
       }
+    } else if (tree.gpu_culled) {
+      if (tree.gpu_culler->draw_is_empty(draw_idx)) {
+        continue;
+      }
     } else {
       if (multidraw_indices.second == 0) {
         continue;
@@ -693,6 +731,8 @@ void Tie3::envmap_second_pass_draw(const Tree& tree,
     if (render_state->no_multidraw) {
       glDrawElements(tree.draw_mode, singledraw_indices.second, GL_UNSIGNED_INT,
                      (void*)(singledraw_indices.first * sizeof(u32)));
+    } else if (tree.gpu_culled) {
+      tree.gpu_culler->draw(tree.draw_mode, draw_idx);
     } else {
       glMultiDrawElements(
           tree.draw_mode, &tree.multidraw_count_buffer[multidraw_indices.first], GL_UNSIGNED_INT,
@@ -891,48 +931,62 @@ void Tie3::render_tree_wind(int idx,
     return;
   }
 
-  // note: this isn't the most efficient because we might compute wind matrices for invisible
-  // instances. TODO: add vis ids to the instance info to avoid this
-  memset(tree.wind_matrix_cache.data(), 0, sizeof(float) * 16 * tree.wind_matrix_cache.size());
   auto& cam_bad = settings.camera.camera;
   std::array<math::Vector4f, 4> cam;
   for (int i = 0; i < 4; i++) {
     cam[i] = cam_bad[i];
   }
 
-  for (size_t inst_id = 0; inst_id < tree.instance_info->size(); inst_id++) {
-    auto& info = tree.instance_info->operator[](inst_id);
-    auto& out = tree.wind_matrix_cache[inst_id];
-    // auto& mat = tree.instance_info->operator[](inst_id).matrix;
-    auto mat = info.matrix;
-
-    ASSERT(info.wind_idx * 4 <= m_wind_vectors.size());
-    do_wind_math(info.wind_idx, m_wind_vectors.data(), m_wind_data,
-                 info.stiffness * m_wind_multiplier, mat);
-
-    // vmulax.xyzw acc, vf20, vf10
-    // vmadday.xyzw acc, vf21, vf10
-    // vmaddz.xyzw vf10, vf22, vf10
-    out[0] = cam[0] * mat[0].x() + cam[1] * mat[0].y() + cam[2] * mat[0].z();
-
-    // vmulax.xyzw acc, vf20, vf11
-    // vmadday.xyzw acc, vf21, vf11
-    // vmaddz.xyzw vf11, vf22, vf11
-    out[1] = cam[0] * mat[1].x() + cam[1] * mat[1].y() + cam[2] * mat[1].z();
-
-    // vmulax.xyzw acc, vf20, vf12
-    // vmadday.xyzw acc, vf21, vf12
-    // vmaddz.xyzw vf12, vf22, vf12
-    out[2] = cam[0] * mat[2].x() + cam[1] * mat[2].y() + cam[2] * mat[2].z();
-
-    // vmulax.xyzw acc, vf20, vf13
-    // vmadday.xyzw acc, vf21, vf13
-    // vmaddaz.xyzw acc, vf22, vf13
-    // vmaddw.xyzw vf13, vf23, vf0
-    out[3] = cam[0] * mat[3].x() + cam[1] * mat[3].y() + cam[2] * mat[3].z() + cam[3];
+  // the GPU path needs the culling on the GPU too, see render_tree.
+  const bool gpu_wind = tree.gpu_culled && tree.gpu_wind;
+  if (gpu_wind) {
+    TieWindGpu::WindParams wind;
+    wind.wind_array = m_wind_data.wind_array;
+    wind.wind_time = m_wind_data.wind_time;
+    wind.paused = m_wind_data.paused;
+    wind.stiffness_multiplier = m_wind_multiplier;
+    wind.wind_vectors = m_wind_vector_buffer;
+    tree.gpu_wind->dispatch(wind, cam.data(), settings.camera.planes, settings.occlusion_culling,
+                            render_state);
+  } else {
+    // note: this isn't the most efficient because we might compute wind matrices for invisible
+    // instances. TODO: add vis ids to the instance info to avoid this
+    memset(tree.wind_matrix_cache.data(), 0, sizeof(float) * 16 * tree.wind_matrix_cache.size());
+
+    for (size_t inst_id = 0; inst_id < tree.instance_info->size(); inst_id++) {
+      auto& info = tree.instance_info->operator[](inst_id);
+      auto& out = tree.wind_matrix_cache[inst_id];
+      // auto& mat = tree.instance_info->operator[](inst_id).matrix;
+      auto mat = info.matrix;
+
+      ASSERT(info.wind_idx * 4 <= m_wind_vectors.size());
+      do_wind_math(info.wind_idx, m_wind_vectors.data(), m_wind_data,
+                   info.stiffness * m_wind_multiplier, mat);
+
+      // vmulax.xyzw acc, vf20, vf10
+      // vmadday.xyzw acc, vf21, vf10
+      // vmaddz.xyzw vf10, vf22, vf10
+      out[0] = cam[0] * mat[0].x() + cam[1] * mat[0].y() + cam[2] * mat[0].z();
+
+      // vmulax.xyzw acc, vf20, vf11
+      // vmadday.xyzw acc, vf21, vf11
+      // vmaddz.xyzw vf11, vf22, vf11
+      out[1] = cam[0] * mat[1].x() + cam[1] * mat[1].y() + cam[2] * mat[1].z();
+
+      // vmulax.xyzw acc, vf20, vf12
+      // vmadday.xyzw acc, vf21, vf12
+      // vmaddz.xyzw vf12, vf22, vf12
+      out[2] = cam[0] * mat[2].x() + cam[1] * mat[2].y() + cam[2] * mat[2].z();
+
+      // vmulax.xyzw acc, vf20, vf13
+      // vmadday.xyzw acc, vf21, vf13
+      // vmaddaz.xyzw acc, vf22, vf13
+      // vmaddw.xyzw vf13, vf23, vf0
+      out[3] = cam[0] * mat[3].x() + cam[1] * mat[3].y() + cam[2] * mat[3].z() + cam[3];
+    }
   }
 
-  auto shader_id = ShaderId::TIE_WIND;
+  auto shader_id = gpu_wind ? ShaderId::TIE_WIND_INSTANCED : ShaderId::TIE_WIND;
   first_tfrag_draw_setup(settings.camera, render_state, shader_id);
   glBindVertexArray(tree.vao);
   glBindBuffer(GL_ARRAY_BUFFER, tree.vertex_buffer);
@@ -962,6 +1016,19 @@ void Tie3::render_tree_wind(int idx,
     }
     auto double_draw = setup_tfrag_shader(render_state, draw.mode, shader_id);
 
+    if (gpu_wind) {
+      tree.gpu_wind->draw(tree.draw_mode, draw_idx);
+      if (double_draw.kind == DoubleDrawKind::AFAIL_NO_DEPTH_WRITE) {
+        glUniform1f(glGetUniformLocation(render_state->shaders[shader_id].id(), "alpha_min"),
+                    -10.f);
+        glUniform1f(glGetUniformLocation(render_state->shaders[shader_id].id(), "alpha_max"),
+                    double_draw.aref_second);
+        glDepthMask(GL_FALSE);
+        tree.gpu_wind->draw(tree.draw_mode, draw_idx);
+      }
+      continue;
+    }
+
     int off = 0;
     for (auto& grp : draw.instance_groups) {
       if (!m_debug_all_visible && !tree.vis_temp.at(grp.vis_idx)) {
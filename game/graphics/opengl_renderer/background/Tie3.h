@@ -6,6 +6,9 @@
 
 #include "game/graphics/gfx.h"
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/background/GpuVisCuller.h"
+#include "game/graphics/opengl_renderer/background/TieWindGpu.h"
+#include "game/graphics/opengl_renderer/background/TimeOfDayBlender.h"
 #include "game/graphics/opengl_renderer/background/background_common.h"
 #include "game/graphics/pipelines/opengl.h"
 
@@ -41,6 +44,7 @@ class Tie3 : public BucketRenderer {
 
   void setup_all_trees(int geom,
                        const TfragRenderSettings& settings,
+                       SharedRenderState* render_state,
                        const u8* proto_vis_data,
                        size_t proto_vis_data_size,
                        bool use_multidraw,
@@ -49,6 +53,7 @@ class Tie3 : public BucketRenderer {
   void setup_tree(int idx,
                   int geom,
                   const TfragRenderSettings& settings,
+                  SharedRenderState* render_state,
                   const u8* proto_vis_data,
                   size_t proto_vis_data_size,
                   bool use_multidraw,
@@ -87,7 +92,7 @@ class Tie3 : public BucketRenderer {
   int lod() const { return Gfx::g_global_settings.lod_tie; }
 
  private:
-  void load_from_fr3_data(const LevelData* loader_data);
+  void load_from_fr3_data(const LevelData* loader_data, SharedRenderState* render_state);
   void discard_tree_cache();
   void render_tree_wind(int idx,
                         int geom,
@@ -118,6 +123,7 @@ class Tie3 : public BucketRenderer {
     const std::vector<tfrag3::TieWindInstance>* instance_info = nullptr;
     const tfrag3::PackedTimeOfDay* colors = nullptr;
     const tfrag3::BVH* vis = nullptr;
+    CullBvh cull;
     const u32* index_data = nullptr;
     std::vector<std::array<math::Vector4f, 4>> wind_matrix_cache;
     GLuint wind_vertex_index_buffer;
@@ -132,6 +138,14 @@ class Tie3 : public BucketRenderer {
     std::vector<GLsizei> multidraw_count_buffer;
     std::vector<void*> multidraw_index_offset_buffer;
     u64 draw_mode = 0;  // strip or not, GL enum
+
+    // optional GPU culling. When gpu_culled is set, the multidraw arrays above are stale and the
+    // draws come from the culler's indirect commands.
+    std::unique_ptr<GpuVisCuller> gpu_culler;
+    std::unique_ptr<TimeOfDayBlender> tod_blender;
+    bool gpu_culled = false;
+    // optional GPU wind. Only used when gpu_culled is set, so the tree skips the CPU culling.
+    std::unique_ptr<TieWindGpu> gpu_wind;
   };
 
   void envmap_second_pass_draw(const Tree& tree,
@@ -145,7 +159,6 @@ class Tie3 : public BucketRenderer {
   const std::vector<GLuint>* m_textures;
   u64 m_load_id = -1;
 
-  std::vector<math::Vector<u8, 4>> m_color_result;
 
   static constexpr int TIME_OF_DAY_COLOR_COUNT = 8192;
 
@@ -158,6 +171,7 @@ class Tie3 : public BucketRenderer {
   TfragPcPortData m_pc_port_data;
 
   std::vector<float> m_wind_vectors;  // note: I suspect these are shared with shrub.
+  GLuint m_wind_vector_buffer = 0;    // the same, for TieWindGpu
 
   float m_wind_multiplier = 1.f;
 
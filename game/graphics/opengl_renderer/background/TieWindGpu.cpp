@@ -0,0 +1,88 @@
+#include "TieWindGpu.h"
+
+#include <algorithm>
+
+TieWindGpu::TieWindGpu(const std::vector<tfrag3::InstancedStripDraw>& draws,
+                       const std::vector<tfrag3::TieWindInstance>& instances,
+                       const tfrag3::BVH& bvh,
+                       SharedRenderState* render_state) {
+  m_num_instances = instances.size();
+  std::vector<Instance> instance_data(std::max((size_t)1, instances.size()));
+  for (size_t i = 0; i < instances.size(); i++) {
+    for (int j = 0; j < 4; j++) {
+      instance_data[i].matrix[j] = instances[i].matrix[j];
+    }
+    instance_data[i].wind_idx = instances[i].wind_idx;
+    instance_data[i].stiffness = instances[i].stiffness;
+  }
+
+  glGenBuffers(1, &m_instance_buffer);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_instance_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, instance_data.size() * sizeof(Instance),
+               instance_data.data(), GL_STATIC_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  // written by the compute shader, read as a vertex attribute with a divisor of 1.
+  constexpr int kMatrixSize = sizeof(math::Vector4f) * 4;
+  glGenBuffers(1, &m_matrix_buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, m_matrix_buffer);
+  glBufferData(GL_ARRAY_BUFFER, instance_data.size() * kMatrixSize, nullptr, GL_DYNAMIC_COPY);
+  for (int i = 0; i < 4; i++) {
+    glEnableVertexAttribArray(kFirstMatrixAttribute + i);
+    glVertexAttribPointer(kFirstMatrixAttribute + i, 4, GL_FLOAT, GL_FALSE, kMatrixSize,
+                          (void*)(i * sizeof(math::Vector4f)));
+    glVertexAttribDivisor(kFirstMatrixAttribute + i, 1);
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  m_culler = std::make_unique<GpuVisCuller>(draws, bvh,
+                                            render_state->shaders[ShaderId::BACKGROUND_CULL]);
+
+  auto id = render_state->shaders[ShaderId::TIE_WIND_MATRICES].id();
+  m_uniforms.wind_array = glGetUniformLocation(id, "wind_array");
+  m_uniforms.wind_time = glGetUniformLocation(id, "wind_time");
+  m_uniforms.paused = glGetUniformLocation(id, "paused");
+  m_uniforms.stiffness_multiplier = glGetUniformLocation(id, "stiffness_multiplier");
+  m_uniforms.camera = glGetUniformLocation(id, "camera");
+  m_uniforms.num_instances = glGetUniformLocation(id, "num_instances");
+}
+
+TieWindGpu::~TieWindGpu() {
+  glDeleteBuffers(1, &m_instance_buffer);
+  glDeleteBuffers(1, &m_matrix_buffer);
+}
+
+bool TieWindGpu::supported(SharedRenderState* render_state) {
+  return GpuVisCuller::supported(render_state) &&
+         render_state->shaders[ShaderId::TIE_WIND_MATRICES].okay();
+}
+
+void TieWindGpu::dispatch(const WindParams& wind,
+                          const math::Vector4f* camera,
+                          const math::Vector4f* planes,
+                          const u8* occlusion_string,
+                          SharedRenderState* render_state) {
+  if (m_num_instances) {
+    render_state->shaders[ShaderId::TIE_WIND_MATRICES].activate();
+    glUniform4fv(m_uniforms.wind_array, 64, wind.wind_array[0].data());
+    glUniform1ui(m_uniforms.wind_time, wind.wind_time);
+    glUniform1i(m_uniforms.paused, wind.paused);
+    glUniform1f(m_uniforms.stiffness_multiplier, wind.stiffness_multiplier);
+    glUniform4fv(m_uniforms.camera, 4, camera[0].data());
+    glUniform1ui(m_uniforms.num_instances, m_num_instances);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_instance_buffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, wind.wind_vectors);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_matrix_buffer);
+    glDispatchCompute((m_num_instances + kWorkgroupSize - 1) / kWorkgroupSize, 1, 1);
+    // the next tree reads the wind vectors, and the draws read the matrices.
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+    for (int i = 0; i < 3; i++) {
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER, i, 0);
+    }
+  }
+
+  // wind groups don't have per-proto visibility.
+  m_culler->dispatch(render_state->shaders[ShaderId::BACKGROUND_CULL], planes, occlusion_string,
+                     nullptr);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common/custom_data/Tfrag3Data.h"
+#include "common/math/Vector.h"
+
+#include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/background/GpuVisCuller.h"
+
+/*!
+ * Animates and draws the wind instances of a tie tree on the GPU. The TIE_WIND_MATRICES compute
+ * shader steps the wind and writes each instance's camera matrix, and a GpuVisCuller writes one
+ * indirect command per instance group. The TIE_WIND_INSTANCED shader reads the matrix as an
+ * instanced vertex attribute, picked by the command's base instance. The instances are uploaded
+ * once, so the CPU cost per frame doesn't depend on the number of instances.
+ */
+class TieWindGpu {
+ public:
+  /*!
+   * Adds the matrix attributes to the tree's vertex array, which must be bound.
+   */
+  TieWindGpu(const std::vector<tfrag3::InstancedStripDraw>& draws,
+             const std::vector<tfrag3::TieWindInstance>& instances,
+             const tfrag3::BVH& bvh,
+             SharedRenderState* render_state);
+  ~TieWindGpu();
+  TieWindGpu(const TieWindGpu&) = delete;
+  TieWindGpu& operator=(const TieWindGpu&) = delete;
+
+  static bool supported(SharedRenderState* render_state);
+
+  struct WindParams {
+    const math::Vector4f* wind_array = nullptr;  // 64 of them
+    u32 wind_time = 0;
+    bool paused = false;
+    float stiffness_multiplier = 1.f;
+    GLuint wind_vectors = 0;  // storage buffer of 4 floats per wind_idx, shared by all trees
+  };
+
+  /*!
+   * Step the wind, compute the matrices and cull the groups.
+   */
+  void dispatch(const WindParams& wind,
+                const math::Vector4f* camera,
+                const math::Vector4f* planes,
+                const u8* occlusion_string,
+                SharedRenderState* render_state);
+
+  /*!
+   * Draw one InstancedStripDraw with the last dispatch. The tree's vertex array, wind index buffer
+   * and TIE_WIND_INSTANCED must be bound.
+   */
+  void draw(u64 draw_mode, size_t draw_idx) const { m_culler->draw(draw_mode, draw_idx); }
+
+ private:
+  struct Instance {
+    math::Vector4f matrix[4];
+    u32 wind_idx;
+    float stiffness;
+    u32 pad[2];
+  };
+  static_assert(sizeof(Instance) == 80);
+  static constexpr int kWorkgroupSize = 64;
+  static constexpr int kFirstMatrixAttribute = 5;
+
+  u32 m_num_instances = 0;
+  GLuint m_instance_buffer = 0;
+  GLuint m_matrix_buffer = 0;
+  std::unique_ptr<GpuVisCuller> m_culler;
+
+  struct {
+    GLint wind_array, wind_time, paused, stiffness_multiplier, camera, num_instances;
+  } m_uniforms;
+};
@@ -0,0 +1,70 @@
+#include "TimeOfDayBlender.h"
+
+#include <algorithm>
+
+#include "game/graphics/opengl_renderer/background/background_common.h"
+
+TimeOfDayBlender::TimeOfDayBlender(const tfrag3::PackedTimeOfDay& colors,
+                                   GLuint texture,
+                                   SharedRenderState* render_state)
+    : m_colors(colors), m_texture(texture) {
+  const auto& shader = render_state->shaders[ShaderId::TIME_OF_DAY_BLEND];
+  if (!shader.okay() || colors.data.empty()) {
+    // the CPU blend writes whole groups of 4 colors.
+    m_color_result.resize((colors.color_count + 3) & ~3);
+    return;
+  }
+
+  glGenBuffers(1, &m_palette_buffer);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_palette_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, colors.data.size(), colors.data.data(), GL_STATIC_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+  m_uniforms.weights = glGetUniformLocation(shader.id(), "weights");
+  m_uniforms.color_count = glGetUniformLocation(shader.id(), "color_count");
+}
+
+TimeOfDayBlender::~TimeOfDayBlender() {
+  if (m_palette_buffer) {
+    glDeleteBuffers(1, &m_palette_buffer);
+  }
+}
+
+void TimeOfDayBlender::update(const math::Vector<s32, 4> itimes[4],
+                              SharedRenderState* render_state) {
+  glActiveTexture(GL_TEXTURE10);
+  glBindTexture(GL_TEXTURE_1D, m_texture);
+
+  if (m_valid && std::equal(itimes, itimes + 4, m_last_itimes)) {
+    return;
+  }
+  m_valid = true;
+  std::copy(itimes, itimes + 4, m_last_itimes);
+
+  if (!uses_gpu()) {
+    interp_time_of_day(itimes, m_colors, m_color_result.data());
+    glTexSubImage1D(GL_TEXTURE_1D, 0, 0, m_colors.color_count, GL_RGBA,
+                    GL_UNSIGNED_INT_8_8_8_8_REV, m_color_result.data());
+    return;
+  }
+
+  math::Vector<u16, 4> weights[8];
+  time_of_day_weights(itimes, weights);
+  u32 weights_u32[8 * 4];
+  for (int i = 0; i < 8; i++) {
+    for (int j = 0; j < 4; j++) {
+      weights_u32[i * 4 + j] = weights[i][j];
+    }
+  }
+
+  render_state->shaders[ShaderId::TIME_OF_DAY_BLEND].activate();
+  glUniform4uiv(m_uniforms.weights, 8, weights_u32);
+  glUniform1ui(m_uniforms.color_count, m_colors.color_count);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_palette_buffer);
+  glBindImageTexture(0, m_texture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+  glDispatchCompute((m_colors.color_count + kWorkgroupSize - 1) / kWorkgroupSize, 1, 1);
+  // the renderer samples the texture right after this.
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+  glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+}
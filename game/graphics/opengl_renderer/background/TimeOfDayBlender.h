@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "common/custom_data/Tfrag3Data.h"
+#include "common/math/Vector.h"
+
+#include "game/graphics/opengl_renderer/BucketRenderer.h"
+
+/*!
+ * Fills the time of day color texture of a background tree, blending its 8 palettes with the
+ * TIME_OF_DAY_BLEND compute shader. The palettes are uploaded once when the tree is loaded, so each
+ * frame only sends the 8 weights. Without compute shaders, it uses interp_time_of_day and uploads
+ * the result. Either way, nothing is done when the itimes are the same as last time.
+ *
+ * The texture must be GL_RGBA8 and have at least colors.color_count texels.
+ */
+class TimeOfDayBlender {
+ public:
+  TimeOfDayBlender(const tfrag3::PackedTimeOfDay& colors,
+                   GLuint texture,
+                   SharedRenderState* render_state);
+  ~TimeOfDayBlender();
+  TimeOfDayBlender(const TimeOfDayBlender&) = delete;
+  TimeOfDayBlender& operator=(const TimeOfDayBlender&) = delete;
+
+  /*!
+   * Update the texture for these itimes. Leaves the texture bound to GL_TEXTURE10.
+   */
+  void update(const math::Vector<s32, 4> itimes[4], SharedRenderState* render_state);
+
+  bool uses_gpu() const { return m_palette_buffer != 0; }
+
+ private:
+  static constexpr int kWorkgroupSize = 64;
+
+  const tfrag3::PackedTimeOfDay& m_colors;
+  GLuint m_texture = 0;
+  GLuint m_palette_buffer = 0;
+  std::vector<math::Vector<u8, 4>> m_color_result;  // CPU path only
+
+  bool m_valid = false;
+  math::Vector<s32, 4> m_last_itimes[4];
+
+  struct {
+    GLint weights, color_count;
+  } m_uniforms;
+};
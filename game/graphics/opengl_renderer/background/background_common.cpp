@@ -2,6 +2,11 @@
 
 #include "background_common.h"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
 #ifdef __aarch64__
 #include "third-party/sse2neon/sse2neon.h"
 #else
@@ -13,7 +18,10 @@
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
 #include "game/graphics/pipelines/opengl.h"
 
-DoubleDraw setup_opengl_from_draw_mode(DrawMode mode, u32 tex_unit, bool mipmap) {
+DoubleDraw setup_opengl_from_draw_mode(DrawMode mode,
+                                       u32 tex_unit,
+                                       bool mipmap,
+                                       GLenum tex_target) {
   glActiveTexture(tex_unit);
 
   if (mode.get_zt_enable()) {
@@ -91,24 +99,24 @@ DoubleDraw setup_opengl_from_draw_mode(DrawMode mode, u32 tex_unit, bool mipmap)
   }
 
   if (mode.get_clamp_s_enable()) {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(tex_target, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
   } else {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(tex_target, GL_TEXTURE_WRAP_S, GL_REPEAT);
   }
 
   if (mode.get_clamp_t_enable()) {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(tex_target, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
   } else {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(tex_target, GL_TEXTURE_WRAP_T, GL_REPEAT);
   }
 
   if (mode.get_filt_enable()) {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+    glTexParameteri(tex_target, GL_TEXTURE_MIN_FILTER,
                     mipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(tex_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
   } else {
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(tex_target, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(tex_target, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
   }
 
   // for some reason, they set atest NEVER + FB_ONLY to disable depth writes
@@ -159,8 +167,12 @@ DoubleDraw setup_opengl_from_draw_mode(DrawMode mode, u32 tex_unit, bool mipmap)
   return double_draw;
 }
 
-DoubleDraw setup_tfrag_shader(SharedRenderState* render_state, DrawMode mode, ShaderId shader) {
-  auto draw_settings = setup_opengl_from_draw_mode(mode, GL_TEXTURE0, true);
+DoubleDraw setup_tfrag_shader(SharedRenderState* render_state,
+                              DrawMode mode,
+                              ShaderId shader,
+                              u32 tex_unit,
+                              GLenum tex_target) {
+  auto draw_settings = setup_opengl_from_draw_mode(mode, tex_unit, true, tex_target);
   auto sh_id = render_state->shaders[shader].id();
   if (auto u_id = glGetUniformLocation(sh_id, "alpha_min"); u_id != -1) {
     glUniform1f(u_id, draw_settings.aref_first);
@@ -241,6 +253,8 @@ void first_tfrag_draw_setup(const GoalBackgroundCameraData& settings,
   auto id = sh.id();
   glUniform1i(glGetUniformLocation(id, "gfx_hack_no_tex"), Gfx::g_global_settings.hack_no_tex);
   glUniform1i(glGetUniformLocation(id, "decal"), false);
+  // tfrag3 is shared with tie, which has float vertices. TFragment turns this on for itself.
+  glUniform1i(glGetUniformLocation(id, "packed_vertices"), false);
   glUniform1i(glGetUniformLocation(id, "tex_T0"), 0);
   glUniformMatrix4fv(glGetUniformLocation(id, "camera"), 1, GL_FALSE, settings.camera[0].data());
 
@@ -281,10 +295,7 @@ void first_tfrag_draw_setup(const GoalBackgroundCameraData& settings,
               render_state->fog_intensity / 255);
 }
 
-void interp_time_of_day_slow(const math::Vector<s32, 4> itimes[4],
-                             const tfrag3::PackedTimeOfDay& in,
-                             math::Vector<u8, 4>* out) {
-  math::Vector<u16, 4> weights[8];
+void time_of_day_weights(const math::Vector<s32, 4> itimes[4], math::Vector<u16, 4>* weights) {
   for (int component = 0; component < 8; component++) {
     int quad_idx = component / 2;
     int word_off = (component % 2 * 2);
@@ -298,6 +309,13 @@ void interp_time_of_day_slow(const math::Vector<s32, 4> itimes[4],
       weights[component][channel] = hw_val;
     }
   }
+}
+
+void interp_time_of_day_slow(const math::Vector<s32, 4> itimes[4],
+                             const tfrag3::PackedTimeOfDay& in,
+                             math::Vector<u8, 4>* out) {
+  math::Vector<u16, 4> weights[8];
+  time_of_day_weights(itimes, weights);
 
   math::Vector<u16, 4> temp[4];
 
@@ -333,19 +351,7 @@ void interp_time_of_day(const math::Vector<s32, 4> itimes[4],
   interp_time_of_day_slow(itimes, packed_colors, out);
 #else
   math::Vector<u16, 4> weights[8];
-  for (int component = 0; component < 8; component++) {
-    int quad_idx = component / 2;
-    int word_off = (component % 2 * 2);
-    for (int channel = 0; channel < 4; channel++) {
-      int word = word_off + (channel / 2);
-      int hw_off = channel % 2;
-
-      u32 word_val = itimes[quad_idx][word];
-      u32 hw_val = hw_off ? (word_val >> 16) : word_val;
-      hw_val = hw_val & 0xff;
-      weights[component][channel] = hw_val;
-    }
-  }
+  time_of_day_weights(itimes, weights);
 
   // weight multipliers
   __m128i weights0 = _mm_setr_epi16(weights[0][0], weights[0][1], weights[0][2], weights[0][3],
@@ -513,21 +519,185 @@ void cull_check_all_slow(const math::Vector4f* planes,
   }
 }
 
-void make_all_visible_multidraws(std::pair<int, int>* draw_ptrs_out,
-                                 GLsizei* counts_out,
-                                 void** index_offsets_out,
-                                 const std::vector<tfrag3::ShrubDraw>& draws) {
-  u64 md_idx = 0;
-  for (size_t i = 0; i < draws.size(); i++) {
-    const auto& draw = draws[i];
-    u64 iidx = draw.first_index_index;
-    std::pair<int, int> ds;
-    ds.first = md_idx;
-    ds.second = 1;
-    counts_out[md_idx] = draw.num_indices;
-    index_offsets_out[md_idx] = (void*)(iidx * sizeof(u32));
-    md_idx++;
-    draw_ptrs_out[i] = ds;
+namespace {
+int add_cull_group(CullBvh* out, const std::vector<tfrag3::VisNode>& nodes, u32 first, u32 count) {
+  ASSERT(count > 0 && count <= (u32)CullBvh::kGroupSize);
+  auto& group = out->groups.emplace_back();
+  group.first_node = first;
+  group.count = count;
+  for (int i = 0; i < CullBvh::kGroupSize; i++) {
+    group.child_group[i] = -1;
+    if (i < (int)count) {
+      const auto& node = nodes[first + i];
+      group.x[i] = node.bsphere.x();
+      group.y[i] = node.bsphere.y();
+      group.z[i] = node.bsphere.z();
+      group.r[i] = node.bsphere.w();
+      group.my_id[i] = node.my_id;
+    } else {
+      group.x[i] = group.y[i] = group.z[i] = 0;
+      group.r[i] = -std::numeric_limits<float>::infinity();
+      group.my_id[i] = 0xffff;
+    }
+  }
+  return out->groups.size() - 1;
+}
+
+void build_flat_cull_bvh(const std::vector<tfrag3::VisNode>& nodes, CullBvh* out) {
+  out->groups.clear();
+  for (u32 i = 0; i < nodes.size(); i += CullBvh::kGroupSize) {
+    add_cull_group(out, nodes, i, std::min((u32)CullBvh::kGroupSize, (u32)nodes.size() - i));
+  }
+  out->num_root_groups = out->groups.size();
+}
+
+/*!
+ * Bitmask of the spheres in the group that are in front of all four planes.
+ */
+u32 cull_test_group(const math::Vector4f* planes, const CullBvh::Group& group) {
+#ifdef __AVX__
+  __m256 x = _mm256_load_ps(group.x);
+  __m256 y = _mm256_load_ps(group.y);
+  __m256 z = _mm256_load_ps(group.z);
+  __m256 neg_r = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_load_ps(group.r));
+  u32 mask = 0xff;
+  for (int p = 0; p < 4 && mask; p++) {
+    // same order of operations as sphere_in_view_ref, so the results match exactly.
+    __m256 acc = _mm256_mul_ps(_mm256_set1_ps(planes[0][p]), x);
+    acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(planes[1][p]), y));
+    acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(planes[2][p]), z));
+    acc = _mm256_sub_ps(acc, _mm256_set1_ps(planes[3][p]));
+    mask &= _mm256_movemask_ps(_mm256_cmp_ps(acc, neg_r, _CMP_GT_OQ));
+  }
+  return mask;
+#else
+  u32 mask = 0;
+  for (int half = 0; half < 2; half++) {
+    const int off = half * 4;
+    __m128 x = _mm_load_ps(group.x + off);
+    __m128 y = _mm_load_ps(group.y + off);
+    __m128 z = _mm_load_ps(group.z + off);
+    __m128 neg_r = _mm_sub_ps(_mm_setzero_ps(), _mm_load_ps(group.r + off));
+    u32 half_mask = 0xf;
+    for (int p = 0; p < 4 && half_mask; p++) {
+      __m128 acc = _mm_mul_ps(_mm_set1_ps(planes[0][p]), x);
+      acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(planes[1][p]), y));
+      acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(planes[2][p]), z));
+      acc = _mm_sub_ps(acc, _mm_set1_ps(planes[3][p]));
+      half_mask &= _mm_movemask_ps(_mm_cmpgt_ps(acc, neg_r));
+    }
+    mask |= half_mask << off;
+  }
+  return mask;
+#endif
+}
+
+/*!
+ * Bitmask of the nodes in the group that the level's occlusion string says are visible.
+ */
+u32 occlusion_test_group(const CullBvh::Group& group, const u8* level_occlusion_string) {
+  u32 mask = 0;
+  for (int i = 0; i < group.count; i++) {
+    u16 my_id = group.my_id[i];
+    if (my_id != 0xffff && level_occlusion_string[my_id / 8] & (1 << (7 - (my_id & 7)))) {
+      mask |= 1 << i;
+    }
+  }
+  return mask;
+}
+
+void cull_check_group(const math::Vector4f* planes,
+                      const CullBvh& bvh,
+                      int group_idx,
+                      const u8* level_occlusion_string,
+                      u8* out) {
+  const auto& group = bvh.groups[group_idx];
+  const u32 in_view = cull_test_group(planes, group);
+  if (!in_view) {
+    return;  // out is already cleared for these nodes and everything under them.
+  }
+
+  u32 visible = in_view;
+  if (level_occlusion_string) {
+    visible &= occlusion_test_group(group, level_occlusion_string);
+  }
+  for (u32 bits = visible; bits; bits &= bits - 1) {
+    out[group.first_node + std::countr_zero(bits)] = 1;
+  }
+
+  // an occluded node's children can still be visible, so this follows the frustum test only.
+  for (u32 bits = in_view; bits; bits &= bits - 1) {
+    int child_group = group.child_group[std::countr_zero(bits)];
+    if (child_group >= 0) {
+      cull_check_group(planes, bvh, child_group, level_occlusion_string, out);
+    }
+  }
+}
+}  // namespace
+
+void build_cull_bvh(const tfrag3::BVH& bvh, CullBvh* out) {
+  const auto& nodes = bvh.vis_nodes;
+  out->groups.clear();
+  out->num_nodes = nodes.size();
+  if (nodes.empty()) {
+    out->num_root_groups = 0;
+    return;
+  }
+
+  // the roots are the first nodes, and a node's children are consecutive, after it.
+  std::vector<u8> covered(nodes.size(), 0);
+  bool ok = !bvh.only_children && bvh.num_roots > 0 && bvh.num_roots <= nodes.size();
+  if (ok) {
+    for (u32 i = 0; i < bvh.num_roots; i += CullBvh::kGroupSize) {
+      add_cull_group(out, nodes, i, std::min((u32)CullBvh::kGroupSize, (u32)bvh.num_roots - i));
+    }
+    out->num_root_groups = out->groups.size();
+    for (u32 i = 0; i < bvh.num_roots; i++) {
+      covered[i] = 1;
+    }
+  }
+
+  // groups are added in node order, and children come after their parents, so this visits every
+  // group after it's been created.
+  for (size_t gi = 0; ok && gi < out->groups.size(); gi++) {
+    for (int i = 0; i < out->groups[gi].count; i++) {
+      const auto& node = nodes[out->groups[gi].first_node + i];
+      if (node.flags != 1) {
+        continue;  // children are leaves, which aren't in the BVH
+      }
+      u32 first = node.child_id - bvh.first_root;
+      if (node.child_id < bvh.first_root || node.num_kids == 0 ||
+          node.num_kids > CullBvh::kGroupSize || first + node.num_kids > nodes.size()) {
+        ok = false;
+        break;
+      }
+      for (u32 c = first; c < first + node.num_kids; c++) {
+        ok = ok && !covered[c];
+        covered[c] = 1;
+      }
+      if (!ok) {
+        break;
+      }
+      int child_group = add_cull_group(out, nodes, first, node.num_kids);
+      out->groups[gi].child_group[i] = child_group;
+    }
+  }
+
+  // only skip subtrees if every node is reachable from a root.
+  ok = ok && std::all_of(covered.begin(), covered.end(), [](u8 x) { return x; });
+  if (!ok) {
+    build_flat_cull_bvh(nodes, out);
+  }
+}
+
+void cull_check_all(const math::Vector4f* planes,
+                    const CullBvh& bvh,
+                    const u8* level_occlusion_string,
+                    u8* out) {
+  // the children of an invisible node are never tested, so clear everything first.
+  memset(out, 0, bvh.num_nodes);
+  for (int i = 0; i < bvh.num_root_groups; i++) {
+    cull_check_group(planes, bvh, i, level_occlusion_string, out);
   }
 }
 
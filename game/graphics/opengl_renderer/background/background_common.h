@@ -40,13 +40,23 @@ struct DoubleDraw {
   float color_mult = 1.;
 };
 
-DoubleDraw setup_tfrag_shader(SharedRenderState* render_state, DrawMode mode, ShaderId shader);
-DoubleDraw setup_opengl_from_draw_mode(DrawMode mode, u32 tex_unit, bool mipmap);
+DoubleDraw setup_tfrag_shader(SharedRenderState* render_state,
+                              DrawMode mode,
+                              ShaderId shader,
+                              u32 tex_unit = GL_TEXTURE0,
+                              GLenum tex_target = GL_TEXTURE_2D);
+DoubleDraw setup_opengl_from_draw_mode(DrawMode mode,
+                                       u32 tex_unit,
+                                       bool mipmap,
+                                       GLenum tex_target = GL_TEXTURE_2D);
 
 void first_tfrag_draw_setup(const GoalBackgroundCameraData& settings,
                             SharedRenderState* render_state,
                             ShaderId shader);
 
+// the weight of each of the 8 palettes, per channel, from the camera's itimes.
+void time_of_day_weights(const math::Vector<s32, 4> itimes[4], math::Vector<u16, 4>* weights);
+
 void interp_time_of_day(const math::Vector<s32, 4> itimes[4],
                         const tfrag3::PackedTimeOfDay& packed_colors,
                         math::Vector<u8, 4>* out);
@@ -55,15 +65,42 @@ void cull_check_all_slow(const math::Vector4f* planes,
                          const std::vector<tfrag3::VisNode>& nodes,
                          const u8* level_occlusion_string,
                          u8* out);
+
+/*!
+ * The bounding spheres of a BVH, rearranged so a set of siblings can be tested against the frustum
+ * at once. Built once per tree at load time.
+ */
+struct CullBvh {
+  static constexpr int kGroupSize = 8;  // a node has at most 8 children
+  struct Group {
+    alignas(32) float x[kGroupSize];
+    alignas(32) float y[kGroupSize];
+    alignas(32) float z[kGroupSize];
+    alignas(32) float r[kGroupSize];  // negative for unused slots, so they always fail
+    s32 child_group[kGroupSize];      // the group holding each node's children, or -1
+    u16 my_id[kGroupSize];            // for the occlusion string
+    u16 first_node = 0;
+    u8 count = 0;
+  };
+  std::vector<Group> groups;
+  int num_root_groups = 0;  // the first groups, which are tested unconditionally
+  u32 num_nodes = 0;
+};
+
+void build_cull_bvh(const tfrag3::BVH& bvh, CullBvh* out);
+
+/*!
+ * Fill out with the visibility of each node, like cull_check_all_slow. Subtrees under a node that
+ * is out of view are skipped without testing.
+ */
+void cull_check_all(const math::Vector4f* planes,
+                    const CullBvh& bvh,
+                    const u8* level_occlusion_string,
+                    u8* out);
 bool sphere_in_view_ref(const math::Vector4f& sphere, const math::Vector4f* planes);
 
 void update_render_state_from_pc_settings(SharedRenderState* state, const TfragPcPortData& data);
 
-void make_all_visible_multidraws(std::pair<int, int>* draw_ptrs_out,
-                                 GLsizei* counts_out,
-                                 void** index_offsets_out,
-                                 const std::vector<tfrag3::ShrubDraw>& draws);
-
 u32 make_all_visible_multidraws(std::pair<int, int>* draw_ptrs_out,
                                 GLsizei* counts_out,
                                 void** index_offsets_out,
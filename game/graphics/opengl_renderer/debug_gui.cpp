@@ -1,5 +1,7 @@
 #include "debug_gui.h"
 
+#include <algorithm>
+
 #include "common/global_profiler/GlobalProfiler.h"
 #include "common/util/string_util.h"
 
@@ -7,6 +9,8 @@
 #include "game/graphics/gfx.h"
 #include "game/graphics/screenshot.h"
 #include "game/overlord/jak3/dma.h"
+#include "game/sound/989snd/player_stats.h"
+#include "game/sound/sndshim.h"
 #include "game/system/hid/sdl_util.h"
 
 #include "fmt/core.h"
@@ -20,6 +24,14 @@ void FrameTimeRecorder::finish_frame() {
   }
 }
 
+void FrameTimeRecorder::present() {
+  m_present_times[m_present_idx++] = m_present_timer.getMs();
+  if (m_present_idx == SIZE) {
+    m_present_idx = 0;
+  }
+  m_present_timer.start();
+}
+
 void FrameTimeRecorder::start_frame() {
   m_compute_timer.start();
   float frame_time = m_fps_timer.getSeconds();
@@ -78,6 +90,20 @@ void FrameTimeRecorder::draw_window(const DmaStats& /*dma_stats*/) {
         },
         (void*)this, SIZE, 0, nullptr, 0, 20., ImVec2(300, 40));
 
+    float present_worst = 0, present_total = 0;
+    for (auto x : m_present_times) {
+      present_worst = std::max(x, present_worst);
+      present_total += x;
+    }
+    ImGui::Text("present-to-present avg: %.1f worst: %.1f", present_total / SIZE, present_worst);
+    ImGui::PlotLines(
+        "0-40ms",
+        [](void* data, int idx) {
+          auto* me = (FrameTimeRecorder*)data;
+          return me->m_present_times[(me->m_present_idx + idx) % SIZE];
+        },
+        (void*)this, SIZE, 0, nullptr, 0, 40., ImVec2(300, 40));
+
     ImGui::Checkbox("Run", &m_play);
     ImGui::SameLine();
     if (ImGui::Button("Single Frame Advance")) {
@@ -106,6 +132,7 @@ void OpenGlDebugGui::draw(const DmaStats& dma_stats) {
       ImGui::MenuItem("Small Profiler", nullptr, &small_profiler);
       ImGui::MenuItem("Loader", nullptr, &m_draw_loader);
       ImGui::MenuItem("Overlord", nullptr, &m_draw_overlord);
+      ImGui::MenuItem("Sound", nullptr, &m_draw_sound);
       if (ImGui::MenuItem("Reboot In Debug Mode!")) {
         want_reboot_in_debug = true;
       }
@@ -123,6 +150,11 @@ void OpenGlDebugGui::draw(const DmaStats& dma_stats) {
         ImGui::Checkbox("Quick-Screenshot on F2", &screenshot_hotkey_enabled);
         ImGui::EndMenu();
       }
+      if (ImGui::BeginMenu("Replay Capture")) {
+        ImGui::MenuItem("Capture Next Frames!", nullptr, &m_want_replay_capture);
+        ImGui::InputInt("Frames", &m_replay_capture_frames);
+        ImGui::EndMenu();
+      }
       ImGui::MenuItem("Subtitle Editor", nullptr, &m_subtitle_editor);
       ImGui::MenuItem("Debug Text Filter", nullptr, &m_filters_menu);
       ImGui::EndMenu();
@@ -182,6 +214,24 @@ void OpenGlDebugGui::draw(const DmaStats& dma_stats) {
         ImGui::Separator();
         ImGui::Checkbox("Accurate Lag Mode", &Gfx::g_global_settings.experimental_accurate_lag);
         ImGui::Checkbox("Sleep in Frame Limiter", &Gfx::g_global_settings.sleep_in_frame_limiter);
+        ImGui::Checkbox("Adaptive VSync", &Gfx::g_global_settings.adaptive_vsync);
+        ImGui::SliderInt("Max Queued Frames (0 = driver)",
+                         &Gfx::g_global_settings.max_queued_frames, 0, 3);
+        ImGui::Checkbox("Pipelined DMA (experimental)", &Gfx::g_global_settings.pipelined_dma);
+        ImGui::Checkbox("Skip Unchanged DMA Chunks", &Gfx::g_global_settings.incremental_dma_copy);
+        ImGui::Checkbox("Dynamic Resolution", &Gfx::g_global_settings.dynamic_resolution);
+        ImGui::SliderFloat("Minimum Resolution Scale",
+                           &Gfx::g_global_settings.dynamic_resolution_min_scale, 0.25f, 1.f);
+        ImGui::TreePop();
+      }
+
+      ImGui::Separator();
+      if (ImGui::TreeNode("Audio")) {
+        ImGui::InputScalar("Latency (frames, 0 = auto)", ImGuiDataType_U32,
+                           &Gfx::g_debug_settings.audio_latency_frames);
+        if (ImGui::MenuItem("Apply")) {
+          snd_SetLatencyFrames(Gfx::g_debug_settings.audio_latency_frames);
+        }
         ImGui::TreePop();
       }
       ImGui::EndMenu();
@@ -207,6 +257,29 @@ void OpenGlDebugGui::draw(const DmaStats& dma_stats) {
         record_events = false;
         prof().dump_to_json();
       }
+      const auto totals = prof().last_event_totals();
+      if (!totals.events.empty() && ImGui::TreeNode("Time per Event (last dump)")) {
+        ImGui::Text("%d frames, per frame:", totals.frames);
+        const double frames = std::max(totals.frames, 1);
+        for (size_t i = 0; i < std::min(totals.events.size(), size_t(50)); i++) {
+          const auto& event = totals.events[i];
+          ImGui::Text("%s", fmt::format("{:7.3f} ms ({:7.3f} self) {:6.1f}x {}",
+                                        event.total_ms / frames, event.self_ms / frames,
+                                        event.count / frames, event.name)
+                                .c_str());
+        }
+        ImGui::TreePop();
+      }
+      if (!prof().is_streaming()) {
+        if (ImGui::Button("Start Streaming to File")) {
+          record_events = true;
+          prof().start_streaming(
+              file_util::get_jak_project_dir() / "profile_data" /
+              fmt::format("prof-{}.perfetto-trace", str_util::current_local_timestamp_no_colons()));
+        }
+      } else if (ImGui::Button("Stop Streaming")) {
+        prof().stop_streaming();
+      }
       // if (ImGui::Button("Open dump folder")) {
       //  // TODO - https://github.com/mlabbe/nativefiledialog
       // }
@@ -245,6 +318,10 @@ void OpenGlDebugGui::draw(const DmaStats& dma_stats) {
   if (should_draw_overlord_debug()) {
     draw_overlord_debug_menu();
   }
+
+  if (master_enable && m_draw_sound) {
+    draw_sound_debug_menu();
+  }
 }
 
 void OpenGlDebugGui::draw_overlord_debug_menu() {
@@ -256,4 +333,41 @@ void OpenGlDebugGui::draw_overlord_debug_menu() {
     ImGui::Text("%30s [%3d] | %30s [%3d]", stream[0].name.chars, stream[0].idx,
                 stream[1].name.chars, stream[1].idx);
   }
+  ImGui::End();
+}
+
+void OpenGlDebugGui::draw_sound_debug_menu() {
+  ImGui::Begin("Sound", &m_draw_sound);
+  snd::PlayerStats stats;
+  if (!snd_GetPlayerStats(&stats)) {
+    ImGui::Text("Sound system is not running");
+    ImGui::End();
+    return;
+  }
+
+  ImGui::Text("callbacks: %lld, period %.0f us", (long long)stats.callbacks, stats.period_us);
+  ImGui::Text("tick: last %.0f us, avg %.0f us, max %.0f us", stats.last_tick_us,
+              stats.avg_tick_us, stats.max_tick_us);
+  ImGui::Text("lock wait: last %.0f us, max %.0f us, total %.1f ms", stats.last_lock_wait_us,
+              stats.max_lock_wait_us, stats.total_lock_wait_us / 1000.);
+  ImGui::Text("latency: %d frames (%.1f ms)", stats.latency_frames, stats.latency_ms);
+  ImGui::Text("voices: %d, handlers: %d", stats.active_voices, stats.active_handlers);
+  if (stats.overruns || stats.late_callbacks) {
+    ImGui::TextColored(ImVec4(1.0, 0.3, 0.3, 1.0), "overruns: %lld, late callbacks: %lld",
+                       (long long)stats.overruns, (long long)stats.late_callbacks);
+  } else {
+    ImGui::Text("overruns: 0, late callbacks: 0");
+  }
+
+  float histogram[snd::PlayerStats::kNumBuckets];
+  for (int i = 0; i < snd::PlayerStats::kNumBuckets; i++) {
+    histogram[i] = stats.histogram[i];
+  }
+  ImGui::PlotHistogram("##tick", histogram, snd::PlayerStats::kNumBuckets, 0,
+                       "tick time: <10% <25% <50% <75% <100% >100% of period", 0, FLT_MAX,
+                       ImVec2(0, 80));
+  if (ImGui::Button("Reset")) {
+    snd_ResetPlayerStats();
+  }
+  ImGui::End();
 }
@@ -5,6 +5,8 @@
  * The debug menu-bar and frame timing window
  */
 
+#include <algorithm>
+
 #include "common/dma/dma.h"
 #include "common/util/Timer.h"
 #include "common/versions/versions.h"
@@ -15,6 +17,8 @@ class FrameTimeRecorder {
 
   void finish_frame();
   void start_frame();
+  // call right after the buffers are swapped.
+  void present();
   void draw_window(const DmaStats& dma_stats);
   bool should_advance_frame() {
     if (m_single_frame) {
@@ -32,6 +36,10 @@ class FrameTimeRecorder {
   int m_idx = 0;
   Timer m_compute_timer;
   Timer m_fps_timer;
+  // time between swaps, the frame times the player actually sees.
+  float m_present_times[SIZE] = {0};
+  int m_present_idx = 0;
+  Timer m_present_timer;
   bool m_open = true;
 
   bool m_play = true;
@@ -44,6 +52,7 @@ class OpenGlDebugGui {
 
   void start_frame();
   void finish_frame();
+  void present() { m_frame_timer.present(); }
   void draw(const DmaStats& dma_stats);
   bool should_draw_render_debug() const { return master_enable && m_draw_debug; }
   bool should_draw_profiler() const { return master_enable && m_draw_profiler; }
@@ -63,6 +72,15 @@ class OpenGlDebugGui {
     return false;
   }
 
+  // number of frames to record for gk --bench-replay, or 0 if no capture was requested.
+  int get_replay_capture_request() {
+    if (m_want_replay_capture) {
+      m_want_replay_capture = false;
+      return std::max(1, m_replay_capture_frames);
+    }
+    return 0;
+  }
+
   bool small_profiler = false;
   bool record_events = false;
   int max_event_buffer_size = 65536;
@@ -74,14 +92,18 @@ class OpenGlDebugGui {
 
  private:
   void draw_overlord_debug_menu();
+  void draw_sound_debug_menu();
   FrameTimeRecorder m_frame_timer;
   bool m_draw_frame_time = false;
   bool m_draw_profiler = false;
   bool m_draw_debug = false;
   bool m_draw_loader = false;
   bool m_draw_overlord = false;
+  bool m_draw_sound = false;
   bool m_subtitle_editor = false;
   bool m_filters_menu = false;
   bool m_want_screenshot = false;
+  bool m_want_replay_capture = false;
+  int m_replay_capture_frames = 120;
   float target_fps_input = 60.f;
 };
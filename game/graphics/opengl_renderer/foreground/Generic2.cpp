@@ -1,5 +1,8 @@
 #include "Generic2.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "game/graphics/opengl_renderer/AdgifHandler.h"
 
 #include "third-party/imgui/imgui.h"
@@ -12,14 +15,28 @@ Generic2::Generic2(ShaderLibrary& shaders,
   m_verts.resize(num_verts);
   m_fragments.resize(num_frags);
   m_adgifs.resize(num_adgif);
+  m_bucket_sort.resize(num_adgif);
+  m_bucket_sort_temp.resize(num_adgif);
   m_buckets.resize(num_buckets);
   m_indices.resize(num_verts * 3);
 
   opengl_setup(shaders);
 }
 
+Generic2::Generic2(Generic2& owner) : m_ogl(owner.m_ogl), m_owner(&owner) {
+  m_verts.resize(owner.m_verts.size());
+  m_fragments.resize(owner.m_fragments.size());
+  m_adgifs.resize(owner.m_adgifs.size());
+  m_bucket_sort.resize(owner.m_adgifs.size());
+  m_bucket_sort_temp.resize(owner.m_adgifs.size());
+  m_buckets.resize(owner.m_buckets.size());
+  m_indices.resize(owner.m_indices.size());
+}
+
 Generic2::~Generic2() {
-  opengl_cleanup();
+  if (!m_owner) {
+    opengl_cleanup();
+  }
 }
 
 void Generic2::draw_debug_window() {
@@ -58,51 +75,113 @@ void Generic2::render_in_mode(DmaFollower& dma,
   {
     // our first pass is to go over the DMA chain from the game and extract the data into buffers
     auto p = prof.make_scoped_child("dma");
-    switch (mode) {
-      case Mode::NORMAL:
-      case Mode::WARP:
-        if (render_state->version == GameVersion::Jak1) {
-          process_dma_jak1(dma, render_state->next_bucket);
-        } else {
-          process_dma_jak2(dma, render_state->next_bucket);
-        }
-        break;
-      case Mode::LIGHTNING:
-        process_dma_lightning(dma, render_state->next_bucket);
-        break;
-      case Mode::PRIM:
-        process_dma_prim(dma, render_state->next_bucket);
-        break;
-      default:
-        ASSERT_NOT_REACHED();
-    }
+    process_dma_in_mode(dma, render_state->next_bucket, render_state->version, mode);
   }
 
-  m_empty = m_next_free_vert == 0;
-
   {
     // the next pass is to look at all of that data, and figure out the best order to draw it
     // using OpenGL
     auto p = prof.make_scoped_child("setup");
-    switch (mode) {
-      case Mode::NORMAL:
-        setup_draws(true, true);
-        break;
-      case Mode::LIGHTNING:
-      case Mode::PRIM:
-        setup_draws(false, true);
-        break;
-      case Mode::WARP:
-        setup_draws(true, false);
-        break;
-      default:
-        ASSERT_NOT_REACHED();
-    }
+    setup_draws_in_mode(mode);
   }
 
-  {
-    // the final pass is the actual drawing.
-    auto p = prof.make_scoped_child("drawing");
-    do_draws(render_state, p);
+  draw_prepared(render_state, prof);
+}
+
+/*!
+ * Do the first two passes (DMA and setup), which don't need OpenGL and can run on any thread.
+ * Finish with draw_prepared.
+ */
+void Generic2::prepare_in_mode(DmaFollower& dma, u32 next_bucket, GameVersion version, Mode mode) {
+  process_dma_in_mode(dma, next_bucket, version, mode);
+  setup_draws_in_mode(mode);
+}
+
+void Generic2::draw_prepared(SharedRenderState* render_state, ScopedProfilerNode& prof) {
+  if (m_owner) {
+    // the debug settings live in the renderer that made us.
+    memcpy(m_alpha_draw_enable, m_owner->m_alpha_draw_enable, sizeof(m_alpha_draw_enable));
+  }
+  // the final pass is the actual drawing.
+  auto p = prof.make_scoped_child("drawing");
+  do_draws(render_state, p);
+}
+
+TexCoordBounds Generic2::warp_tex_coord_bounds(GameVersion version) const {
+  // same as the warp_sample_mode adjustment in generic.vert
+  const float scissor_height = version == GameVersion::Jak1 ? 448.f : 416.f;
+  const float warp_off = 1.f - scissor_height / 512.f;
+  const float scissor_adjust = 512.f / scissor_height;
+  const bool warp_sample_mode = version >= GameVersion::Jak2;
+
+  TexCoordBounds bounds;
+  for (u32 i = 0; i < m_next_free_vert; i++) {
+    const float s = m_verts[i].st.x() / 4096.f;
+    const float t = m_verts[i].st.y() / 4096.f;
+    bounds.add(s, warp_sample_mode ? (1.f - t - warp_off) * scissor_adjust : t);
+  }
+  return bounds;
+}
+
+void Generic2::process_dma_in_mode(DmaFollower& dma,
+                                   u32 next_bucket,
+                                   GameVersion version,
+                                   Mode mode) {
+  switch (mode) {
+    case Mode::NORMAL:
+    case Mode::WARP:
+      if (version == GameVersion::Jak1) {
+        process_dma_jak1(dma, next_bucket);
+      } else {
+        process_dma_jak2(dma, next_bucket);
+      }
+      break;
+    case Mode::LIGHTNING:
+      process_dma_lightning(dma, next_bucket);
+      break;
+    case Mode::PRIM:
+      process_dma_prim(dma, next_bucket);
+      break;
+    default:
+      ASSERT_NOT_REACHED();
   }
-}
\ No newline at end of file
+  m_empty = m_next_free_vert == 0;
+}
+
+void Generic2::setup_draws_in_mode(Mode mode) {
+  switch (mode) {
+    case Mode::NORMAL:
+      setup_draws(true, true);
+      break;
+    case Mode::LIGHTNING:
+    case Mode::PRIM:
+      setup_draws(false, true);
+      break;
+    case Mode::WARP:
+      setup_draws(true, false);
+      break;
+    default:
+      ASSERT_NOT_REACHED();
+  }
+}
+
+std::unique_ptr<Generic2> Generic2::acquire_worker() {
+  std::lock_guard<std::mutex> lk(m_workers_mutex);
+  if (m_free_workers.empty()) {
+    return std::unique_ptr<Generic2>(new Generic2(*this));
+  }
+  auto worker = std::move(m_free_workers.back());
+  m_free_workers.pop_back();
+  return worker;
+}
+
+void Generic2::release_worker(std::unique_ptr<Generic2> worker) {
+  ASSERT(worker->m_owner == this);
+  m_max_frags_seen = std::max(m_max_frags_seen, worker->m_max_frags_seen);
+  m_max_verts_seen = std::max(m_max_verts_seen, worker->m_max_verts_seen);
+  m_max_adgifs_seen = std::max(m_max_adgifs_seen, worker->m_max_adgifs_seen);
+  m_max_buckets_seen = std::max(m_max_buckets_seen, worker->m_max_buckets_seen);
+  m_max_indices_seen = std::max(m_max_indices_seen, worker->m_max_indices_seen);
+  std::lock_guard<std::mutex> lk(m_workers_mutex);
+  m_free_workers.push_back(std::move(worker));
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 
 class Generic2 {
  public:
@@ -18,6 +22,23 @@ class Generic2 {
                       ScopedProfilerNode& prof,
                       Mode mode);
 
+  void prepare_in_mode(DmaFollower& dma, u32 next_bucket, GameVersion version, Mode mode);
+  void draw_prepared(SharedRenderState* render_state, ScopedProfilerNode& prof);
+
+  /*!
+   * The texture coordinates of everything prepared, as the warp shader samples the framebuffer
+   * copy with them.
+   */
+  TexCoordBounds warp_tex_coord_bounds(GameVersion version) const;
+
+  /*!
+   * Get a Generic2 with its own buffers, to prepare a bucket on another thread while this one is
+   * busy. It draws with this renderer's OpenGL objects, so must be released before this is
+   * destroyed.
+   */
+  std::unique_ptr<Generic2> acquire_worker();
+  void release_worker(std::unique_ptr<Generic2> worker);
+
   void draw_debug_window();
   bool empty() { return m_empty; }
 
@@ -34,6 +55,9 @@ class Generic2 {
   static_assert(sizeof(Vertex) == 32);
 
  private:
+  explicit Generic2(Generic2& owner);
+  void process_dma_in_mode(DmaFollower& dma, u32 next_bucket, GameVersion version, Mode mode);
+  void setup_draws_in_mode(Mode mode);
   void determine_draw_modes(bool enable_at, bool default_fog);
   void build_index_buffer();
   void link_adgifs_back_to_frags();
@@ -52,7 +76,6 @@ class Generic2 {
                           bool hud);
   void do_hud_draws(SharedRenderState* render_state, ScopedProfilerNode& prof);
   bool check_for_end_of_generic_data(DmaFollower& dma, u32 next_bucket);
-  void final_vertex_update();
   bool handle_bucket_setup_dma(DmaFollower& dma, u32 next_bucket);
 
   void opengl_setup(ShaderLibrary& shaders);
@@ -179,6 +202,14 @@ class Generic2 {
   std::vector<u32> m_indices;
   u32 m_max_indices_seen = 0;
 
+  // scratch for draws_to_buckets, one per adgif
+  struct BucketSortEntry {
+    u64 key;
+    u32 adgif;
+  };
+  std::vector<BucketSortEntry> m_bucket_sort;
+  std::vector<BucketSortEntry> m_bucket_sort_temp;
+
   Fragment& next_frag() {
     ASSERT(m_next_free_frag < m_fragments.size());
     return m_fragments[m_next_free_frag++];
@@ -199,8 +230,8 @@ class Generic2 {
 
   struct {
     GLuint vao;
-    GLuint vertex_buffer;
-    GLuint index_buffer;
+    std::shared_ptr<StreamingBuffer> vertex_stream;
+    std::shared_ptr<StreamingBuffer> index_stream;
     GLuint alpha_reject, color_mult, fog_color, scale, mat_23, mat_32, mat_33, fog_consts,
         hvdf_offset, use_full_matrix, full_matrix;
     GLuint gfx_hack_no_tex;
@@ -208,4 +239,13 @@ class Generic2 {
   } m_ogl;
 
   bool m_empty = false;
+
+  // where this instance's data went in the streaming buffers on its last upload.
+  u32 m_stream_first_vert = 0;
+  u32 m_stream_first_idx = 0;
+
+  // set on workers, which share the OpenGL objects of their owner.
+  Generic2* m_owner = nullptr;
+  std::mutex m_workers_mutex;
+  std::vector<std::unique_ptr<Generic2>> m_free_workers;
 };
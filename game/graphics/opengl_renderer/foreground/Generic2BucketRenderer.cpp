@@ -13,16 +13,34 @@ void Generic2BucketRenderer::draw_debug_window() {
 void Generic2BucketRenderer::render(DmaFollower& dma,
                                     SharedRenderState* render_state,
                                     ScopedProfilerNode& prof) {
-  // if the user has asked to disable the renderer, just advance the dma follower to the next
-  // bucket and return immediately.
-  if (!m_enabled) {
+  // if the user has asked to disable the renderer, or the DMA was already processed by prepare,
+  // just advance the dma follower to the next bucket.
+  if (!m_enabled || m_prepared) {
     while (dma.current_tag_offset() != render_state->next_bucket) {
       dma.read_and_advance();
     }
+  }
+
+  if (m_prepared) {
+    if (m_enabled) {
+      m_prepared->draw_prepared(render_state, prof);
+      m_empty = m_prepared->empty();
+    }
+    m_generic->release_worker(std::move(m_prepared));
     return;
   }
-  m_generic->render_in_mode(dma, render_state, prof, m_mode);
-  m_empty = m_generic->empty();
+
+  if (m_enabled) {
+    m_generic->render_in_mode(dma, render_state, prof, m_mode);
+    m_empty = m_generic->empty();
+  }
+}
+
+void Generic2BucketRenderer::prepare(DmaFollower& dma, u32 next_bucket, GameVersion version) {
+  ASSERT(!m_prepared);
+  auto worker = m_generic->acquire_worker();
+  worker->prepare_in_mode(dma, next_bucket, version, m_mode);
+  m_prepared = std::move(worker);
 }
 
 bool Generic2BucketRenderer::empty() const {
@@ -12,9 +12,13 @@ class Generic2BucketRenderer : public BucketRenderer {
   void render(DmaFollower& dma, SharedRenderState* render_state, ScopedProfilerNode& prof) override;
   void draw_debug_window() override;
   bool empty() const override;
+  bool can_prepare() const override { return m_enabled; }
+  void prepare(DmaFollower& dma, u32 next_bucket, GameVersion version) override;
 
  private:
   std::shared_ptr<Generic2> m_generic;
   Generic2::Mode m_mode;
   bool m_empty = false;
+  // the worker that prepared this frame's data, if prepare was called.
+  std::unique_ptr<Generic2> m_prepared;
 };
@@ -1,5 +1,49 @@
 #include "Generic2.h"
 
+#include <algorithm>
+
+namespace {
+/*!
+ * Stable LSD radix sort of count entries by their 64-bit key, one byte per pass. Passes where
+ * every key has the same byte are skipped, which is most of them for draw keys. The result is in
+ * either data or temp, and a pointer to it is returned.
+ */
+template <typename T>
+T* radix_sort_by_key(T* data, T* temp, u32 count) {
+  if (count == 0) {
+    return data;
+  }
+  u32 histograms[8][256] = {};
+  for (u32 i = 0; i < count; i++) {
+    u64 key = data[i].key;
+    for (int pass = 0; pass < 8; pass++) {
+      histograms[pass][(key >> (pass * 8)) & 0xff]++;
+    }
+  }
+
+  T* in = data;
+  T* out = temp;
+  for (int pass = 0; pass < 8; pass++) {
+    auto& hist = histograms[pass];
+    const u32 first_byte = (in[0].key >> (pass * 8)) & 0xff;
+    if (hist[first_byte] == count) {
+      continue;
+    }
+    u32 offset = 0;
+    for (auto& h : hist) {
+      u32 n = h;
+      h = offset;
+      offset += n;
+    }
+    for (u32 i = 0; i < count; i++) {
+      out[hist[(in[i].key >> (pass * 8)) & 0xff]++] = in[i];
+    }
+    std::swap(in, out);
+  }
+  return in;
+}
+}  // namespace
+
 /*!
  * Main function to set up Generic2 draw lists.
  * This function figures out which vertices belong to which draw settings.
@@ -13,7 +57,6 @@ void Generic2::setup_draws(bool enable_at, bool default_fog) {
   process_matrices();
   determine_draw_modes(enable_at, default_fog);
   draws_to_buckets();
-  final_vertex_update();
   build_index_buffer();
 }
 
@@ -227,48 +270,51 @@ void Generic2::link_adgifs_back_to_frags() {
 
 /*!
  * Build linked lists of adgifs that share the same settings.
+ * The adgifs are grouped with a stable sort on their key, so each list stays in draw order, then
+ * the buckets are put in the order of their first adgif, which is the order they are drawn in.
  * TODO: also determine texture units per bucket here.
  */
 void Generic2::draws_to_buckets() {
-  std::unordered_map<u64, u32> draw_key_to_bucket;
+  auto new_bucket = [&](u32 adgif_idx) -> Bucket& {
+    u32 bucket_idx = m_next_free_bucket++;
+    ASSERT(bucket_idx < m_buckets.size());
+    auto& bucket = m_buckets[bucket_idx];
+    const auto& ad = m_adgifs[adgif_idx];
+    bucket.tbp = ad.tbp;
+    bucket.mode = ad.mode;
+    bucket.start = adgif_idx;
+    bucket.last = adgif_idx;
+    return bucket;
+  };
+
+  u32 sort_count = 0;
   for (u32 i = 0; i < m_next_free_adgif; i++) {
     auto& ad = m_adgifs[i];
+    ad.next = UINT32_MAX;
     if (ad.uses_hud) {
       // put all hud draws in separate buckets.
       // there's some really weird messed up draws for the orbs that fly up to the corner when
       // breaking a crate on a zoomer.
-      u32 bucket_idx = m_next_free_bucket++;
-      ASSERT(bucket_idx < m_buckets.size());
-      draw_key_to_bucket[ad.key()] = bucket_idx;
-      auto& bucket = m_buckets[bucket_idx];
-      bucket.tbp = ad.tbp;
-      bucket.mode = ad.mode;
-      bucket.start = i;
-      bucket.last = i;
-      ad.next = UINT32_MAX;
+      new_bucket(i);
     } else {
-      u64 key = ad.key();
-      const auto& bucket_it = draw_key_to_bucket.find(key);
-      if (bucket_it == draw_key_to_bucket.end()) {
-        // new bucket!
-        u32 bucket_idx = m_next_free_bucket++;
-        ASSERT(bucket_idx < m_buckets.size());
-        draw_key_to_bucket[key] = bucket_idx;
-        auto& bucket = m_buckets[bucket_idx];
-        bucket.tbp = ad.tbp;
-        bucket.mode = ad.mode;
-        bucket.start = i;
-        bucket.last = i;
-        ad.next = UINT32_MAX;
-      } else {
-        // existing bucket!
-        auto& bucket = m_buckets[bucket_it->second];
-        m_adgifs[bucket.last].next = i;
-        ad.next = UINT32_MAX;
-        bucket.last = i;
-      }
+      m_bucket_sort[sort_count++] = {ad.key(), i};
     }
   }
+
+  const auto* sorted =
+      radix_sort_by_key(m_bucket_sort.data(), m_bucket_sort_temp.data(), sort_count);
+  Bucket* bucket = nullptr;
+  for (u32 i = 0; i < sort_count; i++) {
+    if (i == 0 || sorted[i].key != sorted[i - 1].key) {
+      bucket = &new_bucket(sorted[i].adgif);
+    } else {
+      m_adgifs[bucket->last].next = sorted[i].adgif;
+      bucket->last = sorted[i].adgif;
+    }
+  }
+
+  std::sort(m_buckets.begin(), m_buckets.begin() + m_next_free_bucket,
+            [](const Bucket& a, const Bucket& b) { return a.start < b.start; });
 }
 
 /*!
@@ -336,21 +382,10 @@ void Generic2::process_matrices() {
 }
 
 /*!
- * After all bucketing/draw modes have been determined, fill out the flag fields of all vertices.
+ * Build the index buffer. This visits every vertex of every adgif once, so it also fills out the
+ * flag fields of the vertices, now that the draw modes have been determined.
  * TODO: fill out texture units
  */
-void Generic2::final_vertex_update() {
-  for (u32 i = 0; i < m_next_free_adgif; i++) {
-    auto& ad = m_adgifs[i];
-    for (u32 j = 0; j < ad.vtx_count; j++) {
-      m_verts[ad.vtx_idx + j].flags = ad.vtx_flags;
-    }
-  }
-}
-
-/*!
- * Build the index buffer.
- */
 void Generic2::build_index_buffer() {
   for (u32 bucket_idx = 0; bucket_idx < m_next_free_bucket; bucket_idx++) {
     auto& bucket = m_buckets[bucket_idx];
@@ -363,6 +398,7 @@ void Generic2::build_index_buffer() {
       m_indices[m_next_free_idx++] = UINT32_MAX;
       for (u32 vidx = adgif.vtx_idx; vidx < adgif.vtx_idx + adgif.vtx_count; vidx++) {
         auto& vtx = m_verts[vidx];
+        vtx.flags = adgif.vtx_flags;
         if (vtx.adc) {
           m_indices[m_next_free_idx++] = vidx;
           bucket.tri_count++;
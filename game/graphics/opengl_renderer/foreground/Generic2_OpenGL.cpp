@@ -4,17 +4,16 @@
 #include "game/graphics/gfx.h"
 
 void Generic2::opengl_setup(ShaderLibrary& shaders) {
-  // create OpenGL objects
-  glGenBuffers(1, &m_ogl.vertex_buffer);
-  glGenBuffers(1, &m_ogl.index_buffer);
+  // create OpenGL objects. The streaming buffers fit two full uploads, so a bucket never has to
+  // wait for the previous one.
+  m_ogl.vertex_stream = std::make_shared<StreamingBuffer>(2 * m_verts.size() * sizeof(Vertex));
+  m_ogl.index_stream = std::make_shared<StreamingBuffer>(2 * m_indices.size() * sizeof(u32));
   glGenVertexArrays(1, &m_ogl.vao);
 
   // set up the vertex array
   glBindVertexArray(m_ogl.vao);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_indices.size() * sizeof(u32), nullptr, GL_STREAM_DRAW);
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
-  glBufferData(GL_ARRAY_BUFFER, m_verts.size() * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_stream->buffer());
+  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_stream->buffer());
 
   // xyz
   glEnableVertexAttribArray(0);
@@ -79,8 +78,8 @@ void Generic2::opengl_setup(ShaderLibrary& shaders) {
 }
 
 void Generic2::opengl_cleanup() {
-  glDeleteBuffers(1, &m_ogl.vertex_buffer);
-  glDeleteBuffers(1, &m_ogl.index_buffer);
+  m_ogl.vertex_stream.reset();
+  m_ogl.index_stream.reset();
   glDeleteVertexArrays(1, &m_ogl.vao);
 }
 
@@ -273,8 +272,9 @@ void Generic2::do_draws_for_alpha(SharedRenderState* render_state,
       setup_opengl_for_draw_mode(first.mode, first.fix, render_state);
       setup_opengl_tex(0, first.tbp, first.mode.get_filt_enable(), first.mode.get_clamp_s_enable(),
                        first.mode.get_clamp_t_enable(), render_state);
-      glDrawElements(GL_TRIANGLE_STRIP, bucket.idx_count, GL_UNSIGNED_INT,
-                     (void*)(sizeof(u32) * bucket.idx_idx));
+      glDrawElementsBaseVertex(GL_TRIANGLE_STRIP, bucket.idx_count, GL_UNSIGNED_INT,
+                               (void*)(sizeof(u32) * (m_stream_first_idx + bucket.idx_idx)),
+                               m_stream_first_vert);
       prof.add_draw_call();
       prof.add_tri(bucket.tri_count);
     }
@@ -289,8 +289,9 @@ void Generic2::do_hud_draws(SharedRenderState* render_state, ScopedProfilerNode&
       setup_opengl_for_draw_mode(first.mode, first.fix, render_state);
       setup_opengl_tex(0, first.tbp, first.mode.get_filt_enable(), first.mode.get_clamp_s_enable(),
                        first.mode.get_clamp_t_enable(), render_state);
-      glDrawElements(GL_TRIANGLE_STRIP, bucket.idx_count, GL_UNSIGNED_INT,
-                     (void*)(sizeof(u32) * bucket.idx_idx));
+      glDrawElementsBaseVertex(GL_TRIANGLE_STRIP, bucket.idx_count, GL_UNSIGNED_INT,
+                               (void*)(sizeof(u32) * (m_stream_first_idx + bucket.idx_idx)),
+                               m_stream_first_vert);
       prof.add_draw_call();
       prof.add_tri(bucket.tri_count);
     }
@@ -299,11 +300,15 @@ void Generic2::do_hud_draws(SharedRenderState* render_state, ScopedProfilerNode&
 
 void Generic2::do_draws(SharedRenderState* render_state, ScopedProfilerNode& prof) {
   glBindVertexArray(m_ogl.vao);
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_next_free_idx * sizeof(u32), m_indices.data(),
-               GL_STREAM_DRAW);
-  glBufferData(GL_ARRAY_BUFFER, m_next_free_vert * sizeof(Vertex), m_verts.data(), GL_STREAM_DRAW);
+  // indices are relative to this upload's first vertex, which is added by the draws. This happens
+  // before the restart index check, so UINT32_MAX still restarts.
+  m_stream_first_idx =
+      m_ogl.index_stream->upload(m_indices.data(), m_next_free_idx * sizeof(u32), sizeof(u32)) /
+      sizeof(u32);
+  m_stream_first_vert =
+      m_ogl.vertex_stream->upload(m_verts.data(), m_next_free_vert * sizeof(Vertex),
+                                  sizeof(Vertex)) /
+      sizeof(Vertex);
 
   glEnable(GL_PRIMITIVE_RESTART);
   glPrimitiveRestartIndex(UINT32_MAX);
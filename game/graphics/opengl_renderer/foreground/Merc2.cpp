@@ -1,5 +1,8 @@
 #include "Merc2.h"
 
+#include <algorithm>
+#include <tuple>
+
 #ifdef __aarch64__
 #include "third-party/sse2neon/sse2neon.h"
 #else
@@ -7,6 +10,7 @@
 #endif
 
 #include "common/global_profiler/GlobalProfiler.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/fnv.h"
 
 #include "game/graphics/opengl_renderer/EyeRenderer.h"
@@ -43,12 +47,11 @@
 
 /*!
  * Remaining ideas for optimization:
- * - port blerc to C++, do it in the rendering thread and avoid the lock.
+ * - do blerc in the rendering thread and avoid the lock (the game still runs blerc_execute).
  * - combine envmap draws per effect (might require some funky indexing stuff, or multidraw)
  * - smaller vertex formats for mod-vertex
  * - AVX version of vertex conversion math
  * - eliminate the "copy" step of vertex modification
- * - batch uploading the vertex modification data
  */
 
 std::mutex g_merc_data_mutex;
@@ -62,16 +65,6 @@ Merc2::Merc2(ShaderLibrary& shaders, const std::vector<GLuint>* anim_slot_array)
   glGenVertexArrays(1, &m_vao);
   glBindVertexArray(m_vao);
 
-  // Bone buffer to store skinning matrices for multiple draws
-  glGenBuffers(1, &m_bones_buffer);
-  glBindBuffer(GL_UNIFORM_BUFFER, m_bones_buffer);
-
-  // zero initialize the bone buffer.
-  std::vector<u8> temp(MAX_SHADER_BONE_VECTORS * sizeof(math::Vector4f));
-  glBufferData(GL_UNIFORM_BUFFER, MAX_SHADER_BONE_VECTORS * sizeof(math::Vector4f), temp.data(),
-               GL_DYNAMIC_DRAW);
-  glBindBuffer(GL_UNIFORM_BUFFER, 0);
-
   // annoyingly, glBindBufferRange can have alignment restrictions that vary per platform.
   // the GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT gives us the minimum alignment for views into the bone
   // buffer. The bone buffer stores things per-16-byte "quadword".
@@ -88,6 +81,30 @@ Merc2::Merc2(ShaderLibrary& shaders, const std::vector<GLuint>* anim_slot_array)
     }
   }
 
+  // Bone buffer to store skinning matrices for multiple draws. Each flush needs room for all the
+  // bones, the lights and instance records for instanced draws, plus the full range bound for the
+  // last draw, and the buffer holds a few flushes.
+  m_bones_stream = std::make_unique<StreamingBuffer>(
+      4 * ((MAX_SHADER_BONE_VECTORS + MAX_LIGHTS * 8 + MAX_LEVELS * MAX_DRAWS_PER_LEVEL) *
+               sizeof(math::Vector4f) +
+           128 * sizeof(ShaderMercMat) + m_opengl_buffer_alignment * sizeof(math::Vector4f)));
+
+  // Instanced draws read the bone buffer as a texture buffer, which may have a size limit as low
+  // as 64k texels.
+  GLint max_texels;
+  glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &max_texels);
+  m_instancing_supported = (u64)max_texels * sizeof(math::Vector4f) >= m_bones_stream->size();
+  glGenTextures(1, &m_merc_data_texture);
+  if (m_instancing_supported) {
+    glBindTexture(GL_TEXTURE_BUFFER, m_merc_data_texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_bones_stream->buffer());
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+  }
+
+  // grows if a flush has more mod vertices than fit.
+  glGenVertexArrays(1, &m_mod_vtx_vao);
+  init_mod_vtx_stream(4 * 1024 * 1024);
+
   // initialize draw buffers, these will store lists of draws to flush.
   for (int i = 0; i < MAX_LEVELS; i++) {
     auto& draws = m_level_draw_buckets.emplace_back();
@@ -95,26 +112,21 @@ Merc2::Merc2(ShaderLibrary& shaders, const std::vector<GLuint>* anim_slot_array)
     draws.envmap_draws.resize(MAX_ENVMAP_DRAWS_PER_LEVEL);
   }
 
-  m_mod_vtx_temp.resize(MAX_MOD_VTX);
-  m_mod_vtx_unpack_temp.resize(MAX_MOD_VTX * 2);
-
   for (auto& x : m_effect_debug_mask) {
     x = true;
   }
 
   init_shader_common(shaders[ShaderId::MERC2], &m_merc_uniforms, true);
+  // the bone texture buffer goes on unit 1, the model's texture is on 0.
+  glUniform1i(glGetUniformLocation(shaders[ShaderId::MERC2].id(), "merc_data"), 1);
   init_shader_common(shaders[ShaderId::EMERC], &m_emerc_uniforms, false);
   m_emerc_uniforms.fade = glGetUniformLocation(shaders[ShaderId::EMERC].id(), "fade");
 }
 
 Merc2::~Merc2() {
-  for (auto& x : m_mod_vtx_buffers) {
-    glDeleteBuffers(1, &x.vertex);
-    glDeleteVertexArrays(1, &x.vao);
-  }
-
-  glDeleteBuffers(1, &m_bones_buffer);
+  glDeleteVertexArrays(1, &m_mod_vtx_vao);
   glDeleteVertexArrays(1, &m_vao);
+  glDeleteTextures(1, &m_merc_data_texture);
 }
 
 /*!
@@ -171,8 +183,7 @@ float blerc_multiplier = 1.f;
 
 void Merc2::model_mod_blerc_draws(int num_effects,
                                   const tfrag3::MercModel* model,
-                                  const LevelData* lev,
-                                  ModBuffers* mod_opengl_buffers,
+                                  u32* mod_vtx_jobs,
                                   const float* blerc_weights,
                                   MercDebugStats* stats) {
   // loop over effects.
@@ -183,10 +194,6 @@ void Merc2::model_mod_blerc_draws(int num_effects,
       continue;
     }
 
-    // grab opengl buffer
-    auto opengl_buffers = alloc_mod_vtx_buffer(lev);
-    mod_opengl_buffers[ei] = opengl_buffers;
-
     // check that we have enough room for the finished thing.
     if (effect.mod.vertices.size() > MAX_MOD_VTX) {
       fmt::print("More mod vertices than MAX_MOD_VTX. {} > {}\n", effect.mod.vertices.size(),
@@ -194,24 +201,13 @@ void Merc2::model_mod_blerc_draws(int num_effects,
       ASSERT_NOT_REACHED();
     }
 
-    // start with the correct vertices from the model data:
-    memcpy(m_mod_vtx_temp.data(), effect.mod.vertices.data(),
-           sizeof(tfrag3::MercVertex) * effect.mod.vertices.size());
-
-    // do blerc math
-    const auto* f_data = effect.mod.blerc.float_data.data();
-    const u32* i_data = effect.mod.blerc.int_data.data();
-    const u32* i_data_end = i_data + effect.mod.blerc.int_data.size();
-    blerc_avx(i_data, i_data_end, f_data, blerc_weights, m_mod_vtx_temp.data(), blerc_multiplier);
-
-    // and upload to GPU
-    stats->num_uploads++;
-    stats->num_upload_bytes += effect.mod.vertices.size() * sizeof(tfrag3::MercVertex);
-    {
-      glBindBuffer(GL_ARRAY_BUFFER, opengl_buffers.vertex);
-      glBufferData(GL_ARRAY_BUFFER, effect.mod.vertices.size() * sizeof(tfrag3::MercVertex),
-                   m_mod_vtx_temp.data(), GL_DYNAMIC_DRAW);
-    }
+    // the blerc math runs later, with the other jobs for this flush.
+    mod_vtx_jobs[ei] = alloc_mod_vtx_job();
+    auto& job = m_mod_vtx_jobs[mod_vtx_jobs[ei]];
+    job.blerc = true;
+    job.model = model;
+    job.effect = ei;
+    memcpy(job.blerc_weights, blerc_weights, sizeof(job.blerc_weights));
   }
 }
 
@@ -222,13 +218,10 @@ void Merc2::model_mod_blerc_draws(int num_effects,
 
 void Merc2::model_mod_draws(int num_effects,
                             const tfrag3::MercModel* model,
-                            const LevelData* lev,
                             const u8* input_data,
                             const DmaTransfer& setup,
-                            ModBuffers* mod_opengl_buffers,
+                            u32* mod_vtx_jobs,
                             MercDebugStats* stats) {
-  auto p = scoped_prof("update-verts");
-
   // loop over effects. Mod vertices are done per effect (possibly a bad idea?)
   for (int ei = 0; ei < num_effects; ei++) {
     const auto& effect = model->effects[ei];
@@ -237,11 +230,6 @@ void Merc2::model_mod_draws(int num_effects,
       continue;
     }
 
-    prof().begin_event("start1");
-    // grab opengl buffer
-    auto opengl_buffers = alloc_mod_vtx_buffer(lev);
-    mod_opengl_buffers[ei] = opengl_buffers;
-
     // check that we have enough room for the finished thing.
     if (effect.mod.vertices.size() > MAX_MOD_VTX) {
       fmt::print("More mod vertices than MAX_MOD_VTX. {} > {}\n", effect.mod.vertices.size(),
@@ -256,141 +244,267 @@ void Merc2::model_mod_draws(int num_effects,
       ASSERT_NOT_REACHED();
     }
 
-    // start with the "correct" vertices from the model data:
-    memcpy(m_mod_vtx_temp.data(), effect.mod.vertices.data(),
-           sizeof(tfrag3::MercVertex) * effect.mod.vertices.size());
-
-    // get pointers to the fragment and fragment control data
-    u32 goal_addr;
-    memcpy(&goal_addr, input_data + 4 * ei, 4);
-    const u8* ee0 = setup.data - setup.data_offset;
-    const u8* merc_effect = ee0 + goal_addr;
-    u16 frag_cnt;
-    memcpy(&frag_cnt, merc_effect + 18, 2);
-    ASSERT(frag_cnt >= effect.mod.fragment_mask.size());
-    u32 frag_goal;
-    memcpy(&frag_goal, merc_effect, 4);
-    u32 frag_ctrl_goal;
-    memcpy(&frag_ctrl_goal, merc_effect + 4, 4);
-    const u8* frag = ee0 + frag_goal;
-    const u8* frag_ctrl = ee0 + frag_ctrl_goal;
-
-    // loop over frags
-    u32 vidx = 0;
-    // u32 st_vif_add = model->st_vif_add;
-    float xyz_scale = model->xyz_scale;
-    prof().end_event();
-    {
-      // we're going to look at data that the game may be modifying.
-      // in the original game, they didn't have any lock, but I think that the
-      // scratchpad access from the EE would effectively block the VIF1 DMA, so you'd
-      // hopefully never get a partially updated model (which causes obvious holes).
-      // this lock is not ideal, and can block the rendering thread while blerc_execute runs,
-      // which can take up to 2ms on really blerc-heavy scenes
-      std::unique_lock<std::mutex> lk(g_merc_data_mutex);
-      [[maybe_unused]] int frags_done = 0;
-      auto p = scoped_prof("vert-math");
-
-      // loop over fragments
-      for (u32 fi = 0; fi < effect.mod.fragment_mask.size(); fi++) {
-        frags_done++;
-        u8 mat_xfer_count = frag_ctrl[3];
-
-        // we create a mask of fragments to skip because they have no vertices.
-        // the indexing data assumes that we skip the other fragments.
-        if (effect.mod.fragment_mask[fi]) {
-          // read fragment metadata
-          u8 unsigned_four_count = frag_ctrl[0];
-          u8 lump_four_count = frag_ctrl[1];
-          u32 mm_qwc_off = frag[10];
-          float float_offsets[3];
-          memcpy(float_offsets, &frag[mm_qwc_off * 16], 12);
-          u32 my_u4_count = ((unsigned_four_count + 3) / 4) * 16;
-          u32 my_l4_count = my_u4_count + ((lump_four_count + 3) / 4) * 16;
-
-          // loop over vertices in the fragment and unpack
-          for (u32 w = my_u4_count / 4; w < (my_l4_count / 4) - 2; w += 3) {
-            // positions
-            u32 q0w = 0x4b010000 + frag[w * 4 + (0 * 4) + 3];
-            u32 q1w = 0x4b010000 + frag[w * 4 + (1 * 4) + 3];
-            u32 q2w = 0x4b010000 + frag[w * 4 + (2 * 4) + 3];
-
-            // normals
-            u32 q0z = 0x47800000 + frag[w * 4 + (0 * 4) + 2];
-            u32 q1z = 0x47800000 + frag[w * 4 + (1 * 4) + 2];
-            u32 q2z = 0x47800000 + frag[w * 4 + (2 * 4) + 2];
-
-            // uvs
-            u32 q2x = model->st_vif_add + frag[w * 4 + (2 * 4) + 0];
-            u32 q2y = model->st_vif_add + frag[w * 4 + (2 * 4) + 1];
-
-            auto* pos_array = m_mod_vtx_unpack_temp[vidx].pos;
-            memcpy(&pos_array[0], &q0w, 4);
-            memcpy(&pos_array[1], &q1w, 4);
-            memcpy(&pos_array[2], &q2w, 4);
-            pos_array[0] += float_offsets[0];
-            pos_array[1] += float_offsets[1];
-            pos_array[2] += float_offsets[2];
-            pos_array[0] *= xyz_scale;
-            pos_array[1] *= xyz_scale;
-            pos_array[2] *= xyz_scale;
-
-            auto* nrm_array = m_mod_vtx_unpack_temp[vidx].nrm;
-            memcpy(&nrm_array[0], &q0z, 4);
-            memcpy(&nrm_array[1], &q1z, 4);
-            memcpy(&nrm_array[2], &q2z, 4);
-            nrm_array[0] += -65537;
-            nrm_array[1] += -65537;
-            nrm_array[2] += -65537;
-
-            auto* uv_array = m_mod_vtx_unpack_temp[vidx].uv;
-            memcpy(&uv_array[0], &q2x, 4);
-            memcpy(&uv_array[1], &q2y, 4);
-            uv_array[0] += model->st_magic;
-            uv_array[1] += model->st_magic;
-
-            vidx++;
-          }
-        }
+    // the unpack reads game memory, so it runs later under the merc data lock.
+    mod_vtx_jobs[ei] = alloc_mod_vtx_job();
+    auto& job = m_mod_vtx_jobs[mod_vtx_jobs[ei]];
+    job.blerc = false;
+    job.model = model;
+    job.effect = ei;
+    job.ee0 = setup.data - setup.data_offset;
+    memcpy(&job.effect_goal_addr, input_data + 4 * ei, 4);
+  }
+}
+
+u32 Merc2::alloc_mod_vtx_job() {
+  if (m_num_mod_vtx_jobs >= m_mod_vtx_jobs.size()) {
+    m_mod_vtx_jobs.emplace_back();
+  }
+  return m_num_mod_vtx_jobs++;
+}
 
-        // next control
-        frag_ctrl += 4 + 2 * mat_xfer_count;
+void Merc2::init_mod_vtx_stream(u32 size) {
+  // draws already issued keep the old buffer alive until they're done.
+  m_mod_vtx_stream = std::make_unique<StreamingBuffer>(size);
+  glBindVertexArray(m_mod_vtx_vao);
+  glBindBuffer(GL_ARRAY_BUFFER, m_mod_vtx_stream->buffer());
+  setup_merc_vao();
+}
 
-        // next frag
-        u32 mm_qwc_count = frag[11];
-        frag += mm_qwc_count * 16;
-      }
+/*!
+ * Compute the vertices for a blerc effect: the model's vertices, with the game's blend shape
+ * weights applied.
+ */
+void Merc2::compute_blerc_vertices(ModVtxJob* job) {
+  const auto& effect = job->model->effects[job->effect];
+  job->vertices.assign(effect.mod.vertices.begin(), effect.mod.vertices.end());
+
+  const auto* f_data = effect.mod.blerc.float_data.data();
+  const u32* i_data = effect.mod.blerc.int_data.data();
+  const u32* i_data_end = i_data + effect.mod.blerc.int_data.size();
+  blerc_avx(i_data, i_data_end, f_data, job->blerc_weights, job->vertices.data(),
+            blerc_multiplier);
+}
 
-      // sanity check
-      if (effect.mod.expect_vidx_end != vidx) {
-        fmt::print("---------- BAD {}/{}\n", effect.mod.expect_vidx_end, vidx);
-        ASSERT(false);
+/*!
+ * Compute the vertices for an effect modified by the game, by unpacking its merc fragments.
+ * The caller must hold g_merc_data_mutex.
+ */
+void Merc2::compute_mod_vertices(ModVtxJob* job) {
+  auto p = scoped_prof("update-verts");
+  const auto* model = job->model;
+  const auto& effect = model->effects[job->effect];
+
+  // start with the "correct" vertices from the model data:
+  job->vertices.assign(effect.mod.vertices.begin(), effect.mod.vertices.end());
+  job->unpack_temp.resize(effect.mod.expect_vidx_end);
+
+  // get pointers to the fragment and fragment control data
+  const u8* ee0 = job->ee0;
+  const u8* merc_effect = ee0 + job->effect_goal_addr;
+  u16 frag_cnt;
+  memcpy(&frag_cnt, merc_effect + 18, 2);
+  ASSERT(frag_cnt >= effect.mod.fragment_mask.size());
+  u32 frag_goal;
+  memcpy(&frag_goal, merc_effect, 4);
+  u32 frag_ctrl_goal;
+  memcpy(&frag_ctrl_goal, merc_effect + 4, 4);
+  const u8* frag = ee0 + frag_goal;
+  const u8* frag_ctrl = ee0 + frag_ctrl_goal;
+
+  // loop over frags
+  u32 vidx = 0;
+  // u32 st_vif_add = model->st_vif_add;
+  float xyz_scale = model->xyz_scale;
+  {
+    [[maybe_unused]] int frags_done = 0;
+    auto p = scoped_prof("vert-math");
+
+    // loop over fragments
+    for (u32 fi = 0; fi < effect.mod.fragment_mask.size(); fi++) {
+      frags_done++;
+      u8 mat_xfer_count = frag_ctrl[3];
+
+      // we create a mask of fragments to skip because they have no vertices.
+      // the indexing data assumes that we skip the other fragments.
+      if (effect.mod.fragment_mask[fi]) {
+        // read fragment metadata
+        u8 unsigned_four_count = frag_ctrl[0];
+        u8 lump_four_count = frag_ctrl[1];
+        u32 mm_qwc_off = frag[10];
+        float float_offsets[3];
+        memcpy(float_offsets, &frag[mm_qwc_off * 16], 12);
+        u32 my_u4_count = ((unsigned_four_count + 3) / 4) * 16;
+        u32 my_l4_count = my_u4_count + ((lump_four_count + 3) / 4) * 16;
+
+        // loop over vertices in the fragment and unpack
+        for (u32 w = my_u4_count / 4; w < (my_l4_count / 4) - 2; w += 3) {
+          // positions
+          u32 q0w = 0x4b010000 + frag[w * 4 + (0 * 4) + 3];
+          u32 q1w = 0x4b010000 + frag[w * 4 + (1 * 4) + 3];
+          u32 q2w = 0x4b010000 + frag[w * 4 + (2 * 4) + 3];
+
+          // normals
+          u32 q0z = 0x47800000 + frag[w * 4 + (0 * 4) + 2];
+          u32 q1z = 0x47800000 + frag[w * 4 + (1 * 4) + 2];
+          u32 q2z = 0x47800000 + frag[w * 4 + (2 * 4) + 2];
+
+          // uvs
+          u32 q2x = model->st_vif_add + frag[w * 4 + (2 * 4) + 0];
+          u32 q2y = model->st_vif_add + frag[w * 4 + (2 * 4) + 1];
+
+          // more vertices than expected, report it like the sanity check below does.
+          ASSERT_MSG(vidx < job->unpack_temp.size(),
+                     fmt::format("---------- BAD {}/{}+", effect.mod.expect_vidx_end, vidx + 1));
+          auto* pos_array = job->unpack_temp[vidx].pos;
+          memcpy(&pos_array[0], &q0w, 4);
+          memcpy(&pos_array[1], &q1w, 4);
+          memcpy(&pos_array[2], &q2w, 4);
+          pos_array[0] += float_offsets[0];
+          pos_array[1] += float_offsets[1];
+          pos_array[2] += float_offsets[2];
+          pos_array[0] *= xyz_scale;
+          pos_array[1] *= xyz_scale;
+          pos_array[2] *= xyz_scale;
+
+          auto* nrm_array = job->unpack_temp[vidx].nrm;
+          memcpy(&nrm_array[0], &q0z, 4);
+          memcpy(&nrm_array[1], &q1z, 4);
+          memcpy(&nrm_array[2], &q2z, 4);
+          nrm_array[0] += -65537;
+          nrm_array[1] += -65537;
+          nrm_array[2] += -65537;
+
+          auto* uv_array = job->unpack_temp[vidx].uv;
+          memcpy(&uv_array[0], &q2x, 4);
+          memcpy(&uv_array[1], &q2y, 4);
+          uv_array[0] += model->st_magic;
+          uv_array[1] += model->st_magic;
+
+          vidx++;
+        }
       }
+
+      // next control
+      frag_ctrl += 4 + 2 * mat_xfer_count;
+
+      // next frag
+      u32 mm_qwc_count = frag[11];
+      frag += mm_qwc_count * 16;
     }
 
-    {
-      auto pp = scoped_prof("copy");
-      // now copy the data in merc original vertex order to the output.
-      for (u32 vi = 0; vi < effect.mod.vertices.size(); vi++) {
-        u32 addr = effect.mod.vertex_lump4_addr[vi];
-        if (addr < vidx) {
-          memcpy(&m_mod_vtx_temp[vi], &m_mod_vtx_unpack_temp[addr], 32);
-          m_mod_vtx_temp[vi].st[0] = m_mod_vtx_unpack_temp[addr].uv[0];
-          m_mod_vtx_temp[vi].st[1] = m_mod_vtx_unpack_temp[addr].uv[1];
-        }
+    // sanity check
+    if (effect.mod.expect_vidx_end != vidx) {
+      fmt::print("---------- BAD {}/{}\n", effect.mod.expect_vidx_end, vidx);
+      ASSERT(false);
+    }
+  }
+
+  {
+    auto pp = scoped_prof("copy");
+    // now copy the data in merc original vertex order to the output.
+    for (u32 vi = 0; vi < effect.mod.vertices.size(); vi++) {
+      u32 addr = effect.mod.vertex_lump4_addr[vi];
+      if (addr < vidx) {
+        memcpy(&job->vertices[vi], &job->unpack_temp[addr], 32);
+        job->vertices[vi].st[0] = job->unpack_temp[addr].uv[0];
+        job->vertices[vi].st[1] = job->unpack_temp[addr].uv[1];
       }
     }
+  }
+}
+
+/*!
+ * Compute the vertices for all the mod/blerc effects queued since the last flush, then upload
+ * them. The jobs are independent, so they run on the thread pool and only the uploads happen
+ * here. The draws find their vertices through the job's first_vertex, which stays valid until the
+ * next flush.
+ */
+void Merc2::run_mod_vtx_jobs(MercDebugStats* stats) {
+  if (!m_num_mod_vtx_jobs) {
+    return;
+  }
+
+  {
+    auto p = scoped_prof("mod-vtx-jobs");
+    bool any_game_data = false;
+    for (u32 i = 0; i < m_num_mod_vtx_jobs; i++) {
+      any_game_data |= !m_mod_vtx_jobs[i].blerc;
+    }
 
-    // and upload to GPU
-    stats->num_uploads++;
-    stats->num_upload_bytes += effect.mod.vertices.size() * sizeof(tfrag3::MercVertex);
-    {
-      auto pp = scoped_prof("update-verts-upload");
-      glBindBuffer(GL_ARRAY_BUFFER, opengl_buffers.vertex);
-      glBufferData(GL_ARRAY_BUFFER, effect.mod.vertices.size() * sizeof(tfrag3::MercVertex),
-                   m_mod_vtx_temp.data(), GL_DYNAMIC_DRAW);
+    // we're going to look at data that the game may be modifying.
+    // in the original game, they didn't have any lock, but I think that the
+    // scratchpad access from the EE would effectively block the VIF1 DMA, so you'd
+    // hopefully never get a partially updated model (which causes obvious holes).
+    // taking it once for all jobs keeps the game's blerc_execute from interleaving with us.
+    std::unique_lock<std::mutex> lk(g_merc_data_mutex, std::defer_lock);
+    if (any_game_data) {
+      lk.lock();
     }
+
+    auto run_job = [&](int i) {
+      auto* job = &m_mod_vtx_jobs[i];
+      if (job->blerc) {
+        compute_blerc_vertices(job);
+      } else {
+        compute_mod_vertices(job);
+      }
+    };
+
+    if (m_threaded_mod_vtx && m_num_mod_vtx_jobs > 1) {
+      ThreadPool::global().parallel_for(m_num_mod_vtx_jobs, run_job);
+    } else {
+      for (u32 i = 0; i < m_num_mod_vtx_jobs; i++) {
+        run_job(i);
+      }
+    }
+  }
+
+  // and upload to GPU. This is one allocation for the whole flush: the stream may reuse space once
+  // it's allocated again, so all of the draws using it have to be issued first.
+  auto pp = scoped_prof("update-verts-upload");
+  u32 total_vertices = 0;
+  for (u32 i = 0; i < m_num_mod_vtx_jobs; i++) {
+    m_mod_vtx_jobs[i].first_vertex = total_vertices;
+    total_vertices += m_mod_vtx_jobs[i].vertices.size();
   }
+  const u32 total_bytes = total_vertices * sizeof(tfrag3::MercVertex);
+  if (total_bytes * 2 > m_mod_vtx_stream->size()) {
+    // keep room for a few flushes like this one.
+    init_mod_vtx_stream(std::max(m_mod_vtx_stream->size() * 2, total_bytes * 4));
+  }
+  const u32 offset = m_mod_vtx_stream->allocate(total_bytes, sizeof(tfrag3::MercVertex));
+  stats->num_uploads++;
+  stats->num_upload_bytes += total_bytes;
+  for (u32 i = 0; i < m_num_mod_vtx_jobs; i++) {
+    auto& job = m_mod_vtx_jobs[i];
+    m_mod_vtx_stream->write(offset + job.first_vertex * sizeof(tfrag3::MercVertex),
+                            job.vertices.data(), job.vertices.size() * sizeof(tfrag3::MercVertex));
+    job.first_vertex += offset / sizeof(tfrag3::MercVertex);
+  }
+  m_num_mod_vtx_jobs = 0;
+}
+
+/*!
+ * Get the loader's handle for a model name, from the cache if this frame is drawing the same models
+ * in the same order as the last.
+ */
+MercHandle Merc2::lookup_model(const char* name, SharedRenderState* render_state) {
+  if (m_model_cache_frame != render_state->frame_idx) {
+    m_model_cache_frame = render_state->frame_idx;
+    m_next_cached_model = 0;
+  }
+
+  if (m_next_cached_model == m_model_cache.size()) {
+    m_model_cache.emplace_back();
+    m_model_cache.back().handle = render_state->loader->get_merc_handle(name);
+    m_model_cache.back().name = name;
+  }
+  auto& cached = m_model_cache[m_next_cached_model++];
+  if (cached.name != name) {
+    cached.name = name;
+    cached.handle = render_state->loader->get_merc_handle(name);
+  }
+  return cached.handle;
 }
 
 /*!
@@ -421,7 +535,7 @@ void Merc2::handle_pc_model(const DmaTransfer& setup,
   // Look up the model by name in the loader.
   // This will return a reference to this model's data, plus a reference to the level's data
   // for stuff shared between models of the same level
-  auto model_ref = render_state->loader->get_merc_model(name);
+  auto model_ref = render_state->loader->get_merc_model(lookup_model(name, render_state));
   if (!model_ref) {
     // it can fail, if the game is faster than the loader. In this case, we just don't draw.
     stats->num_missing_models++;
@@ -571,12 +685,12 @@ void Merc2::handle_pc_model(const DmaTransfer& setup,
     num_effects = model->effects.size();
   }
 
-  // will hold opengl buffers for the updated vertices
-  ModBuffers mod_opengl_buffers[kMaxEffect];
+  // will hold the jobs that compute the updated vertices
+  u32 mod_vtx_jobs[kMaxEffect];
   if (model_uses_pc_blerc) {
-    model_mod_blerc_draws(num_effects, model, lev, mod_opengl_buffers, blerc_weights, stats);
+    model_mod_blerc_draws(num_effects, model, mod_vtx_jobs, blerc_weights, stats);
   } else if (model_uses_mod) {  // only if we've enabled, this path is slow.
-    model_mod_draws(num_effects, model, lev, input_data, setup, mod_opengl_buffers, stats);
+    model_mod_draws(num_effects, model, input_data, setup, mod_vtx_jobs, stats);
   }
 
   // stats
@@ -671,14 +785,14 @@ void Merc2::handle_pc_model(const DmaTransfer& setup,
       // do mod draws
       for (auto& mdraw : effect.mod.mod_draw) {
         auto n = alloc_normal_draw(mdraw, args);
-        // modify the draw, set the mod flag and point it to the opengl buffer
+        // modify the draw, set the mod flag and point it to the job for its vertices
         n->flags |= MOD_VTX;
-        n->mod_vtx_buffer = mod_opengl_buffers[ei];
+        n->mod_vtx_job = mod_vtx_jobs[ei];
         if (should_envmap) {
           auto e = try_alloc_envmap_draw(mdraw, effect.envmap_mode, effect.envmap_texture, args);
           if (e) {
             e->flags |= MOD_VTX;
-            e->mod_vtx_buffer = mod_opengl_buffers[ei];
+            e->mod_vtx_job = mod_vtx_jobs[ei];
           }
         }
       }
@@ -708,10 +822,14 @@ void Merc2::draw_debug_window(MercDebugStats* stats) {
 
   ImGui::Text("Uploads  : %d", stats->num_uploads);
   ImGui::Text("Upload kB: %d", stats->num_upload_bytes / 1024);
+  ImGui::Text("Instanced: %d draws, %d instances", stats->num_instanced_draws,
+              stats->num_instances);
 
   ImGui::Checkbox("Debug", &stats->collect_debug_model_list);
 
   ImGui::SliderFloat("blerc-nightmare", &blerc_multiplier, -3, 3);
+  ImGui::Checkbox("Threaded mod vertices", &m_threaded_mod_vtx);
+  ImGui::Checkbox("Instanced draws", &m_instancing);
 
   if (stats->collect_debug_model_list) {
     for (int i = 0; i < kMaxEffect; i++) {
@@ -756,6 +874,7 @@ void Merc2::init_shader_common(Shader& shader, Uniforms* uniforms, bool include_
   uniforms->ignore_alpha = glGetUniformLocation(id, "ignore_alpha");
 
   uniforms->gfx_hack_no_tex = glGetUniformLocation(id, "gfx_hack_no_tex");
+  uniforms->instance_base = glGetUniformLocation(id, "instance_base");
 }
 
 void Merc2::switch_to_merc2(SharedRenderState* render_state) {
@@ -1039,21 +1158,6 @@ u32 Merc2::alloc_bones(int count, ShaderMercMat* data) {
   return first_bone_vector;
 }
 
-Merc2::ModBuffers Merc2::alloc_mod_vtx_buffer(const LevelData* lev) {
-  if (m_next_mod_vtx_buffer >= m_mod_vtx_buffers.size()) {
-    GLuint b;
-    glGenBuffers(1, &b);
-    GLuint vao;
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, b);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lev->merc_indices);
-    setup_merc_vao();
-    m_mod_vtx_buffers.push_back({vao, b});
-  }
-  return m_mod_vtx_buffers[m_next_mod_vtx_buffer++];
-}
-
 Merc2::Draw* Merc2::try_alloc_envmap_draw(const tfrag3::MercDraw& mdraw,
                                           const DrawMode& envmap_mode,
                                           u32 envmap_texture,
@@ -1188,34 +1292,142 @@ void Merc2::flush_draw_buckets(SharedRenderState* render_state,
                                ScopedProfilerNode& prof,
                                MercDebugStats* stats) {
   stats->num_draw_flush++;
+  // the mod draws below use these vertices.
+  run_mod_vtx_jobs(stats);
+
+  const bool instancing = m_instancing && m_instancing_supported;
+  const u32 num_records = instancing ? build_instance_batches(stats) : 0;
+  const u32 num_light_vectors = num_records ? m_next_free_light * 8 : 0;
+
+  // all levels share the same bones, so they only need to be uploaded once.
+  stats->num_bones_uploaded += m_next_free_bone_vector;
+  m_bones_offset = m_bones_stream->allocate(
+      (m_next_free_bone_vector + num_light_vectors + num_records) * sizeof(math::Vector4f) +
+          128 * sizeof(ShaderMercMat),
+      m_opengl_buffer_alignment * sizeof(math::Vector4f));
+  m_bones_stream->write(m_bones_offset, m_shader_bone_vector_buffer,
+                        m_next_free_bone_vector * sizeof(math::Vector4f));
+
+  if (num_records) {
+    // lights, then instance records, after the bones. The records hold texel indices in the whole
+    // buffer, since that's what the texture buffer covers.
+    const u32 first_texel = m_bones_offset / sizeof(math::Vector4f);
+    const u32 first_light_texel = first_texel + m_next_free_bone_vector;
+    m_instance_base = first_light_texel + num_light_vectors;
+    m_instance_vectors.resize(num_light_vectors + num_records);
+    for (u32 i = 0; i < m_next_free_light; i++) {
+      const auto& lights = m_lights_buffer[i];
+      auto* out = &m_instance_vectors[i * 8];
+      const auto& dir0 = lights.direction0;
+      const auto& dir1 = lights.direction1;
+      const auto& dir2 = lights.direction2;
+      out[0] = math::Vector4f(dir0.x(), dir0.y(), dir0.z(), 1);
+      out[1] = math::Vector4f(dir1.x(), dir1.y(), dir1.z(), 0);
+      out[2] = math::Vector4f(dir2.x(), dir2.y(), dir2.z(), 0);
+      out[3] = lights.color0;
+      out[4] = lights.color1;
+      out[5] = lights.color2;
+      out[6] = lights.ambient;
+      out[7] = math::Vector4f::zero();
+    }
+    for (u32 i = 0; i < num_records; i++) {
+      const s32 texels[4] = {(s32)(first_texel + m_instance_records[i].first),
+                             (s32)(first_light_texel + m_instance_records[i].second * 8), 0, 0};
+      memcpy(&m_instance_vectors[num_light_vectors + i], texels, sizeof(texels));
+    }
+    m_bones_stream->write(m_bones_offset + m_next_free_bone_vector * sizeof(math::Vector4f),
+                          m_instance_vectors.data(),
+                          m_instance_vectors.size() * sizeof(math::Vector4f));
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_BUFFER, m_merc_data_texture);
+    glActiveTexture(GL_TEXTURE0);
+  }
+
   for (u32 li = 0; li < m_next_free_level_bucket; li++) {
-    const auto& lev_bucket = m_level_draw_buckets[li];
+    auto& lev_bucket = m_level_draw_buckets[li];
     const auto* lev = lev_bucket.level;
     glBindVertexArray(m_vao);
     glBindBuffer(GL_ARRAY_BUFFER, lev->merc_vertices);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lev->merc_indices);
     setup_merc_vao();
-    stats->num_bones_uploaded += m_next_free_bone_vector;
-
-    glBindBuffer(GL_UNIFORM_BUFFER, m_bones_buffer);
-    glBufferSubData(GL_UNIFORM_BUFFER, 0, m_next_free_bone_vector * sizeof(math::Vector4f),
-                    m_shader_bone_vector_buffer);
-    glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
     switch_to_merc2(render_state);
     do_draws(lev_bucket.draws.data(), lev, lev_bucket.next_free_draw, m_merc_uniforms, prof, false,
-             render_state);
+             render_state, num_records ? &lev_bucket : nullptr);
     if (lev_bucket.next_free_envmap_draw) {
       switch_to_emerc(render_state);
       do_draws(lev_bucket.envmap_draws.data(), lev, lev_bucket.next_free_envmap_draw,
-               m_emerc_uniforms, prof, true, render_state);
+               m_emerc_uniforms, prof, true, render_state, nullptr);
     }
   }
 
   m_next_free_light = 0;
   m_next_free_bone_vector = 0;
   m_next_free_level_bucket = 0;
-  m_next_mod_vtx_buffer = 0;
+}
+
+/*!
+ * Find the draws in each level bucket that can be drawn instanced, and add instance records for
+ * them. These are opaque draws that are the same apart from their bones and lights, which happens
+ * for each draw of a model with more than one copy on screen. Without blending, the order they're
+ * drawn in doesn't matter, so each batch is drawn in place of its first draw.
+ * Returns the number of instance records.
+ */
+u32 Merc2::build_instance_batches(MercDebugStats* stats) {
+  m_instance_records.clear();
+  auto same_draw = [](const Draw& a, const Draw& b) {
+    return a.first_index == b.first_index && a.index_count == b.index_count && a.mode == b.mode &&
+           a.texture == b.texture && a.flags == b.flags && a.no_strip == b.no_strip;
+  };
+
+  for (u32 li = 0; li < m_next_free_level_bucket; li++) {
+    auto& bucket = m_level_draw_buckets[li];
+    bucket.batches.clear();
+    bucket.draw_batch.assign(bucket.next_free_draw, -1);
+
+    // eye textures are looked up per draw, and lights with fade use two draws.
+    m_instance_sort.clear();
+    for (u32 di = 0; di < bucket.next_free_draw; di++) {
+      const auto& draw = bucket.draws[di];
+      if (!(draw.flags & MOD_VTX) && !draw.mode.get_ab_enable() &&
+          (draw.texture & 0xffffff00) != 0xefffff00 && !m_lights_buffer[draw.light_idx].w1) {
+        m_instance_sort.push_back(di);
+      }
+    }
+
+    // sort so the same draws are next to each other, in their original order.
+    const auto* draws = bucket.draws.data();
+    std::sort(m_instance_sort.begin(), m_instance_sort.end(), [&](u32 a, u32 b) {
+      const auto& da = draws[a];
+      const auto& db = draws[b];
+      return std::tie(da.first_index, da.index_count, da.mode.as_int(), da.texture, da.flags,
+                      da.no_strip, a) < std::tie(db.first_index, db.index_count, db.mode.as_int(),
+                                                 db.texture, db.flags, db.no_strip, b);
+    });
+
+    for (size_t i = 0; i < m_instance_sort.size();) {
+      size_t end = i + 1;
+      while (end < m_instance_sort.size() &&
+             same_draw(draws[m_instance_sort[i]], draws[m_instance_sort[end]])) {
+        end++;
+      }
+      if (end - i > 1) {
+        auto& batch = bucket.batches.emplace_back();
+        batch.first_record = m_instance_records.size();
+        batch.count = end - i;
+        batch.drawn = false;
+        for (size_t j = i; j < end; j++) {
+          const auto& draw = draws[m_instance_sort[j]];
+          bucket.draw_batch[m_instance_sort[j]] = bucket.batches.size() - 1;
+          m_instance_records.emplace_back(draw.first_bone, draw.light_idx);
+        }
+        stats->num_instanced_draws++;
+        stats->num_instances += batch.count;
+      }
+      i = end;
+    }
+  }
+  return m_instance_records.size();
 }
 
 void Merc2::do_draws(const Draw* draw_array,
@@ -1224,21 +1436,35 @@ void Merc2::do_draws(const Draw* draw_array,
                      const Uniforms& uniforms,
                      ScopedProfilerNode& prof,
                      bool set_fade,
-                     SharedRenderState* render_state) {
+                     SharedRenderState* render_state,
+                     LevelDrawBucket* instanced_bucket) {
   glBindVertexArray(m_vao);
   s32 last_tex = INT32_MIN;
   int last_light = -1;
   bool normal_vtx_buffer_bound = true;
 
   bool fog_on = true;
+  bool instance_base_set = false;
+  glUniform1i(uniforms.instance_base, -1);
 
   for (u32 di = 0; di < num_draws; di++) {
     auto& draw = draw_array[di];
+    InstanceBatch* batch = nullptr;
+    if (instanced_bucket && instanced_bucket->draw_batch[di] >= 0) {
+      batch = &instanced_bucket->batches[instanced_bucket->draw_batch[di]];
+      if (batch->drawn) {
+        continue;
+      }
+      batch->drawn = true;
+    }
+    GLint base_vertex = 0;
     if (draw.flags & MOD_VTX) {
-      glBindVertexArray(draw.mod_vtx_buffer.vao);
-      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lev->merc_indices);
-      glBindBuffer(GL_ARRAY_BUFFER, lev->merc_vertices);
-      normal_vtx_buffer_bound = false;
+      if (normal_vtx_buffer_bound) {
+        glBindVertexArray(m_mod_vtx_vao);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lev->merc_indices);
+        normal_vtx_buffer_bound = false;
+      }
+      base_vertex = m_mod_vtx_jobs[draw.mod_vtx_job].first_vertex;
     } else {
       if (!normal_vtx_buffer_bound) {
         glBindVertexArray(m_vao);
@@ -1288,7 +1514,11 @@ void Merc2::do_draws(const Draw* draw_array,
       last_tex = draw.texture;
     }
 
-    if ((int)draw.light_idx != last_light && !set_fade) {
+    if (batch) {
+      // lights come from the instance records. The fragment shader only needs fade off.
+      set_uniform(uniforms.light_direction[1], math::Vector4f::zero());
+      last_light = -1;
+    } else if ((int)draw.light_idx != last_light && !set_fade) {
       const auto& l0_dir = m_lights_buffer[draw.light_idx].direction0;
       const auto& l1_dir = m_lights_buffer[draw.light_idx].direction1;
       float fade = 1.f;
@@ -1327,32 +1557,50 @@ void Merc2::do_draws(const Draw* draw_array,
 
       prof.add_draw_call(2);
       prof.add_tri(draw.num_triangles * 2);
-      glBindBufferRange(GL_UNIFORM_BUFFER, 1, m_bones_buffer,
-                        sizeof(math::Vector4f) * draw.first_bone, 128 * sizeof(ShaderMercMat));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 1, m_bones_stream->buffer(),
+                        m_bones_offset + sizeof(math::Vector4f) * draw.first_bone,
+                        128 * sizeof(ShaderMercMat));
       // draw rgb
       const auto& l1_dir = m_lights_buffer[draw.light_idx].direction1;
       math::Vector4f l1_dir_f(l1_dir.x(), l1_dir.y(), l1_dir.z(), 1);
       set_uniform(uniforms.light_direction[1], l1_dir_f);
       glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
-      glDrawElements(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
-                     GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index));
+      glDrawElementsBaseVertex(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
+                               GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index),
+                               base_vertex);
       // draw a
       setup_opengl_from_draw_mode(draw.mode, GL_TEXTURE0, use_mipmaps_for_filtering);
       math::Vector4f l1_dir_f_off(l1_dir.x(), l1_dir.y(), l1_dir.z(), -1);
       set_uniform(uniforms.light_direction[1], l1_dir_f_off);
       glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_TRUE);
-      glDrawElements(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
-                     GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index));
+      glDrawElementsBaseVertex(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
+                               GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index),
+                               base_vertex);
       glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 
+    } else if (batch) {
+      setup_opengl_from_draw_mode(draw.mode, GL_TEXTURE0, use_mipmaps_for_filtering);
+      prof.add_draw_call();
+      prof.add_tri(draw.num_triangles * batch->count);
+      glUniform1i(uniforms.instance_base, m_instance_base + batch->first_record);
+      instance_base_set = true;
+      glDrawElementsInstanced(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
+                              GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index),
+                              batch->count);
     } else {
+      if (instance_base_set) {
+        glUniform1i(uniforms.instance_base, -1);
+        instance_base_set = false;
+      }
       setup_opengl_from_draw_mode(draw.mode, GL_TEXTURE0, use_mipmaps_for_filtering);
       prof.add_draw_call();
       prof.add_tri(draw.num_triangles);
-      glBindBufferRange(GL_UNIFORM_BUFFER, 1, m_bones_buffer,
-                        sizeof(math::Vector4f) * draw.first_bone, 128 * sizeof(ShaderMercMat));
-      glDrawElements(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
-                     GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 1, m_bones_stream->buffer(),
+                        m_bones_offset + sizeof(math::Vector4f) * draw.first_bone,
+                        128 * sizeof(ShaderMercMat));
+      glDrawElementsBaseVertex(draw.no_strip ? GL_TRIANGLES : GL_TRIANGLE_STRIP, draw.index_count,
+                               GL_UNSIGNED_INT, (void*)(sizeof(u32) * draw.first_index),
+                               base_vertex);
     }
   }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 
 struct MercDebugStats {
   int num_models = 0;
@@ -18,6 +19,9 @@ struct MercDebugStats {
   int num_upload_bytes = 0;
   int num_uploads = 0;
 
+  int num_instanced_draws = 0;
+  int num_instances = 0;
+
   struct DrawDebug {
     DrawMode mode;
     int num_tris;
@@ -84,11 +88,18 @@ class Merc2 {
                        SharedRenderState* render_state,
                        ScopedProfilerNode& prof,
                        MercDebugStats* stats);
+  MercHandle lookup_model(const char* name, SharedRenderState* render_state);
   u32 alloc_lights(const VuLights& lights);
 
-  struct ModBuffers {
-    GLuint vao, vertex;
+  // the models are drawn in about the same order every frame, so the model handles are cached by
+  // their position in the frame, and the name only has to be compared.
+  struct CachedModel {
+    std::string name;
+    MercHandle handle = 0;
   };
+  std::vector<CachedModel> m_model_cache;
+  u32 m_next_cached_model = 0;
+  u64 m_model_cache_frame = UINT64_MAX;
 
   static constexpr int kMaxEffect = 64;
   bool m_effect_debug_mask[kMaxEffect];
@@ -135,6 +146,8 @@ class Merc2 {
     GLuint gfx_hack_no_tex;
 
     GLuint fade;
+
+    GLuint instance_base;
   };
 
   Uniforms m_merc_uniforms, m_emerc_uniforms;
@@ -157,22 +170,44 @@ class Merc2 {
 
   void setup_merc_vao();
 
-  std::vector<ModBuffers> m_mod_vtx_buffers;
-  u32 m_next_mod_vtx_buffer = 0;
+  // the vertices of mod draws, for all the jobs of a flush. Drawn with a base vertex.
+  GLuint m_mod_vtx_vao;
+  std::unique_ptr<StreamingBuffer> m_mod_vtx_stream;
 
   static constexpr int MAX_MOD_VTX = UINT16_MAX;
-  std::vector<tfrag3::MercVertex> m_mod_vtx_temp;
 
   struct UnpackTempVtx {
     float pos[4];
     float nrm[4];
     float uv[2];
   };
-  std::vector<UnpackTempVtx> m_mod_vtx_unpack_temp;
 
-  ModBuffers alloc_mod_vtx_buffer(const LevelData* lev);
+  // vertex modification for one effect, queued while handling DMA and run at flush time.
+  struct ModVtxJob {
+    bool blerc = false;  // blerc weights, otherwise unpack the merc data from the game
+    const tfrag3::MercModel* model = nullptr;
+    int effect = 0;
+    u32 first_vertex = 0;  // in m_mod_vtx_stream, once uploaded
+    float blerc_weights[kMaxBlerc];
+    const u8* ee0 = nullptr;
+    u32 effect_goal_addr = 0;
+    // results. Kept between frames so the memory is reused.
+    std::vector<tfrag3::MercVertex> vertices;
+    std::vector<UnpackTempVtx> unpack_temp;
+  };
+  std::vector<ModVtxJob> m_mod_vtx_jobs;
+  u32 m_num_mod_vtx_jobs = 0;
+  bool m_threaded_mod_vtx = true;
 
-  GLuint m_bones_buffer;
+  u32 alloc_mod_vtx_job();
+  void init_mod_vtx_stream(u32 size);
+  static void compute_blerc_vertices(ModVtxJob* job);
+  static void compute_mod_vertices(ModVtxJob* job);
+  void run_mod_vtx_jobs(MercDebugStats* stats);
+
+  // skinning matrices for the draws being flushed, uploaded once per flush.
+  std::unique_ptr<StreamingBuffer> m_bones_stream;
+  u32 m_bones_offset = 0;
 
   enum DrawFlags {
     IGNORE_ALPHA = 1,
@@ -189,19 +224,30 @@ class Merc2 {
     u16 first_bone;
     u16 light_idx;
     u8 flags;
-    ModBuffers mod_vtx_buffer;
+    u32 mod_vtx_job;  // for MOD_VTX draws
     u8 fade[4];
     // no strip hack for custom models
     u8 no_strip;
     u64 hash;
   };
 
+  // draws of the same model that only differ in their bones and lights, drawn as one instanced
+  // draw. Each instance has a record in the bone buffer pointing to its bones and lights.
+  struct InstanceBatch {
+    u32 first_record;
+    u32 count;
+    bool drawn;
+  };
+
   struct LevelDrawBucket {
     const LevelData* level = nullptr;
     std::vector<Draw> draws;
     std::vector<Draw> envmap_draws;
     u32 next_free_draw = 0;
     u32 next_free_envmap_draw = 0;
+    // the batch of each draw, or -1 if it's drawn on its own. Set at flush time.
+    std::vector<s32> draw_batch;
+    std::vector<InstanceBatch> batches;
 
     void reset() {
       level = nullptr;
@@ -235,7 +281,20 @@ class Merc2 {
                 const Uniforms& uniforms,
                 ScopedProfilerNode& prof,
                 bool set_fade,
-                SharedRenderState* render_state);
+                SharedRenderState* render_state,
+                LevelDrawBucket* instanced_bucket);
+
+  bool m_instancing = true;
+  // instancing needs the bone buffer to fit in a texture buffer.
+  bool m_instancing_supported = false;
+  GLuint m_merc_data_texture = 0;
+  // bone vector and light index of each instance, for the batches being flushed.
+  std::vector<std::pair<u32, u32>> m_instance_records;
+  std::vector<u32> m_instance_sort;
+  std::vector<math::Vector4f> m_instance_vectors;
+  // texel of the first instance record in the bone buffer.
+  u32 m_instance_base = 0;
+  u32 build_instance_batches(MercDebugStats* stats);
 
   static constexpr int MAX_LIGHTS = 1024;
   VuLights m_lights_buffer[MAX_LIGHTS];
@@ -251,15 +310,13 @@ class Merc2 {
                           MercDebugStats* stats);
   void model_mod_draws(int num_effects,
                        const tfrag3::MercModel* model,
-                       const LevelData* lev,
                        const u8* input_data,
                        const DmaTransfer& setup,
-                       ModBuffers* mod_opengl_buffers,
+                       u32* mod_vtx_jobs,
                        MercDebugStats* stats);
   void model_mod_blerc_draws(int num_effects,
                              const tfrag3::MercModel* model,
-                             const LevelData* lev,
-                             ModBuffers* mod_opengl_buffers,
+                             u32* mod_vtx_jobs,
                              const float* blerc_weights,
                              MercDebugStats* stats);
 };
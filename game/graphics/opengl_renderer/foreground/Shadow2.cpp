@@ -54,6 +54,7 @@ void Shadow2::init_shaders(ShaderLibrary& shaders) {
 
 void Shadow2::draw_debug_window() {
   ImGui::Checkbox("volume", &m_debug_draw_volume);
+  ImGui::Checkbox("gpu facing", &m_gpu_facing);
 }
 
 void Shadow2::reset_buffers() {
@@ -260,6 +261,22 @@ u32* Shadow2::alloc_inds(int n, bool front) {
   }
 }
 
+/*!
+ * Allocate indices for a triangle, or a strip with the same winding as its first triangle. When the
+ * CPU does the facing test, this picks the increment or decrement pass by which side of the
+ * triangle the camera is on. Otherwise everything goes in one buffer and the rasterizer decides.
+ */
+u32* Shadow2::alloc_facing_inds(int n, const ShadowVertex* verts) {
+  if (m_gpu_facing) {
+    return alloc_inds(n, false);
+  }
+  const math::Vector3f v1_v0_rt_camera = verts[1].pos - verts[0].pos;
+  const math::Vector3f v2_v0_rt_camera = verts[2].pos - verts[0].pos;
+  const math::Vector3f tri_normal = v1_v0_rt_camera.cross(v2_v0_rt_camera);
+  const float normal_dot_eye = tri_normal.dot(verts[0].pos);
+  return alloc_inds(n, normal_dot_eye > 0);
+}
+
 const u8* Shadow2::add_cap_tris(const u8* byte_data, const u8* vertex_data, bool flip) {
   const int num_single_tris = *byte_data++;
   for (int i = 0; i < 3; i++) {
@@ -293,11 +310,7 @@ const u8* Shadow2::add_cap_tris(const u8* byte_data, const u8* vertex_data, bool
       }
     }
 
-    const math::Vector3f v1_v0_rt_camera = vertex_rt_camera[1].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f v2_v0_rt_camera = vertex_rt_camera[2].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f tri_normal = v1_v0_rt_camera.cross(v2_v0_rt_camera);
-    const float normal_dot_eye = tri_normal.dot(vertex_rt_camera[0].pos);
-    auto* idx_buffer = alloc_inds(4, normal_dot_eye > 0);
+    auto* idx_buffer = alloc_facing_inds(4, vertex_rt_camera);
     for (int j = 0; j < 3; j++) {
       idx_buffer[j] = opengl_vertex_idx + j;
     }
@@ -339,11 +352,7 @@ const u8* Shadow2::add_flippable_tris(const u8* byte_data, const u8* vertex_data
       }
     }
 
-    const math::Vector3f v1_v0_rt_camera = vertex_rt_camera[1].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f v2_v0_rt_camera = vertex_rt_camera[2].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f tri_normal = v1_v0_rt_camera.cross(v2_v0_rt_camera);
-    const float normal_dot_eye = tri_normal.dot(vertex_rt_camera[0].pos);
-    auto* idx_buffer = alloc_inds(4, normal_dot_eye > 0);
+    auto* idx_buffer = alloc_facing_inds(4, vertex_rt_camera);
     for (int j = 0; j < 3; j++) {
       idx_buffer[j] = opengl_vertex_idx + j;
     }
@@ -391,14 +400,12 @@ const u8* Shadow2::add_wall_quads(const u8* byte_data,
       memcpy(vertex_rt_camera[3].pos.data(), vertex_data_1 + 16 * vertex_addrs[0], 12);
     }
 
-    const math::Vector3f v1_v0_rt_camera = vertex_rt_camera[1].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f v2_v0_rt_camera = vertex_rt_camera[2].pos - vertex_rt_camera[0].pos;
-    const math::Vector3f tri_normal = v1_v0_rt_camera.cross(v2_v0_rt_camera);
-    const float normal_dot_eye = tri_normal.dot(vertex_rt_camera[0].pos);
-    auto* idx_buffer = alloc_inds(5, normal_dot_eye > 0);
+    // strip order is picked so both triangles have the same winding as 0, 1, 2, which is what the
+    // facing test uses. The rasterizer relies on this when it picks the stencil op.
+    auto* idx_buffer = alloc_facing_inds(5, vertex_rt_camera);
     idx_buffer[0] = opengl_vertex_idx + 1;
-    idx_buffer[1] = opengl_vertex_idx + 0;
-    idx_buffer[2] = opengl_vertex_idx + 2;
+    idx_buffer[1] = opengl_vertex_idx + 2;
+    idx_buffer[2] = opengl_vertex_idx + 0;
     idx_buffer[3] = opengl_vertex_idx + 3;
     idx_buffer[4] = UINT32_MAX;
   }
@@ -470,6 +477,65 @@ void Shadow2::draw_buffers(SharedRenderState* render_state,
     glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);  // no color writes.
   }
 
+  if (m_gpu_facing) {
+    draw_volume_single_pass(prof, constants);
+  } else {
+    draw_volume_two_pass(prof);
+  }
+
+  // finally, draw shadow.
+  glUniform1i(m_ogl.uniforms.clear_mode, 1);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer[0]);
+  glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
+  glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+  glDepthFunc(GL_ALWAYS);
+
+  glEnable(GL_BLEND);
+  glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ONE, GL_ZERO);
+
+  bool have_darken = false;
+  bool have_lighten = false;
+  bool lighten_channel[3] = {false, false, false};
+  bool darken_channel[3] = {false, false, false};
+  for (int i = 0; i < 3; i++) {
+    if (m_color[i] > 128) {
+      have_lighten = true;
+      lighten_channel[i] = true;
+    } else if (m_color[i] < 128) {
+      have_darken = true;
+      darken_channel[i] = true;
+    }
+  }
+
+  if (have_darken) {
+    glColorMask(darken_channel[0], darken_channel[1], darken_channel[2], false);
+    glUniform4f(m_ogl.uniforms.color, (m_color[3] - m_color[0]) / 256.f,
+                (m_color[3] - m_color[1]) / 256.f, (m_color[3] - m_color[2]) / 256.f, 0);
+    glBlendEquation(GL_FUNC_REVERSE_SUBTRACT);
+    glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT,
+                   (void*)(sizeof(u32) * (m_front_index_buffer_used - 6)));
+  }
+
+  if (have_lighten) {
+    glColorMask(lighten_channel[0], lighten_channel[1], lighten_channel[2], false);
+    glUniform4f(m_ogl.uniforms.color, (m_color[0] - m_color[3]) / 256.f,
+                (m_color[1] - m_color[3]) / 256.f, (m_color[2] - m_color[3]) / 256.f, 0);
+    glBlendEquation(GL_FUNC_ADD);
+    glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT,
+                   (void*)(sizeof(u32) * (m_front_index_buffer_used - 6)));
+  }
+
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+  prof.add_draw_call();
+  prof.add_tri(2);
+  glBlendEquation(GL_FUNC_ADD);
+  glDepthMask(GL_TRUE);
+
+  glDisable(GL_STENCIL_TEST);
+}
+
+void Shadow2::draw_volume_two_pass(ScopedProfilerNode& prof) {
   // First pass.
   // here, we don't write depth or color.
   // but we increment stencil on depth fail.
@@ -524,55 +590,47 @@ void Shadow2::draw_buffers(SharedRenderState* render_state,
     prof.add_draw_call();
     prof.add_tri(m_back_index_buffer_used / 3);
   }
+}
 
-  // finally, draw shadow.
-  glUniform1i(m_ogl.uniforms.clear_mode, 1);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer[0]);
-  glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
-  glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
-  glDepthFunc(GL_ALWAYS);
-
-  glEnable(GL_BLEND);
-  glBlendFuncSeparate(GL_ONE, GL_ONE, GL_ONE, GL_ZERO);
-
-  bool have_darken = false;
-  bool have_lighten = false;
-  bool lighten_channel[3] = {false, false, false};
-  bool darken_channel[3] = {false, false, false};
-  for (int i = 0; i < 3; i++) {
-    if (m_color[i] > 128) {
-      have_lighten = true;
-      lighten_channel[i] = true;
-    } else if (m_color[i] < 128) {
-      have_darken = true;
-      darken_channel[i] = true;
-    }
-  }
-
-  if (have_darken) {
-    glColorMask(darken_channel[0], darken_channel[1], darken_channel[2], false);
-    glUniform4f(m_ogl.uniforms.color, (m_color[3] - m_color[0]) / 256.f,
-                (m_color[3] - m_color[1]) / 256.f, (m_color[3] - m_color[2]) / 256.f, 0);
-    glBlendEquation(GL_FUNC_REVERSE_SUBTRACT);
-    glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT,
-                   (void*)(sizeof(u32) * (m_front_index_buffer_used - 6)));
-  }
-
-  if (have_lighten) {
-    glColorMask(lighten_channel[0], lighten_channel[1], lighten_channel[2], false);
-    glUniform4f(m_ogl.uniforms.color, (m_color[0] - m_color[3]) / 256.f,
-                (m_color[1] - m_color[3]) / 256.f, (m_color[2] - m_color[3]) / 256.f, 0);
-    glBlendEquation(GL_FUNC_ADD);
-    glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT,
-                   (void*)(sizeof(u32) * (m_front_index_buffer_used - 6)));
-  }
-
-  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+/*!
+ * Facing of a camera-relative triangle on screen is the sign of normal.dot(v0) times the sign of
+ * the determinant of the x, y, w rows of the perspective transform. The rest of the shader's
+ * transform doesn't change it: it negates x, y and w, then flips y again.
+ */
+bool Shadow2::ccw_faces_away(const FrameConstants& constants) const {
+  const auto& m = constants.camera.v;
+  auto at = [&](int row, int col) { return m[col][row]; };
+  const float det = at(0, 0) * (at(1, 1) * at(3, 2) - at(3, 1) * at(1, 2)) -
+                    at(0, 1) * (at(1, 0) * at(3, 2) - at(3, 0) * at(1, 2)) +
+                    at(0, 2) * (at(1, 0) * at(3, 1) - at(3, 0) * at(1, 1));
+  return det > 0;
+}
 
+void Shadow2::draw_volume_single_pass(ScopedProfilerNode& prof, const FrameConstants& constants) {
+  // One draw for the whole volume. The rasterizer picks the stencil op by facing, so GL_FRONT is
+  // set up to mean "facing away from the camera", which decrements. The wrapping ops make the
+  // result independent of draw order.
+  glFrontFace(ccw_faces_away(constants) ? GL_CCW : GL_CW);
+  glUniform4f(m_ogl.uniforms.color, 0., 0.4, 0., 0.5);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer[0]);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_front_index_buffer_used * sizeof(u32),
+               m_front_index_buffer.data(), GL_STREAM_DRAW);
+  glStencilFunc(GL_ALWAYS, 0, 0);
+  glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_KEEP, GL_DECR_WRAP);
+  glStencilOpSeparate(GL_BACK, GL_KEEP, GL_KEEP, GL_INCR_WRAP);
+  glDrawElements(GL_TRIANGLE_STRIP, (m_front_index_buffer_used - 6), GL_UNSIGNED_INT, nullptr);
   prof.add_draw_call();
-  prof.add_tri(2);
-  glBlendEquation(GL_FUNC_ADD);
-  glDepthMask(GL_TRUE);
+  prof.add_tri(m_front_index_buffer_used / 3);
 
-  glDisable(GL_STENCIL_TEST);
+  if (m_debug_draw_volume) {
+    glDisable(GL_BLEND);
+    glUniform4f(m_ogl.uniforms.color, 0., 0.0, 0., 0.5);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+    glDrawElements(GL_TRIANGLE_STRIP, (m_front_index_buffer_used - 6), GL_UNSIGNED_INT, nullptr);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glEnable(GL_BLEND);
+    prof.add_draw_call();
+    prof.add_tri(m_front_index_buffer_used / 3);
+  }
+  glFrontFace(GL_CCW);
 }
@@ -80,6 +80,9 @@ class Shadow2 : public BucketRenderer {
   size_t m_front_index_buffer_used = 0;
   size_t m_back_index_buffer_used = 0;
   bool m_debug_draw_volume = false;
+  // let the rasterizer sort volume triangles into increment/decrement by facing, instead of a
+  // cross product per triangle on the CPU and two draws.
+  bool m_gpu_facing = true;
 
   void reset_buffers();
   void buffer_from_mscal2(const InputData& input);
@@ -90,8 +93,12 @@ class Shadow2 : public BucketRenderer {
   const u8* add_flippable_tris(const u8* byte_data, const u8* vertex_data, bool flip);
   ShadowVertex* alloc_verts(int n);
   u32* alloc_inds(int n, bool front);
+  u32* alloc_facing_inds(int n, const ShadowVertex* verts);
   void draw_buffers(SharedRenderState* render_state,
                     ScopedProfilerNode& prof,
                     const FrameConstants& constants);
+  void draw_volume_two_pass(ScopedProfilerNode& prof);
+  void draw_volume_single_pass(ScopedProfilerNode& prof, const FrameConstants& constants);
+  bool ccw_faces_away(const FrameConstants& constants) const;
   u8 m_color[4] = {0, 0, 0, 0};
 };
@@ -1,27 +1,144 @@
 #include "Loader.h"
 
+#include <tuple>
+
+#include "common/custom_data/Fr3File.h"
 #include "common/global_profiler/GlobalProfiler.h"
+#include "common/global_profiler/Telemetry.h"
+#include "common/log/log.h"
 #include "common/util/FileUtil.h"
 #include "common/util/Timer.h"
-#include "common/util/compress.h"
+#include "common/util/json_util.h"
 
 #include "game/graphics/opengl_renderer/loader/LoaderStages.h"
 
 #include "third-party/imgui/imgui.h"
 
-Loader::Loader(const fs::path& base_path, int max_levels)
-    : m_base_path(base_path), m_max_levels(max_levels) {
+namespace {
+/*!
+ * Read a level from an fr3 file, then "unpack" it, which creates the vertex data we'll upload to
+ * the GPU. This is slow, and only the loader thread should do it.
+ */
+std::unique_ptr<tfrag3::Level> read_level(const fs::path& path) {
+  // load the fr3 file. It's read, decompressed and deserialized into the tfrag3::Level
+  // structure in chunks, so the whole file is never in memory.
+  prof().begin_event("read-file");
+  Timer import_timer;
+  auto result = std::make_unique<tfrag3::Level>();
+  tfrag3::read_fr3_file(path, *result);
+  double import_time = import_timer.getSeconds();
+  prof().end_event();
+
+  Timer unpack_timer;
+  {
+    auto p = scoped_prof("tie-unpack");
+    for (auto& tie_tree : result->tie_trees) {
+      for (auto& tree : tie_tree) {
+        tree.unpack();
+      }
+    }
+  }
+
+  {
+    auto p = scoped_prof("tfrag-unpack");
+    for (auto& t_tree : result->tfrag_trees) {
+      for (auto& tree : t_tree) {
+        tree.unpack(true);
+      }
+    }
+  }
+
+  {
+    auto p = scoped_prof("shrub-unpack");
+    for (auto& shrub_tree : result->shrub_trees) {
+      shrub_tree.unpack();
+    }
+  }
+
+  fmt::print("------------> Load from file: {:.3f}s, unpack {:.3f}s\n", import_time,
+             unpack_timer.getSeconds());
+  return result;
+}
+
+/*!
+ * Estimate the GPU memory a loaded level uses, from the sizes of its uploads. Drivers add padding
+ * and may keep a copy, so this is a lower bound.
+ */
+size_t level_gpu_bytes(const LevelData& lev) {
+  const auto& level = *lev.level;
+  size_t total = 0;
+  auto texture_bytes = [](const tfrag3::Texture& tex) -> size_t {
+    // uncompressed textures get a mip chain, which is a third of the base level.
+    return tex.is_compressed() ? tex.compressed_data.size() : size_t(tex.w) * tex.h * 4 * 4 / 3;
+  };
+  for (size_t i = 0; i < level.textures.size(); i++) {
+    total += texture_bytes(level.textures[i]);
+    if (i < lev.texture_base_levels.size()) {
+      // the streamed mips are added as they are uploaded.
+      total -= compressed_mip_offset(level.textures[i], lev.texture_base_levels[i]);
+    }
+    if (i < lev.texture_array_slots.size() && lev.texture_array_slots[i].array >= 0) {
+      total += texture_bytes(level.textures[i]);
+    }
+  }
+  for (const auto& geo : level.tfrag_trees) {
+    for (const auto& tree : geo) {
+      total += tree.unpacked.gpu_vertices.size() * sizeof(tfrag3::TfragGpuVertex);
+    }
+  }
+  for (const auto& geo : level.tie_trees) {
+    for (const auto& tree : geo) {
+      total += tree.unpacked.vertices.size() * sizeof(tfrag3::PreloadedVertex);
+      total += tree.unpacked.indices.size() * sizeof(u32);
+      for (const auto& draw : tree.instanced_wind_draws) {
+        total += draw.vertex_index_stream.size() * sizeof(u32);
+      }
+    }
+  }
+  for (const auto& tree : level.shrub_trees) {
+    total += tree.unpacked.vertices.size() * sizeof(tfrag3::ShrubGpuVertex);
+  }
+  total += level.collision.vertices.size() * sizeof(tfrag3::CollisionMesh::Vertex);
+  total += level.merc_data.vertices.size() * sizeof(tfrag3::MercVertex);
+  total += level.merc_data.indices.size() * sizeof(u32);
+  total += level.hfrag.vertices.size() * sizeof(tfrag3::HfragmentVertex);
+  total += level.hfrag.indices.size() * sizeof(u32);
+  return total;
+}
+
+size_t level_memory_usage(const tfrag3::Level& level) {
+  tfrag3::MemoryUsageTracker tracker;
+  level.memory_usage(&tracker);
+  size_t total = 0;
+  for (auto bytes : tracker.data) {
+    total += bytes;
+  }
+  return total;
+}
+}  // namespace
+
+Loader::Loader(const fs::path& base_path,
+               int max_levels,
+               const fs::path& adjacency_file,
+               size_t prefetch_budget)
+    : m_base_path(base_path),
+      m_max_levels(max_levels),
+      m_adjacency_file(adjacency_file),
+      m_prefetch_budget(prefetch_budget) {
+  load_adjacency();
   m_loader_thread = std::thread(&Loader::loader_thread, this);
   m_loader_stages = make_loader_stages();
 }
 
 Loader::~Loader() {
+  stop_upload_thread();
   {
     std::lock_guard<std::mutex> lk(m_loader_mutex);
     m_want_shutdown = true;
     m_loader_cv.notify_all();
   }
   m_loader_thread.join();
+  save_adjacency();
 }
 
 /*!
@@ -49,6 +166,99 @@ void Loader::debug_print_loaded_levels() {
   }
 }
 
+void Loader::set_gpu_budget(size_t bytes) {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  m_gpu_budget = bytes;
+}
+
+void Loader::set_texture_streaming(bool enable) {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  m_stream_textures = enable;
+}
+
+void Loader::set_tfrag_texture_arrays(bool enable) {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  m_tfrag_texture_arrays = enable;
+}
+
+/*!
+ * Upload the next mip of the streamed textures of the levels in use, until the upload budget runs
+ * out. The textures that are the furthest from their full size go first, so a level sharpens
+ * evenly. Mips that would go over the GPU memory budget aren't uploaded, those textures stay
+ * blurry.
+ */
+void Loader::stream_texture_mips(UploadBudget& budget) {
+  u8 max_base_level = 0;
+  for (const auto& [_, lev] : m_loaded_tfrag3_levels) {
+    if (lev->frames_since_last_used == 0) {
+      for (auto base_level : lev->texture_base_levels) {
+        max_base_level = std::max(max_base_level, base_level);
+      }
+    }
+  }
+  if (max_base_level == 0) {
+    return;
+  }
+
+  auto evt = scoped_prof("stream-textures");
+  for (auto& [_, lev] : m_loaded_tfrag3_levels) {
+    if (lev->frames_since_last_used != 0) {
+      continue;
+    }
+    for (size_t i = 0; i < lev->texture_base_levels.size(); i++) {
+      auto& base_level = lev->texture_base_levels[i];
+      if (base_level != max_base_level) {
+        continue;
+      }
+      const auto& tex = lev->level->textures[i];
+      const size_t size = compressed_mip_offset(tex, base_level) -
+                          compressed_mip_offset(tex, base_level - 1);
+      if (m_gpu_budget && m_loaded_gpu_bytes + size > m_gpu_budget) {
+        return;
+      }
+      upload_next_texture_mip(lev->textures[i], tex, base_level);
+      base_level--;
+      lev->gpu_bytes += size;
+      m_loaded_gpu_bytes += size;
+      budget.uploaded(size);
+      if (budget.exhausted()) {
+        return;
+      }
+    }
+  }
+}
+
+/*!
+ * Move a level that is done loading to the loaded levels. Must hold the loader mutex.
+ */
+void Loader::add_loaded_level(const std::string& name, std::unique_ptr<LevelData> lev) {
+  lev->gpu_bytes = level_gpu_bytes(*lev);
+  m_loaded_gpu_bytes += lev->gpu_bytes;
+  if (m_gpu_budget && m_loaded_gpu_bytes > m_gpu_budget) {
+    lg::info("Loaded levels use {:.1f} MB of GPU memory, over the {:.1f} MB budget",
+             m_loaded_gpu_bytes / (1024.f * 1024.f), m_gpu_budget / (1024.f * 1024.f));
+  }
+  m_loaded_tfrag3_levels[name] = std::move(lev);
+}
+
+/*!
+ * Should we unload a level? We keep a slot free for the next level, and stay under the GPU memory
+ * budget if there is one.
+ */
+bool Loader::should_unload() const {
+  return (int)m_loaded_tfrag3_levels.size() >= m_max_levels ||
+         (m_gpu_budget && m_loaded_gpu_bytes > m_gpu_budget);
+}
+
+std::vector<std::string> Loader::loaded_level_names() {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  std::vector<std::string> result;
+  for (const auto& [name, _] : m_loaded_tfrag3_levels) {
+    result.push_back(name);
+  }
+  return result;
+}
+
 /*!
  * The game calls this to give the loader a hint on which levels we want.
  * If the loader is not busy, it will begin loading the level.
@@ -56,30 +266,138 @@ void Loader::debug_print_loaded_levels() {
  */
 void Loader::set_want_levels(const std::vector<std::string>& levels) {
   std::unique_lock<std::mutex> lk(m_loader_mutex);
+  record_level_transitions(levels);
   m_desired_levels = levels;
-  if (!m_level_to_load.empty()) {
-    // can't do anything, we're loading a level right now
-    return;
+
+  // we can't start a load while loading or initializing a level.
+  if (m_level_to_load.empty() && m_initializing_tfrag3_levels.empty()) {
+    // loader isn't busy, try to load one of the requested levels.
+    for (auto& lev : levels) {
+      if (m_loaded_tfrag3_levels.find(lev) != m_loaded_tfrag3_levels.end()) {
+        continue;
+      }
+      auto prefetched = m_prefetched_levels.find(lev);
+      if (prefetched != m_prefetched_levels.end()) {
+        // already read, we can go straight to initializing.
+        m_initializing_tfrag3_levels[lev] = std::make_unique<LevelData>();
+        m_initializing_tfrag3_levels[lev]->level = std::move(prefetched->second.level);
+        m_prefetched_bytes -= prefetched->second.bytes;
+        m_prefetched_levels.erase(prefetched);
+        m_upload_cv.notify_all();
+      } else {
+        // we haven't loaded it yet. Request this level to load.
+        m_level_to_load = lev;
+      }
+      break;
+    }
   }
 
-  if (!m_initializing_tfrag3_levels.empty()) {
-    // can't do anything, we're initializing a level right now
+  update_prefetch(levels);
+  lk.unlock();
+  m_loader_cv.notify_all();
+}
+
+/*!
+ * Remember the levels that were wanted along with a newly wanted level: those are the levels we
+ * came from, and the ones we'll probably want when going back. Must hold the loader mutex.
+ */
+void Loader::record_level_transitions(const std::vector<std::string>& levels) {
+  for (auto& lev : levels) {
+    if (std::find(m_desired_levels.begin(), m_desired_levels.end(), lev) !=
+        m_desired_levels.end()) {
+      continue;
+    }
+    for (auto& prev : m_desired_levels) {
+      if (prev == lev) {
+        continue;
+      }
+      m_adjacency_changed |= m_level_adjacency[prev].insert(lev).second;
+      m_adjacency_changed |= m_level_adjacency[lev].insert(prev).second;
+    }
+  }
+}
+
+/*!
+ * Pick a level for the loader thread to read ahead, from the levels next to the wanted ones, and
+ * drop prefetched levels that we've moved away from. The budget is checked before starting a
+ * prefetch, so it may be exceeded by the last level read. Must hold the loader mutex.
+ */
+void Loader::update_prefetch(const std::vector<std::string>& levels) {
+  if (m_prefetch_budget == 0) {
     return;
   }
 
-  // loader isn't busy, try to load one of the requested levels.
+  auto contains = [](const std::vector<std::string>& list, const std::string& name) {
+    return std::find(list.begin(), list.end(), name) != list.end();
+  };
+
+  std::vector<std::string> candidates;
   for (auto& lev : levels) {
-    auto it = m_loaded_tfrag3_levels.find(lev);
-    if (it == m_loaded_tfrag3_levels.end()) {
-      // we haven't loaded it yet. Request this level to load and wake up the thread.
-      m_level_to_load = lev;
-      lk.unlock();
-      m_loader_cv.notify_all();
-      return;
+    auto it = m_level_adjacency.find(lev);
+    if (it == m_level_adjacency.end()) {
+      continue;
+    }
+    for (auto& next : it->second) {
+      if (!contains(levels, next) && !contains(candidates, next)) {
+        candidates.push_back(next);
+      }
+    }
+  }
+
+  for (auto it = m_prefetched_levels.begin(); it != m_prefetched_levels.end();) {
+    if (!contains(levels, it->first) && !contains(candidates, it->first)) {
+      m_prefetched_bytes -= it->second.bytes;
+      it = m_prefetched_levels.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  if (!m_level_to_prefetch.empty() || m_prefetched_bytes >= m_prefetch_budget) {
+    return;
+  }
+
+  for (auto& lev : candidates) {
+    if (m_loaded_tfrag3_levels.count(lev) || m_initializing_tfrag3_levels.count(lev) ||
+        m_prefetched_levels.count(lev) || m_level_to_load == lev) {
+      continue;
     }
+    m_level_to_prefetch = lev;
+    return;
+  }
+}
+
+void Loader::load_adjacency() {
+  if (m_adjacency_file.empty() || !fs::exists(m_adjacency_file)) {
+    return;
+  }
+  try {
+    auto json = parse_commented_json(file_util::read_text_file(m_adjacency_file),
+                                     m_adjacency_file.string());
+    m_level_adjacency = json.get<std::map<std::string, std::set<std::string>>>();
+  } catch (std::exception& e) {
+    fmt::print("Failed to read level adjacency from {}: {}\n", m_adjacency_file.string(),
+               e.what());
   }
 }
 
+void Loader::save_adjacency() {
+  if (m_adjacency_file.empty() || !m_adjacency_changed) {
+    return;
+  }
+  file_util::create_dir_if_needed_for_file(m_adjacency_file);
+  nlohmann::json json = m_level_adjacency;
+  file_util::write_text_file(m_adjacency_file, json.dump(2));
+}
+
+/*!
+ * The levels from the most recent set_want_levels.
+ */
+std::vector<std::string> Loader::get_want_levels() {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  return m_desired_levels;
+}
+
 /*!
  * The game calls this to tell the loader that we absolutely want these levels active.
  * This will NOT trigger a load!
@@ -138,6 +456,27 @@ void Loader::draw_debug_window() {
     ImGui::Separator();
   }
 
+  if (!m_prefetched_levels.empty()) {
+    ImGui::Text("prefetched levels (%.1f MB)", m_prefetched_bytes / (1024.f * 1024.f));
+    for (auto& lev : m_prefetched_levels) {
+      ImGui::TextColored(blue, "%s", lev.first.c_str());
+      ImGui::SameLine();
+    }
+    ImGui::NewLine();
+    ImGui::Separator();
+  }
+
+  if (m_gpu_budget) {
+    ImGui::TextColored(m_loaded_gpu_bytes > m_gpu_budget ? red : green,
+                       "GPU memory: %.1f of %.1f MB", m_loaded_gpu_bytes / (1024.f * 1024.f),
+                       m_gpu_budget / (1024.f * 1024.f));
+  } else {
+    ImGui::Text("GPU memory: %.1f MB", m_loaded_gpu_bytes / (1024.f * 1024.f));
+  }
+  if (m_gpu_garbage.pending()) {
+    ImGui::Text("waiting to delete %d GPU objects", (int)m_gpu_garbage.pending());
+  }
+
   if (!m_loaded_tfrag3_levels.empty()) {
     ImGui::Text("loaded levels");
     for (auto& lev : m_loaded_tfrag3_levels) {
@@ -152,6 +491,7 @@ void Loader::draw_debug_window() {
                          lev.second->frames_since_last_used);
       ImGui::Text("  %d textures", (int)lev.second->textures.size());
       ImGui::Text("  %d merc", (int)lev.second->merc_model_lookup.size());
+      ImGui::Text("  %.1f MB GPU", lev.second->gpu_bytes / (1024.f * 1024.f));
     }
     ImGui::NewLine();
     ImGui::Separator();
@@ -171,79 +511,63 @@ void Loader::loader_thread() {
       std::unique_lock<std::mutex> lk(m_loader_mutex);
 
       // this will keep us asleep until we've got a level to load.
-      m_loader_cv.wait(lk, [&] { return !m_level_to_load.empty() || m_want_shutdown; });
+      m_loader_cv.wait(lk, [&] {
+        return !m_level_to_load.empty() || !m_level_to_prefetch.empty() || m_want_shutdown;
+      });
       if (m_want_shutdown) {
         return;
       }
-      std::string lev = m_level_to_load;
+
+      // a level the game wants always goes first.
+      const bool prefetch = m_level_to_load.empty();
+      std::string lev = prefetch ? m_level_to_prefetch : m_level_to_load;
+      if (!prefetch && m_level_to_prefetch == lev) {
+        m_level_to_prefetch = "";
+      }
       // don't hold the lock while reading the file.
       lk.unlock();
 
       // simulate slower hard drive (so that the loader thread can lose to the game loads)
       // std::this_thread::sleep_for(std::chrono::milliseconds(1500));
 
-      // load the fr3 file
-      prof().begin_event("read-file");
-      Timer disk_timer;
-      auto data = file_util::read_binary_file(m_base_path / fmt::format("{}.fr3", lev));
-      double disk_load_time = disk_timer.getSeconds();
-      prof().end_event();
-
-      // the FR3 files are compressed
-      prof().begin_event("decompress-file");
-      Timer decomp_timer;
-      auto decomp_data = compression::decompress_zstd(data.data(), data.size());
-      double decomp_time = decomp_timer.getSeconds();
-      prof().end_event();
-
-      // Read back into the tfrag3::Level structure
-      prof().begin_event("deserialize");
-      Timer import_timer;
-      auto result = std::make_unique<tfrag3::Level>();
-      Serializer ser(decomp_data.data(), decomp_data.size());
-      result->serialize(ser);
-      double import_time = import_timer.getSeconds();
-      prof().end_event();
-
-      // and finally "unpack", which creates the vertex data we'll upload to the GPU
-
-      Timer unpack_timer;
-      {
-        auto p = scoped_prof("tie-unpack");
-        for (auto& tie_tree : result->tie_trees) {
-          for (auto& tree : tie_tree) {
-            tree.unpack();
+      std::unique_ptr<tfrag3::Level> result;
+      if (prefetch) {
+        try {
+          result = read_level(m_base_path / fmt::format("{}.fr3", lev));
+        } catch (std::exception& e) {
+          // a bad guess shouldn't take down the game, just stop guessing this level.
+          fmt::print("Failed to prefetch level {}: {}\n", lev, e.what());
+          lk.lock();
+          m_level_to_prefetch = "";
+          m_level_adjacency.erase(lev);
+          for (auto& [_, next] : m_level_adjacency) {
+            next.erase(lev);
           }
+          m_adjacency_changed = true;
+          continue;
         }
+      } else {
+        result = read_level(m_base_path / fmt::format("{}.fr3", lev));
       }
-
-      {
-        auto p = scoped_prof("tfrag-unpack");
-        for (auto& t_tree : result->tfrag_trees) {
-          for (auto& tree : t_tree) {
-            tree.unpack();
-          }
-        }
-      }
-
-      {
-        auto p = scoped_prof("shrub-unpack");
-        for (auto& shrub_tree : result->shrub_trees) {
-          shrub_tree.unpack();
-        }
-      }
-
-      fmt::print(
-          "------------> Load from file: {:.3f}s, import {:.3f}s, decomp {:.3f}s unpack {:.3f}s\n",
-          disk_load_time, import_time, decomp_time, unpack_timer.getSeconds());
+      const size_t bytes = prefetch ? level_memory_usage(*result) : 0;
 
       // grab the lock again
       lk.lock();
+      if (prefetch) {
+        m_level_to_prefetch = "";
+        if (m_level_to_load != lev) {
+          m_prefetched_bytes += bytes;
+          m_prefetched_levels[lev] = {std::move(result), bytes};
+          continue;
+        }
+        // the game asked for this level while we were reading it, finish it like a normal load.
+      }
       // move this level to "initializing" state.
       m_initializing_tfrag3_levels[lev] = std::make_unique<LevelData>();  // reset load state
       m_initializing_tfrag3_levels[lev]->level = std::move(result);
       m_level_to_load = "";
       m_file_load_done_cv.notify_all();
+      m_upload_cv.notify_all();
     }
   } catch (std::exception& e) {
     ASSERT_MSG(false, fmt::format("Exception {} encountered in loader_thread", e.what()));
@@ -254,26 +578,39 @@ void Loader::loader_thread() {
  * Load a "common" FR3 file that has non-level textures.
  * This should be called during initialization, before any threaded loading goes on.
  */
-const tfrag3::Level& Loader::load_common(TexturePool& tex_pool, const std::string& name) {
-  auto data = file_util::read_binary_file(m_base_path / fmt::format("{}.fr3", name));
+void Loader::start_reading_common(const std::string& name) {
+  m_common_read_name = name;
+  m_common_read =
+      std::async(std::launch::async, [path = m_base_path / fmt::format("{}.fr3", name)] {
+        auto p = scoped_prof("startup::read_common_fr3");
+        auto level = std::make_unique<tfrag3::Level>();
+        tfrag3::read_fr3_file(path, *level);
+        return level;
+      });
+}
 
-  auto decomp_data = compression::decompress_zstd(data.data(), data.size());
-  Serializer ser(decomp_data.data(), decomp_data.size());
-  m_common_level.level = std::make_unique<tfrag3::Level>();
-  m_common_level.level->serialize(ser);
+const tfrag3::Level& Loader::load_common(TexturePool& tex_pool, const std::string& name) {
+  if (m_common_read.valid() && m_common_read_name == name) {
+    auto p = scoped_prof("wait-for-common-read");
+    m_common_level.level = m_common_read.get();
+  } else {
+    m_common_level.level = std::make_unique<tfrag3::Level>();
+    tfrag3::read_fr3_file(m_base_path / fmt::format("{}.fr3", name), *m_common_level.level);
+  }
   for (auto& tex : m_common_level.level->textures) {
     m_common_level.textures.push_back(add_texture(tex_pool, tex, true));
   }
 
-  Timer tim;
+  UploadBudget budget;
   MercLoaderStage mls;
   LoaderInput input;
   input.tex_pool = &tex_pool;
-  input.mercs = &m_all_merc_models;
+  input.mercs = &m_merc_models;
   input.lev_data = &m_common_level;
   bool done = false;
   while (!done) {
-    done = mls.run(tim, input);
+    budget.start_frame(UploadBudget::kDefaultBudgetMs);
+    done = mls.run(budget, input);
   }
   return *m_common_level.level;
 }
@@ -282,6 +619,7 @@ bool Loader::upload_textures(Timer& timer, LevelData& data, TexturePool& texture
   // try to move level from initializing to initialized:
 
   auto evt = scoped_prof("upload-textures");
+  ScopedTelemetryTime t("upload-textures");
   constexpr int MAX_TEX_BYTES_PER_FRAME = 1024 * 128;
 
   int bytes_this_run = 0;
@@ -333,6 +671,13 @@ void Loader::update_blocking(TexturePool& tex_pool) {
       }
 
       if (needs_run) {
+        if (m_use_upload_thread) {
+          // nothing to do here until the upload thread is done with the level.
+          std::unique_lock<std::mutex> lk(m_loader_mutex);
+          m_upload_cv.wait(lk, [&] {
+            return m_upload_fence || m_initializing_tfrag3_levels.empty() || !m_use_upload_thread;
+          });
+        }
         update(tex_pool);
       }
     }
@@ -360,25 +705,35 @@ void Loader::update_blocking(TexturePool& tex_pool) {
   }
 }
 
+/*!
+ * Pick the level to unload: one that hasn't been used for a while, preferring levels the game
+ * doesn't want, then the least recently used, then the biggest.
+ */
 const std::string* Loader::get_most_unloadable_level() {
-  for (auto& [name, lev] : m_loaded_tfrag3_levels) {
-    if (lev->frames_since_last_used > 180 &&
-        std::find(m_desired_levels.begin(), m_desired_levels.end(), name) ==
-            m_desired_levels.end()) {
-      return &name;
-    }
-  }
-
+  const std::string* best = nullptr;
+  auto key = [&](const std::string& name, const LevelData& lev) {
+    bool desired = std::find(m_desired_levels.begin(), m_desired_levels.end(), name) !=
+                   m_desired_levels.end();
+    return std::make_tuple(!desired, lev.frames_since_last_used, lev.gpu_bytes);
+  };
   for (const auto& [name, lev] : m_loaded_tfrag3_levels) {
-    if (lev->frames_since_last_used > 180) {
-      return &name;
+    if (lev->frames_since_last_used <= 180) {
+      continue;
+    }
+    if (!best || key(name, *lev) > key(*best, *m_loaded_tfrag3_levels.at(*best))) {
+      best = &name;
     }
   }
-  return nullptr;
+  return best;
 }
 
-void Loader::update(TexturePool& texture_pool) {
+void Loader::update(TexturePool& texture_pool, float frame_slack_ms) {
   Timer loader_timer;
+  const float budget_ms = frame_slack_ms < 0 ? UploadBudget::kDefaultBudgetMs
+                                             : std::clamp(frame_slack_ms * 0.5f,
+                                                          UploadBudget::kMinBudgetMs,
+                                                          UploadBudget::kMaxBudgetMs);
+  m_upload_budget.start_frame(budget_ms);
 
   {
     // lock because we're accessing m_active_levels
@@ -397,7 +752,9 @@ void Loader::update(TexturePool& texture_pool) {
   bool did_gpu_stuff = false;
 
   // work on moving initializing to initialized.
-  {
+  if (m_use_upload_thread) {
+    did_gpu_stuff = finish_uploaded_level(texture_pool);
+  } else {
     // accessing initializing, should lock
     std::unique_lock<std::mutex> lk(m_loader_mutex);
     // grab the first initializing level:
@@ -415,15 +772,22 @@ void Loader::update(TexturePool& texture_pool) {
       bool done = true;
       LoaderInput loader_input;
       loader_input.lev_data = lev.get();
-      loader_input.mercs = &m_all_merc_models;
+      loader_input.mercs = &m_merc_models;
       loader_input.tex_pool = &texture_pool;
+      loader_input.stream_textures = m_stream_textures;
+      loader_input.tfrag_texture_arrays = m_tfrag_texture_arrays;
 
       for (auto& stage : m_loader_stages) {
-        auto evt = scoped_prof(fmt::format("stage-{}", stage->name()).c_str());
+        const auto event_name = fmt::format("stage-{}", stage->name());
+        auto evt = scoped_prof(event_name.c_str());
         Timer stage_timer;
-        done = stage->run(loader_timer, loader_input);
-        if (stage_timer.getMs() > 5.f) {
-          fmt::print("stage {} took {:.2f} ms\n", stage->name(), stage_timer.getMs());
+        done = stage->run(m_upload_budget, loader_input);
+        telemetry().add_event_time(event_name.c_str(), stage_timer.getSeconds());
+        // one piece can still be slow, like a big texture or a driver stall.
+        if (m_upload_budget.used_ms() > m_upload_budget.budget_ms() + 2.f) {
+          lg::warn("loader stage {} went over the budget: {:.2f} of {:.2f} ms", stage->name(),
+                   m_upload_budget.used_ms(), m_upload_budget.budget_ms());
+          telemetry().count_event("loader-over-budget");
         }
         if (!done) {
           break;
@@ -432,8 +796,9 @@ void Loader::update(TexturePool& texture_pool) {
 
       if (done) {
         auto evt = scoped_prof("finish-stages");
+        ScopedTelemetryTime t("finish-stages");
         lk.lock();
-        m_loaded_tfrag3_levels[name] = std::move(lev);
+        add_loaded_level(name, std::move(lev));
         m_initializing_tfrag3_levels.erase(it);
 
         for (auto& stage : m_loader_stages) {
@@ -447,7 +812,7 @@ void Loader::update(TexturePool& texture_pool) {
     auto evt = scoped_prof("gpu-unload");
     // try to remove levels.
     Timer unload_timer;
-    if ((int)m_loaded_tfrag3_levels.size() >= m_max_levels) {
+    if (should_unload()) {
       auto to_unload = get_most_unloadable_level();
       if (to_unload) {
         auto& lev = m_loaded_tfrag3_levels.at(*to_unload);
@@ -471,40 +836,40 @@ void Loader::update(TexturePool& texture_pool) {
               }
             }
           }
-          m_garbage_textures.push_back(tex);
+          m_gpu_garbage.free_texture(tex);
+        }
+        for (auto tex : lev->texture_arrays) {
+          m_gpu_garbage.free_texture(tex);
         }
 
         for (auto& tie_geo : lev->tie_data) {
           for (auto& tie_tree : tie_geo) {
-            m_garbage_buffers.push_back(tie_tree.vertex_buffer);
+            m_gpu_garbage.free_buffer(tie_tree.vertex_buffer);
             if (tie_tree.has_wind) {
-              m_garbage_buffers.push_back(tie_tree.wind_indices);
+              m_gpu_garbage.free_buffer(tie_tree.wind_indices);
             }
-            m_garbage_buffers.push_back(tie_tree.index_buffer);
+            m_gpu_garbage.free_buffer(tie_tree.index_buffer);
           }
         }
 
         for (auto& tfrag_geo : lev->tfrag_vertex_data) {
           for (auto& tfrag_buff : tfrag_geo) {
-            m_garbage_buffers.push_back(tfrag_buff);
+            m_gpu_garbage.free_buffer(tfrag_buff);
           }
         }
 
-        m_garbage_buffers.push_back(lev->hfrag_indices);
-        m_garbage_buffers.push_back(lev->hfrag_indices);
+        m_gpu_garbage.free_buffer(lev->hfrag_vertices);
+        m_gpu_garbage.free_buffer(lev->hfrag_indices);
 
-        m_garbage_buffers.push_back(lev->collide_vertices);
-        m_garbage_buffers.push_back(lev->merc_vertices);
-        m_garbage_buffers.push_back(lev->merc_indices);
+        m_gpu_garbage.free_buffer(lev->collide_vertices);
+        m_gpu_garbage.free_buffer(lev->merc_vertices);
+        m_gpu_garbage.free_buffer(lev->merc_indices);
 
         for (auto& model : lev->level->merc_data.models) {
-          auto& mercs = m_all_merc_models.at(model.name);
-          MercRef ref{&model, lev->load_id};
-          auto it = std::find(mercs.begin(), mercs.end(), ref);
-          ASSERT_MSG(it != mercs.end(), fmt::format("missing merc: {}\n", model.name));
-          mercs.erase(it);
+          m_merc_models.remove(model.name, {&model, lev->load_id});
         }
 
+        m_loaded_gpu_bytes -= lev->gpu_bytes;
         m_loaded_tfrag3_levels.erase(*to_unload);
       }
     }
@@ -512,21 +877,17 @@ void Loader::update(TexturePool& texture_pool) {
     if (unload_timer.getMs() > 5.f) {
       fmt::print("Unload took {:.2f}ms\n", unload_timer.getMs());
     }
+  }
 
-    if (!m_garbage_buffers.empty()) {
-      did_gpu_stuff = true;
-      for (int i = 0; i < 5 && !m_garbage_buffers.empty(); i++) {
-        glDeleteBuffers(1, &m_garbage_buffers.back());
-        m_garbage_buffers.pop_back();
-      }
-    }
+  // the draws that used an unloaded level's textures and buffers have all been issued, so they
+  // can be deleted as soon as the GPU is past this point.
+  m_gpu_garbage.update();
 
-    if (!did_gpu_stuff && !m_garbage_textures.empty()) {
-      for (int i = 0; i < 20 && !m_garbage_textures.empty(); i++) {
-        glDeleteTextures(1, &m_garbage_textures.back());
-        m_garbage_textures.pop_back();
-      }
-    }
+  // the larger mips are only streamed when there's nothing else to do. This has its own budget
+  // because the upload thread uses m_upload_budget.
+  if (!did_gpu_stuff && m_stream_textures) {
+    m_stream_budget.start_frame(budget_ms);
+    stream_texture_mips(m_stream_budget);
   }
 
   if (loader_timer.getMs() > 5) {
@@ -534,13 +895,149 @@ void Loader::update(TexturePool& texture_pool) {
   }
 }
 
-std::optional<MercRef> Loader::get_merc_model(const char* model_name) {
-  // don't think we need to lock here...
-  const auto& it = m_all_merc_models.find(model_name);
-  if (it != m_all_merc_models.end() && !it->second.empty()) {
-    // it->second.front().parent_level->frames_since_last_used = 0;
-    return it->second.front();
-  } else {
-    return std::nullopt;
+void Loader::start_upload_thread(TexturePool& tex_pool,
+                                 std::function<bool()> make_current,
+                                 std::function<void()> release_context) {
+  ASSERT(!m_upload_thread.joinable());
+  m_want_upload_shutdown = false;
+  m_use_upload_thread = true;
+  m_upload_thread = std::thread(&Loader::upload_thread, this, &tex_pool, std::move(make_current),
+                                std::move(release_context));
+}
+
+void Loader::stop_upload_thread() {
+  if (!m_upload_thread.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lk(m_loader_mutex);
+    m_want_upload_shutdown = true;
+  }
+  m_upload_cv.notify_all();
+  m_upload_thread.join();
+  m_use_upload_thread = false;
+}
+
+/*!
+ * Runs the loader stages for the initializing level, with its own GL context.
+ */
+void Loader::upload_thread(TexturePool* tex_pool,
+                           std::function<bool()> make_current,
+                           std::function<void()> release_context) {
+  if (!make_current()) {
+    lg::error("Couldn't use the GL context for the upload thread, uploading on the render thread");
+    std::lock_guard<std::mutex> lk(m_loader_mutex);
+    m_use_upload_thread = false;
+    m_upload_cv.notify_all();
+    return;
+  }
+
+  std::vector<std::function<void()>> publish;
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  while (true) {
+    m_upload_cv.wait(lk, [&] {
+      return m_want_upload_shutdown || (!m_initializing_tfrag3_levels.empty() && !m_upload_fence);
+    });
+    if (m_want_upload_shutdown) {
+      break;
+    }
+    // only the render thread erases the level, after we're done with it.
+    auto& lev = *m_initializing_tfrag3_levels.begin()->second;
+    if (lev.load_id == UINT64_MAX) {
+      lev.load_id = m_id++;
+    }
+    lk.unlock();
+
+    LoaderInput loader_input;
+    loader_input.lev_data = &lev;
+    loader_input.mercs = &m_merc_models;
+    loader_input.tex_pool = tex_pool;
+    loader_input.publish = &publish;
+    loader_input.stream_textures = m_stream_textures;
+    loader_input.tfrag_texture_arrays = m_tfrag_texture_arrays;
+
+    prof().root_event();
+    auto evt = scoped_prof("upload-level");
+    bool done = false;
+    bool shutdown = false;
+    while (!done && !shutdown) {
+      // nothing else is waiting on us, the budget only keeps the uploads in pieces so the driver
+      // can fit the renderer's work in between.
+      m_upload_budget.start_frame(UploadBudget::kDefaultBudgetMs);
+      for (auto& stage : m_loader_stages) {
+        done = stage->run(m_upload_budget, loader_input);
+        if (!done) {
+          break;
+        }
+      }
+      lk.lock();
+      shutdown = m_want_upload_shutdown;
+      lk.unlock();
+    }
+    if (shutdown) {
+      lk.lock();
+      break;
+    }
+
+    for (auto& stage : m_loader_stages) {
+      stage->reset();
+    }
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    // the fence has to be sent to the GPU before another context can wait on it.
+    glFlush();
+    lk.lock();
+    m_upload_fence = fence;
+    m_upload_publish = std::move(publish);
+    publish.clear();
+    m_upload_cv.notify_all();
+  }
+  lk.unlock();
+  release_context();
+}
+
+/*!
+ * With the upload thread, give the initializing level to the renderer once its uploads are done on
+ * the GPU. Returns true if a level is initializing.
+ */
+bool Loader::finish_uploaded_level(TexturePool& texture_pool) {
+  std::unique_lock<std::mutex> lk(m_loader_mutex);
+  if (m_initializing_tfrag3_levels.empty()) {
+    return false;
+  }
+  if (!m_upload_fence) {
+    return true;
+  }
+  auto status = glClientWaitSync(m_upload_fence, 0, 0);
+  if (status == GL_TIMEOUT_EXPIRED) {
+    return true;
+  }
+  if (status == GL_WAIT_FAILED) {
+    lg::error("Waiting for the upload thread's fence failed");
+  }
+  glDeleteSync(m_upload_fence);
+  m_upload_fence = nullptr;
+
+  auto evt = scoped_prof("finish-stages");
+  ScopedTelemetryTime t("finish-stages");
+  {
+    std::unique_lock<std::mutex> tpool_lock(texture_pool.mutex());
+    for (auto& f : m_upload_publish) {
+      f();
+    }
   }
+  m_upload_publish.clear();
+  auto it = m_initializing_tfrag3_levels.begin();
+  add_loaded_level(it->first, std::move(it->second));
+  m_initializing_tfrag3_levels.erase(it);
+  lk.unlock();
+  m_upload_cv.notify_all();
+  return true;
+}
+
+MercHandle Loader::get_merc_handle(const char* model_name) {
+  return m_merc_models.handle(model_name);
+}
+
+std::optional<MercRef> Loader::get_merc_model(MercHandle handle) const {
+  return m_merc_models.get(handle);
 }
@@ -1,46 +1,115 @@
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
 #include <mutex>
+#include <set>
 #include <thread>
 
 #include "common/custom_data/Tfrag3Data.h"
+#include "common/goal_constants.h"
 #include "common/util/FileUtil.h"
 #include "common/util/Timer.h"
 
 #include "game/graphics/opengl_renderer/loader/common.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 #include "game/graphics/texture/TexturePool.h"
 
+// the number of level slots in the game, which is the most levels the loader will keep loaded.
+constexpr PerGameVersion<int> fr3_level_count(jak1::LEVEL_TOTAL,
+                                              jak2::LEVEL_TOTAL,
+                                              jak3::LEVEL_TOTAL);
+
 class Loader {
  public:
   static constexpr float TIE_LOAD_BUDGET = 1.5f;
   static constexpr float SHARED_TEXTURE_LOAD_BUDGET = 3.f;
-  Loader(const fs::path& base_path, int max_levels);
+  static constexpr size_t DEFAULT_PREFETCH_BUDGET = 512 * 1024 * 1024;
+  Loader(const fs::path& base_path,
+         int max_levels,
+         const fs::path& adjacency_file = {},
+         size_t prefetch_budget = DEFAULT_PREFETCH_BUDGET);
   ~Loader();
-  void update(TexturePool& tex_pool);
+  // frame_slack_ms is how long the render thread was idle last frame, or -1 if it's not known.
+  // The GPU uploads for loading levels get about half of it.
+  void update(TexturePool& tex_pool, float frame_slack_ms = -1);
   void update_blocking(TexturePool& tex_pool);
   const LevelData* get_tfrag3_level(const std::string& level_name);
-  std::optional<MercRef> get_merc_model(const char* model_name);
+  // merc models are looked up by name once, then by handle. Only for the render thread.
+  MercHandle get_merc_handle(const char* model_name);
+  std::optional<MercRef> get_merc_model(MercHandle handle) const;
+  // Start reading a common FR3 file on another thread, for load_common(name) to use. This lets the
+  // file be read while the renderer starts up.
+  void start_reading_common(const std::string& name);
   const tfrag3::Level& load_common(TexturePool& tex_pool, const std::string& name);
   void set_want_levels(const std::vector<std::string>& levels);
+  std::vector<std::string> get_want_levels();
   void set_active_levels(const std::vector<std::string>& levels);
   std::vector<LevelData*> get_in_use_levels();
   void draw_debug_window();
   void debug_print_loaded_levels();
+  std::vector<std::string> loaded_level_names();
+  // Unload levels that aren't in use when the loaded levels use more GPU memory than this.
+  // 0 means no limit, only the level count is used.
+  void set_gpu_budget(size_t bytes);
+  // Load big compressed textures at a lower resolution, and stream in their larger mips while the
+  // level is in use. Set before loading levels.
+  void set_texture_streaming(bool enable);
+  // Also pack tfrag textures into texture arrays, which is a second copy of them on the GPU. Set
+  // before loading levels.
+  void set_tfrag_texture_arrays(bool enable);
+
+  /*!
+   * Do the GPU uploads for loading levels on another thread, with a GL context shared with the
+   * renderer's, instead of in update(). That thread calls make_current before any GL calls, and
+   * release_context when it stops. A level is only given to the renderer once a fence after its
+   * uploads has signaled.
+   */
+  void start_upload_thread(TexturePool& tex_pool,
+                           std::function<bool()> make_current,
+                           std::function<void()> release_context);
+  void stop_upload_thread();
 
  private:
   void loader_thread();
+  void upload_thread(TexturePool* tex_pool,
+                     std::function<bool()> make_current,
+                     std::function<void()> release_context);
+  bool finish_uploaded_level(TexturePool& texture_pool);
+  void add_loaded_level(const std::string& name, std::unique_ptr<LevelData> lev);
+  bool should_unload() const;
   bool upload_textures(Timer& timer, LevelData& data, TexturePool& texture_pool);
+  void stream_texture_mips(UploadBudget& budget);
 
   const std::string* get_most_unloadable_level();
 
+  void record_level_transitions(const std::vector<std::string>& levels);
+  void update_prefetch(const std::vector<std::string>& levels);
+  void load_adjacency();
+  void save_adjacency();
+
+  struct PrefetchedLevel {
+    std::unique_ptr<tfrag3::Level> level;
+    size_t bytes = 0;
+  };
+
   // used by game and loader thread
   std::unordered_map<std::string, std::unique_ptr<LevelData>> m_initializing_tfrag3_levels;
 
   LevelData m_common_level;
+  std::string m_common_read_name;
+  std::future<std::unique_ptr<tfrag3::Level>> m_common_read;
 
   std::string m_level_to_load;
 
+  // levels that have been read and unpacked ahead of time, but not uploaded to the GPU.
+  std::unordered_map<std::string, PrefetchedLevel> m_prefetched_levels;
+  std::string m_level_to_prefetch;
+  size_t m_prefetched_bytes = 0;
+
   std::thread m_loader_thread;
   std::mutex m_loader_mutex;
   std::condition_variable m_loader_cv;
@@ -50,15 +119,36 @@ class Loader {
 
   // used only by game thread
   std::unordered_map<std::string, std::unique_ptr<LevelData>> m_loaded_tfrag3_levels;
+  size_t m_loaded_gpu_bytes = 0;
+  size_t m_gpu_budget = 0;
+  bool m_stream_textures = false;
+  bool m_tfrag_texture_arrays = false;
+  UploadBudget m_stream_budget;
 
-  std::unordered_map<std::string, std::vector<MercRef>> m_all_merc_models;
+  MercModelRegistry m_merc_models;
 
   std::vector<std::string> m_desired_levels;
   std::vector<std::string> m_active_levels;
   std::vector<std::unique_ptr<LoaderStage>> m_loader_stages;
-  std::vector<GLuint> m_garbage_textures;
-  std::vector<GLuint> m_garbage_buffers;
+  UploadBudget m_upload_budget;
+
+  // with the upload thread, it runs the loader stages instead of update().
+  std::thread m_upload_thread;
+  std::atomic_bool m_use_upload_thread = false;
+  bool m_want_upload_shutdown = false;
+  std::condition_variable m_upload_cv;
+  // set by the upload thread when the initializing level is uploaded, the render thread finishes
+  // the level after this signals.
+  GLsync m_upload_fence = nullptr;
+  std::vector<std::function<void()>> m_upload_publish;
+  GpuGarbage m_gpu_garbage;
 
   fs::path m_base_path;
   int m_max_levels = 0;
+
+  // levels that have been wanted at the same time, which we use to guess what will load next.
+  std::map<std::string, std::set<std::string>> m_level_adjacency;
+  fs::path m_adjacency_file;
+  bool m_adjacency_changed = false;
+  size_t m_prefetch_budget = 0;
 };
@@ -1,36 +1,190 @@
 #include "LoaderStages.h"
 
+#include <cstring>
+#include <map>
+#include <tuple>
+
 #include "Loader.h"
 
 #include "common/global_profiler/GlobalProfiler.h"
+#include "common/log/log.h"
+#include "common/texture/texture_compression.h"
+
+namespace {
+// from EXT_texture_compression_s3tc, which isn't in our glad.
+constexpr GLenum kGlCompressedRgbS3tcDxt1 = 0x83F0;
+constexpr GLenum kGlCompressedRgbaS3tcDxt5 = 0x83F3;
+
+GLenum gl_format_for_bc(BcFormat format) {
+  return format == BcFormat::BC1 ? kGlCompressedRgbS3tcDxt1 : kGlCompressedRgbaS3tcDxt5;
+}
+
+/*!
+ * Can the GPU sample BC1/BC3 textures? If not, compressed textures are decompressed on load.
+ */
+bool bc_textures_supported() {
+  static const bool supported = [] {
+    GLint num_extensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+    for (GLint i = 0; i < num_extensions; i++) {
+      if (!strcmp((const char*)glGetStringi(GL_EXTENSIONS, i),
+                  "GL_EXT_texture_compression_s3tc")) {
+        return true;
+      }
+    }
+    lg::warn("S3TC textures aren't supported, compressed textures will be decompressed on load");
+    return false;
+  }();
+  return supported;
+}
+
+// with texture streaming, compressed textures bigger than this are loaded without their larger
+// mips, which are uploaded after the level is loaded.
+constexpr u32 kStreamedTextureLoadSize = 256;
+
+/*!
+ * Upload levels [first_level, end_level) of a compressed mip chain to the bound GL_TEXTURE_2D.
+ */
+void upload_compressed_levels(const tfrag3::Texture& tex, u32 first_level, u32 end_level) {
+  const u8* level_data = tex.compressed_data.data() + compressed_mip_offset(tex, first_level);
+  u32 w = std::max(1u, u32(tex.w) >> first_level), h = std::max(1u, u32(tex.h) >> first_level);
+  const bool supported = bc_textures_supported();
+  std::vector<u32> decompressed;
+  for (u32 level = first_level; level < end_level; level++) {
+    const u32 size = bc_level_size(w, h, tex.compressed_format);
+    ASSERT(level_data + size <= tex.compressed_data.data() + tex.compressed_data.size());
+    if (supported) {
+      glCompressedTexImage2D(GL_TEXTURE_2D, level, gl_format_for_bc(tex.compressed_format), w, h,
+                             0, size, level_data);
+    } else {
+      decompressed.resize(w * h);
+      bc_decompress_level(level_data, w, h, tex.compressed_format, decompressed.data());
+      glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV,
+                   decompressed.data());
+    }
+    level_data += size;
+    w = std::max(1u, w / 2);
+    h = std::max(1u, h / 2);
+  }
+}
 
-constexpr float LOAD_BUDGET = 4.5f;
+/*!
+ * Upload a compressed mip chain to the bound GL_TEXTURE_2D, starting at first_level. The texture
+ * samples from first_level until the larger levels are uploaded.
+ */
+void upload_compressed_texture(const tfrag3::Texture& tex, u32 first_level) {
+  const u32 num_levels = bc_num_mip_levels(tex.w, tex.h);
+  ASSERT(first_level < num_levels);
+  upload_compressed_levels(tex, first_level, num_levels);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, first_level);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, num_levels - 1);
+}
 
 /*!
- * Upload a texture to the GPU, and give it to the pool.
+ * Upload src to buffer, starting at element *next, in pieces until it's done or the budget runs
+ * out. Returns true when it's done.
  */
-u64 add_texture(TexturePool& pool, const tfrag3::Texture& tex, bool is_common) {
+template <typename T>
+bool upload_pieces(UploadBudget& budget,
+                   GLenum target,
+                   GLuint buffer,
+                   const std::vector<T>& src,
+                   u32* next) {
+  glBindBuffer(target, buffer);
+  while (*next < src.size()) {
+    u32 start = *next;
+    u32 end = start + budget.piece_elements(sizeof(T), src.size() - start);
+    u32 upload_size = (end - start) * sizeof(T);
+    glBufferSubData(target, start * sizeof(T), upload_size, src.data() + start);
+    budget.uploaded(upload_size);
+    *next = end;
+    if (budget.exhausted()) {
+      break;
+    }
+  }
+  return *next == src.size();
+}
+
+void add_texture_to_pool(TexturePool& pool,
+                         const tfrag3::Texture& tex,
+                         GLuint gl_tex,
+                         bool is_common) {
+  TextureInput in;
+  in.debug_page_name = tex.debug_tpage_name;
+  in.debug_name = tex.debug_name;
+  in.w = tex.w;
+  in.h = tex.h;
+  in.gpu_texture = gl_tex;
+  in.common = is_common;
+  in.id = PcTextureId::from_combo_id(tex.combo_id);
+  // compressed textures have no RGBA data. Users of the source data check for null.
+  in.src_data = tex.data.empty() ? nullptr : (const u8*)tex.data.data();
+  pool.give_texture(in);
+}
+}  // namespace
+
+u32 compressed_mip_offset(const tfrag3::Texture& tex, u32 level) {
+  u32 offset = 0;
+  for (u32 i = 0; i < level; i++) {
+    offset += bc_level_size(std::max(1u, u32(tex.w) >> i), std::max(1u, u32(tex.h) >> i),
+                            tex.compressed_format);
+  }
+  return offset;
+}
+
+u32 first_streamed_level(const tfrag3::Texture& tex) {
+  if (!tex.is_compressed()) {
+    return 0;
+  }
+  const u32 num_levels = bc_num_mip_levels(tex.w, tex.h);
+  const u32 size = std::max(tex.w, tex.h);
+  u32 level = 0;
+  while (level + 1 < num_levels && (size >> level) > kStreamedTextureLoadSize) {
+    level++;
+  }
+  return level;
+}
+
+u32 upload_next_texture_mip(GLuint gl_tex, const tfrag3::Texture& tex, u32 base_level) {
+  ASSERT(base_level > 0);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, gl_tex);
+  upload_compressed_levels(tex, base_level - 1, base_level);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, base_level - 1);
+  glBindTexture(GL_TEXTURE_2D, 0);
+  return compressed_mip_offset(tex, base_level) - compressed_mip_offset(tex, base_level - 1);
+}
+
+/*!
+ * Upload a texture to the GPU, and give it to the pool. With publish, giving it to the pool is
+ * added there instead. Compressed textures are uploaded from mip first_level down.
+ */
+u64 add_texture(TexturePool& pool,
+                const tfrag3::Texture& tex,
+                bool is_common,
+                std::vector<std::function<void()>>* publish,
+                u32 first_level) {
   GLuint gl_tex;
   glActiveTexture(GL_TEXTURE0);
   glGenTextures(1, &gl_tex);
   glBindTexture(GL_TEXTURE_2D, gl_tex);
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex.w, tex.h, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV,
-               tex.data.data());
-  glGenerateMipmap(GL_TEXTURE_2D);
+  if (tex.is_compressed()) {
+    // the extractor already built the mips.
+    upload_compressed_texture(tex, first_level);
+  } else {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex.w, tex.h, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8_REV,
+                 tex.data.data());
+    glGenerateMipmap(GL_TEXTURE_2D);
+  }
   float aniso = 0.0f;
   glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &aniso);
   glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY, aniso);
-  if (tex.load_to_pool) {
-    TextureInput in;
-    in.debug_page_name = tex.debug_tpage_name;
-    in.debug_name = tex.debug_name;
-    in.w = tex.w;
-    in.h = tex.h;
-    in.gpu_texture = gl_tex;
-    in.common = is_common;
-    in.id = PcTextureId::from_combo_id(tex.combo_id);
-    in.src_data = (const u8*)tex.data.data();
-    pool.give_texture(in);
+  if (tex.load_to_pool && publish) {
+    publish->push_back([&pool, &tex, gl_tex, is_common] {
+      add_texture_to_pool(pool, tex, gl_tex, is_common);
+    });
+  } else if (tex.load_to_pool) {
+    add_texture_to_pool(pool, tex, gl_tex, is_common);
   }
 
   return gl_tex;
@@ -39,24 +193,25 @@ u64 add_texture(TexturePool& pool, const tfrag3::Texture& tex, bool is_common) {
 class TextureLoaderStage : public LoaderStage {
  public:
   TextureLoaderStage() : LoaderStage("texture") {}
-  bool run(Timer& timer, LoaderInput& data) override {
-    constexpr int MAX_TEX_BYTES_PER_FRAME = 1024 * 1024;
-
-    int bytes_this_run = 0;
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     int tex_this_run = 0;
     if (data.lev_data->textures.size() < data.lev_data->level->textures.size()) {
       std::unique_lock<std::mutex> tpool_lock(data.tex_pool->mutex());
-      while (data.lev_data->textures.size() < data.lev_data->level->textures.size()) {
+      // a texture is uploaded all at once, so this may go over the budget by one texture.
+      while (data.lev_data->textures.size() < data.lev_data->level->textures.size() &&
+             !budget.exhausted()) {
         auto& tex = data.lev_data->level->textures[data.lev_data->textures.size()];
-        data.lev_data->textures.push_back(add_texture(*data.tex_pool, tex, false));
-        bytes_this_run += tex.w * tex.h * 4;
+        const u32 first_level = data.stream_textures ? first_streamed_level(tex) : 0;
+        data.lev_data->textures.push_back(
+            add_texture(*data.tex_pool, tex, false, data.publish, first_level));
+        data.lev_data->texture_base_levels.push_back(first_level);
+        budget.uploaded(tex.is_compressed()
+                            ? tex.compressed_data.size() - compressed_mip_offset(tex, first_level)
+                            : tex.w * tex.h * 4);
         tex_this_run++;
         if (tex_this_run > 20) {
           break;
         }
-        if (bytes_this_run > MAX_TEX_BYTES_PER_FRAME || timer.getMs() > LOAD_BUDGET) {
-          break;
-        }
       }
     }
     return data.lev_data->textures.size() == data.lev_data->level->textures.size();
@@ -64,10 +219,165 @@ class TextureLoaderStage : public LoaderStage {
   void reset() override {}
 };
 
+/*!
+ * Pack the textures used by tfrag draws into GL_TEXTURE_2D_ARRAYs, one array per texture size.
+ * This is a second copy: the individual textures from TextureLoaderStage are still used by
+ * everything else, so it's only done when tfrag_texture_arrays is set.
+ */
+class TextureArrayLoaderStage : public LoaderStage {
+ public:
+  TextureArrayLoaderStage() : LoaderStage("texture-array") {}
+  bool run(UploadBudget& budget, LoaderInput& data) override {
+    if (m_done || !data.tfrag_texture_arrays) {
+      return true;
+    }
+
+    auto* lev = data.lev_data;
+    if (!m_arrays_created) {
+      create_arrays(*lev);
+      m_arrays_created = true;
+      return false;
+    }
+
+    while (m_next_tex < lev->texture_array_slots.size()) {
+      const auto& slot = lev->texture_array_slots[m_next_tex];
+      if (slot.array >= 0) {
+        const auto& tex = lev->level->textures[m_next_tex];
+        glBindTexture(GL_TEXTURE_2D_ARRAY, lev->texture_arrays[slot.array]);
+        if (tex.is_compressed()) {
+          const u8* level_data = tex.compressed_data.data();
+          u32 w = tex.w, h = tex.h;
+          for (u32 level = 0; level < bc_num_mip_levels(tex.w, tex.h); level++) {
+            const u32 size = bc_level_size(w, h, tex.compressed_format);
+            glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, 0, 0, slot.layer, w, h, 1,
+                                      gl_format_for_bc(tex.compressed_format), size, level_data);
+            level_data += size;
+            w = std::max(1u, w / 2);
+            h = std::max(1u, h / 2);
+          }
+          budget.uploaded(tex.compressed_data.size());
+        } else {
+          glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, slot.layer, tex.w, tex.h, 1, GL_RGBA,
+                          GL_UNSIGNED_INT_8_8_8_8_REV, tex.data.data());
+          budget.uploaded(tex.w * tex.h * 4);
+        }
+      }
+      m_next_tex++;
+      if (budget.exhausted()) {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        return false;
+      }
+    }
+
+    // all layers are uploaded, build mips one array at a time. Compressed arrays already have them.
+    while (m_next_mip < lev->texture_arrays.size() && !m_array_needs_mips[m_next_mip]) {
+      m_next_mip++;
+    }
+    if (m_next_mip < lev->texture_arrays.size()) {
+      glBindTexture(GL_TEXTURE_2D_ARRAY, lev->texture_arrays[m_next_mip]);
+      glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+      glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+      m_next_mip++;
+      return false;
+    }
+
+    m_done = true;
+    return true;
+  }
+
+  void reset() override {
+    m_done = false;
+    m_arrays_created = false;
+    m_next_tex = 0;
+    m_next_mip = 0;
+    m_array_needs_mips.clear();
+  }
+
+ private:
+  void create_arrays(LevelData& lev) {
+    const auto& textures = lev.level->textures;
+    lev.texture_array_slots.clear();
+    lev.texture_array_slots.resize(textures.size());
+
+    // group the textures used by tfrag by size and format.
+    std::vector<bool> used_by_tfrag(textures.size(), false);
+    for (const auto& geo : lev.level->tfrag_trees) {
+      for (const auto& tree : geo) {
+        for (const auto& draw : tree.draws) {
+          if (draw.tree_tex_id >= 0) {
+            used_by_tfrag.at(draw.tree_tex_id) = true;
+          }
+        }
+      }
+    }
+    // format is -1 for uncompressed. Compressed textures the GPU can't sample aren't packed.
+    std::map<std::tuple<u16, u16, int>, std::vector<u32>> textures_by_size;
+    for (u32 i = 0; i < textures.size(); i++) {
+      const auto& tex = textures[i];
+      if (!used_by_tfrag[i] || (tex.is_compressed() && !bc_textures_supported())) {
+        continue;
+      }
+      int format = tex.is_compressed() ? (int)tex.compressed_format : -1;
+      textures_by_size[{tex.w, tex.h, format}].push_back(i);
+    }
+
+    GLint max_layers = 256;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+    float aniso = 0.0f;
+    glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &aniso);
+
+    glActiveTexture(GL_TEXTURE0);
+    for (const auto& [key, tex_ids] : textures_by_size) {
+      // a single texture doesn't save any binds.
+      if (tex_ids.size() < 2) {
+        continue;
+      }
+      const auto [w, h, format] = key;
+      for (size_t first = 0; first < tex_ids.size(); first += max_layers) {
+        u32 layers = std::min(tex_ids.size() - first, (size_t)max_layers);
+        GLuint& gl_tex = lev.texture_arrays.emplace_back();
+        glGenTextures(1, &gl_tex);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, gl_tex);
+        if (format < 0) {
+          glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA, w, h, layers, 0, GL_RGBA,
+                       GL_UNSIGNED_INT_8_8_8_8_REV, nullptr);
+          m_array_needs_mips.push_back(true);
+        } else {
+          const auto bc_format = (BcFormat)format;
+          const u32 num_levels = bc_num_mip_levels(w, h);
+          u32 lw = w, lh = h;
+          for (u32 level = 0; level < num_levels; level++) {
+            glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, gl_format_for_bc(bc_format), lw,
+                                   lh, layers, 0, bc_level_size(lw, lh, bc_format) * layers,
+                                   nullptr);
+            lw = std::max(1u, lw / 2);
+            lh = std::max(1u, lh / 2);
+          }
+          glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, num_levels - 1);
+          m_array_needs_mips.push_back(false);
+        }
+        glTexParameterf(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_ANISOTROPY, aniso);
+        for (u32 layer = 0; layer < layers; layer++) {
+          auto& slot = lev.texture_array_slots[tex_ids[first + layer]];
+          slot.array = lev.texture_arrays.size() - 1;
+          slot.layer = layer;
+        }
+      }
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  }
+
+  bool m_done = false;
+  bool m_arrays_created = false;
+  u32 m_next_tex = 0;
+  u32 m_next_mip = 0;
+  std::vector<bool> m_array_needs_mips;  // per array in LevelData
+};
+
 class TfragLoadStage : public LoaderStage {
  public:
   TfragLoadStage() : LoaderStage("tfrag") {}
-  bool run(Timer& timer, LoaderInput& data) override {
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     if (m_done) {
       return true;
     }
@@ -85,16 +395,14 @@ class TfragLoadStage : public LoaderStage {
           glGenBuffers(1, &tree_out);
           glBindBuffer(GL_ARRAY_BUFFER, tree_out);
           glBufferData(GL_ARRAY_BUFFER,
-                       in_tree.unpacked.vertices.size() * sizeof(tfrag3::PreloadedVertex), nullptr,
-                       GL_STATIC_DRAW);
+                       in_tree.unpacked.gpu_vertices.size() * sizeof(tfrag3::TfragGpuVertex),
+                       nullptr, GL_STATIC_DRAW);
         }
       }
       m_opengl_created = true;
       return false;
     }
 
-    constexpr u32 CHUNK_SIZE = 32768;
-    u32 uploaded_bytes = 0;
     [[maybe_unused]] u32 unique_buffers = 0;
 
     while (true) {
@@ -104,18 +412,21 @@ class TfragLoadStage : public LoaderStage {
         complete_tree = true;
       } else {
         const auto& tree = data.lev_data->level->tfrag_trees[m_next_geo][m_next_tree];
-        u32 end_vert_in_tree = tree.unpacked.vertices.size();
+        u32 end_vert_in_tree = tree.unpacked.gpu_vertices.size();
         // the number of vertices we'd need to finish the tree right now
         size_t num_verts_left_in_tree = end_vert_in_tree - m_next_vert;
         size_t start_vert_for_chunk;
         size_t end_vert_for_chunk;
 
-        if (num_verts_left_in_tree > CHUNK_SIZE) {
+        const u32 chunk_size =
+            budget.piece_elements(sizeof(tfrag3::TfragGpuVertex), num_verts_left_in_tree);
+
+        if (num_verts_left_in_tree > chunk_size) {
           complete_tree = false;
           // should only do partial
           start_vert_for_chunk = m_next_vert;
-          end_vert_for_chunk = start_vert_for_chunk + CHUNK_SIZE;
-          m_next_vert += CHUNK_SIZE;
+          end_vert_for_chunk = start_vert_for_chunk + chunk_size;
+          m_next_vert += chunk_size;
         } else {
           // should do all!
           start_vert_for_chunk = m_next_vert;
@@ -125,10 +436,10 @@ class TfragLoadStage : public LoaderStage {
 
         glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->tfrag_vertex_data[m_next_geo][m_next_tree]);
         u32 upload_size =
-            (end_vert_for_chunk - start_vert_for_chunk) * sizeof(tfrag3::PreloadedVertex);
-        glBufferSubData(GL_ARRAY_BUFFER, start_vert_for_chunk * sizeof(tfrag3::PreloadedVertex),
-                        upload_size, tree.unpacked.vertices.data() + start_vert_for_chunk);
-        uploaded_bytes += upload_size;
+            (end_vert_for_chunk - start_vert_for_chunk) * sizeof(tfrag3::TfragGpuVertex);
+        glBufferSubData(GL_ARRAY_BUFFER, start_vert_for_chunk * sizeof(tfrag3::TfragGpuVertex),
+                        upload_size, tree.unpacked.gpu_vertices.data() + start_vert_for_chunk);
+        budget.uploaded(upload_size);
       }
 
       if (complete_tree) {
@@ -151,7 +462,7 @@ class TfragLoadStage : public LoaderStage {
         return false;
       }
 
-      if (timer.getMs() > LOAD_BUDGET || (uploaded_bytes / 1024) > 2048) {
+      if (budget.exhausted()) {
         return false;
       }
     }
@@ -176,7 +487,7 @@ class TfragLoadStage : public LoaderStage {
 class ShrubLoadStage : public LoaderStage {
  public:
   ShrubLoadStage() : LoaderStage("shrub") {}
-  bool run(Timer& timer, LoaderInput& data) override {
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     if (m_done) {
       return true;
     }
@@ -199,9 +510,6 @@ class ShrubLoadStage : public LoaderStage {
       return false;
     }
 
-    constexpr u32 CHUNK_SIZE = 32768;
-    u32 uploaded_bytes = 0;
-
     while (true) {
       const auto& tree = data.lev_data->level->shrub_trees[m_next_tree];
       u32 end_vert_in_tree = tree.unpacked.vertices.size();
@@ -211,13 +519,15 @@ class ShrubLoadStage : public LoaderStage {
       size_t end_vert_for_chunk;
 
       bool complete_tree;
+      const u32 chunk_size =
+          budget.piece_elements(sizeof(tfrag3::ShrubGpuVertex), num_verts_left_in_tree);
 
-      if (num_verts_left_in_tree > CHUNK_SIZE) {
+      if (num_verts_left_in_tree > chunk_size) {
         complete_tree = false;
         // should only do partial
         start_vert_for_chunk = m_next_vert;
-        end_vert_for_chunk = start_vert_for_chunk + CHUNK_SIZE;
-        m_next_vert += CHUNK_SIZE;
+        end_vert_for_chunk = start_vert_for_chunk + chunk_size;
+        m_next_vert += chunk_size;
       } else {
         // should do all!
         start_vert_for_chunk = m_next_vert;
@@ -230,7 +540,7 @@ class ShrubLoadStage : public LoaderStage {
           (end_vert_for_chunk - start_vert_for_chunk) * sizeof(tfrag3::ShrubGpuVertex);
       glBufferSubData(GL_ARRAY_BUFFER, start_vert_for_chunk * sizeof(tfrag3::ShrubGpuVertex),
                       upload_size, tree.unpacked.vertices.data() + start_vert_for_chunk);
-      uploaded_bytes += upload_size;
+      budget.uploaded(upload_size);
 
       if (complete_tree) {
         // and move on to next tree
@@ -242,7 +552,7 @@ class ShrubLoadStage : public LoaderStage {
         }
       }
 
-      if (timer.getMs() > LOAD_BUDGET || (uploaded_bytes / 128) > 2048) {
+      if (budget.exhausted()) {
         return false;
       }
     }
@@ -265,7 +575,7 @@ class ShrubLoadStage : public LoaderStage {
 class TieLoadStage : public LoaderStage {
  public:
   TieLoadStage() : LoaderStage("tie") {}
-  bool run(Timer& timer, LoaderInput& data) override {
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     if (m_done) {
       return true;
     }
@@ -299,8 +609,6 @@ class TieLoadStage : public LoaderStage {
 
     if (!m_verts_done) {
       auto evt = scoped_prof("tie-verts");
-      constexpr u32 CHUNK_SIZE = 32768;
-      u32 uploaded_bytes = 0;
 
       while (true) {
         const auto& tree = data.lev_data->level->tie_trees[m_next_geo][m_next_tree];
@@ -311,13 +619,15 @@ class TieLoadStage : public LoaderStage {
         size_t end_vert_for_chunk;
 
         bool complete_tree;
+        const u32 chunk_size =
+            budget.piece_elements(sizeof(tfrag3::PreloadedVertex), num_verts_left_in_tree);
 
-        if (num_verts_left_in_tree > CHUNK_SIZE) {
+        if (num_verts_left_in_tree > chunk_size) {
           complete_tree = false;
           // should only do partial
           start_vert_for_chunk = m_next_vert;
-          end_vert_for_chunk = start_vert_for_chunk + CHUNK_SIZE;
-          m_next_vert += CHUNK_SIZE;
+          end_vert_for_chunk = start_vert_for_chunk + chunk_size;
+          m_next_vert += chunk_size;
         } else {
           // should do all!
           start_vert_for_chunk = m_next_vert;
@@ -335,7 +645,7 @@ class TieLoadStage : public LoaderStage {
                           upload_size, tree.unpacked.vertices.data() + start_vert_for_chunk);
         }
 
-        uploaded_bytes += upload_size;
+        budget.uploaded(upload_size);
 
         if (complete_tree) {
           // and move on to next tree
@@ -358,7 +668,7 @@ class TieLoadStage : public LoaderStage {
           }
         }
 
-        if (timer.getMs() > LOAD_BUDGET || (uploaded_bytes / 1024) > 2048) {
+        if (budget.exhausted()) {
           return false;
         }
       }
@@ -394,6 +704,7 @@ class TieLoadStage : public LoaderStage {
 
             glBufferData(GL_ELEMENT_ARRAY_BUFFER, wind_idx_buffer_len * sizeof(u32), temp.data(),
                          GL_STATIC_DRAW);
+            budget.uploaded(wind_idx_buffer_len * sizeof(u32));
             abort = true;
           }
         }
@@ -405,15 +716,13 @@ class TieLoadStage : public LoaderStage {
       m_next_vert = 0;
       m_next_tree = 0;
 
-      if (timer.getMs() > LOAD_BUDGET) {
+      if (budget.exhausted()) {
         return false;
       }
     }
 
     if (!m_indices_done) {
       auto evt = scoped_prof("tie-ind");
-      constexpr u32 CHUNK_SIZE = 32768 * 8;
-      u32 uploaded_bytes = 0;
 
       while (true) {
         const auto& tree = data.lev_data->level->tie_trees[m_next_geo][m_next_tree];
@@ -424,13 +733,14 @@ class TieLoadStage : public LoaderStage {
         size_t end_ind_for_chunk;
 
         bool complete_tree;
+        const u32 chunk_size = budget.piece_elements(sizeof(u32), num_inds_left_in_tree);
 
-        if (num_inds_left_in_tree > CHUNK_SIZE) {
+        if (num_inds_left_in_tree > chunk_size) {
           complete_tree = false;
           // should only do partial
           start_ind_for_chunk = m_next_vert;
-          end_ind_for_chunk = start_ind_for_chunk + CHUNK_SIZE;
-          m_next_vert += CHUNK_SIZE;
+          end_ind_for_chunk = start_ind_for_chunk + chunk_size;
+          m_next_vert += chunk_size;
         } else {
           // should do all!
           start_ind_for_chunk = m_next_vert;
@@ -443,7 +753,7 @@ class TieLoadStage : public LoaderStage {
         u32 upload_size = (end_ind_for_chunk - start_ind_for_chunk) * sizeof(u32);
         glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, start_ind_for_chunk * sizeof(u32), upload_size,
                         tree.unpacked.indices.data() + start_ind_for_chunk);
-        uploaded_bytes += upload_size;
+        budget.uploaded(upload_size);
 
         if (complete_tree) {
           // and move on to next tree
@@ -467,7 +777,7 @@ class TieLoadStage : public LoaderStage {
           }
         }
 
-        if (timer.getMs() > LOAD_BUDGET || (uploaded_bytes / 1024) > 2048) {
+        if (budget.exhausted()) {
           return false;
         }
       }
@@ -501,7 +811,7 @@ class TieLoadStage : public LoaderStage {
 class CollideLoaderStage : public LoaderStage {
  public:
   CollideLoaderStage() : LoaderStage("collide") {}
-  bool run(Timer& /*timer*/, LoaderInput& data) override {
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     if (m_done) {
       return true;
     }
@@ -516,15 +826,23 @@ class CollideLoaderStage : public LoaderStage {
       return false;
     }
 
-    u32 start = m_vtx;
-    u32 end = std::min((u32)data.lev_data->level->collision.vertices.size(), start + 32768);
+    const auto& verts = data.lev_data->level->collision.vertices;
     glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->collide_vertices);
-    glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(tfrag3::CollisionMesh::Vertex),
-                    (end - start) * sizeof(tfrag3::CollisionMesh::Vertex),
-                    data.lev_data->level->collision.vertices.data() + start);
-    m_vtx = end;
+    while (m_vtx < verts.size()) {
+      u32 start = m_vtx;
+      u32 end = start + budget.piece_elements(sizeof(tfrag3::CollisionMesh::Vertex),
+                                              verts.size() - start);
+      u32 upload_size = (end - start) * sizeof(tfrag3::CollisionMesh::Vertex);
+      glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(tfrag3::CollisionMesh::Vertex), upload_size,
+                      verts.data() + start);
+      budget.uploaded(upload_size);
+      m_vtx = end;
+      if (budget.exhausted()) {
+        break;
+      }
+    }
 
-    if (m_vtx == data.lev_data->level->collision.vertices.size()) {
+    if (m_vtx == verts.size()) {
       m_done = true;
       return true;
     } else {
@@ -546,7 +864,7 @@ class CollideLoaderStage : public LoaderStage {
 class StallLoaderStage : public LoaderStage {
  public:
   StallLoaderStage() : LoaderStage("stall") {}
-  bool run(Timer&, LoaderInput& /*data*/) override {
+  bool run(UploadBudget&, LoaderInput& /*data*/) override {
     m_count++;
     if (m_count > 10) {
       return true;
@@ -570,7 +888,7 @@ class HfragLoaderStage : public LoaderStage {
     m_idx = 0;
   }
 
-  bool run(Timer&, LoaderInput& data) override {
+  bool run(UploadBudget& budget, LoaderInput& data) override {
     if (m_done) {
       return true;
     }
@@ -591,12 +909,8 @@ class HfragLoaderStage : public LoaderStage {
     }
 
     if (!m_vtx_uploaded) {
-      u32 start = m_idx;
-      m_idx = std::min(start + 32768, (u32)data.lev_data->level->hfrag.indices.size());
-      glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->hfrag_indices);
-      glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(u32), (m_idx - start) * sizeof(u32),
-                      data.lev_data->level->hfrag.indices.data() + start);
-      if (m_idx != data.lev_data->level->hfrag.indices.size()) {
+      if (!upload_pieces(budget, GL_ARRAY_BUFFER, data.lev_data->hfrag_indices,
+                         data.lev_data->level->hfrag.indices, &m_idx)) {
         return false;
       } else {
         m_idx = 0;
@@ -604,14 +918,8 @@ class HfragLoaderStage : public LoaderStage {
       }
     }
 
-    u32 start = m_idx;
-    m_idx = std::min(start + 32768, (u32)data.lev_data->level->hfrag.vertices.size());
-    glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->hfrag_vertices);
-    glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(tfrag3::HfragmentVertex),
-                    (m_idx - start) * sizeof(tfrag3::HfragmentVertex),
-                    data.lev_data->level->hfrag.vertices.data() + start);
-
-    if (m_idx != data.lev_data->level->hfrag.vertices.size()) {
+    if (!upload_pieces(budget, GL_ARRAY_BUFFER, data.lev_data->hfrag_vertices,
+                       data.lev_data->level->hfrag.vertices, &m_idx)) {
       return false;
     } else {
       m_done = true;
@@ -635,7 +943,7 @@ void MercLoaderStage::reset() {
   m_idx = 0;
 }
 
-bool MercLoaderStage::run(Timer& /*timer*/, LoaderInput& data) {
+bool MercLoaderStage::run(UploadBudget& budget, LoaderInput& data) {
   if (m_done) {
     return true;
   }
@@ -656,12 +964,8 @@ bool MercLoaderStage::run(Timer& /*timer*/, LoaderInput& data) {
   }
 
   if (!m_vtx_uploaded) {
-    u32 start = m_idx;
-    m_idx = std::min(start + 32768, (u32)data.lev_data->level->merc_data.indices.size());
-    glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->merc_indices);
-    glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(u32), (m_idx - start) * sizeof(u32),
-                    data.lev_data->level->merc_data.indices.data() + start);
-    if (m_idx != data.lev_data->level->merc_data.indices.size()) {
+    if (!upload_pieces(budget, GL_ARRAY_BUFFER, data.lev_data->merc_indices,
+                       data.lev_data->level->merc_data.indices, &m_idx)) {
       return false;
     } else {
       m_idx = 0;
@@ -669,20 +973,24 @@ bool MercLoaderStage::run(Timer& /*timer*/, LoaderInput& data) {
     }
   }
 
-  u32 start = m_idx;
-  m_idx = std::min(start + 32768, (u32)data.lev_data->level->merc_data.vertices.size());
-  glBindBuffer(GL_ARRAY_BUFFER, data.lev_data->merc_vertices);
-  glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(tfrag3::MercVertex),
-                  (m_idx - start) * sizeof(tfrag3::MercVertex),
-                  data.lev_data->level->merc_data.vertices.data() + start);
-
-  if (m_idx != data.lev_data->level->merc_data.vertices.size()) {
+  if (!upload_pieces(budget, GL_ARRAY_BUFFER, data.lev_data->merc_vertices,
+                     data.lev_data->level->merc_data.vertices, &m_idx)) {
     return false;
   } else {
     m_done = true;
-    for (auto& model : data.lev_data->level->merc_data.models) {
-      data.lev_data->merc_model_lookup[model.name] = &model;
-      (*data.mercs)[model.name].push_back({&model, data.lev_data->load_id, data.lev_data});
+    auto* lev = data.lev_data;
+    for (auto& model : lev->level->merc_data.models) {
+      lev->merc_model_lookup[model.name] = &model;
+    }
+    auto add_models = [lev, mercs = data.mercs] {
+      for (auto& model : lev->level->merc_data.models) {
+        mercs->add(model.name, {&model, lev->load_id, lev});
+      }
+    };
+    if (data.publish) {
+      data.publish->push_back(add_models);
+    } else {
+      add_models();
     }
     return true;
   }
@@ -693,6 +1001,7 @@ std::vector<std::unique_ptr<LoaderStage>> make_loader_stages() {
   std::vector<std::unique_ptr<LoaderStage>> ret;
   ret.push_back(std::make_unique<TieLoadStage>());
   ret.push_back(std::make_unique<TextureLoaderStage>());
+  ret.push_back(std::make_unique<TextureArrayLoaderStage>());
   ret.push_back(std::make_unique<TfragLoadStage>());
   ret.push_back(std::make_unique<ShrubLoadStage>());
   ret.push_back(std::make_unique<CollideLoaderStage>());
@@ -3,12 +3,25 @@
 #include "game/graphics/opengl_renderer/loader/common.h"
 
 std::vector<std::unique_ptr<LoaderStage>> make_loader_stages();
-u64 add_texture(TexturePool& pool, const tfrag3::Texture& tex, bool is_common);
+u64 add_texture(TexturePool& pool,
+                const tfrag3::Texture& tex,
+                bool is_common,
+                std::vector<std::function<void()>>* publish = nullptr,
+                u32 first_level = 0);
+
+// Texture streaming: big compressed textures are loaded from a smaller mip, and the larger mips
+// are uploaded one at a time after the level is loaded.
+// the mip a compressed texture is loaded from with streaming, 0 if it isn't streamed.
+u32 first_streamed_level(const tfrag3::Texture& tex);
+// the bytes of a compressed mip chain before a level
+u32 compressed_mip_offset(const tfrag3::Texture& tex, u32 level);
+// upload the mip above base_level and sample from it. Returns the bytes uploaded.
+u32 upload_next_texture_mip(GLuint gl_tex, const tfrag3::Texture& tex, u32 base_level);
 
 class MercLoaderStage : public LoaderStage {
  public:
   MercLoaderStage();
-  bool run(Timer& timer, LoaderInput& data) override;
+  bool run(UploadBudget& budget, LoaderInput& data) override;
   void reset() override;
 
  private:
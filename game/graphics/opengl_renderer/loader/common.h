@@ -1,16 +1,36 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "common/common_types.h"
 #include "common/custom_data/Tfrag3Data.h"
+#include "common/util/Assert.h"
 #include "common/util/Timer.h"
 
 #include "game/graphics/texture/TexturePool.h"
 
+#include "fmt/core.h"
 #include "third-party/glad/include/glad/glad.h"
 
 struct LevelData {
   std::unique_ptr<tfrag3::Level> level;
   std::vector<GLuint> textures;
+  // per texture, the largest mip that is uploaded. Above 0, the rest are still being streamed.
+  std::vector<u8> texture_base_levels;
+
+  // with tfrag_texture_arrays, tfrag textures are also packed into GL_TEXTURE_2D_ARRAYs, with one
+  // array per texture size, so switching between them is a uniform change instead of a bind.
+  struct TextureArraySlot {
+    s16 array = -1;  // -1 if the texture isn't in an array
+    u16 layer = 0;
+  };
+  std::vector<GLuint> texture_arrays;
+  std::vector<TextureArraySlot> texture_array_slots;  // per texture
   u64 load_id = UINT64_MAX;
 
   struct TieOpenGL {
@@ -32,6 +52,8 @@ struct LevelData {
   GLuint hfrag_indices;
 
   int frames_since_last_used = 0;
+  // estimated GPU memory used by this level, set when it is done loading.
+  size_t gpu_bytes = 0;
 };
 
 struct MercRef {
@@ -43,16 +65,114 @@ struct MercRef {
   }
 };
 
+// a merc model name, resolved by MercModelRegistry
+using MercHandle = u32;
+
+/*!
+ * The merc models of the loaded levels, by name. A name gets a handle the first time it's seen,
+ * which stays valid for the life of the loader, and finds whichever level has the model loaded at
+ * the time. This lets the renderer look up a name once instead of every frame. Levels add and
+ * remove their models on the render thread, which is also the only thread that looks them up.
+ */
+class MercModelRegistry {
+ public:
+  MercHandle handle(const std::string& name) {
+    auto [it, added] = m_handles.try_emplace(name, m_models.size());
+    if (added) {
+      m_models.emplace_back();
+    }
+    return it->second;
+  }
+
+  std::optional<MercRef> get(MercHandle handle) const {
+    const auto& refs = m_models.at(handle);
+    if (refs.empty()) {
+      return std::nullopt;
+    }
+    return refs.front();
+  }
+
+  void add(const std::string& name, const MercRef& ref) { m_models[handle(name)].push_back(ref); }
+
+  void remove(const std::string& name, const MercRef& ref) {
+    auto& refs = m_models[handle(name)];
+    auto it = std::find(refs.begin(), refs.end(), ref);
+    ASSERT_MSG(it != refs.end(), fmt::format("missing merc: {}\n", name));
+    refs.erase(it);
+  }
+
+ private:
+  std::unordered_map<std::string, MercHandle> m_handles;
+  std::vector<std::vector<MercRef>> m_models;  // by handle, the levels that have the model
+};
+
 struct LoaderInput {
   LevelData* lev_data;
   TexturePool* tex_pool;
-  std::unordered_map<std::string, std::vector<MercRef>>* mercs;
+  MercModelRegistry* mercs;
+  // if set, the changes the renderer can see (the texture pool and merc models) are added here
+  // instead of being made, to run on the render thread once the uploads are done on the GPU.
+  std::vector<std::function<void()>>* publish = nullptr;
+  // load big compressed textures without their larger mips, see first_streamed_level.
+  bool stream_textures = false;
+  // also pack tfrag textures into texture arrays.
+  bool tfrag_texture_arrays = false;
+};
+
+/*!
+ * The time the loader stages can spend uploading to the GPU in one frame, shared by all of them.
+ * Uploads are split into pieces that should fit in the time that's left, using the measured upload
+ * rate, so one big upload can't take the whole frame.
+ */
+class UploadBudget {
+ public:
+  static constexpr u32 kMinPieceBytes = 16 * 1024;
+  static constexpr u32 kMaxPieceBytes = 2 * 1024 * 1024;
+  static constexpr float kDefaultBudgetMs = 4.5f;
+  static constexpr float kMinBudgetMs = 1.f;
+  static constexpr float kMaxBudgetMs = 8.f;
+
+  void start_frame(float budget_ms) {
+    m_timer.start();
+    m_budget_ms = budget_ms;
+    m_last_upload_ms = 0;
+  }
+
+  /*!
+   * How many elements of elt_size bytes to upload next, out of remaining. At least one, so loads
+   * always make progress.
+   */
+  u32 piece_elements(u32 elt_size, u32 remaining) const {
+    float left_ms = std::max(0.f, m_budget_ms - used_ms());
+    u64 bytes = std::clamp<u64>(left_ms * m_bytes_per_ms, kMinPieceBytes, kMaxPieceBytes);
+    return std::min<u64>(remaining, std::max<u64>(1, bytes / elt_size));
+  }
+
+  // call after each upload, to measure the upload rate
+  void uploaded(u64 bytes) {
+    float now = used_ms();
+    float ms = now - m_last_upload_ms;
+    m_last_upload_ms = now;
+    if (bytes >= kMinPieceBytes && ms > 0.01f) {
+      m_bytes_per_ms = 0.8 * m_bytes_per_ms + 0.2 * (bytes / ms);
+    }
+  }
+
+  bool exhausted() const { return used_ms() >= m_budget_ms; }
+  float used_ms() const { return m_timer.getMs(); }
+  float budget_ms() const { return m_budget_ms; }
+
+ private:
+  Timer m_timer;
+  float m_budget_ms = kDefaultBudgetMs;
+  float m_last_upload_ms = 0;
+  double m_bytes_per_ms = 512 * 1024;  // the measured rate, including the work between uploads
 };
 
 class LoaderStage {
  public:
   LoaderStage(const std::string& name) : m_name(name) {}
-  virtual bool run(Timer& timer, LoaderInput& data) = 0;
+  virtual bool run(UploadBudget& budget, LoaderInput& data) = 0;
   virtual void reset() = 0;
   virtual ~LoaderStage() = default;
   const std::string& name() const { return m_name; }
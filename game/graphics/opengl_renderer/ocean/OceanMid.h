@@ -122,11 +122,7 @@ class OceanMid {
 
   void sq_buffer(Mask mask, const Vf& val, u16 addr) {
     ASSERT(addr < 1024);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        m_vu_data[addr].data[i] = val[i];
-      }
-    }
+    vu_masked_store(m_vu_data[addr].data, mask, val.load());
   }
 
   void ilw_buffer(Mask mask, u16& dest, u16 addr) {
@@ -172,11 +168,7 @@ class OceanMid {
 
   void lq_buffer(Mask mask, Vf& dest, u16 addr) {
     ASSERT(addr < 1024);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        dest[i] = m_vu_data[addr].data[i];
-      }
-    }
+    vu_masked_store(dest.data, mask, m_vu_data[addr].load());
   }
 
   struct Vu {
@@ -11,7 +11,9 @@ OceanNear::OceanNear(const std::string& name, int my_id)
   }
 }
 
-void OceanNear::draw_debug_window() {}
+void OceanNear::draw_debug_window() {
+  m_texture_renderer.draw_debug_window();
+}
 
 void OceanNear::init_textures(TexturePool& pool, GameVersion version) {
   m_texture_renderer.init_textures(pool, version);
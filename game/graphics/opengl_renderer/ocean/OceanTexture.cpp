@@ -1,5 +1,7 @@
 #include "OceanTexture.h"
 
+#include <optional>
+
 #include "game/graphics/opengl_renderer/AdgifHandler.h"
 
 #include "third-party/imgui/imgui.h"
@@ -75,18 +77,38 @@ void OceanTexture::init_textures(TexturePool& pool, GameVersion version) {
 }
 
 void OceanTexture::draw_debug_window() {
+  ImGui::SliderInt("Update every N frames", &m_update_interval, 1, 4);
   if (m_tex0_gpu) {
     ImGui::Image((ImTextureID)(intptr_t)m_tex0_gpu->gpu_textures.at(0).gl,
                  ImVec2(m_tex0_gpu->w, m_tex0_gpu->h));
   }
 }
 
+/*!
+ * Should the texture be drawn this frame? It's always drawn the first time, and then every
+ * m_update_interval frames. Between updates, the last texture is used again.
+ */
+bool OceanTexture::should_update(const SharedRenderState* render_state) {
+  if (m_has_texture && render_state->frame_idx >= m_last_update_frame &&
+      render_state->frame_idx - m_last_update_frame < (u64)m_update_interval) {
+    return false;
+  }
+  m_has_texture = true;
+  m_last_update_frame = render_state->frame_idx;
+  return true;
+}
+
 void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
                                              SharedRenderState* render_state,
                                              ScopedProfilerNode& prof) {
+  // the DMA is always read, but the texture is only drawn on the frames it's updated.
+  const bool update = should_update(render_state);
   // if we're doing mipmaps, render to temp.
   // otherwise, render directly to target.
-  FramebufferTexturePairContext ctxt(m_generate_mipmaps ? m_temp_texture : m_result_texture);
+  std::optional<FramebufferTexturePairContext> ctxt;
+  if (update) {
+    ctxt.emplace(m_generate_mipmaps ? m_temp_texture : m_result_texture);
+  }
   // render to the first texture
   {
     // (set-display-gs-state arg0 ocean-tex-page-0 128 128 0 0)
@@ -157,7 +179,9 @@ void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
     ASSERT(data.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(data.vifcode0().immediate == TexVu1Prog::START);
     ASSERT(data.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L1_PC();
+    if (update) {
+      run_L1_PC();
+    }
   }
 
   // loop over vertex groups
@@ -178,7 +202,9 @@ void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
     ASSERT(call.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(call.vifcode0().immediate == TexVu1Prog::REST);
     ASSERT(call.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L2_PC();
+    if (update) {
+      run_L2_PC();
+    }
   }
 
   // last upload does something weird...
@@ -214,7 +240,9 @@ void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
     ASSERT(data.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(data.vifcode0().immediate == TexVu1Prog::REST);
     ASSERT(data.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L2_PC();
+    if (update) {
+      run_L2_PC();
+    }
   }
 
   // last call
@@ -227,11 +255,13 @@ void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
     // this program does nothing.
   }
 
-  flush(render_state, prof);
-  if (m_generate_mipmaps) {
-    // if we did mipmaps, the above code rendered to temp, and now we need to generate mipmaps
-    // in the real output
-    make_texture_with_mipmaps(render_state, prof);
+  if (update) {
+    flush(render_state, prof);
+    if (m_generate_mipmaps) {
+      // if we did mipmaps, the above code rendered to temp, and now we need to generate mipmaps
+      // in the real output
+      make_texture_with_mipmaps(render_state, prof);
+    }
   }
 
   // give to gpu!
@@ -241,9 +271,14 @@ void OceanTexture::handle_ocean_texture_jak1(DmaFollower& dma,
 void OceanTexture::handle_ocean_texture_jak2(DmaFollower& dma,
                                              SharedRenderState* render_state,
                                              ScopedProfilerNode& prof) {
+  // the DMA is always read, but the texture is only drawn on the frames it's updated.
+  const bool update = should_update(render_state);
   // if we're doing mipmaps, render to temp.
   // otherwise, render directly to target.
-  FramebufferTexturePairContext ctxt(m_generate_mipmaps ? m_temp_texture : m_result_texture);
+  std::optional<FramebufferTexturePairContext> ctxt;
+  if (update) {
+    ctxt.emplace(m_generate_mipmaps ? m_temp_texture : m_result_texture);
+  }
   // render to the first texture
   {
     // (set-display-gs-state arg0 21 128 128 0 0)
@@ -316,7 +351,9 @@ void OceanTexture::handle_ocean_texture_jak2(DmaFollower& dma,
     ASSERT(data.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(data.vifcode0().immediate == TexVu1Prog::START);
     ASSERT(data.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L1_PC_jak2();
+    if (update) {
+      run_L1_PC_jak2();
+    }
   }
 
   // loop over vertex groups
@@ -337,7 +374,9 @@ void OceanTexture::handle_ocean_texture_jak2(DmaFollower& dma,
     ASSERT(call.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(call.vifcode0().immediate == TexVu1Prog::REST);
     ASSERT(call.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L2_PC_jak2();
+    if (update) {
+      run_L2_PC_jak2();
+    }
   }
 
   // last upload does something weird...
@@ -373,7 +412,9 @@ void OceanTexture::handle_ocean_texture_jak2(DmaFollower& dma,
     ASSERT(data.vifcode0().kind == VifCode::Kind::MSCALF);
     ASSERT(data.vifcode0().immediate == TexVu1Prog::REST);
     ASSERT(data.vifcode1().kind == VifCode::Kind::STMOD);  // not sure why...
-    run_L2_PC_jak2();
+    if (update) {
+      run_L2_PC_jak2();
+    }
   }
 
   // last call
@@ -386,11 +427,13 @@ void OceanTexture::handle_ocean_texture_jak2(DmaFollower& dma,
     // this program does nothing.
   }
 
-  flush(render_state, prof);
-  if (m_generate_mipmaps) {
-    // if we did mipmaps, the above code rendered to temp, and now we need to generate mipmaps
-    // in the real output
-    make_texture_with_mipmaps(render_state, prof);
+  if (update) {
+    flush(render_state, prof);
+    if (m_generate_mipmaps) {
+      // if we did mipmaps, the above code rendered to temp, and now we need to generate mipmaps
+      // in the real output
+      make_texture_with_mipmaps(render_state, prof);
+    }
   }
 
   // (reset-display-gs-state *display* arg0)
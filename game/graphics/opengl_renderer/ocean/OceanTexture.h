@@ -36,9 +36,16 @@ class OceanTexture {
   void destroy_pc();
 
   void make_texture_with_mipmaps(SharedRenderState* render_state, ScopedProfilerNode& prof);
+  bool should_update(const SharedRenderState* render_state);
 
   bool m_generate_mipmaps;
 
+  // the texture follows the slowly moving waves, so it can be drawn less often than every frame to
+  // save the VU program and the draws. 1 draws it every frame, like the game.
+  int m_update_interval = 1;
+  u64 m_last_update_frame = 0;
+  bool m_has_texture = false;
+
   static constexpr int TEX0_SIZE = 128;
   static constexpr int NUM_MIPS = 8;
   FramebufferTexturePair m_result_texture;
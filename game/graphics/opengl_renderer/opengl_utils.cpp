@@ -1,8 +1,12 @@
 #include "opengl_utils.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
 
+#include "common/log/log.h"
 #include "common/util/Assert.h"
 
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
@@ -132,11 +136,19 @@ FullScreenDraw::FullScreenDraw() {
 
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
+
+  // like the GL_LINEAR filter of glBlitFramebuffer, without changing the texture's own filter.
+  glGenSamplers(1, &m_linear_sampler);
+  glSamplerParameteri(m_linear_sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glSamplerParameteri(m_linear_sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glSamplerParameteri(m_linear_sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glSamplerParameteri(m_linear_sampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 }
 
 FullScreenDraw::~FullScreenDraw() {
   glDeleteVertexArrays(1, &m_vao);
   glDeleteBuffers(1, &m_vertex_buffer);
+  glDeleteSamplers(1, &m_linear_sampler);
 }
 
 void FullScreenDraw::draw(const math::Vector4f& color,
@@ -154,6 +166,45 @@ void FullScreenDraw::draw(const math::Vector4f& color,
   glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
 
+void FullScreenDraw::draw_texture(GLuint texture,
+                                  int samples,
+                                  bool scaled,
+                                  bool bicubic,
+                                  float brightness,
+                                  SharedRenderState* render_state,
+                                  ScopedProfilerNode& prof) {
+  glBindVertexArray(m_vao);
+  glBindBuffer(GL_ARRAY_BUFFER, m_vertex_buffer);
+  auto& shader = render_state->shaders[ShaderId::POST_PROCESSING];
+  shader.activate();
+  // the two samplers can't share a texture unit, even though only one is used.
+  glUniform1i(glGetUniformLocation(shader.id(), "tex_T0"), 0);
+  glUniform1i(glGetUniformLocation(shader.id(), "tex_ms"), 1);
+  glUniform1i(glGetUniformLocation(shader.id(), "samples"), samples);
+  glUniform1i(glGetUniformLocation(shader.id(), "scaled"), scaled);
+  glUniform1i(glGetUniformLocation(shader.id(), "bicubic"), bicubic);
+  glUniform4f(glGetUniformLocation(shader.id(), "fragment_color"), 0, 0, 0, brightness);
+  if (samples) {
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, texture);
+  } else {
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindSampler(0, m_linear_sampler);
+  }
+
+  prof.add_tri(2);
+  prof.add_draw_call();
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+  if (samples) {
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, 0);
+  } else {
+    glBindSampler(0, 0);
+  }
+  glActiveTexture(GL_TEXTURE0);
+}
+
 FramebufferCopier::FramebufferCopier() {
   glGenFramebuffers(1, &m_fbo);
   glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
@@ -181,10 +232,10 @@ FramebufferCopier::~FramebufferCopier() {
   glDeleteFramebuffers(1, &m_fbo);
 }
 
-void FramebufferCopier::copy_now(int render_fb_w, int render_fb_h, GLuint render_fb) {
-  if (m_fbo_width != render_fb_w || m_fbo_height != render_fb_h) {
-    m_fbo_width = render_fb_w;
-    m_fbo_height = render_fb_h;
+void FramebufferCopier::resize(int w, int h) {
+  if (m_fbo_width != w || m_fbo_height != h) {
+    m_fbo_width = w;
+    m_fbo_height = h;
 
     glBindTexture(GL_TEXTURE_2D, m_fbo_texture);
 
@@ -193,23 +244,58 @@ void FramebufferCopier::copy_now(int render_fb_w, int render_fb_h, GLuint render
 
     glBindTexture(GL_TEXTURE_2D, 0);
   }
+}
 
+void FramebufferCopier::blit_from(GLuint render_fb, int x0, int y0, int x1, int y1) {
   glBindFramebuffer(GL_READ_FRAMEBUFFER, render_fb);
   glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo);
 
-  glBlitFramebuffer(0,                    // srcX0
-                    0,                    // srcY0
-                    render_fb_w,          // srcX1
-                    render_fb_h,          // srcY1
-                    0,                    // dstX0
-                    0,                    // dstY0
-                    m_fbo_width,          // dstX1
-                    m_fbo_height,         // dstY1
+  glBlitFramebuffer(x0,                   // srcX0
+                    y0,                   // srcY0
+                    x1,                   // srcX1
+                    y1,                   // srcY1
+                    x0,                   // dstX0
+                    y0,                   // dstY0
+                    x1,                   // dstX1
+                    y1,                   // dstY1
                     GL_COLOR_BUFFER_BIT,  // mask
                     GL_NEAREST            // filter
   );
 
   glBindFramebuffer(GL_FRAMEBUFFER, render_fb);
+  m_last_copy_w = x1 - x0;
+  m_last_copy_h = y1 - y0;
+}
+
+void FramebufferCopier::copy_now(int render_fb_w, int render_fb_h, GLuint render_fb) {
+  resize(render_fb_w, render_fb_h);
+  blit_from(render_fb, 0, 0, render_fb_w, render_fb_h);
+}
+
+void FramebufferCopier::copy_region_now(int render_fb_w,
+                                        int render_fb_h,
+                                        GLuint render_fb,
+                                        const TexCoordBounds& bounds) {
+  resize(render_fb_w, render_fb_h);
+  if (bounds.empty()) {
+    m_last_copy_w = 0;
+    m_last_copy_h = 0;
+    return;
+  }
+
+  // the texture is the same size as the framebuffer, so texture coordinates map directly to pixels.
+  // linear filtering reads one texel past the coordinate, and one more covers rounding.
+  constexpr int kBorder = 2;
+  auto to_pixel = [](float coord, int size, bool round_up) {
+    float px = std::clamp(coord, 0.f, 1.f) * size;
+    int result = (round_up ? (int)std::ceil(px) + kBorder : (int)std::floor(px) - kBorder);
+    return std::clamp(result, 0, size);
+  };
+  const int x0 = to_pixel(bounds.min_s, render_fb_w, false);
+  const int x1 = to_pixel(bounds.max_s, render_fb_w, true);
+  const int y0 = to_pixel(bounds.min_t, render_fb_h, false);
+  const int y1 = to_pixel(bounds.max_t, render_fb_h, true);
+  blit_from(render_fb, x0, y0, x1, y1);
 }
 
 void FramebufferCopier::copy_back_now(int render_fb_w, int render_fb_h, GLuint render_fb) {
@@ -230,3 +316,288 @@ void FramebufferCopier::copy_back_now(int render_fb_w, int render_fb_h, GLuint r
 
   glBindFramebuffer(GL_FRAMEBUFFER, render_fb);
 }
+
+GpuBucketTimers::~GpuBucketTimers() {
+  for (auto& frame : m_frames) {
+    if (!frame.queries.empty()) {
+      glDeleteQueries(frame.queries.size(), frame.queries.data());
+    }
+  }
+}
+
+bool GpuBucketTimers::try_resolve(Frame& frame) {
+  frame.pending = false;
+  if (!frame.last_issued) {
+    return true;
+  }
+  // queries finish in order, so the frame is done once the last one is.
+  GLint available = 0;
+  glGetQueryObjectiv(frame.last_issued, GL_QUERY_RESULT_AVAILABLE, &available);
+  if (!available) {
+    frame.pending = true;
+    return false;
+  }
+
+  const int num_buckets = frame.issued.size();
+  m_last_durations.assign(num_buckets, -1.f);
+  m_new_frame_duration = 0;
+  for (int i = 0; i < num_buckets; i++) {
+    if (frame.issued[i]) {
+      GLuint64 start = 0, end = 0;
+      glGetQueryObjectui64v(frame.queries[2 * i], GL_QUERY_RESULT, &start);
+      glGetQueryObjectui64v(frame.queries[2 * i + 1], GL_QUERY_RESULT, &end);
+      m_last_durations[i] = (end - start) * 1e-9f;
+      m_new_frame_duration += m_last_durations[i];
+    }
+  }
+  return true;
+}
+
+void GpuBucketTimers::begin_frame(int num_buckets) {
+  // read back everything that's done, oldest first.
+  for (int i = 0; i < kFramesInFlight; i++) {
+    auto& frame = m_frames[(m_frame_idx + i) % kFramesInFlight];
+    if (frame.pending && !try_resolve(frame)) {
+      break;
+    }
+  }
+
+  auto& frame = m_frames[m_frame_idx];
+  // still not done after kFramesInFlight frames, give up on it.
+  frame.pending = false;
+  if ((int)frame.queries.size() != 2 * num_buckets) {
+    if (!frame.queries.empty()) {
+      glDeleteQueries(frame.queries.size(), frame.queries.data());
+    }
+    frame.queries.resize(2 * num_buckets);
+    glGenQueries(frame.queries.size(), frame.queries.data());
+  }
+  frame.issued.assign(num_buckets, 0);
+  frame.last_issued = 0;
+  m_in_frame = true;
+}
+
+void GpuBucketTimers::begin_bucket(int bucket) {
+  if (m_in_frame) {
+    glQueryCounter(m_frames[m_frame_idx].queries.at(2 * bucket), GL_TIMESTAMP);
+  }
+}
+
+void GpuBucketTimers::end_bucket(int bucket) {
+  if (m_in_frame) {
+    auto& frame = m_frames[m_frame_idx];
+    frame.last_issued = frame.queries.at(2 * bucket + 1);
+    glQueryCounter(frame.last_issued, GL_TIMESTAMP);
+    frame.issued.at(bucket) = 1;
+  }
+}
+
+void GpuBucketTimers::end_frame() {
+  if (m_in_frame) {
+    m_frames[m_frame_idx].pending = true;
+    m_frame_idx = (m_frame_idx + 1) % kFramesInFlight;
+    m_in_frame = false;
+  }
+}
+
+namespace {
+// glad is generated for GL 4.3, so it doesn't have the GL 4.4 / ARB_buffer_storage API.
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+typedef void(APIENTRYP BufferStorageProc)(GLenum target,
+                                          GLsizeiptr size,
+                                          const void* data,
+                                          GLbitfield flags);
+BufferStorageProc g_buffer_storage = nullptr;
+typedef void(APIENTRYP MaxShaderCompilerThreadsProc)(GLuint count);
+
+bool has_extension(const char* name) {
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; i++) {
+    const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, i);
+    if (ext && !strcmp(ext, name)) {
+      return true;
+    }
+  }
+  return false;
+}
+}  // namespace
+
+void load_buffer_storage(GLADloadproc load) {
+  g_buffer_storage = nullptr;
+  if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 4) ||
+      has_extension("GL_ARB_buffer_storage")) {
+    g_buffer_storage = (BufferStorageProc)load("glBufferStorage");
+  }
+  lg::info("Streaming buffers {} persistently mapped", g_buffer_storage ? "are" : "are not");
+}
+
+void load_parallel_shader_compile(GLADloadproc load) {
+  MaxShaderCompilerThreadsProc max_threads = nullptr;
+  if (has_extension("GL_KHR_parallel_shader_compile")) {
+    max_threads = (MaxShaderCompilerThreadsProc)load("glMaxShaderCompilerThreadsKHR");
+  } else if (has_extension("GL_ARB_parallel_shader_compile")) {
+    max_threads = (MaxShaderCompilerThreadsProc)load("glMaxShaderCompilerThreadsARB");
+  }
+  if (max_threads) {
+    // 0xffffffff lets the driver pick the number of threads.
+    max_threads(0xffffffff);
+  }
+  lg::info("Parallel shader compile is {}", max_threads ? "enabled" : "not supported");
+}
+
+StreamingBuffer::StreamingBuffer(u32 size, u32 num_segments) {
+  ASSERT(num_segments > 0 && num_segments <= 32);
+  m_segment_size = (size + num_segments - 1) / num_segments;
+  m_size = m_segment_size * num_segments;
+  m_segment_fences.resize(num_segments, 0);
+  m_segment_written.resize(num_segments, 0);
+
+  glGenBuffers(1, &m_buffer);
+  glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+  if (g_buffer_storage) {
+    constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    g_buffer_storage(GL_COPY_WRITE_BUFFER, m_size, nullptr, flags);
+    m_mapped = (u8*)glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, m_size, flags);
+    if (!m_mapped) {
+      // storage from glBufferStorage can't be resized, so start over with a normal buffer.
+      lg::warn("Failed to persistently map a {} byte streaming buffer", m_size);
+      glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+      glDeleteBuffers(1, &m_buffer);
+      glGenBuffers(1, &m_buffer);
+      glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+    }
+  }
+  if (!m_mapped) {
+    glBufferData(GL_COPY_WRITE_BUFFER, m_size, nullptr, GL_STREAM_DRAW);
+  }
+  glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+StreamingBuffer::~StreamingBuffer() {
+  for (auto& fence : m_fences) {
+    glDeleteSync(fence.sync);
+  }
+  if (m_mapped) {
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+    glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  }
+  glDeleteBuffers(1, &m_buffer);
+}
+
+void StreamingBuffer::wait_for_fence(u64 seq) {
+  // fences are signaled in order, so every fence before this one is done too.
+  while (!m_fences.empty() && m_fences.front().seq <= seq) {
+    auto sync = m_fences.front().sync;
+    while (glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {
+    }
+    glDeleteSync(sync);
+    m_fences.pop_front();
+  }
+}
+
+u32 StreamingBuffer::allocate(u32 size, u32 alignment) {
+  ASSERT_MSG(size <= m_size,
+             fmt::format("Streaming buffer upload of {} bytes, but the buffer is {}", size, m_size));
+  u32 offset = ((m_head + alignment - 1) / alignment) * alignment;
+  const bool wrapped = offset + size > m_size;
+  if (wrapped) {
+    offset = 0;
+  }
+  if (size == 0) {
+    return offset;
+  }
+
+  const u32 first = offset / m_segment_size;
+  const u32 last = (offset + size - 1) / m_segment_size;
+  const u32 num_segments = m_segment_fences.size();
+
+  // the space after the head in a segment we're already writing hasn't been used since the GPU
+  // was last done with the segment. Anything else might still be in use.
+  u32 needs_wait = 0;
+  for (u32 seg = first; seg <= last; seg++) {
+    if (wrapped || !m_segment_written[seg]) {
+      needs_wait |= 1u << seg;
+    }
+  }
+
+  if (needs_wait) {
+    // the draws for everything written so far have been issued, so one fence covers all of it.
+    GLsync sync = nullptr;
+    for (u32 seg = 0; seg < num_segments; seg++) {
+      if (m_segment_written[seg]) {
+        if (!sync) {
+          sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+          m_fences.push_back({m_next_fence_seq++, sync});
+        }
+        m_segment_fences[seg] = m_fences.back().seq;
+        m_segment_written[seg] = 0;
+      }
+    }
+    for (u32 seg = first; seg <= last; seg++) {
+      if ((needs_wait & (1u << seg)) && m_segment_fences[seg]) {
+        wait_for_fence(m_segment_fences[seg]);
+        m_segment_fences[seg] = 0;
+      }
+    }
+  }
+
+  for (u32 seg = first; seg <= last; seg++) {
+    m_segment_written[seg] = 1;
+  }
+  m_head = offset + size;
+  return offset;
+}
+
+void StreamingBuffer::write(u32 offset, const void* data, u32 size) {
+  if (size == 0) {
+    return;
+  }
+  ASSERT(offset + size <= m_size);
+  if (m_mapped) {
+    memcpy(m_mapped + offset, data, size);
+  } else {
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+    auto* dst = glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, size,
+                                 GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                                     GL_MAP_INVALIDATE_RANGE_BIT);
+    if (dst) {
+      memcpy(dst, data, size);
+      glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+  }
+}
+
+void GpuGarbage::update() {
+  if (!m_unfenced.textures.empty() || !m_unfenced.buffers.empty()) {
+    m_unfenced.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    m_pending += m_unfenced.textures.size() + m_unfenced.buffers.size();
+    m_fenced.push_back(std::move(m_unfenced));
+    m_unfenced = {};
+  }
+
+  // fences are signaled in order, so this stops at the first one that isn't.
+  while (!m_fenced.empty()) {
+    auto& batch = m_fenced.front();
+    auto status = glClientWaitSync(batch.fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+      break;
+    }
+    glDeleteSync(batch.fence);
+    if (!batch.textures.empty()) {
+      glDeleteTextures(batch.textures.size(), batch.textures.data());
+    }
+    if (!batch.buffers.empty()) {
+      glDeleteBuffers(batch.buffers.size(), batch.buffers.data());
+    }
+    m_pending -= batch.textures.size() + batch.buffers.size();
+    m_fenced.pop_front();
+  }
+}
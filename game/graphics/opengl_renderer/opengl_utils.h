@@ -1,5 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <limits>
+#include <vector>
+
 #include "common/math/Vector.h"
 
 #include "game/graphics/pipelines/opengl.h"
@@ -74,9 +80,43 @@ class FullScreenDraw {
   FullScreenDraw& operator=(const FullScreenDraw&) = delete;
   void draw(const math::Vector4f& color, SharedRenderState* render_state, ScopedProfilerNode& prof);
 
+  /*!
+   * Draw a color texture over the viewport with the post processing shader, multiplied by
+   * brightness. If samples isn't 0, the texture is multisampled and is resolved in the same pass.
+   * If scaled is false, the viewport must be the same size as the texture. If bicubic is set, a
+   * texture that isn't multisampled is scaled with a Catmull-Rom filter instead of a bilinear one.
+   */
+  void draw_texture(GLuint texture,
+                    int samples,
+                    bool scaled,
+                    bool bicubic,
+                    float brightness,
+                    SharedRenderState* render_state,
+                    ScopedProfilerNode& prof);
+
  private:
   GLuint m_vao;
   GLuint m_vertex_buffer;
+  GLuint m_linear_sampler;
+};
+
+/*!
+ * The texture coordinates that an effect samples a framebuffer copy with. Coordinates outside of
+ * 0-1 read the edge, like the CLAMP_TO_EDGE the copies are sampled with.
+ */
+struct TexCoordBounds {
+  float min_s = std::numeric_limits<float>::max();
+  float min_t = std::numeric_limits<float>::max();
+  float max_s = std::numeric_limits<float>::lowest();
+  float max_t = std::numeric_limits<float>::lowest();
+
+  void add(float s, float t) {
+    min_s = std::min(min_s, s);
+    min_t = std::min(min_t, t);
+    max_s = std::max(max_s, s);
+    max_t = std::max(max_t, t);
+  }
+  bool empty() const { return min_s > max_s || min_t > max_t; }
 };
 
 class FramebufferCopier {
@@ -87,11 +127,196 @@ class FramebufferCopier {
   FramebufferCopier& operator=(const FramebufferCopier&) = delete;
   void copy_now(int render_fb_w, int render_fb_h, GLuint render_fb);
   void copy_back_now(int render_fb_w, int render_fb_h, GLuint render_fb);
+
+  /*!
+   * Copy only the pixels that are sampled with these texture coordinates (plus a border for linear
+   * filtering), to the same place in the texture. The rest of the texture is left as it was.
+   */
+  void copy_region_now(int render_fb_w,
+                       int render_fb_h,
+                       GLuint render_fb,
+                       const TexCoordBounds& bounds);
   u64 texture() const { return m_fbo_texture; }
   int width() const { return m_fbo_width; }
   int height() const { return m_fbo_height; }
 
+  // size of the most recent copy, for debugging.
+  int last_copy_width() const { return m_last_copy_w; }
+  int last_copy_height() const { return m_last_copy_h; }
+
  private:
+  void resize(int w, int h);
+  void blit_from(GLuint render_fb, int x0, int y0, int x1, int y1);
+
   GLuint m_fbo = 0, m_fbo_texture = 0;
   int m_fbo_width = 640, m_fbo_height = 480;
-};
\ No newline at end of file
+  int m_last_copy_w = 0, m_last_copy_h = 0;
+};
+
+/*!
+ * GPU time of each bucket, measured with GL_TIMESTAMP queries around it. The queries for a frame
+ * are read back a few frames later, once the GPU is done with them, so measuring never stalls the
+ * renderer. If the GPU is so far behind that a frame's queries are still pending when they need to
+ * be reused, that frame is skipped.
+ */
+class GpuBucketTimers {
+ public:
+  GpuBucketTimers() = default;
+  ~GpuBucketTimers();
+  GpuBucketTimers(const GpuBucketTimers&) = delete;
+  GpuBucketTimers& operator=(const GpuBucketTimers&) = delete;
+
+  void begin_frame(int num_buckets);
+  void begin_bucket(int bucket);
+  void end_bucket(int bucket);
+  void end_frame();
+
+  /*!
+   * The GPU time of this bucket in the most recent frame with results, in seconds.
+   * Negative if there is no result for it.
+   */
+  float last_duration(int bucket) const {
+    return bucket < (int)m_last_durations.size() ? m_last_durations[bucket] : -1.f;
+  }
+
+  /*!
+   * The total GPU time of the buckets of the newest frame with results, in seconds, if it wasn't
+   * taken already. Otherwise negative.
+   */
+  float take_frame_duration() {
+    float result = m_new_frame_duration;
+    m_new_frame_duration = -1.f;
+    return result;
+  }
+
+ private:
+  static constexpr int kFramesInFlight = 3;
+  struct Frame {
+    std::vector<GLuint> queries;  // start and end per bucket
+    std::vector<u8> issued;
+    GLuint last_issued = 0;
+    bool pending = false;
+  };
+  bool try_resolve(Frame& frame);
+
+  std::array<Frame, kFramesInFlight> m_frames;
+  int m_frame_idx = 0;
+  bool m_in_frame = false;
+  std::vector<float> m_last_durations;
+  float m_new_frame_duration = -1.f;
+};
+
+/*!
+ * Look up glBufferStorage, which isn't part of the GL 4.3 API that glad loads. If it's available
+ * (GL 4.4 or ARB_buffer_storage), StreamingBuffers are persistently mapped. Call once, after glad.
+ */
+void load_buffer_storage(GLADloadproc load);
+
+/*!
+ * Ask the driver to compile shaders on background threads, if it supports
+ * KHR_parallel_shader_compile. ShaderLibrary starts every compile before checking any of them, so
+ * they run at the same time. Call once, after glad.
+ */
+void load_parallel_shader_compile(GLADloadproc load);
+
+/*!
+ * A ring buffer for data that's uploaded every frame, like vertices built on the CPU.
+ *
+ * Uploads are copied into the next free part of the ring instead of replacing the whole buffer,
+ * so the driver never has to wait for, or make a copy of, data that the GPU is still reading.
+ * The ring is split into segments. A fence is placed when the ring moves on to a new segment, and
+ * a segment is only written again once the GPU is past its fence. If the ring is big enough to
+ * hold a few frames of data, this never waits.
+ *
+ * The buffer is mapped once and left mapped when glBufferStorage is available. Otherwise, each
+ * upload maps its range with GL_MAP_UNSYNCHRONIZED_BIT, using the same fences.
+ * The buffer isn't tied to a target, so it can be used as a vertex, index, or uniform buffer.
+ */
+class StreamingBuffer {
+ public:
+  explicit StreamingBuffer(u32 size, u32 num_segments = 8);
+  ~StreamingBuffer();
+  StreamingBuffer(const StreamingBuffer&) = delete;
+  StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+  GLuint buffer() const { return m_buffer; }
+  u32 size() const { return m_size; }
+
+  /*!
+   * Reserve size bytes, and return their offset in the buffer, which is a multiple of alignment.
+   * The space stays reserved until the next allocation, so the draws using it must be issued
+   * before then.
+   */
+  u32 allocate(u32 size, u32 alignment = 1);
+
+  /*!
+   * Copy data into space from allocate. Uses the GL_COPY_WRITE_BUFFER binding if the buffer isn't
+   * mapped, so vertex array state isn't touched.
+   */
+  void write(u32 offset, const void* data, u32 size);
+
+  /*!
+   * Allocate and write in one step.
+   */
+  u32 upload(const void* data, u32 size, u32 alignment = 1) {
+    u32 offset = allocate(size, alignment);
+    write(offset, data, size);
+    return offset;
+  }
+
+ private:
+  void wait_for_fence(u64 seq);
+
+  struct Fence {
+    u64 seq = 0;
+    GLsync sync = nullptr;
+  };
+
+  GLuint m_buffer = 0;
+  u8* m_mapped = nullptr;
+  u32 m_size = 0;
+  u32 m_segment_size = 0;
+  u32 m_head = 0;
+  std::vector<u64> m_segment_fences;  // fence to wait for before writing the segment, 0 for none
+  std::vector<u8> m_segment_written;  // written since the last fence
+  std::deque<Fence> m_fences;
+  u64 m_next_fence_seq = 1;
+};
+
+/*!
+ * Deletes textures and buffers once the GPU is done with them. Deleting an object that the GPU is
+ * still using can make some drivers wait for it to finish.
+ *
+ * Objects freed before a call to update() are deleted together: update() places a fence after
+ * everything drawn so far, which covers every draw that could use them, and a later update()
+ * deletes them once that fence has signaled. The fence is never waited on.
+ */
+class GpuGarbage {
+ public:
+  GpuGarbage() = default;
+  GpuGarbage(const GpuGarbage&) = delete;
+  GpuGarbage& operator=(const GpuGarbage&) = delete;
+
+  // The object must not be used in any draws after this.
+  void free_texture(GLuint texture) { m_unfenced.textures.push_back(texture); }
+  void free_buffer(GLuint buffer) { m_unfenced.buffers.push_back(buffer); }
+
+  /*!
+   * Fence the objects freed since the last update, and delete the ones the GPU is done with.
+   * Call once per frame, on the thread with the renderer's GL context.
+   */
+  void update();
+
+  // the number of objects that haven't been deleted yet
+  size_t pending() const { return m_pending; }
+
+ private:
+  struct Batch {
+    GLsync fence = nullptr;
+    std::vector<GLuint> textures;
+    std::vector<GLuint> buffers;
+  };
+  Batch m_unfenced;
+  std::deque<Batch> m_fenced;
+  size_t m_pending = 0;  // in m_fenced
+};
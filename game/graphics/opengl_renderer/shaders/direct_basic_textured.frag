@@ -22,19 +22,48 @@ uniform vec4 fog_color;
 flat in uvec4 tex_info;
 in float fog;
 
+// one sampler per DirectRenderer texture state, so a flush can use several textures.
 uniform sampler2D tex_T20;
+uniform sampler2D tex_T21;
+uniform sampler2D tex_T22;
+uniform sampler2D tex_T23;
+uniform sampler2D tex_T24;
+uniform sampler2D tex_T25;
+uniform sampler2D tex_T26;
+uniform sampler2D tex_T27;
 
 vec4 sample_tex(vec2 coord, uint unit) {
-  return texture(tex_T20, coord);
+  switch (unit) {
+    case 0: return texture(tex_T20, coord);
+    case 1: return texture(tex_T21, coord);
+    case 2: return texture(tex_T22, coord);
+    case 3: return texture(tex_T23, coord);
+    case 4: return texture(tex_T24, coord);
+    case 5: return texture(tex_T25, coord);
+    case 6: return texture(tex_T26, coord);
+    default: return texture(tex_T27, coord);
+  }
+}
+
+vec2 tex_size(uint unit) {
+  switch (unit) {
+    case 0: return vec2(textureSize(tex_T20, 0));
+    case 1: return vec2(textureSize(tex_T21, 0));
+    case 2: return vec2(textureSize(tex_T22, 0));
+    case 3: return vec2(textureSize(tex_T23, 0));
+    case 4: return vec2(textureSize(tex_T24, 0));
+    case 5: return vec2(textureSize(tex_T25, 0));
+    case 6: return vec2(textureSize(tex_T26, 0));
+    default: return vec2(textureSize(tex_T27, 0));
+  }
 }
 
 vec4 sample_tex_px(vec2 coordf, uint unit) {
   // note: there is still fractional texels and filtering in this mode.
   vec2 coord_px = coordf / 16.f;
-  vec2 tex_size = vec2(textureSize(tex_T20, 0));
   // but texture perspective correction is disabled.
   // current uses are on quads with the same z so it doesn't really matter.
-  return textureProj(tex_T20, vec4(coord_px / tex_size, 1, 1));
+  return sample_tex(coord_px / tex_size(unit), unit);
 }
 
 void main() {
@@ -1,10 +1,23 @@
 #version 410 core
 
-out vec4 color;
+// the second output is the blend factor (with GL_SRC1_ALPHA), so the iris, pupil and lid can be
+// drawn together. Only the pupil blends, the others replace what's under them.
+layout (location = 0, index = 0) out vec4 color;
+layout (location = 0, index = 1) out vec4 blend_factor;
 in vec2 st;
+flat in int layer;  // 0 = iris, 1 = pupil, 2 = lid
 uniform sampler2D tex_T0;
+uniform sampler2D tex_T1;
+uniform sampler2D tex_T2;
 
 void main() {
-  color = texture(tex_T0, st);
+  if (layer == 0) {
+    color = texture(tex_T0, st);
+  } else if (layer == 1) {
+    color = texture(tex_T1, st);
+  } else {
+    color = texture(tex_T2, st);
+  }
   color.w *= 2;
+  blend_factor = layer == 1 ? color : vec4(1);
 }
@@ -1,9 +1,12 @@
 #version 410 core
 layout (location = 0) in vec4 xyst_in;
+layout (location = 1) in float layer_in;
 
 out vec2 st;
+flat out int layer;
 
 void main() {
   gl_Position = vec4((xyst_in.x - 768.f) / 256.f, (xyst_in.y - 768.f) / 256.f, 0, 1);
   st = xyst_in.zw;
+  layer = int(layer_in);
 }
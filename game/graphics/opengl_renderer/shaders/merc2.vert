@@ -39,6 +39,31 @@ layout (std140) uniform ub_bones {
   MercMatrixData bones[128];
 };
 
+// Instanced draws read each instance's bones and lights from merc_data instead. The instance
+// records start at instance_base, which is -1 for a draw that isn't instanced. See
+// Merc2::build_instance_batches for the layout.
+uniform int instance_base;
+uniform samplerBuffer merc_data;
+int instance_bones;
+
+mat4 bone_x(uint i) {
+  if (instance_base < 0) {
+    return bones[i].X;
+  }
+  int t = instance_bones + int(i) * 8;
+  return mat4(texelFetch(merc_data, t), texelFetch(merc_data, t + 1), texelFetch(merc_data, t + 2),
+              texelFetch(merc_data, t + 3));
+}
+
+mat3 bone_r(uint i) {
+  if (instance_base < 0) {
+    return bones[i].R;
+  }
+  int t = instance_bones + int(i) * 8 + 4;
+  return mat3(texelFetch(merc_data, t).xyz, texelFetch(merc_data, t + 1).xyz,
+              texelFetch(merc_data, t + 2).xyz);
+}
+
 
 /*
 The inputs are in registers 8, 10, 12, 25, and the outputs are 9, 11, 13, 26. The output is written over the input.
@@ -56,30 +81,49 @@ maddz.xyzw vf26, vf28, vf25
 ```
 */
 void main() {
+  vec3 dir0 = light_dir0_fade.xyz;
+  vec3 dir1 = light_dir1_fade_en.xyz;
+  vec3 dir2 = light_dir2;
+  vec4 col0 = light_col0;
+  vec4 col1 = light_col1;
+  vec4 col2 = light_col2;
+  vec4 ambient = light_ambient;
+  if (instance_base >= 0) {
+    ivec2 record = floatBitsToInt(texelFetch(merc_data, instance_base + gl_InstanceID).xy);
+    instance_bones = record.x;
+    dir0 = texelFetch(merc_data, record.y).xyz;
+    dir1 = texelFetch(merc_data, record.y + 1).xyz;
+    dir2 = texelFetch(merc_data, record.y + 2).xyz;
+    col0 = texelFetch(merc_data, record.y + 3);
+    col1 = texelFetch(merc_data, record.y + 4);
+    col2 = texelFetch(merc_data, record.y + 5);
+    ambient = texelFetch(merc_data, record.y + 6);
+  }
+
   vec4 p = vec4(position_in, 1);
-  vec4 vtx_pos = -bones[mats[0]].X * p * weights_in[0];
-  vec3 rotated_nrm = bones[mats[0]].R * normal_in * weights_in[0];
+  vec4 vtx_pos = -bone_x(mats[0]) * p * weights_in[0];
+  vec3 rotated_nrm = bone_r(mats[0]) * normal_in * weights_in[0];
 
   // game may send garbage bones if the weight is 0, don't let NaNs sneak in.
   if (weights_in[1] > 0) {
-    vtx_pos += -bones[mats[1]].X * p * weights_in[1];
-    rotated_nrm += bones[mats[1]].R * normal_in * weights_in[1];
+    vtx_pos += -bone_x(mats[1]) * p * weights_in[1];
+    rotated_nrm += bone_r(mats[1]) * normal_in * weights_in[1];
   }
   if (weights_in[2] > 0) {
-    vtx_pos += -bones[mats[2]].X * p * weights_in[2];
-    rotated_nrm += bones[mats[2]].R * normal_in * weights_in[2];
+    vtx_pos += -bone_x(mats[2]) * p * weights_in[2];
+    rotated_nrm += bone_r(mats[2]) * normal_in * weights_in[2];
   }
 
   vec4 transformed = perspective_matrix * vtx_pos;
 
   rotated_nrm = normalize(rotated_nrm);
-  vec3 light_intensity = light_dir0_fade.xyz * rotated_nrm.x + light_dir1_fade_en.xyz * rotated_nrm.y + light_dir2 * rotated_nrm.z;
+  vec3 light_intensity = dir0 * rotated_nrm.x + dir1 * rotated_nrm.y + dir2 * rotated_nrm.z;
   light_intensity = max(light_intensity, vec3(0, 0, 0));
 
-  vec4 light_color = light_ambient
-                   + light_intensity.x * light_col0
-                   + light_intensity.y * light_col1
-                   + light_intensity.z * light_col2;
+  vec4 light_color = ambient
+                   + light_intensity.x * col0
+                   + light_intensity.y * col1
+                   + light_intensity.z * col2;
 
 
 
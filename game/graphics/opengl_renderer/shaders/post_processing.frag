@@ -1,5 +1,8 @@
 #version 410 core
 
+// Draws the finished frame to the window. The MSAA resolve, the scale to the draw region and the
+// PCRTC brightness are all done here, in one pass.
+
 in vec2 screen_pos;
 
 out vec4 color;
@@ -7,7 +10,62 @@ out vec4 color;
 uniform vec4 fragment_color;
 
 uniform sampler2D tex_T0;
+uniform sampler2DMS tex_ms;
+uniform int samples;  // 0 if the frame isn't multisampled, and is in tex_T0.
+uniform int scaled;   // 0 if the window region is the same size as the frame.
+uniform int bicubic;  // scale tex_T0 with a Catmull-Rom filter, for dynamic resolution.
+
+vec3 resolved_texel(ivec2 coord) {
+  coord = clamp(coord, ivec2(0), textureSize(tex_ms) - 1);
+  vec3 sum = vec3(0);
+  for (int i = 0; i < samples; i++) {
+    sum += texelFetch(tex_ms, coord, i).rgb;
+  }
+  return sum / samples;
+}
+
+// Catmull-Rom in 9 bilinear samples: the middle two of the 4 taps on each axis are done as one.
+vec3 catmull_rom(vec2 uv) {
+  vec2 size = vec2(textureSize(tex_T0, 0));
+  vec2 pos = uv * size;
+  vec2 center = floor(pos - 0.5) + 0.5;
+  vec2 f = pos - center;
+  vec2 w0 = f * (-0.5 + f * (1.0 - 0.5 * f));
+  vec2 w1 = 1.0 + f * f * (-2.5 + 1.5 * f);
+  vec2 w2 = f * (0.5 + f * (2.0 - 1.5 * f));
+  vec2 w3 = f * f * (-0.5 + 0.5 * f);
+  vec2 w12 = w1 + w2;
+  vec2 uv0 = (center - 1.0) / size;
+  vec2 uv12 = (center + w2 / w12) / size;
+  vec2 uv3 = (center + 2.0) / size;
+
+  vec3 result = vec3(0);
+  result += texture(tex_T0, vec2(uv0.x, uv0.y)).rgb * w0.x * w0.y;
+  result += texture(tex_T0, vec2(uv12.x, uv0.y)).rgb * w12.x * w0.y;
+  result += texture(tex_T0, vec2(uv3.x, uv0.y)).rgb * w3.x * w0.y;
+  result += texture(tex_T0, vec2(uv0.x, uv12.y)).rgb * w0.x * w12.y;
+  result += texture(tex_T0, vec2(uv12.x, uv12.y)).rgb * w12.x * w12.y;
+  result += texture(tex_T0, vec2(uv3.x, uv12.y)).rgb * w3.x * w12.y;
+  result += texture(tex_T0, vec2(uv0.x, uv3.y)).rgb * w0.x * w3.y;
+  result += texture(tex_T0, vec2(uv12.x, uv3.y)).rgb * w12.x * w3.y;
+  result += texture(tex_T0, vec2(uv3.x, uv3.y)).rgb * w3.x * w3.y;
+  return max(result, vec3(0));
+}
 
 void main() {
-  color = vec4(texture(tex_T0, screen_pos).rgb * fragment_color.a, 1.0);
+  vec3 rgb;
+  if (samples == 0) {
+    rgb = bicubic == 0 ? texture(tex_T0, screen_pos).rgb : catmull_rom(screen_pos);
+  } else if (scaled == 0) {
+    rgb = resolved_texel(ivec2(screen_pos * textureSize(tex_ms)));
+  } else {
+    // same as resolving, then blitting with GL_LINEAR
+    vec2 pos = screen_pos * textureSize(tex_ms) - 0.5;
+    ivec2 base = ivec2(floor(pos));
+    vec2 f = pos - floor(pos);
+    vec3 bottom = mix(resolved_texel(base), resolved_texel(base + ivec2(1, 0)), f.x);
+    vec3 top = mix(resolved_texel(base + ivec2(0, 1)), resolved_texel(base + ivec2(1, 1)), f.x);
+    rgb = mix(bottom, top, f.y);
+  }
+  color = vec4(rgb * fragment_color.a, 1.0);
 }
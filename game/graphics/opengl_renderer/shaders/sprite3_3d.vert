@@ -72,7 +72,8 @@ void main() {
   float sx = xyz_sx.w;
   float sy = quat_sy.w;
   fragment_color = rgba;
-  uint vert_id = tex_info_in.z;
+  // one instance per sprite: tex_info_in.z packs the corner for each strip vertex, 2 bits each.
+  uint vert_id = (tex_info_in.z >> (2u * uint(gl_VertexID))) & 3u;
   uint rendermode = tex_info_in.w; // 2D, HUD, 3D
   vec3 quat = quat_sy.xyz;
   uint matrix = flags_matrix.y;
@@ -0,0 +1,75 @@
+#version 410 core
+
+// All layers of a fixed texture animation in a single pass. This produces the same result as
+// drawing each layer with tex_anim and the blend state from set_up_opengl_for_fixed: the blending
+// is done here, with the destination quantized to 8 bits after each layer like the framebuffer.
+
+out vec4 color;
+
+const int kMaxLayers = 16;
+
+struct Layer {
+  // destination position (0 to 1) to position in the layer's quad (0 to 1 inside)
+  vec4 local_x;
+  vec4 local_y;
+  // uv = uv0 + du * local.x + dv * local.y
+  vec4 uv0_du;
+  vec4 dv_fix;
+  vec4 rgba;
+  // blend mode, set alpha
+  ivec4 mode;
+};
+
+layout (std140) uniform ub_tex_anim_layers {
+  Layer layers[kMaxLayers];
+};
+
+uniform int layer_count;
+uniform vec4 clear_color;
+uniform vec2 dest_size;
+uniform sampler2D layer_tex[kMaxLayers];
+
+vec3 quantize(vec3 v) {
+  return round(clamp(v, 0., 1.) * 255.) / 255.;
+}
+
+void main() {
+  vec2 pos = gl_FragCoord.xy / dest_size;
+  vec3 dst = quantize(clear_color.rgb);
+  float dst_a = round(clamp(clear_color.a, 0., 1.) * 255.) / 255.;
+
+  for (int i = 0; i < layer_count; i++) {
+    vec2 local = vec2(dot(layers[i].local_x.xyz, vec3(pos, 1)),
+                      dot(layers[i].local_y.xyz, vec3(pos, 1)));
+    if (any(lessThan(local, vec2(0))) || any(greaterThanEqual(local, vec2(1)))) {
+      continue;
+    }
+
+    vec2 uv = layers[i].uv0_du.xy + layers[i].uv0_du.zw * local.x + layers[i].dv_fix.xy * local.y;
+    vec4 src = layers[i].rgba / 128. * textureLod(layer_tex[i], uv, 0);
+    vec3 src_rgb = clamp(src.rgb, 0., 1.);
+    // the color draw uses alpha_multiply = 2.
+    float src_a = clamp(src.a * 2., 0., 1.);
+
+    int blend = layers[i].mode.x;
+    if (blend == 1) {
+      // 0 2 0 1: Cs * As + Cd
+      dst = src_rgb * src_a + dst;
+    } else if (blend == 2) {
+      // 0 1 0 1: (Cs - Cd) * As + Cd
+      dst = src_rgb * src_a + dst * (1. - src_a);
+    } else if (blend == 3) {
+      // 0 2 2 1: Cs * FIX + Cd
+      dst = src_rgb * clamp(layers[i].dv_fix.z, 0., 1.) + dst;
+    } else {
+      // no blending
+      dst = src_rgb;
+    }
+    dst = quantize(dst);
+
+    // the alpha draw never blends.
+    dst_a = layers[i].mode.y == 1 ? 0.5 : clamp(src.a, 0., 1.);
+  }
+
+  color = vec4(dst, dst_a);
+}
@@ -0,0 +1,10 @@
+#version 410 core
+
+layout (location = 0) in int vertex_index;
+
+// covers the whole destination: layers find their own coverage in the fragment shader.
+const vec2 corners[4] = vec2[](vec2(0, 0), vec2(1, 0), vec2(1, 1), vec2(0, 1));
+
+void main() {
+  gl_Position = vec4(-1. + (corners[vertex_index] * 2), 0, 1);
+}
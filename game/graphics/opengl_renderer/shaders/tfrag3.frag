@@ -6,6 +6,9 @@ in vec4 fragment_color;
 in vec3 tex_coord;
 in float fogginess;
 uniform sampler2D tex_T0;
+// level textures packed into an array. tex_layer is the layer + 1, or 0 to sample tex_T0.
+uniform sampler2DArray tex_T12;
+uniform int tex_layer;
 
 uniform float alpha_min;
 uniform float alpha_max;
@@ -17,7 +20,12 @@ uniform int gfx_hack_no_tex;
 void main() {
   if (gfx_hack_no_tex == 0) {
     //vec4 T0 = texture(tex_T0, tex_coord);
-    vec4 T0 = texture(tex_T0, tex_coord.xy);
+    vec4 T0;
+    if (tex_layer == 0) {
+      T0 = texture(tex_T0, tex_coord.xy);
+    } else {
+      T0 = texture(tex_T12, vec3(tex_coord.xy, tex_layer - 1));
+    }
     color = fragment_color * T0;
   } else {
     color = fragment_color/2;
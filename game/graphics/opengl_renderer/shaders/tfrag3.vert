@@ -3,6 +3,7 @@
 layout (location = 0) in vec3 position_in;
 layout (location = 1) in vec3 tex_coord_in;
 layout (location = 2) in int time_of_day_index;
+layout (location = 3) in vec3 cluster_in; // only with packed_vertices
 
 uniform vec4 hvdf_offset;
 uniform vec4 cam_trans;
@@ -13,6 +14,11 @@ uniform float fog_min;
 uniform float fog_max;
 uniform sampler1D tex_T10; // note, sampled in the vertex shader on purpose.
 uniform int decal;
+uniform int packed_vertices; // tfrag's quantized vertices, tie has floats.
+
+// must match TfragTree::unpack
+const float CLUSTER_SIZE = 4096. * 40.;
+const float MASTER_OFFSET = 12000. * 4096.;
 
 out vec4 fragment_color;
 out vec3 tex_coord;
@@ -34,8 +40,16 @@ void main() {
   // the itof0 is done in the preprocessing step.  now we have floats.
 
 
+  vec3 position = position_in;
+  tex_coord = tex_coord_in;
+  if (packed_vertices == 1) {
+    // offset in the cluster, from 0 to 65535
+    position = (-MASTER_OFFSET + CLUSTER_SIZE * cluster_in) + position_in * (CLUSTER_SIZE / 65535.);
+    tex_coord = vec3(tex_coord_in.xy / 1024., 0);
+  }
+
   // Step 3, the camera transform
-  vec3 vert = position_in - cam_trans.xyz;
+  vec3 vert = position - cam_trans.xyz;
   vec4 transformed = -pc_camera[3];
   transformed.w = 0;
   transformed -= pc_camera[0] * vert.x;
@@ -59,6 +73,4 @@ void main() {
     // tfrag/tie always use TCC=RGB, so even with decal, alpha comes from fragment.
     fragment_color.xyz = vec3(1.0, 1.0, 1.0);
   }
-  
-  tex_coord = tex_coord_in;
 }
@@ -34,8 +34,11 @@
  *   draw. But the alpha of the entire first draw is constant, and we can figure it out in the
  *   vertex shader, so there's no need to do this approach.
  *
+ * - The final draws are grouped by texture and mode.
+ * - With GL 4.3, a compute shader does the depth copy, probe and downsampling for every sprite in
+ *   a single dispatch (glow_probe_visibility.comp), and writes the final 2x2 grid directly.
+ *
  * there are a few remaining improvements that could be made:
- *   - The final draws could be bucketed, this would reduce draw calls by a lot.
  *   - The depth buffer copy could likely be eliminated.
  *   - There's a possibility that overlapping probes do the "wrong" thing. This could be solved by
  *     copying from the depth buffer to the grid, then drawing probes on the grid. Currently the
@@ -254,6 +257,10 @@ GlowRenderer::GlowRenderer() {
   m_default_draw_mode.disable_depth_write();
 
   glGenTextures(1, &m_ogl.depth_texture);
+
+  glGenBuffers(1, &m_ogl.probe_buffer);
+  m_compute_probes.resize(kMaxSprites);
+  m_batches.reserve(kMaxSprites);
 }
 
 namespace {
@@ -561,8 +568,9 @@ void GlowRenderer::draw_debug_window() {
   ImGui::Checkbox("Show Probes", &m_debug.show_probes);
   ImGui::Checkbox("Show Copy", &m_debug.show_probe_copies);
   ImGui::Checkbox("Enable Glow Boost", &m_debug.enable_glow_boost);
+  ImGui::Checkbox("Compute Probes", &m_debug.use_compute);
   ImGui::SliderFloat("Boost Glow", &m_debug.glow_boost, 0, 10);
-  ImGui::Text("Count: %d", m_debug.num_sprites);
+  ImGui::Text("Count: %d, draws: %d", m_debug.num_sprites, m_debug.num_draws);
 }
 
 /*!
@@ -707,6 +715,7 @@ void GlowRenderer::probe_and_copy_old(SharedRenderState* render_state, ScopedPro
   for (u32 sidx = 0; sidx < m_next_sprite; sidx++) {
     add_sprite_pass_3(m_sprite_data_buffer[sidx], sidx);
   }
+  build_sprite_batches();
 
   // draw probes
   setup_buffers_for_draws();
@@ -733,6 +742,7 @@ void GlowRenderer::probe_and_copy_new(SharedRenderState* render_state, ScopedPro
   for (u32 sidx = 0; sidx < m_next_sprite; sidx++) {
     add_sprite_pass_3(m_sprite_data_buffer[sidx], sidx);
   }
+  build_sprite_batches();
 
   // clear the grid.
   setup_buffers_for_draws();
@@ -771,6 +781,83 @@ void GlowRenderer::probe_and_copy_new(SharedRenderState* render_state, ScopedPro
   glViewport(old_viewport[0], old_viewport[1], old_viewport[2], old_viewport[3]);
 }
 
+/*!
+ * Find the visibility of every probe with one compute dispatch. This does the same depth copy and
+ * probe test as probe_and_copy_new, then writes the fraction that passed straight to the last
+ * downsample texture, so the downsample chain isn't needed.
+ */
+void GlowRenderer::probe_compute(SharedRenderState* render_state, ScopedProfilerNode& prof) {
+  for (u32 sidx = 0; sidx < m_next_sprite; sidx++) {
+    const auto& data = m_sprite_data_buffer[sidx];
+    auto& probe = m_compute_probes[sidx];
+    probe.uv_rect = math::Vector4f(data.offscreen_uv[0][0], data.offscreen_uv[0][1],
+                                   data.offscreen_uv[1][0], data.offscreen_uv[1][1]);
+    // same cell as add_sprite_new
+    probe.z_cell = math::Vector4f(data.second_clear_pos[0].z(), sidx / kDownsampleBatchWidth,
+                                  sidx % kDownsampleBatchWidth, 0);
+  }
+
+  // generate vertex/index data for framebuffer draws
+  for (u32 sidx = 0; sidx < m_next_sprite; sidx++) {
+    add_sprite_pass_3(m_sprite_data_buffer[sidx], sidx);
+  }
+  build_sprite_batches();
+  setup_buffers_for_draws();
+
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ogl.probe_buffer);
+  glBufferData(GL_SHADER_STORAGE_BUFFER, m_next_sprite * sizeof(ComputeProbe),
+               m_compute_probes.data(), GL_STREAM_DRAW);
+  glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_ogl.probe_buffer);
+
+  auto& shader = render_state->shaders[ShaderId::GLOW_PROBE_VISIBILITY];
+  shader.activate();
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_2D, m_ogl.probe_fbo_depth_tex);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glUniform1i(glGetUniformLocation(shader.id(), "depth_tex"), 0);
+  glUniform1f(glGetUniformLocation(shader.id(), "scissor_height"),
+              render_state->version == GameVersion::Jak1 ? 448.f : 416.f);
+  glBindImageTexture(0, m_ogl.downsample_fbos[kDownsampleIterations - 1].tex, 0, GL_FALSE, 0,
+                     GL_WRITE_ONLY, GL_RGBA8);
+
+  glDispatchCompute(m_next_sprite, 1, 1);
+  prof.add_draw_call();
+  // draw_sprites samples the result in the vertex shader.
+  glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+  glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+}
+
+/*!
+ * Group the final draws by texture and draw mode. Each group gets a contiguous run of indices
+ * after the ones already generated, and is drawn once.
+ */
+void GlowRenderer::build_sprite_batches() {
+  std::array<u32, kMaxSprites> order;
+  for (u32 i = 0; i < m_next_sprite; i++) {
+    order[i] = i;
+  }
+  auto key = [&](u32 i) {
+    return ((u64)m_sprite_records[i].tbp << 32) | m_sprite_records[i].draw_mode.as_int();
+  };
+  std::stable_sort(order.begin(), order.begin() + m_next_sprite,
+                   [&](u32 a, u32 b) { return key(a) < key(b); });
+
+  m_batches.clear();
+  for (u32 i = 0; i < m_next_sprite; i++) {
+    const u32 sprite = order[i];
+    if (m_batches.empty() || key(m_batches.back().record) != key(sprite)) {
+      m_batches.push_back({m_next_index, 0, sprite});
+    }
+    u32* idx = alloc_index(5);
+    memcpy(idx, &m_index_buffer[m_sprite_records[sprite].idx], 5 * sizeof(u32));
+    m_batches.back().num_indices += 5;
+  }
+}
+
 /*!
  * Draw all pending sprites.
  */
@@ -785,14 +872,18 @@ void GlowRenderer::flush(SharedRenderState* render_state, ScopedProfilerNode& pr
   // (this is a bit wasteful)
   blit_depth(render_state);
 
-  if (new_mode) {
-    probe_and_copy_new(render_state, prof);
+  if (m_debug.use_compute && render_state->shaders[ShaderId::GLOW_PROBE_VISIBILITY].okay()) {
+    probe_compute(render_state, prof);
   } else {
-    probe_and_copy_old(render_state, prof);
-  }
+    if (new_mode) {
+      probe_and_copy_new(render_state, prof);
+    } else {
+      probe_and_copy_old(render_state, prof);
+    }
 
-  // downsample probes.
-  downsample_chain(render_state, prof, m_next_sprite);
+    // downsample probes.
+    downsample_chain(render_state, prof, m_next_sprite);
+  }
 
   draw_sprites(render_state, prof);
 
@@ -837,8 +928,9 @@ void GlowRenderer::draw_sprites(SharedRenderState* render_state, ScopedProfilerN
 
   glDepthMask(GL_FALSE);
 
-  for (u32 i = 0; i < m_next_sprite; i++) {
-    const auto& record = m_sprite_records[i];
+  m_debug.num_draws = m_batches.size();
+  for (const auto& batch : m_batches) {
+    const auto& record = m_sprite_records[batch.record];
     auto tex = render_state->texture_pool->lookup(record.tbp);
     if (!tex) {
       fmt::print("Failed to find texture at {}, using random (glow)", record.tbp);
@@ -867,8 +959,9 @@ void GlowRenderer::draw_sprites(SharedRenderState* render_state, ScopedProfilerN
     }
 
     prof.add_draw_call();
-    prof.add_tri(2);
-    glDrawElements(GL_TRIANGLE_STRIP, 5, GL_UNSIGNED_INT, (void*)(record.idx * sizeof(u32)));
+    prof.add_tri(2 * batch.num_indices / 5);
+    glDrawElements(GL_TRIANGLE_STRIP, batch.num_indices, GL_UNSIGNED_INT,
+                   (void*)(batch.first_index * sizeof(u32)));
   }
   glEnable(GL_DEPTH_TEST);
 }
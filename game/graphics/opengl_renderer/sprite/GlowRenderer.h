@@ -30,7 +30,9 @@ class GlowRenderer {
     bool show_probes = false;
     bool show_probe_copies = false;
     bool enable_glow_boost = false;
+    bool use_compute = true;
     int num_sprites = 0;
+    int num_draws = 0;
     float glow_boost = 1.f;
   } m_debug;
   void add_sprite_pass_1(const SpriteGlowOutput& data);
@@ -41,6 +43,8 @@ class GlowRenderer {
 
   void probe_and_copy_old(SharedRenderState* render_state, ScopedProfilerNode& prof);
   void probe_and_copy_new(SharedRenderState* render_state, ScopedProfilerNode& prof);
+  void probe_compute(SharedRenderState* render_state, ScopedProfilerNode& prof);
+  void build_sprite_batches();
 
   void blit_depth(SharedRenderState* render_state);
 
@@ -111,8 +115,18 @@ class GlowRenderer {
     GLuint depth_texture;
 
     DsFbo downsample_fbos[kDownsampleIterations];
+
+    GLuint probe_buffer;  // ComputeProbe for each sprite, for the compute path.
   } m_ogl;
 
+  // input to glow_probe_visibility.comp
+  struct ComputeProbe {
+    math::Vector4f uv_rect;  // u0, v0, u1, v1
+    math::Vector4f z_cell;   // probe z, cell x, cell y, unused
+  };
+  static_assert(sizeof(ComputeProbe) == 32);
+  std::vector<ComputeProbe> m_compute_probes;
+
   struct {
     GLuint vao;
     GLuint index_buffer;
@@ -128,4 +142,13 @@ class GlowRenderer {
   };
 
   std::array<SpriteRecord, kMaxSprites> m_sprite_records;
+
+  // final draws, grouped by texture and mode. The draws blend additively with no depth test, so
+  // the order doesn't matter.
+  struct SpriteBatch {
+    u32 first_index;
+    u32 num_indices;
+    u32 record;
+  };
+  std::vector<SpriteBatch> m_batches;
 };
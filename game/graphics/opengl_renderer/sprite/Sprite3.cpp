@@ -35,10 +35,19 @@ u32 process_sprite_chunk_header(DmaFollower& dma) {
 }
 
 constexpr int SPRITE_RENDERER_MAX_SPRITES = 1920 * 12;
+
+/*!
+ * Pack which corner each of the four strip vertices uses, two bits each, for the vertex shader.
+ */
+u16 corner_order(u16 v0, u16 v1, u16 v2, u16 v3) {
+  return v0 | (v1 << 2) | (v2 << 4) | (v3 << 6);
+}
 }  // namespace
 
-Sprite3::Sprite3(const std::string& name, int my_id)
-    : BucketRenderer(name, my_id), m_direct(name, my_id, 1024) {
+Sprite3::Sprite3(const std::string& name,
+                 int my_id,
+                 std::shared_ptr<FramebufferCopier> fb_copier)
+    : BucketRenderer(name, my_id), m_distort_fb_copier(fb_copier), m_direct(name, my_id, 1024) {
   opengl_setup();
 }
 
@@ -51,71 +60,20 @@ void Sprite3::opengl_setup() {
 }
 
 void Sprite3::opengl_setup_normal() {
-  glGenBuffers(1, &m_ogl.vertex_buffer);
+  // one record per sprite, expanded to the four corners in the vertex shader. Room for two full
+  // flushes.
+  auto bytes = SPRITE_RENDERER_MAX_SPRITES * sizeof(SpriteVertex3D);
+  m_ogl.vertex_stream = std::make_unique<StreamingBuffer>(2 * bytes);
   glGenVertexArrays(1, &m_ogl.vao);
   glBindVertexArray(m_ogl.vao);
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
-  auto verts = SPRITE_RENDERER_MAX_SPRITES * 4;
-  auto bytes = verts * sizeof(SpriteVertex3D);
-  glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(
-      0,                                       // location 0 in the shader
-      4,                                       // 4 floats per vert (w unused)
-      GL_FLOAT,                                // floats
-      GL_TRUE,                                 // normalized, ignored,
-      sizeof(SpriteVertex3D),                  //
-      (void*)offsetof(SpriteVertex3D, xyz_sx)  // offset in array (why is this a pointer...)
-  );
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(
-      1,                                        // location 1 in the shader
-      4,                                        // 4 color components
-      GL_FLOAT,                                 // floats
-      GL_TRUE,                                  // normalized, ignored,
-      sizeof(SpriteVertex3D),                   //
-      (void*)offsetof(SpriteVertex3D, quat_sy)  // offset in array (why is this a pointer...)
-  );
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(
-      2,                                     // location 2 in the shader
-      4,                                     // 4 color components
-      GL_FLOAT,                              // floats
-      GL_TRUE,                               // normalized, ignored,
-      sizeof(SpriteVertex3D),                //
-      (void*)offsetof(SpriteVertex3D, rgba)  // offset in array (why is this a pointer...)
-  );
-
-  glEnableVertexAttribArray(3);
-  glVertexAttribIPointer(
-      3,                                             // location 3 in the shader
-      2,                                             // 4 color components
-      GL_UNSIGNED_SHORT,                             // floats
-      sizeof(SpriteVertex3D),                        //
-      (void*)offsetof(SpriteVertex3D, flags_matrix)  // offset in array (why is this a pointer...)
-  );
-
-  glEnableVertexAttribArray(4);
-  glVertexAttribIPointer(
-      4,                                     // location 4 in the shader
-      4,                                     // 3 floats per vert
-      GL_UNSIGNED_SHORT,                     // floats
-      sizeof(SpriteVertex3D),                //
-      (void*)offsetof(SpriteVertex3D, info)  // offset in array (why is this a pointer...)
-  );
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-  u32 idx_buffer_len = SPRITE_RENDERER_MAX_SPRITES * 5;
-  glGenBuffers(1, &m_ogl.index_buffer);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_len * sizeof(u32), nullptr, GL_STREAM_DRAW);
-
+  for (int i = 0; i < 5; i++) {
+    glEnableVertexAttribArray(i);
+    glVertexAttribDivisor(i, 1);
+  }
+  set_instance_attributes(0);
   glBindVertexArray(0);
 
-  m_vertices_3d.resize(verts);
-  m_index_buffer_data.resize(idx_buffer_len);
+  m_vertices_3d.resize(SPRITE_RENDERER_MAX_SPRITES);
 
   m_default_mode.disable_depth_write();
   m_default_mode.set_depth_test(GsTest::ZTest::GEQUAL);
@@ -559,10 +517,14 @@ void Sprite3::draw_debug_window() {
   ImGui::Checkbox("new glow", &m_glow_renderer.new_mode);
   ImGui::Separator();
   ImGui::Text("Distort sprites: %d", m_distort_stats.total_sprites);
+  ImGui::Text("Distort copy: %dx%d", m_distort_fb_copier->last_copy_width(),
+              m_distort_fb_copier->last_copy_height());
   ImGui::Text("2D Group 0 (World) blocks: %d sprites: %d", m_debug_stats.blocks_2d_grp0,
               m_debug_stats.count_2d_grp0);
   ImGui::Text("2D Group 1 (HUD) blocks: %d sprites: %d", m_debug_stats.blocks_2d_grp1,
               m_debug_stats.count_2d_grp1);
+  ImGui::Text("Texture binds skipped: %d/%d", m_debug_stats.tex_lookups_skipped,
+              m_debug_stats.tex_lookups);
   ImGui::Checkbox("Culling", &m_enable_culling);
   ImGui::Checkbox("2d", &m_2d_enable);
   ImGui::SameLine();
@@ -573,6 +535,26 @@ void Sprite3::draw_debug_window() {
   m_glow_renderer.draw_debug_window();
 }
 
+/*!
+ * Point the per-sprite attributes at the record at byte_offset in the vertex stream. Each bucket is
+ * a contiguous run of records, drawn with this offset, since base instance needs GL 4.2.
+ */
+void Sprite3::set_instance_attributes(u32 byte_offset) {
+  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_stream->buffer());
+  auto offset = [&](size_t field) { return (void*)(byte_offset + field); };
+  glVertexAttribPointer(0, 4, GL_FLOAT, GL_TRUE, sizeof(SpriteVertex3D),
+                        offset(offsetof(SpriteVertex3D, xyz_sx)));
+  glVertexAttribPointer(1, 4, GL_FLOAT, GL_TRUE, sizeof(SpriteVertex3D),
+                        offset(offsetof(SpriteVertex3D, quat_sy)));
+  glVertexAttribPointer(2, 4, GL_FLOAT, GL_TRUE, sizeof(SpriteVertex3D),
+                        offset(offsetof(SpriteVertex3D, rgba)));
+  glVertexAttribIPointer(3, 2, GL_UNSIGNED_SHORT, sizeof(SpriteVertex3D),
+                         offset(offsetof(SpriteVertex3D, flags_matrix)));
+  glVertexAttribIPointer(4, 4, GL_UNSIGNED_SHORT, sizeof(SpriteVertex3D),
+                         offset(offsetof(SpriteVertex3D, info)));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Render (for real)
 
@@ -581,44 +563,44 @@ void Sprite3::flush_sprites(SharedRenderState* render_state,
                             bool double_draw) {
   glBindVertexArray(m_ogl.vao);
 
-  glEnable(GL_PRIMITIVE_RESTART);
-  glPrimitiveRestartIndex(UINT32_MAX);
-
-  // upload vertex buffer
-  glBindBuffer(GL_ARRAY_BUFFER, m_ogl.vertex_buffer);
-  glBufferData(GL_ARRAY_BUFFER, m_sprite_idx * sizeof(SpriteVertex3D) * 4, m_vertices_3d.data(),
-               GL_STREAM_DRAW);
-
-  // two passes through the buckets. first to build the index buffer
-  u32 idx_offset = 0;
+  // two passes through the buckets. first to lay out the sprite records, grouped by bucket
+  u32 sprite_offset = 0;
   for (const auto bucket : m_bucket_list) {
-    memcpy(&m_index_buffer_data[idx_offset], bucket->ids.data(), bucket->ids.size() * sizeof(u32));
-    bucket->offset_in_idx_buffer = idx_offset;
-    idx_offset += bucket->ids.size();
+    memcpy(&m_vertices_3d[sprite_offset], bucket->sprites.data(),
+           bucket->sprites.size() * sizeof(SpriteVertex3D));
+    bucket->first_sprite = sprite_offset;
+    sprite_offset += bucket->sprites.size();
   }
 
   // now upload it
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ogl.index_buffer);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_offset * sizeof(u32), m_index_buffer_data.data(),
-               GL_STREAM_DRAW);
+  const u32 first_byte = m_ogl.vertex_stream->upload(
+      m_vertices_3d.data(), sprite_offset * sizeof(SpriteVertex3D), sizeof(SpriteVertex3D));
 
   // now do draws!
+  // buckets with the same texture but a different mode are common, so only bind on a tbp change.
+  glActiveTexture(GL_TEXTURE0);
+  u32 bound_tbp = UINT32_MAX;
   for (const auto bucket : m_bucket_list) {
     u32 tbp = bucket->key >> 32;
     DrawMode mode;
     mode.as_int() = bucket->key & 0xffffffff;
 
-    std::optional<u64> tex;
-    tex = render_state->texture_pool->lookup(tbp);
+    m_debug_stats.tex_lookups++;
+    if (tbp == bound_tbp) {
+      m_debug_stats.tex_lookups_skipped++;
+    } else {
+      std::optional<u64> tex;
+      tex = render_state->texture_pool->lookup(tbp);
 
-    if (!tex) {
-      lg::warn("Failed to find texture at {}, using random (sprite)", tbp);
-      tex = render_state->texture_pool->get_placeholder_texture();
-    }
-    ASSERT(tex);
+      if (!tex) {
+        lg::warn("Failed to find texture at {}, using random (sprite)", tbp);
+        tex = render_state->texture_pool->get_placeholder_texture();
+      }
+      ASSERT(tex);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, *tex);
+      glBindTexture(GL_TEXTURE_2D, *tex);
+      bound_tbp = tbp;
+    }
 
     auto settings = setup_opengl_from_draw_mode(mode, GL_TEXTURE0, false);
 
@@ -629,10 +611,10 @@ void Sprite3::flush_sprites(SharedRenderState* render_state,
     glUniform1i(glGetUniformLocation(render_state->shaders[ShaderId::SPRITE3].id(), "tex_T0"), 0);
 
     prof.add_draw_call();
-    prof.add_tri(2 * (bucket->ids.size() / 5));
+    prof.add_tri(2 * bucket->sprites.size());
 
-    glDrawElements(GL_TRIANGLE_STRIP, bucket->ids.size(), GL_UNSIGNED_INT,
-                   (void*)(bucket->offset_in_idx_buffer * sizeof(u32)));
+    set_instance_attributes(first_byte + bucket->first_sprite * sizeof(SpriteVertex3D));
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, bucket->sprites.size());
 
     if (double_draw) {
       switch (settings.kind) {
@@ -640,7 +622,7 @@ void Sprite3::flush_sprites(SharedRenderState* render_state,
           break;
         case DoubleDrawKind::AFAIL_NO_DEPTH_WRITE:
           prof.add_draw_call();
-          prof.add_tri(2 * (bucket->ids.size() / 5));
+          prof.add_tri(2 * bucket->sprites.size());
           glUniform1f(
               glGetUniformLocation(render_state->shaders[ShaderId::SPRITE3].id(), "alpha_min"),
               -10.f);
@@ -648,8 +630,7 @@ void Sprite3::flush_sprites(SharedRenderState* render_state,
               glGetUniformLocation(render_state->shaders[ShaderId::SPRITE3].id(), "alpha_max"),
               settings.aref_second);
           glDepthMask(GL_FALSE);
-          glDrawElements(GL_TRIANGLE_STRIP, bucket->ids.size(), GL_UNSIGNED_INT,
-                         (void*)(bucket->offset_in_idx_buffer * sizeof(u32)));
+          glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, bucket->sprites.size());
           break;
         default:
           ASSERT(false);
@@ -826,14 +807,7 @@ void Sprite3::do_block_common(SpriteMode mode,
         bucket = &it->second;
       }
     }
-    u32 start_vtx_id = m_sprite_idx * 4;
-    bucket->ids.push_back(start_vtx_id);
-    bucket->ids.push_back(start_vtx_id + 1);
-    bucket->ids.push_back(start_vtx_id + 2);
-    bucket->ids.push_back(start_vtx_id + 3);
-    bucket->ids.push_back(UINT32_MAX);
-
-    auto& vert1 = m_vertices_3d.at(start_vtx_id + 0);
+    auto& vert1 = bucket->sprites.emplace_back();
 
     if (render_state->version == GameVersion::Jak3) {
       auto flag = m_vec_data_2d[sprite_idx].flag();
@@ -858,41 +832,24 @@ void Sprite3::do_block_common(SpriteMode mode,
     vert1.flags_matrix[1] = m_vec_data_2d[sprite_idx].matrix();
     vert1.info[0] = 0;  // hack
     vert1.info[1] = m_current_mode.get_tcc_enable();
-    vert1.info[2] = 0;
+    vert1.info[2] = corner_order(0, 1, 3, 2);
     vert1.info[3] = mode;
 
-    m_vertices_3d.at(start_vtx_id + 1) = vert1;
-    m_vertices_3d.at(start_vtx_id + 2) = vert1;
-    m_vertices_3d.at(start_vtx_id + 3) = vert1;
-
-    m_vertices_3d.at(start_vtx_id + 1).info[2] = 1;
-    m_vertices_3d.at(start_vtx_id + 2).info[2] = 3;
-    m_vertices_3d.at(start_vtx_id + 3).info[2] = 2;
-
     // note that PC swaps the last two vertices
     if (render_state->version == GameVersion::Jak3) {
       auto flag = m_vec_data_2d[sprite_idx].flag();
       switch (flag & 0x30) {
         case 0x10:
           // FLAG 16: 1, 0, 3, 2
-          m_vertices_3d.at(start_vtx_id + 0).info[2] = 0;
-          m_vertices_3d.at(start_vtx_id + 1).info[2] = 1;
-          m_vertices_3d.at(start_vtx_id + 2).info[2] = 3;
-          m_vertices_3d.at(start_vtx_id + 3).info[2] = 2;
+          vert1.info[2] = corner_order(0, 1, 3, 2);
           break;
         case 0x20:
           // FLAG 32: 3, 2, 1, 0
-          m_vertices_3d.at(start_vtx_id + 0).info[2] = 3;
-          m_vertices_3d.at(start_vtx_id + 1).info[2] = 2;
-          m_vertices_3d.at(start_vtx_id + 2).info[2] = 0;
-          m_vertices_3d.at(start_vtx_id + 3).info[2] = 1;
+          vert1.info[2] = corner_order(3, 2, 0, 1);
           break;
         case 0x30:
           // 2, 3, 0, 1
-          m_vertices_3d.at(start_vtx_id + 0).info[2] = 2;
-          m_vertices_3d.at(start_vtx_id + 1).info[2] = 3;
-          m_vertices_3d.at(start_vtx_id + 2).info[2] = 1;
-          m_vertices_3d.at(start_vtx_id + 3).info[2] = 0;
+          vert1.info[2] = corner_order(2, 3, 1, 0);
           break;
       }
     }
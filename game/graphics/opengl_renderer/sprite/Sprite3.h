@@ -10,12 +10,13 @@
 #include "game/graphics/opengl_renderer/BucketRenderer.h"
 #include "game/graphics/opengl_renderer/DirectRenderer.h"
 #include "game/graphics/opengl_renderer/background/background_common.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 #include "game/graphics/opengl_renderer/sprite/GlowRenderer.h"
 #include "game/graphics/opengl_renderer/sprite/sprite_common.h"
 
 class Sprite3 : public BucketRenderer {
  public:
-  Sprite3(const std::string& name, int my_id);
+  Sprite3(const std::string& name, int my_id, std::shared_ptr<FramebufferCopier> fb_copier);
   void render(DmaFollower& dma, SharedRenderState* render_state, ScopedProfilerNode& prof) override;
   void draw_debug_window() override;
   static constexpr int SPRITES_PER_CHUNK = 48;
@@ -37,8 +38,9 @@ class Sprite3 : public BucketRenderer {
   void distort_setup_instanced(ScopedProfilerNode& prof);
   void distort_draw(SharedRenderState* render_state, ScopedProfilerNode& prof);
   void distort_draw_instanced(SharedRenderState* render_state, ScopedProfilerNode& prof);
-  void distort_draw_common(SharedRenderState* render_state, ScopedProfilerNode& prof);
-  void distort_setup_framebuffer_dims(SharedRenderState* render_state);
+  void distort_draw_common(SharedRenderState* render_state,
+                           ScopedProfilerNode& prof,
+                           const TexCoordBounds& bounds);
   void handle_sprite_frame_setup(DmaFollower& dma,
                                  GameVersion version,
                                  SharedRenderState* render_state,
@@ -121,12 +123,11 @@ class Sprite3 : public BucketRenderer {
     GLuint vao;
     GLuint vertex_buffer;
     GLuint index_buffer;
-    GLuint fbo;
-    GLuint fbo_texture;
-    int fbo_width = 640;
-    int fbo_height = 480;
   } m_distort_ogl;
 
+  // copy of the framebuffer that distort samples, shared with warp.
+  std::shared_ptr<FramebufferCopier> m_distort_fb_copier;
+
   struct {
     GLuint vao;
     GLuint vertex_buffer;    // contains vertex data for each possible sprite resolution (3-11)
@@ -134,6 +135,7 @@ class Sprite3 : public BucketRenderer {
     float last_aspect_x = -1.0;
     float last_aspect_y = -1.0;
     bool vertex_data_changed = false;
+    float max_st_offset = 0;  // largest texture coordinate offset in the meshes, before scaling
   } m_distort_instanced_ogl;
 
   struct {
@@ -164,6 +166,8 @@ class Sprite3 : public BucketRenderer {
     int count_2d_grp0 = 0;
     int blocks_2d_grp1 = 0;
     int count_2d_grp1 = 0;
+    int tex_lookups = 0;
+    int tex_lookups_skipped = 0;
   } m_debug_stats;
 
   bool m_enable_distort_instancing = true;
@@ -179,25 +183,26 @@ class Sprite3 : public BucketRenderer {
     math::Vector4f quat_sy;             // quaternion + y scale
     math::Vector4f rgba;                // color
     math::Vector<u16, 2> flags_matrix;  // flags + matrix... split
-    math::Vector<u16, 4> info;
+    math::Vector<u16, 4> info;  // x: unused, y: tcc, z: corner order, w: mode
     math::Vector<u8, 4> pad;
   };
   static_assert(sizeof(SpriteVertex3D) == 64);
 
+  // one per sprite, drawn as a 4 vertex instance.
   std::vector<SpriteVertex3D> m_vertices_3d;
+  void set_instance_attributes(u32 byte_offset);
 
   struct {
-    GLuint vertex_buffer;
+    std::unique_ptr<StreamingBuffer> vertex_stream;
     GLuint vao;
-    GLuint index_buffer;
   } m_ogl;
 
   DrawMode m_current_mode, m_default_mode;
   u32 m_current_tbp = 0;
 
   struct Bucket {
-    std::vector<u32> ids;
-    u32 offset_in_idx_buffer = 0;
+    std::vector<SpriteVertex3D> sprites;
+    u32 first_sprite = 0;
     u64 key = -1;
   };
 
@@ -208,6 +213,4 @@ class Sprite3 : public BucketRenderer {
   Bucket* m_last_bucket = nullptr;
 
   u64 m_sprite_idx = 0;
-
-  std::vector<u32> m_index_buffer_data;
 };
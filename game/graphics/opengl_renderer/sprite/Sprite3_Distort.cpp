@@ -1,4 +1,8 @@
 #include "Sprite3.h"
+
+#include <algorithm>
+#include <cmath>
+
 #include "game/graphics/opengl_renderer/dma_helpers.h"
 
 namespace {
@@ -16,30 +20,8 @@ constexpr int SPRITE_RENDERER_MAX_DISTORT_SPRITES =
 }  // namespace
 
 void Sprite3::opengl_setup_distort() {
-  // Create framebuffer to snapshot current render to a texture that can be bound for the distort
-  // shader This will represent tex0 from the original GS data
-  glGenFramebuffers(1, &m_distort_ogl.fbo);
-  glBindFramebuffer(GL_FRAMEBUFFER, m_distort_ogl.fbo);
-
-  glGenTextures(1, &m_distort_ogl.fbo_texture);
-  glBindTexture(GL_TEXTURE_2D, m_distort_ogl.fbo_texture);
-
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_distort_ogl.fbo_width, m_distort_ogl.fbo_height, 0,
-               GL_RGB, GL_UNSIGNED_BYTE, NULL);
-
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-  // Texture clamping here matches the GS init data for distort
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-  glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                         m_distort_ogl.fbo_texture, 0);
-
-  ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
-
-  glBindTexture(GL_TEXTURE_2D, 0);
-  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  // The framebuffer snapshot that the distort shader samples is m_distort_fb_copier's texture.
+  // This will represent tex0 from the original GS data.
 
   // Non-instancing
   // ----------------------
@@ -418,6 +400,7 @@ void Sprite3::distort_setup_instanced(ScopedProfilerNode& /*prof*/) {
     m_distort_instanced_ogl.last_aspect_y = m_sprite_distorter_sine_tables_aspect.y();
     // Aspect ratio changed, which means we have a new sine table
     m_sprite_distorter_vertices_instanced.clear();
+    m_distort_instanced_ogl.max_st_offset = 0;
 
     // Build a mesh for every possible distort sprite resolution
     auto vf03 = math::Vector2f(0, 0);
@@ -441,6 +424,11 @@ void Sprite3::distort_setup_instanced(ScopedProfilerNode& /*prof*/) {
         m_sprite_distorter_vertices_instanced.push_back({vf06, vf07});
         m_sprite_distorter_vertices_instanced.push_back({vf08, vf09});
         m_sprite_distorter_vertices_instanced.push_back({vf14, vf03});
+
+        for (float st : {vf07.x(), vf07.y(), vf09.x(), vf09.y()}) {
+          m_distort_instanced_ogl.max_st_offset =
+              std::max(m_distort_instanced_ogl.max_st_offset, std::abs(st));
+        }
       }
     }
 
@@ -475,16 +463,18 @@ void Sprite3::distort_setup_instanced(ScopedProfilerNode& /*prof*/) {
  * Draws each distort sprite.
  */
 void Sprite3::distort_draw(SharedRenderState* render_state, ScopedProfilerNode& prof) {
-  // First, make sure the distort framebuffer is the correct size
-  distort_setup_framebuffer_dims(render_state);
-
   if (m_distort_stats.total_tris == 0) {
     // No distort sprites to draw, we can end early
     return;
   }
 
+  TexCoordBounds bounds;
+  for (const auto& vert : m_sprite_distorter_vertices) {
+    bounds.add(vert.st.x(), vert.st.y());
+  }
+
   // Do common distort drawing logic
-  distort_draw_common(render_state, prof);
+  distort_draw_common(render_state, prof, bounds);
 
   // Set up shader
   auto shader = &render_state->shaders[ShaderId::SPRITE_DISTORT];
@@ -529,16 +519,25 @@ void Sprite3::distort_draw(SharedRenderState* render_state, ScopedProfilerNode&
  * Draws each distort sprite using instanced rendering.
  */
 void Sprite3::distort_draw_instanced(SharedRenderState* render_state, ScopedProfilerNode& prof) {
-  // First, make sure the distort framebuffer is the correct size
-  distort_setup_framebuffer_dims(render_state);
-
   if (m_distort_stats.total_tris == 0) {
     // No distort sprites to draw, we can end early
     return;
   }
 
+  // the shader offsets each sprite's texture coordinate by the mesh's, scaled by x or z.
+  TexCoordBounds bounds;
+  for (const auto& [res, instances] : m_sprite_distorter_instances_by_res) {
+    for (const auto& instance : instances) {
+      const auto& scale = instance.sx_sy_sz_t;
+      const float r = m_distort_instanced_ogl.max_st_offset *
+                      std::max(std::abs(scale.x()), std::abs(scale.z()));
+      bounds.add(instance.x_y_z_s.w() - r, scale.w() - r);
+      bounds.add(instance.x_y_z_s.w() + r, scale.w() + r);
+    }
+  }
+
   // Do common distort drawing logic
-  distort_draw_common(render_state, prof);
+  distort_draw_common(render_state, prof, bounds);
 
   // Set up shader
   auto shader = &render_state->shaders[ShaderId::SPRITE_DISTORT_INSTANCED];
@@ -591,29 +590,22 @@ void Sprite3::distort_draw_instanced(SharedRenderState* render_state, ScopedProf
   glBindVertexArray(0);
 }
 
-void Sprite3::distort_draw_common(SharedRenderState* render_state, ScopedProfilerNode& /*prof*/) {
+void Sprite3::distort_draw_common(SharedRenderState* render_state,
+                                  ScopedProfilerNode& /*prof*/,
+                                  const TexCoordBounds& bounds) {
   // The distort effect needs to read the current framebuffer, so copy what's been rendered so far
-  // to a texture that we can then pass to the shader
-  glBindFramebuffer(GL_READ_FRAMEBUFFER, render_state->render_fb);
-  glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_distort_ogl.fbo);
-
-  glBlitFramebuffer(0,                          // srcX0
-                    0,                          // srcY0
-                    render_state->render_fb_w,  // srcX1
-                    render_state->render_fb_h,  // srcY1
-                    0,                          // dstX0
-                    0,                          // dstY0
-                    m_distort_ogl.fbo_width,    // dstX1
-                    m_distort_ogl.fbo_height,   // dstY1
-                    GL_COLOR_BUFFER_BIT,        // mask
-                    GL_NEAREST                  // filter
-  );
-
-  glBindFramebuffer(GL_FRAMEBUFFER, render_state->render_fb);
+  // to a texture that we can then pass to the shader. Only the part the sprites sample is needed.
+  if (render_state->partial_screen_copies) {
+    m_distort_fb_copier->copy_region_now(render_state->render_fb_w, render_state->render_fb_h,
+                                         render_state->render_fb, bounds);
+  } else {
+    m_distort_fb_copier->copy_now(render_state->render_fb_w, render_state->render_fb_h,
+                                  render_state->render_fb);
+  }
 
   // Set up OpenGL state
   m_current_mode.set_depth_write_enable(!m_sprite_distorter_setup.zbuf.zmsk());  // zbuf
-  glBindTexture(GL_TEXTURE_2D, m_distort_ogl.fbo_texture);                       // tex0
+  glBindTexture(GL_TEXTURE_2D, m_distort_fb_copier->texture());                  // tex0
   m_current_mode.set_filt_enable(m_sprite_distorter_setup.tex1.mmag());          // tex1
   update_mode_from_alpha1(m_sprite_distorter_setup.alpha.data, m_current_mode);  // alpha1
   // note: clamp and miptbp are skipped since that is set up ahead of time with the distort
@@ -621,19 +613,3 @@ void Sprite3::distort_draw_common(SharedRenderState* render_state, ScopedProfile
 
   setup_opengl_from_draw_mode(m_current_mode, GL_TEXTURE0, false);
 }
-
-void Sprite3::distort_setup_framebuffer_dims(SharedRenderState* render_state) {
-  // Distort framebuffer must be the same dimensions as the default window framebuffer
-  if (m_distort_ogl.fbo_width != render_state->render_fb_w ||
-      m_distort_ogl.fbo_height != render_state->render_fb_h) {
-    m_distort_ogl.fbo_width = render_state->render_fb_w;
-    m_distort_ogl.fbo_height = render_state->render_fb_h;
-
-    glBindTexture(GL_TEXTURE_2D, m_distort_ogl.fbo_texture);
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_distort_ogl.fbo_width, m_distort_ogl.fbo_height, 0,
-                 GL_RGB, GL_UNSIGNED_BYTE, NULL);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-  }
-}
@@ -0,0 +1,113 @@
+/*!
+ * @file headless.cpp
+ * Renderer for the headless mode. The frame times it reports are only the time the game spent
+ * running a frame, with nothing drawn and no waiting for vsync.
+ */
+
+#include "headless.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/global_profiler/GlobalProfiler.h"
+#include "common/global_profiler/Telemetry.h"
+#include "common/log/log.h"
+#include "common/util/Timer.h"
+
+#include "game/kernel/common/kmachine.h"
+
+namespace {
+
+struct HeadlessData {
+  Timer frame_timer;
+  std::vector<float> frame_ms;
+  u32 frame_idx = 0;
+};
+
+HeadlessData* g_headless_data = nullptr;
+
+int headless_init(GfxGlobalSettings& /*settings*/) {
+  g_headless_data = new HeadlessData;
+  lg::info("Headless mode: nothing is drawn, frames run as fast as possible");
+  return 0;
+}
+
+void headless_exit() {
+  if (!g_headless_data) {
+    return;
+  }
+  auto& frames = g_headless_data->frame_ms;
+  if (!frames.empty()) {
+    double total_ms = 0;
+    for (auto ms : frames) {
+      total_ms += ms;
+    }
+    std::sort(frames.begin(), frames.end());
+    lg::info("Headless mode: {} frames, {:.3f} ms average, {:.3f} ms median, {:.3f} ms max",
+             frames.size(), total_ms / frames.size(), frames[frames.size() / 2], frames.back());
+  }
+  if (telemetry().is_enabled()) {
+    telemetry().flush();
+  }
+  delete g_headless_data;
+  g_headless_data = nullptr;
+}
+
+u32 headless_vsync() {
+  if (!g_headless_data) {
+    return 0;
+  }
+  prof().instant_event("headless-vsync");
+  // the time before the first vsync is startup, not a frame.
+  if (g_headless_data->frame_idx > 0) {
+    const double frame_s = g_headless_data->frame_timer.getSeconds();
+    g_headless_data->frame_ms.push_back(frame_s * 1000);
+    // a frame counts as long if it couldn't have run at 1.5x the target frame time.
+    telemetry().frame(frame_s, 1.5 / Gfx::g_global_settings.target_fps);
+  }
+
+  ee_timer_next_frame();
+  g_headless_data->frame_idx++;
+  const int frame_limit = Gfx::g_global_settings.headless_frames;
+  if (frame_limit > 0 && g_headless_data->frame_idx >= (u32)frame_limit) {
+    lg::info("Headless mode: ran {} frames, exiting", frame_limit);
+    MasterExit = RuntimeExitStatus::EXIT;
+  }
+  g_headless_data->frame_timer.start();
+  return g_headless_data->frame_idx & 1;
+}
+
+u32 headless_sync_path() {
+  return 0;
+}
+
+void headless_flush() {}
+
+void headless_send_chain(const void* /*data*/, u32 /*offset*/) {}
+
+void headless_texture_upload_now(const u8* /*tpage*/, int /*mode*/, u32 /*s7_ptr*/) {}
+
+void headless_texture_relocate(u32 /*destination*/, u32 /*source*/, u32 /*format*/) {}
+
+void headless_set_levels(const std::vector<std::string>& /*levels*/) {}
+
+void headless_set_pmode_alp(float /*val*/) {}
+
+}  // namespace
+
+const GfxRendererModule gRendererHeadless = {
+    headless_init,                // init
+    nullptr,                      // make_display
+    headless_exit,                // exit
+    headless_vsync,               // vsync
+    headless_sync_path,           // sync_path
+    headless_flush,               // flush
+    headless_send_chain,          // send_chain
+    headless_texture_upload_now,  // texture_upload_now
+    headless_texture_relocate,    // texture_relocate
+    headless_set_levels,          // set_levels
+    headless_set_levels,          // set_active_levels
+    headless_set_pmode_alp,       // set_pmode_alp
+    GfxPipeline::Headless,        // pipeline
+    "Headless"                    // name
+};
@@ -0,0 +1,11 @@
+#pragma once
+
+/*!
+ * @file headless.h
+ * Renderer for benchmarking the game without a window or GPU. It draws nothing, and each vsync
+ * returns right away after stepping the EE timer a frame.
+ */
+
+#include "game/graphics/gfx.h"
+
+extern const GfxRendererModule gRendererHeadless;
@@ -5,6 +5,8 @@
 
 #include "opengl.h"
 
+#include <algorithm>
+#include <array>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -12,6 +14,7 @@
 
 #include "common/dma/dma_copy.h"
 #include "common/global_profiler/GlobalProfiler.h"
+#include "common/global_profiler/Telemetry.h"
 #include "common/goal_constants.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
@@ -20,11 +23,14 @@
 #include "common/util/compress.h"
 
 #include "game/graphics/display.h"
+#include "game/graphics/frame_replay.h"
 #include "game/graphics/gfx.h"
 #include "game/graphics/opengl_renderer/OpenGLRenderer.h"
 #include "game/graphics/opengl_renderer/debug_gui.h"
+#include "game/graphics/opengl_renderer/opengl_utils.h"
 #include "game/graphics/screenshot.h"
 #include "game/graphics/texture/TexturePool.h"
+#include "game/kernel/common/kmalloc.h"
 #include "game/runtime.h"
 #include "game/sce/libscf.h"
 #include "game/system/hid/input_manager.h"
@@ -44,24 +50,48 @@
 
 #include "third-party/stb_image/stb_image.h"
 
-constexpr bool run_dma_copy = false;
+/*!
+ * A DMA chain sent by the game. Normally the renderer reads the chain in the game's memory, so the
+ * game has to wait for it to be rendered before building the next one there. With pipelined_dma,
+ * the chain is copied when it's sent instead, and the game can keep going.
+ */
+struct SentChain {
+  const void* data = nullptr;
+  u32 offset = 0;
+  bool copied = false;
+  DmaData copy;  // if copied, data and offset point into this.
+};
 
-constexpr PerGameVersion<int> fr3_level_count(jak1::LEVEL_TOTAL,
-                                              jak2::LEVEL_TOTAL,
-                                              jak3::LEVEL_TOTAL);
+// The chain being rendered, one waiting to be rendered, and one the game is copying.
+constexpr int kMaxChainsInFlight = 3;
+
+static std::shared_ptr<Loader> make_loader(GameVersion version) {
+  auto loader = std::make_shared<Loader>(
+      file_util::get_jak_project_dir() / "out" / game_version_names[version] / "fr3",
+      fr3_level_count[version], file_util::get_user_misc_dir(version) / "level-adjacency.json");
+  // the renderer loads this after compiling its shaders, read it in the meantime.
+  loader->start_reading_common("GAME");
+  return loader;
+}
 
 struct GraphicsData {
   // vsync
   std::mutex sync_mutex;
   std::condition_variable sync_cv;
 
-  // dma chain transfer
+  // dma chain transfer. The chains are used in order. A chain belongs to the game until it's sent,
+  // then to the renderer until it's rendered.
   std::mutex dma_mutex;
-  std::condition_variable dma_cv;
+  std::condition_variable dma_cv;         // a chain was sent
+  std::condition_variable chain_done_cv;  // a chain was rendered
   u64 frame_idx = 0;
   u64 frame_idx_of_input_data = 0;
-  bool has_data_to_render = false;
-  FixedChunkDmaCopier dma_copier;
+  std::array<SentChain, kMaxChainsInFlight> chains;
+  int next_chain_to_send = 0;
+  int chains_in_flight = 0;         // sent, and not done rendering
+  FixedChunkDmaCopier send_copier;  // only used by the game thread
+  FixedChunkDmaCopier dma_copier;   // only used by the render thread, for replay captures
+  DmaStats last_dma_stats;
 
   // texture pool
   std::shared_ptr<TexturePool> texture_pool;
@@ -72,8 +102,13 @@ struct GraphicsData {
   OpenGLRenderer ogl_renderer;
 
   OpenGlDebugGui debug_gui;
+  frame_replay::Recorder replay_recorder;
 
   FrameLimiter frame_limiter;
+  Timer telemetry_frame_timer;
+  // time the render thread spent waiting, for the loader's upload budget
+  float idle_ms = 0;
+  float last_idle_ms = -1;
   Timer engine_timer;
   double last_engine_time = 1. / 60.;
   float pmode_alp = 1.f;
@@ -82,11 +117,10 @@ struct GraphicsData {
   GameVersion version;
 
   GraphicsData(GameVersion version)
-      : dma_copier(EE_MAIN_MEM_SIZE),
+      : send_copier(EE_MAIN_MEM_SIZE),
+        dma_copier(EE_MAIN_MEM_SIZE),
         texture_pool(std::make_shared<TexturePool>(version)),
-        loader(std::make_shared<Loader>(
-            file_util::get_jak_project_dir() / "out" / game_version_names[version] / "fr3",
-            fr3_level_count[version])),
+        loader(make_loader(version)),
         ogl_renderer(texture_pool, loader, version),
         debug_gui(),
         version(version) {}
@@ -211,7 +245,7 @@ static void init_imgui(SDL_Window* window,
 static std::shared_ptr<GfxDisplay> gl_make_display(int width,
                                                    int height,
                                                    const char* title,
-                                                   GfxGlobalSettings& /*settings*/,
+                                                   GfxGlobalSettings& settings,
                                                    GameVersion game_version,
                                                    bool is_main) {
   // Setup the window
@@ -267,11 +301,48 @@ static std::shared_ptr<GfxDisplay> gl_make_display(int width,
                                              "supports this and your drivers are up to date.");
         return NULL;
       }
+      load_buffer_storage((GLADloadproc)SDL_GL_GetProcAddress);
+      load_parallel_shader_compile((GLADloadproc)SDL_GL_GetProcAddress);
     }
     {
       auto p = scoped_prof("startup::sdl::gfx_data_init");
       g_gfx_data = std::make_unique<GraphicsData>(game_version);
+      g_gfx_data->loader->set_gpu_budget(size_t(settings.level_gpu_budget_mb) * 1024 * 1024);
+      g_gfx_data->loader->set_texture_streaming(settings.texture_streaming);
+      g_gfx_data->loader->set_tfrag_texture_arrays(settings.tfrag_texture_arrays);
     }
+    if (settings.gl_upload_thread) {
+      auto p = scoped_prof("startup::sdl::create_upload_context");
+      SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+      SDL_GLContext upload_context = SDL_GL_CreateContext(window);
+      SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+      // creating a context makes it current.
+      SDL_GL_MakeCurrent(window, gl_context);
+      if (!upload_context) {
+        sdl_util::log_error("Could not create the upload GL context, using the render thread");
+      } else {
+        g_gfx_data->loader->start_upload_thread(
+            *g_gfx_data->texture_pool,
+            [=] { return SDL_GL_MakeCurrent(window, upload_context); },
+            [=] {
+              SDL_GL_MakeCurrent(window, nullptr);
+              SDL_GL_DestroyContext(upload_context);
+            });
+      }
+    }
+    telemetry().set_info_callback([](nlohmann::json& report) {
+      report["levels"] = g_gfx_data->loader->loaded_level_names();
+      if (kglobalheap.offset) {
+        report["global_heap"] = {{"used", kheapused(kglobalheap)},
+                                 {"size", kglobalheap->top_base - kglobalheap->base}};
+      }
+      if (auto display = Display::GetMainDisplay()) {
+        const auto input_age = display->get_input_manager()->take_input_age_stats();
+        report["input"] = {{"reads", input_age.reads},
+                           {"avg_age_ms", input_age.avg_ms},
+                           {"max_age_ms", input_age.max_ms}};
+      }
+    });
     gl_inited = true;
     const char* gl_version = (const char*)glGetString(GL_VERSION);
     lg::info("OpenGL initialized - v{}.{} | Renderer: {}", GLVersion.major, GLVersion.minor,
@@ -349,6 +420,9 @@ GLDisplay::GLDisplay(SDL_Window* window, SDL_GLContext gl_context, bool is_main)
   m_input_manager->register_command(
       CommandBinding::Source::KEYBOARD,
       CommandBinding(SDLK_F2, [&]() { m_take_screenshot_next_frame = true; }));
+  if (is_main && Gfx::g_global_settings.input_poll_thread) {
+    m_input_manager->start_poll_thread();
+  }
 }
 
 GLDisplay::~GLDisplay() {
@@ -359,6 +433,13 @@ GLDisplay::~GLDisplay() {
   ImGui_ImplOpenGL3_Shutdown();
   ImGui_ImplSDL3_Shutdown();
   ImGui::DestroyContext();
+  for (auto fence : m_present_fences) {
+    glDeleteSync(fence);
+  }
+  // the upload thread has a context for this window too.
+  if (m_main && g_gfx_data) {
+    g_gfx_data->loader->stop_upload_thread();
+  }
   // Cleanup SDL
   SDL_GL_DestroyContext(m_gl_context);
   SDL_DestroyWindow(m_window);
@@ -376,18 +457,31 @@ void render_game_frame(int game_width,
                        int draw_region_height,
                        int msaa_samples,
                        bool take_screenshot) {
-  // wait for a copied chain.
-  bool got_chain = false;
+  // wait for a chain.
+  const SentChain* chain = nullptr;
   {
     auto p = scoped_prof("wait-for-dma");
+    ScopedTelemetryTime t("wait-for-dma");
+    Timer wait_timer;
     std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
     // there's a timeout here, so imgui can still be responsive even if we don't render anything
-    got_chain = g_gfx_data->dma_cv.wait_for(lock, std::chrono::milliseconds(40),
-                                            [=] { return g_gfx_data->has_data_to_render; });
+    if (g_gfx_data->dma_cv.wait_for(lock, std::chrono::milliseconds(40),
+                                    [=] { return g_gfx_data->chains_in_flight > 0; })) {
+      // the oldest one that was sent
+      chain = &g_gfx_data->chains[(g_gfx_data->next_chain_to_send + kMaxChainsInFlight -
+                                   g_gfx_data->chains_in_flight) %
+                                  kMaxChainsInFlight];
+    } else {
+      telemetry().count_event("wait-for-dma-timeout");
+    }
+    g_gfx_data->idle_ms += wait_timer.getMs();
   }
   // render that chain.
-  if (got_chain) {
-    g_gfx_data->frame_idx_of_input_data = g_gfx_data->frame_idx;
+  if (chain) {
+    {
+      std::unique_lock<std::mutex> lock(g_gfx_data->sync_mutex);
+      g_gfx_data->frame_idx_of_input_data = g_gfx_data->frame_idx;
+    }
     RenderOptions options;
     options.game_res_w = game_width;
     options.game_res_h = game_height;
@@ -396,6 +490,9 @@ void render_game_frame(int game_width,
     options.draw_region_width = draw_region_width;
     options.draw_region_height = draw_region_height;
     options.msaa_samples = msaa_samples;
+    options.dynamic_resolution = Gfx::g_global_settings.dynamic_resolution;
+    options.dynamic_resolution_min_scale = Gfx::g_global_settings.dynamic_resolution_min_scale;
+    options.target_frame_ms = 1000.f / std::max(1.f, Gfx::g_global_settings.target_fps);
     options.draw_render_debug_window = g_gfx_data->debug_gui.should_draw_render_debug();
     options.draw_profiler_window = g_gfx_data->debug_gui.should_draw_profiler();
     options.draw_loader_window = g_gfx_data->debug_gui.should_draw_loader_menu();
@@ -430,6 +527,7 @@ void render_game_frame(int game_width,
     options.draw_small_profiler_window =
         g_gfx_data->debug_gui.master_enable && g_gfx_data->debug_gui.small_profiler;
     options.pmode_alp_register = g_gfx_data->pmode_alp;
+    options.frame_slack_ms = g_gfx_data->last_idle_ms;
 
     GLint msaa_max;
     glGetIntegerv(GL_MAX_SAMPLES, &msaa_max);
@@ -437,25 +535,34 @@ void render_game_frame(int game_width,
       options.msaa_samples = msaa_max;
     }
 
-    if constexpr (run_dma_copy) {
-      auto& chain = g_gfx_data->dma_copier.get_last_result();
-      g_gfx_data->ogl_renderer.render(DmaFollower(chain.data.data(), chain.start_offset), options);
-    } else {
+    if (int frames = g_gfx_data->debug_gui.get_replay_capture_request()) {
+      g_gfx_data->replay_recorder.start(frames, g_gfx_data->version, options);
+    }
+    if (g_gfx_data->replay_recorder.active()) {
+      auto p = scoped_prof("replay-capture");
+      g_gfx_data->replay_recorder.add_frame(
+          chain->copied ? chain->copy : g_gfx_data->dma_copier.run(chain->data, chain->offset),
+          *g_gfx_data->texture_pool, *g_gfx_data->loader, options.pmode_alp_register);
+    }
+    g_gfx_data->last_dma_stats =
+        chain->copied ? chain->copy.stats : g_gfx_data->dma_copier.get_last_result().stats;
+
+    // a copied chain can't change while we're reading it, so the buckets can be done in parallel.
+    options.prepare_buckets_in_parallel = chain->copied;
+    {
       auto p = scoped_prof("ogl-render");
-      g_gfx_data->ogl_renderer.render(DmaFollower(g_gfx_data->dma_copier.get_last_input_data(),
-                                                  g_gfx_data->dma_copier.get_last_input_offset()),
-                                      options);
+      g_gfx_data->ogl_renderer.render(DmaFollower(chain->data, chain->offset), options);
     }
   }
 
   // before vsync, mark the chain as rendered.
   {
-    // should be fine to remove this mutex if the game actually waits for vsync to call
-    // send_chain again. but let's be safe for now.
     std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
     g_gfx_data->engine_timer.start();
-    g_gfx_data->has_data_to_render = false;
-    g_gfx_data->sync_cv.notify_all();
+    if (chain) {
+      g_gfx_data->chains_in_flight--;
+      g_gfx_data->chain_done_cv.notify_all();
+    }
   }
 }
 
@@ -482,10 +589,61 @@ void GLDisplay::process_sdl_events() {
   }
 }
 
+/*!
+ * Set the swap interval for the vsync settings, if they changed.
+ */
+void GLDisplay::update_swap_interval() {
+  const bool adaptive = Gfx::g_global_settings.adaptive_vsync && m_adaptive_vsync_supported;
+  const int interval = Gfx::g_global_settings.vsync ? (adaptive ? -1 : 1) : 0;
+  if (interval == m_swap_interval) {
+    return;
+  }
+  if (SDL_GL_SetSwapInterval(interval)) {
+    m_swap_interval = interval;
+    return;
+  }
+  if (interval == -1) {
+    lg::warn("Adaptive vsync isn't supported, using normal vsync: {}", SDL_GetError());
+    m_adaptive_vsync_supported = false;
+    update_swap_interval();
+  } else {
+    lg::error("Failed to set the swap interval to {}: {}", interval, SDL_GetError());
+    m_swap_interval = interval;
+  }
+}
+
+/*!
+ * The driver may queue a few frames before the GPU gets to them, and the input for a queued frame
+ * is read long before it's shown. Wait until the GPU is done with all but max_queued_frames of the
+ * presented frames, so the next frame reads the input as late as possible.
+ */
+void GLDisplay::wait_for_queued_frames() {
+  const size_t max_queued = Gfx::g_global_settings.max_queued_frames;
+  if (max_queued == 0) {
+    for (auto fence : m_present_fences) {
+      glDeleteSync(fence);
+    }
+    m_present_fences.clear();
+    return;
+  }
+
+  auto p = scoped_prof("wait-queued-frames");
+  Timer wait_timer;
+  while (m_present_fences.size() > max_queued) {
+    // one second, so a GPU hang doesn't hang us too.
+    glClientWaitSync(m_present_fences.front(), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    glDeleteSync(m_present_fences.front());
+    m_present_fences.pop_front();
+  }
+  g_gfx_data->idle_ms += wait_timer.getMs();
+}
+
 /*!
  * Main function called to render graphics frames. This is called in a loop.
  */
 void GLDisplay::render() {
+  wait_for_queued_frames();
+
   // Before we process the current frames SDL events we for keyboard/mouse button inputs.
   //
   // This technically means that keyboard/mouse button inputs will be a frame behind but the
@@ -508,6 +666,7 @@ void GLDisplay::render() {
   }
   // Now process SDL Events
   process_sdl_events();
+  m_input_manager->publish_frame_input();
   // Also process any display related events received from the EE (the game)
   // this is done here so they run from the perspective of the graphics thread
   {
@@ -559,7 +718,7 @@ void GLDisplay::render() {
   // render debug
   if (is_imgui_visible()) {
     auto p = scoped_prof("debug-gui");
-    g_gfx_data->debug_gui.draw(g_gfx_data->dma_copier.get_last_result().stats);
+    g_gfx_data->debug_gui.draw(g_gfx_data->last_dma_stats);
   }
   {
     auto p = scoped_prof("imgui-render");
@@ -571,28 +730,39 @@ void GLDisplay::render() {
   g_gfx_data->debug_gui.finish_frame();
   if (Gfx::g_global_settings.framelimiter) {
     auto p = scoped_prof("frame-limiter");
+    Timer limiter_timer;
     g_gfx_data->frame_limiter.run(
         Gfx::g_global_settings.target_fps, Gfx::g_global_settings.experimental_accurate_lag,
         Gfx::g_global_settings.sleep_in_frame_limiter, g_gfx_data->last_engine_time);
+    g_gfx_data->idle_ms += limiter_timer.getMs();
   }
 
   {
     auto p = scoped_prof("swap-buffers");
+    Timer swap_timer;
     SDL_GL_SwapWindow(m_window);
+    // with vsync, this blocks until the next refresh.
+    g_gfx_data->idle_ms += swap_timer.getMs();
+    g_gfx_data->debug_gui.present();
+    if (Gfx::g_global_settings.max_queued_frames > 0) {
+      m_present_fences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
   }
 
+  // a frame is long if it took 1.5x the target time.
+  telemetry().frame(g_gfx_data->telemetry_frame_timer.getSeconds(),
+                    1.5 / Gfx::g_global_settings.target_fps);
+  g_gfx_data->telemetry_frame_timer.start();
+  g_gfx_data->last_idle_ms = g_gfx_data->idle_ms;
+  g_gfx_data->idle_ms = 0;
+
   // actually wait for vsync
   if (g_gfx_data->debug_gui.should_gl_finish()) {
     glFinish();
   }
 
   // switch vsync modes, if requested
-  if (Gfx::g_global_settings.vsync != Gfx::g_global_settings.old_vsync) {
-    Gfx::g_global_settings.old_vsync = Gfx::g_global_settings.vsync;
-    // NOTE - -1 can be used for adaptive vsync, maybe useful for Jak 2+?
-    // https://wiki.libsdl.org/SDL3/SDL_GL_SetSwapInterval
-    SDL_GL_SetSwapInterval(Gfx::g_global_settings.vsync);
-  }
+  update_swap_interval();
 
   // Start timing for the next frame.
   g_gfx_data->debug_gui.start_frame();
@@ -641,51 +811,82 @@ u32 gl_vsync() {
   return g_gfx_data->frame_idx & 1;
 }
 
+/*!
+ * How many chains the game can send before it has to wait for the renderer.
+ */
+static int max_chains_in_flight() {
+  return Gfx::g_global_settings.pipelined_dma ? kMaxChainsInFlight : 1;
+}
+
+/*!
+ * Wait until the game can send another chain.
+ * Called from the game thread, on a GOAL stack.
+ */
 u32 gl_sync_path() {
   if (!g_gfx_data) {
     return 0;
   }
-  std::unique_lock<std::mutex> lock(g_gfx_data->sync_mutex);
+  std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
   g_gfx_data->last_engine_time = g_gfx_data->engine_timer.getSeconds();
-  if (!g_gfx_data->has_data_to_render) {
-    return 0;
-  }
-  g_gfx_data->sync_cv.wait(lock, [=] { return !g_gfx_data->has_data_to_render; });
+  g_gfx_data->chain_done_cv.wait(
+      lock, [=] { return g_gfx_data->chains_in_flight < max_chains_in_flight(); });
   return 0;
 }
 
+/*!
+ * Wait until the renderer is done with every chain that was sent.
+ * Called from the game thread.
+ */
+void gl_flush() {
+  if (!g_gfx_data) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
+  g_gfx_data->chain_done_cv.wait(lock, [=] { return g_gfx_data->chains_in_flight == 0; });
+}
+
 /*!
  * Send DMA to the renderer.
  * Called from the game thread, on a GOAL stack.
  */
 void gl_send_chain(const void* data, u32 offset) {
-  if (g_gfx_data) {
+  if (!g_gfx_data) {
+    return;
+  }
+
+  const bool copy = Gfx::g_global_settings.pipelined_dma;
+  SentChain* chain = nullptr;
+  {
     std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
-    if (g_gfx_data->has_data_to_render) {
+    if (g_gfx_data->chains_in_flight >= (copy ? kMaxChainsInFlight : 1)) {
       lg::error(
           "Gfx::send_chain called when the graphics renderer has pending data. Was this called "
           "multiple times per frame?");
       return;
     }
-
-    // we copy the dma data and give a copy of it to the render.
-    // the copy has a few advantages:
-    // - if the game code has a bug and corrupts the DMA buffer, the renderer won't see it.
-    // - the copied DMA is much smaller than the entire game memory, so it can be dumped to a
-    // file
-    //    separate of the entire RAM.
-    // - it verifies the DMA data is valid early on.
-    // but it may also be pretty expensive. Both the renderer and the game wait on this to
-    // complete.
-
-    // The renderers should just operate on DMA chains, so eliminating this step in the future
-    // may be easy.
-
-    g_gfx_data->dma_copier.set_input_data(data, offset, run_dma_copy);
-
-    g_gfx_data->has_data_to_render = true;
-    g_gfx_data->dma_cv.notify_all();
-  }
+    chain = &g_gfx_data->chains[g_gfx_data->next_chain_to_send];
+  }
+
+  // The renderer doesn't use this chain until it's counted as in flight, so we can fill it in
+  // without the lock. The copy also means that if the game code has a bug and corrupts the DMA
+  // buffer, the renderer won't see it. But it's not free, and the renderers still read some data,
+  // like textures, from the game's memory directly.
+  chain->copied = copy;
+  if (copy) {
+    g_gfx_data->send_copier.set_incremental(Gfx::g_global_settings.incremental_dma_copy);
+    g_gfx_data->send_copier.run(data, offset);
+    g_gfx_data->send_copier.swap_last_result(&chain->copy);
+    chain->data = chain->copy.data.data();
+    chain->offset = chain->copy.start_offset;
+  } else {
+    chain->data = data;
+    chain->offset = offset;
+  }
+
+  std::unique_lock<std::mutex> lock(g_gfx_data->dma_mutex);
+  g_gfx_data->next_chain_to_send = (g_gfx_data->next_chain_to_send + 1) % kMaxChainsInFlight;
+  g_gfx_data->chains_in_flight++;
+  g_gfx_data->dma_cv.notify_all();
 }
 
 /*!
@@ -731,6 +932,7 @@ const GfxRendererModule gRendererOpenGL = {
     gl_exit,                // exit
     gl_vsync,               // vsync
     gl_sync_path,           // sync_path
+    gl_flush,               // flush
     gl_send_chain,          // send_chain
     gl_texture_upload_now,  // texture_upload_now
     gl_texture_relocate,    // texture_relocate
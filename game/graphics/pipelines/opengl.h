@@ -6,6 +6,7 @@
  */
 
 #define GLFW_INCLUDE_NONE
+#include <deque>
 #include <mutex>
 
 #include "game/graphics/display.h"
@@ -36,6 +37,14 @@ class GLDisplay : public GfxDisplay {
   bool m_take_screenshot_next_frame = false;
   void process_sdl_events();
 
+  void update_swap_interval();
+  void wait_for_queued_frames();
+  // the swap interval that was last set, or 2 before the first one.
+  int m_swap_interval = 2;
+  bool m_adaptive_vsync_supported = true;
+  // a fence after each presented frame that the GPU may not have finished, oldest first.
+  std::deque<GLsync> m_present_fences;
+
   struct DisplayState {
     // move it a bit away from the top by default
     s32 window_pos_x = 50;
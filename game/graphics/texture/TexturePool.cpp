@@ -275,6 +275,37 @@ void TexturePool::relocate(u32 destination, u32 source, u32 format) {
   }
 }
 
+std::vector<u32> TexturePool::get_vram_state() {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  std::vector<u32> result;
+  for (u32 slot = 0; slot < m_textures.size(); slot++) {
+    const auto* source = m_textures[slot].source;
+    if (source) {
+      result.push_back(slot);
+      result.push_back((u32(source->tex_id.page) << 16) | source->tex_id.tex);
+    }
+  }
+  return result;
+}
+
+void TexturePool::set_vram_state(const std::vector<u32>& state) {
+  std::unique_lock<std::mutex> lk(m_mutex);
+  ASSERT(state.size() % 2 == 0);
+  for (size_t i = 0; i < state.size(); i += 2) {
+    u32 slot_addr = state[i];
+    auto id = PcTextureId::from_combo_id(state[i + 1]);
+    auto& slot = m_textures.at(slot_addr);
+    if (slot.source && slot.source->tex_id == id) {
+      continue;
+    }
+    // same as an upload of this texture, it may be a placeholder if the loader doesn't have it.
+    if (slot.source) {
+      slot.source->remove_slot(slot_addr);
+    }
+    slot.source = get_gpu_texture_for_slot(id, slot_addr);
+  }
+}
+
 GpuTexture* TexturePool::get_gpu_texture_for_slot(PcTextureId id, u32 slot) {
   auto it = m_loaded_textures.lookup_or_insert(id);
   if (!it.second) {
@@ -307,7 +338,7 @@ std::optional<u64> TexturePool::lookup_mt4hh(u32 location) {
 }
 
 namespace {
-const std::vector<u32>& get_tpage_dir(GameVersion version) {
+std::span<const u32> get_tpage_dir(GameVersion version) {
   switch (version) {
     case GameVersion::Jak1:
       return get_jak1_tpage_dir();
@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
 
@@ -77,7 +78,7 @@ constexpr int SKY_TEXTURE_VRAM_ADDRS[2] = {8064, 8096};
 template <typename T>
 class TextureMap {
  public:
-  TextureMap(const std::vector<u32>& tpage_dir) {
+  TextureMap(std::span<const u32> tpage_dir) {
     u32 off = 0;
     for (auto& x : tpage_dir) {
       m_dir.push_back(off);
@@ -344,6 +345,13 @@ class TexturePool {
   }
   void move_existing_to_vram(GpuTexture* tex, u32 slot_addr);
 
+  /*!
+   * Which texture the game has put in each VRAM slot, as (slot, combo texture id) pairs. This is
+   * saved in frame replay captures, so the replay can restore it without running the game.
+   */
+  std::vector<u32> get_vram_state();
+  void set_vram_state(const std::vector<u32>& state);
+
   std::mutex& mutex() { return m_mutex; }
   PcTextureId allocate_pc_port_texture(GameVersion version);
 
@@ -1,11 +1,11 @@
 #include "jak1_tpage_dir.h"
 
-#include <vector>
+#include <span>
 
 #include "common/common_types.h"
 namespace {
 
-std::vector<u32> tpage_dir = {
+constexpr u32 tpage_dir[] = {
     0x0, 0x2, 0x37, 0x1, 0x1, 0x10, 0x2, 0x4, 0x3, 0x2, 0x1, 0x5, 0x7, 0x8, 0x1, 0x1, 0x1, 0xb, 0xe,
     0x8, 0x1, 0x6, 0x4, 0x6, 0x3, 0x3, 0x6, 0x6, 0x4, 0x4, 0x4, 0xd, 0x1, 0x4, 0x9, 0xc, 0x1, 0x1,
     0x6, 0x3, 0x2, 0x14, 0x1, 0x1, 0x2, 0x2, 0x34, 0x34, 0x4, 0x15, 0x1, 0x1, 0x1, 0x8, 0x6, 0xb,
@@ -99,6 +99,6 @@ std::vector<u32> tpage_dir = {
     EXTRA_PC_PORT_TEXTURE_COUNT};
 }
 
-const std::vector<u32>& get_jak1_tpage_dir() {
+std::span<const u32> get_jak1_tpage_dir() {
   return tpage_dir;
 }
\ No newline at end of file
@@ -1,8 +1,8 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include "common/common_types.h"
 
-const std::vector<u32>& get_jak1_tpage_dir();
+std::span<const u32> get_jak1_tpage_dir();
 constexpr u32 EXTRA_PC_PORT_TEXTURE_COUNT = 64;
\ No newline at end of file
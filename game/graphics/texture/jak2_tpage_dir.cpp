@@ -1,6 +1,6 @@
 #include "jak2_tpage_dir.h"
 
-#include <vector>
+#include <span>
 
 #include "common/common_types.h"
 
@@ -8,7 +8,7 @@
 
 // clang-format off
 namespace {
-std::vector<u32> tpage_dir = {
+constexpr u32 tpage_dir[] = {
     0x0,   0x0,  0x0,   0x0,  0x0,  0x0,  0x0,   0x0,        0x0,   0x0,  0x0,  0xa5, 0xd5, 0x0,
     0x0,   0x0,  0x0,   0x0,  0x0,  0x0,  0x0,   0x3e,       0x0,   0x0,  0x0,  0x0,  0x0,  0x0,
     0x0,   0x0,  0x0,   0x4,  0x1,  0x9,  0x8,   0x0,        0x0,   0x0,  0x0,  0x0,  0x0,  0x9,
@@ -270,6 +270,6 @@ std::vector<u32> tpage_dir = {
 // note, there is a weird /*0x7fff0000*/ at the end that I removed
 }
 
-const std::vector<u32>& get_jak2_tpage_dir() {
+std::span<const u32> get_jak2_tpage_dir() {
   return tpage_dir;
 }
\ No newline at end of file
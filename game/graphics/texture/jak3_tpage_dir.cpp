@@ -3,1719 +3,1719 @@
 #include "game/graphics/texture/jak1_tpage_dir.h"
 
 namespace {
-std::vector<u32> tpage_dir = {0x0,   0x7,
-                              0x3,   0x5,
-                              0xba,  0x29,
-                              0x1b,  0x84,
-                              0x5,   0x5e,
-                              0x6,   0x19,
-                              0x6,   0x36,
-                              0x0,   0x26,
-                              0x0,   0x8c,
-                              0x1e,  0x0,
-                              0x17,  0x0,
-                              0x1,   0x4,
-                              0xe,   0x6,
-                              0x7,   0x7,
-                              0x6,   0x5,
-                              0x1e,  0x13,
-                              0x7,   0x7,
-                              0x2,   0x4,
-                              0x3,   0x3,
-                              0x0,   0x3,
-                              0xd,   0x10,
-                              0xa,   0x5,
-                              0x5,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x5,
-                              0x5,   0x2,
-                              0x7,   0x7,
-                              0x5,   0x9,
-                              0x9,   0x6,
-                              0x1e,  0x12,
-                              0x2,   0x2,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x8,   0x8,
-                              0x5,   0xb,
-                              0xc,   0x9,
-                              0x16,  0x1,
-                              0x14,  0x1,
-                              0x10,  0x1,
-                              0x1,   0x1,
-                              0x1,   0x3,
-                              0x1f,  0x13,
-                              0x13,  0x12,
-                              0x17,  0x1e,
-                              0x1a,  0x17,
-                              0x11,  0xf,
-                              0x14,  0xe,
-                              0x10,  0x16,
-                              0x1c,  0x16,
-                              0x19,  0x13,
-                              0x13,  0x2,
-                              0x7,   0x8,
-                              0x2,   0x3,
-                              0x14,  0x14,
-                              0xb,   0xb,
-                              0x10,  0x10,
-                              0x2,   0x2,
-                              0x9,   0x2,
-                              0x0,   0x23,
-                              0x0,   0x20,
-                              0xaf,  0x1b,
-                              0x0,   0x90,
-                              0x6,   0x6,
-                              0x4,   0x1,
-                              0x23,  0x51,
-                              0x44,  0x23,
-                              0x42,  0x0,
-                              0x0,   0x7f,
-                              0x1,   0x58,
-                              0x6,   0x6,
-                              0x4,   0x1,
-                              0x6,   0x6,
-                              0x5,   0x2f,
-                              0xd,   0x1,
-                              0x26,  0x14,
-                              0x1,   0x10,
-                              0x1,   0x4,
-                              0x1,   0x1,
-                              0x0,   0x25,
-                              0xd,   0x80,
-                              0x0,   0x20,
-                              0x7d,  0x1,
-                              0x0,   0x23,
-                              0xe,   0x7a,
-                              0x0,   0x23,
-                              0x79,  0x1,
-                              0xc,   0x3,
-                              0x4d,  0xc,
-                              0x4c,  0x1,
-                              0xa,   0x11,
-                              0x4,   0x52,
-                              0xa,   0x11,
-                              0x52,  0x3,
-                              0x2,   0x8,
-                              0xb,   0x16,
-                              0x2e,  0x3,
-                              0x8,   0xb,
-                              0x2e,  0x1,
-                              0x2,   0x3,
-                              0x1,   0x8,
-                              0xc,   0x16,
-                              0x35,  0x3,
-                              0x8,   0xc,
-                              0x35,  0x2,
-                              0x2,   0x1,
-                              0xd,   0x19,
-                              0x45,  0xd,
-                              0x46,  0x1,
-                              0x4f,  0x14,
-                              0x5,   0x67,
-                              0x37,  0x14,
-                              0x58,  0x3,
-                              0x3,   0x2,
-                              0xc,   0x8,
-                              0x44,  0xc,
-                              0x44,  0x6,
-                              0x1d,  0x5,
-                              0x1,   0x16,
-                              0xb,   0x6,
-                              0x2e,  0x5,
-                              0x16,  0xb,
-                              0x2e,  0x1,
-                              0x1,   0x5,
-                              0x1,   0x19,
-                              0xb,   0x6,
-                              0x2a,  0x5,
-                              0x19,  0xb,
-                              0x2a,  0x1,
-                              0x1,   0x5,
-                              0x5,   0x5,
-                              0x4,   0x6,
-                              0x1d,  0x1f,
-                              0x10,  0x6,
-                              0x6,   0x65,
-                              0x14,  0x1e,
-                              0x63,  0x2,
-                              0x3,   0x4,
-                              0x5,   0x5,
-                              0x4,   0x4,
-                              0x2,   0x6,
-                              0x5,   0x48,
-                              0x6,   0x5,
-                              0x48,  0x0,
-                              0x4,   0x0,
-                              0x0,   0x2,
-                              0x2,   0x1,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x4,   0x4,
-                              0x4,   0x2,
-                              0x4,   0x4,
-                              0xd1,  0x17,
-                              0x3,   0x3,
-                              0x3,   0x9,
-                              0x1,   0x1,
-                              0x0,   0x37,
-                              0xc4,  0x1,
-                              0x31,  0x73,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x78,
-                              0xe,   0x2d,
-                              0x2,   0x0,
-                              0x0,   0x0,
-                              0x11,  0x11,
-                              0x1c,  0x0,
-                              0x1,   0x15,
-                              0x7,   0x1,
-                              0x2,   0x0,
-                              0x9,   0x2,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x2a,
-                              0x4,   0x27,
-                              0x58,  0x4,
-                              0x2d,  0x47,
-                              0x2,   0x27,
-                              0x1,   0x6,
-                              0x1,   0x26,
-                              0x0,   0x0,
-                              0x0,   0x2,
-                              0x20,  0x2,
-                              0x1,   0x2,
-                              0x1,   0x0,
-                              0x7,   0x0,
-                              0x0,   0x0,
-                              0xd,   0x3b,
-                              0x7,   0x1,
-                              0x0,   0x0,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0x2,   0x0,
-                              0x35,  0x0,
-                              0x95,  0x7,
-                              0x7,   0x6,
-                              0x1,   0xd7,
-                              0x0,   0x0,
-                              0xe,   0x0,
-                              0x6,   0x0,
-                              0x6,   0xf,
-                              0xa,   0x85,
-                              0x1c,  0x0,
-                              0x79,  0x1a,
-                              0x34,  0x3,
-                              0x5d,  0x5f,
-                              0x5,   0x3,
-                              0x1f,  0x16,
-                              0x4,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x25,  0x1,
-                              0x0,   0x4,
-                              0x24,  0x4,
-                              0x1,   0x0,
-                              0x9,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x7,
-                              0x5,   0x1,
-                              0x5,   0x1,
-                              0xb,   0xb,
-                              0x0,   0x0,
-                              0x14,  0x2,
-                              0x2,   0x12,
-                              0x6,   0x0,
-                              0x1,   0x0,
-                              0x1,   0x1,
-                              0x2c,  0x82,
-                              0x3,   0x2,
-                              0x2,   0x0,
-                              0x0,   0x4,
-                              0x0,   0x6,
-                              0x6,   0x56,
-                              0x0,   0x0,
-                              0x0,   0x2,
-                              0x24,  0x5d,
-                              0x4,   0x46,
-                              0x7,   0xe,
-                              0x55,  0x15,
-                              0x5e,  0x57,
-                              0x16,  0x3b,
-                              0x5a,  0x2,
-                              0x12,  0x3,
-                              0x2,   0x3,
-                              0x3,   0x1,
-                              0x18,  0x2,
-                              0x0,   0x2,
-                              0x2,   0x0,
-                              0x1,   0x7,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x0,   0x0,
-                              0x1,   0x5,
-                              0x28,  0x5,
-                              0x31,  0x1,
-                              0xa3,  0x0,
-                              0x3,   0x0,
-                              0x37,  0x0,
-                              0x19,  0x3,
-                              0x3,   0x0,
-                              0x3,   0x3,
-                              0x2,   0x2,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x4,
-                              0xc8,  0x72,
-                              0xe,   0x21,
-                              0xdc,  0x9,
-                              0x20,  0x1a,
-                              0x7d,  0xa,
-                              0x10,  0xd8,
-                              0x19,  0x7,
-                              0x2d,  0x19,
-                              0x2c,  0x21,
-                              0x27,  0x64,
-                              0x12,  0x7,
-                              0x0,   0x2,
-                              0xc,   0x7,
-                              0x15,  0x13,
-                              0x45,  0x68,
-                              0x5,   0x2,
-                              0x0,   0x19,
-                              0x0,   0x6a,
-                              0x4,   0x5,
-                              0x1,   0x7,
-                              0x0,   0x4,
-                              0x0,   0x1e,
-                              0x10,  0xf,
-                              0xe,   0x0,
-                              0x1,   0x0,
-                              0x22,  0x2f,
-                              0x22,  0x70,
-                              0x82,  0x123,
-                              0x1c,  0x1e,
-                              0xf,   0x43,
-                              0x1c,  0x1f,
-                              0x16,  0x35,
-                              0x36,  0x47,
-                              0x1d,  0x1a,
-                              0x2,   0x20,
-                              0xe,   0x12,
-                              0x7,   0x5,
-                              0x2,   0x0,
-                              0x0,   0x0,
-                              0x5,   0x29,
-                              0x7,   0x0,
-                              0x13,  0x13,
-                              0x16,  0x16,
-                              0x0,   0x0,
-                              0x7,   0x25,
-                              0x3,   0x0,
-                              0x8,   0x8,
-                              0xd,   0x2,
-                              0x5d,  0x19,
-                              0x3,   0x34,
-                              0x50,  0x2c,
-                              0x10,  0x1,
-                              0x0,   0x82,
-                              0x8,   0x7,
-                              0x1,   0x0,
-                              0xd,   0x27,
-                              0x7,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x7,   0x6,
-                              0xd,   0xe,
-                              0xd,   0xd,
-                              0x3,   0x1f,
-                              0x2c,  0x0,
-                              0x1,   0x40,
-                              0x0,   0x0,
-                              0x18,  0x3,
-                              0x3,   0x4,
-                              0x1,   0x0,
-                              0x0,   0x1,
-                              0x2,   0x2,
-                              0x1,   0x1,
-                              0x3,   0x3,
-                              0x96,  0x3a,
-                              0x4,   0xcc,
-                              0x1,   0x7,
-                              0x0,   0xa,
-                              0x0,   0x7,
-                              0x6,   0x0,
-                              0x5,   0x5,
-                              0x15,  0x13,
-                              0x32,  0x2d,
-                              0x2,   0xe,
-                              0x2,   0x23,
-                              0x0,   0x0,
-                              0x0,   0x7,
-                              0x7f,  0x0,
-                              0xd,   0x7,
-                              0x0,   0x0,
-                              0x1,   0x0,
-                              0xc,   0x6,
-                              0x1,   0xd,
-                              0x5,   0x5,
-                              0x5,   0xe,
-                              0x5,   0x5,
-                              0x5,   0xe,
-                              0x0,   0x0,
-                              0xe,   0x10,
-                              0x29,  0x18,
-                              0x18,  0x19,
-                              0x23,  0x7f,
-                              0x54,  0x3,
-                              0x48,  0x6,
-                              0x51,  0xe,
-                              0x52,  0xe,
-                              0x12,  0xe,
-                              0x6c,  0x40,
-                              0x57,  0x16,
-                              0x37,  0x54,
-                              0x3,   0x17,
-                              0x0,   0x0,
-                              0x7,   0x7,
-                              0xd,   0x5d,
-                              0x6c,  0x0,
-                              0x8,   0x6,
-                              0x5,   0x10,
-                              0x1,   0x34,
-                              0xc7,  0xe,
-                              0x0,   0x0,
-                              0x0,   0x9,
-                              0x12,  0xe,
-                              0x3,   0x6,
-                              0x84,  0x5,
-                              0x6d,  0x3,
-                              0x8,   0x16,
-                              0x1,   0x14,
-                              0x1,   0x10,
-                              0x1,   0x15,
-                              0x0,   0x0,
-                              0x82,  0x8,
-                              0x1,   0x2,
-                              0x30,  0x0,
-                              0x1,   0x5e,
-                              0x5b,  0x0,
-                              0x3b,  0x3,
-                              0x1,   0x2,
-                              0x44,  0x21,
-                              0x21,  0xe,
-                              0xa,   0x9,
-                              0xb,   0x16,
-                              0x23,  0xe,
-                              0x3,   0xe,
-                              0x5,   0x21,
-                              0x1,   0x2,
-                              0x93,  0x5,
-                              0x19,  0x1,
-                              0x82,  0x2,
-                              0x2,   0x1,
-                              0xd,   0x67,
-                              0x1,   0x0,
-                              0x0,   0x5a,
-                              0x3,   0x12,
-                              0x33,  0x0,
-                              0x1,   0x1,
-                              0x1,   0x5,
-                              0x1,   0x3,
-                              0x1,   0x3,
-                              0x1,   0x3,
-                              0x1,   0x8,
-                              0x3,   0x1,
-                              0x3,   0x1,
-                              0x8,   0x6,
-                              0x6,   0x8,
-                              0x3,   0x3,
-                              0x36,  0x68,
-                              0x1,   0x73,
-                              0x41,  0x1c,
-                              0x65,  0x3,
-                              0x2,   0x2,
-                              0x0,   0x15,
-                              0x13,  0x8,
-                              0x0,   0xa,
-                              0x2,   0x0,
-                              0x0,   0x3,
-                              0x1,   0x0,
-                              0x0,   0xd,
-                              0x0,   0xb3,
-                              0x50,  0x68,
-                              0xaa,  0x0,
-                              0x1d,  0xc,
-                              0xb,   0xc,
-                              0xc,   0xd,
-                              0xd,   0x8,
-                              0xa,   0x42,
-                              0xb,   0x0,
-                              0x3b,  0x9c,
-                              0x3b,  0x0,
-                              0x32,  0x5c,
-                              0x2a,  0x56,
-                              0x1f,  0x69,
-                              0x12,  0x5,
-                              0x3,   0x7,
-                              0x3a,  0x8f,
-                              0x3b,  0x0,
-                              0x30,  0x4f,
-                              0x56,  0x1f,
-                              0x59,  0x1,
-                              0x1,   0x4,
-                              0x0,   0x0,
-                              0x26,  0x25,
-                              0x13,  0x13,
-                              0xd,   0xd,
-                              0x5e,  0x6,
-                              0x1f,  0x31,
-                              0x12,  0xd,
-                              0x1b,  0x1,
-                              0xb,   0x9,
-                              0x0,   0x0,
-                              0x2c,  0x1e,
-                              0x7,   0x0,
-                              0xb,   0x4,
-                              0x3d,  0xa,
-                              0x4,   0x4,
-                              0x0,   0x4,
-                              0x7,   0x5,
-                              0x5,   0x4,
-                              0x0,   0x6,
-                              0x6,   0x3,
-                              0x7,   0x0,
-                              0xd,   0x8,
-                              0x6,   0x11,
-                              0x47,  0x3,
-                              0x17,  0x62,
-                              0x6,   0x7,
-                              0x14,  0x11,
-                              0xc,   0x2,
-                              0x7,   0x4,
-                              0x5e,  0x12,
-                              0x1f,  0x7,
-                              0x7,   0x0,
-                              0x3,   0x4,
-                              0x3,   0x3,
-                              0x3,   0x4,
-                              0x4,   0x4,
-                              0x0,   0x0,
-                              0x3,   0x0,
-                              0x0,   0x0,
-                              0x4d,  0xc,
-                              0x0,   0xc,
-                              0x4,   0x7,
-                              0x31,  0x66,
-                              0x0,   0x2d,
-                              0x66,  0x0,
-                              0x31,  0x2,
-                              0x0,   0xb,
-                              0x5,   0x5,
-                              0x4,   0xc,
-                              0x5,   0x36,
-                              0x4,   0x7,
-                              0x11,  0x3,
-                              0x2,   0x12,
-                              0x1,   0x22,
-                              0x0,   0xc,
-                              0x38,  0x0,
-                              0x0,   0x0,
-                              0x11,  0x1f,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0x32,  0x0,
-                              0x0,   0x9,
-                              0x0,   0xe,
-                              0xd,   0x6,
-                              0x9,   0x9,
-                              0x6,   0x1,
-                              0x0,   0x0,
-                              0x21,  0x1,
-                              0x4,   0x3,
-                              0x1,   0x1,
-                              0x0,   0x0,
-                              0x1,   0x0,
-                              0xb,   0xb,
-                              0x1,   0x1,
-                              0x1,   0x3b,
-                              0xa,   0x24,
-                              0x41,  0x1,
-                              0x58,  0x0,
-                              0xa,   0x3d,
-                              0x1,   0x0,
-                              0x7,   0xa,
-                              0x4b,  0x2,
-                              0x1d,  0x1,
-                              0x1,   0x1,
-                              0x1,   0xf,
-                              0xd,   0x9,
-                              0xf,   0xe,
-                              0x5,   0x9,
-                              0x0,   0x4,
-                              0x2,   0x3,
-                              0x9,   0x1,
-                              0x5,   0x4,
-                              0x14,  0x44,
-                              0x8,   0x4c,
-                              0xd,   0x51,
-                              0x9,   0x4c,
-                              0x10,  0x9,
-                              0x3e,  0xa,
-                              0x44,  0x55,
-                              0x4,   0x54,
-                              0x6,   0x1f,
-                              0x56,  0xc,
-                              0xf,   0x1f,
-                              0x6,   0x54,
-                              0x6,   0x14,
-                              0x1f,  0x1,
-                              0x5,   0x5,
-                              0x3,   0x1,
-                              0x8,   0x1f,
-                              0x1,   0x0,
-                              0x73,  0x10,
-                              0x40,  0x1,
-                              0x19,  0xc,
-                              0x8,   0x19,
-                              0x0,   0x34,
-                              0x69,  0x6b,
-                              0x4,   0x8,
-                              0x0,   0x0,
-                              0x1,   0xc,
-                              0x1,   0x0,
-                              0x0,   0x3,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x0,
-                              0x0,   0x7,
-                              0x2,   0xc,
-                              0xb,   0x3,
-                              0x8,   0x8,
-                              0x0,   0x7,
-                              0x0,   0x14,
-                              0x13,  0x6,
-                              0x6,   0x3,
-                              0x4,   0xb,
-                              0xa,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x1,   0xa8,
-                              0x0,   0x23,
-                              0x6,   0x2,
-                              0x7,   0x0,
-                              0x4,   0x4,
-                              0x3,   0x6,
-                              0x20,  0x6,
-                              0x1a,  0x19,
-                              0x15,  0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x10,  0x11,
-                              0xc,   0xb,
-                              0x3,   0x3,
-                              0x7,   0x7,
-                              0x1,   0x7,
-                              0x9,   0xc,
-                              0x32,  0x84,
-                              0x59,  0x70,
-                              0x1,   0x0,
-                              0x0,   0x39,
-                              0x1,   0x1,
-                              0x2,   0x9,
-                              0x9,   0x9,
-                              0x9,   0x2,
-                              0x23,  0x6,
-                              0x5,   0x2,
-                              0xe,   0xe,
-                              0x5,   0x7,
-                              0x7,   0x5,
-                              0x8,   0x7,
-                              0x3,   0x6,
-                              0x6,   0x3,
-                              0xa,   0x2,
-                              0x5,   0x2,
-                              0x5,   0x2,
-                              0xe,   0x2,
-                              0x8,   0x2,
-                              0x6,   0x2,
-                              0xa,   0x2,
-                              0x5,   0x2,
-                              0x5,   0x2,
-                              0x0,   0x10,
-                              0x0,   0x1,
-                              0x0,   0x4,
-                              0x21,  0x6,
-                              0x9,   0x4,
-                              0x4,   0x0,
-                              0x1,   0x8,
-                              0x8,   0x1,
-                              0x16,  0x0,
-                              0xe,   0xa,
-                              0x7,   0xe,
-                              0x3,   0x0,
-                              0x0,   0x5,
-                              0x21,  0x4,
-                              0x54,  0x23,
-                              0x1,   0x3,
-                              0xc,   0x7,
-                              0x42,  0x2,
-                              0x0,   0x13,
-                              0xa,   0x7,
-                              0x9,   0x1,
-                              0x14,  0x14,
-                              0x0,   0x1,
-                              0x11,  0x17,
-                              0x1c,  0x1c,
-                              0x1c,  0x0,
-                              0x1,   0x34,
-                              0x1,   0x2,
-                              0x1,   0x2,
-                              0x5,   0x2,
-                              0x50,  0xf,
-                              0x1,   0xa,
-                              0x1,   0x4,
-                              0x9,   0x4,
-                              0x17,  0x2,
-                              0x3,   0xa,
-                              0xe,   0x48,
-                              0x18,  0x4,
-                              0x3,   0x18,
-                              0xe,   0x34,
-                              0x6,   0x0,
-                              0x42,  0x3c,
-                              0x10,  0x2,
-                              0x14,  0x3,
-                              0x1b,  0x9,
-                              0x35,  0x22,
-                              0x22,  0x7f,
-                              0x5,   0x1c,
-                              0x4a,  0x7a,
-                              0x5,   0x4a,
-                              0x22,  0xe,
-                              0x3,   0x2,
-                              0x1,   0x1,
-                              0x3,   0xc,
-                              0x6,   0x4,
-                              0x1,   0x3,
-                              0x3,   0x22,
-                              0x1a,  0x1,
-                              0x2,   0x9,
-                              0x8,   0x6,
-                              0x3,   0x3,
-                              0x2,   0x3,
-                              0x5,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x23,
-                              0x0,   0x12,
-                              0x3,   0x5,
-                              0x22,  0x0,
-                              0x3,   0x3,
-                              0x2,   0x2,
-                              0x76,  0x5,
-                              0x61,  0x3,
-                              0x0,   0x0,
-                              0x0,   0x6,
-                              0x1,   0x5,
-                              0x3d,  0x24,
-                              0x1f,  0x1,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x1d,  0x1d,
-                              0x1d,  0x7,
-                              0x27,  0x1b,
-                              0x1c,  0x3,
-                              0x3,   0x3,
-                              0x2,   0x3,
-                              0x3,   0x2,
-                              0x3,   0x8,
-                              0x0,   0x3a,
-                              0x26,  0x22,
-                              0x1,   0x4,
-                              0x4,   0x1,
-                              0x1,   0x3,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x3,   0x1,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x1,   0x26,
-                              0x2,   0x26,
-                              0x4,   0x7,
-                              0x42,  0x4,
-                              0x1,   0x0,
-                              0x4d,  0x1,
-                              0x0,   0x4,
-                              0x8,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x74,
-                              0x4d,  0x1,
-                              0x13,  0x1,
-                              0x2,   0x11,
-                              0x0,   0x0,
-                              0x5,   0x1e,
-                              0x0,   0x18,
-                              0x0,   0x0,
-                              0x0,   0x2,
-                              0x0,   0x0,
-                              0x1e,  0x1f,
-                              0x1,   0x48,
-                              0x23,  0x3e,
-                              0x44,  0x25,
-                              0x2,   0x0,
-                              0x1c,  0x35,
-                              0x0,   0x10,
-                              0x21,  0x1,
-                              0xd,   0xc,
-                              0xa,   0xe,
-                              0x0,   0x35,
-                              0x0,   0x0,
-                              0x1,   0x9,
-                              0x2,   0x1,
-                              0x7,   0x2,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0xa,
-                              0x0,   0x3,
-                              0x1f,  0x6c,
-                              0xa,   0xa,
-                              0x16,  0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0xe,   0x38,
-                              0x17,  0x6,
-                              0x0,   0x0,
-                              0x0,   0x6,
-                              0x6c,  0x8f,
-                              0x39,  0x20,
-                              0x1d,  0x94,
-                              0x2,   0x20,
-                              0x4,   0x7,
-                              0x4,   0x0,
-                              0x0,   0x0,
-                              0x4,   0x0,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x51,  0xb4,
-                              0x5,   0x26,
-                              0x65,  0x1,
-                              0xa,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x34,  0x23,
-                              0x7,   0x31,
-                              0x5,   0x0,
-                              0x4,   0x2,
-                              0x2,   0x7,
-                              0x6,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x7,
-                              0x0,   0xe,
-                              0x1,   0x3,
-                              0xd,   0xc,
-                              0x0,   0x21,
-                              0x1,   0x10,
-                              0x14,  0x3f,
-                              0x0,   0x0,
-                              0x18,  0x5,
-                              0x1,   0xb,
-                              0x2,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x3,   0x3,
-                              0x1,   0x2,
-                              0x3,   0x4,
-                              0x4,   0x5,
-                              0x5,   0x5,
-                              0x5,   0x0,
-                              0x0,   0x10,
-                              0x10,  0x2,
-                              0x0,   0x0,
-                              0x2,   0x2,
-                              0x1,   0x0,
-                              0x2,   0x3,
-                              0x1,   0x6,
-                              0x9,   0x1,
-                              0x0,   0xe,
-                              0x16,  0x17,
-                              0x4,   0x4,
-                              0x6,   0x1,
-                              0x1a,  0x1,
-                              0x41,  0x31,
-                              0x1,   0x50,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x1,   0x0,
-                              0x6,   0x1,
-                              0x1,   0x1,
-                              0xc,   0x0,
-                              0x3,   0x3,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0xd8,  0x2,
-                              0x2,   0x7,
-                              0x5,   0x2d,
-                              0x18,  0x5,
-                              0x3,   0xa,
-                              0x1,   0x0,
-                              0x1,   0x0,
-                              0x0,   0x2,
-                              0x2,   0x3,
-                              0x3,   0x20,
-                              0x5b,  0x0,
-                              0xf,   0x1,
-                              0x7,   0x6,
-                              0x7,   0x2,
-                              0x0,   0x88,
-                              0x3e,  0x1f,
-                              0x3,   0x1,
-                              0x5,   0x4,
-                              0x7,   0x6,
-                              0x7,   0x6,
-                              0x7,   0x7,
-                              0x5,   0x1,
-                              0x2,   0x3,
-                              0x4,   0x3,
-                              0xb,   0x7,
-                              0x68,  0x4,
-                              0x0,   0x20,
-                              0x2,   0x5,
-                              0x0,   0x5,
-                              0x6,   0xa5,
-                              0x2,   0x2,
-                              0x4,   0x7,
-                              0x5,   0x7,
-                              0xe,   0x4,
-                              0xe,   0xc,
-                              0x0,   0x3,
-                              0x1f,  0x1,
-                              0x44,  0x23,
-                              0x1c,  0x0,
-                              0x1,   0xe,
-                              0x2,   0x0,
-                              0x5,   0x47,
-                              0x0,   0x0,
-                              0x20,  0x0,
-                              0x0,   0x0,
-                              0x29,  0x5,
-                              0x3,   0xb,
-                              0x4,   0x1,
-                              0x1,   0x1f,
-                              0x1,   0x1b,
-                              0x2,   0x0,
-                              0xc,   0x6,
-                              0x0,   0x19,
-                              0x0,   0x1,
-                              0x3,   0x6,
-                              0x4,   0x6,
-                              0x81,  0x35,
-                              0x0,   0x3,
-                              0x4,   0x0,
-                              0x1,   0x2,
-                              0x2,   0xb,
-                              0x2,   0xb,
-                              0x0,   0x31,
-                              0x3,   0x5,
-                              0x4a,  0x2,
-                              0xa6,  0x4,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x9,   0x5,
-                              0x5,   0x4,
-                              0xe,   0xd,
-                              0x8d,  0x5,
-                              0x1e,  0x3,
-                              0x6,   0xb,
-                              0x4,   0x4,
-                              0x4,   0x4,
-                              0x3,   0x2,
-                              0x2,   0x2,
-                              0x7,   0x2,
-                              0x2,   0x6f,
-                              0x1,   0x1,
-                              0x5,   0x5,
-                              0x1,   0x2,
-                              0x1,   0x1,
-                              0x16,  0x1,
-                              0x14,  0x1,
-                              0x10,  0x1,
-                              0xf,   0xb,
-                              0x10,  0xc,
-                              0x11,  0x18,
-                              0x14,  0x13,
-                              0x1,   0x2,
-                              0x6,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x47,
-                              0x2,   0x14,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x4,   0x5,
-                              0x4f,  0x0,
-                              0x1d,  0x1,
-                              0x0,   0x1,
-                              0x0,   0x1,
-                              0x0,   0x0,
-                              0x1,   0x3,
-                              0xd,   0xd,
-                              0x84,  0x5,
-                              0x0,   0x8,
-                              0x7,   0x12,
-                              0x12,  0x1,
-                              0x1,   0x1,
-                              0x1,   0x83,
-                              0x5,   0x0,
-                              0x1b,  0x1,
-                              0x5,   0x43,
-                              0x5a,  0x1,
-                              0xa,   0x5a,
-                              0x1,   0x23,
-                              0x14,  0x10,
-                              0x15,  0x1,
-                              0x13,  0xf,
-                              0x2,   0x2,
-                              0x18,  0x21,
-                              0x1,   0x2,
-                              0x2,   0x13,
-                              0xd,   0xd,
-                              0xb,   0x1f,
-                              0x3,   0x2,
-                              0x68,  0x4,
-                              0x4,   0x6,
-                              0x6,   0x44,
-                              0x1,   0x18,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x4,   0x4,
-                              0x4,   0x8,
-                              0x22,  0x6,
-                              0x0,   0x8,
-                              0x1,   0x3,
-                              0x0,   0x0,
-                              0x32,  0x1,
-                              0x9,   0xa,
-                              0x13,  0x8,
-                              0x2,   0xd9,
-                              0x1a,  0x6,
-                              0x0,   0xad,
-                              0x18,  0x5,
-                              0x3a,  0x9,
-                              0xa,   0x6,
-                              0x2,   0x0,
-                              0x0,   0x9c,
-                              0x16,  0x5,
-                              0xb1,  0x18,
-                              0x6,   0x0,
-                              0x0,   0x0,
-                              0x6,   0x8d,
-                              0x10,  0x88,
-                              0x32,  0x1,
-                              0x6,   0x1b,
-                              0xe,   0x0,
-                              0x5,   0x1,
-                              0x0,   0x0,
-                              0x6,   0x2,
-                              0x1,   0x1,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0xa,   0x0,
-                              0x0,   0x0,
-                              0x0,   0xf,
-                              0x3,   0x5,
-                              0x39,  0x1d,
-                              0xb,   0x4,
-                              0x5,   0x5,
-                              0x5,   0x0,
-                              0x0,   0x59,
-                              0x17,  0x0,
-                              0x2b,  0x0,
-                              0x3,   0x5,
-                              0x2,   0x3,
-                              0x0,   0x0,
-                              0x2,   0x6,
-                              0x3,   0x6,
-                              0x6,   0x5,
-                              0x6,   0x6,
-                              0x4,   0x3,
-                              0x6,   0x33,
-                              0xa,   0x9,
-                              0xa,   0x0,
-                              0x13,  0x1a,
-                              0x1,   0x19,
-                              0x7c,  0x1,
-                              0x1,   0x1,
-                              0x2,   0x0,
-                              0x20,  0x1,
-                              0x3b,  0x3,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x74,  0x3,
-                              0x3,   0x1,
-                              0x9,   0x61,
-                              0x1,   0x0,
-                              0x5,   0x5,
-                              0x5,   0x5,
-                              0x0,   0x9,
-                              0x5,   0xa,
-                              0x4,   0x6,
-                              0x0,   0x2a,
-                              0x2,   0x2,
-                              0x0,   0x1,
-                              0xc,   0x0,
-                              0x8,   0x6,
-                              0x0,   0x1,
-                              0xc,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x3,
-                              0x3,   0x3,
-                              0x7,   0x10,
-                              0x1,   0x1b,
-                              0x0,   0x1c,
-                              0x7,   0x5f,
-                              0x3,   0x0,
-                              0x17,  0x3,
-                              0x3,   0x1d,
-                              0x8,   0x8,
-                              0x5,   0xb,
-                              0xb,   0xc,
-                              0x1a,  0x8,
-                              0x74,  0x1b,
-                              0x37,  0x1,
-                              0xb,   0x2,
-                              0x4,   0x3,
-                              0x1,   0x2,
-                              0x3,   0x9,
-                              0x11,  0x0,
-                              0x25,  0x0,
-                              0x1,   0x1,
-                              0x0,   0x9,
-                              0x3,   0x4c,
-                              0x3,   0xb,
-                              0x0,   0x6c,
-                              0x7,   0x25,
-                              0x2a,  0x40,
-                              0x29,  0x0,
-                              0x0,   0x0,
-                              0x4,   0x4,
-                              0x2c,  0x7,
-                              0x42,  0x2,
-                              0x0,   0x38,
-                              0x0,   0x3,
-                              0xb,   0xe,
-                              0xb,   0x3,
-                              0x3,   0x2,
-                              0x3,   0x1e,
-                              0x3,   0x7,
-                              0x91,  0x0,
-                              0x1d,  0x23,
-                              0x3,   0x7,
-                              0x0,   0x2,
-                              0x35,  0x2e,
-                              0x20,  0x4,
-                              0x4,   0x3,
-                              0x5,   0x0,
-                              0x4b,  0x2,
-                              0x1,   0x1c,
-                              0x8,   0x5,
-                              0x1,   0x0,
-                              0xa,   0x0,
-                              0x6,   0x7,
-                              0xd,   0x7,
-                              0x22,  0x1f,
-                              0x1,   0x3,
-                              0x8,   0x21,
-                              0x9,   0x7f,
-                              0x0,   0x0,
-                              0x13,  0x0,
-                              0x6,   0x3c,
-                              0x42,  0x5b,
-                              0x47,  0x9,
-                              0x0,   0x1d,
-                              0x4,   0x4f,
-                              0x3,   0x1,
-                              0x3,   0x0,
-                              0x0,   0x0,
-                              0x5,   0x2,
-                              0xe,   0x3c,
-                              0x0,   0x53,
-                              0x3,   0x1f,
-                              0x7,   0x0,
-                              0x4,   0x5,
-                              0x5,   0xf,
-                              0x1,   0x4,
-                              0x2c,  0x2,
-                              0x1f,  0x4,
-                              0x29,  0x0,
-                              0x2c,  0xd,
-                              0x0,   0x2d,
-                              0xa,   0x20,
-                              0xd,   0x23,
-                              0x0,   0x0,
-                              0x5,   0x0,
-                              0x0,   0x5,
-                              0x3,   0x1,
-                              0x0,   0x3,
-                              0x11,  0x6,
-                              0x35,  0x1,
-                              0x0,   0x0,
-                              0x0,   0x4a,
-                              0x4,   0x6,
-                              0x0,   0x1,
-                              0x6,   0x6,
-                              0x0,   0x0,
-                              0x6,   0x22,
-                              0x1,   0x1,
-                              0x10,  0x4,
-                              0xd,   0x0,
-                              0x1,   0x0,
-                              0x1,   0x0,
-                              0x0,   0x3,
-                              0x2,   0x2,
-                              0x5,   0x1,
-                              0x5,   0x6,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0x1,   0x4,
-                              0x2,   0x1,
-                              0x8,   0x5,
-                              0x3,   0x0,
-                              0x2,   0x0,
-                              0x0,   0x4,
-                              0x3,   0x6,
-                              0x0,   0x4,
-                              0x4,   0x0,
-                              0x0,   0x1,
-                              0x1,   0x2,
-                              0x3,   0x7,
-                              0x5,   0xc,
-                              0x0,   0x0,
-                              0x33,  0x9,
-                              0x3,   0x23,
-                              0x4d,  0xa,
-                              0x6,   0x6,
-                              0x7,   0x7,
-                              0x6,   0x7,
-                              0x44,  0xf,
-                              0x7,   0x24,
-                              0x22,  0x0,
-                              0x0,   0x12,
-                              0x1,   0x2,
-                              0x1,   0x0,
-                              0xd,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x2,
-                              0x2,   0x8,
-                              0x10,  0x3,
-                              0x3,   0x5,
-                              0x3,   0x3,
-                              0x6,   0x6,
-                              0x6,   0x6,
-                              0x0,   0x1,
-                              0x3,   0x3,
-                              0x6,   0x6,
-                              0x6,   0x6,
-                              0x4,   0x4,
-                              0x7,   0x12,
-                              0x7,   0x1b,
-                              0x1e,  0x1b,
-                              0x1f,  0x1d,
-                              0x4,   0x4,
-                              0x4,   0x4,
-                              0x4,   0x7,
-                              0x7,   0x2,
-                              0x4,   0x26,
-                              0x2c,  0x2b,
-                              0x2,   0x24,
-                              0x1,   0x9,
-                              0x9,   0x1f,
-                              0x3,   0x5,
-                              0x43,  0xe,
-                              0x6,   0x3,
-                              0x8f,  0x38,
-                              0x1,   0x4,
-                              0x12,  0x0,
-                              0x0,   0x0,
-                              0x1,   0x1,
-                              0x1,   0x0,
-                              0x1,   0xc,
-                              0x0,   0x16,
-                              0x4,   0x0,
-                              0x7f,  0x5,
-                              0x0,   0x66,
-                              0x1f,  0x3,
-                              0x0,   0x6,
-                              0x1a,  0x5,
-                              0x5,   0x5,
-                              0x2,   0x2,
-                              0x4,   0xa3,
-                              0x3,   0x8,
-                              0x5,   0x1,
-                              0x5,   0x3,
-                              0x1,   0x1a,
-                              0x3,   0x0,
-                              0x5,   0x0,
-                              0x0,   0x3,
-                              0x1,   0x4,
-                              0x3,   0x0,
-                              0x5,   0x6,
-                              0xb,   0x4,
-                              0x4,   0x4,
-                              0x3,   0x3,
-                              0x1c,  0x1f,
-                              0x9,   0x0,
-                              0x0,   0x0,
-                              0x6,   0x8,
-                              0x7,   0xa,
-                              0x43,  0x17,
-                              0x14,  0x0,
-                              0x0,   0x5,
-                              0x3,   0x0,
-                              0x8,   0x8,
-                              0x22,  0x0,
-                              0x0,   0x1,
-                              0x79,  0x6a,
-                              0x3,   0x21,
-                              0x0,   0x39,
-                              0x4,   0x12,
-                              0x4,   0x7c,
-                              0x5,   0x0,
-                              0x5,   0xb,
-                              0x3,   0x0,
-                              0x0,   0x3,
-                              0x3,   0x6,
-                              0x3c,  0x42,
-                              0x4,   0x48,
-                              0x30,  0x7f,
-                              0x17,  0x1,
-                              0x4f,  0x2,
-                              0x1,   0x7,
-                              0x43,  0x0,
-                              0x22,  0x0,
-                              0x44,  0x3e,
-                              0x3,   0x2,
-                              0x3,   0x40,
-                              0x39,  0x88,
-                              0x42,  0x0,
-                              0x4,   0x1,
-                              0x1d,  0x7,
-                              0x3,   0x1c,
-                              0x4,   0x3,
-                              0x1b,  0x3,
-                              0x7,   0x62,
-                              0x1f,  0x3,
-                              0x0,   0x4f,
-                              0x22,  0xd,
-                              0x35,  0x1f,
-                              0x1,   0x0,
-                              0x5,   0xd,
-                              0xa,   0x2,
-                              0x0,   0x1,
-                              0x12,  0x4,
-                              0x23,  0xb,
-                              0x4,   0x3,
-                              0x3,   0x23,
-                              0x4,   0x0,
-                              0x0,   0x0,
-                              0x6f,  0x2,
-                              0x7,   0x6,
-                              0x1,   0x4,
-                              0x4,   0x0,
-                              0x3,   0x2,
-                              0x4,   0x0,
-                              0x0,   0x0,
-                              0x6,   0x2,
-                              0x28,  0x2,
-                              0x1,   0x2,
-                              0x4c,  0x5,
-                              0x0,   0x0,
-                              0x2,   0x3,
-                              0x1a,  0x0,
-                              0x3,   0x26,
-                              0x7,   0xf,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x7,   0x0,
-                              0x4,   0x7f,
-                              0x5,   0x0,
-                              0xd,   0xd,
-                              0x1,   0x1,
-                              0x4,   0x1,
-                              0x1d,  0x8,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x6,   0x5,
-                              0x1,   0x5,
-                              0x5,   0x6,
-                              0x1a,  0x0,
-                              0x0,   0x1,
-                              0x3a,  0x0,
-                              0x0,   0x8,
-                              0x23,  0x1,
-                              0x8,   0x7,
-                              0x8,   0x1,
-                              0x29,  0x0,
-                              0x9,   0x8,
-                              0x8,   0x8,
-                              0x65,  0x3d,
-                              0x2,   0x0,
-                              0x7,   0x1,
-                              0x29,  0x1,
-                              0x0,   0x1,
-                              0x11,  0x5,
-                              0x4,   0xb,
-                              0x4,   0x1,
-                              0x0,   0xa,
-                              0x9,   0x4,
-                              0x4,   0x0,
-                              0x6,   0x9,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x4,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x2,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x33,
-                              0x1,   0x1,
-                              0x27,  0x1,
-                              0x11,  0x0,
-                              0x4b,  0x1,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x4,
-                              0xc,   0x5,
-                              0xc,   0x0,
-                              0x22,  0x1,
-                              0x17,  0x4,
-                              0x5,   0xa,
-                              0x2,   0x2,
-                              0x2,   0x26,
-                              0x33,  0x1,
-                              0x1,   0x1,
-                              0x11,  0x4,
-                              0x4,   0xa,
-                              0x2,   0x6,
-                              0x5,   0x7,
-                              0x3,   0x3b,
-                              0x4,   0x3,
-                              0x1f,  0x4,
-                              0x8,   0x6,
-                              0x5,   0x5,
-                              0x5,   0x0,
-                              0x0,   0x40,
-                              0x3,   0xc,
-                              0x91,  0x1,
-                              0x0,   0x13,
-                              0xb,   0x1e,
-                              0x4,   0x19,
-                              0x3e,  0x2,
-                              0x1,   0x0,
-                              0x0,   0x6,
-                              0x1,   0x0,
-                              0x3,   0x16,
-                              0x4,   0x2,
-                              0xb,   0x1e,
-                              0x1,   0x6,
-                              0x6,   0x3f,
-                              0x6,   0x7,
-                              0xf,   0x3,
-                              0x18,  0x14,
-                              0x0,   0x0,
-                              0x4,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x2,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x9,
-                              0x1,   0x2f,
-                              0x0,   0x0,
-                              0x2f,  0x0,
-                              0x0,   0x1,
-                              0x23,  0x4,
-                              0x0,   0x0,
-                              0x6,   0x77,
-                              0x1,   0xd,
-                              0xd,   0x0,
-                              0x1b,  0xf,
-                              0x1b,  0x44,
-                              0x1,   0x0,
-                              0x6,   0x4,
-                              0x5,   0x43,
-                              0x1f,  0x6,
-                              0x8,   0x8,
-                              0x0,   0x0,
-                              0x3,   0x5,
-                              0x13,  0x3f,
-                              0x1f,  0x1,
-                              0x5,   0x2,
-                              0x1e,  0x61,
-                              0x56,  0x2,
-                              0x16,  0x1,
-                              0xd,   0x0,
-                              0xb,   0xb,
-                              0xb,   0x3,
-                              0x4,   0x3,
-                              0x0,   0x7,
-                              0xe,   0x7,
-                              0x10,  0x0,
-                              0x0,   0x2,
-                              0x10,  0xe,
-                              0x4,   0x1,
-                              0x6,   0xf,
-                              0x5,   0x5,
-                              0x2,   0x0,
-                              0x6,   0x3,
-                              0x9,   0x1b,
-                              0x14,  0x0,
-                              0x3c,  0x0,
-                              0x0,   0x0,
-                              0x0,   0x1b,
-                              0x8,   0x5,
-                              0x34,  0x3,
-                              0x3c,  0x13,
-                              0x42,  0x1,
-                              0xa,   0x0,
-                              0x3,   0x11,
-                              0x18,  0x1c,
-                              0x1,   0x1,
-                              0x2,   0x3,
-                              0x7,   0x6,
-                              0x7,   0x7,
-                              0x7,   0x7,
-                              0x6,   0x9,
-                              0x1,   0x9,
-                              0xb,   0x1,
-                              0x2,   0x1,
-                              0xe,   0x0,
-                              0x4,   0x3,
-                              0x1,   0x2,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x9,   0x31,
-                              0x1,   0x0,
-                              0x4,   0x4,
-                              0x4,   0x4,
-                              0x10,  0xf,
-                              0x7,   0x7,
-                              0x2,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x3,
-                              0x4,   0x2,
-                              0x0,   0x0,
-                              0xd,   0xa,
-                              0x6,   0x1,
-                              0x8,   0x0,
-                              0x18,  0x0,
-                              0x18,  0x2b,
-                              0x4,   0x2,
-                              0x2,   0x3,
-                              0x1,   0x4,
-                              0x5,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x37,
-                              0x1,   0x0,
-                              0x3,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x0,
-                              0x8,   0x6,
-                              0x2,   0x3,
-                              0x3,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x11,
-                              0x0,   0x2,
-                              0x2,   0xf,
-                              0x8,   0x1,
-                              0x8,   0x9,
-                              0x10,  0x2,
-                              0x2,   0x2,
-                              0x2,   0x9,
-                              0x7,   0x3,
-                              0x0,   0x75,
-                              0xd,   0x0,
-                              0x0,   0x0,
-                              0x0,   0x7,
-                              0x8,   0x4,
-                              0xa,   0x6,
-                              0x4,   0x1,
-                              0x2,   0x8,
-                              0x2,   0x0,
-                              0x15,  0x15,
-                              0x15,  0x0,
-                              0x0,   0x26,
-                              0x1,   0xb,
-                              0x15,  0x5,
-                              0x2,   0x2,
-                              0x2,   0x1,
-                              0x15,  0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x19,
-                              0x0,   0x1,
-                              0x21,  0x1,
-                              0x2,   0x1,
-                              0x1,   0x3,
-                              0x1,   0x0,
-                              0x0,   0x4,
-                              0x4,   0x0,
-                              0x14,  0x1,
-                              0x1,   0x1,
-                              0x1,   0x2,
-                              0x2,   0x2,
-                              0x1,   0x1,
-                              0x5,   0x3,
-                              0x1,   0x12,
-                              0x3,   0x3,
-                              0xd,   0x0,
-                              0x11,  0x2,
-                              0x3,   0x3,
-                              0x5,   0x5,
-                              0x5,   0x7,
-                              0x2,   0x2,
-                              0x3,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x2,   0x2,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x4,   0x4,
-                              0x4,   0x2,
-                              0x4,   0x4,
-                              0x2,   0x1,
-                              0x4,   0x1,
-                              0x1,   0x67,
-                              0x1,   0x3,
-                              0x2,   0x1,
-                              0x1,   0x1,
-                              0x19,  0x19,
-                              0x1,   0x19,
-                              0x1,   0x7,
-                              0x1,   0x0,
-                              0x2,   0x10,
-                              0x7,   0x7,
-                              0x3,   0x3,
-                              0x1d,  0x1,
-                              0x1,   0x27,
-                              0x2,   0x3,
-                              0x5,   0x2,
-                              0x2,   0xa,
-                              0x0,   0x0,
-                              0xab,  0x85,
-                              0x1,   0x1,
-                              0x8,   0x1d,
-                              0x35,  0x1,
-                              0x1a,  0x1,
-                              0x35,  0x1,
-                              0x1,   0x1,
-                              0x1,   0x6f,
-                              0x92,  0x2,
-                              0x2,   0x2,
-                              0x2,   0x1,
-                              0x2,   0x1,
-                              0x1,   0x3,
-                              0xb,   0x0,
-                              0x0,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x3,
-                              0x3,   0x4,
-                              0xc,   0x0,
-                              0x0,   0x1a,
-                              0x0,   0xf,
-                              0x19,  0xf,
-                              0x0,   0x13,
-                              0x13,  0x27,
-                              0x0,   0x14,
-                              0x13,  0x15,
-                              0x0,   0x45,
-                              0x11,  0x1d,
-                              0x1b,  0xb,
-                              0xb,   0x3,
-                              0x2,   0x1,
-                              0x3c,  0x3,
-                              0x10a, 0x42,
-                              0x1,   0x12,
-                              0x20,  0x1de,
-                              0x1,   0x0,
-                              0x3,   0x0,
-                              0x12,  0x18,
-                              0x18,  0x1c,
-                              0x1a,  0x0,
-                              0x20,  0x1e,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x1,   0x1,
-                              0x2,   0x4,
-                              0x61,  0x7,
-                              0x0,   0x10,
-                              0x35,  0x0,
-                              0x0,   0x0,
-                              0x10,  0x1f,
-                              0x0,   0x17,
-                              0x25,  0x26,
-                              0x1c,  0x7e,
-                              0x5,   0x2b,
-                              0x10,  0x56,
-                              0x47,  0x6,
-                              0x6,   0x1,
-                              0x1b,  0x0,
-                              0x0,   0x0,
-                              0x2b,  0x85,
-                              0x3c,  0xb,
-                              0x4,   0x4,
-                              0x6,   EXTRA_PC_PORT_TEXTURE_COUNT};
+constexpr u32 tpage_dir[] = {0x0,   0x7,
+                             0x3,   0x5,
+                             0xba,  0x29,
+                             0x1b,  0x84,
+                             0x5,   0x5e,
+                             0x6,   0x19,
+                             0x6,   0x36,
+                             0x0,   0x26,
+                             0x0,   0x8c,
+                             0x1e,  0x0,
+                             0x17,  0x0,
+                             0x1,   0x4,
+                             0xe,   0x6,
+                             0x7,   0x7,
+                             0x6,   0x5,
+                             0x1e,  0x13,
+                             0x7,   0x7,
+                             0x2,   0x4,
+                             0x3,   0x3,
+                             0x0,   0x3,
+                             0xd,   0x10,
+                             0xa,   0x5,
+                             0x5,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x5,
+                             0x5,   0x2,
+                             0x7,   0x7,
+                             0x5,   0x9,
+                             0x9,   0x6,
+                             0x1e,  0x12,
+                             0x2,   0x2,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x8,   0x8,
+                             0x5,   0xb,
+                             0xc,   0x9,
+                             0x16,  0x1,
+                             0x14,  0x1,
+                             0x10,  0x1,
+                             0x1,   0x1,
+                             0x1,   0x3,
+                             0x1f,  0x13,
+                             0x13,  0x12,
+                             0x17,  0x1e,
+                             0x1a,  0x17,
+                             0x11,  0xf,
+                             0x14,  0xe,
+                             0x10,  0x16,
+                             0x1c,  0x16,
+                             0x19,  0x13,
+                             0x13,  0x2,
+                             0x7,   0x8,
+                             0x2,   0x3,
+                             0x14,  0x14,
+                             0xb,   0xb,
+                             0x10,  0x10,
+                             0x2,   0x2,
+                             0x9,   0x2,
+                             0x0,   0x23,
+                             0x0,   0x20,
+                             0xaf,  0x1b,
+                             0x0,   0x90,
+                             0x6,   0x6,
+                             0x4,   0x1,
+                             0x23,  0x51,
+                             0x44,  0x23,
+                             0x42,  0x0,
+                             0x0,   0x7f,
+                             0x1,   0x58,
+                             0x6,   0x6,
+                             0x4,   0x1,
+                             0x6,   0x6,
+                             0x5,   0x2f,
+                             0xd,   0x1,
+                             0x26,  0x14,
+                             0x1,   0x10,
+                             0x1,   0x4,
+                             0x1,   0x1,
+                             0x0,   0x25,
+                             0xd,   0x80,
+                             0x0,   0x20,
+                             0x7d,  0x1,
+                             0x0,   0x23,
+                             0xe,   0x7a,
+                             0x0,   0x23,
+                             0x79,  0x1,
+                             0xc,   0x3,
+                             0x4d,  0xc,
+                             0x4c,  0x1,
+                             0xa,   0x11,
+                             0x4,   0x52,
+                             0xa,   0x11,
+                             0x52,  0x3,
+                             0x2,   0x8,
+                             0xb,   0x16,
+                             0x2e,  0x3,
+                             0x8,   0xb,
+                             0x2e,  0x1,
+                             0x2,   0x3,
+                             0x1,   0x8,
+                             0xc,   0x16,
+                             0x35,  0x3,
+                             0x8,   0xc,
+                             0x35,  0x2,
+                             0x2,   0x1,
+                             0xd,   0x19,
+                             0x45,  0xd,
+                             0x46,  0x1,
+                             0x4f,  0x14,
+                             0x5,   0x67,
+                             0x37,  0x14,
+                             0x58,  0x3,
+                             0x3,   0x2,
+                             0xc,   0x8,
+                             0x44,  0xc,
+                             0x44,  0x6,
+                             0x1d,  0x5,
+                             0x1,   0x16,
+                             0xb,   0x6,
+                             0x2e,  0x5,
+                             0x16,  0xb,
+                             0x2e,  0x1,
+                             0x1,   0x5,
+                             0x1,   0x19,
+                             0xb,   0x6,
+                             0x2a,  0x5,
+                             0x19,  0xb,
+                             0x2a,  0x1,
+                             0x1,   0x5,
+                             0x5,   0x5,
+                             0x4,   0x6,
+                             0x1d,  0x1f,
+                             0x10,  0x6,
+                             0x6,   0x65,
+                             0x14,  0x1e,
+                             0x63,  0x2,
+                             0x3,   0x4,
+                             0x5,   0x5,
+                             0x4,   0x4,
+                             0x2,   0x6,
+                             0x5,   0x48,
+                             0x6,   0x5,
+                             0x48,  0x0,
+                             0x4,   0x0,
+                             0x0,   0x2,
+                             0x2,   0x1,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x4,   0x4,
+                             0x4,   0x2,
+                             0x4,   0x4,
+                             0xd1,  0x17,
+                             0x3,   0x3,
+                             0x3,   0x9,
+                             0x1,   0x1,
+                             0x0,   0x37,
+                             0xc4,  0x1,
+                             0x31,  0x73,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x78,
+                             0xe,   0x2d,
+                             0x2,   0x0,
+                             0x0,   0x0,
+                             0x11,  0x11,
+                             0x1c,  0x0,
+                             0x1,   0x15,
+                             0x7,   0x1,
+                             0x2,   0x0,
+                             0x9,   0x2,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x2a,
+                             0x4,   0x27,
+                             0x58,  0x4,
+                             0x2d,  0x47,
+                             0x2,   0x27,
+                             0x1,   0x6,
+                             0x1,   0x26,
+                             0x0,   0x0,
+                             0x0,   0x2,
+                             0x20,  0x2,
+                             0x1,   0x2,
+                             0x1,   0x0,
+                             0x7,   0x0,
+                             0x0,   0x0,
+                             0xd,   0x3b,
+                             0x7,   0x1,
+                             0x0,   0x0,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0x2,   0x0,
+                             0x35,  0x0,
+                             0x95,  0x7,
+                             0x7,   0x6,
+                             0x1,   0xd7,
+                             0x0,   0x0,
+                             0xe,   0x0,
+                             0x6,   0x0,
+                             0x6,   0xf,
+                             0xa,   0x85,
+                             0x1c,  0x0,
+                             0x79,  0x1a,
+                             0x34,  0x3,
+                             0x5d,  0x5f,
+                             0x5,   0x3,
+                             0x1f,  0x16,
+                             0x4,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x25,  0x1,
+                             0x0,   0x4,
+                             0x24,  0x4,
+                             0x1,   0x0,
+                             0x9,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x7,
+                             0x5,   0x1,
+                             0x5,   0x1,
+                             0xb,   0xb,
+                             0x0,   0x0,
+                             0x14,  0x2,
+                             0x2,   0x12,
+                             0x6,   0x0,
+                             0x1,   0x0,
+                             0x1,   0x1,
+                             0x2c,  0x82,
+                             0x3,   0x2,
+                             0x2,   0x0,
+                             0x0,   0x4,
+                             0x0,   0x6,
+                             0x6,   0x56,
+                             0x0,   0x0,
+                             0x0,   0x2,
+                             0x24,  0x5d,
+                             0x4,   0x46,
+                             0x7,   0xe,
+                             0x55,  0x15,
+                             0x5e,  0x57,
+                             0x16,  0x3b,
+                             0x5a,  0x2,
+                             0x12,  0x3,
+                             0x2,   0x3,
+                             0x3,   0x1,
+                             0x18,  0x2,
+                             0x0,   0x2,
+                             0x2,   0x0,
+                             0x1,   0x7,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x0,   0x0,
+                             0x1,   0x5,
+                             0x28,  0x5,
+                             0x31,  0x1,
+                             0xa3,  0x0,
+                             0x3,   0x0,
+                             0x37,  0x0,
+                             0x19,  0x3,
+                             0x3,   0x0,
+                             0x3,   0x3,
+                             0x2,   0x2,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x4,
+                             0xc8,  0x72,
+                             0xe,   0x21,
+                             0xdc,  0x9,
+                             0x20,  0x1a,
+                             0x7d,  0xa,
+                             0x10,  0xd8,
+                             0x19,  0x7,
+                             0x2d,  0x19,
+                             0x2c,  0x21,
+                             0x27,  0x64,
+                             0x12,  0x7,
+                             0x0,   0x2,
+                             0xc,   0x7,
+                             0x15,  0x13,
+                             0x45,  0x68,
+                             0x5,   0x2,
+                             0x0,   0x19,
+                             0x0,   0x6a,
+                             0x4,   0x5,
+                             0x1,   0x7,
+                             0x0,   0x4,
+                             0x0,   0x1e,
+                             0x10,  0xf,
+                             0xe,   0x0,
+                             0x1,   0x0,
+                             0x22,  0x2f,
+                             0x22,  0x70,
+                             0x82,  0x123,
+                             0x1c,  0x1e,
+                             0xf,   0x43,
+                             0x1c,  0x1f,
+                             0x16,  0x35,
+                             0x36,  0x47,
+                             0x1d,  0x1a,
+                             0x2,   0x20,
+                             0xe,   0x12,
+                             0x7,   0x5,
+                             0x2,   0x0,
+                             0x0,   0x0,
+                             0x5,   0x29,
+                             0x7,   0x0,
+                             0x13,  0x13,
+                             0x16,  0x16,
+                             0x0,   0x0,
+                             0x7,   0x25,
+                             0x3,   0x0,
+                             0x8,   0x8,
+                             0xd,   0x2,
+                             0x5d,  0x19,
+                             0x3,   0x34,
+                             0x50,  0x2c,
+                             0x10,  0x1,
+                             0x0,   0x82,
+                             0x8,   0x7,
+                             0x1,   0x0,
+                             0xd,   0x27,
+                             0x7,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x7,   0x6,
+                             0xd,   0xe,
+                             0xd,   0xd,
+                             0x3,   0x1f,
+                             0x2c,  0x0,
+                             0x1,   0x40,
+                             0x0,   0x0,
+                             0x18,  0x3,
+                             0x3,   0x4,
+                             0x1,   0x0,
+                             0x0,   0x1,
+                             0x2,   0x2,
+                             0x1,   0x1,
+                             0x3,   0x3,
+                             0x96,  0x3a,
+                             0x4,   0xcc,
+                             0x1,   0x7,
+                             0x0,   0xa,
+                             0x0,   0x7,
+                             0x6,   0x0,
+                             0x5,   0x5,
+                             0x15,  0x13,
+                             0x32,  0x2d,
+                             0x2,   0xe,
+                             0x2,   0x23,
+                             0x0,   0x0,
+                             0x0,   0x7,
+                             0x7f,  0x0,
+                             0xd,   0x7,
+                             0x0,   0x0,
+                             0x1,   0x0,
+                             0xc,   0x6,
+                             0x1,   0xd,
+                             0x5,   0x5,
+                             0x5,   0xe,
+                             0x5,   0x5,
+                             0x5,   0xe,
+                             0x0,   0x0,
+                             0xe,   0x10,
+                             0x29,  0x18,
+                             0x18,  0x19,
+                             0x23,  0x7f,
+                             0x54,  0x3,
+                             0x48,  0x6,
+                             0x51,  0xe,
+                             0x52,  0xe,
+                             0x12,  0xe,
+                             0x6c,  0x40,
+                             0x57,  0x16,
+                             0x37,  0x54,
+                             0x3,   0x17,
+                             0x0,   0x0,
+                             0x7,   0x7,
+                             0xd,   0x5d,
+                             0x6c,  0x0,
+                             0x8,   0x6,
+                             0x5,   0x10,
+                             0x1,   0x34,
+                             0xc7,  0xe,
+                             0x0,   0x0,
+                             0x0,   0x9,
+                             0x12,  0xe,
+                             0x3,   0x6,
+                             0x84,  0x5,
+                             0x6d,  0x3,
+                             0x8,   0x16,
+                             0x1,   0x14,
+                             0x1,   0x10,
+                             0x1,   0x15,
+                             0x0,   0x0,
+                             0x82,  0x8,
+                             0x1,   0x2,
+                             0x30,  0x0,
+                             0x1,   0x5e,
+                             0x5b,  0x0,
+                             0x3b,  0x3,
+                             0x1,   0x2,
+                             0x44,  0x21,
+                             0x21,  0xe,
+                             0xa,   0x9,
+                             0xb,   0x16,
+                             0x23,  0xe,
+                             0x3,   0xe,
+                             0x5,   0x21,
+                             0x1,   0x2,
+                             0x93,  0x5,
+                             0x19,  0x1,
+                             0x82,  0x2,
+                             0x2,   0x1,
+                             0xd,   0x67,
+                             0x1,   0x0,
+                             0x0,   0x5a,
+                             0x3,   0x12,
+                             0x33,  0x0,
+                             0x1,   0x1,
+                             0x1,   0x5,
+                             0x1,   0x3,
+                             0x1,   0x3,
+                             0x1,   0x3,
+                             0x1,   0x8,
+                             0x3,   0x1,
+                             0x3,   0x1,
+                             0x8,   0x6,
+                             0x6,   0x8,
+                             0x3,   0x3,
+                             0x36,  0x68,
+                             0x1,   0x73,
+                             0x41,  0x1c,
+                             0x65,  0x3,
+                             0x2,   0x2,
+                             0x0,   0x15,
+                             0x13,  0x8,
+                             0x0,   0xa,
+                             0x2,   0x0,
+                             0x0,   0x3,
+                             0x1,   0x0,
+                             0x0,   0xd,
+                             0x0,   0xb3,
+                             0x50,  0x68,
+                             0xaa,  0x0,
+                             0x1d,  0xc,
+                             0xb,   0xc,
+                             0xc,   0xd,
+                             0xd,   0x8,
+                             0xa,   0x42,
+                             0xb,   0x0,
+                             0x3b,  0x9c,
+                             0x3b,  0x0,
+                             0x32,  0x5c,
+                             0x2a,  0x56,
+                             0x1f,  0x69,
+                             0x12,  0x5,
+                             0x3,   0x7,
+                             0x3a,  0x8f,
+                             0x3b,  0x0,
+                             0x30,  0x4f,
+                             0x56,  0x1f,
+                             0x59,  0x1,
+                             0x1,   0x4,
+                             0x0,   0x0,
+                             0x26,  0x25,
+                             0x13,  0x13,
+                             0xd,   0xd,
+                             0x5e,  0x6,
+                             0x1f,  0x31,
+                             0x12,  0xd,
+                             0x1b,  0x1,
+                             0xb,   0x9,
+                             0x0,   0x0,
+                             0x2c,  0x1e,
+                             0x7,   0x0,
+                             0xb,   0x4,
+                             0x3d,  0xa,
+                             0x4,   0x4,
+                             0x0,   0x4,
+                             0x7,   0x5,
+                             0x5,   0x4,
+                             0x0,   0x6,
+                             0x6,   0x3,
+                             0x7,   0x0,
+                             0xd,   0x8,
+                             0x6,   0x11,
+                             0x47,  0x3,
+                             0x17,  0x62,
+                             0x6,   0x7,
+                             0x14,  0x11,
+                             0xc,   0x2,
+                             0x7,   0x4,
+                             0x5e,  0x12,
+                             0x1f,  0x7,
+                             0x7,   0x0,
+                             0x3,   0x4,
+                             0x3,   0x3,
+                             0x3,   0x4,
+                             0x4,   0x4,
+                             0x0,   0x0,
+                             0x3,   0x0,
+                             0x0,   0x0,
+                             0x4d,  0xc,
+                             0x0,   0xc,
+                             0x4,   0x7,
+                             0x31,  0x66,
+                             0x0,   0x2d,
+                             0x66,  0x0,
+                             0x31,  0x2,
+                             0x0,   0xb,
+                             0x5,   0x5,
+                             0x4,   0xc,
+                             0x5,   0x36,
+                             0x4,   0x7,
+                             0x11,  0x3,
+                             0x2,   0x12,
+                             0x1,   0x22,
+                             0x0,   0xc,
+                             0x38,  0x0,
+                             0x0,   0x0,
+                             0x11,  0x1f,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0x32,  0x0,
+                             0x0,   0x9,
+                             0x0,   0xe,
+                             0xd,   0x6,
+                             0x9,   0x9,
+                             0x6,   0x1,
+                             0x0,   0x0,
+                             0x21,  0x1,
+                             0x4,   0x3,
+                             0x1,   0x1,
+                             0x0,   0x0,
+                             0x1,   0x0,
+                             0xb,   0xb,
+                             0x1,   0x1,
+                             0x1,   0x3b,
+                             0xa,   0x24,
+                             0x41,  0x1,
+                             0x58,  0x0,
+                             0xa,   0x3d,
+                             0x1,   0x0,
+                             0x7,   0xa,
+                             0x4b,  0x2,
+                             0x1d,  0x1,
+                             0x1,   0x1,
+                             0x1,   0xf,
+                             0xd,   0x9,
+                             0xf,   0xe,
+                             0x5,   0x9,
+                             0x0,   0x4,
+                             0x2,   0x3,
+                             0x9,   0x1,
+                             0x5,   0x4,
+                             0x14,  0x44,
+                             0x8,   0x4c,
+                             0xd,   0x51,
+                             0x9,   0x4c,
+                             0x10,  0x9,
+                             0x3e,  0xa,
+                             0x44,  0x55,
+                             0x4,   0x54,
+                             0x6,   0x1f,
+                             0x56,  0xc,
+                             0xf,   0x1f,
+                             0x6,   0x54,
+                             0x6,   0x14,
+                             0x1f,  0x1,
+                             0x5,   0x5,
+                             0x3,   0x1,
+                             0x8,   0x1f,
+                             0x1,   0x0,
+                             0x73,  0x10,
+                             0x40,  0x1,
+                             0x19,  0xc,
+                             0x8,   0x19,
+                             0x0,   0x34,
+                             0x69,  0x6b,
+                             0x4,   0x8,
+                             0x0,   0x0,
+                             0x1,   0xc,
+                             0x1,   0x0,
+                             0x0,   0x3,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x0,
+                             0x0,   0x7,
+                             0x2,   0xc,
+                             0xb,   0x3,
+                             0x8,   0x8,
+                             0x0,   0x7,
+                             0x0,   0x14,
+                             0x13,  0x6,
+                             0x6,   0x3,
+                             0x4,   0xb,
+                             0xa,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x1,   0xa8,
+                             0x0,   0x23,
+                             0x6,   0x2,
+                             0x7,   0x0,
+                             0x4,   0x4,
+                             0x3,   0x6,
+                             0x20,  0x6,
+                             0x1a,  0x19,
+                             0x15,  0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x10,  0x11,
+                             0xc,   0xb,
+                             0x3,   0x3,
+                             0x7,   0x7,
+                             0x1,   0x7,
+                             0x9,   0xc,
+                             0x32,  0x84,
+                             0x59,  0x70,
+                             0x1,   0x0,
+                             0x0,   0x39,
+                             0x1,   0x1,
+                             0x2,   0x9,
+                             0x9,   0x9,
+                             0x9,   0x2,
+                             0x23,  0x6,
+                             0x5,   0x2,
+                             0xe,   0xe,
+                             0x5,   0x7,
+                             0x7,   0x5,
+                             0x8,   0x7,
+                             0x3,   0x6,
+                             0x6,   0x3,
+                             0xa,   0x2,
+                             0x5,   0x2,
+                             0x5,   0x2,
+                             0xe,   0x2,
+                             0x8,   0x2,
+                             0x6,   0x2,
+                             0xa,   0x2,
+                             0x5,   0x2,
+                             0x5,   0x2,
+                             0x0,   0x10,
+                             0x0,   0x1,
+                             0x0,   0x4,
+                             0x21,  0x6,
+                             0x9,   0x4,
+                             0x4,   0x0,
+                             0x1,   0x8,
+                             0x8,   0x1,
+                             0x16,  0x0,
+                             0xe,   0xa,
+                             0x7,   0xe,
+                             0x3,   0x0,
+                             0x0,   0x5,
+                             0x21,  0x4,
+                             0x54,  0x23,
+                             0x1,   0x3,
+                             0xc,   0x7,
+                             0x42,  0x2,
+                             0x0,   0x13,
+                             0xa,   0x7,
+                             0x9,   0x1,
+                             0x14,  0x14,
+                             0x0,   0x1,
+                             0x11,  0x17,
+                             0x1c,  0x1c,
+                             0x1c,  0x0,
+                             0x1,   0x34,
+                             0x1,   0x2,
+                             0x1,   0x2,
+                             0x5,   0x2,
+                             0x50,  0xf,
+                             0x1,   0xa,
+                             0x1,   0x4,
+                             0x9,   0x4,
+                             0x17,  0x2,
+                             0x3,   0xa,
+                             0xe,   0x48,
+                             0x18,  0x4,
+                             0x3,   0x18,
+                             0xe,   0x34,
+                             0x6,   0x0,
+                             0x42,  0x3c,
+                             0x10,  0x2,
+                             0x14,  0x3,
+                             0x1b,  0x9,
+                             0x35,  0x22,
+                             0x22,  0x7f,
+                             0x5,   0x1c,
+                             0x4a,  0x7a,
+                             0x5,   0x4a,
+                             0x22,  0xe,
+                             0x3,   0x2,
+                             0x1,   0x1,
+                             0x3,   0xc,
+                             0x6,   0x4,
+                             0x1,   0x3,
+                             0x3,   0x22,
+                             0x1a,  0x1,
+                             0x2,   0x9,
+                             0x8,   0x6,
+                             0x3,   0x3,
+                             0x2,   0x3,
+                             0x5,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x23,
+                             0x0,   0x12,
+                             0x3,   0x5,
+                             0x22,  0x0,
+                             0x3,   0x3,
+                             0x2,   0x2,
+                             0x76,  0x5,
+                             0x61,  0x3,
+                             0x0,   0x0,
+                             0x0,   0x6,
+                             0x1,   0x5,
+                             0x3d,  0x24,
+                             0x1f,  0x1,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x1d,  0x1d,
+                             0x1d,  0x7,
+                             0x27,  0x1b,
+                             0x1c,  0x3,
+                             0x3,   0x3,
+                             0x2,   0x3,
+                             0x3,   0x2,
+                             0x3,   0x8,
+                             0x0,   0x3a,
+                             0x26,  0x22,
+                             0x1,   0x4,
+                             0x4,   0x1,
+                             0x1,   0x3,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x3,   0x1,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x1,   0x26,
+                             0x2,   0x26,
+                             0x4,   0x7,
+                             0x42,  0x4,
+                             0x1,   0x0,
+                             0x4d,  0x1,
+                             0x0,   0x4,
+                             0x8,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x74,
+                             0x4d,  0x1,
+                             0x13,  0x1,
+                             0x2,   0x11,
+                             0x0,   0x0,
+                             0x5,   0x1e,
+                             0x0,   0x18,
+                             0x0,   0x0,
+                             0x0,   0x2,
+                             0x0,   0x0,
+                             0x1e,  0x1f,
+                             0x1,   0x48,
+                             0x23,  0x3e,
+                             0x44,  0x25,
+                             0x2,   0x0,
+                             0x1c,  0x35,
+                             0x0,   0x10,
+                             0x21,  0x1,
+                             0xd,   0xc,
+                             0xa,   0xe,
+                             0x0,   0x35,
+                             0x0,   0x0,
+                             0x1,   0x9,
+                             0x2,   0x1,
+                             0x7,   0x2,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0xa,
+                             0x0,   0x3,
+                             0x1f,  0x6c,
+                             0xa,   0xa,
+                             0x16,  0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0xe,   0x38,
+                             0x17,  0x6,
+                             0x0,   0x0,
+                             0x0,   0x6,
+                             0x6c,  0x8f,
+                             0x39,  0x20,
+                             0x1d,  0x94,
+                             0x2,   0x20,
+                             0x4,   0x7,
+                             0x4,   0x0,
+                             0x0,   0x0,
+                             0x4,   0x0,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x51,  0xb4,
+                             0x5,   0x26,
+                             0x65,  0x1,
+                             0xa,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x34,  0x23,
+                             0x7,   0x31,
+                             0x5,   0x0,
+                             0x4,   0x2,
+                             0x2,   0x7,
+                             0x6,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x7,
+                             0x0,   0xe,
+                             0x1,   0x3,
+                             0xd,   0xc,
+                             0x0,   0x21,
+                             0x1,   0x10,
+                             0x14,  0x3f,
+                             0x0,   0x0,
+                             0x18,  0x5,
+                             0x1,   0xb,
+                             0x2,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x3,   0x3,
+                             0x1,   0x2,
+                             0x3,   0x4,
+                             0x4,   0x5,
+                             0x5,   0x5,
+                             0x5,   0x0,
+                             0x0,   0x10,
+                             0x10,  0x2,
+                             0x0,   0x0,
+                             0x2,   0x2,
+                             0x1,   0x0,
+                             0x2,   0x3,
+                             0x1,   0x6,
+                             0x9,   0x1,
+                             0x0,   0xe,
+                             0x16,  0x17,
+                             0x4,   0x4,
+                             0x6,   0x1,
+                             0x1a,  0x1,
+                             0x41,  0x31,
+                             0x1,   0x50,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x1,   0x0,
+                             0x6,   0x1,
+                             0x1,   0x1,
+                             0xc,   0x0,
+                             0x3,   0x3,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0xd8,  0x2,
+                             0x2,   0x7,
+                             0x5,   0x2d,
+                             0x18,  0x5,
+                             0x3,   0xa,
+                             0x1,   0x0,
+                             0x1,   0x0,
+                             0x0,   0x2,
+                             0x2,   0x3,
+                             0x3,   0x20,
+                             0x5b,  0x0,
+                             0xf,   0x1,
+                             0x7,   0x6,
+                             0x7,   0x2,
+                             0x0,   0x88,
+                             0x3e,  0x1f,
+                             0x3,   0x1,
+                             0x5,   0x4,
+                             0x7,   0x6,
+                             0x7,   0x6,
+                             0x7,   0x7,
+                             0x5,   0x1,
+                             0x2,   0x3,
+                             0x4,   0x3,
+                             0xb,   0x7,
+                             0x68,  0x4,
+                             0x0,   0x20,
+                             0x2,   0x5,
+                             0x0,   0x5,
+                             0x6,   0xa5,
+                             0x2,   0x2,
+                             0x4,   0x7,
+                             0x5,   0x7,
+                             0xe,   0x4,
+                             0xe,   0xc,
+                             0x0,   0x3,
+                             0x1f,  0x1,
+                             0x44,  0x23,
+                             0x1c,  0x0,
+                             0x1,   0xe,
+                             0x2,   0x0,
+                             0x5,   0x47,
+                             0x0,   0x0,
+                             0x20,  0x0,
+                             0x0,   0x0,
+                             0x29,  0x5,
+                             0x3,   0xb,
+                             0x4,   0x1,
+                             0x1,   0x1f,
+                             0x1,   0x1b,
+                             0x2,   0x0,
+                             0xc,   0x6,
+                             0x0,   0x19,
+                             0x0,   0x1,
+                             0x3,   0x6,
+                             0x4,   0x6,
+                             0x81,  0x35,
+                             0x0,   0x3,
+                             0x4,   0x0,
+                             0x1,   0x2,
+                             0x2,   0xb,
+                             0x2,   0xb,
+                             0x0,   0x31,
+                             0x3,   0x5,
+                             0x4a,  0x2,
+                             0xa6,  0x4,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x9,   0x5,
+                             0x5,   0x4,
+                             0xe,   0xd,
+                             0x8d,  0x5,
+                             0x1e,  0x3,
+                             0x6,   0xb,
+                             0x4,   0x4,
+                             0x4,   0x4,
+                             0x3,   0x2,
+                             0x2,   0x2,
+                             0x7,   0x2,
+                             0x2,   0x6f,
+                             0x1,   0x1,
+                             0x5,   0x5,
+                             0x1,   0x2,
+                             0x1,   0x1,
+                             0x16,  0x1,
+                             0x14,  0x1,
+                             0x10,  0x1,
+                             0xf,   0xb,
+                             0x10,  0xc,
+                             0x11,  0x18,
+                             0x14,  0x13,
+                             0x1,   0x2,
+                             0x6,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x47,
+                             0x2,   0x14,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x4,   0x5,
+                             0x4f,  0x0,
+                             0x1d,  0x1,
+                             0x0,   0x1,
+                             0x0,   0x1,
+                             0x0,   0x0,
+                             0x1,   0x3,
+                             0xd,   0xd,
+                             0x84,  0x5,
+                             0x0,   0x8,
+                             0x7,   0x12,
+                             0x12,  0x1,
+                             0x1,   0x1,
+                             0x1,   0x83,
+                             0x5,   0x0,
+                             0x1b,  0x1,
+                             0x5,   0x43,
+                             0x5a,  0x1,
+                             0xa,   0x5a,
+                             0x1,   0x23,
+                             0x14,  0x10,
+                             0x15,  0x1,
+                             0x13,  0xf,
+                             0x2,   0x2,
+                             0x18,  0x21,
+                             0x1,   0x2,
+                             0x2,   0x13,
+                             0xd,   0xd,
+                             0xb,   0x1f,
+                             0x3,   0x2,
+                             0x68,  0x4,
+                             0x4,   0x6,
+                             0x6,   0x44,
+                             0x1,   0x18,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x4,   0x4,
+                             0x4,   0x8,
+                             0x22,  0x6,
+                             0x0,   0x8,
+                             0x1,   0x3,
+                             0x0,   0x0,
+                             0x32,  0x1,
+                             0x9,   0xa,
+                             0x13,  0x8,
+                             0x2,   0xd9,
+                             0x1a,  0x6,
+                             0x0,   0xad,
+                             0x18,  0x5,
+                             0x3a,  0x9,
+                             0xa,   0x6,
+                             0x2,   0x0,
+                             0x0,   0x9c,
+                             0x16,  0x5,
+                             0xb1,  0x18,
+                             0x6,   0x0,
+                             0x0,   0x0,
+                             0x6,   0x8d,
+                             0x10,  0x88,
+                             0x32,  0x1,
+                             0x6,   0x1b,
+                             0xe,   0x0,
+                             0x5,   0x1,
+                             0x0,   0x0,
+                             0x6,   0x2,
+                             0x1,   0x1,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0xa,   0x0,
+                             0x0,   0x0,
+                             0x0,   0xf,
+                             0x3,   0x5,
+                             0x39,  0x1d,
+                             0xb,   0x4,
+                             0x5,   0x5,
+                             0x5,   0x0,
+                             0x0,   0x59,
+                             0x17,  0x0,
+                             0x2b,  0x0,
+                             0x3,   0x5,
+                             0x2,   0x3,
+                             0x0,   0x0,
+                             0x2,   0x6,
+                             0x3,   0x6,
+                             0x6,   0x5,
+                             0x6,   0x6,
+                             0x4,   0x3,
+                             0x6,   0x33,
+                             0xa,   0x9,
+                             0xa,   0x0,
+                             0x13,  0x1a,
+                             0x1,   0x19,
+                             0x7c,  0x1,
+                             0x1,   0x1,
+                             0x2,   0x0,
+                             0x20,  0x1,
+                             0x3b,  0x3,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x74,  0x3,
+                             0x3,   0x1,
+                             0x9,   0x61,
+                             0x1,   0x0,
+                             0x5,   0x5,
+                             0x5,   0x5,
+                             0x0,   0x9,
+                             0x5,   0xa,
+                             0x4,   0x6,
+                             0x0,   0x2a,
+                             0x2,   0x2,
+                             0x0,   0x1,
+                             0xc,   0x0,
+                             0x8,   0x6,
+                             0x0,   0x1,
+                             0xc,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x3,
+                             0x3,   0x3,
+                             0x7,   0x10,
+                             0x1,   0x1b,
+                             0x0,   0x1c,
+                             0x7,   0x5f,
+                             0x3,   0x0,
+                             0x17,  0x3,
+                             0x3,   0x1d,
+                             0x8,   0x8,
+                             0x5,   0xb,
+                             0xb,   0xc,
+                             0x1a,  0x8,
+                             0x74,  0x1b,
+                             0x37,  0x1,
+                             0xb,   0x2,
+                             0x4,   0x3,
+                             0x1,   0x2,
+                             0x3,   0x9,
+                             0x11,  0x0,
+                             0x25,  0x0,
+                             0x1,   0x1,
+                             0x0,   0x9,
+                             0x3,   0x4c,
+                             0x3,   0xb,
+                             0x0,   0x6c,
+                             0x7,   0x25,
+                             0x2a,  0x40,
+                             0x29,  0x0,
+                             0x0,   0x0,
+                             0x4,   0x4,
+                             0x2c,  0x7,
+                             0x42,  0x2,
+                             0x0,   0x38,
+                             0x0,   0x3,
+                             0xb,   0xe,
+                             0xb,   0x3,
+                             0x3,   0x2,
+                             0x3,   0x1e,
+                             0x3,   0x7,
+                             0x91,  0x0,
+                             0x1d,  0x23,
+                             0x3,   0x7,
+                             0x0,   0x2,
+                             0x35,  0x2e,
+                             0x20,  0x4,
+                             0x4,   0x3,
+                             0x5,   0x0,
+                             0x4b,  0x2,
+                             0x1,   0x1c,
+                             0x8,   0x5,
+                             0x1,   0x0,
+                             0xa,   0x0,
+                             0x6,   0x7,
+                             0xd,   0x7,
+                             0x22,  0x1f,
+                             0x1,   0x3,
+                             0x8,   0x21,
+                             0x9,   0x7f,
+                             0x0,   0x0,
+                             0x13,  0x0,
+                             0x6,   0x3c,
+                             0x42,  0x5b,
+                             0x47,  0x9,
+                             0x0,   0x1d,
+                             0x4,   0x4f,
+                             0x3,   0x1,
+                             0x3,   0x0,
+                             0x0,   0x0,
+                             0x5,   0x2,
+                             0xe,   0x3c,
+                             0x0,   0x53,
+                             0x3,   0x1f,
+                             0x7,   0x0,
+                             0x4,   0x5,
+                             0x5,   0xf,
+                             0x1,   0x4,
+                             0x2c,  0x2,
+                             0x1f,  0x4,
+                             0x29,  0x0,
+                             0x2c,  0xd,
+                             0x0,   0x2d,
+                             0xa,   0x20,
+                             0xd,   0x23,
+                             0x0,   0x0,
+                             0x5,   0x0,
+                             0x0,   0x5,
+                             0x3,   0x1,
+                             0x0,   0x3,
+                             0x11,  0x6,
+                             0x35,  0x1,
+                             0x0,   0x0,
+                             0x0,   0x4a,
+                             0x4,   0x6,
+                             0x0,   0x1,
+                             0x6,   0x6,
+                             0x0,   0x0,
+                             0x6,   0x22,
+                             0x1,   0x1,
+                             0x10,  0x4,
+                             0xd,   0x0,
+                             0x1,   0x0,
+                             0x1,   0x0,
+                             0x0,   0x3,
+                             0x2,   0x2,
+                             0x5,   0x1,
+                             0x5,   0x6,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0x1,   0x4,
+                             0x2,   0x1,
+                             0x8,   0x5,
+                             0x3,   0x0,
+                             0x2,   0x0,
+                             0x0,   0x4,
+                             0x3,   0x6,
+                             0x0,   0x4,
+                             0x4,   0x0,
+                             0x0,   0x1,
+                             0x1,   0x2,
+                             0x3,   0x7,
+                             0x5,   0xc,
+                             0x0,   0x0,
+                             0x33,  0x9,
+                             0x3,   0x23,
+                             0x4d,  0xa,
+                             0x6,   0x6,
+                             0x7,   0x7,
+                             0x6,   0x7,
+                             0x44,  0xf,
+                             0x7,   0x24,
+                             0x22,  0x0,
+                             0x0,   0x12,
+                             0x1,   0x2,
+                             0x1,   0x0,
+                             0xd,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x2,
+                             0x2,   0x8,
+                             0x10,  0x3,
+                             0x3,   0x5,
+                             0x3,   0x3,
+                             0x6,   0x6,
+                             0x6,   0x6,
+                             0x0,   0x1,
+                             0x3,   0x3,
+                             0x6,   0x6,
+                             0x6,   0x6,
+                             0x4,   0x4,
+                             0x7,   0x12,
+                             0x7,   0x1b,
+                             0x1e,  0x1b,
+                             0x1f,  0x1d,
+                             0x4,   0x4,
+                             0x4,   0x4,
+                             0x4,   0x7,
+                             0x7,   0x2,
+                             0x4,   0x26,
+                             0x2c,  0x2b,
+                             0x2,   0x24,
+                             0x1,   0x9,
+                             0x9,   0x1f,
+                             0x3,   0x5,
+                             0x43,  0xe,
+                             0x6,   0x3,
+                             0x8f,  0x38,
+                             0x1,   0x4,
+                             0x12,  0x0,
+                             0x0,   0x0,
+                             0x1,   0x1,
+                             0x1,   0x0,
+                             0x1,   0xc,
+                             0x0,   0x16,
+                             0x4,   0x0,
+                             0x7f,  0x5,
+                             0x0,   0x66,
+                             0x1f,  0x3,
+                             0x0,   0x6,
+                             0x1a,  0x5,
+                             0x5,   0x5,
+                             0x2,   0x2,
+                             0x4,   0xa3,
+                             0x3,   0x8,
+                             0x5,   0x1,
+                             0x5,   0x3,
+                             0x1,   0x1a,
+                             0x3,   0x0,
+                             0x5,   0x0,
+                             0x0,   0x3,
+                             0x1,   0x4,
+                             0x3,   0x0,
+                             0x5,   0x6,
+                             0xb,   0x4,
+                             0x4,   0x4,
+                             0x3,   0x3,
+                             0x1c,  0x1f,
+                             0x9,   0x0,
+                             0x0,   0x0,
+                             0x6,   0x8,
+                             0x7,   0xa,
+                             0x43,  0x17,
+                             0x14,  0x0,
+                             0x0,   0x5,
+                             0x3,   0x0,
+                             0x8,   0x8,
+                             0x22,  0x0,
+                             0x0,   0x1,
+                             0x79,  0x6a,
+                             0x3,   0x21,
+                             0x0,   0x39,
+                             0x4,   0x12,
+                             0x4,   0x7c,
+                             0x5,   0x0,
+                             0x5,   0xb,
+                             0x3,   0x0,
+                             0x0,   0x3,
+                             0x3,   0x6,
+                             0x3c,  0x42,
+                             0x4,   0x48,
+                             0x30,  0x7f,
+                             0x17,  0x1,
+                             0x4f,  0x2,
+                             0x1,   0x7,
+                             0x43,  0x0,
+                             0x22,  0x0,
+                             0x44,  0x3e,
+                             0x3,   0x2,
+                             0x3,   0x40,
+                             0x39,  0x88,
+                             0x42,  0x0,
+                             0x4,   0x1,
+                             0x1d,  0x7,
+                             0x3,   0x1c,
+                             0x4,   0x3,
+                             0x1b,  0x3,
+                             0x7,   0x62,
+                             0x1f,  0x3,
+                             0x0,   0x4f,
+                             0x22,  0xd,
+                             0x35,  0x1f,
+                             0x1,   0x0,
+                             0x5,   0xd,
+                             0xa,   0x2,
+                             0x0,   0x1,
+                             0x12,  0x4,
+                             0x23,  0xb,
+                             0x4,   0x3,
+                             0x3,   0x23,
+                             0x4,   0x0,
+                             0x0,   0x0,
+                             0x6f,  0x2,
+                             0x7,   0x6,
+                             0x1,   0x4,
+                             0x4,   0x0,
+                             0x3,   0x2,
+                             0x4,   0x0,
+                             0x0,   0x0,
+                             0x6,   0x2,
+                             0x28,  0x2,
+                             0x1,   0x2,
+                             0x4c,  0x5,
+                             0x0,   0x0,
+                             0x2,   0x3,
+                             0x1a,  0x0,
+                             0x3,   0x26,
+                             0x7,   0xf,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x7,   0x0,
+                             0x4,   0x7f,
+                             0x5,   0x0,
+                             0xd,   0xd,
+                             0x1,   0x1,
+                             0x4,   0x1,
+                             0x1d,  0x8,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x6,   0x5,
+                             0x1,   0x5,
+                             0x5,   0x6,
+                             0x1a,  0x0,
+                             0x0,   0x1,
+                             0x3a,  0x0,
+                             0x0,   0x8,
+                             0x23,  0x1,
+                             0x8,   0x7,
+                             0x8,   0x1,
+                             0x29,  0x0,
+                             0x9,   0x8,
+                             0x8,   0x8,
+                             0x65,  0x3d,
+                             0x2,   0x0,
+                             0x7,   0x1,
+                             0x29,  0x1,
+                             0x0,   0x1,
+                             0x11,  0x5,
+                             0x4,   0xb,
+                             0x4,   0x1,
+                             0x0,   0xa,
+                             0x9,   0x4,
+                             0x4,   0x0,
+                             0x6,   0x9,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x4,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x2,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x33,
+                             0x1,   0x1,
+                             0x27,  0x1,
+                             0x11,  0x0,
+                             0x4b,  0x1,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x4,
+                             0xc,   0x5,
+                             0xc,   0x0,
+                             0x22,  0x1,
+                             0x17,  0x4,
+                             0x5,   0xa,
+                             0x2,   0x2,
+                             0x2,   0x26,
+                             0x33,  0x1,
+                             0x1,   0x1,
+                             0x11,  0x4,
+                             0x4,   0xa,
+                             0x2,   0x6,
+                             0x5,   0x7,
+                             0x3,   0x3b,
+                             0x4,   0x3,
+                             0x1f,  0x4,
+                             0x8,   0x6,
+                             0x5,   0x5,
+                             0x5,   0x0,
+                             0x0,   0x40,
+                             0x3,   0xc,
+                             0x91,  0x1,
+                             0x0,   0x13,
+                             0xb,   0x1e,
+                             0x4,   0x19,
+                             0x3e,  0x2,
+                             0x1,   0x0,
+                             0x0,   0x6,
+                             0x1,   0x0,
+                             0x3,   0x16,
+                             0x4,   0x2,
+                             0xb,   0x1e,
+                             0x1,   0x6,
+                             0x6,   0x3f,
+                             0x6,   0x7,
+                             0xf,   0x3,
+                             0x18,  0x14,
+                             0x0,   0x0,
+                             0x4,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x2,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x9,
+                             0x1,   0x2f,
+                             0x0,   0x0,
+                             0x2f,  0x0,
+                             0x0,   0x1,
+                             0x23,  0x4,
+                             0x0,   0x0,
+                             0x6,   0x77,
+                             0x1,   0xd,
+                             0xd,   0x0,
+                             0x1b,  0xf,
+                             0x1b,  0x44,
+                             0x1,   0x0,
+                             0x6,   0x4,
+                             0x5,   0x43,
+                             0x1f,  0x6,
+                             0x8,   0x8,
+                             0x0,   0x0,
+                             0x3,   0x5,
+                             0x13,  0x3f,
+                             0x1f,  0x1,
+                             0x5,   0x2,
+                             0x1e,  0x61,
+                             0x56,  0x2,
+                             0x16,  0x1,
+                             0xd,   0x0,
+                             0xb,   0xb,
+                             0xb,   0x3,
+                             0x4,   0x3,
+                             0x0,   0x7,
+                             0xe,   0x7,
+                             0x10,  0x0,
+                             0x0,   0x2,
+                             0x10,  0xe,
+                             0x4,   0x1,
+                             0x6,   0xf,
+                             0x5,   0x5,
+                             0x2,   0x0,
+                             0x6,   0x3,
+                             0x9,   0x1b,
+                             0x14,  0x0,
+                             0x3c,  0x0,
+                             0x0,   0x0,
+                             0x0,   0x1b,
+                             0x8,   0x5,
+                             0x34,  0x3,
+                             0x3c,  0x13,
+                             0x42,  0x1,
+                             0xa,   0x0,
+                             0x3,   0x11,
+                             0x18,  0x1c,
+                             0x1,   0x1,
+                             0x2,   0x3,
+                             0x7,   0x6,
+                             0x7,   0x7,
+                             0x7,   0x7,
+                             0x6,   0x9,
+                             0x1,   0x9,
+                             0xb,   0x1,
+                             0x2,   0x1,
+                             0xe,   0x0,
+                             0x4,   0x3,
+                             0x1,   0x2,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x9,   0x31,
+                             0x1,   0x0,
+                             0x4,   0x4,
+                             0x4,   0x4,
+                             0x10,  0xf,
+                             0x7,   0x7,
+                             0x2,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x3,
+                             0x4,   0x2,
+                             0x0,   0x0,
+                             0xd,   0xa,
+                             0x6,   0x1,
+                             0x8,   0x0,
+                             0x18,  0x0,
+                             0x18,  0x2b,
+                             0x4,   0x2,
+                             0x2,   0x3,
+                             0x1,   0x4,
+                             0x5,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x37,
+                             0x1,   0x0,
+                             0x3,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x0,
+                             0x8,   0x6,
+                             0x2,   0x3,
+                             0x3,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x11,
+                             0x0,   0x2,
+                             0x2,   0xf,
+                             0x8,   0x1,
+                             0x8,   0x9,
+                             0x10,  0x2,
+                             0x2,   0x2,
+                             0x2,   0x9,
+                             0x7,   0x3,
+                             0x0,   0x75,
+                             0xd,   0x0,
+                             0x0,   0x0,
+                             0x0,   0x7,
+                             0x8,   0x4,
+                             0xa,   0x6,
+                             0x4,   0x1,
+                             0x2,   0x8,
+                             0x2,   0x0,
+                             0x15,  0x15,
+                             0x15,  0x0,
+                             0x0,   0x26,
+                             0x1,   0xb,
+                             0x15,  0x5,
+                             0x2,   0x2,
+                             0x2,   0x1,
+                             0x15,  0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x19,
+                             0x0,   0x1,
+                             0x21,  0x1,
+                             0x2,   0x1,
+                             0x1,   0x3,
+                             0x1,   0x0,
+                             0x0,   0x4,
+                             0x4,   0x0,
+                             0x14,  0x1,
+                             0x1,   0x1,
+                             0x1,   0x2,
+                             0x2,   0x2,
+                             0x1,   0x1,
+                             0x5,   0x3,
+                             0x1,   0x12,
+                             0x3,   0x3,
+                             0xd,   0x0,
+                             0x11,  0x2,
+                             0x3,   0x3,
+                             0x5,   0x5,
+                             0x5,   0x7,
+                             0x2,   0x2,
+                             0x3,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x2,   0x2,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x4,   0x4,
+                             0x4,   0x2,
+                             0x4,   0x4,
+                             0x2,   0x1,
+                             0x4,   0x1,
+                             0x1,   0x67,
+                             0x1,   0x3,
+                             0x2,   0x1,
+                             0x1,   0x1,
+                             0x19,  0x19,
+                             0x1,   0x19,
+                             0x1,   0x7,
+                             0x1,   0x0,
+                             0x2,   0x10,
+                             0x7,   0x7,
+                             0x3,   0x3,
+                             0x1d,  0x1,
+                             0x1,   0x27,
+                             0x2,   0x3,
+                             0x5,   0x2,
+                             0x2,   0xa,
+                             0x0,   0x0,
+                             0xab,  0x85,
+                             0x1,   0x1,
+                             0x8,   0x1d,
+                             0x35,  0x1,
+                             0x1a,  0x1,
+                             0x35,  0x1,
+                             0x1,   0x1,
+                             0x1,   0x6f,
+                             0x92,  0x2,
+                             0x2,   0x2,
+                             0x2,   0x1,
+                             0x2,   0x1,
+                             0x1,   0x3,
+                             0xb,   0x0,
+                             0x0,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x3,
+                             0x3,   0x4,
+                             0xc,   0x0,
+                             0x0,   0x1a,
+                             0x0,   0xf,
+                             0x19,  0xf,
+                             0x0,   0x13,
+                             0x13,  0x27,
+                             0x0,   0x14,
+                             0x13,  0x15,
+                             0x0,   0x45,
+                             0x11,  0x1d,
+                             0x1b,  0xb,
+                             0xb,   0x3,
+                             0x2,   0x1,
+                             0x3c,  0x3,
+                             0x10a, 0x42,
+                             0x1,   0x12,
+                             0x20,  0x1de,
+                             0x1,   0x0,
+                             0x3,   0x0,
+                             0x12,  0x18,
+                             0x18,  0x1c,
+                             0x1a,  0x0,
+                             0x20,  0x1e,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x1,   0x1,
+                             0x2,   0x4,
+                             0x61,  0x7,
+                             0x0,   0x10,
+                             0x35,  0x0,
+                             0x0,   0x0,
+                             0x10,  0x1f,
+                             0x0,   0x17,
+                             0x25,  0x26,
+                             0x1c,  0x7e,
+                             0x5,   0x2b,
+                             0x10,  0x56,
+                             0x47,  0x6,
+                             0x6,   0x1,
+                             0x1b,  0x0,
+                             0x0,   0x0,
+                             0x2b,  0x85,
+                             0x3c,  0xb,
+                             0x4,   0x4,
+                             0x6,   EXTRA_PC_PORT_TEXTURE_COUNT};
 }
 
-const std::vector<u32>& get_jak3_tpage_dir() {
+std::span<const u32> get_jak3_tpage_dir() {
   return tpage_dir;
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include "common/common_types.h"
 
-const std::vector<u32>& get_jak3_tpage_dir();
\ No newline at end of file
+std::span<const u32> get_jak3_tpage_dir();
\ No newline at end of file
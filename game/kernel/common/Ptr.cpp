@@ -0,0 +1,99 @@
+#include "Ptr.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "common/goal_constants.h"
+#include "common/log/log.h"
+
+#include "game/kernel/common/memory_layout.h"
+
+#include "fmt/core.h"
+
+namespace ptr_checks {
+namespace {
+struct Site {
+  const char* file;
+  const char* function;
+  u32 line;
+  u64 count = 0;
+};
+
+// file, function, line, column. The names are string literals, so they're compared by pointer.
+using SiteKey = std::tuple<const char*, const char*, u32, u32>;
+
+enum class Region { KERNEL, GLOBAL_HEAP, STACK, DEBUG_HEAP, MAX };
+const char* region_names[(int)Region::MAX] = {"kernel", "global heap", "stack", "debug heap"};
+
+Region region_of(u32 offset) {
+  if (offset < HEAP_START) {
+    return Region::KERNEL;
+  } else if (offset < GLOBAL_HEAP_END) {
+    return Region::GLOBAL_HEAP;
+  } else if (offset < DEBUG_HEAP_START) {
+    return Region::STACK;
+  } else {
+    return Region::DEBUG_HEAP;
+  }
+}
+
+// the kernel is only on the EE thread, but the report may be printed from somewhere else.
+std::mutex g_mutex;
+std::map<SiteKey, Site> g_sites;
+u64 g_region_counts[(int)Region::MAX] = {};
+}  // namespace
+
+void record_access(u32 offset, u32 size, const std::source_location& loc) {
+  ASSERT_MSG(offset >= EE_MAIN_MEM_LOW_PROTECT && (u64)offset + size <= EE_MAIN_MEM_SIZE,
+             fmt::format("Ptr access of {} bytes at #x{:x} is outside EE memory ({}:{} {})", size,
+                         offset, loc.file_name(), loc.line(), loc.function_name()));
+
+  SiteKey key(loc.file_name(), loc.function_name(), loc.line(), loc.column());
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto it = g_sites.find(key);
+  if (it == g_sites.end()) {
+    it = g_sites.emplace(key, Site{loc.file_name(), loc.function_name(), loc.line()}).first;
+  }
+  it->second.count++;
+  g_region_counts[(int)region_of(offset)]++;
+}
+
+/*!
+ * Print the call sites that accessed memory through Ptr the most.
+ */
+void print_report(int top_n) {
+  if (!PTR_DEBUG_CHECKS) {
+    lg::print("Ptr access checks are disabled, set PTR_DEBUG_CHECKS in Ptr.h\n");
+    return;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  std::vector<const Site*> sites;
+  u64 total = 0;
+  for (auto& [key, site] : g_sites) {
+    sites.push_back(&site);
+    total += site.count;
+  }
+  std::sort(sites.begin(), sites.end(),
+            [](const Site* a, const Site* b) { return a->count > b->count; });
+
+  lg::print("Ptr accesses: {}\n", total);
+  for (int i = 0; i < (int)Region::MAX; i++) {
+    lg::print("  {:<12} {:>14}\n", region_names[i], g_region_counts[i]);
+  }
+  for (int i = 0; i < std::min((int)sites.size(), top_n); i++) {
+    auto* site = sites[i];
+    lg::print("{:>14} {}:{} {}\n", site->count, site->file, site->line, site->function);
+  }
+}
+
+void reset() {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_sites.clear();
+  for (auto& x : g_region_counts) {
+    x = 0;
+  }
+}
+}  // namespace ptr_checks
@@ -5,11 +5,47 @@
  * Representation of a GOAL pointer which can be converted to/from a C pointer.
  */
 
+#include <source_location>
+#include <type_traits>
+
 #include "common/common_types.h"
 #include "common/util/Assert.h"
 
 #include "game/runtime.h"
 
+//! Toggle to bounds check every Ptr dereference and count them by call site. This is slow and is
+// only meant for finding which kernel code is hitting EE memory the most, see ptr_checks.
+constexpr bool PTR_DEBUG_CHECKS = false;
+
+namespace ptr_checks {
+void record_access(u32 offset, u32 size, const std::source_location& loc);
+void print_report(int top_n);
+void reset();
+}  // namespace ptr_checks
+
+/*!
+ * Policies for what Ptr does on each dereference. The release policy does nothing, so Ptr is just
+ * an offset from g_ee_main_mem. The checked policy checks against the memory map and records the
+ * caller.
+ */
+struct PtrReleasePolicy {
+  template <typename T>
+  static void on_access(u32, const std::source_location&) {}
+};
+
+struct PtrCheckedPolicy {
+  template <typename T>
+  static void on_access(u32 offset, const std::source_location& loc) {
+    if constexpr (std::is_void_v<T>) {
+      ptr_checks::record_access(offset, 1, loc);
+    } else {
+      ptr_checks::record_access(offset, sizeof(T), loc);
+    }
+  }
+};
+
+using PtrPolicy = std::conditional_t<PTR_DEBUG_CHECKS, PtrCheckedPolicy, PtrReleasePolicy>;
+
 /*!
  * GOAL pointer to a T.  Represented as a 32-bit unsigned offset from g_ee_main_mem.
  * A NULL pointer has an offset of 0.
@@ -17,7 +53,8 @@
  * This doesn't have to be very efficient, as this implementation is only used in the C Kernel.
  * The GOAL implementation is much more efficient.
  *
- * Consider putting size checks on these?
+ * Dereferences go through PtrPolicy. Overloaded operators can't take the caller's location, so
+ * -> and * are counted by the type being accessed, and c() is counted at the call site.
  */
 template <typename T>
 struct Ptr {
@@ -38,6 +75,7 @@ struct Ptr {
    */
   T* operator->() {
     ASSERT(offset);
+    PtrPolicy::on_access<T>(offset, std::source_location::current());
     return (T*)(g_ee_main_mem + offset);
   }
 
@@ -46,6 +84,7 @@ struct Ptr {
    */
   T& operator*() {
     ASSERT(offset);
+    PtrPolicy::on_access<T>(offset, std::source_location::current());
     return *(T*)(g_ee_main_mem + offset);
   }
 
@@ -59,10 +98,11 @@ struct Ptr {
   /*!
    * Convert to a C pointer.
    */
-  T* c() {
+  T* c(const std::source_location& loc = std::source_location::current()) {
     if (!offset) {
       return nullptr;
     }
+    PtrPolicy::on_access<T>(offset, loc);
     return (T*)(g_ee_main_mem + offset);
   }
 
@@ -75,6 +75,18 @@ u32 RpcBusy(s32 channel) {
   return sceSifCheckStatRpc(&cd[channel].rpcd);
 }
 
+/*!
+ * Check if any RPC that has been set up is busy.
+ */
+bool AnyRpcBusy() {
+  for (auto& client : cd) {
+    if (client.serve && sceSifCheckStatRpc(&client.rpcd)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /*!
  * Wait for an RPC to not be busy. Prints a stall message if sShowStallMsg is true and we have
  * to wait on the IOP.  Stalling here is bad because it means the rest of the game can't run.
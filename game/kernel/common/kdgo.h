@@ -15,6 +15,7 @@ s32 RpcCall(s32 rpcChannel,
             s32 recvSize);
 u64 RpcCall_wrapper(void* _args);
 u32 RpcBusy(s32 channel);
+bool AnyRpcBusy();
 void RpcSync(s32 channel);
 void LoadDGOTest();
 void kdgo_init_globals();
@@ -66,7 +66,7 @@ struct link_control {
   int m_table_toggle;
 
   bool m_opengoal;
-  bool m_busy;  // only in jak2, but doesn't hurt to set it in jak 1.
+  bool m_busy;  // set from link begin to finish, savestates wait for it to be clear.
 
   // jak 3 new stuff
   bool m_on_global_heap = false;
@@ -1,5 +1,6 @@
 #include "kmachine.h"
 
+#include <algorithm>
 #include <random>
 
 #include "common/global_profiler/GlobalProfiler.h"
@@ -16,7 +17,9 @@
 #include "game/graphics/screenshot.h"
 #include "game/kernel/common/Ptr.h"
 #include "game/kernel/common/kernel_types.h"
+#include "game/kernel/common/kmalloc.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/mips2c/mips2c_table.h"
 #include "game/sce/libcdvd_ee.h"
@@ -43,6 +46,9 @@ u32 vif1_interrupt_handler = 0;
 u32 vblank_interrupt_handler = 0;
 
 Timer ee_clock_timer;
+// headless mode EE timer: the start of the current frame, and how far into the frame it's read.
+u64 ee_fixed_timer_frame_start = 0;
+u64 ee_fixed_timer_frame_reads = 0;
 
 void kmachine_init_globals_common() {
   memset(pad_dma_buf, 0, sizeof(pad_dma_buf));
@@ -52,6 +58,8 @@ void kmachine_init_globals_common() {
   vif1_interrupt_handler = 0;
   vblank_interrupt_handler = 0;
   ee_clock_timer = Timer();
+  ee_fixed_timer_frame_start = 0;
+  ee_fixed_timer_frame_reads = 0;
 }
 
 /*!
@@ -416,7 +424,23 @@ u64 pc_filter_debug_string(u32 str_ptr, u32 dist_ptr) {
 
 CommonPCPortFunctionWrappers g_pc_port_funcs;
 
+u64 ee_fixed_timer_frame_ticks() {
+  return 300'000'000 / std::max(1, (int)Gfx::g_global_settings.target_fps);
+}
+
+void ee_timer_next_frame() {
+  ee_fixed_timer_frame_start += ee_fixed_timer_frame_ticks();
+  ee_fixed_timer_frame_reads = 0;
+}
+
 u64 read_ee_timer() {
+  if (Gfx::g_global_settings.headless) {
+    // each read moves a tick forward, so code that waits for the timer still finishes. It stays
+    // in the frame, so the game never sees a lag frame.
+    ee_fixed_timer_frame_reads =
+        std::min(ee_fixed_timer_frame_reads + 1, ee_fixed_timer_frame_ticks() - 1);
+    return ee_fixed_timer_frame_start + ee_fixed_timer_frame_reads;
+  }
   u64 ns = ee_clock_timer.getNs();
   return (ns * 3) / 10;
 }
@@ -1125,6 +1149,13 @@ void init_common_pc_port_functions(
   // debugging tools
   make_func_symbol_func("pc-filter-debug-string?", (void*)pc_filter_debug_string);
   make_func_symbol_func("pc-screen-shot", (void*)pc_screen_shot);
+  // Print kmalloc telemetry for a kheap, or all kheaps if 0. Prints to stdout.
+  make_func_symbol_func("pc-kheap-report", (void*)kheap_report);
+  // Print the top N call sites for Ptr accesses, if PTR_DEBUG_CHECKS is on.
+  make_func_symbol_func("pc-ptr-report", (void*)ptr_checks::print_report);
   make_func_symbol_func("pc-register-screen-shot-settings",
                         (void*)pc_register_screen_shot_settings);
+  // Save or restore a savestate slot after the current frame, for tests. See ksavestate.h
+  make_func_symbol_func("pc-save-state", (void*)savestate_request_save);
+  make_func_symbol_func("pc-restore-state", (void*)savestate_request_restore);
 }
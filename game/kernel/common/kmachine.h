@@ -1,5 +1,7 @@
 #pragma once
 
+#include <random>
+
 #include "common/common_types.h"
 
 #include "game/graphics/gfx.h"
@@ -24,9 +26,16 @@ extern u32 reboot_iop;  // renamed to reboot_iop to avoid conflict
 
 extern const char* init_types[];
 extern u32 vblank_interrupt_handler;
+extern std::mt19937 extra_random_generator;
 
 void kmachine_init_globals_common();
 
+/*!
+ * In headless mode, the EE timer only moves forward a frame at a time, when this is called on each
+ * vsync. The game then sees a fixed timestep, however long the frame took to run.
+ */
+void ee_timer_next_frame();
+
 /*!
  * Initialize the CD Drive
  */
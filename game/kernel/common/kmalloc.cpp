@@ -1,9 +1,15 @@
 #include "kmalloc.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "common/goal_constants.h"
+#include "common/log/log.h"
 
 #include "game/kernel/common/kprint.h"
 #include "game/kernel/common/kscheme.h"
@@ -22,6 +28,191 @@ enum MemItemsCategory {
 int MemItemsCount[NUM_CATEGORIES] = {0, 0};
 int MemItemsSize[NUM_CATEGORIES] = {0, 0};
 
+namespace {
+/*!
+ * PC-only allocation telemetry, see kmalloc_telemetry in kmalloc.h.
+ * For each heap, this tracks bytes and counts per allocation name, high-water marks for both ends
+ * and the allocations that are still live, which is used to draw a map of the heap.
+ * Heaps are reset by GOAL directly, so an allocation is considered dead once a later allocation
+ * from the same end starts at or below (above, for the top) it.
+ */
+struct AllocRecord {
+  u32 start;
+  u32 size;
+  const std::string* name;
+};
+
+struct NameStats {
+  u32 count = 0;
+  u64 total_bytes = 0;
+};
+
+struct HeapStats {
+  u32 bottom_high_water = 0;
+  u32 top_high_water = 0;
+  u32 failed_allocs = 0;
+  std::unordered_map<std::string, NameStats> names;
+  std::vector<AllocRecord> bottom;  // ascending addresses
+  std::vector<AllocRecord> top;     // descending addresses
+};
+
+std::map<u32, HeapStats> g_heap_stats;
+
+void record_alloc(Ptr<kheapinfo> heap, u32 start, s32 size, bool from_top, const char* name) {
+  auto& stats = g_heap_stats[heap.offset];
+  auto name_it = stats.names.try_emplace(name ? name : "").first;
+  name_it->second.count++;
+  name_it->second.total_bytes += size;
+
+  AllocRecord rec{start, (u32)size, &name_it->first};
+  if (from_top) {
+    while (!stats.top.empty() && stats.top.back().start < start + size) {
+      stats.top.pop_back();
+    }
+    stats.top.push_back(rec);
+    stats.top_high_water = std::max(stats.top_high_water, (u32)(heap->top_base - heap->top));
+  } else {
+    while (!stats.bottom.empty() && stats.bottom.back().start >= start) {
+      stats.bottom.pop_back();
+    }
+    stats.bottom.push_back(rec);
+    stats.bottom_high_water =
+        std::max(stats.bottom_high_water, (u32)(heap->current - heap->base));
+  }
+}
+
+void record_failed_alloc(Ptr<kheapinfo> heap) {
+  g_heap_stats[heap.offset].failed_allocs++;
+}
+
+/*!
+ * Print a one line map of the heap. # is live bottom memory, = is live top memory, + is the
+ * padding between live allocations, and . is free.
+ */
+void print_heap_map(Ptr<kheapinfo> heap, const HeapStats& stats) {
+  constexpr int kColumns = 100;
+  u32 base = heap->base.offset;
+  u32 heap_size = heap->top_base - heap->base;
+  if (heap_size == 0) {
+    return;
+  }
+
+  // bytes of each kind per column
+  u32 used[kColumns] = {};
+  u32 used_top[kColumns] = {};
+  u32 padding[kColumns] = {};
+  auto add_range = [&](u32* column_bytes, u32 start, u32 end) {
+    start = std::clamp(start, base, base + heap_size) - base;
+    end = std::clamp(end, base, base + heap_size) - base;
+    while (start < end) {
+      u32 col = (u64)start * kColumns / heap_size;
+      while ((u64)(col + 1) * heap_size / kColumns <= start) {
+        col++;  // rounding
+      }
+      u32 col_end = (u64)(col + 1) * heap_size / kColumns;
+      u32 chunk = std::min(end, col_end) - start;
+      column_bytes[col] += chunk;
+      start += chunk;
+    }
+  };
+
+  u32 padding_bytes = 0;
+  u32 prev_end = base;
+  for (auto& rec : stats.bottom) {
+    if (rec.start + rec.size > heap->current.offset) {
+      break;
+    }
+    add_range(padding, prev_end, rec.start);
+    padding_bytes += rec.start - prev_end;
+    add_range(used, rec.start, rec.start + rec.size);
+    prev_end = rec.start + rec.size;
+  }
+  prev_end = heap->top_base.offset;
+  for (auto& rec : stats.top) {
+    if (rec.start < heap->top.offset) {
+      break;
+    }
+    add_range(padding, rec.start + rec.size, prev_end);
+    padding_bytes += prev_end - (rec.start + rec.size);
+    add_range(used_top, rec.start, rec.start + rec.size);
+    prev_end = rec.start;
+  }
+
+  char map[kColumns + 1];
+  for (int i = 0; i < kColumns; i++) {
+    u32 col_size = (u64)(i + 1) * heap_size / kColumns - (u64)i * heap_size / kColumns;
+    if (used[i] + used_top[i] + padding[i] < col_size / 2) {
+      map[i] = '.';
+    } else if (padding[i] > used[i] + used_top[i]) {
+      map[i] = '+';
+    } else {
+      map[i] = used[i] >= used_top[i] ? '#' : '=';
+    }
+  }
+  map[kColumns] = 0;
+  lg::print("  [{}]\n", map);
+  lg::print("  padding between live allocations: {} bytes\n", padding_bytes);
+}
+
+void print_heap_report(u32 heap_addr, const HeapStats& stats) {
+  Ptr<kheapinfo> heap(heap_addr);
+  u32 heap_size = heap->top_base - heap->base;
+  lg::print("kheap #x{:x} [#x{:x} - #x{:x}] {} KB\n", heap_addr, heap->base.offset,
+            heap->top_base.offset, heap_size / 1024);
+  lg::print("  bottom: {} KB used, {} KB high-water\n", (heap->current - heap->base) / 1024,
+            stats.bottom_high_water / 1024);
+  lg::print("  top:    {} KB used, {} KB high-water\n", (heap->top_base - heap->top) / 1024,
+            stats.top_high_water / 1024);
+  if (stats.failed_allocs) {
+    lg::print("  failed allocations: {}\n", stats.failed_allocs);
+  }
+  print_heap_map(heap, stats);
+
+  // live bytes per name, from the allocation records
+  std::unordered_map<const std::string*, u32> live;
+  for (auto& rec : stats.bottom) {
+    if (rec.start + rec.size <= heap->current.offset) {
+      live[rec.name] += rec.size;
+    }
+  }
+  for (auto& rec : stats.top) {
+    if (rec.start >= heap->top.offset) {
+      live[rec.name] += rec.size;
+    }
+  }
+
+  std::vector<std::pair<const std::string*, const NameStats*>> names;
+  for (auto& [name, name_stats] : stats.names) {
+    names.emplace_back(&name, &name_stats);
+  }
+  std::sort(names.begin(), names.end(), [](const auto& a, const auto& b) {
+    return a.second->total_bytes > b.second->total_bytes;
+  });
+  lg::print("  {:<32} {:>10} {:>12} {:>12}\n", "name", "count", "total (KB)", "live (KB)");
+  for (auto& [name, name_stats] : names) {
+    const auto& live_it = live.find(name);
+    lg::print("  {:<32} {:>10} {:>12} {:>12}\n", *name, name_stats->count,
+              name_stats->total_bytes / 1024, live_it == live.end() ? 0 : live_it->second / 1024);
+  }
+}
+}  // namespace
+
+/*!
+ * Print the allocation telemetry for a heap, or for all heaps if heap is 0.
+ * Not in the original game.
+ */
+void kheap_report(u32 heap) {
+  if (!kmalloc_telemetry) {
+    lg::print("kmalloc telemetry is disabled\n");
+    return;
+  }
+  for (auto& [heap_addr, stats] : g_heap_stats) {
+    if (!heap || heap == heap_addr) {
+      print_heap_report(heap_addr, stats);
+    }
+  }
+}
+
 void kmalloc_init_globals_common() {
   // _globalheap and _debugheap
   kglobalheap.offset = GLOBAL_HEAP_INFO_ADDR;
@@ -31,6 +222,7 @@ void kmalloc_init_globals_common() {
     x = 0;
   for (auto& x : MemItemsSize)
     x = 0;
+  g_heap_stats.clear();
 }
 
 /*!
@@ -159,10 +351,16 @@ Ptr<u8> kmalloc(Ptr<kheapinfo> heap, s32 size, u32 flags, char const* name) {
     if (heap->top.offset < memend) {
       kheapstatus(heap);
       Msg(6, "kmalloc: !alloc mem %s (%d bytes) heap %x\n", name, size, heap.offset);
+      if (kmalloc_telemetry) {
+        record_failed_alloc(heap);
+      }
       return Ptr<u8>(0);
     }
 
     heap->current.offset = memend;
+    if (kmalloc_telemetry) {
+      record_alloc(heap, memstart, size, false, name);
+    }
     if (flags & KMALLOC_MEMSET)
       std::memset(Ptr<u8>(memstart).c(), 0, (size_t)size);
     return Ptr<u8>(memstart);
@@ -182,10 +380,16 @@ Ptr<u8> kmalloc(Ptr<kheapinfo> heap, s32 size, u32 flags, char const* name) {
     if (heap->current.offset >= memstart) {
       Msg(6, "kmalloc: !alloc mem from top %s (%d bytes) heap %x\n", name, size, heap.offset);
       kheapstatus(heap);
+      if (kmalloc_telemetry) {
+        record_failed_alloc(heap);
+      }
       return Ptr<u8>(0);
     }
 
     heap->top.offset = memstart;
+    if (kmalloc_telemetry) {
+      record_alloc(heap, memstart, size, true, name);
+    }
 
     if (flags & KMALLOC_MEMSET)
       std::memset(Ptr<u8>(memstart).c(), 0, (size_t)size);
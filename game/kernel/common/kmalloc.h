@@ -26,6 +26,10 @@ constexpr u32 KMALLOC_ALIGN_256 = 0x100;
 constexpr u32 KMALLOC_ALIGN_64 = 0x40;
 constexpr u32 KMALLOC_ALIGN_16 = 0x10;
 
+// PC-only per-heap allocation accounting, printed with kheap_report. Set to false to compile it
+// out of kmalloc.
+constexpr bool kmalloc_telemetry = true;
+
 void kmalloc_init_globals_common();
 
 Ptr<u8> ksmalloc(Ptr<kheapinfo> heap, s32 size, u32 flags, char const* name);
@@ -33,4 +37,5 @@ Ptr<kheapinfo> kheapstatus(Ptr<kheapinfo> heap);
 Ptr<kheapinfo> kinitheap(Ptr<kheapinfo> heap, Ptr<u8> mem, s32 size);
 u32 kheapused(Ptr<kheapinfo> heap);
 Ptr<u8> kmalloc(Ptr<kheapinfo> heap, s32 size, u32 flags, char const* name);
-void kfree(Ptr<u8> a);
\ No newline at end of file
+void kfree(Ptr<u8> a);
+void kheap_report(u32 heap);
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <cstring>
 
 #include "common/util/Assert.h"
+#include "common/util/BackgroundFileWriter.h"
 #include "common/util/FileUtil.h"
 #include "common/util/Timer.h"
 
@@ -156,6 +157,10 @@ u32 mc_checksum(Ptr<u8> data, s32 size) {
  */
 bool file_is_present(int id, int bank = 0) {
   auto bankname = mc_get_filename(g_game_version, 4 + id * 2 + bank);
+  // saves are written in the background, the newest one might not be in the file yet.
+  if (auto pending = background_file_writer().pending(bankname)) {
+    return (int)pending->size() >= mc_get_total_bank_size(g_game_version);
+  }
   if (!fs::exists(bankname) ||
       int(fs::file_size(bankname)) < mc_get_total_bank_size(g_game_version)) {
     // file doesn't exist, or size is bad. we do not want to open files that will crash on read!
@@ -179,6 +184,16 @@ bool file_is_present(int id, int bank = 0) {
   */
 }
 
+/*!
+ * PC port function to read a bank, including one that is still being written.
+ */
+std::vector<u8> read_bank(const fs::path& bankname) {
+  if (auto pending = background_file_writer().pending(bankname)) {
+    return *pending;
+  }
+  return file_util::read_binary_file(bankname.string());
+}
+
 /*!
  * PC port function to set memcard info. We don't use a memory card, instead just the raw savefiles.
  */
@@ -189,11 +204,11 @@ void pc_update_card() {
     auto bankname = mc_get_filename(g_game_version, 4 + file * 2);
     mc_files[file].present = file_is_present(file);
     if (mc_files[file].present) {
-      auto bankdata = file_util::read_binary_file(bankname.string());
+      auto bankdata = read_bank(bankname);
       auto header1 = reinterpret_cast<McHeader*>(bankdata.data());
       if (file_is_present(file, 1)) {
         auto bankname2 = mc_get_filename(g_game_version, 1 + 4 + file * 2);
-        auto bankdata2 = file_util::read_binary_file(bankname2.string());
+        auto bankdata2 = read_bank(bankname2);
         auto header2 = reinterpret_cast<McHeader*>(bankdata2.data());
 
         if (header2->save_count > header1->save_count) {
@@ -223,7 +238,9 @@ void pc_update_card() {
 }
 
 /*!
- * PC port function to save a file. This does the whole saving at once, synchronously.
+ * PC port function to save a file. This does the whole saving at once, but the file is written in
+ * the background so slow storage doesn't cause a hitch. The other bank of the file is left alone
+ * until the next save, so a failed write still leaves the previous save.
  */
 void pc_game_save_synch() {
   Timer mc_timer;
@@ -252,62 +269,30 @@ void pc_game_save_synch() {
   // 4 is the first bank file
   mc_print("open {} for saving", mc_get_filename_no_dir(g_game_version, op.param2 * 2 + 4 + p4));
   auto save_path = mc_get_filename(g_game_version, op.param2 * 2 + 4 + p4);
-  file_util::create_dir_if_needed_for_file(save_path.string());
-  auto fd = file_util::open_file(save_path.string().c_str(), "wb");
-  mc_print("synchronous save file open took {:.2f}ms\n", mc_timer.getMs());
-  if (fd) {
-    // cb_openedsave //
-    mc_print("save file opened, writing header...");
-    memset(&header, 0, sizeof(McHeader));
-    header.save_count = p2;
-    header.checksum = mc_checksum(op.data_ptr, BANK_SIZE[g_game_version]);
-    header.magic = MEM_CARD_MAGIC;
-    header.save_count2 = p2;
-    memcpy(header.preview_data, op.data_ptr2.c(), 64);
-    if (fwrite(&header, sizeof(McHeader), 1, fd) == 1) {
-      // cb_savedheader //
-      mc_print("save file writing main data");
-      if (fwrite(op.data_ptr.c(), BANK_SIZE[g_game_version], 1, fd) == 1) {
-        // cb_saveddata //
-        mc_print("save file writing footer");
-        if (fwrite(&header, sizeof(McHeader), 1, fd) == 1) {
-          // cb_savedfooter //
-          if (fclose(fd) == 0) {
-            // cb_closedsave //
-            mc_print("All done with saving!!");
-            op.operation = MemoryCardOperationKind::NO_OP;
-            op.result = McStatusCode::OK;
-            mc_files[op.param2].present = 1;
-            mc_files[op.param2].most_recent_save_count = p2;
-            mc_files[op.param2].last_saved_bank = p4;
-            memcpy(mc_files[op.param2].data, op.data_ptr2.c(), 64);
-            mc_last_file = op.param2;
-          } else {
-            op.operation = MemoryCardOperationKind::NO_OP;
-            op.result = McStatusCode::INTERNAL_ERROR;
-          }
-        } else {
-          fclose(fd);
-          op.operation = MemoryCardOperationKind::NO_OP;
-          op.result = McStatusCode::INTERNAL_ERROR;
-        }
-      } else {
-        fclose(fd);
-        op.operation = MemoryCardOperationKind::NO_OP;
-        op.result = McStatusCode::INTERNAL_ERROR;
-      }
-    } else {
-      fclose(fd);
-      op.operation = MemoryCardOperationKind::NO_OP;
-      op.result = McStatusCode::INTERNAL_ERROR;
-    }
-  } else {
-    fmt::print("[MC] Error opening file, errno - {}", errno);
-    op.operation = MemoryCardOperationKind::NO_OP;
-    op.result = McStatusCode::INTERNAL_ERROR;
-  }
 
-  mc_print("[MC] synchronous save took {:.2f}ms\n", mc_timer.getMs());
+  // header | data | footer (a copy of the header)
+  memset(&header, 0, sizeof(McHeader));
+  header.save_count = p2;
+  header.checksum = mc_checksum(op.data_ptr, BANK_SIZE[g_game_version]);
+  header.magic = MEM_CARD_MAGIC;
+  header.save_count2 = p2;
+  memcpy(header.preview_data, op.data_ptr2.c(), 64);
+  std::vector<u8> bank(mc_get_total_bank_size(g_game_version));
+  memcpy(bank.data(), &header, sizeof(McHeader));
+  memcpy(bank.data() + sizeof(McHeader), op.data_ptr.c(), BANK_SIZE[g_game_version]);
+  memcpy(bank.data() + sizeof(McHeader) + BANK_SIZE[g_game_version], &header, sizeof(McHeader));
+  background_file_writer().write(save_path, std::move(bank));
+
+  mc_print("All done with saving!!");
+  op.operation = MemoryCardOperationKind::NO_OP;
+  op.result = McStatusCode::OK;
+  mc_files[op.param2].present = 1;
+  mc_files[op.param2].most_recent_save_count = p2;
+  mc_files[op.param2].last_saved_bank = p4;
+  memcpy(mc_files[op.param2].data, op.data_ptr2.c(), 64);
+  mc_last_file = op.param2;
+
+  mc_print("[MC] save took {:.2f}ms\n", mc_timer.getMs());
 }
 
 void pc_game_load_open_file(FILE* fd) {
@@ -439,6 +424,8 @@ void pc_game_load_open_file(FILE* fd) {
 void pc_game_load_synch() {
   Timer mc_timer;
   mc_timer.start();
+  // loading reads the files directly, wait for any save that's still being written.
+  background_file_writer().flush();
   pc_update_card();
 
   // cb_reprobe_load //
@@ -0,0 +1,127 @@
+#include "ksavestate.h"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "common/goal_constants.h"
+#include "common/log/log.h"
+#include "common/util/Timer.h"
+#include "common/util/compress.h"
+
+#include "game/graphics/gfx.h"
+#include "game/kernel/common/kdgo.h"
+#include "game/kernel/common/klink.h"
+#include "game/kernel/common/kmachine.h"
+#include "game/kernel/common/kprint.h"
+#include "game/kernel/common/kscheme.h"
+#include "game/runtime.h"
+
+namespace {
+
+struct SaveState {
+  std::vector<u8> memory;  // main memory, from compress_zstd_seekable
+  std::vector<std::function<void()>> restore_globals;
+};
+
+std::vector<SaveStateFunc> g_state_funcs;
+std::array<std::unique_ptr<SaveState>, SAVESTATE_SLOT_COUNT> g_slots;
+
+// the requested slot times two, plus one for a restore. -1 if there's no request.
+std::atomic<int> g_request = -1;
+bool g_logged_wait = false;
+
+void save(int slot) {
+  Timer timer;
+  auto state = std::make_unique<SaveState>();
+  state->memory = compression::compress_zstd_seekable(g_ee_main_mem, EE_MAIN_MEM_SIZE);
+  for (auto& func : g_state_funcs) {
+    state->restore_globals.push_back(func());
+  }
+  lg::info("[savestate] saved slot {} ({:.1f} MB compressed) in {:.1f} ms", slot,
+           state->memory.size() / (1024.f * 1024.f), timer.getMs());
+  g_slots[slot] = std::move(state);
+}
+
+void restore(int slot) {
+  const auto* state = g_slots[slot].get();
+  if (!state) {
+    lg::error("[savestate] can't restore slot {}, nothing was saved there", slot);
+    return;
+  }
+  Timer timer;
+  // the renderer reads DMA data and textures from main memory, so let it finish first.
+  Gfx::flush();
+  compression::ZstdSeekableReader reader(state->memory.data(), state->memory.size());
+  reader.read(0, g_ee_main_mem, EE_MAIN_MEM_SIZE);
+  for (auto& restore_global : state->restore_globals) {
+    restore_global();
+  }
+  lg::info("[savestate] restored slot {} in {:.1f} ms", slot, timer.getMs());
+}
+
+void request(u32 slot, bool is_restore) {
+  if (slot >= SAVESTATE_SLOT_COUNT) {
+    lg::error("[savestate] invalid slot {}, there are {}", slot, SAVESTATE_SLOT_COUNT);
+    return;
+  }
+  g_request = slot * 2 + (is_restore ? 1 : 0);
+}
+
+}  // namespace
+
+void ksavestate_init_globals() {
+  g_state_funcs.clear();
+  for (auto& slot : g_slots) {
+    slot.reset();
+  }
+  g_request = -1;
+  g_logged_wait = false;
+
+  // common kernel globals that change while the game runs.
+  savestate_add_global(&NumSymbols);
+  savestate_add_global(&LastSymbol);
+  savestate_add_global(&MessCount);
+  savestate_add_global(&sMsgNum);
+  savestate_add_global(&saved_link_control);
+  savestate_add_global(&extra_random_generator);
+}
+
+void savestate_add(SaveStateFunc func) {
+  g_state_funcs.push_back(std::move(func));
+}
+
+void savestate_request_save(u32 slot) {
+  request(slot, false);
+}
+
+void savestate_request_restore(u32 slot) {
+  request(slot, true);
+}
+
+void savestate_run_pending() {
+  int req = g_request;
+  if (req < 0) {
+    return;
+  }
+
+  // the IOP writes RPC results and loaded data into main memory, and a link in progress has state
+  // in the kernel, so wait until neither is running.
+  if (AnyRpcBusy() || saved_link_control.m_busy) {
+    if (!g_logged_wait) {
+      lg::info("[savestate] waiting for the IOP and linker to be idle");
+      g_logged_wait = true;
+    }
+    return;
+  }
+
+  if (!g_request.compare_exchange_strong(req, -1)) {
+    return;  // there's a new request, do that one next time.
+  }
+  g_logged_wait = false;
+  if (req & 1) {
+    restore(req / 2);
+  } else {
+    save(req / 2);
+  }
+}
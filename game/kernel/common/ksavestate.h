@@ -0,0 +1,51 @@
+#pragma once
+
+/*!
+ * @file ksavestate.h
+ * Savestates, to run a test from the same point many times without booting and playing in again.
+ *
+ * A savestate is all of EE main memory (zstd compressed), plus the C++ kernel globals that change
+ * while the game runs. It's taken between kernel dispatches, when no GOAL code is running, and only
+ * while no IOP RPC or link is in progress, so nothing in flight refers to the saved memory.
+ *
+ * Savestates only work in the same run of the game: main memory has host addresses in it (the
+ * trampolines to C++ kernel functions). The IOP, sound and renderer aren't saved. They follow the
+ * game's memory again after a restore, as long as the same levels are loaded as when it was saved.
+ */
+
+#include <functional>
+#include <memory>
+
+#include "common/common_types.h"
+
+constexpr int SAVESTATE_SLOT_COUNT = 8;
+
+// Saves a copy of some state, and returns a function that puts the copy back.
+using SaveStateFunc = std::function<std::function<void()>()>;
+
+void ksavestate_init_globals();
+
+/*!
+ * Save and restore some state with main memory. The kernels add their globals in InitMachine.
+ */
+void savestate_add(SaveStateFunc func);
+
+template <typename T>
+void savestate_add_global(T* global) {
+  savestate_add([global]() {
+    auto copy = std::make_shared<T>(*global);
+    return [global, copy]() { *global = *copy; };
+  });
+}
+
+/*!
+ * Ask to save or restore a slot. It's done after the current kernel dispatch, or on a later one if
+ * the IOP or linker is busy then.
+ */
+void savestate_request_save(u32 slot);
+void savestate_request_restore(u32 slot);
+
+/*!
+ * Do the requested save or restore. Called by KernelCheckAndDispatch between dispatches.
+ */
+void savestate_run_pending();
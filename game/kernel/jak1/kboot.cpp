@@ -19,6 +19,7 @@
 #include "game/common/game_common_types.h"
 #include "game/kernel/common/klisten.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/jak1/klisten.h"
@@ -151,6 +152,8 @@ void KernelCheckAndDispatch() {
       SendAck();
     }
 
+    savestate_run_pending();
+
     if (time_ms < 4) {
       std::this_thread::sleep_for(std::chrono::microseconds(1000));
     }
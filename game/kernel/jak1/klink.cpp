@@ -567,6 +567,7 @@ void link_control::jak1_finish(bool jump_from_c_to_goal) {
   FastLink = 0;  // nested fast links won't work right.
   m_heap->top = m_heap_top;
   DebugSegment = old_debug_segment;
+  m_busy = false;
 }
 
 namespace jak1 {
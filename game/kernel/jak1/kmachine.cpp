@@ -28,6 +28,7 @@
 #include "game/kernel/common/kmachine.h"
 #include "game/kernel/common/kmalloc.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/common/ksound.h"
@@ -321,6 +322,12 @@ int InitMachine() {
     kdebugheap.offset = 0;
   }
 
+  // kernel globals for savestates, in addition to the common ones.
+  savestate_add_global(&sLastMsg);
+  for (auto& msg : sMsg) {
+    savestate_add_global(&msg);
+  }
+
   init_output();    // GOAL input/output buffer setup
   jak1::InitIOP();  // start IOP/OVERLORD, loading our legal splash screen
 
@@ -14,6 +14,7 @@
 #include "game/kernel/common/Symbol4.h"
 #include "game/kernel/common/klisten.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/jak2/klisten.h"
@@ -154,6 +155,7 @@ void KernelShutdown(u32 reason) {
 void KernelCheckAndDispatch() {
   while (MasterExit == RuntimeExitStatus::RUNNING) {
     KernelDispatch(kernel_dispatcher->value());
+    savestate_run_pending();
   }
 }
 
@@ -1,5 +1,12 @@
 #include "kdgo.h"
 
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "common/global_profiler/GlobalProfiler.h"
 #include "common/link_types.h"
 #include "common/log/log.h"
@@ -23,6 +30,74 @@ void kdgo_init_globals() {
   memset(sMsg, 0, sizeof(sMsg));
 }
 
+namespace {
+/*!
+ * Reads a whole file on a separate thread. Reads from the front of the file can be used while the
+ * rest is still loading, so the disk is busy while the caller links.
+ */
+class ReadAheadFile {
+ public:
+  ReadAheadFile(FILE* fp, size_t size) : m_fp(fp), m_data(size) {
+    m_thread = std::thread([this]() { read_loop(); });
+  }
+  ReadAheadFile(const ReadAheadFile&) = delete;
+  ReadAheadFile& operator=(const ReadAheadFile&) = delete;
+  ~ReadAheadFile() { m_thread.join(); }
+
+  /*!
+   * Copy the next size bytes of the file to dest, waiting for them to be read if needed. Returns
+   * false if the file ends first.
+   */
+  bool read(void* dest, size_t size) {
+    {
+      std::unique_lock<std::mutex> lk(m_mutex);
+      m_cv.wait(lk, [&]() { return m_bytes_read >= m_pos + size || m_done; });
+      if (m_bytes_read < m_pos + size) {
+        return false;
+      }
+    }
+    memcpy(dest, m_data.data() + m_pos, size);
+    m_pos += size;
+    return true;
+  }
+
+ private:
+  void read_loop() {
+    // small enough that linking can start soon after the first object arrives.
+    constexpr size_t kChunkSize = 1024 * 1024;
+    size_t done = 0;
+    while (done < m_data.size()) {
+      size_t n = fread(m_data.data() + done, 1, std::min(kChunkSize, m_data.size() - done), m_fp);
+      if (n == 0) {
+        break;
+      }
+      done += n;
+      {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_bytes_read = done;
+      }
+      m_cv.notify_one();
+    }
+    {
+      std::lock_guard<std::mutex> lk(m_mutex);
+      m_done = true;
+    }
+    m_cv.notify_one();
+  }
+
+  FILE* m_fp = nullptr;
+  std::vector<u8> m_data;
+  // only used by the caller of read
+  size_t m_pos = 0;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  size_t m_bytes_read = 0;
+  bool m_done = false;
+  std::thread m_thread;
+};
+}  // namespace
+
 /*!
  * Send message to IOP to start loading a new DGO file
  * Uses a double-buffered message buffer
@@ -160,22 +235,27 @@ void load_and_link_dgo_from_c_fast(const char* name,
   auto old_heap_top = heap->top;
   auto buffer1 = kmalloc(heap, bufferSize, KMALLOC_TOP | KMALLOC_ALIGN_64, "dgo-buffer-1");
 
+  // the rest of the file is read in the background while objects are linked. Objects are still
+  // copied to the same places in the heap as they would be if read directly.
+  std::optional<ReadAheadFile> file;
+  file.emplace(fp, fs::file_size(file_path));
+
   // read the header
   DgoHeader header;
-  if (fread(&header, sizeof(DgoHeader), 1, fp) != 1) {
+  if (!file->read(&header, sizeof(DgoHeader))) {
     lg::die("failed to read dgo header");
   }
   lg::info("got {} objects, name {}\n", header.object_count, header.name);
 
   // load all but the final
   for (int i = 0; i < (int)header.object_count - 1; i++) {
-    if (fread(buffer1.c(), sizeof(ObjectHeader), 1, fp) != 1) {
+    if (!file->read(buffer1.c(), sizeof(ObjectHeader))) {
       lg::die("failed to read object header");
     }
     auto* obj_header = (ObjectHeader*)buffer1.c();
     u32 aligned_size = align16(obj_header->size);
     auto* obj_dest = buffer1.c() + sizeof(ObjectHeader);
-    if (fread(obj_dest, aligned_size, 1, fp) != 1) {
+    if (!file->read(obj_dest, aligned_size)) {
       lg::die("Failed to read object data");
     }
     link_and_exec(buffer1 + sizeof(ObjectHeader), obj_header->name, obj_header->size, heap,
@@ -183,19 +263,20 @@ void load_and_link_dgo_from_c_fast(const char* name,
   }
 
   auto final_object_dest = Ptr<u8>((heap->current + 0x3f).offset & 0xffffffc0);
-  if (fread(final_object_dest.c(), sizeof(ObjectHeader), 1, fp) != 1) {
+  if (!file->read(final_object_dest.c(), sizeof(ObjectHeader))) {
     lg::die("failed to read final object header");
   }
   auto* obj_header = (ObjectHeader*)final_object_dest.c();
   u32 aligned_size = align16(obj_header->size);
   auto* obj_dest = (final_object_dest + sizeof(ObjectHeader)).c();
-  if (fread(obj_dest, aligned_size, 1, fp) != 1) {
+  if (!file->read(obj_dest, aligned_size)) {
     lg::die("Failed to read object data");
   }
   link_and_exec(final_object_dest + sizeof(ObjectHeader), obj_header->name, obj_header->size, heap,
                 linkFlag, true);
 
   heap->top = old_heap_top;
+  file.reset();
   fclose(fp);
   lg::info("load_and_link_dgo_from_c_fast took {:.3f} s\n", timer.getSeconds());
 }
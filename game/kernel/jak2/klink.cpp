@@ -1,5 +1,10 @@
 #include "klink.h"
 
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "common/goal_constants.h"
 #include "common/log/log.h"
 #include "common/symbols.h"
@@ -17,6 +22,39 @@
 
 static constexpr bool link_debug_printfs = false;
 
+namespace jak2 {
+bool LinkImageCacheEnabled = false;
+}
+
+namespace {
+/*!
+ * PC-only cache of v2/v4 object images after pointer relocation, enabled with -link-cache.
+ * The relocated image only depends on the object data and the address it was linked to, so when
+ * the same object is loaded into the same place again (a level going back into the same level
+ * heap), the image can be copied in and the offset table skipped. The symbol and type links are
+ * still done normally, as those addresses can change.
+ * Entries are checked against the link block, which holds the relocation and symbol tables. This
+ * assumes the object files on disk don't change while the game is running.
+ */
+struct LinkImageCacheEntry {
+  u32 link_block_crc = 0;
+  u32 symbol_table_offset = 0;  // from m_link_block_ptr
+  std::vector<u8> image;
+};
+
+std::unordered_map<std::string, LinkImageCacheEntry> g_link_image_cache;
+size_t g_link_image_cache_bytes = 0;
+constexpr size_t LINK_IMAGE_CACHE_MAX_BYTES = 256 * 1024 * 1024;
+}  // namespace
+
+namespace jak2 {
+void klink_init_globals() {
+  LinkImageCacheEnabled = false;
+  g_link_image_cache.clear();
+  g_link_image_cache_bytes = 0;
+}
+}  // namespace jak2
+
 /*!
  * Make progress on linking.
  */
@@ -89,12 +127,27 @@ uint32_t cross_seg_dist_link_v3(Ptr<uint8_t> link,
   return 1 + 3 * 4;
 }
 
-uint32_t ptr_link_v3(Ptr<u8> link, ObjectFileHeader* ofh, int current_seg) {
-  auto* link_data = link.cast<u32>().c();
-  u32 patch_loc = link_data[0] + ofh->code_infos[current_seg].offset;
-  u32 patch_value = link_data[1] + ofh->code_infos[current_seg].offset;
-  *Ptr<u32>(patch_loc).c() = patch_value;
-  return 8;
+/*!
+ * Link a run of consecutive LINK_PTR records. Code objects have a lot of these back-to-back, so
+ * this does them all in one go instead of going through the dispatch loop for each one.
+ * Returns the number of bytes used, including the LINK_PTR kind bytes between records.
+ */
+uint32_t ptr_link_run_v3(Ptr<u8> link, ObjectFileHeader* ofh, int current_seg) {
+  const u8* lp = link.c();
+  const u32 seg_offset = ofh->code_infos[current_seg].offset;
+  u8* mem = g_ee_main_mem;
+  uint32_t seek = 0;
+  for (;;) {
+    u32 link_data[2];
+    memcpy(link_data, lp + seek, 8);
+    seek += 8;
+    u32 patch_value = link_data[1] + seg_offset;
+    memcpy(mem + link_data[0] + seg_offset, &patch_value, 4);
+    if (lp[seek] != LINK_PTR) {
+      return seek;
+    }
+    seek++;
+  }
 }
 
 /*!
@@ -102,15 +155,10 @@ uint32_t ptr_link_v3(Ptr<u8> link, ObjectFileHeader* ofh, int current_seg) {
  * Returns a pointer to the link table data after the typelinking data.
  */
 uint32_t typelink_v3(Ptr<uint8_t> link, Ptr<uint8_t> data) {
-  // get the name of the type
-  uint32_t seek = 0;
-  char sym_name[256];
-  while (link.c()[seek]) {
-    sym_name[seek] = link.c()[seek];
-    seek++;
-    ASSERT(seek < 256);
-  }
-  sym_name[seek] = 0;
+  // get the name of the type. It's null terminated in the link table, so it can be used in place.
+  const char* sym_name = (const char*)link.c();
+  uint32_t seek = strlen(sym_name);
+  ASSERT(seek < 256);
   seek++;
 
   // determine the number of methods
@@ -125,33 +173,31 @@ uint32_t typelink_v3(Ptr<uint8_t> link, Ptr<uint8_t> data) {
   auto type_ptr = jak2::intern_type_from_c(sym_name, method_count);
 
   // prepare to read the locations of the type pointers
-  Ptr<uint32_t> offsets = link.cast<uint32_t>() + seek;
-  uint32_t offset_count = *offsets;
-  offsets = offsets + 4;
-  seek += 4;
+  const u8* offsets = link.c() + seek;
+  uint32_t offset_count;
+  memcpy(&offset_count, offsets, 4);
+  offsets += 4;
 
   // write the type pointers into memory
+  u8* base = data.c();
+  const s32 value = type_ptr.offset;
   for (uint32_t i = 0; i < offset_count; i++) {
-    *(data + offsets.c()[i]).cast<int32_t>() = type_ptr.offset;
-    seek += 4;
+    u32 offset;
+    memcpy(&offset, offsets + 4 * i, 4);
+    memcpy(base + offset, &value, 4);
   }
 
-  return seek;
+  return seek + 4 + 4 * offset_count;
 }
 /*!
  * Link symbols (both offsets and pointers) in "v3 equivalent" link data.
  * Returns a pointer to the link table data after the linking data for this symbol.
  */
 uint32_t symlink_v3(Ptr<uint8_t> link, Ptr<uint8_t> data) {
-  // get the symbol name
-  uint32_t seek = 0;
-  char sym_name[256];
-  while (link.c()[seek]) {
-    sym_name[seek] = link.c()[seek];
-    seek++;
-    ASSERT(seek < 256);
-  }
-  sym_name[seek] = 0;
+  // get the symbol name. It's null terminated in the link table, so it can be used in place.
+  const char* sym_name = (const char*)link.c();
+  uint32_t seek = strlen(sym_name);
+  ASSERT(seek < 256);
   seek++;
 
   // intern
@@ -160,28 +206,33 @@ uint32_t symlink_v3(Ptr<uint8_t> link, Ptr<uint8_t> data) {
   uint32_t sym_addr = sym.cast<u32>().offset;
 
   // prepare to read locations of symbol links
-  Ptr<uint32_t> offsets = link.cast<uint32_t>() + seek;
-  uint32_t offset_count = *offsets;
-  offsets = offsets + 4;
-  seek += 4;
+  const u8* offsets = link.c() + seek;
+  uint32_t offset_count;
+  memcpy(&offset_count, offsets, 4);
+  offsets += 4;
 
+  u8* base = data.c();
   for (uint32_t i = 0; i < offset_count; i++) {
-    uint32_t offset = offsets.c()[i];
-    seek += 4;
-    auto data_ptr = (data + offset).cast<int32_t>();
-
-    if (*data_ptr == -1) {
+    u32 offset;
+    memcpy(&offset, offsets + 4 * i, 4);
+    u8* patch = base + offset;
+    s32 old_value;
+    memcpy(&old_value, patch, 4);
+
+    s32 value;
+    if (old_value == -1) {
       // a "-1" indicates that we should store the address.
-      *(data + offset).cast<int32_t>() = sym_addr;
-    } else if (*(data_ptr.cast<u32>()) == LINK_SYM_NO_OFFSET_FLAG) {
-      *(data + offset).cast<int32_t>() = sym_offset - 1;
+      value = sym_addr;
+    } else if ((u32)old_value == LINK_SYM_NO_OFFSET_FLAG) {
+      value = sym_offset - 1;
     } else {
       // otherwise store the offset to st.
-      *(data + offset).cast<int32_t>() = sym_offset;
+      value = sym_offset;
     }
+    memcpy(patch, &value, 4);
   }
 
-  return seek;
+  return seek + 4 + 4 * offset_count;
 }
 }  // namespace
 
@@ -292,7 +343,7 @@ uint32_t link_control::jak2_work_v3() {
               break;
             case LINK_PTR:
               lp = lp + 1;
-              lp = lp + ptr_link_v3(lp, ofh, m_segment_process);
+              lp = lp + ptr_link_run_v3(lp, ofh, m_segment_process);
               break;
             default:
               ASSERT_MSG(false, fmt::format("unknown link table thing {}", *lp));
@@ -400,13 +451,33 @@ uint32_t link_control::jak2_work_v2() {
   }
 
   // init offset phase
+  std::string cache_key;
+  u32 link_block_crc = 0;
   if (m_state == LINK_V2_STATE_OFFSETS && m_segment_process == 0) {
     m_reloc_ptr = m_link_block_ptr + 8;  // seek to link table
     if (*m_reloc_ptr == 0) {             // do we have pointer links to do?
       m_reloc_ptr.offset++;              // if not, seek past the \0, and go to next state
       m_state = LINK_V2_STATE_SYMBOL_TABLE;
       m_segment_process = 0;
-    } else {
+    } else if (jak2::LinkImageCacheEnabled) {
+      // the size includes the type tag before m_link_block_ptr, which is set during linking.
+      u32 link_block_size = *m_link_block_ptr.cast<u32>();
+      link_block_crc = crc32(m_link_block_ptr.c(), (s32)link_block_size - 4);
+      cache_key = fmt::format("{}@{:x}+{:x}", m_object_name, m_object_data.offset, m_code_size);
+      const auto& it = g_link_image_cache.find(cache_key);
+      if (it != g_link_image_cache.end() && it->second.link_block_crc == link_block_crc) {
+        if (link_debug_printfs) {
+          printf("[work_v2] link cache hit: %s\n", cache_key.c_str());
+        }
+        memcpy(m_object_data.c(), it->second.image.data(), m_code_size);
+        m_reloc_ptr = m_link_block_ptr + it->second.symbol_table_offset;
+        m_state = LINK_V2_STATE_SYMBOL_TABLE;
+        m_segment_process = 0;
+        cache_key.clear();
+      }
+    }
+
+    if (m_state == LINK_V2_STATE_OFFSETS) {
       m_base_ptr = m_object_data;  // base address for offsetting.
       m_loc_ptr = m_object_data;   // pointer which seeks thru the code
       m_table_toggle = 0;          // are we seeking or fixing?
@@ -474,6 +545,16 @@ uint32_t link_control::jak2_work_v2() {
     m_reloc_ptr.offset++;
     m_state = 2;
     m_segment_process = 0;
+
+    if (!cache_key.empty() &&
+        g_link_image_cache_bytes + m_code_size <= LINK_IMAGE_CACHE_MAX_BYTES) {
+      auto& entry = g_link_image_cache[cache_key];
+      g_link_image_cache_bytes -= entry.image.size();
+      entry.link_block_crc = link_block_crc;
+      entry.symbol_table_offset = m_reloc_ptr.offset - m_link_block_ptr.offset;
+      entry.image.assign(m_object_data.c(), m_object_data.c() + m_code_size);
+      g_link_image_cache_bytes += m_code_size;
+    }
   }
 
   if (m_state == 2) {  // GOAL object fixup
@@ -6,6 +6,8 @@
 #include "game/kernel/common/kmalloc.h"
 
 namespace jak2 {
+extern bool LinkImageCacheEnabled;
+void klink_init_globals();
 void ultimate_memcpy(void* dst, void* src, uint32_t size);
 Ptr<uint8_t> link_and_exec(Ptr<uint8_t> data,
                            const char* name,
@@ -129,6 +129,58 @@ struct SQLResult {
   Ptr<String> data[1];
 };
 
+namespace {
+/*!
+ * Make a sql-result on the debug heap with the values of all rows, and store it in *sql-result*.
+ */
+u32 make_sql_result(const sqlite::GenericResponse& result) {
+  auto sym = find_symbol_from_c("sql-result");
+  if (!sym.offset) {
+    return s7.offset;
+  }
+  // TODO - can their sql-result type not return multiple rows and the data is just the columns?
+  // or do they make assumptions and iterate the data like a 2d flattened array
+  //
+  // Collect string results
+  std::vector<std::string> results;
+  for (const auto& row : result.rows) {
+    for (const auto& val : row) {
+      lg::debug("[SQL] Result \"{}\"", val.data());
+      results.push_back(val.data());
+    }
+  }
+
+  // Make the GOAL type to hold them
+  Ptr<Type> type = Ptr<Type>(sym->value());
+  auto new_result_ptr = call_method_of_type_arg2(intern_from_c("debug").offset, type,
+                                                 GOAL_NEW_METHOD, type.offset, results.size());
+  SQLResult* new_result = Ptr<SQLResult>(new_result_ptr).c();
+  for (int i = 0; i < (int)results.size(); i++) {
+    new_result->data[i] = Ptr<String>(make_debug_string_from_c(results.at(i).data()));
+  }
+  new_result->len = results.size();
+
+  // TODO - possible values here (when to set them?)
+  // 'error = the default, fairly obvious
+  // 'select = the result of a select
+  new_result->error = intern_from_c("select").offset;
+
+  // Store the result in the convienant debugging global (stores last query resp)
+  SqlResult->value() = new_result_ptr;
+  return new_result_ptr;
+}
+
+std::string prepare_sql_query(Ptr<String> string_in) {
+  std::string query_str = string_in->data();
+  str_util::replace(query_str, "LAST_INSERT_ID()", "last_insert_rowid()");
+  lg::debug("[SQL] Query '{}'", query_str);
+
+  // ensure the DB is initialized
+  initialize_sql_db();
+  return query_str;
+}
+}  // namespace
+
 int sql_query_sync(Ptr<String> string_in) {
   if (!MasterDebug) {
     // not debugging, no sql results.
@@ -144,12 +196,7 @@ int sql_query_sync(Ptr<String> string_in) {
       SendAck();
     */
 
-    std::string query_str = string_in->data();
-    str_util::replace(query_str, "LAST_INSERT_ID()", "last_insert_rowid()");
-    lg::debug("[SQL] Query '{}'", query_str);
-
-    // ensure the DB is initialized
-    initialize_sql_db();
+    const auto query_str = prepare_sql_query(string_in);
 
     // clear global
     SqlResult->value() = s7.offset;
@@ -159,43 +206,9 @@ int sql_query_sync(Ptr<String> string_in) {
     const auto& result = run_sql_query(query_str);
     // TODO - check for errors
 
-    auto sym = find_symbol_from_c("sql-result");
-    if (sym.offset) {
-      // TODO - can their sql-result type not return multiple rows and the data is just the columns?
-      // or do they make assumptions and iterate the data like a 2d flattened array
-      //
-      // Collect string results
-      std::vector<std::string> results;
-      for (const auto& row : result.rows) {
-        for (const auto& val : row) {
-          lg::debug("[SQL] Result \"{}\"", val.data());
-          results.push_back(val.data());
-        }
-      }
-
-      // Make the GOAL type to hold them
-      Ptr<Type> type = Ptr<Type>(sym->value());
-      auto new_result_ptr = call_method_of_type_arg2(intern_from_c("debug").offset, type,
-                                                     GOAL_NEW_METHOD, type.offset, results.size());
-      SQLResult* new_result = Ptr<SQLResult>(new_result_ptr).c();
-      for (int i = 0; i < (int)results.size(); i++) {
-        new_result->data[i] = Ptr<String>(make_debug_string_from_c(results.at(i).data()));
-      }
-      new_result->len = results.size();
-
-      // TODO - possible values here (when to set them?)
-      // 'error = the default, fairly obvious
-      // 'select = the result of a select
-      new_result->error = intern_from_c("select").offset;
-
-      kdebugheap->top.offset += 0x4000;
-
-      // Store the result in the convienant debugging global (stores last query resp)
-      SqlResult->value() = new_result_ptr;
-      return new_result_ptr;
-    }
-
-    return s7.offset;
+    const auto new_result_ptr = make_sql_result(result);
+    kdebugheap->top.offset += 0x4000;
+    return new_result_ptr;
 
     /* Original code, disabled
       // didn't we just set these to false?
@@ -218,4 +231,31 @@ int sql_query_sync(Ptr<String> string_in) {
   }
 }
 
+/*!
+ * PC port: start a query on the SQL worker thread, so the game doesn't wait for it. Returns the id
+ * to give to pc-sql-query-poll. Queries run in order, after any started before.
+ */
+u32 pc_sql_query_async(u32 string_in) {
+  if (!MasterDebug) {
+    return 0;
+  }
+  return sql_async_queries.submit(prepare_sql_query(Ptr<String>(string_in)));
+}
+
+/*!
+ * PC port: the sql-result of a query from pc-sql-query-async, or #f if it's still running.
+ * Each result can only be polled once.
+ */
+u32 pc_sql_query_poll(u32 id) {
+  if (!MasterDebug || id == 0) {
+    // not debugging, no sql results.
+    return s7.offset + S7_OFF_FIX_SYM_EMPTY_PAIR;
+  }
+  auto result = sql_async_queries.take_result(id);
+  if (!result) {
+    return s7.offset;
+  }
+  return make_sql_result(*result);
+}
+
 }  // namespace jak2
@@ -16,5 +16,7 @@ extern Ptr<Symbol4<u32>> kernel_packages;
 void klisten_init_globals();
 void ProcessListenerMessage(Ptr<char> msg);
 int sql_query_sync(Ptr<String> string_in);
+u32 pc_sql_query_async(u32 string_in);
+u32 pc_sql_query_poll(u32 id);
 void InitListener();
 }  // namespace jak2
\ No newline at end of file
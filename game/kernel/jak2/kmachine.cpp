@@ -25,6 +25,7 @@
 #include "game/kernel/common/kmachine.h"
 #include "game/kernel/common/kmalloc.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/common/ksound.h"
@@ -184,6 +185,12 @@ void InitParms(int argc, const char* const* argv) {
       Msg(6, "dkernel: no sound mode\n");
       masterConfig.disable_sound = true;
     }
+
+    // an added mode to keep relocated level data in memory for faster reloads
+    if (arg == "-link-cache") {
+      Msg(6, "dkernel: link cache mode\n");
+      LinkImageCacheEnabled = true;
+    }
   }
 }
 
@@ -381,6 +388,13 @@ int InitMachine() {
   } else {
     kinitheap(kdebugheap, Ptr<u8>(DEBUG_HEAP_START), jak2::DEBUG_HEAP_SIZE);
   }
+
+  // kernel globals for savestates, in addition to the common ones.
+  savestate_add_global(&sLastMsg);
+  for (auto& msg : sMsg) {
+    savestate_add_global(&msg);
+  }
+  savestate_add_global(&g_symbol_hash_table);
   init_output();
   InitIOP();
   // sceGsResetPath();
@@ -540,6 +554,10 @@ void InitMachine_PCPort() {
   make_function_symbol_from_c("pc-init-autosplitter-struct",
                               (void*)kmachine_extras::init_autosplit_struct);
 
+  // editor database queries that don't wait for the result
+  make_function_symbol_from_c("pc-sql-query-async", (void*)pc_sql_query_async);
+  make_function_symbol_from_c("pc-sql-query-poll", (void*)pc_sql_query_poll);
+
   // discord rich presence
   make_function_symbol_from_c("pc-discord-rpc-update", (void*)kmachine_extras::update_discord_rpc);
 
@@ -720,6 +738,7 @@ void InitMachineScheme() {
 }
 
 sqlite::SQLiteDatabase sql_db;
+sqlite::AsyncQueryRunner sql_async_queries(sql_db);
 
 void initialize_sql_db() {
   // If the DB has already been initialized, no-op
@@ -755,20 +774,26 @@ void initialize_sql_db() {
     fs::path level_info_fixture = file_util::get_jak_project_dir() / "goal_src" / "jak2" / "tools" /
                                   "db-fixtures" / "fixture-level_info.sql";
     if (file_util::file_exists(level_info_fixture.string())) {
-      const auto success = sql_db.run_query(file_util::read_text_file(level_info_fixture));
-      // TODO - error check
+      // one transaction, or every insert waits for the disk.
+      if (!sql_db.run_transaction(file_util::read_text_file(level_info_fixture))) {
+        lg::error("[SQL]: Failed to load {}", level_info_fixture.string());
+      }
     }
     fs::path light_fixture = file_util::get_jak_project_dir() / "goal_src" / "jak2" / "tools" /
                              "db-fixtures" / "fixture-light.sql";
     if (file_util::file_exists(light_fixture.string())) {
-      const auto success = sql_db.run_query(file_util::read_text_file(light_fixture));
-      // TODO - error check
+      // one transaction, or every insert waits for the disk.
+      if (!sql_db.run_transaction(file_util::read_text_file(light_fixture))) {
+        lg::error("[SQL]: Failed to load {}", light_fixture.string());
+      }
     }
     fs::path region_fixture = file_util::get_jak_project_dir() / "goal_src" / "jak2" / "tools" /
                               "db-fixtures" / "fixture-region.sql";
     if (file_util::file_exists(region_fixture.string())) {
-      const auto success = sql_db.run_query(file_util::read_text_file(region_fixture));
-      // TODO - error check
+      // one transaction, or every insert waits for the disk.
+      if (!sql_db.run_transaction(file_util::read_text_file(region_fixture))) {
+        lg::error("[SQL]: Failed to load {}", region_fixture.string());
+      }
     }
   }
 }
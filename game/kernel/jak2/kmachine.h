@@ -13,6 +13,7 @@ int ShutdownMachine();
 void InitMachineScheme();
 
 extern sqlite::SQLiteDatabase sql_db;
+extern sqlite::AsyncQueryRunner sql_async_queries;
 void initialize_sql_db();
 sqlite::GenericResponse run_sql_query(const std::string& query);
 
@@ -3,6 +3,8 @@
 
 #include <cstdio>
 #include <cstring>
+#include <string>
+#include <unordered_map>
 
 #include "fileio.h"
 
@@ -34,12 +36,17 @@ Ptr<Symbol4<u32>> CollapseQuote;
 Ptr<Symbol4<u32>> SqlResult;
 Ptr<u32> KernelDebug;
 
+// name -> (symbol - s7) / 4 for every named symbol, so lookups don't need to probe the table.
+// The table in GOAL memory is still filled in the same way, this only speeds up finding symbols.
+std::unordered_map<std::string, int> g_symbol_hash_table;
+
 void kscheme_init_globals() {
   symbol_slot = 0;
   LevelTypeList.offset = 0;
   CollapseQuote.offset = 0;
   SqlResult.offset = 0;
   KernelDebug.offset = 0;
+  g_symbol_hash_table.clear();
 }
 
 /*!
@@ -600,23 +607,35 @@ Ptr<Symbol4<u32>> set_fixed_symbol(u32 offset, const char* name, u32 value) {
 
   // set hash of the symbol
   *sym_to_hash(sym).c() = crc32((const u8*)name, strlen(name));
+  g_symbol_hash_table.insert(std::make_pair(name, ((s32)sym.offset - (s32)s7.offset) / 4));
 
   NumSymbols++;
   return sym;
 }
 
+/*!
+ * Look up a symbol by name in g_symbol_hash_table.
+ * Returns null if there is no symbol with this name.
+ */
+Ptr<Symbol4<u32>> find_symbol_from_c_ht(const char* name) {
+  const auto& it = g_symbol_hash_table.find(name);
+  if (it == g_symbol_hash_table.end()) {
+    return Ptr<Symbol4<u32>>(0);
+  } else {
+    return Ptr<Symbol4<u32>>(s7.offset + it->second * 4);
+  }
+}
+
 /*!
  * Search the hash table's fixed area for a symbol.
  * Returns null if we didn't find it.
+ * MODIFIED: uses g_symbol_hash_table instead of scanning the whole fixed area.
  */
 Ptr<Symbol4<u32>> find_symbol_in_fixed_area(u32 hash, const char* name) {
-  for (u32 i = s7.offset; i < s7.offset + FIX_FIXED_SYM_END_OFFSET; i += 4) {
-    auto sym = Ptr<Symbol4<u32>>(i);
-    if (*sym_to_hash(sym) == hash) {
-      if (!strcmp(sym_to_string(sym)->data(), name)) {
-        return sym;
-      }
-    }
+  (void)hash;
+  auto sym = find_symbol_from_c_ht(name);
+  if (sym.offset >= s7.offset && sym.offset < s7.offset + FIX_FIXED_SYM_END_OFFSET) {
+    return sym;
   }
   return Ptr<Symbol4<u32>>(0);
 }
@@ -669,6 +688,12 @@ Ptr<Symbol4<u32>> find_symbol_from_c(const char* name) {
     }
   }
 
+  // existing symbols can be found without probing. New symbols still probe to find their slot.
+  auto existing = find_symbol_from_c_ht(name);
+  if (existing.offset) {
+    return existing;
+  }
+
   s32 sh1 = hash << 0x13;
   s32 sh2 = sh1 >> 0x10;
   // will be signed, bottom 3 bits 0 (for alignment, symbols are every 8 bytes)
@@ -728,6 +753,7 @@ Ptr<Symbol4<u32>> intern_from_c(const char* name) {
   auto str = make_string_from_c(name);
   *sym_to_string_ptr(symbol) = Ptr<String>(str);
   *sym_to_hash(symbol) = hash;
+  g_symbol_hash_table[name] = ((s32)symbol.offset - (s32)s7.offset) / 4;
 
   NumSymbols++;
   return symbol;
@@ -880,6 +906,8 @@ Ptr<Type> set_fixed_type(u32 offset,
   // set the symbol's name and hash
   *sym_to_string_ptr(type_symbol) = Ptr<String>(make_string_from_c(name));
   *sym_to_hash(type_symbol) = crc32((const u8*)name, strlen(name));
+  g_symbol_hash_table.insert(
+      std::make_pair(name, ((s32)type_symbol.offset - (s32)s7.offset) / 4));
   NumSymbols++;
 
   if (symbol_value.offset == 0) {
@@ -12,6 +12,7 @@
 #include "game/kernel/common/kboot.h"
 #include "game/kernel/common/klisten.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/jak3/klisten.h"
@@ -158,6 +159,7 @@ void KernelShutdown(u32 reason) {
 void KernelCheckAndDispatch() {
   while (MasterExit == RuntimeExitStatus::RUNNING) {
     KernelDispatch(kernel_dispatcher->value());
+    savestate_run_pending();
   }
 }
 
@@ -4,8 +4,12 @@
 
 #include "game/kernel/common/Ptr.h"
 #include "game/kernel/common/kmalloc.h"
+#include "game/overlord/jak3/rpc_interface.h"
 
 namespace jak3 {
+extern RPC_Dgo_Cmd* sLastMsg;
+extern RPC_Dgo_Cmd sMsg[2];
+
 void load_and_link_dgo_from_c(const char* name,
                               Ptr<kheapinfo> heap,
                               u32 linkFlag,
@@ -15,6 +15,7 @@
 #include "game/kernel/common/kmachine.h"
 #include "game/kernel/common/kmalloc.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/ksocket.h"
 #include "game/kernel/common/ksound.h"
 #include "game/kernel/common/memory_layout.h"
@@ -260,6 +261,13 @@ int InitMachine() {
   } else {
     kinitheap(kdebugheap, Ptr<u8>(DEBUG_HEAP_START), jak3::DEBUG_HEAP_SIZE);
   }
+
+  // kernel globals for savestates, in addition to the common ones.
+  savestate_add_global(&sLastMsg);
+  for (auto& msg : sMsg) {
+    savestate_add_global(&msg);
+  }
+  savestate_add_global(&g_symbol_hash_table);
   init_output();
   InitIOP();
   // sceGsResetPath();
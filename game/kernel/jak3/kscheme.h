@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "game/kernel/common/Ptr.h"
 #include "game/kernel/common/Symbol4.h"
 #include "game/kernel/common/kmalloc.h"
@@ -10,6 +13,7 @@ void kscheme_init_globals();
 constexpr s32 SYMBOL_OFFSET = 1;
 extern Ptr<u32> SymbolString;
 extern bool DebugSymbols;
+extern std::unordered_map<std::string, int> g_symbol_hash_table;
 
 /*!
  * GOAL Type
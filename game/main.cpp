@@ -10,6 +10,7 @@
 #include "runtime.h"
 
 #include "common/global_profiler/GlobalProfiler.h"
+#include "common/global_profiler/Telemetry.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
 #include "common/util/dialogs.h"
@@ -19,7 +20,11 @@
 #include "common/versions/versions.h"
 
 #include "game/common/game_common_types.h"
+#include "game/mips2c/mips2c_table.h"
+#include "graphics/frame_replay.h"
+#include "graphics/gfx.h"
 #include "graphics/gfx_test.h"
+#include "system/hid/pad_recording.h"
 
 #include "third-party/CLI11.hpp"
 
@@ -49,6 +54,8 @@ void setup_logging(const std::string& game_name, bool verbose, bool disable_ansi
     lg::disable_ansi_colors();
   }
   lg::initialize();
+  // the runtime threads log a lot, don't make them wait on the file.
+  lg::start_async();
 }
 
 std::string game_arg_documentation() {
@@ -99,9 +106,17 @@ int main(int argc, char** argv) {
   bool enable_portable = false;
   bool disable_save_location_override = false;
   std::string profile_until_event = "";
+  fs::path profile_stream_path;
   std::string gpu_test = "";
   std::string gpu_test_out_path = "";
+  fs::path bench_replay_path;
+  frame_replay::ReplaySettings bench_replay_settings;
   int port_number = -1;
+  std::string mips2c_native = "on";
+  std::string telemetry_output;
+  double telemetry_interval = 1.;
+  fs::path input_record_path;
+  fs::path input_replay_path;
   fs::path project_path_override;
   fs::path user_config_dir_override;
   std::vector<std::string> game_args;
@@ -123,10 +138,69 @@ int main(int argc, char** argv) {
                "stored to the default location");
   app.add_option("--profile-until-event", profile_until_event,
                  "Stops recording profile events once an event with this name is seen");
+  app.add_option("--profile-stream", profile_stream_path,
+                 "Streams profile events to this Perfetto trace file from startup");
   app.add_option("--gpu-test", gpu_test,
                  "Tests for minimum graphics requirements.  Valid Options are: [opengl]");
   app.add_option("--gpu-test-out-path", gpu_test_out_path,
                  "Where to store the gpu test result file");
+  app.add_option("--bench-replay", bench_replay_path,
+                 "Replay a frame capture (from the debug menu) through the renderer without the "
+                 "game, and print the timings")
+      ->check(CLI::ExistingFile);
+  app.add_option("--bench-replay-loops", bench_replay_settings.loops,
+                 "How many times to play the frame capture");
+  app.add_option("--bench-replay-json", bench_replay_settings.json_path,
+                 "Write the replay timings to this JSON file");
+  app.add_flag("--bench-replay-gpu-sync", bench_replay_settings.gpu_sync,
+               "Wait for the GPU after each bucket during the replay");
+  app.add_option("--mips2c-native", mips2c_native,
+                 "Use the native versions of mips2c functions (on), not (off), or run both and "
+                 "report differences (validate)")
+      ->check(CLI::IsMember({"on", "off", "validate"}));
+  app.add_option("--telemetry", telemetry_output,
+                 "Write frame time and stutter statistics as JSON lines to this file, or to a UDP "
+                 "address given as udp:host:port");
+  app.add_option("--telemetry-interval", telemetry_interval,
+                 "Seconds between telemetry reports, defaults to 1");
+  app.add_flag("--dynamic-resolution", Gfx::g_global_settings.dynamic_resolution,
+               "Lower the internal resolution when the GPU can't hold the target frame rate");
+  app.add_option("--dynamic-resolution-min-scale",
+                 Gfx::g_global_settings.dynamic_resolution_min_scale,
+                 "The lowest fraction of the game resolution that dynamic resolution can use, "
+                 "defaults to 0.5")
+      ->check(CLI::Range(0.1f, 1.f));
+  app.add_flag("--adaptive-vsync", Gfx::g_global_settings.adaptive_vsync,
+               "With vsync on, show frames that are late right away instead of waiting for the "
+               "next refresh, if the driver supports it");
+  app.add_option("--max-queued-frames", Gfx::g_global_settings.max_queued_frames,
+                 "Wait for the GPU to finish all but this many frames before starting the next "
+                 "one, for lower input latency. Defaults to 0, which leaves it to the driver")
+      ->check(CLI::Range(0, 3));
+  app.add_flag("--gl-upload-thread", Gfx::g_global_settings.gl_upload_thread,
+               "Upload loading levels to the GPU from another thread with a shared GL context");
+  app.add_flag("--input-poll-thread", Gfx::g_global_settings.input_poll_thread,
+               "Sample controllers on a separate thread, so the game reads fresher input");
+  app.add_option("--level-gpu-budget", Gfx::g_global_settings.level_gpu_budget_mb,
+                 "GPU memory for loaded levels in MB. Levels that aren't in use are unloaded to "
+                 "stay under it. Defaults to 0, which is no limit")
+      ->check(CLI::NonNegativeNumber);
+  app.add_flag("--texture-streaming", Gfx::g_global_settings.texture_streaming,
+               "Load big textures at a lower resolution first, and upload the full resolution "
+               "while the level is in use, within the level GPU budget");
+  app.add_flag("--tfrag-texture-arrays", Gfx::g_global_settings.tfrag_texture_arrays,
+               "Also keep tfrag textures in texture arrays, to save texture binds. This uses about "
+               "as much GPU memory again as the level's tfrag textures");
+  app.add_flag("--headless", Gfx::g_global_settings.headless,
+               "Run without a window or GPU, as fast as possible with a fixed timestep. For "
+               "benchmarking the game code, the frame times go to --telemetry");
+  app.add_option("--headless-frames", Gfx::g_global_settings.headless_frames,
+                 "Exit after this many frames in headless mode")
+      ->check(CLI::NonNegativeNumber);
+  app.add_option("--input-record", input_record_path, "Record the pad input to this file");
+  app.add_option("--input-replay", input_replay_path,
+                 "Play back pad input recorded with --input-record, instead of the controllers")
+      ->check(CLI::ExistingFile);
   app.add_option("--proj-path", project_path_override,
                  "Specify the location of the 'data/' folder");
   app.add_option("--config-path", user_config_dir_override,
@@ -165,8 +239,22 @@ int main(int argc, char** argv) {
     return 0;
   }
 
+  if (!telemetry_output.empty() && !telemetry().open(telemetry_output, telemetry_interval)) {
+    return 1;
+  }
+
+  if (mips2c_native == "off") {
+    Mips2C::gNativeMode = Mips2C::NativeMode::OFF;
+  } else if (mips2c_native == "validate") {
+    lg::info("Validating native mips2c functions against mips2c");
+    Mips2C::gNativeMode = Mips2C::NativeMode::VALIDATE;
+  }
+
   prof().set_enable(enable_profiling);
   prof().set_waiting_for_event(profile_until_event);
+  if (!profile_stream_path.empty()) {
+    prof().start_streaming(profile_stream_path);
+  }
 
   // Create struct with all non-kmachine handled args to pass to the runtime
   GameLaunchOptions game_options;
@@ -218,13 +306,6 @@ int main(int argc, char** argv) {
     get_cpu_info().has_avx2 = false;
   }
 
-#ifndef __AVX2__
-  if (get_cpu_info().has_avx2) {
-    // printf("Note: your CPU supports AVX2, but this build was not compiled with AVX2 support\n");
-    get_cpu_info().has_avx2 = false;
-  }
-#endif
-
   if (get_cpu_info().has_avx2) {
     lg::info("AVX2 mode enabled");
   } else {
@@ -238,6 +319,17 @@ int main(int argc, char** argv) {
     return 1;
   }
 
+  if (!bench_replay_path.empty()) {
+    return frame_replay::run_replay(bench_replay_path, bench_replay_settings);
+  }
+
+  if (!input_record_path.empty() && !pad_recording().start_recording(input_record_path.string())) {
+    return 1;
+  }
+  if (!input_replay_path.empty() && !pad_recording().start_replay(input_replay_path.string())) {
+    return 1;
+  }
+
   bool force_debug_next_time = false;
   // always start with an empty arg, as internally kmachine starts at `1` not `0`
   std::vector<const char*> arg_ptrs = {""};
@@ -253,6 +253,88 @@ struct ExecutionContext {
     }
   }
 
+  // The vector float ops work on all four lanes at once, then only store the lanes in the mask.
+  // They give the same result as doing each lane separately.
+  REALLY_INLINE __m128 vf_vec(int idx) const {
+    return idx == 0 ? _mm_setr_ps(0, 0, 0, 1.f) : vfs[idx].vf.load();
+  }
+
+  // one field of a register, in all four lanes
+  REALLY_INLINE __m128 vf_bc(int idx, BC bc) const {
+    __m128 v = vf_vec(idx);
+    switch (bc) {
+      case BC::x:
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+      case BC::y:
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+      case BC::z:
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+      default:
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+  }
+
+  REALLY_INLINE __m128 acc_vec() const { return acc.vf.load(); }
+
+  // The mask is always a constant here, so this picks one blend with an immediate, which is faster
+  // than blendv.
+  static REALLY_INLINE __m128 masked_blend(DEST mask, __m128 old, __m128 val) {
+    switch (mask) {
+#define MIPS2C_BLEND_CASE(m) \
+  case (DEST)m:              \
+    return _mm_blend_ps(old, val, m);
+      MIPS2C_BLEND_CASE(1)
+      MIPS2C_BLEND_CASE(2)
+      MIPS2C_BLEND_CASE(3)
+      MIPS2C_BLEND_CASE(4)
+      MIPS2C_BLEND_CASE(5)
+      MIPS2C_BLEND_CASE(6)
+      MIPS2C_BLEND_CASE(7)
+      MIPS2C_BLEND_CASE(8)
+      MIPS2C_BLEND_CASE(9)
+      MIPS2C_BLEND_CASE(10)
+      MIPS2C_BLEND_CASE(11)
+      MIPS2C_BLEND_CASE(12)
+      MIPS2C_BLEND_CASE(13)
+      MIPS2C_BLEND_CASE(14)
+#undef MIPS2C_BLEND_CASE
+      case DEST::xyzw:
+        return val;
+      default:
+        return old;
+    }
+  }
+
+  REALLY_INLINE void set_vf(DEST mask, int dst, __m128 val) {
+    _mm_store_ps(vfs[dst].f, masked_blend(mask, vfs[dst].vf.load(), val));
+  }
+
+  REALLY_INLINE void set_acc(DEST mask, __m128 val) {
+    _mm_store_ps(acc.f, masked_blend(mask, acc.vf.load(), val));
+  }
+
+  // std::min(a, b) and std::max(a, b) on each lane, including which one is picked for nans and
+  // zeros. The ARM versions of _mm_min_ps/_mm_max_ps don't do this, so they're not used there.
+  static REALLY_INLINE __m128 vf_min(__m128 a, __m128 b) {
+#ifdef __aarch64__
+    return _mm_blendv_ps(a, b, _mm_cmplt_ps(b, a));
+#else
+    return _mm_min_ps(b, a);
+#endif
+  }
+
+  static REALLY_INLINE __m128 vf_max(__m128 a, __m128 b) {
+#ifdef __aarch64__
+    return _mm_blendv_ps(a, b, _mm_cmplt_ps(a, b));
+#else
+    return _mm_max_ps(b, a);
+#endif
+  }
+
+  static REALLY_INLINE __m128 vf_abs(__m128 a) {
+    return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+  }
+
   u128 gpr_src(int idx) {
     if (idx == 0) {
       u128 result;
@@ -397,36 +479,21 @@ struct ExecutionContext {
   }
 
   void vadd_bc(DEST mask, BC bc, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] + s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dest, _mm_add_ps(s0, s1));
   }
 
   void vmini_bc(DEST mask, BC bc, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = std::min(s0.f[i], s1.f[(int)bc]);
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dest, vf_min(s0, s1));
   }
 
   void vmax_bc(DEST mask, BC bc, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = std::max(s0.f[i], s1.f[(int)bc]);
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dest, vf_max(s0, s1));
   }
 
   void pextuh(int dst, int src0, int src1) {
@@ -788,240 +855,126 @@ struct ExecutionContext {
   }
 
   void vsub_bc(DEST mask, BC bc, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] - s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dest, _mm_sub_ps(s0, s1));
   }
 
   void vmul_bc(DEST mask, BC bc, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dest, _mm_mul_ps(s0, s1));
   }
 
   void vmul(DEST mask, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dest, _mm_mul_ps(s0, s1));
   }
 
   void vadd(DEST mask, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] + s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dest, _mm_add_ps(s0, s1));
   }
 
   void vmini(DEST mask, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = std::min(s0.f[i], s1.f[i]);
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dest, vf_min(s0, s1));
   }
 
   void vmax(DEST mask, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = std::max(s0.f[i], s1.f[i]);
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dest, vf_max(s0, s1));
   }
 
   void vmr32(DEST mask, int dest, int src) {
-    auto s = vf_src(src);
-    if ((u64)mask & 1) {
-      vfs[dest].f[0] = s.f[1];
-    }
-
-    if ((u64)mask & 2) {
-      vfs[dest].f[1] = s.f[2];
-    }
-
-    if ((u64)mask & 4) {
-      vfs[dest].f[2] = s.f[3];
-    }
-
-    if ((u64)mask & 8) {
-      vfs[dest].f[3] = s.f[0];
-    }
+    auto s = vf_vec(src);
+    set_vf(mask, dest, _mm_shuffle_ps(s, s, _MM_SHUFFLE(0, 3, 2, 1)));
   }
 
   void vsub(DEST mask, int dest, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s0.f[i] - s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dest, _mm_sub_ps(s0, s1));
   }
 
   void vmula_bc(DEST mask, BC bc, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] = s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_acc(mask, _mm_mul_ps(s0, s1));
   }
 
   void vmula(DEST mask, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] = s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_acc(mask, _mm_mul_ps(s0, s1));
   }
 
   void vmula_q(DEST mask, int src0) {
-    auto s0 = vf_src(src0);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] = s0.f[i] * Q;
-      }
-    }
+    auto s0 = vf_vec(src0);
+    set_acc(mask, _mm_mul_ps(s0, _mm_set1_ps(Q)));
   }
 
   void vadda_bc(DEST mask, BC bc, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] = s0.f[i] + s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_acc(mask, _mm_add_ps(s0, s1));
   }
 
   void vmadda_bc(DEST mask, BC bc, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] += s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_acc(mask, _mm_add_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmadda(DEST mask, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] += s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_acc(mask, _mm_add_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmsuba(DEST mask, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] -= s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_acc(mask, _mm_sub_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmsuba_bc(DEST mask, BC bc, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        acc.f[i] -= s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_acc(mask, _mm_sub_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmadd_bc(DEST mask, BC bc, int dst, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = acc.f[i] + s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dst, _mm_add_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmadd(DEST mask, int dst, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = acc.f[i] + s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dst, _mm_add_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmsub_bc(DEST mask, BC bc, int dst, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = acc.f[i] - s0.f[i] * s1.f[(int)bc];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_bc(src1, bc);
+    set_vf(mask, dst, _mm_sub_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmsub(DEST mask, int dst, int src0, int src1) {
-    auto s0 = vf_src(src0);
-    auto s1 = vf_src(src1);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = acc.f[i] - s0.f[i] * s1.f[i];
-      }
-    }
+    auto s0 = vf_vec(src0);
+    auto s1 = vf_vec(src1);
+    set_vf(mask, dst, _mm_sub_ps(acc_vec(), _mm_mul_ps(s0, s1)));
   }
 
   void vmsubq(DEST mask, int dst, int src0) {
-    auto s0 = vf_src(src0);
-
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = acc.f[i] - s0.f[i] * Q;
-      }
-    }
+    auto s0 = vf_vec(src0);
+    set_vf(mask, dst, _mm_sub_ps(acc_vec(), _mm_mul_ps(s0, _mm_set1_ps(Q))));
   }
 
   void vdiv(int src0, BC bc0, int src1, BC bc1) {
@@ -1044,12 +997,8 @@ struct ExecutionContext {
   void sqrts(int dst, int src) { fprs[dst] = std::sqrt(std::abs(fprs[src])); }
 
   void vmulq(DEST mask, int dst, int src) {
-    auto s0 = vf_src(src);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = s0.f[i] * Q;
-      }
-    }
+    auto s = vf_vec(src);
+    set_vf(mask, dst, _mm_mul_ps(s, _mm_set1_ps(Q)));
   }
 
   void vrget(DEST mask, int dst) {
@@ -1064,21 +1013,13 @@ struct ExecutionContext {
   void vrxor(int src, BC bc) { gRng.rxor(vf_src(src).du32[(int)bc]); }
 
   void vaddq(DEST mask, int dst, int src) {
-    auto s = vf_src(src);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = s.f[i] + Q;
-      }
-    }
+    auto s = vf_vec(src);
+    set_vf(mask, dst, _mm_add_ps(s, _mm_set1_ps(Q)));
   }
 
   void vabs(DEST mask, int dst, int src) {
-    auto s = vf_src(src);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dst].f[i] = std::abs(s.f[i]);
-      }
-    }
+    auto s = vf_vec(src);
+    set_vf(mask, dst, vf_abs(s));
   }
 
   void vrnext(DEST mask, int dst) {
@@ -1094,12 +1035,8 @@ struct ExecutionContext {
   void mov64(int dest, int src) { gprs[dest].ds64[0] = gpr_src(src).du64[0]; }
 
   void vmove(DEST mask, int dest, int src) {
-    auto s = vf_src(src);
-    for (int i = 0; i < 4; i++) {
-      if ((u64)mask & (1 << i)) {
-        vfs[dest].f[i] = s.f[i];
-      }
-    }
+    auto s = vf_vec(src);
+    set_vf(mask, dest, s);
   }
 
   void slt(int dst, int src0, int src1) {
@@ -1,5 +1,8 @@
 #include "mips2c_table.h"
 
+#include <array>
+#include <utility>
+
 #include "common/log/log.h"
 #include "common/symbols.h"
 
@@ -8,6 +11,7 @@
 #include "game/kernel/jak1/kscheme.h"
 #include "game/kernel/jak2/kscheme.h"
 #include "game/kernel/jak3/kscheme.h"
+#include "game/mips2c/mips2c_private.h"
 #include "game/runtime.h"
 
 extern "C" {
@@ -400,6 +404,7 @@ namespace method_21_cloth_system { extern void link(); }
 
 LinkedFunctionTable gLinkedFunctionTable;
 Rng gRng;
+NativeMode gNativeMode = NativeMode::ON;
 PerGameVersion<std::unordered_map<std::string, std::vector<void (*)()>>> gMips2CLinkCallbacks = {
     //////// JAK 1
     {{"font", {jak1::draw_string::link}},
@@ -669,18 +674,18 @@ void LinkedFunctionTable::reg(const std::string& name, u64 (*exec)(void*), u32 s
   Ptr<u8> jump_to_asm;
   switch (g_game_version) {
     case GameVersion::Jak1:
-      jump_to_asm = Ptr<u8>(::jak1::alloc_heap_object(s7.offset + jak1_symbols::FIX_SYM_GLOBAL_HEAP,
-                                                      *(s7 + jak1_symbols::FIX_SYM_FUNCTION_TYPE),
-                                                      0x40, UNKNOWN_PP));
+      jump_to_asm = Ptr<u8>(::jak1::alloc_heap_object(
+          ::s7.offset + jak1_symbols::FIX_SYM_GLOBAL_HEAP,
+          *(::s7 + jak1_symbols::FIX_SYM_FUNCTION_TYPE), 0x40, UNKNOWN_PP));
       break;
     case GameVersion::Jak2:
       jump_to_asm = Ptr<u8>(::jak2::alloc_heap_object(
-          s7.offset + jak2_symbols::FIX_SYM_GLOBAL_HEAP,
+          ::s7.offset + jak2_symbols::FIX_SYM_GLOBAL_HEAP,
           ::jak2::u32_in_fixed_sym(jak2_symbols::FIX_SYM_FUNCTION_TYPE), 0x40, UNKNOWN_PP));
       break;
     case GameVersion::Jak3:
       jump_to_asm = Ptr<u8>(::jak3::alloc_heap_object(
-          s7.offset + jak3_symbols::FIX_SYM_GLOBAL_HEAP,
+          ::s7.offset + jak3_symbols::FIX_SYM_GLOBAL_HEAP,
           ::jak3::u32_in_fixed_sym(jak3_symbols::FIX_SYM_FUNCTION_TYPE), 0x40, UNKNOWN_PP));
       break;
     default:
@@ -739,6 +744,129 @@ void LinkedFunctionTable::reg(const std::string& name, u64 (*exec)(void*), u32 s
   }
 }
 
+namespace {
+
+// The trampoline can only call a plain function pointer, so each validated function gets its own
+// thunk that knows which slot it's in.
+constexpr int kMaxNativeFunctions = 32;
+
+struct NativeSlot {
+  std::string name;
+  u64 (*mips2c)(void*) = nullptr;
+  u64 (*native)(void*) = nullptr;
+  std::vector<OutputRange> (*outputs)(void*) = nullptr;
+  u64 calls = 0;
+  u64 mismatches = 0;
+};
+
+std::array<NativeSlot, kMaxNativeFunctions> g_native_slots;
+int g_native_slot_count = 0;
+
+std::vector<u8> read_outputs(const std::vector<OutputRange>& ranges) {
+  std::vector<u8> result;
+  for (const auto& range : ranges) {
+    const u8* start = g_ee_main_mem + range.addr;
+    result.insert(result.end(), start, start + range.size);
+  }
+  return result;
+}
+
+void write_outputs(const std::vector<OutputRange>& ranges, const std::vector<u8>& data) {
+  size_t offset = 0;
+  for (const auto& range : ranges) {
+    memcpy(g_ee_main_mem + range.addr, data.data() + offset, range.size);
+    offset += range.size;
+  }
+}
+
+/*!
+ * Run both versions from the same context and memory, and complain if they disagree. The mips2c
+ * result is kept either way.
+ */
+u64 run_validated(NativeSlot& slot, void* ctxt) {
+  const auto ranges = slot.outputs(ctxt);
+  const auto before = read_outputs(ranges);
+
+  ExecutionContext native_ctxt = *(ExecutionContext*)ctxt;
+  u64 native_result = slot.native(&native_ctxt);
+  const auto native_out = read_outputs(ranges);
+
+  write_outputs(ranges, before);
+  u64 result = slot.mips2c(ctxt);
+  const auto mips2c_out = read_outputs(ranges);
+
+  slot.calls++;
+  if (native_result != result || native_out != mips2c_out) {
+    slot.mismatches++;
+    size_t first_diff = 0;
+    while (first_diff < mips2c_out.size() && native_out[first_diff] == mips2c_out[first_diff]) {
+      first_diff++;
+    }
+    // only the first one is printed, after that it's just counted.
+    if (slot.mismatches == 1) {
+      lg::error(
+          "MIPS2C native {} doesn't match: returned 0x{:x} (mips2c 0x{:x}), first output "
+          "difference at byte {} of {}",
+          slot.name, native_result, result, first_diff, mips2c_out.size());
+    } else if ((slot.mismatches & (slot.mismatches - 1)) == 0) {
+      lg::error("MIPS2C native {} has mismatched {} of {} calls", slot.name, slot.mismatches,
+                slot.calls);
+    }
+  }
+  return result;
+}
+
+template <int Slot>
+u64 validate_thunk(void* ctxt) {
+  return run_validated(g_native_slots[Slot], ctxt);
+}
+
+template <int... Slots>
+constexpr std::array<u64 (*)(void*), sizeof...(Slots)> make_thunks(
+    std::integer_sequence<int, Slots...>) {
+  return {validate_thunk<Slots>...};
+}
+
+constexpr auto kValidateThunks =
+    make_thunks(std::make_integer_sequence<int, kMaxNativeFunctions>());
+}  // namespace
+
+void LinkedFunctionTable::reg_native(const std::string& name,
+                                     u64 (*native)(void*),
+                                     std::vector<OutputRange> (*outputs)(void*)) {
+  auto it = m_executes.find(name);
+  ASSERT_MSG(it != m_executes.end(),
+             fmt::format("MIPS2C native {} was registered before the mips2c function", name));
+
+  u64 (*target)(void*) = nullptr;
+  switch (gNativeMode) {
+    case NativeMode::OFF:
+      return;
+    case NativeMode::ON:
+      target = native;
+      break;
+    case NativeMode::VALIDATE: {
+      // the table is rebuilt when the kernel restarts, so reuse the slot for the same name.
+      int slot_idx = 0;
+      while (slot_idx < g_native_slot_count && g_native_slots[slot_idx].name != name) {
+        slot_idx++;
+      }
+      ASSERT_MSG(slot_idx < kMaxNativeFunctions, "too many MIPS2C native functions");
+      g_native_slot_count = std::max(g_native_slot_count, slot_idx + 1);
+      auto& slot = g_native_slots[slot_idx];
+      slot.name = name;
+      slot.mips2c = it->second.c_func;
+      slot.native = native;
+      slot.outputs = outputs;
+      target = kValidateThunks[slot_idx];
+    } break;
+  }
+
+  // point the trampoline from reg at the new function. The address is after the first mov opcode.
+  u64 addr = (u64)target;
+  memcpy(it->second.goal_trampoline.c() + 2, &addr, 8);
+}
+
 u32 LinkedFunctionTable::get(const std::string& name) {
   auto it = m_executes.find(name);
   if (it == m_executes.end()) {
@@ -13,9 +13,37 @@
 
 namespace Mips2C {
 
+// A range of EE memory written by a function, used to compare a native implementation against the
+// mips2c one.
+struct OutputRange {
+  u32 addr;
+  u32 size;
+};
+
+enum class NativeMode {
+  OFF,      // always run the mips2c version
+  ON,       // run the native version, if there is one
+  VALIDATE  // run both and compare the outputs, then keep the mips2c result
+};
+
+extern NativeMode gNativeMode;
+
 class LinkedFunctionTable {
  public:
   void reg(const std::string& name, u64 (*exec)(void*), u32 goal_stack_size);
+
+  /*!
+   * Use a hand-written implementation in place of the mips2c function name, which must already be
+   * registered. It gets the same ExecutionContext, and must have the same effect on EE memory and
+   * return the same value.
+   *
+   * outputs gives the memory the function writes for the arguments in the context. In validate
+   * mode, both versions run on the same inputs and these ranges and the returned values are
+   * compared. Both versions run, so this only works for functions that don't call GOAL code.
+   */
+  void reg_native(const std::string& name,
+                  u64 (*native)(void*),
+                  std::vector<OutputRange> (*outputs)(void*));
   u32 get(const std::string& name);
 
  private:
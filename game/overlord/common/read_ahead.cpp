@@ -0,0 +1,93 @@
+#include "read_ahead.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/util/Assert.h"
+#include "common/util/ThreadPool.h"
+
+ReadAheadFile::~ReadAheadFile() {
+  wait_for_prefetch();
+}
+
+void ReadAheadFile::set_file(FILE* fp) {
+  wait_for_prefetch();
+  m_fp = fp;
+  m_size = 0;
+  m_last_end = 0;
+  m_current.data.clear();
+  m_next.data.clear();
+  if (fp) {
+    fseek(fp, 0, SEEK_END);
+    m_size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+  }
+}
+
+size_t ReadAheadFile::read(u64 offset, void* dest, size_t len) {
+  ASSERT(m_fp);
+  bool sequential = offset == m_last_end;
+  u8* out = (u8*)dest;
+  size_t done = 0;
+
+  while (done < len && offset + done < m_size) {
+    u64 pos = offset + done;
+    if (!m_current.contains(pos) && m_prefetch.valid()) {
+      wait_for_prefetch();
+      if (m_next.contains(pos)) {
+        std::swap(m_current, m_next);
+      }
+    }
+
+    if (m_current.contains(pos)) {
+      size_t count = std::min<u64>(len - done, m_current.start + m_current.data.size() - pos);
+      memcpy(out + done, m_current.data.data() + (pos - m_current.start), count);
+      done += count;
+    } else if (!sequential || len - done >= kChunkSize) {
+      // random access, or big enough that buffering would just add a copy.
+      size_t count = read_file(pos, out + done, len - done);
+      done += count;
+      if (count == 0) {
+        break;
+      }
+    } else {
+      fill(&m_current, pos);
+      if (m_current.data.empty()) {
+        break;
+      }
+    }
+  }
+
+  m_last_end = offset + done;
+  if (sequential && m_current.contains(m_last_end) && !m_prefetch.valid()) {
+    start_prefetch();
+  }
+  return done;
+}
+
+size_t ReadAheadFile::read_file(u64 offset, void* dest, size_t len) {
+  if (fseek(m_fp, offset, SEEK_SET)) {
+    ASSERT_NOT_REACHED_MSG("Failed to fseek");
+  }
+  return fread(dest, 1, len, m_fp);
+}
+
+void ReadAheadFile::fill(Chunk* chunk, u64 offset) {
+  chunk->start = offset;
+  chunk->data.resize(std::min<u64>(kChunkSize, m_size - std::min(offset, m_size)));
+  chunk->data.resize(read_file(offset, chunk->data.data(), chunk->data.size()));
+}
+
+void ReadAheadFile::wait_for_prefetch() {
+  if (m_prefetch.valid()) {
+    m_prefetch.get();
+  }
+}
+
+void ReadAheadFile::start_prefetch() {
+  u64 next_start = m_current.start + m_current.data.size();
+  if (m_next.contains(next_start) || next_start >= m_size) {
+    return;
+  }
+  m_prefetch = ThreadPool::global().submit([this, next_start]() { fill(&m_next, next_start); });
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+/*!
+ * @file read_ahead.h
+ * Sequential read-ahead for the fake CD.
+ *
+ * The overlords read files a few sectors at a time, in the order the PS2 CD would have been asked
+ * for them. Reads that pick up where the last one ended are served from a large buffer, and the
+ * next buffer is read on the shared thread pool while the current one is used. Other reads go
+ * straight to the file.
+ */
+
+#include <cstdio>
+#include <future>
+#include <vector>
+
+#include "common/common_types.h"
+
+class ReadAheadFile {
+ public:
+  static constexpr size_t kChunkSize = 1024 * 1024;
+
+  ReadAheadFile() = default;
+  ~ReadAheadFile();
+  ReadAheadFile(const ReadAheadFile&) = delete;
+  ReadAheadFile& operator=(const ReadAheadFile&) = delete;
+
+  /*!
+   * Switch to reading from fp, or nothing if it's null. The caller still owns the file, and must
+   * call this (or destroy the reader) before closing it.
+   */
+  void set_file(FILE* fp);
+  FILE* file() const { return m_fp; }
+  u64 size() const { return m_size; }
+
+  /*!
+   * Read up to len bytes at offset. Returns the number of bytes read, which is only short at the
+   * end of the file.
+   */
+  size_t read(u64 offset, void* dest, size_t len);
+
+ private:
+  struct Chunk {
+    u64 start = 0;
+    std::vector<u8> data;
+    bool contains(u64 offset) const { return offset >= start && offset < start + data.size(); }
+  };
+
+  size_t read_file(u64 offset, void* dest, size_t len);
+  void fill(Chunk* chunk, u64 offset);
+  void wait_for_prefetch();
+  void start_prefetch();
+
+  FILE* m_fp = nullptr;
+  u64 m_size = 0;
+  // where the last read ended, to spot sequential reads.
+  u64 m_last_end = 0;
+  Chunk m_current;
+  Chunk m_next;
+  // only one of the prefetch and the caller uses the FILE at a time.
+  std::future<void> m_prefetch;
+};
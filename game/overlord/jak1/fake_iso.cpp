@@ -7,6 +7,7 @@
 
 #include "game/overlord/common/fake_iso.h"
 #include "game/overlord/common/overlord.h"
+#include "game/overlord/common/read_ahead.h"
 #include "game/overlord/common/soundcommon.h"
 #include "game/overlord/jak1/isocommon.h"
 #include "game/sound/sndshim.h"
@@ -22,6 +23,8 @@ uint32_t FS_SyncRead();
 uint32_t FS_LoadMusic(char* name, snd::BankHandle* bank_handle);
 void FS_Close(LoadStackEntry* fd);
 static LoadStackEntry sLoadStack[MAX_OPEN_FILES];  //! List of all files that are "open"
+// reader for each entry of sLoadStack, kept separate because the load stack gets memset.
+static ReadAheadFile sLoadStackReaders[MAX_OPEN_FILES];
 static LoadStackEntry* sReadInfo;                  // LoadStackEntry for currently reading file
 
 void fake_iso_init_globals() {
@@ -40,6 +43,9 @@ void fake_iso_init_globals() {
   fake_iso.load_music = FS_LoadMusic;
 
   memset(sLoadStack, 0, sizeof(sLoadStack));
+  for (auto& reader : sLoadStackReaders) {
+    reader.set_file(nullptr);
+  }
   sReadInfo = nullptr;
 }
 
@@ -77,6 +83,7 @@ LoadStackEntry* FS_Open(FileRecord* fr, int32_t offset) {
       auto future = thpool.submit(open_fr, fr, iop::GetThreadId());
       iop::SleepThread();
       selected->fp = future.get();
+      sLoadStackReaders[i].set_file(selected->fp);
 
       return selected;
     }
@@ -103,6 +110,7 @@ LoadStackEntry* FS_OpenWad(FileRecord* fr, int32_t offset) {
       auto future = thpool.submit(open_fr, fr, iop::GetThreadId());
       iop::SleepThread();
       selected->fp = future.get();
+      sLoadStackReaders[i].set_file(selected->fp);
 
       return selected;
     }
@@ -121,6 +129,7 @@ void FS_Close(LoadStackEntry* fd) {
 
   // close the FD
   fd->fr = nullptr;
+  sLoadStackReaders[fd - sLoadStack].set_file(nullptr);
   fclose(fd->fp);
   if (fd == sReadInfo) {
     sReadInfo = nullptr;
@@ -139,20 +148,15 @@ void fs_read(LoadStackEntry* fd, void* buffer, int32_t len, s32 thread_to_wake)
   u32 offset_into_file = SECTOR_SIZE * fd->location;
 
   ASSERT(fd->fp);
-  fseek(fd->fp, 0, SEEK_END);
-  uint32_t file_len = ftell(fd->fp);
-  rewind(fd->fp);
+  auto& reader = sLoadStackReaders[fd - sLoadStack];
+  u64 file_len = reader.size();
 
   if (offset_into_file < file_len) {
-    if (offset_into_file) {
-      fseek(fd->fp, offset_into_file, SEEK_SET);
-    }
-
     if (offset_into_file + real_size > file_len) {
       real_size = (file_len - offset_into_file);
     }
 
-    if (fread(buffer, real_size, 1, fd->fp) != 1) {
+    if (reader.read(offset_into_file, buffer, real_size) != (size_t)real_size) {
       ASSERT(false);
     }
   }
@@ -10,6 +10,7 @@
 #include "game/common/overlord_common.h"
 #include "game/overlord/common/fake_iso.h"
 #include "game/overlord/common/isocommon.h"
+#include "game/overlord/common/read_ahead.h"
 #include "game/overlord/common/sbank.h"
 #include "game/overlord/jak2/iso_queue.h"
 #include "game/sce/iop.h"
@@ -83,6 +84,7 @@ u32 FS_SyncRead();
 struct FakeCd {
   int offset_into_file = 0;
   FILE* fp = nullptr;
+  ReadAheadFile reader;
   void (*callback)(int) = nullptr;
   FileRecord* last_fr = nullptr;
 } gFakeCd;
@@ -143,14 +145,8 @@ int sceCdRead(int lsn, int num_sectors, void* dest, void* mode) {
   auto do_read = [lsn, num_sectors, dest](s32 thid) {
     // printf("sceCdRead %d, %d -> %p\n", lsn, num_sectors, dest);
     ASSERT(gFakeCd.fp);
-    if (fseek(gFakeCd.fp, lsn * SECTOR_SIZE, SEEK_SET)) {
-      ASSERT_MSG(false, "Failed to fseek");
-    }
-    if (fread(dest, num_sectors * SECTOR_SIZE, 1, gFakeCd.fp) < 0) {
-      printf("dest is %p, num_sectors %d, lsn %d\n", dest, num_sectors, lsn);
-      printf("err: %s\n", strerror(errno));
-      ASSERT_MSG(false, "Failed to fread");
-    }
+    // reads past the end of the file leave the rest of dest alone.
+    gFakeCd.reader.read((u64)lsn * SECTOR_SIZE, dest, num_sectors * SECTOR_SIZE);
     ASSERT(gFakeCd.callback);
 
     iWakeupThread(thid);
@@ -622,6 +618,8 @@ int FS_PageBeginRead(LoadStackEntry* lse, Buffer* buffer) {
 
       ASSERT(fp);
 
+      // stop reading ahead in the old file before closing it.
+      gFakeCd.reader.set_file(fp);
       if (gFakeCd.fp) {
         fclose(gFakeCd.fp);
       }
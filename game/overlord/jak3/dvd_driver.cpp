@@ -7,6 +7,7 @@
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
 
+#include "game/overlord/common/fake_iso.h"
 #include "game/overlord/jak3/isocommon.h"
 #include "game/overlord/jak3/overlord.h"
 #include "game/sce/iop.h"
@@ -263,6 +264,8 @@ void CDvdDriver::CancelRead(jak3::CDescriptor* desc) {
       //        sceCdSync(0);
       //      }
       //      sceCdSync(0);
+      // a host read can't be interrupted, but it must be done before the buffer is given back.
+      sync_read();
       read_in_progress = 0;
     }
 
@@ -400,8 +403,8 @@ void CDvdDriver::read_from_file(const jak3::Block* block) {
     lg::debug("CDvdDriver swapping files {} - > {}",
               selected_entry->def ? selected_entry->def->name.data : "NONE", fd->name.data);
     if (selected_entry->def) {
+      selected_entry->reader->set_file(nullptr);
       fclose(selected_entry->fp);
-      selected_entry->size = 0;
     }
 
     selected_entry->def = fd;
@@ -409,12 +412,9 @@ void CDvdDriver::read_from_file(const jak3::Block* block) {
     if (!selected_entry->fp) {
       lg::die("Failed to open {} {}", fd->full_path, strerror(errno));
     }
-    // get the size of the file we actually opened, rather than caching the size at startup to
-    // support changing the file length after the game has started.
-    fseek(selected_entry->fp, 0, SEEK_END);
-    selected_entry->size = ftell(selected_entry->fp);
-    fseek(selected_entry->fp, 0, SEEK_SET);
-    selected_entry->offset_in_file = 0;
+    // this gets the size of the file we actually opened, rather than caching the size at startup
+    // to support changing the file length after the game has started.
+    selected_entry->reader->set_file(selected_entry->fp);
   }
 
   // increment use counter
@@ -422,32 +422,51 @@ void CDvdDriver::read_from_file(const jak3::Block* block) {
 
   const u64 desired_offset = block->params.sector_num * 0x800;
 
+  const u64 file_size = selected_entry->reader->size();
+
   // see if we're reading entirely past the end of the file
-  if (desired_offset >= selected_entry->size) {
+  if (desired_offset >= file_size) {
     return;
   }
 
-  if (selected_entry->offset_in_file != desired_offset) {
-    lg::debug("CDvdDriver jumping in file {}: {} -> {}", fd->name.data,
-              selected_entry->offset_in_file, desired_offset);
-    if (fseek(selected_entry->fp, desired_offset, SEEK_SET)) {
-      ASSERT_NOT_REACHED_MSG("Failed to fseek");
-    }
-    selected_entry->offset_in_file = desired_offset;
-  }
-
   // read
   s64 read_length = block->params.num_sectors * 0x800;
-  s64 extra_length = read_length + desired_offset - selected_entry->size;
+  s64 extra_length = read_length + desired_offset - file_size;
   if (extra_length > 0) {
     read_length -= extra_length;
   }
-  auto ret = fread(block->params.destination, read_length, 1, selected_entry->fp);
-  if (ret != 1) {
+  auto ret = selected_entry->reader->read(desired_offset, block->params.destination, read_length);
+  if (ret != (size_t)read_length) {
     lg::die("Failed to read {} {}, size {} of {} (ret {})", fd->full_path, strerror(errno),
-            read_length, selected_entry->size, ret);
+            read_length, file_size, ret);
+  }
+}
+
+/*!
+ * Start reading a block on the overlord thread pool. Like the CD read on the PS2, this returns
+ * immediately, so the other IOP threads (like the SPU streams) keep running while the host reads.
+ */
+void CDvdDriver::start_read(const jak3::Block* block) {
+  ASSERT(!m_pending_read.valid());
+  // copy the block, it's owned by the ring.
+  m_pending_read = thpool.submit([this, copy = *block]() { read_from_file(&copy); }).share();
+}
+
+/*!
+ * Wait for the read from start_read to finish. Only call this from the DVD thread.
+ */
+void CDvdDriver::sync_read() {
+  if (!m_pending_read.valid()) {
+    return;
   }
-  selected_entry->offset_in_file += read_length;
+  // poll, instead of sleeping until the read wakes us. A wakeup that arrives while this thread is
+  // waiting on something else would make it runnable too early.
+  while (m_pending_read.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+    DelayThread(100);
+  }
+  // rethrows, if the read failed.
+  m_pending_read.get();
+  m_pending_read = {};
 }
 
 u32 DvdThread() {
@@ -470,8 +489,9 @@ u32 DvdThread() {
     bool completed = false;
 
     // if a read is in progress, wait for it to finish.
+    // a cancelled read is still synced, so the file cache is never used by two reads at once.
+    driver->sync_read();
     if (driver->read_in_progress) {
-      // TODO: if we switch to async reads, this is where we'd want to sync.
       // sceCdSync(0);
       completed = true;
       // error checking
@@ -497,7 +517,7 @@ u32 DvdThread() {
       // start a new read.
       driver->read_in_progress = 1;
       ovrld_log(LogCategory::DRIVER, "[driver thread] Reading for slot {}", block - driver->ring);
-      driver->read_from_file(block);
+      driver->start_read(block);
 
     } else {
       driver->read_in_progress = 0;
@@ -579,8 +599,12 @@ void CDvdDriver::CompletionHandler(jak3::Block* block, int code) {
 }
 
 CDvdDriver::~CDvdDriver() {
+  if (m_pending_read.valid()) {
+    m_pending_read.wait();
+  }
   for (auto& entry : m_file_cache) {
     if (entry.fp) {
+      entry.reader->set_file(nullptr);
       fclose(entry.fp);
     }
   }
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <functional>
+#include <future>
+#include <memory>
 
 #include "common/common_types.h"
 
+#include "game/overlord/common/read_ahead.h"
 #include "game/overlord/jak3/isocommon.h"
 
 namespace jak3 {
@@ -103,6 +106,8 @@ class CDvdDriver {
   int ReleaseFIFOSema(bool from_dvd_thread);
   int AcquireFIFOSema(bool from_dvd_thread);
   void read_from_file(const Block* block);
+  void start_read(const Block* block);
+  void sync_read();
   void CompletionHandler(Block* block, int code);
 
   u8 initialized = 0;
@@ -130,13 +135,16 @@ class CDvdDriver {
   struct FileCacheEntry {
     const ISOFileDef* def = nullptr;
     FILE* fp = nullptr;
-    size_t size = 0;
+    // a pointer so the driver can still be reset with *this = {}, which copies.
+    std::shared_ptr<ReadAheadFile> reader = std::make_shared<ReadAheadFile>();
     u32 last_use_count = 0;
-    u64 offset_in_file = 0;
   };
   u32 m_file_cache_counter = 0;
   static constexpr int kNumFileCacheEntries = 6;
   FileCacheEntry m_file_cache[kNumFileCacheEntries];
+  // the host read started by start_read. The file cache is only touched by that read until it is
+  // synced. Shared so the driver stays copyable.
+  std::shared_future<void> m_pending_read;
 };
 
 // replacement for g_DvdDriver
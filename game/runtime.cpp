@@ -41,6 +41,7 @@
 #include "game/kernel/common/kmalloc.h"
 #include "game/kernel/common/kmemcard.h"
 #include "game/kernel/common/kprint.h"
+#include "game/kernel/common/ksavestate.h"
 #include "game/kernel/common/kscheme.h"
 #include "game/kernel/jak1/kboot.h"
 #include "game/kernel/jak1/kdgo.h"
@@ -48,6 +49,7 @@
 #include "game/kernel/jak1/kscheme.h"
 #include "game/kernel/jak2/kboot.h"
 #include "game/kernel/jak2/kdgo.h"
+#include "game/kernel/jak2/klink.h"
 #include "game/kernel/jak2/klisten.h"
 #include "game/kernel/jak2/kscheme.h"
 #include "game/kernel/jak3/kboot.h"
@@ -99,6 +101,26 @@ namespace {
 int g_argc = 0;
 const char** g_argv = nullptr;
 
+/*!
+ * Read the CGOs that the kernel loads at boot, so they are in the OS file cache by the time the EE
+ * asks for them. This runs on its own thread while graphics start, and only helps on a cold start.
+ */
+void warm_boot_files(GameVersion version) {
+  auto p = scoped_prof("startup::warm_boot_files");
+  const auto iso_dir =
+      file_util::get_jak_project_dir() / "out" / game_version_names[version] / "iso";
+  std::vector<u8> buffer(1024 * 1024);
+  for (const char* name : {"KERNEL.CGO", "GAME.CGO"}) {
+    auto fp = file_util::open_file(iso_dir / name, "rb");
+    if (!fp) {
+      continue;
+    }
+    while (fread(buffer.data(), 1, buffer.size(), fp) == buffer.size()) {
+    }
+    fclose(fp);
+  }
+}
+
 /*!
  * SystemThread function for running the DECI2 communication with the GOAL compiler.
  */
@@ -199,6 +221,7 @@ void ee_runner(SystemThreadInterface& iface) {
 
   kdsnetm_init_globals_common();
   klink_init_globals();
+  jak2::klink_init_globals();
 
   kmachine_init_globals_common();
   jak1::kscheme_init_globals();
@@ -218,6 +241,7 @@ void ee_runner(SystemThreadInterface& iface) {
 
   kmemcard_init_globals();
   kprint_init_globals_common();
+  ksavestate_init_globals();
 
   // Added for OpenGOAL's debugger
   xdbg::allow_debugging();
@@ -341,7 +365,10 @@ void iop_runner(SystemThreadInterface& iface, GameVersion version) {
   {
     auto p = scoped_prof("overlord-wait-for-init");
     while (complete == false) {
-      iop.kernel.dispatch();
+      auto wait_duration = iop.kernel.dispatch();
+      if (!complete && wait_duration) {
+        iop.wait_run_iop(*wait_duration);
+      }
     }
   }
 
@@ -386,6 +413,7 @@ RuntimeExitStatus exec_runtime(GameLaunchOptions game_options, int argc, const c
 
   gStartTime = time(nullptr);
   prof().instant_event("ROOT");
+  std::thread warm_boot_files_thread(warm_boot_files, g_game_version);
   {
     auto p = scoped_prof("startup::exec_runtime::init_discord_rpc");
     init_discord_rpc();
@@ -440,7 +468,7 @@ RuntimeExitStatus exec_runtime(GameLaunchOptions game_options, int argc, const c
 
   // step 4: wait for EE to signal a shutdown. meanwhile, run video loop on main thread.
   // TODO relegate this to its own function
-  if (enable_display) {
+  if (enable_display && !Gfx::g_global_settings.headless) {
     try {
       Gfx::Loop([]() { return MasterExit == RuntimeExitStatus::RUNNING; });
     } catch (std::exception& e) {
@@ -464,6 +492,7 @@ RuntimeExitStatus exec_runtime(GameLaunchOptions game_options, int argc, const c
 
   // join and exit
   tm.join();
+  warm_boot_files_thread.join();
 
   // kill renderer after all threads are stopped.
   // this makes sure the std::shared_ptr<Display> is destroyed in the main thread.
@@ -6,6 +6,7 @@
 #include "game/graphics/gfx.h"
 #include "game/kernel/common/kernel_types.h"
 #include "game/system/hid/input_bindings.h"
+#include "game/system/hid/pad_recording.h"
 
 /*!
  * @file libpad.cpp
@@ -66,31 +67,29 @@ int scePadRead(int port, int /*slot*/, u8* rdata) {
 
   cpad->status = 0x70 /* (dualshock2) */ | (20 / 2); /* (dualshock2 data size) */
 
-  std::optional<std::shared_ptr<PadData>> pad_data = std::nullopt;
+  PadData pad_data;
+  bool has_data = false;
   if (Display::GetMainDisplay()) {
+    int read_port = port;
     if (Gfx::g_debug_settings.treat_pad0_as_pad1) {
-      if (port == 0) {
-        pad_data = Display::GetMainDisplay()->get_input_manager()->get_current_data(1);
-      } else {
-        pad_data = Display::GetMainDisplay()->get_input_manager()->get_current_data(0);
-      }
-    } else {
-      pad_data = Display::GetMainDisplay()->get_input_manager()->get_current_data(port);
+      read_port = port == 0 ? 1 : 0;
     }
+    has_data = Display::GetMainDisplay()->get_input_manager()->read_pad_data(read_port, &pad_data);
   }
+  pad_recording().process(port, &has_data, &pad_data);
 
-  if (pad_data) {
-    std::tie(cpad->rightx, cpad->righty) = pad_data.value()->analog_right();
-    std::tie(cpad->leftx, cpad->lefty) = pad_data.value()->analog_left();
+  if (has_data) {
+    std::tie(cpad->rightx, cpad->righty) = pad_data.analog_right();
+    std::tie(cpad->leftx, cpad->lefty) = pad_data.analog_left();
 
     // pressure sensitivity, ignored for almost all controllers
-    for (size_t i = 0; i < pad_data.value()->pressure_data.size(); i++) {
-      cpad->abutton[i] = pad_data.value()->pressure_data.at(i);
+    for (size_t i = 0; i < pad_data.pressure_data.size(); i++) {
+      cpad->abutton[i] = pad_data.pressure_data.at(i);
     }
 
     cpad->button0 = 0;
-    for (size_t i = 0; i < pad_data.value()->button_data.size(); i++) {
-      cpad->button0 |= pad_data.value()->button_data.at(i) << i;
+    for (size_t i = 0; i < pad_data.button_data.size(); i++) {
+      cpad->button0 |= pad_data.button_data.at(i) << i;
     }
   }
 
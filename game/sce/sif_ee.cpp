@@ -89,8 +89,12 @@ s32 sceSifCallRpc(sceSifClientData* bd,
 }
 
 s32 sceSifCheckStatRpc(sceSifRpcData* bd) {
-  iop->signal_run_iop();
-  return iop->kernel.sif_busy(bd->id);
+  bool busy = iop->kernel.sif_busy(bd->id);
+  if (busy) {
+    // the EE is waiting on this, make sure the IOP is running.
+    iop->signal_run_iop();
+  }
+  return busy;
 }
 
 s32 sceSifBindRpc(sceSifClientData* bd, u32 request, u32 mode) {
@@ -1,6 +1,7 @@
 #include "settings.h"
 
 #include "common/log/log.h"
+#include "common/util/BackgroundFileWriter.h"
 #include "common/util/json_util.h"
 
 #include "game/runtime.h"
@@ -18,6 +19,7 @@ void to_json(json& j, const DebugSettings& obj) {
   json_serialize(text_check_range);
   json_serialize(text_max_range);
   json_serialize(hide_imgui_key);
+  json_serialize(audio_latency_frames);
 }
 
 void from_json(const json& j, DebugSettings& obj) {
@@ -31,6 +33,7 @@ void from_json(const json& j, DebugSettings& obj) {
   json_deserialize_if_exists(text_check_range);
   json_deserialize_if_exists(text_max_range);
   json_deserialize_if_exists(hide_imgui_key);
+  json_deserialize_if_exists(audio_latency_frames);
 }
 
 DebugSettings::DebugSettings() {}
@@ -58,8 +61,8 @@ void DebugSettings::save_settings() {
   json data = *this;
   auto debug_settings_filename =
       file_util::get_user_misc_dir(g_game_version) / "debug-settings.json";
-  file_util::create_dir_if_needed_for_file(debug_settings_filename);
-  file_util::write_text_file(debug_settings_filename, data.dump(2));
+  // on the writer thread, saving shouldn't cause a hitch.
+  background_file_writer().write_text(debug_settings_filename, data.dump(2));
 }
 
 void to_json(json& j, const DisplaySettings& obj) {
@@ -103,8 +106,7 @@ void DisplaySettings::save_settings() {
   version = current_version;
   json data = *this;
   auto file_path = file_util::get_user_settings_dir(g_game_version) / "display-settings.json";
-  file_util::create_dir_if_needed_for_file(file_path);
-  file_util::write_text_file(file_path, data.dump(2));
+  background_file_writer().write_text(file_path, data.dump(2));
 }
 
 void to_json(json& j, const InputSettings& obj) {
@@ -156,7 +158,6 @@ void InputSettings::save_settings() {
   version = current_version;
   json data = *this;
   auto file_path = file_util::get_user_settings_dir(g_game_version) / "input-settings.json";
-  file_util::create_dir_if_needed_for_file(file_path);
-  file_util::write_text_file(file_path, data.dump(2));
+  background_file_writer().write_text(file_path, data.dump(2));
 }
 }  // namespace game_settings
@@ -25,6 +25,8 @@ struct DebugSettings {
   bool text_check_range = false;
   float text_max_range = 0;
   u32 hide_imgui_key = SDLK_LALT;
+  // audio output latency in frames, 0 adjusts it automatically.
+  u32 audio_latency_frames = 0;
 
   void load_settings();
   void save_settings();
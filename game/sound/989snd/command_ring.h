@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace snd {
+
+// Bounded lock-free queue with any number of producers and a single consumer.
+// Each cell has a sequence number that says whether it's free for the producer at that position
+// or ready for the consumer, so a push only contends on the head index. Size must be a power of
+// two. Pop must only be called from one thread at a time.
+template <typename T, size_t Size>
+class CommandRing {
+  static_assert(Size && (Size & (Size - 1)) == 0, "CommandRing size must be a power of 2");
+
+ public:
+  CommandRing() {
+    for (size_t i = 0; i < Size; i++) {
+      mCells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // Returns false if the ring is full.
+  bool Push(const T& value) {
+    size_t pos = mHead.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+      cell = &mCells[pos & (Size - 1)];
+      size_t seq = cell->seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (mHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = mHead.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->value = value;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Returns false if there is nothing ready.
+  bool Pop(T* out) {
+    Cell& cell = mCells[mTail & (Size - 1)];
+    size_t seq = cell.seq.load(std::memory_order_acquire);
+    if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(mTail + 1) < 0) {
+      return false;
+    }
+
+    *out = cell.value;
+    cell.seq.store(mTail + Size, std::memory_order_release);
+    mTail++;
+    return true;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> seq;
+    T value;
+  };
+
+  std::array<Cell, Size> mCells;
+  alignas(64) std::atomic<size_t> mHead{0};
+  alignas(64) size_t mTail{0};
+};
+
+}  // namespace snd
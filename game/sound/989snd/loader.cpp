@@ -59,6 +59,7 @@ static Tone ReadTone(BinaryReader& data, u8* samples) {
 static Midi ReadMidi(BinaryReader& data) {
   Midi mid;
   u8* base = const_cast<u8*>(data.here());
+  const u8* end = base + data.bytes_left();
 
   mid.DataID = data.read<u32>();
   mid.Version = data.read<s16>();
@@ -73,6 +74,7 @@ static Midi ReadMidi(BinaryReader& data) {
   data.read<u32>();
   mid.Tempo = data.read<u32>();
   mid.PPQ = data.read<s32>();
+  mid.Sequence = std::make_shared<MidiSequence>(mid.DataStart, end);
 
   return mid;
 }
@@ -202,6 +204,7 @@ SFXBlock* SFXBlock::ReadBlock(std::span<u8> bank_data, std::span<u8> samples) {
 
   block->SampleData = std::make_unique<u8[]>(samples.size());
   std::copy(samples.begin(), samples.end(), block->SampleData.get());
+  block->Samples = std::span<const u8>(block->SampleData.get(), samples.size());
 
   block->Version = data.read<u32>();
   block->Flags.flags = data.read<u32>();
@@ -327,6 +330,7 @@ MusicBank* MusicBank::ReadBank(std::span<u8> bank_data,
 
   bank->SampleData = std::make_unique<u8[]>(samples.size_bytes());
   std::copy(samples.begin(), samples.end(), bank->SampleData.get());
+  bank->Samples = std::span<const u8>(bank->SampleData.get(), samples.size_bytes());
 
   bank->SeqData = std::make_unique<u8[]>(midi_data.size_bytes());
   std::copy(midi_data.begin(), midi_data.end(), bank->SeqData.get());
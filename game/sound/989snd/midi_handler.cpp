@@ -66,30 +66,14 @@ MidiHandler::MidiHandler(Midi* block,
 }
 
 void MidiHandler::InitMidi() {
-  m_seq_data_start = m_header->DataStart;
-  m_seq_ptr = m_seq_data_start;
+  m_seq = m_header->Sequence.get();
+  m_event = 0;
   m_tempo = m_header->Tempo;
   m_ppq = m_header->PPQ;
   m_chanvol.fill(0x7f);
   m_chanpan.fill(0);
 }
 
-std::pair<size_t, u32> MidiHandler::ReadVLQ(u8* value) {
-  size_t len = 1;
-  u32 out = *value & 0x7f;
-  // fmt::print("starting with {:x}\n", *value);
-
-  if ((*value & 0x80) != 0) {
-    while ((*value & 0x80) != 0) {
-      len++;
-      value++;
-      out = (out << 7) + (*value & 0x7f);
-    }
-  }
-
-  return {len, out};
-}
-
 void MidiHandler::Pause() {
   m_paused = true;
 
@@ -199,18 +183,13 @@ void MidiHandler::UnmuteChannel(u8 channel) {
   m_mute_state[channel] = false;
 }
 
-void MidiHandler::NoteOn() {
-  u8 channel = m_status & 0xf;
-  u8 note = m_seq_ptr[0];
-  u8 velocity = m_seq_ptr[1];
-
-  if (velocity == 0) {
-    NoteOff();
-    return;
-  }
+void MidiHandler::NoteOn(const Event& ev) {
+  u8 channel = ev.status & 0xf;
+  u8 note = ev.data[0];
+  u8 velocity = ev.data[1];
 
+  // a note on with 0 velocity was decoded as a note off.
   if (m_mute_state[channel]) {
-    m_seq_ptr += 2;
     return;
   }
 
@@ -249,18 +228,15 @@ void MidiHandler::NoteOn() {
       m_voices.emplace_front(voice);
     }
   }
-
-  m_seq_ptr += 2;
 }
 
-void MidiHandler::NoteOff() {
-  u8 channel = m_status & 0xf;
-  u8 note = m_seq_ptr[0];
+void MidiHandler::NoteOff(const Event& ev) {
+  u8 channel = ev.status & 0xf;
+  u8 note = ev.data[0];
   // Yep, no velocity for note-offs
-  [[maybe_unused]] u8 velocity = m_seq_ptr[1];
 
-  // fmt::print("{}: note off {:02x} {:02x} {:02x}\n", m_time, m_status, m_seq_ptr[0],
-  // m_seq_ptr[1]);
+  // fmt::print("{}: note off {:02x} {:02x} {:02x}\n", m_time, ev.status, ev.data[0],
+  // ev.data[1]);
 
   for (auto& v : m_voices) {
     auto voice = v.lock();
@@ -272,25 +248,22 @@ void MidiHandler::NoteOff() {
       voice->KeyOff();
     }
   }
-
-  m_seq_ptr += 2;
 }
 
-void MidiHandler::ProgramChange() {
-  u8 channel = m_status & 0xf;
-  u8 program = m_seq_ptr[0];
+void MidiHandler::ProgramChange(const Event& ev) {
+  u8 channel = ev.status & 0xf;
+  u8 program = ev.data[0];
 
   m_programs[channel] = program;
 
   // fmt::print("{:x} {}: [ch{:01x}] program change {:02x} -> {:02x}\n", (u64)this, m_time, channel,
   // m_programs[channel], program);
-  m_seq_ptr += 1;
 }
 
-void MidiHandler::ChannelPressure() {
-  u8 channel = m_status & 0xf;
-  u8 note = m_seq_ptr[0];
-  // fmt::print("{}: channel pressure {:02x} {:02x}\n", m_time, m_status, m_seq_ptr[0]);
+void MidiHandler::ChannelPressure(const Event& ev) {
+  u8 channel = ev.status & 0xf;
+  u8 note = ev.data[0];
+  // fmt::print("{}: channel pressure {:02x} {:02x}\n", m_time, ev.status, ev.data[0]);
 
   for (auto& v : m_voices) {
     auto voice = v.lock();
@@ -302,13 +275,11 @@ void MidiHandler::ChannelPressure() {
       voice->KeyOff();
     }
   }
-
-  m_seq_ptr += 1;
 }
 
-void MidiHandler::ChannelPitch() {
-  u8 channel = m_status & 0xF;
-  s32 pitch = 0xFFFF * ((m_seq_ptr[0] & 0x7f) | ((m_seq_ptr[1] & 0x7f) << 7)) / 0x3FFF;
+void MidiHandler::ChannelPitch(const Event& ev) {
+  u8 channel = ev.status & 0xF;
+  s32 pitch = ev.value;
   // lg::debug("{}: pitch ch{:01x} {:04x}", m_time, channel, pitch);
 
   m_pitch_bend[channel] = pitch + 0x8000;
@@ -327,36 +298,21 @@ void MidiHandler::ChannelPitch() {
       voice->SetPitch(pitch);
     }
   }
-
-  m_seq_ptr += 2;
 }
 
-void MidiHandler::MetaEvent() {
-  // fmt::print("{}: meta event {:02x}\n", m_time, *m_seq_ptr);
-  size_t len = m_seq_ptr[1];
-
-  if (*m_seq_ptr == 0x2f) {
-    m_seq_ptr = m_seq_data_start;
-
-    // If repeats was 0 we'll go negative, fail this test, and loop infinitely as intended
-    m_repeats--;
-    if (m_repeats == 0) {
-      m_track_complete = true;
-    }
+void MidiHandler::EndOfTrack() {
+  // back to the start, with the running status of the end of track meta event.
+  m_event = m_seq->Find(0, 0xFF);
 
-    if (m_repeats < 0) {
-      m_repeats = 0;
-    }
-
-    return;
+  // If repeats was 0 we'll go negative, fail this test, and loop infinitely as intended
+  m_repeats--;
+  if (m_repeats == 0) {
+    m_track_complete = true;
   }
 
-  if (*m_seq_ptr == 0x51) {
-    m_tempo = (m_seq_ptr[2] << 16) | (m_seq_ptr[3] << 8) | (m_seq_ptr[4]);
-    m_ppt = 100 * mics_per_tick / (m_tempo / m_ppq);
+  if (m_repeats < 0) {
+    m_repeats = 0;
   }
-
-  m_seq_ptr += len + 2;
 }
 
 static s16 midiTo360Pan(u8 pan) {
@@ -367,10 +323,10 @@ static s16 midiTo360Pan(u8 pan) {
   }
 }
 
-void MidiHandler::ControllerChange() {
-  u8 channel = m_status & 0xf;
-  u8 controller = m_seq_ptr[0];
-  u8 value = m_seq_ptr[1];
+void MidiHandler::ControllerChange(const Event& ev) {
+  u8 channel = ev.status & 0xf;
+  u8 controller = ev.data[0];
+  u8 value = ev.data[1];
 
   switch (controller) {
     // case 0x0: {} break; // TODO bank select
@@ -385,30 +341,24 @@ void MidiHandler::ControllerChange() {
       throw MidiError(fmt::format("invalid midi controller change {}", controller));
       break;
   }
-
-  m_seq_ptr += 2;
 }
 
-void MidiHandler::SystemEvent() {
-  // fmt::print("{}: system event {:02x}\n", m_time, *m_seq_ptr);
+void MidiHandler::SystemEvent(const Event& ev) {
+  // fmt::print("{}: system event {:02x}\n", m_time, ev.data[0]);
 
-  switch (*m_seq_ptr) {
-    case 0x75:
-      m_seq_ptr++;
-      if (m_parent.has_value()) {
-        auto [cont, ptr] = m_parent.value()->RunAME(*this, m_seq_ptr);
-        m_seq_ptr = ptr;
+  if (m_parent.has_value()) {
+    auto [cont, ptr] = m_parent.value()->RunAME(*this, m_seq->Data() + ev.value);
 
-        if (!cont) {
-          // lg::debug("{:x} track stopped by ame", (u64)this);
-          m_track_complete = true;
-        }
-      } else {
-        throw MidiError("MIDI tried to run AME without an AME handler");
-      }
-      break;
-    default:
-      throw MidiError(fmt::format("Unknown system message {:02x}", *m_seq_ptr));
+    if (!cont) {
+      // lg::debug("{:x} track stopped by ame", (u64)this);
+      m_track_complete = true;
+      return;
+    }
+
+    // the script decides how much of the stream it reads, continue from where it stopped.
+    m_event = m_seq->Find(ptr - m_seq->Data(), ev.status);
+  } else {
+    throw MidiError("MIDI tried to run AME without an AME handler");
   }
 }
 
@@ -423,20 +373,20 @@ bool MidiHandler::Tick() {
   } catch (MidiError& e) {
     m_track_complete = true;
     lg::error("MIDI Error: {}", e.what());
-    fmt::print("Sequence following: ");
-    for (int i = 0; i < 10; i++) {
-      fmt::print("{:x} ", m_seq_ptr[i]);
-    }
-    fmt::print("\n");
+    const auto& ev = m_seq->At(m_event - 1);
+    fmt::print("At event {}: status {:x} data {:x} {:x}\n", m_event - 1, ev.status, ev.data[0],
+               ev.data[1]);
   }
 
   return m_track_complete;
 }
 
 void MidiHandler::NewDelta() {
-  auto [len, delta] = ReadVLQ(m_seq_ptr);
+  if (m_track_complete) {
+    return;
+  }
 
-  m_seq_ptr += len;
+  u32 delta = m_seq->At(m_event).delta;
   m_time += delta;
 
   m_ppt = 100 * mics_per_tick / (m_tempo / m_ppq);
@@ -460,45 +410,47 @@ void MidiHandler::Step() {
   }
 
   while (!m_tick_countdown && !m_track_complete) {
-    // running status, new events always have top bit
-    if (*m_seq_ptr & 0x80) {
-      m_status = *m_seq_ptr;
-      m_seq_ptr++;
-    }
+    // a copy, running an AME script can decode more events.
+    const Event ev = m_seq->At(m_event++);
 
-    switch (m_status >> 4) {
-      case 0x8:
-        NoteOff();
+    switch (ev.type) {
+      case Event::Type::NoteOff:
+        NoteOff(ev);
         break;
-      case 0x9:
-        NoteOn();
+      case Event::Type::NoteOn:
+        NoteOn(ev);
         break;
-      case 0xB:
-        ControllerChange();
+      case Event::Type::Controller:
+        ControllerChange(ev);
         break;
-      case 0xD:
-        ChannelPressure();
+      case Event::Type::ChannelPressure:
+        ChannelPressure(ev);
         break;
-      case 0xC:
-        ProgramChange();
+      case Event::Type::ProgramChange:
+        ProgramChange(ev);
         break;
-      case 0xE:
-        ChannelPitch();
+      case Event::Type::PitchBend:
+        ChannelPitch(ev);
         break;
-      case 0xF:
-        // normal meta-event
-        if (m_status == 0xFF) {
-          MetaEvent();
-          break;
-        }
-        if (m_status == 0xF0) {
-          SystemEvent();
-          break;
+      case Event::Type::Tempo:
+        m_tempo = ev.value;
+        m_ppt = 100 * mics_per_tick / (m_tempo / m_ppq);
+        break;
+      case Event::Type::Meta:
+        break;
+      case Event::Type::EndOfTrack:
+        EndOfTrack();
+        break;
+      case Event::Type::Ame:
+        SystemEvent(ev);
+        break;
+      case Event::Type::Invalid:
+        if (ev.status == 0xF0) {
+          throw MidiError(fmt::format("Unknown system message {:02x}", ev.data[0]));
         }
-        [[fallthrough]];
-      default:
-        throw MidiError(fmt::format("invalid status {}", m_status));
-        return;
+        throw MidiError(fmt::format("invalid status {}", ev.status));
+      case Event::Type::EndOfData:
+        throw MidiError("sequence ran past the end of the data");
     }
 
     NewDelta();
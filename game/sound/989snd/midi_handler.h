@@ -99,9 +99,8 @@ class MidiHandler : public SoundHandler {
   std::array<s16, 16> m_pitch_bend{};
   u8* m_sample_data{nullptr};
 
-  u8* m_seq_data_start{nullptr};
-  u8* m_seq_ptr{nullptr};
-  u8 m_status{0};
+  MidiSequence* m_seq{nullptr};
+  u32 m_event{0};  // the next event to run
   u32 m_tempo{500000};
   u32 m_ppq{480};
   u32 m_time{0};
@@ -120,15 +119,14 @@ class MidiHandler : public SoundHandler {
   void Step();
   void NewDelta();
 
-  void NoteOn();
-  void NoteOff();
-  void ControllerChange();
-  void ChannelPressure();
-  void ProgramChange();
-  void MetaEvent();
-  void SystemEvent();
-  void ChannelPitch();
-
-  static std::pair<size_t, u32> ReadVLQ(u8* value);
+  using Event = MidiSequence::Event;
+  void NoteOn(const Event& ev);
+  void NoteOff(const Event& ev);
+  void ControllerChange(const Event& ev);
+  void ChannelPressure(const Event& ev);
+  void ProgramChange(const Event& ev);
+  void EndOfTrack();
+  void SystemEvent(const Event& ev);
+  void ChannelPitch(const Event& ev);
 };
 }  // namespace snd
@@ -0,0 +1,148 @@
+// Copyright: 2021 - 2024, Ziemas
+// SPDX-License-Identifier: ISC
+#include "midi_sequence.h"
+
+namespace snd {
+
+static u64 RunKey(u32 offset, u8 status) {
+  return ((u64)offset << 8) | status;
+}
+
+MidiSequence::MidiSequence(u8* data, const u8* end) : m_data(data), m_size(end - data) {
+  Decode(0, 0);
+}
+
+u32 MidiSequence::Find(u32 offset, u8 status) {
+  auto it = m_runs.find(RunKey(offset, status));
+  if (it != m_runs.end()) {
+    return it->second;
+  }
+
+  u32 idx = m_events.size();
+  Decode(offset, status);
+  return idx;
+}
+
+void MidiSequence::Decode(u32 offset, u8 status) {
+  m_runs[RunKey(offset, status)] = m_events.size();
+
+  while (true) {
+    Event ev{};
+    auto has_bytes = [&](u32 count) { return offset + count <= m_size; };
+    auto end_of_data = [&]() {
+      ev.type = Event::Type::EndOfData;
+      ev.status = status;
+      ev.value = offset;
+      m_events.push_back(ev);
+    };
+
+    // delta time
+    if (!has_bytes(1)) {
+      return end_of_data();
+    }
+    ev.delta = m_data[offset] & 0x7f;
+    while (m_data[offset] & 0x80) {
+      offset++;
+      if (!has_bytes(1)) {
+        return end_of_data();
+      }
+      ev.delta = (ev.delta << 7) + (m_data[offset] & 0x7f);
+    }
+    offset++;
+
+    // running status, new events always have top bit
+    if (!has_bytes(1)) {
+      return end_of_data();
+    }
+    if (m_data[offset] & 0x80) {
+      status = m_data[offset++];
+    }
+    ev.status = status;
+
+    u32 length = 0;
+    switch (status >> 4) {
+      case 0x8:
+        ev.type = Event::Type::NoteOff;
+        length = 2;
+        break;
+      case 0x9:
+        ev.type = Event::Type::NoteOn;
+        length = 2;
+        break;
+      case 0xB:
+        ev.type = Event::Type::Controller;
+        length = 2;
+        break;
+      case 0xD:
+        ev.type = Event::Type::ChannelPressure;
+        length = 1;
+        break;
+      case 0xC:
+        ev.type = Event::Type::ProgramChange;
+        length = 1;
+        break;
+      case 0xE:
+        ev.type = Event::Type::PitchBend;
+        length = 2;
+        break;
+      case 0xF:
+        if (status == 0xFF) {
+          if (!has_bytes(2)) {
+            return end_of_data();
+          }
+          ev.data[0] = m_data[offset];
+          if (ev.data[0] == 0x2f) {
+            ev.type = Event::Type::EndOfTrack;
+            m_events.push_back(ev);
+            return;
+          }
+          length = m_data[offset + 1] + 2;
+          if (!has_bytes(length)) {
+            return end_of_data();
+          }
+          if (ev.data[0] == 0x51) {
+            ev.type = Event::Type::Tempo;
+            ev.value = (m_data[offset + 2] << 16) | (m_data[offset + 3] << 8) | m_data[offset + 4];
+          } else {
+            ev.type = Event::Type::Meta;
+          }
+          offset += length;
+          m_events.push_back(ev);
+          continue;
+        }
+        if (status == 0xF0) {
+          ev.data[0] = m_data[offset];
+          if (ev.data[0] == 0x75) {
+            // where the script ends depends on the script, so stop here.
+            ev.type = Event::Type::Ame;
+            ev.value = offset + 1;
+            m_events.push_back(ev);
+            return;
+          }
+        }
+        [[fallthrough]];
+      default:
+        ev.type = Event::Type::Invalid;
+        ev.value = offset;
+        m_events.push_back(ev);
+        return;
+    }
+
+    if (!has_bytes(length)) {
+      return end_of_data();
+    }
+    for (u32 i = 0; i < length; i++) {
+      ev.data[i] = m_data[offset + i];
+    }
+    offset += length;
+
+    if (ev.type == Event::Type::NoteOn && ev.data[1] == 0) {
+      ev.type = Event::Type::NoteOff;
+    } else if (ev.type == Event::Type::PitchBend) {
+      ev.value = 0xFFFF * ((ev.data[0] & 0x7f) | ((ev.data[1] & 0x7f) << 7)) / 0x3FFF;
+    }
+    m_events.push_back(ev);
+  }
+}
+
+}  // namespace snd
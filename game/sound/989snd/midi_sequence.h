@@ -0,0 +1,66 @@
+// Copyright: 2021 - 2024, Ziemas
+// SPDX-License-Identifier: ISC
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace snd {
+
+/*!
+ * A MIDI track decoded into events, so the handlers don't parse MIDI bytes on the audio thread.
+ *
+ * AME scripts are left as bytes and run by the AmeHandler, because how much of the stream a script
+ * reads depends on its registers. The events after a script are decoded when the track first
+ * gets there, and looked up by where the script left off after that.
+ *
+ * Only used from the audio thread (or with the player locked).
+ */
+class MidiSequence {
+ public:
+  struct Event {
+    enum class Type : u8 {
+      NoteOff,
+      NoteOn,
+      Controller,
+      ChannelPressure,
+      ProgramChange,
+      PitchBend,
+      Tempo,
+      EndOfTrack,
+      Meta,     // other meta events, ignored
+      Ame,      // value is the offset of the script
+      Invalid,  // the handler errors when it gets here
+      EndOfData,
+    };
+
+    Type type;
+    u8 status;
+    u8 data[2];
+    u32 delta;  // midi ticks to wait before this event
+    u32 value;
+  };
+
+  MidiSequence(u8* data, const u8* end);
+
+  /*!
+   * Get the index of the event whose delta time starts at offset, decoding from there if this is
+   * the first time. status is the running status at that point.
+   */
+  u32 Find(u32 offset, u8 status);
+  const Event& At(u32 idx) const { return m_events[idx]; }
+  u8* Data() const { return m_data; }
+
+ private:
+  void Decode(u32 offset, u8 status);
+
+  u8* m_data;
+  u32 m_size;
+  std::vector<Event> m_events;
+  // offset and status of the start of each decoded run, to the first event of the run
+  std::unordered_map<u64, u32> m_runs;
+};
+
+}  // namespace snd
@@ -1,8 +1,10 @@
 #pragma once
+#include <memory>
 #include <span>
 #include <variant>
 #include <vector>
 
+#include "midi_sequence.h"
 #include "soundbank.h"
 
 namespace snd {
@@ -16,6 +18,8 @@ struct Midi {
   u8* DataStart;
   u32 Tempo;
   s32 PPQ;
+  // DataStart decoded into events, shared by the handlers playing it.
+  std::shared_ptr<MidiSequence> Sequence;
 };
 
 struct MidiSegment : Midi {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: ISC
 #include "player.h"
 
+#include <algorithm>
 #include <fstream>
 
 #include "sfxblock.h"
@@ -13,14 +14,19 @@
 #include <combaseapi.h>
 #include <windows.h>
 #endif
+#include "common/global_profiler/GlobalProfiler.h"
 #include "common/log/log.h"
+#include "common/util/Assert.h"
 
 namespace snd {
 
 u8 g_global_excite = 0;
 
-Player::Player() : mVmanager(mSynth) {
-  InitCubeb();
+Player::Player(bool open_device, u32 latency) : mVmanager(mSynth, mSampleCache) {
+  mPinnedLatency = latency;
+  if (open_device) {
+    InitCubeb();
+  }
 }
 
 Player::~Player() {
@@ -40,45 +46,164 @@ void Player::InitCubeb() {
 
   cubeb_init(&mCtx, "OpenGOAL", nullptr);
 
-  cubeb_stream_params outparam = {};
-  outparam.channels = 2;
-  outparam.format = CUBEB_SAMPLE_S16LE;
-  outparam.rate = 48000;
-  outparam.layout = CUBEB_LAYOUT_STEREO;
-  outparam.prefs = CUBEB_STREAM_PREF_NONE;
-
   s32 err = 0;
   u32 latency = 0;
+  auto outparam = StreamParams();
   err = cubeb_get_min_latency(mCtx, &outparam, &latency);
   if (err != CUBEB_OK) {
     lg::error("Cubeb init failed");
     return;
   }
+  mMinLatency = latency;
 
-  err = cubeb_stream_init(mCtx, &mStream, "OpenGOAL", nullptr, nullptr, nullptr, &outparam, latency,
-                          &sound_callback, &state_callback, this);
+  std::scoped_lock lock(mStreamLock);
+  if (!OpenStream(mPinnedLatency ? std::max(mPinnedLatency, mMinLatency) : mMinLatency)) {
+    return;
+  }
+  mLatencyThread = std::thread(&Player::LatencyThread, this);
+}
+
+void Player::DestroyCubeb() {
+  if (mLatencyThread.joinable()) {
+    {
+      std::scoped_lock lock(mStreamLock);
+      mStopLatencyThread = true;
+    }
+    mLatencyCv.notify_all();
+    mLatencyThread.join();
+  }
+  {
+    std::scoped_lock lock(mStreamLock);
+    CloseStream();
+  }
+  if (mCtx) {
+    cubeb_destroy(mCtx);
+    mCtx = nullptr;
+  }
+#ifdef _WIN32
+  if (m_coinitialized) {
+    CoUninitialize();
+    m_coinitialized = false;
+  }
+#endif
+}
+
+cubeb_stream_params Player::StreamParams() {
+  cubeb_stream_params outparam = {};
+  outparam.channels = 2;
+  outparam.format = CUBEB_SAMPLE_S16LE;
+  outparam.rate = kSampleRate;
+  outparam.layout = CUBEB_LAYOUT_STEREO;
+  outparam.prefs = CUBEB_STREAM_PREF_NONE;
+  return outparam;
+}
+
+/*!
+ * Open and start the output stream with a latency in frames. The stream lock must be held.
+ */
+bool Player::OpenStream(u32 latency) {
+  auto outparam = StreamParams();
+  s32 err = cubeb_stream_init(mCtx, &mStream, "OpenGOAL", nullptr, nullptr, nullptr, &outparam,
+                              latency, &sound_callback, &state_callback, this);
   if (err != CUBEB_OK) {
+    mStream = nullptr;
     lg::error("Cubeb init failed");
-    return;
+    return false;
+  }
+
+  {
+    std::scoped_lock lock(mTickLock);
+    mLatency = latency;
+    mStats.latency_frames = latency;
+    mStats.latency_ms = latency * 1000.f / kSampleRate;
+    // the gap since the last callback of the old stream isn't a late callback.
+    mLastCallback = {};
   }
 
   err = cubeb_stream_start(mStream);
   if (err != CUBEB_OK) {
     lg::error("Cubeb init failed");
+    return false;
+  }
+  return true;
+}
+
+void Player::CloseStream() {
+  // this waits for the callback, so mTickLock must not be held.
+  if (mStream) {
+    cubeb_stream_stop(mStream);
+    cubeb_stream_destroy(mStream);
+    mStream = nullptr;
+  }
+}
+
+void Player::SetLatency(u32 frames) {
+  std::scoped_lock lock(mStreamLock);
+  mPinnedLatency = frames;
+  if (!mCtx) {
     return;
   }
+  u32 target = frames ? std::max(frames, mMinLatency) : mMinLatency;
+  if (mStream && target != mLatency) {
+    lg::info("Audio latency set to {} frames", target);
+    CloseStream();
+    OpenStream(target);
+  }
 }
 
-void Player::DestroyCubeb() {
-  cubeb_stream_stop(mStream);
-  cubeb_stream_destroy(mStream);
-  cubeb_destroy(mCtx);
-#ifdef _WIN32
-  if (m_coinitialized) {
-    CoUninitialize();
-    m_coinitialized = false;
+/*!
+ * Unless the latency is pinned, reopen the stream with more latency after an overrun or a late
+ * callback, and with less latency after a long time without either.
+ */
+void Player::LatencyThread() {
+  // callbacks that used more than half of the period. Too close to the limit to lower the latency.
+  auto busy_callbacks = [](const PlayerStats& stats) {
+    return stats.histogram[3] + stats.histogram[4] + stats.histogram[5];
+  };
+
+  std::unique_lock lock(mStreamLock);
+  PlayerStats last = GetStats();
+  int calm_windows = 0;
+  // the lowest latency that had problems. We don't try to go back down to it.
+  u32 bad_latency = 0;
+
+  while (!mLatencyCv.wait_for(lock, kLatencyWindow, [&] { return mStopLatencyThread; })) {
+    PlayerStats stats = GetStats();
+    // also skip the window the stats were reset in.
+    if (mPinnedLatency || !mStream || stats.callbacks < last.callbacks) {
+      last = stats;
+      continue;
+    }
+
+    u64 problems =
+        (stats.overruns - last.overruns) + (stats.late_callbacks - last.late_callbacks);
+    u64 busy = busy_callbacks(stats) - busy_callbacks(last);
+    last = stats;
+
+    u32 target = mLatency;
+    if (problems) {
+      calm_windows = 0;
+      bad_latency = std::max(bad_latency, mLatency);
+      target = std::max(mLatency, std::min(mLatency * 2, kMaxLatency));
+    } else if (busy) {
+      calm_windows = 0;
+    } else if (++calm_windows >= kCalmWindowsToLower) {
+      calm_windows = 0;
+      target = std::max(mLatency / 2, mMinLatency);
+      if (target <= bad_latency) {
+        target = mLatency;
+      }
+    }
+
+    if (target != mLatency) {
+      lg::info("Audio latency {} -> {} frames", mLatency, target);
+      CloseStream();
+      if (!OpenStream(target)) {
+        return;
+      }
+      last = GetStats();
+    }
   }
-#endif
 }
 
 long Player::sound_callback([[maybe_unused]] cubeb_stream* stream,
@@ -95,10 +220,15 @@ void Player::state_callback([[maybe_unused]] cubeb_stream* stream,
                             [[maybe_unused]] cubeb_state state) {}
 
 void Player::Tick(s16Output* stream, int samples) {
+  auto p = scoped_prof("snd-tick");
+  const auto start = std::chrono::steady_clock::now();
   std::scoped_lock lock(mTickLock);
+  const auto locked = std::chrono::steady_clock::now();
+  const int frames = samples;
+  DrainCommands();
   static int htick = 200;
   static int stick = 48000;
-  for (int i = 0; i < samples; i++) {
+  while (samples > 0) {
     // The handlers expect to tick at 240hz
     // 48000/240 = 200
     if (htick == 200) {
@@ -123,14 +253,77 @@ void Player::Tick(s16Output* stream, int samples) {
       stick = 0;
     }
 
-    stick++;
-    htick++;
-    *stream++ = mSynth.Tick();
+    // mix up to the next handler tick in one block
+    int block = std::min(samples, 200 - htick);
+    mSynth.Tick(stream, block);
+    stream += block;
+    samples -= block;
+    stick += block;
+    htick += block;
+  }
+
+  UpdateStats(frames, start, locked);
+}
+
+void Player::UpdateStats(int frames,
+                         std::chrono::steady_clock::time_point start,
+                         std::chrono::steady_clock::time_point locked) {
+  using micros = std::chrono::duration<float, std::micro>;
+  const auto end = std::chrono::steady_clock::now();
+  const float tick_us = micros(end - start).count();
+  const float lock_wait_us = micros(locked - start).count();
+  const float period_us = frames * 1.e6f / kSampleRate;
+  auto& stats = mStats;
+
+  if (stats.callbacks && micros(start - mLastCallback).count() > 2 * stats.period_us) {
+    stats.late_callbacks++;
+  }
+  mLastCallback = start;
+
+  if (tick_us > period_us) {
+    stats.overruns++;
+    prof().instant_event("snd-overrun");
+  }
+
+  const float fraction = period_us > 0 ? tick_us / period_us : 0;
+  int bucket = 0;
+  while (bucket < PlayerStats::kNumBuckets - 1 &&
+         fraction >= PlayerStats::kBucketLimits[bucket]) {
+    bucket++;
   }
+  stats.histogram[bucket]++;
+
+  stats.avg_tick_us =
+      stats.callbacks ? stats.avg_tick_us + (tick_us - stats.avg_tick_us) * 0.05f : tick_us;
+  stats.callbacks++;
+  stats.frames += frames;
+  stats.period_us = period_us;
+  stats.last_tick_us = tick_us;
+  stats.max_tick_us = std::max(stats.max_tick_us, tick_us);
+  stats.last_lock_wait_us = lock_wait_us;
+  stats.max_lock_wait_us = std::max(stats.max_lock_wait_us, lock_wait_us);
+  stats.total_lock_wait_us += lock_wait_us;
+  stats.active_voices = mSynth.ActiveVoices();
+  stats.active_handlers = mHandlers.size();
+}
+
+PlayerStats Player::GetStats() {
+  std::scoped_lock lock(mTickLock);
+  return mStats;
+}
+
+void Player::ResetStats() {
+  std::scoped_lock lock(mTickLock);
+  auto latency_frames = mStats.latency_frames;
+  auto latency_ms = mStats.latency_ms;
+  mStats = {};
+  mStats.latency_frames = latency_frames;
+  mStats.latency_ms = latency_ms;
 }
 
 u32 Player::PlaySound(BankHandle bank_id, u32 sound_id, s32 vol, s32 pan, s32 pm, s32 pb) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   auto bank = mLoader.GetBankByHandle(bank_id);
   if (bank == nullptr) {
     lg::error("play_sound: Bank {} does not exist", static_cast<void*>(bank_id));
@@ -159,6 +352,7 @@ u32 Player::PlaySound(BankHandle bank_id, u32 sound_id, s32 vol, s32 pan, s32 pm
 
 void Player::DebugPrintAllSoundsInBank(BankHandle bank_id) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   auto* bank = mLoader.GetBankByHandle(bank_id);
   if (!bank) {
     lg::error("DebugPrintAllSoundsInBank: invalid bank");
@@ -175,6 +369,7 @@ u32 Player::PlaySoundByName(BankHandle bank_id,
                             s32 pm,
                             s32 pb) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   SoundBank* bank = nullptr;
   if (bank_id == 0 && bank_name != nullptr) {
     bank = mLoader.GetBankByName(bank_name);
@@ -200,19 +395,12 @@ u32 Player::PlaySoundByName(BankHandle bank_id,
 }
 
 void Player::StopSound(u32 sound_id) {
-  std::scoped_lock lock(mTickLock);
-  auto handler = mHandlers.find(sound_id);
-  if (handler == mHandlers.end())
-    return;
-
-  handler->second->Stop();
-
-  // m_handle_allocator.free_id(sound_id);
-  // m_handlers.erase(sound_id);
+  Submit({Command::Type::StopSound, sound_id, 0, 0});
 }
 
 u32 Player::GetSoundID(u32 sound_handle) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   auto handler = mHandlers.find(sound_handle);
   if (handler == mHandlers.end())
     return -1;
@@ -220,18 +408,12 @@ u32 Player::GetSoundID(u32 sound_handle) {
 }
 
 void Player::SetSoundReg(u32 sound_id, u8 reg, u8 value) {
-  std::scoped_lock lock(mTickLock);
-  if (mHandlers.find(sound_id) == mHandlers.end()) {
-    // fmt::print("set_midi_reg: Handler {} does not exist\n", sound_id);
-    return;
-  }
-
-  auto* handler = mHandlers.at(sound_id).get();
-  handler->SetRegister(reg, value);
+  Submit({Command::Type::SetSoundReg, sound_id, reg, value});
 }
 
 bool Player::SoundStillActive(u32 sound_id) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   auto handler = mHandlers.find(sound_id);
   if (handler == mHandlers.end())
     return false;
@@ -241,31 +423,18 @@ bool Player::SoundStillActive(u32 sound_id) {
 }
 
 void Player::SetMasterVolume(u32 group, s32 volume) {
-  std::scoped_lock lock(mTickLock);
-  if (volume > 0x400)
-    volume = 0x400;
-
-  if (volume < 0)
-    volume = 0;
-
-  if (group == 15)
-    return;
-
-  mVmanager.SetMasterVol(group, volume);
-
-  // Master volume
-  if (group == 16) {
-    mSynth.SetMasterVol(0x3ffff * volume / 0x400);
-  }
+  Submit({Command::Type::SetMasterVolume, group, volume, 0});
 }
 
 BankHandle Player::LoadBank(std::span<u8> bank) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   return mLoader.BankLoad(bank);
 }
 
 void Player::UnloadBank(BankHandle bank_handle) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   auto* bank = mLoader.GetBankByHandle(bank_handle);
   if (bank == nullptr)
     return;
@@ -279,81 +448,46 @@ void Player::UnloadBank(BankHandle bank_handle) {
     }
   }
 
+  mSampleCache.Invalidate(bank->Samples.data(), bank->Samples.data() + bank->Samples.size());
   mLoader.UnloadBank(bank_handle);
 }
 
 void Player::SetPanTable(VolPair* pantable) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   mVmanager.SetPanTable(pantable);
 }
 
 void Player::SetPlaybackMode(s32 mode) {
-  std::scoped_lock lock(mTickLock);
-  mVmanager.SetPlaybackMode(mode);
+  Submit({Command::Type::SetPlaybackMode, 0, mode, 0});
 }
 
 void Player::PauseSound(s32 sound_id) {
-  std::scoped_lock lock(mTickLock);
-  auto handler = mHandlers.find(sound_id);
-  if (handler == mHandlers.end())
-    return;
-
-  handler->second->Pause();
+  Submit({Command::Type::PauseSound, (u32)sound_id, 0, 0});
 }
 
 void Player::ContinueSound(s32 sound_id) {
-  std::scoped_lock lock(mTickLock);
-  auto handler = mHandlers.find(sound_id);
-  if (handler == mHandlers.end())
-    return;
-
-  handler->second->Unpause();
+  Submit({Command::Type::ContinueSound, (u32)sound_id, 0, 0});
 }
 
 void Player::PauseAllSoundsInGroup(u8 group) {
-  std::scoped_lock lock(mTickLock);
-
-  for (auto& h : mHandlers) {
-    if ((1 << h.second->Group()) & group) {
-      h.second->Pause();
-    }
-  }
+  Submit({Command::Type::PauseAllSoundsInGroup, 0, group, 0});
 }
 
 void Player::ContinueAllSoundsInGroup(u8 group) {
-  std::scoped_lock lock(mTickLock);
-
-  for (auto& h : mHandlers) {
-    if ((1 << h.second->Group()) & group) {
-      h.second->Unpause();
-    }
-  }
+  Submit({Command::Type::ContinueAllSoundsInGroup, 0, group, 0});
 }
 
 void Player::SetSoundVolPan(s32 sound_id, s32 vol, s32 pan) {
-  std::scoped_lock lock(mTickLock);
-  auto handler = mHandlers.find(sound_id);
-  if (handler == mHandlers.end())
-    return;
-
-  handler->second->SetVolPan(vol, pan);
+  Submit({Command::Type::SetSoundVolPan, (u32)sound_id, vol, pan});
 }
 
 void Player::SetSoundPmod(s32 sound_handle, s32 mod) {
-  std::scoped_lock lock(mTickLock);
-  auto handler = mHandlers.find(sound_handle);
-  if (handler == mHandlers.end())
-    return;
-
-  handler->second->SetPMod(mod);
+  Submit({Command::Type::SetSoundPmod, (u32)sound_handle, mod, 0});
 }
 
 void Player::StopAllSounds() {
-  std::scoped_lock lock(mTickLock);
-  for (auto it = mHandlers.begin(); it != mHandlers.end();) {
-    mHandleAllocator.FreeId(it->first);
-    it = mHandlers.erase(it);
-  }
+  Submit({Command::Type::StopAllSounds, 0, 0, 0});
 }
 
 s32 Player::GetSoundUserData(BankHandle block_handle,
@@ -362,6 +496,7 @@ s32 Player::GetSoundUserData(BankHandle block_handle,
                              char* sound_name,
                              SFXUserData* dst) {
   std::scoped_lock lock(mTickLock);
+  DrainCommands();
   SoundBank* bank = nullptr;
   if (block_handle == nullptr && block_name != nullptr) {
     bank = mLoader.GetBankByName(block_name);
@@ -398,4 +533,95 @@ s32 Player::GetSoundUserData(BankHandle block_handle,
   return 0;
 }
 
+void Player::Submit(const Command& cmd) {
+  if (mCommands.Push(cmd)) {
+    return;
+  }
+
+  // The ring is full, so the audio thread is behind. Run everything that's queued, then this
+  // command, so they still happen in order.
+  std::scoped_lock lock(mTickLock);
+  DrainCommands();
+  ApplyCommand(cmd);
+}
+
+void Player::DrainCommands() {
+  Command cmd;
+  while (mCommands.Pop(&cmd)) {
+    ApplyCommand(cmd);
+  }
+}
+
+void Player::ApplyCommand(const Command& cmd) {
+  using Type = Command::Type;
+  switch (cmd.type) {
+    case Type::PauseAllSoundsInGroup:
+    case Type::ContinueAllSoundsInGroup:
+      for (auto& h : mHandlers) {
+        if ((1 << h.second->Group()) & cmd.arg0) {
+          if (cmd.type == Type::PauseAllSoundsInGroup) {
+            h.second->Pause();
+          } else {
+            h.second->Unpause();
+          }
+        }
+      }
+      return;
+    case Type::SetMasterVolume: {
+      s32 volume = std::clamp(cmd.arg0, 0, 0x400);
+      if (cmd.handle == 15)
+        return;
+
+      mVmanager.SetMasterVol(cmd.handle, volume);
+
+      // Master volume
+      if (cmd.handle == 16) {
+        mSynth.SetMasterVol(0x3ffff * volume / 0x400);
+      }
+      return;
+    }
+    case Type::SetPlaybackMode:
+      mVmanager.SetPlaybackMode(cmd.arg0);
+      return;
+    case Type::StopAllSounds:
+      for (auto it = mHandlers.begin(); it != mHandlers.end();) {
+        mHandleAllocator.FreeId(it->first);
+        it = mHandlers.erase(it);
+      }
+      return;
+    default:
+      break;
+  }
+
+  // the rest act on a single sound
+  auto handler = mHandlers.find(cmd.handle);
+  if (handler == mHandlers.end())
+    return;
+
+  switch (cmd.type) {
+    case Type::StopSound:
+      handler->second->Stop();
+      // m_handle_allocator.free_id(sound_id);
+      // m_handlers.erase(sound_id);
+      break;
+    case Type::PauseSound:
+      handler->second->Pause();
+      break;
+    case Type::ContinueSound:
+      handler->second->Unpause();
+      break;
+    case Type::SetSoundVolPan:
+      handler->second->SetVolPan(cmd.arg0, cmd.arg1);
+      break;
+    case Type::SetSoundPmod:
+      handler->second->SetPMod(cmd.arg0);
+      break;
+    case Type::SetSoundReg:
+      handler->second->SetRegister(cmd.arg0, cmd.arg1);
+      break;
+    default:
+      ASSERT_NOT_REACHED();
+  }
+}
+
 }  // namespace snd
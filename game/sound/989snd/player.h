@@ -2,15 +2,21 @@
 // SPDX-License-Identifier: ISC
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <span>
+#include <thread>
 #include <vector>
 
 #include "ame_handler.h"
+#include "command_ring.h"
 #include "handle_allocator.h"
 #include "loader.h"
+#include "player_stats.h"
+#include "sample_cache.h"
 #include "sound_handler.h"
 
 #include "common/common_types.h"
@@ -24,7 +30,11 @@ namespace snd {
 
 class Player {
  public:
-  Player();
+  static constexpr u32 kSampleRate = 48000;
+
+  // without open_device, nothing is played until Render is called.
+  // latency is the output buffer size in frames. 0 picks it automatically.
+  explicit Player(bool open_device = true, u32 latency = 0);
   ~Player();
   Player(const Player&) = delete;
   Player operator=(const Player&) = delete;
@@ -68,13 +78,49 @@ class Player {
                        s32 sound_id,
                        char* sound_name,
                        SFXUserData* dst);
+  // Mix the next samples frames, for running without an audio device.
+  void Render(s16Output* out, int samples) { Tick(out, samples); }
+  PlayerStats GetStats();
+  void ResetStats();
+  // pin the output latency in frames, or 0 to adjust it automatically.
+  void SetLatency(u32 frames);
 
  private:
+  // Calls that don't return anything are queued and run by the audio thread at the start of the
+  // next buffer, so the game threads don't wait for it to finish mixing.
+  struct Command {
+    enum class Type : u8 {
+      StopSound,
+      PauseSound,
+      ContinueSound,
+      PauseAllSoundsInGroup,
+      ContinueAllSoundsInGroup,
+      SetSoundVolPan,
+      SetSoundPmod,
+      SetSoundReg,
+      SetMasterVolume,
+      SetPlaybackMode,
+      StopAllSounds,
+    };
+    Type type;
+    u32 handle;
+    s32 arg0;
+    s32 arg1;
+  };
+
+  void Submit(const Command& cmd);
+  void DrainCommands();
+  void ApplyCommand(const Command& cmd);
+
+  CommandRing<Command, 1024> mCommands;
   std::recursive_mutex mTickLock;  // TODO does not need to recursive with some light restructuring
   IdAllocator mHandleAllocator;
   std::map<u32, std::unique_ptr<SoundHandler>> mHandlers;
 
   void Tick(s16Output* stream, int samples);
+  void UpdateStats(int frames,
+                   std::chrono::steady_clock::time_point start,
+                   std::chrono::steady_clock::time_point locked);
 
 #ifdef _WIN32
   bool m_coinitialized = false;
@@ -82,12 +128,34 @@ class Player {
 
   Loader mLoader;
   Synth mSynth;
+  SampleCache mSampleCache;
   VoiceManager mVmanager;
   s32 mTick{0};
+  PlayerStats mStats;
+  std::chrono::steady_clock::time_point mLastCallback;
 
   cubeb* mCtx{nullptr};
   cubeb_stream* mStream{nullptr};
 
+  // cubeb can't resize the buffer of a running stream, so changing the latency reopens the stream.
+  static constexpr auto kLatencyWindow = std::chrono::seconds(1);
+  static constexpr int kCalmWindowsToLower = 30;
+  static constexpr u32 kMaxLatency = 4096;
+
+  static cubeb_stream_params StreamParams();
+  bool OpenStream(u32 latency);
+  void CloseStream();
+  void LatencyThread();
+
+  // held while opening or closing the stream, and by the latency thread while it's awake.
+  std::mutex mStreamLock;
+  std::condition_variable mLatencyCv;
+  std::thread mLatencyThread;
+  bool mStopLatencyThread{false};
+  u32 mMinLatency{0};
+  u32 mLatency{0};
+  u32 mPinnedLatency{0};
+
   static long sound_callback(cubeb_stream* stream,
                              void* user,
                              const void* input,
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+
+#include "common/common_types.h"
+
+namespace snd {
+
+/*!
+ * Timing of the audio callback, updated by the audio thread at the end of each callback.
+ * The tick time includes waiting for mTickLock.
+ */
+struct PlayerStats {
+  // histogram of tick time as a fraction of the buffer period: <10%, <25%, <50%, <75%, <100%, more.
+  static constexpr int kNumBuckets = 6;
+  static constexpr std::array<float, kNumBuckets - 1> kBucketLimits = {0.1f, 0.25f, 0.5f, 0.75f,
+                                                                       1.f};
+
+  u64 callbacks = 0;
+  u64 frames = 0;
+  // the callback took longer than the audio it produced
+  u64 overruns = 0;
+  // the callback started more than two buffer periods after the last one, so the device probably
+  // ran dry. cubeb doesn't report underruns, so this is a guess.
+  u64 late_callbacks = 0;
+  std::array<u64, kNumBuckets> histogram{};
+
+  float period_us = 0;
+  float last_tick_us = 0;
+  float avg_tick_us = 0;  // moving average
+  float max_tick_us = 0;
+  float last_lock_wait_us = 0;
+  float max_lock_wait_us = 0;
+  double total_lock_wait_us = 0;
+
+  u32 latency_frames = 0;
+  float latency_ms = 0;
+  int active_voices = 0;
+  int active_handlers = 0;
+};
+
+}  // namespace snd
@@ -0,0 +1,63 @@
+#include "sample_cache.h"
+
+#include "../common/voice.h"
+
+namespace snd {
+
+static size_t EntryBytes(const std::shared_ptr<const std::vector<s16>>& decoded) {
+  return decoded ? decoded->size() * sizeof(s16) : 0;
+}
+
+void SampleCache::SetCapacity(size_t bytes) {
+  mCapacity = bytes;
+  Evict();
+}
+
+std::shared_ptr<const std::vector<s16>> SampleCache::Get(const u8* sample) {
+  if (mCapacity == 0 || sample == nullptr) {
+    return nullptr;
+  }
+
+  auto it = mEntries.find(sample);
+  if (it != mEntries.end()) {
+    mLru.splice(mLru.begin(), mLru, it->second.lru);
+    return it->second.decoded;
+  }
+
+  std::shared_ptr<const std::vector<s16>> decoded;
+  auto pcm = Voice::DecodeFirstPass((const u16*)sample, kMaxSampleLength);
+  if (pcm.has_value()) {
+    decoded = std::make_shared<const std::vector<s16>>(std::move(*pcm));
+  }
+
+  mLru.push_front(sample);
+  mEntries.emplace(sample, Entry{decoded, mLru.begin()});
+  mSize += EntryBytes(decoded);
+  Evict();
+
+  // might have been evicted already if it's bigger than the whole cache, that's fine.
+  return decoded;
+}
+
+void SampleCache::Invalidate(const u8* begin, const u8* end) {
+  for (auto it = mEntries.begin(); it != mEntries.end();) {
+    if (it->first >= begin && it->first < end) {
+      mSize -= EntryBytes(it->second.decoded);
+      mLru.erase(it->second.lru);
+      it = mEntries.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void SampleCache::Evict() {
+  while (mSize > mCapacity && !mLru.empty()) {
+    auto it = mEntries.find(mLru.back());
+    mSize -= EntryBytes(it->second.decoded);
+    mEntries.erase(it);
+    mLru.pop_back();
+  }
+}
+
+}  // namespace snd
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace snd {
+
+// Decoded PCM for bank samples, so the voices playing common sounds don't all decode them again.
+// Samples are decoded on first use and the least recently used ones are dropped when the cache is
+// over its capacity. Everything here runs under the player lock.
+class SampleCache {
+ public:
+  static constexpr size_t kDefaultCapacityBytes = 32 * 1024 * 1024;
+  // longer samples are decoded by the voice as they play. 10 seconds at 48khz.
+  static constexpr size_t kMaxSampleLength = 480000;
+
+  // A capacity of 0 disables the cache.
+  void SetCapacity(size_t bytes);
+
+  // Get the decoded samples for the bank sample at this address, or nullptr if it isn't cached.
+  std::shared_ptr<const std::vector<s16>> Get(const u8* sample);
+
+  // Forget every sample in [begin, end), for when a bank is unloaded.
+  void Invalidate(const u8* begin, const u8* end);
+
+ private:
+  struct Entry {
+    // nullptr if the sample was too long to cache.
+    std::shared_ptr<const std::vector<s16>> decoded;
+    std::list<const u8*>::iterator lru;
+  };
+
+  void Evict();
+
+  size_t mCapacity{kDefaultCapacityBytes};
+  size_t mSize{0};
+  std::unordered_map<const u8*, Entry> mEntries;
+  // most recently used first
+  std::list<const u8*> mLru;
+};
+
+}  // namespace snd
@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "common/util/FileUtil.h"
+#include "common/util/Timer.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -13,7 +14,67 @@
 
 #include "common/log/log.h"
 
+/*!
+ * Render seconds of audio without an audio device, as fast as possible. The sounds are started
+ * together and restarted when they finish, checked once per 60hz frame like the game does.
+ */
+int run_bench(const fs::path& file, float seconds, const std::vector<u32>& sounds) {
+  snd::Player player(false);
+  auto file_buf = file_util::read_binary_file(file);
+  auto bankid = player.LoadBank(file_buf);
+
+  constexpr int kFrameSamples = snd::Player::kSampleRate / 60;
+  std::vector<snd::s16Output> buffer(kFrameSamples);
+  std::vector<u32> handles(sounds.size(), 0);
+  const int frames = seconds * 60;
+
+  Timer timer;
+  for (int frame = 0; frame < frames; frame++) {
+    for (size_t i = 0; i < sounds.size(); i++) {
+      if (!handles[i] || !player.SoundStillActive(handles[i])) {
+        handles[i] = player.PlaySound(bankid, sounds[i], 0x400, 0, 0, 0);
+      }
+    }
+    player.Render(buffer.data(), kFrameSamples);
+  }
+  const double elapsed_ms = timer.getMs();
+
+  auto stats = player.GetStats();
+  const double audio_ms = frames * 1000. / 60;
+  printf("rendered %.1f s of audio in %.1f ms (%.1fx realtime)\n", audio_ms / 1000., elapsed_ms,
+         audio_ms / elapsed_ms);
+  printf("tick: avg %.1f us, max %.1f us, period %.0f us, voices %d\n", stats.avg_tick_us,
+         stats.max_tick_us, stats.period_us, stats.active_voices);
+  for (int i = 0; i < snd::PlayerStats::kNumBuckets; i++) {
+    if (i < snd::PlayerStats::kNumBuckets - 1) {
+      printf(" <%3.0f%%: %lld\n", snd::PlayerStats::kBucketLimits[i] * 100,
+             (long long)stats.histogram[i]);
+    } else {
+      printf(" more: %lld\n", (long long)stats.histogram[i]);
+    }
+  }
+  return 0;
+}
+
 int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    printf("usage: sndplay <bank> [sound]\n");
+    printf("       sndplay <bank> bench <seconds> <sound> [sound...]\n");
+    return 1;
+  }
+
+  if (argc > 2 && std::string(argv[2]) == "bench") {
+    if (argc < 5) {
+      printf("bench needs a length in seconds and at least one sound\n");
+      return 1;
+    }
+    std::vector<u32> sounds;
+    for (int i = 4; i < argc; i++) {
+      sounds.push_back(std::atoi(argv[i]));
+    }
+    return run_bench(argv[1], std::atof(argv[3]), sounds);
+  }
+
   snd::Player player;
 
   fs::path file = argv[1];
@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include <optional>
+#include <span>
 #include <string_view>
 
 #include "sound_handler.h"
@@ -53,6 +54,8 @@ class SoundBank {
   BlockFlags Flags;
   u32 BankID;
   s8 BankNum;
+  // the sample data, owned by the derived bank.
+  std::span<const u8> Samples;
 
   virtual std::optional<std::unique_ptr<SoundHandler>>
   MakeHandler(VoiceManager& vm, u32 sound_id, s32 vol, s32 pan, s32 pm, s32 pb, s32 current_tick) {
@@ -9,7 +9,8 @@
 #include "../common/voice.h"
 
 namespace snd {
-VoiceManager::VoiceManager(Synth& synth) : mSynth(synth) {
+VoiceManager::VoiceManager(Synth& synth, SampleCache& sample_cache)
+    : mSynth(synth), mSampleCache(sample_cache) {
   mPanTable = normalPanTable;
   mMasterVol.fill(0x400);
   mGroupDuck.fill(0x10000);
@@ -36,6 +37,7 @@ void VoiceManager::StartTone(std::shared_ptr<VagVoice> voice) {
   voice->SetAsdr2(voice->tone.ADSR2);
 
   voice->SetSample((u16*)(voice->tone.Sample));
+  voice->SetDecodedSample(mSampleCache.Get(voice->tone.Sample));
 
   voice->KeyOn();
 
@@ -8,6 +8,7 @@
 
 #include "game/sound/common/synth.h"
 #include "game/sound/common/voice.h"
+#include "game/sound/989snd/sample_cache.h"
 
 namespace snd {
 
@@ -47,7 +48,7 @@ class VagVoice : public Voice {
 
 class VoiceManager {
  public:
-  VoiceManager(Synth& synth);
+  VoiceManager(Synth& synth, SampleCache& sample_cache);
   void StartTone(std::shared_ptr<VagVoice> voice);
   void Pause(std::shared_ptr<VagVoice> voice);
   void Unpause(std::shared_ptr<VagVoice> voice);
@@ -70,6 +71,7 @@ class VoiceManager {
 
  private:
   Synth& mSynth;
+  SampleCache& mSampleCache;
 
   std::list<std::weak_ptr<VagVoice>> mVoices;
   void CleanVoices() {
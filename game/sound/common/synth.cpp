@@ -2,28 +2,75 @@
 // SPDX-License-Identifier: ISC
 #include "synth.h"
 
+#include <algorithm>
 #include <stdexcept>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define SYNTH_X86
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SYNTH_NEON
+#include <arm_neon.h>
+#endif
+
 namespace snd {
 
 static s16 ApplyVolume(s16 sample, s32 volume) {
   return (sample * volume) >> 15;
 }
 
+// out += in, saturating. This is the same as adding the voices one sample at a time.
+static void MixSaturating(s16Output* out, const s16Output* in, int samples) {
+  static_assert(sizeof(s16Output) == 2 * sizeof(s16));
+  s16* dst = &out->left;
+  const s16* src = &in->left;
+  int count = samples * 2;
+  int i = 0;
+#if defined(SYNTH_X86)
+  for (; i + 8 <= count; i += 8) {
+    __m128i a = _mm_loadu_si128((const __m128i*)(dst + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(src + i));
+    _mm_storeu_si128((__m128i*)(dst + i), _mm_adds_epi16(a, b));
+  }
+#elif defined(SYNTH_NEON)
+  for (; i + 8 <= count; i += 8) {
+    vst1q_s16(dst + i, vqaddq_s16(vld1q_s16(dst + i), vld1q_s16(src + i)));
+  }
+#endif
+  for (; i < count; i++) {
+    dst[i] = static_cast<s16>(std::clamp<s32>(dst[i] + src[i], INT16_MIN, INT16_MAX));
+  }
+}
+
 s16Output Synth::Tick() {
   s16Output out{};
+  Tick(&out, 1);
+  return out;
+}
 
-  mVoices.remove_if([](std::shared_ptr<Voice>& v) { return v->Dead(); });
-  for (auto& v : mVoices) {
-    out += v->Run();
-  }
+void Synth::Tick(s16Output* out, int samples) {
+  while (samples > 0) {
+    int block = std::min(samples, kBlockSize);
+    std::fill(out, out + block, s16Output{});
 
-  out.left = ApplyVolume(out.left, mVolume.left.Get());
-  out.right = ApplyVolume(out.right, mVolume.right.Get());
+    mVoices.remove_if([](std::shared_ptr<Voice>& v) { return v->Dead(); });
+    mActiveVoices = 0;
+    for (auto& v : mVoices) {
+      v->Run(mVoiceBuf.data(), block);
+      MixSaturating(out, mVoiceBuf.data(), block);
+      mActiveVoices += v->Playing();
+    }
 
-  mVolume.Run();
+    // the master volume can sweep, so it's still done per sample.
+    for (int i = 0; i < block; i++) {
+      out[i].left = ApplyVolume(out[i].left, mVolume.left.Get());
+      out[i].right = ApplyVolume(out[i].right, mVolume.right.Get());
+      mVolume.Run();
+    }
 
-  return out;
+    out += block;
+    samples -= block;
+  }
 }
 
 void Synth::AddVoice(std::shared_ptr<Voice> voice) {
@@ -1,6 +1,7 @@
 // Copyright: 2021 - 2024, Ziemas
 // SPDX-License-Identifier: ISC
 #pragma once
+#include <array>
 #include <forward_list>
 #include <memory>
 #include <unordered_map>
@@ -26,12 +27,20 @@ class Synth {
   }
 
   s16Output Tick();
+  // Mix the next samples frames into out. Voices are added and removed between blocks.
+  void Tick(s16Output* out, int samples);
   void AddVoice(std::shared_ptr<Voice> voice);
   void SetMasterVol(u32 volume);
+  // voices that were playing in the last block
+  int ActiveVoices() const { return mActiveVoices; }
 
  private:
+  static constexpr int kBlockSize = 256;
+
   std::forward_list<std::shared_ptr<Voice>> mVoices;
+  std::array<s16Output, kBlockSize> mVoiceBuf{};
 
   VolumePair mVolume{};
+  int mActiveVoices{0};
 };
 }  // namespace snd
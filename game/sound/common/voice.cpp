@@ -29,24 +29,21 @@ void Voice::DecodeSamples() {
   if (mADSR.GetPhase() == ADSR::Phase::Stopped) {
     for (int i = 0; i < 4; i++)
       mDecodeBuf.Push(0);
+  } else if (mUseDecoded) {
+    // mNAX is on the first pass, so it maps directly to the decoded samples
+    size_t idx = ((mNAX >> 3) * 7 + (mNAX & 0x7) - 1) * 4;
+    const s16* samples = mDecoded->data() + idx;
+    for (int i = 0; i < 4; i++) {
+      mDecodeBuf.Push(samples[i]);
+    }
+    // keep the history up to date for when we leave the cached part.
+    mDecodeHist2 = samples[2];
+    mDecodeHist1 = samples[3];
   } else {
-    u32 data = mSample[mNAX];
+    s16 samples[4];
+    DecodeWord(mSample[mNAX], mCurHeader, mDecodeHist1, mDecodeHist2, samples);
     for (int i = 0; i < 4; i++) {
-      s32 sample = (s16)((data & 0xF) << 12);
-      sample >>= mCurHeader.Shift.get();
-
-      // TODO do the right thing for invalid shift/filter values
-      sample += (adpcm_coefs[mCurHeader.Filter.get()][0] * mDecodeHist1) >> 6;
-      sample += (adpcm_coefs[mCurHeader.Filter.get()][1] * mDecodeHist2) >> 6;
-
-      // We do get overflow here otherwise, should we?
-      sample = std::clamp<s32>(sample, INT16_MIN, INT16_MAX);
-
-      mDecodeHist2 = mDecodeHist1;
-      mDecodeHist1 = static_cast<s16>(sample);
-
-      mDecodeBuf.Push(static_cast<s16>(sample));
-      data >>= 4;
+      mDecodeBuf.Push(samples[i]);
     }
   }
 
@@ -56,6 +53,7 @@ void Voice::DecodeSamples() {
     if (mCurHeader.LoopEnd.get()) {
       mNAX = mLSA;
       mENDX = true;
+      mUseDecoded = false;
 
       if (!mCurHeader.LoopRepeat.get()) {
         // Need to inhibit stopping here in noise is on
@@ -71,6 +69,49 @@ void Voice::DecodeSamples() {
   }
 }
 
+void Voice::DecodeWord(u16 data, ADPCMHeader header, s16& hist1, s16& hist2, s16* out) {
+  for (int i = 0; i < 4; i++) {
+    s32 sample = (s16)((data & 0xF) << 12);
+    sample >>= header.Shift.get();
+
+    // TODO do the right thing for invalid shift/filter values
+    sample += (adpcm_coefs[header.Filter.get()][0] * hist1) >> 6;
+    sample += (adpcm_coefs[header.Filter.get()][1] * hist2) >> 6;
+
+    // We do get overflow here otherwise, should we?
+    sample = std::clamp<s32>(sample, INT16_MIN, INT16_MAX);
+
+    hist2 = hist1;
+    hist1 = static_cast<s16>(sample);
+
+    out[i] = static_cast<s16>(sample);
+    data >>= 4;
+  }
+}
+
+std::optional<std::vector<s16>> Voice::DecodeFirstPass(const u16* sample, size_t max_samples) {
+  std::vector<s16> result;
+  s16 hist1 = 0;
+  s16 hist2 = 0;
+  for (u32 block = 0;; block++) {
+    if (result.size() + 28 > max_samples) {
+      return std::nullopt;
+    }
+
+    ADPCMHeader header;
+    header.bits = sample[block * 8];
+    for (u32 word = 1; word < 8; word++) {
+      s16 out[4];
+      DecodeWord(sample[block * 8 + word], header, hist1, hist2, out);
+      result.insert(result.end(), out, out + 4);
+    }
+
+    if (header.LoopEnd.get()) {
+      return result;
+    }
+  }
+}
+
 void Voice::UpdateBlockHeader() {
   mCurHeader.bits = mSample[mNAX & ~0x7];
   if (mCurHeader.LoopStart.get() && !mCustomLoop)
@@ -94,6 +135,8 @@ void Voice::KeyOn() {
   mDecodeHist2 = 0;
   mDecodeBuf.Reset();
   mCustomLoop = false;
+  // the decoded samples start at the beginning of the sample, with no history.
+  mUseDecoded = mDecoded && mSSA == 0;
   // Console.WriteLn("SPU[%d]:VOICE[%d] Key On, SSA %08x", m_SPU.m_Id, m_Id, m_SSA);
 }
 
@@ -134,4 +177,10 @@ s16Output Voice::Run() {
 
   return s16Output{left, right};
 }
+
+void Voice::Run(s16Output* out, int samples) {
+  for (int i = 0; i < samples; i++) {
+    out[i] = Run();
+  }
+}
 }  // namespace snd
@@ -1,6 +1,10 @@
 // Copyright: 2021 - 2024, Ziemas
 // SPDX-License-Identifier: ISC
 #pragma once
+#include <memory>
+#include <optional>
+#include <vector>
+
 #include "bitfield.h"
 #include "envelope.h"
 #include "fifo.h"
@@ -19,6 +23,8 @@ class Voice {
 
   Voice(AllocationType alloc = AllocationType::Managed) : mAlloc(alloc) {}
   s16Output Run();
+  // Render the next samples frames into out.
+  void Run(s16Output* out, int samples);
 
   void KeyOn();
 
@@ -32,6 +38,8 @@ class Voice {
     return mADSR.GetPhase() == ADSR::Phase::Stopped;
   }
 
+  bool Playing() const { return mADSR.GetPhase() != ADSR::Phase::Stopped; }
+
   void SetPitch(u16 reg) {
     // fmt::print("VOICE[{}] PITCH WRITE {:x}\n", m_channel, reg);
     mPitch = reg;
@@ -60,8 +68,19 @@ class Voice {
   void SetSample(u16* sample) {
     mSample = sample;
     mSSA = 0;
+    mDecoded.reset();
+  }
+
+  // Samples from DecodeFirstPass for the current sample. Only valid for sample data that doesn't
+  // change, and only used when the voice starts at the beginning of the sample.
+  void SetDecodedSample(std::shared_ptr<const std::vector<s16>> decoded) {
+    mDecoded = std::move(decoded);
   }
 
+  // Decode a sample from its start to the end of the first block with the loop end flag, the
+  // same way a voice would. Returns nullopt if that's longer than max_samples.
+  static std::optional<std::vector<s16>> DecodeFirstPass(const u16* sample, size_t max_samples);
+
   u32 GetNax() { return mNAX; }
 
   void SetSsa(u32 addr) { mSSA = addr; }
@@ -88,6 +107,7 @@ class Voice {
   bool mENDX{false};
 
   void DecodeSamples();
+  static void DecodeWord(u16 data, ADPCMHeader header, s16& hist1, s16& hist2, s16* out);
   void UpdateBlockHeader();
 
   fifo<s16, 0x20> mDecodeBuf{};
@@ -105,6 +125,10 @@ class Voice {
 
   ADPCMHeader mCurHeader{};
 
+  std::shared_ptr<const std::vector<s16>> mDecoded;
+  // still on the first pass through mDecoded, which ends at the first loop.
+  bool mUseDecoded{false};
+
   ADSR mADSR{};
   VolumePair mVolume{};
 };
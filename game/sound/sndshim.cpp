@@ -10,9 +10,11 @@
 #include "989snd/player.h"
 
 std::unique_ptr<snd::Player> player;
+// set before the sound system starts, or while it runs.
+static u32 g_latency_frames = 0;
 
 void snd_StartSoundSystem() {
-  player = std::make_unique<snd::Player>();
+  player = std::make_unique<snd::Player>(true, g_latency_frames);
 
   for (auto& voice : voices) {
     voice = std::make_shared<snd::Voice>(snd::Voice::AllocationType::Permanent);
@@ -293,3 +295,24 @@ void snd_SetGlobalExcite(u8 value) {
     player->SetGlobalExcite(value);
   }
 }
+
+bool snd_GetPlayerStats(snd::PlayerStats* stats) {
+  if (player) {
+    *stats = player->GetStats();
+    return true;
+  }
+  return false;
+}
+
+void snd_ResetPlayerStats() {
+  if (player) {
+    player->ResetStats();
+  }
+}
+
+void snd_SetLatencyFrames(u32 frames) {
+  g_latency_frames = frames;
+  if (player) {
+    player->SetLatency(frames);
+  }
+}
@@ -15,6 +15,7 @@ typedef void (*FreeFun)(void*);
 
 namespace snd {
 class SoundBank;
+struct PlayerStats;
 using BankHandle = SoundBank*;
 };  // namespace snd
 
@@ -86,3 +87,8 @@ s32 snd_GetSoundUserData(snd::BankHandle block_handle,
                          char* sound_name,
                          SFXUserData* dst);
 void snd_SetSoundReg(s32 sound_handle, s32 which, u8 val);
+// returns false if the sound system isn't running.
+bool snd_GetPlayerStats(snd::PlayerStats* stats);
+void snd_ResetPlayerStats();
+// pin the audio output latency in frames, or 0 to adjust it automatically.
+void snd_SetLatencyFrames(u32 frames);
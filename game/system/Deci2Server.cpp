@@ -7,6 +7,8 @@
 // clang-format off
 #include "Deci2Server.h"
 
+#include <chrono>
+
 #include "common/cross_sockets/XSocket.h"
 #include "common/versions/versions.h"
 #include "common/listener_common.h"
@@ -25,6 +27,17 @@
 // clang-format on
 
 Deci2Server::~Deci2Server() {
+  // Cleanup the send thread. Anything still queued is dropped.
+  if (send_thread_running) {
+    {
+      std::lock_guard<std::mutex> lk(send_mutex);
+      kill_send_thread = true;
+    }
+    send_cv.notify_all();
+    send_thread.join();
+    send_thread_running = false;
+  }
+
   // Cleanup the accept thread
   if (accept_thread_running) {
     kill_accept_thread = true;
@@ -42,6 +55,9 @@ void Deci2Server::post_init() {
   accept_thread_running = true;
   kill_accept_thread = false;
   accept_thread = std::thread(&Deci2Server::accept_thread_func, this);
+  send_thread_running = true;
+  kill_send_thread = false;
+  send_thread = std::thread(&Deci2Server::send_thread_func, this);
 }
 
 void Deci2Server::accept_thread_func() {
@@ -171,22 +187,60 @@ void Deci2Server::read_data() {
   unlock();
 }
 
+/*!
+ * Queue data to be sent to the listener. The data is copied, so buf can be reused right away.
+ * This only blocks if the listener has fallen far behind.
+ */
 void Deci2Server::send_data(void* buf, u16 len) {
-  lock();
   if (!client_connected) {
     printf("[DECI2] send while not connected, not sending!\n");
-  } else {
-    uint16_t prog = 0;
-    while (prog < len) {
-      int wrote = write_to_socket(accepted_socket, (char*)(buf) + prog, len - prog);
-      prog += wrote;
-      if (!client_connected || want_exit_callback()) {
-        unlock();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lk(send_mutex);
+  // the exit callback isn't a notification, so check it every now and then.
+  auto can_queue = [&] {
+    return send_queue_bytes < MAX_QUEUED_SEND_BYTES || !client_connected || kill_send_thread ||
+           want_exit_callback();
+  };
+  while (!send_cv.wait_for(lk, std::chrono::milliseconds(100), can_queue)) {
+  }
+  send_queue.emplace_back((u8*)buf, (u8*)buf + len);
+  send_queue_bytes += len;
+  lk.unlock();
+  send_cv.notify_all();
+}
+
+void Deci2Server::send_thread_func() {
+  while (true) {
+    std::vector<u8> msg;
+    {
+      std::unique_lock<std::mutex> lk(send_mutex);
+      send_cv.wait(lk, [&] { return !send_queue.empty() || kill_send_thread; });
+      if (kill_send_thread) {
         return;
       }
+      msg = std::move(send_queue.front());
+      send_queue.pop_front();
     }
+
+    size_t prog = 0;
+    while (prog < msg.size()) {
+      int wrote = write_to_socket(accepted_socket, (char*)msg.data() + prog, msg.size() - prog);
+      if (wrote > 0) {
+        prog += wrote;
+      }
+      if (!client_connected || want_exit_callback()) {
+        break;
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lk(send_mutex);
+      send_queue_bytes -= msg.size();
+    }
+    send_cv.notify_all();
   }
-  unlock();
 }
 
 void Deci2Server::lock() {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
+#include <vector>
 
 #include "deci_common.h"
 
@@ -28,6 +30,7 @@ class Deci2Server : public XSocketServer {
 
  protected:
   void accept_thread_func();
+  void send_thread_func();
 
  private:
   bool want_shutdown = false;
@@ -44,4 +47,15 @@ class Deci2Server : public XSocketServer {
   std::mutex server_mutex;
 
   bool client_connected = false;
+
+  // outgoing messages are copied into a queue and written by send_thread, so a slow listener
+  // doesn't block the EE thread when it flushes prints.
+  static constexpr size_t MAX_QUEUED_SEND_BYTES = 16 * 1024 * 1024;
+  std::thread send_thread;
+  std::mutex send_mutex;
+  std::condition_variable send_cv;
+  std::deque<std::vector<u8>> send_queue;
+  size_t send_queue_bytes = 0;
+  bool kill_send_thread = false;
+  bool send_thread_running = false;
 };
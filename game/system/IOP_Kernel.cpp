@@ -121,8 +121,11 @@ void IOP_Kernel::WakeupThread(s32 id) {
 
 void IOP_Kernel::iWakeupThread(s32 id) {
   ASSERT(id > 0);
-  std::scoped_lock lock(wakeup_mtx);
-  wakeup_queue.push(id);
+  {
+    std::scoped_lock lock(wakeup_mtx);
+    wakeup_queue.push(id);
+  }
+  notify_work();
 }
 
 s32 IOP_Kernel::WaitSema(s32 id) {
@@ -324,7 +327,7 @@ void IOP_Kernel::updateDelay() {
 
 std::optional<time_stamp> IOP_Kernel::nextWakeup() {
   bool found_ready = false;
-  time_stamp lowest = time_point_cast<microseconds>(steady_clock::now()) + microseconds(1000);
+  time_stamp lowest = time_point_cast<microseconds>(steady_clock::now()) + kMaxIdleWait;
 
   for (auto& t : threads) {
     if (t.waitType == IopThread::Wait::Delay) {
@@ -384,6 +387,13 @@ std::optional<time_stamp> IOP_Kernel::dispatch() {
   updateDelay();
   processWakeups();
 
+  // the vblank can be the only thing that woke us up, so don't wait for a thread to be ready.
+  if (vblank_handler != nullptr && vblank_recieved) {
+    vblank_handler(nullptr);
+    vblank_recieved = false;
+    processWakeups();
+  }
+
   // Run until all threads are idle
   IopThread* next = schedNext();
   if (next) {
@@ -408,34 +418,51 @@ std::optional<time_stamp> IOP_Kernel::dispatch() {
   return nextWakeup();
 }
 
+void IOP_Kernel::notify_work() {
+  {
+    std::scoped_lock lock(work_mtx);
+    work_pending = true;
+  }
+  work_cv.notify_one();
+}
+
+void IOP_Kernel::wait_for_work(time_stamp deadline) {
+  std::unique_lock<std::mutex> lock(work_mtx);
+  work_cv.wait_until(lock, deadline, [&]() { return work_pending; });
+  work_pending = false;
+}
+
 void IOP_Kernel::set_rpc_queue(iop::sceSifQueueData* qd, u32 thread) {
-  sif_mtx.lock();
-  for (const auto& r : sif_records) {
+  std::scoped_lock lock(sif_mtx);
+  int count = sif_record_count.load();
+  for (int i = 0; i < count; i++) {
+    const auto& r = sif_records[i];
     ASSERT(!(r.qd == qd || r.thread_to_wake == thread));
   }
-  SifRecord rec;
+  ASSERT(count < kMaxSifRecords);
+  auto& rec = sif_records[count];
   rec.thread_to_wake = thread;
   rec.qd = qd;
-  sif_records.push_back(rec);
-  sif_mtx.unlock();
+  // publish the record
+  sif_record_count.store(count + 1, std::memory_order_release);
+}
+
+SifRecord* IOP_Kernel::find_sif_record(u32 rpc_channel) {
+  int count = sif_record_count.load(std::memory_order_acquire);
+  for (int i = 0; i < count; i++) {
+    if (sif_records[i].qd->serve_data->command == rpc_channel) {
+      return &sif_records[i];
+    }
+  }
+  return nullptr;
 }
 
 typedef void* (*sif_rpc_handler)(unsigned int, void*, int);
 
 bool IOP_Kernel::sif_busy(u32 id) {
-  sif_mtx.lock();
-  bool rv = false;
-  bool found = false;
-  for (auto& r : sif_records) {
-    if (r.qd->serve_data->command == id) {
-      rv = !r.cmd.finished;
-      found = true;
-      break;
-    }
-  }
-  ASSERT(found);
-  sif_mtx.unlock();
-  return rv;
+  auto* rec = find_sif_record(id);
+  ASSERT(rec);
+  return rec->busy.load(std::memory_order_acquire);
 }
 
 void IOP_Kernel::sif_rpc(s32 rpcChannel,
@@ -446,23 +473,18 @@ void IOP_Kernel::sif_rpc(s32 rpcChannel,
                          void* recvBuff,
                          s32 recvSize) {
   ASSERT(async);
-  sif_mtx.lock();
   // step 1 - find entry
-  SifRecord* rec = nullptr;
-  for (auto& e : sif_records) {
-    if (e.qd->serve_data->command == (u32)rpcChannel) {
-      rec = &e;
-    }
-  }
+  SifRecord* rec = find_sif_record(rpcChannel);
   if (!rec) {
     printf("Failed to find handler for sif channel 0x%x\n", rpcChannel);
   }
   ASSERT(rec);
 
+  std::scoped_lock lock(rec->mtx);
   // step 2 - check entry is safe to give command to
   ASSERT(rec->cmd.finished && rec->cmd.started);
 
-  // step 3 - memcpy!
+  // step 3 - memcpy! The EE is allowed to reuse its buffer as soon as this returns.
   if (rec->qd->serve_data->buff_size < sendSize) {
     lg::die(
         "Buffer overflow in EE -> IOP RPC. channel {}, fno {}, requested size {}, buffer size {}\n",
@@ -478,49 +500,47 @@ void IOP_Kernel::sif_rpc(s32 rpcChannel,
   rec->cmd.copy_back_size = recvSize;
   rec->cmd.started = false;
   rec->cmd.finished = false;
+  rec->busy.store(true, std::memory_order_release);
 
   iWakeupThread(rec->thread_to_wake);
-
-  sif_mtx.unlock();
 }
 
 void IOP_Kernel::rpc_loop(iop::sceSifQueueData* qd) {
+  SifRecord* rec = nullptr;
+  for (int i = 0; i < sif_record_count.load(std::memory_order_acquire); i++) {
+    if (sif_records[i].qd == qd) {
+      rec = &sif_records[i];
+    }
+  }
+  ASSERT(rec);
+
   while (true) {
-    bool got_cmd = false;
     SifRpcCommand cmd;
     sif_rpc_handler func = nullptr;
 
-    // get command and mark it as started if we get it
-    sif_mtx.lock();
-    for (auto& r : sif_records) {
-      if (r.qd == qd) {
-        cmd = r.cmd;
-        got_cmd = true;
-        r.cmd.started = true;
-        func = r.qd->serve_data->func;
-      }
+    // get command and mark it as started
+    {
+      std::scoped_lock lock(rec->mtx);
+      cmd = rec->cmd;
+      rec->cmd.started = true;
+      func = rec->qd->serve_data->func;
     }
-    sif_mtx.unlock();
 
     // handle command
-    if (got_cmd) {
-      if (!cmd.started) {
-        // cf
-        ASSERT(func);
-        auto data = func(cmd.fno, cmd.buff, cmd.size);
-        if (cmd.copy_back_buff && cmd.copy_back_size) {
-          memcpy(cmd.copy_back_buff, data, cmd.copy_back_size);
-        }
-
-        sif_mtx.lock();
-        for (auto& r : sif_records) {
-          if (r.qd == qd) {
-            ASSERT(r.cmd.started);
-            r.cmd.finished = true;
-          }
-        }
-        sif_mtx.unlock();
+    if (!cmd.started) {
+      // cf
+      ASSERT(func);
+      auto data = func(cmd.fno, cmd.buff, cmd.size);
+      if (cmd.copy_back_buff && cmd.copy_back_size && cmd.copy_back_buff != data) {
+        memcpy(cmd.copy_back_buff, data, cmd.copy_back_size);
+      }
+
+      {
+        std::scoped_lock lock(rec->mtx);
+        ASSERT(rec->cmd.started);
+        rec->cmd.finished = true;
       }
+      rec->busy.store(false, std::memory_order_release);
     }
 
     SleepThread();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <list>
@@ -38,9 +39,13 @@ struct SifRpcCommand {
 };
 
 struct SifRecord {
-  iop::sceSifQueueData* qd;
+  iop::sceSifQueueData* qd = nullptr;
   SifRpcCommand cmd;
-  u32 thread_to_wake;
+  u32 thread_to_wake = 0;
+  // protects cmd. Each channel has its own, so channels don't wait on each other.
+  std::mutex mtx;
+  // set by sif_rpc until the command has finished, so the EE can poll without locking.
+  std::atomic_bool busy = false;
 };
 
 struct IopThread {
@@ -120,6 +125,18 @@ class IOP_Kernel {
   void iWakeupThread(s32 id);
   void YieldThread();
   std::optional<time_stamp> dispatch();
+
+  /*!
+   * Wake up the host thread if it's in wait_for_work. Call this from any thread after doing
+   * something that could make an IOP thread ready.
+   */
+  void notify_work();
+
+  /*!
+   * Block the host thread until notify_work is called or the deadline from dispatch passes.
+   * Returns right away if notify_work was called since the last wait.
+   */
+  void wait_for_work(time_stamp deadline);
   void set_rpc_queue(iop::sceSifQueueData* qd, u32 thread);
   void rpc_loop(iop::sceSifQueueData* qd);
   void shutdown();
@@ -202,7 +219,10 @@ class IOP_Kernel {
 
   u32 GetSystemTimeLow();
 
-  void signal_vblank() { vblank_recieved = true; };
+  void signal_vblank() {
+    vblank_recieved = true;
+    notify_work();
+  };
 
   bool sif_busy(u32 id);
 
@@ -221,6 +241,7 @@ class IOP_Kernel {
   void processWakeups();
 
   IopThread* schedNext();
+  SifRecord* find_sif_record(u32 rpc_channel);
   std::optional<time_stamp> nextWakeup();
 
   s32 (*vblank_handler)(void*) = nullptr;
@@ -231,12 +252,22 @@ class IOP_Kernel {
   IopThread* _currentThread = nullptr;
   std::vector<IopThread> threads;
   std::vector<Messagebox> mbxs;
-  std::vector<SifRecord> sif_records;
+  // records are never removed, and only read up to sif_record_count, so they can be looked up
+  // without a lock.
+  static constexpr int kMaxSifRecords = 16;
+  std::array<SifRecord, kMaxSifRecords> sif_records;
+  std::atomic_int sif_record_count = 0;
   std::vector<Semaphore> semas;
   std::vector<EventFlag> event_flags;
   std::queue<int> wakeup_queue;
   bool mainThreadSleep = false;
   std::mutex sif_mtx, wakeup_mtx;
 
+  // with nothing to do, the host thread still checks in this often, in case it missed something.
+  static constexpr std::chrono::milliseconds kMaxIdleWait{100};
+  std::mutex work_mtx;
+  std::condition_variable work_cv;
+  bool work_pending = false;
+
   time_stamp m_start_time;
 };
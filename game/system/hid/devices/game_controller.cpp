@@ -1,5 +1,6 @@
 #include "game_controller.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "dualsense_effects.h"
@@ -243,6 +244,59 @@ void GameController::process_event(const SDL_Event& event,
   }
 }
 
+void GameController::poll_state(const InputBindingGroups& binds,
+                                bool pressure_sensitivity,
+                                PadData* data) const {
+  *data = PadData();
+  data->pressure_data.fill(0);
+  if (!m_device_handle) {
+    return;
+  }
+  const bool use_pressure = pressure_sensitivity && m_has_pressure_sensitive_buttons;
+  auto press = [&](int pad_data_index, u8 pressure) {
+    data->button_data.at(pad_data_index) = true;
+    const auto pressure_index =
+        data->button_index_to_pressure_index(static_cast<PadData::ButtonIndex>(pad_data_index));
+    if (pressure_index != PadData::PressureIndex::INVALID_PRESSURE) {
+      data->pressure_data.at(pressure_index) =
+          std::max(data->pressure_data.at(pressure_index), pressure);
+    }
+  };
+
+  for (const auto& [axis, axis_binds] : binds.analog_axii) {
+    if (axis >= SDL_GAMEPAD_AXIS_LEFTX && axis <= SDL_GAMEPAD_AXIS_RIGHTY) {
+      const int value = SDL_GetGamepadAxis(m_device_handle, (SDL_GamepadAxis)axis);
+      for (const auto& bind : axis_binds) {
+        data->analog_data.at(bind.pad_data_index) = normalize_axes_value(value);
+      }
+    }
+  }
+  for (const auto& [axis, axis_binds] : binds.button_axii) {
+    if (axis >= SDL_GAMEPAD_AXIS_LEFT_TRIGGER && axis <= SDL_GAMEPAD_AXIS_RIGHT_TRIGGER) {
+      const int value = SDL_GetGamepadAxis(m_device_handle, (SDL_GamepadAxis)axis);
+      if (value > 0) {
+        for (const auto& bind : axis_binds) {
+          press(bind.pad_data_index, use_pressure ? normalize_axes_value(value) : 255);
+        }
+      }
+    }
+  }
+  for (const auto& [button, button_binds] : binds.buttons) {
+    if ((int)button >= SDL_GAMEPAD_BUTTON_COUNT ||
+        !SDL_GetGamepadButton(m_device_handle, (SDL_GamepadButton)button)) {
+      continue;
+    }
+    u8 pressure = 255;
+    if (use_pressure && button_to_pressure_axes.contains(button)) {
+      pressure = normalize_axes_value(
+          SDL_GetJoystickAxis(m_low_device_handle, button_to_pressure_axes.at(button)));
+    }
+    for (const auto& bind : button_binds) {
+      press(bind.pad_data_index, pressure);
+    }
+  }
+}
+
 void GameController::close_device() {
   if (m_device_handle) {
     clear_trigger_effect(dualsense_effects::TriggerEffectOption::BOTH);
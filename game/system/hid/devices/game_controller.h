@@ -14,6 +14,12 @@ class GameController : public InputDevice {
                      std::shared_ptr<PadData> data,
                      std::optional<InputBindAssignmentMeta>& bind_assignment) override;
   void close_device() override;
+  /*!
+   * Read the current state of the controller straight from SDL into data, using binds instead of
+   * the settings. The pressure of buttons that aren't pressed is 0. Unlike process_event, this can
+   * be called from another thread, as long as the controller isn't closed meanwhile.
+   */
+  void poll_state(const InputBindingGroups& binds, bool pressure_sensitivity, PadData* data) const;
   int send_rumble(const u8 low_rumble, const u8 high_rumble);
   void send_trigger_rumble(const u16 left_rumble,
                            const u16 right_rumble,
@@ -1,6 +1,7 @@
 #include "input_manager.h"
 
 #include <atomic>
+#include <chrono>
 #include <cmath>
 
 #include "input_manager.h"
@@ -73,6 +74,10 @@ InputManager::~InputManager() {
   prof().instant_event("ROOT");
   {
     auto p = scoped_prof("input_manager::destroy");
+    if (m_poll_thread.joinable()) {
+      m_poll_thread_running = false;
+      m_poll_thread.join();
+    }
     for (auto& device : m_available_controllers) {
       device->close_device();
     }
@@ -84,6 +89,11 @@ void InputManager::refresh_device_list() {
   prof().instant_event("ROOT");
   {
     auto p = scoped_prof("input_manager::refresh_device_list");
+    {
+      // stop sampling the controllers before they're closed
+      std::lock_guard<std::mutex> lock(m_poll_mutex);
+      m_poll_targets.clear();
+    }
     m_available_controllers.clear();
     m_controller_port_mapping.clear();
     // Enumerate devices
@@ -197,8 +207,12 @@ void InputManager::process_sdl_event(const SDL_Event& event) {
   // This goes last so it takes precedence
   for (const auto& [port, controller_idx] : m_controller_port_mapping) {
     if (m_data.find(port) != m_data.end() && (int)m_available_controllers.size() > controller_idx) {
+      // the sampling thread provides the state of sampled ports instead
+      const bool sampled = m_poll_thread_running && port < kSampledPorts;
       m_available_controllers.at(controller_idx)
-          ->process_event(event, m_command_binds, m_data.at(port), m_waiting_for_bind);
+          ->process_event(event, m_command_binds,
+                          sampled ? m_ignored_controller_data : m_data.at(port),
+                          m_waiting_for_bind);
     }
   }
 
@@ -260,6 +274,149 @@ void InputManager::finish_polling() {
   }
 }
 
+namespace {
+u64 steady_time_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/*!
+ * Add a controller's state to the keyboard and mouse state. Buttons pressed on either count as
+ * pressed. Like the events, the controller's sticks are ignored while keys simulate them.
+ */
+void merge_controller_data(const PadData& controller, PadData* out) {
+  if (!out->analogs_being_simulated()) {
+    out->analog_data = controller.analog_data;
+  }
+  for (size_t i = 0; i < out->button_data.size(); i++) {
+    if (controller.button_data[i]) {
+      out->button_data[i] = true;
+      const auto pressure_index =
+          out->button_index_to_pressure_index(static_cast<PadData::ButtonIndex>(i));
+      if (pressure_index != PadData::PressureIndex::INVALID_PRESSURE) {
+        out->pressure_data.at(pressure_index) = controller.pressure_data.at(pressure_index);
+      }
+    }
+  }
+}
+}  // namespace
+
+void InputManager::publish_frame_input() {
+  m_frame_input_time_ns = steady_time_ns();
+  if (m_poll_thread_running) {
+    update_poll_targets();
+  }
+}
+
+void InputManager::start_poll_thread() {
+  if (m_poll_thread.joinable()) {
+    return;
+  }
+  lg::info("Sampling controllers on a separate thread");
+  m_poll_thread_running = true;
+  update_poll_targets();
+  m_poll_thread = std::thread([this]() { poll_thread_loop(); });
+}
+
+/*!
+ * Give the sampling thread the controllers and binds to use. This copies the binds, so the thread
+ * doesn't read the settings while they're changed.
+ */
+void InputManager::update_poll_targets() {
+  std::vector<PollTarget> targets;
+  // while binding, the controller shouldn't also control the game
+  if (!m_waiting_for_bind && m_skip_polling_for_n_frames <= 0) {
+    for (const auto& [port, controller_idx] : m_controller_port_mapping) {
+      if (port < 0 || port >= kSampledPorts ||
+          controller_idx >= (int)m_available_controllers.size()) {
+        continue;
+      }
+      const auto& controller = m_available_controllers.at(controller_idx);
+      const auto binds = m_settings->controller_binds.find(controller->get_guid());
+      if (binds != m_settings->controller_binds.end()) {
+        targets.push_back(
+            {port, controller, binds->second, m_settings->enable_pressure_sensitivity});
+      }
+    }
+  }
+  std::lock_guard<std::mutex> lock(m_poll_mutex);
+  m_poll_targets = std::move(targets);
+}
+
+void InputManager::poll_thread_loop() {
+  constexpr auto kInterval = std::chrono::microseconds(1000);
+  auto next = std::chrono::steady_clock::now();
+  while (m_poll_thread_running) {
+    {
+      std::lock_guard<std::mutex> lock(m_poll_mutex);
+      SDL_UpdateGamepads();
+      const u64 now = steady_time_ns();
+      std::array<bool, kSampledPorts> sampled = {};
+      for (const auto& target : m_poll_targets) {
+        ControllerSample sample;
+        sample.active = true;
+        sample.time_ns = now;
+        target.controller->poll_state(target.binds, target.pressure_sensitivity, &sample.data);
+        m_controller_samples[target.port].write(sample);
+        sampled[target.port] = true;
+      }
+      for (int port = 0; port < kSampledPorts; port++) {
+        if (!sampled[port]) {
+          m_controller_samples[port].write(ControllerSample());
+        }
+      }
+    }
+    next += kInterval;
+    const auto now = std::chrono::steady_clock::now();
+    if (next < now) {
+      // fell behind, don't try to catch up
+      next = now;
+    }
+    std::this_thread::sleep_until(next);
+  }
+}
+
+bool InputManager::read_pad_data(const int port, PadData* out) {
+  auto it = m_data.find(port);
+  if (it == m_data.end()) {
+    return false;
+  }
+  *out = *it->second;
+  u64 input_time = m_frame_input_time_ns;
+  if (m_poll_thread_running && port >= 0 && port < kSampledPorts) {
+    ControllerSample sample;
+    if (m_controller_samples[port].read(&sample) && sample.active) {
+      merge_controller_data(sample.data, out);
+      input_time = sample.time_ns;
+    }
+  }
+  record_input_age(input_time);
+  return true;
+}
+
+void InputManager::record_input_age(u64 input_time_ns) {
+  if (input_time_ns == 0) {
+    return;
+  }
+  const double age_ms = (steady_time_ns() - input_time_ns) / 1e6;
+  std::lock_guard<std::mutex> lock(m_input_age_mutex);
+  m_input_age.reads++;
+  m_input_age_total_ms += age_ms;
+  m_input_age.max_ms = std::max(m_input_age.max_ms, age_ms);
+}
+
+InputManager::InputAgeStats InputManager::take_input_age_stats() {
+  std::lock_guard<std::mutex> lock(m_input_age_mutex);
+  InputAgeStats result = m_input_age;
+  if (result.reads) {
+    result.avg_ms = m_input_age_total_ms / result.reads;
+  }
+  m_input_age = {};
+  m_input_age_total_ms = 0;
+  return result;
+}
+
 void InputManager::process_ee_events() {
   const std::lock_guard<std::mutex> lock(m_event_queue_mtx);
   // Fully process any events from the EE
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <variant>
 
 #include "common/common_types.h"
+#include "common/util/TripleBuffer.h"
 
 #include "devices/dualsense_effects.h"
 #include "devices/game_controller.h"
@@ -58,6 +62,27 @@ class InputManager {
   void clear_mouse_actions();
   // Any cleanup that should happen after polling has completed for this frame
   void finish_polling();
+  // Called once per frame after the SDL events are processed, when the frame's input is final
+  void publish_frame_input();
+
+  /*!
+   * Sample the controllers on a separate thread about once per millisecond, so the game gets
+   * their state from just before it reads the pad, instead of from the start of the last rendered
+   * frame. Keyboard, mouse, commands and binding still go through the render thread.
+   */
+  void start_poll_thread();
+  /*!
+   * The pad state of port, as the game should see it. Only called from the EE thread.
+   */
+  bool read_pad_data(const int port, PadData* out);
+
+  /// How old the input was when the game read it, since the last call
+  struct InputAgeStats {
+    u64 reads = 0;
+    double avg_ms = 0;
+    double max_ms = 0;
+  };
+  InputAgeStats take_input_age_stats();
   /// Any event coming from the EE thread that interacts directly with SDL should be enqueued as an
   /// event so it can be ran from the proper thread context (the graphics thread)
   void process_ee_events();
@@ -182,6 +207,37 @@ class InputManager {
   /// The game will poll for the status of this flag to know if a bind has been assigned
   std::optional<InputBindAssignmentMeta> m_waiting_for_bind = std::nullopt;
 
+  /// Controller sampling thread, see start_poll_thread
+  struct ControllerSample {
+    bool active = false;  // false if the port has no controller being sampled
+    u64 time_ns = 0;
+    PadData data;
+  };
+  struct PollTarget {
+    int port;
+    std::shared_ptr<GameController> controller;
+    InputBindingGroups binds;
+    bool pressure_sensitivity;
+  };
+  static constexpr int kSampledPorts = 4;
+  std::thread m_poll_thread;
+  std::atomic_bool m_poll_thread_running = false;
+  /// Held while sampling, so the controllers aren't closed in the middle of it
+  std::mutex m_poll_mutex;
+  std::vector<PollTarget> m_poll_targets;
+  std::array<TripleBuffer<ControllerSample>, kSampledPorts> m_controller_samples;
+  /// While sampling, controller events still run commands and binds, but write their state here
+  std::shared_ptr<PadData> m_ignored_controller_data = std::make_shared<PadData>();
+  /// When the render thread last finished processing input
+  std::atomic<u64> m_frame_input_time_ns = 0;
+  std::mutex m_input_age_mutex;
+  InputAgeStats m_input_age;
+  double m_input_age_total_ms = 0;
+
+  void poll_thread_loop();
+  void update_poll_targets();
+  void record_input_age(u64 input_time_ns);
+
   void refresh_device_list();
   void clear_inputs();
 
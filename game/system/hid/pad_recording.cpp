@@ -0,0 +1,124 @@
+#include "pad_recording.h"
+
+#include <sstream>
+
+#include "common/log/log.h"
+#include "common/util/FileUtil.h"
+
+#include "fmt/core.h"
+
+PadRecording::~PadRecording() {
+  close();
+}
+
+bool PadRecording::start_recording(const std::string& path) {
+  m_record_file = file_util::open_file(path, "w");
+  if (!m_record_file) {
+    lg::error("Failed to open {} to record pad input", path);
+    return false;
+  }
+  lg::info("Recording pad input to {}", path);
+  return true;
+}
+
+bool PadRecording::start_replay(const std::string& path) {
+  std::string text;
+  try {
+    text = file_util::read_text_file(path);
+  } catch (std::exception& e) {
+    lg::error("Failed to read pad input recording {}: {}", path, e.what());
+    return false;
+  }
+
+  std::istringstream lines(text);
+  std::string line;
+  int line_number = 0;
+  while (std::getline(lines, line)) {
+    line_number++;
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream fields(line);
+    int port, has_data;
+    u32 buttons;
+    Read read;
+    fields >> port >> has_data >> std::hex >> buttons >> std::dec;
+    for (auto& analog : read.data.analog_data) {
+      fields >> analog;
+    }
+    for (auto& pressure : read.data.pressure_data) {
+      int value;
+      fields >> value;
+      pressure = value;
+    }
+    if (fields.fail() || port < 0 || port >= (int)m_replay_reads.size()) {
+      lg::error("Bad line {} in pad input recording {}", line_number, path);
+      return false;
+    }
+    read.has_data = has_data;
+    for (size_t i = 0; i < read.data.button_data.size(); i++) {
+      read.data.button_data[i] = buttons & (1 << i);
+    }
+    m_replay_reads[port].push_back(read);
+  }
+
+  m_replaying = true;
+  lg::info("Playing back pad input from {} ({} and {} reads)", path, m_replay_reads[0].size(),
+           m_replay_reads[1].size());
+  return true;
+}
+
+void PadRecording::close() {
+  if (m_record_file) {
+    fclose(m_record_file);
+    m_record_file = nullptr;
+  }
+  m_replaying = false;
+  for (auto& reads : m_replay_reads) {
+    reads.clear();
+  }
+  m_replay_idx = {0, 0};
+  m_logged_replay_end = false;
+}
+
+void PadRecording::process(int port, bool* has_data, PadData* data) {
+  if (port < 0 || port >= (int)m_replay_reads.size()) {
+    return;
+  }
+
+  if (m_replaying) {
+    const auto& reads = m_replay_reads[port];
+    auto& idx = m_replay_idx[port];
+    if (idx < reads.size()) {
+      *has_data = reads[idx].has_data;
+      *data = reads[idx].data;
+      idx++;
+    } else {
+      *has_data = false;
+      if (!m_logged_replay_end) {
+        lg::info("Pad input recording ended, no more input");
+        m_logged_replay_end = true;
+      }
+    }
+  }
+
+  if (m_record_file) {
+    u32 buttons = 0;
+    for (size_t i = 0; i < data->button_data.size(); i++) {
+      buttons |= data->button_data[i] << i;
+    }
+    fmt::print(m_record_file, "{} {} {:x}", port, *has_data ? 1 : 0, buttons);
+    for (auto analog : data->analog_data) {
+      fmt::print(m_record_file, " {}", analog);
+    }
+    for (auto pressure : data->pressure_data) {
+      fmt::print(m_record_file, " {}", pressure);
+    }
+    fmt::print(m_record_file, "\n");
+  }
+}
+
+PadRecording& pad_recording() {
+  static PadRecording recording;
+  return recording;
+}
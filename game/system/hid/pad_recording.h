@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+#include "game/system/hid/input_bindings.h"
+
+/*!
+ * Records the pad data the game reads, and plays it back, so a run can be repeated with the same
+ * input (for benchmarks, usually in headless mode).
+ *
+ * The file is text, one line per scePadRead:
+ *   port has_data buttons left_x left_y right_x right_y pressure[12]
+ * with buttons as a hex bit mask. Playing back gives each port its recorded reads in order, and
+ * no input once they run out.
+ *
+ * It does nothing until start_recording() or start_replay() is called.
+ */
+class PadRecording {
+ public:
+  ~PadRecording();
+
+  bool start_recording(const std::string& path);
+  bool start_replay(const std::string& path);
+  void close();
+
+  /*!
+   * Called by scePadRead with the pad data from the input manager. This records it, or replaces
+   * it with the next read from the recording.
+   */
+  void process(int port, bool* has_data, PadData* data);
+
+ private:
+  struct Read {
+    bool has_data = false;
+    PadData data;
+  };
+
+  FILE* m_record_file = nullptr;
+  bool m_replaying = false;
+  std::array<std::vector<Read>, 2> m_replay_reads;
+  std::array<size_t, 2> m_replay_idx = {0, 0};
+  bool m_logged_replay_end = false;
+};
+
+PadRecording& pad_recording();
@@ -60,8 +60,7 @@ void* IOP::iop_alloc(int size) {
 void IOP::wait_run_iop(
     std::chrono::time_point<std::chrono::steady_clock, std::chrono::microseconds> wakeup) {
   auto p = scoped_prof("krnlw");
-  std::unique_lock<std::mutex> lk(run_cv_mutex);
-  iop_run_cv.wait_until(lk, wakeup);
+  kernel.wait_for_work(wakeup);
 }
 
 void IOP::kill_from_ee() {
@@ -70,8 +69,7 @@ void IOP::kill_from_ee() {
 }
 
 void IOP::signal_run_iop() {
-  std::unique_lock<std::mutex> lk(run_cv_mutex);
-  iop_run_cv.notify_all();
+  kernel.notify_work();
 }
 
 IOP::~IOP() {
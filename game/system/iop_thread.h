@@ -40,9 +40,8 @@ class IOP {
  private:
   std::vector<void*> allocations;
   std::condition_variable cv;
-  std::mutex iop_mutex, run_cv_mutex;
+  std::mutex iop_mutex;
   bool overlord_init_done = false;
-  std::condition_variable iop_run_cv;
 };
 
 #endif  // JAK1_IOP_THREAD_H
@@ -1,6 +1,7 @@
 #include "MercExtract.h"
 
 #include "common/log/log.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/gltf_util.h"
 
 #include "goalc/build_level/common/gltf_mesh_extract.h"
@@ -23,6 +24,19 @@ void extract(const std::string& name,
     joints += gltf_util::get_joint_count(model, *skin_idx);
   }
 
+  // a primitive to extract. Reading the buffers of the primitives is done in parallel, then they
+  // are merged in order.
+  struct PrimWork {
+    const gltf_util::NodeWithTransform* node = nullptr;
+    const tinygltf::Mesh* mesh = nullptr;
+    const tinygltf::Primitive* prim = nullptr;
+    // relative to the first vertex of the primitive
+    std::vector<u32> indices;
+    gltf_util::ExtractedVertices verts;
+    std::vector<gltf_util::JointsAndWeights> joints_and_weights;
+  };
+  std::vector<PrimWork> prims;
+
   for (const auto& n : all_nodes) {
     const auto& node = model.nodes[n.node_idx];
     if (node.extras.Has("set_invisible") && node.extras.Get("set_invisible").Get<int>()) {
@@ -48,45 +62,64 @@ void extract(const std::string& name,
         //   continue;  // skip, no collide here
         // }
         prim_count++;
-        // extract index buffer
-        std::vector<u32> prim_indices = gltf_util::gltf_index_buffer(
-            model, prim.indices, out.new_vertices.size() + vertex_offset);
-        ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
-        // extract vertices
-        auto verts =
-            gltf_util::gltf_vertices(model, prim.attributes, n.w_T_node, true, true, mesh.name);
-        out.new_vertices.insert(out.new_vertices.end(), verts.vtx.begin(), verts.vtx.end());
-        out.new_colors.insert(out.new_colors.end(), verts.vtx_colors.begin(),
-                              verts.vtx_colors.end());
-        out.normals.insert(out.normals.end(), verts.normals.begin(), verts.normals.end());
-        ASSERT(out.new_colors.size() == out.new_vertices.size());
+        auto& work = prims.emplace_back();
+        work.node = &n;
+        work.mesh = &mesh;
+        work.prim = &prim;
+      }
+    }
+  }
 
-        if (prim.attributes.count("JOINTS_0") && prim.attributes.count("WEIGHTS_0")) {
-          auto joints_and_weights = gltf_util::extract_and_flatten_joints_and_weights(model, prim);
-          ASSERT(joints_and_weights.size() == verts.vtx.size());
-          out.joints_and_weights.insert(out.joints_and_weights.end(), joints_and_weights.begin(),
-                                        joints_and_weights.end());
-        } else {
-          // add fake data for vertices without this data
-          gltf_util::JointsAndWeights dummy;
-          dummy.joints[0] = 3;
-          dummy.weights[0] = 1.f;
-          for (size_t i = 0; i < out.new_vertices.size(); i++) {
-            out.joints_and_weights.push_back(dummy);
-          }
-        }
+  ThreadPool::global().parallel_for(prims.size(), [&](int i) {
+    auto& work = prims[i];
+    const auto& prim = *work.prim;
+    // extract index buffer
+    work.indices = gltf_util::gltf_index_buffer(model, prim.indices, 0);
+    ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
+    // extract vertices
+    work.verts = gltf_util::gltf_vertices(model, prim.attributes, work.node->w_T_node, true, true,
+                                          work.mesh->name);
+    if (prim.attributes.count("JOINTS_0") && prim.attributes.count("WEIGHTS_0")) {
+      work.joints_and_weights = gltf_util::extract_and_flatten_joints_and_weights(model, prim);
+      ASSERT(work.joints_and_weights.size() == work.verts.vtx.size());
+    }
+  });
 
-        // real draw details will be filled out in the next loop.
-        auto& draw = draw_by_material[prim.material];
-        draw.mode = gltf_util::make_default_draw_mode();  // todo rm
-        draw.tree_tex_id = 0;                             // todo rm
-        draw.num_triangles += prim_indices.size() / 3;
-        draw.no_strip = true;
-        draw.index_count = prim_indices.size();
-        draw.first_index = index_offset + out.new_indices.size();
-        out.new_indices.insert(out.new_indices.end(), prim_indices.begin(), prim_indices.end());
+  for (auto& work : prims) {
+    const auto& prim = *work.prim;
+    const auto& verts = work.verts;
+    for (auto& idx : work.indices) {
+      idx += out.new_vertices.size() + vertex_offset;
+    }
+    const auto& prim_indices = work.indices;
+    out.new_vertices.insert(out.new_vertices.end(), verts.vtx.begin(), verts.vtx.end());
+    out.new_colors.insert(out.new_colors.end(), verts.vtx_colors.begin(), verts.vtx_colors.end());
+    out.normals.insert(out.normals.end(), verts.normals.begin(), verts.normals.end());
+    ASSERT(out.new_colors.size() == out.new_vertices.size());
+
+    if (prim.attributes.count("JOINTS_0") && prim.attributes.count("WEIGHTS_0")) {
+      out.joints_and_weights.insert(out.joints_and_weights.end(), work.joints_and_weights.begin(),
+                                    work.joints_and_weights.end());
+    } else {
+      // add fake data for vertices without this data
+      gltf_util::JointsAndWeights dummy;
+      dummy.joints[0] = 3;
+      dummy.weights[0] = 1.f;
+      for (size_t i = 0; i < out.new_vertices.size(); i++) {
+        out.joints_and_weights.push_back(dummy);
       }
     }
+
+    // real draw details will be filled out in the next loop.
+    auto& draw = draw_by_material[prim.material];
+    draw.mode = gltf_util::make_default_draw_mode();  // todo rm
+    draw.tree_tex_id = 0;                             // todo rm
+    draw.num_triangles += prim_indices.size() / 3;
+    draw.no_strip = true;
+    draw.index_count = prim_indices.size();
+    draw.first_index = index_offset + out.new_indices.size();
+    out.new_indices.insert(out.new_indices.end(), prim_indices.begin(), prim_indices.end());
+    work = {};
   }
 
   tfrag3::MercEffect e;
@@ -1,5 +1,8 @@
 #include "animation_processing.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "common/log/log.h"
 #include "common/util/gltf_util.h"
 
@@ -143,20 +146,124 @@ UncompressedJointAnim extract_anim_from_gltf(const tinygltf::Model& model,
 }
 
 namespace {
+/*!
+ * The biggest difference between components of two values of a channel. q and -q are the same
+ * rotation, so quaternions are compared both ways.
+ */
+template <int n>
+float max_difference(const math::Vector<float, n>& a,
+                     const math::Vector<float, n>& b,
+                     bool quaternion) {
+  float result = 0;
+  float flipped = 0;
+  for (int i = 0; i < n; i++) {
+    result = std::max(result, std::abs(a[i] - b[i]));
+    flipped = std::max(flipped, std::abs(a[i] + b[i]));
+  }
+  return quaternion ? std::min(result, flipped) : result;
+}
+
 template <int n>
-bool is_constant(const std::vector<math::Vector<float, n>>& in) {
+bool is_constant(const std::vector<math::Vector<float, n>>& in, float tolerance, bool quaternion) {
   if (in.empty()) {
     return true;
   }
   auto first = in.at(0);
   for (auto& x : in) {
-    if (x != first) {
+    if (max_difference(x, first, quaternion) > tolerance) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * Sample a channel between frames, interpolating like the game does.
+ */
+template <int n>
+math::Vector<float, n> sample(const std::vector<math::Vector<float, n>>& frames,
+                              float frame,
+                              bool quaternion) {
+  if (frames.size() == 1) {
+    return frames[0];
+  }
+  frame = std::clamp(frame, 0.f, (float)(frames.size() - 1));
+  const int i = std::min((int)frame, (int)frames.size() - 2);
+  const float fraction = frame - i;
+  float multiplier = 1;
+  if (quaternion && frames[i].dot(frames[i + 1]) < 0) {
+    multiplier = -1;
+  }
+  return frames[i] * (1.f - fraction) + frames[i + 1] * fraction * multiplier;
+}
+
+/*!
+ * Resample a channel to new_count evenly spaced frames, with the same first and last frame.
+ */
+template <int n>
+std::vector<math::Vector<float, n>> resample(const std::vector<math::Vector<float, n>>& frames,
+                                             int new_count,
+                                             bool quaternion) {
+  if (new_count == (int)frames.size()) {
+    return frames;
+  }
+  std::vector<math::Vector<float, n>> result;
+  const float step = (frames.size() - 1) / (float)(new_count - 1);
+  for (int i = 0; i < new_count; i++) {
+    result.push_back(sample(frames, i * step, quaternion));
+  }
+  return result;
+}
+
+/*!
+ * Does playing back a channel resampled to new_count frames stay within the tolerance?
+ */
+template <int n>
+bool can_resample(const std::vector<math::Vector<float, n>>& frames,
+                  int new_count,
+                  float tolerance,
+                  bool quaternion) {
+  if (is_constant(frames, tolerance, quaternion)) {
+    return true;
+  }
+  const auto resampled = resample(frames, new_count, quaternion);
+  const float to_new = (new_count - 1) / (float)(frames.size() - 1);
+  for (size_t i = 0; i < frames.size(); i++) {
+    if (max_difference(sample(resampled, i * to_new, quaternion), frames[i], quaternion) >
+        tolerance) {
       return false;
     }
   }
   return true;
 }
 
+/*!
+ * The fewest frames the animation can be stored with, within the tolerances of the settings.
+ * Frames are evenly spaced, as they aren't stored with times.
+ */
+int pick_frame_count(const UncompressedJointAnim& in, const CompressionSettings& settings) {
+  if (in.frames < 3 || settings.max_frame_step <= 1) {
+    return in.frames;
+  }
+  const int min_count =
+      std::max(2, (in.frames - 1 + settings.max_frame_step - 1) / settings.max_frame_step + 1);
+  for (int count = min_count; count < in.frames; count++) {
+    bool ok = true;
+    for (const auto& joint : in.joints) {
+      if (!can_resample(joint.trans_frames, count, settings.max_trans_error, false) ||
+          !can_resample(joint.quat_frames, count, settings.max_quat_error, true) ||
+          !can_resample(joint.scale_frames, count, settings.max_scale_error, false)) {
+        ok = false;
+        break;
+      }
+    }
+    if (ok) {
+      return count;
+    }
+  }
+  return in.frames;
+}
+
 bool can_use_small_trans(const std::vector<math::Vector3f>& trans_frames) {
   constexpr float kMaxTrans = 32767.f * (4.f / 4096.f);
   for (auto& trans : trans_frames) {
@@ -169,9 +276,11 @@ bool can_use_small_trans(const std::vector<math::Vector3f>& trans_frames) {
   return true;
 }
 
-bool is_matrix_constant(const UncompressedSingleJointAnim& anim) {
-  return is_constant(anim.quat_frames) && is_constant(anim.scale_frames) &&
-         is_constant(anim.trans_frames);
+bool is_matrix_constant(const UncompressedSingleJointAnim& anim,
+                        const CompressionSettings& settings) {
+  return is_constant(anim.quat_frames, settings.max_quat_error, true) &&
+         is_constant(anim.scale_frames, settings.max_scale_error, false) &&
+         is_constant(anim.trans_frames, settings.max_trans_error, false);
 }
 
 void compress_frame_to_matrix(CompressedFrame* frame,
@@ -232,15 +341,27 @@ void compress_scale(CompressedFrame* frame, const math::Vector3f& scale) {
 }
 }  // namespace
 
-CompressedAnim compress_animation(const UncompressedJointAnim& in) {
-  ASSERT(in.joints.size() >= 2);  // need two matrix joints.
+CompressedAnim compress_animation(const UncompressedJointAnim& original,
+                                  const CompressionSettings& settings) {
+  ASSERT(original.joints.size() >= 2);  // need two matrix joints.
+  UncompressedJointAnim in = original;
+  in.frames = pick_frame_count(original, settings);
+  if (in.frames != original.frames) {
+    for (auto& joint : in.joints) {
+      joint.trans_frames = resample(joint.trans_frames, in.frames, false);
+      joint.quat_frames = resample(joint.quat_frames, in.frames, true);
+      joint.scale_frames = resample(joint.scale_frames, in.frames, false);
+    }
+  }
+
   CompressedAnim out;
   out.name = in.name;
-  out.framerate = in.framerate;
+  out.speed = original.frames > 1 ? (in.frames - 1) / (float)(original.frames - 1) : 1.f;
+  out.framerate = in.framerate * out.speed;
   out.frames.resize(in.frames);
   for (int matrix = 0; matrix < 2; matrix++) {
     const auto& joint_data = in.joints.at(matrix);
-    if (is_matrix_constant(joint_data)) {
+    if (is_matrix_constant(joint_data, settings)) {
       out.matrix_animated[matrix] = false;
       compress_frame_to_matrix(&out.fixed, joint_data.trans_frames[0], joint_data.quat_frames[0],
                                joint_data.scale_frames[0]);
@@ -257,9 +378,11 @@ CompressedAnim compress_animation(const UncompressedJointAnim& in) {
     const auto& joint_data = in.joints.at(joint);
     auto& metadata = out.joint_metadata.emplace_back();
 
-    metadata.animated_trans = !is_constant(joint_data.trans_frames);
-    metadata.animated_quat = !is_constant(joint_data.quat_frames);
-    metadata.animated_scale = !is_constant(joint_data.scale_frames);
+    metadata.animated_trans =
+        !is_constant(joint_data.trans_frames, settings.max_trans_error, false);
+    metadata.animated_quat = !is_constant(joint_data.quat_frames, settings.max_quat_error, true);
+    metadata.animated_scale =
+        !is_constant(joint_data.scale_frames, settings.max_scale_error, false);
     metadata.big_trans_mode = !can_use_small_trans(joint_data.trans_frames);
 
     if (metadata.animated_trans) {
@@ -287,8 +410,9 @@ CompressedAnim compress_animation(const UncompressedJointAnim& in) {
     }
   }
 
-  lg::info("animation {} size {:.2f} kB", in.name,
-           (out.fixed.size_bytes() + out.frames.size() * out.frames.at(0).size_bytes()) / 1024.f);
+  lg::info("animation {} size {:.2f} kB, {} of {} frames", in.name,
+           (out.fixed.size_bytes() + out.frames.size() * out.frames.at(0).size_bytes()) / 1024.f,
+           in.frames, original.frames);
   return out;
 }
 }  // namespace anim
\ No newline at end of file
@@ -49,6 +49,20 @@ struct CompressedAnim {
   bool matrix_animated[2] = {false, false};
   std::vector<CompressedJointMetadata> joint_metadata;
   float framerate = 60;
+  // stored frames per frame of the input. Less than 1 if frames were dropped. The game's speed and
+  // artist step must use this so it plays at the original rate.
+  float speed = 1;
+};
+
+/*!
+ * How far a compressed animation may be from the input at any frame, for each joint.
+ */
+struct CompressionSettings {
+  float max_trans_error = 0.001f;  // meters, about one step of the small translation format
+  float max_quat_error = 0.001f;   // of any quaternion component, about 0.1 degrees
+  float max_scale_error = 0.001f;
+  // keep at least one stored frame per this many input frames. 1 to keep every frame.
+  int max_frame_step = 4;
 };
 
 /*!
@@ -64,6 +78,12 @@ UncompressedJointAnim extract_anim_from_gltf(const tinygltf::Model& model,
                                              const std::map<int, int>& node_to_joint,
                                              float framerate);
 
-CompressedAnim compress_animation(const UncompressedJointAnim& in);
+/*!
+ * Compress an animation for the game. Channels that stay within the tolerances of their first frame
+ * are stored once. The rest are resampled to the fewest frames where interpolating between them
+ * still reproduces every input frame within the tolerances.
+ */
+CompressedAnim compress_animation(const UncompressedJointAnim& in,
+                                  const CompressionSettings& settings = {});
 
 }  // namespace anim
\ No newline at end of file
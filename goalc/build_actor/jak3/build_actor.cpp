@@ -128,9 +128,9 @@ ArtJointAnim::ArtJointAnim(const anim::CompressedAnim& anim, const std::vector<J
     : frames(anim) {
   this->name = anim.name;
   length = joints.size();
-  speed = 1.0f;
+  speed = anim.speed;
   artist_base = 0.0f;
-  artist_step = 1.0f;
+  artist_step = 1.0f / anim.speed;
   master_art_group_name = name;
   master_art_group_index = 2;
 }
@@ -1,80 +1,100 @@
 #include "collide_bvh.h"
 
 #include <algorithm>
+#include <cfloat>
 #include <map>
-#include <unordered_set>
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/Timer.h"
 
 // Collision BVH algorithm
-// We start with all the points in a single node, then recursively split nodes in 8 until no nodes
+// We start with all the faces in a single node, then recursively split nodes in 8 until no nodes
 // have too many faces.
-// The splitting is done by doing median cuts along the x, y, or z axis.
-
-// The bspheres are built at the end.
+// Each split is a binary split picked with a binned surface area heuristic, and three levels of
+// binary splits make the 8 children.
+// The faces are partitioned in place, so the faces of every node are a contiguous range of one
+// array, and bspheres are computed from that range as nodes are created, without copying vertices.
+// Large subtrees are split in parallel.
 
 namespace collide {
 
 namespace {
 constexpr int MAX_UNIQUE_VERTS_IN_FRAG = 128;
+constexpr int NUM_SAH_BINS = 16;
+// below this many faces, split subtrees on this thread
+constexpr size_t MIN_FACES_FOR_PARALLEL_SPLIT = 4096;
 
 /*!
  * The Collide node.
  * If it's a leaf, it has faces
- * Otherwise it has 2, 4, or 8 children nodes.
+ * Otherwise it has 1 to 8 children nodes.
  */
 struct CNode {
   std::vector<CNode> child_nodes;
-  std::vector<jak1::CollideFace> faces;
+  // the range of faces in this node (and its children)
+  size_t begin = 0;
+  size_t end = 0;
   math::Vector4f bsphere;
+
+  size_t face_count() const { return end - begin; }
+  bool is_leaf() const { return child_nodes.empty(); }
 };
 
-struct VectorHash {
-  size_t operator()(const math::Vector3f& in) const {
-    return std::hash<float>()(in.x()) ^ std::hash<float>()(in.y()) ^ std::hash<float>()(in.z());
+struct Aabb {
+  math::Vector3f min = math::Vector3f(FLT_MAX, FLT_MAX, FLT_MAX);
+  math::Vector3f max = math::Vector3f(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+  void add(const math::Vector3f& pt) {
+    min = min.min(pt);
+    max = max.max(pt);
   }
-};
 
-/*!
- * Recursively get a list of vertices.
- */
-void collect_vertices(const CNode& node, std::vector<math::Vector3f>& verts) {
-  for (auto& child : node.child_nodes) {
-    collect_vertices(child, verts);
+  void add(const Aabb& other) {
+    min = min.min(other.min);
+    max = max.max(other.max);
   }
-  for (auto& face : node.faces) {
-    verts.push_back(face.v[0]);
-    verts.push_back(face.v[1]);
-    verts.push_back(face.v[2]);
+
+  float half_area() const {
+    if (min.x() > max.x()) {
+      return 0;
+    }
+    auto size = max - min;
+    return size.x() * size.y() + size.y() * size.z() + size.z() * size.x();
   }
-}
+};
 
 /*!
- * Find the vertex in verts that is most distant from pt.
+ * Find the vertex of faces [begin, end) that is most distant from pt.
  */
-size_t find_most_distant(math::Vector3f pt, const std::vector<math::Vector3f>& verts) {
+math::Vector3f find_most_distant(math::Vector3f pt,
+                                 const std::vector<jak1::CollideFace>& faces,
+                                 size_t begin,
+                                 size_t end) {
   float max_dist_squared = 0;
-  size_t idx_of_best = 0;
-  for (size_t i = 0; i < verts.size(); i++) {
-    float dist = (pt - verts[i]).squared_length();
-    if (dist > max_dist_squared) {
-      max_dist_squared = dist;
-      idx_of_best = i;
+  math::Vector3f best = faces[begin].v[0];
+  for (size_t i = begin; i < end; i++) {
+    for (auto& v : faces[i].v) {
+      float dist = (pt - v).squared_length();
+      if (dist > max_dist_squared) {
+        max_dist_squared = dist;
+        best = v;
+      }
     }
   }
-  return idx_of_best;
+  return best;
 }
 
 /*!
- * Compute a bounding sphere for a node and its children.
+ * Compute a bounding sphere for a node, from the vertices of all of its faces.
+ * (note that we don't do bspheres of bspheres... I think this is better?)
  */
-void compute_my_bsphere_ritters(CNode& node, const std::vector<math::Vector3f>& verts) {
-  ASSERT(verts.size() > 0);
-  auto px = verts[0];
-  auto py = verts[find_most_distant(px, verts)];
-  auto pz = verts[find_most_distant(py, verts)];
+void compute_my_bsphere_ritters(CNode& node, const std::vector<jak1::CollideFace>& faces) {
+  ASSERT(node.face_count() > 0);
+  auto px = faces[node.begin].v[0];
+  auto py = find_most_distant(px, faces, node.begin, node.end);
+  auto pz = find_most_distant(py, faces, node.begin, node.end);
 
   auto origin = (pz + py) / 2.f;
   node.bsphere.x() = origin.x();
@@ -82,188 +102,229 @@ void compute_my_bsphere_ritters(CNode& node, const std::vector<math::Vector3f>&
   node.bsphere.z() = origin.z();
 
   float max_squared = 0;
-  for (auto& pt : verts) {
-    max_squared = std::max(max_squared, (pt - origin).squared_length());
+  for (size_t i = node.begin; i < node.end; i++) {
+    for (auto& pt : faces[i].v) {
+      max_squared = std::max(max_squared, (pt - origin).squared_length());
+    }
   }
   node.bsphere.w() = std::sqrt(max_squared);
 }
 
 /*!
- * Compute a bounding sphere for a node and its children.
- */
-void compute_my_bsphere_ritters(CNode& node) {
-  std::vector<math::Vector3f> verts;
-  collect_vertices(node, verts);
-  compute_my_bsphere_ritters(node, verts);
-}
-
-/*!
- * Split faces in two along a coordinate plane.
- * Will clear the input faces
+ * Pick where to split faces [begin, end) with a binned surface area heuristic, and partition them
+ * so the first part is [begin, result) and the second is [result, end).
  */
-void split_along_dim(std::vector<jak1::CollideFace>& faces,
-                     int dim,
-                     std::vector<jak1::CollideFace>* out0,
-                     std::vector<jak1::CollideFace>* out1) {
-  std::sort(faces.begin(), faces.end(),
-            [=](const jak1::CollideFace& a, const jak1::CollideFace& b) {
-              return a.bsphere[dim] < b.bsphere[dim];
-            });
-  // lg::print("splitting with size: {}\n", faces.size());
-  size_t split_idx = faces.size() / 2;
-  out0->insert(out0->end(), faces.begin(), faces.begin() + split_idx);
-  out1->insert(out1->end(), faces.begin() + split_idx, faces.end());
-}
-
-/*!
- * Split a node into two nodes. The outputs should be uninitialized nodes
- */
-void split_node_once(CNode& node, CNode* out0, CNode* out1) {
-  compute_my_bsphere_ritters(node);
-  CNode temps[6];
-  split_along_dim(node.faces, 0, &temps[0].faces, &temps[1].faces);
-  split_along_dim(node.faces, 1, &temps[2].faces, &temps[3].faces);
-  split_along_dim(node.faces, 2, &temps[4].faces, &temps[5].faces);
-  node.faces.clear();
-  for (auto& t : temps) {
-    compute_my_bsphere_ritters(t);
+size_t partition_faces(std::vector<jak1::CollideFace>& faces, size_t begin, size_t end) {
+  Aabb centroid_bounds;
+  for (size_t i = begin; i < end; i++) {
+    centroid_bounds.add(faces[i].bsphere.xyz());
   }
 
-  float max_bspheres[3] = {0, 0, 0};
-
-  for (int i = 0; i < 3; i++) {
-    max_bspheres[i] = std::max(temps[i * 2].bsphere.w(), temps[i * 2 + 1].bsphere.w());
+  // bin the faces along all three axes in one pass. Faces are bounded by their bsphere's box,
+  // which is close enough for picking a split and doesn't touch the vertices.
+  float lo[3], scale[3];
+  for (int dim = 0; dim < 3; dim++) {
+    lo[dim] = centroid_bounds.min[dim];
+    const float extent = centroid_bounds.max[dim] - lo[dim];
+    scale[dim] = extent > 0 ? NUM_SAH_BINS / extent : 0;
+  }
+  auto bin_of = [&](const math::Vector4f& sphere, int dim) {
+    return std::min(NUM_SAH_BINS - 1, (int)((sphere[dim] - lo[dim]) * scale[dim]));
+  };
+  Aabb bin_bounds[3][NUM_SAH_BINS];
+  size_t bin_counts[3][NUM_SAH_BINS] = {};
+  for (size_t i = begin; i < end; i++) {
+    const auto& sphere = faces[i].bsphere;
+    Aabb box;
+    box.min = sphere.xyz() - math::Vector3f(sphere.w(), sphere.w(), sphere.w());
+    box.max = sphere.xyz() + math::Vector3f(sphere.w(), sphere.w(), sphere.w());
+    for (int dim = 0; dim < 3; dim++) {
+      int bin = bin_of(sphere, dim);
+      bin_counts[dim][bin]++;
+      bin_bounds[dim][bin].add(box);
+    }
   }
 
-  int best_dim = 0;
-  float best_w = max_bspheres[0];
-  for (int i = 0; i < 3; i++) {
-    if (max_bspheres[i] < best_w) {
-      best_dim = i;
-      best_w = max_bspheres[i];
+  float best_cost = FLT_MAX;
+  int best_dim = -1;
+  int best_bin = 0;
+  for (int dim = 0; dim < 3; dim++) {
+    if (scale[dim] == 0) {
+      continue;
+    }
+    // cost of each split from the right, then sweep from the left.
+    float right_cost[NUM_SAH_BINS] = {};
+    Aabb right;
+    size_t right_count = 0;
+    for (int bin = NUM_SAH_BINS - 1; bin > 0; bin--) {
+      right.add(bin_bounds[dim][bin]);
+      right_count += bin_counts[dim][bin];
+      right_cost[bin] = right.half_area() * right_count;
+    }
+    Aabb left;
+    size_t left_count = 0;
+    for (int bin = 0; bin < NUM_SAH_BINS - 1; bin++) {
+      left.add(bin_bounds[dim][bin]);
+      left_count += bin_counts[dim][bin];
+      if (left_count == 0 || left_count == end - begin) {
+        continue;
+      }
+      float cost = left.half_area() * left_count + right_cost[bin + 1];
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_dim = dim;
+        best_bin = bin;
+      }
     }
   }
 
-  *out0 = temps[best_dim * 2];
-  *out1 = temps[best_dim * 2 + 1];
+  if (best_dim == -1) {
+    // all the faces have the same center, just split them in half.
+    return begin + (end - begin) / 2;
+  }
+
+  auto mid = std::partition(faces.begin() + begin, faces.begin() + end,
+                            [&](const jak1::CollideFace& f) {
+                              return bin_of(f.bsphere, best_dim) <= best_bin;
+                            });
+  return mid - faces.begin();
 }
 
-bool needs_split(const CNode& node) {
+/*!
+ * Split a node into two nodes. The outputs should be uninitialized nodes
+ */
+void split_node_once(std::vector<jak1::CollideFace>& faces,
+                     const CNode& node,
+                     CNode* out0,
+                     CNode* out1) {
+  ASSERT(node.face_count() > 1);
+  size_t mid = partition_faces(faces, node.begin, node.end);
+  out0->begin = node.begin;
+  out0->end = mid;
+  out1->begin = mid;
+  out1->end = node.end;
+  compute_my_bsphere_ritters(*out0, faces);
+  compute_my_bsphere_ritters(*out1, faces);
+}
+
+bool needs_split(const std::vector<jak1::CollideFace>& faces, const CNode& node) {
   // quick reject.
-  if (node.faces.size() > 100) {
+  if (node.face_count() > 100) {
     return true;
   }
 
   if (node.bsphere.w() > (125.f * 4096.f)) {
-    return true;
+    return node.face_count() > 1;
   }
 
   ASSERT(node.child_nodes.empty());
-  std::unordered_set<math::Vector3f, VectorHash> unique_verts;
-  for (auto& f : node.faces) {
-    for (auto& v : f.v) {
-      unique_verts.insert(v);
+  // at most 300 vertices here, so sorting is faster than a hash set.
+  std::vector<math::Vector3f> verts;
+  verts.reserve(node.face_count() * 3);
+  for (size_t i = node.begin; i < node.end; i++) {
+    for (auto& v : faces[i].v) {
+      verts.push_back(v);
     }
   }
+  std::sort(verts.begin(), verts.end(), [](const math::Vector3f& a, const math::Vector3f& b) {
+    if (a.x() != b.x()) {
+      return a.x() < b.x();
+    }
+    if (a.y() != b.y()) {
+      return a.y() < b.y();
+    }
+    return a.z() < b.z();
+  });
+  size_t unique_verts = std::unique(verts.begin(), verts.end()) - verts.begin();
 
-  return unique_verts.size() >= MAX_UNIQUE_VERTS_IN_FRAG;
+  return unique_verts >= MAX_UNIQUE_VERTS_IN_FRAG;
 }
 
-void split_recursive(CNode& to_split) {
+void split_recursive(std::vector<jak1::CollideFace>& faces, CNode& to_split) {
   ASSERT(to_split.child_nodes.empty());
-  ASSERT(!to_split.faces.empty());
-
-  CNode level0[2];
-  split_node_once(to_split, &level0[0], &level0[1]);
-  for (int i = 0; i < 2; i++) {
-    if (needs_split(level0[i])) {
-      CNode level1[2];
-      split_node_once(level0[i], &level1[0], &level1[1]);
-      for (int j = 0; j < 2; j++) {
-        if (needs_split(level1[j])) {
-          CNode level2[2];
-          split_node_once(level1[j], &level2[0], &level2[1]);
-          for (int k = 0; k < 2; k++) {
-            if (needs_split(level2[k])) {
-              to_split.child_nodes.push_back(std::move(level2[k]));
-              split_recursive(to_split.child_nodes.back());
-            } else {
-              to_split.child_nodes.push_back(std::move(level2[k]));
-            }
-          }
-        } else {
-          to_split.child_nodes.push_back(std::move(level1[j]));
-        }
+  ASSERT(to_split.face_count() > 0);
+
+  // up to three levels of binary splits, stopping early on nodes that are small enough.
+  to_split.child_nodes.reserve(8);
+  std::vector<CNode> level = {to_split};
+  for (int depth = 0; depth < 3; depth++) {
+    std::vector<CNode> next_level;
+    for (auto& node : level) {
+      if (depth == 0 || needs_split(faces, node)) {
+        next_level.resize(next_level.size() + 2);
+        split_node_once(faces, node, &next_level[next_level.size() - 2], &next_level.back());
+      } else {
+        to_split.child_nodes.push_back(node);
       }
-    } else {
-      to_split.child_nodes.push_back(std::move(level0[i]));
     }
+    level = std::move(next_level);
+  }
+  for (auto& node : level) {
+    to_split.child_nodes.push_back(node);
   }
-
   ASSERT(to_split.child_nodes.size() <= 8);
 
-  bool has_leaves = false;
-  bool has_not_leaves = false;
+  // keep the children in the order of their faces.
+  std::sort(to_split.child_nodes.begin(), to_split.child_nodes.end(),
+            [](const CNode& a, const CNode& b) { return a.begin < b.begin; });
+
+  std::vector<CNode*> to_recurse;
   for (auto& child : to_split.child_nodes) {
-    if (!child.faces.empty()) {
-      has_leaves = true;
-    }
-    if (!child.child_nodes.empty()) {
-      has_not_leaves = true;
+    if (needs_split(faces, child)) {
+      to_recurse.push_back(&child);
     }
   }
 
-  if (has_leaves && has_not_leaves) {
-    std::vector<CNode> temp_children = std::move(to_split.child_nodes);
-    to_split.child_nodes = {};
-    for (auto& c : temp_children) {
-      if (!c.faces.empty()) {
-        to_split.child_nodes.emplace_back();
-        to_split.child_nodes.emplace_back();
-        split_node_once(c, &to_split.child_nodes[to_split.child_nodes.size() - 1],
-                        &to_split.child_nodes[to_split.child_nodes.size() - 2]);
-      } else {
-        to_split.child_nodes.push_back(std::move(c));
-      }
+  // the children are disjoint ranges of faces, so they can be split at the same time.
+  auto recurse = [&](int i) { split_recursive(faces, *to_recurse[i]); };
+  if (to_split.face_count() >= MIN_FACES_FOR_PARALLEL_SPLIT && to_recurse.size() > 1) {
+    ThreadPool::global().parallel_for(to_recurse.size(), recurse);
+  } else {
+    for (size_t i = 0; i < to_recurse.size(); i++) {
+      recurse(i);
     }
   }
-}
 
-/*!
- * Recursively compute bspheres of all children
- * (note that we don't do bspheres of bspheres... I think this is better?)
- */
-void bsphere_recursive(CNode& node) {
-  compute_my_bsphere_ritters(node);
-  for (auto& child : node.child_nodes) {
-    bsphere_recursive(child);
+  // a draw node must have only frags or only draw nodes as children. Put leaves next to split
+  // nodes under their own draw node.
+  if (!to_recurse.empty() && to_recurse.size() != to_split.child_nodes.size()) {
+    for (auto& child : to_split.child_nodes) {
+      if (child.is_leaf()) {
+        CNode leaf = child;
+        if (leaf.face_count() > 1) {
+          child.child_nodes.resize(2);
+          split_node_once(faces, leaf, &child.child_nodes[0], &child.child_nodes[1]);
+        } else {
+          child.child_nodes.push_back(leaf);
+        }
+      }
+    }
   }
 }
 
-void drawable_layout_helper(const CNode& node_in,
+void drawable_layout_helper(const std::vector<jak1::CollideFace>& faces,
+                            const CNode& node_in,
                             CollideTree& tree_out,
                             DrawNode& parent_to_add_to) {
-  if (node_in.faces.empty()) {
-    ASSERT(!node_in.child_nodes.empty());
+  if (!node_in.is_leaf()) {
     auto& next = parent_to_add_to.draw_node_children.emplace_back();
     next.bsphere = node_in.bsphere;
     for (auto& c : node_in.child_nodes) {
-      drawable_layout_helper(c, tree_out, next);
+      drawable_layout_helper(faces, c, tree_out, next);
     }
 
   } else {
-    ASSERT(node_in.child_nodes.empty());
     size_t frag_idx = tree_out.frags.frags.size();
     auto& frag_out = tree_out.frags.frags.emplace_back();
-    frag_out.faces = node_in.faces;
+    frag_out.faces.assign(faces.begin() + node_in.begin, faces.begin() + node_in.end);
     frag_out.bsphere = node_in.bsphere;
     parent_to_add_to.frag_children.push_back((int)frag_idx);
   }
 }
 
-CollideTree build_collide_tree(CNode& root) {
+CollideTree build_collide_tree(const std::vector<jak1::CollideFace>& faces, CNode& root) {
   CollideTree tree;
-  drawable_layout_helper(root, tree, tree.fake_root_node);
+  drawable_layout_helper(faces, root, tree, tree.fake_root_node);
   return tree;
 }
 
@@ -283,19 +344,17 @@ CollideTree construct_collide_bvh(const std::vector<jak1::CollideFace>& tris) {
   // part 1: build the tree
   Timer bvh_timer;
   lg::info("Building collide bvh from {} triangles", tris.size());
+  std::vector<jak1::CollideFace> faces = tris;
   CNode root;
-  root.faces = tris;
-  split_recursive(root);
+  root.begin = 0;
+  root.end = faces.size();
+  compute_my_bsphere_ritters(root, faces);
+  split_recursive(faces, root);
   lg::info("BVH tree constructed in {:.2f} ms", bvh_timer.getMs());
 
-  // part 2: compute bspheres
+  // part 2: layout tree
   bvh_timer.start();
-  bsphere_recursive(root);
-  lg::info("Found bspheres in {:.2f} ms", bvh_timer.getMs());
-
-  // part 3: layout tree
-  bvh_timer.start();
-  auto tree = build_collide_tree(root);
+  auto tree = build_collide_tree(faces, root);
   debug_stats(tree);
 
   lg::info("Tree layout done in {:.2f} ms", bvh_timer.getMs());
@@ -311,4 +370,20 @@ CollideTree construct_collide_bvh(const std::vector<jak1::CollideFace>& tris) {
   return tree;
 }
 
+void DrawNode::serialize(Serializer& ser) {
+  ser.from_vector(&draw_node_children, [&](DrawNode* child) { child->serialize(ser); });
+  ser.from_pod_vector(&frag_children);
+  ser.from_ptr(&bsphere);
+}
+
+void CollideFrag::serialize(Serializer& ser) {
+  ser.from_ptr(&bsphere);
+  ser.from_pod_vector(&faces);
+}
+
+void CollideTree::serialize(Serializer& ser) {
+  fake_root_node.serialize(ser);
+  ser.from_vector(&frags.frags, [&](CollideFrag* frag) { frag->serialize(ser); });
+}
+
 }  // namespace collide
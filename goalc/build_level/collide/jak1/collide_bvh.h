@@ -2,6 +2,8 @@
 
 #include <vector>
 
+#include "common/util/Serializer.h"
+
 #include "goalc/build_level/collide/common/collide_common.h"
 
 // requirements:
@@ -15,11 +17,13 @@ struct DrawNode {
   std::vector<DrawNode> draw_node_children;
   std::vector<int> frag_children;
   math::Vector4f bsphere;
+  void serialize(Serializer& ser);
 };
 
 struct CollideFrag {
   math::Vector4f bsphere;
   std::vector<jak1::CollideFace> faces;
+  void serialize(Serializer& ser);
 };
 
 struct DrawableInlineArrayNode {
@@ -34,6 +38,7 @@ struct CollideTree {
   //  std::vector<DrawableInlineArrayNode> node_arrays;
   DrawNode fake_root_node;  // the children of this are the ones that go in the top level.
   DrawableInlineArrayCollideFrag frags;
+  void serialize(Serializer& ser);
 };
 
 CollideTree construct_collide_bvh(const std::vector<jak1::CollideFace>& tris);
@@ -81,11 +81,7 @@ size_t generate_packed_collide_data(DataObjectGenerator& gen, const std::vector<
   gen.align_to_basic();
   size_t result = gen.current_offset_bytes();
   ASSERT((data.size() % 4) == 0);
-  for (size_t i = 0; i < data.size(); i += 4) {
-    u32 word;
-    memcpy(&word, data.data() + i, 4);
-    gen.add_word(word);
-  }
+  gen.add_pod_vector(data);
   return result;
 }
 
@@ -270,3 +270,19 @@ CollideFragMeshDataArray pack_collide_frags(const std::vector<collide::CollideFr
 // packed_data:
 //  (u16x3) per vertex, packed float vtx format.
 //
+
+void CollideFragMeshData::serialize(Serializer& ser) {
+  ser.from_ptr(&bsphere);
+  ser.from_pod_vector(&packed_data);
+  ser.from_ptr(&strip_data_len);
+  ser.from_ptr(&poly_count);
+  ser.from_ptr(&base_trans_xyz_s32);
+  ser.from_ptr(&vertex_count);
+  ser.from_ptr(&vertex_data_qwc);
+  ser.from_ptr(&total_qwc);
+}
+
+void CollideFragMeshDataArray::serialize(Serializer& ser) {
+  ser.from_vector(&packed_frag_data, [&](CollideFragMeshData* frag) { frag->serialize(ser); });
+  ser.from_pod_vector(&pats);
+}
@@ -11,11 +11,13 @@ struct CollideFragMeshData {
   u8 vertex_count;
   u8 vertex_data_qwc;
   u8 total_qwc;
+  void serialize(Serializer& ser);
 };
 
 struct CollideFragMeshDataArray {
   std::vector<CollideFragMeshData> packed_frag_data;
   std::vector<jak1::PatSurface> pats;
+  void serialize(Serializer& ser);
 };
 
 CollideFragMeshDataArray pack_collide_frags(const std::vector<collide::CollideFrag>& frag_data);
\ No newline at end of file
@@ -1,12 +1,13 @@
 #include "collide.h"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <unordered_map>
-#include <unordered_set>
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/ThreadPool.h"
 
 #include "goalc/data_compiler/DataObjectGenerator.h"
 
@@ -244,15 +245,17 @@ FragStats compute_frag_stats(const std::vector<jak3::CollideFace>& tris,
     }
   }
 
+  std::vector<float> vx;
+  vx.reserve(indices.size() * 3);
   for (int i = 0; i < 3; i++) {
-    std::vector<float> vx;
-    vx.reserve(tris.size() * 3);
+    vx.clear();
     for (auto idx : indices) {
       for (const auto& vtx : tris[idx].v) {
         vx.push_back(vtx[i]);
       }
     }
-    std::sort(vx.begin(), vx.end());
+    // only the middle element is needed, no need to sort them all.
+    std::nth_element(vx.begin(), vx.begin() + vx.size() / 2, vx.end());
     ret.median_vertex_position[i] = vx[vx.size() / 2];
   }
 
@@ -260,12 +263,6 @@ FragStats compute_frag_stats(const std::vector<jak3::CollideFace>& tris,
   return ret;
 }
 
-struct VectorHash {
-  size_t operator()(const math::Vector3f& in) const {
-    return std::hash<float>()(in.x()) ^ std::hash<float>()(in.y()) ^ std::hash<float>()(in.z());
-  }
-};
-
 struct CVertexHash {
   size_t operator()(const math::Vector<u16, 3>& in) const {
     return std::hash<u16>()(in.x()) ^ std::hash<u16>()(in.y()) ^ std::hash<u16>()(in.z());
@@ -277,13 +274,25 @@ struct CVertexHash {
  * (currently using float equality, however, a smarter version could look at quantized vertices)
  */
 int unique_vertex_count(const Frag& frag, const std::vector<jak3::CollideFace>& tris) {
-  std::unordered_set<math::Vector3f, VectorHash> vmap;
+  std::vector<math::Vector3f> verts;
+  verts.reserve(frag.tri_indices.size() * 3);
   for (auto i : frag.tri_indices) {
     for (const auto& v : tris[i].v) {
-      vmap.insert(v);
+      verts.push_back(v);
     }
   }
-  return (int)vmap.size();
+  // sorting a flat array is much faster than inserting into a hash set.
+  const auto less = [](const math::Vector3f& a, const math::Vector3f& b) {
+    if (a.x() != b.x()) {
+      return a.x() < b.x();
+    }
+    if (a.y() != b.y()) {
+      return a.y() < b.y();
+    }
+    return a.z() < b.z();
+  };
+  std::sort(verts.begin(), verts.end(), less);
+  return (int)(std::unique(verts.begin(), verts.end()) - verts.begin());
 }
 
 /*!
@@ -309,8 +318,8 @@ bool frag_is_valid_for_packing(const Frag& frag,
     }
   }
 
-  // there is a limit to the number of unique vertices
-  if (unique_vertex_count(frag, tris) >= UINT8_MAX) {
+  // there is a limit to the number of unique vertices. Small frags can't have that many.
+  if (frag.tri_indices.size() * 3 >= UINT8_MAX && unique_vertex_count(frag, tris) >= UINT8_MAX) {
     return false;
   }
 
@@ -341,34 +350,56 @@ struct SplitStats {
   bool had_zero = false;
 };
 
-SplitStats compute_split_stats(const Frag& frag,
-                               const std::vector<jak3::CollideFace>& tris,
-                               const FragSplit& split) {
-  SplitStats stats;
-  BBoxBuilder bbox[2];
+/*!
+ * The average of the vertices of each triangle, which is the point used to pick its side of a
+ * split.
+ */
+std::vector<math::Vector3f> compute_tri_centers(const std::vector<jak3::CollideFace>& tris) {
+  std::vector<math::Vector3f> centers;
+  centers.reserve(tris.size());
+  for (const auto& tri : tris) {
+    centers.push_back((tri.v[0] + tri.v[1] + tri.v[2]) / 3.f);
+  }
+  return centers;
+}
+
+/*!
+ * Compute the stats for all three splits (one per axis) in a single pass over the frag.
+ */
+void compute_split_stats(const Frag& frag,
+                         const std::vector<jak3::CollideFace>& tris,
+                         const std::vector<math::Vector3f>& tri_centers,
+                         const FragSplit (&splits)[3],
+                         SplitStats (&out)[3]) {
+  BBoxBuilder bbox[3][2];
 
   for (auto i : frag.tri_indices) {
     const auto& tri = tris[i];
-    const math::Vector3f average_pt = (tri.v[0] + tri.v[1] + tri.v[2]) / 3.f;
-    const int out_bin = (average_pt[split.axis] > split.value) ? 1 : 0;
-    bbox[out_bin].add_tri(tri);
-    stats.tri_count[out_bin]++;
+    const auto& center = tri_centers[i];
+    for (int s = 0; s < 3; s++) {
+      const int out_bin = (center[splits[s].axis] > splits[s].value) ? 1 : 0;
+      bbox[s][out_bin].add_tri(tri);
+      out[s].tri_count[out_bin]++;
+    }
   }
-  stats.bboxes[0] = bbox[0].box;
-  stats.bboxes[1] = bbox[1].box;
-
-  if (stats.tri_count[0] && stats.tri_count[1]) {
-    stats.overlap_volume = overlap_volume(stats.bboxes[0], stats.bboxes[1]);
-    float max_count = std::max(stats.tri_count[1], stats.tri_count[0]);
-    float min_count = std::min(stats.tri_count[1], stats.tri_count[0]);
-    stats.imbalance = max_count / min_count;
-    stats.had_zero = false;
-  } else {
-    stats.overlap_volume = 0;
-    stats.imbalance = 0;
-    stats.had_zero = true;
+
+  for (int s = 0; s < 3; s++) {
+    auto& stats = out[s];
+    stats.bboxes[0] = bbox[s][0].box;
+    stats.bboxes[1] = bbox[s][1].box;
+
+    if (stats.tri_count[0] && stats.tri_count[1]) {
+      stats.overlap_volume = overlap_volume(stats.bboxes[0], stats.bboxes[1]);
+      float max_count = std::max(stats.tri_count[1], stats.tri_count[0]);
+      float min_count = std::min(stats.tri_count[1], stats.tri_count[0]);
+      stats.imbalance = max_count / min_count;
+      stats.had_zero = false;
+    } else {
+      stats.overlap_volume = 0;
+      stats.imbalance = 0;
+      stats.had_zero = true;
+    }
   }
-  return stats;
 }
 
 int idx_of_max(float a, float b, float c) {
@@ -390,7 +421,8 @@ int idx_of_max(float a, float b, float c) {
 
 FragSplit pick_best_frag_split(const Frag& frag,
                                const FragStats& stats,
-                               const std::vector<jak3::CollideFace>& tris) {
+                               const std::vector<jak3::CollideFace>& tris,
+                               const std::vector<math::Vector3f>& tri_centers) {
   // this is the tricky part.
 
   // I think the most important thing about splitting is that we should try to minimize overlapping
@@ -422,8 +454,8 @@ FragSplit pick_best_frag_split(const Frag& frag,
   for (int i = 0; i < 3; i++) {
     splits[i].axis = i;
     splits[i].value = stats.average_vertex_position[i];
-    split_stats[i] = compute_split_stats(frag, tris, splits[i]);
   }
+  compute_split_stats(frag, tris, tri_centers, splits, split_stats);
 
   if (aspect > 25) {
     if (split_stats[max_idx].imbalance < 4) {
@@ -465,13 +497,11 @@ Frag add_all_to_frag(const std::vector<jak3::CollideFace>& tris) {
 
 void split_frag(const Frag& in,
                 const FragSplit& split,
-                const std::vector<jak3::CollideFace>& tris,
+                const std::vector<math::Vector3f>& tri_centers,
                 Frag* out_a,
                 Frag* out_b) {
   for (auto i : in.tri_indices) {
-    const auto& tri = tris[i];
-    const math::Vector3f average_pt = (tri.v[0] + tri.v[1] + tri.v[2]) / 3.f;
-    if (average_pt[split.axis] > split.value) {
+    if (tri_centers[i][split.axis] > split.value) {
       out_a->tri_indices.push_back(i);
     } else {
       out_b->tri_indices.push_back(i);
@@ -479,12 +509,57 @@ void split_frag(const Frag& in,
   }
 }
 
-std::vector<Frag> fragment_mesh(const std::vector<jak3::CollideFace>& tris) {
-  struct FragAndStats {
-    Frag f;
-    FragStats s;
+/*!
+ * Frags with at least this many triangles split their halves in parallel.
+ */
+constexpr size_t kMinTrisForParallelSplit = 8192;
+
+/*!
+ * Split a frag that is too big until all the pieces are valid, and add them to out.
+ * The order is the same as splitting the too-big frags from a stack: the valid halves go first,
+ * then the pieces of the second half, then the pieces of the first half.
+ */
+void split_until_valid(const Frag& frag,
+                       const FragStats& stats,
+                       const std::vector<jak3::CollideFace>& tris,
+                       const std::vector<math::Vector3f>& tri_centers,
+                       std::vector<Frag>* out) {
+  Frag ab[2];
+  FragStats ab_stats[2];
+  auto split = pick_best_frag_split(frag, stats, tris, tri_centers);
+  split_frag(frag, split, tri_centers, &ab[0], &ab[1]);
+
+  std::vector<int> too_big;
+  for (int i = 0; i < 2; i++) {
+    ab_stats[i] = compute_frag_stats(tris, ab[i].tri_indices);
+    if (frag_is_valid_for_packing(ab[i], ab_stats[i], tris)) {
+      out->push_back(std::move(ab[i]));
+    } else {
+      too_big.insert(too_big.begin(), i);
+    }
+  }
+
+  // the halves have separate triangles, so they can be split at the same time.
+  std::vector<Frag> pieces[2];
+  auto recurse = [&](int i) {
+    split_until_valid(ab[too_big[i]], ab_stats[too_big[i]], tris, tri_centers, &pieces[i]);
   };
+  if (too_big.size() > 1 && frag.tri_indices.size() >= kMinTrisForParallelSplit) {
+    ThreadPool::global().parallel_for(too_big.size(), recurse);
+  } else {
+    for (size_t i = 0; i < too_big.size(); i++) {
+      recurse(i);
+    }
+  }
+
+  for (auto& list : pieces) {
+    for (auto& piece : list) {
+      out->push_back(std::move(piece));
+    }
+  }
+}
 
+std::vector<Frag> fragment_mesh(const std::vector<jak3::CollideFace>& tris) {
   auto initial_frag = add_all_to_frag(tris);
   auto initial_stats = compute_frag_stats(tris, initial_frag.tri_indices);
   if (frag_is_valid_for_packing(initial_frag, initial_stats, tris)) {
@@ -495,30 +570,10 @@ std::vector<Frag> fragment_mesh(const std::vector<jak3::CollideFace>& tris) {
   }
 
   // split up all "too big" frags until they are good.
-  std::vector<FragAndStats> too_big_frags = {{initial_frag, initial_stats}};
+  const auto tri_centers = compute_tri_centers(tris);
   std::vector<Frag> good_frags;
-
-  while (!too_big_frags.empty()) {
-    printf("sizes %zu %zu\n", too_big_frags.size(), good_frags.size());
-    auto& back = too_big_frags.back();
-
-    // split it!
-    FragAndStats ab[2];
-    auto split = pick_best_frag_split(back.f, back.s, tris);
-    split_frag(back.f, split, tris, &ab[0].f, &ab[1].f);
-
-    too_big_frags.pop_back();  // invalidate back.
-
-    // check if split frags are good or not.
-    for (auto& fs : ab) {
-      fs.s = compute_frag_stats(tris, fs.f.tri_indices);
-      if (frag_is_valid_for_packing(fs.f, fs.s, tris)) {
-        good_frags.push_back(std::move(fs.f));
-      } else {
-        too_big_frags.push_back(std::move(fs));
-      }
-    }
-  }
+  split_until_valid(initial_frag, initial_stats, tris, tri_centers, &good_frags);
+  lg::info("Split collide mesh into {} frags", good_frags.size());
   return good_frags;
 }
 
@@ -532,6 +587,29 @@ struct VectorIntHash {
   }
 };
 
+/*!
+ * Find the range of cells [start, end] along one axis of a grid that could touch [lo, hi].
+ * The range has an extra cell on each side, so rounding in the cell boxes can't lose an
+ * intersection. Only the cells in the range need the exact test.
+ */
+void grid_cell_range(float lo,
+                     float hi,
+                     float grid_min,
+                     float cell_size,
+                     int dim,
+                     int* start,
+                     int* end) {
+  if (!(cell_size > 0) || !std::isfinite(cell_size)) {
+    *start = 0;
+    *end = dim - 1;
+    return;
+  }
+  const float first = std::floor((lo - grid_min) / cell_size) - 1;
+  const float last = std::floor((hi - grid_min) / cell_size) + 1;
+  *start = (int)std::max(first, 0.f);
+  *end = (int)std::min(last, (float)(dim - 1));
+}
+
 CollideHash build_grid_for_main_hash(std::vector<CollideFragment>&& frags) {
   lg::info("Creating main hash");
   CollideHash result;
@@ -561,35 +639,39 @@ CollideHash build_grid_for_main_hash(std::vector<CollideFragment>&& frags) {
                                       box_size[1] / grid_dimension[1],
                                       box_size[2] / grid_dimension[2]);
 
-  std::vector<std::vector<int>> frags_in_cells;
+  // yzx order to match game
+  std::vector<std::vector<int>> frags_in_cells(grid_dimension[0] * grid_dimension[1] *
+                                               grid_dimension[2]);
 
   // debug
   std::vector<bool> debug_found_flags(frags.size(), false);
   int debug_intersect_count = 0;
 
-  // yzx order to match game
-  for (int yi = 0; yi < grid_dimension[1]; yi++) {
-    for (int zi = 0; zi < grid_dimension[2]; zi++) {
-      for (int xi = 0; xi < grid_dimension[0]; xi++) {
-        auto& cell_list = frags_in_cells.emplace_back();
-
-        BoundingBox cell;
-        cell.min =
-            math::Vector3f(xi * grid_cell_size[0], yi * grid_cell_size[1], zi * grid_cell_size[2]) +
-            bbox.box.min;
-        cell.max = cell.min + grid_cell_size;
-
-        for (size_t fi = 0; fi < frags.size(); fi++) {
-          const auto& frag = frags[fi];
+  // only check a frag against the cells near its bounding box. Frags are visited in order, so the
+  // cell lists come out sorted.
+  for (size_t fi = 0; fi < frags.size(); fi++) {
+    const auto& frag = frags[fi];
+    int start[3], end[3];
+    for (int i = 0; i < 3; i++) {
+      grid_cell_range(frag.bbox_min_corner[i], frag.bbox_max_corner[i], bbox.box.min[i],
+                      grid_cell_size[i], grid_dimension[i], &start[i], &end[i]);
+    }
+    for (int yi = start[1]; yi <= end[1]; yi++) {
+      for (int zi = start[2]; zi <= end[2]; zi++) {
+        for (int xi = start[0]; xi <= end[0]; xi++) {
+          BoundingBox cell;
+          cell.min = math::Vector3f(xi * grid_cell_size[0], yi * grid_cell_size[1],
+                                    zi * grid_cell_size[2]) +
+                     bbox.box.min;
+          cell.max = cell.min + grid_cell_size;
+
           if (bounding_box_bounding_box(cell, {frag.bbox_min_corner, frag.bbox_max_corner})) {
             debug_found_flags[fi] = true;
             debug_intersect_count++;
-            cell_list.push_back(fi);
+            frags_in_cells[(yi * grid_dimension[2] + zi) * grid_dimension[0] + xi].push_back(fi);
           }
         }
-
-        std::sort(cell_list.begin(), cell_list.end());
-      };
+      }
     }
   }
 
@@ -721,36 +803,40 @@ jak3::CollideFragment build_grid_for_frag(const std::vector<jak3::CollideFace>&
   }
   ASSERT(grid_dimension[0] * grid_dimension[1] * grid_dimension[2] == 256);
 
-  // per-cell, a list of polys that intersect it.
-  std::vector<std::vector<int>> polys_in_cells;
+  // per-cell, a list of polys that intersect it, in yzx order to match game
+  std::vector<std::vector<int>> polys_in_cells(256);
 
   // debug
   std::vector<bool> debug_found_flags(frag.tri_indices.size(), false);
   int debug_intersect_count = 0;
 
-  // yzx order to match game
-  for (int yi = 0; yi < grid_dimension[1]; yi++) {
-    for (int zi = 0; zi < grid_dimension[2]; zi++) {
-      for (int xi = 0; xi < grid_dimension[0]; xi++) {
-        auto& cell_list = polys_in_cells.emplace_back();
-
-        BoundingBox cell;
-        cell.min =
-            math::Vector3f(xi * grid_cell_size[0], yi * grid_cell_size[1], zi * grid_cell_size[2]) +
-            bbox.box.min;
-        cell.max = cell.min + grid_cell_size;
-
-        for (size_t ti = 0; ti < frag.tri_indices.size(); ti++) {
-          const auto& tri = tris[frag.tri_indices[ti]];
+  // only run the full triangle-box test on the cells near the triangle's bounding box. Triangles
+  // are visited in order, so the cell lists come out sorted.
+  for (size_t ti = 0; ti < frag.tri_indices.size(); ti++) {
+    const auto& tri = tris[frag.tri_indices[ti]];
+    const math::Vector3f tri_min = tri.v[0].min(tri.v[1].min(tri.v[2]));
+    const math::Vector3f tri_max = tri.v[0].max(tri.v[1].max(tri.v[2]));
+    int start[3], end[3];
+    for (int i = 0; i < 3; i++) {
+      grid_cell_range(tri_min[i], tri_max[i], bbox.box.min[i], grid_cell_size[i],
+                      grid_dimension[i], &start[i], &end[i]);
+    }
+    for (int yi = start[1]; yi <= end[1]; yi++) {
+      for (int zi = start[2]; zi <= end[2]; zi++) {
+        for (int xi = start[0]; xi <= end[0]; xi++) {
+          BoundingBox cell;
+          cell.min = math::Vector3f(xi * grid_cell_size[0], yi * grid_cell_size[1],
+                                    zi * grid_cell_size[2]) +
+                     bbox.box.min;
+          cell.max = cell.min + grid_cell_size;
+
           if (triangle_bounding_box(cell, tri.v[0], tri.v[1], tri.v[2])) {
             debug_found_flags[ti] = true;
             debug_intersect_count++;
-            cell_list.push_back(ti);
+            polys_in_cells[(yi * grid_dimension[2] + zi) * grid_dimension[0] + xi].push_back(ti);
           }
         }
-
-        std::sort(cell_list.begin(), cell_list.end());
-      };
+      }
     }
   }
 
@@ -810,10 +896,9 @@ CollideHash construct_collide_hash(const std::vector<jak3::CollideFace>& tris) {
   CollideHash collide_hash;
 
   std::vector<Frag> frags = fragment_mesh(tris);
-  std::vector<CollideFragment> hashed_frags;
-  for (auto& frag : frags) {
-    hashed_frags.push_back(build_grid_for_frag(tris, frag));
-  }
+  std::vector<CollideFragment> hashed_frags(frags.size());
+  ThreadPool::global().parallel_for(
+      frags.size(), [&](int i) { hashed_frags[i] = build_grid_for_frag(tris, frags[i]); });
 
   // hash tris in frags
   // hash frags
@@ -828,24 +913,11 @@ size_t add_pod_to_object_file(DataObjectGenerator& gen,
   const size_t align_words = (align_bytes + 3) / 4;
   gen.align(align_words);
   const size_t ret = gen.current_offset_bytes();
-
-  const size_t full_words = size_bytes / 4;
-  size_t bytes = 0;
-  for (size_t word = 0; word < full_words; word++) {
-    u32 data = 0;
-    memcpy(&data, in + 4 * word, 4);
-    gen.add_word(data);
-    bytes += 4;
+  gen.add_data(in, size_bytes);
+  // there's always at least one byte of padding after the data.
+  if (size_bytes % 4 == 0) {
+    gen.add_word(0);
   }
-
-  u8 remainder[4] = {0, 0, 0, 0};
-  int i = 0;
-  while (bytes < size_bytes) {
-    remainder[i++] = in[bytes++];
-  }
-  u32 last;
-  memcpy(&last, remainder, 4);
-  gen.add_word(last);
   return ret;
 }
 
@@ -954,6 +1026,18 @@ size_t add_to_object_file(const CollideFragment& frag, DataObjectGenerator& gen)
 }
 
 size_t add_to_object_file(const CollideHash& hash, DataObjectGenerator& gen) {
+  // the fragments and the item array are most of the object, allocate room for them up front.
+  size_t words = hash.buckets.size() + 2 * hash.index_array.size() + 32;
+  for (auto& frag : hash.fragments) {
+    const size_t bytes = frag.pat_array.size() * sizeof(frag.pat_array[0]) +
+                         frag.buckets.size() * sizeof(frag.buckets[0]) +
+                         frag.poly_array.size() * sizeof(frag.poly_array[0]) +
+                         frag.vert_array.size() * sizeof(frag.vert_array[0]) +
+                         frag.index_array.size() * sizeof(frag.index_array[0]);
+    words += bytes / 4 + 40;
+  }
+  gen.reserve(words, hash.index_array.size() + 5 * hash.fragments.size() + 8);
+
   std::vector<size_t> frags;
   for (auto& frag : hash.fragments) {
     frags.push_back(add_to_object_file(frag, gen));
@@ -1030,4 +1114,34 @@ size_t add_to_object_file(const CollideHash& hash, DataObjectGenerator& gen) {
 
   return result;
 }
+
+void CollideFragment::serialize(Serializer& ser) {
+  ser.from_pod_vector(&pat_array);
+  ser.from_pod_vector(&buckets);
+  ser.from_pod_vector(&index_array);
+  ser.from_pod_vector(&poly_array);
+  ser.from_pod_vector(&vert_array);
+  ser.from_ptr(&grid_step);
+  ser.from_ptr(&axis_scale);
+  ser.from_ptr(&bbox_min_corner);
+  ser.from_ptr(&bbox_max_corner);
+  ser.from_ptr(&bsphere);
+  ser.from_ptr(&bbox_min_corner_i);
+  ser.from_ptr(&bbox_max_corner_i);
+  ser.from_ptr(&dimension_array);
+}
+
+void CollideHash::serialize(Serializer& ser) {
+  ser.from_ptr(&qwc_id_bits);
+  ser.from_pod_vector(&buckets);
+  ser.from_pod_vector(&index_array);
+  ser.from_vector(&fragments, [&](CollideFragment* frag) { frag->serialize(ser); });
+  ser.from_ptr(&grid_step);
+  ser.from_ptr(&axis_scale);
+  ser.from_ptr(&bbox_min_corner);
+  ser.from_ptr(&bbox_min_corner_i);
+  ser.from_ptr(&bbox_max_corner_i);
+  ser.from_ptr(&dimension_array);
+}
+
 }  // namespace jak3
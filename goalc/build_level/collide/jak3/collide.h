@@ -4,6 +4,7 @@
 
 #include "common/common_types.h"
 #include "common/math/Vector.h"
+#include "common/util/Serializer.h"
 
 #include "goalc/build_level/collide/common/collide_common.h"
 
@@ -76,6 +77,7 @@ struct CollideFragment {
 
   // the number of cells in the grid along the x/y/z axis
   u32 dimension_array[3] = {0, 0, 0};
+  void serialize(Serializer& ser);
 };
 
 /*
@@ -114,6 +116,7 @@ struct CollideHash {
   math::Vector<s32, 3> bbox_min_corner_i;
   math::Vector<s32, 3> bbox_max_corner_i;
   u32 dimension_array[3] = {0, 0, 0};
+  void serialize(Serializer& ser);
 };
 
 CollideHash construct_collide_hash(const std::vector<jak1::CollideFace>& tris);
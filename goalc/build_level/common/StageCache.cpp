@@ -0,0 +1,70 @@
+#include "StageCache.h"
+
+#include <cstring>
+
+#include "common/log/log.h"
+#include "common/util/Assert.h"
+#include "common/util/MappedFile.h"
+#include "common/util/compress.h"
+
+#include "fmt/core.h"
+
+namespace {
+constexpr u32 kMagic = 0x434c4231;  // "1BLC"
+constexpr u32 kVersion = 1;
+
+struct CacheFileHeader {
+  u32 magic = kMagic;
+  u32 version = kVersion;
+  u64 key = 0;
+};
+}  // namespace
+
+bool StageCache::load(const std::string& stage,
+                      const StageKey& key,
+                      const std::function<void(Serializer&)>& serialize) {
+  auto path = m_dir / fmt::format("{}.bin", stage);
+  if (!fs::exists(path)) {
+    return false;
+  }
+  MappedFile file_data(path, MappedFile::Access::SEQUENTIAL);
+  CacheFileHeader header;
+  if (file_data.size() < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, file_data.data(), sizeof(header));
+  if (header.magic != kMagic || header.version != kVersion || header.key != key.value()) {
+    return false;
+  }
+
+  auto data = compression::decompress_zstd(file_data.data() + sizeof(header),
+                                           file_data.size() - sizeof(header));
+  Serializer ser(data.data(), data.size(), false);
+  serialize(ser);
+  ASSERT_MSG(ser.get_load_finished(),
+             fmt::format("build cache file {} did not match the stage", path.string()));
+  lg::info("Using cached {} from {}", stage, path.string());
+  return true;
+}
+
+void StageCache::save(const std::string& stage,
+                      const StageKey& key,
+                      const std::function<void(Serializer&)>& serialize) {
+  Serializer ser;
+  serialize(ser);
+  auto [data, size] = ser.get_save_result();
+  auto compressed = compression::compress_zstd(data, size);
+
+  CacheFileHeader header;
+  header.key = key.value();
+  std::vector<u8> file_data(sizeof(header) + compressed.size());
+  memcpy(file_data.data(), &header, sizeof(header));
+  memcpy(file_data.data() + sizeof(header), compressed.data(), compressed.size());
+
+  // write then rename, so an interrupted build can't leave half of a file that looks valid.
+  file_util::create_dir_if_needed(m_dir);
+  auto path = m_dir / fmt::format("{}.bin", stage);
+  auto tmp_path = m_dir / fmt::format("{}.bin.tmp", stage);
+  file_util::write_binary_file(tmp_path, file_data.data(), file_data.size());
+  fs::rename(tmp_path, path);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+#include "common/util/Serializer.h"
+#include "common/util/hash.h"
+
+/*!
+ * A hash of everything a build_level stage depends on.
+ */
+class StageKey {
+ public:
+  void add(const void* data, size_t size) { m_hasher.update(data, size); }
+
+  template <typename T>
+  void add_pod(const T& x) {
+    add(&x, sizeof(T));
+  }
+
+  template <typename T>
+  void add_pod_vector(const std::vector<T>& vec) {
+    add_pod(vec.size());
+    add(vec.data(), vec.size() * sizeof(T));
+  }
+
+  void add_str(const std::string& str) {
+    add_pod(str.size());
+    add(str.data(), str.size());
+  }
+
+  u64 value() const { return m_hasher.digest64(); }
+
+ private:
+  hash_util::Hasher m_hasher;
+};
+
+/*!
+ * On-disk cache of the slow stages of build_level (reading the glTF mesh and building collision),
+ * so rebuilding a level after changing something else, like the actors in the level json, doesn't
+ * redo them.
+ *
+ * Each stage saves its result to its own file, along with the key of the inputs it was made from.
+ * The result is only used again if the key matches. Only the latest result of each stage is kept.
+ * If you change what a stage does, bump kVersion in StageCache.cpp so old results are not used.
+ */
+class StageCache {
+ public:
+  explicit StageCache(const fs::path& dir) : m_dir(dir) {}
+
+  /*!
+   * If there's a result for this stage with a matching key, call serialize with a loading
+   * Serializer to read it, and return true.
+   */
+  bool load(const std::string& stage,
+            const StageKey& key,
+            const std::function<void(Serializer&)>& serialize);
+
+  /*!
+   * Save the result of a stage. serialize is called with a saving Serializer to write it.
+   */
+  void save(const std::string& stage,
+            const StageKey& key,
+            const std::function<void(Serializer&)>& serialize);
+
+ private:
+  fs::path m_dir;
+};
@@ -18,6 +18,7 @@ void add_tree(std::vector<tfrag3::TfragTree>& out_pc,
   normal.draws = draws;
   pack_tfrag_vertices(&normal.packed_vertices, mesh_extract_out.tfrag_vertices);
   normal.colors = gltf_util::pack_time_of_day(mesh_extract_out.color_palette);
+  normal.bvh = mesh_extract_out.bvh;
   normal.use_strips = false;
 }
 
@@ -3,7 +3,7 @@
 void tie_from_gltf(const gltf_mesh_extract::TieOutput& mesh_extract_out,
                    std::vector<tfrag3::TieTree>& out_pc) {
   auto& out = out_pc.emplace_back();
-  // bvh: leave default
+  out.bvh = mesh_extract_out.bvh;
   // draws
   // categories
   out.category_draw_indices[0] = 0;
@@ -1,12 +1,15 @@
 #include "build_level.h"
 
+#include "common/util/MappedFile.h"
+#include "common/util/gltf_util.h"
+
 void save_pc_data(const std::string& nickname,
                   tfrag3::Level& data,
                   const fs::path& fr3_output_dir) {
   Serializer ser;
   data.serialize(ser);
   auto compressed =
-      compression::compress_zstd(ser.get_save_result().first, ser.get_save_result().second);
+      tfrag3::make_fr3_file(ser.get_save_result().first, ser.get_save_result().second);
   lg::print("stats for {}\n", data.level_name);
   print_memory_usage(data, ser.get_save_result().second);
   lg::print("compressed: {} -> {} ({:.2f}%)\n", ser.get_save_result().second, compressed.size(),
@@ -15,6 +18,39 @@ void save_pc_data(const std::string& nickname,
                                compressed.size());
 }
 
+fs::path build_cache_dir(const std::string& output_prefix, const std::string& nickname) {
+  return file_util::get_jak_project_dir() / "out" / output_prefix / "build_cache" / nickname;
+}
+
+/*!
+ * Run the glTF mesh extract, or reuse the last result if the glb file and the mesh settings are
+ * the same. The textures the extract adds to the texture pool are cached too, so the pool should
+ * start out empty.
+ */
+void extract_mesh_cached(StageCache& cache,
+                         const gltf_mesh_extract::Input& in,
+                         gltf_mesh_extract::Output& out) {
+  ASSERT(in.tex_pool->textures_by_idx.empty());
+  StageKey key;
+  MappedFile glb(in.filename, MappedFile::Access::SEQUENTIAL);
+  key.add_pod(glb.size());
+  key.add(glb.data(), glb.size());
+  key.add_pod(in.auto_wall_enable);
+  key.add_pod(in.auto_wall_angle);
+  key.add_pod(in.double_sided_collide);
+  key.add_pod(in.generate_lods);
+
+  auto serialize = [&](Serializer& ser) {
+    out.serialize(ser);
+    ser.from_vector(&in.tex_pool->textures_by_idx,
+                    [&](tfrag3::Texture* tex) { tex->serialize(ser); });
+  };
+  if (!cache.load("mesh", key, serialize)) {
+    gltf_mesh_extract::extract(in, out);
+    cache.save("mesh", key, serialize);
+  }
+}
+
 std::vector<std::string> get_build_level_deps(const std::string& input_file) {
   auto level_json = parse_commented_json(
       file_util::read_text_file(file_util::get_file_path({input_file})), input_file);
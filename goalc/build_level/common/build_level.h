@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include "common/custom_data/Fr3File.h"
 #include "common/log/log.h"
 #include "common/util/compress.h"
 #include "common/util/json_util.h"
@@ -10,8 +11,14 @@
 
 #include "decompiler/level_extractor/extract_level.h"
 #include "goalc/build_actor/common/MercExtract.h"
+#include "goalc/build_level/common/StageCache.h"
+#include "goalc/build_level/common/gltf_mesh_extract.h"
 
 void save_pc_data(const std::string& nickname, tfrag3::Level& data, const fs::path& fr3_output_dir);
+fs::path build_cache_dir(const std::string& output_prefix, const std::string& nickname);
+void extract_mesh_cached(StageCache& cache,
+                         const gltf_mesh_extract::Input& in,
+                         gltf_mesh_extract::Output& out);
 std::vector<std::string> get_build_level_deps(const std::string& input_file);
 std::vector<decompiler::ObjectFileRecord> find_art_groups(
     std::vector<std::string>& processed_ags,
@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
 #include <set>
 #include <unordered_map>
 
 #include "common/log/log.h"
 #include "common/util/Assert.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/Timer.h"
 
 /*!
@@ -523,3 +526,362 @@ QuantizedColors quantize_colors_kd_tree(const std::vector<math::Vector<u8, 4>>&
 
   return result;
 }
+
+namespace {
+
+using Vec4 = std::array<float, 4>;
+
+float distance_squared(const Vec4& a, const Vec4& b) {
+  float ret = 0;
+  for (int i = 0; i < 4; i++) {
+    const float diff = a[i] - b[i];
+    ret += diff * diff;
+  }
+  return ret;
+}
+
+/*!
+ * Colors used by the input, with how many vertices use them. Sorted by u32 value.
+ */
+struct UniqueColors {
+  std::vector<u32> values;
+  std::vector<Vec4> colors;
+  std::vector<float> weights;
+};
+
+UniqueColors count_unique_colors(const std::vector<Color>& in) {
+  std::vector<u32> sorted;
+  sorted.reserve(in.size());
+  for (auto& c : in) {
+    sorted.push_back(color_as_u32(c));
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  UniqueColors result;
+  for (size_t i = 0; i < sorted.size();) {
+    size_t end = i;
+    while (end < sorted.size() && sorted[end] == sorted[i]) {
+      end++;
+    }
+    const Color c = u32_as_color(sorted[i]);
+    result.values.push_back(sorted[i]);
+    result.colors.push_back({(float)c[0], (float)c[1], (float)c[2], (float)c[3]});
+    result.weights.push_back(end - i);
+    i = end;
+  }
+  return result;
+}
+
+/*!
+ * A box of the median cut: a range of the colors, after they're reordered.
+ */
+struct Box {
+  u32 begin = 0;
+  u32 end = 0;
+  // weighted sum of squared distances to the mean, in each dimension
+  Vec4 error = {0, 0, 0, 0};
+  float total_error = 0;
+};
+
+Box make_box(const UniqueColors& colors, const std::vector<u32>& order, u32 begin, u32 end) {
+  Box box;
+  box.begin = begin;
+  box.end = end;
+  double weight = 0;
+  double sum[4] = {0, 0, 0, 0};
+  double sum_sq[4] = {0, 0, 0, 0};
+  for (u32 i = begin; i < end; i++) {
+    const auto& c = colors.colors[order[i]];
+    const double w = colors.weights[order[i]];
+    weight += w;
+    for (int d = 0; d < 4; d++) {
+      sum[d] += w * c[d];
+      sum_sq[d] += w * c[d] * c[d];
+    }
+  }
+  for (int d = 0; d < 4; d++) {
+    box.error[d] = std::max(0., sum_sq[d] - sum[d] * sum[d] / weight);
+    box.total_error += box.error[d];
+  }
+  return box;
+}
+
+/*!
+ * Split the colors into boxes with median cut. The box with the biggest error is split along the
+ * dimension with the biggest error, at the weighted median.
+ */
+std::vector<Box> median_cut(const UniqueColors& colors, std::vector<u32>& order, u32 box_count) {
+  std::vector<Box> boxes;
+  boxes.push_back(make_box(colors, order, 0, order.size()));
+  auto cmp = [&](u32 a, u32 b) { return boxes[a].total_error < boxes[b].total_error; };
+  std::vector<u32> heap = {0};
+
+  while (boxes.size() < box_count && !heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), cmp);
+    const u32 box_idx = heap.back();
+    heap.pop_back();
+    const Box box = boxes[box_idx];
+    if (box.total_error <= 0 || box.end - box.begin < 2) {
+      continue;  // all the same color
+    }
+
+    // colors are 8-bit, so the weighted median can be found from a histogram.
+    const int dim = std::max_element(box.error.begin(), box.error.end()) - box.error.begin();
+    std::array<double, 256> histogram;
+    histogram.fill(0);
+    double total_weight = 0;
+    for (u32 i = box.begin; i < box.end; i++) {
+      histogram[(int)colors.colors[order[i]][dim]] += colors.weights[order[i]];
+      total_weight += colors.weights[order[i]];
+    }
+    // colors below split_value go in the first box, and both boxes need at least one value.
+    int lo = 0;
+    while (histogram[lo] == 0) {
+      lo++;
+    }
+    int hi = 255;
+    while (histogram[hi] == 0) {
+      hi--;
+    }
+    if (lo == hi) {
+      continue;  // only rounding error made this look splittable.
+    }
+    int split_value = lo + 1;
+    double weight = histogram[lo];
+    while (split_value < hi && weight + histogram[split_value] <= total_weight / 2) {
+      weight += histogram[split_value];
+      split_value++;
+    }
+    const u32 split =
+        std::partition(order.begin() + box.begin, order.begin() + box.end,
+                       [&](u32 c) { return colors.colors[c][dim] < split_value; }) -
+        order.begin();
+
+    boxes[box_idx] = make_box(colors, order, box.begin, split);
+    boxes.push_back(make_box(colors, order, split, box.end));
+    for (u32 idx : {box_idx, (u32)boxes.size() - 1}) {
+      heap.push_back(idx);
+      std::push_heap(heap.begin(), heap.end(), cmp);
+    }
+  }
+  return boxes;
+}
+
+/*!
+ * An implicit k-d tree over points, for nearest neighbor lookups. The node of a range of points is
+ * the middle point, split along split_dims of that point, so there is nothing to allocate per node.
+ */
+class PointTree {
+ public:
+  explicit PointTree(const std::vector<Vec4>& points) : m_points(points) {
+    m_order.resize(points.size());
+    for (u32 i = 0; i < m_order.size(); i++) {
+      m_order[i] = i;
+    }
+    m_split_dims.resize(points.size());
+    build(0, points.size());
+  }
+
+  // the closest point to p. Starting from a guess that is already close makes this faster.
+  u32 nearest(const Vec4& p, u32 guess) const {
+    u32 best = guess;
+    float best_dist = distance_squared(p, m_points[guess]);
+    nearest(p, 0, m_order.size(), &best, &best_dist);
+    return best;
+  }
+
+ private:
+  static constexpr u32 kLeafSize = 8;
+
+  void build(u32 begin, u32 end) {
+    if (end - begin <= kLeafSize) {
+      return;
+    }
+    float mins[4], maxs[4];
+    for (int d = 0; d < 4; d++) {
+      mins[d] = std::numeric_limits<float>::max();
+      maxs[d] = std::numeric_limits<float>::lowest();
+    }
+    for (u32 i = begin; i < end; i++) {
+      for (int d = 0; d < 4; d++) {
+        mins[d] = std::min(mins[d], m_points[m_order[i]][d]);
+        maxs[d] = std::max(maxs[d], m_points[m_order[i]][d]);
+      }
+    }
+    int dim = 0;
+    for (int d = 1; d < 4; d++) {
+      if (maxs[d] - mins[d] > maxs[dim] - mins[dim]) {
+        dim = d;
+      }
+    }
+    const u32 mid = (begin + end) / 2;
+    std::nth_element(m_order.begin() + begin, m_order.begin() + mid, m_order.begin() + end,
+                     [&](u32 a, u32 b) { return m_points[a][dim] < m_points[b][dim]; });
+    m_split_dims[mid] = dim;
+    build(begin, mid);
+    build(mid + 1, end);
+  }
+
+  void nearest(const Vec4& p, u32 begin, u32 end, u32* best, float* best_dist) const {
+    if (end - begin <= kLeafSize) {
+      for (u32 i = begin; i < end; i++) {
+        const float dist = distance_squared(p, m_points[m_order[i]]);
+        if (dist < *best_dist) {
+          *best_dist = dist;
+          *best = m_order[i];
+        }
+      }
+      return;
+    }
+
+    const u32 mid = (begin + end) / 2;
+    const auto& split_point = m_points[m_order[mid]];
+    const float dist = distance_squared(p, split_point);
+    if (dist < *best_dist) {
+      *best_dist = dist;
+      *best = m_order[mid];
+    }
+    const float plane_dist = p[m_split_dims[mid]] - split_point[m_split_dims[mid]];
+    if (plane_dist < 0) {
+      nearest(p, begin, mid, best, best_dist);
+      if (plane_dist * plane_dist < *best_dist) {
+        nearest(p, mid + 1, end, best, best_dist);
+      }
+    } else {
+      nearest(p, mid + 1, end, best, best_dist);
+      if (plane_dist * plane_dist < *best_dist) {
+        nearest(p, begin, mid, best, best_dist);
+      }
+    }
+  }
+
+  const std::vector<Vec4>& m_points;
+  std::vector<u32> m_order;
+  std::vector<u8> m_split_dims;
+};
+
+}  // namespace
+
+/*!
+ * Quantize colors with median cut, then refine the palette with k-means (Lloyd's algorithm), which
+ * moves each palette color to the mean of the colors that are closest to it. Colors are weighted by
+ * how many vertices use them.
+ */
+QuantizedColors quantize_colors_kmeans(const std::vector<math::Vector<u8, 4>>& in,
+                                       u32 target_count,
+                                       int max_iterations) {
+  Timer timer;
+  QuantizedColors result;
+  if (in.empty()) {
+    return result;
+  }
+  const auto unique = count_unique_colors(in);
+  const u32 num_unique = unique.colors.size();
+
+  // assignment of unique colors to palette entries
+  std::vector<u32> assignment(num_unique);
+  std::vector<Vec4> centers;
+  {
+    std::vector<u32> order(num_unique);
+    for (u32 i = 0; i < num_unique; i++) {
+      order[i] = i;
+    }
+    for (auto& box : median_cut(unique, order, target_count)) {
+      Vec4 sum = {0, 0, 0, 0};
+      float weight = 0;
+      for (u32 i = box.begin; i < box.end; i++) {
+        assignment[order[i]] = centers.size();
+        for (int d = 0; d < 4; d++) {
+          sum[d] += unique.weights[order[i]] * unique.colors[order[i]][d];
+        }
+        weight += unique.weights[order[i]];
+      }
+      for (auto& x : sum) {
+        x /= weight;
+      }
+      centers.push_back(sum);
+    }
+  }
+
+  int iterations = 0;
+  // if every color fits in the palette, there is nothing to refine.
+  if (num_unique > target_count) {
+    constexpr int kChunkSize = 1024;
+    for (; iterations < max_iterations; iterations++) {
+      // assign colors to the closest center
+      const PointTree tree(centers);
+      std::vector<int> changed_per_chunk((num_unique + kChunkSize - 1) / kChunkSize);
+      ThreadPool::global().parallel_for(changed_per_chunk.size(), [&](int chunk) {
+        const u32 end = std::min(num_unique, (u32)(chunk + 1) * kChunkSize);
+        for (u32 i = chunk * kChunkSize; i < end; i++) {
+          const u32 nearest = tree.nearest(unique.colors[i], assignment[i]);
+          if (nearest != assignment[i]) {
+            assignment[i] = nearest;
+            changed_per_chunk[chunk]++;
+          }
+        }
+      });
+      int changed = 0;
+      for (int c : changed_per_chunk) {
+        changed += c;
+      }
+      // stop once almost nothing moves, the last few iterations barely change the palette.
+      if (changed <= num_unique / 100) {
+        break;
+      }
+
+      // and move the centers to the mean of their colors. Centers that lost all their colors stay
+      // put, and are dropped at the end if they are still empty.
+      std::vector<std::array<double, 5>> sums(centers.size(), {0, 0, 0, 0, 0});
+      for (u32 i = 0; i < num_unique; i++) {
+        auto& sum = sums[assignment[i]];
+        for (int d = 0; d < 4; d++) {
+          sum[d] += unique.weights[i] * unique.colors[i][d];
+        }
+        sum[4] += unique.weights[i];
+      }
+      for (size_t c = 0; c < centers.size(); c++) {
+        if (sums[c][4] > 0) {
+          for (int d = 0; d < 4; d++) {
+            centers[c][d] = sums[c][d] / sums[c][4];
+          }
+        }
+      }
+    }
+  }
+
+  // build the palette from the centers that are used. Alpha is halved, like the other quantizers,
+  // as 0x80 is fully opaque on the PS2.
+  std::vector<u32> center_to_palette(centers.size(), UINT32_MAX);
+  std::vector<u32> unique_to_palette(num_unique);
+  for (u32 i = 0; i < num_unique; i++) {
+    auto& slot = center_to_palette[assignment[i]];
+    if (slot == UINT32_MAX) {
+      slot = result.final_colors.size();
+      const auto& c = centers[assignment[i]];
+      auto to_u8 = [](float x) { return (u8)std::clamp((int)std::round(x), 0, 255); };
+      result.final_colors.emplace_back(to_u8(c[0]), to_u8(c[1]), to_u8(c[2]), to_u8(c[3]) / 2);
+    }
+    unique_to_palette[i] = slot;
+  }
+
+  result.vtx_to_color.resize(in.size());
+  double total_error = 0;
+  for (size_t i = 0; i < in.size(); i++) {
+    const u32 value = color_as_u32(in[i]);
+    const u32 unique_idx =
+        std::lower_bound(unique.values.begin(), unique.values.end(), value) - unique.values.begin();
+    result.vtx_to_color[i] = unique_to_palette[unique_idx];
+    Color input = in[i];
+    input.w() /= 2;
+    const auto& output = result.final_colors[result.vtx_to_color[i]];
+    total_error += std::sqrt((float)color_difference(input, output));
+  }
+
+  lg::info(
+      "Quantize colors: {} input colors ({} unique) -> {} output, {} k-means iterations, average "
+      "error {:.2f}, in {:.3f} ms",
+      in.size(), num_unique, result.final_colors.size(), iterations, total_error / in.size(),
+      timer.getMs());
+  return result;
+}
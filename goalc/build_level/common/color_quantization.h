@@ -21,4 +21,13 @@ QuantizedColors quantize_colors_octree(const std::vector<math::Vector<u8, 4>>& i
                                        u32 target_count);
 
 QuantizedColors quantize_colors_kd_tree(const std::vector<math::Vector<u8, 4>>& in,
-                                        u32 target_depth);
\ No newline at end of file
+                                        u32 target_depth);
+
+/*!
+ * Quantize colors with median cut, refined by up to max_iterations of k-means. Faster than the k-d
+ * tree, and the palette is closer to the input colors. Each iteration makes it better, but takes
+ * about as long as the median cut.
+ */
+QuantizedColors quantize_colors_kmeans(const std::vector<math::Vector<u8, 4>>& in,
+                                       u32 target_count,
+                                       int max_iterations = 2);
@@ -7,15 +7,23 @@
 #include <optional>
 
 #include "color_quantization.h"
+#include "mesh_lod.h"
 
 #include "common/log/log.h"
 #include "common/math/geometry.h"
+#include "common/util/MappedFile.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/Timer.h"
 #include "common/util/gltf_util.h"
 #include "common/util/image_resize.h"
 
 using namespace gltf_util;
-constexpr int kColorTreeDepth = 13;
+// the most colors in a time of day palette
+constexpr u32 kMaxPaletteColors = 8192;
+// the most triangles in a culling cluster
+constexpr u32 kMaxClusterTris = 512;
+// the most a simplified level of detail may move the surface, for geometry 1, 2, 3.
+constexpr float kLodMaxError[] = {0.25f * 4096, 0.5f * 4096, 1.f * 4096};
 namespace gltf_mesh_extract {
 
 void dedup_tfrag_vertices(TfragOutput& data) {
@@ -80,6 +88,203 @@ void dedup_tie_vertices(TieOutput& data) {
            data.vertices.size(), 100.f * data.vertices.size() / original_size);
 }
 
+/*!
+ * Reorder the triangles in each vis group so vertices are reused from the post-transform cache,
+ * then renumber the vertices in the order the draws first use them, so the vertex fetches of a
+ * draw are close together. Triangle lists are kept: custom levels aren't drawn with strips.
+ * Returns the old index of each new vertex.
+ */
+std::vector<u32> optimize_draws(const std::vector<std::vector<tfrag3::StripDraw>*>& drawlists,
+                                u32 vertex_count) {
+  Timer timer;
+  constexpr int kReportCacheSize = 16;
+  double misses_before = 0, misses_after = 0, tris = 0;
+  std::vector<u32> inds;
+  for (auto drawlist : drawlists) {
+    for (auto& draw : *drawlist) {
+      ASSERT(draw.runs.empty());  // not supported yet
+      // the triangles can only move within their vis group.
+      u32 offset = 0;
+      for (const auto& grp : draw.vis_groups) {
+        const auto begin = draw.plain_indices.begin() + offset;
+        inds.assign(begin, begin + grp.num_inds);
+        const double grp_tris = inds.size() / 3;
+        misses_before += grp_tris * average_cache_miss_ratio(inds, vertex_count, kReportCacheSize);
+        optimize_vertex_cache(inds, vertex_count);
+        misses_after += grp_tris * average_cache_miss_ratio(inds, vertex_count, kReportCacheSize);
+        tris += grp_tris;
+        std::copy(inds.begin(), inds.end(), begin);
+        offset += grp.num_inds;
+      }
+      ASSERT(offset == draw.plain_indices.size());
+    }
+  }
+
+  std::vector<u32> old_to_new(vertex_count, UINT32_MAX);
+  std::vector<u32> new_to_old;
+  new_to_old.reserve(vertex_count);
+  for (auto drawlist : drawlists) {
+    for (auto& draw : *drawlist) {
+      for (auto& idx : draw.plain_indices) {
+        if (old_to_new[idx] == UINT32_MAX) {
+          old_to_new[idx] = new_to_old.size();
+          new_to_old.push_back(idx);
+        }
+        idx = old_to_new[idx];
+      }
+    }
+  }
+  // vertices that aren't used by any draw (or were simplified away) are dropped.
+
+  if (tris > 0) {
+    lg::info("Vertex cache optimization took {:.2f} ms, vertices per triangle {:.3f} -> {:.3f}",
+             timer.getMs(), misses_before / tris, misses_after / tris);
+  }
+  return new_to_old;
+}
+
+template <typename Vertex>
+std::vector<math::Vector3f> vertex_positions(const std::vector<Vertex>& vertices) {
+  std::vector<math::Vector3f> result;
+  result.reserve(vertices.size());
+  for (const auto& v : vertices) {
+    result.emplace_back(v.x, v.y, v.z);
+  }
+  return result;
+}
+
+/*!
+ * Group the triangles of a tree into clusters, and split each draw into a vis group per cluster so
+ * the renderer can cull them. All the draws share the returned BVH.
+ */
+tfrag3::BVH cluster_draws(const std::vector<std::vector<tfrag3::StripDraw>*>& drawlists,
+                          const std::vector<math::Vector3f>& positions) {
+  std::vector<u32> all_indices;
+  for (auto drawlist : drawlists) {
+    for (auto& draw : *drawlist) {
+      all_indices.insert(all_indices.end(), draw.plain_indices.begin(), draw.plain_indices.end());
+    }
+  }
+  auto clusters = mesh_lod::build_clusters(positions, all_indices, kMaxClusterTris);
+
+  u32 tri_offset = 0;
+  for (auto drawlist : drawlists) {
+    for (auto& draw : *drawlist) {
+      const u32 tri_count = draw.plain_indices.size() / 3;
+      std::vector<u32> order(tri_count);
+      for (u32 i = 0; i < tri_count; i++) {
+        order[i] = i;
+      }
+      std::stable_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        return clusters.tri_to_vis_node[tri_offset + a] < clusters.tri_to_vis_node[tri_offset + b];
+      });
+
+      std::vector<u32> new_indices;
+      new_indices.reserve(draw.plain_indices.size());
+      draw.vis_groups.clear();
+      for (auto tri : order) {
+        const u16 vis_node = clusters.tri_to_vis_node[tri_offset + tri];
+        if (draw.vis_groups.empty() || draw.vis_groups.back().vis_idx_in_pc_bvh != vis_node) {
+          draw.vis_groups.emplace_back().vis_idx_in_pc_bvh = vis_node;
+        }
+        auto& grp = draw.vis_groups.back();
+        grp.num_inds += 3;
+        grp.num_tris++;
+        new_indices.insert(new_indices.end(), draw.plain_indices.begin() + tri * 3,
+                           draw.plain_indices.begin() + tri * 3 + 3);
+      }
+      draw.plain_indices = std::move(new_indices);
+      tri_offset += tri_count;
+    }
+  }
+
+  lg::info("Grouped {} triangles into culling clusters, with {} BVH nodes", all_indices.size() / 3,
+           clusters.bvh.vis_nodes.size());
+  return clusters.bvh;
+}
+
+/*!
+ * Simplify each draw, to about half the triangles.
+ */
+void simplify_draws(const std::vector<std::vector<tfrag3::StripDraw>*>& drawlists,
+                    const std::vector<math::Vector3f>& positions,
+                    float max_error) {
+  Timer timer;
+  size_t tris_before = 0, tris_after = 0;
+  for (auto drawlist : drawlists) {
+    for (auto& draw : *drawlist) {
+      auto& inds = draw.plain_indices;
+      tris_before += inds.size() / 3;
+      inds = mesh_lod::simplify(positions, inds, inds.size() / 6, max_error);
+      draw.num_triangles = inds.size() / 3;
+      tris_after += inds.size() / 3;
+    }
+  }
+  lg::info("Simplification took {:.2f} ms, {} -> {} triangles", timer.getMs(), tris_before,
+           tris_after);
+}
+
+void optimize_tfrag_draws(TfragOutput& data) {
+  data.bvh = cluster_draws({&data.normal_strip_draws, &data.trans_strip_draws},
+                           vertex_positions(data.tfrag_vertices));
+  auto new_to_old = optimize_draws({&data.normal_strip_draws, &data.trans_strip_draws},
+                                   data.tfrag_vertices.size());
+  std::vector<tfrag3::PreloadedVertex> new_verts;
+  new_verts.reserve(new_to_old.size());
+  for (auto old_idx : new_to_old) {
+    new_verts.push_back(data.tfrag_vertices[old_idx]);
+  }
+  data.tfrag_vertices = std::move(new_verts);
+}
+
+void optimize_tie_draws(TieOutput& data) {
+  data.bvh = cluster_draws({&data.base_draws, &data.envmap_draws}, vertex_positions(data.vertices));
+  auto new_to_old = optimize_draws({&data.base_draws, &data.envmap_draws}, data.vertices.size());
+  std::vector<tfrag3::PackedTieVertices::Vertex> new_verts;
+  std::vector<u16> new_color_indices;
+  new_verts.reserve(new_to_old.size());
+  new_color_indices.reserve(new_to_old.size());
+  for (auto old_idx : new_to_old) {
+    new_verts.push_back(data.vertices[old_idx]);
+    new_color_indices.push_back(data.color_indices[old_idx]);
+  }
+  data.vertices = std::move(new_verts);
+  data.color_indices = std::move(new_color_indices);
+}
+
+/*!
+ * Make the lower levels of detail, each simplified from the one before.
+ */
+std::vector<TfragOutput> make_tfrag_lods(const TfragOutput& lod0) {
+  std::vector<TfragOutput> result;
+  result.reserve(tfrag3::TFRAG_GEOS - 1);
+  const TfragOutput* prev = &lod0;
+  for (int geom = 1; geom < tfrag3::TFRAG_GEOS; geom++) {
+    lg::info("Making tfrag level of detail {}", geom);
+    auto& lod = result.emplace_back(*prev);
+    simplify_draws({&lod.normal_strip_draws, &lod.trans_strip_draws},
+                   vertex_positions(lod.tfrag_vertices), kLodMaxError[geom - 1]);
+    optimize_tfrag_draws(lod);
+    prev = &lod;
+  }
+  return result;
+}
+
+std::vector<TieOutput> make_tie_lods(const TieOutput& lod0) {
+  std::vector<TieOutput> result;
+  result.reserve(tfrag3::TIE_GEOS - 1);
+  const TieOutput* prev = &lod0;
+  for (int geom = 1; geom < tfrag3::TIE_GEOS; geom++) {
+    lg::info("Making tie level of detail {}", geom);
+    auto& lod = result.emplace_back(*prev);
+    simplify_draws({&lod.base_draws, &lod.envmap_draws}, vertex_positions(lod.vertices),
+                   kLodMaxError[geom - 1]);
+    optimize_tie_draws(lod);
+    prev = &lod;
+  }
+  return result;
+}
+
 bool prim_needs_tie(const tinygltf::Model& model, const tinygltf::Primitive& prim) {
   if (prim.material >= 0) {
     auto mat = model.materials.at(prim.material);
@@ -88,21 +293,27 @@ bool prim_needs_tie(const tinygltf::Model& model, const tinygltf::Primitive& pri
   return false;
 }
 
-void extract(const Input& in,
-             TfragOutput& out,
-             const tinygltf::Model& model,
-             const std::vector<NodeWithTransform>& all_nodes) {
-  std::vector<math::Vector<u8, 4>> all_vtx_colors;
-  ASSERT(out.tfrag_vertices.empty());
-
-  struct MaterialInfo {
-    tfrag3::StripDraw draw;
-    bool needs_tie = false;
-  };
-  std::map<int, MaterialInfo> info_by_material;
-  int mesh_count = 0;
-  int prim_count = 0;
+/*!
+ * A primitive to extract, and its index buffer and vertices. Reading these from the GLTF is most of
+ * the work of extracting a mesh, so all primitives are read in parallel, then merged in order.
+ */
+struct PrimWork {
+  const NodeWithTransform* node = nullptr;
+  const tinygltf::Mesh* mesh = nullptr;
+  const tinygltf::Primitive* prim = nullptr;
+  // relative to the first vertex of the primitive
+  std::vector<u32> indices;
+  ExtractedVertices verts;
+};
 
+/*!
+ * Find the visible primitives that go in the tie or the tfrag.
+ */
+std::vector<PrimWork> find_visible_prims(const tinygltf::Model& model,
+                                         const std::vector<NodeWithTransform>& all_nodes,
+                                         bool tie,
+                                         int* mesh_count) {
+  std::vector<PrimWork> result;
   for (const auto& n : all_nodes) {
     const auto& node = model.nodes[n.node_idx];
     if (node.extras.Has("set_invisible") && node.extras.Get("set_invisible").Get<int>()) {
@@ -110,49 +321,93 @@ void extract(const Input& in,
     }
     if (node.mesh >= 0) {
       const auto& mesh = model.meshes[node.mesh];
-      mesh_count++;
+      (*mesh_count)++;
       for (const auto& prim : mesh.primitives) {
         if (prim.material >= 0 && model.materials[prim.material].extras.Has("set_invisible") &&
             model.materials[prim.material].extras.Get("set_invisible").Get<int>()) {
           continue;
         }
 
-        if (prim_needs_tie(model, prim)) {
+        if (prim_needs_tie(model, prim) != tie) {
           continue;
         }
-        prim_count++;
-        // extract index buffer
-        std::vector<u32> prim_indices =
-            gltf_index_buffer(model, prim.indices, out.tfrag_vertices.size());
-        ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
-        // extract vertices
-        auto verts = gltf_vertices(model, prim.attributes, n.w_T_node, true, false, mesh.name);
-        out.tfrag_vertices.insert(out.tfrag_vertices.end(), verts.vtx.begin(), verts.vtx.end());
-        all_vtx_colors.insert(all_vtx_colors.end(), verts.vtx_colors.begin(),
-                              verts.vtx_colors.end());
-        ASSERT(all_vtx_colors.size() == out.tfrag_vertices.size());
-
-        auto& info = info_by_material[prim.material];
-        info.draw.mode = make_default_draw_mode();                        // todo rm
-        info.draw.tree_tex_id = texture_pool_debug_checker(in.tex_pool);  // todo rm
-        info.draw.num_triangles += prim_indices.size() / 3;
-        if (info.draw.vis_groups.empty()) {
-          auto& grp = info.draw.vis_groups.emplace_back();
-          grp.num_inds += prim_indices.size();
-          grp.num_tris += info.draw.num_triangles;
-          grp.vis_idx_in_pc_bvh = UINT16_MAX;
-        } else {
-          auto& grp = info.draw.vis_groups.back();
-          grp.num_inds += prim_indices.size();
-          grp.num_tris += info.draw.num_triangles;
-          grp.vis_idx_in_pc_bvh = UINT16_MAX;
-        }
-
-        info.draw.plain_indices.insert(info.draw.plain_indices.end(), prim_indices.begin(),
-                                       prim_indices.end());
+        auto& work = result.emplace_back();
+        work.node = &n;
+        work.mesh = &mesh;
+        work.prim = &prim;
       }
     }
   }
+  return result;
+}
+
+void read_prims(const tinygltf::Model& model,
+                std::vector<PrimWork>& prims,
+                bool get_colors,
+                bool get_normals) {
+  ThreadPool::global().parallel_for(prims.size(), [&](int i) {
+    auto& work = prims[i];
+    // extract index buffer
+    work.indices = gltf_index_buffer(model, work.prim->indices, 0);
+    ASSERT_MSG(work.prim->mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
+    // extract vertices
+    work.verts = gltf_vertices(model, work.prim->attributes, work.node->w_T_node, get_colors,
+                               get_normals, work.mesh->name);
+  });
+}
+
+/*!
+ * Add a draw of a primitive to the draw for its material.
+ */
+void add_prim_draw(tfrag3::StripDraw& draw, const std::vector<u32>& prim_indices) {
+  draw.num_triangles += prim_indices.size() / 3;
+  if (draw.vis_groups.empty()) {
+    auto& grp = draw.vis_groups.emplace_back();
+    grp.num_inds += prim_indices.size();
+    grp.num_tris += draw.num_triangles;
+    grp.vis_idx_in_pc_bvh = UINT16_MAX;
+  } else {
+    auto& grp = draw.vis_groups.back();
+    grp.num_inds += prim_indices.size();
+    grp.num_tris += draw.num_triangles;
+    grp.vis_idx_in_pc_bvh = UINT16_MAX;
+  }
+
+  draw.plain_indices.insert(draw.plain_indices.end(), prim_indices.begin(), prim_indices.end());
+}
+
+void extract(const Input& in,
+             TfragOutput& out,
+             const tinygltf::Model& model,
+             const std::vector<NodeWithTransform>& all_nodes) {
+  std::vector<math::Vector<u8, 4>> all_vtx_colors;
+  ASSERT(out.tfrag_vertices.empty());
+
+  struct MaterialInfo {
+    tfrag3::StripDraw draw;
+    bool needs_tie = false;
+  };
+  std::map<int, MaterialInfo> info_by_material;
+  int mesh_count = 0;
+  auto prims = find_visible_prims(model, all_nodes, false, &mesh_count);
+  int prim_count = prims.size();
+  read_prims(model, prims, true, false);
+
+  for (auto& work : prims) {
+    auto& verts = work.verts;
+    for (auto& idx : work.indices) {
+      idx += out.tfrag_vertices.size();
+    }
+    out.tfrag_vertices.insert(out.tfrag_vertices.end(), verts.vtx.begin(), verts.vtx.end());
+    all_vtx_colors.insert(all_vtx_colors.end(), verts.vtx_colors.begin(), verts.vtx_colors.end());
+    ASSERT(all_vtx_colors.size() == out.tfrag_vertices.size());
+
+    auto& info = info_by_material[work.prim->material];
+    info.draw.mode = make_default_draw_mode();                        // todo rm
+    info.draw.tree_tex_id = texture_pool_debug_checker(in.tex_pool);  // todo rm
+    add_prim_draw(info.draw, work.indices);
+    work = {};
+  }
 
   for (const auto& [mat_idx, d_] : info_by_material) {
     // out.strip_draws.push_back(d_);
@@ -202,7 +457,7 @@ void extract(const Input& in,
            out.tfrag_vertices.size());
 
   Timer quantize_timer;
-  auto quantized = quantize_colors_kd_tree(all_vtx_colors, kColorTreeDepth);
+  auto quantized = quantize_colors_kmeans(all_vtx_colors, kMaxPaletteColors);
   for (size_t i = 0; i < out.tfrag_vertices.size(); i++) {
     out.tfrag_vertices[i].color_index = quantized.vtx_to_color[i];
   }
@@ -210,6 +465,7 @@ void extract(const Input& in,
   lg::info("Color palette generation took {:.2f} ms", quantize_timer.getMs());
 
   dedup_tfrag_vertices(out);
+  optimize_tfrag_draws(out);
 }
 
 s8 normal_to_s8(float in) {
@@ -256,56 +512,24 @@ void extract(const Input& in,
   };
   std::map<int, MaterialInfo> info_by_material;
   int mesh_count = 0;
-  int prim_count = 0;
-
-  for (const auto& n : all_nodes) {
-    const auto& node = model.nodes[n.node_idx];
-    if (node.extras.Has("set_invisible") && node.extras.Get("set_invisible").Get<int>()) {
-      continue;
-    }
-    if (node.mesh >= 0) {
-      const auto& mesh = model.meshes[node.mesh];
-      mesh_count++;
-      for (const auto& prim : mesh.primitives) {
-        if (prim.material >= 0 && model.materials[prim.material].extras.Has("set_invisible") &&
-            model.materials[prim.material].extras.Get("set_invisible").Get<int>()) {
-          continue;
-        }
-
-        if (!prim_needs_tie(model, prim)) {
-          continue;
-        }
-        prim_count++;
-        // extract index buffer
-        std::vector<u32> prim_indices = gltf_index_buffer(model, prim.indices, out.vertices.size());
-        ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
-        // extract vertices
-        auto verts = gltf_vertices(model, prim.attributes, n.w_T_node, true, true, mesh.name);
-        add_to_packed_verts(&out.vertices, verts.vtx, verts.normals);
-        all_vtx_colors.insert(all_vtx_colors.end(), verts.vtx_colors.begin(),
-                              verts.vtx_colors.end());
-        ASSERT(all_vtx_colors.size() == out.vertices.size());
-
-        auto& info = info_by_material[prim.material];
-        info.draw.mode = make_default_draw_mode();                        // todo rm
-        info.draw.tree_tex_id = texture_pool_debug_checker(in.tex_pool);  // todo rm
-        info.draw.num_triangles += prim_indices.size() / 3;
-        if (info.draw.vis_groups.empty()) {
-          auto& grp = info.draw.vis_groups.emplace_back();
-          grp.num_inds += prim_indices.size();
-          grp.num_tris += info.draw.num_triangles;
-          grp.vis_idx_in_pc_bvh = UINT16_MAX;
-        } else {
-          auto& grp = info.draw.vis_groups.back();
-          grp.num_inds += prim_indices.size();
-          grp.num_tris += info.draw.num_triangles;
-          grp.vis_idx_in_pc_bvh = UINT16_MAX;
-        }
-
-        info.draw.plain_indices.insert(info.draw.plain_indices.end(), prim_indices.begin(),
-                                       prim_indices.end());
-      }
+  auto prims = find_visible_prims(model, all_nodes, true, &mesh_count);
+  int prim_count = prims.size();
+  read_prims(model, prims, true, true);
+
+  for (auto& work : prims) {
+    auto& verts = work.verts;
+    for (auto& idx : work.indices) {
+      idx += out.vertices.size();
     }
+    add_to_packed_verts(&out.vertices, verts.vtx, verts.normals);
+    all_vtx_colors.insert(all_vtx_colors.end(), verts.vtx_colors.begin(), verts.vtx_colors.end());
+    ASSERT(all_vtx_colors.size() == out.vertices.size());
+
+    auto& info = info_by_material[work.prim->material];
+    info.draw.mode = make_default_draw_mode();                        // todo rm
+    info.draw.tree_tex_id = texture_pool_debug_checker(in.tex_pool);  // todo rm
+    add_prim_draw(info.draw, work.indices);
+    work = {};
   }
 
   for (const auto& [mat_idx, d_] : info_by_material) {
@@ -366,7 +590,7 @@ void extract(const Input& in,
            out.vertices.size());
 
   Timer quantize_timer;
-  auto quantized = quantize_colors_kd_tree(all_vtx_colors, kColorTreeDepth);
+  auto quantized = quantize_colors_kmeans(all_vtx_colors, kMaxPaletteColors);
   for (size_t i = 0; i < out.vertices.size(); i++) {
     out.color_indices.push_back(quantized.vtx_to_color[i]);
   }
@@ -374,6 +598,7 @@ void extract(const Input& in,
   lg::info("Color palette generation took {:.2f} ms", quantize_timer.getMs());
 
   dedup_tie_vertices(out);
+  optimize_tie_draws(out);
 }
 
 std::optional<std::vector<jak1::CollideFace>> subdivide_face_if_needed(jak1::CollideFace face_in) {
@@ -490,7 +715,8 @@ void extract(const Input& in,
              const std::vector<NodeWithTransform>& all_nodes) {
   [[maybe_unused]] int mesh_count = 0;
   [[maybe_unused]] int prim_count = 0;
-  int suspicious_faces = 0;
+  std::vector<PrimWork> prims;
+  std::vector<PatResult> prim_pats;
 
   for (const auto& n : all_nodes) {
     const auto& node = model.nodes[n.node_idx];
@@ -514,67 +740,90 @@ void extract(const Input& in,
           continue;  // skip, no collide here
         }
         prim_count++;
-        // extract index buffer
-        std::vector<u32> prim_indices = gltf_index_buffer(model, prim.indices, 0);
-        ASSERT_MSG(prim.mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
-        // extract vertices
-        auto verts = gltf_vertices(model, prim.attributes, n.w_T_node, false, true, mesh.name);
-
-        for (size_t iidx = 0; iidx < prim_indices.size(); iidx += 3) {
-          jak1::CollideFace face;
-
-          // get the positions
-          for (int j = 0; j < 3; j++) {
-            auto& vtx = verts.vtx.at(prim_indices.at(iidx + j));
-            face.v[j].x() = vtx.x;
-            face.v[j].y() = vtx.y;
-            face.v[j].z() = vtx.z;
-          }
+        auto& work = prims.emplace_back();
+        work.node = &n;
+        work.mesh = &mesh;
+        work.prim = &prim;
+        prim_pats.push_back(pat);
+      }
+    }
+  }
 
-          // now face normal
-          math::Vector3f face_normal =
-              (face.v[2] - face.v[0]).cross(face.v[1] - face.v[0]).normalized();
+  // faces of each primitive, after subdividing big ones
+  struct PrimFaces {
+    std::vector<jak1::CollideFace> faces;
+    int suspicious_faces = 0;
+    int fix_count = 0;
+  };
+  std::vector<PrimFaces> prim_faces(prims.size());
+
+  ThreadPool::global().parallel_for(prims.size(), [&](int prim_idx) {
+    auto& work = prims[prim_idx];
+    auto& result = prim_faces[prim_idx];
+    // extract index buffer
+    std::vector<u32> prim_indices = gltf_index_buffer(model, work.prim->indices, 0);
+    ASSERT_MSG(work.prim->mode == TINYGLTF_MODE_TRIANGLES, "Unsupported triangle mode");
+    // extract vertices
+    auto verts = gltf_vertices(model, work.prim->attributes, work.node->w_T_node, false, true,
+                               work.mesh->name);
+
+    for (size_t iidx = 0; iidx < prim_indices.size(); iidx += 3) {
+      jak1::CollideFace face;
+
+      // get the positions
+      for (int j = 0; j < 3; j++) {
+        auto& vtx = verts.vtx.at(prim_indices.at(iidx + j));
+        face.v[j].x() = vtx.x;
+        face.v[j].y() = vtx.y;
+        face.v[j].z() = vtx.z;
+      }
 
-          float dots[3];
-          for (int j = 0; j < 3; j++) {
-            dots[j] = face_normal.dot(verts.normals.at(prim_indices.at(iidx + j)).normalized());
-          }
+      // now face normal
+      math::Vector3f face_normal =
+          (face.v[2] - face.v[0]).cross(face.v[1] - face.v[0]).normalized();
 
-          if (dots[0] > 1e-3 && dots[1] > 1e-3 && dots[2] > 1e-3) {
-            suspicious_faces++;
-            auto temp = face.v[2];
-            face.v[2] = face.v[1];
-            face.v[1] = temp;
-          }
+      float dots[3];
+      for (int j = 0; j < 3; j++) {
+        dots[j] = face_normal.dot(verts.normals.at(prim_indices.at(iidx + j)).normalized());
+      }
 
-          face.bsphere = math::bsphere_of_triangle(face.v);
-          face.bsphere.w() += 1e-1 * 5;
-          for (int j = 0; j < 3; j++) {
-            float output_dist = face.bsphere.w() - (face.bsphere.xyz() - face.v[j]).length();
-            if (output_dist < 0) {
-              lg::print("{}\n", output_dist);
-              lg::print("BAD:\n{}\n{}\n{}\n", face.v[0].to_string_aligned(),
-                        face.v[1].to_string_aligned(), face.v[2].to_string_aligned());
-              lg::print("bsphere: {}\n", face.bsphere.to_string_aligned());
-            }
-          }
-          face.pat = pat.pat;
-          out.faces.push_back(face);
+      if (dots[0] > 1e-3 && dots[1] > 1e-3 && dots[2] > 1e-3) {
+        result.suspicious_faces++;
+        auto temp = face.v[2];
+        face.v[2] = face.v[1];
+        face.v[1] = temp;
+      }
+
+      face.bsphere = math::bsphere_of_triangle(face.v);
+      face.bsphere.w() += 1e-1 * 5;
+      for (int j = 0; j < 3; j++) {
+        float output_dist = face.bsphere.w() - (face.bsphere.xyz() - face.v[j]).length();
+        if (output_dist < 0) {
+          lg::print("{}\n", output_dist);
+          lg::print("BAD:\n{}\n{}\n{}\n", face.v[0].to_string_aligned(),
+                    face.v[1].to_string_aligned(), face.v[2].to_string_aligned());
+          lg::print("bsphere: {}\n", face.bsphere.to_string_aligned());
         }
       }
+      face.pat = prim_pats[prim_idx].pat;
+
+      auto try_fix = subdivide_face_if_needed(face);
+      if (try_fix) {
+        result.fix_count++;
+        result.faces.insert(result.faces.end(), try_fix->begin(), try_fix->end());
+      } else {
+        result.faces.push_back(face);
+      }
     }
-  }
+  });
 
   std::vector<jak1::CollideFace> fixed_faces;
+  int suspicious_faces = 0;
   int fix_count = 0;
-  for (auto& face : out.faces) {
-    auto try_fix = subdivide_face_if_needed(face);
-    if (try_fix) {
-      fix_count++;
-      fixed_faces.insert(fixed_faces.end(), try_fix->begin(), try_fix->end());
-    } else {
-      fixed_faces.push_back(face);
-    }
+  for (auto& result : prim_faces) {
+    fixed_faces.insert(fixed_faces.end(), result.faces.begin(), result.faces.end());
+    suspicious_faces += result.suspicious_faces;
+    fix_count += result.fix_count;
   }
 
   if (in.double_sided_collide) {
@@ -615,7 +864,10 @@ void extract(const Input& in, Output& out) {
   tinygltf::TinyGLTF loader;
   tinygltf::Model model;
   std::string err, warn;
-  bool res = loader.LoadBinaryFromFile(&model, &err, &warn, in.filename);
+  // tinygltf would read the whole file into a vector first.
+  MappedFile file(in.filename, MappedFile::Access::SEQUENTIAL);
+  bool res = loader.LoadBinaryFromMemory(&model, &err, &warn, file.data(), file.size(),
+                                         fs::path(in.filename).parent_path().string());
   ASSERT_MSG(warn.empty(), warn.c_str());
   ASSERT_MSG(err.empty(), err.c_str());
   ASSERT_MSG(res, "Failed to load GLTF file!");
@@ -623,6 +875,41 @@ void extract(const Input& in, Output& out) {
   extract(in, out.tfrag, model, all_nodes);
   extract(in, out.collide, model, all_nodes);
   extract(in, out.tie, model, all_nodes);
+  if (in.generate_lods) {
+    out.tfrag_lods = make_tfrag_lods(out.tfrag);
+    if (!out.tie.base_draws.empty()) {
+      out.tie_lods = make_tie_lods(out.tie);
+    }
+  }
   lg::info("GLTF total took {:.2f} ms", read_timer.getMs());
 }
+
+void TfragOutput::serialize(Serializer& ser) {
+  ser.from_vector(&normal_strip_draws, [&](tfrag3::StripDraw* draw) { draw->serialize(ser); });
+  ser.from_vector(&trans_strip_draws, [&](tfrag3::StripDraw* draw) { draw->serialize(ser); });
+  ser.from_pod_vector(&tfrag_vertices);
+  ser.from_pod_vector(&color_palette);
+  bvh.serialize(ser);
+}
+
+void CollideOutput::serialize(Serializer& ser) {
+  ser.from_pod_vector(&faces);
+}
+
+void TieOutput::serialize(Serializer& ser) {
+  ser.from_vector(&base_draws, [&](tfrag3::StripDraw* draw) { draw->serialize(ser); });
+  ser.from_vector(&envmap_draws, [&](tfrag3::StripDraw* draw) { draw->serialize(ser); });
+  ser.from_pod_vector(&vertices);
+  ser.from_pod_vector(&color_indices);
+  ser.from_pod_vector(&color_palette);
+  bvh.serialize(ser);
+}
+
+void Output::serialize(Serializer& ser) {
+  tfrag.serialize(ser);
+  collide.serialize(ser);
+  tie.serialize(ser);
+  ser.from_vector(&tfrag_lods, [&](TfragOutput* lod) { lod->serialize(ser); });
+  ser.from_vector(&tie_lods, [&](TieOutput* lod) { lod->serialize(ser); });
+}
 }  // namespace gltf_mesh_extract
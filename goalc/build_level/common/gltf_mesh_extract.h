@@ -20,6 +20,7 @@ struct Input {
   bool auto_wall_enable = true;
   float auto_wall_angle = 30.f;
   bool double_sided_collide = false;
+  bool generate_lods = true;
 };
 
 struct TfragOutput {
@@ -27,10 +28,13 @@ struct TfragOutput {
   std::vector<tfrag3::StripDraw> trans_strip_draws;
   std::vector<tfrag3::PreloadedVertex> tfrag_vertices;
   std::vector<math::Vector<u8, 4>> color_palette;
+  tfrag3::BVH bvh;  // culling clusters, shared by the normal and trans draws
+  void serialize(Serializer& ser);
 };
 
 struct CollideOutput {
   std::vector<jak1::CollideFace> faces;
+  void serialize(Serializer& ser);
 };
 
 struct TieOutput {
@@ -39,12 +43,19 @@ struct TieOutput {
   std::vector<tfrag3::PackedTieVertices::Vertex> vertices;
   std::vector<u16> color_indices;
   std::vector<math::Vector<u8, 4>> color_palette;
+  tfrag3::BVH bvh;
+  void serialize(Serializer& ser);
 };
 
 struct Output {
   TfragOutput tfrag;
   CollideOutput collide;
   TieOutput tie;
+  // simplified versions of tfrag and tie, for the lower levels of detail (geometry 1 and up).
+  std::vector<TfragOutput> tfrag_lods;
+  std::vector<TieOutput> tie_lods;
+  // for the build_level cache, see StageCache.h
+  void serialize(Serializer& ser);
 };
 
 struct PatResult {
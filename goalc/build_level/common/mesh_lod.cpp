@@ -0,0 +1,430 @@
+#include "mesh_lod.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+
+#include "common/util/Assert.h"
+
+namespace mesh_lod {
+
+namespace {
+
+/*!
+ * A symmetric 4x4 matrix Q, where v^T Q v is the sum of squared distances from v to a set of
+ * planes.
+ */
+struct Quadric {
+  double a2 = 0, ab = 0, ac = 0, ad = 0, b2 = 0, bc = 0, bd = 0, c2 = 0, cd = 0, d2 = 0;
+
+  // add the plane ax + by + cz + d = 0, where (a, b, c) is normalized.
+  void add_plane(double a, double b, double c, double d) {
+    a2 += a * a;
+    ab += a * b;
+    ac += a * c;
+    ad += a * d;
+    b2 += b * b;
+    bc += b * c;
+    bd += b * d;
+    c2 += c * c;
+    cd += c * d;
+    d2 += d * d;
+  }
+
+  void operator+=(const Quadric& o) {
+    a2 += o.a2;
+    ab += o.ab;
+    ac += o.ac;
+    ad += o.ad;
+    b2 += o.b2;
+    bc += o.bc;
+    bd += o.bd;
+    c2 += o.c2;
+    cd += o.cd;
+    d2 += o.d2;
+  }
+
+  double error(const math::Vector3f& p) const {
+    const double x = p.x(), y = p.y(), z = p.z();
+    return a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x + b2 * y * y +
+           2 * bc * y * z + 2 * bd * y + c2 * z * z + 2 * cd * z + d2;
+  }
+};
+
+// the smallest cosine of the angle a triangle's normal can turn by in one collapse.
+constexpr float kMinNormalDot = 0.25f;
+
+u64 edge_key(u32 a, u32 b) {
+  if (a > b) {
+    std::swap(a, b);
+  }
+  return ((u64)a << 32) | b;
+}
+
+/*!
+ * Moving vertex "from" onto vertex "to".
+ */
+struct Collapse {
+  double cost;
+  u32 from, to;
+  bool operator>(const Collapse& other) const { return cost > other.cost; }
+};
+
+math::Vector3f tri_normal(const math::Vector3f& a,
+                          const math::Vector3f& b,
+                          const math::Vector3f& c) {
+  return (b - a).cross(c - a);
+}
+}  // namespace
+
+std::vector<u32> simplify(const std::vector<math::Vector3f>& positions,
+                          const std::vector<u32>& indices,
+                          u32 target_tri_count,
+                          float max_error) {
+  ASSERT(indices.size() % 3 == 0);
+  const u32 tri_count = indices.size() / 3;
+  if (tri_count <= target_tri_count) {
+    return indices;
+  }
+
+  const u32 vertex_count = positions.size();
+  std::vector<u32> tris = indices;
+  std::vector<Quadric> quadrics(vertex_count);
+  std::vector<std::vector<u32>> vtx_tris(vertex_count);
+  std::unordered_map<u64, int> edge_counts;
+
+  for (u32 t = 0; t < tri_count; t++) {
+    const u32* v = &tris[t * 3];
+    for (int i = 0; i < 3; i++) {
+      ASSERT(v[i] < vertex_count);
+      vtx_tris[v[i]].push_back(t);
+      edge_counts[edge_key(v[i], v[(i + 1) % 3])]++;
+    }
+
+    const math::Vector3f normal = tri_normal(positions[v[0]], positions[v[1]], positions[v[2]]);
+    const float length = normal.length();
+    if (length > 0) {
+      const math::Vector3f n = normal / length;
+      for (int i = 0; i < 3; i++) {
+        quadrics[v[i]].add_plane(n.x(), n.y(), n.z(), -n.dot(positions[v[0]]));
+      }
+    }
+  }
+
+  // an edge that isn't shared by exactly two triangles is on a border (or a seam), keep it.
+  std::vector<bool> locked(vertex_count, false);
+  for (const auto& [key, count] : edge_counts) {
+    if (count != 2) {
+      locked[key >> 32] = true;
+      locked[key & UINT32_MAX] = true;
+    }
+  }
+
+  std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> queue;
+  auto collapse_cost = [&](u32 from, u32 to) {
+    Quadric q = quadrics[from];
+    q += quadrics[to];
+    return q.error(positions[to]);
+  };
+  auto add_candidate = [&](u32 from, u32 to) {
+    if (!locked[from] && from != to) {
+      queue.push({collapse_cost(from, to), from, to});
+    }
+  };
+  for (const auto& [key, count] : edge_counts) {
+    add_candidate(key >> 32, key & UINT32_MAX);
+    add_candidate(key & UINT32_MAX, key >> 32);
+  }
+
+  const double max_cost = (double)max_error * max_error;
+  std::vector<bool> tri_alive(tri_count, true);
+  std::vector<bool> removed(vertex_count, false);
+  std::vector<u32> from_neighbors, to_neighbors;
+  u32 alive_count = tri_count;
+
+  while (alive_count > target_tri_count && !queue.empty()) {
+    const auto candidate = queue.top();
+    queue.pop();
+    if (candidate.cost > max_cost) {
+      break;
+    }
+    const u32 from = candidate.from;
+    const u32 to = candidate.to;
+    if (removed[from] || removed[to]) {
+      continue;
+    }
+
+    // the cost goes up when something is collapsed onto either end, try again later if so.
+    const double cost = collapse_cost(from, to);
+    if (cost > candidate.cost) {
+      queue.push({cost, from, to});
+      continue;
+    }
+
+    // check that the edge still exists, and that moving the vertex doesn't flip any triangles.
+    int shared_tris = 0;
+    bool flips = false;
+    from_neighbors.clear();
+    for (auto t : vtx_tris[from]) {
+      if (!tri_alive[t]) {
+        continue;
+      }
+      const u32* v = &tris[t * 3];
+      for (int i = 0; i < 3; i++) {
+        if (v[i] != from) {
+          from_neighbors.push_back(v[i]);
+        }
+      }
+      if (v[0] == to || v[1] == to || v[2] == to) {
+        shared_tris++;
+        continue;
+      }
+      math::Vector3f p[3];
+      for (int i = 0; i < 3; i++) {
+        p[i] = positions[v[i] == from ? to : v[i]];
+      }
+      // also reject big turns, which can add up to a flip over several collapses.
+      const auto old_normal = tri_normal(positions[v[0]], positions[v[1]], positions[v[2]]);
+      const auto new_normal = tri_normal(p[0], p[1], p[2]);
+      if (new_normal.dot(old_normal) <= kMinNormalDot * new_normal.length() * old_normal.length()) {
+        flips = true;
+        break;
+      }
+    }
+    if (!shared_tris || flips) {
+      continue;
+    }
+
+    // the vertices next to both ends must be the ones across the removed triangles, otherwise the
+    // collapse would fold the mesh onto itself.
+    to_neighbors.clear();
+    for (auto t : vtx_tris[to]) {
+      if (tri_alive[t]) {
+        const u32* v = &tris[t * 3];
+        for (int i = 0; i < 3; i++) {
+          if (v[i] != to) {
+            to_neighbors.push_back(v[i]);
+          }
+        }
+      }
+    }
+    std::sort(from_neighbors.begin(), from_neighbors.end());
+    from_neighbors.erase(std::unique(from_neighbors.begin(), from_neighbors.end()),
+                         from_neighbors.end());
+    std::sort(to_neighbors.begin(), to_neighbors.end());
+    to_neighbors.erase(std::unique(to_neighbors.begin(), to_neighbors.end()), to_neighbors.end());
+    int common_neighbors = 0;
+    for (auto n : from_neighbors) {
+      if (n != to && std::binary_search(to_neighbors.begin(), to_neighbors.end(), n)) {
+        common_neighbors++;
+      }
+    }
+    if (common_neighbors != shared_tris) {
+      continue;
+    }
+
+    // do the collapse
+    for (auto t : vtx_tris[from]) {
+      if (!tri_alive[t]) {
+        continue;
+      }
+      u32* v = &tris[t * 3];
+      if (v[0] == to || v[1] == to || v[2] == to) {
+        tri_alive[t] = false;
+        alive_count--;
+      } else {
+        for (int i = 0; i < 3; i++) {
+          if (v[i] == from) {
+            v[i] = to;
+          }
+        }
+        vtx_tris[to].push_back(t);
+      }
+    }
+    vtx_tris[from].clear();
+    removed[from] = true;
+    quadrics[to] += quadrics[from];
+
+    // the edges around the merged vertex have new costs.
+    auto& to_tris = vtx_tris[to];
+    to_tris.erase(
+        std::remove_if(to_tris.begin(), to_tris.end(), [&](u32 t) { return !tri_alive[t]; }),
+        to_tris.end());
+    for (auto t : to_tris) {
+      const u32* v = &tris[t * 3];
+      for (int i = 0; i < 3; i++) {
+        add_candidate(v[i], to);
+        add_candidate(to, v[i]);
+      }
+    }
+  }
+
+  std::vector<u32> result;
+  result.reserve(alive_count * 3);
+  for (u32 t = 0; t < tri_count; t++) {
+    if (tri_alive[t]) {
+      result.insert(result.end(), tris.begin() + t * 3, tris.begin() + t * 3 + 3);
+    }
+  }
+  return result;
+}
+
+namespace {
+struct BuildNode {
+  std::vector<u32> children;  // empty for clusters
+  u32 begin = 0, end = 0;     // range of triangles, for clusters
+  math::Vector4f bsphere;
+};
+
+math::Vector4f bsphere_of_spheres(const std::vector<math::Vector4f>& spheres) {
+  auto radius_vec = [](const math::Vector4f& s) { return math::Vector3f(s.w(), s.w(), s.w()); };
+  math::Vector3f min = spheres.at(0).xyz() - radius_vec(spheres[0]);
+  math::Vector3f max = spheres[0].xyz() + radius_vec(spheres[0]);
+  for (const auto& s : spheres) {
+    min.min_in_place(s.xyz() - radius_vec(s));
+    max.max_in_place(s.xyz() + radius_vec(s));
+  }
+  const math::Vector3f center = (min + max) * 0.5f;
+  float radius = 0;
+  for (const auto& s : spheres) {
+    radius = std::max(radius, (s.xyz() - center).length() + s.w());
+  }
+  return math::Vector4f(center.x(), center.y(), center.z(), radius);
+}
+}  // namespace
+
+Clusters build_clusters(const std::vector<math::Vector3f>& positions,
+                        const std::vector<u32>& indices,
+                        u32 max_cluster_tris) {
+  ASSERT(indices.size() % 3 == 0);
+  ASSERT(max_cluster_tris > 0);
+  Clusters result;
+  const u32 tri_count = indices.size() / 3;
+  if (tri_count == 0) {
+    return result;
+  }
+
+  std::vector<math::Vector3f> centers;
+  centers.reserve(tri_count);
+  for (u32 t = 0; t < tri_count; t++) {
+    centers.push_back((positions.at(indices[t * 3]) + positions.at(indices[t * 3 + 1]) +
+                       positions.at(indices[t * 3 + 2])) /
+                      3.f);
+  }
+  std::vector<u32> order(tri_count);
+  for (u32 t = 0; t < tri_count; t++) {
+    order[t] = t;
+  }
+
+  // split top-down: each node gets up to 8 children by splitting its triangles at the median of
+  // the longest axis three times.
+  std::vector<BuildNode> nodes;
+  std::function<u32(u32, u32)> build = [&](u32 begin, u32 end) -> u32 {
+    const u32 idx = nodes.size();
+    nodes.emplace_back();
+    if (end - begin <= max_cluster_tris) {
+      nodes[idx].begin = begin;
+      nodes[idx].end = end;
+      math::Vector3f min = positions[indices[order[begin] * 3]];
+      math::Vector3f max = min;
+      for (u32 i = begin; i < end; i++) {
+        for (int j = 0; j < 3; j++) {
+          min.min_in_place(positions[indices[order[i] * 3 + j]]);
+          max.max_in_place(positions[indices[order[i] * 3 + j]]);
+        }
+      }
+      const math::Vector3f center = (min + max) * 0.5f;
+      float radius = 0;
+      for (u32 i = begin; i < end; i++) {
+        for (int j = 0; j < 3; j++) {
+          radius = std::max(radius, (positions[indices[order[i] * 3 + j]] - center).length());
+        }
+      }
+      nodes[idx].bsphere = math::Vector4f(center.x(), center.y(), center.z(), radius);
+      return idx;
+    }
+
+    std::vector<std::pair<u32, u32>> ranges = {{begin, end}};
+    for (int level = 0; level < 3; level++) {
+      std::vector<std::pair<u32, u32>> next;
+      for (auto [b, e] : ranges) {
+        if (e - b <= max_cluster_tris) {
+          next.push_back({b, e});
+          continue;
+        }
+        math::Vector3f min = centers[order[b]];
+        math::Vector3f max = min;
+        for (u32 i = b; i < e; i++) {
+          min.min_in_place(centers[order[i]]);
+          max.max_in_place(centers[order[i]]);
+        }
+        const math::Vector3f size = max - min;
+        const int axis = size.x() > size.y() ? (size.x() > size.z() ? 0 : 2)
+                                             : (size.y() > size.z() ? 1 : 2);
+        const u32 mid = b + (e - b) / 2;
+        std::nth_element(order.begin() + b, order.begin() + mid, order.begin() + e,
+                         [&](u32 x, u32 y) { return centers[x][axis] < centers[y][axis]; });
+        next.push_back({b, mid});
+        next.push_back({mid, e});
+      }
+      ranges = std::move(next);
+    }
+
+    std::vector<math::Vector4f> child_spheres;
+    for (auto [b, e] : ranges) {
+      const u32 child = build(b, e);
+      nodes[idx].children.push_back(child);
+      child_spheres.push_back(nodes[child].bsphere);
+    }
+    nodes[idx].bsphere = bsphere_of_spheres(child_spheres);
+    return idx;
+  };
+  const u32 root = build(0, tri_count);
+
+  // lay the nodes out breadth-first, so the children of each node are next to each other.
+  std::vector<u32> layout = {root};
+  for (size_t i = 0; i < layout.size(); i++) {
+    for (auto child : nodes[layout[i]].children) {
+      layout.push_back(child);
+    }
+  }
+  ASSERT(layout.size() < UINT16_MAX / 2);
+
+  std::vector<u32> node_to_vis(nodes.size());
+  for (size_t i = 0; i < layout.size(); i++) {
+    node_to_vis[layout[i]] = i;
+  }
+
+  auto& bvh = result.bvh;
+  bvh.first_root = 0;
+  bvh.num_roots = 1;
+  bvh.only_children = false;
+  bvh.first_leaf_node = layout.size();
+  bvh.vis_nodes.resize(layout.size());
+  result.tri_to_vis_node.resize(tri_count);
+  u16 next_leaf = bvh.first_leaf_node;
+  for (size_t i = 0; i < layout.size(); i++) {
+    const auto& node = nodes[layout[i]];
+    auto& vis = bvh.vis_nodes[i];
+    vis.bsphere = node.bsphere;
+    vis.my_id = i;
+    if (node.children.empty()) {
+      // a cluster, with a single leaf as its child.
+      vis.flags = 0;
+      vis.num_kids = 1;
+      vis.child_id = next_leaf++;
+      for (u32 t = node.begin; t < node.end; t++) {
+        result.tri_to_vis_node[order[t]] = i;
+      }
+    } else {
+      vis.flags = 1;
+      vis.num_kids = node.children.size();
+      vis.child_id = node_to_vis[node.children.front()];
+    }
+  }
+  bvh.last_leaf_node = next_leaf - 1;
+  return result;
+}
+
+}  // namespace mesh_lod
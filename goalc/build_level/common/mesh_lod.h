@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/custom_data/Tfrag3Data.h"
+#include "common/math/Vector.h"
+
+/*!
+ * Tools for making the lower detail levels and culling clusters of custom level meshes.
+ * Meshes are indexed triangle lists, with positions in game units.
+ */
+namespace mesh_lod {
+
+/*!
+ * Simplify a mesh with quadric error metric edge collapses (Garland & Heckbert), until there are at
+ * most target_tri_count triangles, or the next collapse would move the surface by more than
+ * max_error. Vertices only move onto other vertices, so no new vertices are made and texture
+ * coordinates and colors stay valid. Vertices on the border of the mesh (including seams where
+ * vertices are split) are never removed, so neighboring meshes still line up.
+ * Returns the new index list, triangles in the same order and winding as the input.
+ */
+std::vector<u32> simplify(const std::vector<math::Vector3f>& positions,
+                          const std::vector<u32>& indices,
+                          u32 target_tri_count,
+                          float max_error);
+
+/*!
+ * Triangles grouped into spatially coherent clusters, with a BVH over the clusters that the
+ * renderer can use to cull them.
+ */
+struct Clusters {
+  // in the same layout as extracted levels: roots first, and the children of a node consecutive.
+  // Each cluster is a node with leaf children, which vis groups refer to.
+  tfrag3::BVH bvh;
+  // for each input triangle, the vis node of its cluster.
+  std::vector<u16> tri_to_vis_node;
+};
+
+Clusters build_clusters(const std::vector<math::Vector3f>& positions,
+                        const std::vector<u32>& indices,
+                        u32 max_cluster_tris);
+
+}  // namespace mesh_lod
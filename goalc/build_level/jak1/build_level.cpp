@@ -32,9 +32,11 @@ bool run_build_level(const std::string& input_file,
   mesh_extract_in.auto_wall_enable = level_json.value("automatic_wall_detection", true);
   mesh_extract_in.double_sided_collide = level_json.at("double_sided_collide").get<bool>();
   mesh_extract_in.auto_wall_angle = level_json.value("automatic_wall_angle", 30.0);
+  mesh_extract_in.generate_lods = level_json.value("generate_lods", true);
   mesh_extract_in.tex_pool = &tex_pool;
   gltf_mesh_extract::Output mesh_extract_out;
-  gltf_mesh_extract::extract(mesh_extract_in, mesh_extract_out);
+  StageCache cache(build_cache_dir(output_prefix, level_json.at("nickname").get<std::string>()));
+  extract_mesh_cached(cache, mesh_extract_in, mesh_extract_out);
 
   // add stuff to the GOAL level structure
   file.info = make_file_info_for_level(fs::path(input_file).filename().string());
@@ -89,11 +91,17 @@ bool run_build_level(const std::string& input_file,
                                           "drawable-inline-array-trans-tfrag");
 
   tfrag_from_gltf(mesh_extract_out.tfrag, pc_level.tfrag_trees[0]);
+  for (size_t i = 0; i < mesh_extract_out.tfrag_lods.size(); i++) {
+    tfrag_from_gltf(mesh_extract_out.tfrag_lods[i], pc_level.tfrag_trees[i + 1]);
+  }
 
   // TIE
   if (!mesh_extract_out.tie.base_draws.empty()) {
     file.drawable_trees.ties.emplace_back();
     tie_from_gltf(mesh_extract_out.tie, pc_level.tie_trees[0]);
+    for (size_t i = 0; i < mesh_extract_out.tie_lods.size(); i++) {
+      tie_from_gltf(mesh_extract_out.tie_lods[i], pc_level.tie_trees[i + 1]);
+    }
   }
 
   // TEXTURE
@@ -104,8 +112,18 @@ bool run_build_level(const std::string& input_file,
     lg::error("No collision geometry was found");
   } else {
     auto& collide_drawable_tree = file.drawable_trees.collides.emplace_back();
-    collide_drawable_tree.bvh = collide::construct_collide_bvh(mesh_extract_out.collide.faces);
-    collide_drawable_tree.packed_frags = pack_collide_frags(collide_drawable_tree.bvh.frags.frags);
+    StageKey collide_key;
+    collide_key.add_pod_vector(mesh_extract_out.collide.faces);
+    auto serialize_collide = [&](Serializer& ser) {
+      collide_drawable_tree.bvh.serialize(ser);
+      collide_drawable_tree.packed_frags.serialize(ser);
+    };
+    if (!cache.load("collide", collide_key, serialize_collide)) {
+      collide_drawable_tree.bvh = collide::construct_collide_bvh(mesh_extract_out.collide.faces);
+      collide_drawable_tree.packed_frags =
+          pack_collide_frags(collide_drawable_tree.bvh.frags.frags);
+      cache.save("collide", collide_key, serialize_collide);
+    }
     // for collision renderer
     for (auto& face : mesh_extract_out.collide.faces) {
       math::Vector4f verts[3];
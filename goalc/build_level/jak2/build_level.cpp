@@ -28,9 +28,11 @@ bool run_build_level(const std::string& input_file,
   mesh_extract_in.auto_wall_enable = level_json.value("automatic_wall_detection", true);
   mesh_extract_in.double_sided_collide = level_json.at("double_sided_collide").get<bool>();
   mesh_extract_in.auto_wall_angle = level_json.value("automatic_wall_angle", 30.0);
+  mesh_extract_in.generate_lods = level_json.value("generate_lods", true);
   mesh_extract_in.tex_pool = &tex_pool;
   gltf_mesh_extract::Output mesh_extract_out;
-  gltf_mesh_extract::extract(mesh_extract_in, mesh_extract_out);
+  StageCache cache(build_cache_dir(output_prefix, level_json.at("nickname").get<std::string>()));
+  extract_mesh_cached(cache, mesh_extract_in, mesh_extract_out);
 
   // add stuff to the GOAL level structure
   file.info = make_file_info_for_level(fs::path(input_file).filename().string());
@@ -72,11 +74,17 @@ bool run_build_level(const std::string& input_file,
   // TFRAG
   file.drawable_trees.tfrags.emplace_back("drawable-tree-tfrag", "drawable-inline-array-tfrag");
   tfrag_from_gltf(mesh_extract_out.tfrag, pc_level.tfrag_trees[0]);
+  for (size_t i = 0; i < mesh_extract_out.tfrag_lods.size(); i++) {
+    tfrag_from_gltf(mesh_extract_out.tfrag_lods[i], pc_level.tfrag_trees[i + 1]);
+  }
 
   // TIE
   if (!mesh_extract_out.tie.base_draws.empty()) {
     file.drawable_trees.ties.emplace_back();
     tie_from_gltf(mesh_extract_out.tie, pc_level.tie_trees[0]);
+    for (size_t i = 0; i < mesh_extract_out.tie_lods.size(); i++) {
+      tie_from_gltf(mesh_extract_out.tie_lods[i], pc_level.tie_trees[i + 1]);
+    }
   }
 
   pc_level.textures = std::move(tex_pool.textures_by_idx);
@@ -85,7 +93,13 @@ bool run_build_level(const std::string& input_file,
   if (mesh_extract_out.collide.faces.empty()) {
     lg::error("No collision geometry was found");
   } else {
-    file.collide_hash = construct_collide_hash(mesh_extract_out.collide.faces);
+    StageKey collide_key;
+    collide_key.add_pod_vector(mesh_extract_out.collide.faces);
+    auto serialize_collide = [&](Serializer& ser) { file.collide_hash.serialize(ser); };
+    if (!cache.load("collide", collide_key, serialize_collide)) {
+      file.collide_hash = construct_collide_hash(mesh_extract_out.collide.faces);
+      cache.save("collide", collide_key, serialize_collide);
+    }
   }
 
   // Save the GOAL level
@@ -11,6 +11,8 @@
 
 #include "IR.h"
 
+#include "common/util/ThreadPool.h"
+
 #include "goalc/debugger/DebugInfo.h"
 #include "goalc/emitter/IGen.h"
 
@@ -51,9 +53,16 @@ std::vector<u8> CodeGenerator::run(const TypeSystem* ts) {
     static_obj->generate(&m_gen);
   }
 
-  // next, add instructions to functions
-  for (size_t i = 0; i < m_fe->functions().size(); i++) {
-    do_function(m_fe->functions().at(i).get(), i);
+  // next, add instructions to functions. Each function only adds to its own instructions, links
+  // and debug info, so they can be done in parallel.
+  const auto& functions = m_fe->functions();
+  if (functions.size() > 1) {
+    ThreadPool::global().parallel_for(functions.size(),
+                                      [&](int i) { do_function(functions.at(i).get(), i); });
+  } else {
+    for (size_t i = 0; i < functions.size(); i++) {
+      do_function(functions.at(i).get(), i);
+    }
   }
 
   // generate a v3 object.
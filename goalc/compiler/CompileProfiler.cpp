@@ -0,0 +1,180 @@
+#include "CompileProfiler.h"
+
+#include <algorithm>
+
+#include "common/log/log.h"
+#include "common/util/Assert.h"
+
+#include "third-party/json.hpp"
+
+namespace {
+const char* phase_name(CompileProfiler::Phase phase) {
+  switch (phase) {
+    case CompileProfiler::Phase::READ:
+      return "read";
+    case CompileProfiler::Phase::COMPILE:
+      return "compile";
+    case CompileProfiler::Phase::REGALLOC:
+      return "regalloc";
+    case CompileProfiler::Phase::CODEGEN:
+      return "codegen";
+    case CompileProfiler::Phase::WRITE:
+      return "write";
+    default:
+      ASSERT(false);
+      return "";
+  }
+}
+
+double to_ms(u64 ns) {
+  return ns / 1.0e6;
+}
+
+double to_us(u64 ns) {
+  return ns / 1.0e3;
+}
+}  // namespace
+
+void CompileProfiler::start() {
+  m_enabled = true;
+  m_start_ns = now_ns();
+  m_files.clear();
+  m_open_files.clear();
+  m_macros.clear();
+}
+
+void CompileProfiler::begin_file(const std::string& name) {
+  if (!m_enabled) {
+    return;
+  }
+  auto& file = m_files.emplace_back();
+  file.name = name;
+  file.start_ns = now_ns();
+  m_open_files.push_back(m_files.size() - 1);
+}
+
+void CompileProfiler::end_file() {
+  if (!m_enabled || m_open_files.empty()) {
+    return;
+  }
+  m_files.at(m_open_files.back()).end_ns = now_ns();
+  m_open_files.pop_back();
+}
+
+void CompileProfiler::add_phase(Phase phase, u64 start_ns, u64 end_ns) {
+  if (!m_enabled || m_open_files.empty()) {
+    return;
+  }
+  auto& file = m_files.at(m_open_files.back());
+  file.phase_ns[(int)phase] += end_ns - start_ns;
+  file.events.push_back({phase, start_ns, end_ns});
+}
+
+void CompileProfiler::add_macro(const char* name, u64 ns) {
+  if (!m_enabled) {
+    return;
+  }
+  auto& macro = m_macros[name];
+  macro.ns += ns;
+  macro.count++;
+  if (!m_open_files.empty()) {
+    m_files.at(m_open_files.back()).macro_ns += ns;
+  }
+}
+
+void CompileProfiler::finish(const fs::path& trace_path, int top_n) {
+  if (!m_enabled) {
+    return;
+  }
+  // files that threw never got their end time.
+  while (!m_open_files.empty()) {
+    end_file();
+  }
+  m_enabled = false;
+  print_tables(top_n);
+  write_trace(trace_path);
+}
+
+void CompileProfiler::print_tables(int top_n) const {
+  u64 phase_totals[(int)Phase::MAX] = {};
+  u64 macro_total = 0;
+  for (auto& file : m_files) {
+    for (int i = 0; i < (int)Phase::MAX; i++) {
+      phase_totals[i] += file.phase_ns[i];
+    }
+    macro_total += file.macro_ns;
+  }
+
+  lg::print("\nCompiler profile ({} files, {:.3f}s total)\n", m_files.size(),
+            to_ms(now_ns() - m_start_ns) / 1000.);
+  lg::print(" {:<24} {:>12}\n", "phase", "time (ms)");
+  for (int i = 0; i < (int)Phase::MAX; i++) {
+    lg::print(" {:<24} {:>12.2f}\n", phase_name((Phase)i), to_ms(phase_totals[i]));
+  }
+  lg::print(" {:<24} {:>12.2f}\n", "  macro expansion", to_ms(macro_total));
+
+  // files, slowest first
+  std::vector<const FileRecord*> files;
+  for (auto& file : m_files) {
+    files.push_back(&file);
+  }
+  std::sort(files.begin(), files.end(), [](const FileRecord* a, const FileRecord* b) {
+    return a->end_ns - a->start_ns > b->end_ns - b->start_ns;
+  });
+  lg::print("\nSlowest {} files (ms)\n", std::min((int)files.size(), top_n));
+  lg::print(" {:<32} {:>9} {:>9} {:>9} {:>9} {:>9} {:>9} {:>9}\n", "file", "total", "read",
+            "macros", "compile", "regalloc", "codegen", "write");
+  for (int i = 0; i < std::min((int)files.size(), top_n); i++) {
+    auto* file = files[i];
+    u64 compile_ns = file->phase_ns[(int)Phase::COMPILE];
+    lg::print(" {:<32} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}\n",
+              file->name, to_ms(file->end_ns - file->start_ns),
+              to_ms(file->phase_ns[(int)Phase::READ]), to_ms(file->macro_ns),
+              to_ms(compile_ns - std::min(compile_ns, file->macro_ns)),
+              to_ms(file->phase_ns[(int)Phase::REGALLOC]),
+              to_ms(file->phase_ns[(int)Phase::CODEGEN]), to_ms(file->phase_ns[(int)Phase::WRITE]));
+  }
+
+  // macros, slowest first
+  std::vector<std::pair<const char*, MacroRecord>> macros(m_macros.begin(), m_macros.end());
+  std::sort(macros.begin(), macros.end(),
+            [](const auto& a, const auto& b) { return a.second.ns > b.second.ns; });
+  lg::print("\nSlowest {} macros\n", std::min((int)macros.size(), top_n));
+  lg::print(" {:<32} {:>12} {:>12} {:>12}\n", "macro", "time (ms)", "expansions", "avg (us)");
+  for (int i = 0; i < std::min((int)macros.size(), top_n); i++) {
+    auto& [name, macro] = macros[i];
+    lg::print(" {:<32} {:>12.2f} {:>12} {:>12.2f}\n", name, to_ms(macro.ns), macro.count,
+              to_us(macro.ns) / macro.count);
+  }
+  lg::print("\n");
+}
+
+void CompileProfiler::write_trace(const fs::path& path) const {
+  nlohmann::json json;
+  auto& trace_events = json["traceEvents"];
+  trace_events = nlohmann::json::array();
+  json["displayTimeUnit"] = "ms";
+
+  auto add_event = [&](const std::string& name, const char* category, u64 start_ns, u64 end_ns) {
+    auto& event = trace_events.emplace_back();
+    event["name"] = name;
+    event["cat"] = category;
+    event["ph"] = "X";
+    event["ts"] = to_us(start_ns - m_start_ns);
+    event["dur"] = to_us(end_ns - start_ns);
+    event["pid"] = 0;
+    event["tid"] = 0;
+    return &event;
+  };
+
+  for (auto& file : m_files) {
+    auto* event = add_event(file.name, "file", file.start_ns, file.end_ns);
+    (*event)["args"]["macro expansion (ms)"] = to_ms(file.macro_ns);
+    for (auto& phase : file.events) {
+      add_event(phase_name(phase.phase), "phase", phase.start_ns, phase.end_ns);
+    }
+  }
+
+  file_util::write_text_file(path, json.dump());
+  lg::print("Saved compiler profile trace to: {}\n", path.string());
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/*!
+ * @file CompileProfiler.h
+ * Optional timing of the compiler, used by (make ... :profile #t).
+ *
+ * Records how long each file spends in each phase of asm-file, and how long the GOOS evaluation
+ * of each macro takes. Type checking happens while compiling each form, so it is part of the
+ * compile phase. The results are saved as a Chrome trace and printed as top-N tables.
+ */
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/util/FileUtil.h"
+
+class CompileProfiler {
+ public:
+  enum class Phase : u8 { READ, COMPILE, REGALLOC, CODEGEN, WRITE, MAX };
+
+  void start();
+  void finish(const fs::path& trace_path, int top_n);
+  bool enabled() const { return m_enabled; }
+
+  void begin_file(const std::string& name);
+  void end_file();
+  void add_phase(Phase phase, u64 start_ns, u64 end_ns);
+  // name should be an interned symbol name, it's used as the key.
+  void add_macro(const char* name, u64 ns);
+
+  static u64 now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+ private:
+  struct PhaseEvent {
+    Phase phase;
+    u64 start_ns;
+    u64 end_ns;
+  };
+
+  struct FileRecord {
+    std::string name;
+    u64 start_ns = 0;
+    u64 end_ns = 0;
+    u64 phase_ns[(int)Phase::MAX] = {};
+    u64 macro_ns = 0;
+    std::vector<PhaseEvent> events;
+  };
+
+  struct MacroRecord {
+    u64 ns = 0;
+    u64 count = 0;
+  };
+
+  void print_tables(int top_n) const;
+  void write_trace(const fs::path& path) const;
+
+  bool m_enabled = false;
+  u64 m_start_ns = 0;
+  std::vector<FileRecord> m_files;
+  // files currently being compiled, asm-file can be nested.
+  std::vector<size_t> m_open_files;
+  std::unordered_map<const char*, MacroRecord> m_macros;
+};
+
+/*!
+ * Adds the time from construction to destruction to a phase of the current file.
+ */
+class ScopedCompilePhase {
+ public:
+  ScopedCompilePhase(CompileProfiler* profiler, CompileProfiler::Phase phase)
+      : m_profiler(profiler->enabled() ? profiler : nullptr), m_phase(phase) {
+    if (m_profiler) {
+      m_start_ns = CompileProfiler::now_ns();
+    }
+  }
+  ScopedCompilePhase(const ScopedCompilePhase&) = delete;
+  ScopedCompilePhase& operator=(const ScopedCompilePhase&) = delete;
+  ~ScopedCompilePhase() {
+    if (m_profiler) {
+      m_profiler->add_phase(m_phase, m_start_ns, CompileProfiler::now_ns());
+    }
+  }
+
+ private:
+  CompileProfiler* m_profiler = nullptr;
+  CompileProfiler::Phase m_phase;
+  u64 m_start_ns = 0;
+};
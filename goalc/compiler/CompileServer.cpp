@@ -0,0 +1,40 @@
+#include "CompileServer.h"
+
+#include "common/formatter/formatter.h"
+
+#include "third-party/json.hpp"
+
+ReplStatus handle_nrepl_request(ReplServer& server,
+                                const ReplRequest& request,
+                                std::unique_ptr<Compiler>& compiler,
+                                std::mutex& compiler_mutex) {
+  ReplStatus status = ReplStatus::OK;
+  switch (request.type) {
+    case ReplServerMessageType::EVAL: {
+      std::lock_guard<std::mutex> lock(compiler_mutex);
+      status = compiler->handle_repl_string(request.body);
+      // Print out the prompt, just for better UX
+      compiler->print_to_repl(compiler->get_prompt());
+    } break;
+    case ReplServerMessageType::EVAL_WITH_RESULT: {
+      nlohmann::json result;
+      {
+        std::lock_guard<std::mutex> lock(compiler_mutex);
+        status = compiler->handle_repl_string(request.body);
+        result["ok"] = !compiler->last_repl_error().has_value();
+        result["error"] = compiler->last_repl_error().value_or("");
+      }
+      server.respond(request, result.dump());
+    } break;
+    case ReplServerMessageType::FORMAT: {
+      auto formatted = formatter::format_code(request.body);
+      nlohmann::json result;
+      result["ok"] = formatted.has_value();
+      result["result"] = formatted.value_or("");
+      server.respond(request, result.dump());
+    } break;
+    default:
+      break;
+  }
+  return status;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "common/repl/nrepl/ReplServer.h"
+
+#include "goalc/compiler/Compiler.h"
+
+/*!
+ * Answer a request that came in over nREPL. Only compiling needs the compiler (and its lock), so
+ * formatting requests don't wait on compiles.
+ */
+ReplStatus handle_nrepl_request(ReplServer& server,
+                                const ReplRequest& request,
+                                std::unique_ptr<Compiler>& compiler,
+                                std::mutex& compiler_mutex);
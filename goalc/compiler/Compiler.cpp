@@ -2,13 +2,21 @@
 
 #include <chrono>
 #include <thread>
+#include <unordered_set>
 
 #include "CompilerException.h"
 #include "IR.h"
+#include "IROptimizer.h"
 
 #include "common/goos/PrettyPrinter.h"
 #include "common/link_types.h"
 #include "common/util/FileUtil.h"
+#include "common/util/MappedFile.h"
+#include "common/util/Serializer.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/Timer.h"
+#include "common/util/hash.h"
+#include "common/util/string_util.h"
 
 #include "goalc/make/Tools.h"
 #include "goalc/regalloc/Allocator.h"
@@ -31,6 +39,10 @@ Compiler::Compiler(GameVersion version,
   m_listener.add_debugger(&m_debugger);
   m_listener.set_default_port(version);
   m_ts.add_builtin_types(m_version);
+  // interactive sessions start with the types from the last build, if the sources haven't changed.
+  if (m_repl) {
+    load_type_snapshot();
+  }
   m_global_env = std::make_unique<GlobalEnv>();
   m_none = std::make_unique<None>(m_ts.make_typespec("none"));
 
@@ -90,6 +102,7 @@ Compiler::~Compiler() {
 }
 
 ReplStatus Compiler::handle_repl_string(const std::string& input) {
+  m_last_repl_error.reset();
   if (input.empty()) {
     return ReplStatus::OK;
   }
@@ -120,6 +133,7 @@ ReplStatus Compiler::handle_repl_string(const std::string& input) {
     }
   } catch (std::exception& e) {
     print_compiler_warning("REPL Error: {}\n", e.what());
+    m_last_repl_error = e.what();
   }
 
   if (m_want_exit) {
@@ -249,9 +263,21 @@ Val* Compiler::compile_error_guard(const goos::Object& code, Env* env) {
 }
 
 void Compiler::color_object_file(FileEnv* env) {
-  int num_spills_in_file = 0;
-  for (auto& f : env->functions()) {
-    AllocationInput input;
+  // build the allocator inputs from the IR on this thread. Allocation only reads its input, so
+  // each function can then be allocated in parallel.
+  const auto& functions = env->functions();
+  if (m_settings.optimize_ir) {
+    for (auto& f : functions) {
+      auto stats = optimize_ir(f.get());
+      m_debug_stats.ir_removed += stats.removed_instructions;
+      m_debug_stats.ir_copies_propagated += stats.propagated_copies;
+    }
+  }
+
+  std::vector<AllocationInput> inputs(functions.size());
+  for (size_t fi = 0; fi < functions.size(); fi++) {
+    auto& f = functions[fi];
+    auto& input = inputs[fi];
     input.is_asm_function = f->is_asm_func;
     for (auto& i : f->code()) {
       input.instructions.push_back(i->to_rai());
@@ -275,29 +301,52 @@ void Compiler::color_object_file(FileEnv* env) {
       input.debug_settings.print_analysis = true;
       input.debug_settings.allocate_log_level = 2;
     }
+  }
 
-    m_debug_stats.total_funcs++;
+  struct Allocation {
+    AllocationResult result;
+    bool needed_v1 = false;
+  };
+  std::vector<Allocation> allocations(functions.size());
+  auto allocate = [&](int fi) {
+    auto& alloc = allocations[fi];
+    alloc.result = allocate_registers_v2(inputs[fi]);
+    if (!alloc.result.ok) {
+      alloc.needed_v1 = true;
+      alloc.result = allocate_registers(inputs[fi]);
+    }
+  };
+
+  // the debug prints would interleave, so keep those in order.
+  if (functions.size() > 1 && !m_settings.debug_print_regalloc) {
+    ThreadPool::global().parallel_for(functions.size(), allocate);
+  } else {
+    for (size_t fi = 0; fi < functions.size(); fi++) {
+      allocate(fi);
+    }
+  }
 
-    auto regalloc_result_2 = allocate_registers_v2(input);
+  int num_spills_in_file = 0;
+  for (size_t fi = 0; fi < functions.size(); fi++) {
+    auto& f = functions[fi];
+    auto& alloc = allocations[fi];
+    m_debug_stats.total_funcs++;
 
-    if (regalloc_result_2.ok) {
-      if (regalloc_result_2.num_spilled_vars > 0) {
+    if (!alloc.needed_v1) {
+      if (alloc.result.num_spilled_vars > 0) {
         // lg::print("Function {} has {} spilled vars.\n", f->name(),
-        //  regalloc_result_2.num_spilled_vars);
+        //  alloc.result.num_spilled_vars);
       }
-      num_spills_in_file += regalloc_result_2.num_spills;
-      f->set_allocations(std::move(regalloc_result_2));
     } else {
       lg::print(
           "Warning: function {} failed register allocation with the v2 allocator. Falling back to "
           "the v1 allocator.\n",
           f->name());
       m_debug_stats.funcs_requiring_v1_allocator++;
-      auto regalloc_result = allocate_registers(input);
-      m_debug_stats.num_spills_v1 += regalloc_result.num_spills;
-      num_spills_in_file += regalloc_result.num_spills;
-      f->set_allocations(std::move(regalloc_result));
+      m_debug_stats.num_spills_v1 += alloc.result.num_spills;
     }
+    num_spills_in_file += alloc.result.num_spills;
+    f->set_allocations(std::move(alloc.result));
   }
 
   m_debug_stats.num_spills += num_spills_in_file;
@@ -415,27 +464,27 @@ void Compiler::setup_goos_forms() {
   });
 }
 
-void Compiler::asm_file(const CompilationOptions& options) {
-  // If the filename provided is not a valid path but it's a name (with or without an extension)
-  // attempt to find it in the defined `asmFileSearchDirs`
-  //
-  // For example - (ml "process-drawable.gc")
-  // - This allows you to load a file without precisely defining the entire path
-  //
-  // If multiple candidates are found, abort
-
-  std::string file_name = options.filename;
+/*!
+ * Get the path to a source file. If the filename provided is not a valid path but it's a name (with
+ * or without an extension) attempt to find it in the defined `asmFileSearchDirs`
+ *
+ * For example - (ml "process-drawable.gc")
+ * - This allows you to load a file without precisely defining the entire path
+ *
+ * If multiple candidates are found, or none, returns an empty string.
+ */
+std::string Compiler::find_asm_file(const std::string& file_name) {
   std::string file_path = file_util::get_file_path({file_name});
 
   if (!file_util::file_exists(file_path)) {
     if (file_path.empty()) {
       lg::print("ERROR - can't load a file without a providing a path\n");
-      return;
+      return {};
     } else if (m_repl && m_repl->repl_config.asm_file_search_dirs.empty()) {
       lg::print(
           "ERROR - can't load a file that doesn't exist - '{}' and no search dirs are defined\n",
           file_path);
-      return;
+      return {};
     }
     std::string base_name = file_util::base_name_no_ext(file_path);
     // Attempt the find the full path of the file (ignore extension)
@@ -453,20 +502,33 @@ void Compiler::asm_file(const CompilationOptions& options) {
 
     if (candidate_paths.empty()) {
       lg::print("ERROR - attempt to find object file automatically, but found nothing\n");
-      return;
+      return {};
     } else if (candidate_paths.size() > 1) {
       lg::print("ERROR - attempt to find object file automatically, but found multiple\n");
-      return;
+      return {};
     }
     // Found the file!, use it!
     file_path = candidate_paths.at(0).string();
   }
+  return file_path;
+}
+
+void Compiler::asm_file(const CompilationOptions& options) {
+  const std::string file_path = find_asm_file(options.filename);
+  if (file_path.empty()) {
+    return;
+  }
 
   // Evict any symbols we have indexed for this file, this is what
   // helps to ensure we have an up to date and accurate symbol index
   m_symbol_info.evict_symbols_using_file_index(file_path);
 
-  auto code = m_goos.reader.read_from_file({file_path});
+  m_compile_profiler.begin_file(fs::path(file_path).filename().string());
+  goos::Object code;
+  {
+    ScopedCompilePhase phase(&m_compile_profiler, CompileProfiler::Phase::READ);
+    code = m_goos.reader.read_from_file({file_path});
+  }
 
   std::string obj_file_name = file_path;
 
@@ -480,11 +542,19 @@ void Compiler::asm_file(const CompilationOptions& options) {
   obj_file_name = obj_file_name.substr(0, obj_file_name.find_last_of('.'));
 
   // COMPILE
-  auto obj_file = compile_object_file(obj_file_name, code, !options.no_code);
+  FileEnv* obj_file = nullptr;
+  {
+    ScopedCompilePhase phase(&m_compile_profiler, CompileProfiler::Phase::COMPILE);
+    obj_file = compile_object_file(obj_file_name, code, !options.no_code);
+  }
+  m_type_snapshot_sources[file_path] = hash_util::hash64(file_util::read_text_file(file_path));
 
   if (options.color) {
     // register allocation
-    color_object_file(obj_file);
+    {
+      ScopedCompilePhase phase(&m_compile_profiler, CompileProfiler::Phase::REGALLOC);
+      color_object_file(obj_file);
+    }
 
     // code/object file generation
     std::vector<u8> data;
@@ -497,6 +567,7 @@ void Compiler::asm_file(const CompilationOptions& options) {
         file_util::write_text_file(options.disassembly_output_file, disasm);
       }
     } else {
+      ScopedCompilePhase phase(&m_compile_profiler, CompileProfiler::Phase::CODEGEN);
       data = codegen_object_file(obj_file);
     }
 
@@ -511,6 +582,7 @@ void Compiler::asm_file(const CompilationOptions& options) {
 
     // save file
     if (options.write) {
+      ScopedCompilePhase phase(&m_compile_profiler, CompileProfiler::Phase::WRITE);
       auto path = file_util::get_jak_project_dir() / "out" / m_make.compiler_output_prefix() /
                   "obj" / (obj_file_name + ".o");
       file_util::create_dir_if_needed_for_file(path);
@@ -529,4 +601,210 @@ void Compiler::asm_file(const CompilationOptions& options) {
       lg::print("WARNING - couldn't disassemble because coloring is not enabled\n");
     }
   }
+  m_compile_profiler.end_file();
+}
+
+namespace {
+/*!
+ * If form is a function or method definition, get its name and, for methods, the type.
+ */
+bool get_definition_name(const goos::Object& form, std::string* name, std::string* method_type) {
+  if (!form.is_pair() || !form.as_pair()->car.is_symbol()) {
+    return false;
+  }
+  const auto& head = form.as_pair()->car.as_symbol().name_ptr;
+  const auto& rest = form.as_pair()->cdr;
+  if (!rest.is_pair() || !rest.as_pair()->car.is_symbol()) {
+    return false;
+  }
+  static const std::unordered_set<std::string> kFunctionDefs = {
+      "defun", "defun-debug", "defun-recursive", "defun-debug-recursive", "defbehavior"};
+  if (kFunctionDefs.count(head)) {
+    *name = rest.as_pair()->car.as_symbol().name_ptr;
+    method_type->clear();
+    return true;
+  }
+  if (std::string(head) != "defmethod" || !rest.as_pair()->cdr.is_pair()) {
+    return false;
+  }
+  *name = rest.as_pair()->car.as_symbol().name_ptr;
+  // either (defmethod name type (args) ...) or (defmethod name ((this type) args) ...)
+  const auto& after_name = rest.as_pair()->cdr.as_pair()->car;
+  method_type->clear();
+  if (after_name.is_symbol()) {
+    *method_type = after_name.as_symbol().name_ptr;
+  } else if (after_name.is_pair() && after_name.as_pair()->car.is_pair()) {
+    const auto& first_arg = after_name.as_pair()->car;
+    if (first_arg.as_pair()->cdr.is_pair() && first_arg.as_pair()->cdr.as_pair()->car.is_symbol()) {
+      *method_type = first_arg.as_pair()->cdr.as_pair()->car.as_symbol().name_ptr;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+/*!
+ * Compile just the definitions of one function or method from a file and send them to the target,
+ * like they were typed into the REPL. This replaces the function (or method) without running the
+ * rest of the file's top level, and only the new function is allocated in the target.
+ * For methods, method_type picks one type's method if the file defines several with the name.
+ */
+void Compiler::hot_patch(const std::string& file_name,
+                         const std::string& def_name,
+                         const std::optional<std::string>& method_type) {
+  const std::string file_path = find_asm_file(file_name);
+  if (file_path.empty()) {
+    return;
+  }
+
+  goos::Object code = m_goos.reader.read_from_file({file_path});
+  std::vector<goos::Object> forms = {
+      goos::Object::make_symbol(&m_goos.reader.symbolTable, "top-level")};
+  std::vector<std::string> found;
+  std::string name, type;
+  for_each_in_list(code.as_pair()->cdr, [&](const goos::Object& form) {
+    if (get_definition_name(form, &name, &type) && name == def_name &&
+        (!method_type || *method_type == type)) {
+      forms.push_back(form);
+      found.push_back(type.empty() ? name : fmt::format("{} of {}", name, type));
+    }
+  });
+
+  if (found.empty()) {
+    throw std::runtime_error(
+        fmt::format("No definition of {} was found in {}", def_name, file_path));
+  }
+  lg::print("Patching {}\n", str_util::join(found, ", "));
+
+  auto obj_file = compile_object_file("repl", goos::build_list(std::move(forms)), true);
+  color_object_file(obj_file);
+  auto data = codegen_object_file(obj_file);
+  if (m_listener.is_connected()) {
+    m_listener.send_code(data);
+  } else {
+    lg::print("WARNING - couldn't load because listener isn't connected\n");
+  }
+}
+
+namespace {
+/*!
+ * The type snapshot holds the type system and global symbol types from the last successful build,
+ * so an interactive session knows about all types before anything is compiled. It's only valid if
+ * every source file that went into it is unchanged.
+ */
+struct TypeSnapshotHeader {
+  static constexpr u32 kMagic = 0x53505954;  // TYPS
+  static constexpr u32 kVersion = 2;
+  u32 magic = kMagic;
+  u32 version = kVersion;
+  u32 game_version = 0;
+  u32 pad = 0;
+  u64 payload_size = 0;
+  u64 payload_hash = 0;
+};
+
+fs::path type_snapshot_path(GameVersion version) {
+  return file_util::get_jak_project_dir() / "out" / game_version_names[version] /
+         "type-snapshot.bin";
+}
+}  // namespace
+
+/*!
+ * Save the type system and global symbol types. This should be called after a successful build.
+ */
+void Compiler::save_type_snapshot() {
+  Timer timer;
+  Serializer ser;
+  ser.from_string_map(&m_type_snapshot_sources, [&](u64* hash) { ser.from_ptr(hash); });
+  m_ts.serialize(ser);
+  std::vector<std::pair<std::string, TypeSpec>> symbol_types;
+  m_symbol_types.for_each(
+      [&](const char* name, const TypeSpec& ts) { symbol_types.emplace_back(name, ts); });
+  ser.from_vector(&symbol_types, [&](std::pair<std::string, TypeSpec>* sym) {
+    ser.from_str(&sym->first);
+    sym->second.serialize(ser);
+  });
+
+  auto [payload, payload_size] = ser.get_save_result();
+  TypeSnapshotHeader header;
+  header.game_version = (u32)m_version;
+  header.payload_size = payload_size;
+  header.payload_hash = hash_util::hash64(payload, payload_size);
+  std::vector<u8> data(sizeof(header) + payload_size);
+  memcpy(data.data(), &header, sizeof(header));
+  memcpy(data.data() + sizeof(header), payload, payload_size);
+
+  // write and rename, so another session never sees a partial file.
+  const auto path = type_snapshot_path(m_version);
+  const auto tmp_path = fs::path(path.string() + ".tmp");
+  try {
+    file_util::create_dir_if_needed_for_file(path);
+    file_util::write_binary_file(tmp_path, data.data(), data.size());
+    fs::rename(tmp_path, path);
+  } catch (std::exception& e) {
+    lg::warn("Failed to save type snapshot: {}", e.what());
+    return;
+  }
+  lg::info("Saved type snapshot ({} files, {} KB) in {:.1f} ms", m_type_snapshot_sources.size(),
+           data.size() / 1024, timer.getMs());
+}
+
+/*!
+ * Load the type snapshot from the last build, if all of its source files are unchanged.
+ * Returns false if there is no usable snapshot, in which case nothing is modified.
+ */
+bool Compiler::load_type_snapshot() {
+  Timer timer;
+  const auto path = type_snapshot_path(m_version);
+  if (!fs::exists(path)) {
+    return false;
+  }
+
+  std::unique_ptr<MappedFile> file;
+  try {
+    file = std::make_unique<MappedFile>(path);
+  } catch (std::exception& e) {
+    lg::warn("Failed to open type snapshot: {}", e.what());
+    return false;
+  }
+
+  TypeSnapshotHeader header;
+  if (file->size() < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, file->data(), sizeof(header));
+  const u8* payload = file->data() + sizeof(header);
+  if (header.magic != TypeSnapshotHeader::kMagic ||
+      header.version != TypeSnapshotHeader::kVersion ||
+      header.game_version != (u32)m_version ||
+      header.payload_size != file->size() - sizeof(header) ||
+      header.payload_hash != hash_util::hash64(payload, header.payload_size)) {
+    lg::warn("Ignoring invalid type snapshot {}", path.string());
+    return false;
+  }
+
+  Serializer ser(payload, header.payload_size, false);
+  std::map<std::string, u64> sources;
+  ser.from_string_map(&sources, [&](u64* hash) { ser.from_ptr(hash); });
+  for (const auto& [source, hash] : sources) {
+    if (!fs::exists(source) || hash_util::hash64(file_util::read_text_file(source)) != hash) {
+      lg::info("Type snapshot is out of date ({} changed)", source);
+      return false;
+    }
+  }
+
+  m_ts.serialize(ser);
+  size_t symbol_count = ser.load<size_t>();
+  for (size_t i = 0; i < symbol_count; i++) {
+    auto name = ser.load_string();
+    TypeSpec ts;
+    ts.serialize(ser);
+    m_symbol_types.set(m_goos.intern_ptr(name), ts);
+  }
+  ASSERT(ser.get_load_finished());
+
+  m_type_snapshot_sources = std::move(sources);
+  lg::info("Loaded type snapshot ({} files) in {:.1f} ms", m_type_snapshot_sources.size(),
+           timer.getMs());
+  return true;
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <mutex>
 #include <optional>
 
@@ -8,6 +9,7 @@
 #include "common/repl/repl_wrapper.h"
 #include "common/type_system/TypeSystem.h"
 
+#include "goalc/compiler/CompileProfiler.h"
 #include "goalc/compiler/CompilerException.h"
 #include "goalc/compiler/CompilerSettings.h"
 #include "goalc/compiler/Env.h"
@@ -51,12 +53,17 @@ class Compiler {
            std::unique_ptr<REPL::Wrapper> repl = nullptr);
   ~Compiler();
   void asm_file(const CompilationOptions& options);
+  void hot_patch(const std::string& file_name,
+                 const std::string& def_name,
+                 const std::optional<std::string>& method_type);
 
   void save_repl_history();
   void print_to_repl(const std::string& str);
   std::string get_prompt();
   std::string get_repl_input();
   ReplStatus handle_repl_string(const std::string& input);
+  // why the last handle_repl_string failed, if it did. Used to answer nREPL requests.
+  const std::optional<std::string>& last_repl_error() const { return m_last_repl_error; }
   goos::Interpreter& get_goos() { return m_goos; }
   FileEnv* compile_object_file(const std::string& name, goos::Object code, bool allow_emit);
   std::unique_ptr<FunctionEnv> compile_top_level_function(const std::string& name,
@@ -78,6 +85,8 @@ class Compiler {
                                            const std::optional<std::string>& string_name);
   void shutdown_target();
   void enable_throw_on_redefines() { m_throw_on_define_extern_redefinition = true; }
+  void enable_ir_optimizer() { m_settings.optimize_ir = true; }
+  void enable_fma() { m_settings.use_fma = true; }
   void add_ignored_define_extern_symbol(const std::string& name) {
     m_allow_inconsistent_definition_symbols.insert(name);
   }
@@ -100,11 +109,15 @@ class Compiler {
                      replxx::Replxx::colors_t& colors,
                      std::vector<std::pair<std::string, replxx::Replxx::Color>> const& user_data);
   bool knows_object_file(const std::string& name);
+  void save_type_snapshot();
+  bool load_type_snapshot();
   MakeSystem& make_system() { return m_make; }
   std::vector<symbol_info::SymbolInfo*> lookup_symbol_info_by_file(
       const std::string& file_path) const;
   std::vector<symbol_info::SymbolInfo*> lookup_symbol_info_by_prefix(
       const std::string& prefix) const;
+  std::vector<symbol_info::SymbolInfo*> lookup_symbol_info_fuzzy(const std::string& query,
+                                                                 int max_count) const;
   std::set<std::string> lookup_symbol_names_starting_with(const std::string& prefix,
                                                           int max_count = -1) const;
   std::vector<symbol_info::SymbolInfo*> lookup_exact_name_info(const std::string& name) const;
@@ -117,18 +130,22 @@ class Compiler {
   generate_per_file_symbol_info();
 
  private:
+  std::string find_asm_file(const std::string& file_name);
+
   GameVersion m_version;
   TypeSystem m_ts;
   std::unique_ptr<GlobalEnv> m_global_env = nullptr;
   std::unique_ptr<None> m_none = nullptr;
   bool m_want_exit = false;
   bool m_want_reload = false;
+  std::optional<std::string> m_last_repl_error;
   listener::Listener m_listener;
   goos::Interpreter m_goos;
   Debugger m_debugger;
   MakeSystem m_make;
   std::unique_ptr<REPL::Wrapper> m_repl;
   CompilerSettings m_settings;
+  CompileProfiler m_compile_profiler;
   bool m_throw_on_define_extern_redefinition = false;  // TODO - move to settings
 
   // State Tracking
@@ -141,12 +158,17 @@ class Compiler {
   // Overrides
   std::unordered_set<std::string> m_allow_inconsistent_definition_symbols;
 
+  // hash of each source file whose types are in m_ts, used to validate the type snapshot.
+  std::map<std::string, u64> m_type_snapshot_sources;
+
   struct DebugStats {
     int num_spills = 0;
     int num_spills_v1 = 0;
     int num_moves_eliminated = 0;
     int total_funcs = 0;
     int funcs_requiring_v1_allocator = 0;
+    int ir_removed = 0;
+    int ir_copies_propagated = 0;
   } m_debug_stats;
 
   void setup_goos_forms();
@@ -621,6 +643,7 @@ class Compiler {
   Val* compile_seval(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_exit(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_asm_file(const goos::Object& form, const goos::Object& rest, Env* env);
+  Val* compile_hot_patch(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_repl_clear_screen(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_asm_data_file(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_asm_text_file(const goos::Object& form, const goos::Object& rest, Env* env);
@@ -668,6 +691,9 @@ class Compiler {
   Val* compile_stop(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_dump_all(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_pm(const goos::Object& form, const goos::Object& rest, Env* env);
+  Val* compile_mem_snapshot(const goos::Object& form, const goos::Object& rest, Env* env);
+  Val* compile_mem_diff(const goos::Object& form, const goos::Object& rest, Env* env);
+  Val* compile_prof(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_di(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_disasm(const goos::Object& form, const goos::Object& rest, Env* env);
   Val* compile_bp(const goos::Object& form, const goos::Object& rest, Env* env);
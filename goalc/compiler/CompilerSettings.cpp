@@ -9,6 +9,12 @@ CompilerSettings::CompilerSettings() {
 
   m_settings["disable-math-const-prop"].kind = SettingKind::BOOL;
   m_settings["disable-math-const-prop"].boolp = &disable_math_const_prop;
+
+  m_settings["optimize-ir"].kind = SettingKind::BOOL;
+  m_settings["optimize-ir"].boolp = &optimize_ir;
+
+  m_settings["use-fma"].kind = SettingKind::BOOL;
+  m_settings["use-fma"].boolp = &use_fma;
 }
 
 void CompilerSettings::set(const std::string& name, const goos::Object& value) {
@@ -11,6 +11,8 @@ class CompilerSettings {
   bool debug_print_ir = false;
   bool debug_print_regalloc = false;
   bool disable_math_const_prop = false;
+  bool optimize_ir = false;
+  bool use_fma = false;  // objects built with this only run on CPUs with FMA
   bool emit_move_after_return = true;
   bool check_for_requires = false;  // check for missing 'require' statements (TODO - does not work
                                     // for virtual state usages or macro usages)
@@ -50,7 +50,7 @@ RegVal* Env::make_vfr(const TypeSpec& ts) {
   return make_ireg(coerce_to_reg_type(ts), RegClass::VECTOR_FLOAT);
 }
 
-std::unordered_map<std::string, Label>& Env::get_label_map() {
+cu::FlatHashMap<std::string, Label>& Env::get_label_map() {
   return parent()->get_label_map();
 }
 
@@ -163,6 +163,33 @@ void FileEnv::add_static(std::unique_ptr<StaticObject> s) {
   m_statics.push_back(std::move(s));
 }
 
+/*!
+ * Get a static string with this text, in the given segment. Identical string constants in a file
+ * share a single string, so they should not be modified.
+ */
+StaticString* FileEnv::get_string_constant(const std::string& text, int seg) {
+  auto& existing = m_string_constants.at(seg)[text];
+  if (!existing) {
+    auto obj = std::make_unique<StaticString>(text, seg);
+    existing = obj.get();
+    add_static(std::move(obj));
+  }
+  return existing;
+}
+
+/*!
+ * Get a static float with this value, in the given segment. Floats with the same bits share one.
+ */
+StaticFloat* FileEnv::get_float_constant(float value, int seg) {
+  auto& existing = m_float_constants.at(seg)[float_as_u32(value)];
+  if (!existing) {
+    auto obj = std::make_unique<StaticFloat>(value, seg);
+    existing = obj.get();
+    add_static(std::move(obj));
+  }
+  return existing;
+}
+
 void FileEnv::add_top_level_function(std::unique_ptr<FunctionEnv> fe) {
   // todo, set FE as top level segment
   m_functions.push_back(std::move(fe));
@@ -188,6 +215,12 @@ void FileEnv::cleanup_after_codegen() {
   m_top_level_func = nullptr;
   m_functions.clear();
   m_statics.clear();
+  for (auto& constants : m_string_constants) {
+    constants.clear();
+  }
+  for (auto& constants : m_float_constants) {
+    constants.clear();
+  }
   m_vals.clear();
 }
 
@@ -235,6 +268,15 @@ void FunctionEnv::finish() {
   resolve_gotos();
 }
 
+/*!
+ * Replace an instruction with one that does nothing, and drop any register constraints on it.
+ * Instruction indices stay the same, so labels and the remaining constraints are still valid.
+ */
+void FunctionEnv::remove_ir(int idx) {
+  m_code.at(idx) = std::make_unique<IR_Null>();
+  std::erase_if(m_constraints, [&](const IRegConstraint& c) { return c.instr_idx == idx; });
+}
+
 void FunctionEnv::resolve_gotos() {
   for (auto& gt : unresolved_gotos) {
     auto kv_label = m_labels.find(gt.label);
@@ -264,11 +306,11 @@ RegVal* FunctionEnv::make_ireg(const TypeSpec& ts, RegClass reg_class) {
   return m_iregs.back().get();
 }
 
-std::unordered_map<std::string, Label>& FunctionEnv::get_label_map() {
+cu::FlatHashMap<std::string, Label>& FunctionEnv::get_label_map() {
   return m_labels;
 }
 
-std::unordered_map<std::string, Label>& LabelEnv::get_label_map() {
+cu::FlatHashMap<std::string, Label>& LabelEnv::get_label_map() {
   return m_labels;
 }
 
@@ -6,6 +6,7 @@
  * manages the memory for stuff generated during compiling.
  */
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -15,7 +16,9 @@
 #include "Val.h"
 
 #include "common/goos/Object.h"
+#include "common/link_types.h"
 #include "common/type_system/TypeSpec.h"
+#include "common/util/FlatHashMap.h"
 
 #include "goalc/regalloc/allocator_interface.h"
 
@@ -40,7 +43,7 @@ class Env {
   virtual void constrain_reg(IRegConstraint constraint);  // todo, remove!
   virtual RegVal* lexical_lookup(goos::Object sym);
   virtual BlockEnv* find_block(const std::string& name);
-  virtual std::unordered_map<std::string, Label>& get_label_map();
+  virtual cu::FlatHashMap<std::string, Label>& get_label_map();
   RegVal* make_gpr(const TypeSpec& ts);
   RegVal* make_fpr(const TypeSpec& ts);
   RegVal* make_vfr(const TypeSpec& ts);
@@ -102,6 +105,8 @@ class FileEnv : public Env {
   void add_function(std::unique_ptr<FunctionEnv> fe);
   void add_top_level_function(std::unique_ptr<FunctionEnv> fe);
   void add_static(std::unique_ptr<StaticObject> s);
+  StaticString* get_string_constant(const std::string& text, int seg);
+  StaticFloat* get_float_constant(float value, int seg);
   void debug_print_tl();
   const std::vector<std::unique_ptr<FunctionEnv>>& functions() { return m_functions; }
   const std::vector<std::unique_ptr<StaticObject>>& statics() { return m_statics; }
@@ -139,6 +144,9 @@ class FileEnv : public Env {
   std::string m_name;
   std::vector<std::unique_ptr<FunctionEnv>> m_functions;
   std::vector<std::unique_ptr<StaticObject>> m_statics;
+  // string literals and float constants, shared by everything in the segment that uses them.
+  std::array<cu::FlatHashMap<std::string, StaticString*>, N_SEG> m_string_constants;
+  std::array<cu::FlatHashMap<u32, StaticFloat*>, N_SEG> m_float_constants;
   int m_anon_func_counter = 0;
   std::vector<std::unique_ptr<Val>> m_vals;
   int m_default_segment = MAIN_SEGMENT;
@@ -183,12 +191,13 @@ class FunctionEnv : public DeclareEnv {
  public:
   FunctionEnv(Env* parent, std::string name, const goos::Reader* reader);
   std::string print() override;
-  std::unordered_map<std::string, Label>& get_label_map() override;
+  cu::FlatHashMap<std::string, Label>& get_label_map() override;
   void set_segment(int seg) { segment = seg; }
   void emit(const goos::Object& form, std::unique_ptr<IR> ir, Env* lowest_env);
   void finish();
   RegVal* make_ireg(const TypeSpec& ts, RegClass reg_class) override;
   const std::vector<std::unique_ptr<IR>>& code() const { return m_code; }
+  void remove_ir(int idx);
   const std::vector<goos::Object>& code_source() const { return m_code_debug_source; }
   int max_vars() const { return m_iregs.size(); }
   const std::vector<IRegConstraint>& constraints() { return m_constraints; }
@@ -252,7 +261,7 @@ class FunctionEnv : public DeclareEnv {
   TypeSpec asm_func_return_type;
   std::vector<UnresolvedGoto> unresolved_gotos;
   std::vector<UnresolvedConditionalGoto> unresolved_cond_gotos;
-  std::unordered_map<goos::InternedSymbolPtr, RegVal*, goos::InternedSymbolPtr::hash> params;
+  cu::FlatHashMap<goos::InternedSymbolPtr, RegVal*, goos::InternedSymbolPtr::hash> params;
 
  protected:
   void resolve_gotos();
@@ -269,9 +278,9 @@ class FunctionEnv : public DeclareEnv {
 
   bool m_aligned_stack_required = false;
   int m_stack_var_slots_used = 0;
-  std::unordered_map<std::string, Label> m_labels;
+  cu::FlatHashMap<std::string, Label> m_labels;
   std::vector<std::unique_ptr<Label>> m_unnamed_labels;
-  std::unordered_map<std::string, StackSpace> m_stack_singleton_slots;
+  cu::FlatHashMap<std::string, StackSpace> m_stack_singleton_slots;
 
   const goos::Reader* m_reader = nullptr;
 };
@@ -293,18 +302,18 @@ class LexicalEnv : public DeclareEnv {
   explicit LexicalEnv(Env* parent) : DeclareEnv(EnvKind::OTHER_ENV, parent) {}
   RegVal* lexical_lookup(goos::Object sym) override;
   std::string print() override;
-  std::unordered_map<goos::InternedSymbolPtr, RegVal*, goos::InternedSymbolPtr::hash> vars;
+  cu::FlatHashMap<goos::InternedSymbolPtr, RegVal*, goos::InternedSymbolPtr::hash> vars;
 };
 
 class LabelEnv : public Env {
  public:
   explicit LabelEnv(Env* parent) : Env(EnvKind::OTHER_ENV, parent) {}
   std::string print() override { return "labelenv"; }
-  std::unordered_map<std::string, Label>& get_label_map() override;
+  cu::FlatHashMap<std::string, Label>& get_label_map() override;
   BlockEnv* find_block(const std::string& name) override;
 
  protected:
-  std::unordered_map<std::string, Label> m_labels;
+  cu::FlatHashMap<std::string, Label> m_labels;
 };
 
 class SymbolMacroEnv : public Env {
@@ -38,6 +38,18 @@ Register get_reg(const RegVal* rv, const AllocationResult& allocs, emitter::IR_R
   }
 }
 
+/*!
+ * If operand is old_val, change it to new_val.
+ */
+template <typename T>
+bool replace_operand(T*& operand, const RegVal* old_val, RegVal* new_val) {
+  if (operand && operand->ireg().id == old_val->ireg().id) {
+    operand = new_val;
+    return true;
+  }
+  return false;
+}
+
 int get_stack_offset(const RegVal* rv, const AllocationResult& allocs) {
   if (rv->rlet_constraint().has_value()) {
     // should be impossible. Can't take the address of an inline assembly form register.
@@ -169,6 +181,10 @@ RegAllocInstr IR_Return::to_rai() {
   return rai;
 }
 
+bool IR_Return::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_value, old_val, new_val);
+}
+
 void IR_Return::add_constraints(std::vector<IRegConstraint>* constraints, int my_id) {
   IRegConstraint c;
   if (dynamic_cast<const None*>(m_return_reg)) {
@@ -211,6 +227,10 @@ RegAllocInstr IR_LoadConstant64::to_rai() {
   return rai;
 }
 
+bool IR_LoadConstant64::removable_if_unused() const {
+  return true;
+}
+
 void IR_LoadConstant64::do_codegen(emitter::ObjectGenerator* gen,
                                    const AllocationResult& allocs,
                                    emitter::IR_Record irec) {
@@ -234,6 +254,10 @@ RegAllocInstr IR_LoadSymbolPointer::to_rai() {
   return rai;
 }
 
+bool IR_LoadSymbolPointer::removable_if_unused() const {
+  return true;
+}
+
 void IR_LoadSymbolPointer::do_codegen(emitter::ObjectGenerator* gen,
                                       const AllocationResult& allocs,
                                       emitter::IR_Record irec) {
@@ -277,6 +301,10 @@ RegAllocInstr IR_SetSymbolValue::to_rai() {
   return rai;
 }
 
+bool IR_SetSymbolValue::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_src, old_val, new_val);
+}
+
 void IR_SetSymbolValue::do_codegen(emitter::ObjectGenerator* gen,
                                    const AllocationResult& allocs,
                                    emitter::IR_Record irec) {
@@ -305,6 +333,10 @@ RegAllocInstr IR_GetSymbolValue::to_rai() {
   return rai;
 }
 
+bool IR_GetSymbolValue::removable_if_unused() const {
+  return true;
+}
+
 void IR_GetSymbolValue::do_codegen(emitter::ObjectGenerator* gen,
                                    const AllocationResult& allocs,
                                    emitter::IR_Record irec) {
@@ -340,6 +372,14 @@ RegAllocInstr IR_RegSet::to_rai() {
   return rai;
 }
 
+bool IR_RegSet::removable_if_unused() const {
+  return true;
+}
+
+bool IR_RegSet::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_src, old_val, new_val);
+}
+
 void IR_RegSet::do_codegen(emitter::ObjectGenerator* gen,
                            const AllocationResult& allocs,
                            emitter::IR_Record irec) {
@@ -504,6 +544,10 @@ RegAllocInstr IR_StaticVarAddr::to_rai() {
   return rai;
 }
 
+bool IR_StaticVarAddr::removable_if_unused() const {
+  return true;
+}
+
 void IR_StaticVarAddr::do_codegen(emitter::ObjectGenerator* gen,
                                   const AllocationResult& allocs,
                                   emitter::IR_Record irec) {
@@ -529,6 +573,10 @@ RegAllocInstr IR_FunctionAddr::to_rai() {
   return rai;
 }
 
+bool IR_FunctionAddr::removable_if_unused() const {
+  return true;
+}
+
 void IR_FunctionAddr::do_codegen(emitter::ObjectGenerator* gen,
                                  const AllocationResult& allocs,
                                  emitter::IR_Record irec) {
@@ -608,6 +656,21 @@ RegAllocInstr IR_IntegerMath::to_rai() {
   return rai;
 }
 
+bool IR_IntegerMath::removable_if_unused() const {
+  // division by zero traps, so keep those.
+  return m_kind != IntegerMathKind::IDIV_32 && m_kind != IntegerMathKind::IMOD_32 &&
+         m_kind != IntegerMathKind::UDIV_32 && m_kind != IntegerMathKind::UMOD_32;
+}
+
+bool IR_IntegerMath::replace_read(const RegVal* old_val, RegVal* new_val) {
+  // the destination is also a source, so only the argument can be replaced.
+  if (m_kind == IntegerMathKind::NOT_64 || m_kind == IntegerMathKind::SHL_64 ||
+      m_kind == IntegerMathKind::SAR_64 || m_kind == IntegerMathKind::SHR_64) {
+    return false;
+  }
+  return replace_operand(m_arg, old_val, new_val);
+}
+
 void IR_IntegerMath::do_codegen(emitter::ObjectGenerator* gen,
                                 const AllocationResult& allocs,
                                 emitter::IR_Record irec) {
@@ -737,6 +800,14 @@ RegAllocInstr IR_FloatMath::to_rai() {
   return rai;
 }
 
+bool IR_FloatMath::removable_if_unused() const {
+  return true;
+}
+
+bool IR_FloatMath::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_arg, old_val, new_val);
+}
+
 void IR_FloatMath::do_codegen(emitter::ObjectGenerator* gen,
                               const AllocationResult& allocs,
                               emitter::IR_Record irec) {
@@ -791,6 +862,10 @@ RegAllocInstr IR_StaticVarLoad::to_rai() {
   return rai;
 }
 
+bool IR_StaticVarLoad::removable_if_unused() const {
+  return true;
+}
+
 void IR_StaticVarLoad::do_codegen(emitter::ObjectGenerator* gen,
                                   const AllocationResult& allocs,
                                   emitter::IR_Record irec) {
@@ -859,6 +934,12 @@ RegAllocInstr IR_ConditionalBranch::to_rai() {
   return rai;
 }
 
+bool IR_ConditionalBranch::replace_read(const RegVal* old_val, RegVal* new_val) {
+  bool replaced = replace_operand(condition.a, old_val, new_val);
+  replaced |= replace_operand(condition.b, old_val, new_val);
+  return replaced;
+}
+
 void IR_ConditionalBranch::do_codegen(emitter::ObjectGenerator* gen,
                                       const AllocationResult& allocs,
                                       emitter::IR_Record irec) {
@@ -940,6 +1021,10 @@ RegAllocInstr IR_LoadConstOffset::to_rai() {
   return rai;
 }
 
+bool IR_LoadConstOffset::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return m_use_coloring && replace_operand(m_base, old_val, new_val);
+}
+
 void IR_LoadConstOffset::do_codegen(emitter::ObjectGenerator* gen,
                                     const AllocationResult& allocs,
                                     emitter::IR_Record irec) {
@@ -988,6 +1073,15 @@ RegAllocInstr IR_StoreConstOffset::to_rai() {
   return rai;
 }
 
+bool IR_StoreConstOffset::replace_read(const RegVal* old_val, RegVal* new_val) {
+  if (!m_use_coloring) {
+    return false;
+  }
+  bool replaced = replace_operand(m_value, old_val, new_val);
+  replaced |= replace_operand(m_base, old_val, new_val);
+  return replaced;
+}
+
 void IR_StoreConstOffset::do_codegen(emitter::ObjectGenerator* gen,
                                      const AllocationResult& allocs,
                                      emitter::IR_Record irec) {
@@ -1076,6 +1170,14 @@ RegAllocInstr IR_FloatToInt::to_rai() {
   return rai;
 }
 
+bool IR_FloatToInt::removable_if_unused() const {
+  return true;
+}
+
+bool IR_FloatToInt::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_src, old_val, new_val);
+}
+
 void IR_FloatToInt::do_codegen(emitter::ObjectGenerator* gen,
                                const AllocationResult& allocs,
                                emitter::IR_Record irec) {
@@ -1102,6 +1204,14 @@ RegAllocInstr IR_IntToFloat::to_rai() {
   return rai;
 }
 
+bool IR_IntToFloat::removable_if_unused() const {
+  return true;
+}
+
+bool IR_IntToFloat::replace_read(const RegVal* old_val, RegVal* new_val) {
+  return replace_operand(m_src, old_val, new_val);
+}
+
 void IR_IntToFloat::do_codegen(emitter::ObjectGenerator* gen,
                                const AllocationResult& allocs,
                                emitter::IR_Record irec) {
@@ -1125,6 +1235,10 @@ RegAllocInstr IR_GetStackAddr::to_rai() {
   return rai;
 }
 
+bool IR_GetStackAddr::removable_if_unused() const {
+  return true;
+}
+
 void IR_GetStackAddr::do_codegen(emitter::ObjectGenerator* gen,
                                  const AllocationResult& allocs,
                                  emitter::IR_Record irec) {
@@ -1537,6 +1651,69 @@ void IR_VFMath3Asm::do_codegen(emitter::ObjectGenerator* gen,
   }
 }
 
+///////////////////////
+// IR_VFMulAddAsm
+///////////////////////
+
+IR_VFMulAddAsm::IR_VFMulAddAsm(bool use_color,
+                               const RegVal* dst,
+                               const RegVal* acc,
+                               const RegVal* src1,
+                               const RegVal* src2,
+                               bool subtract)
+    : IR_Asm(use_color),
+      m_dst(dst),
+      m_acc(acc),
+      m_src1(src1),
+      m_src2(src2),
+      m_subtract(subtract) {}
+
+std::string IR_VFMulAddAsm::print() {
+  return fmt::format("{}{} {}, {}, {}, {}", m_subtract ? ".fnmadd.vf" : ".fmadd.vf",
+                     get_color_suffix_string(), m_dst->print(), m_acc->print(), m_src1->print(),
+                     m_src2->print());
+}
+
+RegAllocInstr IR_VFMulAddAsm::to_rai() {
+  RegAllocInstr rai;
+  if (m_use_coloring) {
+    rai.write.push_back(m_dst->ireg());
+    rai.read.push_back(m_acc->ireg());
+    rai.read.push_back(m_src1->ireg());
+    rai.read.push_back(m_src2->ireg());
+  }
+  return rai;
+}
+
+void IR_VFMulAddAsm::do_codegen(emitter::ObjectGenerator* gen,
+                                const AllocationResult& allocs,
+                                emitter::IR_Record irec) {
+  auto dst = get_reg_asm(m_dst, allocs, irec, m_use_coloring);
+  auto acc = get_reg_asm(m_acc, allocs, irec, m_use_coloring);
+  auto src1 = get_reg_asm(m_src1, allocs, irec, m_use_coloring);
+  auto src2 = get_reg_asm(m_src2, allocs, irec, m_use_coloring);
+
+  // x86 overwrites one of the three inputs, pick the form that overwrites the one in dst.
+  if (dst == acc) {
+    gen->add_instr(m_subtract ? IGen::fnmadd231_vf(dst, src1, src2)
+                              : IGen::fmadd231_vf(dst, src1, src2),
+                   irec);
+  } else if (dst == src1) {
+    gen->add_instr(m_subtract ? IGen::fnmadd213_vf(dst, src2, acc)
+                              : IGen::fmadd213_vf(dst, src2, acc),
+                   irec);
+  } else if (dst == src2) {
+    gen->add_instr(m_subtract ? IGen::fnmadd213_vf(dst, src1, acc)
+                              : IGen::fmadd213_vf(dst, src1, acc),
+                   irec);
+  } else {
+    gen->add_instr(IGen::mov_vf_vf(dst, acc), irec);
+    gen->add_instr(m_subtract ? IGen::fnmadd231_vf(dst, src1, src2)
+                              : IGen::fmadd231_vf(dst, src1, src2),
+                   irec);
+  }
+}
+
 ///////////////////////
 // IR_Int128Math3Asm
 ///////////////////////
@@ -20,6 +20,15 @@ class IR {
     (void)constraints;
     (void)my_id;
   }
+  // can this be removed if nothing reads the registers it writes? (no other side effects)
+  virtual bool removable_if_unused() const { return false; }
+  // replace reads of old_val with new_val, only in operands that are not also written.
+  // returns true if anything was replaced.
+  virtual bool replace_read(const RegVal* old_val, RegVal* new_val) {
+    (void)old_val;
+    (void)new_val;
+    return false;
+  }
   virtual ~IR() = default;
 };
 
@@ -32,6 +41,7 @@ class IR_Return : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
   const RegVal* value() { return m_value; }
 
  protected:
@@ -48,6 +58,7 @@ class IR_LoadConstant64 : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -62,6 +73,7 @@ class IR_LoadSymbolPointer : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -76,6 +88,7 @@ class IR_SetSymbolValue : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
 
  protected:
   const SymbolVal* m_dest = nullptr;
@@ -90,6 +103,7 @@ class IR_GetSymbolValue : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -105,6 +119,10 @@ class IR_RegSet : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
+  const RegVal* dest() const { return m_dest; }
+  const RegVal* src() const { return m_src; }
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -155,6 +173,7 @@ class IR_StaticVarAddr : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -169,6 +188,7 @@ class IR_StaticVarLoad : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -183,6 +203,7 @@ class IR_FunctionAddr : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  protected:
   const RegVal* m_dest = nullptr;
@@ -219,6 +240,8 @@ class IR_IntegerMath : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
   IntegerMathKind get_kind() const { return m_kind; }
 
  protected:
@@ -238,6 +261,8 @@ class IR_FloatMath : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
   FloatMathKind get_kind() const { return m_kind; }
 
  protected:
@@ -268,6 +293,11 @@ class IR_GotoLabel : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  const Label* dest() const { return m_dest; }
+  void retarget(const Label* dest) {
+    ASSERT(m_resolved);
+    m_dest = dest;
+  }
 
  protected:
   const Label* m_dest = nullptr;
@@ -282,6 +312,7 @@ class IR_ConditionalBranch : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
   void mark_as_resolved() { m_resolved = true; }
 
   Condition condition;
@@ -322,6 +353,8 @@ class IR_FloatToInt : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
 
  private:
   const RegVal* m_dest = nullptr;
@@ -336,6 +369,8 @@ class IR_IntToFloat : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
 
  private:
   const RegVal* m_dest = nullptr;
@@ -350,6 +385,7 @@ class IR_GetStackAddr : public IR {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool removable_if_unused() const override;
 
  private:
   const RegVal* m_dest = nullptr;
@@ -370,6 +406,7 @@ class IR_Asm : public IR {
  public:
   explicit IR_Asm(bool use_coloring);
   std::string get_color_suffix_string();
+  bool use_coloring() const { return m_use_coloring; }
 
  protected:
   bool m_use_coloring;
@@ -387,6 +424,7 @@ class IR_LoadConstOffset : public IR_Asm {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
 
  private:
   const RegVal* m_dest = nullptr;
@@ -407,6 +445,7 @@ class IR_StoreConstOffset : public IR_Asm {
   void do_codegen(emitter::ObjectGenerator* gen,
                   const AllocationResult& allocs,
                   emitter::IR_Record irec) override;
+  bool replace_read(const RegVal* old_val, RegVal* new_val) override;
 
  private:
   const RegVal* m_value = nullptr;
@@ -562,6 +601,31 @@ class IR_VFMath3Asm : public IR_Asm {
   Kind m_kind;
 };
 
+/*!
+ * dst = acc + src1 * src2 (or acc - src1 * src2) as a single fused multiply-add. Requires FMA.
+ */
+class IR_VFMulAddAsm : public IR_Asm {
+ public:
+  IR_VFMulAddAsm(bool use_color,
+                 const RegVal* dst,
+                 const RegVal* acc,
+                 const RegVal* src1,
+                 const RegVal* src2,
+                 bool subtract);
+  std::string print() override;
+  RegAllocInstr to_rai() override;
+  void do_codegen(emitter::ObjectGenerator* gen,
+                  const AllocationResult& allocs,
+                  emitter::IR_Record irec) override;
+
+ protected:
+  const RegVal* m_dst = nullptr;
+  const RegVal* m_acc = nullptr;
+  const RegVal* m_src1 = nullptr;
+  const RegVal* m_src2 = nullptr;
+  bool m_subtract = false;
+};
+
 class IR_Int128Math3Asm : public IR_Asm {
  public:
   // these are MIPS names, not x86 names.
@@ -0,0 +1,293 @@
+/*!
+ * @file IROptimizer.cpp
+ * Optional cleanup passes over a function's IR, run before register allocation.
+ *
+ * The compiler emits IR for each form without looking at what was emitted before it, so functions
+ * end up with moves into temporaries that are only read once, results that are never used, and
+ * jumps to the next instruction or to another jump. The passes here are:
+ *  - jump threading, and removing jumps to the next instruction
+ *  - removing unreachable instructions
+ *  - copy propagation within a basic block
+ *  - removing instructions that only write variables which are never read
+ *
+ * Removed instructions are replaced with IR_Null, so the instruction indices used by labels and
+ * register constraints stay valid. Constraints on a removed instruction are dropped with it.
+ * Variables with register constraints, rlet variables and variables forced onto the stack are left
+ * alone.
+ */
+
+#include "IROptimizer.h"
+
+#include "Env.h"
+#include "IR.h"
+
+#include "goalc/regalloc/allocator_interface.h"
+
+namespace {
+
+struct FunctionInfo {
+  FunctionEnv* env = nullptr;
+  // per var, false if the var is constrained to a register or needs to be on the stack.
+  std::vector<bool> can_optimize_var;
+
+  bool can_optimize(int var) const { return can_optimize_var.at(var); }
+  const auto& code() const { return env->code(); }
+};
+
+FunctionInfo make_function_info(FunctionEnv* env) {
+  FunctionInfo info;
+  info.env = env;
+  info.can_optimize_var.resize(env->max_vars(), true);
+  for (auto& reg_val : env->reg_vals()) {
+    if (reg_val->forced_on_stack() || reg_val->rlet_constraint()) {
+      info.can_optimize_var.at(reg_val->ireg().id) = false;
+    }
+  }
+  for (auto& constraint : env->constraints()) {
+    info.can_optimize_var.at(constraint.ireg.id) = false;
+  }
+  return info;
+}
+
+AllocationInput make_input(const FunctionInfo& info) {
+  AllocationInput input;
+  for (auto& ir : info.code()) {
+    input.instructions.push_back(ir->to_rai());
+  }
+  input.max_vars = info.env->max_vars();
+  return input;
+}
+
+/*!
+ * The same liveness analysis as the register allocator. Returns the vars that are live out of each
+ * instruction.
+ */
+std::vector<IRegSet> find_live_out(const AllocationInput& input, ControlFlowAnalysisCache* cfa) {
+  for (auto& block : cfa->basic_blocks) {
+    block.live.resize(block.instr_idx.size());
+    block.dead.resize(block.instr_idx.size());
+    block.analyze_liveliness_phase1(input.instructions);
+  }
+
+  bool changed = false;
+  do {
+    changed = false;
+    for (auto& block : cfa->basic_blocks) {
+      if (block.analyze_liveliness_phase2(cfa->basic_blocks, input.instructions)) {
+        changed = true;
+      }
+    }
+  } while (changed);
+
+  for (auto& block : cfa->basic_blocks) {
+    block.analyze_liveliness_phase3(cfa->basic_blocks, input.instructions);
+  }
+
+  std::vector<IRegSet> result(input.instructions.size());
+  for (auto& block : cfa->basic_blocks) {
+    for (size_t i = 0; i < block.instr_idx.size(); i++) {
+      result.at(block.instr_idx[i]) = block.live.at(i);
+    }
+  }
+  return result;
+}
+
+bool is_null(const IR* ir) {
+  return dynamic_cast<const IR_Null*>(ir);
+}
+
+/*!
+ * The index of the first instruction at or after idx that actually does something.
+ */
+int skip_nulls(const FunctionInfo& info, int idx) {
+  while (idx < (int)info.code().size() && is_null(info.code()[idx].get())) {
+    idx++;
+  }
+  return idx;
+}
+
+/*!
+ * Follow a jump destination through any unconditional jumps it lands on.
+ */
+const Label* final_destination(const FunctionInfo& info, const Label* label) {
+  // jumps may form a loop, so give up after a while.
+  for (int i = 0; i < 16; i++) {
+    int idx = skip_nulls(info, label->idx);
+    if (idx >= (int)info.code().size()) {
+      break;
+    }
+    auto* next_goto = dynamic_cast<const IR_GotoLabel*>(info.code()[idx].get());
+    if (!next_goto || next_goto->dest() == label) {
+      break;
+    }
+    label = next_goto->dest();
+  }
+  return label;
+}
+
+void simplify_branches(FunctionInfo& info, IROptimizerStats* stats) {
+  for (int i = 0; i < (int)info.code().size(); i++) {
+    const Label* dest = nullptr;
+    auto* ir = info.code()[i].get();
+    if (auto* goto_ir = dynamic_cast<IR_GotoLabel*>(ir)) {
+      dest = final_destination(info, goto_ir->dest());
+      if (dest != goto_ir->dest()) {
+        goto_ir->retarget(dest);
+        stats->threaded_jumps++;
+      }
+    } else if (auto* branch = dynamic_cast<IR_ConditionalBranch*>(ir)) {
+      dest = final_destination(info, &branch->label);
+      if (dest != &branch->label) {
+        branch->label = *dest;
+        stats->threaded_jumps++;
+      }
+    } else {
+      continue;
+    }
+
+    // jumping to the instruction we'd fall through to anyway. The condition of a branch has no
+    // side effects, so these can go too.
+    if (skip_nulls(info, dest->idx) == skip_nulls(info, i + 1)) {
+      info.env->remove_ir(i);
+      stats->removed_instructions++;
+    }
+  }
+}
+
+void remove_unreachable(FunctionInfo& info, IROptimizerStats* stats) {
+  auto input = make_input(info);
+  ControlFlowAnalysisCache cfa;
+  find_basic_blocks(&cfa, input);
+  if (cfa.basic_blocks.empty()) {
+    return;
+  }
+
+  std::vector<bool> reachable(cfa.basic_blocks.size(), false);
+  std::vector<int> to_visit = {0};
+  reachable.at(0) = true;
+  while (!to_visit.empty()) {
+    int block_idx = to_visit.back();
+    to_visit.pop_back();
+    for (auto succ : cfa.basic_blocks.at(block_idx).succ) {
+      if (succ >= 0 && !reachable.at(succ)) {
+        reachable.at(succ) = true;
+        to_visit.push_back(succ);
+      }
+    }
+  }
+
+  for (size_t block_idx = 0; block_idx < cfa.basic_blocks.size(); block_idx++) {
+    if (reachable[block_idx]) {
+      continue;
+    }
+    for (auto instr_idx : cfa.basic_blocks[block_idx].instr_idx) {
+      if (!is_null(info.code()[instr_idx].get())) {
+        info.env->remove_ir(instr_idx);
+        stats->removed_instructions++;
+      }
+    }
+  }
+}
+
+/*!
+ * After a move from src to dst, later reads of dst in the same basic block can read src instead,
+ * until either one is written. If all reads get replaced, the move becomes dead.
+ */
+bool propagate_copies(FunctionInfo& info, IROptimizerStats* stats) {
+  auto input = make_input(info);
+  ControlFlowAnalysisCache cfa;
+  find_basic_blocks(&cfa, input);
+
+  bool changed = false;
+  for (auto& block : cfa.basic_blocks) {
+    for (size_t i = 0; i < block.instr_idx.size(); i++) {
+      auto* move = dynamic_cast<IR_RegSet*>(info.code().at(block.instr_idx[i]).get());
+      if (!move) {
+        continue;
+      }
+      auto dst = move->dest()->ireg();
+      auto src = move->src()->ireg();
+      if (dst.id == src.id || dst.reg_class != src.reg_class || !info.can_optimize(dst.id) ||
+          !info.can_optimize(src.id)) {
+        continue;
+      }
+      RegVal* src_val = info.env->reg_vals().at(src.id).get();
+      ASSERT(src_val->ireg().id == src.id);
+
+      for (size_t j = i + 1; j < block.instr_idx.size(); j++) {
+        int instr_idx = block.instr_idx[j];
+        auto& ir = info.code().at(instr_idx);
+        // reads happen before writes, so the instruction that overwrites either can still read.
+        auto& rai = input.instructions.at(instr_idx);
+        if (rai.reads(dst.id) && ir->replace_read(move->dest(), src_val)) {
+          rai = ir->to_rai();
+          stats->propagated_copies++;
+          changed = true;
+        }
+        if (rai.writes(dst.id) || rai.writes(src.id)) {
+          break;
+        }
+      }
+    }
+  }
+  return changed;
+}
+
+bool remove_dead_code(FunctionInfo& info, IROptimizerStats* stats) {
+  auto input = make_input(info);
+  ControlFlowAnalysisCache cfa;
+  find_basic_blocks(&cfa, input);
+  auto live_out = find_live_out(input, &cfa);
+
+  bool changed = false;
+  for (int i = 0; i < (int)info.code().size(); i++) {
+    auto& rai = input.instructions[i];
+    if (rai.write.empty() || !info.code()[i]->removable_if_unused()) {
+      continue;
+    }
+    bool used = false;
+    for (auto& wr : rai.write) {
+      if (!info.can_optimize(wr.id) || live_out[i][wr.id]) {
+        used = true;
+        break;
+      }
+    }
+    if (!used) {
+      info.env->remove_ir(i);
+      stats->removed_instructions++;
+      changed = true;
+    }
+  }
+  return changed;
+}
+}  // namespace
+
+IROptimizerStats optimize_ir(FunctionEnv* env) {
+  IROptimizerStats stats;
+  if (env->is_asm_func || env->code().empty()) {
+    return stats;
+  }
+
+  for (auto& ir : env->code()) {
+    // assembly without coloring uses registers that don't show up in to_rai, and the destination
+    // of a jump through a register is unknown.
+    auto* asm_ir = dynamic_cast<const IR_Asm*>(ir.get());
+    if ((asm_ir && !asm_ir->use_coloring()) || dynamic_cast<const IR_JumpReg*>(ir.get())) {
+      return stats;
+    }
+  }
+
+  auto info = make_function_info(env);
+  simplify_branches(info, &stats);
+  remove_unreachable(info, &stats);
+
+  // each pass can create more work for the other.
+  for (int i = 0; i < 8; i++) {
+    bool changed = propagate_copies(info, &stats);
+    changed |= remove_dead_code(info, &stats);
+    if (!changed) {
+      break;
+    }
+  }
+  return stats;
+}
@@ -0,0 +1,16 @@
+/*!
+ * @file IROptimizer.h
+ * Optional cleanup passes over a function's IR, run before register allocation.
+ */
+
+#pragma once
+
+class FunctionEnv;
+
+struct IROptimizerStats {
+  int removed_instructions = 0;  // instructions replaced with IR_Null
+  int propagated_copies = 0;     // reads changed to use the source of a move instead
+  int threaded_jumps = 0;        // jumps retargeted to skip over another jump
+};
+
+IROptimizerStats optimize_ir(FunctionEnv* env);
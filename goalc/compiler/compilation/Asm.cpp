@@ -1001,6 +1001,26 @@ Val* Compiler::compile_asm_vf_math4_two_operation(const goos::Object& form,
   // First we clear a temporary register
   auto temp_reg = env->make_vfr(dest->type());
 
+  // a multiply followed by an add or subtract of the product can be done as a single fused
+  // multiply-add.
+  if (m_settings.use_fma && first_op_kind == IR_VFMath3Asm::Kind::MUL &&
+      (second_op_kind == IR_VFMath3Asm::Kind::ADD || second_op_kind == IR_VFMath3Asm::Kind::SUB)) {
+    bool subtract = second_op_kind == IR_VFMath3Asm::Kind::SUB;
+    auto mul_src = src2;
+    if (broadcastElement != emitter::Register::VF_ELEMENT::NONE) {
+      env->emit_ir<IR_SplatVF>(form, color, temp_reg, src2, broadcastElement);
+      mul_src = temp_reg;
+    }
+
+    if (mask == 0b1111) {
+      env->emit_ir<IR_VFMulAddAsm>(form, color, dest, src3, src1, mul_src, subtract);
+    } else {
+      env->emit_ir<IR_VFMulAddAsm>(form, color, temp_reg, src3, src1, mul_src, subtract);
+      env->emit_ir<IR_BlendVF>(form, color, dest, dest, temp_reg, mask);
+    }
+    return get_none();
+  }
+
   // If there is a broadcast register, splat that float across the entire src2 register before
   // performing the operation For example vaddx.xyzw vf10, vf20, vf30
   // vf10[x] = vf20[x] + vf30[x]
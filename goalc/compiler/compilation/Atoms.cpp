@@ -151,6 +151,7 @@ const std::unordered_map<std::string, GoalCompilerForm> g_goal_forms = {
     {"gs", {.form_function = &Compiler::compile_gs}},
     {":exit", {.form_function = &Compiler::compile_exit}},
     {"asm-file", {.form_function = &Compiler::compile_asm_file}},
+    {"hot-patch", {.form_function = &Compiler::compile_hot_patch}},
     {"asm-data-file", {.form_function = &Compiler::compile_asm_data_file}},
     {"asm-text-file", {.form_function = &Compiler::compile_asm_text_file}},
     {"listen-to-target", {.form_function = &Compiler::compile_listen_to_target}},
@@ -196,6 +197,9 @@ const std::unordered_map<std::string, GoalCompilerForm> g_goal_forms = {
     {":break", {.form_function = &Compiler::compile_break}},
     {":dump-all-mem", {.form_function = &Compiler::compile_dump_all}},
     {":pm", {.form_function = &Compiler::compile_pm}},
+    {":mem-snapshot", {.form_function = &Compiler::compile_mem_snapshot}},
+    {":mem-diff", {.form_function = &Compiler::compile_mem_diff}},
+    {":prof", {.form_function = &Compiler::compile_prof}},
     {":di", {.form_function = &Compiler::compile_di}},
     {":disasm", {.form_function = &Compiler::compile_disasm}},
     {":bp", {.form_function = &Compiler::compile_bp}},
@@ -522,12 +526,9 @@ Val* Compiler::compile_string(const goos::Object& form, Env* env) {
  * Compile a string constant and place it in the given segment.
  */
 Val* Compiler::compile_string(const std::string& str, Env* env, int seg) {
-  auto obj = std::make_unique<StaticString>(str, seg);
+  auto obj = env->file_env()->get_string_constant(str, seg);
   auto fe = env->function_env();
-  auto result = fe->alloc_val<StaticVal>(obj.get(), m_ts.make_typespec("string"));
-  auto fie = env->file_env();
-  fie->add_static(std::move(obj));
-  return result;
+  return fe->alloc_val<StaticVal>(obj, m_ts.make_typespec("string"));
 }
 
 /*!
@@ -548,12 +549,9 @@ Val* Compiler::compile_float(const goos::Object& code, Env* env) {
  * of the code, at least in Jak 1.
  */
 Val* Compiler::compile_float(float value, Env* env, int seg) {
-  auto obj = std::make_unique<StaticFloat>(value, seg);
+  auto obj = env->file_env()->get_float_constant(value, seg);
   auto fe = env->function_env();
-  auto result = fe->alloc_val<FloatConstantVal>(m_ts.make_typespec("float"), obj.get());
-  auto fie = env->file_env();
-  fie->add_static(std::move(obj));
-  return result;
+  return fe->alloc_val<FloatConstantVal>(m_ts.make_typespec("float"), obj);
 }
 
 Val* Compiler::compile_pointer_add(const goos::Object& form, const goos::Object& rest, Env* env) {
@@ -181,6 +181,29 @@ Val* Compiler::compile_asm_file(const goos::Object& form, const goos::Object& re
   return get_none();
 }
 
+/*!
+ * Recompile one function or method from a file and replace it in the target, without reloading
+ * the file. (hot-patch "file.gc" name [:type type-name])
+ */
+Val* Compiler::compile_hot_patch(const goos::Object& form, const goos::Object& rest, Env* env) {
+  (void)env;
+  auto args = get_va(form, rest);
+  va_check(form, args, {goos::ObjectType::STRING, goos::ObjectType::SYMBOL},
+           {{"type", {false, {goos::ObjectType::SYMBOL}}}});
+  std::optional<std::string> method_type;
+  if (args.has_named("type")) {
+    method_type = symbol_string(args.get_named("type"));
+  }
+
+  try {
+    hot_patch(args.unnamed.at(0).as_string()->data, symbol_string(args.unnamed.at(1)),
+              method_type);
+  } catch (std::runtime_error& e) {
+    throw_compiler_error(form, "Error while patching: {}", e.what());
+  }
+  return get_none();
+}
+
 /*!
  * Simple help / documentation command
  */
@@ -617,6 +640,11 @@ std::vector<symbol_info::SymbolInfo*> Compiler::lookup_symbol_info_by_prefix(
   return m_symbol_info.lookup_symbols_starting_with(prefix);
 }
 
+std::vector<symbol_info::SymbolInfo*> Compiler::lookup_symbol_info_fuzzy(const std::string& query,
+                                                                         int max_count) const {
+  return m_symbol_info.lookup_symbols_fuzzy(query, max_count);
+}
+
 std::set<std::string> Compiler::lookup_symbol_names_starting_with(const std::string& prefix,
                                                                   int max_count) const {
   if (m_goos.reader.check_string_is_valid(prefix)) {
@@ -825,7 +853,9 @@ Val* Compiler::compile_make(const goos::Object& form, const goos::Object& rest,
   va_check(form, args, {goos::ObjectType::STRING},
            {{"force", {false, {goos::ObjectType::SYMBOL}}},
             {"verbose", {false, {goos::ObjectType::SYMBOL}}},
-            {"report", {false, {goos::ObjectType::SYMBOL}}}});
+            {"report", {false, {goos::ObjectType::SYMBOL}}},
+            {"profile", {false, {goos::ObjectType::SYMBOL}}},
+            {"jobs", {false, {goos::ObjectType::INTEGER}}}});
   bool force = false;
   if (args.has_named("force")) {
     force = get_true_or_false(form, args.get_named("force"));
@@ -841,7 +871,28 @@ Val* Compiler::compile_make(const goos::Object& form, const goos::Object& rest,
     report = get_true_or_false(form, args.get_named("report"));
   }
 
-  m_make.make(args.unnamed.at(0).as_string()->data, force, verbose, report);
+  bool profile = false;
+  if (args.has_named("profile")) {
+    profile = get_true_or_false(form, args.get_named("profile"));
+  }
+
+  std::optional<int> jobs;
+  if (args.has_named("jobs")) {
+    jobs = args.get_named("jobs").as_int();
+  }
+
+  if (profile) {
+    m_compile_profiler.start();
+  }
+  bool ok = m_make.make(args.unnamed.at(0).as_string()->data, force, verbose, report, jobs);
+  if (profile) {
+    m_compile_profiler.finish(file_util::get_jak_project_dir() / "goalc-profile.json", 20);
+  }
+  if (ok) {
+    save_type_snapshot();
+  } else {
+    m_last_repl_error = fmt::format("make of {} failed", args.unnamed.at(0).as_string()->data);
+  }
   return get_none();
 }
 
@@ -856,6 +907,8 @@ Val* Compiler::compile_print_debug_compiler_stats(const goos::Object& form,
   lg::print("Eliminated moves: {}\n", m_debug_stats.num_moves_eliminated);
   lg::print("Total functions: {}\n", m_debug_stats.total_funcs);
   lg::print("Functions requiring v1: {}\n", m_debug_stats.funcs_requiring_v1_allocator);
+  lg::print("IR removed by optimizer: {}\n", m_debug_stats.ir_removed);
+  lg::print("IR copies propagated: {}\n", m_debug_stats.ir_copies_propagated);
   lg::print("Size of autocomplete prefix tree: {}\n", m_symbol_info.symbol_count());
 
   return get_none();
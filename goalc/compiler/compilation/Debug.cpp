@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <unordered_set>
+
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
 
@@ -181,6 +184,142 @@ Val* Compiler::compile_dump_all(const goos::Object& form, const goos::Object& re
   return get_none();
 }
 
+/*!
+ * Take a snapshot of EE memory to diff against with :mem-diff.
+ * (:mem-snapshot) takes all of EE memory, (:mem-snapshot addr size) takes a range.
+ */
+Val* Compiler::compile_mem_snapshot(const goos::Object& form,
+                                    const goos::Object& rest,
+                                    Env* env) {
+  (void)env;
+  auto args = get_va(form, rest);
+  if (!args.named.empty()) {
+    throw_compiler_error(form, ":mem-snapshot doesn't take named arguments.");
+  }
+  if (!m_debugger.is_valid() || !m_debugger.is_attached()) {
+    throw_compiler_error(form, "Cannot take a memory snapshot, the debugger must be attached.");
+  }
+
+  u32 addr = EE_MAIN_MEM_LOW_PROTECT;
+  u32 size = EE_MAIN_MEM_SIZE - EE_MAIN_MEM_LOW_PROTECT;
+  if (args.unnamed.size() == 2) {
+    addr = parse_address_spec(args.unnamed.at(0));
+    size = args.unnamed.at(1).as_int();
+  } else if (!args.unnamed.empty()) {
+    throw_compiler_error(form, ":mem-snapshot takes either no arguments or an address and size.");
+  }
+
+  if (!m_debugger.take_memory_snapshot(addr, size)) {
+    lg::print("Failed to take memory snapshot.\n");
+  } else {
+    lg::print("Took snapshot of 0x{:x} bytes at 0x{:x}.\n", size, addr);
+  }
+  return get_none();
+}
+
+/*!
+ * Print the memory that changed since the last :mem-snapshot or :mem-diff.
+ * The :limit argument sets how many changed ranges are printed.
+ */
+Val* Compiler::compile_mem_diff(const goos::Object& form, const goos::Object& rest, Env* env) {
+  (void)env;
+  auto args = get_va(form, rest);
+  va_check(form, args, {}, {{"limit", {false, goos::ObjectType::INTEGER}}});
+  if (!m_debugger.is_valid() || !m_debugger.is_attached()) {
+    throw_compiler_error(form, "Cannot diff memory, the debugger must be attached.");
+  }
+  int limit = 50;
+  if (args.has_named("limit")) {
+    limit = args.get_named("limit").as_int();
+  }
+
+  Debugger::MemoryDiff diff;
+  if (!m_debugger.diff_memory_snapshot(&diff)) {
+    lg::print("Failed to diff memory. Use :mem-snapshot first.\n");
+    return get_none();
+  }
+
+  u32 total_bytes = 0;
+  for (auto& [start, size] : diff.changed) {
+    total_bytes += size;
+  }
+  lg::print("{} bytes changed in {} ranges, read {} of {} pages.\n", total_bytes,
+            diff.changed.size(), diff.pages_read, diff.pages_total);
+  for (int i = 0; i < std::min((int)diff.changed.size(), limit); i++) {
+    auto& [start, size] = diff.changed[i];
+    lg::print("  0x{:08x} {:>8} bytes\n", start, size);
+  }
+  if ((int)diff.changed.size() > limit) {
+    lg::print("  ...and {} more\n", diff.changed.size() - limit);
+  }
+  return get_none();
+}
+
+/*!
+ * Sample the call stacks of the running game, and write them in the collapsed format that
+ * flamegraph.pl and speedscope read: (:prof "out/prof.txt" :seconds 5 :hz 1000)
+ * Prints the functions with the most samples.
+ */
+Val* Compiler::compile_prof(const goos::Object& form, const goos::Object& rest, Env* env) {
+  (void)env;
+  auto args = get_va(form, rest);
+  va_check(form, args, {{goos::ObjectType::STRING}},
+           {{"seconds", {false, goos::ObjectType::INTEGER}},
+            {"hz", {false, goos::ObjectType::INTEGER}},
+            {"limit", {false, goos::ObjectType::INTEGER}}});
+  if (!m_debugger.is_valid() || !m_debugger.is_attached() || !m_debugger.is_running()) {
+    throw_compiler_error(form, "Cannot profile, the debugger must be attached and running.");
+  }
+  auto dest_file = args.unnamed.at(0).as_string()->data;
+  int seconds = args.has_named("seconds") ? args.get_named("seconds").as_int() : 5;
+  int hz = args.has_named("hz") ? args.get_named("hz").as_int() : 1000;
+  int limit = args.has_named("limit") ? args.get_named("limit").as_int() : 30;
+  if (hz < 1 || hz > 10000 || seconds < 1) {
+    throw_compiler_error(form, ":prof needs a rate of 1 to 10000 hz and at least 1 second.");
+  }
+
+  lg::print("Profiling for {} s at {} Hz...\n", seconds, hz);
+  Debugger::ProfileResult result;
+  if (!m_debugger.profile(hz, seconds * 1000, &result)) {
+    lg::print("Profiling stopped early.\n");
+  }
+
+  std::string collapsed;
+  std::unordered_map<std::string, int> self_samples, total_samples;
+  for (auto& [stack, count] : result.stacks) {
+    collapsed += fmt::format("{} {}\n", stack, count);
+    auto leaf = stack.substr(stack.rfind(';') + 1);
+    self_samples[leaf] += count;
+    // count each function once per stack, even if it's recursive.
+    std::unordered_set<std::string> seen;
+    size_t start = 0;
+    while (start <= stack.size()) {
+      auto end = std::min(stack.find(';', start), stack.size());
+      auto name = stack.substr(start, end - start);
+      if (seen.insert(name).second) {
+        total_samples[name] += count;
+      }
+      start = end + 1;
+    }
+  }
+  file_util::write_text_file(file_util::get_file_path({dest_file}), collapsed);
+
+  lg::print("{} samples ({} failed), pause avg {:.1f} us, max {:.1f} us. Wrote {}\n",
+            result.samples, result.failed_samples, result.avg_pause_us, result.max_pause_us,
+            dest_file);
+  std::vector<std::pair<std::string, int>> sorted(self_samples.begin(), self_samples.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.second > b.second; });
+  int total = std::max(result.samples, 1);
+  lg::print("   self  total  function\n");
+  for (int i = 0; i < std::min((int)sorted.size(), limit); i++) {
+    auto& [name, count] = sorted[i];
+    lg::print(" {:5.1f}% {:5.1f}%  {}\n", 100.f * count / total,
+              100.f * total_samples[name] / total, name);
+  }
+  return get_none();
+}
+
 namespace {
 
 enum class PrintMode { HEX, UNSIGNED_DEC, SIGNED_DEC, FLOAT };
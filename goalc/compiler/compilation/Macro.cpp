@@ -56,7 +56,12 @@ Val* Compiler::compile_goos_macro(const goos::Object& o,
   auto mac_env = mac_env_obj.as_env_ptr();
   mac_env->parent_env = m_goos.global_environment.as_env_ptr();
   m_goos.set_args_in_env(o, args, macro->args, mac_env);
+  u64 expand_start_ns = m_compile_profiler.enabled() ? CompileProfiler::now_ns() : 0;
   auto goos_result = m_goos.eval_list_return_last(macro->body, macro->body, mac_env);
+  if (m_compile_profiler.enabled()) {
+    m_compile_profiler.add_macro(name.as_symbol().name_ptr,
+                                 CompileProfiler::now_ns() - expand_start_ns);
+  }
   // make the macro expanded form point to the source where the macro was used for error messages.
   // m_goos.reader.db.inherit_info(o, goos_result);
 
@@ -661,11 +661,8 @@ StaticResult Compiler::compile_static_no_eval_for_pairs(const goos::Object& form
   } else if (form.is_empty_list()) {
     return StaticResult::make_symbol("_empty_");
   } else if (form.is_string()) {
-    // todo - this should eventually work with a string pool
-    auto obj = std::make_unique<StaticString>(form.as_string()->data, seg);
-    auto result = StaticResult::make_structure_reference(obj.get(), m_ts.make_typespec("string"));
-    fie->add_static(std::move(obj));
-    return result;
+    auto obj = fie->get_string_constant(form.as_string()->data, seg);
+    return StaticResult::make_structure_reference(obj, m_ts.make_typespec("string"));
   } else {
     throw_compiler_error(form, "Cannot put the following form in a static pair: {}", form.print());
     return {};
@@ -716,11 +713,8 @@ StaticResult Compiler::compile_static(const goos::Object& form_before_macro, Env
   } else if (is_quoted_sym(form)) {
     return StaticResult::make_symbol(unquote(form).as_symbol().name_ptr);
   } else if (form.is_string()) {
-    // todo string pool
-    auto obj = std::make_unique<StaticString>(form.as_string()->data, segment);
-    auto result = StaticResult::make_structure_reference(obj.get(), m_ts.make_typespec("string"));
-    fie->add_static(std::move(obj));
-    return result;
+    auto obj = fie->get_string_constant(form.as_string()->data, segment);
+    return StaticResult::make_structure_reference(obj, m_ts.make_typespec("string"));
   } else if (form.is_pair()) {
     auto first = form.as_pair()->car;
     auto rest = form.as_pair()->cdr;
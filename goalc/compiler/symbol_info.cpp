@@ -1,5 +1,7 @@
 #include "symbol_info.h"
 
+#include <algorithm>
+
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
 #include "common/util/string_util.h"
@@ -76,7 +78,7 @@ void SymbolInfoMap::add_global(const std::string& name,
       .m_type = type,
   };
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -85,7 +87,7 @@ void SymbolInfoMap::add_global(const std::string& name,
 void SymbolInfoMap::add_fwd_dec(const std::string& name, const goos::Object& defining_form) {
   SymbolInfo info = {.m_kind = Kind::FWD_DECLARED_SYM, .m_name = name, .m_def_form = defining_form};
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -112,7 +114,7 @@ void SymbolInfoMap::add_function(const std::string& name,
   }
   info.update_args_from_docstring();
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -171,7 +173,7 @@ void SymbolInfoMap::add_type(const std::string& name,
     info.m_type_states.push_back(type_state_info);
   }
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -189,7 +191,7 @@ void SymbolInfoMap::add_constant(const std::string& name,
       .m_type = "unknown",
   };
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -219,7 +221,7 @@ void SymbolInfoMap::add_macro(const std::string& name,
     info.m_variadic_arg = arg_spec.rest;
   }
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -232,7 +234,7 @@ void SymbolInfoMap::add_builtin(const std::string& name, const std::string& docs
       .m_docstring = docstring,
   };
   info.set_definition_location(m_textdb);
-  m_symbol_map.insert(name, info);
+  insert_symbol(name, info);
 }
 
 void SymbolInfoMap::add_method(const std::string& method_name,
@@ -258,7 +260,7 @@ void SymbolInfoMap::add_method(const std::string& method_name,
   }
   info.update_args_from_docstring();
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(method_name, info);
+  const auto inserted_symbol = insert_symbol(method_name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -281,7 +283,7 @@ void SymbolInfoMap::add_state(const std::string& name,
   // TODO - split up docstring into individual handlers
   // TODO - update args from docstring
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(name, info);
+  const auto inserted_symbol = insert_symbol(name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -296,7 +298,7 @@ void SymbolInfoMap::add_enum(EnumType* enum_info,
                      .m_docstring = docstring,
                      .m_enum_info = enum_info};
   info.set_definition_location(m_textdb);
-  const auto inserted_symbol = m_symbol_map.insert(info.m_name, info);
+  const auto inserted_symbol = insert_symbol(info.m_name, info);
   if (info.m_def_location) {
     add_symbol_to_file_index(info.m_def_location->file_path, inserted_symbol);
   }
@@ -309,13 +311,57 @@ std::vector<SymbolInfo*> SymbolInfoMap::lookup_symbols_by_file(const std::string
   return {};
 }
 
+SymbolInfo* SymbolInfoMap::insert_symbol(const std::string& name, const SymbolInfo& info) {
+  auto& symbols = m_symbol_map[name];
+  if (symbols.empty()) {
+    m_name_index_stale = true;
+  }
+  symbols.push_back(std::make_unique<SymbolInfo>(info));
+  m_symbol_count++;
+  return symbols.back().get();
+}
+
+const CompletionIndex& SymbolInfoMap::name_index() const {
+  if (m_name_index_stale) {
+    std::vector<std::string> names;
+    names.reserve(m_symbol_map.size());
+    for (const auto& [name, symbols] : m_symbol_map) {
+      names.push_back(name);
+    }
+    m_name_index = CompletionIndex(std::move(names));
+    m_name_index_stale = false;
+  }
+  return m_name_index;
+}
+
+std::vector<SymbolInfo*> SymbolInfoMap::symbols_with_names(
+    const std::vector<std::string>& names) const {
+  std::vector<SymbolInfo*> result;
+  for (const auto& name : names) {
+    auto it = m_symbol_map.find(name);
+    if (it != m_symbol_map.end()) {
+      for (const auto& symbol : it->second) {
+        result.push_back(symbol.get());
+      }
+    }
+  }
+  return result;
+}
+
 std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_name(const std::string& name) const {
-  return m_symbol_map.retrieve_with_exact(name);
+  std::vector<SymbolInfo*> result;
+  auto it = m_symbol_map.find(name);
+  if (it != m_symbol_map.end()) {
+    for (const auto& symbol : it->second) {
+      result.push_back(symbol.get());
+    }
+  }
+  return result;
 }
 
 std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_name(const std::string& name,
                                                           const Kind sym_kind) const {
-  const auto query_results = m_symbol_map.retrieve_with_exact(name);
+  const auto query_results = lookup_exact_name(name);
   std::vector<SymbolInfo*> filtered_results = {};
   for (const auto& result : query_results) {
     if (result->m_kind == sym_kind) {
@@ -328,7 +374,7 @@ std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_name(const std::string& nam
 std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_method_name(
     const std::string& name,
     const std::string& defining_type_name) const {
-  const auto query_results = m_symbol_map.retrieve_with_exact(name);
+  const auto query_results = lookup_exact_name(name);
   std::vector<SymbolInfo*> filtered_results = {};
   for (const auto& result : query_results) {
     if (result->m_kind == Kind::METHOD && result->m_method_info.type_name == defining_type_name) {
@@ -341,7 +387,7 @@ std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_method_name(
 std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_virtual_state_name(
     const std::string& name,
     const std::string& defining_type_name) const {
-  const auto query_results = m_symbol_map.retrieve_with_exact(name);
+  const auto query_results = lookup_exact_name(name);
   std::vector<SymbolInfo*> filtered_results = {};
   for (const auto& result : query_results) {
     if (result->m_kind == Kind::STATE && result->m_state_virtual &&
@@ -354,37 +400,47 @@ std::vector<SymbolInfo*> SymbolInfoMap::lookup_exact_virtual_state_name(
 
 std::vector<SymbolInfo*> SymbolInfoMap::lookup_symbols_starting_with(
     const std::string& prefix) const {
-  std::vector<SymbolInfo*> symbols;
-  const auto lookup = m_symbol_map.retrieve_with_prefix(prefix);
-  for (const auto& result : lookup) {
-    symbols.push_back(result);
-  }
-  return symbols;
+  return symbols_with_names(name_index().with_prefix(prefix));
 }
 
 std::vector<SymbolInfo*> SymbolInfoMap::get_all_symbols() const {
-  return m_symbol_map.get_all_elements();
+  return symbols_with_names(name_index().with_prefix(""));
 }
 
 std::set<std::string> SymbolInfoMap::lookup_names_starting_with(const std::string& prefix,
                                                                 int max_count) const {
-  std::set<std::string> names;
-  const auto lookup = m_symbol_map.retrieve_with_prefix(prefix, max_count);
-  for (const auto& result : lookup) {
-    names.insert(result->m_name);
-  }
-  return names;
+  const auto names = name_index().with_prefix(prefix, max_count);
+  return std::set<std::string>(names.begin(), names.end());
+}
+
+std::vector<SymbolInfo*> SymbolInfoMap::lookup_symbols_fuzzy(const std::string& query,
+                                                             int max_count) const {
+  return symbols_with_names(name_index().fuzzy(query, max_count));
 }
 
 int SymbolInfoMap::symbol_count() const {
-  return m_symbol_map.size();
+  return m_symbol_count;
 }
 
 void SymbolInfoMap::evict_symbols_using_file_index(const std::string& file_path) {
   const auto standardized_path = file_util::convert_to_unix_path_separators(file_path);
   if (m_file_symbol_index.find(standardized_path) != m_file_symbol_index.end()) {
     for (const auto& symbol : m_file_symbol_index.at(standardized_path)) {
-      m_symbol_map.remove(symbol->m_name, symbol);
+      auto it = m_symbol_map.find(symbol->m_name);
+      if (it == m_symbol_map.end()) {
+        continue;
+      }
+      auto& symbols = it->second;
+      auto to_remove = std::find_if(symbols.begin(), symbols.end(),
+                                    [&](const auto& other) { return other.get() == symbol; });
+      if (to_remove != symbols.end()) {
+        symbols.erase(to_remove);
+        m_symbol_count--;
+      }
+      if (symbols.empty()) {
+        m_symbol_map.erase(it);
+        m_name_index_stale = true;
+      }
     }
     m_file_symbol_index.erase(standardized_path);
   }
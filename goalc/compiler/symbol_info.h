@@ -1,12 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/goos/Object.h"
 #include "common/util/Assert.h"
-#include "common/util/trie_with_duplicates.h"
+#include "common/util/CompletionIndex.h"
 
 #include "goalc/compiler/Val.h"
 
@@ -122,18 +124,25 @@ struct SymbolInfo {
 };
 
 /*!
- * A map of symbol info. It internally stores the info in a prefix tree so you can quickly get
- * a list of all symbols starting with a given prefix.
+ * A map of symbol info. There can be several symbols with the same name (a method and a function,
+ * for example). Lookups by prefix or fuzzy match use a CompletionIndex of the names, which is
+ * rebuilt on the next lookup after symbols are added or removed.
  */
 class SymbolInfoMap {
   goos::TextDb* m_textdb;
-  TrieWithDuplicates<SymbolInfo> m_symbol_map;
+  std::unordered_map<std::string, std::vector<std::unique_ptr<SymbolInfo>>> m_symbol_map;
+  int m_symbol_count = 0;
+  mutable CompletionIndex m_name_index;
+  mutable bool m_name_index_stale = false;
   // Indexes references to symbols by the file they are defined within
   // This allows us to not only efficiently retrieve symbols by file, but also allows us to
   // cleanup symbols when files are re-compiled.
   std::unordered_map<std::string, std::vector<SymbolInfo*>> m_file_symbol_index;
 
   void add_symbol_to_file_index(const std::string& file_path, SymbolInfo* symbol);
+  SymbolInfo* insert_symbol(const std::string& name, const SymbolInfo& info);
+  const CompletionIndex& name_index() const;
+  std::vector<SymbolInfo*> symbols_with_names(const std::vector<std::string>& names) const;
 
  public:
   SymbolInfoMap(goos::TextDb* textdb) : m_textdb(textdb) {}
@@ -183,6 +192,8 @@ class SymbolInfoMap {
   std::vector<SymbolInfo*> lookup_symbols_starting_with(const std::string& prefix) const;
   std::set<std::string> lookup_names_starting_with(const std::string& prefix,
                                                    int max_count = -1) const;
+  // the symbols with the max_count best fuzzy matches to the query, best first.
+  std::vector<SymbolInfo*> lookup_symbols_fuzzy(const std::string& query, int max_count) const;
   std::vector<SymbolInfo*> get_all_symbols() const;
   int symbol_count() const;
   // Uses the per-file index to find and evict symbols globally
@@ -48,6 +48,19 @@ void push_better_variable_length_integer(u32 value, std::vector<u8>* vec) {
 }
 }  // namespace
 
+DataObjectGenerator::StringId DataObjectGenerator::intern(const std::string& str) {
+  auto [it, inserted] = m_string_ids.try_emplace(str, int(m_strings.size()));
+  if (inserted) {
+    m_strings.push_back(str);
+  }
+  return StringId{it->second};
+}
+
+void DataObjectGenerator::reserve(size_t words, size_t pointer_links) {
+  m_words.reserve(m_words.size() + words);
+  m_ptr_links.reserve(m_ptr_links.size() + pointer_links);
+}
+
 int DataObjectGenerator::add_word(u32 word) {
   auto result = int(m_words.size());
   m_words.push_back(word);
@@ -61,6 +74,15 @@ int DataObjectGenerator::add_word_float(float f) {
   return result;
 }
 
+int DataObjectGenerator::add_data(const void* data, size_t size_bytes) {
+  auto result = int(m_words.size());
+  m_words.resize(m_words.size() + (size_bytes + 3) / 4, 0);
+  if (size_bytes) {
+    memcpy(m_words.data() + result, data, size_bytes);
+  }
+  return result;
+}
+
 void DataObjectGenerator::set_word(u32 word_idx, u32 val) {
   m_words.at(word_idx) = val;
 }
@@ -76,32 +98,101 @@ void DataObjectGenerator::link_word_to_byte(int source_word, int target_byte) {
 }
 
 int DataObjectGenerator::add_ref_to_string_in_pool(const std::string& str) {
+  return add_ref_to_string_in_pool(intern(str));
+}
+
+int DataObjectGenerator::add_ref_to_string_in_pool(StringId str) {
   auto result = int(m_words.size());
   m_words.push_back(0);
-  m_string_pool[str].push_back(result);
+  m_string_pool.push_back({str.idx, result});
   return result;
 }
 
 void DataObjectGenerator::link_word_to_string_in_pool(const std::string& str, int word_idx) {
-  m_string_pool[str].push_back(word_idx);
+  link_word_to_string_in_pool(intern(str), word_idx);
+}
+
+void DataObjectGenerator::link_word_to_string_in_pool(StringId str, int word_idx) {
+  m_string_pool.push_back({str.idx, word_idx});
 }
 
 int DataObjectGenerator::add_type_tag(const std::string& str) {
+  return add_type_tag(intern(str));
+}
+
+int DataObjectGenerator::add_type_tag(StringId str) {
   auto result = int(m_words.size());
   m_words.push_back(0);
-  m_type_links[str].push_back(result);
+  m_type_links.push_back({str.idx, result});
   return result;
 }
 
 int DataObjectGenerator::add_symbol_link(const std::string& str) {
+  return add_symbol_link(intern(str));
+}
+
+int DataObjectGenerator::add_symbol_link(StringId str) {
   auto result = int(m_words.size());
   m_words.push_back(0);
-  m_symbol_links[str].push_back(result);
+  m_symbol_links.push_back({str.idx, result});
   return result;
 }
 
 void DataObjectGenerator::link_word_to_symbol(const std::string& str, int word_idx) {
-  m_symbol_links[str].push_back(word_idx);
+  link_word_to_symbol(intern(str), word_idx);
+}
+
+void DataObjectGenerator::link_word_to_symbol(StringId str, int word_idx) {
+  m_symbol_links.push_back({str.idx, word_idx});
+}
+
+/*!
+ * Order links alphabetically by string, then by word. The strings are sorted once, and the links
+ * are put in order with a counting sort. The words are usually added in order already.
+ */
+std::vector<DataObjectGenerator::StringLinkRecord> DataObjectGenerator::sort_by_string(
+    const std::vector<StringLinkRecord>& links) const {
+  // the strings that are used, in order.
+  std::vector<int> rank(m_strings.size(), -1);
+  std::vector<int> used;
+  for (const auto& link : links) {
+    if (rank[link.str] == -1) {
+      rank[link.str] = 0;
+      used.push_back(link.str);
+    }
+  }
+  std::sort(used.begin(), used.end(),
+            [&](int a, int b) { return m_strings[a] < m_strings[b]; });
+
+  // start of each string's links in the result
+  std::vector<int> starts(used.size() + 1, 0);
+  for (size_t i = 0; i < used.size(); i++) {
+    rank[used[i]] = i;
+  }
+  for (const auto& link : links) {
+    starts[rank[link.str] + 1]++;
+  }
+  for (size_t i = 0; i < used.size(); i++) {
+    starts[i + 1] += starts[i];
+  }
+
+  std::vector<StringLinkRecord> result(links.size());
+  std::vector<int> next(starts.begin(), starts.end() - 1);
+  for (const auto& link : links) {
+    result[next[rank[link.str]]++] = link;
+  }
+
+  const auto by_word = [](const StringLinkRecord& a, const StringLinkRecord& b) {
+    return a.word < b.word;
+  };
+  for (size_t i = 0; i < used.size(); i++) {
+    auto begin = result.begin() + starts[i];
+    auto end = result.begin() + starts[i + 1];
+    if (!std::is_sorted(begin, end, by_word)) {
+      std::sort(begin, end, by_word);
+    }
+  }
+  return result;
 }
 
 void DataObjectGenerator::align(int alignment_words) {
@@ -133,6 +224,7 @@ std::vector<u8> DataObjectGenerator::generate_v2() {
 
   // build
   std::vector<u8> result;
+  result.reserve(sizeof(LinkHeaderV2) + link.size() + m_words.size() * 4 + 16);
   add_data_to_vector(header, &result);
   result.insert(result.end(), link.begin(), link.end());
 
@@ -167,6 +259,8 @@ std::vector<u8> DataObjectGenerator::generate_v4() {
   second_header.length = first_header.length;
 
   std::vector<u8> result;
+  result.reserve(sizeof(LinkHeaderV4) + sizeof(LinkHeaderV2) + link.size() +
+                 m_words.size() * 4 + 16);
   add_data_to_vector(first_header, &result);
   auto start = result.size();
   result.resize(result.size() + m_words.size() * 4);
@@ -181,19 +275,23 @@ std::vector<u8> DataObjectGenerator::generate_v4() {
 
 std::vector<u8> DataObjectGenerator::generate_link_table() {
   std::vector<u8> link;
+  // roughly two bytes per pointer run, plus the names and a byte or two per symbol/type link
+  link.reserve(2 * m_ptr_links.size() + 2 * (m_symbol_links.size() + m_type_links.size()) + 64);
 
   // pointer links are in source order.
-  std::sort(m_ptr_links.begin(), m_ptr_links.end(),
-            [](const PointerLinkRecord& a, const PointerLinkRecord& b) {
-              return a.source_word < b.source_word;
-            });
+  const auto by_source = [](const PointerLinkRecord& a, const PointerLinkRecord& b) {
+    return a.source_word < b.source_word;
+  };
+  if (!std::is_sorted(m_ptr_links.begin(), m_ptr_links.end(), by_source)) {
+    std::sort(m_ptr_links.begin(), m_ptr_links.end(), by_source);
+  }
 
-  int i = 0;
+  size_t i = 0;
 
   u32 last_word = 0;
-  while (i < int(m_ptr_links.size())) {
+  while (i < m_ptr_links.size()) {
     // seeking
-    auto& entry = m_ptr_links.at(i);
+    auto& entry = m_ptr_links[i];
     int diff = int(entry.source_word) - int(last_word);
     last_word = entry.source_word + 1;
     ASSERT(diff >= 0);
@@ -202,16 +300,12 @@ std::vector<u8> DataObjectGenerator::generate_link_table() {
 
     // count.
     int consecutive = 1;
-    for (;;) {
-      if (i + 1 < int(m_ptr_links.size()) &&
-          m_ptr_links.at(i + 1).source_word == m_ptr_links.at(i).source_word + 1) {
-        m_words.at(m_ptr_links.at(i + 1).source_word) = m_ptr_links.at(i + 1).target_byte;
-        last_word = m_ptr_links.at(i + 1).source_word + 1;
-        consecutive++;
-        i++;
-      } else {
-        break;
-      }
+    while (i + 1 < m_ptr_links.size() &&
+           m_ptr_links[i + 1].source_word == m_ptr_links[i].source_word + 1) {
+      m_words[m_ptr_links[i + 1].source_word] = m_ptr_links[i + 1].target_byte;
+      last_word = m_ptr_links[i + 1].source_word + 1;
+      consecutive++;
+      i++;
     }
 
     push_variable_length_integer(consecutive, &link);
@@ -219,44 +313,30 @@ std::vector<u8> DataObjectGenerator::generate_link_table() {
   }
   push_variable_length_integer(0, &link);
 
-  for (auto& sl : m_symbol_links) {
-    // insert name. first char won't have the highest bit set
-    for (auto c : sl.first) {
-      link.push_back(c);
-    }
-    link.push_back(0);
-    std::sort(sl.second.begin(), sl.second.end());
-    int prev = 0;
-
-    for (auto& x : sl.second) {
-      int diff = x - prev;
-      ASSERT(diff >= 0);
-      push_better_variable_length_integer(diff * 4, &link);
-      m_words.at(x) = 0xffffffff;
-      prev = x;
-    }
-    link.push_back(0);
-  }
-
-  // types
-  for (auto& tl : m_type_links) {
-    link.push_back(0x80);
-    for (auto c : tl.first) {
-      link.push_back(c);
-    }
-    link.push_back(0);
-
-    std::sort(tl.second.begin(), tl.second.end());
-    int prev = 0;
-
-    for (auto& x : tl.second) {
-      int diff = x - prev;
-      ASSERT(diff >= 0);
-      push_better_variable_length_integer(diff * 4, &link);
-      m_words.at(x) = 0xffffffff;
-      prev = x;
+  // symbols, then types (which have the high bit set on the first char)
+  for (const auto* links : {&m_symbol_links, &m_type_links}) {
+    const auto sorted = sort_by_string(*links);
+    size_t j = 0;
+    while (j < sorted.size()) {
+      const int str = sorted[j].str;
+      const auto& name = m_strings[str];
+      if (links == &m_type_links) {
+        link.push_back(0x80);
+      }
+      link.insert(link.end(), name.begin(), name.end());
+      link.push_back(0);
+
+      int prev = 0;
+      for (; j < sorted.size() && sorted[j].str == str; j++) {
+        int x = sorted[j].word;
+        int diff = x - prev;
+        ASSERT(diff >= 0);
+        push_better_variable_length_integer(diff * 4, &link);
+        m_words.at(x) = 0xffffffff;
+        prev = x;
+      }
+      link.push_back(0);
     }
-    link.push_back(0);
   }
   push_variable_length_integer(0, &link);
 
@@ -268,26 +348,21 @@ std::vector<u8> DataObjectGenerator::generate_link_table() {
 }
 
 void DataObjectGenerator::add_strings() {
-  for (auto& entry : m_string_pool) {
-    // add the string
+  const auto string_tag = intern("string");
+  const auto sorted = sort_by_string(m_string_pool);
+  size_t i = 0;
+  while (i < sorted.size()) {
+    const int str = sorted[i].str;
+    // add the string. The data is padded with at least one zero, for the null terminator.
     align(4);
-    add_type_tag("string");
-    auto target_word = add_word(entry.first.length());
-    std::vector<u8> string_buff;
-    for (auto c : entry.first) {
-      string_buff.push_back(c);
-    }
-    string_buff.push_back(0);
-    while (string_buff.size() & 3) {
-      string_buff.push_back(0);
-    }
-
-    for (int i = 0; i < int(string_buff.size()) / 4; i++) {
-      add_word(*(u32*)(string_buff.data() + i * 4));
-    }
-
-    for (auto& source : entry.second) {
-      link_word_to_word(source, target_word);
+    add_type_tag(string_tag);
+    const auto& chars = m_strings[str];
+    auto target_word = add_word(chars.length());
+    m_words.resize(m_words.size() + chars.size() / 4 + 1, 0);
+    memcpy(m_words.data() + target_word + 1, chars.data(), chars.size());
+
+    for (; i < sorted.size() && sorted[i].str == str; i++) {
+      link_word_to_word(sorted[i].word, target_word);
     }
   }
 }
@@ -1,23 +1,46 @@
 #pragma once
 
-#include <map>
 #include <string>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/util/FlatHashMap.h"
 
 class DataObjectGenerator {
  public:
+  /*!
+   * A string used by a symbol link, type tag or the string pool. Linking with an id instead of the
+   * string skips looking up the string, for names that are used many times.
+   */
+  struct StringId {
+    int idx = -1;
+  };
+  StringId intern(const std::string& str);
+
+  // allocate room for the words and pointer links that will be added.
+  void reserve(size_t words, size_t pointer_links = 0);
+
   int add_word(u32 word);
   int add_word_float(float f);
+  // add data, padded with zeros to a whole number of words. Returns the index of the first word.
+  int add_data(const void* data, size_t size_bytes);
+  template <typename T>
+  int add_pod_vector(const std::vector<T>& data) {
+    return add_data(data.data(), data.size() * sizeof(T));
+  }
   void set_word(u32 word_idx, u32 val);
   void link_word_to_word(int source, int target, int offset = 0);
   void link_word_to_byte(int source_word, int target_byte);
   int add_ref_to_string_in_pool(const std::string& str);
+  int add_ref_to_string_in_pool(StringId str);
   void link_word_to_string_in_pool(const std::string& str, int word_idx);
+  void link_word_to_string_in_pool(StringId str, int word_idx);
   int add_type_tag(const std::string& str);
+  int add_type_tag(StringId str);
   int add_symbol_link(const std::string& str);
+  int add_symbol_link(StringId str);
   void link_word_to_symbol(const std::string& str, int word_idx);
+  void link_word_to_symbol(StringId str, int word_idx);
   std::vector<u8> generate_v2();
   std::vector<u8> generate_v4();
   void align(int alignment_words);
@@ -35,11 +58,20 @@ class DataObjectGenerator {
     int target_byte;
   };
 
-  std::map<std::string, std::vector<int>> m_string_pool;
+  struct StringLinkRecord {
+    int str;
+    int word;
+  };
+
+  std::vector<StringLinkRecord> sort_by_string(const std::vector<StringLinkRecord>& links) const;
+
+  std::vector<std::string> m_strings;
+  cu::FlatHashMap<std::string, int> m_string_ids;
+
+  std::vector<StringLinkRecord> m_string_pool;
   std::vector<u32> m_words;
   std::vector<PointerLinkRecord> m_ptr_links;
 
-  // both alphabetical.
-  // symbols before types.
-  std::map<std::string, std::vector<int>> m_type_links, m_symbol_links;
+  // both are written in alphabetical order, symbols before types.
+  std::vector<StringLinkRecord> m_type_links, m_symbol_links;
 };
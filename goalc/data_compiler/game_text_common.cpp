@@ -22,6 +22,7 @@
 #include "common/goos/Reader.h"
 #include "common/util/FileUtil.h"
 #include "common/util/FontUtils.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/json_util.h"
 
 #include "game/runtime.h"
@@ -62,43 +63,55 @@ std::string uppercase(const std::string& in) {
 /*!
  * Write game text data to a file. Uses the V2 object format which is identical between GOAL and
  * OpenGOAL, so this should produce exactly identical files to what is found in the game.
+ * Each group and language is a separate file, so they are generated in parallel.
  */
 void compile_text(GameTextDB& db, const std::string& output_prefix) {
+  std::vector<std::pair<const std::string*, const GameTextBank*>> outputs;
   for (const auto& [group_name, banks] : db.groups()) {
     for (const auto& [lang, bank] : banks) {
-      DataObjectGenerator gen;
-      gen.add_type_tag("game-text-info");  // type
-      gen.add_word(bank->lines().size());  // length
-      gen.add_word(lang);                  // language-id
-      // this string is found in the string pool.
-      gen.add_ref_to_string_in_pool(group_name);  // group-name
-
-      // now add all the datas: (the lines are already sorted by id)
-      for (auto& [id, line] : bank->lines()) {
-        gen.add_word(id);  // id
-        // these strings must be in the string pool, as sometimes there are duplicate
-        // strings in a single language, and these strings should be stored once and have multiple
-        // references to them.
-        gen.add_ref_to_string_in_pool(line);  // text
-      }
+      outputs.emplace_back(&group_name, bank.get());
+    }
+  }
 
-      auto data = gen.generate_v2();
+  file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
+  ThreadPool::global().parallel_for(outputs.size(), [&](int i) {
+    const auto& group_name = *outputs[i].first;
+    const auto* bank = outputs[i].second;
+    DataObjectGenerator gen;
+    gen.add_type_tag("game-text-info");  // type
+    gen.add_word(bank->lines().size());  // length
+    gen.add_word(bank->lang());          // language-id
+    // this string is found in the string pool.
+    gen.add_ref_to_string_in_pool(group_name);  // group-name
 
-      file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
-      file_util::write_binary_file(
-          file_util::get_file_path(
-              {"out", output_prefix, "iso", fmt::format("{}{}.TXT", lang, uppercase(group_name))}),
-          data.data(), data.size());
+    // now add all the datas: (the lines are already sorted by id)
+    for (auto& [id, line] : bank->lines()) {
+      gen.add_word(id);  // id
+      // these strings must be in the string pool, as sometimes there are duplicate
+      // strings in a single language, and these strings should be stored once and have multiple
+      // references to them.
+      gen.add_ref_to_string_in_pool(line);  // text
     }
-  }
+
+    auto data = gen.generate_v2();
+
+    file_util::write_binary_file(
+        file_util::get_file_path({"out", output_prefix, "iso",
+                                  fmt::format("{}{}.TXT", bank->lang(), uppercase(group_name))}),
+        data.data(), data.size());
+  });
 }
 
 /*!
  * Write game subtitle data to a file. Uses the V2 object format which is identical between GOAL and
- * OpenGOAL.
+ * OpenGOAL. Each language is a separate file, generated in parallel.
  */
 void compile_subtitles_v1(GameSubtitleDB& db, const std::string& output_prefix) {
-  for (const auto& [lang, bank] : db.m_banks) {
+  const std::vector<std::pair<int, std::shared_ptr<GameSubtitleBank>>> banks(db.m_banks.begin(),
+                                                                              db.m_banks.end());
+  file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
+  ThreadPool::global().parallel_for(banks.size(), [&](int i) {
+    const auto& [lang, bank] = banks[i];
     // get font encoding information
     auto font = get_font_bank(bank->m_text_version);
 
@@ -155,20 +168,23 @@ void compile_subtitles_v1(GameSubtitleDB& db, const std::string& output_prefix)
 
     auto data = gen.generate_v2();
 
-    file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
     file_util::write_binary_file(
         file_util::get_file_path(
             {"out", output_prefix, "iso", fmt::format("{}{}.TXT", lang, uppercase("subtit"))}),
         data.data(), data.size());
-  }
+  });
 }
 
 /*!
  * Write game subtitle2 data to a file. Uses the V2 object format which is identical between GOAL
- * and OpenGOAL.
+ * and OpenGOAL. Each language is a separate file, generated in parallel.
  */
 void compile_subtitles_v2(GameSubtitleDB& db, const std::string& output_prefix) {
-  for (const auto& [lang, bank] : db.m_banks) {
+  const std::vector<std::pair<int, std::shared_ptr<GameSubtitleBank>>> banks(db.m_banks.begin(),
+                                                                              db.m_banks.end());
+  file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
+  ThreadPool::global().parallel_for(banks.size(), [&](int i) {
+    const auto& [lang, bank] = banks[i];
     auto font = get_font_bank(bank->m_text_version);
     DataObjectGenerator gen;
     if (get_text_version_name(bank->m_text_version) == "jak3") {
@@ -223,13 +239,12 @@ void compile_subtitles_v2(GameSubtitleDB& db, const std::string& output_prefix)
 
     auto data = gen.generate_v2();
 
-    file_util::create_dir_if_needed(file_util::get_file_path({"out", output_prefix, "iso"}));
     auto file_name = get_text_version_name(bank->m_text_version) == "jak3" ? "subti3" : "subti2";
     file_util::write_binary_file(
         file_util::get_file_path(
             {"out", output_prefix, "iso", fmt::format("{}{}.TXT", lang, uppercase(file_name))}),
         data.data(), data.size());
-  }
+  });
 }
 }  // namespace
 
@@ -239,17 +254,29 @@ void compile_subtitles_v2(GameSubtitleDB& db, const std::string& output_prefix)
 void compile_game_text(const std::vector<GameTextDefinitionFile>& files,
                        GameTextDB& db,
                        const std::string& output_prefix) {
+  // converting the JSON files to the game encoding is most of the work, and each file is
+  // independent, so do that in parallel first. Files are still added in order, since later files
+  // replace lines from earlier ones.
+  std::vector<std::vector<std::pair<int, std::string>>> json_lines(files.size());
+  ThreadPool::global().parallel_for(files.size(), [&](int i) {
+    auto& file = files[i];
+    if (file.format == GameTextDefinitionFile::Format::JSON) {
+      auto file_path = file_util::get_jak_project_dir() / file.file_path;
+      auto json = parse_commented_json(file_util::read_text_file(file_path), file.file_path);
+      json_lines[i] = convert_text_json(json, file);
+    }
+  });
+
   goos::Reader reader;
-  for (auto& file : files) {
+  for (size_t i = 0; i < files.size(); i++) {
+    auto& file = files[i];
     if (file.format == GameTextDefinitionFile::Format::GOAL) {
       lg::print("[Build Game Text] GOAL {}\n", file.file_path);
       auto code = reader.read_from_file({file.file_path});
       parse_text_goal(code, db, file);
     } else if (file.format == GameTextDefinitionFile::Format::JSON) {
       lg::print("[Build Game Text] JSON {}\n", file.file_path);
-      auto file_path = file_util::get_jak_project_dir() / file.file_path;
-      auto json = parse_commented_json(file_util::read_text_file(file_path), file.file_path);
-      parse_text_json(json, db, file);
+      add_text_lines(json_lines[i], db, file);
     }
   }
   compile_text(db, output_prefix);
@@ -258,17 +285,21 @@ void compile_game_text(const std::vector<GameTextDefinitionFile>& files,
 void compile_game_subtitles(const std::vector<GameSubtitleDefinitionFile>& files,
                             GameSubtitleDB& db,
                             const std::string& output_prefix) {
-  goos::Reader reader;
+  // each language reads its own files (and the base language's), so read them in parallel.
+  std::vector<GameSubtitlePackage> packages(files.size());
+  ThreadPool::global().parallel_for(files.size(),
+                                    [&](int i) { packages[i] = db.read_package(files[i]); });
+
   if (db.m_subtitle_version == GameSubtitleDB::SubtitleFormat::V1) {
-    for (auto& file : files) {
-      lg::print("[Build Game Subtitle V1] {}:{}\n", file.lines_path, file.meta_path);
-      db.init_banks_from_file(file);
+    for (size_t i = 0; i < files.size(); i++) {
+      lg::print("[Build Game Subtitle V1] {}:{}\n", files[i].lines_path, files[i].meta_path);
+      db.init_banks_from_package(files[i], packages[i]);
     }
     compile_subtitles_v1(db, output_prefix);
   } else {
-    for (auto& file : files) {
-      lg::print("[Build Game Subtitle V2] {}:{}\n", file.lines_path, file.meta_path);
-      db.init_banks_from_file(file);
+    for (size_t i = 0; i < files.size(); i++) {
+      lg::print("[Build Game Subtitle V2] {}:{}\n", files[i].lines_path, files[i].meta_path);
+      db.init_banks_from_package(files[i], packages[i]);
     }
     compile_subtitles_v2(db, output_prefix);
   }
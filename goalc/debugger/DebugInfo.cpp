@@ -1,11 +1,58 @@
 #include "DebugInfo.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "fmt/core.h"
 
 DebugInfo::DebugInfo(std::string obj_name) : m_obj_name(std::move(obj_name)) {}
 
+void DebugInfo::build_index() {
+  for (auto& seg : m_index) {
+    seg.clear();
+  }
+  for (auto& kv : m_functions) {
+    auto& func = kv.second;
+    if (func.seg < N_SEG) {
+      m_index[func.seg].push_back({func.offset_in_seg, func.offset_in_seg + func.length, &func});
+    }
+  }
+  for (auto& seg : m_index) {
+    std::sort(seg.begin(), seg.end(),
+              [](const IndexEntry& a, const IndexEntry& b) { return a.start < b.start; });
+  }
+  m_last_hit = nullptr;
+  m_index_valid = true;
+}
+
+bool DebugInfo::lookup_function(FunctionDebugInfo** info, std::string* name, u32 offset, u8 seg) {
+  if (!m_index_valid) {
+    build_index();
+  }
+
+  const IndexEntry* hit = nullptr;
+  if (m_last_hit && m_last_hit->info->seg == seg && offset >= m_last_hit->start &&
+      offset < m_last_hit->end) {
+    hit = m_last_hit;
+  } else if (seg < N_SEG) {
+    // functions don't overlap, so the only candidate is the last one starting at or before offset.
+    const auto& funcs = m_index[seg];
+    auto it = std::upper_bound(funcs.begin(), funcs.end(), offset,
+                               [](u32 off, const IndexEntry& e) { return off < e.start; });
+    if (it != funcs.begin() && offset < (it - 1)->end) {
+      hit = &*(it - 1);
+    }
+  }
+
+  if (!hit) {
+    return false;
+  }
+  m_last_hit = hit;
+  *info = hit->info;
+  *name = hit->info->name;
+  return true;
+}
+
 std::string FunctionDebugInfo::disassemble_debug_info(bool* had_failure,
                                                       const goos::Reader* reader,
                                                       bool omit_ir) {
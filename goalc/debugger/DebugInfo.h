@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/link_types.h"
 #include "common/util/Assert.h"
 
 #include "goalc/debugger/disassemble.h"
@@ -54,25 +55,19 @@ class DebugInfo {
     auto& result = m_functions[name];
     result.name = name;
     result.obj_name = obj_name;
+    // the offset and length are set after this, so the index is built on the next lookup.
+    m_index_valid = false;
     return result;
   }
 
-  bool lookup_function(FunctionDebugInfo** info, std::string* name, u32 offset, u8 seg) {
-    for (auto& kv : m_functions) {
-      auto start = kv.second.offset_in_seg;
-      auto end = start + kv.second.length;
-      if (offset >= start && offset < end && seg == kv.second.seg) {
-        *info = &kv.second;
-        *name = kv.first;
-        return true;
-      }
-    }
-    return false;
-  }
+  bool lookup_function(FunctionDebugInfo** info, std::string* name, u32 offset, u8 seg);
 
   FunctionDebugInfo& function_by_name(const std::string& name) { return m_functions.at(name); }
 
-  void clear() { m_functions.clear(); }
+  void clear() {
+    m_functions.clear();
+    m_index_valid = false;
+  }
 
   std::string disassemble_all_functions(bool* had_failure,
                                         const goos::Reader* reader,
@@ -84,4 +79,17 @@ class DebugInfo {
  private:
   std::string m_obj_name;
   std::unordered_map<std::string, FunctionDebugInfo> m_functions;
+
+  /*!
+   * The functions of each segment, sorted by offset, so lookup_function can binary search.
+   */
+  struct IndexEntry {
+    u32 start;
+    u32 end;
+    FunctionDebugInfo* info;
+  };
+  void build_index();
+  std::vector<IndexEntry> m_index[N_SEG];
+  bool m_index_valid = false;
+  const IndexEntry* m_last_hit = nullptr;  // backtraces look up the same functions a lot
 };
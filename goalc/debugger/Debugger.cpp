@@ -6,6 +6,8 @@
 
 #include "Debugger.h"
 
+#include <algorithm>
+
 #include "common/goal_constants.h"
 #include "common/log/log.h"
 #include "common/symbols.h"
@@ -161,7 +163,7 @@ bool Debugger::attach_and_break() {
 
 std::string Debugger::get_info_about_addr(u32 addr) {
   if (addr >= EE_MAIN_MEM_LOW_PROTECT && addr < EE_MAIN_MEM_SIZE) {
-    auto map_loc = m_memory_map.lookup(addr);
+    const auto& map_loc = m_memory_map.lookup(addr);
     if (map_loc.empty) {
       return "Unknown Address";
     }
@@ -193,7 +195,7 @@ InstructionPointerInfo Debugger::get_rip_info(u64 rip) {
     if (rip >= m_debug_context.base + EE_MAIN_MEM_LOW_PROTECT &&
         rip < m_debug_context.base + EE_MAIN_MEM_SIZE) {
       result.in_goal_mem = true;
-      auto map_loc = m_memory_map.lookup(rip - m_debug_context.base);
+      const auto& map_loc = m_memory_map.lookup(rip - m_debug_context.base);
       if (map_loc.empty) {
         result.knows_object = false;
         result.knows_function = false;
@@ -514,6 +516,137 @@ bool Debugger::do_continue() {
   }
 }
 
+/*!
+ * Sample the call stack of the running target for a while. Each sample stops the target, reads the
+ * registers and walks the stack, then lets it go again.
+ * Must be attached and running, and is still running after unless the target crashed.
+ */
+bool Debugger::profile(int sample_hz, int duration_ms, ProfileResult* out) {
+  ASSERT(is_valid() && is_attached() && is_running());
+  m_memory_map = m_listener->build_memory_map();
+  m_continue_info.valid = false;
+  m_regs_valid = false;
+  clear_signal_queue();
+
+  // the watcher checks for stops more often while this is set, and doesn't print our breaks.
+  m_profiling = true;
+  const auto period = std::chrono::nanoseconds(1000000000 / sample_hz);
+  const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(duration_ms);
+  auto next_sample = std::chrono::steady_clock::now();
+  double total_pause_us = 0;
+  bool ok = true;
+
+  while (next_sample < end) {
+    std::this_thread::sleep_until(next_sample);
+    next_sample += period;
+
+    Timer pause_timer;
+    if (!xdbg::break_now(m_debug_context.tid)) {
+      ok = false;
+      break;
+    }
+    auto info = pop_signal();
+    if (info.kind != xdbg::SignalInfo::BREAK) {
+      // it crashed (or hit a breakpoint) and really is stopped now.
+      lg::print("[Debugger] Target stopped while profiling. Run (:di) to get more information.\n");
+      ok = false;
+      break;
+    }
+
+    xdbg::Regs regs;
+    if (xdbg::get_regs_now(m_debug_context.tid, &regs)) {
+      auto frames = sample_stack(regs);
+      std::string stack;
+      for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+        if (!stack.empty()) {
+          stack += ';';
+        }
+        stack += *it;
+      }
+      out->stacks[stack]++;
+      out->samples++;
+    } else {
+      out->failed_samples++;
+    }
+
+    if (!xdbg::cont_now(m_debug_context.tid)) {
+      ok = false;
+      break;
+    }
+    m_running = true;
+    double pause_us = pause_timer.getUs();
+    total_pause_us += pause_us;
+    out->max_pause_us = std::max(out->max_pause_us, pause_us);
+  }
+
+  m_profiling = false;
+  int paused = out->samples + out->failed_samples;
+  if (paused) {
+    out->avg_pause_us = total_pause_us / paused;
+  }
+  return ok;
+}
+
+/*!
+ * The names of the functions on the stack, leaf first. Code that isn't GOAL (the C++ kernel and
+ * mips2c functions) is one [native] frame, and its GOAL caller is found by looking up the stack
+ * for the first return address into a GOAL function.
+ */
+std::vector<std::string> Debugger::sample_stack(const xdbg::Regs& regs) {
+  constexpr int MAX_DEPTH = 64;
+  constexpr int SCAN_WORDS = 128;
+  std::vector<std::string> frames;
+  u64 rip = regs.rip;
+  u64 rsp = regs.gprs[emitter::RSP];
+
+  auto info = get_rip_info(rip);
+  if (!info.knows_function) {
+    if (!info.in_goal_mem) {
+      frames.push_back("[native]");
+    } else if (info.knows_object) {
+      frames.push_back(fmt::format("[{}]", info.object_name));
+    } else {
+      frames.push_back("[unknown]");
+    }
+
+    u64 stack[SCAN_WORDS];
+    if (!read_memory_if_safe((u8*)stack, sizeof(stack), rsp - m_debug_context.base)) {
+      return frames;
+    }
+    bool found = false;
+    for (int i = 0; i < SCAN_WORDS && !found; i++) {
+      auto caller = get_rip_info(stack[i]);
+      if (caller.knows_function && caller.func_debug && caller.func_debug->stack_usage) {
+        rip = stack[i];
+        rsp += 8 * (i + 1);
+        found = true;
+      }
+    }
+    if (!found) {
+      return frames;
+    }
+  }
+
+  while ((int)frames.size() < MAX_DEPTH) {
+    info = get_rip_info(rip);
+    if (!info.knows_function) {
+      break;
+    }
+    frames.push_back(info.function_name);
+    if (!info.func_debug || !info.func_debug->stack_usage) {
+      break;
+    }
+    u64 rsp_at_call = rsp + *info.func_debug->stack_usage;
+    u64 next_rip = 0;
+    if (!read_memory_if_safe<u64>(&next_rip, rsp_at_call - m_debug_context.base)) {
+      break;
+    }
+    rip = next_rip;
+    rsp = rsp_at_call + 8;  // 8 for the call itself.
+  }
+  return frames;
+}
+
 /*!
  * Read memory from an attached and halted target.
  */
@@ -538,6 +671,84 @@ bool Debugger::write_memory(const u8* src_buffer, int size, u32 goal_addr) {
   return xdbg::write_goal_memory(src_buffer, size, goal_addr, m_debug_context, m_memory_handle);
 }
 
+/*!
+ * Save a copy of a range of EE memory to diff against later. The range is rounded out to pages.
+ * The target doesn't have to be halted, but diffs are only exact if it is.
+ */
+bool Debugger::take_memory_snapshot(u32 goal_addr, u32 size) {
+  ASSERT(is_valid() && is_attached());
+  u32 start = std::max(goal_addr, (u32)EE_MAIN_MEM_LOW_PROTECT) & ~(xdbg::DIRTY_PAGE_SIZE - 1);
+  u32 end = std::min((u64)goal_addr + size, (u64)EE_MAIN_MEM_SIZE);
+  end = (end + xdbg::DIRTY_PAGE_SIZE - 1) & ~(xdbg::DIRTY_PAGE_SIZE - 1);
+  if (end <= start) {
+    return false;
+  }
+
+  m_snapshot.valid = false;
+  m_snapshot.start = start;
+  m_snapshot.data.resize(end - start);
+  // clear first, so writes made while we read are seen by the next diff.
+  m_snapshot.use_dirty_pages =
+      xdbg::dirty_page_tracking_supported() && xdbg::clear_dirty_pages(m_debug_context.tid);
+  if (!xdbg::read_goal_memory(m_snapshot.data.data(), m_snapshot.data.size(), start,
+                              m_debug_context, m_memory_handle)) {
+    return false;
+  }
+  m_snapshot.valid = true;
+  return true;
+}
+
+/*!
+ * Find the bytes that changed since the last snapshot or diff, and update the snapshot.
+ * When dirty page tracking is available, only pages that were written are read from the target.
+ */
+bool Debugger::diff_memory_snapshot(MemoryDiff* out) {
+  ASSERT(is_valid() && is_attached());
+  if (!m_snapshot.valid) {
+    return false;
+  }
+  u32 size = m_snapshot.data.size();
+  out->changed.clear();
+  out->pages_total = size / xdbg::DIRTY_PAGE_SIZE;
+
+  std::vector<u32> pages;
+  if (m_snapshot.use_dirty_pages &&
+      xdbg::get_dirty_pages(m_snapshot.start, size, m_debug_context, &pages) &&
+      xdbg::clear_dirty_pages(m_debug_context.tid)) {
+    // pages written after here will be in the next diff.
+  } else {
+    pages.clear();
+    for (u32 addr = m_snapshot.start; addr < m_snapshot.start + size;
+         addr += xdbg::DIRTY_PAGE_SIZE) {
+      pages.push_back(addr);
+    }
+  }
+  out->pages_read = pages.size();
+
+  u8 page_data[xdbg::DIRTY_PAGE_SIZE];
+  for (u32 page_addr : pages) {
+    if (!xdbg::read_goal_memory(page_data, xdbg::DIRTY_PAGE_SIZE, page_addr, m_debug_context,
+                                m_memory_handle)) {
+      return false;
+    }
+    u8* old_data = m_snapshot.data.data() + (page_addr - m_snapshot.start);
+    for (u32 i = 0; i < xdbg::DIRTY_PAGE_SIZE; i++) {
+      if (old_data[i] == page_data[i]) {
+        continue;
+      }
+      u32 addr = page_addr + i;
+      if (!out->changed.empty() &&
+          out->changed.back().first + out->changed.back().second == addr) {
+        out->changed.back().second++;
+      } else {
+        out->changed.emplace_back(addr, 1);
+      }
+    }
+    memcpy(old_data, page_data, xdbg::DIRTY_PAGE_SIZE);
+  }
+  return true;
+}
+
 void Debugger::read_symbol_table_jak1() {
   using namespace jak1_symbols;
   using namespace jak1;
@@ -956,7 +1167,9 @@ void Debugger::watcher() {
           printf("Target has crashed with a SEGFAULT! Run (:di) to get more information.\n");
           break;
         case xdbg::SignalInfo::BREAK:
-          printf("Target has stopped. Run (:di) to get more information.\n");
+          if (!m_profiling) {
+            printf("Target has stopped. Run (:di) to get more information.\n");
+          }
           break;
         case xdbg::SignalInfo::MATH_EXCEPTION:
           printf("Target has crashed with a MATH_EXCEPTION! Run (:di) to get more information.\n");
@@ -996,7 +1209,11 @@ void Debugger::watcher() {
 
     } else {
       // the target didn't stop.
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      if (m_profiling) {
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+      } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
     }
   }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <cstring>
 #include <mutex>
@@ -99,6 +100,24 @@ class Debugger {
   void remove_addr_breakpoint(u32 addr);
   void update_break_info(std::optional<std::string> dump_path);
 
+  struct MemoryDiff {
+    std::vector<std::pair<u32, u32>> changed;  // start, size
+    u32 pages_read = 0;
+    u32 pages_total = 0;
+  };
+  bool take_memory_snapshot(u32 goal_addr, u32 size);
+  bool diff_memory_snapshot(MemoryDiff* out);
+
+  struct ProfileResult {
+    // call stacks, root first and separated by ;, and how many samples were in each.
+    std::unordered_map<std::string, int> stacks;
+    int samples = 0;
+    int failed_samples = 0;
+    double avg_pause_us = 0;
+    double max_pause_us = 0;
+  };
+  bool profile(int sample_hz, int duration_ms, ProfileResult* out);
+
   InstructionPointerInfo get_rip_info(u64 x86_rip);
   DebugInfo& get_debug_info_for_object(const std::string& object_name);
   bool knows_object(const std::string& object_name) const;
@@ -174,6 +193,9 @@ class Debugger {
   bool m_attach_return = false;
   std::condition_variable m_attach_cv;
 
+  std::atomic<bool> m_profiling = false;
+  std::vector<std::string> sample_stack(const xdbg::Regs& regs);
+
   bool try_start_watcher();
   void start_watcher();
   void stop_watcher();
@@ -191,6 +213,14 @@ class Debugger {
 
   std::unordered_map<u32, Breakpoint> m_addr_breakpoints;
 
+  // memory snapshot to diff against, see take_memory_snapshot.
+  struct MemorySnapshot {
+    u32 start = 0;
+    std::vector<u8> data;
+    bool use_dirty_pages = false;
+    bool valid = false;
+  } m_snapshot;
+
   std::mutex m_watcher_mutex;
   std::condition_variable m_watcher_cv;
   std::thread m_watcher_thread;
@@ -2376,6 +2376,56 @@ class IGen {
     return instr;
   }
 
+  /*
+    Fused multiply-add, these require FMA support (not part of AVX).
+    The 231 forms accumulate into dst: dst = dst + src1 * src2
+    The 213 forms multiply dst: dst = dst * src1 + src2
+    The fnmadd forms subtract the product instead of adding it.
+  */
+  static Instruction fmadd231_vf(Register dst, Register src1, Register src2) {
+    ASSERT(dst.is_xmm());
+    ASSERT(src1.is_xmm());
+    ASSERT(src2.is_xmm());
+    // VEX.128.66.0F38.W0 B8 /r VFMADD231PS xmm1, xmm2, xmm3/m128
+    Instruction instr(0xb8);
+    instr.set_vex_modrm_and_rex(dst.hw_id(), src2.hw_id(), VEX3::LeadingBytes::P_0F_38,
+                                src1.hw_id(), false, VexPrefix::P_66);
+    return instr;
+  }
+
+  static Instruction fmadd213_vf(Register dst, Register src1, Register src2) {
+    ASSERT(dst.is_xmm());
+    ASSERT(src1.is_xmm());
+    ASSERT(src2.is_xmm());
+    // VEX.128.66.0F38.W0 A8 /r VFMADD213PS xmm1, xmm2, xmm3/m128
+    Instruction instr(0xa8);
+    instr.set_vex_modrm_and_rex(dst.hw_id(), src2.hw_id(), VEX3::LeadingBytes::P_0F_38,
+                                src1.hw_id(), false, VexPrefix::P_66);
+    return instr;
+  }
+
+  static Instruction fnmadd231_vf(Register dst, Register src1, Register src2) {
+    ASSERT(dst.is_xmm());
+    ASSERT(src1.is_xmm());
+    ASSERT(src2.is_xmm());
+    // VEX.128.66.0F38.W0 BC /r VFNMADD231PS xmm1, xmm2, xmm3/m128
+    Instruction instr(0xbc);
+    instr.set_vex_modrm_and_rex(dst.hw_id(), src2.hw_id(), VEX3::LeadingBytes::P_0F_38,
+                                src1.hw_id(), false, VexPrefix::P_66);
+    return instr;
+  }
+
+  static Instruction fnmadd213_vf(Register dst, Register src1, Register src2) {
+    ASSERT(dst.is_xmm());
+    ASSERT(src1.is_xmm());
+    ASSERT(src2.is_xmm());
+    // VEX.128.66.0F38.W0 AC /r VFNMADD213PS xmm1, xmm2, xmm3/m128
+    Instruction instr(0xac);
+    instr.set_vex_modrm_and_rex(dst.hw_id(), src2.hw_id(), VEX3::LeadingBytes::P_0F_38,
+                                src1.hw_id(), false, VexPrefix::P_66);
+    return instr;
+  }
+
   static Instruction sqrt_vf(Register dst, Register src) {
     ASSERT(dst.is_xmm());
     ASSERT(src.is_xmm());
@@ -3,6 +3,8 @@
 #ifndef JAK_INSTRUCTION_H
 #define JAK_INSTRUCTION_H
 
+#include <cstring>
+
 #include "common/common_types.h"
 #include "common/util/Assert.h"
 
@@ -958,16 +960,15 @@ struct Instruction {
       buffer[count++] = m_sib;
     }
 
+    // v_arr is the little-endian bytes of the value, so it can be copied in one go.
     if (m_flags & kSetDispImm) {
-      for (int i = 0; i < disp.size; i++) {
-        buffer[count++] = disp.v_arr[i];
-      }
+      memcpy(buffer + count, disp.v_arr, disp.size);
+      count += disp.size;
     }
 
     if (m_flags & kSetImm) {
-      for (int i = 0; i < imm.size; i++) {
-        buffer[count++] = imm.v_arr[i];
-      }
+      memcpy(buffer + count, imm.v_arr, imm.size);
+      count += imm.size;
     }
     return count;
   }
@@ -1002,15 +1003,11 @@ struct Instruction {
     }
 
     if (m_flags & kSetDispImm) {
-      for (int i = 0; i < disp.size; i++) {
-        count++;
-      }
+      count += disp.size;
     }
 
     if (m_flags & kSetImm) {
-      for (int i = 0; i < imm.size; i++) {
-        count++;
-      }
+      count += imm.size;
     }
     return count;
   }
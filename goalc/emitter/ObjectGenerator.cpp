@@ -33,6 +33,10 @@ ObjectGenerator::ObjectGenerator(GameVersion version) : m_version(version) {}
 ObjectFileData ObjectGenerator::generate_data_v3(const TypeSystem* ts) {
   ObjectFileData out;
 
+  for (int seg = N_SEG; seg-- > 0;) {
+    merge_function_links(seg);
+  }
+
   // do functions (step 2, part 1)
   for (int seg = N_SEG; seg-- > 0;) {
     auto& data = m_data_by_seg.at(seg);
@@ -55,20 +59,20 @@ ObjectFileData ObjectGenerator::generate_data_v3(const TypeSystem* ts) {
       function.debug->offset_in_seg = m_data_by_seg.at(seg).size();
       function.debug->seg = seg;
 
-      // insert instructions!
-
+      // insert instructions! find the size first, so they can be emitted straight into data.
+      size_t code_size = 0;
+      for (const auto& instr : function.instructions) {
+        code_size += instr.length();
+      }
+      size_t offset = data.size();
+      data.resize(offset + code_size);
+      function.instruction_to_byte_in_data.reserve(function.instructions.size() + 1);
       for (size_t instr_idx = 0; instr_idx < function.instructions.size(); instr_idx++) {
-        const auto& instr = function.instructions[instr_idx];
-        u8 temp[128];
-        auto count = instr.emit(temp);
-        ASSERT(count < 128);
-        function.instruction_to_byte_in_data.push_back(data.size());
-        function.debug->instructions.at(instr_idx).offset =
-            data.size() - function.debug->offset_in_seg;
-        for (int i = 0; i < count; i++) {
-          insert_data<u8>(seg, temp[i]);
-        }
+        function.instruction_to_byte_in_data.push_back(offset);
+        function.debug->instructions.at(instr_idx).offset = offset - function.debug->offset_in_seg;
+        offset += function.instructions[instr_idx].emit(data.data() + offset);
       }
+      ASSERT(offset == data.size());
 
       function.debug->length = m_data_by_seg.at(seg).size() - function.debug->offset_in_seg;
     }
@@ -194,8 +198,7 @@ InstructionRecord ObjectGenerator::add_instr(Instruction inst, IR_Record ir) {
   auto& func_data = m_function_data_by_seg.at(rec.seg).at(rec.func_id);
   rec.instr_id = int(func_data.instructions.size());
   func_data.instructions.emplace_back(inst);
-  auto debug = m_function_data_by_seg.at(ir.seg).at(ir.func_id).debug;
-  debug->instructions.emplace_back(inst, InstructionInfo::Kind::IR, ir.ir_id);
+  func_data.debug->instructions.emplace_back(inst, InstructionInfo::Kind::IR, ir.ir_id);
   return rec;
 }
 
@@ -246,7 +249,9 @@ void ObjectGenerator::link_instruction_jump(InstructionRecord jump_instr, IR_Rec
   // must jump within our own function.
   ASSERT(jump_instr.seg == destination.seg);
   ASSERT(jump_instr.func_id == destination.func_id);
-  m_jump_temp_links_by_seg.at(jump_instr.seg).push_back({jump_instr, destination});
+  m_function_data_by_seg.at(jump_instr.seg)
+      .at(jump_instr.func_id)
+      .jump_links.push_back({jump_instr, destination});
 }
 
 /*!
@@ -256,7 +261,9 @@ void ObjectGenerator::link_instruction_jump(InstructionRecord jump_instr, IR_Rec
  */
 void ObjectGenerator::link_instruction_symbol_mem(const InstructionRecord& rec,
                                                   const std::string& name) {
-  m_symbol_instr_temp_links_by_seg.at(rec.seg)[name].push_back({rec, true});
+  m_function_data_by_seg.at(rec.seg)
+      .at(rec.func_id)
+      .symbol_instr_links.push_back({name, {rec, true}});
 }
 
 /*!
@@ -265,7 +272,9 @@ void ObjectGenerator::link_instruction_symbol_mem(const InstructionRecord& rec,
  */
 void ObjectGenerator::link_instruction_symbol_ptr(const InstructionRecord& rec,
                                                   const std::string& name) {
-  m_symbol_instr_temp_links_by_seg.at(rec.seg)[name].push_back({rec, false});
+  m_function_data_by_seg.at(rec.seg)
+      .at(rec.func_id)
+      .symbol_instr_links.push_back({name, {rec, false}});
 }
 
 /*!
@@ -313,12 +322,40 @@ void ObjectGenerator::link_static_pointer_to_function(const StaticRecord& source
 void ObjectGenerator::link_instruction_static(const InstructionRecord& instr,
                                               const StaticRecord& target_static,
                                               int offset) {
-  m_rip_data_temp_links_by_seg.at(instr.seg).push_back({instr, target_static, offset});
+  m_function_data_by_seg.at(instr.seg)
+      .at(instr.func_id)
+      .rip_data_links.push_back({instr, target_static, offset});
 }
 
 void ObjectGenerator::link_instruction_to_function(const InstructionRecord& instr,
                                                    const FunctionRecord& target_func) {
-  m_rip_func_temp_links_by_seg.at(instr.seg).push_back({instr, target_func});
+  m_function_data_by_seg.at(instr.seg)
+      .at(instr.func_id)
+      .rip_func_links.push_back({instr, target_func});
+}
+
+/*!
+ * Add the links from each function's instructions to the links for the segment, in function order,
+ * so the link table doesn't depend on the order functions were emitted in.
+ */
+void ObjectGenerator::merge_function_links(int seg) {
+  for (auto& function : m_function_data_by_seg.at(seg)) {
+    auto& jumps = m_jump_temp_links_by_seg.at(seg);
+    jumps.insert(jumps.end(), function.jump_links.begin(), function.jump_links.end());
+    for (auto& [name, link] : function.symbol_instr_links) {
+      m_symbol_instr_temp_links_by_seg.at(seg)[name].push_back(link);
+    }
+    auto& rip_funcs = m_rip_func_temp_links_by_seg.at(seg);
+    rip_funcs.insert(rip_funcs.end(), function.rip_func_links.begin(),
+                     function.rip_func_links.end());
+    auto& rip_data = m_rip_data_temp_links_by_seg.at(seg);
+    rip_data.insert(rip_data.end(), function.rip_data_links.begin(),
+                    function.rip_data_links.end());
+    function.jump_links.clear();
+    function.symbol_instr_links.clear();
+    function.rip_func_links.clear();
+    function.rip_data_links.clear();
+  }
 }
 
 /*!
@@ -631,10 +668,12 @@ std::vector<u8> ObjectGenerator::generate_header_v3() {
 }
 
 ObjectGeneratorStats ObjectGenerator::get_stats() const {
-  return m_stats;
+  ObjectGeneratorStats stats;
+  stats.moves_eliminated = m_moves_eliminated;
+  return stats;
 }
 
 void ObjectGenerator::count_eliminated_move() {
-  m_stats.moves_eliminated++;
+  m_moves_eliminated++;
 }
 }  // namespace emitter
@@ -5,13 +5,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstring>
-#include <map>
 #include <string>
 
 #include "Instruction.h"
 #include "ObjectFileData.h"
 
+#include "common/util/FlatMap.h"
 #include "common/versions/versions.h"
 
 #include "goalc/debugger/DebugInfo.h"
@@ -61,6 +62,10 @@ struct ObjectGeneratorStats {
   int moves_eliminated = 0;
 };
 
+/*!
+ * Functions are all added first, then their IR and instructions. Once every function is added, the
+ * instructions and links of different functions can be added from different threads at once.
+ */
 class ObjectGenerator {
  public:
   ObjectGenerator(GameVersion version);
@@ -100,6 +105,7 @@ class ObjectGenerator {
   GameVersion version() const { return m_version; }
 
  private:
+  void merge_function_links(int seg);
   void handle_temp_static_type_links(int seg);
   void handle_temp_jump_links(int seg);
   void handle_temp_instr_sym_links(int seg);
@@ -132,14 +138,6 @@ class ObjectGenerator {
     memcpy(data.data() + offset, &x, sizeof(T));
   }
 
-  struct FunctionData {
-    std::vector<Instruction> instructions;
-    std::vector<int> ir_to_instruction;
-    std::vector<int> instruction_to_byte_in_data;
-    int min_align = 16;
-    FunctionDebugInfo* debug = nullptr;
-  };
-
   struct StaticData {
     std::vector<u8> data;
     int min_align = 16;
@@ -203,11 +201,26 @@ class ObjectGenerator {
     int dest = -1;
   };
 
+  struct FunctionData {
+    std::vector<Instruction> instructions;
+    std::vector<int> ir_to_instruction;
+    std::vector<int> instruction_to_byte_in_data;
+    int min_align = 16;
+    FunctionDebugInfo* debug = nullptr;
+
+    // links from this function's instructions. Each function keeps its own so functions can be
+    // emitted in parallel, then merge_function_links adds them in function order.
+    std::vector<JumpLink> jump_links;
+    std::vector<std::pair<std::string, SymbolInstrLink>> symbol_instr_links;
+    std::vector<RipFuncLink> rip_func_links;
+    std::vector<RipDataLink> rip_data_links;
+  };
+
   template <typename T>
   using seg_vector = std::array<std::vector<T>, N_SEG>;
 
   template <typename T>
-  using seg_map = std::array<std::map<std::string, std::vector<T>>, N_SEG>;
+  using seg_map = std::array<cu::FlatMap<std::string, std::vector<T>>, N_SEG>;
   GameVersion m_version;
 
   // final data
@@ -236,6 +249,6 @@ class ObjectGenerator {
 
   std::vector<FunctionRecord> m_all_function_records;
 
-  ObjectGeneratorStats m_stats;
+  std::atomic<int> m_moves_eliminated = 0;
 };
 }  // namespace emitter
@@ -363,7 +363,6 @@ void Listener::send_code(std::vector<uint8_t>& code, const std::optional<std::st
   rcv_mtx.unlock();
 
   auto* header = (ListenerMessageHeader*)m_buffer;
-  auto* buffer_data = (char*)(header + 1);
   header->deci2_header.rsvd = 0;
   header->deci2_header.len = total_size;
   header->deci2_header.proto = DECI2_PROTOCOL;
@@ -374,8 +373,8 @@ void Listener::send_code(std::vector<uint8_t>& code, const std::optional<std::st
   header->u6 = 0;
   last_sent_id++;
   header->msg_id = last_sent_id;
-  memcpy(buffer_data, code.data(), code.size());
-  send_buffer(total_size);
+  // the code is sent straight from the vector, after the header.
+  send_buffer(sizeof(ListenerMessageHeader), code.data(), code.size());
 }
 
 /*!
@@ -434,22 +433,31 @@ void Listener::send_poke() {
 }
 
 /*!
- * Low level send of the m_buffer.
+ * Low level send of the first sz bytes of m_buffer, followed by data_size bytes of data.
  * Waits for the target to respond or times out and prints an error.
  */
-void Listener::send_buffer(int sz) {
-  int wrote = 0;
-
+void Listener::send_buffer(int sz, const void* data, int data_size) {
   if (debug_listener) {
-    fprintf(stderr, "[L -> T] sending %d bytes...\n", sz);
+    fprintf(stderr, "[L -> T] sending %d bytes...\n", sz + data_size);
   }
 
   got_ack = false;
   waiting_for_ack = true;
-  while (wrote < sz) {
-    auto to_send = std::min(512, sz - wrote);
-    auto x = write_to_socket(listen_socket, m_buffer + wrote, to_send);
-    wrote += x > 0 ? x : 0;
+  XSocketBuffer bufs[2] = {{m_buffer, sz}, {(const char*)data, data_size}};
+  int buf_idx = 0;
+  int buf_count = data_size ? 2 : 1;
+  while (buf_idx < buf_count) {
+    auto x = write_to_socket_gather(listen_socket, bufs + buf_idx, buf_count - buf_idx);
+    int wrote = x > 0 ? x : 0;
+    // skip past what was sent, it may have stopped partway through a buffer.
+    while (buf_idx < buf_count && wrote >= bufs[buf_idx].len) {
+      wrote -= bufs[buf_idx].len;
+      buf_idx++;
+    }
+    if (buf_idx < buf_count) {
+      bufs[buf_idx].data += wrote;
+      bufs[buf_idx].len -= wrote;
+    }
   }
 
   if (debug_listener) {
@@ -49,7 +49,7 @@ class Listener {
   void add_load(const std::string& name, const LoadEntry& le);
   void do_unload(const std::string& name);
 
-  void send_buffer(int sz);
+  void send_buffer(int sz, const void* data = nullptr, int data_size = 0);
   bool wait_for_ack();
   void handle_output_message(const char* msg);
 
@@ -105,10 +105,11 @@ std::string MemoryMap::print() const {
 }
 
 const MemoryMapEntry& MemoryMap::lookup(u32 addr) {
-  for (auto& entry : m_entries) {
-    if (addr >= entry.start_addr && addr < entry.end_addr) {
-      return entry;
-    }
+  // the entries are sorted and cover all of memory (with gap entries), so binary search.
+  auto it = std::upper_bound(m_entries.begin(), m_entries.end(), addr,
+                             [](u32 a, const MemoryMapEntry& e) { return a < e.start_addr; });
+  if (it != m_entries.begin() && addr < (it - 1)->end_addr) {
+    return *(it - 1);
   }
   ASSERT(false);
   throw std::runtime_error("MemoryMap::lookup failed");
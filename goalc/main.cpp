@@ -2,20 +2,24 @@
 #include <regex>
 
 #include "common/log/log.h"
+#include "common/repl/nrepl/ReplClient.h"
 #include "common/repl/nrepl/ReplServer.h"
 #include "common/repl/repl_wrapper.h"
 #include "common/util/FileUtil.h"
 #include "common/util/diff.h"
+#include "common/util/os.h"
 #include "common/util/string_util.h"
 #include "common/util/term_util.h"
 #include "common/util/unicode_util.h"
 #include "common/versions/versions.h"
 
+#include "goalc/compiler/CompileServer.h"
 #include "goalc/compiler/Compiler.h"
 
 #include "fmt/color.h"
 #include "fmt/core.h"
 #include "third-party/CLI11.hpp"
+#include "third-party/json.hpp"
 
 void setup_logging(const bool disable_ansi_colors) {
   lg::set_file_level(lg::level::info);
@@ -28,6 +32,28 @@ void setup_logging(const bool disable_ansi_colors) {
   lg::initialize();
 }
 
+/*!
+ * Run a command on a goalc that's already running with --server, instead of starting a compiler.
+ */
+int run_on_server(int port, const std::string& cmd) {
+  ReplClient client(port);
+  if (!client.connect()) {
+    lg::error("Could not connect to a compile server on port {}", port);
+    return 1;
+  }
+  auto resp = client.request(ReplServerMessageType::EVAL_WITH_RESULT, cmd);
+  if (!resp) {
+    lg::error("Lost the connection to the compile server on port {}", port);
+    return 1;
+  }
+  auto result = nlohmann::json::parse(*resp);
+  if (!result.at("ok").get<bool>()) {
+    lg::error("{}", result.at("error").get<std::string>());
+    return 1;
+  }
+  return 0;
+}
+
 int main(int argc, char** argv) {
   ArgumentGuard u8_guard(argc, argv);
 
@@ -36,6 +62,10 @@ int main(int argc, char** argv) {
   std::string username = "#f";
   std::string game = "jak1";
   int nrepl_port = -1;
+  int opt_level = 0;
+  bool use_fma = false;
+  bool server_mode = false;
+  bool client_mode = false;
   fs::path project_path_override;
   fs::path iso_path_override;
 
@@ -51,12 +81,31 @@ int main(int argc, char** argv) {
   app.add_option("--proj-path", project_path_override,
                  "Specify the location of the 'data/' folder");
   app.add_option("--iso-path", iso_path_override, "Specify the location of the 'iso_data/' folder");
+  app.add_option("-O,--opt-level", opt_level,
+                 "IR optimization level. 0 (default) is off, 1 runs the IR optimizer");
+  app.add_flag("--fma", use_fma,
+               "Use fused multiply-add for vf math if this CPU supports it. The compiled code "
+               "will only run on CPUs with FMA");
+  app.add_flag("--server", server_mode,
+               "Run as a compile server: keep the compiler loaded and take commands only over "
+               "nREPL, not from the terminal");
+  app.add_flag("--client", client_mode,
+               "Send '--cmd' to a goalc running with '--server' on the nREPL port instead of "
+               "starting a compiler. Exits with 1 if the command failed");
   define_common_cli_arguments(app);
   app.validate_positionals();
   CLI11_PARSE(app, argc, argv);
 
   GameVersion game_version = game_name_to_version(game);
 
+  if (use_fma) {
+    setup_cpu_info();
+    if (!get_cpu_info().has_fma) {
+      lg::warn("This CPU does not support FMA, ignoring --fma");
+      use_fma = false;
+    }
+  }
+
   if (!project_path_override.empty()) {
     if (!fs::exists(project_path_override)) {
       lg::error("Error: project path override '{}' does not exist", project_path_override.string());
@@ -96,13 +145,30 @@ int main(int argc, char** argv) {
     repl_config.iso_path = iso_path_override.string();
   }
 
+  if (client_mode) {
+    if (cmd.empty()) {
+      lg::error("--client needs a command to send with --cmd");
+      return 1;
+    }
+    return run_on_server(repl_config.get_nrepl_port(), cmd);
+  }
+
   // Init Compiler
   std::unique_ptr<Compiler> compiler;
   std::mutex compiler_mutex;
+  auto apply_codegen_options = [&](Compiler& c) {
+    if (opt_level > 0) {
+      c.enable_ir_optimizer();
+    }
+    if (use_fma) {
+      c.enable_fma();
+    }
+  };
   // if a command is provided on the command line, no REPL just run the compiler on it
   try {
     if (!cmd.empty()) {
       compiler = std::make_unique<Compiler>(game_version);
+      apply_codegen_options(*compiler);
       compiler->run_front_end_on_string(cmd);
       return 0;
     }
@@ -125,24 +191,27 @@ int main(int argc, char** argv) {
   std::function<bool()> shutdown_callback = [&]() { return status == ReplStatus::WANT_EXIT; };
   ReplServer repl_server(shutdown_callback, repl_config.get_nrepl_port());
   bool nrepl_server_ok = repl_server.init_server(true);
+  if (server_mode && !nrepl_server_ok) {
+    lg::error("Could not start the compile server on port {}", repl_config.get_nrepl_port());
+    return 1;
+  }
   std::thread nrepl_thread;
   // the compiler may throw an exception if it fails to load its standard library.
   try {
     compiler = std::make_unique<Compiler>(
         game_version, std::make_optional(repl_config), username,
         std::make_unique<REPL::Wrapper>(username, repl_config, startup_file, nrepl_server_ok));
+    apply_codegen_options(*compiler);
     // Start nREPL Server if it spun up successfully
     if (nrepl_server_ok) {
       nrepl_thread = std::thread([&]() {
         while (!shutdown_callback()) {
-          auto resp = repl_server.get_msg();
-          if (resp) {
-            std::lock_guard<std::mutex> lock(compiler_mutex);
-            status = compiler->handle_repl_string(resp.value());
-            // Print out the prompt, just for better UX
-            compiler->print_to_repl(compiler->get_prompt());
+          auto req = repl_server.get_request();
+          if (req) {
+            status = handle_nrepl_request(repl_server, *req, compiler, compiler_mutex);
+          } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50000));
           }
-          std::this_thread::sleep_for(std::chrono::microseconds(50000));
         }
       });
     }
@@ -159,8 +228,14 @@ int main(int argc, char** argv) {
         compiler = std::make_unique<Compiler>(
             game_version, std::make_optional(repl_config), username,
             std::make_unique<REPL::Wrapper>(username, repl_config, startup_file, nrepl_server_ok));
+        apply_codegen_options(*compiler);
         status = ReplStatus::OK;
       }
+      if (server_mode) {
+        // all input comes from nREPL
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        continue;
+      }
       // process user input
       std::string input_from_stdin = compiler->get_repl_input();
       if (!input_from_stdin.empty()) {
@@ -0,0 +1,122 @@
+#include "BuildCache.h"
+
+#include <chrono>
+#include <thread>
+
+#include "common/log/log.h"
+#include "common/util/hash.h"
+#include "common/util/string_util.h"
+
+#include "fmt/core.h"
+
+namespace {
+// bump this if the layout of cache entries changes.
+constexpr int kBuildCacheFormatVersion = 2;
+constexpr const char* kManifestName = "manifest.txt";
+
+std::string hash_string(const std::string& str) {
+  auto hash = hash_util::hash128(str.data(), str.size());
+  return fmt::format("{:016x}{:016x}", hash.hi, hash.lo);
+}
+
+std::optional<std::string> hash_file(const fs::path& path) {
+  if (!fs::exists(path)) {
+    return {};
+  }
+  auto data = file_util::read_binary_file(path);
+  auto hash = hash_util::hash128(data.data(), data.size());
+  return fmt::format("{:016x}{:016x}", hash.hi, hash.lo);
+}
+}  // namespace
+
+BuildCache::BuildCache(const fs::path& cache_dir) : m_dir(cache_dir) {
+  file_util::create_dir_if_needed(m_dir);
+}
+
+std::optional<std::string> BuildCache::get_key(Tool& tool,
+                                               const ToolInput& task,
+                                               const PathMap& path_map) {
+  std::string key_data = fmt::format("{} {} {} {} {}\n", kBuildCacheFormatVersion, tool.name(),
+                                     tool.version(), path_map.output_prefix, task.arg.print());
+  for (auto& out : task.output) {
+    key_data += fmt::format("out {}\n", out);
+  }
+  for (auto& in : tool.get_cache_inputs(task, path_map)) {
+    auto hash = hash_file(file_util::get_file_path({in}));
+    if (!hash) {
+      return {};
+    }
+    key_data += fmt::format("in {} {}\n", in, *hash);
+  }
+  return hash_string(key_data);
+}
+
+bool BuildCache::restore(const std::string& key, const ToolInput& task) {
+  const auto entry_dir = m_dir / key;
+  const auto manifest_path = entry_dir / kManifestName;
+  if (!fs::exists(manifest_path)) {
+    return false;
+  }
+
+  // manifest is one line per output, holding the hash of its contents.
+  auto lines = str_util::split(file_util::read_text_file(manifest_path), '\n');
+  std::vector<std::string> hashes;
+  for (auto& line : lines) {
+    if (!line.empty()) {
+      hashes.push_back(line);
+    }
+  }
+  if (hashes.size() != task.output.size()) {
+    lg::warn("Ignoring invalid build cache entry {}", entry_dir.string());
+    return false;
+  }
+
+  for (size_t i = 0; i < task.output.size(); i++) {
+    const auto out_path = fs::path(file_util::get_file_path({task.output[i]}));
+    if (hash_file(out_path) == hashes[i]) {
+      // already have the right file, just make it look up to date.
+      fs::last_write_time(out_path, fs::file_time_type::clock::now());
+    } else {
+      file_util::create_dir_if_needed_for_file(out_path);
+      fs::copy_file(entry_dir / std::to_string(i), out_path, fs::copy_options::overwrite_existing);
+    }
+  }
+  m_hits++;
+  return true;
+}
+
+void BuildCache::store(const std::string& key, const ToolInput& task) {
+  const auto entry_dir = m_dir / key;
+  if (fs::exists(entry_dir)) {
+    return;
+  }
+
+  // unique per thread and time, so concurrent builds never write to the same folder.
+  const auto thread_hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+  const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  const auto tmp_dir = m_dir / fmt::format("{}.tmp.{:x}.{}", key, thread_hash, now);
+  try {
+    file_util::create_dir_if_needed(tmp_dir);
+    std::string manifest;
+    for (size_t i = 0; i < task.output.size(); i++) {
+      const auto out_path = fs::path(file_util::get_file_path({task.output[i]}));
+      auto hash = hash_file(out_path);
+      if (!hash) {
+        // the tool didn't produce all of its outputs, don't cache it.
+        fs::remove_all(tmp_dir);
+        return;
+      }
+      fs::copy_file(out_path, tmp_dir / std::to_string(i));
+      manifest += *hash;
+      manifest += '\n';
+    }
+    file_util::write_text_file(tmp_dir / kManifestName, manifest);
+    fs::rename(tmp_dir, entry_dir);
+    m_stores++;
+  } catch (std::exception& e) {
+    // most likely another build added the same entry at the same time.
+    lg::debug("Failed to add build cache entry {}: {}", key, e.what());
+    std::error_code ec;
+    fs::remove_all(tmp_dir, ec);
+  }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include "common/util/FileUtil.h"
+
+#include "goalc/make/Tool.h"
+
+/*!
+ * A content-addressed cache of build step outputs.
+ *
+ * Each step is keyed by a hash of the tool, its version, the step's arguments and outputs, and the
+ * contents of all of its input files. If an entry exists for a key, the outputs are restored from
+ * the cache instead of running the tool, so this works even when timestamps are meaningless, like
+ * after a git checkout or on a fresh clone.
+ *
+ * The cache directory may be shared by multiple build machines: entries are written to a temporary
+ * folder and renamed into place, so a partially written entry is never visible.
+ */
+class BuildCache {
+ public:
+  explicit BuildCache(const fs::path& cache_dir);
+
+  /*!
+   * Get the cache key for a step, or nothing if the step can't be cached (missing input file).
+   */
+  std::optional<std::string> get_key(Tool& tool, const ToolInput& task, const PathMap& path_map);
+
+  /*!
+   * Restore the outputs of a step from the cache. Outputs that already have the right contents are
+   * just touched. Returns false if there is no valid entry for this key.
+   */
+  bool restore(const std::string& key, const ToolInput& task);
+
+  /*!
+   * Add the outputs of a step that was just run to the cache.
+   */
+  void store(const std::string& key, const ToolInput& task);
+
+  const fs::path& dir() const { return m_dir; }
+  int hit_count() const { return m_hits; }
+  int store_count() const { return m_stores; }
+
+ private:
+  fs::path m_dir;
+  std::atomic<int> m_hits = 0;
+  std::atomic<int> m_stores = 0;
+};
@@ -1,5 +1,10 @@
 #include "MakeSystem.h"
 
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include "common/goos/ParseHelpers.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
@@ -433,6 +438,41 @@ std::vector<std::string> MakeSystem::filter_dependencies(const std::vector<std::
   return result;
 }
 
+/*!
+ * For each step in deps, get the indices of the earlier steps in deps that it depends on.
+ * Dependencies that aren't in deps (already up to date) are left out.
+ */
+std::vector<std::vector<int>> MakeSystem::get_step_graph(const std::vector<std::string>& deps) {
+  std::unordered_map<const MakeStep*, int> step_to_idx;
+  for (size_t i = 0; i < deps.size(); i++) {
+    step_to_idx[m_output_to_step.at(deps[i]).get()] = i;
+  }
+
+  std::vector<std::vector<int>> result(deps.size());
+  for (size_t i = 0; i < deps.size(); i++) {
+    auto& rule = m_output_to_step.at(deps[i]);
+    auto& tool = m_tools.at(rule->tool);
+    auto add_dep = [&](const std::string& dep) {
+      const auto& dep_step = m_output_to_step.find(dep);
+      if (dep_step == m_output_to_step.end()) {
+        return;
+      }
+      const auto& dep_idx = step_to_idx.find(dep_step->second.get());
+      if (dep_idx != step_to_idx.end() && dep_idx->second < (int)i) {
+        result[i].push_back(dep_idx->second);
+      }
+    };
+    for (auto& dep : rule->deps) {
+      add_dep(dep);
+    }
+    for (auto& dep : tool->get_additional_dependencies(
+             {rule->input, rule->deps, rule->outputs, rule->arg}, m_path_map)) {
+      add_dep(dep);
+    }
+  }
+  return result;
+}
+
 namespace {
 void print_input(const std::vector<std::string>& in, char end) {
   int i = 0;
@@ -449,9 +489,236 @@ void print_input(const std::vector<std::string>& in, char end) {
     lg::print("{}{}{}", all_names, std::string(70 - all_names.length(), ' '), end);
   }
 }
+
+/*!
+ * Run a single step. Returns false and sets error if the tool fails or throws.
+ */
+bool run_step(Tool* tool,
+              MakeStep* rule,
+              const PathMap& path_map,
+              BuildCache* cache,
+              std::string* error) {
+  try {
+    const ToolInput task = {rule->input, rule->deps, rule->outputs, rule->arg};
+    std::optional<std::string> cache_key;
+    if (cache && tool->is_cacheable()) {
+      cache_key = cache->get_key(*tool, task, path_map);
+      if (cache_key && cache->restore(*cache_key, task)) {
+        return true;
+      }
+    }
+    if (tool->run(task, path_map)) {
+      if (cache_key) {
+        cache->store(*cache_key, task);
+      }
+      return true;
+    }
+  } catch (std::exception& e) {
+    *error = e.what();
+  }
+  return false;
+}
+
+void print_step_start(int percent, const Tool& tool, const MakeStep& rule, bool verbose) {
+  if (verbose) {
+    lg::print("[{:3d}%] [{:8s}] {}{}\n", percent, tool.name(), rule.input.at(0),
+              rule.input.size() > 1 ? ", ..." : "");
+  } else {
+    lg::print("[{:3d}%] [{:8s}]       ", percent, tool.name());
+    print_input(rule.input, '\r');
+  }
+}
+
+void print_step_done(int percent,
+                     const Tool& tool,
+                     const MakeStep& rule,
+                     double seconds,
+                     bool verbose) {
+  if (verbose) {
+    if (seconds > 0.05) {
+      lg::print(fg(fmt::color::yellow), " {:.3f}\n", seconds);
+    } else {
+      lg::print(" {:.3f}\n", seconds);
+    }
+  } else {
+    if (seconds > 0.05) {
+      lg::print("[{:3d}%] [{:8s}] ", percent, tool.name());
+      lg::print(fg(fmt::color::yellow), "{:.3f} ", seconds);
+      print_input(rule.input, '\n');
+    } else {
+      lg::print("[{:3d}%] [{:8s}] {:.3f} ", percent, tool.name(), seconds);
+      print_input(rule.input, '\n');
+    }
+  }
+}
+
+void fail_step(const MakeStep& rule, const std::string& error) {
+  if (!error.empty()) {
+    lg::print("\n");
+    lg::print("Error: {}\n", error);
+  }
+  lg::print("Build failed on {}{}\n", rule.input.at(0), rule.input.size() > 1 ? ", ..." : "");
+  throw std::runtime_error("Build failed.");
+}
+
+int step_percent(int idx, int count) {
+  return (100.0 * (1 + idx) / count) + 0.5;
+}
 }  // namespace
 
-bool MakeSystem::make(const std::string& target_in, bool force, bool verbose, bool gen_report) {
+void MakeSystem::run_steps_serial(const std::vector<std::string>& deps,
+                                  bool verbose,
+                                  std::vector<double>* step_seconds) {
+  for (size_t i = 0; i < deps.size(); i++) {
+    Timer step_timer;
+    auto& rule = m_output_to_step.at(deps[i]);
+    auto& tool = m_tools.at(rule->tool);
+    int percent = step_percent(i, deps.size());
+    print_step_start(percent, *tool, *rule, verbose);
+
+    std::string error;
+    if (!run_step(tool.get(), rule.get(), m_path_map, m_build_cache.get(), &error)) {
+      fail_step(*rule, error);
+    }
+
+    step_seconds->at(i) = step_timer.getSeconds();
+    print_step_done(percent, *tool, *rule, step_seconds->at(i), verbose);
+  }
+}
+
+/*!
+ * Run steps on a pool of num_jobs workers. A step starts once all of the steps it depends on have
+ * finished, and tools that aren't thread safe are never run at the same time as each other.
+ * Results are printed in the same order as the serial build, regardless of when steps finish.
+ */
+void MakeSystem::run_steps_parallel(const std::vector<std::string>& deps,
+                                    bool verbose,
+                                    int num_jobs,
+                                    std::vector<double>* step_seconds) {
+  const int num_steps = deps.size();
+  std::vector<MakeStep*> steps;
+  std::vector<Tool*> tools;
+  for (auto& dep : deps) {
+    auto& rule = m_output_to_step.at(dep);
+    steps.push_back(rule.get());
+    tools.push_back(m_tools.at(rule->tool).get());
+  }
+
+  std::vector<int> remaining_deps(num_steps);
+  std::vector<std::vector<int>> dependents(num_steps);
+  const auto graph = get_step_graph(deps);
+  for (int i = 0; i < num_steps; i++) {
+    remaining_deps[i] = graph[i].size();
+    for (int dep : graph[i]) {
+      dependents[dep].push_back(i);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::set<int> ready;  // ordered, so we prefer steps that come first in the serial order.
+  std::vector<bool> finished(num_steps, false);
+  std::vector<bool> succeeded(num_steps, false);
+  std::vector<std::string> errors(num_steps);
+  int num_started = 0;
+  int next_to_print = 0;
+  bool serial_lane_busy = false;
+  bool failed = false;
+
+  for (int i = 0; i < num_steps; i++) {
+    if (remaining_deps[i] == 0) {
+      ready.insert(i);
+    }
+  }
+
+  // must hold the lock.
+  auto pick_step = [&]() {
+    for (int idx : ready) {
+      if (tools[idx]->is_thread_safe() || !serial_lane_busy) {
+        return idx;
+      }
+    }
+    return -1;
+  };
+
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lk(mutex);
+    while (true) {
+      int idx = -1;
+      cv.wait(lk, [&]() {
+        return failed || num_started == num_steps || (idx = pick_step()) != -1;
+      });
+      if (idx == -1) {
+        return;
+      }
+
+      ready.erase(idx);
+      num_started++;
+      const bool serial = !tools[idx]->is_thread_safe();
+      if (serial) {
+        serial_lane_busy = true;
+      }
+      lk.unlock();
+
+      Timer step_timer;
+      std::string error;
+      bool success = run_step(tools[idx], steps[idx], m_path_map, m_build_cache.get(), &error);
+      double seconds = step_timer.getSeconds();
+
+      lk.lock();
+      if (serial) {
+        serial_lane_busy = false;
+      }
+      finished[idx] = true;
+      succeeded[idx] = success;
+      errors[idx] = error;
+      step_seconds->at(idx) = seconds;
+      if (success) {
+        for (int dependent : dependents[idx]) {
+          if (--remaining_deps[dependent] == 0) {
+            ready.insert(dependent);
+          }
+        }
+      } else {
+        failed = true;
+      }
+
+      while (next_to_print < num_steps && finished[next_to_print] && succeeded[next_to_print]) {
+        if (verbose) {
+          print_step_start(step_percent(next_to_print, num_steps), *tools[next_to_print],
+                           *steps[next_to_print], verbose);
+        }
+        print_step_done(step_percent(next_to_print, num_steps), *tools[next_to_print],
+                        *steps[next_to_print], step_seconds->at(next_to_print), verbose);
+        next_to_print++;
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < std::min(num_jobs, num_steps); i++) {
+    threads.emplace_back(worker);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  if (failed) {
+    for (int i = 0; i < num_steps; i++) {
+      if (finished[i] && !succeeded[i]) {
+        fail_step(*steps[i], errors[i]);
+      }
+    }
+  }
+  ASSERT(next_to_print == num_steps);
+}
+
+bool MakeSystem::make(const std::string& target_in,
+                      bool force,
+                      bool verbose,
+                      bool gen_report,
+                      std::optional<int> num_jobs) {
   std::string target = m_path_map.apply_remaps(target_in);
   auto deps = get_dependencies(target);
   //  lg::print("All deps:\n");
@@ -483,62 +750,46 @@ bool MakeSystem::make(const std::string& target_in, bool force, bool verbose, bo
                                    str_util::current_isotimestamp());
   }
 
-  Timer make_timer;
-  lg::print("Building {} targets...\n", deps.size());
-  int i = 0;
-  for (auto& to_make : deps) {
-    Timer step_timer;
-    auto& rule = m_output_to_step.at(to_make);
-    auto& tool = m_tools.at(rule->tool);
-    int percent = (100.0 * (1 + (i++)) / (deps.size())) + 0.5;
-    if (verbose) {
-      lg::print("[{:3d}%] [{:8s}] {}{}\n", percent, tool->name(), rule->input.at(0),
-                rule->input.size() > 1 ? ", ..." : "");
-    } else {
-      lg::print("[{:3d}%] [{:8s}]       ", percent, tool->name());
-      print_input(rule->input, '\r');
-    }
-
-    bool success = false;
-    try {
-      success = tool->run({rule->input, rule->deps, rule->outputs, rule->arg}, m_path_map);
-    } catch (std::exception& e) {
-      lg::print("\n");
-      lg::print("Error: {}\n", e.what());
-    }
-    if (!success) {
-      lg::print("Build failed on {}{}\n", rule->input.at(0), rule->input.size() > 1 ? ", ..." : "");
-      throw std::runtime_error("Build failed.");
-      return false;
-    }
+  int jobs = num_jobs.value_or(m_repl_config ? m_repl_config->make_jobs : 1);
+  if (jobs <= 0) {
+    jobs = std::max(1u, std::thread::hardware_concurrency());
+  }
 
-    const auto seconds = step_timer.getSeconds();
-    if (verbose) {
-      if (seconds > 0.05) {
-        lg::print(fg(fmt::color::yellow), " {:.3f}\n", seconds);
-      } else {
-        lg::print(" {:.3f}\n", seconds);
-      }
-    } else {
-      if (seconds > 0.05) {
-        lg::print("[{:3d}%] [{:8s}] ", percent, tool->name());
-        lg::print(fg(fmt::color::yellow), "{:.3f} ", seconds);
-        print_input(rule->input, '\n');
-      } else {
-        lg::print("[{:3d}%] [{:8s}] {:.3f} ", percent, tool->name(), seconds);
-        print_input(rule->input, '\n');
-      }
-    }
+  // the cache directory can be shared between machines, so allow it to be set per-machine.
+  std::string cache_dir = m_repl_config ? m_repl_config->build_cache_dir : "";
+  if (const char* cache_dir_env = std::getenv("OPENGOAL_BUILD_CACHE")) {
+    cache_dir = cache_dir_env;
+  }
+  if (cache_dir.empty()) {
+    m_build_cache.reset();
+  } else if (!m_build_cache || m_build_cache->dir() != fs::path(cache_dir)) {
+    m_build_cache = std::make_unique<BuildCache>(cache_dir);
+  }
+  const int cache_hits_before = m_build_cache ? m_build_cache->hit_count() : 0;
 
-    if (gen_report) {
-      report_contents +=
-          fmt::format("\"{}\": {}{}", str_util::split_string(rule->input.at(0), "/").back(),
-                      seconds, i == deps.size() ? "" : ",");
-    }
+  Timer make_timer;
+  lg::print("Building {} targets...\n", deps.size());
+  std::vector<double> step_seconds(deps.size());
+  if (jobs == 1 || deps.size() <= 1) {
+    run_steps_serial(deps, verbose, &step_seconds);
+  } else {
+    lg::print("Using {} jobs\n", jobs);
+    run_steps_parallel(deps, verbose, jobs, &step_seconds);
   }
+
   lg::print("\nSuccessfully built all {} targets in {:.3f}s\n", deps.size(),
             make_timer.getSeconds());
+  if (m_build_cache) {
+    lg::print("Restored {} targets from the build cache at {}\n",
+              m_build_cache->hit_count() - cache_hits_before, m_build_cache->dir().string());
+  }
   if (gen_report) {
+    for (size_t i = 0; i < deps.size(); i++) {
+      auto& rule = m_output_to_step.at(deps[i]);
+      report_contents +=
+          fmt::format("\"{}\": {}{}", str_util::split_string(rule->input.at(0), "/").back(),
+                      step_seconds[i], i + 1 == deps.size() ? "" : ",");
+    }
     report_contents += fmt::format("}}, 'total': {}}});", make_timer.getSeconds());
     str_util::replace(report_output, "// DATA ENDS\n",
                       fmt::format("{}\n// DATA ENDS\n", report_contents));
@@ -3,6 +3,7 @@
 #include "common/goos/Interpreter.h"
 #include "common/util/FileUtil.h"
 
+#include "goalc/make/BuildCache.h"
 #include "goalc/make/Tool.h"
 
 struct MakeStep {
@@ -58,7 +59,11 @@ class MakeSystem {
   std::vector<std::string> get_dependencies(const std::string& target) const;
   std::vector<std::string> filter_dependencies(const std::vector<std::string>& all_deps);
 
-  bool make(const std::string& target, bool force, bool verbose, bool gen_report);
+  bool make(const std::string& target,
+            bool force,
+            bool verbose,
+            bool gen_report,
+            std::optional<int> num_jobs = {});
 
   void add_tool(std::shared_ptr<Tool> tool);
   void set_constant(const std::string& name, const std::string& value);
@@ -90,6 +95,15 @@ class MakeSystem {
                         std::vector<std::string>* result_order,
                         std::unordered_set<std::string>* result_set) const;
 
+  std::vector<std::vector<int>> get_step_graph(const std::vector<std::string>& deps);
+  void run_steps_serial(const std::vector<std::string>& deps,
+                        bool verbose,
+                        std::vector<double>* step_seconds);
+  void run_steps_parallel(const std::vector<std::string>& deps,
+                          bool verbose,
+                          int num_jobs,
+                          std::vector<double>* step_seconds);
+
   goos::Interpreter m_goos;
 
   std::optional<REPL::Config> m_repl_config;
@@ -100,4 +114,5 @@ class MakeSystem {
   PathMap m_path_map;
   std::vector<std::string> m_gsrc_folder;
   std::map<std::string, std::string> m_gsrc_files = {};
+  std::unique_ptr<BuildCache> m_build_cache;
 };
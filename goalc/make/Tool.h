@@ -28,6 +28,28 @@ class Tool {
     return {};
   }
   virtual bool needs_run(const ToolInput& task, const PathMap& path_map);
+  /*!
+   * Can run() be called on this tool from multiple threads at the same time?
+   * Tools that aren't thread safe all share a single lane in the make scheduler, so at most one of
+   * them is running at a time.
+   */
+  virtual bool is_thread_safe() const { return false; }
+  /*!
+   * Can the outputs of this tool be stored in and restored from the build cache? This requires that
+   * the outputs only depend on the files returned by get_cache_inputs, and that running the tool
+   * has no side effects other than writing its outputs.
+   */
+  virtual bool is_cacheable() const { return false; }
+  /*!
+   * Files whose contents determine the outputs of this tool. By default, the inputs and all
+   * dependencies.
+   */
+  virtual std::vector<std::string> get_cache_inputs(const ToolInput& task,
+                                                    const PathMap& path_map);
+  /*!
+   * Increment this when a change to a tool changes its output, to invalidate cached outputs.
+   */
+  virtual int version() const { return 1; }
   virtual ~Tool() = default;
 
   const std::string& name() const { return m_name; }
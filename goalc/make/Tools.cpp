@@ -45,7 +45,7 @@ bool CompilerTool::run(const ToolInput& task, const PathMap& /*path_map*/) {
 
 namespace {
 DgoDescription parse_desc_file(const std::string& filename, goos::Reader& reader) {
-  auto& dgo_desc = reader.read_from_file({filename}).as_pair()->cdr;
+  auto dgo_desc = reader.read_from_file({filename}).as_pair()->cdr;
   if (goos::list_length(dgo_desc) != 1) {
     throw std::runtime_error("Invalid DGO description - got too many lists");
   }
@@ -88,7 +88,9 @@ bool DgoTool::run(const ToolInput& task, const PathMap& path_map) {
   if (task.input.size() != 1) {
     throw std::runtime_error(fmt::format("Invalid amount of inputs to {} tool", name()));
   }
-  auto desc = parse_desc_file(task.input.at(0), m_reader);
+  // use a local reader, the make system may run multiple dgo steps at once.
+  goos::Reader reader;
+  auto desc = parse_desc_file(task.input.at(0), reader);
   build_dgo(desc, path_map.output_prefix);
   return true;
 }
@@ -96,7 +98,9 @@ bool DgoTool::run(const ToolInput& task, const PathMap& path_map) {
 std::vector<std::string> DgoTool::get_additional_dependencies(const ToolInput& task,
                                                               const PathMap& path_map) {
   std::vector<std::string> result;
-  auto desc = parse_desc_file(task.input.at(0), m_reader);
+  // cache keys are computed on the make workers too, so this also needs its own reader.
+  goos::Reader reader;
+  auto desc = parse_desc_file(task.input.at(0), reader);
   for (auto& x : desc.entries) {
     // todo out
     result.push_back(fmt::format("out/{}obj/{}", path_map.output_prefix, x.file_name));
@@ -153,6 +157,17 @@ bool TextTool::needs_run(const ToolInput& task, const PathMap& path_map) {
   return Tool::needs_run({task.input, deps, task.output, task.arg}, path_map);
 }
 
+std::vector<std::string> TextTool::get_cache_inputs(const ToolInput& task,
+                                                    const PathMap& path_map) {
+  std::vector<std::string> result = {task.input.at(0)};
+  std::vector<GameTextDefinitionFile> files;
+  open_text_project("text", task.input.at(0), files);
+  for (auto& file : files) {
+    result.push_back(path_map.apply_remaps(file.file_path));
+  }
+  return result;
+}
+
 bool TextTool::run(const ToolInput& task, const PathMap& path_map) {
   GameTextDB db;
   std::vector<GameTextDefinitionFile> files;
@@ -217,6 +232,14 @@ bool SubtitleTool::needs_run(const ToolInput& task, const PathMap& path_map) {
   return Tool::needs_run({task.input, deps, task.output, task.arg}, path_map);
 }
 
+std::vector<std::string> SubtitleTool::get_cache_inputs(const ToolInput& task,
+                                                        const PathMap& path_map) {
+  std::vector<GameSubtitleDefinitionFile> files;
+  std::vector<std::string> result = {task.input.at(0)};
+  enumerate_subtitle_project_files(name(), task.input.at(0), path_map, files, result);
+  return result;
+}
+
 bool SubtitleTool::run(const ToolInput& task, const PathMap& path_map) {
   GameSubtitleDB db;
   db.m_subtitle_version = GameSubtitleDB::SubtitleFormat::V1;
@@ -238,6 +261,14 @@ bool SubtitleV2Tool::needs_run(const ToolInput& task, const PathMap& path_map) {
   return Tool::needs_run({task.input, deps, task.output, task.arg}, path_map);
 }
 
+std::vector<std::string> SubtitleV2Tool::get_cache_inputs(const ToolInput& task,
+                                                          const PathMap& path_map) {
+  std::vector<GameSubtitleDefinitionFile> files;
+  std::vector<std::string> result = {task.input.at(0)};
+  enumerate_subtitle_project_files(name(), task.input.at(0), path_map, files, result);
+  return result;
+}
+
 bool SubtitleV2Tool::run(const ToolInput& task, const PathMap& path_map) {
   GameSubtitleDB db;
   db.m_subtitle_version = GameSubtitleDB::SubtitleFormat::V2;
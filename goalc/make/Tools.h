@@ -20,35 +20,43 @@ class DgoTool : public Tool {
  public:
   DgoTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
   std::vector<std::string> get_additional_dependencies(const ToolInput&,
                                                        const PathMap& path_map) override;
-
- private:
-  goos::Reader m_reader;
 };
 
 class TpageDirTool : public Tool {
  public:
   TpageDirTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
 };
 
 class CopyTool : public Tool {
  public:
   CopyTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
 };
 
 class GameCntTool : public Tool {
  public:
   GameCntTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
 };
 
 class TextTool : public Tool {
  public:
   TextTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
+  std::vector<std::string> get_cache_inputs(const ToolInput& task,
+                                            const PathMap& path_map) override;
   bool needs_run(const ToolInput& task, const PathMap& path_map) override;
 };
 
@@ -56,12 +64,17 @@ class GroupTool : public Tool {
  public:
   GroupTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
 };
 
 class SubtitleTool : public Tool {
  public:
   SubtitleTool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
+  std::vector<std::string> get_cache_inputs(const ToolInput& task,
+                                            const PathMap& path_map) override;
   bool needs_run(const ToolInput& task, const PathMap& path_map) override;
 };
 
@@ -69,6 +82,10 @@ class SubtitleV2Tool : public Tool {
  public:
   SubtitleV2Tool();
   bool run(const ToolInput& task, const PathMap& path_map) override;
+  bool is_thread_safe() const override { return true; }
+  bool is_cacheable() const override { return true; }
+  std::vector<std::string> get_cache_inputs(const ToolInput& task,
+                                            const PathMap& path_map) override;
   bool needs_run(const ToolInput& task, const PathMap& path_map) override;
 };
 
@@ -1,6 +1,7 @@
 #include "Allocator_v2.h"
 
 #include <algorithm>
+#include <array>
 #include <optional>
 #include <unordered_map>
 
@@ -181,6 +182,11 @@ class VarAssignment {
     }
   }
 
+  // starting at first_live(), the temporary register used at each instruction (if any)
+  const std::vector<std::optional<emitter::Register>>& stack_slot_regs() const {
+    return m_stack_temp_regs;
+  }
+
   emitter::Register get_stack_slot_reg(int instr_idx) const {
     ASSERT(assigned_to_stack());
     ASSERT(m_stack_temp_regs.at(instr_idx - first_live()));
@@ -256,6 +262,13 @@ struct RACache {
   std::vector<std::vector<s32>> live_per_instruction;
 
   std::vector<IRegSet> liveout_per_instr;
+  // per register, per instruction, the number of live vars that occupy the register, either by
+  // being assigned to it or by using it as a stack temporary. Lets most instructions skip the
+  // live_per_instruction scan when checking an assignment.
+  std::array<std::vector<u16>, emitter::RegisterInfo::N_REGS> reg_users;
+  // per instruction, bitmasks (by register id) of clobbered and excluded registers.
+  std::vector<u32> clobber_mask;
+  std::vector<u32> exclude_mask;
   int current_stack_slot = 0;
   bool used_stack = false;
   bool failed_alloc = false;
@@ -268,6 +281,41 @@ struct RACache {
   } stats;
 };
 
+/*!
+ * Update reg_users for a var occupying reg at a single instruction.
+ */
+void update_reg_users_at(RACache* cache, int var_idx, emitter::Register reg, int instr, int delta) {
+  if (cache->used_var.at(var_idx) && cache->vars.at(var_idx).live(instr)) {
+    auto& count = cache->reg_users[reg.id()].at(instr);
+    ASSERT(delta > 0 || count > 0);
+    count += delta;
+  }
+}
+
+/*!
+ * Update reg_users for a var occupying reg over its entire live range.
+ */
+void update_reg_users(RACache* cache, int var_idx, emitter::Register reg, int delta) {
+  const auto& var = cache->vars.at(var_idx);
+  for (int i = var.first_live(); i <= var.last_live(); i++) {
+    update_reg_users_at(cache, var_idx, reg, i, delta);
+  }
+}
+
+/*!
+ * Clear all of a stack var's temporary registers.
+ */
+void clear_stack_slot_regs(RACache* cache, int var_idx) {
+  auto& var = cache->vars.at(var_idx);
+  const auto& temp_regs = var.stack_slot_regs();
+  for (int i = 0; i < (int)temp_regs.size(); i++) {
+    if (temp_regs[i]) {
+      update_reg_users_at(cache, var_idx, *temp_regs[i], var.first_live() + i, -1);
+    }
+  }
+  var.clear_stack_slot_regs();
+}
+
 struct AssignmentOrder {
   std::vector<emitter::Register> xmms, gprs;
 };
@@ -514,6 +562,20 @@ void do_liveliness_analysis(const AllocationInput& input, RACache* cache) {
       cache->liveout_per_instr.at(intsr_idx) = block.live.at(idx_in_block);
     }
   }
+
+  for (auto& users : cache->reg_users) {
+    users.resize(input.instructions.size());
+  }
+  cache->clobber_mask.resize(input.instructions.size());
+  cache->exclude_mask.resize(input.instructions.size());
+  for (u32 i = 0; i < input.instructions.size(); i++) {
+    for (auto& reg : input.instructions[i].clobber) {
+      cache->clobber_mask[i] |= 1u << reg.id();
+    }
+    for (auto& reg : input.instructions[i].exclude) {
+      cache->exclude_mask[i] |= 1u << reg.id();
+    }
+  }
 }
 
 /*!
@@ -526,6 +588,7 @@ void do_constrained_alloc(RACache* cache, const AllocationInput& input, bool tra
       lg::print("[RA] Apply constraint {}\n", constr.to_string());
     }
     cache->vars.at(var_id).constrain_to_register(constr.desired_register);
+    update_reg_users(cache, var_id, constr.desired_register, 1);
   }
 }
 
@@ -588,24 +651,30 @@ bool check_constrained_alloc(RACache* cache, const AllocationInput& in) {
   // - programmer actually asked for this.
   // In the second case, rlet will put both rletted variables into the same ireg, so we won't
   // see it from the register allocation.
+  // Only the constrained vars are assigned at this point, so just look at those.
+  std::vector<s32> assigned_live;
   for (uint32_t i = 0; i < in.instructions.size(); i++) {
-    for (auto idx1 : cache->live_per_instruction.at(i)) {
+    assigned_live.clear();
+    for (auto idx : cache->live_per_instruction.at(i)) {
+      if (cache->vars.at(idx).assigned_to_reg()) {
+        assigned_live.push_back(idx);
+      }
+    }
+    for (auto idx1 : assigned_live) {
       auto& lr1 = cache->vars.at(idx1);
-      for (auto idx2 : cache->live_per_instruction.at(i)) {
+      for (auto idx2 : assigned_live) {
         if (idx1 == idx2) {
           continue;
         }
         auto& lr2 = cache->vars.at(idx2);
-        if (lr1.assigned_to_reg() && lr2.assigned_to_reg()) {
-          if (lr1.reg() == lr2.reg() && !safe_overlap(in, *cache, lr1, lr2, i)) {
-            // todo, this error won't be helpful
-            lg::print(
-                "[RegAlloc Error] {} Cannot satisfy constraints at instruction {} due to "
-                "constraints "
-                "on {} and {}, both are assigned to register {}\n",
-                in.function_name, i, lr1.var(), lr2.var(), lr1.reg().print());
-            ok = false;
-          }
+        if (lr1.reg() == lr2.reg() && !safe_overlap(in, *cache, lr1, lr2, i)) {
+          // todo, this error won't be helpful
+          lg::print(
+              "[RegAlloc Error] {} Cannot satisfy constraints at instruction {} due to "
+              "constraints "
+              "on {} and {}, both are assigned to register {}\n",
+              in.function_name, i, lr1.var(), lr2.var(), lr1.reg().print());
+          ok = false;
         }
       }
     }
@@ -642,14 +711,17 @@ bool vector_contains(const std::vector<T>& vec, const T& obj) {
 }
 
 /*!
- * Is it okay to assign the given variable to the register?
+ * Does another live var occupy reg at the given instruction, in a way that conflicts with var_idx?
  */
-bool check_register_assign_at(const AllocationInput& input,
-                              RACache& cache,
-                              int var_idx,
-                              int instr_idx,
-                              emitter::Register reg) {
-  // Step 1: check other assignments
+bool other_var_conflicts_at(const AllocationInput& input,
+                            RACache& cache,
+                            int var_idx,
+                            int instr_idx,
+                            emitter::Register reg) {
+  // most instructions have nobody in this register, don't bother looking.
+  if (!cache.reg_users[reg.id()].at(instr_idx)) {
+    return false;
+  }
 
   // look at everybody else in the interference graph
   for (int other_idx : cache.live_per_instruction.at(instr_idx)) {
@@ -666,26 +738,37 @@ bool check_register_assign_at(const AllocationInput& input,
       if (other_var.assigned_to_reg(reg)) {
         // assigned to the same register as us!
         if (!safe_overlap(input, cache, cache.vars.at(var_idx), other_var, instr_idx)) {
-          return false;
+          return true;
         }
       }
     } else {
       // assigned to stack TODO
       if (other_var.stack_bonus_op_needs_reg(reg, instr_idx)) {
-        return false;
+        return true;
       }
     }
   }
+  return false;
+}
+
+/*!
+ * Is it okay to assign the given variable to the register?
+ */
+bool check_register_assign_at(const AllocationInput& input,
+                              RACache& cache,
+                              int var_idx,
+                              int instr_idx,
+                              emitter::Register reg) {
+  // Step 1: check other assignments
+  if (other_var_conflicts_at(input, cache, var_idx, instr_idx, reg)) {
+    return false;
+  }
 
   // Step 2: check clobbers and excludes.
   // The model for clobber is that each instruction reads, clobbers, then writes.
   // so in some cases it's okay to clobber.
-
-  // loop over our live range
-
-  const auto& instr = input.instructions.at(instr_idx);
-
-  if (vector_contains(instr.clobber, reg)) {
+  const u32 reg_bit = 1u << reg.id();
+  if (cache.clobber_mask.at(instr_idx) & reg_bit) {
     // there's two cases where this is okay.
     // 1: if we aren't live-out. The clobber won't clobber anything.
     if (!cache.liveout_per_instr.at(instr_idx)[var_idx]) {
@@ -699,7 +782,7 @@ bool check_register_assign_at(const AllocationInput& input,
     }
   }
 
-  if (vector_contains(instr.exclude, reg)) {
+  if (cache.exclude_mask.at(instr_idx) & reg_bit) {
     return false;
   }
 
@@ -714,53 +797,11 @@ bool check_register_assign(const AllocationInput& input,
                            int var_idx,
                            emitter::Register reg) {
   auto& this_var = cache.vars.at(var_idx);
-
-  // Step 1: check other assignments
-
-  // loop over our live range
-  for (int instr = this_var.first_live(); instr <= this_var.last_live(); instr++) {
-    // and leave out the ones where we're dead
-    if (!this_var.live(instr)) {
-      continue;
-    }
-
-    // look at everybody else in the interference graph
-    for (int other_idx : cache.live_per_instruction.at(instr)) {
-      // don't check ourselves
-      if (other_idx == var_idx) {
-        continue;
-      }
-
-      // we are both live here.
-      const auto& other_var = cache.vars.at(other_idx);
-      if (other_var.unassigned()) {
-        // skip unassigned.
-        continue;
-      } else if (other_var.assigned_to_reg()) {
-        if (other_var.assigned_to_reg(reg)) {
-          // assigned to the same register as us!
-          if (!safe_overlap(input, cache, this_var, other_var, instr)) {
-            ;
-            return false;
-          }
-        }
-      } else {
-        // assigned to stack TODO
-        if (other_var.stack_bonus_op_needs_reg(reg, instr)) {
-          return false;
-        }
-      }
-    }
-  }
-
-  // Step 2: check clobbers and excludes.
-  // The model for clobber is that each instruction reads, clobbers, then writes.
-  // so in some cases it's okay to clobber.
+  const u32 reg_bit = 1u << reg.id();
 
   // loop over our live range
   for (int instr_idx = this_var.first_live(); instr_idx <= this_var.last_live(); instr_idx++) {
-    const auto& instr = input.instructions.at(instr_idx);
-    if (vector_contains(instr.exclude, reg)) {
+    if (cache.exclude_mask.at(instr_idx) & reg_bit) {
       return false;
     }
 
@@ -769,19 +810,22 @@ bool check_register_assign(const AllocationInput& input,
       continue;
     }
 
-    if (vector_contains(instr.clobber, reg)) {
+    // check clobbers. The model for clobber is that each instruction reads, clobbers, then
+    // writes. so in some cases it's okay to clobber.
+    if (cache.clobber_mask.at(instr_idx) & reg_bit) {
       // there's two cases where this is okay.
       // 1: if we aren't live-out. The clobber won't clobber anything.
-      if (!cache.liveout_per_instr.at(instr_idx)[var_idx]) {
-        continue;
-      } else {
-        // otherwise, we need to write it.
-        if (!instr.writes(var_idx)) {
-          return false;
-        }
-        // 2: we write it after the clobber.
+      // 2: we write it after the clobber.
+      if (cache.liveout_per_instr.at(instr_idx)[var_idx] &&
+          !input.instructions.at(instr_idx).writes(var_idx)) {
+        return false;
       }
     }
+
+    // check other assignments
+    if (other_var_conflicts_at(input, cache, var_idx, instr_idx, reg)) {
+      return false;
+    }
   }
 
   return true;
@@ -842,6 +886,7 @@ bool try_demote_stack(const AllocationInput& input,
   }
 
   int my_slot = get_stack_slot_for_var(var_idx, cache);
+  update_reg_users(cache, var_idx, var.reg(), -1);
   var.demote_to_stack(my_slot);
   setup_stack_bonus_ops(input, cache, var_idx, settings, my_slot);
   return true;
@@ -893,6 +938,7 @@ loop_top:
         if (vector_contains(allowable_local_var_move_elim, reg)) {
           if (check_register_assign_at(input, *cache, var_idx, instr_idx, reg)) {
             var.set_stack_slot_reg(reg, instr_idx);
+            update_reg_users_at(cache, var_idx, reg, instr_idx, 1);
             bonus.reg = reg;
             bonus.slot = my_slot;
             success = true;
@@ -905,6 +951,7 @@ loop_top:
     for (auto reg : order) {
       if (check_register_assign_at(input, *cache, var_idx, instr_idx, reg)) {
         var.set_stack_slot_reg(reg, instr_idx);
+        update_reg_users_at(cache, var_idx, reg, instr_idx, 1);
         bonus.reg = reg;
         bonus.slot = my_slot;
         success = true;
@@ -920,7 +967,7 @@ loop_top:
         }
 
         if (try_demote_stack(input, cache, other_var_idx, settings)) {
-          var.clear_stack_slot_regs();
+          clear_stack_slot_regs(cache, var_idx);
           goto loop_top;
         }
       }
@@ -940,7 +987,7 @@ loop_top:
         if (other_var.seen() && (other_var.first_live() <= var.last_live()) &&
             (var.first_live() <= other_var.last_live())) {
           if (try_demote_stack(input, cache, other_var_idx, settings)) {
-            var.clear_stack_slot_regs();
+            clear_stack_slot_regs(cache, var_idx);
             goto loop_top;
           }
         }
@@ -1021,6 +1068,7 @@ bool run_assignment_on_var(const AllocationInput& input,
 
           if (worked) {
             var.assign_to_register(other_var.reg());
+            update_reg_users(cache, var_idx, var.reg(), 1);
             assigned_to_reg = true;
           }
         }
@@ -1049,6 +1097,7 @@ bool run_assignment_on_var(const AllocationInput& input,
 
           if (worked) {
             var.assign_to_register(other_var.reg());
+            update_reg_users(cache, var_idx, var.reg(), 1);
             assigned_to_reg = true;
           }
         }
@@ -1067,6 +1116,7 @@ bool run_assignment_on_var(const AllocationInput& input,
         }
         if (worked) {
           var.assign_to_register(reg);
+          update_reg_users(cache, var_idx, reg, 1);
           assigned_to_reg = true;
           break;
         }
@@ -1131,7 +1181,6 @@ AllocationResult allocate_registers_v2(const AllocationInput& input) {
 
   // STEP 2: Constrained allocation.
   do_constrained_alloc(&cache, input, input.debug_settings.trace_debug_constraints);
-  check_constrained_alloc(&cache, input);
   if (!check_constrained_alloc(&cache, input)) {
     result.ok = false;
     lg::print("[RegAlloc Error] Register allocation has failed due to bad constraints.\n");
@@ -1182,27 +1231,22 @@ AllocationResult allocate_registers_v2(const AllocationInput& input) {
   result.stack_slots_for_vars = input.stack_slots_for_stack_vars;
 
   // check for use of saved registers
-  for (auto sr : emitter::gRegInfo.get_all_saved()) {
-    bool uses_sr = false;
-    for (auto& lr : cache.vars) {
-      for (int instr_idx = lr.first_live(); instr_idx <= lr.last_live(); instr_idx++) {
-        if (lr.assigned_to_reg()) {
-          if (lr.assigned_to_reg(sr)) {
-            uses_sr = true;
-            break;
-          }
-        } else if (lr.assigned_to_stack()) {
-          if (lr.stack_bonus_op_needs_reg(sr, instr_idx)) {
-            uses_sr = true;
-            break;
-          }
-        }
+  u32 used_reg_mask = 0;
+  for (auto& lr : cache.vars) {
+    if (lr.assigned_to_reg()) {
+      if (lr.first_live() <= lr.last_live()) {
+        used_reg_mask |= 1u << lr.reg().id();
       }
-      if (uses_sr) {
-        break;
+    } else if (lr.assigned_to_stack()) {
+      for (auto& temp_reg : lr.stack_slot_regs()) {
+        if (temp_reg) {
+          used_reg_mask |= 1u << temp_reg->id();
+        }
       }
     }
-    if (uses_sr) {
+  }
+  for (auto sr : emitter::gRegInfo.get_all_saved()) {
+    if (used_reg_mask & (1u << sr.id())) {
       result.used_saved_regs.push_back(sr);
     }
   }
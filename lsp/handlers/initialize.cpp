@@ -4,7 +4,7 @@ namespace lsp_handlers {
 std::optional<json> initialize(Workspace& /*workspace*/, int /*id*/, json /*params*/) {
   json text_document_sync{
       {"openClose", true},
-      {"change", 1},  // Full sync
+      {"change", 2},  // Incremental sync
       {"willSave", true},
       {"willSaveWaitUntil", false},
       {"save", {{"includeText", false}}},
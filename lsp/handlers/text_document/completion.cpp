@@ -1,5 +1,9 @@
 #include "completion.h"
 
+#include <set>
+
+#include "fmt/core.h"
+
 namespace lsp_handlers {
 
 std::unordered_map<symbol_info::Kind, LSPSpec::CompletionItemKind> completion_item_kind_map = {
@@ -14,6 +18,9 @@ std::unordered_map<symbol_info::Kind, LSPSpec::CompletionItemKind> completion_it
     {symbol_info::Kind::TYPE, LSPSpec::CompletionItemKind::Class},
 };
 
+// only the best matches are sent, the client asks again as more is typed.
+constexpr int kMaxCompletionNames = 100;
+
 std::optional<json> get_completions(Workspace& workspace, int /*id*/, json params) {
   auto converted_params = params.get<LSPSpec::CompletionParams>();
   const auto file_type = workspace.determine_filetype_from_uri(converted_params.textDocument.m_uri);
@@ -26,6 +33,7 @@ std::optional<json> get_completions(Workspace& workspace, int /*id*/, json param
     return nullptr;
   }
   std::vector<LSPSpec::CompletionItem> items;
+  bool incomplete = false;
   const auto& tracked_file = maybe_tracked_file.value().get();
   // The cursor position in the context of completions is always 1 character ahead of the text, we
   // move it back 1 spot so we can actually detect what the user has typed so far
@@ -37,20 +45,25 @@ std::optional<json> get_completions(Workspace& workspace, int /*id*/, json param
   if (!symbol) {
     lg::debug("get_completions - no symbol to work from");
   } else {
-    const auto matching_symbols =
-        workspace.get_symbols_starting_with(tracked_file.m_game_version, symbol.value());
+    const auto matching_symbols = workspace.get_symbols_matching(
+        tracked_file.m_game_version, symbol.value(), kMaxCompletionNames);
     lg::debug("get_completions - found {} symbols", matching_symbols.size());
 
+    std::set<std::string> names;
     for (const auto& symbol : matching_symbols) {
+      names.insert(symbol->m_name);
       LSPSpec::CompletionItem item;
       item.label = symbol->m_name;
       item.kind = completion_item_kind_map.at(symbol->m_kind);
+      // keep our ranking, instead of the client sorting by name
+      item.sortText = fmt::format("{:05d}", items.size());
       // TODO - flesh out this more fully when auto-complete with non-globals works as well
       items.push_back(item);
     }
+    incomplete = (int)names.size() >= kMaxCompletionNames;
   }
   LSPSpec::CompletionList list_result;
-  list_result.isIncomplete = false;  // we want further typing to re-evaluate the list
+  list_result.isIncomplete = incomplete;  // if so, further typing re-evaluates the list
   list_result.items = items;
   return list_result;
 }
@@ -10,9 +10,7 @@ void did_open(Workspace& workspace, json raw_params) {
 
 void did_change(Workspace& workspace, json raw_params) {
   auto params = raw_params.get<LSPSpec::DidChangeTextDocumentParams>();
-  for (const auto& change : params.m_contentChanges) {
-    workspace.update_tracked_file(params.m_textDocument.m_uri, change.m_text);
-  }
+  workspace.update_tracked_file(params.m_textDocument.m_uri, params.m_contentChanges);
 }
 
 void did_close(Workspace& workspace, json raw_params) {
@@ -67,11 +65,9 @@ std::optional<json> did_change_push_diagnostics(Workspace& workspace, json raw_p
     publish_params.m_diagnostics = tracked_file.m_diagnostics;
   }
 
-  json response;
-  response["method"] = "textDocument/publishDiagnostics";
-  response["params"] = publish_params;
-
-  return response;
+  // Changes come in on every key press, so wait until they stop instead of publishing each time.
+  workspace.queue_diagnostics(publish_params);
+  return {};
 }
 
 }  // namespace lsp_handlers
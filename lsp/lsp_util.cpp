@@ -1,5 +1,8 @@
 #include "lsp_util.h"
 
+#include <algorithm>
+#include <iostream>
+#include <mutex>
 #include <sstream>
 
 #include "common/util/string_util.h"
@@ -80,4 +83,30 @@ std::string uri_to_path(const LSPSpec::DocumentUri& uri) {
   }
   return decoded_uri;
 }
+
+size_t utf16_offset_to_byte_offset(const std::string& line, uint32_t utf16_offset) {
+  size_t byte_offset = 0;
+  uint32_t units = 0;
+  while (byte_offset < line.size() && units < utf16_offset) {
+    const u8 lead = line[byte_offset];
+    size_t length = 1;
+    if (lead >= 0xf0) {
+      length = 4;
+    } else if (lead >= 0xe0) {
+      length = 3;
+    } else if (lead >= 0xc0) {
+      length = 2;
+    }
+    // characters outside of the BMP are a surrogate pair in UTF-16
+    units += length == 4 ? 2 : 1;
+    byte_offset = std::min(byte_offset + length, line.size());
+  }
+  return byte_offset;
+}
+
+void send_to_client(const std::string& message) {
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+  std::cout << message << std::flush;
+}
 }  // namespace lsp_util
@@ -10,4 +10,9 @@ std::string url_encode(const std::string& value);
 std::string url_decode(const std::string& input);
 LSPSpec::DocumentUri uri_from_path(fs::path path);
 std::string uri_to_path(const LSPSpec::DocumentUri& uri);
+/// @brief Convert a character offset in a line, counted in UTF-16 code units like LSP positions
+/// are, to a byte offset in the UTF-8 line. Offsets past the end of the line give the line length.
+size_t utf16_offset_to_byte_offset(const std::string& line, uint32_t utf16_offset);
+/// @brief Write a message to the client. This is safe to call from any thread.
+void send_to_client(const std::string& message);
 };  // namespace lsp_util
@@ -17,6 +17,7 @@
 #include "common/util/term_util.h"
 
 #include "lsp/handlers/lsp_router.h"
+#include "lsp/lsp_util.h"
 #include "lsp/state/workspace.h"
 #include "lsp/transport/stdio.h"
 #include "lsp/state/app.h"
@@ -139,7 +140,7 @@ int main(int argc, char** argv) {
         auto responses = lsp_router.route_message(message_buffer, appstate);
         if (responses) {
           for (const auto& response : responses.value()) {
-            std::cout << response.c_str() << std::flush;
+            lsp_util::send_to_client(response);
             if (appstate.verbose) {
               lg::debug("<<< Sending message: {}", response);
             } else {
@@ -10,9 +10,15 @@ void LSPSpec::from_json(const json& j, DidOpenTextDocumentParams& obj) {
 
 void LSPSpec::to_json(json& j, const TextDocumentContentChangeEvent& obj) {
   j = json{{"text", obj.m_text}};
+  if (obj.m_range) {
+    j["range"] = obj.m_range.value();
+  }
 }
 
 void LSPSpec::from_json(const json& j, TextDocumentContentChangeEvent& obj) {
+  if (j.contains("range")) {
+    obj.m_range = j.at("range").get<Range>();
+  }
   j.at("text").get_to(obj.m_text);
 }
 
@@ -11,6 +11,9 @@ void to_json(json& j, const DidOpenTextDocumentParams& obj);
 void from_json(const json& j, DidOpenTextDocumentParams& obj);
 
 struct TextDocumentContentChangeEvent {
+  /// @brief The range of the document that changed. If omitted, m_text is the whole new document.
+  std::optional<Range> m_range;
+  /// @brief The new text for the range, or the whole document
   std::string m_text;
 };
 
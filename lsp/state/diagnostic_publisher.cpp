@@ -0,0 +1,66 @@
+#include "diagnostic_publisher.h"
+
+#include <algorithm>
+#include <vector>
+
+DiagnosticPublisher::DiagnosticPublisher(std::chrono::milliseconds delay) : m_delay(delay) {
+  m_thread = std::thread([this]() { run(); });
+}
+
+DiagnosticPublisher::~DiagnosticPublisher() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+}
+
+void DiagnosticPublisher::queue(const LSPSpec::PublishDiagnosticParams& params) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending[params.m_uri] = {params, std::chrono::steady_clock::now() + m_delay};
+  }
+  m_cv.notify_one();
+}
+
+void DiagnosticPublisher::cancel(const LSPSpec::DocumentUri& uri) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_pending.erase(uri);
+}
+
+void DiagnosticPublisher::run() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop) {
+    if (m_pending.empty()) {
+      m_cv.wait(lock);
+      continue;
+    }
+    auto next_deadline = std::chrono::steady_clock::time_point::max();
+    for (const auto& [uri, pending] : m_pending) {
+      next_deadline = std::min(next_deadline, pending.deadline);
+    }
+    if (std::chrono::steady_clock::now() < next_deadline) {
+      // woken up early by a new queue, or the deadline passed. Either way, check again.
+      m_cv.wait_until(lock, next_deadline);
+      continue;
+    }
+
+    std::vector<LSPSpec::PublishDiagnosticParams> ready;
+    const auto now = std::chrono::steady_clock::now();
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+      if (it->second.deadline <= now) {
+        ready.push_back(std::move(it->second.params));
+        it = m_pending.erase(it);
+      } else {
+        it++;
+      }
+    }
+    // don't block queueing while serializing and writing.
+    lock.unlock();
+    for (const auto& params : ready) {
+      m_requester.send_notification(params, "textDocument/publishDiagnostics");
+    }
+    lock.lock();
+  }
+}
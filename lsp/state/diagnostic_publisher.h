@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "lsp/protocol/document_diagnostics.h"
+#include "lsp/state/lsp_requester.h"
+
+/// @brief Publishes diagnostics from a background thread, once a document has stopped changing
+/// for a little while. While typing, there's a change event on every key press, and sending every
+/// diagnostic of a large file each time just makes the editor slower.
+class DiagnosticPublisher {
+ public:
+  DiagnosticPublisher(std::chrono::milliseconds delay = std::chrono::milliseconds(250));
+  ~DiagnosticPublisher();
+
+  /// @brief Publish these diagnostics after the delay, unless newer ones for the same document are
+  /// queued before then.
+  void queue(const LSPSpec::PublishDiagnosticParams& params);
+  /// @brief Drop the queued diagnostics for a document, if there are any.
+  void cancel(const LSPSpec::DocumentUri& uri);
+
+ private:
+  struct PendingPublish {
+    LSPSpec::PublishDiagnosticParams params;
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  void run();
+
+  std::chrono::milliseconds m_delay;
+  LSPRequester m_requester;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stop = false;
+  std::unordered_map<LSPSpec::DocumentUri, PendingPublish> m_pending;
+  std::thread m_thread;
+};
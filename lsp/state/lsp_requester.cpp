@@ -1,10 +1,9 @@
 #include "lsp_requester.h"
 
-#include <iostream>
-
 #include "common/log/log.h"
 #include "common/util/string_util.h"
 
+#include "lsp/lsp_util.h"
 #include "lsp/protocol/progress_report.h"
 
 void LSPRequester::send_request(const json& params, const std::string& method) {
@@ -22,7 +21,7 @@ void LSPRequester::send_request(const json& params, const std::string& method) {
 
   // Send requests immediately, as they may be done during the handling of a client request
   lg::info("Sending Request {}", method);
-  std::cout << request.c_str() << std::flush;
+  lsp_util::send_to_client(request);
 }
 
 void LSPRequester::send_notification(const json& params, const std::string& method) {
@@ -39,7 +38,7 @@ void LSPRequester::send_notification(const json& params, const std::string& meth
 
   // Send requests immediately, as they may be done during the handling of a client request
   lg::info("Sending Notification {}", method);
-  std::cout << request.c_str() << std::flush;
+  lsp_util::send_to_client(request);
 }
 
 void LSPRequester::send_progress_create_request(const std::string& title,
@@ -16,8 +16,8 @@ class LSPRequester {
                                     const std::string& message,
                                     const int percentage);
   void send_progress_finish_request(const std::string& title, const std::string& message);
+  void send_notification(const json& payload, const std::string& method);
 
  private:
   void send_request(const json& payload, const std::string& method);
-  void send_notification(const json& payload, const std::string& method);
 };
@@ -1,10 +1,14 @@
 #include "workspace.h"
 
+#include <algorithm>
 #include <regex>
 
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/MappedFile.h"
+#include "common/util/Serializer.h"
 #include "common/util/ast_util.h"
+#include "common/util/hash.h"
 #include "common/util/string_util.h"
 
 #include "lsp/lsp_util.h"
@@ -54,6 +58,8 @@ std::optional<std::reference_wrapper<WorkspaceOGFile>> Workspace::get_tracked_og
   if (it == m_tracked_og_files.end()) {
     return std::nullopt;
   }
+  // make sure the symbols are filled in if indexing just finished
+  get_compiler(it->second.m_game_version);
   return std::ref(it->second);
 }
 
@@ -72,11 +78,7 @@ std::optional<DefinitionMetadata> Workspace::get_definition_info_from_all_types(
   if (m_tracked_all_types_files.count(all_types_uri) == 0) {
     return {};
   }
-  const auto& dts = m_tracked_all_types_files[all_types_uri]->m_dts;
-  if (dts->symbol_metadata_map.count(symbol_name) == 0) {
-    return {};
-  }
-  return dts->symbol_metadata_map.at(symbol_name);
+  return m_tracked_all_types_files[all_types_uri]->get_definition_info(symbol_name);
 }
 
 // TODO - a gross hack that should go away when the language isn't so tightly coupled to the jak
@@ -97,27 +99,28 @@ std::optional<GameVersion> Workspace::determine_game_version_from_uri(
   return {};
 }
 
-std::vector<symbol_info::SymbolInfo*> Workspace::get_symbols_starting_with(
+std::vector<symbol_info::SymbolInfo*> Workspace::get_symbols_matching(
     const GameVersion game_version,
-    const std::string& symbol_prefix) {
-  if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+    const std::string& query,
+    int max_count) {
+  const auto compiler = get_compiler(game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(game_version));
     return {};
   }
-  const auto& compiler = m_compiler_instances[game_version].get();
-  return compiler->lookup_symbol_info_by_prefix(symbol_prefix);
+  return compiler->lookup_symbol_info_fuzzy(query, max_count);
 }
 
 std::optional<symbol_info::SymbolInfo*> Workspace::get_global_symbol_info(
     const WorkspaceOGFile& file,
     const std::string& symbol_name) {
-  if (m_compiler_instances.find(file.m_game_version) == m_compiler_instances.end()) {
+  const auto compiler = get_compiler(file.m_game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(file.m_game_version));
     return {};
   }
-  const auto& compiler = m_compiler_instances[file.m_game_version].get();
   const auto symbol_infos = compiler->lookup_exact_name_info(symbol_name);
   if (symbol_infos.empty()) {
     return {};
@@ -134,12 +137,12 @@ std::optional<symbol_info::SymbolInfo*> Workspace::get_global_symbol_info(
 std::optional<std::pair<TypeSpec, Type*>> Workspace::get_symbol_typeinfo(
     const WorkspaceOGFile& file,
     const std::string& symbol_name) {
-  if (m_compiler_instances.find(file.m_game_version) == m_compiler_instances.end()) {
+  const auto compiler = get_compiler(file.m_game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(file.m_game_version));
     return {};
   }
-  const auto& compiler = m_compiler_instances[file.m_game_version].get();
   const auto typespec = compiler->lookup_typespec(symbol_name);
   if (typespec) {
     // NOTE - for some reason calling with the symbol's typespec and the symbol itself produces
@@ -165,7 +168,8 @@ std::optional<symbol_info::DefinitionLocation> Workspace::get_symbol_def_locatio
 std::vector<std::tuple<std::string, std::string, Docs::DefinitionLocation>>
 Workspace::get_symbols_parent_type_path(const std::string& symbol_name,
                                         const GameVersion game_version) {
-  if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+  const auto compiler = get_compiler(game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(game_version));
     return {};
@@ -174,7 +178,6 @@ Workspace::get_symbols_parent_type_path(const std::string& symbol_name,
   // name, docstring, def_loc
   std::vector<std::tuple<std::string, std::string, Docs::DefinitionLocation>> parents = {};
 
-  const auto& compiler = m_compiler_instances[game_version].get();
   const auto parent_path = compiler->type_system().get_path_up_tree(symbol_name);
   for (const auto& parent : parent_path) {
     const auto symbol_infos = compiler->lookup_exact_name_info(parent);
@@ -209,7 +212,8 @@ Workspace::get_symbols_parent_type_path(const std::string& symbol_name,
 
 std::vector<std::tuple<std::string, std::string, Docs::DefinitionLocation>>
 Workspace::get_types_subtypes(const std::string& symbol_name, const GameVersion game_version) {
-  if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+  const auto compiler = get_compiler(game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(game_version));
     return {};
@@ -218,7 +222,6 @@ Workspace::get_types_subtypes(const std::string& symbol_name, const GameVersion
   // name, docstring, def_loc
   std::vector<std::tuple<std::string, std::string, Docs::DefinitionLocation>> subtypes = {};
 
-  const auto& compiler = m_compiler_instances[game_version].get();
   const auto subtype_names =
       compiler->type_system().search_types_by_parent_type_strict(symbol_name);
   for (const auto& subtype_name : subtype_names) {
@@ -244,13 +247,13 @@ Workspace::get_types_subtypes(const std::string& symbol_name, const GameVersion
 
 std::unordered_map<std::string, s64> Workspace::get_enum_entries(const std::string& enum_name,
                                                                  const GameVersion game_version) {
-  if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+  const auto compiler = get_compiler(game_version);
+  if (!compiler) {
     lg::debug("Compiler not instantiated for game version - {}",
               version_to_game_name(game_version));
     return {};
   }
 
-  const auto& compiler = m_compiler_instances[game_version].get();
   const auto enum_info = compiler->type_system().try_enum_lookup(enum_name);
   if (!enum_info) {
     return {};
@@ -265,14 +268,7 @@ void Workspace::start_tracking_file(const LSPSpec::DocumentUri& file_uri,
     lg::debug("new ir file - {}", file_uri);
     WorkspaceIRFile file(content);
     m_tracked_ir_files[file_uri] = file;
-    if (!file.m_all_types_uri.empty()) {
-      if (m_tracked_all_types_files.count(file.m_all_types_uri) == 0) {
-        lg::debug("new all-types file - {}", file.m_all_types_uri);
-        m_tracked_all_types_files[file.m_all_types_uri] = std::make_unique<WorkspaceAllTypesFile>(
-            file.m_all_types_uri, file.m_game_version, file.m_all_types_file_path);
-        m_tracked_all_types_files[file.m_all_types_uri]->parse_type_system();
-      }
-    }
+    track_all_types_file(file);
   } else if (language_id == "opengoal") {
     if (m_tracked_og_files.find(file_uri) != m_tracked_og_files.end()) {
       lg::debug("Already tracking - {}", file_uri);
@@ -284,63 +280,99 @@ void Workspace::start_tracking_file(const LSPSpec::DocumentUri& file_uri,
       return;
     }
 
-    if (m_compiler_instances.find(*game_version) == m_compiler_instances.end()) {
+    if (m_compiler_instances.find(*game_version) == m_compiler_instances.end() &&
+        m_indexing_compilers.find(*game_version) == m_indexing_compilers.end()) {
       lg::debug(
           "first time encountering a OpenGOAL file for game version - {}, initializing a compiler",
           version_to_game_name(*game_version));
-      const auto project_path =
-          file_util::try_get_project_path_from_path(lsp_util::uri_to_path(file_uri));
-      lg::debug("Detected project path - {}", project_path.value());
-      if (!file_util::setup_project_path(project_path)) {
-        lg::debug("unable to setup project path, not initializing a compiler");
-        return;
-      }
-      const std::string progress_title =
-          fmt::format("Compiling {}", version_to_game_name_external(game_version.value()));
-      m_requester.send_progress_create_request(progress_title, "compiling project", -1);
-      m_compiler_instances.emplace(game_version.value(),
-                                   std::make_unique<Compiler>(game_version.value()));
-      try {
-        // TODO - this should happen on a separate thread so the LSP is not blocking during this
-        // lengthy step
-        // TODO - make this a setting (disable indexing)
-        // TODO - ask water if there is a fancy way to reduce memory usage (disabling coloring,
-        // etc?)
-        m_compiler_instances.at(*game_version)
-            ->run_front_end_on_string("(make-group \"all-code\")");
-        m_requester.send_progress_finish_request(progress_title, "indexed");
-      } catch (std::exception& e) {
-        // TODO - If it fails, annotate errors (DIAGNOSTIC TODO)
-        m_requester.send_progress_finish_request(progress_title, "failed");
-        lg::debug("error when {}", progress_title);
-      }
+      start_indexing(*game_version, file_uri);
     }
     m_tracked_og_files.emplace(file_uri, WorkspaceOGFile(file_uri, content, *game_version));
-    m_tracked_og_files[file_uri].update_symbols(
-        m_compiler_instances.at(*game_version)
-            ->lookup_symbol_info_by_file(lsp_util::uri_to_path(file_uri)));
+    // If the compiler is still indexing, the symbols are filled in once it's done
+    if (const auto compiler = get_compiler(*game_version)) {
+      m_tracked_og_files[file_uri].update_symbols(
+          compiler->lookup_symbol_info_by_file(lsp_util::uri_to_path(file_uri)));
+    }
   }
 }
 
-void Workspace::update_tracked_file(const LSPSpec::DocumentUri& file_uri,
-                                    const std::string& content) {
+void Workspace::start_indexing(const GameVersion game_version,
+                               const LSPSpec::DocumentUri& file_uri) {
+  const auto project_path =
+      file_util::try_get_project_path_from_path(lsp_util::uri_to_path(file_uri));
+  lg::debug("Detected project path - {}", project_path.value());
+  if (!file_util::setup_project_path(project_path)) {
+    lg::debug("unable to setup project path, not initializing a compiler");
+    return;
+  }
+  // Compiling the whole project takes a while, so do it on another thread and keep handling
+  // requests. Anything that needs the compiler acts like it doesn't exist until it's done.
+  m_indexing_compilers[game_version] =
+      std::async(std::launch::async, [game_version]() -> std::unique_ptr<Compiler> {
+        LSPRequester requester;
+        const std::string progress_title =
+            fmt::format("Compiling {}", version_to_game_name_external(game_version));
+        requester.send_progress_create_request(progress_title, "compiling project", -1);
+        auto compiler = std::make_unique<Compiler>(game_version);
+        try {
+          // TODO - make this a setting (disable indexing)
+          // TODO - ask water if there is a fancy way to reduce memory usage (disabling coloring,
+          // etc?)
+          compiler->run_front_end_on_string("(make-group \"all-code\")");
+          requester.send_progress_finish_request(progress_title, "indexed");
+        } catch (std::exception& e) {
+          // TODO - If it fails, annotate errors (DIAGNOSTIC TODO)
+          requester.send_progress_finish_request(progress_title, "failed");
+          lg::debug("error when {}", progress_title);
+        }
+        return compiler;
+      });
+}
+
+Compiler* Workspace::get_compiler(const GameVersion game_version) {
+  auto indexing = m_indexing_compilers.find(game_version);
+  if (indexing != m_indexing_compilers.end()) {
+    if (indexing->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      return nullptr;
+    }
+    try {
+      m_compiler_instances[game_version] = indexing->second.get();
+    } catch (std::exception& e) {
+      lg::error("Failed to create a compiler for {} - {}", version_to_game_name(game_version),
+                e.what());
+    }
+    m_indexing_compilers.erase(indexing);
+    // Fill in the symbols of the files that were opened while indexing
+    auto compiler = m_compiler_instances.find(game_version);
+    if (compiler != m_compiler_instances.end()) {
+      for (auto& [uri, file] : m_tracked_og_files) {
+        if (file.m_game_version == game_version) {
+          file.update_symbols(
+              compiler->second->lookup_symbol_info_by_file(lsp_util::uri_to_path(uri)));
+        }
+      }
+    }
+  }
+  auto it = m_compiler_instances.find(game_version);
+  if (it == m_compiler_instances.end()) {
+    return nullptr;
+  }
+  return it->second.get();
+}
+
+void Workspace::update_tracked_file(
+    const LSPSpec::DocumentUri& file_uri,
+    const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes) {
   lg::debug("potentially updating - {}", file_uri);
   // Check if the file is already tracked or not, this is done because change events don't give
   // language details it's assumed you are keeping track of that!
   if (m_tracked_ir_files.find(file_uri) != m_tracked_ir_files.end()) {
     lg::debug("updating tracked IR file - {}", file_uri);
-    WorkspaceIRFile file(content);
-    m_tracked_ir_files[file_uri] = file;
+    auto& file = m_tracked_ir_files[file_uri];
+    file.apply_changes(changes);
     // There is the potential for the all-types to have changed, albeit this is probably never going
     // to happen
-    if (!file.m_all_types_uri.empty() &&
-        m_tracked_all_types_files.count(file.m_all_types_uri) == 0) {
-      auto& all_types_file = m_tracked_all_types_files[file.m_all_types_uri];
-      all_types_file->m_file_path = file.m_all_types_file_path;
-      all_types_file->m_uri = file.m_all_types_uri;
-      all_types_file->m_game_version = file.m_game_version;
-      all_types_file->update_type_system();
-    }
+    track_all_types_file(file);
   } else if (m_tracked_all_types_files.find(file_uri) != m_tracked_all_types_files.end()) {
     lg::debug("updating tracked all types file - {}", file_uri);
     // If the all-types file has changed, re-parse it
@@ -348,33 +380,43 @@ void Workspace::update_tracked_file(const LSPSpec::DocumentUri& file_uri,
     m_tracked_all_types_files[file_uri]->update_type_system();
   } else if (m_tracked_og_files.find(file_uri) != m_tracked_og_files.end()) {
     lg::debug("updating tracked OG file - {}", file_uri);
-    m_tracked_og_files[file_uri].parse_content(content);
+    m_tracked_og_files[file_uri].apply_changes(changes);
     // re-`ml` the file
     const auto game_version = m_tracked_og_files[file_uri].m_game_version;
-    if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+    if (!get_compiler(game_version)) {
       lg::debug("No compiler initialized for - {}", version_to_game_name(game_version));
       return;
     }
   }
 }
 
+void Workspace::track_all_types_file(const WorkspaceIRFile& file) {
+  if (file.m_all_types_uri.empty() || m_tracked_all_types_files.count(file.m_all_types_uri) != 0) {
+    return;
+  }
+  lg::debug("new all-types file - {}", file.m_all_types_uri);
+  m_tracked_all_types_files[file.m_all_types_uri] = std::make_unique<WorkspaceAllTypesFile>(
+      file.m_all_types_uri, file.m_game_version, file.m_all_types_file_path);
+  m_tracked_all_types_files[file.m_all_types_uri]->parse_type_system();
+}
+
 void Workspace::tracked_file_will_save(const LSPSpec::DocumentUri& file_uri) {
   lg::debug("file will be saved - {}", file_uri);
   if (m_tracked_og_files.find(file_uri) != m_tracked_og_files.end()) {
     // goalc is not an incremental compiler (yet) so I believe it will be a better UX
     // to re-compile on the file save, rather than as the user is typing
     const auto game_version = m_tracked_og_files[file_uri].m_game_version;
-    if (m_compiler_instances.find(game_version) == m_compiler_instances.end()) {
+    const auto compiler = get_compiler(game_version);
+    if (!compiler) {
       lg::debug("No compiler initialized for - {}", version_to_game_name(game_version));
       return;
     }
     CompilationOptions options;
     options.filename = lsp_util::uri_to_path(file_uri);
     // re-compile the file
-    m_compiler_instances.at(game_version)->asm_file(options);
+    compiler->asm_file(options);
     // Update symbols for this specific file
-    const auto symbol_infos =
-        m_compiler_instances.at(game_version)->lookup_symbol_info_by_file(options.filename);
+    const auto symbol_infos = compiler->lookup_symbol_info_by_file(options.filename);
     m_tracked_og_files[file_uri].update_symbols(symbol_infos);
   }
 }
@@ -386,11 +428,16 @@ void Workspace::update_global_index(const GameVersion game_version) {
 // clang-format on
 
 void Workspace::stop_tracking_file(const LSPSpec::DocumentUri& file_uri) {
+  m_diagnostic_publisher.cancel(file_uri);
   m_tracked_ir_files.erase(file_uri);
   m_tracked_all_types_files.erase(file_uri);
   m_tracked_og_files.erase(file_uri);
 }
 
+void Workspace::queue_diagnostics(const LSPSpec::PublishDiagnosticParams& params) {
+  m_diagnostic_publisher.queue(params);
+}
+
 WorkspaceOGFile::WorkspaceOGFile(const LSPSpec::DocumentUri& uri,
                                  const std::string& content,
                                  const GameVersion& game_version)
@@ -406,17 +453,96 @@ WorkspaceOGFile::WorkspaceOGFile(const LSPSpec::DocumentUri& uri,
 
 void WorkspaceOGFile::parse_content(const std::string& content) {
   m_content = content;
+  update_ast(nullptr);
+}
+
+void WorkspaceOGFile::update_ast(const TSTree* old_tree) {
   auto parser = ts_parser_new();
   if (ts_parser_set_language(parser, g_opengoalLang)) {
     // Get the AST for the current state of the file
-    // TODO - eventually, we should consider doing partial updates of the AST
-    // but right now the LSP just receives the entire document so that's a larger change.
-    m_ast.reset(ts_parser_parse_string(parser, NULL, m_content.c_str(), m_content.length()),
+    m_ast.reset(ts_parser_parse_string(parser, old_tree, m_content.c_str(), m_content.length()),
                 TreeSitterTreeDeleter());
   }
   ts_parser_delete(parser);
 }
 
+namespace {
+struct ContentLocation {
+  uint32_t byte_offset;
+  TSPoint point;
+};
+
+// Find an LSP position in the content. Tree-sitter rows and columns are lines and bytes.
+ContentLocation find_position(const std::string& content, const LSPSpec::Position& position) {
+  size_t line_start = 0;
+  uint32_t row = 0;
+  while (row < position.m_line) {
+    const auto next_line = content.find('\n', line_start);
+    if (next_line == std::string::npos) {
+      // past the last line, so the end of the document.
+      return {(uint32_t)content.length(), {row, (uint32_t)(content.length() - line_start)}};
+    }
+    line_start = next_line + 1;
+    row++;
+  }
+  auto line_end = content.find('\n', line_start);
+  if (line_end == std::string::npos) {
+    line_end = content.length();
+  }
+  const auto column = lsp_util::utf16_offset_to_byte_offset(
+      content.substr(line_start, line_end - line_start), position.m_character);
+  return {(uint32_t)(line_start + column), {row, (uint32_t)column}};
+}
+
+TSPoint end_of_inserted_text(const TSPoint& start, const std::string& text) {
+  TSPoint end = start;
+  const auto last_newline = text.rfind('\n');
+  if (last_newline == std::string::npos) {
+    end.column += text.length();
+  } else {
+    end.row += std::count(text.begin(), text.end(), '\n');
+    end.column = text.length() - last_newline - 1;
+  }
+  return end;
+}
+}  // namespace
+
+void WorkspaceOGFile::apply_changes(
+    const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes) {
+  bool full_parse = false;
+  for (const auto& change : changes) {
+    if (!change.m_range) {
+      m_content = change.m_text;
+      full_parse = true;
+      continue;
+    }
+    const auto start = find_position(m_content, change.m_range->m_start);
+    auto old_end = find_position(m_content, change.m_range->m_end);
+    if (old_end.byte_offset < start.byte_offset) {
+      old_end = start;
+    }
+    m_content.replace(start.byte_offset, old_end.byte_offset - start.byte_offset, change.m_text);
+    const auto new_end = end_of_inserted_text(start.point, change.m_text);
+    m_line_count += (int)new_end.row - (int)old_end.point.row;
+    if (m_ast && !full_parse) {
+      TSInputEdit edit;
+      edit.start_byte = start.byte_offset;
+      edit.old_end_byte = old_end.byte_offset;
+      edit.new_end_byte = start.byte_offset + change.m_text.length();
+      edit.start_point = start.point;
+      edit.old_end_point = old_end.point;
+      edit.new_end_point = new_end;
+      ts_tree_edit(m_ast.get(), &edit);
+    }
+  }
+  if (full_parse) {
+    const auto [line_count, line_ending] =
+        file_util::get_majority_file_line_endings_and_count(m_content);
+    m_line_count = line_count;
+  }
+  update_ast(full_parse ? nullptr : m_ast.get());
+}
+
 void WorkspaceOGFile::update_symbols(const std::vector<symbol_info::SymbolInfo*>& symbol_infos) {
   m_symbols.clear();
   // TODO - sorting by definition location would be nice (maybe VSCode already does this?)
@@ -549,32 +675,103 @@ std::vector<OpenGOALFormResult> WorkspaceOGFile::search_for_forms_that_begin_wit
 }
 
 WorkspaceIRFile::WorkspaceIRFile(const std::string& content) {
-  const auto line_ending = file_util::get_majority_file_line_endings(content);
-  m_lines = str_util::split_string(content, line_ending);
+  m_line_ending = file_util::get_majority_file_line_endings(content);
+  m_lines = str_util::split_string(content, m_line_ending);
 
-  bool in_opengoal_block = false;
-  for (size_t i = 0; i < m_lines.size(); i++) {
-    const auto& line = m_lines.at(i);
+  m_line_info.reserve(m_lines.size());
+  for (const auto& line : m_lines) {
     if (m_all_types_uri == "") {
       find_all_types_path(line);
     }
-    if (str_util::contains(line, ";;-*-OpenGOAL-Start-*-")) {
-      in_opengoal_block = true;
-    } else if (str_util::contains(line, ";;-*-OpenGOAL-End-*-")) {
-      in_opengoal_block = false;
-    }
-    find_function_symbol(i, line);
-    identify_diagnostics(i, line, in_opengoal_block);
+    m_line_info.push_back(analyze_line(line));
   }
+  collect_line_info();
 
   lg::info("Added new IR file. {} lines with {} symbols and {} diagnostics", m_lines.size(),
            m_symbols.size(), m_diagnostics.size());
 }
 
+void WorkspaceIRFile::apply_changes(
+    const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes) {
+  for (const auto& change : changes) {
+    if (!change.m_range) {
+      *this = WorkspaceIRFile(change.m_text);
+      continue;
+    }
+    // positions past the end of the document are the end of the last line.
+    const auto& range = change.m_range.value();
+    const size_t last_line = m_lines.size() - 1;
+    const size_t first_changed = std::min<size_t>(range.m_start.m_line, last_line);
+    const size_t last_changed = std::min<size_t>(range.m_end.m_line, last_line);
+    const auto& first_line = m_lines.at(first_changed);
+    const auto& end_line = m_lines.at(last_changed);
+    const size_t start_byte =
+        range.m_start.m_line > last_line
+            ? first_line.length()
+            : lsp_util::utf16_offset_to_byte_offset(first_line, range.m_start.m_character);
+    const size_t end_byte =
+        range.m_end.m_line > last_line
+            ? end_line.length()
+            : lsp_util::utf16_offset_to_byte_offset(end_line, range.m_end.m_character);
+    auto new_lines = str_util::split_string(
+        first_line.substr(0, start_byte) + change.m_text + end_line.substr(end_byte),
+        m_line_ending);
+
+    std::vector<LineInfo> new_line_info;
+    new_line_info.reserve(new_lines.size());
+    for (const auto& line : new_lines) {
+      if (m_all_types_uri == "") {
+        find_all_types_path(line);
+      }
+      new_line_info.push_back(analyze_line(line));
+    }
+    m_lines.erase(m_lines.begin() + first_changed, m_lines.begin() + last_changed + 1);
+    m_lines.insert(m_lines.begin() + first_changed, new_lines.begin(), new_lines.end());
+    m_line_info.erase(m_line_info.begin() + first_changed,
+                      m_line_info.begin() + last_changed + 1);
+    m_line_info.insert(m_line_info.begin() + first_changed, new_line_info.begin(),
+                       new_line_info.end());
+  }
+  collect_line_info();
+}
+
+WorkspaceIRFile::LineInfo WorkspaceIRFile::analyze_line(const std::string& line) {
+  LineInfo info;
+  find_function_symbol(line, info);
+  identify_diagnostics(line, info);
+  return info;
+}
+
+void WorkspaceIRFile::collect_line_info() {
+  m_symbols.clear();
+  m_diagnostics.clear();
+  for (uint32_t line_num = 0; line_num < m_line_info.size(); line_num++) {
+    const auto& info = m_line_info[line_num];
+    if (info.function_symbol) {
+      auto& symbol = m_symbols.emplace_back(info.function_symbol.value());
+      symbol.m_range.m_start.m_line = line_num;
+      symbol.m_range.m_end.m_line = line_num;  // NOTE - set on the next function
+      symbol.m_selectionRange.m_start.m_line = line_num;
+      symbol.m_selectionRange.m_end.m_line = line_num;
+    }
+    if (info.ends_function) {
+      // Set the previous symbols end-line
+      if (!m_symbols.empty()) {
+        m_symbols[m_symbols.size() - 1].m_range.m_end.m_line = line_num - 1;
+      }
+    }
+    if (info.diagnostic) {
+      auto& diag = m_diagnostics.emplace_back(info.diagnostic.value());
+      diag.m_range.m_start.m_line = line_num;
+      diag.m_range.m_end.m_line = line_num;
+    }
+  }
+}
+
 // This is kind of a hack, but to ensure consistency.  The file will reference the all-types.gc
 // file it was generated with, this lets us accurately jump to the definition properly!
 void WorkspaceIRFile::find_all_types_path(const std::string& line) {
-  std::regex regex("; ALL_TYPES=(.*)=(.*)");
+  static const std::regex regex("; ALL_TYPES=(.*)=(.*)");
   std::smatch matches;
 
   if (std::regex_search(line, matches, regex)) {
@@ -595,9 +792,11 @@ void WorkspaceIRFile::find_all_types_path(const std::string& line) {
   }
 }
 
-void WorkspaceIRFile::find_function_symbol(const uint32_t line_num_zero_based,
-                                           const std::string& line) {
-  std::regex regex("; \\.function (.*)");
+void WorkspaceIRFile::find_function_symbol(const std::string& line, LineInfo& info) {
+  if (line.find("function") == std::string::npos) {
+    return;
+  }
+  static const std::regex regex("; \\.function (.*)");
   std::smatch matches;
 
   if (std::regex_search(line, matches, regex)) {
@@ -609,39 +808,38 @@ void WorkspaceIRFile::find_function_symbol(const uint32_t line_num_zero_based,
       new_symbol.m_name = match.str();
       new_symbol.m_kind = LSPSpec::SymbolKind::Function;
       LSPSpec::Range symbol_range;
-      symbol_range.m_start = {line_num_zero_based, 0};
-      symbol_range.m_end = {line_num_zero_based, 0};  // NOTE - set on the next function
+      symbol_range.m_start = {0, 0};
+      symbol_range.m_end = {0, 0};
       new_symbol.m_range = symbol_range;
       LSPSpec::Range symbol_selection_range;
-      symbol_selection_range.m_start = {line_num_zero_based, 0};
-      symbol_selection_range.m_end = {line_num_zero_based, (uint32_t)line.length() - 1};
+      symbol_selection_range.m_start = {0, 0};
+      symbol_selection_range.m_end = {0, (uint32_t)line.length() - 1};
       new_symbol.m_selectionRange = symbol_selection_range;
-      m_symbols.push_back(new_symbol);
+      info.function_symbol = new_symbol;
     }
   }
 
-  std::regex end_function("^;; \\.endfunction\\s*$");
+  static const std::regex end_function("^;; \\.endfunction\\s*$");
   if (std::regex_match(line, end_function)) {
-    // Set the previous symbols end-line
-    if (!m_symbols.empty()) {
-      m_symbols[m_symbols.size() - 1].m_range.m_end.m_line = line_num_zero_based - 1;
-    }
+    info.ends_function = true;
   }
 }
 
-void WorkspaceIRFile::identify_diagnostics(const uint32_t line_num_zero_based,
-                                           const std::string& line,
-                                           const bool /*in_opengoal_block*/) {
-  std::regex info_regex(";; INFO: (.*)");
-  std::regex warn_regex(";; WARN: (.*)");
-  std::regex error_regex(";; ERROR: (.*)");
+void WorkspaceIRFile::identify_diagnostics(const std::string& line, LineInfo& info) {
+  // Cheap check first, most lines don't have a diagnostic.
+  if (line.find(";; ") == std::string::npos) {
+    return;
+  }
+  static const std::regex info_regex(";; INFO: (.*)");
+  static const std::regex warn_regex(";; WARN: (.*)");
+  static const std::regex error_regex(";; ERROR: (.*)");
   std::smatch info_matches;
   std::smatch warn_matches;
   std::smatch error_matches;
 
   LSPSpec::Range diag_range;
-  diag_range.m_start = {line_num_zero_based, 0};
-  diag_range.m_end = {line_num_zero_based, (uint32_t)line.length() - 1};
+  diag_range.m_start = {0, 0};
+  diag_range.m_end = {0, (uint32_t)line.length() - 1};
 
   // Check for an info-level warnings
   if (std::regex_search(line, info_matches, info_regex)) {
@@ -653,7 +851,7 @@ void WorkspaceIRFile::identify_diagnostics(const uint32_t line_num_zero_based,
       new_diag.m_message = match.str();
       new_diag.m_range = diag_range;
       new_diag.m_source = "OpenGOAL LSP";
-      m_diagnostics.push_back(new_diag);
+      info.diagnostic = new_diag;
       return;
     }
   }
@@ -667,7 +865,7 @@ void WorkspaceIRFile::identify_diagnostics(const uint32_t line_num_zero_based,
       new_diag.m_message = match.str();
       new_diag.m_range = diag_range;
       new_diag.m_source = "OpenGOAL LSP";
-      m_diagnostics.push_back(new_diag);
+      info.diagnostic = new_diag;
       return;
     }
   }
@@ -682,7 +880,7 @@ void WorkspaceIRFile::identify_diagnostics(const uint32_t line_num_zero_based,
       new_diag.m_message = match.str();
       new_diag.m_range = diag_range;
       new_diag.m_source = "OpenGOAL LSP";
-      m_diagnostics.push_back(new_diag);
+      info.diagnostic = new_diag;
       return;
     }
   }
@@ -728,13 +926,128 @@ std::optional<std::string> WorkspaceIRFile::get_symbol_at_position(
   return {};
 }
 
+WorkspaceAllTypesFile::~WorkspaceAllTypesFile() {
+  if (m_index_thread.joinable()) {
+    m_index_thread.join();
+  }
+}
+
+std::optional<DefinitionMetadata> WorkspaceAllTypesFile::get_definition_info(
+    const std::string& symbol_name) {
+  std::lock_guard<std::mutex> lock(m_index_mutex);
+  auto it = m_symbol_index.find(symbol_name);
+  if (it == m_symbol_index.end()) {
+    return {};
+  }
+  return it->second;
+}
+
+fs::path WorkspaceAllTypesFile::index_cache_path() const {
+  const auto path_hash =
+      hash_util::hash64(file_util::convert_to_unix_path_separators(m_file_path.string()));
+  return file_util::get_user_misc_dir(m_game_version) / "lsp" / "all-types-index" /
+         fmt::format("{:016x}.bin", path_hash);
+}
+
+namespace {
+// bump this if the index format changes
+constexpr u64 kAllTypesIndexVersion = 1;
+}  // namespace
+
+bool WorkspaceAllTypesFile::load_index(u64 content_hash, bool allow_stale) {
+  const auto cache_path = index_cache_path();
+  if (!fs::exists(cache_path)) {
+    return false;
+  }
+  try {
+    MappedFile data(cache_path, MappedFile::Access::SEQUENTIAL);
+    Serializer ser(data.data(), data.size(), false);
+    u64 version, cached_hash;
+    ser.from_ptr(&version);
+    ser.from_ptr(&cached_hash);
+    if (version != kAllTypesIndexVersion || (!allow_stale && cached_hash != content_hash)) {
+      return false;
+    }
+    std::unordered_map<std::string, DefinitionMetadata> index;
+    ser.from_string_map(&index, [&](DefinitionMetadata* metadata) { metadata->serialize(ser); });
+    std::lock_guard<std::mutex> lock(m_index_mutex);
+    m_symbol_index = std::move(index);
+    return cached_hash == content_hash;
+  } catch (std::exception& e) {
+    lg::warn("Ignoring unreadable all-types index '{}' - {}", cache_path.string(), e.what());
+    return false;
+  }
+}
+
+void WorkspaceAllTypesFile::save_index(u64 content_hash) {
+  Serializer ser;
+  u64 version = kAllTypesIndexVersion;
+  ser.from_ptr(&version);
+  ser.from_ptr(&content_hash);
+  {
+    std::lock_guard<std::mutex> lock(m_index_mutex);
+    ser.from_string_map(&m_symbol_index,
+                        [&](DefinitionMetadata* metadata) { metadata->serialize(ser); });
+  }
+  const auto cache_path = index_cache_path();
+  try {
+    file_util::create_dir_if_needed_for_file(cache_path);
+    file_util::write_binary_file(cache_path, ser.get_save_result().first,
+                                 ser.get_save_result().second);
+  } catch (std::exception& e) {
+    lg::warn("Unable to save all-types index '{}' - {}", cache_path.string(), e.what());
+  }
+}
+
+void WorkspaceAllTypesFile::build_index() {
+  LSPRequester requester;
+  const std::string progress_title = fmt::format("Indexing {}", m_file_path.filename().string());
+  requester.send_progress_create_request(progress_title, "parsing type definitions", -1);
+  while (true) {
+    try {
+      const auto contents = file_util::read_text_file(m_file_path);
+      const u64 content_hash = hash_util::hash64(contents);
+      if (load_index(content_hash, true)) {
+        lg::debug("DTS index up to date - '{}'", m_file_path.string());
+      } else {
+        lg::debug("DTS Loading - '{}'", m_file_path.string());
+        decompiler::DecompilerTypeSystem dts(m_game_version);
+        dts.parse_type_defs({m_file_path.string()});
+        lg::debug("DTS Loaded At - '{}'", m_file_path.string());
+        {
+          std::lock_guard<std::mutex> lock(m_index_mutex);
+          m_symbol_index = std::move(dts.symbol_metadata_map);
+        }
+        save_index(content_hash);
+      }
+    } catch (std::exception& e) {
+      lg::error("Failed to index all-types file '{}' - {}", m_file_path.string(), e.what());
+    }
+
+    std::lock_guard<std::mutex> lock(m_index_thread_mutex);
+    if (!m_reindex_requested) {
+      m_index_thread_running = false;
+      break;
+    }
+    m_reindex_requested = false;
+  }
+  requester.send_progress_finish_request(progress_title, "indexed");
+}
+
 void WorkspaceAllTypesFile::parse_type_system() {
-  lg::debug("DTS Loading - '{}'", m_file_path.string());
-  m_dts->parse_type_defs({m_file_path.string()});
-  lg::debug("DTS Loaded At - '{}'", m_file_path.string());
+  std::lock_guard<std::mutex> lock(m_index_thread_mutex);
+  if (m_index_thread_running) {
+    // let the running thread go again once it's done, so it sees the latest file
+    m_reindex_requested = true;
+    return;
+  }
+  if (m_index_thread.joinable()) {
+    m_index_thread.join();
+  }
+  m_index_thread_running = true;
+  m_index_thread = std::thread([this]() { build_index(); });
 }
 
 void WorkspaceAllTypesFile::update_type_system() {
-  m_dts = std::make_unique<decompiler::DecompilerTypeSystem>(m_game_version);
   parse_type_system();
 }
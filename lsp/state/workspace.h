@@ -1,7 +1,10 @@
 #pragma once
 
+#include <future>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 
@@ -13,6 +16,8 @@
 #include "lsp/protocol/common_types.h"
 #include "lsp/protocol/document_diagnostics.h"
 #include "lsp/protocol/document_symbols.h"
+#include "lsp/protocol/document_synchronization.h"
+#include "lsp/state/diagnostic_publisher.h"
 #include "lsp/state/lsp_requester.h"
 
 #include "third-party/tree-sitter/tree-sitter/lib/src/tree.h"
@@ -50,6 +55,9 @@ class WorkspaceOGFile {
   std::vector<LSPSpec::Diagnostic> m_diagnostics;
 
   void parse_content(const std::string& new_content);
+  /// Apply the changes to the content in order, then update the AST once. Changes with a range only
+  /// re-parse the parts of the AST that changed.
+  void apply_changes(const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes);
   void update_symbols(const std::vector<symbol_info::SymbolInfo*>& symbol_infos);
   std::optional<std::string> get_symbol_at_position(const LSPSpec::Position position) const;
   std::vector<OpenGOALFormResult> search_for_forms_that_begin_with(
@@ -58,6 +66,10 @@ class WorkspaceOGFile {
  private:
   int32_t version;
   std::shared_ptr<TSTree> m_ast;
+
+  /// Parse m_content. old_tree is the previous AST, already edited to match the new content, or
+  /// null to parse everything again.
+  void update_ast(const TSTree* old_tree);
 };
 
 class WorkspaceIRFile {
@@ -76,37 +88,66 @@ class WorkspaceIRFile {
   std::optional<std::string> get_mips_instruction_at_position(
       const LSPSpec::Position position) const;
   std::optional<std::string> get_symbol_at_position(const LSPSpec::Position position) const;
+  /// Apply the changes to the lines in order. Only the lines that changed are analyzed again.
+  void apply_changes(const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes);
 
  private:
+  /// What was found on a single line. Line numbers in here are left as 0, and are set when
+  /// collecting the results, so lines can move without analyzing them again.
+  struct LineInfo {
+    std::optional<LSPSpec::DocumentSymbol> function_symbol;
+    bool ends_function = false;
+    std::optional<LSPSpec::Diagnostic> diagnostic;
+  };
+
+  std::string m_line_ending;
+  std::vector<LineInfo> m_line_info;
+
+  LineInfo analyze_line(const std::string& line);
+  /// Rebuild m_symbols and m_diagnostics from m_line_info.
+  void collect_line_info();
   void find_all_types_path(const std::string& line);
-  void find_function_symbol(const uint32_t line_num_zero_based, const std::string& line);
+  void find_function_symbol(const std::string& line, LineInfo& info);
   /// Make any relevant diagnostics on the IR line.
   /// It's assumed each line in an IR can have atmost one diagnostic, and they are contained to just
   /// that line!
-  void identify_diagnostics(const uint32_t line_num_zero_based,
-                            const std::string& line,
-                            const bool in_opengoal_block);
+  void identify_diagnostics(const std::string& line, LineInfo& info);
 };
 
+/// An all-types file, and the index of the symbols defined in it.
+///
+/// The type system is parsed on a background thread, and queries only see the index once it's
+/// done. The index is saved to disk along with a hash of the file, so opening the same file again
+/// loads it instead of parsing. If the file has changed since, the old index answers queries until
+/// the new one is ready.
 class WorkspaceAllTypesFile {
  public:
-  WorkspaceAllTypesFile()
-      : m_dts(std::make_unique<decompiler::DecompilerTypeSystem>(GameVersion::Jak1)) {};
   WorkspaceAllTypesFile(const LSPSpec::DocumentUri& uri,
                         const GameVersion version,
                         const fs::path file_path)
-      : m_game_version(version),
-        m_uri(uri),
-        m_dts(std::make_unique<decompiler::DecompilerTypeSystem>(m_game_version)),
-        m_file_path(file_path) {};
+      : m_game_version(version), m_uri(uri), m_file_path(file_path) {};
+  ~WorkspaceAllTypesFile();
 
   GameVersion m_game_version;
   LSPSpec::DocumentUri m_uri;
-  std::unique_ptr<decompiler::DecompilerTypeSystem> m_dts;
   fs::path m_file_path;
 
   void parse_type_system();
   void update_type_system();
+  std::optional<DefinitionMetadata> get_definition_info(const std::string& symbol_name);
+
+ private:
+  fs::path index_cache_path() const;
+  bool load_index(u64 content_hash, bool allow_stale);
+  void save_index(u64 content_hash);
+  void build_index();
+
+  std::mutex m_index_mutex;
+  std::unordered_map<std::string, DefinitionMetadata> m_symbol_index;
+  std::mutex m_index_thread_mutex;
+  std::thread m_index_thread;
+  bool m_index_thread_running = false;
+  bool m_reindex_requested = false;
 };
 
 class Workspace {
@@ -128,10 +169,13 @@ class Workspace {
   void start_tracking_file(const LSPSpec::DocumentUri& file_uri,
                            const std::string& language_id,
                            const std::string& content);
-  void update_tracked_file(const LSPSpec::DocumentUri& file_uri, const std::string& content);
+  void update_tracked_file(const LSPSpec::DocumentUri& file_uri,
+                           const std::vector<LSPSpec::TextDocumentContentChangeEvent>& changes);
   void tracked_file_will_save(const LSPSpec::DocumentUri& file_uri);
   void update_global_index(const GameVersion game_version);
   void stop_tracking_file(const LSPSpec::DocumentUri& file_uri);
+  /// Publish diagnostics once the file stops changing for a moment, instead of right away.
+  void queue_diagnostics(const LSPSpec::PublishDiagnosticParams& params);
   std::optional<std::reference_wrapper<WorkspaceOGFile>> get_tracked_og_file(
       const LSPSpec::URI& file_uri);
   std::optional<std::reference_wrapper<WorkspaceIRFile>> get_tracked_ir_file(
@@ -139,8 +183,10 @@ class Workspace {
   std::optional<DefinitionMetadata> get_definition_info_from_all_types(
       const std::string& symbol_name,
       const LSPSpec::DocumentUri& all_types_uri);
-  std::vector<symbol_info::SymbolInfo*> get_symbols_starting_with(const GameVersion game_version,
-                                                                  const std::string& symbol_prefix);
+  // the symbols best matching what has been typed so far, best first.
+  std::vector<symbol_info::SymbolInfo*> get_symbols_matching(const GameVersion game_version,
+                                                             const std::string& query,
+                                                             int max_count);
   std::optional<symbol_info::SymbolInfo*> get_global_symbol_info(const WorkspaceOGFile& file,
                                                                  const std::string& symbol_name);
   std::optional<std::pair<TypeSpec, Type*>> get_symbol_typeinfo(const WorkspaceOGFile& file,
@@ -158,12 +204,15 @@ class Workspace {
 
  private:
   LSPRequester m_requester;
+  DiagnosticPublisher m_diagnostic_publisher;
   bool m_initialized = false;
   std::unordered_map<LSPSpec::DocumentUri, WorkspaceOGFile> m_tracked_og_files = {};
   std::unordered_map<LSPSpec::DocumentUri, WorkspaceIRFile> m_tracked_ir_files = {};
   std::unordered_map<LSPSpec::DocumentUri, std::unique_ptr<WorkspaceAllTypesFile>>
       m_tracked_all_types_files = {};
 
+  void track_all_types_file(const WorkspaceIRFile& file);
+
   // TODO:
   // OpenGOAL is still incredibly tightly coupled to the jak projects as a language
   //
@@ -173,5 +222,11 @@ class Workspace {
   // Until that decoupling happens, things like this will remain fairly clunky.
   // TODO - change this to a shared_ptr so it can more easily be passed around functions
   std::unordered_map<GameVersion, std::unique_ptr<Compiler>> m_compiler_instances;
+  // Compilers that are still indexing the project on a background thread
+  std::unordered_map<GameVersion, std::future<std::unique_ptr<Compiler>>> m_indexing_compilers;
   std::unordered_map<GameVersion, OGGlobalIndex> m_global_indicies;
+
+  /// The compiler for a game version, or null if it doesn't exist or is still indexing.
+  Compiler* get_compiler(const GameVersion game_version);
+  void start_indexing(const GameVersion game_version, const LSPSpec::DocumentUri& file_uri);
 };
@@ -0,0 +1,62 @@
+#include <string>
+
+#include "benchmarks.h"
+
+#include "common/log/log.h"
+#include "common/util/FileUtil.h"
+#include "common/util/unicode_util.h"
+
+#include "framework/benchmark.h"
+
+#include "third-party/CLI11.hpp"
+
+int main(int argc, char* argv[]) {
+  ArgumentGuard u8_guard(argc, argv);
+
+  bench::RunSettings settings;
+  std::string json_path;
+  std::string baseline_path;
+  double max_regression = 10.;
+  std::string project_path;
+
+  CLI::App app{"OpenGOAL - Microbenchmarks"};
+  app.add_option("--filter", settings.filter, "Only run benchmarks with this in their name");
+  app.add_option("--samples", settings.samples, "Number of timed samples for each benchmark");
+  app.add_option("--min-time", settings.min_time_ms, "Minimum length of a sample, in ms");
+  app.add_option("--json", json_path, "Write the results to this JSON file");
+  app.add_option("--baseline", baseline_path,
+                 "Compare the results with this JSON file, from an earlier run with --json")
+      ->check(CLI::ExistingFile);
+  app.add_option("--max-regression", max_regression,
+                 "Fail if a benchmark is more than this many percent slower than the baseline");
+  app.add_option("--proj-path", project_path, "Project path");
+  app.validate_positionals();
+  CLI11_PARSE(app, argc, argv);
+
+  lg::initialize();
+
+  std::optional<fs::path> pp;
+  if (!project_path.empty()) {
+    pp = project_path;
+  }
+  if (!file_util::setup_project_path(pp)) {
+    lg::error("Couldn't setup project path, tool is supposed to be ran in the jak-project repo!");
+    return 1;
+  }
+
+  auto results = bench::run_benchmarks(bench::all_benchmarks(), settings);
+
+  if (!json_path.empty()) {
+    file_util::write_text_file(json_path, bench::results_to_json(results));
+  }
+
+  if (!baseline_path.empty()) {
+    auto baseline = bench::results_from_json(file_util::read_text_file(baseline_path));
+    if (!bench::compare_with_baseline(results, baseline, max_regression)) {
+      lg::error("Some benchmarks are more than {}% slower than the baseline", max_regression);
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,418 @@
+#include "benchmarks.h"
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+#include "common/dma/dma_copy.h"
+#include "common/goos/Interpreter.h"
+#include "common/goos/Reader.h"
+#include "common/texture/texture_conversion.h"
+#include "common/util/Assert.h"
+#include "common/util/FileUtil.h"
+#include "common/util/FlatHashMap.h"
+#include "common/util/FlatMap.h"
+#include "common/util/Serializer.h"
+#include "common/util/compress.h"
+#include "common/util/crc32.h"
+#include "common/util/fnv.h"
+#include "common/util/hash.h"
+#include "common/util/print_float.h"
+
+#include "game/graphics/texture/TextureConverter.h"
+#include "goalc/regalloc/Allocator_v2.h"
+
+namespace bench {
+
+namespace {
+
+std::vector<u8> random_bytes(size_t size, u64 seed) {
+  Random rng(seed);
+  std::vector<u8> result(size);
+  for (size_t i = 0; i < size; i += 8) {
+    u64 x = rng.next();
+    memcpy(result.data() + i, &x, std::min(size_t(8), size - i));
+  }
+  return result;
+}
+
+/*!
+ * Something like the vertex data of a level: smooth positions and repeated colors/texture ids,
+ * which compresses about as well as the real thing.
+ */
+std::vector<u8> level_like_data(size_t size, u64 seed) {
+  Random rng(seed);
+  std::vector<u32> words(size / 4);
+  u32 position = 0;
+  for (size_t i = 0; i < words.size(); i++) {
+    switch (i % 4) {
+      case 0:
+      case 1:
+        position += rng.next_below(64);
+        words[i] = position;
+        break;
+      case 2:
+        words[i] = 0x80808080 | (rng.next_below(4) << 8);
+        break;
+      case 3:
+        words[i] = rng.next_below(16);
+        break;
+    }
+  }
+  std::vector<u8> result(size);
+  memcpy(result.data(), words.data(), words.size() * 4);
+  return result;
+}
+
+struct PackedVertex {
+  float x, y, z;
+  u16 s, t;
+  u32 color;
+  u32 pad[3];
+};
+
+struct SerializerInput {
+  std::vector<u32> indices;
+  std::vector<PackedVertex> vertices;
+  std::vector<std::string> names;
+
+  void serialize(Serializer& ser) {
+    ser.from_pod_vector(&indices);
+    ser.from_pod_vector(&vertices);
+    ser.from_string_vector(&names);
+  }
+};
+
+std::shared_ptr<SerializerInput> make_serializer_input() {
+  Random rng(86);
+  auto input = std::make_shared<SerializerInput>();
+  input->indices.resize(1 << 20);
+  for (auto& idx : input->indices) {
+    idx = rng.next_below(1 << 18);
+  }
+  input->vertices.resize(1 << 18);
+  for (auto& vtx : input->vertices) {
+    vtx.x = rng.next_below(100000);
+    vtx.y = rng.next_below(100000);
+    vtx.z = rng.next_below(100000);
+    vtx.s = rng.next_below(4096);
+    vtx.t = rng.next_below(4096);
+    vtx.color = rng.next();
+  }
+  for (int i = 0; i < 4096; i++) {
+    input->names.push_back(fmt::format("tex-{}-{}", i, rng.next_below(1000)));
+  }
+  return input;
+}
+
+u64 serializer_input_size(const SerializerInput& input) {
+  return input.indices.size() * sizeof(u32) + input.vertices.size() * sizeof(PackedVertex);
+}
+
+/*!
+ * A DMA chain of NEXT packets (with data inline) and REF packets (pointing to data elsewhere),
+ * spread out over main memory, like a frame's buckets.
+ */
+struct DmaInput {
+  static constexpr u32 memory_size = 32 * 1024 * 1024;
+  std::vector<u8> memory;
+  u32 start = 0;
+  u64 data_bytes = 0;
+};
+
+u64 make_tag(DmaTag::Kind kind, u16 qwc, u32 addr) {
+  return u64(qwc) | (u64(kind) << 28) | (u64(addr) << 32);
+}
+
+std::shared_ptr<DmaInput> make_dma_input() {
+  Random rng(87);
+  auto input = std::make_shared<DmaInput>();
+  input->memory.resize(DmaInput::memory_size);
+  constexpr int packet_count = 4000;
+  // packets go in the upper half, and REF data in the lower half (above the protected area).
+  constexpr u32 packet_spacing = (DmaInput::memory_size / 2 / packet_count) & ~15;
+  auto packet_addr = [&](int i) { return DmaInput::memory_size / 2 + i * packet_spacing; };
+  std::vector<u32> order(packet_count);
+  for (int i = 0; i < packet_count; i++) {
+    order[i] = i;
+  }
+  for (int i = packet_count - 1; i > 0; i--) {
+    std::swap(order[i], order[rng.next_below(i + 1)]);
+  }
+
+  input->start = packet_addr(order[0]);
+  for (int i = 0; i < packet_count; i++) {
+    u32 addr = packet_addr(order[i]);
+    u16 qwc = 1 + rng.next_below(128);
+    if (i != packet_count - 1 && rng.next_below(4) == 0) {
+      // ref to some data, then a next with no data to get to the next packet.
+      u32 data = 1024 * 1024 + rng.next_below(8 * 1024 * 1024 / 16) * 16;
+      u64 ref_tag = make_tag(DmaTag::Kind::REF, qwc, data);
+      memcpy(input->memory.data() + addr, &ref_tag, 8);
+      input->data_bytes += qwc * 16;
+      addr += 16;
+      qwc = 0;
+    }
+    u64 tag = i == packet_count - 1 ? make_tag(DmaTag::Kind::END, qwc, 0)
+                                    : make_tag(DmaTag::Kind::NEXT, qwc, packet_addr(order[i + 1]));
+    memcpy(input->memory.data() + addr, &tag, 8);
+    input->data_bytes += qwc * 16;
+  }
+  return input;
+}
+
+/*!
+ * A function with a lot of short-lived temporaries, some long-lived variables, loops and calls,
+ * which is roughly what the compiler gives the allocator for big functions.
+ */
+AllocationInput make_regalloc_input(int instruction_count) {
+  Random rng(88);
+  AllocationInput input;
+  input.function_name = "benchmark-function";
+  int var_count = 0;
+  for (int arg = 0; arg < 3; arg++) {
+    IRegConstraint constraint;
+    constraint.ireg = {RegClass::GPR_64, var_count++};
+    constraint.instr_idx = 0;
+    constraint.desired_register = emitter::gRegInfo.get_gpr_arg_reg(arg);
+    input.constraints.push_back(constraint);
+  }
+
+  for (int i = 0; i < instruction_count; i++) {
+    RegAllocInstr instr;
+    int read_count = 1 + rng.next_below(2);
+    for (int r = 0; r < read_count; r++) {
+      // mostly recent temporaries, sometimes the arguments.
+      int var = rng.next_below(8) == 0 ? rng.next_below(3)
+                                       : var_count - 1 - rng.next_below(std::min(var_count, 12));
+      instr.read.push_back({RegClass::GPR_64, var});
+    }
+    instr.write.push_back({RegClass::GPR_64, var_count++});
+    instr.is_move = read_count == 1 && rng.next_below(4) == 0;
+    if (i % 40 == 20) {
+      // a function call
+      for (int arg = 0; arg < 8; arg++) {
+        instr.clobber.push_back(emitter::gRegInfo.get_gpr_arg_reg(arg));
+      }
+      instr.clobber.push_back(emitter::RAX);
+      instr.is_move = false;
+    }
+    if (i % 100 == 99) {
+      // a loop
+      instr.jumps.push_back(i - 60);
+    }
+    input.instructions.push_back(instr);
+  }
+  input.max_vars = var_count;
+  return input;
+}
+
+BenchmarkBody dma_copy() {
+  auto input = make_dma_input();
+  auto copier = std::make_shared<FixedChunkDmaCopier>(DmaInput::memory_size);
+  return {[input, copier]() { keep(copier->run(input->memory.data(), input->start).data.size()); },
+          input->data_bytes};
+}
+
+// the same chain every time, so after the first run no chunks are copied.
+BenchmarkBody dma_copy_incremental() {
+  auto input = make_dma_input();
+  auto copier = std::make_shared<FixedChunkDmaCopier>(DmaInput::memory_size);
+  copier->set_incremental(true);
+  return {[input, copier]() { keep(copier->run(input->memory.data(), input->start).data.size()); },
+          input->data_bytes};
+}
+
+BenchmarkBody serializer_save() {
+  auto input = make_serializer_input();
+  return {[input]() {
+            Serializer ser;
+            input->serialize(ser);
+            keep(ser.get_save_result().second);
+          },
+          serializer_input_size(*input)};
+}
+
+BenchmarkBody serializer_load() {
+  auto input = make_serializer_input();
+  Serializer ser;
+  input->serialize(ser);
+  auto result = ser.get_save_result();
+  auto saved = std::make_shared<std::vector<u8>>(result.first, result.first + result.second);
+  return {[saved]() {
+            Serializer loader(saved->data(), saved->size(), false);
+            SerializerInput loaded;
+            loaded.serialize(loader);
+            keep(loaded.indices.size());
+          },
+          serializer_input_size(*input)};
+}
+
+BenchmarkBody decompress_zstd() {
+  auto data = level_like_data(16 * 1024 * 1024, 89);
+  auto compressed =
+      std::make_shared<std::vector<u8>>(compression::compress_zstd(data.data(), data.size()));
+  return {[compressed]() {
+            keep(compression::decompress_zstd(compressed->data(), compressed->size()).size());
+          },
+          data.size()};
+}
+
+BenchmarkBody crc32_bytes(size_t size) {
+  auto data = std::make_shared<std::vector<u8>>(random_bytes(size, 90));
+  return {[data]() { keep(crc32(data->data(), data->size())); }, size};
+}
+
+BenchmarkBody hash64_bytes(size_t size) {
+  auto data = std::make_shared<std::vector<u8>>(random_bytes(size, 90));
+  return {[data]() { keep(hash_util::hash64(data->data(), data->size())); }, size};
+}
+
+BenchmarkBody fnv64_bytes(size_t size) {
+  auto data = std::make_shared<std::vector<u8>>(random_bytes(size, 90));
+  return {[data]() { keep(fnv64(data->data(), data->size())); }, size};
+}
+
+BenchmarkBody read_goal_lib() {
+  auto text = std::make_shared<std::string>(
+      file_util::read_text_file(file_util::get_file_path({"goal_src", "goal-lib.gc"})));
+  auto reader = std::make_shared<goos::Reader>();
+  return {[reader, text]() {
+            keep(reader->read_from_string(*text, true, "goal-lib.gc").is_pair());
+          },
+          text->size()};
+}
+
+BenchmarkBody interpreter_eval() {
+  auto interp = std::make_shared<goos::Interpreter>();
+  auto env = interp->global_environment.as_env_ptr();
+  interp->eval(interp->reader.read_from_string(
+                   "(desfun bench-fib (n) (if (< n 2) n (+ (bench-fib (- n 1)) (bench-fib (- n "
+                   "2)))))"),
+               env);
+  auto form = interp->reader.read_from_string("(bench-fib 15)");
+  return {[interp, env, form]() { keep(interp->eval(form, env).is_int()); }};
+}
+
+BenchmarkBody allocate_registers() {
+  auto input = std::make_shared<AllocationInput>(make_regalloc_input(2000));
+  ASSERT(allocate_registers_v2(*input).ok);
+  return {[input]() { keep(allocate_registers_v2(*input).ok); }};
+}
+
+// symbol-like names, like the labels and link tables of the compiler.
+std::shared_ptr<std::vector<std::string>> make_names(int count, u64 seed) {
+  Random rng(seed);
+  auto names = std::make_shared<std::vector<std::string>>();
+  for (int i = 0; i < count; i++) {
+    names->push_back(fmt::format("name-{}-{}", rng.next_below(100000), i));
+  }
+  return names;
+}
+
+// build a map of names, then look each one up a few times, like a function's label map.
+template <typename Map>
+BenchmarkBody string_map_lookup() {
+  auto names = make_names(200, 92);
+  return {[names]() {
+    Map map;
+    for (size_t i = 0; i < names->size(); i++) {
+      map[(*names)[i]] = i;
+    }
+    size_t sum = 0;
+    for (int pass = 0; pass < 4; pass++) {
+      for (const auto& name : *names) {
+        sum += map.find(name)->second;
+      }
+    }
+    keep(sum);
+  }};
+}
+
+// add links to names with repeats, then walk them in order, like the object file link tables.
+template <typename Map>
+BenchmarkBody link_table_build() {
+  auto names = make_names(300, 93);
+  auto order = std::make_shared<std::vector<int>>();
+  Random rng(94);
+  for (int i = 0; i < 5000; i++) {
+    order->push_back(rng.next_below(names->size()));
+  }
+  return {[names, order]() {
+    Map map;
+    for (size_t i = 0; i < order->size(); i++) {
+      map[(*names)[(*order)[i]]].push_back(i);
+    }
+    size_t sum = 0;
+    for (const auto& [name, links] : map) {
+      sum += name.size() + links.size();
+    }
+    keep(sum);
+  }};
+}
+
+// floats like the ones in decompiled data, from tiny to large.
+BenchmarkBody print_floats() {
+  Random rng(95);
+  auto floats = std::make_shared<std::vector<float>>();
+  for (int i = 0; i < 10000; i++) {
+    floats->push_back((float)rng.next_below(1 << 24) / (1 << rng.next_below(30)));
+  }
+  return {[floats]() {
+    char buffer[64];
+    size_t length = 0;
+    for (float f : *floats) {
+      length += float_to_cstr(f, buffer);
+    }
+    keep(length);
+  }};
+}
+
+BenchmarkBody texture_download(PSM psm, CPSM clut_psm) {
+  constexpr u32 w = 256, h = 256;
+  auto converter = std::make_shared<TextureConverter>();
+  auto vram = random_bytes(4 * 1024 * 1024, 91);
+  converter->upload(vram.data(), 0, vram.size() / 4);
+  auto out = std::make_shared<std::vector<u8>>(w * h * 4);
+  return {[converter, out, psm, clut_psm]() {
+            converter->download_rgba8888(out->data(), 0, w / 64, w, h, (int)psm, (int)clut_psm,
+                                         0x2000, out->size());
+            keep((*out)[0]);
+          },
+          out->size()};
+}
+
+}  // namespace
+
+std::vector<Benchmark> all_benchmarks() {
+  return {
+      {"dma/fixed_chunk_copier_run", dma_copy},
+      {"dma/fixed_chunk_copier_run_incremental", dma_copy_incremental},
+      {"serializer/save", serializer_save},
+      {"serializer/load", serializer_load},
+      {"compression/decompress_zstd", decompress_zstd},
+      {"crc32/16_bytes", []() { return crc32_bytes(16); }},
+      {"crc32/1_MB", []() { return crc32_bytes(1024 * 1024); }},
+      {"hash/hash64_16_bytes", []() { return hash64_bytes(16); }},
+      {"hash/hash64_1_MB", []() { return hash64_bytes(1024 * 1024); }},
+      {"hash/fnv64_1_MB", []() { return fnv64_bytes(1024 * 1024); }},
+      {"goos/read_goal_lib", read_goal_lib},
+      {"goos/interpreter_eval", interpreter_eval},
+      {"print/float_to_cstr", print_floats},
+      {"regalloc/allocate_registers_v2", allocate_registers},
+      {"texture/download_psmt8_clut32",
+       []() { return texture_download(PSM::PSMT8, CPSM::PSMCT32); }},
+      {"texture/download_psmt4_clut16",
+       []() { return texture_download(PSM::PSMT4, CPSM::PSMCT16); }},
+      {"containers/string_lookup_unordered_map",
+       string_map_lookup<std::unordered_map<std::string, size_t>>},
+      {"containers/string_lookup_flat_hash_map",
+       string_map_lookup<cu::FlatHashMap<std::string, size_t>>},
+      {"containers/link_table_map", link_table_build<std::map<std::string, std::vector<int>>>},
+      {"containers/link_table_flat_map",
+       link_table_build<cu::FlatMap<std::string, std::vector<int>>>},
+  };
+}
+
+}  // namespace bench
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <vector>
+
+#include "framework/benchmark.h"
+
+namespace bench {
+std::vector<Benchmark> all_benchmarks();
+}
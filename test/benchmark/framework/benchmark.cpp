@@ -0,0 +1,136 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "common/log/log.h"
+#include "common/util/Timer.h"
+
+#include "fmt/core.h"
+#include "third-party/json.hpp"
+
+namespace bench {
+
+namespace {
+volatile u64 g_sink = 0;
+
+double run_sample(const std::function<void()>& body, u64 iterations) {
+  Timer timer;
+  for (u64 i = 0; i < iterations; i++) {
+    body();
+  }
+  return (double)timer.getNs();
+}
+
+std::string throughput(const BenchmarkResult& result) {
+  if (!result.bytes_per_iteration || result.median_ns <= 0) {
+    return "";
+  }
+  double bytes_per_second = result.bytes_per_iteration / (result.median_ns / 1.e9);
+  return fmt::format("{:10.1f} MB/s", bytes_per_second / 1.e6);
+}
+}  // namespace
+
+void keep(u64 value) {
+  g_sink = g_sink + value;
+}
+
+std::vector<BenchmarkResult> run_benchmarks(const std::vector<Benchmark>& benchmarks,
+                                            const RunSettings& settings) {
+  std::vector<BenchmarkResult> results;
+  const double min_time_ns = settings.min_time_ms * 1.e6;
+  for (const auto& benchmark : benchmarks) {
+    if (!settings.filter.empty() && benchmark.name.find(settings.filter) == std::string::npos) {
+      continue;
+    }
+    auto body = benchmark.setup();
+    const auto& run = body.run;
+
+    // find how many iterations it takes to fill a sample. This also warms up caches.
+    u64 iterations = 1;
+    for (;;) {
+      double ns = run_sample(run, iterations);
+      if (ns >= min_time_ns) {
+        break;
+      }
+      double scale = ns > 0 ? 1.2 * min_time_ns / ns : 10.;
+      iterations = std::max(iterations + 1, u64(iterations * std::min(scale, 10.)));
+    }
+
+    std::vector<double> ns_per_iteration;
+    for (int i = 0; i < std::max(1, settings.samples); i++) {
+      ns_per_iteration.push_back(run_sample(run, iterations) / iterations);
+    }
+    std::sort(ns_per_iteration.begin(), ns_per_iteration.end());
+
+    auto& result = results.emplace_back();
+    result.name = benchmark.name;
+    result.iterations = iterations;
+    result.bytes_per_iteration = body.bytes_per_iteration;
+    result.median_ns = ns_per_iteration.at(ns_per_iteration.size() / 2);
+    result.min_ns = ns_per_iteration.front();
+    result.max_ns = ns_per_iteration.back();
+    lg::info("{:<36} {:14.1f} ns/iter (min {:.1f}, max {:.1f}) {}", result.name, result.median_ns,
+             result.min_ns, result.max_ns, throughput(result));
+  }
+  return results;
+}
+
+std::string results_to_json(const std::vector<BenchmarkResult>& results) {
+  nlohmann::json benchmarks = nlohmann::json::array();
+  for (const auto& result : results) {
+    benchmarks.push_back({{"name", result.name},
+                          {"iterations", result.iterations},
+                          {"bytes_per_iteration", result.bytes_per_iteration},
+                          {"median_ns", result.median_ns},
+                          {"min_ns", result.min_ns},
+                          {"max_ns", result.max_ns}});
+  }
+  nlohmann::json json;
+  json["benchmarks"] = benchmarks;
+  return json.dump(2);
+}
+
+std::vector<BenchmarkResult> results_from_json(const std::string& text) {
+  std::vector<BenchmarkResult> results;
+  auto json = nlohmann::json::parse(text);
+  for (const auto& entry : json.at("benchmarks")) {
+    auto& result = results.emplace_back();
+    result.name = entry.at("name").get<std::string>();
+    result.iterations = entry.value("iterations", 0);
+    result.bytes_per_iteration = entry.value("bytes_per_iteration", 0);
+    result.median_ns = entry.at("median_ns").get<double>();
+    result.min_ns = entry.value("min_ns", result.median_ns);
+    result.max_ns = entry.value("max_ns", result.median_ns);
+  }
+  return results;
+}
+
+bool compare_with_baseline(const std::vector<BenchmarkResult>& results,
+                           const std::vector<BenchmarkResult>& baseline,
+                           double max_regression_percent) {
+  std::unordered_map<std::string, const BenchmarkResult*> baseline_by_name;
+  for (const auto& result : baseline) {
+    baseline_by_name[result.name] = &result;
+  }
+
+  bool ok = true;
+  for (const auto& result : results) {
+    auto it = baseline_by_name.find(result.name);
+    if (it == baseline_by_name.end() || it->second->median_ns <= 0) {
+      lg::info("{:<36} not in baseline", result.name);
+      continue;
+    }
+    double change = 100. * (result.median_ns / it->second->median_ns - 1.);
+    if (change > max_regression_percent) {
+      lg::error("{:<36} {:+7.1f}% ({:.1f} -> {:.1f} ns/iter) REGRESSION", result.name, change,
+                it->second->median_ns, result.median_ns);
+      ok = false;
+    } else {
+      lg::info("{:<36} {:+7.1f}%", result.name, change);
+    }
+  }
+  return ok;
+}
+
+}  // namespace bench
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+/*!
+ * A small microbenchmark runner.
+ *
+ * Each benchmark has a setup function, which builds its input and returns the body to time. The
+ * body is run in a loop until a sample takes at least min_time_ms, and the median time of all
+ * samples is reported. Inputs are generated from fixed seeds (or read from files in the repo), so
+ * runs on the same machine are comparable.
+ */
+namespace bench {
+
+struct BenchmarkBody {
+  std::function<void()> run;
+  // bytes processed by one run, to report throughput. 0 if it doesn't apply.
+  u64 bytes_per_iteration = 0;
+};
+
+struct Benchmark {
+  std::string name;
+  // only called if the benchmark isn't filtered out, so it can do expensive setup.
+  std::function<BenchmarkBody()> setup;
+};
+
+struct BenchmarkResult {
+  std::string name;
+  u64 iterations = 0;
+  u64 bytes_per_iteration = 0;
+  double median_ns = 0;
+  double min_ns = 0;
+  double max_ns = 0;
+};
+
+struct RunSettings {
+  int samples = 5;
+  double min_time_ms = 100.;
+  std::string filter;
+};
+
+/*!
+ * Keep the compiler from removing a computation whose result is otherwise unused.
+ */
+void keep(u64 value);
+
+/*!
+ * Deterministic random numbers, the same on all platforms (unlike the std distributions).
+ */
+class Random {
+ public:
+  explicit Random(u64 seed) : m_state(seed) {}
+  u64 next() {
+    // splitmix64
+    u64 z = (m_state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+  u32 next_below(u32 max) { return next() % max; }
+
+ private:
+  u64 m_state;
+};
+
+std::vector<BenchmarkResult> run_benchmarks(const std::vector<Benchmark>& benchmarks,
+                                            const RunSettings& settings);
+std::string results_to_json(const std::vector<BenchmarkResult>& results);
+std::vector<BenchmarkResult> results_from_json(const std::string& json);
+
+/*!
+ * Print how the results compare to the baseline. Returns false if any benchmark is more than
+ * max_regression_percent slower than in the baseline.
+ */
+bool compare_with_baseline(const std::vector<BenchmarkResult>& results,
+                           const std::vector<BenchmarkResult>& baseline,
+                           double max_regression_percent);
+
+}  // namespace bench
@@ -0,0 +1,88 @@
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/log/log.h"
+#include "common/util/FileUtil.h"
+#include "common/util/string_util.h"
+
+#include "fmt/core.h"
+#include "gtest/gtest.h"
+
+class AsyncLogTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    lg::set_stdout_level(lg::level::off);
+    lg::set_file("opengoal-test-log", false, false, fs::temp_directory_path().string());
+    lg::start_async();
+  }
+
+  void TearDown() override {
+    lg::finish();
+    lg::set_stdout_level(lg::level::trace);
+  }
+
+  // the non-empty lines written to the log file so far.
+  std::vector<std::string> read_log() {
+    std::vector<std::string> lines;
+    for (auto& line : str_util::split(file_util::read_text_file(
+             (fs::temp_directory_path() / "opengoal-test-log.log").string()))) {
+      if (!line.empty()) {
+        lines.push_back(line);
+      }
+    }
+    return lines;
+  }
+};
+
+TEST_F(AsyncLogTest, KeepsOrderAcrossThreads) {
+  constexpr int kThreads = 4;
+  constexpr int kMessagesPerThread = 500;
+  std::mutex order_mutex;
+  int next_message = 0;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kMessagesPerThread; j++) {
+        // the lock decides the order, and the log has to match it.
+        std::lock_guard<std::mutex> lk(order_mutex);
+        lg::info("message {}", next_message++);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  lg::finish();
+  auto lines = read_log();
+  ASSERT_EQ(lines.size(), kThreads * kMessagesPerThread);
+  for (size_t i = 0; i < lines.size(); i++) {
+    EXPECT_TRUE(str_util::ends_with(lines[i], fmt::format("[info] message {}", i))) << lines[i];
+  }
+}
+
+TEST_F(AsyncLogTest, WritesEverythingOnFlushAndFinish) {
+  // a thread that exits without flushing.
+  std::thread([] {
+    for (int i = 0; i < 1000; i++) {
+      lg::info("from thread {}", i);
+    }
+  }).join();
+  for (int i = 0; i < 1000; i++) {
+    lg::info("from main {}", i);
+  }
+
+  lg::flush();
+  auto lines = read_log();
+  ASSERT_EQ(lines.size(), 2000);
+  EXPECT_TRUE(str_util::ends_with(lines[999], "[info] from thread 999"));
+  EXPECT_TRUE(str_util::ends_with(lines[1999], "[info] from main 999"));
+
+  lg::print("after flush\n");
+  lg::finish();
+  lines = read_log();
+  ASSERT_EQ(lines.size(), 2001);
+  EXPECT_EQ(lines.back(), "after flush");
+}
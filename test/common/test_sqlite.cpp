@@ -0,0 +1,76 @@
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/sqlite/sqlite.h"
+#include "common/util/FileUtil.h"
+
+#include "fmt/core.h"
+#include "gtest/gtest.h"
+
+namespace {
+std::optional<sqlite::GenericResponse> wait_for_result(sqlite::AsyncQueryRunner& runner, u32 id) {
+  for (int i = 0; i < 5000; i++) {
+    if (auto result = runner.take_result(id)) {
+      return result;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+TEST(SQLite, Transaction) {
+  const auto path = fs::temp_directory_path() / "opengoal-test-transaction.db";
+  fs::remove(path);
+  {
+    sqlite::SQLiteDatabase db;
+    ASSERT_TRUE(db.open_db(path.string()));
+    EXPECT_TRUE(db.run_transaction("CREATE TABLE test (id INTEGER PRIMARY KEY, name TEXT);"
+                                   "INSERT INTO test VALUES (1, 'a');"));
+    // the second insert fails, so neither is kept.
+    EXPECT_FALSE(db.run_transaction("INSERT INTO test VALUES (2, 'b');"
+                                    "INSERT INTO test VALUES (1, 'c');"));
+    auto rows = db.run_query("SELECT id, name FROM test ORDER BY id;").rows;
+    ASSERT_EQ(rows.size(), 1);
+    EXPECT_EQ(rows[0], std::vector<std::string>({"1", "a"}));
+    // again, from the cached statement.
+    EXPECT_EQ(db.run_query("SELECT id, name FROM test ORDER BY id;").rows, rows);
+  }
+  fs::remove(path);
+}
+
+TEST(SQLite, AsyncQueries) {
+  const auto path = fs::temp_directory_path() / "opengoal-test-async.db";
+  fs::remove(path);
+  {
+    sqlite::SQLiteDatabase db;
+    ASSERT_TRUE(db.open_db(path.string()));
+    ASSERT_TRUE(db.run_transaction("CREATE TABLE test (value INTEGER);"));
+
+    sqlite::AsyncQueryRunner runner(db);
+    // queries run in the order they were submitted, so each count sees the inserts before it.
+    std::vector<u32> count_ids;
+    for (int i = 0; i < 10; i++) {
+      const u32 insert_id = runner.submit(fmt::format("INSERT INTO test VALUES ({});", i));
+      EXPECT_NE(insert_id, 0);
+      count_ids.push_back(runner.submit("SELECT COUNT(*) FROM test;"));
+    }
+    for (int i = 0; i < 10; i++) {
+      auto result = wait_for_result(runner, count_ids[i]);
+      ASSERT_TRUE(result.has_value());
+      ASSERT_EQ(result->rows.size(), 1);
+      EXPECT_EQ(result->rows[0][0], std::to_string(i + 1));
+      // each result can only be taken once.
+      EXPECT_FALSE(runner.take_result(count_ids[i]).has_value());
+    }
+
+    // the synchronous path sees the same database.
+    auto rows = db.run_query("SELECT SUM(value) FROM test;").rows;
+    ASSERT_EQ(rows.size(), 1);
+    EXPECT_EQ(rows[0][0], "45");
+  }
+  fs::remove(path);
+}
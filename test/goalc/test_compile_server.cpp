@@ -0,0 +1,79 @@
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/repl/nrepl/ReplClient.h"
+#include "common/repl/nrepl/ReplServer.h"
+
+#include "goalc/compiler/CompileServer.h"
+#include "goalc/compiler/Compiler.h"
+
+#include "fmt/core.h"
+#include "gtest/gtest.h"
+#include "third-party/json.hpp"
+
+namespace {
+constexpr int kTestPort = 8190;
+}
+
+TEST(CompileServer, EvalAndFormatFromManyClients) {
+  std::mutex compiler_mutex;
+  auto compiler = std::make_unique<Compiler>(GameVersion::Jak1);
+
+  std::atomic<bool> stop = false;
+  ReplServer server([&]() { return stop.load(); }, kTestPort);
+  ASSERT_TRUE(server.init_server(true));
+  std::thread server_thread([&]() {
+    while (!stop) {
+      if (auto req = server.get_request()) {
+        handle_nrepl_request(server, *req, compiler, compiler_mutex);
+      }
+    }
+  });
+
+  constexpr int kClients = 4;
+  constexpr int kRequestsPerClient = 5;
+  std::atomic<int> answered = 0;
+  std::vector<std::thread> clients;
+  for (int i = 0; i < kClients; i++) {
+    clients.emplace_back([&, i]() {
+      ReplClient client(kTestPort);
+      if (!client.connect()) {
+        ADD_FAILURE() << "client " << i << " could not connect";
+        return;
+      }
+      for (int j = 0; j < kRequestsPerClient; j++) {
+        auto ok = client.request(ReplServerMessageType::EVAL_WITH_RESULT,
+                                 fmt::format("(define *compile-server-test-{}* {})", i, j));
+        ASSERT_TRUE(ok.has_value());
+        auto ok_result = nlohmann::json::parse(*ok);
+        EXPECT_TRUE(ok_result.at("ok").get<bool>());
+        EXPECT_EQ(ok_result.at("error").get<std::string>(), "");
+
+        // the error comes back to the client that caused it.
+        auto bad = client.request(ReplServerMessageType::EVAL_WITH_RESULT, "(+ 1 2");
+        ASSERT_TRUE(bad.has_value());
+        auto bad_result = nlohmann::json::parse(*bad);
+        EXPECT_FALSE(bad_result.at("ok").get<bool>());
+        EXPECT_NE(bad_result.at("error").get<std::string>(), "");
+
+        auto formatted = client.request(ReplServerMessageType::FORMAT, "(defun foo ()   (+ 1 2))");
+        ASSERT_TRUE(formatted.has_value());
+        auto format_result = nlohmann::json::parse(*formatted);
+        EXPECT_TRUE(format_result.at("ok").get<bool>());
+        EXPECT_NE(format_result.at("result").get<std::string>(), "");
+        answered++;
+      }
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  EXPECT_EQ(answered, kClients * kRequestsPerClient);
+
+  stop = true;
+  server_thread.join();
+  server.shutdown_server();
+}
@@ -0,0 +1,289 @@
+#include <string>
+#include <thread>
+
+#include "inja.hpp"
+
+#include "game/runtime.h"
+#include "goalc/compiler/Compiler.h"
+#include "goalc/compiler/IROptimizer.h"
+#include "gtest/gtest.h"
+#include "test/goalc/framework/test_runner.h"
+
+// --------
+// Unit tests of the individual passes, on IR built by hand.
+// --------
+
+namespace {
+struct TestFunction {
+  TestFunction() {
+    auto* file = genv.add_file("ir-optimizer-test");
+    auto func = std::make_unique<FunctionEnv>(file, "test-function", &reader);
+    env = func.get();
+    file->add_function(std::move(func));
+    ret = env->make_gpr(TypeSpec("int"));
+  }
+
+  RegVal* make_var() { return env->make_gpr(TypeSpec("int")); }
+
+  template <typename IR_Type, typename... Args>
+  void emit(Args&&... args) {
+    env->emit_ir<IR_Type>(goos::Object(), std::forward<Args>(args)...);
+  }
+
+  void emit_return(RegVal* value) { emit<IR_Return>(ret, value, emitter::RAX); }
+
+  bool is_removed(int idx) const { return dynamic_cast<IR_Null*>(env->code().at(idx).get()); }
+
+  goos::Reader reader;
+  GlobalEnv genv;
+  FunctionEnv* env = nullptr;
+  RegVal* ret = nullptr;
+};
+}  // namespace
+
+TEST(IROptimizer, PropagatesCopy) {
+  TestFunction f;
+  auto a = f.make_var();
+  auto b = f.make_var();
+  f.emit<IR_LoadConstant64>(a, 10);
+  f.emit<IR_RegSet>(b, a);
+  f.emit_return(b);
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.propagated_copies, 1);
+  EXPECT_EQ(stats.removed_instructions, 1);
+  EXPECT_FALSE(f.is_removed(0));
+  EXPECT_TRUE(f.is_removed(1));
+  EXPECT_FALSE(f.is_removed(2));
+}
+
+TEST(IROptimizer, KeepsCopyIntoRletVariable) {
+  TestFunction f;
+  auto a = f.make_var();
+  auto b = f.make_var();
+  b->set_rlet_constraint(emitter::RBX);
+  f.emit<IR_LoadConstant64>(a, 10);
+  f.emit<IR_RegSet>(b, a);
+  f.emit_return(b);
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.propagated_copies, 0);
+  EXPECT_EQ(stats.removed_instructions, 0);
+  EXPECT_NE(dynamic_cast<IR_RegSet*>(f.env->code().at(1).get()), nullptr);
+}
+
+TEST(IROptimizer, KeepsCopyFromConstrainedVariable) {
+  TestFunction f;
+  auto a = f.make_var();
+  auto b = f.make_var();
+  f.emit<IR_LoadConstant64>(a, 10);
+  f.emit<IR_RegSet>(b, a);
+  f.emit_return(b);
+
+  IRegConstraint constraint;
+  constraint.ireg = a->ireg();
+  constraint.instr_idx = 0;
+  constraint.desired_register = emitter::RBX;
+  f.env->constrain(constraint);
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.propagated_copies, 0);
+  EXPECT_EQ(stats.removed_instructions, 0);
+  EXPECT_EQ(f.env->constraints().size(), 2);  // the return, and ours
+}
+
+TEST(IROptimizer, RemovesDeadCode) {
+  TestFunction f;
+  auto a = f.make_var();
+  auto unused = f.make_var();
+  f.emit<IR_LoadConstant64>(a, 10);
+  f.emit<IR_LoadConstant64>(unused, 20);
+  f.emit<IR_IntegerMath>(IntegerMathKind::ADD_64, unused, a);
+  f.emit_return(a);
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.removed_instructions, 2);
+  EXPECT_FALSE(f.is_removed(0));
+  EXPECT_TRUE(f.is_removed(1));
+  EXPECT_TRUE(f.is_removed(2));
+  EXPECT_FALSE(f.is_removed(3));
+}
+
+TEST(IROptimizer, RemovesJumpToNextInstruction) {
+  TestFunction f;
+  auto a = f.make_var();
+  Label next(f.env, 2);
+  f.emit<IR_LoadConstant64>(a, 10);
+  f.emit<IR_GotoLabel>(&next);
+  f.emit_return(a);
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.threaded_jumps, 0);
+  EXPECT_EQ(stats.removed_instructions, 1);
+  EXPECT_TRUE(f.is_removed(1));
+  EXPECT_FALSE(f.is_removed(2));
+}
+
+TEST(IROptimizer, ThreadsJumps) {
+  TestFunction f;
+  auto a = f.make_var();
+  auto b = f.make_var();
+  Label to_goto(f.env, 5);
+  Label end(f.env, 7);
+  f.emit<IR_LoadConstant64>(a, 1);
+  f.emit<IR_LoadConstant64>(b, 2);
+  Condition cond;
+  cond.kind = ConditionKind::EQUAL;
+  cond.a = a;
+  cond.b = b;
+  auto branch_ir = std::make_unique<IR_ConditionalBranch>(cond, to_goto);
+  branch_ir->mark_as_resolved();
+  f.env->emit(goos::Object(), std::move(branch_ir), f.env);
+  f.emit_return(a);
+  f.emit<IR_GotoLabel>(&end);
+  f.emit<IR_GotoLabel>(&end);  // to_goto
+  f.emit_return(b);            // never reached
+  f.emit_return(a);            // end
+
+  auto stats = optimize_ir(f.env);
+  EXPECT_EQ(stats.threaded_jumps, 1);
+  auto* branch = dynamic_cast<IR_ConditionalBranch*>(f.env->code().at(2).get());
+  ASSERT_NE(branch, nullptr);
+  EXPECT_EQ(branch->label.idx, end.idx);
+  // nothing jumps to to_goto anymore, so it can't be reached.
+  EXPECT_FALSE(f.is_removed(4));
+  EXPECT_TRUE(f.is_removed(5));
+  EXPECT_TRUE(f.is_removed(6));
+}
+
+// --------
+// The static compiler tests again, with the optimizer turned on. These should give exactly the same
+// output as they do in test_arithmetic, test_collections and test_control_statements.
+// --------
+
+class IROptimizerTests : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    runtime_thread = std::make_unique<std::thread>(std::thread(GoalTest::runtime_no_kernel_jak1));
+    compiler = std::make_unique<Compiler>(GameVersion::Jak1);
+    compiler->enable_ir_optimizer();
+    runner = std::make_unique<GoalTest::CompilerTestRunner>();
+    runner->c = compiler.get();
+  }
+
+  static void TearDownTestSuite() {
+    compiler->shutdown_target();
+    runtime_thread->join();
+
+    runtime_thread.reset();
+    compiler.reset();
+    runner.reset();
+  }
+
+  void SetUp() {
+    for (auto& category : {arithmetic, collections, control}) {
+      GoalTest::createDirIfAbsent(GoalTest::getTemplateDir(category));
+      GoalTest::createDirIfAbsent(GoalTest::getGeneratedDir(category));
+    }
+  }
+
+  void TearDown() {}
+
+  static std::unique_ptr<std::thread> runtime_thread;
+  static std::unique_ptr<Compiler> compiler;
+  static std::unique_ptr<GoalTest::CompilerTestRunner> runner;
+
+  std::string arithmetic = "arithmetic";
+  std::string collections = "collections";
+  std::string control = "control-statements";
+  inja::Environment env{GoalTest::getTemplateDir(arithmetic),
+                        GoalTest::getGeneratedDir(arithmetic)};
+};
+
+std::unique_ptr<std::thread> IROptimizerTests::runtime_thread;
+std::unique_ptr<Compiler> IROptimizerTests::compiler;
+std::unique_ptr<GoalTest::CompilerTestRunner> IROptimizerTests::runner;
+
+TEST_F(IROptimizerTests, Arithmetic) {
+  runner->run_static_test(env, arithmetic, "add-int-literals.static.gc", {"13\n"});
+  runner->run_static_test(env, arithmetic, "add-let.static.gc", {"7\n"});
+  runner->run_static_test(env, arithmetic, "add-function.static.gc", {"21\n"});
+  runner->run_static_test(env, arithmetic, "add-int-multiple.static.gc", {"15\n"});
+  runner->run_static_test(env, arithmetic, "add-int-multiple-2.static.gc", {"15\n"});
+  runner->run_static_test(env, arithmetic, "add-int-vars.static.gc", {"7\n"});
+  runner->run_static_test(env, arithmetic, "ash.static.gc", {"18\n"});
+  runner->run_static_test(env, arithmetic, "divide-1.static.gc", {"6\n"});
+  runner->run_static_test(env, arithmetic, "divide-2.static.gc", {"7\n"});
+  runner->run_static_test(env, arithmetic, "negative-int-symbol.static.gc", {"-123\n"});
+  runner->run_static_test(env, arithmetic, "mod.static.gc", {"7\n"});
+  runner->run_static_test(env, arithmetic, "multiply.static.gc", {"-12\n"});
+  runner->run_static_test(env, arithmetic, "multiply-let.static.gc", {"3\n"});
+  runner->run_static_test(env, arithmetic, "nested-function.static.gc", {"10\n"});
+  runner->run_static_test(env, arithmetic, "shiftvs.static.gc", {"11\n"});
+  runner->run_static_test(env, arithmetic, "shift-fixed.static.gc", {"11\n"});
+  runner->run_static_test(env, arithmetic, "subtract-1.static.gc", {"4\n"});
+  runner->run_static_test(env, arithmetic, "subtract-2.static.gc", {"4\n"});
+  runner->run_static_test(env, arithmetic, "subtract-let.static.gc", {"3\n"});
+  runner->run_static_test(env, arithmetic, "multiply32.static.gc", {"-1234478448\n"});
+  runner->run_static_test(env, arithmetic, "multiply64.static.gc", {"93270638141856400\n"});
+  runner->run_static_test(env, arithmetic, "float.static.gc", {"1067316150\n"});
+  runner->run_static_test(env, arithmetic, "float-pow.static.gc", {"256\n0\n"});
+  runner->run_static_test(env, arithmetic, "float-product.static.gc", {"120.0000\n0\n"});
+  runner->run_static_test(env, arithmetic, "float-max.static.gc", {"3.70\n0\n"});
+  runner->run_static_test(env, arithmetic, "float-min.static.gc", {"-1.20\n0\n"});
+  runner->run_static_test(env, arithmetic, "logand.static.gc", {"4\n"});
+  runner->run_static_test(env, arithmetic, "logior.static.gc", {"60\n"});
+  runner->run_static_test(env, arithmetic, "logxor.static.gc", {"56\n"});
+  runner->run_static_test(env, arithmetic, "signed-int-compare.static.gc", {"12\n"});
+  runner->run_static_test(env, arithmetic, "mod-unsigned.static.gc", {"ffffffffffffffff 5\n0\n"});
+  runner->run_static_test(
+      env, arithmetic, "nested-float-functions.static.gc",
+      {"i 1.4400 3.4000\nr 10.1523\ni 1.2000 10.1523\nr 17.5432\n17.543 10.152\n0\n"});
+}
+
+TEST_F(IROptimizerTests, Collections) {
+  runner->run_static_test(collections, "empty-pair.static.gc", {"()\n0\n"});
+  runner->run_static_test(collections, "pair-check.static.gc", {"#t#f\n0\n"});
+  runner->run_static_test(collections, "list.static.gc", {"(a b c d)\n0\n"});
+  runner->run_static_test(collections, "inline-array-field.static.gc", {"16\n"});
+  runner->run_static_test(collections, "cons.static.gc", {"(a . b)\n0\n"});
+  runner->run_static_test(collections, "car-cdr-get.static.gc", {"ab\n0\n"});
+  runner->run_static_test(collections, "car-cdr-set.static.gc", {"(c . d)\n0\n"});
+  runner->run_static_test(collections, "nested-car-cdr-set.static.gc",
+                          {"efgh\n((e . g) f . h)\n0\n"});
+}
+
+TEST_F(IROptimizerTests, ControlStatements) {
+  runner->run_static_test(control, "conditional-compilation.static.gc", {"3\n"});
+  runner->run_static_test(control, "nested-blocks-1.static.gc", {"7\n"});
+  runner->run_static_test(control, "nested-blocks-2.static.gc", {"8\n"});
+  runner->run_static_test(control, "nested-blocks-3.static.gc", {"7\n"});
+  runner->run_static_test(control, "goto.static.gc", {"3\n"});
+  runner->run_static_test(control, "return-value-of-if.static.gc", {"123\n"});
+  runner->run_static_test(control, "dotimes.static.gc", {"4950\n"});
+  runner->run_static_test(control, "factorial-recursive.static.gc", {"3628800\n"});
+  runner->run_static_test(control, "factorial-iterative.static.gc", {"3628800\n"});
+  runner->run_static_test(control, "defun-return-constant.static.gc", {"12\n"});
+  runner->run_static_test(control, "defun-return-symbol.static.gc", {"42\n"});
+  runner->run_static_test(control, "return.static.gc", {"77\n"});
+  runner->run_static_test(control, "return-arg.static.gc", {"23\n"});
+  runner->run_static_test(control, "return-colors.static.gc", {"77\n"});
+  runner->run_static_test(control, "nested-call.static.gc", {"2\n"});
+  runner->run_static_test(control, "simple-call.static.gc", {"30\n"});
+  runner->run_static_test(control, "lambda-1.static.gc", {"2\n"});
+  runner->run_static_test(control, "declare-inline.static.gc", {"32\n"});
+  runner->run_static_test(control, "inline-call.static.gc", {"44\n"});
+  runner->run_static_test(control, "function-returning-none.static.gc", {"1\n"});
+  runner->run_static_test(control, "inline-with-block-1.static.gc", {"1\n"});
+  runner->run_static_test(control, "inline-with-block-2.static.gc", {"3\n"});
+  runner->run_static_test(control, "inline-with-block-3.static.gc", {"4\n"});
+  runner->run_static_test(control, "inline-with-block-4.static.gc", {"3.0000\n0\n"});
+  runner->run_static_test(control, "return-from-trick.static.gc", {"1\n"});
+  runner->run_static_test(control, "set-symbol.static.gc", {"22\n"});
+  runner->run_static_test(control, "protect.static.gc", {"33\n"});
+  runner->run_static_test(control, "align16-1.static.gc", {"80\n"});
+  runner->run_static_test(control, "align16-2.static.gc", {"64\n"});
+  runner->run_static_test(control, "defsmacro-defgmacro.static.gc", {"20\n"});
+  runner->run_static_test(control, "desfun.static.gc", {"4\n"});
+  runner->run_static_test(control, "methods.static.gc", {"#t#t\n0\n"});
+}
@@ -0,0 +1,185 @@
+#include <cmath>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include "goalc/build_level/common/mesh_lod.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+struct Mesh {
+  std::vector<math::Vector3f> positions;
+  std::vector<u32> indices;
+};
+
+/*!
+ * A heightfield of n by n quads, with unit spacing and the height from height(x, z).
+ */
+Mesh make_grid(int n, const std::function<float(float, float)>& height) {
+  Mesh mesh;
+  for (int z = 0; z <= n; z++) {
+    for (int x = 0; x <= n; x++) {
+      mesh.positions.emplace_back(x, height(x, z), z);
+    }
+  }
+  auto vtx = [&](int x, int z) { return (u32)(z * (n + 1) + x); };
+  for (int z = 0; z < n; z++) {
+    for (int x = 0; x < n; x++) {
+      mesh.indices.insert(mesh.indices.end(), {vtx(x, z), vtx(x, z + 1), vtx(x + 1, z)});
+      mesh.indices.insert(mesh.indices.end(), {vtx(x + 1, z), vtx(x, z + 1), vtx(x + 1, z + 1)});
+    }
+  }
+  return mesh;
+}
+
+math::Vector3f tri_normal(const Mesh& mesh, const std::vector<u32>& indices, u32 tri) {
+  const auto& a = mesh.positions.at(indices.at(tri * 3));
+  const auto& b = mesh.positions.at(indices.at(tri * 3 + 1));
+  const auto& c = mesh.positions.at(indices.at(tri * 3 + 2));
+  return (b - a).cross(c - a);
+}
+
+// every triangle of a simplified heightfield should still face up, with some area.
+void expect_no_flipped_triangles(const Mesh& mesh, const std::vector<u32>& indices) {
+  ASSERT_EQ(indices.size() % 3, 0);
+  for (u32 t = 0; t < indices.size() / 3; t++) {
+    EXPECT_GT(tri_normal(mesh, indices, t).y(), 1e-4f) << "triangle " << t;
+  }
+}
+
+std::set<u32> used_vertices(const std::vector<u32>& indices) {
+  return std::set<u32>(indices.begin(), indices.end());
+}
+}  // namespace
+
+TEST(MeshLod, SimplifyFlatGrid) {
+  constexpr int kSize = 32;
+  const auto mesh = make_grid(kSize, [](float, float) { return 0.f; });
+  const u32 tri_count = mesh.indices.size() / 3;
+  const auto result = mesh_lod::simplify(mesh.positions, mesh.indices, tri_count / 2, 0.01f);
+
+  // a flat interior costs nothing to remove, so it gets all the way to the target.
+  EXPECT_LE(result.size() / 3, tri_count / 2);
+  EXPECT_GT(result.size(), 0);
+  expect_no_flipped_triangles(mesh, result);
+
+  // the border stays where it was, so neighboring meshes still meet it.
+  const auto used = used_vertices(result);
+  for (int i = 0; i <= kSize; i++) {
+    EXPECT_TRUE(used.count(i)) << i;
+    EXPECT_TRUE(used.count(kSize * (kSize + 1) + i)) << i;
+    EXPECT_TRUE(used.count(i * (kSize + 1))) << i;
+    EXPECT_TRUE(used.count(i * (kSize + 1) + kSize)) << i;
+  }
+}
+
+TEST(MeshLod, SimplifyKeepsFeaturesOverMaxError) {
+  // a flat grid with one raised vertex in the middle.
+  constexpr int kSize = 16;
+  constexpr u32 kPeak = (kSize / 2) * (kSize + 1) + kSize / 2;
+  auto mesh = make_grid(kSize, [](float, float) { return 0.f; });
+  mesh.positions[kPeak].y() = 0.5f;
+
+  // the flat part goes, but removing the peak would move the surface by more than max_error.
+  const u32 tri_count = mesh.indices.size() / 3;
+  const auto result = mesh_lod::simplify(mesh.positions, mesh.indices, 0, 0.1f);
+  EXPECT_LT(result.size() / 3, tri_count);
+  expect_no_flipped_triangles(mesh, result);
+  EXPECT_TRUE(used_vertices(result).count(kPeak));
+
+  // with a big enough max_error, it goes too.
+  const auto flat = mesh_lod::simplify(mesh.positions, mesh.indices, 0, 10.f);
+  expect_no_flipped_triangles(mesh, flat);
+  EXPECT_FALSE(used_vertices(flat).count(kPeak));
+}
+
+TEST(MeshLod, SimplifyUnderTargetIsUnchanged) {
+  const auto mesh = make_grid(4, [](float x, float z) { return std::sin(x) * std::cos(z); });
+  EXPECT_EQ(mesh_lod::simplify(mesh.positions, mesh.indices, 1000, 1.f), mesh.indices);
+}
+
+TEST(MeshLod, ClustersSmallMesh) {
+  const auto mesh = make_grid(4, [](float, float) { return 0.f; });
+  const auto clusters = mesh_lod::build_clusters(mesh.positions, mesh.indices, 512);
+
+  // one cluster, which is the root, with a single leaf.
+  const auto& bvh = clusters.bvh;
+  ASSERT_EQ(bvh.vis_nodes.size(), 1);
+  EXPECT_EQ(bvh.num_roots, 1);
+  EXPECT_EQ(bvh.first_leaf_node, 1);
+  EXPECT_EQ(bvh.last_leaf_node, 1);
+  EXPECT_EQ(bvh.vis_nodes[0].flags, 0);
+  EXPECT_EQ(bvh.vis_nodes[0].num_kids, 1);
+  EXPECT_EQ(bvh.vis_nodes[0].child_id, 1);
+  EXPECT_EQ(clusters.tri_to_vis_node, std::vector<u16>(mesh.indices.size() / 3, 0));
+}
+
+TEST(MeshLod, ClustersLargeMesh) {
+  constexpr u32 kMaxClusterTris = 100;
+  const auto mesh = make_grid(64, [](float x, float z) { return std::sin(x * 0.2f) * z * 0.1f; });
+  const u32 tri_count = mesh.indices.size() / 3;
+  const auto clusters = mesh_lod::build_clusters(mesh.positions, mesh.indices, kMaxClusterTris);
+  const auto& bvh = clusters.bvh;
+  const auto& nodes = bvh.vis_nodes;
+  ASSERT_EQ(clusters.tri_to_vis_node.size(), tri_count);
+  ASSERT_GT(nodes.size(), 1);
+  EXPECT_EQ(bvh.first_root, 0);
+  EXPECT_EQ(bvh.num_roots, 1);
+  EXPECT_EQ(bvh.first_leaf_node, nodes.size());
+
+  auto sphere_contains = [](const math::Vector4f& outer, const math::Vector3f& center,
+                            float radius) {
+    return (center - outer.xyz()).length() + radius <= outer.w() * 1.0001f + 1e-4f;
+  };
+
+  // each node but the root is the child of exactly one node, and each cluster has its own leaf.
+  std::vector<int> parent_count(nodes.size(), 0);
+  std::set<u16> leaves;
+  for (size_t i = 0; i < nodes.size(); i++) {
+    const auto& node = nodes[i];
+    EXPECT_EQ(node.my_id, i);
+    if (node.flags) {
+      ASSERT_GE(node.num_kids, 1);
+      ASSERT_LE(node.num_kids, 8);
+      ASSERT_LE(node.child_id + node.num_kids, nodes.size());
+      EXPECT_GT(node.child_id, i);
+      for (int k = 0; k < node.num_kids; k++) {
+        const auto& child = nodes[node.child_id + k];
+        parent_count[node.child_id + k]++;
+        EXPECT_TRUE(sphere_contains(node.bsphere, child.bsphere.xyz(), child.bsphere.w()))
+            << "child " << node.child_id + k << " of " << i;
+      }
+    } else {
+      EXPECT_EQ(node.num_kids, 1);
+      EXPECT_GE(node.child_id, bvh.first_leaf_node);
+      EXPECT_LE(node.child_id, bvh.last_leaf_node);
+      EXPECT_TRUE(leaves.insert(node.child_id).second);
+    }
+  }
+  EXPECT_EQ(parent_count[0], 0);
+  for (size_t i = 1; i < nodes.size(); i++) {
+    EXPECT_EQ(parent_count[i], 1) << i;
+  }
+  EXPECT_EQ(leaves.size(), bvh.last_leaf_node - bvh.first_leaf_node + 1);
+
+  // every triangle is in a cluster that bounds it, and no cluster is too big.
+  std::vector<u32> cluster_sizes(nodes.size(), 0);
+  for (u32 t = 0; t < tri_count; t++) {
+    const u16 node_idx = clusters.tri_to_vis_node[t];
+    ASSERT_LT(node_idx, nodes.size());
+    const auto& node = nodes[node_idx];
+    EXPECT_EQ(node.flags, 0);
+    cluster_sizes[node_idx]++;
+    for (int i = 0; i < 3; i++) {
+      EXPECT_TRUE(sphere_contains(node.bsphere, mesh.positions[mesh.indices[t * 3 + i]], 0))
+          << "triangle " << t;
+    }
+  }
+  for (size_t i = 0; i < nodes.size(); i++) {
+    if (!nodes[i].flags) {
+      EXPECT_GT(cluster_sizes[i], 0);
+      EXPECT_LE(cluster_sizes[i], kMaxClusterTris);
+    }
+  }
+}
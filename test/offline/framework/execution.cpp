@@ -71,77 +71,70 @@ decompiler::ObjectFileData& get_data(OfflineTestDecompiler& dc,
 }
 
 OfflineTestCompareResult compare(OfflineTestDecompiler& dc,
-                                 const OfflineTestWorkGroup& work_group,
+                                 const OfflineTestSourceFile& file,
                                  const OfflineTestConfig& config) {
   OfflineTestCompareResult compare_result;
 
-  for (const auto& file : work_group.work_collection.source_files) {
-    work_group.status->update_curr_file(file.name_in_dgo);
-    auto& data = get_data(dc, file.unique_name, file.name_in_dgo);
-    std::string result = clean_decompilation_code(data.full_output);
-    std::string ref = clean_decompilation_code(file_util::read_text_file(file.path.string()));
-    compare_result.total_files++;
-    compare_result.total_lines += str_util::line_count(result);
-    if (result != ref) {
-      compare_result.failing_files.push_back({file.unique_name, str_util::diff(ref, result)});
-      compare_result.total_pass = false;
-      if (config.dump_mode) {
-        auto failure_dir = file_util::get_jak_project_dir() / "failures";
-        file_util::create_dir_if_needed(failure_dir);
-        file_util::write_text_file(failure_dir / fmt::format("{}_REF.gc", file.unique_name),
-                                   clean_decompilation_code(data.full_output, true));
-      }
-    } else {
-      compare_result.ok_files++;
+  auto& data = get_data(dc, file.unique_name, file.name_in_dgo);
+  std::string result = clean_decompilation_code(data.full_output);
+  std::string ref = clean_decompilation_code(file_util::read_text_file(file.path.string()));
+  compare_result.total_files++;
+  compare_result.total_lines += str_util::line_count(result);
+  if (result != ref) {
+    compare_result.failing_files.push_back({file.unique_name, str_util::diff(ref, result)});
+    compare_result.total_pass = false;
+    if (config.dump_mode) {
+      auto failure_dir = file_util::get_jak_project_dir() / "failures";
+      file_util::create_dir_if_needed(failure_dir);
+      file_util::write_text_file(failure_dir / fmt::format("{}_REF.gc", file.unique_name),
+                                 clean_decompilation_code(data.full_output, true));
     }
-    work_group.status->complete_step();
+  } else {
+    compare_result.ok_files++;
   }
 
   return compare_result;
 }
 
-OfflineTestCompileResult compile(OfflineTestDecompiler& dc,
-                                 const OfflineTestWorkGroup& work_group,
-                                 const OfflineTestConfig& config) {
-  OfflineTestCompileResult result;
-  Compiler compiler(game_name_to_version(config.game_name));
+std::unique_ptr<Compiler> make_compiler(const OfflineTestConfig& config) {
+  auto compiler = std::make_unique<Compiler>(game_name_to_version(config.game_name));
 
-  compiler.run_front_end_on_file(
-      {"decompiler", "config", game_name_to_all_types[config.game_name]});
-  compiler.run_front_end_on_file(
+  compiler->run_front_end_on_file(
+      {"decompiler", "config", game_name_to_all_types.at(config.game_name)});
+  compiler->run_front_end_on_file(
       {"test", "decompiler", "reference", config.game_name, "decompiler-macros.gc"});
   if (config.game_name == "jak2") {
-    compiler.run_front_end_on_file({"goal_src", "jak2", "engine", "data", "art-elts.gc"});
+    compiler->run_front_end_on_file({"goal_src", "jak2", "engine", "data", "art-elts.gc"});
   } else if (config.game_name == "jak1") {
-    compiler.run_front_end_on_file({"goal_src", "jak1", "engine", "data", "art-elts.gc"});
+    compiler->run_front_end_on_file({"goal_src", "jak1", "engine", "data", "art-elts.gc"});
   } else if (config.game_name == "jak3") {
-    compiler.run_front_end_on_file({"goal_src", "jak3", "engine", "data", "art-elts.gc"});
+    compiler->run_front_end_on_file({"goal_src", "jak3", "engine", "data", "art-elts.gc"});
   }
+  return compiler;
+}
 
-  int total_lines = 0;
-
-  for (const auto& file : work_group.work_collection.source_files) {
-    work_group.status->update_curr_file(file.name_in_dgo);
-    if (config.skip_compile_files.count(file.name_in_dgo)) {
-      lg::warn("Skipping {}", file.name_in_dgo);
-      continue;
-    }
+OfflineTestCompileResult compile(OfflineTestDecompiler& dc,
+                                 Compiler& compiler,
+                                 const OfflineTestSourceFile& file,
+                                 const OfflineTestConfig& config) {
+  OfflineTestCompileResult result;
+  if (config.skip_compile_files.count(file.name_in_dgo)) {
+    lg::warn("Skipping {}", file.name_in_dgo);
+    return result;
+  }
 
-    lg::info("Compiling {}...", file.unique_name);
+  lg::info("Compiling {}...", file.unique_name);
 
-    auto& data = get_data(dc, file.unique_name, file.name_in_dgo);
+  auto& data = get_data(dc, file.unique_name, file.name_in_dgo);
 
-    try {
-      const auto& src = data.output_with_skips;
-      total_lines += str_util::line_count(src);
-      compiler.run_full_compiler_on_string_no_save(src, file.name_in_dgo);
-    } catch (const std::exception& e) {
-      result.ok = false;
-      result.failing_files.push_back({file.name_in_dgo, e.what()});
-    }
-    work_group.status->complete_step();
+  try {
+    const auto& src = data.output_with_skips;
+    result.num_lines += str_util::line_count(src);
+    compiler.run_full_compiler_on_string_no_save(src, file.name_in_dgo);
+  } catch (const std::exception& e) {
+    result.ok = false;
+    result.failing_files.push_back({file.name_in_dgo, e.what()});
   }
 
-  result.num_lines = total_lines;
   return result;
 }
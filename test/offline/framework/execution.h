@@ -5,18 +5,25 @@
 #include "decompiler/ObjectFile/ObjectFileDB.h"
 #include "test/offline/config/config.h"
 
+class Compiler;
+
 struct OfflineTestDecompiler {
   std::unique_ptr<decompiler::ObjectFileDB> db;
   std::unique_ptr<decompiler::Config> config;
 };
 
 void disassemble(OfflineTestDecompiler& dc);
+decompiler::ObjectFileData& get_data(OfflineTestDecompiler& dc,
+                                     const std::string& unique_name,
+                                     const std::string& name_in_dgo);
 void decompile(OfflineTestDecompiler& dc,
                const OfflineTestConfig& config,
                const std::shared_ptr<OfflineTestThreadStatus> status);
 OfflineTestCompareResult compare(OfflineTestDecompiler& dc,
-                                 const OfflineTestWorkGroup& work_group,
+                                 const OfflineTestSourceFile& file,
                                  const OfflineTestConfig& config);
+std::unique_ptr<Compiler> make_compiler(const OfflineTestConfig& config);
 OfflineTestCompileResult compile(OfflineTestDecompiler& dc,
-                                 const OfflineTestWorkGroup& work_group,
+                                 Compiler& compiler,
+                                 const OfflineTestSourceFile& file,
                                  const OfflineTestConfig& config);
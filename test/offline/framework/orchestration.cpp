@@ -1,5 +1,9 @@
 #include "orchestration.h"
 
+#include <algorithm>
+#include <future>
+#include <unordered_map>
+
 #include "execution.h"
 #include "file_management.h"
 
@@ -10,6 +14,7 @@
 #include "common/util/term_util.h"
 
 #include "decompiler/ObjectFile/ObjectFileDB.h"
+#include "goalc/compiler/Compiler.h"
 #include "test/offline/config/config.h"
 
 #include "fmt/color.h"
@@ -18,7 +23,7 @@
 
 OfflineTestThreadManager g_offline_test_thread_manager;
 
-OfflineTestDecompiler setup_decompiler(const OfflineTestWorkGroup& work,
+OfflineTestDecompiler setup_decompiler(const std::vector<OfflineTestSourceFile>& files,
                                        const fs::path& iso_data_path,
                                        const OfflineTestConfig& offline_config) {
   // TODO - pull out extractor logic to determine release into common and use here
@@ -34,7 +39,7 @@ OfflineTestDecompiler setup_decompiler(const OfflineTestWorkGroup& work,
 
   // modify the config
   std::unordered_set<std::string> object_files;
-  for (auto& file : work.work_collection.source_files) {
+  for (auto& file : files) {
     object_files.insert(file.name_in_dgo);  // todo, make this work with unique_name
   }
 
@@ -45,6 +50,7 @@ OfflineTestDecompiler setup_decompiler(const OfflineTestWorkGroup& work,
   // don't try to do this because we can't write the file
   dc.config->generate_symbol_definition_map = false;
   dc.config->process_art_groups = false;  // not needed, art groups are stored in a json file
+  dc.config->ir2_threads = offline_config.num_threads;
 
   std::vector<fs::path> dgo_paths;
   for (auto& x : offline_config.dgos) {
@@ -68,7 +74,7 @@ OfflineTestDecompiler setup_decompiler(const OfflineTestWorkGroup& work,
   if (db_files.size() != object_files.size()) {
     lg::error("DB file error: has {} entries, but expected {}", db_files.size(),
               object_files.size());
-    for (auto& file : work.work_collection.source_files) {
+    for (auto& file : files) {
       if (!db_files.count(file.unique_name)) {
         lg::error(
             "didn't find {}, make sure it's part of the DGO inputs and not in the banned objects "
@@ -82,125 +88,127 @@ OfflineTestDecompiler setup_decompiler(const OfflineTestWorkGroup& work,
   return dc;
 }
 
-std::vector<std::future<OfflineTestThreadResult>> distribute_work(
-    const OfflineTestConfig& offline_config,
-    const std::vector<OfflineTestSourceFile>& files) {
-  // First, group files by their DGO so they can be partitioned
-  std::unordered_map<std::string, OfflineTestWorkCollection> work_colls = {};
+/*!
+ * Run the test with a single decompiler for all of the files. The decompiler runs IR2 analysis on
+ * num_threads threads, then that many workers compare and compile files from a shared queue.
+ */
+OfflineTestThreadResult run_offline_test(const OfflineTestConfig& offline_config,
+                                         const std::vector<OfflineTestSourceFile>& files) {
+  OfflineTestThreadResult result;
+  if (files.empty()) {
+    return result;
+  }
+  Timer total_timer;
 
+  std::set<std::string> all_dgos;
   for (const auto& file : files) {
-    if (work_colls.count(file.containing_dgo) == 0) {
-      work_colls[file.containing_dgo] = OfflineTestWorkCollection();
-    }
-    work_colls[file.containing_dgo].source_files.push_back(file);
+    all_dgos.insert(file.containing_dgo);
   }
+  auto decompiler_status = std::make_shared<OfflineTestThreadStatus>(offline_config);
+  decompiler_status->dgos = all_dgos;
+  decompiler_status->total_steps = files.size();
+  g_offline_test_thread_manager.statuses.push_back(decompiler_status);
 
-  // Now partition by DGO so that threads do not consume unnecessary or duplicate resources
-  //
-  // TODO - additionally, if we have more threads than we can actually utilize we should not
-  // reserve them and dynamically adjust the used thread count
-  std::vector<OfflineTestWorkGroup> work_groups = {};
+  std::vector<std::shared_ptr<OfflineTestThreadStatus>> worker_statuses;
   for (int i = 0; i < (int)offline_config.num_threads; i++) {
-    auto new_group = OfflineTestWorkGroup();
-    new_group.status = std::make_shared<OfflineTestThreadStatus>(offline_config);
-    work_groups.push_back(new_group);
-    g_offline_test_thread_manager.statuses.push_back(new_group.status);
+    worker_statuses.push_back(std::make_shared<OfflineTestThreadStatus>(offline_config));
+    g_offline_test_thread_manager.statuses.push_back(worker_statuses.back());
   }
 
-  g_offline_test_thread_manager.print_current_test_status(offline_config);
+  Timer decompiler_timer;
+  decompiler_status->update_stage(OfflineTestThreadStatus::Stage::PREPARING);
+  auto decompiler = setup_decompiler(files, fs::path(offline_config.iso_data_path), offline_config);
+  disassemble(decompiler);
 
-  // Count the total number of files.
-  // We'll divide the files evenly between workers. We want to avoid the case where all workers need
-  // all DGOs, so assign consecutive files (likely to belong to the same dgo) to the same worker.
-  int total_files = 0;
-  for (const auto& [dgo, work] : work_colls) {
-    total_files += work.source_files.size();
-  }
-  // int divisor = (total_files + work_groups.size() - 1) / work_groups.size();
-
-  // Divide up the work
-  int file_idx = 0;
-  for (const auto& [dgo, work] : work_colls) {
-    // source files
-    for (auto& source_file : work.source_files) {
-      auto& wg = work_groups.at(file_idx % work_groups.size());
-      wg.dgo_set.insert(dgo);
-      wg.work_collection.source_files.push_back(source_file);
-      file_idx++;
-    }
-  }
+  decompiler_status->update_stage(OfflineTestThreadStatus::Stage::DECOMPILING);
+  decompile(decompiler, offline_config, decompiler_status);
+  decompiler_status->update_stage(OfflineTestThreadStatus::Stage::FINISHED);
+  result.time_spent_decompiling = decompiler_timer.getSeconds();
 
-  // Create summary of work for pretty printing.
-  for (auto& wg : work_groups) {
-    wg.status->dgos = wg.dgo_set;
-    wg.status->total_steps = wg.work_size() * 3;  // decomp, compare, compile
+  // start with the biggest files, so a big file isn't the last thing to finish.
+  OfflineTestWorkQueue queue;
+  queue.source_files = files;
+  std::unordered_map<std::string, size_t> output_sizes;
+  for (const auto& file : files) {
+    output_sizes[file.unique_name] =
+        get_data(decompiler, file.unique_name, file.name_in_dgo).output_with_skips.size();
   }
-
-  // Now we can finally create the futures
-  std::vector<std::future<OfflineTestThreadResult>> threads;
-  for (auto& work_group : work_groups) {
-    threads.push_back(std::async(std::launch::async, [&, work_group]() mutable {
-      OfflineTestThreadResult result;
-      if (work_group.work_size() == 0) {
-        return result;
-      }
-      Timer total_timer;
-
-      Timer decompiler_timer;
-      work_group.status->update_stage(OfflineTestThreadStatus::Stage::PREPARING);
-      auto decompiler =
-          setup_decompiler(work_group, fs::path(offline_config.iso_data_path), offline_config);
-      disassemble(decompiler);
-
-      work_group.status->update_stage(OfflineTestThreadStatus::Stage::DECOMPILING);
-      decompile(decompiler, offline_config, work_group.status);
-
-      result.time_spent_decompiling = decompiler_timer.getSeconds();
-
-      work_group.status->update_stage(OfflineTestThreadStatus::Stage::COMPARING);
-      result.compare = compare(decompiler, work_group, offline_config);
-      if (!result.compare.total_pass) {
-        result.exit_code = 1;
-        if (offline_config.fail_on_cmp) {
-          work_group.status->update_stage(OfflineTestThreadStatus::Stage::FAILED);
-          return result;
+  std::stable_sort(queue.source_files.begin(), queue.source_files.end(),
+                   [&](const OfflineTestSourceFile& a, const OfflineTestSourceFile& b) {
+                     return output_sizes.at(a.unique_name) > output_sizes.at(b.unique_name);
+                   });
+
+  Timer compile_timer;
+  std::vector<std::future<OfflineTestThreadResult>> workers;
+  for (auto& status : worker_statuses) {
+    workers.push_back(std::async(std::launch::async, [&, status]() {
+      OfflineTestThreadResult worker_result;
+      status->update_stage(OfflineTestThreadStatus::Stage::PREPARING);
+      auto compiler = make_compiler(offline_config);
+
+      while (auto* file = queue.pop()) {
+        status->add_file(file->containing_dgo, 2);  // compare, compile
+        status->update_stage(OfflineTestThreadStatus::Stage::COMPARING);
+        status->update_curr_file(file->name_in_dgo);
+        auto compare_result = compare(decompiler, *file, offline_config);
+        worker_result.compare.add(compare_result);
+        status->complete_step();
+        if (!compare_result.total_pass) {
+          worker_result.exit_code = 1;
+          if (offline_config.fail_on_cmp) {
+            queue.stop = true;
+            status->update_stage(OfflineTestThreadStatus::Stage::FAILED);
+            return worker_result;
+          }
         }
-      }
 
-      // TODO - if anything has failed, fail fast and skip compiling
-
-      Timer compile_timer;
-      work_group.status->update_stage(OfflineTestThreadStatus::Stage::COMPILING);
-      result.compile = compile(decompiler, work_group, offline_config);
-      result.time_spent_compiling = compile_timer.getSeconds();
-      if (!result.compile.ok) {
-        work_group.status->update_stage(OfflineTestThreadStatus::Stage::FAILED);
-        result.exit_code = 1;
-      } else {
-        work_group.status->update_stage(OfflineTestThreadStatus::Stage::FINISHED);
+        status->update_stage(OfflineTestThreadStatus::Stage::COMPILING);
+        auto compile_result = compile(decompiler, *compiler, *file, offline_config);
+        worker_result.compile.add(compile_result);
+        status->complete_step();
+        if (!compile_result.ok) {
+          worker_result.exit_code = 1;
+        }
       }
-      result.total_time = total_timer.getSeconds();
 
-      return result;
+      status->update_stage(worker_result.exit_code ? OfflineTestThreadStatus::Stage::FAILED
+                                                   : OfflineTestThreadStatus::Stage::FINISHED);
+      return worker_result;
     }));
   }
 
-  return threads;
+  for (auto& worker : workers) {
+    result.add(worker.get());
+  }
+  result.time_spent_compiling = compile_timer.getSeconds();
+  result.total_time = total_timer.getSeconds();
+
+  // the order that workers finish files in isn't fixed, so sort the failures for the report.
+  std::sort(result.compare.failing_files.begin(), result.compare.failing_files.end(),
+            [](const auto& a, const auto& b) { return a.filename < b.filename; });
+  std::sort(result.compile.failing_files.begin(), result.compile.failing_files.end(),
+            [](const auto& a, const auto& b) { return a.filename < b.filename; });
+
+  return result;
 }
 
 void OfflineTestThreadStatus::update_stage(Stage new_stage) {
-  stage = new_stage;
-  g_offline_test_thread_manager.print_current_test_status(config);
+  g_offline_test_thread_manager.update(config, [&]() { stage = new_stage; });
 }
 
 void OfflineTestThreadStatus::update_curr_file(const std::string& _curr_file) {
-  curr_file = _curr_file;
-  g_offline_test_thread_manager.print_current_test_status(config);
+  g_offline_test_thread_manager.update(config, [&]() { curr_file = _curr_file; });
+}
+
+void OfflineTestThreadStatus::add_file(const std::string& dgo, uint32_t steps) {
+  g_offline_test_thread_manager.update(config, [&]() {
+    dgos.insert(dgo);
+    total_steps += steps;
+  });
 }
 
 void OfflineTestThreadStatus::complete_step() {
-  curr_step++;
-  g_offline_test_thread_manager.print_current_test_status(config);
+  g_offline_test_thread_manager.update(config, [&]() { curr_step++; });
 }
 
 bool OfflineTestThreadStatus::in_progress() {
@@ -297,8 +305,6 @@ void OfflineTestThreadManager::print_current_test_status(const OfflineTestConfig
     return;
   }
 
-  std::lock_guard<std::mutex> guard(print_lock);
-
   // Handle terminal height
   auto rows_available = term_util::row_count();
   // Truncate any threads we can't display
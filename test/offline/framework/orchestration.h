@@ -1,6 +1,6 @@
 #pragma once
 
-#include <future>
+#include <atomic>
 #include <mutex>
 #include <set>
 #include <string>
@@ -90,22 +90,29 @@ class OfflineTestThreadStatus {
   std::string curr_file;
   OfflineTestConfig config;
 
+  // these can be called from any thread.
   void update_stage(Stage new_stage);
   void update_curr_file(const std::string& _curr_file);
+  void add_file(const std::string& dgo, uint32_t steps);
   void complete_step();
   bool in_progress();
 };
 
-struct OfflineTestWorkCollection {
+/// @brief The files to test, shared by all of the workers. Each worker takes the next file from
+/// the queue when it's done with the previous one, so one big DGO doesn't hold up the others.
+struct OfflineTestWorkQueue {
   std::vector<OfflineTestSourceFile> source_files;
-};
-
-struct OfflineTestWorkGroup {
-  std::set<std::string> dgo_set;
-  OfflineTestWorkCollection work_collection;
-  std::shared_ptr<OfflineTestThreadStatus> status;
+  std::atomic<int> next_file = 0;
+  // set to stop handing out files, when failing fast.
+  std::atomic<bool> stop = false;
 
-  int work_size() const { return work_collection.source_files.size(); }
+  const OfflineTestSourceFile* pop() {
+    if (stop) {
+      return nullptr;
+    }
+    int idx = next_file++;
+    return idx < (int)source_files.size() ? &source_files[idx] : nullptr;
+  }
 };
 
 class OfflineTestThreadManager {
@@ -116,14 +123,20 @@ class OfflineTestThreadManager {
   int num_threads_succeeded();
   int num_threads_failed();
 
-  void print_current_test_status(const OfflineTestConfig& config);
+  // run f to modify a status, then print the new status.
+  template <typename Func>
+  void update(const OfflineTestConfig& config, Func f) {
+    std::lock_guard<std::mutex> guard(lock);
+    f();
+    print_current_test_status(config);
+  }
 
  private:
-  std::mutex print_lock;
+  void print_current_test_status(const OfflineTestConfig& config);
+  std::mutex lock;
 };
 
 extern OfflineTestThreadManager g_offline_test_thread_manager;
 
-std::vector<std::future<OfflineTestThreadResult>> distribute_work(
-    const OfflineTestConfig& offline_config,
-    const std::vector<OfflineTestSourceFile>& files);
+OfflineTestThreadResult run_offline_test(const OfflineTestConfig& offline_config,
+                                         const std::vector<OfflineTestSourceFile>& files);
@@ -1,5 +1,5 @@
-#include <future>
 #include <string>
+#include <thread>
 
 #include "common/log/log.h"
 #include "common/util/term_util.h"
@@ -38,7 +38,7 @@ int main(int argc, char* argv[]) {
   app.add_option("-m,--max_files", max_files,
                  "Limit the amount of files ran in a single test, picks the first N");
   app.add_option("-t,--num_threads", num_threads,
-                 "The number of threads to partition the offline test work between");
+                 "The number of threads to decompile, compare and compile with");
   app.add_option("-f,--file", single_file,
                  "Limit the offline test routine to a single file to decompile/compile -- useful "
                  "when you are just iterating on a single file");
@@ -64,6 +64,13 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // Figure out the number of threads
+  if (num_threads < 1) {
+    num_threads = 1;
+  } else if (num_threads > 1) {
+    num_threads = std::min(num_threads, std::thread::hardware_concurrency());
+  }
+
   // Setup environment, fetch files
   auto config = OfflineTestConfig(game_name, iso_data_path, num_threads, dump_current_output,
                                   fail_on_cmp, false, pretty_print);
@@ -74,23 +81,9 @@ int main(int argc, char* argv[]) {
     source_files.erase(source_files.begin() + max_files, source_files.end());
   }
 
-  // Figure out the number of threads, prepare their statuses and start printing it
-  if (num_threads < 1) {
-    num_threads = 1;
-  } else if (num_threads > 1) {
-    num_threads = std::min(num_threads, std::thread::hardware_concurrency());
-  }
-
-  // Distribute the work amongst the threads, partitioning by DGO
+  // Decompile everything once, then compare and compile on all threads
   decompiler::init_opcode_info();
-  auto workers = distribute_work(config, source_files);
-
-  // summarize results:
-  OfflineTestThreadResult total;
-  for (auto& worker : workers) {
-    auto ret = worker.get();
-    total.add(ret);
-  }
+  auto total = run_offline_test(config, source_files);
 
   if (!total.compare.total_pass) {
     lg::error("Comparison failed.");
@@ -1,19 +1,41 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <limits>
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "common/dma/dma_copy.h"
+#include "common/global_profiler/Telemetry.h"
+#include "common/texture/texture_compression.h"
 #include "common/util/Assert.h"
+#include "common/util/BackgroundFileWriter.h"
 #include "common/util/BitUtils.h"
+#include "common/util/CompletionIndex.h"
 #include "common/util/CopyOnWrite.h"
 #include "common/util/FileUtil.h"
+#include "common/util/FlatHashMap.h"
+#include "common/util/FlatMap.h"
+#include "common/util/FontUtils.h"
+#include "common/util/MonotonicArena.h"
 #include "common/util/Range.h"
 #include "common/util/SmallVector.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/TripleBuffer.h"
 #include "common/util/Trie.h"
 #include "common/util/crc32.h"
+#include "common/util/gltf_util.h"
+#include "common/util/hash.h"
 #include "common/util/json_util.h"
 #include "common/util/os.h"
 #include "common/util/print_float.h"
+#include "common/util/string_util.h"
 
 #include "gtest/gtest.h"
 #include "test/all_jak1_symbols.h"
@@ -59,6 +81,62 @@ TEST(CommonUtil, Trie) {
   EXPECT_FALSE(test.lookup("path1-k") == nullptr);
 }
 
+TEST(CommonUtil, CompletionIndex) {
+  std::vector<std::string> strings(std::begin(all_syms), std::end(all_syms));
+  strings.push_back("path");  // duplicates are only stored once
+  CompletionIndex index(strings);
+  EXPECT_EQ(index.size(), 7941);
+
+  // same results as the trie above
+  EXPECT_EQ(index.with_prefix("cam").size(), 184);
+  EXPECT_EQ(index.with_prefix("").size(), 7941);
+  EXPECT_EQ(index.with_prefix("not-in-the-list").size(), 0u);
+  auto path = index.with_prefix("path");
+  EXPECT_TRUE(std::is_sorted(path.begin(), path.end()));
+  EXPECT_EQ(path.front(), "path");
+  auto cam = index.with_prefix("cam");
+  EXPECT_EQ(index.with_prefix("cam", 5), std::vector<std::string>(cam.begin(), cam.begin() + 5));
+
+  // an exact match is best, then names starting with the query
+  auto fuzzy = index.fuzzy("path", 10);
+  ASSERT_EQ(fuzzy.size(), 10);
+  EXPECT_EQ(fuzzy.front(), "path");
+  EXPECT_TRUE(str_util::starts_with(fuzzy.at(1), "path"));
+
+  // the characters don't have to be next to each other
+  auto rotate = index.fuzzy("camrot", 20);
+  EXPECT_NE(std::find(rotate.begin(), rotate.end(), "cam-rotation-tracker"), rotate.end());
+  for (const auto& name : rotate) {
+    EXPECT_EQ(index.fuzzy(name, 1), std::vector<std::string>{name});
+  }
+  EXPECT_TRUE(index.fuzzy("zzzzzzzzzz", 10).empty());
+  EXPECT_TRUE(index.fuzzy("cam", 0).empty());
+}
+
+TEST(CommonUtil, RemapTrie) {
+  RemapTrie trie;
+  trie.add("~Y", 2, 0);
+  trie.add("~Y~Z", 4, 1);
+  trie.add("a", 1, 2);
+  trie.add("a", 1, 3);  // same key and score, the first one wins
+  trie.add(std::string_view("\x03\0", 2), 5, 4);
+  trie.add("bc", 2, 5);
+
+  auto find = [&](std::string_view str, bool past_end = false) {
+    return trie.find(str.data(), str.size(), past_end);
+  };
+  EXPECT_EQ(find("x"), -1);
+  EXPECT_EQ(find(""), -1);
+  EXPECT_EQ(find("~Y~"), 0);
+  EXPECT_EQ(find("~Y~Zabc"), 1);  // longest match
+  EXPECT_EQ(find("abc"), 2);
+  EXPECT_EQ(find("b"), -1);
+  EXPECT_EQ(find("b", true), 5);  // runs past the end
+  EXPECT_EQ(find("~Y~", true), 1);
+  EXPECT_EQ(find("bd", true), -1);
+  EXPECT_EQ(find(std::string_view("\x03\0", 2)), 4);  // keys can contain zero bytes
+}
+
 TEST(CommonUtil, StripComments) {
   std::string test_input =
       R"(
@@ -80,6 +158,11 @@ test "asdf /* y */ /////a\"bcd"
 )";
 
   EXPECT_EQ(strip_cpp_style_comments(test_input), test_expected);
+  // no newline after the last comment, and comments right next to text
+  EXPECT_EQ(strip_cpp_style_comments("a/**/b/*/ c */d/e // end"), "abd/e ");
+  EXPECT_EQ(strip_cpp_style_comments("{\"k\": \"//\"}// x"), "{\"k\": \"//\"}");
+  EXPECT_ANY_THROW(strip_cpp_style_comments("abc /* def"));
+  EXPECT_ANY_THROW(strip_cpp_style_comments("abc \"def"));
 }
 
 TEST(CommonUtil, RangeIterator) {
@@ -143,11 +226,22 @@ TEST(CommonUtil, FloatToString) {
   EXPECT_EQ("1460961.2", float_to_string(1460961.25));
   EXPECT_EQ("1460961.2", float_to_string(1460961.20));
   EXPECT_EQ("1460961.2", float_to_string(1460961.30));
+
+  EXPECT_EQ("0.0", float_to_string(0.f));
+  EXPECT_EQ("0", float_to_string(-0.f, false));
+  EXPECT_EQ("-1.5", float_to_string(-1.5f));
+  EXPECT_EQ("1234000.0", float_to_string(1234000));
+  EXPECT_EQ("1234000", float_to_string(1234000, false));
+  EXPECT_EQ("12.345", float_to_string(12.345f));
+  EXPECT_EQ("-0.00342", float_to_string(-0.00342f));
+  char buffer[64];
+  EXPECT_EQ(float_to_cstr(-12.5f, buffer), 5);
+  EXPECT_STREQ(buffer, "-12.5");
 }
 
 TEST(CommonUtil, PowerOfTwo) {
   EXPECT_EQ(get_power_of_two(0), std::nullopt);
-  EXPECT_EQ(get_power_of_two(1), 0);
+  EXPECT_EQ(get_power_of_two(1), 0u);
   EXPECT_EQ(get_power_of_two(2), 1);
   EXPECT_EQ(get_power_of_two(3), std::nullopt);
   EXPECT_EQ(get_power_of_two(4), 2);
@@ -195,6 +289,87 @@ TEST(CommonUtil, CopyOnWrite) {
   EXPECT_EQ(*z, 15);
 }
 
+TEST(ThreadPool, ParallelFor) {
+  ThreadPool pool(4);
+  std::vector<int> results(1000, 0);
+  pool.parallel_for(results.size(), [&](int i) { results[i] = i * 2; });
+  for (int i = 0; i < (int)results.size(); i++) {
+    EXPECT_EQ(results[i], i * 2);
+  }
+}
+
+TEST(ThreadPool, NestedParallelFor) {
+  ThreadPool pool(2);
+  std::atomic<int> total = 0;
+  pool.parallel_for(8, [&](int) { pool.parallel_for(100, [&](int j) { total += j; }); });
+  EXPECT_EQ(total, 8 * 4950);
+}
+
+TEST(ThreadPool, ParallelForStaysWithinThreadCount) {
+  ThreadPool pool(2);
+  std::atomic<int> running = 0;
+  std::atomic<int> max_running = 0;
+  pool.parallel_for(32, [&](int) {
+    int now = ++running;
+    int prev = max_running;
+    while (now > prev && !max_running.compare_exchange_weak(prev, now)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    running--;
+  });
+  EXPECT_LE(max_running, pool.num_threads());
+}
+
+TEST(ThreadPool, ParallelForException) {
+  ThreadPool pool(3);
+  EXPECT_THROW(pool.parallel_for(100,
+                                 [&](int i) {
+                                   if (i == 50) {
+                                     throw std::runtime_error("fail");
+                                   }
+                                 }),
+               std::runtime_error);
+}
+
+TEST(ThreadPool, Submit) {
+  ThreadPool pool(2);
+  auto a = pool.submit([]() { return 12; });
+  auto b = pool.submit([]() { throw std::runtime_error("fail"); });
+  EXPECT_EQ(pool.wait(a), 12);
+  EXPECT_THROW(pool.wait(b), std::runtime_error);
+}
+
+TEST(ThreadPool, TaskGraph) {
+  ThreadPool pool(4);
+  TaskGraph graph(pool);
+  std::atomic<int> counter = 0;
+  std::vector<int> order(4, -1);
+  auto first = graph.add([&]() { order[0] = counter++; });
+  auto left = graph.add([&]() { order[1] = counter++; }, {first});
+  auto right = graph.add([&]() { order[2] = counter++; }, {first});
+  graph.add([&]() { order[3] = counter++; }, {left, right});
+  graph.run();
+  EXPECT_EQ(order[0], 0);
+  EXPECT_GT(order[1], order[0]);
+  EXPECT_GT(order[2], order[0]);
+  EXPECT_EQ(order[3], 3);
+
+  // can run it again.
+  counter = 0;
+  graph.run();
+  EXPECT_EQ(order[3], 3);
+}
+
+TEST(ThreadPool, TaskGraphException) {
+  ThreadPool pool(2);
+  TaskGraph graph(pool);
+  bool ran_dependent = false;
+  auto failing = graph.add([]() { throw std::runtime_error("fail"); });
+  graph.add([&]() { ran_dependent = true; }, {failing});
+  EXPECT_THROW(graph.run(), std::runtime_error);
+  EXPECT_FALSE(ran_dependent);
+}
+
 namespace cu {
 namespace test {
 
@@ -252,7 +427,7 @@ struct RuleOfFiveExample {
 TEST(SmallVector, NoConstruction) {
   // Confirm that an empty vector constructs nothing.
   SmallVector<ThrowOnDefaultConstruct, 128> empty;
-  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.size(), 0u);
   EXPECT_TRUE(empty.empty());
 
   // should also destroy nothing
@@ -383,10 +558,10 @@ TEST(SmallVector, CopyAssign) {
 
 TEST(SmallVector, Construction) {
   SmallVector<ThrowOnDefaultConstruct, 128> empty;
-  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.size(), 0u);
   EXPECT_TRUE(empty.empty());
   empty.reserve(256);
-  EXPECT_EQ(empty.size(), 0);
+  EXPECT_EQ(empty.size(), 0u);
   EXPECT_TRUE(empty.empty());
   empty.shrink_to_fit();
   EXPECT_EQ(empty.capacity(), 128);
@@ -396,7 +571,195 @@ TEST(SmallVector, Construction) {
   EXPECT_FALSE(one.empty());
 }
 
+TEST(FlatHashMap, MatchesUnorderedMap) {
+  cu::FlatHashMap<std::string, int> map;
+  std::unordered_map<std::string, int> ref;
+  u32 seed = 12345;
+  auto next = [&]() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+  };
+  for (int i = 0; i < 20000; i++) {
+    auto key = fmt::format("key-{}", next() % 500);
+    int value = next();
+    switch (next() % 3) {
+      case 0:
+        map[key] = value;
+        ref[key] = value;
+        break;
+      case 1:
+        EXPECT_EQ(map.insert({key, value}).second, ref.insert({key, value}).second);
+        break;
+      case 2:
+        EXPECT_EQ(map.erase(key), ref.erase(key));
+        break;
+    }
+    ASSERT_EQ(map.size(), ref.size());
+  }
+
+  size_t count = 0;
+  for (const auto& [key, value] : map) {
+    EXPECT_EQ(ref.at(key), value);
+    count++;
+  }
+  EXPECT_EQ(count, ref.size());
+  for (const auto& [key, value] : ref) {
+    auto it = map.find(key);
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->second, value);
+  }
+  EXPECT_FALSE(map.contains("missing"));
+
+  auto copy = map;
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.find("key-1") == map.end());
+  EXPECT_EQ(copy.size(), ref.size());
+  auto moved = std::move(copy);
+  EXPECT_EQ(moved.size(), ref.size());
+}
+
+TEST(FlatMap, SortedLikeMap) {
+  cu::FlatMap<std::string, int> map;
+  std::map<std::string, int> ref;
+  u32 seed = 6789;
+  auto next = [&]() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+  };
+  for (int i = 0; i < 5000; i++) {
+    auto key = fmt::format("key-{}", next() % 300);
+    if (next() % 4 == 0) {
+      EXPECT_EQ(map.erase(key), ref.erase(key));
+    } else {
+      map[key] += i;
+      ref[key] += i;
+    }
+  }
+  ASSERT_EQ(map.size(), ref.size());
+  auto it = map.begin();
+  for (const auto& [key, value] : ref) {
+    EXPECT_EQ(it->first, key);
+    EXPECT_EQ(it->second, value);
+    EXPECT_EQ(map.at(key), value);
+    ++it;
+  }
+  EXPECT_TRUE(map.find("missing") == map.end());
+}
+
+TEST(Hash, StreamingMatchesOneShot) {
+  std::vector<u8> data(70000);
+  u64 x = 1;
+  for (auto& byte : data) {
+    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    byte = x >> 56;
+  }
+  std::vector<size_t> sizes;
+  for (size_t i = 0; i <= 300; i++) {
+    sizes.push_back(i);
+  }
+  for (size_t size : {511, 512, 513, 1023, 1024, 1025, 1088, 1089, 4096, 69999}) {
+    sizes.push_back(size);
+  }
+  std::unordered_set<u64> seen;
+  for (size_t size : sizes) {
+    for (u64 seed : {0ULL, 1234ULL}) {
+      const u64 expected = hash_util::hash64(data.data(), size, seed);
+      const auto expected128 = hash_util::hash128(data.data(), size, seed);
+      EXPECT_EQ(expected, hash_util::hash64_scalar(data.data(), size, seed)) << size;
+      seen.insert(expected);
+      for (size_t split : {size_t(0), size / 3, size - size / 5, size}) {
+        hash_util::Hasher hasher(seed);
+        hasher.update(data.data(), split);
+        hasher.update(data.data() + split, (size - split) / 2);
+        hasher.update(data.data() + split + (size - split) / 2, size - split - (size - split) / 2);
+        EXPECT_EQ(hasher.digest64(), expected) << size << " " << split;
+        EXPECT_TRUE(hasher.digest128() == expected128) << size << " " << split;
+      }
+      hash_util::Hasher bytewise(seed);
+      for (size_t i = 0; i < std::min(size, size_t(2000)); i++) {
+        bytewise.update(data.data() + i, 1);
+      }
+      if (size <= 2000) {
+        EXPECT_EQ(bytewise.digest64(), expected) << size;
+      }
+    }
+  }
+  // every size and seed should hash differently
+  EXPECT_EQ(seen.size(), sizes.size() * 2);
+}
+
+TEST(TripleBuffer, LatestValue) {
+  TripleBuffer<int> buffer;
+  int value = -1;
+  EXPECT_FALSE(buffer.read(&value));
+  EXPECT_EQ(value, -1);
+  buffer.write(1);
+  buffer.write(2);
+  EXPECT_TRUE(buffer.read(&value));
+  EXPECT_EQ(value, 2);
+  // reading again gives the same value
+  EXPECT_TRUE(buffer.read(&value));
+  EXPECT_EQ(value, 2);
+  buffer.write(3);
+  EXPECT_TRUE(buffer.read(&value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(TripleBuffer, Threaded) {
+  struct Value {
+    int a = 0;
+    int b = 0;
+  };
+  TripleBuffer<Value> buffer;
+  constexpr int kWrites = 200000;
+  std::thread writer([&]() {
+    for (int i = 1; i <= kWrites; i++) {
+      buffer.write({i, -i});
+    }
+  });
+  int last = 0;
+  while (last < kWrites) {
+    Value value;
+    if (buffer.read(&value)) {
+      ASSERT_EQ(value.a, -value.b);
+      ASSERT_GE(value.a, last);
+      last = value.a;
+    }
+  }
+  writer.join();
+}
+
 #ifndef NO_ASSERT
+TEST(MonotonicArena, Alignment) {
+  MonotonicArena arena(64);
+  for (int i = 0; i < 1000; i++) {
+    auto* byte = arena.create<u8>(i);
+    EXPECT_EQ(*byte, (u8)i);
+    auto* word = arena.create<u64>(i);
+    EXPECT_EQ((uintptr_t)word % alignof(u64), 0u);
+    EXPECT_EQ(*word, (u64)i);
+    struct alignas(64) Wide {
+      u8 data[64];
+    };
+    auto* wide = arena.create<Wide>();
+    EXPECT_EQ((uintptr_t)wide % 64, 0u);
+  }
+}
+
+TEST(MonotonicArena, LargeAllocation) {
+  MonotonicArena arena(64);
+  auto* small = (u8*)arena.allocate(16, 1);
+  auto* large = (u8*)arena.allocate(1 << 22, 16);
+  memset(large, 0xaa, 1 << 22);
+  memset(small, 0x55, 16);
+  EXPECT_EQ(large[0], 0xaa);
+  EXPECT_EQ(large[(1 << 22) - 1], 0xaa);
+  EXPECT_GE(arena.bytes_reserved(), (size_t)(1 << 22));
+  arena.reset();
+  EXPECT_EQ(arena.bytes_reserved(), 0u);
+}
+
 TEST(Assert, Death) {
   EXPECT_DEATH(private_assert_failed("foo", "bar", 12, "aaa"), "");
 }
@@ -423,5 +786,248 @@ TEST(CRC32, Reference) {
   }
 }
 
+TEST(TextureCompression, SolidBlocksAreExact) {
+  for (u32 color : {0xff000000u, 0xffffffffu, 0xff0000ffu, 0x80ff0000u}) {
+    std::vector<u32> texels(8 * 8, color);
+    auto format = bc_pick_format(texels.data(), texels.size());
+    EXPECT_EQ(format, (color >> 24) == 0xff ? BcFormat::BC1 : BcFormat::BC3);
+    auto compressed = bc_compress_mip_chain(texels.data(), 8, 8, format);
+    EXPECT_EQ(compressed.size(), bc_mip_chain_size(8, 8, format));
+    std::vector<u32> decompressed(8 * 8);
+    bc_decompress_level(compressed.data(), 8, 8, format, decompressed.data());
+    EXPECT_EQ(decompressed, texels);
+  }
+}
+
+TEST(TextureCompression, GradientRoundTrip) {
+  // 6x5 isn't a multiple of the block size, so this also covers partial blocks. The color only
+  // varies along x, so it lies on a line within each block, which is what BC1 can represent.
+  const u32 w = 6, h = 5;
+  std::vector<u32> texels;
+  for (u32 y = 0; y < h; y++) {
+    for (u32 x = 0; x < w; x++) {
+      texels.push_back((x * 30) | ((x * 15 + 40) << 8) | (0x40 << 16) | ((y * 50 + 20) << 24));
+    }
+  }
+  auto compressed = bc_compress_mip_chain(texels.data(), w, h, BcFormat::BC3);
+  EXPECT_EQ(bc_num_mip_levels(w, h), 3u);
+  EXPECT_EQ(compressed.size(), 16u * (4 + 1 + 1));
+  std::vector<u32> decompressed(w * h);
+  bc_decompress_level(compressed.data(), w, h, BcFormat::BC3, decompressed.data());
+  for (u32 i = 0; i < w * h; i++) {
+    for (int c = 0; c < 4; c++) {
+      int expected = (texels[i] >> (8 * c)) & 0xff;
+      int actual = (decompressed[i] >> (8 * c)) & 0xff;
+      EXPECT_NEAR(expected, actual, 24) << "texel " << i << " channel " << c;
+    }
+  }
+}
+
+TEST(GltfUtil, OptimizeVertexCache) {
+  // a grid of quads, in rows longer than the cache.
+  const u32 n = 40;
+  const u32 vertex_count = (n + 1) * (n + 1);
+  auto vtx = [&](u32 x, u32 y) { return y * (n + 1) + x; };
+  std::vector<u32> indices;
+  for (u32 y = 0; y < n; y++) {
+    for (u32 x = 0; x < n; x++) {
+      indices.insert(indices.end(), {vtx(x, y), vtx(x + 1, y), vtx(x + 1, y + 1)});
+      indices.insert(indices.end(), {vtx(x, y), vtx(x + 1, y + 1), vtx(x, y + 1)});
+    }
+  }
+
+  auto sorted_tris = [](const std::vector<u32>& inds) {
+    std::vector<std::array<u32, 3>> tris;
+    for (size_t i = 0; i < inds.size(); i += 3) {
+      tris.push_back({inds[i], inds[i + 1], inds[i + 2]});
+    }
+    std::sort(tris.begin(), tris.end());
+    return tris;
+  };
+
+  const float acmr_before = gltf_util::average_cache_miss_ratio(indices, vertex_count, 16);
+  const auto tris_before = sorted_tris(indices);
+  gltf_util::optimize_vertex_cache(indices, vertex_count);
+  const float acmr_after = gltf_util::average_cache_miss_ratio(indices, vertex_count, 16);
+
+  // same triangles, with the same winding.
+  EXPECT_EQ(sorted_tris(indices), tris_before);
+  EXPECT_GT(acmr_before, 0.95f);
+  EXPECT_LT(acmr_after, 0.75f);
+}
+
+TEST(GltfUtil, DedupVertices) {
+  std::vector<tfrag3::PreloadedVertex> in;
+  for (int i = 0; i < 1000; i++) {
+    auto& v = in.emplace_back();
+    // fields swapped and repeated, which a hash that xors them together can't tell apart.
+    v.x = i % 10;
+    v.y = (i / 10) % 10;
+    v.z = v.x;
+    v.s = v.y;
+    v.t = 0;
+    v.color_index = (i % 200) < 100 ? 0 : 1;
+  }
+  std::vector<tfrag3::PreloadedVertex> out;
+  std::vector<u32> old_to_new;
+  gltf_util::dedup_vertices(in, out, old_to_new);
+
+  ASSERT_EQ(out.size(), 200u);
+  ASSERT_EQ(old_to_new.size(), in.size());
+  for (size_t i = 0; i < in.size(); i++) {
+    EXPECT_TRUE(out.at(old_to_new[i]) == in[i]);
+    // in the order they were first seen
+    if (i < 100) {
+      EXPECT_EQ(old_to_new[i], i);
+    }
+  }
+  EXPECT_EQ(old_to_new[100], 100u);
+  EXPECT_EQ(old_to_new[200], 0u);
+}
+
 }  // namespace test
 }  // namespace cu
+
+namespace {
+void write_tag(std::vector<u8>& memory, u32 addr, DmaTag::Kind kind, u16 qwc, u32 next) {
+  u64 tag = u64(qwc) | (u64(kind) << 28) | (u64(next) << 32);
+  memcpy(memory.data() + addr, &tag, 8);
+}
+}  // namespace
+
+TEST(DmaCopy, Incremental) {
+  constexpr u32 chunk = FixedChunkDmaCopier::chunk_size;
+  std::vector<u8> memory(16 * chunk);
+  for (size_t i = 0; i < memory.size(); i++) {
+    memory[i] = i * 7;
+  }
+  // a packet in chunk 5 that refs data in chunk 9, then goes to a packet in chunk 12.
+  const u32 a = 5 * chunk + 0x100, data = 9 * chunk + 0x40, b = 12 * chunk + 0x200;
+  write_tag(memory, a, DmaTag::Kind::REF, 2, data);
+  write_tag(memory, a + 16, DmaTag::Kind::NEXT, 1, b);
+  write_tag(memory, b, DmaTag::Kind::END, 0, 0);
+
+  FixedChunkDmaCopier copier(memory.size());
+  copier.set_incremental(true);
+  auto check = [&](u32 start) {
+    const auto& result = copier.run(memory.data(), start);
+    EXPECT_EQ(flatten_dma(DmaFollower(memory.data(), start)),
+              flatten_dma(DmaFollower(result.data.data(), result.start_offset)));
+    return (u32)result.stats.num_copied_bytes;
+  };
+
+  EXPECT_EQ(check(a), 3 * chunk);
+  EXPECT_EQ(check(a), 0u);
+  memory[data + 3]++;
+  EXPECT_EQ(check(a), chunk);
+
+  // a chain that reads the tags of the first one as data, from the same chunks. The copy is
+  // reused, but the tags shouldn't still have the addresses fixed up by the last run.
+  write_tag(memory, a - 16, DmaTag::Kind::CNT, 2, 0);
+  write_tag(memory, a + 32, DmaTag::Kind::END, 0, 0);
+  EXPECT_EQ(check(a - 16), chunk);
+  EXPECT_EQ(check(a - 16), 0u);
+  EXPECT_EQ(check(a), 2 * chunk);
+  EXPECT_EQ(check(a - 16), 0u);
+}
+
+TEST(Telemetry, Report) {
+  const auto path = fs::temp_directory_path() / "opengoal-test-telemetry.jsonl";
+  fs::remove(path);
+  {
+    Telemetry t;
+    EXPECT_TRUE(t.open(path.string(), 1000.));
+    t.set_info_callback([](nlohmann::json& report) { report["levels"] = {"village1"}; });
+    for (int i = 0; i < 99; i++) {
+      t.frame(0.016, 0.025);
+    }
+    t.add_event_time("upload-textures", 0.030);
+    t.count_event("wait-for-dma-timeout");
+    t.frame(0.040, 0.025);
+    t.frame(0.030, 0.025);  // nothing took long enough to blame
+    t.flush();
+  }
+  auto lines = str_util::split(file_util::read_text_file(path), '\n');
+  fs::remove(path);
+  auto report = nlohmann::json::parse(lines.at(0));
+  EXPECT_EQ(report["frames"], 101);
+  EXPECT_FLOAT_EQ(report["frame_ms"]["p50"].get<float>(), 16);
+  EXPECT_FLOAT_EQ(report["frame_ms"]["p99"].get<float>(), 30);
+  EXPECT_FLOAT_EQ(report["frame_ms"]["max"].get<float>(), 40);
+  EXPECT_EQ(report["long_frames"], 2);
+  EXPECT_EQ(report["long_frame_causes"]["upload-textures"], 1);
+  EXPECT_EQ(report["long_frame_causes"]["unknown"], 1);
+  EXPECT_EQ(report["events"]["wait-for-dma-timeout"], 1);
+  EXPECT_EQ(report["levels"][0], "village1");
+}
+
+TEST(FileUtil, WriteBinaryFileAtomic) {
+  const auto dir = fs::temp_directory_path() / "opengoal-test-atomic";
+  fs::remove_all(dir);
+  const auto path = dir / "sub" / "file.bin";
+  auto temp_path = path;
+  temp_path += ".tmp";
+
+  // creates the directories.
+  std::vector<u8> old_data = {1, 2, 3};
+  EXPECT_TRUE(file_util::write_binary_file_atomic(path, old_data.data(), old_data.size()));
+  EXPECT_EQ(file_util::read_binary_file(path), old_data);
+  EXPECT_FALSE(fs::exists(temp_path));
+
+  std::vector<u8> new_data(10000, 7);
+  EXPECT_TRUE(file_util::write_binary_file_atomic(path, new_data.data(), new_data.size()));
+  EXPECT_EQ(file_util::read_binary_file(path), new_data);
+  EXPECT_FALSE(fs::exists(temp_path));
+
+  // if the temporary file can't be written, the old file is left alone.
+  fs::create_directory(temp_path);
+  EXPECT_FALSE(file_util::write_binary_file_atomic(path, old_data.data(), old_data.size()));
+  EXPECT_EQ(file_util::read_binary_file(path), new_data);
+
+  fs::remove_all(dir);
+}
+
+TEST(BackgroundFileWriter, QueuedWrites) {
+  const auto dir = fs::temp_directory_path() / "opengoal-test-background";
+  fs::remove_all(dir);
+  const auto a = dir / "a.bin";
+  const auto b = dir / "b.bin";
+  {
+    BackgroundFileWriter writer;
+    for (u8 i = 0; i < 20; i++) {
+      writer.write(a, std::vector<u8>(1000, i));
+      // readers see the newest data, even before it's written.
+      auto pending = writer.pending(a);
+      if (pending) {
+        EXPECT_EQ(*pending, std::vector<u8>(1000, i));
+      } else {
+        EXPECT_EQ(file_util::read_binary_file(a), std::vector<u8>(1000, i));
+      }
+    }
+    writer.write_text(b, "hello");
+    writer.flush();
+    EXPECT_EQ(writer.pending(a), nullptr);
+    EXPECT_EQ(writer.pending(b), nullptr);
+    EXPECT_EQ(file_util::read_binary_file(a), std::vector<u8>(1000, 19));
+    EXPECT_EQ(file_util::read_text_file(b), "hello\n");
+  }
+  EXPECT_FALSE(fs::exists(dir / "a.bin.tmp"));
+  EXPECT_FALSE(fs::exists(dir / "b.bin.tmp"));
+  fs::remove_all(dir);
+}
+
+TEST(BackgroundFileWriter, FinishesOnDestruction) {
+  const auto dir = fs::temp_directory_path() / "opengoal-test-background-exit";
+  fs::remove_all(dir);
+  {
+    BackgroundFileWriter writer;
+    for (int i = 0; i < 10; i++) {
+      writer.write(dir / fmt::format("{}.bin", i), std::vector<u8>(100000, i));
+    }
+  }
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(file_util::read_binary_file(dir / fmt::format("{}.bin", i)),
+              std::vector<u8>(100000, i));
+  }
+  fs::remove_all(dir);
+}
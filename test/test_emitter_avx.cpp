@@ -304,6 +304,70 @@ TEST(EmitterAVX, DivVF) {
             "C5E05EDBC4C1605EDDC5905EDBC4C1105EDDC5605EEBC441605EEDC5105EEBC441105EED");
 }
 
+TEST(EmitterAVX, FmaddVF231) {
+  CodeTester tester;
+  tester.init_code_buffer(1024);
+  tester.emit(IGen::fmadd231_vf(XMM0 + 3, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 3, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 3, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 3, XMM0 + 13, XMM0 + 13));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 13, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 13, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 13, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fmadd231_vf(XMM0 + 13, XMM0 + 13, XMM0 + 13));
+
+  EXPECT_EQ(tester.dump_to_hex_string(true),
+            "C4E261B8DBC4C261B8DDC4E211B8DBC4C211B8DDC46261B8EBC44261B8EDC46211B8EBC44211B8ED");
+}
+
+TEST(EmitterAVX, FmaddVF213) {
+  CodeTester tester;
+  tester.init_code_buffer(1024);
+  tester.emit(IGen::fmadd213_vf(XMM0 + 3, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 3, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 3, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 3, XMM0 + 13, XMM0 + 13));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 13, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 13, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 13, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fmadd213_vf(XMM0 + 13, XMM0 + 13, XMM0 + 13));
+
+  EXPECT_EQ(tester.dump_to_hex_string(true),
+            "C4E261A8DBC4C261A8DDC4E211A8DBC4C211A8DDC46261A8EBC44261A8EDC46211A8EBC44211A8ED");
+}
+
+TEST(EmitterAVX, FnmaddVF231) {
+  CodeTester tester;
+  tester.init_code_buffer(1024);
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 3, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 3, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 3, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 3, XMM0 + 13, XMM0 + 13));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 13, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 13, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 13, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fnmadd231_vf(XMM0 + 13, XMM0 + 13, XMM0 + 13));
+
+  EXPECT_EQ(tester.dump_to_hex_string(true),
+            "C4E261BCDBC4C261BCDDC4E211BCDBC4C211BCDDC46261BCEBC44261BCEDC46211BCEBC44211BCED");
+}
+
+TEST(EmitterAVX, FnmaddVF213) {
+  CodeTester tester;
+  tester.init_code_buffer(1024);
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 3, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 3, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 3, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 3, XMM0 + 13, XMM0 + 13));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 13, XMM0 + 3, XMM0 + 3));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 13, XMM0 + 3, XMM0 + 13));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 13, XMM0 + 13, XMM0 + 3));
+  tester.emit(IGen::fnmadd213_vf(XMM0 + 13, XMM0 + 13, XMM0 + 13));
+
+  EXPECT_EQ(tester.dump_to_hex_string(true),
+            "C4E261ACDBC4C261ACDDC4E211ACDBC4C211ACDDC46261ACEBC44261ACEDC46211ACEBC44211ACED");
+}
+
 TEST(EmitterAVX, SqrtVF) {
   CodeTester tester;
   tester.init_code_buffer(1024);
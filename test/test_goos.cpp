@@ -3,6 +3,8 @@
  * Tests for the GOOS macro language.
  */
 
+#include <thread>
+
 #include "common/goos/Interpreter.h"
 
 #include "gtest/gtest.h"
@@ -1304,4 +1306,30 @@ TEST(GoosBuiltins, HashTable) {
   EXPECT_EQ(e(i, "(cdr (hash-table-try-ref ht \"foo\"))"), "123");
   e(i, "(hash-table-set! ht \"foo\" 456)");
   EXPECT_EQ(e(i, "(cdr (hash-table-try-ref ht \"foo\"))"), "456");
-}
\ No newline at end of file
+}
+
+TEST(GoosObjects, FreeOnOtherThread) {
+  // lists built on one thread and freed on another, with the other thread exiting while its free
+  // list still has blocks in it.
+  for (int round = 0; round < 4; round++) {
+    std::vector<Object> items;
+    for (int i = 0; i < 5000; i++) {
+      items.push_back(StringObject::make_new(std::to_string(i)));
+    }
+    Object list = build_list(items);
+    items.clear();
+    std::thread t([&]() {
+      EXPECT_EQ(list.as_pair()->car.as_string()->data, "0");
+      list = Object::make_empty_list();
+    });
+    t.join();
+  }
+
+  // blocks handed back by the exited threads get used again.
+  std::vector<Object> items;
+  for (int i = 0; i < 5000; i++) {
+    items.push_back(Object::make_integer(i));
+  }
+  Object list = build_list(items);
+  EXPECT_EQ(list.print().substr(0, 8), "(0 1 2 3");
+}
@@ -1,7 +1,10 @@
 #include "common/goos/ParseHelpers.h"
 #include "common/goos/Reader.h"
+#include "common/type_system/TypeSearchIndex.h"
 #include "common/type_system/TypeSystem.h"
+#include "common/type_system/defenum.h"
 #include "common/type_system/deftype.h"
+#include "common/util/Serializer.h"
 
 #include "gtest/gtest.h"
 
@@ -48,7 +51,7 @@ TEST(TypeSystemReverse, NestedInlineWeird) {
   ts.add_builtin_types(GameVersion::Jak1);
   goos::Reader reader;
   auto add_type = [&](const std::string& str) {
-    auto& in = reader.read_from_string(str).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
+    auto in = reader.read_from_string(str).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
     parse_deftype(in, &ts);
   };
 
@@ -482,7 +485,7 @@ TEST(Deftype, deftype) {
       "(deftype my-type (basic) ((f1 int64) (f2 string) (f3 int8) (f4 type :inline) (f5 uint64 "
       ":overlay-at f1)))";
   goos::Reader reader;
-  auto& in = reader.read_from_string(input).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
+  auto in = reader.read_from_string(input).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
   auto result = parse_deftype(in, &ts);
 
   auto& f = dynamic_cast<StructureType*>(ts.lookup_type(result.type))->fields();
@@ -525,4 +528,117 @@ TEST(Deftype, deftype) {
   EXPECT_EQ(f5.is_inline(), false);
 }
 
+TEST(TypeSystem, Serialize) {
+  TypeSystem ts;
+  ts.add_builtin_types(GameVersion::Jak1);
+  goos::Reader reader;
+  auto rest = [&](const std::string& str) {
+    return reader.read_from_string(str).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
+  };
+  parse_deftype(rest("(deftype rgba (uint32) ((r uint8 :offset 0) (a uint8 :offset 24)))"), &ts);
+  parse_deftype(rest("(deftype my-type (basic) ((f1 int64) (f2 string) (f3 rgba 4)))"), &ts);
+  ts.declare_method("my-type", "my-method", std::optional<std::string>("doc"), false,
+                    ts.make_function_typespec({"_type_", "int"}, "rgba"), false);
+  DefinitionMetadata meta;
+  parse_defenum(rest("(defenum my-enum :type uint8 (one 1) (two 2))"), &ts, &meta);
+  ts.forward_declare_type_as("fwd-type", "basic");
+
+  Serializer save;
+  ts.serialize(save);
+  auto [data, size] = save.get_save_result();
+
+  TypeSystem loaded;
+  Serializer load(data, size);
+  loaded.serialize(load);
+  EXPECT_TRUE(load.get_load_finished());
+
+  auto names = ts.get_all_type_names();
+  EXPECT_EQ(names.size(), loaded.get_all_type_names().size());
+  for (auto& name : names) {
+    auto* original = ts.lookup_type_allow_partial_def(name);
+    auto* copy = loaded.lookup_type_allow_partial_def(name);
+    // null types are only equal to themselves.
+    if (!dynamic_cast<NullType*>(original)) {
+      EXPECT_TRUE(*original == *copy) << name;
+    }
+    EXPECT_EQ(original->print(), copy->print());
+  }
+  EXPECT_TRUE(loaded.partially_defined_type_exists("fwd-type"));
+  EXPECT_FALSE(loaded.fully_defined_type_exists("fwd-type"));
+  EXPECT_EQ(loaded.lookup_method("my-type", "my-method").type.print(),
+            "(function _type_ int rgba)");
+  EXPECT_EQ(loaded.try_enum_lookup("my-enum")->entries().at("two"), 2);
+  EXPECT_EQ(loaded.lookup_bitfield_info("rgba", "a").offset, 24);
+}
+
+TEST(TypeSystem, SearchIndex) {
+  TypeSystem ts;
+  ts.add_builtin_types(GameVersion::Jak1);
+  goos::Reader reader;
+  auto rest = [&](const std::string& str) {
+    return reader.read_from_string(str).as_pair()->cdr.as_pair()->car.as_pair()->cdr;
+  };
+  parse_deftype(rest("(deftype thing (basic) ((a int16 :offset 4) (b int16) (c float)))"), &ts);
+  parse_deftype(
+      rest("(deftype big-thing (thing) ((d int16 :offset 14)) (:methods (m1 (_type_) none)))"),
+      &ts);
+  parse_deftype(rest("(deftype other (structure) ((a int16 :offset 4)))"), &ts);
+
+  TypeSearchIndex built(ts);
+  Serializer save;
+  built.serialize(save);
+  auto [data, size] = save.get_save_result();
+  TypeSearchIndex index;
+  Serializer load(data, size);
+  index.serialize(load);
+  EXPECT_TRUE(load.get_load_finished());
+  EXPECT_EQ(index.all_type_names().size(), ts.get_all_type_names().size());
+
+  auto sorted = [](std::vector<std::string> names) {
+    std::sort(names.begin(), names.end());
+    return names;
+  };
+
+  TypeSearchIndex::Query by_parent;
+  by_parent.parent = "thing";
+  EXPECT_EQ(index.search(by_parent), std::vector<std::string>({"big-thing", "thing"}));
+  by_parent.parent = "structure";
+  auto structures = index.search(by_parent);
+  for (auto& name : structures) {
+    EXPECT_TRUE(ts.tc(TypeSpec("structure"), TypeSpec(name))) << name;
+  }
+  EXPECT_EQ(std::count(structures.begin(), structures.end(), "other"), 1);
+  EXPECT_EQ(std::count(structures.begin(), structures.end(), "string"), 1);
+
+  TypeSearchIndex::Query by_method;
+  by_method.min_method_id = 9;
+  EXPECT_EQ(index.search(by_method), sorted(ts.search_types_by_minimum_method_id(9)));
+
+  TypeSearchIndex::Query by_size;
+  by_size.min_size = 8;
+  by_size.max_size = 16;
+  EXPECT_EQ(index.search(by_size), sorted(ts.search_types_by_size(8, 16)));
+  by_size.max_size = {};
+  EXPECT_EQ(index.search(by_size), sorted(ts.search_types_by_size(8, {})));
+
+  TypeSearchIndex::Query by_fields;
+  by_fields.fields = {{"int16", 4}};
+  EXPECT_EQ(index.search(by_fields), std::vector<std::string>({"big-thing", "other", "thing"}));
+  by_fields.fields->push_back({"int16", 14});
+  EXPECT_EQ(index.search(by_fields), std::vector<std::string>({"big-thing"}));
+
+  TypeSearchIndex::Query combined;
+  combined.parent = "thing";
+  combined.min_size = 12;
+  combined.max_size = 16;
+  combined.fields = {{"int16", 6}};
+  EXPECT_EQ(index.search(combined), std::vector<std::string>({"big-thing", "thing"}));
+  combined.min_method_id = 9;
+  EXPECT_EQ(index.search(combined), std::vector<std::string>({"big-thing"}));
+
+  TypeSearchIndex::Query unknown_parent;
+  unknown_parent.parent = "not-a-type";
+  EXPECT_TRUE(index.search(unknown_parent).empty());
+}
+
 // TODO - a big test to make sure all the builtin types are what we expect.
@@ -0,0 +1,235 @@
+#include <cstring>
+#include <random>
+
+#include "game/common/vu.h"
+
+#include "gtest/gtest.h"
+
+// The masked Vf/Accumulator ops are vectorized. These check them against the per-lane definition
+// they replaced, bit for bit, for every mask.
+
+namespace {
+bool lane(int mask, int i) {
+  return mask & (1 << i);
+}
+
+u32 bits(float f) {
+  u32 result;
+  memcpy(&result, &f, 4);
+  return result;
+}
+
+void expect_same(const Vf& expected, const Vf& actual, int mask) {
+  for (int i = 0; i < 4; i++) {
+    EXPECT_EQ(bits(expected[i]), bits(actual[i])) << "mask " << mask << " lane " << i;
+  }
+}
+
+class VuOps : public ::testing::Test {
+ protected:
+  Vf random_vf() {
+    std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
+    Vf result;
+    for (auto& x : result.data) {
+      // mix in some exact ties and zeros of both signs.
+      switch (m_rng() % 8) {
+        case 0:
+          x = 0.f;
+          break;
+        case 1:
+          x = -0.f;
+          break;
+        default:
+          x = dist(m_rng);
+      }
+    }
+    return result;
+  }
+
+  std::mt19937 m_rng{12345};
+};
+}  // namespace
+
+TEST_F(VuOps, Arithmetic) {
+  for (int iter = 0; iter < 200; iter++) {
+    for (int m = 0; m < 16; m++) {
+      const Mask mask = (Mask)m;
+      Vf a = random_vf(), b = random_vf(), dest = random_vf();
+      const float f = a.z();
+
+      Vf expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[i] + b[i];
+        }
+      }
+      actual.add(mask, a, b);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[i] - f;
+        }
+      }
+      actual.sub(mask, a, f);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[i] * b[i];
+        }
+      }
+      actual.mul(mask, a, b);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = vu_max(a[i], b[i]);
+        }
+      }
+      actual.max(mask, a, b);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = vu_min(a[i], b[i]);
+        }
+      }
+      actual.mini(mask, a, b);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[(i + 1) % 4];
+        }
+      }
+      actual.mr32(mask, a);
+      expect_same(expected, actual, m);
+
+      // aliased source and destination
+      expected = a, actual = a;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[(i + 1) % 4];
+        }
+      }
+      actual.mr32(mask, actual);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      u32 expected_flag = 0;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = a[i] + f;
+          if (expected[i] < 0) {
+            expected_flag = 0x2;
+          }
+        }
+      }
+      EXPECT_EQ(expected_flag, actual.add_and_set_sf_s(mask, a, f));
+      expect_same(expected, actual, m);
+    }
+  }
+}
+
+TEST_F(VuOps, Conversions) {
+  for (int iter = 0; iter < 200; iter++) {
+    for (int m = 0; m < 16; m++) {
+      const Mask mask = (Mask)m;
+      Vf a = random_vf(), dest = random_vf();
+
+      Vf expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          s32 val = a.data[i] * 4096.f;
+          memcpy(&expected.data[i], &val, 4);
+        }
+      }
+      actual.ftoi12(mask, a);
+      expect_same(expected, actual, m);
+
+      Vf ints = expected;
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          s32 val;
+          memcpy(&val, &ints.data[i], 4);
+          expected[i] = ((float)val) * (1.f / 4096.f);
+        }
+      }
+      actual.itof12(mask, ints);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          s32 val = a.data[i];
+          memcpy(&expected.data[i], &val, 4);
+        }
+      }
+      actual.ftoi0(mask, a);
+      expect_same(expected, actual, m);
+    }
+  }
+}
+
+TEST_F(VuOps, Accumulator) {
+  for (int iter = 0; iter < 200; iter++) {
+    for (int m = 0; m < 16; m++) {
+      const Mask mask = (Mask)m;
+      Vf a = random_vf(), b = random_vf(), acc_init = random_vf(), dest = random_vf();
+      const float f = b.w();
+
+      Accumulator acc;
+      memcpy(acc.data, acc_init.data, 16);
+      Vf expected = dest, actual = dest;
+      u16 expected_flag = 0;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = acc.data[i] + a[i] * f;
+          if (expected[i] < 0) {
+            expected_flag |= (1 << (3 - i)) << 4;
+          }
+          if (expected[i] == 0) {
+            expected_flag |= (1 << (3 - i));
+          }
+        }
+      }
+      EXPECT_EQ(expected_flag, acc.madd_flag(mask, actual, a, f));
+      expect_same(expected, actual, m);
+
+      expected = acc_init;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] += a[i] * b[i];
+        }
+      }
+      acc.madda(mask, a, b);
+      memcpy(actual.data, acc.data, 16);
+      expect_same(expected, actual, m);
+
+      expected = dest, actual = dest;
+      for (int i = 0; i < 4; i++) {
+        if (lane(m, i)) {
+          expected[i] = acc.data[i] - a[i] * f;
+        }
+      }
+      acc.msub(mask, actual, a, f);
+      expect_same(expected, actual, m);
+    }
+  }
+}
+
+TEST(Vu, SaturateInfs) {
+  Vf v(INFINITY, -INFINITY, 1.f, -2.f);
+  v.saturate_infs();
+  EXPECT_EQ(v.x(), FLT_MAX);
+  EXPECT_EQ(v.y(), -FLT_MAX);
+  EXPECT_EQ(v.z(), 1.f);
+  EXPECT_EQ(v.w(), -2.f);
+}
@@ -1,10 +1,18 @@
+#include <algorithm>
 #include <cstdio>
+#include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/common_types.h"
+#include "common/custom_data/Fr3File.h"
+#include "common/util/FileUtil.h"
+#include "common/util/MappedFile.h"
+#include "common/util/Serializer.h"
 #include "common/util/compress.h"
 
+#include "fmt/core.h"
 #include "gtest/gtest.h"
 #include "test/all_jak1_symbols.h"
 
@@ -56,4 +64,193 @@ TEST(ZSTD, CommonLibrary) {
   }
 
   EXPECT_TRUE(compressed.size() < 0.5 * all.size());
-}
\ No newline at end of file
+}
+TEST(ZSTD, StreamingFileReader) {
+  std::string all;
+  for (auto& x : all_syms) {
+    all.append(x);
+    all.append("\n");
+  }
+
+  auto compressed = compression::compress_zstd(all.data(), all.size());
+  const auto path = fs::temp_directory_path() / "opengoal-test-zstd-stream.bin";
+  file_util::write_binary_file(path, compressed.data(), compressed.size());
+
+  {
+    compression::ZstdFileReader reader(path);
+    ASSERT_EQ(reader.decompressed_size(), all.size());
+
+    // read in uneven pieces, through a streaming serializer.
+    Serializer ser([&](void* dst, size_t size) { reader.read(dst, size); },
+                   reader.decompressed_size());
+    std::string result(all.size(), '\0');
+    size_t offset = 0;
+    size_t chunk = 1;
+    while (offset < result.size()) {
+      size_t size = std::min(chunk, result.size() - offset);
+      ser.from_raw_data(result.data() + offset, size);
+      offset += size;
+      chunk = chunk * 3 + 1;
+    }
+    EXPECT_TRUE(ser.get_load_finished());
+    EXPECT_EQ(all, result);
+  }
+
+  fs::remove(path);
+}
+
+TEST(ZSTD, Seekable) {
+  std::string all;
+  for (auto& x : all_syms) {
+    all.append(x);
+    all.append("\n");
+  }
+
+  // small frames, so reads cover several of them.
+  auto compressed = compression::compress_zstd_seekable(all.data(), all.size(), 4096);
+  compression::ZstdSeekableReader reader(compressed.data(), compressed.size());
+  ASSERT_EQ(reader.decompressed_size(), all.size());
+  EXPECT_EQ(reader.frame_count(), (all.size() + 4095) / 4096);
+
+  std::string whole(all.size(), '\0');
+  reader.read(0, whole.data(), whole.size());
+  EXPECT_EQ(all, whole);
+
+  // ranges inside one frame, across a frame boundary, and across several frames.
+  for (auto [offset, size] : std::vector<std::pair<size_t, size_t>>{
+           {10, 100}, {4000, 200}, {5000, 20000}, {all.size() - 7, 7}, {123, 0}}) {
+    std::string part(size, '\0');
+    reader.read(offset, part.data(), size);
+    EXPECT_EQ(all.substr(offset, size), part);
+  }
+
+  // it's still a normal zstd stream.
+  std::string decompressed(all.size(), '\0');
+  auto result = ZSTD_decompress(decompressed.data(), decompressed.size(), compressed.data(),
+                                compressed.size());
+  ASSERT_FALSE(ZSTD_isError(result));
+  EXPECT_EQ(all, decompressed);
+}
+
+TEST(ZSTD, Parallel) {
+  // big enough for a few frames.
+  std::string all;
+  while (all.size() < 3 * compression::kSeekableFrameSize) {
+    for (auto& x : all_syms) {
+      all.append(x);
+      all.append("\n");
+    }
+  }
+
+  auto compressed = compression::compress_zstd_parallel(all.data(), all.size());
+  auto decompressed = compression::decompress_zstd(compressed.data(), compressed.size());
+  EXPECT_EQ(all, std::string(decompressed.begin(), decompressed.end()));
+
+  const auto path = fs::temp_directory_path() / "opengoal-test-zstd-parallel.bin";
+  file_util::write_binary_file(path, compressed.data(), compressed.size());
+  {
+    compression::ZstdFileReader reader(path);
+    ASSERT_EQ(reader.decompressed_size(), all.size());
+    std::string result(all.size(), '\0');
+    reader.read(result.data(), result.size());
+    EXPECT_EQ(all, result);
+  }
+  fs::remove(path);
+}
+
+TEST(ZSTD, Dictionary) {
+  // small buffers that look alike, which is what dictionaries are for.
+  std::vector<std::string> samples;
+  for (int i = 0; i < 20; i++) {
+    std::string sample;
+    for (int j = 0; j < 8; j++) {
+      sample += fmt::format("{} {}\n", all_syms[(i * 8 + j) % std::size(all_syms)], i);
+    }
+    samples.push_back(sample);
+  }
+  std::string dict_text;
+  for (auto& x : all_syms) {
+    dict_text.append(x);
+    dict_text.append("\n");
+  }
+  const std::vector<u8> dictionary(dict_text.begin(), dict_text.end());
+
+  compression::ZstdCompressor compressor;
+  compression::ZstdCompressor with_dictionary;
+  with_dictionary.set_dictionary(dictionary);
+  compression::ZstdDecompressor decompressor;
+  decompressor.set_dictionary(dictionary);
+
+  size_t plain_size = 0, dictionary_size = 0;
+  for (auto& sample : samples) {
+    plain_size += compressor.compress(sample.data(), sample.size()).size();
+    auto compressed = with_dictionary.compress(sample.data(), sample.size());
+    dictionary_size += compressed.size();
+    auto decompressed = decompressor.decompress(compressed.data(), compressed.size());
+    EXPECT_EQ(sample, std::string(decompressed.begin(), decompressed.end()));
+  }
+  EXPECT_LT(dictionary_size, plain_size);
+}
+
+TEST(ZSTD, MappedFile) {
+  std::vector<u8> data(3 * 4096 + 123);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = i * 7;
+  }
+  const auto path = fs::temp_directory_path() / "opengoal-test-mapped.bin";
+  file_util::write_binary_file(path, data.data(), data.size());
+  {
+    MappedFile file(path, MappedFile::Access::SEQUENTIAL);
+    EXPECT_TRUE(file.is_mapped());
+    ASSERT_EQ(file.size(), data.size());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), file.data()));
+  }
+
+  file_util::write_binary_file(path, nullptr, 0);
+  {
+    MappedFile file(path);
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_TRUE(file.span().empty());
+  }
+  fs::remove(path);
+}
+
+TEST(ZSTD, Fr3RoundTrip) {
+  tfrag3::Level level;
+  level.level_name = "test-level";
+  // one texture that compresses well and one that doesn't, so the block format has both kinds of
+  // block, and both span several blocks.
+  std::mt19937 rng(1234);
+  for (int i = 0; i < 2; i++) {
+    auto& tex = level.textures.emplace_back();
+    tex.w = 1024;
+    tex.h = 768;
+    tex.debug_name = fmt::format("tex-{}", i);
+    tex.data.resize(tex.w * tex.h);
+    for (size_t j = 0; j < tex.data.size(); j++) {
+      tex.data[j] = i == 0 ? (j / 64) : rng();
+    }
+  }
+  Serializer ser;
+  level.serialize(ser);
+  const auto serialized = ser.get_save_result();
+
+  const auto path = fs::temp_directory_path() / "opengoal-test-level.fr3";
+  for (auto format :
+       {tfrag3::Fr3Format::ZSTD, tfrag3::Fr3Format::BLOCKS, tfrag3::Fr3Format::UNCOMPRESSED}) {
+    auto file_data = tfrag3::make_fr3_file(serialized.first, serialized.second, format);
+    file_util::write_binary_file(path, file_data.data(), file_data.size());
+
+    tfrag3::Level result;
+    tfrag3::read_fr3_file(path, result);
+    EXPECT_EQ(result.level_name, level.level_name);
+    ASSERT_EQ(result.textures.size(), level.textures.size());
+    for (size_t i = 0; i < level.textures.size(); i++) {
+      EXPECT_EQ(result.textures[i].w, level.textures[i].w);
+      EXPECT_EQ(result.textures[i].h, level.textures[i].h);
+      EXPECT_EQ(result.textures[i].debug_name, level.textures[i].debug_name);
+      EXPECT_TRUE(result.textures[i].data == level.textures[i].data);
+    }
+  }
+  fs::remove(path);
+}
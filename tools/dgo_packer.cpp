@@ -1,7 +1,9 @@
 #include <cstdio>
+#include <cstdlib>
 
-#include "common/util/BinaryWriter.h"
+#include "common/util/DgoWriter.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/unicode_util.h"
 #include "common/versions/versions.h"
 
@@ -13,44 +15,42 @@ int main(int argc, char** argv) {
   printf("OpenGOAL version %d.%d\n", versions::GOAL_VERSION_MAJOR, versions::GOAL_VERSION_MINOR);
   printf("DGO Packing Tool\n");
 
-  if (argc < 3) {
-    printf("usage: dgo_packer <path> <dgo description file>\n");
-    return 1;
+  int first_arg = 1;
+  int jobs = 1;
+  if (argc > 2 && std::string(argv[1]) == "-j") {
+    jobs = std::atoi(argv[2]);
+    first_arg = 3;
   }
 
-  std::string out_path = argv[1];
-
-  for (int i = 2; i < argc; i++) {
-    std::string file_name = argv[i];
-    std::string file_text = file_util::read_text_file(file_name);
-
-    auto x = nlohmann::json::parse(file_text);
-    std::string out_file_name = x["file_name"];
-    std::string internal_name = x["internal_name"];
-    printf("Packing %s\n", internal_name.c_str());
-
-    BinaryWriter writer;
-    writer.add<u32>(x["objects"].size());
-    writer.add_cstr_len(x["internal_name"].get<std::string>().c_str(), 60);
-
-    for (auto& entry : x["objects"]) {
-      auto obj_data =
-          file_util::read_binary_file(file_util::combine_path(out_path, entry["unique_name"]));
-      auto aligned_size = ((obj_data.size() + 15) / 16) * 16;
-      // size
-      writer.add<uint32_t>(aligned_size);
-      // name
-      writer.add_str_len(entry["internal_name"].get<std::string>().c_str(), 60);
-      // data
-      writer.add_data(obj_data.data(), obj_data.size());
-      // pad
-      while (writer.get_size() & 15) {
-        writer.add<uint8_t>(0);
-      }
-    }
-    writer.write_to_file(file_util::combine_path(out_path, "mod_" + out_file_name));
+  if (argc < first_arg + 2 || jobs < 1) {
+    printf("usage: dgo_packer [-j <jobs>] <path> <dgo description files>\n");
+    return 1;
   }
 
+  std::string out_path = argv[first_arg];
+  std::vector<std::string> file_names(argv + first_arg + 1, argv + argc);
+
+  ThreadPool::global().parallel_for(
+      file_names.size(),
+      [&](int i) {
+        std::string file_text = file_util::read_text_file(file_names[i]);
+
+        auto x = nlohmann::json::parse(file_text);
+        std::string out_file_name = x["file_name"];
+        std::string internal_name = x["internal_name"];
+        printf("Packing %s\n", internal_name.c_str());
+
+        // objects are copied from their mapped file straight to the output.
+        DgoFileWriter writer(file_util::combine_path(out_path, "mod_" + out_file_name),
+                             internal_name, x["objects"].size());
+        for (auto& entry : x["objects"]) {
+          writer.add_object_file(entry["internal_name"].get<std::string>(),
+                                 file_util::combine_path(out_path, entry["unique_name"]), true);
+        }
+        writer.finish();
+      },
+      jobs);
+
   printf("Done\n");
   return 0;
 }
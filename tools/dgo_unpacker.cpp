@@ -1,8 +1,12 @@
 #include <cstdio>
+#include <cstdlib>
+#include <memory>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "common/util/DgoReader.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/unicode_util.h"
 #include "common/versions/versions.h"
 
@@ -11,39 +15,58 @@ int run(int argc, char** argv) {
   printf("OpenGOAL version %d.%d\n", versions::GOAL_VERSION_MAJOR, versions::GOAL_VERSION_MINOR);
   printf("DGO Unpacking Tool\n");
 
-  if (argc < 3) {
-    printf("usage: dgo_unpacker <output path> <dgo files>\n");
+  int first_arg = 1;
+  int jobs = 1;
+  if (argc > 2 && std::string(argv[1]) == "-j") {
+    jobs = std::atoi(argv[2]);
+    first_arg = 3;
+  }
+
+  if (argc < first_arg + 2 || jobs < 1) {
+    printf("usage: dgo_unpacker [-j <jobs>] <output path> <dgo files>\n");
     return 1;
   }
 
-  std::string out_path = argv[1];
-
-  for (int i = 2; i < argc; i++) {
-    std::string file_name = argv[i];
-    std::string base = file_util::base_name(file_name);
-    printf("Unpacking %s\n", base.c_str());
-    // read the file
-    auto data = file_util::read_binary_file(file_name);
-    if (file_util::dgo_header_is_compressed(data)) {
-      printf(" Detected compressed dgo, decompressing...\n");
-      auto original_size = data.size();
-      data = file_util::decompress_dgo(data);
-      printf(" Decompressed from %d to %d bytes (%.2f%% compression)\n", int(original_size),
-             int(data.size()), 100.f * original_size / data.size());
-    }
-    // read as a DGO
-    auto dgo = DgoReader(base, data);
-    // write dgo description
-    file_util::create_dir_if_needed(out_path);
-    file_util::write_text_file(file_util::combine_path(out_path, base + ".txt"),
-                               dgo.description_as_json());
-    // write files:
-    for (auto& entry : dgo.entries()) {
-      file_util::write_binary_file(file_util::combine_path(out_path, entry.unique_name),
-                                   (const void*)entry.data.data(), entry.data.size());
+  std::string out_path = argv[first_arg];
+  std::vector<std::string> file_names(argv + first_arg + 1, argv + argc);
+  file_util::create_dir_if_needed(out_path);
+
+  // map all the DGOs first. Entries are views of the mapped files, so this is cheap.
+  std::vector<std::unique_ptr<DgoReader>> dgos(file_names.size());
+  ThreadPool::global().parallel_for(
+      file_names.size(),
+      [&](int i) {
+        std::string base = file_util::base_name(file_names[i]);
+        dgos[i] = std::make_unique<DgoReader>(fs::path(file_names[i]));
+        printf("Unpacking %s%s\n", base.c_str(),
+               dgos[i]->was_compressed() ? " (decompressed)" : "");
+        // write dgo description
+        file_util::write_text_file(file_util::combine_path(out_path, base + ".txt"),
+                                   dgos[i]->description_as_json());
+      },
+      jobs);
+
+  // if different DGOs have an object with the same name, the last DGO on the command line wins.
+  std::unordered_map<std::string, size_t> owner;
+  for (size_t i = 0; i < dgos.size(); i++) {
+    for (auto& entry : dgos[i]->entries()) {
+      owner[entry.unique_name] = i;
     }
   }
 
+  // write files:
+  ThreadPool::global().parallel_for(
+      dgos.size(),
+      [&](int i) {
+        for (auto& entry : dgos[i]->entries()) {
+          if (owner.at(entry.unique_name) == (size_t)i) {
+            file_util::write_binary_file(file_util::combine_path(out_path, entry.unique_name),
+                                         entry.data.data(), entry.data.size());
+          }
+        }
+      },
+      jobs);
+
   printf("Done\n");
   return 0;
 }
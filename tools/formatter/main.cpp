@@ -4,11 +4,13 @@
 // - parent-types
 // - ...
 
+#include <atomic>
 #include <queue>
 
 #include "common/formatter/formatter.h"
 #include "common/log/log.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
 #include "common/util/json_util.h"
 #include "common/util/string_util.h"
 #include "common/util/term_util.h"
@@ -21,6 +23,33 @@
 #include "third-party/CLI11.hpp"
 #include "third-party/json.hpp"
 
+enum class FormatResult { Formatted, AlreadyFormatted, Failed };
+
+FormatResult format_file(const fs::path& path, bool check, bool write_inplace, bool write_newfile) {
+  const auto source_code = file_util::read_text_file(path);
+  const auto result = formatter::format_code(source_code);
+  if (!result) {
+    lg::error("Could not format file - {}", path.string());
+    return FormatResult::Failed;
+  }
+  // write_text_file adds a new-line at the end, so compare with that
+  if (result.value() + "\n" == source_code) {
+    return FormatResult::AlreadyFormatted;
+  }
+  if (check) {
+    lg::warn("Not formatted - {}", path.string());
+  } else if (write_inplace) {
+    // TODO - i don't like this implementation, return a new string instead
+    file_util::write_text_file(path, result.value());
+  } else if (write_newfile) {
+    auto new_path = path.string();
+    if (str_util::replace(new_path, ".gc", ".new.gc")) {
+      file_util::write_text_file(new_path, result.value());
+    }
+  }
+  return FormatResult::Formatted;
+}
+
 int main(int argc, char** argv) {
   ArgumentGuard u8_guard(argc, argv);
 
@@ -40,7 +69,8 @@ int main(int argc, char** argv) {
   app.add_flag("-n,--new", write_newfile,
                "Whether to write the formatted results into a new file in the same directory, "
                "useful for testing");
-  app.add_option("-f,--file", file_path, "Input file path");
+  app.add_option("-f,--file", file_path,
+                 "Input file path, or a directory to format every .gc file inside of it");
   app.add_option("--config", config_path, "Config file path");
   app.validate_positionals();
   define_common_cli_arguments(app);
@@ -50,23 +80,36 @@ int main(int argc, char** argv) {
     lg::disable_ansi_colors();
   }
 
-  // TODO - support recursing directories
-  // Read in source code
-  const auto source_code = file_util::read_text_file(file_path);
-  const auto result = formatter::format_code(source_code);
-
-  if (result) {
-    // TODO - i don't like this implementation, return a new string instead
-    if (write_inplace) {
-      file_util::write_text_file(file_path, result.value());
-    } else if (write_newfile) {
-      if (str_util::replace(file_path, ".gc", ".new.gc")) {
-        file_util::write_text_file(file_path, result.value());
+  if (fs::is_directory(file_path)) {
+    // Files are independent, so format them all at once
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::recursive_directory_iterator(file_path)) {
+      if (entry.is_regular_file() && entry.path().extension() == ".gc") {
+        files.push_back(entry.path());
       }
     }
-    return 0;
-  } else {
-    lg::error("Could not format file");
+    std::atomic<int> num_formatted = 0;
+    std::atomic<int> num_failed = 0;
+    ThreadPool::global().parallel_for(files.size(), [&](int i) {
+      switch (format_file(files.at(i), check, write_inplace, write_newfile)) {
+        case FormatResult::Formatted:
+          num_formatted++;
+          break;
+        case FormatResult::Failed:
+          num_failed++;
+          break;
+        default:
+          break;
+      }
+    });
+    lg::info("{} files, {} {}, {} could not be formatted", files.size(), num_formatted.load(),
+             check ? "not formatted" : "changed", num_failed.load());
+    return (num_failed > 0 || (check && num_formatted > 0)) ? 1 : 0;
+  }
+
+  const auto result = format_file(file_path, check, write_inplace, write_newfile);
+  if (result == FormatResult::Failed || (check && result == FormatResult::Formatted)) {
     return 1;
   }
+  return 0;
 }
@@ -20,10 +20,8 @@ decompiler::LinkedObjectFile load_bsp_from_dgo(const std::string& file_name,
                                                decompiler::DecompilerTypeSystem& dts) {
   std::string short_name = file_util::base_name(file_name);
   fmt::print("Loading DGO file: {}\n", short_name);
-  auto dgo_file_data = file_util::read_binary_file(file_name);
-
-  auto dgo = DgoReader(short_name, dgo_file_data);
-  auto entries = dgo.entries();
+  auto dgo = DgoReader(fs::path(file_name));
+  const auto& entries = dgo.entries();
   ASSERT(entries.size() > 0);
 
   const auto& level_file = entries.back();
@@ -31,7 +29,8 @@ decompiler::LinkedObjectFile load_bsp_from_dgo(const std::string& file_name,
   fmt::print("Using level file: {}, size {} kB\n", level_file.internal_name,
              level_file.data.size() / 1024);
 
-  return decompiler::to_linked_object_file(level_file.data, level_file.internal_name, dts,
+  std::vector<u8> level_data(level_file.data.begin(), level_file.data.end());
+  return decompiler::to_linked_object_file(level_data, level_file.internal_name, dts,
                                            kGameVersion);
 }
 
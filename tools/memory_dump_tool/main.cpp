@@ -1,3 +1,4 @@
+#include <bit>
 #include <fstream>
 #include <iomanip>
 #include <optional>
@@ -9,6 +10,8 @@
 #include "common/type_system/TypeSystem.h"
 #include "common/util/Assert.h"
 #include "common/util/FileUtil.h"
+#include "common/util/ThreadPool.h"
+#include "common/util/Timer.h"
 #include "common/util/unicode_util.h"
 
 #include "decompiler/util/DecompilerTypeSystem.h"
@@ -17,6 +20,11 @@
 #include "third-party/CLI11.hpp"
 #include "third-party/json.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define SCAN_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 struct Ram {
   const u8* data = nullptr;
   u32 size = 0;
@@ -230,26 +238,155 @@ std::unordered_map<u32, std::string> build_type_map(const Ram& ram,
 const std::vector<std::string> ignored_types = {"symbol", "string", "function", "object",
                                                 "integer"};
 
+/*!
+ * The addresses of the types, in an open addressing hash table that's quick to check a word
+ * against. Type addresses are basic pointers in a small range, so most words can be rejected by
+ * their low bits and range without a lookup.
+ */
+class TypeTagSet {
+ public:
+  explicit TypeTagSet(const std::vector<u32>& tags) {
+    ASSERT(!tags.empty());
+    int bits = 4;
+    while ((1u << bits) < tags.size() * 2) {
+      bits++;
+    }
+    m_shift = 32 - bits;
+    m_slots.resize(1 << bits, 0);  // 0 is never a type
+    m_indices.resize(1 << bits, -1);
+    for (size_t i = 0; i < tags.size(); i++) {
+      m_min = std::min(m_min, tags[i]);
+      m_max = std::max(m_max, tags[i]);
+      u32 slot = slot_of(tags[i]);
+      while (m_slots[slot]) {
+        slot = (slot + 1) & (m_slots.size() - 1);
+      }
+      m_slots[slot] = tags[i];
+      m_indices[slot] = i;
+    }
+  }
+
+  // the index of the tag in the list it was made from, or -1 if it's not a type.
+  int find(u32 tag) const {
+    for (u32 slot = slot_of(tag); m_slots[slot]; slot = (slot + 1) & (m_slots.size() - 1)) {
+      if (m_slots[slot] == tag) {
+        return m_indices[slot];
+      }
+    }
+    return -1;
+  }
+
+  bool maybe_contains(u32 tag) const {
+    return (tag & 7) == BASIC_OFFSET && tag >= m_min && tag <= m_max;
+  }
+
+  u32 min() const { return m_min; }
+  u32 max() const { return m_max; }
+
+ private:
+  u32 slot_of(u32 tag) const { return (tag * 0x9E3779B1u) >> m_shift; }
+
+  int m_shift = 0;
+  u32 m_min = UINT32_MAX;
+  u32 m_max = 0;
+  std::vector<u32> m_slots;
+  std::vector<int> m_indices;
+};
+
+/*!
+ * Find the objects in [start, end), checking the first word of every 16 bytes against the types.
+ * Adds (type index, address) pairs to out, in address order.
+ */
+void scan_region_for_basics(const Ram& ram,
+                            const TypeTagSet& tags,
+                            const std::vector<bool>& ignored,
+                            u32 start,
+                            u32 end,
+                            std::vector<std::pair<int, u32>>* out) {
+  auto check = [&](u32 addr) {
+    u32 tag;
+    memcpy(&tag, ram.data + addr, sizeof(u32));
+    if (tags.maybe_contains(tag)) {
+      int idx = tags.find(tag);
+      if (idx >= 0 && !ignored[idx]) {
+        out->emplace_back(idx, addr);
+      }
+    }
+  };
+
+  u32 addr = start;
+#ifdef SCAN_USE_SSE2
+  // four objects at a time: gather the first word of each 16 bytes and do the low bits and range
+  // checks on all of them. Signed compares, so flip the top bit to compare unsigned.
+  const __m128i low_bits = _mm_set1_epi32(7);
+  const __m128i basic_offset = _mm_set1_epi32(BASIC_OFFSET);
+  const __m128i flip = _mm_set1_epi32(INT32_MIN);
+  const __m128i min = _mm_set1_epi32(tags.min() ^ 0x80000000);
+  const __m128i max = _mm_set1_epi32(tags.max() ^ 0x80000000);
+  for (; addr + 64 <= end; addr += 64) {
+    const auto* src = (const __m128i*)(ram.data + addr);
+    const __m128i ab = _mm_unpacklo_epi32(_mm_loadu_si128(src), _mm_loadu_si128(src + 1));
+    const __m128i cd = _mm_unpacklo_epi32(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3));
+    const __m128i words = _mm_unpacklo_epi64(ab, cd);
+    const __m128i flipped = _mm_xor_si128(words, flip);
+    const __m128i out_of_range =
+        _mm_or_si128(_mm_cmplt_epi32(flipped, min), _mm_cmpgt_epi32(flipped, max));
+    const __m128i basic = _mm_cmpeq_epi32(_mm_and_si128(words, low_bits), basic_offset);
+    u32 mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_andnot_si128(out_of_range, basic)));
+    while (mask) {
+      check(addr + 16 * std::countr_zero(mask));
+      mask &= mask - 1;
+    }
+  }
+#endif
+  for (; addr + 4 <= end; addr += 16) {
+    check(addr);
+  }
+}
+
 std::unordered_map<std::string, std::vector<u32>> find_basics(
     const Ram& ram,
     const std::unordered_map<u32, std::string>& type_map) {
-  lg::info("Scanning memory for objects. This may take a while...");
+  lg::info("Scanning memory for objects...");
+  Timer timer;
 
   std::unordered_map<std::string, std::vector<u32>> result;
-  int total_objects = 0;
-
-  for (u32 addr = (1 << 20); addr < ram.size; addr += 16) {
-    u32 tag = ram.word(addr);
-    auto iter = type_map.find(tag);
+  if (type_map.empty()) {
+    return result;
+  }
+  std::vector<u32> tags;
+  std::vector<const std::string*> names;
+  std::vector<bool> ignored;
+  for (const auto& [tag, name] : type_map) {
+    tags.push_back(tag);
+    names.push_back(&name);
     // ignore the stupid types.
-    if (iter != type_map.end() && std::find(ignored_types.begin(), ignored_types.end(),
-                                            iter->second) == ignored_types.end()) {
-      result[iter->second].push_back(addr);
+    ignored.push_back(std::find(ignored_types.begin(), ignored_types.end(), name) !=
+                      ignored_types.end());
+  }
+  const TypeTagSet tag_set(tags);
+
+  // split into regions that are scanned in parallel, then put back together in address order.
+  constexpr u32 kRegionSize = 1 << 20;
+  const u32 start = 1 << 20;
+  const int region_count = (ram.size - start + kRegionSize - 1) / kRegionSize;
+  std::vector<std::vector<std::pair<int, u32>>> found(region_count);
+  ThreadPool::global().parallel_for(region_count, [&](int i) {
+    const u32 region_start = start + i * kRegionSize;
+    scan_region_for_basics(ram, tag_set, ignored, region_start,
+                           std::min(ram.size, region_start + kRegionSize), &found[i]);
+  });
+
+  int total_objects = 0;
+  for (const auto& region : found) {
+    for (const auto& [type_idx, addr] : region) {
+      result[*names[type_idx]].push_back(addr);
       total_objects++;
     }
   }
 
-  lg::info("Got {} objects of {} unique types\n", total_objects, result.size());
+  lg::info("Got {} objects of {} unique types in {:.1f} ms\n", total_objects, result.size(),
+           timer.getMs());
   return result;
 }
 
@@ -609,14 +746,16 @@ void inspect_symbols(const Ram& ram,
 int main(int argc, char** argv) {
   ArgumentGuard u8_guard(argc, argv);
 
-  fs::path dump_path;
+  std::vector<fs::path> dump_paths;
   fs::path output_path;
   std::string game_name = "jak1";
 
   lg::initialize();
 
   CLI::App app{"OpenGOAL Memory Dump Analyzer"};
-  app.add_option("dump-path", dump_path, "The path to the dump file to analyze")->required();
+  app.add_option("dump-path", dump_paths,
+                 "The path to the dump file to analyze. Several dumps add up in the results")
+      ->required();
   app.add_option("--output-path", output_path,
                  "Where the output files should be sent, defaults to current directory otherwise");
   app.add_option("-g,--game", game_name, "Specify the game name, defaults to 'jak1'");
@@ -651,40 +790,6 @@ int main(int argc, char** argv) {
     output_folder = "./";
   }
 
-  if (dump_path.extension() == "p2s") {
-    lg::error("PCSX2 savestates are not directly supported. Please extract contents beforehand");
-    return 1;
-  }
-
-  lg::info("Loading memory from '{}'", dump_path.string());
-  auto data = file_util::read_binary_file(dump_path);
-
-  u32 one_mb = (1 << 20);
-
-  if (data.size() == 32 * one_mb) {
-    lg::info("Got 32MB file");
-  } else if (data.size() == 128 * one_mb) {
-    lg::info("Got 128MB file");
-  } else if (data.size() == 127 * one_mb) {
-    lg::warn("Got a 127MB file. Assuming this is a dump with the first 1 MB missing.\n");
-    data.insert(data.begin(), one_mb, 0);
-    if (data.size() != 128 * one_mb) {
-      lg::error("it was not!");
-      return 1;
-    }
-  } else {
-    lg::error("Invalid size: {} bytes", data.size());
-    return 1;
-  }
-
-  Ram ram(data.data(), data.size());
-
-  u32 s7 = scan_for_symbol_table(ram, game_version, one_mb, 2 * one_mb);
-  if (!s7) {
-    lg::error("Failed to find symbol table");
-    return 1;
-  }
-
   nlohmann::json results;
   auto json_path = fmt::format("ee-results-{}.json", game_name);
   if (fs::exists(output_folder / json_path)) {
@@ -693,15 +798,51 @@ int main(int argc, char** argv) {
     i >> results;
   }
 
-  auto symbol_map = build_symbol_map(game_version, ram, s7);
-  auto types = build_type_map(ram, symbol_map, game_version, s7);
-  auto basics = find_basics(ram, types);
+  for (const auto& dump_path : dump_paths) {
+    if (dump_path.extension() == "p2s") {
+      lg::error("PCSX2 savestates are not directly supported. Please extract contents beforehand");
+      return 1;
+    }
+
+    lg::info("Loading memory from '{}'", dump_path.string());
+    auto data = file_util::read_binary_file(dump_path);
+
+    u32 one_mb = (1 << 20);
+
+    if (data.size() == 32 * one_mb) {
+      lg::info("Got 32MB file");
+    } else if (data.size() == 128 * one_mb) {
+      lg::info("Got 128MB file");
+    } else if (data.size() == 127 * one_mb) {
+      lg::warn("Got a 127MB file. Assuming this is a dump with the first 1 MB missing.\n");
+      data.insert(data.begin(), one_mb, 0);
+      if (data.size() != 128 * one_mb) {
+        lg::error("it was not!");
+        return 1;
+      }
+    } else {
+      lg::error("Invalid size: {} bytes", data.size());
+      return 1;
+    }
+
+    Ram ram(data.data(), data.size());
 
-  follow_references_to_find_pointers(ram, dts.ts, basics, s7 + 0x100);
+    u32 s7 = scan_for_symbol_table(ram, game_version, one_mb, 2 * one_mb);
+    if (!s7) {
+      lg::error("Failed to find symbol table");
+      return 1;
+    }
 
-  inspect_basics(ram, basics, types, symbol_map, dts.ts, results);
-  inspect_symbols(ram, types, symbol_map);
-  inspect_process_self(ram, basics, types, dts.ts);
+    auto symbol_map = build_symbol_map(game_version, ram, s7);
+    auto types = build_type_map(ram, symbol_map, game_version, s7);
+    auto basics = find_basics(ram, types);
+
+    follow_references_to_find_pointers(ram, dts.ts, basics, s7 + 0x100);
+
+    inspect_basics(ram, basics, types, symbol_map, dts.ts, results);
+    inspect_symbols(ram, types, symbol_map);
+    inspect_process_self(ram, basics, types, dts.ts);
+  }
 
   if (fs::exists(output_folder / json_path)) {
     fs::remove(output_folder / json_path);
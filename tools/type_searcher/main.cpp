@@ -3,9 +3,15 @@
 // - field types at given offsets
 // - parent-types
 // - ...
+//
+// The searches are done with a TypeSearchIndex, which is saved next to all-types.gc and rebuilt
+// when all-types changes, so most runs don't need to parse all-types at all.
 
 #include "common/log/log.h"
+#include "common/type_system/TypeSearchIndex.h"
 #include "common/util/FileUtil.h"
+#include "common/util/Timer.h"
+#include "common/util/crc32.h"
 #include "common/util/json_util.h"
 #include "common/util/string_util.h"
 #include "common/util/unicode_util.h"
@@ -16,6 +22,103 @@
 #include "third-party/CLI11.hpp"
 #include "third-party/json.hpp"
 
+namespace {
+constexpr u32 kIndexFileMagic = 0x58445354;  // "TSDX"
+
+/*!
+ * Load the index for this all-types file, or build it if it's missing or out of date.
+ */
+TypeSearchIndex load_or_build_index(GameVersion game_version, bool rebuild) {
+  const auto game_name = version_to_game_name(game_version);
+  const auto all_types_path =
+      file_util::get_jak_project_dir() / "decompiler" / "config" / game_name / "all-types.gc";
+  const auto index_path = fs::path(all_types_path).replace_extension(".search-index");
+
+  auto all_types = file_util::read_text_file(all_types_path);
+  u32 source_crc = crc32((const u8*)all_types.data(), all_types.size());
+  u64 source_size = all_types.size();
+
+  if (!rebuild && fs::exists(index_path)) {
+    try {
+      auto data = file_util::read_binary_file(index_path);
+      Serializer ser(data.data(), data.size(), false);
+      if (ser.load<u32>() == kIndexFileMagic && ser.load<u32>() == source_crc &&
+          ser.load<u64>() == source_size) {
+        TypeSearchIndex index;
+        index.serialize(ser);
+        return index;
+      }
+      lg::info("all-types.gc has changed, rebuilding the search index");
+    } catch (std::exception& e) {
+      lg::warn("Failed to load search index {}: {}", index_path.string(), e.what());
+    }
+  }
+
+  lg::info("Loading type definitions from all-types.gc...");
+  Timer timer;
+  decompiler::DecompilerTypeSystem dts(game_version);
+  dts.parse_type_defs({"decompiler", "config", game_name, "all-types.gc"});
+  TypeSearchIndex index(dts.ts);
+
+  Serializer ser;
+  ser.save<u32>(kIndexFileMagic);
+  ser.save<u32>(source_crc);
+  ser.save<u64>(source_size);
+  index.serialize(ser);
+  auto [data, size] = ser.get_save_result();
+  file_util::write_binary_file(index_path, data, size);
+  lg::info("Indexed {} types in {:.2f}s, saved to {}", index.type_count(), timer.getSeconds(),
+           index_path.string());
+  return index;
+}
+
+/*!
+ * The size filter can be a single size, or a range (min-max), in decimal.
+ */
+void parse_size(const std::string& type_size, TypeSearchIndex::Query* query) {
+  if (str_util::contains(type_size, "-")) {
+    auto tokens = str_util::split(type_size, '-');
+    query->min_size = std::stoi(tokens[0]);
+    query->max_size = std::stoi(tokens[1]);
+  } else {
+    query->min_size = std::stoi(type_size);
+  }
+}
+
+void parse_fields(const nlohmann::json& data, TypeSearchIndex::Query* query) {
+  query->fields.emplace();
+  for (auto& item : data) {
+    TypeSystem::TypeSearchFieldInput new_field;
+    try {
+      new_field.field_offset = item.at("offset").get<int>();
+      new_field.field_type_name = item.at("type").get<std::string>();
+      query->fields->push_back(new_field);
+    } catch (std::exception& ex) {
+      fmt::print("Bad field search entry - {}", ex.what());
+    }
+  }
+}
+
+/*!
+ * A query in a --batch file, which has the same options as the command line:
+ * {"parent": "basic", "method_id": 9, "size": "16-32", "fields": [{"offset": 4, "type": "int32"}]}
+ */
+TypeSearchIndex::Query parse_batch_query(const nlohmann::json& json) {
+  TypeSearchIndex::Query query;
+  query.parent = json.value("parent", "");
+  query.min_method_id = json.value("method_id", -1);
+  if (json.contains("size")) {
+    const auto& size = json.at("size");
+    parse_size(size.is_string() ? size.get<std::string>() : std::to_string(size.get<int>()),
+               &query);
+  }
+  if (json.contains("fields")) {
+    parse_fields(json.at("fields"), &query);
+  }
+  return query;
+}
+}  // namespace
+
 int main(int argc, char** argv) {
   ArgumentGuard u8_guard(argc, argv);
 
@@ -26,6 +129,8 @@ int main(int argc, char** argv) {
   std::string type_size = "";
   std::string field_json = "";
   bool get_all = false;
+  fs::path batch_path;
+  bool rebuild_index = false;
 
   lg::initialize();
 
@@ -35,13 +140,19 @@ int main(int argc, char** argv) {
   app.add_option("-g,--game", game_name, "Specify the game name, defaults to 'jak1'");
   app.add_option(
       "-s,--size", type_size,
-      "The size of the type we are searching for, this can be a range (max-min), assumes decimal");
+      "The size of the type we are searching for, this can be a range (min-max), assumes decimal");
   app.add_option("-m,--method_id", method_id_min,
                  "Require the provided method id to be supported by the type");
   app.add_option("-p,--parent", parent_type, "The type of which it is an descendent of");
   app.add_option("-f,--fields", field_json,
                  "JSON encoded string specifying which field types and their offsets are required "
                  "- [{offset,type}]");
+  app.add_option("-b,--batch", batch_path,
+                 "Run every query in this file, one JSON object per line with the keys parent, "
+                 "method_id, size and fields. The output is a list of results, one per query")
+      ->check(CLI::ExistingFile);
+  app.add_flag("--rebuild-index", rebuild_index,
+               "Rebuild the search index, even if all-types hasn't changed");
   app.validate_positionals();
   CLI11_PARSE(app, argc, argv);
 
@@ -50,32 +161,19 @@ int main(int argc, char** argv) {
     lg::error("couldn't setup project path, exiting");
     return 1;
   }
-  lg::info("Loading type definitions from all-types.gc...");
 
+  if (!valid_game_version(game_name)) {
+    lg::error("unsupported game version");
+    return 1;
+  }
   auto game_version = game_name_to_version(game_name);
 
-  decompiler::DecompilerTypeSystem dts(game_version);
-
-  switch (game_version) {
-    case GameVersion::Jak1:
-      dts.parse_type_defs({"decompiler", "config", "jak1", "all-types.gc"});
-      break;
-    case GameVersion::Jak2:
-      dts.parse_type_defs({"decompiler", "config", "jak2", "all-types.gc"});
-      break;
-    case GameVersion::Jak3:
-      dts.parse_type_defs({"decompiler", "config", "jak3", "all-types.gc"});
-      break;
-    default:
-      lg::error("unsupported game version");
-      return 1;
-  }
+  auto index = load_or_build_index(game_version, rebuild_index);
 
   auto results = nlohmann::json::array({});
 
   if (get_all) {
-    auto type_names = dts.ts.get_all_type_names();
-    for (const auto& name : type_names) {
+    for (const auto& name : index.all_type_names()) {
       fmt::print("{}\n", name);
       results.push_back(name);
     }
@@ -85,54 +183,34 @@ int main(int argc, char** argv) {
     return 0;
   }
 
-  std::optional<std::vector<std::string>> potential_types = {};
-
-  // First filter by parent type is available
-  if (!parent_type.empty()) {
-    potential_types = dts.ts.search_types_by_parent_type(parent_type);
-  }
-
-  // Filter by method count
-  if (method_id_min != -1) {
-    potential_types = dts.ts.search_types_by_minimum_method_id(method_id_min, potential_types);
+  if (!batch_path.empty()) {
+    int line_number = 0;
+    for (const auto& line : str_util::split(file_util::read_text_file(batch_path), '\n')) {
+      line_number++;
+      if (str_util::trim(line).empty()) {
+        continue;
+      }
+      auto json = parse_commented_json(line, fmt::format("--batch line {}", line_number));
+      auto matches = index.search(parse_batch_query(json));
+      fmt::print("query {}: {} types\n", line_number, matches.size());
+      results.push_back(matches);
+    }
+    file_util::write_text_file(output_path.string(), results.dump());
+    return 0;
   }
 
-  // Filter out types by size next
+  TypeSearchIndex::Query query;
+  query.parent = parent_type;
+  query.min_method_id = method_id_min;
   if (!type_size.empty()) {
-    // Check if a range was given
-    int min_size = 0;
-    std::optional<int> max_size = {};
-    if (str_util::contains(type_size, "-")) {
-      auto tokens = str_util::split(type_size, '-');
-      min_size = std::stoi(tokens[0]);
-      max_size = std::stoi(tokens[1]);
-    } else {
-      min_size = std::stoi(type_size);
-    }
-    potential_types = dts.ts.search_types_by_size(min_size, max_size, potential_types);
+    parse_size(type_size, &query);
   }
-
-  // Filter out by fields
   if (!field_json.empty()) {
-    std::vector<TypeSystem::TypeSearchFieldInput> search_fields = {};
-    if (!field_json.empty()) {
-      auto data = parse_commented_json(field_json, "--fields arg");
-      for (auto& item : data) {
-        TypeSystem::TypeSearchFieldInput new_field;
-        try {
-          new_field.field_offset = item.at("offset").get<int>();
-          new_field.field_type_name = item.at("type").get<std::string>();
-          search_fields.push_back(new_field);
-        } catch (std::exception& ex) {
-          fmt::print("Bad field search entry - {}", ex.what());
-        }
-      }
-    }
-    potential_types = dts.ts.search_types_by_fields(search_fields, potential_types);
+    parse_fields(parse_commented_json(field_json, "--fields arg"), &query);
   }
 
-  if (potential_types) {
-    for (const auto& val : potential_types.value()) {
+  if (!query.empty()) {
+    for (const auto& val : index.search(query)) {
       fmt::print("{}\n", val);
       results.push_back(val);
     }